@@ -33,6 +33,10 @@
 #include "common/common_defines.h"
 #include "audioio/audioio.h"
 #include <iomanip>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 union u_SNR {
   float f_SNR;
@@ -219,6 +223,8 @@ public:
   void process_messages_tx_control();
   int add_message_tx_data(char type, int length, char* data);
   void process_messages_tx_data();
+  int get_ir_part(int batch_index);
+  int get_harq_rx_key();
 	//! Sends a data or a control message to the other end (via ALSA driver).
 	    /*!
 	     * \param message the st_message structure to be sent.
@@ -427,6 +433,35 @@ private:
   void return_to_last_configuration();
   int init_messages_buffers();
   int deinit_messages_buffers();
+
+  // Batch TX: frames are encoded on batch_encoder into batch_tx_frames, one total_frame_size slot
+  // per frame, while the ones already encoded are filtered and played. The buffers are sized by
+  // init_batch_tx() for the largest batch of the configuration and kept between batches.
+  // While a batch is out, batch_encoder is the only user of telecom_system. The ARQ thread only runs
+  // the FIR_tx1/FIR_tx2 streams, which transmit_byte() leaves alone for NO_FILTER_MESSAGE frames,
+  // and send_batch() returns once the encoder is idle again.
+  double* batch_tx_frames;
+  int batch_tx_frames_size;
+  int* batch_tx_ir_part;  // per frame of the batch
+  int* batch_tx_output_size;  // samples played per frame of the batch
+  int batch_tx_nFrames_max;
+  double* batch_tx_filtered1;
+  double* batch_tx_filtered2;
+  int batch_tx_filtered_size;
+  double* pilot_tone_buffer;  // pilot tone of pilot_tone_ms/pilot_tone_hz, built by init_batch_tx()
+  int pilot_tone_samples;
+  int pilot_tone_buffer_hz;
+  std::thread batch_encoder;  // started once, waits for the next batch between batches
+  std::mutex batch_encoder_mutex;
+  std::condition_variable batch_encoder_cv;
+  int batch_encoder_nFrames;  // frames of the batch handed to batch_encoder, 0 when idle
+  int batch_encoder_frame_slot;
+  int batch_encoder_quit;
+  std::atomic<int> batch_frames_encoded;
+  void init_batch_tx(int nFrames);
+  void batch_encoder_loop();
+  void encode_batch_frame(int index, int ir_part, double* out);
+  void stream_batch_tx(double* in, int nItems, int* position, int play_begin, int play_end);
   void check_buffer_canaries(const char* caller);
 
   char last_received_message_sequence;
@@ -436,6 +471,8 @@ private:
   char last_message_received_type;
   char last_message_received_code;
 
+  int harq_next_id;  // a failed data frame is keyed to the first missing message from this id on
+
   int data_ack_received;
   int repeating_last_ack;
 
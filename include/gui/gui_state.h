@@ -295,7 +295,8 @@ inline void gui_push_audio_samples(const double* samples, int count) {
  * @param modulation Modulation type (MOD_BPSK=2, MOD_QPSK=4, etc.)
  * @param is_mfsk true if current mode is MFSK (no IQ data available)
  */
-inline void gui_push_constellation(const std::complex<double>* iq_data, int count,
+template <typename T>
+inline void gui_push_constellation(const std::complex<T>* iq_data, int count,
                                     int modulation, bool is_mfsk) {
     g_gui_state.constellation_is_mfsk.store(is_mfsk);
     g_gui_state.constellation_modulation.store(modulation);
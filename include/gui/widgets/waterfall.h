@@ -7,6 +7,7 @@
 #define WATERFALL_H_
 
 #include <complex>
+#include "physical_layer/fft.h"
 
 #define WATERFALL_FFT_SIZE 4096
 #define WATERFALL_HISTORY_LINES 500
@@ -70,7 +71,8 @@ public:
 private:
     // FFT processing
     void processFFT();
-    void fft(std::complex<double>* v, int n);
+    cl_fft_plan* fft_plan_;  // Shared real-input plan of WATERFALL_FFT_SIZE points
+    double window_[WATERFALL_FFT_SIZE];  // Hanning window
 
     // Sample buffer for FFT
     double sample_buffer_[WATERFALL_FFT_SIZE];
@@ -24,6 +24,7 @@
 #define INC_AWGN_H_
 
 #include <complex>
+#include "physical_defines.h"
 #include <stdlib.h>
 #include <cmath>
 
@@ -39,8 +40,8 @@ public:
 	~cl_awgn();
 
 	void set_seed(long seed);
-	void apply(std::complex <double> *in,std::complex <double> *out,float ampl,int nItems);
-	void apply_with_delay(std::complex <double> *in,std::complex <double> *out,float ampl,int nItems, int delay);
+	void apply(sample_complex *in,sample_complex *out,float ampl,int nItems);
+	void apply_with_delay(sample_complex *in,sample_complex *out,float ampl,int nItems, int delay);
 	void apply_with_delay(double *in,double *out,float ampl,int nItems, int delay);
 	double  awgn_value_generator();
 
@@ -36,27 +36,27 @@ class cl_data_container
 	cl_data_container();
 	~cl_data_container();
 	int* data_bit;
+	int* data_bit_shadow;  // data_bit as allocated by set_size(), checked by deinit()
 	int* data_bit_energy_dispersal;
 	int* data_byte;
 	int* encoded_data;
 	int* bit_interleaved_data;
-	std::complex <double>* modulated_data;
-	std::complex <double>* ofdm_symbol_modulated_data;
-	std::complex <double>* ofdm_symbol_demodulated_data;
-	std::complex <double>* ofdm_framed_data;
-	std::complex <double>* ofdm_time_freq_interleaved_data;
-	std::complex <double>* ofdm_time_freq_deinterleaved_data;
-	std::complex <double>* ofdm_deframed_data;
-	std::complex <double>* ofdm_deframed_data_without_amplitude_restoration;
-	std::complex <double>* equalized_data;
-	std::complex <double>* equalized_data_without_amplitude_restoration;
-	std::complex <double>* preamble_symbol_modulated_data;
-	std::complex <double>* preamble_data;
+	sample_complex* modulated_data;
+	sample_complex* ofdm_symbol_modulated_data;
+	sample_complex* ofdm_symbol_demodulated_data;
+	sample_complex* ofdm_framed_data;
+	sample_complex* ofdm_time_freq_interleaved_data;
+	sample_complex* ofdm_deframed_data;
+	sample_complex* ofdm_deframed_data_without_amplitude_restoration;
+	sample_complex* equalized_data;
+	sample_complex* equalized_data_without_amplitude_restoration;
+	sample_complex* preamble_symbol_modulated_data;
+	sample_complex* preamble_data;
 	double* passband_data;
 	double* passband_delayed_data;
 	double* ready_to_process_passband_delayed_data;
-	std::complex <double>* baseband_data;
-	std::complex <double>* baseband_data_interpolated;
+	sample_complex* baseband_data;
+	sample_complex* baseband_data_interpolated;
 	float* demodulated_data;
 	float* deinterleaved_data;
 	int* hd_decoded_data_bit;
@@ -71,6 +71,22 @@ class cl_data_container
 
 	int total_frame_size;
 
+	// passband_delayed_data is a mirrored ring of 2*buffer_Nsymb symbols: every captured symbol is
+	// written twice, so the current window of buffer_Nsymb symbols is always contiguous from
+	// passband_delayed_head and appending a symbol costs one symbol of copying.
+	int passband_delayed_head;
+	long long rx_symbol_count; //!< Symbols appended to the capture window so far, identifies a window.
+	long long ready_to_process_symbol_count; //!< rx_symbol_count of the window in ready_to_process_passband_delayed_data, -1 if unknown.
+	// ready_to_process_passband_delayed_data points to the snapshot window in this mirrored ring, so
+	// a snapshot only copies the symbols captured since the previous one.
+	double* ready_to_process_passband_ring;
+	int ready_to_process_head;
+	double* passband_window();
+	void append_passband_symbol(const double* symbol);
+	void snapshot_passband_window();
+	void clear_passband_window();
+	void take_passband_window(cl_data_container* from);
+
 	double* passband_data_tx;
 	double* passband_data_tx_buffer;
 	double* passband_data_tx_filtered_fir_1;
@@ -79,6 +95,13 @@ class cl_data_container
 
 	int *bit_energy_dispersal_sequence;
 
+	// Bit-packed TX pipeline buffers, N_MAX_WORDS words each.
+	uint64_t* data_bit_packed;
+	uint64_t* data_bit_energy_dispersal_packed;
+	uint64_t* encoded_data_packed;
+	uint64_t* bit_interleaved_data_packed;
+	uint64_t* bit_energy_dispersal_sequence_packed;
+
 	void deinit();
 
 
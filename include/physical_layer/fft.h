@@ -0,0 +1,83 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INC_FFT_H_
+#define INC_FFT_H_
+
+#include <complex>
+#include "physical_defines.h"
+#include <cmath>
+#ifdef MERCURY_FFTW
+#include <fftw3.h>
+#ifdef MERCURY_FLOAT_SAMPLES
+#define FFTW(name) fftwf_##name
+#else
+#define FFTW(name) fftw_##name
+#endif
+#endif
+
+#ifndef M_PI
+#define M_PI          3.14159265358979323846  /* pi */
+#endif
+
+#define FFT_FORWARD 0
+#define FFT_INVERSE 1
+
+#define FFT_COMPLEX 0
+#define FFT_REAL 1
+
+// Shared FFT plans, built once per size, direction and type and kept for the life of the process.
+// Transforms are unscaled in both directions. execute() only reads the plan, so one plan may be
+// used by several threads at once. The built-in kernel is radix-4 with a final radix-2 stage and
+// needs a power of two size; building with MERCURY_FFTW (make FFTW_ENABLED=1) runs FFTW instead.
+class cl_fft_plan
+{
+private:
+	cl_fft_plan(int n, int direction, int type);
+	~cl_fft_plan();
+
+	int log2_n;
+	int* bit_rev;
+	sample_complex* twiddle;      //!< [n/2] exp(-+j*2*pi*k/n) in the plan's direction.
+	sample_complex* real_twiddle; //!< [n/4+1] exp(-j*2*pi*k/n) for the real input split.
+	cl_fft_plan* half_plan;              //!< n/2 point complex plan of a real input plan.
+#ifdef MERCURY_FFTW
+	FFTW(plan) fftw;
+#endif
+	void radix4(sample_complex* v) const;
+
+public:
+	static cl_fft_plan* get(int n, int direction);
+	static cl_fft_plan* get_real(int n);
+
+	// Complex plan: in-place n point transform.
+	void execute(sample_complex* v) const;
+	// Real plan: n real samples to the n/2+1 non-negative frequency bins.
+	void execute(const sample_real* in, sample_complex* out) const;
+
+	int n;
+	int direction;
+	int type;
+};
+
+
+#endif
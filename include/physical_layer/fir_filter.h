@@ -25,7 +25,9 @@
 
 #include <cmath>
 #include <complex>
+#include "physical_defines.h"
 #include <iostream>
+#include "fft.h"
 
 #ifndef M_PI
 #define M_PI          3.14159265358979323846  /* pi */
@@ -40,6 +42,9 @@
 #define HPF 1
 #define BPF 2
 
+// Filters with at least this many taps use overlap-save FFT convolution.
+#define FIR_FFT_MIN_TAPS 64
+
 class cl_FIR
 {
 private:
@@ -47,14 +52,40 @@ private:
 	double* filter_coefficients;
 	double filter_cut_frequency;
 
+	// Zero padded copy of the input, (nTaps-1)/2 samples of history and nTaps/2 of lookahead,
+	// or the stream delay line followed by the new input.
+	double* padded_real;
+	sample_complex* padded_complex;
+	int padded_size;
+	void reserve_padded(int nItems);
+
+	// Overlap-save: spectrum of the taps and one FFT block.
+	int fft_size;
+	sample_complex* fft_coefficients;
+	sample_complex* fft_block;
+	cl_fft_plan* fft_forward;
+	cl_fft_plan* fft_inverse;
+	void init_fft();
+	void deinit_fft();
+	void multiply_spectrum();
+
+	double* stream_history;
+
+	// out[k]=sum_j c[j]*in[k+nTaps-1-j], k=0..nOut-1 (fully overlapped convolution).
+	void convolve_valid(const double* in, double* out, int nOut);
+	void convolve_valid(const sample_complex* in, sample_complex* out, int nOut, int stride);
 
 public:
 	cl_FIR();
 	~cl_FIR();
 
 	void design();
-	void apply(std::complex <double>* in, std::complex <double>* out, int nItems);
+	void apply(sample_complex* in, sample_complex* out, int nItems);
+	void apply(const sample_complex* in, sample_complex* out, int nItems, int first, int last);
 	void apply(double* in, double* out, int nItems);
+	void apply_decimate(sample_complex* in, sample_complex* out, int nItems, int decimation_rate);
+	void apply_stream(double* in, double* out, int nItems);
+	void reset_stream();
 	void deinit();
 
 	int filter_window;
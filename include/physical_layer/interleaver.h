@@ -23,14 +23,19 @@
 #ifndef INC_INTERLEAVER_H_
 #define INC_INTERLEAVER_H_
 #include <complex>
+#include "physical_defines.h"
+#include <cstdint>
 
 
 void interleaver(int* in, int* out, int nItems, int block_size);
-void interleaver(std::complex<double>* in, std::complex<double>* out, int nItems, int block_size);
+void interleaver(sample_complex* in, sample_complex* out, int nItems, int block_size);
 void deinterleaver(int* in, int* out, int nItems, int block_size);
 void deinterleaver(float* in, float* out, int nItems, int block_size);
-void deinterleaver(std::complex<double>* in, std::complex<double>* out, int nItems, int block_size);
+void deinterleaver(sample_complex* in, sample_complex* out, int nItems, int block_size);
 
 void bit_energy_dispersal(int* in, int* sequence, int* out, int nItems);
 
+void interleaver(const uint64_t* in, uint64_t* out, int nItems, int block_size);
+void bit_energy_dispersal(const uint64_t* in, const uint64_t* sequence, uint64_t* out, int nItems);
+
 #endif
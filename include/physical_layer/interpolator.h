@@ -26,10 +26,10 @@
 #include "physical_defines.h"
 
 double interpolate_linear(double a,double a_x,double b,double b_x,double x);
-std::complex <double> interpolate_linear(std::complex <double> a,double a_x,std::complex <double> b,double b_x,double x);
+sample_complex interpolate_linear(sample_complex a,double a_x,sample_complex b,double b_x,double x);
 
 double interpolate_bilinear(double a,double a_x,double a_y,double b,double b_x,double b_y,double c,double c_x,double c_y,double d,double d_x,double d_y,double x,double y);
-std::complex <double> interpolate_bilinear(std::complex <double> a,double a_x,double a_y,std::complex <double> b,double b_x,double b_y,std::complex <double> c,double c_x,double c_y,std::complex <double> d,double d_x,double d_y,double x,double y);
+sample_complex interpolate_bilinear(sample_complex a,double a_x,double a_y,sample_complex b,double b_x,double b_y,sample_complex c,double c_x,double c_y,sample_complex d,double d_x,double d_y,double x,double y);
 
 void interpolate_linear_col(st_channel_real* estimated_channel, int max_col, int max_row, int col);
 void interpolate_linear_col(st_channel_complex* estimated_channel, int max_col, int max_row, int col);
@@ -25,23 +25,40 @@
 
 #include "ldpc_decoder_GBF.h"
 #include "ldpc_decoder_SPA.h"
+#include "ldpc_decoder_MS.h"
+#include "ldpc_decoder_LAYERED_MS.h"
+#include "ldpc_decoder_SIMD_MS.h"
 #include "mercury_ldpc.h"
 #include "physical_defines.h"
+#include "worker_pool.h"
 #include <iostream>
+#include <cstdint>
+
+// Per-thread decoder scratch memory, the code tables and graph are shared read only.
+struct st_ldpc_workspace
+{
+	double* R;  // Check-to-variable messages, one per graph edge
+	double* Q;  // Variable-to-check messages, one per graph edge
+	short* simd_R;  // SIMD_MS check-to-variable messages
+	short* simd_L;  // SIMD_MS posterior LLRs
+	int nEdges;  // Size of R and Q
+	int simd_size;  // Size of simd_R
+};
 
 class cl_ldpc
 {
 private:
 	int Cwidth;
 	int Vwidth;
-	int dwidth;
 	int *QCmatrixEnc;
 	int *QCmatrixC;
 	int *QCmatrixV;
-	int *QCmatrixd;
-	double* R;
-	double* Q;
-	int* V_pos;       // Pre-allocated SPA decoder workspace [P*Cwidth]
+	st_ldpc_workspace* workspace;  // One per decoding thread
+	int nWorkspaces;
+	cl_worker_pool pool;  // decode_batch() threads, started by its first call
+	st_ldpc_graph graph;  // Tanner graph compiled from the QC tables at init()
+	st_ldpc_simd_layout simd_layout;  // Row groups of the SIMD_MS decoder
+	int simd_cpu_kernel;  // SIMD_MS kernel picked for the CPU when the row groups were built
 
 
 
@@ -52,12 +69,18 @@ private:
 
 
 	float eta_val;
+	float MS_alpha_val;
+	float MS_beta_val;
 	int nIteration_max_val;
+	int nThreads_val;
 	int print_nIteration_val;
 
 
 
 	int update_code_parameters();
+	void expand_code(const int* QCbase, int nGroups);
+	void build_graph();
+	int decode_codeword(const float* data,  int*  decoded_data, st_ldpc_workspace* ws);
 
 public:
 	cl_ldpc();
@@ -68,7 +91,10 @@ public:
 	float rate;
 	int decoding_algorithm;
 	float GBF_eta; //!< The GBF algorithms correction rate.
+	float MS_alpha; //!< The Min-Sum check node normalization factor.
+	float MS_beta; //!< The Min-Sum check node offset.
 	int nIteration_max; //!< The maximum number of LDPC decoding iterations allowed.
+	int nThreads; //!< The number of threads used by decode_batch(), 0 uses one per hardware thread.
 	int print_nIteration;
 	void init();
 	void deinit();
@@ -81,13 +107,45 @@ public:
 	   */
 	void encode(const int* data, int*  encoded_data);
 
+	//! Bit-packed LDPC encoding, bit i of a message is bit i%64 of word i/64.
+	    /*!
+	      \param data holds the K data bits.
+	      \param encoded_data receives the N code bits, the data followed by the parity, may not alias data.
+	      \return None
+	   */
+	void encode(const uint64_t* data, uint64_t*  encoded_data);
+
 	//! The LDPC decoding function, validates the message integrity and attempts to correct bit errors.
+	//! Decodes on the calling thread with the caller's own scratch memory, so it may overlap decode_batch() or another decode().
 	    /*!
 	      \param data is the received message.
-	      \param encoded_data is the corrected data without the LDPC parity bits.
+	      \param decoded_data is the corrected data without the LDPC parity bits.
+	      \param ws is a workspace fitted to the current code by init_workspace().
 	      \return number of iterations used to decode the message, the message maybe corrupt if this reaches the max number of iterations allowed.
 	   */
-	int decode(const float* data,  int*  decoded_data);
+	int decode(const float* data,  int*  decoded_data, st_ldpc_workspace* ws);
+
+	//! Sizes a workspace for the current code, it is only reallocated when too small. A zeroed workspace starts empty.
+	void init_workspace(st_ldpc_workspace* ws);
+	void deinit_workspace(st_ldpc_workspace* ws);
+
+	//! The LDPC batch decoding function, decodes several messages spread over the decoding threads.
+	//! It uses the decoder's own workspaces and threads: one caller at a time, never concurrently with itself.
+	    /*!
+	      \param data is nCodewords received messages of N LLRs each, one after the other.
+	      \param decoded_data is nCodewords corrected messages of K bits each, one after the other.
+	      \param nCodewords is the number of messages in the batch.
+	      \param iterations_done receives the number of iterations used by each message.
+	      \return None
+	   */
+	void decode_batch(const float* data,  int*  decoded_data, int nCodewords, int* iterations_done);
+
+	//! The number of messages decode_batch() decodes concurrently.
+	int get_nThreads();
+
+	//! Selects the SIMD_MS kernel. SIMD_MS_KERNEL_SCALAR runs the same row groups in plain C with the same results, any other value restores the kernel picked for the CPU.
+	void set_SIMD_MS_kernel(int kernel);
+	int get_SIMD_MS_kernel();
 
 
 };
@@ -28,9 +28,7 @@
 int decode_GBF(
 		const float LLRi[],
 		int LLRo[],
-		int* C,
-		int CWidth,
-		int CWidthMax,
+		const st_ldpc_graph* graph,
 		int N,
 		int K,
 		int P,
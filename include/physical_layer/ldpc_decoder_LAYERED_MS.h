@@ -0,0 +1,52 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INC_LDPC_DECODER_LAYERED_MS_H_
+#define INC_LDPC_DECODER_LAYERED_MS_H_
+
+#include <cmath>
+#include "physical_defines.h"
+#include "ldpc_decoder_MS.h"
+
+// Row-serial (layered) schedule of the normalized/offset Min-Sum decoder: each check row
+// reads the current posterior LLRs and writes them back before the next row is processed,
+// so the messages of an iteration are used within the same iteration.
+// R holds the check-to-variable messages of every edge of the graph.
+int decode_LAYERED_MS(
+		const float LLRi[],
+		int LLRo[],
+		const st_ldpc_graph* graph,
+		double* R,
+		int N,
+		int K,
+		int P,
+		int nIteration_max,
+		float alpha,
+		float beta
+);
+
+
+#endif
+
+/* D. E. Hocevar, "A reduced complexity decoder architecture via layered decoding of LDPC codes," IEEE Workshop on Signal Processing Systems (SIPS), 2004, pp. 107-112.
+ * https://ieeexplore.ieee.org/document/1363033
+ */
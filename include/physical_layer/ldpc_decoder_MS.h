@@ -0,0 +1,53 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INC_LDPC_DECODER_MS_H_
+#define INC_LDPC_DECODER_MS_H_
+
+#include <cmath>
+#include "physical_defines.h"
+
+// Normalized/offset Min-Sum: R = sign * max(alpha^log2(dc-1) * min|Q| - beta, 0) for check degree dc>2.
+// alpha=1, beta=0 gives plain Min-Sum; beta=0 gives Normalized Min-Sum; alpha=1 gives Offset Min-Sum.
+// Check-to-variable message magnitude cap, matches the SPA 2*atanh(0.9999999) limit and bounds degree-1 checks.
+#define MS_MESSAGE_MAX 16.8
+
+int decode_MS(
+		const float LLRi[],
+		int LLRo[],
+		const st_ldpc_graph* graph,
+		double* R,
+		double* Q,
+		int N,
+		int K,
+		int P,
+		int nIteration_max,
+		float alpha,
+		float beta
+);
+
+
+#endif
+
+/* J. Chen, A. Dholakia, E. Eleftheriou, M. P. C. Fossorier, and X. Hu, "Reduced-complexity decoding of LDPC codes," IEEE Transactions on Communications, vol. 53, no. 8, pp. 1288-1299, Aug 2005.
+ * https://ieeexplore.ieee.org/document/1495850
+ */
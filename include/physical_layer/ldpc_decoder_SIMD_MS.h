@@ -0,0 +1,89 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INC_LDPC_DECODER_SIMD_MS_H_
+#define INC_LDPC_DECODER_SIMD_MS_H_
+
+#include <cmath>
+#include "physical_defines.h"
+#include "ldpc_decoder_MS.h"
+
+#define SIMD_MS_KERNEL_SCALAR 0
+#define SIMD_MS_KERNEL_SSE41 1
+#define SIMD_MS_KERNEL_AVX2 2
+
+#define SIMD_MS_LANES_MAX 16
+
+// Fixed-point message format: LLR * SIMD_MS_SCALE in saturated int16.
+#define SIMD_MS_SCALE 16
+#define SIMD_MS_LLR_MAX 32767
+#define SIMD_MS_MESSAGE_MAX ((short)(MS_MESSAGE_MAX*SIMD_MS_SCALE))
+
+// Check rows packed into groups of "lanes" rows that share no variable node, so one vector
+// instruction updates one edge of every row of the group. Rows that are one circulant apart
+// are grouped first; their info edges then address consecutive variables and are read and
+// written with plain vector loads/stores instead of per-lane gathers.
+struct st_ldpc_simd_layout
+{
+	int kernel;            //!< SIMD_MS_KERNEL_SCALAR, SIMD_MS_KERNEL_SSE41 or SIMD_MS_KERNEL_AVX2.
+	int lanes;             //!< Rows per group: 16 for AVX2, 8 otherwise.
+	int nGroups;
+	int* group_start;      //!< [nGroups+1] first slot of each group, a slot is one edge of every lane.
+	int* slot_variable;    //!< [nSlots*lanes] variable node per lane, N for padding.
+	char* slot_contiguous; //!< [nSlots] YES when the lanes address consecutive variables.
+	short* alpha;          //!< [nGroups*lanes] Q15 Min-Sum normalization of each row.
+};
+
+void SIMD_MS_layout_build(
+		st_ldpc_simd_layout* layout,
+		const st_ldpc_graph* graph,
+		int N,
+		int K,
+		int P,
+		float alpha
+);
+
+void SIMD_MS_layout_free(st_ldpc_simd_layout* layout);
+
+// Layered normalized/offset Min-Sum on saturated int16 messages, one group of rows per step.
+// R holds group_start[nGroups]*lanes check-to-variable messages and L the N+1 posterior LLRs
+// (L[N] is the padding variable); the layout itself is read only and may be shared by threads.
+int decode_SIMD_MS(
+		const float LLRi[],
+		int LLRo[],
+		const st_ldpc_graph* graph,
+		const st_ldpc_simd_layout* layout,
+		short R[],
+		short L[],
+		int N,
+		int K,
+		int P,
+		int nIteration_max,
+		float beta
+);
+
+
+#endif
+
+/* K. Zhang, X. Huang, and Z. Wang, "High-throughput layered decoder implementation for quasi-cyclic LDPC codes," IEEE Journal on Selected Areas in Communications, vol. 27, no. 6, pp. 985-994, Aug 2009.
+ * https://ieeexplore.ieee.org/document/5174521
+ */
@@ -25,22 +25,13 @@
 
 #include <cmath>
 #include "physical_defines.h"
-#include "ldpc.h"
 
 int decode_SPA(
 		const float LLRi[],
 		int LLRo[],
-		int* C,
-		int CWidth,
-		int CWidthMax,
-		int* V,
-		int VWidth,
-		int VWidthMax,
-		int d[],
-		int dWidth,
+		const st_ldpc_graph* graph,
 		double* R,
 		double* Q,
-		int* V_pos,
 		int N,
 		int K,
 		int P,
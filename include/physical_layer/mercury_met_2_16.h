@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_MET_2_16_H
 #define INCLUDED_MERCURY_MET_2_16_H
-extern int mercury_met_Cwidth_2_16;
-extern int mercury_met_Vwidth_2_16;
-extern int mercury_met_dwidth_2_16;
-extern int mercury_met_QCmatrixC_2_16[1400][9];
-extern int mercury_met_QCmatrixV_2_16[1600][15];
-extern int mercury_met_QCmatrixd_2_16[14];
-extern int mercury_met_QCmatrixEnc_2_16[1400][8];
+extern int mercury_met_nGroups_2_16;
+extern int mercury_met_QCbase_2_16[2339];
 #endif
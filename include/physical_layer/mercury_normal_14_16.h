@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_14_16_H
 #define INCLUDED_MERCURY_NORMAL_14_16_H
-extern int mercury_normal_Cwidth_14_16;
-extern int mercury_normal_Vwidth_14_16;
-extern int mercury_normal_dwidth_14_16;
-extern int mercury_normal_QCmatrixC_14_16[200][46];
-extern int mercury_normal_QCmatrixV_14_16[1600][6];
-extern int mercury_normal_QCmatrixd_14_16[418];
-extern int mercury_normal_QCmatrixEnc_14_16[200][45];
+extern int mercury_normal_nGroups_14_16;
+extern int mercury_normal_QCbase_14_16[2090];
 #endif
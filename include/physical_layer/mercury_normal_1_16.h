@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_1_16_H
 #define INCLUDED_MERCURY_NORMAL_1_16_H
-extern int mercury_normal_Cwidth_1_16;
-extern int mercury_normal_Vwidth_1_16;
-extern int mercury_normal_dwidth_1_16;
-extern int mercury_normal_QCmatrixC_1_16[1500][4];
-extern int mercury_normal_QCmatrixV_1_16[1600][8];
-extern int mercury_normal_QCmatrixd_1_16[12];
-extern int mercury_normal_QCmatrixEnc_1_16[1500][3];
+extern int mercury_normal_nGroups_1_16;
+extern int mercury_normal_QCbase_1_16[44];
 #endif
@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_2_16_H
 #define INCLUDED_MERCURY_NORMAL_2_16_H
-extern int mercury_normal_Cwidth_2_16;
-extern int mercury_normal_Vwidth_2_16;
-extern int mercury_normal_dwidth_2_16;
-extern int mercury_normal_QCmatrixC_2_16[1400][5];
-extern int mercury_normal_QCmatrixV_2_16[1600][9];
-extern int mercury_normal_QCmatrixd_2_16[24];
-extern int mercury_normal_QCmatrixEnc_2_16[1400][4];
+extern int mercury_normal_nGroups_2_16;
+extern int mercury_normal_QCbase_2_16[92];
 #endif
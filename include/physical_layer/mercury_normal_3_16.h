@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_3_16_H
 #define INCLUDED_MERCURY_NORMAL_3_16_H
-extern int mercury_normal_Cwidth_3_16;
-extern int mercury_normal_Vwidth_3_16;
-extern int mercury_normal_dwidth_3_16;
-extern int mercury_normal_QCmatrixC_3_16[1300][6];
-extern int mercury_normal_QCmatrixV_3_16[1600][9];
-extern int mercury_normal_QCmatrixd_3_16[30];
-extern int mercury_normal_QCmatrixEnc_3_16[1300][5];
+extern int mercury_normal_nGroups_3_16;
+extern int mercury_normal_QCbase_3_16[146];
 #endif
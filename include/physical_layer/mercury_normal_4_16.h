@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_4_16_H
 #define INCLUDED_MERCURY_NORMAL_4_16_H
-extern int mercury_normal_Cwidth_4_16;
-extern int mercury_normal_Vwidth_4_16;
-extern int mercury_normal_dwidth_4_16;
-extern int mercury_normal_QCmatrixC_4_16[1200][9];
-extern int mercury_normal_QCmatrixV_4_16[1600][9];
-extern int mercury_normal_QCmatrixd_4_16[180];
-extern int mercury_normal_QCmatrixEnc_4_16[1200][8];
+extern int mercury_normal_nGroups_4_16;
+extern int mercury_normal_QCbase_4_16[872];
 #endif
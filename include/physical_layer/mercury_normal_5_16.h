@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_5_16_H
 #define INCLUDED_MERCURY_NORMAL_5_16_H
-extern int mercury_normal_Cwidth_5_16;
-extern int mercury_normal_Vwidth_5_16;
-extern int mercury_normal_dwidth_5_16;
-extern int mercury_normal_QCmatrixC_5_16[1100][15];
-extern int mercury_normal_QCmatrixV_5_16[1600][9];
-extern int mercury_normal_QCmatrixd_5_16[180];
-extern int mercury_normal_QCmatrixEnc_5_16[1100][14];
+extern int mercury_normal_nGroups_5_16;
+extern int mercury_normal_QCbase_5_16[951];
 #endif
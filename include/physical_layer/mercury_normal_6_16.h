@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_6_16_H
 #define INCLUDED_MERCURY_NORMAL_6_16_H
-extern int mercury_normal_Cwidth_6_16;
-extern int mercury_normal_Vwidth_6_16;
-extern int mercury_normal_dwidth_6_16;
-extern int mercury_normal_QCmatrixC_6_16[1000][13];
-extern int mercury_normal_QCmatrixV_6_16[1600][9];
-extern int mercury_normal_QCmatrixd_6_16[1048];
-extern int mercury_normal_QCmatrixEnc_6_16[1000][12];
+extern int mercury_normal_nGroups_6_16;
+extern int mercury_normal_QCbase_6_16[5426];
 #endif
@@ -22,11 +22,6 @@
 
 #ifndef INCLUDED_MERCURY_NORMAL_8_16_H
 #define INCLUDED_MERCURY_NORMAL_8_16_H
-extern int mercury_normal_Cwidth_8_16;
-extern int mercury_normal_Vwidth_8_16;
-extern int mercury_normal_dwidth_8_16;
-extern int mercury_normal_QCmatrixC_8_16[800][12];
-extern int mercury_normal_QCmatrixV_8_16[1600][8];
-extern int mercury_normal_QCmatrixd_8_16[30];
-extern int mercury_normal_QCmatrixEnc_8_16[800][11];
+extern int mercury_normal_nGroups_8_16;
+extern int mercury_normal_QCbase_8_16[146];
 #endif
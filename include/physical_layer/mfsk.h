@@ -24,6 +24,7 @@
 #define INC_MFSK_H_
 
 #include <complex>
+#include "physical_defines.h"
 #include <cmath>
 
 #define MOD_MFSK 200
@@ -66,23 +67,23 @@ public:
 
 	// Generate MFSK preamble data (tones in all streams simultaneously)
 	// preamble_out: nSymb * Nc complex values
-	void generate_preamble(std::complex<double>* preamble_out, int nSymb);
+	void generate_preamble(sample_complex* preamble_out, int nSymb);
 
 	// Generate ACK pattern: ACK_PATTERN_NSYMB symbols of known tones with hopping
 	// pattern_out: ACK_PATTERN_NSYMB * Nc complex values
-	void generate_ack_pattern(std::complex<double>* pattern_out);
+	void generate_ack_pattern(sample_complex* pattern_out);
 
 	// Generate BREAK pattern: same structure as ACK but with break_tones
-	void generate_break_pattern(std::complex<double>* pattern_out);
+	void generate_break_pattern(sample_complex* pattern_out);
 
 	// TX: Map bits to one-hot subcarrier vectors across all streams
 	// Consumes bits_per_symbol() bits per symbol period
 	void mod(const int* bits_in, int total_bits,
-	         std::complex<double>* symbols_out);
+	         sample_complex* symbols_out);
 
 	// RX: Non-coherent energy detection across all streams -> soft LLRs
 	// Produces bits_per_symbol() LLRs per symbol period
-	void demod(const std::complex<double>* fft_in, int total_bits,
+	void demod(const sample_complex* fft_in, int total_bits,
 	           float* llr_out);
 };
 
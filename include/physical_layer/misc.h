@@ -24,19 +24,35 @@
 #define INC_MISC_H_
 
 #include <complex>
+#include "physical_defines.h"
 #include <cmath>
+#include <cstdint>
 
 #ifndef M_PI
 #define M_PI          3.14159265358979323846  /* pi */
 #endif
 
 void shift_left(double* matrix, int size, int nShift);
-double get_angle(std::complex <double> value);
-double get_amplitude(std::complex <double> value);
-std::complex <double> set_complex(double amplitude, double theta);
-void matrix_multiplication(std::complex <double>* a, int a_width, int a_hight, std::complex <double>* b, int b_width, int b_hight, std::complex <double>* c);
+double get_angle(sample_complex value);
+double get_amplitude(sample_complex value);
+sample_complex set_complex(double amplitude, double theta);
+void matrix_multiplication(sample_complex* a, int a_width, int a_hight, sample_complex* b, int b_width, int b_hight, sample_complex* c);
 
 void byte_to_bit(int* data_byte, int* data_bit, int nBytes);
 void bit_to_byte(int* data_bit, int* data_byte, int nBits);
 
+// Packed bits: bit i is bit i%64 of word i/64, in the order of byte_to_bit().
+inline int get_packed_bit(const uint64_t* data, int index)
+{
+	return (int)((data[index>>6]>>(index&63))&1);
+}
+inline void set_packed_bit(uint64_t* data, int index, int value)
+{
+	data[index>>6]=(data[index>>6]&~((uint64_t)1<<(index&63)))|((uint64_t)(value&1)<<(index&63));
+}
+void byte_to_packed_bit(const int* data_byte, uint64_t* data_bit, int first_byte, int nBytes);
+void bit_to_packed_bit(const int* data_bit, uint64_t* data_packed, int nBits);
+void packed_bit_to_bit(const uint64_t* data_packed, int* data_bit, int nBits);
+void packed_bit_copy(const uint64_t* in, int in_offset, uint64_t* out, int out_offset, int nBits);
+
 #endif
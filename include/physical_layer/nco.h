@@ -0,0 +1,69 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INC_NCO_H_
+#define INC_NCO_H_
+
+#include <complex>
+#include "physical_defines.h"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI          3.14159265358979323846  /* pi */
+#endif
+
+// Independent rotator chains, one per SIMD lane.
+#define NCO_LANES 4
+// Samples between exact re-seeds of the rotators from the phase accumulator.
+#define NCO_BLOCK 256
+
+// Numerically controlled oscillator. The phase is kept in cycles wrapped to [0,1), so it does not
+// lose precision over long sessions, and carries over from one call to the next. Within a block
+// the carrier comes from a complex rotator recurrence instead of one cos()/sin() per sample.
+class cl_nco
+{
+private:
+	double frequency;
+	double sampling_frequency;
+	double phase_increment;
+	double lane_step_real;
+	double lane_step_imag;
+	void update_step();
+
+public:
+	cl_nco();
+	~cl_nco();
+
+	void set_frequency(double frequency, double sampling_frequency);
+	void set_phase(double phase);
+	void reset();
+
+	// out[i]=in[i]*amplitude*exp(j*phase_i)
+	void mix_down(const double* in, sample_complex* out, int nItems, double amplitude);
+	// out[i]=amplitude*(in[i].real()*cos(phase_i)+in[i].imag()*sin(phase_i))
+	void mix_up(const sample_complex* in, double* out, int nItems, double amplitude);
+
+	double phase;
+};
+
+
+#endif
@@ -29,6 +29,8 @@
 #include "misc.h"
 #include "physical_defines.h"
 #include "fir_filter.h"
+#include "nco.h"
+#include "fft.h"
 #include "plot.h"
 #include "psk.h"
 #include "interpolator.h"
@@ -39,6 +41,19 @@ struct TimeSyncResult {
 	double correlation;  // Normalized correlation (0.0 to 1.0)
 };
 
+// Grow-as-needed scratch of the Schmidl-Cox search, one per thread searching at the same time.
+struct st_time_sync_workspace {
+	int* corr_loc;
+	double* corr_vals;
+	int corr_size;
+	double* prefix_energy;
+	double* prefix_gi;
+	double* prefix_half;
+	int prefix_size;
+};
+void init_time_sync_workspace(st_time_sync_workspace* workspace);
+void free_time_sync_workspace(st_time_sync_workspace* workspace);
+
 
 class cl_pilot_configurator
 {
@@ -57,15 +72,24 @@ public:
 	int Nfft, Nc, Nsymb, Nc_max;
 	int modulation;
 	int seed;
-	std::complex <double> *sequence;
+	sample_complex *sequence;
 	double boost;
 	struct st_carrier* carrier;
 	int print_on;
 	int pilot_density;
 
+	// Channel estimator tables, rebuilt by configure(). Anchor columns are the pilot columns
+	// (every Dx-th carrier and the last one); they are interpolated in time between their own
+	// pilots, the other carriers in frequency between the anchors around them.
+	int* pilot_cell;                                  //!< [nPilots] frame index of each pilot, in sequence order.
+	struct st_interpolation_weight* time_weight;      //!< [Nsymb*Nc] pilots around each cell of an anchor column.
+	struct st_interpolation_weight* frequency_weight; //!< [Nc] anchor columns around each carrier, first==carrier on an anchor.
+
 private:
 	struct st_carrier* virtual_carrier;
 	int start_shift;
+	void build_interpolation_tables();
+	void free_interpolation_tables();
 
 
 };
@@ -85,7 +109,7 @@ public:
 	int Nfft, Nc, Nsymb, nIdentical_sections;
 	int modulation;
 	int seed;
-	std::complex <double> *sequence;
+	sample_complex *sequence;
 	double boost;
 	struct st_carrier* carrier;
 	int print_on;
@@ -101,28 +125,34 @@ class cl_ofdm
 private:
 
 	int Ngi;
-	void zero_padder(std::complex <double>* in, std::complex <double>* out);
-	void zero_depadder(std::complex <double>* in, std::complex <double>* out);
-	void gi_adder(std::complex <double>* in, std::complex <double>* out);
-	void gi_remover(std::complex <double>* in, std::complex <double>* out);
-	void _fft(std::complex <double> *v, int n);
-	void _ifft(std::complex <double> *v, int n);
-	void _fft_fast(std::complex <double> *v, int n);
-	void _ifft_fast(std::complex <double> *v, int n);
-	void fft(std::complex <double>* in, std::complex <double>* out);
-	void ifft(std::complex <double>* in, std::complex <double>* out);
-	void ifft(std::complex <double>* in, std::complex <double>* out, int _Nfft);
-
-	// Optimized FFT: precomputed twiddle factors
-	std::complex<double>* fft_twiddle;     // Twiddle factors for FFT
-	std::complex<double>* fft_scratch;     // Scratch buffer for in-place FFT
-	int* fft_bit_rev;                      // Bit-reversal permutation table
-	int fft_twiddle_size;                  // Size of twiddle table
-	void init_fft_tables(int n);
-	void deinit_fft_tables();
-
-	std::complex <double> *zero_padded_data,*iffted_data;
-	std::complex <double> *gi_removed_data,*ffted_data;
+	void zero_padder(sample_complex* in, sample_complex* out);
+	void zero_depadder(sample_complex* in, sample_complex* out);
+	void gi_adder(sample_complex* in, sample_complex* out);
+	void gi_remover(sample_complex* in, sample_complex* out);
+	void fft(sample_complex* in, sample_complex* out);
+	void ifft(sample_complex* in, sample_complex* out);
+	void ifft(sample_complex* in, sample_complex* out, int _Nfft);
+
+	// Nfft point plans from the shared plan cache
+	cl_fft_plan* fft_plan;
+	cl_fft_plan* ifft_plan;
+
+	sample_complex *zero_padded_data,*iffted_data;
+	sample_complex *gi_removed_data,*ffted_data;
+
+	// Channel estimator scratch: per cell pilot products, their window sums and one interpolated row
+	sample_complex *ls_numerator,*ls_row_numerator;
+	double *ls_denominator,*ls_row_denominator;
+	sample_complex *estimator_row;
+	void interpolate_channel(const sample_complex* pilot_estimate);
+
+	// MMSE estimator tables, built by init() when channel_estimator==CHANNEL_EST_MMSE
+	int* MMSE_tap;              //!< [Nsymb*Nc*MMSE_TAPS] pilot cells feeding each cell.
+	sample_real* MMSE_weight;   //!< [MMSE_SNR_BUCKETS*Nsymb*Nc*MMSE_TAPS] Wiener weights of the taps.
+	int* MMSE_triple;           //!< [3*MMSE_nTriples] runs of three pilots in a column, for the noise estimate.
+	int MMSE_nTriples;
+	void build_MMSE_tables();
+	void free_MMSE_tables();
 
 public:
 	cl_ofdm();
@@ -130,34 +160,41 @@ public:
 	void init();
 	void init(int Nfft, int Nc, int Nsymb, float gi);
 	void deinit();
-	void symbol_mod(std::complex <double>*in, std::complex <double>*out);
-	void symbol_demod(std::complex <double>*in, std::complex <double>*out);
-	void framer(std::complex <double>* in, std::complex <double>* out);
-	void deframer(std::complex <double>* in, std::complex <double>* out);
-	void ZF_channel_estimator(std::complex <double>*in);
-	void LS_channel_estimator(std::complex <double>*in);
+	void symbol_mod(sample_complex*in, sample_complex*out);
+	void symbol_demod(sample_complex*in, sample_complex*out);
+	void framer(sample_complex* in, sample_complex* out);
+	void deframer(sample_complex* in, sample_complex* out);
+	void ZF_channel_estimator(sample_complex*in);
+	void LS_channel_estimator(sample_complex*in);
+	void MMSE_channel_estimator(sample_complex*in);
+	void set_channel_estimator(int estimator);
 	void restore_channel_amplitude();
-	double carrier_sampling_frequency_sync(std::complex <double>*in, double carrier_freq_width, int preamble_nSymb, double sampling_frequency);
-	double frequency_sync_coarse(std::complex<double>* in, double subcarrier_spacing, int search_range_subcarriers = 0, int interpolation_rate = 1);
-	void channel_equalizer(std::complex <double>* in, std::complex <double>* out);
-	void channel_equalizer_without_amplitude_restoration(std::complex <double>* in,std::complex <double>* out);
-
-	void automatic_gain_control(std::complex <double>*in);
-	double measure_variance(std::complex <double>*in);
-	double measure_signal_stregth(std::complex <double> *in, int nItems);
+	double carrier_sampling_frequency_sync(sample_complex*in, double carrier_freq_width, int preamble_nSymb, double sampling_frequency);
+	double frequency_sync_coarse(sample_complex* in, double subcarrier_spacing, int search_range_subcarriers = 0, int interpolation_rate = 1);
+	void channel_equalizer(sample_complex* in, sample_complex* out);
+	void channel_equalizer_without_amplitude_restoration(sample_complex* in,sample_complex* out);
+
+	void automatic_gain_control(sample_complex*in);
+	double measure_variance(sample_complex*in, int first_symbol = 0, int nSymbols = -1);  // over the pilots of the given rows, all rows by default
+	void fill_missing_symbols(sample_complex*in, int first_symbol, int nSymbols);  // rebuilds the rows outside [first_symbol,first_symbol+nSymbols) from their received pilots
+	double preamble_coherence(sample_complex*in);  // 0..1, from the received preamble symbols at the base rate
+	double measure_signal_stregth(sample_complex *in, int nItems);
 	st_power_measurment measure_signal_power_avg_papr(double *in, int nItems);
 	void peak_clip(double *in, int nItems, double papr);
-	void peak_clip(std::complex <double> *in, int nItems, double papr);
-	double measure_SNR(std::complex <double>*in_s, std::complex <double>*in_n, int nItems);
-	int time_sync(std::complex <double>*in, int size, int interpolation_rate, int location_to_return);
-	int time_sync_preamble(std::complex <double>*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max);
-	TimeSyncResult time_sync_preamble_with_metric(std::complex <double>*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max);
-	int time_sync_mfsk(std::complex<double>* baseband_interp, int buffer_size_interp, int interpolation_rate, int preamble_nSymb, const int* preamble_tones, int mfsk_M, int nStreams, const int* stream_offsets, int search_start_symb = 0);
-	double detect_ack_pattern(std::complex<double>* baseband_interp, int buffer_size_interp, int interpolation_rate, int ack_nsymb, const int* ack_tones, int ack_pattern_len, int tone_hop_step, int mfsk_M, int nStreams, const int* stream_offsets, int* out_matched = nullptr);
-	int symbol_sync(std::complex <double>*, int size, int interpolation_rate, int location_to_return);
-	void rational_resampler(std::complex <double>* in, int in_size , std::complex <double>* out, int rate, int interpolation_decimation);
-	void baseband_to_passband(std::complex <double>* in, int in_size, double* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, int interpolation_rate);
-	void passband_to_baseband(double* in, int in_size, std::complex <double>* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, int decimation_rate, cl_FIR* filter);
+	void peak_clip(sample_complex *in, int nItems, double papr);
+	double measure_SNR(sample_complex*in_s, sample_complex*in_n, int nItems);
+	int time_sync(sample_complex*in, int size, int interpolation_rate, int location_to_return);
+	int time_sync_preamble(sample_complex*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max);
+	TimeSyncResult time_sync_preamble_with_metric(sample_complex*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max);
+	TimeSyncResult time_sync_preamble_with_metric(st_time_sync_workspace* workspace, sample_complex*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max);
+	void time_sync_preamble_metric_range(st_time_sync_workspace* workspace, const sample_complex* in, int size, int interpolation_rate, int first, int last, double* metric);
+	int time_sync_mfsk(sample_complex* baseband_interp, int buffer_size_interp, int interpolation_rate, int preamble_nSymb, const int* preamble_tones, int mfsk_M, int nStreams, const int* stream_offsets, int search_start_symb = 0);
+	double detect_ack_pattern(sample_complex* baseband_interp, int buffer_size_interp, int interpolation_rate, int ack_nsymb, const int* ack_tones, int ack_pattern_len, int tone_hop_step, int mfsk_M, int nStreams, const int* stream_offsets, int* out_matched = nullptr);
+	int symbol_sync(sample_complex*, int size, int interpolation_rate, int location_to_return);
+	void rational_resampler(sample_complex* in, int in_size , sample_complex* out, int rate, int interpolation_decimation);
+	void baseband_to_passband(sample_complex* in, int in_size, double* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, int interpolation_rate);
+	void passband_to_baseband(double* in, int in_size, sample_complex* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, int decimation_rate, cl_FIR* filter);
+	void passband_to_baseband(double* in, int in_size, sample_complex* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, cl_FIR* filter, int first, int last);
 	struct st_channel_complex * estimated_channel, *estimated_channel_without_amplitude_restoration;
 	int Nfft,Nc,Nsymb;
 	float gi;
@@ -165,13 +202,13 @@ public:
 	struct st_carrier* ofdm_preamble;
 	cl_pilot_configurator pilot_configurator;
 	cl_preamble_configurator preamble_configurator;
-	void fft(std::complex <double>* in, std::complex <double>* out, int _Nfft);
+	void fft(sample_complex* in, sample_complex* out, int _Nfft);
 	int time_sync_Nsymb;
 	double freq_offset_ignore_limit;
 	cl_FIR FIR_rx_data,FIR_rx_time_sync;
 	cl_FIR FIR_tx1, FIR_tx2;
 	int start_shift;
-	long unsigned passband_start_sample;
+	cl_nco passband_nco;
 
 	double preamble_papr_cut;
 	double data_papr_cut;
@@ -180,26 +217,27 @@ public:
 	int channel_estimator_amplitude_restoration;
 	int LS_window_width;
 	int LS_window_hight;
+	double MMSE_delay_spread;  // maximum delay over the useful symbol length, twice the guard interval when 0
+	double MMSE_doppler;       // maximum Doppler shift times the symbol length (guard included)
+	double MMSE_SNR;           // SNR of the pilot estimates of the last frame, dB
 
 	// Pre-allocated buffers for passband_to_baseband (avoids new/delete per call)
-	std::complex<double>* p2b_l_data;
-	std::complex<double>* p2b_data_filtered;
+	sample_complex* p2b_l_data;
+	cl_nco p2b_nco;
 	int p2b_buffer_size;
 
 	// Pre-allocated Nfft-sized work buffers shared by frequency_sync_coarse,
 	// time_sync_mfsk, and detect_ack_pattern (never called concurrently)
-	std::complex<double>* work_buf_a;
-	std::complex<double>* work_buf_b;
+	sample_complex* work_buf_a;
+	sample_complex* work_buf_b;
 
 	// Pre-allocated grow-as-needed buffers for time_sync_preamble[_with_metric]
-	int* tsync_corr_loc;
-	double* tsync_corr_vals;
-	int tsync_corr_size;
-	std::complex<double>* tsync_data;
-	int tsync_data_size;
+	st_time_sync_workspace tsync;
+	void time_sync_preamble_metric(st_time_sync_workspace* workspace, sample_complex*in, int size, int interpolation_rate, int step);
+	void time_sync_preamble_rank(st_time_sync_workspace* workspace, int size, int nTrials_max);
 
 	// Pre-allocated grow-as-needed buffer for baseband_to_passband
-	std::complex<double>* b2p_data_interpolated;
+	sample_complex* b2p_data_interpolated;
 	int b2p_buffer_size;
 };
 
@@ -67,6 +67,8 @@ public:
 	int ofdm_channel_estimator_amplitude_restoration;
 	int ofdm_LS_window_width;
 	int ofdm_LS_window_hight;
+	double ofdm_MMSE_delay_spread;
+	double ofdm_MMSE_doppler;
 
 	float ofdm_freq_offset_ignore_limit;
 	int ofdm_start_shift;
@@ -76,10 +78,15 @@ public:
 
 	int ldpc_decoding_algorithm;
 	float ldpc_GBF_eta;
+	float ldpc_MS_alpha;
+	float ldpc_MS_beta;
 	int ldpc_nIteration_max;
+	int ldpc_nThreads;
 	int ldpc_print_nIteration;
 
 	int outer_code;
+	int harq_nBuffers;
+	double ir_first_fraction;
 
 	double bandwidth;
 	int time_sync_trials_max;
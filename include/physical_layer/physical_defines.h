@@ -26,9 +26,19 @@
 #include <complex>
 #include "common/common_defines.h"
 
+// Sample type of the PHY data path (make FLOAT_SAMPLES=1 for single precision).
+// Passband audio buffers and carrier phase accumulators stay in double.
+#ifdef MERCURY_FLOAT_SAMPLES
+typedef float sample_real;
+#else
+typedef double sample_real;
+#endif
+typedef std::complex <sample_real> sample_complex;
+
 #define ALSA_MAX_PATH 128
 
 #define N_MAX 1600
+#define N_MAX_WORDS ((N_MAX+63)/64)
 #define C_WIDTH_MAX 200
 #define V_WIDTH_MAX 50
 #define D_WIDTH_MAX 2400
@@ -41,6 +51,9 @@
 
 #define GBF 0
 #define SPA 1
+#define LDPC_MS 2
+#define LAYERED_MS 3
+#define SIMD_MS 4
 
 
 #define NOT_HEALTHY -1
@@ -67,6 +80,10 @@
 
 #define ZERO_FORCE 0
 #define LEAST_SQUARE 1
+#define CHANNEL_EST_MMSE 2
+
+#define MMSE_TAPS 12
+#define MMSE_SNR_BUCKETS 5
 
 #define NO_OUTER_CODE 0
 #define CRC16_MODBUS_RTU 1
@@ -74,22 +91,49 @@
 #define HIGH_DENSITY 0
 #define LOW_DENSITY 1
 
+#define IR_FULL 0
+#define IR_FIRST 1
+
+#define IR_RATE_MAX 0.5
+#define HARQ_DUPLICATE_CORRELATION 0.9
+#define HARQ_SYNC_COHERENCE 0.5
+#define HARQ_NO_KEY -1
+
 
 
 struct st_carrier
 {
-	std::complex <double> value;
+	sample_complex value;
 	int type;
 
 };
 
 struct st_channel_complex
 {
-	std::complex <double> value;
+	sample_complex value;
 	int status;
 
 };
 
+// Linear interpolation between two cells of a frame: value=first+weight*(second-first).
+struct st_interpolation_weight
+{
+	int first;
+	int second;
+	double weight;
+};
+
+// Passband waveform that only depends on the configuration, with the carrier frequency and the
+// output power it was built for and the passband NCO phase at its end (cycles).
+struct st_passband_waveform
+{
+	double* samples;
+	int nSamples;
+	double carrier_frequency;
+	double output_power_Watt;
+	double end_phase;
+};
+
 struct st_channel_real
 {
 	double value;
@@ -104,6 +148,16 @@ struct st_power_measurment
 	double papr_db;
 };
 
+// Compressed (CSR) Tanner graph of an LDPC code, edges are numbered in check-major order.
+struct st_ldpc_graph
+{
+	int nEdges;
+	int* check_start;     //!< [P+1] first edge of each check node.
+	int* edge_variable;   //!< [nEdges] variable node of each edge.
+	int* variable_start;  //!< [N+1] first entry of each variable node in variable_edge.
+	int* variable_edge;   //!< [nEdges] edges of each variable node, in the order of QCmatrixV.
+};
+
 
 
 
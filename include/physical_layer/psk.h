@@ -24,7 +24,12 @@
 #define INC_PSK_H_
 
 #include <complex>
+#include "physical_defines.h"
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
 
 #define MOD_BPSK 2
 #define MOD_QPSK 4
@@ -33,14 +38,39 @@
 #define MOD_32QAM 32
 #define MOD_64QAM 64
 
+#define PSK_TERMS_MAX (MOD_64QAM/2)
+
+#define PSK_AXIS_I 0
+#define PSK_AXIS_Q 1
+#define PSK_AXIS_IQ 2
+
+#define PSK_DEMOD_KERNEL_SCALAR 0
+#define PSK_DEMOD_KERNEL_AVX2 1
+
+// Max-log metric of one bit: for each bit value, the minimum over the points carrying it of
+// |p|^2-2*Re(y*conj(p)), the |y|^2 term being common to both sides. When the points of each
+// bit value form a grid sharing the same levels on the other axis (square Gray QAM, BPSK, QPSK)
+// only the distinct levels of the bit's own axis are kept, and the LLR is a piecewise-linear
+// function of the I or Q component alone.
+struct st_psk_bit_metric
+{
+	int axis;                               //!< PSK_AXIS_I, PSK_AXIS_Q or PSK_AXIS_IQ.
+	int nTerms[2];
+	float offset[2][PSK_TERMS_MAX];
+	float slope_i[2][PSK_TERMS_MAX];
+	float slope_q[2][PSK_TERMS_MAX];
+};
+
 class cl_psk
 {
 private:
-	std::complex <double>* constellation;
+	sample_complex* constellation;
 	int nBits;
 	int nSymbols;
-	float* D_buf;    // Pre-allocated demod workspace [nSymbols]
-	float* LLR_buf;  // Pre-allocated demod workspace [nBits]
+	st_psk_bit_metric* bit_metric; // [nBits], LSB first
+	int demod_kernel;
+
+	void build_bit_metrics();
 public:
 
 
@@ -48,11 +78,16 @@ public:
 	~cl_psk();
 
 
-	void set_constellation(std::complex <double> *_constellation, int size);
+	void set_constellation(sample_complex *_constellation, int size);
 	void set_predefined_constellation(int M);
 	void deinit();
-	void mod(const int *in,int nItems,std::complex <double> *out);
-	void demod(const std::complex <double> *in,int nItems,float *out,float variance);
+	void mod(const int *in,int nItems,sample_complex *out);
+	void mod(const uint64_t *in,int nItems,sample_complex *out);
+	void demod(const sample_complex *in,int nItems,float *out,float variance);
+	void demod(const sample_complex *in,int nItems,float *out,float variance,const int* out_index);
+	// PSK_DEMOD_KERNEL_SCALAR forces the scalar demapper, any other value restores the kernel picked for the CPU.
+	void set_demod_kernel(int kernel);
+	int get_demod_kernel();
 
 };
 
@@ -37,6 +37,8 @@
 #include "misc.h"
 #include "common/ring_buffer_posix.h"
 #include <iomanip>
+#include <thread>
+#include <atomic>
 
 
 #if defined(_WIN32)
@@ -45,19 +47,38 @@
 #define msleep(a) usleep(a * 1000)
 #endif
 
-struct st_reinit_subsystems{
-	int microphone=YES;
-	int speaker=YES;
-	int telecom_system=YES;
-	int data_container=YES;
-	int ofdm_FIR_rx_data=YES;
-	int ofdm_FIR_rx_time_sync=YES;
-	int ofdm_FIR_tx1=YES;
-	int ofdm_FIR_tx2=YES;
-	int ofdm=YES;
-	int ldpc=YES;
-	int psk=YES;
-	int pre_equalization_channel=YES;
+#define NUMBER_OF_PHY_CONTEXTS (NUMBER_OF_CONFIGS+3)
+
+// Everything that only depends on the configuration: sizes and buffers, the OFDM tables and
+// filters, the constellation, the LDPC code. It is built the first time its configuration is loaded and kept
+// until the destructor, so switching configurations never frees or reallocates any of it.
+struct st_phy_context{
+	int built;
+	cl_data_container data_container;
+	cl_ofdm ofdm;
+	cl_psk psk;
+	cl_mfsk mfsk;
+	cl_ldpc ldpc;
+	double modulation;
+	double carrier_frequency;  // of the pre-equalization channel measurement
+	struct st_channel_complex* pre_equalization_channel;
+	int* rx_bit_dest;  // [nBits] LDPC position of each bit of the deframed data, MSB of a symbol first
+	st_passband_waveform preamble_passband;
+	st_passband_waveform ack_pattern_passband;
+	st_passband_waveform break_pattern_passband;
+};
+
+#define COARSE_FREQ_HYPOTHESES 3
+
+// Scratch of one coarse frequency hypothesis, so the hypotheses can be searched concurrently.
+struct st_sync_worker{
+	cl_FIR filter;  // same design as ofdm->FIR_rx_time_sync
+	cl_nco nco;
+	sample_complex* mixed;
+	sample_complex* baseband;
+	int size;
+	st_time_sync_workspace tsync;
+	TimeSyncResult result;
 };
 
 struct st_receive_stats{
@@ -79,27 +100,127 @@ struct st_receive_stats{
 	int mfsk_search_raw;  // MFSK anti-re-decode: base search position (symbol units, pre-nUnder adjustment)
 	int frame_overflow_symbols;  // >0: MFSK frame extends beyond captured audio by this many symbols
 	double coarse_metric;  // Schmidl-Cox correlation metric from coarse time_sync (diagnostic)
+	int harq_combined;  // YES: decoded only after chase combining with a stored failed frame
+	int ir_part;  // IR_FULL or IR_FIRST: part of the codeword the last frame was read as
+	int frame_nsymb;  // data symbols of the last decoded frame
+	int frame_key;  // HARQ key the last frame was received under, HARQ_NO_KEY when not combined
+	int harq_stored;  // YES: the last frame failed and was kept in a soft buffer under frame_key
+};
+
+// What decode_frame() finds out about a codeword. Each trial has its own, the decoder may run on
+// rx_decoder while the main thread goes on; finish_rx_trial() publishes it.
+struct st_decode_result{
+	int* hd_decoded_bit;   // nReal_data bits, energy dispersal removed
+	int* hd_decoded_byte;  // nReal_data/8 bytes, CRC included
+	int iterations_done;   // -1 when the trial was not decoded
+	int all_zeros;
+	int crc;
+};
+
+// A sync trial of receive_byte() as handed from the front end (sync, demodulation, LLRs) to the
+// LDPC decoder, with what is needed to report it once its decode is known.
+struct st_rx_trial{
+	float* llr;
+	sample_complex* deframed_data;
+	sample_complex* deframed_data_without_amplitude_restoration;
+	int sync_trial;
+	int delay;
+	double freq_offset;
+	float variance;
+	float SNR_variance;
+	int ir_part;
+	int frame_nsymb;
+	int frame_key;
+	double sync_coherence;
+	int decoded;
+	st_decode_result result;
+	st_ldpc_workspace ldpc_workspace;
 };
 
 
 class cl_telecom_system
 {
 private:
-
+	int decode_frame(float* llr, int nReal_data, st_decode_result* result, st_ldpc_workspace* ldpc_workspace);
+	void publish_decode_result(const st_decode_result* result, int* out, int nReal_data);
+	int harq_combine(st_rx_trial* trial, int nReal_data);
+	float* harq_llr_combined;
+	void update_ir_nsymb();
+	void ir_erase_missing_bits();
+	int harq_holds(int key);
+	void transmit_packed(const uint64_t* data, double* out, int message_location);
+	sample_complex* time_sync_baseband(double* data, double carrier_frequency);
+	// Time sync baseband of the capture window, kept as a mirrored ring of 2*rx_stream_size samples
+	// so only the symbols appended since the previous snapshot are mixed and filtered again.
+	sample_complex* rx_stream_baseband;
+	sample_complex* rx_stream_mixed;
+	sample_complex* rx_stream_filtered;
+	int rx_stream_size;
+	int rx_stream_head;
+	long long rx_stream_symbol_count;
+	double rx_stream_carrier_frequency;
+	int rx_stream_valid;
+	cl_nco rx_stream_nco;
+	// Schmidl-Cox metric of every candidate of the ring, mirrored the same way, and the peak and
+	// the energy of each of its symbols, updated with the samples that changed.
+	double* rx_stream_metric;
+	double* rx_stream_symbol_peak;
+	int* rx_stream_symbol_peak_location;
+	double* rx_stream_symbol_energy;
+	int rx_stream_symbol_size;
+	int rx_stream_metric_valid;
+	st_time_sync_workspace rx_stream_tsync;
+	void update_rx_stream_symbols(int first, int last);
+	TimeSyncResult search_preamble(sample_complex* baseband, int first, int size, int step);
+	double measure_signal_stregth(sample_complex* baseband, int nItems);
+	void frame_baseband(double* data, double carrier_frequency, sample_complex* sync_baseband);
+	// Contexts of CONFIG_0..CONFIG_16 followed by ROBUST_0..ROBUST_2, context points to the active one.
+	st_phy_context phy_context[NUMBER_OF_PHY_CONTEXTS];
+	st_phy_context* context;
+	void build_phy_context(int configuration, int preamble_nSymb, int channel_estimator);
+	void publish_phy_context();
+	void load_phy_context();
+	void build_rx_bit_dest(int* dest);
+	void free_phy_contexts();
+	// Preamble, ACK and BREAK passband waveforms are built on first use and kept in the context.
+	int copy_cached_passband(st_passband_waveform* waveform, double carrier_frequency, double* out);
+	void cache_passband(st_passband_waveform* waveform, double carrier_frequency, const double* in, int nSamples);
+	// Coarse frequency search: one worker per hypothesis, run on up to nSync_threads threads.
+	st_sync_worker sync_worker[COARSE_FREQ_HYPOTHESES];
+	int nSync_threads;
+	cl_worker_pool sync_pool;  // hypothesis threads, started by init()
+	void search_coarse_frequency(double* data, const double* frequency_offset, int step);
+	void search_frequency_hypothesis(double* data, int nItems, int search_size, double frequency, int step, st_sync_worker* worker);
+	// The LDPC decode of a sync trial runs on rx_decoder while the front end prepares the next
+	// trial, which is dropped if the decode succeeds. Two trials alternate between the slots.
+	st_rx_trial rx_trial[2];
+	int rx_trial_size;
+	st_rx_trial* rx_decoding;  // trial on rx_decoder, NULL when none
+	std::thread rx_decoder;
+	std::atomic<int> rx_decoder_done;
+	void alloc_rx_trials();
+	void capture_rx_trial(st_rx_trial* trial, int rx_ir_part, float variance, double freq_offset_measured, double sync_coherence);
+	void start_rx_trial(st_rx_trial* trial, int nReal_data);
+	int collect_rx_trial(int* out, int nReal_data, int* harq_tried, int wait);
+	int finish_rx_trial(st_rx_trial* trial, int* out, int nReal_data, int* harq_tried);
+	void quiesce_rx_decoder();  // joins rx_decoder and drops its trial, before the LDPC code changes
 
 public:
 	cl_telecom_system();
 	~cl_telecom_system();
-	cl_data_container data_container;
-	cl_psk psk;
-	cl_mfsk mfsk;
+	// The objects of the current configuration, in its context.
+	cl_data_container* data_container;
+	cl_psk* psk;
+	cl_mfsk* mfsk;
 	cl_mfsk ack_mfsk;  // Dedicated MFSK instance for ACK pattern (always initialized, all modes)
 	cl_awgn awgn_channel;
 	cl_error_rate error_rate;
-	cl_ofdm ofdm;
+	cl_ofdm* ofdm;
+	// Context whose data container the audio capture thread fills, swapped by load_configuration().
+	std::atomic<st_phy_context*> capture_context;
 	cl_error_rate passband_test_EsN0(float EsN0,int max_frame_no);
 	cl_error_rate baseband_test_EsN0(float EsN0,int max_frame_no);
-	cl_ldpc ldpc;
+	cl_ldpc* ldpc;  // of the current configuration, in its context
 	double sampling_frequency;
 	double carrier_frequency;
 	double carrier_amplitude;
@@ -107,8 +228,10 @@ public:
 	int time_sync_trials_max;
 	int use_last_good_time_sync;
 	int use_last_good_freq_offset;
+	int pipelined_receive;  // YES: decode a sync trial while the next one is prepared
 	int mfsk_fixed_delay;  // >= 0: bypass time_sync with this delay (BER test); -1: use time_sync
 	int test_puncture_nBits;  // > 0: zero out LLRs past this position (punctured LDPC BER test); 0: disabled
+	int test_estimator_benchmark;  // YES: PLOT_PASSBAND compares the LS and MMSE channel estimators
 
 	// MFSK short control frames: punctured LDPC for ACK/control messages
 	int ctrl_nBits;    // interleaved bits to transmit for ctrl frames (0 = no puncturing)
@@ -118,12 +241,24 @@ public:
 	int get_active_nsymb() const;  // ctrl_nsymb when mfsk_ctrl_mode, else Nsymb
 	int get_active_nbits() const;  // ctrl_nBits when mfsk_ctrl_mode, else nBits
 
+	// Incremental redundancy for OFDM data frames: the first transmission carries only the first
+	// ir_nsymb data symbols of the frame, a retransmission the full frame. A receiver reads a frame
+	// as a first part unless it already holds a soft buffer of the frame's key, so the part is
+	// never signalled. Both ends of a link should use the same share.
+	double ir_first_fraction;  // share of the data symbols sent first (0 or 1 disables IR)
+	int ir_nsymb;  // data symbols of an IR_FIRST frame, 0 when IR is off for this configuration
+	int ir_part;  // part transmitted by transmit_byte()
+	void set_ir_part(int part);
+
+
 	// ACK pattern: short known-tone sequence for pattern-based ACK
 	int ack_pattern_passband_samples;    // = ACK_PATTERN_NSYMB * Nofdm * freq_interp_rate
 	double ack_pattern_detection_threshold;  // metric threshold for detection
 	int generate_ack_pattern_passband(double* out);  // TX: returns samples written
 	double detect_ack_pattern_from_passband(double* data, int size, int* out_matched = nullptr);  // RX: returns metric
 	void ack_pattern_detection_test();  // SNR sweep + false alarm test
+	void channel_estimator_benchmark();  // LS vs MMSE: BER and CPU time per frame over an Es/N0 sweep
+	int harq_check();  // chase combining on and off over an Es/N0 sweep, YES when HARQ only adds decodes
 
 	// BREAK pattern: emergency "drop to ROBUST_0" signal (different tones from ACK)
 	int generate_break_pattern_passband(double* out);  // TX: returns samples written
@@ -160,8 +295,7 @@ public:
 
 	void calculate_parameters();
 
-	void init();
-	void deinit();
+	void reset_receiver();
 	cl_plot BER_plot, constellation_plot;
 
 	void TX_RAND_process_main();
@@ -191,9 +325,25 @@ public:
 	int outer_code;
 	int outer_code_reserved_bits;
 
-	int bit_energy_dispersal_seed;
+	// HARQ chase combining: deinterleaved LLRs of OFDM frames that failed the LDPC/CRC check
+	// are kept and summed with later receptions until one of the sums decodes.
+	int harq_nBuffers;  // soft frames kept (0 disables chase combining)
+	float* harq_llr;  // harq_nBuffers*N_MAX stored LLRs
+	int* harq_age;  // per buffer: -1 free, else ACK rounds since it was stored
+	int* harq_key;  // per buffer: frame key of the stored frame
+	// The message id sits inside the codeword, so the receiver cannot read it from a failed frame.
+	// The ARQ receiver sets the id of the message it expects next, failed frames are kept under it.
+	int harq_rx_key;  // 0..255, HARQ_NO_KEY: failed frames are not combined
+	void harq_release(int key);  // the message of key was received
+	int harq_nBuffers_allocated;
+	int harq_N, harq_Nsymb;  // frame geometry of the stored frames
+	double harq_M;
+	void harq_init();  // (re)allocates on a change of harq_nBuffers, flushes on a change of geometry
+	void harq_deinit();
+	void harq_flush();
+	void harq_age_buffers(int max_age);  // once per ACK round, drops buffers older than max_age
 
-	st_reinit_subsystems reinit_subsystems;
+	int bit_energy_dispersal_seed;
 
 };
 
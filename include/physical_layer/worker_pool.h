@@ -0,0 +1,69 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INC_WORKER_POOL_H_
+#define INC_WORKER_POOL_H_
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+// Threads created once by init() and parked between jobs. run() hands the tasks of a job out one
+// at a time to the pool and the calling thread, which takes part as worker 0.
+class cl_worker_pool
+{
+private:
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable job_ready;
+	std::condition_variable job_done;
+	const std::function<void(int,int)>* job;
+	int nTasks;
+	std::atomic<int> next_task;
+	int nBusy;
+	long long generation;
+	int quit;
+	std::atomic<int> running;  // a job is in run(), which is not reentrant
+	void work(int worker);
+	void work_tasks(int worker);
+
+public:
+	cl_worker_pool();
+	~cl_worker_pool();
+	int nThreads; //!< Workers including the calling thread, 1 until init().
+	void init(int nThreads);
+	void deinit();
+
+	//! Runs task(i,worker) for every i in [0,nTasks) and returns once all of them are done. Not reentrant, one caller at a time.
+	    /*!
+	      \param nTasks is the number of tasks of the job.
+	      \param task is called with the task index and the index of the worker running it, below nThreads.
+	      \return None
+	   */
+	void run(int nTasks, const std::function<void(int,int)>& task);
+};
+
+
+#endif
@@ -1004,10 +1004,9 @@ void *radio_capture_prep_thread(void *telecom_ptr_void)
 
 	while (!shutdown_)
     {
-		cl_data_container *data_container_ptr = &telecom_ptr->data_container;
+		cl_data_container *data_container_ptr = &telecom_ptr->capture_context.load()->data_container;
 		int signal_period = data_container_ptr->Nofdm * data_container_ptr->buffer_Nsymb * data_container_ptr->interpolation_rate; // in samples
 		int symbol_period = data_container_ptr->Nofdm * data_container_ptr->interpolation_rate;
-		int location_of_last_frame = signal_period - symbol_period - 1; // TODO: do we need this "-1"?
 
 		if (symbol_period == 0) {
 			continue;
@@ -1026,20 +1025,20 @@ void *radio_capture_prep_thread(void *telecom_ptr_void)
 
 		MUTEX_LOCK(&capture_prep_mutex);
 
-		// Re-read buffer parameters inside mutex to prevent use-after-free
-		// during config switches that deinit/reinit passband_delayed_data.
-		// The values read outside the mutex (signal_period) may be stale if
-		// deinit zeroed Nofdm/buffer_Nsymb between the read and the lock.
+		// A config switch publishes another context under this mutex, so the
+		// container is looked up again. Containers are never freed, but the
+		// symbol read outside the mutex may not fit the new one anymore.
+		data_container_ptr = &telecom_ptr->capture_context.load()->data_container;
 		{
 			int sp = data_container_ptr->Nofdm * data_container_ptr->buffer_Nsymb * data_container_ptr->interpolation_rate;
-			int loc = sp - symbol_period - 1;
 			if(sp != signal_period && sp != 0) {
 				printf("[CAP-STALE] sp_old=%d sp_new=%d symb_old=%d buf=%p tid=%lu\n",
 					signal_period, sp, symbol_period, (void*)data_container_ptr->passband_delayed_data,
 					(unsigned long)pthread_self());
 				fflush(stdout);
 			}
-			if(sp == 0 || data_container_ptr->passband_delayed_data == NULL || loc < 0) {
+			if(sp == 0 || data_container_ptr->passband_delayed_data == NULL || sp < symbol_period ||
+				symbol_period != data_container_ptr->Nofdm * data_container_ptr->interpolation_rate) {
 				MUTEX_UNLOCK(&capture_prep_mutex);
 				continue;
 			}
@@ -1047,8 +1046,8 @@ void *radio_capture_prep_thread(void *telecom_ptr_void)
 			if(data_container_ptr->data_ready == 1)
 				data_container_ptr->nUnder_processing_events++;
 
-			shift_left(data_container_ptr->passband_delayed_data, sp, symbol_period);
-			memcpy(&data_container_ptr->passband_delayed_data[loc], buffer_temp, symbol_period * sizeof(double));
+			// Only the new symbol is written, the window itself is not moved.
+			data_container_ptr->append_passband_symbol(buffer_temp);
 
 			data_container_ptr->frames_to_read--;
 			if(data_container_ptr->frames_to_read < 0)
@@ -126,7 +126,7 @@ void cl_arq_controller::process_messages_commander()
 				printf("[BREAK] Retry (%d left)\n", emergency_break_retries);
 				fflush(stdout);
 				send_break_pattern();
-				telecom_system->data_container.frames_to_read = 4;
+				telecom_system->data_container->frames_to_read = 4;
 				calculate_receiving_timeout();
 				receiving_timer.start();
 			}
@@ -241,9 +241,9 @@ void cl_arq_controller::process_messages_commander()
 
 			reset_all_timers();
 			// Reset RX state machine - wait for fresh data (prevents decode of self-received TX audio)
-			telecom_system->data_container.frames_to_read =
-				telecom_system->data_container.preamble_nSymb + telecom_system->data_container.Nsymb;
-			telecom_system->data_container.nUnder_processing_events = 0;
+			telecom_system->data_container->frames_to_read =
+				telecom_system->data_container->preamble_nSymb + telecom_system->data_container->Nsymb;
+			telecom_system->data_container->nUnder_processing_events = 0;
 
 			fifo_buffer_tx.flush();
 			fifo_buffer_backup.flush();
@@ -415,14 +415,14 @@ void cl_arq_controller::process_messages_tx_control()
 			// scans only the tail of the buffer, so each poll is cheap (~120μs).
 			// The ACK arrives after responder decode + prep + TX + audio latency;
 			// polling adapts to any round-trip time without timing estimation.
-			telecom_system->data_container.frames_to_read = 4;
+			telecom_system->data_container->frames_to_read = 4;
 		}
 		else
 		{
 			// Fallback: expect short LDPC ctrl frame
 			telecom_system->set_mfsk_ctrl_mode(true);
-			telecom_system->data_container.frames_to_read =
-				telecom_system->data_container.preamble_nSymb + telecom_system->get_active_nsymb();
+			telecom_system->data_container->frames_to_read =
+				telecom_system->data_container->preamble_nSymb + telecom_system->get_active_nsymb();
 		}
 		connection_status=RECEIVING_ACKS_CONTROL;
 
@@ -436,7 +436,7 @@ void cl_arq_controller::process_messages_tx_control()
 		receiving_timer.start();
 		printf("[CMD-RX] Entering receive mode: ack_cfg=%d recv_timeout=%d msg_tx_time=%d ctrl_tx_time=%d ack_batch=%d ftr=%d\n",
 			ack_configuration, receiving_timeout, message_transmission_time_ms, ctrl_transmission_time_ms, ack_batch_size,
-			telecom_system->data_container.frames_to_read.load());
+			telecom_system->data_container->frames_to_read.load());
 		fflush(stdout);
 
 		if(messages_control.data[0]==SET_CONFIG)
@@ -558,14 +558,14 @@ void cl_arq_controller::process_messages_tx_data()
 		if(ack_pattern_time_ms > 0)
 		{
 			// Expect ACK tone pattern — poll frequently (same as control path).
-			telecom_system->data_container.frames_to_read = 4;
+			telecom_system->data_container->frames_to_read = 4;
 		}
 		else
 		{
 			// Fallback: expect short LDPC ctrl frame
 			telecom_system->set_mfsk_ctrl_mode(true);
-			telecom_system->data_container.frames_to_read =
-				telecom_system->data_container.preamble_nSymb + telecom_system->get_active_nsymb();
+			telecom_system->data_container->frames_to_read =
+				telecom_system->data_container->preamble_nSymb + telecom_system->get_active_nsymb();
 		}
 		data_ack_received=NO;
 		connection_status=RECEIVING_ACKS_DATA;
@@ -579,6 +579,32 @@ void cl_arq_controller::process_messages_tx_data()
 	}
 }
 
+// Data frames of an incremental redundancy configuration are sent as a first part the first time
+// and in full on every resend after an ACK timeout. A message repeated to pad the batch counts as
+// one more transmission.
+int cl_arq_controller::get_ir_part(int batch_index)
+{
+	st_message* message=&messages_batch_tx[batch_index];
+	if(message->type!=DATA_LONG && message->type!=DATA_SHORT)
+	{
+		return IR_FULL;
+	}
+
+	int transmission=this->nResends-message->nResends;
+	if(transmission<0)
+	{
+		transmission=0;
+	}
+	for(int i=0;i<batch_index;i++)
+	{
+		if(messages_batch_tx[i].id==message->id && (messages_batch_tx[i].type==DATA_LONG || messages_batch_tx[i].type==DATA_SHORT))
+		{
+			transmission++;
+		}
+	}
+	return (transmission==0)?IR_FIRST:IR_FULL;
+}
+
 void cl_arq_controller::process_messages_rx_acks_control()
 {
 	if (receiving_timer.get_elapsed_time_ms()<receiving_timeout)
@@ -699,7 +725,7 @@ void cl_arq_controller::process_messages_rx_acks_control()
 					emergency_break_retries = 3;
 					break_recovery_phase = 0;  // BREAK ACK handler will set to 1
 					send_break_pattern();
-					telecom_system->data_container.frames_to_read = 4;
+					telecom_system->data_container->frames_to_read = 4;
 					calculate_receiving_timeout();
 					receiving_timer.start();
 					return;
@@ -735,7 +761,7 @@ void cl_arq_controller::process_messages_rx_acks_control()
 					emergency_break_retries = 3;
 					break_recovery_phase = 0;
 					send_break_pattern();
-					telecom_system->data_container.frames_to_read = 4;
+					telecom_system->data_container->frames_to_read = 4;
 					calculate_receiving_timeout();
 					receiving_timer.start();
 					return;
@@ -796,7 +822,7 @@ void cl_arq_controller::process_messages_rx_acks_control()
 				fifo_buffer_backup.flush();
 
 				send_break_pattern();
-				telecom_system->data_container.frames_to_read = 4;
+				telecom_system->data_container->frames_to_read = 4;
 				calculate_receiving_timeout();
 				receiving_timer.start();
 				return;
@@ -845,7 +871,7 @@ void cl_arq_controller::process_messages_rx_acks_control()
 				emergency_nack_count = 0;
 
 				send_break_pattern();
-				telecom_system->data_container.frames_to_read = 4;
+				telecom_system->data_container->frames_to_read = 4;
 				calculate_receiving_timeout();
 				receiving_timer.start();
 				return;
@@ -879,7 +905,7 @@ void cl_arq_controller::process_messages_rx_acks_control()
 					emergency_break_active = 1;
 					emergency_break_retries = 3;
 					send_break_pattern();
-					telecom_system->data_container.frames_to_read = 4;
+					telecom_system->data_container->frames_to_read = 4;
 					calculate_receiving_timeout();
 					receiving_timer.start();
 					return;
@@ -1036,7 +1062,7 @@ void cl_arq_controller::process_messages_rx_acks_data()
 			emergency_nack_count = 0;
 
 			send_break_pattern();
-			telecom_system->data_container.frames_to_read = 4;
+			telecom_system->data_container->frames_to_read = 4;
 			calculate_receiving_timeout();
 			receiving_timer.start();
 			return;
@@ -1078,7 +1104,7 @@ void cl_arq_controller::process_messages_rx_acks_data()
 				emergency_break_retries = 3;
 				send_break_pattern();
 				// Poll for ACK from responder
-				telecom_system->data_container.frames_to_read = 4;
+				telecom_system->data_container->frames_to_read = 4;
 				calculate_receiving_timeout();
 				receiving_timer.start();
 				return;
@@ -1431,9 +1457,9 @@ void cl_arq_controller::process_control_commander()
 				messages_rx_buffer.status=FREE;
 				// Reset RX state machine - wait for fresh data (prevents decode of self-received TX audio).
 				// Frame completeness gating handles late arrivals adaptively.
-				telecom_system->data_container.frames_to_read =
-					telecom_system->data_container.preamble_nSymb + telecom_system->data_container.Nsymb;
-				telecom_system->data_container.nUnder_processing_events = 0;
+				telecom_system->data_container->frames_to_read =
+					telecom_system->data_container->preamble_nSymb + telecom_system->data_container->Nsymb;
+				telecom_system->data_container->nUnder_processing_events = 0;
 				telecom_system->receive_stats.mfsk_search_raw = 0;
 			}
 			else if (messages_control.data[0]==SET_CONFIG)
@@ -1549,9 +1575,9 @@ void cl_arq_controller::process_control_commander()
 			this->connection_status=RECEIVING;
 			reset_all_timers();
 			// Reset RX state machine - wait for fresh data (prevents decode of self-received TX audio)
-			telecom_system->data_container.frames_to_read =
-				telecom_system->data_container.preamble_nSymb + telecom_system->data_container.Nsymb;
-			telecom_system->data_container.nUnder_processing_events = 0;
+			telecom_system->data_container->frames_to_read =
+				telecom_system->data_container->preamble_nSymb + telecom_system->data_container->Nsymb;
+			telecom_system->data_container->nUnder_processing_events = 0;
 
 			fifo_buffer_tx.flush();
 			fifo_buffer_backup.flush();
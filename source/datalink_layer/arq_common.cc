@@ -25,6 +25,8 @@
 #include <cmath>
 #include <cstring>
 #include <chrono>
+#include <thread>
+#include <atomic>
 
 #ifdef MERCURY_GUI_ENABLED
 #include "gui/gui_state.h"
@@ -51,6 +53,22 @@ cl_arq_controller::cl_arq_controller()
 	messages_batch_ack=NULL;
 	message_TxRx_byte_buffer=NULL;
 
+	batch_tx_frames=NULL;
+	batch_tx_frames_size=0;
+	batch_tx_ir_part=NULL;
+	batch_tx_output_size=NULL;
+	batch_tx_nFrames_max=0;
+	batch_tx_filtered1=NULL;
+	batch_tx_filtered2=NULL;
+	batch_tx_filtered_size=0;
+	pilot_tone_buffer=NULL;
+	pilot_tone_samples=0;
+	pilot_tone_buffer_hz=0;
+	batch_encoder_nFrames=0;
+	batch_encoder_frame_slot=0;
+	batch_encoder_quit=NO;
+	batch_frames_encoded=0;
+
 	message_batch_counter_tx=0;
 	ack_timeout_data=1000;
 	ack_timeout_control=1000;
@@ -169,6 +187,8 @@ cl_arq_controller::cl_arq_controller()
 	last_message_received_type=NONE;
 	last_message_received_code=NONE;
 
+	harq_next_id=0;
+
 	last_received_message_sequence=255;
 	data_ack_received=NO;
 	repeating_last_ack=NO;
@@ -196,6 +216,33 @@ cl_arq_controller::~cl_arq_controller()
 	{
 		delete[] messages_control_bu.data;
 	}
+	if(batch_encoder.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(batch_encoder_mutex);
+			batch_encoder_quit=YES;
+		}
+		batch_encoder_cv.notify_all();
+		batch_encoder.join();
+	}
+	if(batch_tx_frames!=NULL)
+	{
+		delete[] batch_tx_frames;
+	}
+	if(batch_tx_ir_part!=NULL)
+	{
+		delete[] batch_tx_ir_part;
+		delete[] batch_tx_output_size;
+	}
+	if(batch_tx_filtered1!=NULL)
+	{
+		delete[] batch_tx_filtered1;
+		delete[] batch_tx_filtered2;
+	}
+	if(pilot_tone_buffer!=NULL)
+	{
+		delete[] pilot_tone_buffer;
+	}
 	this->deinit_messages_buffers();
 }
 
@@ -623,7 +670,7 @@ void cl_arq_controller::load_configuration(int configuration, int level, int bac
 	// Pause audio capture during PHY reconfig to prevent race condition:
 	// telecom_system->load_configuration may deinit/reinit buffers that
 	// the audio callback accesses (passband_delayed_data, etc.)
-	telecom_system->data_container.frames_to_read = 0;
+	telecom_system->data_container->frames_to_read = 0;
 	telecom_system->load_configuration(configuration);
 	int nBytes_header=0;
 	if (ACK_MULTI_ACK_RANGE_HEADER_LENGTH>nBytes_header) nBytes_header=ACK_MULTI_ACK_RANGE_HEADER_LENGTH;
@@ -631,8 +678,8 @@ void cl_arq_controller::load_configuration(int configuration, int level, int bac
 	if (DATA_LONG_HEADER_LENGTH>nBytes_header) nBytes_header=DATA_LONG_HEADER_LENGTH;
 	if (DATA_SHORT_HEADER_LENGTH>nBytes_header) nBytes_header=DATA_SHORT_HEADER_LENGTH;
 
-	int nBytes_data=(telecom_system->data_container.nBits-telecom_system->ldpc.P-telecom_system->outer_code_reserved_bits)/8 - nBytes_header;
-	int nBytes_message=(telecom_system->data_container.nBits)/8 ;
+	int nBytes_data=(telecom_system->data_container->nBits-telecom_system->ldpc->P-telecom_system->outer_code_reserved_bits)/8 - nBytes_header;
+	int nBytes_message=(telecom_system->data_container->nBits)/8 ;
 
 
 	set_max_buffer_length(nBytes_data, nBytes_message, nBytes_header);
@@ -666,17 +713,17 @@ void cl_arq_controller::load_configuration(int configuration, int level, int bac
 	// NOTE: turboshift state is NOT reset here — it persists across config changes.
 	// Only reset at connection init (see init code above).
 
-	message_transmission_time_ms=ceil((1000.0*(telecom_system->data_container.Nsymb+telecom_system->data_container.preamble_nSymb)*telecom_system->data_container.Nofdm*telecom_system->frequency_interpolation_rate)/(float)(telecom_system->frequency_interpolation_rate*(telecom_system->bandwidth/telecom_system->ofdm.Nc)*telecom_system->ofdm.Nfft));
+	message_transmission_time_ms=ceil((1000.0*(telecom_system->data_container->Nsymb+telecom_system->data_container->preamble_nSymb)*telecom_system->data_container->Nofdm*telecom_system->frequency_interpolation_rate)/(float)(telecom_system->frequency_interpolation_rate*(telecom_system->bandwidth/telecom_system->ofdm->Nc)*telecom_system->ofdm->Nfft));
 	if(telecom_system->ctrl_nsymb > 0)
 	{
-		ctrl_transmission_time_ms=ceil((1000.0*(telecom_system->ctrl_nsymb+telecom_system->data_container.preamble_nSymb)*telecom_system->data_container.Nofdm*telecom_system->frequency_interpolation_rate)/(float)(telecom_system->frequency_interpolation_rate*(telecom_system->bandwidth/telecom_system->ofdm.Nc)*telecom_system->ofdm.Nfft));
+		ctrl_transmission_time_ms=ceil((1000.0*(telecom_system->ctrl_nsymb+telecom_system->data_container->preamble_nSymb)*telecom_system->data_container->Nofdm*telecom_system->frequency_interpolation_rate)/(float)(telecom_system->frequency_interpolation_rate*(telecom_system->bandwidth/telecom_system->ofdm->Nc)*telecom_system->ofdm->Nfft));
 	}
 	else
 	{
 		ctrl_transmission_time_ms=message_transmission_time_ms;
 	}
     // TODO: After audio I/O rewrite we don't use this anymore. Was:
-	// time_left_to_send_last_frame=(float)telecom_system->speaker.frames_to_leave_transmit_fct/(float)(telecom_system->frequency_interpolation_rate*(telecom_system->bandwidth/telecom_system->ofdm.Nc)*telecom_system->ofdm.Nfft);
+	// time_left_to_send_last_frame=(float)telecom_system->speaker.frames_to_leave_transmit_fct/(float)(telecom_system->frequency_interpolation_rate*(telecom_system->bandwidth/telecom_system->ofdm->Nc)*telecom_system->ofdm->Nfft);
     time_left_to_send_last_frame=0;
 
 	// Scale data_batch_size for ~10s block duration (OFDM modes only).
@@ -778,6 +825,11 @@ void cl_arq_controller::load_configuration(int configuration, int level, int bac
 	{
 		this->init_messages_buffers();
 	}
+
+	int batch_size_max=data_batch_size;
+	if(control_batch_size>batch_size_max) batch_size_max=control_batch_size;
+	if(ack_batch_size>batch_size_max) batch_size_max=ack_batch_size;
+	init_batch_tx(batch_size_max);
 }
 
 void cl_arq_controller::return_to_last_configuration()
@@ -1426,10 +1478,10 @@ void cl_arq_controller::update_status()
 					connection_status = RECEIVING;
 					watchdog_timer.start();
 					link_timer.start();
-					telecom_system->data_container.frames_to_read =
-						telecom_system->data_container.preamble_nSymb
-						+ telecom_system->data_container.Nsymb;
-					telecom_system->data_container.nUnder_processing_events = 0;
+					telecom_system->data_container->frames_to_read =
+						telecom_system->data_container->preamble_nSymb
+						+ telecom_system->data_container->Nsymb;
+					telecom_system->data_container->nUnder_processing_events = 0;
 					telecom_system->receive_stats.mfsk_search_raw = 0;
 				}
 				else
@@ -1714,20 +1766,14 @@ void cl_arq_controller::process_main()
 	if(link_status == LISTENING || link_status == IDLE || link_status == DROPPED)
 	{
 		MUTEX_LOCK(&capture_prep_mutex);
-		if(telecom_system->data_container.frames_to_read == 0)
+		if(telecom_system->data_container->frames_to_read == 0)
 		{
-			int signal_period = telecom_system->data_container.Nofdm *
-				telecom_system->data_container.buffer_Nsymb *
-				telecom_system->data_container.interpolation_rate;
-
-			memcpy(telecom_system->data_container.ready_to_process_passband_delayed_data,
-				telecom_system->data_container.passband_delayed_data,
-				signal_period * sizeof(double));
+			telecom_system->data_container->snapshot_passband_window();
 
 			MUTEX_UNLOCK(&capture_prep_mutex);
 
 			measurements.signal_stregth_dbm = telecom_system->measure_signal_only(
-				telecom_system->data_container.ready_to_process_passband_delayed_data);
+				telecom_system->data_container->ready_to_process_passband_delayed_data);
 		}
 		else
 		{
@@ -2013,6 +2059,8 @@ void cl_arq_controller::reset_session_state()
 	last_message_received_type = NONE;
 	last_message_received_code = NONE;
 	last_received_message_sequence = 255;
+	telecom_system->harq_flush();
+	harq_next_id = 0;
 
 	// Connection
 	connection_id = 0;
@@ -2072,7 +2120,7 @@ void cl_arq_controller::send(st_message* message, int message_location)
 
 	for(int i=0;i<(header_length+message->length);i++)
 	{
-		telecom_system->data_container.data_byte[i]=(int)(unsigned char)message_TxRx_byte_buffer[i];
+		telecom_system->data_container->data_byte[i]=(int)(unsigned char)message_TxRx_byte_buffer[i];
 	}
 
 	if(message->type == DATA_LONG || message->type == DATA_SHORT)
@@ -2080,13 +2128,13 @@ void cl_arq_controller::send(st_message* message, int message_location)
 		hex_trace("S3-TX-PACK", message_TxRx_byte_buffer, header_length + message->length);
 	}
 
-	telecom_system->transmit_byte(telecom_system->data_container.data_byte,header_length+message->length,telecom_system->data_container.ready_to_transmit_passband_data_tx,message_location);
+	telecom_system->transmit_byte(telecom_system->data_container->data_byte,header_length+message->length,telecom_system->data_container->ready_to_transmit_passband_data_tx,message_location);
 
 	{
 		int active_nsymb = telecom_system->get_active_nsymb();
-		tx_transfer(telecom_system->data_container.ready_to_transmit_passband_data_tx,
-					telecom_system->data_container.Nofdm * telecom_system->data_container.interpolation_rate *
-					(active_nsymb + telecom_system->data_container.preamble_nSymb));
+		tx_transfer(telecom_system->data_container->ready_to_transmit_passband_data_tx,
+					telecom_system->data_container->Nofdm * telecom_system->data_container->interpolation_rate *
+					(active_nsymb + telecom_system->data_container->preamble_nSymb));
 	}
 
 	while (size_buffer(playback_buffer) > 0)
@@ -2101,187 +2149,322 @@ void cl_arq_controller::send(st_message* message, int message_location)
 
 }
 
-void cl_arq_controller::send_batch()
+// Builds the header of batch message index and modulates it, unfiltered, to out.
+void cl_arq_controller::encode_batch_frame(int index, int ir_part, double* out)
 {
-	printf("[TX] send_batch() on CONFIG_%d, %d messages, first type=%d\n",
-		current_configuration, message_batch_counter_tx,
-		message_batch_counter_tx > 0 ? messages_batch_tx[0].type : -1);
-	fflush(stdout);
+	int header_length=0;
 
-	// Flush capture buffer at the START of send_batch(), before TX begins.
-	// On VB-Cable (and real radios), the responder decodes the frame and sends
-	// its ACK pattern while the commander may still be draining playback or in
-	// PTT-off delay. By flushing here, the buffer is clean BEFORE self-echo
-	// starts, and the ACK pattern that arrives after the frame is preserved.
-	// The order-aware ACK detector distinguishes ACK tones from OFDM self-echo.
-	circular_buf_reset(capture_buffer);
+	messages_batch_tx[index].sequence_number=index;
+
+	if(messages_batch_tx[index].type==DATA_LONG)
 	{
-		int buf_samples = telecom_system->data_container.Nofdm * telecom_system->data_container.buffer_Nsymb * telecom_system->data_container.interpolation_rate;
-		MUTEX_LOCK(&capture_prep_mutex);
-		memset(telecom_system->data_container.passband_delayed_data, 0, buf_samples * sizeof(double));
-		MUTEX_UNLOCK(&capture_prep_mutex);
+		message_TxRx_byte_buffer[0]=messages_batch_tx[index].type;
+		message_TxRx_byte_buffer[1]=connection_id;
+		message_TxRx_byte_buffer[2]=messages_batch_tx[index].sequence_number;
+		message_TxRx_byte_buffer[3]=messages_batch_tx[index].id;
+		header_length=DATA_LONG_HEADER_LENGTH;
+	}
+	else if (messages_batch_tx[index].type==DATA_SHORT)
+	{
+		message_TxRx_byte_buffer[0]=messages_batch_tx[index].type;
+		message_TxRx_byte_buffer[1]=connection_id;
+		message_TxRx_byte_buffer[2]=messages_batch_tx[index].sequence_number;
+		message_TxRx_byte_buffer[3]=messages_batch_tx[index].id;
+		message_TxRx_byte_buffer[4]=messages_batch_tx[index].length;
+		header_length=DATA_SHORT_HEADER_LENGTH;
+	}
+	else if (messages_batch_tx[index].type==ACK_RANGE || messages_batch_tx[index].type==ACK_MULTI)
+	{
+		message_TxRx_byte_buffer[0]=messages_batch_tx[index].type;
+		message_TxRx_byte_buffer[1]=connection_id;
+		message_TxRx_byte_buffer[2]=messages_batch_tx[index].sequence_number;
+		header_length=ACK_MULTI_ACK_RANGE_HEADER_LENGTH;
+	}
+	else if (messages_batch_tx[index].type==CONTROL || messages_batch_tx[index].type==ACK_CONTROL)
+	{
+		message_TxRx_byte_buffer[0]=messages_batch_tx[index].type;
+		message_TxRx_byte_buffer[1]=connection_id;
+		message_TxRx_byte_buffer[2]=messages_batch_tx[index].sequence_number;
+		header_length=CONTROL_ACK_CONTROL_HEADER_LENGTH;
 	}
-	telecom_system->data_container.nUnder_processing_events = 0;
-	telecom_system->receive_stats.delay_of_last_decoded_message = -1;
-	telecom_system->receive_stats.mfsk_search_raw = 0;
 
-	ptt_on();
+	for(int j=0;j<messages_batch_tx[index].length;j++)
+	{
+		message_TxRx_byte_buffer[j+header_length]=messages_batch_tx[index].data[j];
+	}
 
-	cl_timer ptt_on_delay, ptt_off_delay;
-	ptt_on_delay.start();
+	if(header_length>max_header_length)
+	{
+		std::cout<<"header size is too big, adjust the configuration parameters"<<std::endl;
+		exit(0);
+	}
 
-	int active_nsymb = telecom_system->get_active_nsymb();
-	int frame_output_size = telecom_system->data_container.Nofdm*telecom_system->data_container.interpolation_rate*(active_nsymb+telecom_system->data_container.preamble_nSymb);
+	for(int j=0;j<(header_length+messages_batch_tx[index].length);j++)
+	{
+		telecom_system->data_container->data_byte[j]=(int)(unsigned char)message_TxRx_byte_buffer[j];
+	}
 
-	double *batch_frames_output_data=NULL;
-	double *batch_frames_output_data_filtered1=NULL;
-	double *batch_frames_output_data_filtered2=NULL;
+	// Debug: show serialized bytes before transmit
+	{
+		int total = header_length + messages_batch_tx[index].length;
+		printf("[TX-BYTES] frame=%d type=%d connid=%d hdr=%d len=%d bytes:",
+			index, messages_batch_tx[index].type, (int)(unsigned char)connection_id,
+			header_length, messages_batch_tx[index].length);
+		for(int j=0; j<total && j<12; j++)
+			printf(" %02x", (unsigned char)message_TxRx_byte_buffer[j]);
+		printf("\n");
+		fflush(stdout);
+	}
 
-	batch_frames_output_data=new double[(message_batch_counter_tx+2)*frame_output_size];
-	batch_frames_output_data_filtered1=new double[(message_batch_counter_tx+2)*frame_output_size];
-	batch_frames_output_data_filtered2=new double[(message_batch_counter_tx+2)*frame_output_size];
+	telecom_system->set_ir_part(ir_part);
+	telecom_system->transmit_byte(telecom_system->data_container->data_byte,header_length+messages_batch_tx[index].length,out,NO_FILTER_MESSAGE);
+	telecom_system->set_ir_part(IR_FULL);
+}
 
-	if (batch_frames_output_data==NULL)
+// Chase combining key of the next frame received. The message id of a data frame is only known
+// once it decodes, but the commander sends the missing messages of a batch in increasing id
+// order: a failed frame is most likely the first missing message after the last one received
+// in this batch. The CRC16 still confirms every combination.
+int cl_arq_controller::get_harq_rx_key()
+{
+	if(role!=RESPONDER || link_status!=CONNECTED || connection_status!=RECEIVING)
 	{
-		exit(-31);
+		return HARQ_NO_KEY;
 	}
-	if (batch_frames_output_data_filtered1==NULL)
+	for(int i=harq_next_id;i<nMessages;i++)
 	{
-		exit(-32);
+		if(messages_rx[i].status==FREE)
+		{
+			return i;
+		}
 	}
-	if (batch_frames_output_data_filtered2==NULL)
+	return HARQ_NO_KEY;
+}
+
+// Runs the next nItems samples of the batch through FIR_tx1 and FIR_tx2 and plays the filtered
+// samples in [play_begin,play_end). Both filters run as streams, so the output lags the zero
+// phase filtering of the whole batch by the sum of their group delays; *position counts the
+// samples fed so far.
+void cl_arq_controller::stream_batch_tx(double* in, int nItems, int* position, int play_begin, int play_end)
+{
+	if(nItems>batch_tx_filtered_size)
 	{
-		exit(-33);
+		if(batch_tx_filtered1!=NULL)
+		{
+			delete[] batch_tx_filtered1;
+			delete[] batch_tx_filtered2;
+		}
+		batch_tx_filtered1=new double[nItems];
+		batch_tx_filtered2=new double[nItems];
+		batch_tx_filtered_size=nItems;
 	}
 
-	int header_length=0;
-	for(int i=0;i<message_batch_counter_tx;i++)
-	{
-		messages_batch_tx[i].sequence_number=i;
+	telecom_system->ofdm->FIR_tx1.apply_stream(in,batch_tx_filtered1,nItems);
+	telecom_system->ofdm->FIR_tx2.apply_stream(batch_tx_filtered1,batch_tx_filtered2,nItems);
 
-		header_length=0;
+	int output_start=*position-telecom_system->ofdm->FIR_tx1.filter_nTaps/2-telecom_system->ofdm->FIR_tx2.filter_nTaps/2;
+	int first=(play_begin>output_start)?play_begin:output_start;
+	int last=(play_end<output_start+nItems)?play_end:output_start+nItems;
+	if(last>first)
+	{
+		tx_transfer(&batch_tx_filtered2[first-output_start],last-first);
+	}
+	*position+=nItems;
+}
 
-		if(messages_batch_tx[i].type==DATA_LONG)
+// Fits the batch buffers to nFrames frames of the current configuration and the pilot tone to
+// its settings, only what is too small or out of date is rebuilt. Starts batch_encoder.
+void cl_arq_controller::init_batch_tx(int nFrames)
+{
+	int frame_slot=telecom_system->data_container->total_frame_size;
+	if(nFrames*frame_slot>batch_tx_frames_size)
+	{
+		if(batch_tx_frames!=NULL)
 		{
-			message_TxRx_byte_buffer[0]=messages_batch_tx[i].type;
-			message_TxRx_byte_buffer[1]=connection_id;
-			message_TxRx_byte_buffer[2]=messages_batch_tx[i].sequence_number;
-			message_TxRx_byte_buffer[3]=messages_batch_tx[i].id;
-			header_length=DATA_LONG_HEADER_LENGTH;
+			delete[] batch_tx_frames;
 		}
-		else if (messages_batch_tx[i].type==DATA_SHORT)
+		batch_tx_frames=new double[nFrames*frame_slot];
+		batch_tx_frames_size=nFrames*frame_slot;
+		if (batch_tx_frames==NULL)
 		{
-			message_TxRx_byte_buffer[0]=messages_batch_tx[i].type;
-			message_TxRx_byte_buffer[1]=connection_id;
-			message_TxRx_byte_buffer[2]=messages_batch_tx[i].sequence_number;
-			message_TxRx_byte_buffer[3]=messages_batch_tx[i].id;
-			message_TxRx_byte_buffer[4]=messages_batch_tx[i].length;
-			header_length=DATA_SHORT_HEADER_LENGTH;
+			exit(-31);
 		}
-		else if (messages_batch_tx[i].type==ACK_RANGE || messages_batch_tx[i].type==ACK_MULTI)
+	}
+	if(nFrames>batch_tx_nFrames_max)
+	{
+		if(batch_tx_ir_part!=NULL)
 		{
-			message_TxRx_byte_buffer[0]=messages_batch_tx[i].type;
-			message_TxRx_byte_buffer[1]=connection_id;
-			message_TxRx_byte_buffer[2]=messages_batch_tx[i].sequence_number;
-			header_length=ACK_MULTI_ACK_RANGE_HEADER_LENGTH;
+			delete[] batch_tx_ir_part;
+			delete[] batch_tx_output_size;
 		}
-		else if (messages_batch_tx[i].type==CONTROL || messages_batch_tx[i].type==ACK_CONTROL)
+		batch_tx_ir_part=new int[nFrames];
+		batch_tx_output_size=new int[nFrames];
+		batch_tx_nFrames_max=nFrames;
+		if (batch_tx_ir_part==NULL || batch_tx_output_size==NULL)
 		{
-			message_TxRx_byte_buffer[0]=messages_batch_tx[i].type;
-			message_TxRx_byte_buffer[1]=connection_id;
-			message_TxRx_byte_buffer[2]=messages_batch_tx[i].sequence_number;
-			header_length=CONTROL_ACK_CONTROL_HEADER_LENGTH;
+			exit(-30);
 		}
+	}
 
-		for(int j=0;j<messages_batch_tx[i].length;j++)
+	// Pilot tone (configurable frequency to warm up TX/amp)
+	const double SAMPLE_RATE = 48000.0;
+	int pilot_samples = (pilot_tone_ms > 0 && pilot_tone_hz > 0) ? (int)(pilot_tone_ms * SAMPLE_RATE / 1000.0) : 0;
+	if(pilot_samples != pilot_tone_samples || pilot_tone_hz != pilot_tone_buffer_hz)
+	{
+		if(pilot_tone_buffer!=NULL)
 		{
-			message_TxRx_byte_buffer[j+header_length]=messages_batch_tx[i].data[j];
+			delete[] pilot_tone_buffer;
+			pilot_tone_buffer=NULL;
 		}
-
-		if(header_length>max_header_length)
+		pilot_tone_samples = pilot_samples;
+		pilot_tone_buffer_hz = pilot_tone_hz;
+		if(pilot_samples > 0)
 		{
-			std::cout<<"header size is too big, adjust the configuration parameters"<<std::endl;
-			exit(0);
+			const double PILOT_FREQ = (double)pilot_tone_hz;
+			const double PI = 3.14159265358979323846;
+			pilot_tone_buffer = new double[pilot_samples];
+
+			for(int i = 0; i < pilot_samples; i++)
+			{
+				// Generate sine wave with soft ramp up/down to avoid clicks
+				double t = (double)i / SAMPLE_RATE;
+				double envelope = 1.0;
+				int ramp_samples = (int)(SAMPLE_RATE * 0.005); // 5ms ramp
+				if(i < ramp_samples)
+					envelope = (double)i / ramp_samples;
+				else if(i > pilot_samples - ramp_samples)
+					envelope = (double)(pilot_samples - i) / ramp_samples;
+
+				pilot_tone_buffer[i] = envelope * 0.5 * sin(2.0 * PI * PILOT_FREQ * t);
+			}
 		}
+	}
+
+	if(!batch_encoder.joinable())
+	{
+		batch_encoder=std::thread(&cl_arq_controller::batch_encoder_loop,this);
+	}
+}
 
-		for(int j=0;j<(header_length+messages_batch_tx[i].length);j++)
+// Encodes the frames of each batch send_batch() hands over, one after the other.
+void cl_arq_controller::batch_encoder_loop()
+{
+	std::unique_lock<std::mutex> lock(batch_encoder_mutex);
+	while(1)
+	{
+		batch_encoder_cv.wait(lock,[this](){return batch_encoder_nFrames>0 || batch_encoder_quit==YES;});
+		if(batch_encoder_quit==YES)
 		{
-			telecom_system->data_container.data_byte[j]=(int)(unsigned char)message_TxRx_byte_buffer[j];
+			return;
 		}
-
-		// Debug: show serialized bytes before transmit
+		int nFrames=batch_encoder_nFrames;
+		int frame_slot=batch_encoder_frame_slot;
+		lock.unlock();
+		for(int i=0;i<nFrames;i++)
 		{
-			int total = header_length + messages_batch_tx[i].length;
-			printf("[TX-BYTES] frame=%d type=%d connid=%d hdr=%d len=%d bytes:",
-				i, messages_batch_tx[i].type, (int)(unsigned char)connection_id,
-				header_length, messages_batch_tx[i].length);
-			for(int j=0; j<total && j<12; j++)
-				printf(" %02x", (unsigned char)message_TxRx_byte_buffer[j]);
-			printf("\n");
-			fflush(stdout);
+			encode_batch_frame(i,batch_tx_ir_part[i],&batch_tx_frames[i*frame_slot]);
+			batch_frames_encoded.store(i+1);
 		}
+		lock.lock();
+		batch_encoder_nFrames=0;
+		batch_encoder_cv.notify_all();
+	}
+}
 
-		telecom_system->transmit_byte(telecom_system->data_container.data_byte,header_length+messages_batch_tx[i].length,&batch_frames_output_data[(i+1)*frame_output_size],NO_FILTER_MESSAGE);
+void cl_arq_controller::send_batch()
+{
+	printf("[TX] send_batch() on CONFIG_%d, %d messages, first type=%d\n",
+		current_configuration, message_batch_counter_tx,
+		message_batch_counter_tx > 0 ? messages_batch_tx[0].type : -1);
+	fflush(stdout);
 
+	// Flush capture buffer at the START of send_batch(), before TX begins.
+	// On VB-Cable (and real radios), the responder decodes the frame and sends
+	// its ACK pattern while the commander may still be draining playback or in
+	// PTT-off delay. By flushing here, the buffer is clean BEFORE self-echo
+	// starts, and the ACK pattern that arrives after the frame is preserved.
+	// The order-aware ACK detector distinguishes ACK tones from OFDM self-echo.
+	circular_buf_reset(capture_buffer);
+	MUTEX_LOCK(&capture_prep_mutex);
+	telecom_system->data_container->clear_passband_window();
+	MUTEX_UNLOCK(&capture_prep_mutex);
+	telecom_system->data_container->nUnder_processing_events = 0;
+	telecom_system->receive_stats.delay_of_last_decoded_message = -1;
+	telecom_system->receive_stats.mfsk_search_raw = 0;
 
-		last_message_sent_type=messages_batch_tx[i].type;
-		if(messages_batch_tx[i].type==CONTROL || messages_batch_tx[i].type==ACK_CONTROL)
-		{
-			last_message_sent_code=messages_batch_tx[i].data[0];
-		}
-		last_received_message_sequence=-1;
+	ptt_on();
 
-	}
+	cl_timer ptt_on_delay, ptt_off_delay;
+	ptt_on_delay.start();
 
-	for(int i=0;i<frame_output_size;i++) //padding start and end to prepare for filtering
+	// Frames differ in length when incremental redundancy sends part of a codeword.
+	init_batch_tx(message_batch_counter_tx);
+	int* frame_ir_part=batch_tx_ir_part;
+	int* frame_output_size=batch_tx_output_size;
+	int batch_output_size=0;
+	for(int i=0;i<message_batch_counter_tx;i++)
 	{
-		batch_frames_output_data[(0)*frame_output_size+i]=batch_frames_output_data[(0+1)*frame_output_size+i];
-		batch_frames_output_data[(message_batch_counter_tx+1)*frame_output_size+i]=batch_frames_output_data[(message_batch_counter_tx)*frame_output_size+i];
+		frame_ir_part[i]=get_ir_part(i);
+		telecom_system->set_ir_part(frame_ir_part[i]);
+		frame_output_size[i]=telecom_system->data_container->Nofdm*telecom_system->data_container->interpolation_rate*(telecom_system->get_active_nsymb()+telecom_system->data_container->preamble_nSymb);
+		batch_output_size+=frame_output_size[i];
 	}
+	telecom_system->set_ir_part(IR_FULL);
 
+	// transmit_byte() always writes a full frame. Frame 0 is played while the following frames
+	// are still being encoded.
+	int frame_slot=telecom_system->data_container->total_frame_size;
 	{
-		int total_fir_size = (message_batch_counter_tx+2)*frame_output_size;
-		memset(batch_frames_output_data_filtered1, 0, total_fir_size * sizeof(double));
-		memset(batch_frames_output_data_filtered2, 0, total_fir_size * sizeof(double));
-		telecom_system->ofdm.FIR_tx1.apply(batch_frames_output_data,batch_frames_output_data_filtered1,total_fir_size);
-		telecom_system->ofdm.FIR_tx2.apply(batch_frames_output_data_filtered1,batch_frames_output_data_filtered2,total_fir_size);
+		std::lock_guard<std::mutex> lock(batch_encoder_mutex);
+		batch_frames_encoded=0;
+		batch_encoder_frame_slot=frame_slot;
+		batch_encoder_nFrames=message_batch_counter_tx;
 	}
+	batch_encoder_cv.notify_all();
 
 	while(ptt_on_delay.get_elapsed_time_ms() < ptt_on_delay_ms)
 		msleep(1);
 
-	// Generate pilot tone if enabled (configurable frequency to warm up TX/amp)
-	if(pilot_tone_ms > 0 && pilot_tone_hz > 0)
+	if(pilot_tone_samples > 0)
 	{
-		const double SAMPLE_RATE = 48000.0;
-		const double PILOT_FREQ = (double)pilot_tone_hz;
-		const double PI = 3.14159265358979323846;
-		int pilot_samples = (int)(pilot_tone_ms * SAMPLE_RATE / 1000.0);
-		double* pilot_buffer = new double[pilot_samples];
+		tx_transfer(pilot_tone_buffer, pilot_tone_samples);
+	}
 
-		for(int i = 0; i < pilot_samples; i++)
-		{
-			// Generate sine wave with soft ramp up/down to avoid clicks
-			double t = (double)i / SAMPLE_RATE;
-			double envelope = 1.0;
-			int ramp_samples = (int)(SAMPLE_RATE * 0.005); // 5ms ramp
-			if(i < ramp_samples)
-				envelope = (double)i / ramp_samples;
-			else if(i > pilot_samples - ramp_samples)
-				envelope = (double)(pilot_samples - i) / ramp_samples;
+	// The batch is filtered as if padded with a copy of the first frame in front and of the last
+	// frame behind, only the frames themselves are played.
+	int position=0;
+	int play_begin=0;
+	telecom_system->ofdm->FIR_tx1.reset_stream();
+	telecom_system->ofdm->FIR_tx2.reset_stream();
+	for(int i=0;i<message_batch_counter_tx;i++)
+	{
+		while(batch_frames_encoded.load()<=i)
+			msleep(1);
 
-			pilot_buffer[i] = envelope * 0.5 * sin(2.0 * PI * PILOT_FREQ * t);
+		if(i==0)
+		{
+			play_begin=frame_output_size[0];
+			stream_batch_tx(batch_tx_frames,frame_output_size[0],&position,play_begin,play_begin+batch_output_size);
 		}
+		printf("[TX] tx_transfer frame %d/%d, size=%d ir_part=%d\n", i, message_batch_counter_tx, frame_output_size[i], frame_ir_part[i]);
+		fflush(stdout);
+		stream_batch_tx(&batch_tx_frames[i*frame_slot],frame_output_size[i],&position,play_begin,play_begin+batch_output_size);
 
-		tx_transfer(pilot_buffer, pilot_samples);
-		delete[] pilot_buffer;
+		last_message_sent_type=messages_batch_tx[i].type;
+		if(messages_batch_tx[i].type==CONTROL || messages_batch_tx[i].type==ACK_CONTROL)
+		{
+			last_message_sent_code=messages_batch_tx[i].data[0];
+		}
+		last_received_message_sequence=-1;
 	}
-
-	for(int i=0;i<message_batch_counter_tx;i++)
+	if(message_batch_counter_tx>0)
 	{
-		printf("[TX] tx_transfer frame %d/%d, size=%d\n", i, message_batch_counter_tx, frame_output_size);
-		fflush(stdout);
-		tx_transfer(&batch_frames_output_data_filtered2[(i+1)*frame_output_size], frame_output_size);
+		int last=message_batch_counter_tx-1;
+		stream_batch_tx(&batch_tx_frames[last*frame_slot],frame_output_size[last],&position,play_begin,play_begin+batch_output_size);
+	}
+	{
+		std::unique_lock<std::mutex> lock(batch_encoder_mutex);
+		batch_encoder_cv.wait(lock,[this](){return batch_encoder_nFrames==0;});
 	}
 
 	printf("[TX] Waiting for playback buffer to drain...\n");
@@ -2300,22 +2483,6 @@ void cl_arq_controller::send_batch()
 
 	ptt_off();
 
-	if (batch_frames_output_data!=NULL)
-	{
-		delete[] batch_frames_output_data;
-		batch_frames_output_data=NULL;
-	}
-	if (batch_frames_output_data_filtered1!=NULL)
-	{
-		delete[] batch_frames_output_data_filtered1;
-		batch_frames_output_data_filtered1=NULL;
-	}
-	if (batch_frames_output_data_filtered2!=NULL)
-	{
-		delete[] batch_frames_output_data_filtered2;
-		batch_frames_output_data_filtered2=NULL;
-	}
-
 	for(int i=0;i<message_batch_counter_tx;i++)
 	{
 		if(messages_batch_tx[i].type==DATA_LONG || messages_batch_tx[i].type==DATA_SHORT)
@@ -2344,10 +2511,10 @@ void cl_arq_controller::send_batch()
 	// Buffer was flushed at start of send_batch(). Self-echo + ACK are in
 	// the sliding buffer. Set frames_to_read for default data frame reception
 	// — callers may override for ACK pattern capture after send_batch() returns.
-	telecom_system->data_container.frames_to_read =
-		telecom_system->data_container.preamble_nSymb + telecom_system->get_active_nsymb();
+	telecom_system->data_container->frames_to_read =
+		telecom_system->data_container->preamble_nSymb + telecom_system->get_active_nsymb();
 	printf("[TX-END] frames_to_read=%d (ctrl=%d)\n",
-		telecom_system->data_container.frames_to_read.load(),
+		telecom_system->data_container->frames_to_read.load(),
 		telecom_system->mfsk_ctrl_mode ? 1 : 0);
 }
 
@@ -2363,7 +2530,7 @@ void cl_arq_controller::send_ack_pattern()
 	ptt_on_delay_timer.start();
 
 	int pattern_samples = telecom_system->ack_pattern_passband_samples;
-	int symbol_period = telecom_system->data_container.Nofdm * telecom_system->data_container.interpolation_rate;
+	int symbol_period = telecom_system->data_container->Nofdm * telecom_system->data_container->interpolation_rate;
 
 	// Allocate buffers: pattern + 1 symbol padding at each end for FIR filtering
 	int padded_size = pattern_samples + 2 * symbol_period;
@@ -2385,8 +2552,8 @@ void cl_arq_controller::send_ack_pattern()
 	// FIR filter chain (same as send_batch)
 	memset(filtered1, 0, padded_size * sizeof(double));
 	memset(filtered2, 0, padded_size * sizeof(double));
-	telecom_system->ofdm.FIR_tx1.apply(raw_output, filtered1, padded_size);
-	telecom_system->ofdm.FIR_tx2.apply(filtered1, filtered2, padded_size);
+	telecom_system->ofdm->FIR_tx1.apply(raw_output, filtered1, padded_size);
+	telecom_system->ofdm->FIR_tx2.apply(filtered1, filtered2, padded_size);
 
 	// Wait PTT on delay
 	while(ptt_on_delay_timer.get_elapsed_time_ms() < ptt_on_delay_ms)
@@ -2437,13 +2604,10 @@ void cl_arq_controller::send_ack_pattern()
 
 	// Flush capture buffer and passband_delayed_data (discard self-echo + stale patterns)
 	circular_buf_reset(capture_buffer);
-	{
-		int buf_samples = telecom_system->data_container.Nofdm * telecom_system->data_container.buffer_Nsymb * telecom_system->data_container.interpolation_rate;
-		MUTEX_LOCK(&capture_prep_mutex);
-		memset(telecom_system->data_container.passband_delayed_data, 0, buf_samples * sizeof(double));
-		MUTEX_UNLOCK(&capture_prep_mutex);
-	}
-	telecom_system->data_container.nUnder_processing_events = 0;
+	MUTEX_LOCK(&capture_prep_mutex);
+	telecom_system->data_container->clear_passband_window();
+	MUTEX_UNLOCK(&capture_prep_mutex);
+	telecom_system->data_container->nUnder_processing_events = 0;
 	telecom_system->receive_stats.delay_of_last_decoded_message = -1;
 	telecom_system->receive_stats.mfsk_search_raw = 0;
 
@@ -2463,7 +2627,7 @@ void cl_arq_controller::send_break_pattern()
 	ptt_on_delay_timer.start();
 
 	int pattern_samples = telecom_system->ack_pattern_passband_samples;
-	int symbol_period = telecom_system->data_container.Nofdm * telecom_system->data_container.interpolation_rate;
+	int symbol_period = telecom_system->data_container->Nofdm * telecom_system->data_container->interpolation_rate;
 
 	int padded_size = pattern_samples + 2 * symbol_period;
 	double *raw_output = new double[padded_size];
@@ -2482,8 +2646,8 @@ void cl_arq_controller::send_break_pattern()
 
 	memset(filtered1, 0, padded_size * sizeof(double));
 	memset(filtered2, 0, padded_size * sizeof(double));
-	telecom_system->ofdm.FIR_tx1.apply(raw_output, filtered1, padded_size);
-	telecom_system->ofdm.FIR_tx2.apply(filtered1, filtered2, padded_size);
+	telecom_system->ofdm->FIR_tx1.apply(raw_output, filtered1, padded_size);
+	telecom_system->ofdm->FIR_tx2.apply(filtered1, filtered2, padded_size);
 
 	while(ptt_on_delay_timer.get_elapsed_time_ms() < ptt_on_delay_ms)
 		msleep(1);
@@ -2528,13 +2692,10 @@ void cl_arq_controller::send_break_pattern()
 	delete[] filtered2;
 
 	circular_buf_reset(capture_buffer);
-	{
-		int buf_samples = telecom_system->data_container.Nofdm * telecom_system->data_container.buffer_Nsymb * telecom_system->data_container.interpolation_rate;
-		MUTEX_LOCK(&capture_prep_mutex);
-		memset(telecom_system->data_container.passband_delayed_data, 0, buf_samples * sizeof(double));
-		MUTEX_UNLOCK(&capture_prep_mutex);
-	}
-	telecom_system->data_container.nUnder_processing_events = 0;
+	MUTEX_LOCK(&capture_prep_mutex);
+	telecom_system->data_container->clear_passband_window();
+	MUTEX_UNLOCK(&capture_prep_mutex);
+	telecom_system->data_container->nUnder_processing_events = 0;
 	telecom_system->receive_stats.delay_of_last_decoded_message = -1;
 	telecom_system->receive_stats.mfsk_search_raw = 0;
 
@@ -2550,9 +2711,9 @@ bool cl_arq_controller::receive_ack_pattern()
 {
 	// Tail = ACK pattern (16 sym) + guard (8 sym) = 24 symbols
 	const int tail_nsymb = cl_mfsk::ACK_PATTERN_NSYMB + 8;
-	int sym_samples = telecom_system->data_container.Nofdm
-	                * telecom_system->data_container.interpolation_rate;
-	int signal_period = sym_samples * telecom_system->data_container.buffer_Nsymb;
+	int sym_samples = telecom_system->data_container->Nofdm
+	                * telecom_system->data_container->interpolation_rate;
+	int signal_period = sym_samples * telecom_system->data_container->buffer_Nsymb;
 	int tail_samples = tail_nsymb * sym_samples;
 	if(tail_samples > signal_period)
 		tail_samples = signal_period;
@@ -2560,19 +2721,20 @@ bool cl_arq_controller::receive_ack_pattern()
 
 	MUTEX_LOCK(&capture_prep_mutex);
 
-	if(telecom_system->data_container.frames_to_read == 0)
+	if(telecom_system->data_container->frames_to_read == 0)
 	{
 		// Snapshot only the tail (newest audio) — smaller copy, shorter mutex hold
-		memcpy(telecom_system->data_container.ready_to_process_passband_delayed_data,
-			&telecom_system->data_container.passband_delayed_data[tail_offset],
+		memcpy(telecom_system->data_container->ready_to_process_passband_delayed_data,
+			&telecom_system->data_container->passband_window()[tail_offset],
 			tail_samples * sizeof(double));
+		telecom_system->data_container->ready_to_process_symbol_count = -1;
 
-		telecom_system->data_container.data_ready = 0;
+		telecom_system->data_container->data_ready = 0;
 		MUTEX_UNLOCK(&capture_prep_mutex);
 
 		int matched_count = 0;
 		double metric = telecom_system->detect_ack_pattern_from_passband(
-			telecom_system->data_container.ready_to_process_passband_delayed_data,
+			telecom_system->data_container->ready_to_process_passband_delayed_data,
 			tail_samples, &matched_count);
 
 		printf("[ACK-RX] metric=%.3f threshold=%.3f matched=%d/16\n",
@@ -2585,32 +2747,32 @@ bool cl_arq_controller::receive_ack_pattern()
 			// Detected — start capturing a full frame immediately so audio
 			// accumulates during guard delay and next preamble isn't missed.
 			MUTEX_LOCK(&capture_prep_mutex);
-			telecom_system->data_container.frames_to_read =
-				telecom_system->data_container.preamble_nSymb + telecom_system->data_container.Nsymb;
-			telecom_system->data_container.nUnder_processing_events = 0;
+			telecom_system->data_container->frames_to_read =
+				telecom_system->data_container->preamble_nSymb + telecom_system->data_container->Nsymb;
+			telecom_system->data_container->nUnder_processing_events = 0;
 			telecom_system->receive_stats.mfsk_search_raw = 0;
 			MUTEX_UNLOCK(&capture_prep_mutex);
 			return true;
 		}
 
 		// Not detected — poll again in 4 symbols (~91ms)
-		telecom_system->data_container.frames_to_read = 4;
-		telecom_system->data_container.nUnder_processing_events = 0;
+		telecom_system->data_container->frames_to_read = 4;
+		telecom_system->data_container->nUnder_processing_events = 0;
 		return false;
 	}
 
-	telecom_system->data_container.data_ready = 0;
+	telecom_system->data_container->data_ready = 0;
 	MUTEX_UNLOCK(&capture_prep_mutex);
 	return false;
 }
 
 void cl_arq_controller::receive()
 {
-	int signal_period = telecom_system->data_container.Nofdm * telecom_system->data_container.buffer_Nsymb * telecom_system->data_container.interpolation_rate; // in samples
-	int symbol_period = telecom_system->data_container.Nofdm * telecom_system->data_container.interpolation_rate;
+	int signal_period = telecom_system->data_container->Nofdm * telecom_system->data_container->buffer_Nsymb * telecom_system->data_container->interpolation_rate; // in samples
+	int symbol_period = telecom_system->data_container->Nofdm * telecom_system->data_container->interpolation_rate;
 
 #if 0 // TODO:  do we need this?
-	if(telecom_system->data_container.data_ready == 0)
+	if(telecom_system->data_container->data_ready == 0)
 	{
 		msleep(1);
 		return;
@@ -2620,14 +2782,14 @@ void cl_arq_controller::receive()
 	st_receive_stats received_message_stats;
 
 
-	if(telecom_system->data_container.frames_to_read==0)
+	if(telecom_system->data_container->frames_to_read==0)
 	{
 
 
-		memcpy(telecom_system->data_container.ready_to_process_passband_delayed_data, telecom_system->data_container.passband_delayed_data, signal_period * sizeof(double));
+		telecom_system->data_container->snapshot_passband_window();
 
 		// Clear data_ready while we have the lock, before unlocking
-		telecom_system->data_container.data_ready = 0;
+		telecom_system->data_container->data_ready = 0;
 
 		MUTEX_UNLOCK(&capture_prep_mutex);
 
@@ -2635,19 +2797,19 @@ void cl_arq_controller::receive()
 		// Shows energy distribution to detect self-hearing (H5c) or silence-preceded frames
 		if(telecom_system->M != MOD_MFSK)
 		{
-			int sym_samples = telecom_system->data_container.Nofdm * telecom_system->data_container.interpolation_rate;
-			int buf_nsymb = telecom_system->data_container.buffer_Nsymb;
+			int sym_samples = telecom_system->data_container->Nofdm * telecom_system->data_container->interpolation_rate;
+			int buf_nsymb = telecom_system->data_container->buffer_Nsymb;
 			int chunk_symb = (buf_nsymb + 9) / 10;  // ~11 symbols per chunk
 			int chunk_samples = chunk_symb * sym_samples;
 			if (g_verbose) {
-				printf("[BUF-ENERGY] nUnder=%d |", telecom_system->data_container.nUnder_processing_events.load());
+				printf("[BUF-ENERGY] nUnder=%d |", telecom_system->data_container->nUnder_processing_events.load());
 				for(int c = 0; c < signal_period; c += chunk_samples)
 				{
 					double peak = 0.0;
 					int end = (c + chunk_samples < signal_period) ? c + chunk_samples : signal_period;
 					for(int s = c; s < end; s++)
 					{
-						double v = fabs(telecom_system->data_container.ready_to_process_passband_delayed_data[s]);
+						double v = fabs(telecom_system->data_container->ready_to_process_passband_delayed_data[s]);
 						if(v > peak) peak = v;
 					}
 					printf(" %.3f", peak);
@@ -2661,18 +2823,19 @@ void cl_arq_controller::receive()
 		// Apply live LDPC iteration limit from GUI
 		int gui_ldpc_max = g_gui_state.ldpc_iterations_max.load();
 		if (gui_ldpc_max >= 5 && gui_ldpc_max <= 50)
-			telecom_system->ldpc.nIteration_max = gui_ldpc_max;
+			telecom_system->ldpc->nIteration_max = gui_ldpc_max;
 #endif
 
 		auto proc_start = std::chrono::steady_clock::now();
-		received_message_stats = telecom_system->receive_byte(telecom_system->data_container.ready_to_process_passband_delayed_data,telecom_system->data_container.data_byte);
+		telecom_system->harq_rx_key=get_harq_rx_key();
+		received_message_stats = telecom_system->receive_byte(telecom_system->data_container->ready_to_process_passband_delayed_data,telecom_system->data_container->data_byte);
 		auto proc_end = std::chrono::steady_clock::now();
 		double proc_ms = std::chrono::duration<double, std::milli>(proc_end - proc_start).count();
 
 		// Frame period = (preamble + data symbols) in wall clock time
-		double frame_samples = (double)(telecom_system->data_container.Nofdm *
-			(telecom_system->data_container.Nsymb + telecom_system->data_container.preamble_nSymb) *
-			telecom_system->data_container.interpolation_rate);
+		double frame_samples = (double)(telecom_system->data_container->Nofdm *
+			(telecom_system->data_container->Nsymb + telecom_system->data_container->preamble_nSymb) *
+			telecom_system->data_container->interpolation_rate);
 		double frame_ms = (frame_samples / 48000.0) * 1000.0;
 		float load = (frame_ms > 0) ? (float)(proc_ms / frame_ms) : 0.0f;
 
@@ -2689,20 +2852,24 @@ void cl_arq_controller::receive()
 
 		if (received_message_stats.message_decoded==YES)
 		{
-			int rx_nsymb = telecom_system->get_active_nsymb();
-			int rx_frame = rx_nsymb + telecom_system->data_container.preamble_nSymb;
+			if (g_verbose && received_message_stats.harq_combined==YES)
+				printf("[HARQ] message recovered from a combined retransmission (ir_part=%d)\n", received_message_stats.ir_part);
+
+			// Incremental redundancy parts are shorter than a full frame.
+			int rx_nsymb = (received_message_stats.frame_nsymb > 0) ? received_message_stats.frame_nsymb : telecom_system->get_active_nsymb();
+			int rx_frame = rx_nsymb + telecom_system->data_container->preamble_nSymb;
 			int end_of_current_message = received_message_stats.delay / symbol_period  + rx_frame;
-			int frames_left_in_buffer = telecom_system->data_container.buffer_Nsymb - end_of_current_message;
+			int frames_left_in_buffer = telecom_system->data_container->buffer_Nsymb - end_of_current_message;
 			if(frames_left_in_buffer<0)
 				frames_left_in_buffer=0;
 
-			int nUnder_snapshot = telecom_system->data_container.nUnder_processing_events.load();
-			telecom_system->data_container.frames_to_read=rx_frame-frames_left_in_buffer-nUnder_snapshot;
+			int nUnder_snapshot = telecom_system->data_container->nUnder_processing_events.load();
+			telecom_system->data_container->frames_to_read=rx_frame-frames_left_in_buffer-nUnder_snapshot;
 
 			int ftr_clamped = 0;
-			if(telecom_system->data_container.frames_to_read > rx_frame || telecom_system->data_container.frames_to_read<0)
+			if(telecom_system->data_container->frames_to_read > rx_frame || telecom_system->data_container->frames_to_read<0)
 			{
-				telecom_system->data_container.frames_to_read = rx_frame-frames_left_in_buffer;
+				telecom_system->data_container->frames_to_read = rx_frame-frames_left_in_buffer;
 				ftr_clamped = 1;
 			}
 
@@ -2710,7 +2877,7 @@ void cl_arq_controller::receive()
 				printf("[RX-TIMING] OK: delay=%d delay_symb=%d rx_frame=%d end=%d left=%d nUnder=%d ftr=%d clamped=%d proc=%.0fms\n",
 					received_message_stats.delay, received_message_stats.delay / symbol_period,
 					rx_frame, end_of_current_message, frames_left_in_buffer, nUnder_snapshot,
-					telecom_system->data_container.frames_to_read.load(), ftr_clamped, proc_ms);
+					telecom_system->data_container->frames_to_read.load(), ftr_clamped, proc_ms);
 			fflush(stdout);
 
 			// MFSK anti-re-decode: after successful decode, record where the old
@@ -2722,12 +2889,12 @@ void cl_arq_controller::receive()
 			if(telecom_system->M == MOD_MFSK)
 			{
 				int frame_end_symb = received_message_stats.delay / symbol_period + rx_frame;
-				telecom_system->receive_stats.mfsk_search_raw = frame_end_symb - telecom_system->data_container.frames_to_read;
+				telecom_system->receive_stats.mfsk_search_raw = frame_end_symb - telecom_system->data_container->frames_to_read;
 			}
 
-			telecom_system->receive_stats.delay_of_last_decoded_message += (rx_frame - (telecom_system->data_container.frames_to_read + telecom_system->data_container.nUnder_processing_events)) * symbol_period;
+			telecom_system->receive_stats.delay_of_last_decoded_message += (rx_frame - (telecom_system->data_container->frames_to_read + telecom_system->data_container->nUnder_processing_events)) * symbol_period;
 
-			telecom_system->data_container.nUnder_processing_events = 0;
+			telecom_system->data_container->nUnder_processing_events = 0;
 
 			measurements.frequency_offset = received_message_stats.freq_offset;
 			if(this->role == COMMANDER)
@@ -2744,7 +2911,7 @@ void cl_arq_controller::receive()
 				if(byte_copy_len > N_MAX/8) byte_copy_len = N_MAX/8;
 				for(int i=0; i < byte_copy_len; i++)
 				{
-					message_TxRx_byte_buffer[i] = (char)telecom_system->data_container.data_byte[i];
+					message_TxRx_byte_buffer[i] = (char)telecom_system->data_container->data_byte[i];
 				}
 				hex_trace("S6-RX-RAW", message_TxRx_byte_buffer, byte_copy_len);
 			}
@@ -2805,6 +2972,13 @@ void cl_arq_controller::receive()
 					hex_trace("S7-RX-DATA_SHORT", messages_rx_buffer.data, messages_rx_buffer.length);
 				}
 
+				if(messages_rx_buffer.type==DATA_LONG || messages_rx_buffer.type==DATA_SHORT)
+				{
+					// Soft frames of this message are not needed any more.
+					telecom_system->harq_release((unsigned char)messages_rx_buffer.id);
+					harq_next_id=(unsigned char)messages_rx_buffer.id+1;
+				}
+
 				last_message_received_type=messages_rx_buffer.type;
 				if(messages_rx_buffer.type==CONTROL || messages_rx_buffer.type==ACK_CONTROL)
 				{
@@ -2814,13 +2988,19 @@ void cl_arq_controller::receive()
 		}
 		else
 		{
+			// A failed frame kept for chase combining took the place of the message it was keyed to.
+			if(received_message_stats.harq_stored==YES)
+			{
+				harq_next_id=received_message_stats.frame_key+1;
+			}
+
 			// MFSK frame completeness: if the frame extends beyond captured audio,
 			// capture the remaining symbols instead of wasting a full recapture cycle.
 			if(received_message_stats.frame_overflow_symbols > 0)
 			{
 				int shift_symbols = received_message_stats.frame_overflow_symbols + 4;
-				telecom_system->data_container.frames_to_read = shift_symbols;
-				telecom_system->data_container.nUnder_processing_events = 0;
+				telecom_system->data_container->frames_to_read = shift_symbols;
+				telecom_system->data_container->nUnder_processing_events = 0;
 				telecom_system->receive_stats.mfsk_search_raw = 0;
 
 				// Save the preamble position adjusted for the upcoming buffer shift.
@@ -2835,7 +3015,7 @@ void cl_arq_controller::receive()
 				if (g_verbose)
 					printf("[RX-TIMING] INCOMPLETE: overflow=%d symbols, capturing %d more, saved_delay=%d\n",
 						received_message_stats.frame_overflow_symbols,
-						telecom_system->data_container.frames_to_read.load(),
+						telecom_system->data_container->frames_to_read.load(),
 						telecom_system->mfsk_fixed_delay);
 				fflush(stdout);
 				return;
@@ -2843,7 +3023,7 @@ void cl_arq_controller::receive()
 
 			if (g_verbose)
 				printf("[RX-TIMING] FAIL: nUnder=%d proc=%.0fms search_raw=%d delay_last=%d mod=%d\n",
-					telecom_system->data_container.nUnder_processing_events.load(), proc_ms,
+					telecom_system->data_container->nUnder_processing_events.load(), proc_ms,
 					telecom_system->receive_stats.mfsk_search_raw,
 					telecom_system->receive_stats.delay_of_last_decoded_message,
 					telecom_system->M);
@@ -2856,7 +3036,7 @@ void cl_arq_controller::receive()
 			{
 				int matched = 0;
 				double metric = telecom_system->detect_break_pattern_from_passband(
-					telecom_system->data_container.ready_to_process_passband_delayed_data,
+					telecom_system->data_container->ready_to_process_passband_delayed_data,
 					signal_period, &matched);
 				if(metric >= telecom_system->ack_pattern_detection_threshold
 				   && matched >= cl_mfsk::ACK_PATTERN_NSYMB / 2)
@@ -2872,15 +3052,15 @@ void cl_arq_controller::receive()
 			// buffer accumulate fresh audio instead of burning CPU on doomed LDPC
 			// decodes of the same shifting frame. MFSK has anti-re-decode so it
 			// doesn't spin on the same frame.
-			if(telecom_system->M != MOD_MFSK && telecom_system->data_container.frames_to_read == 0)
+			if(telecom_system->M != MOD_MFSK && telecom_system->data_container->frames_to_read == 0)
 			{
-				telecom_system->data_container.frames_to_read = 8;
-				telecom_system->data_container.nUnder_processing_events = 0;
+				telecom_system->data_container->frames_to_read = 8;
+				telecom_system->data_container->nUnder_processing_events = 0;
 			}
 
-			if(telecom_system->data_container.frames_to_read==0 && telecom_system->receive_stats.delay_of_last_decoded_message!=-1)
+			if(telecom_system->data_container->frames_to_read==0 && telecom_system->receive_stats.delay_of_last_decoded_message!=-1)
 			{
-				telecom_system->receive_stats.delay_of_last_decoded_message -= telecom_system->data_container.Nofdm*telecom_system->data_container.interpolation_rate;
+				telecom_system->receive_stats.delay_of_last_decoded_message -= telecom_system->data_container->Nofdm*telecom_system->data_container->interpolation_rate;
 				if(telecom_system->receive_stats.delay_of_last_decoded_message < 0)
 				{
 					telecom_system->receive_stats.delay_of_last_decoded_message = -1;
@@ -2892,7 +3072,7 @@ void cl_arq_controller::receive()
 	}
 
 	// frames_to_read != 0: just clear data_ready and unlock
-	telecom_system->data_container.data_ready = 0;
+	telecom_system->data_container->data_ready = 0;
 	MUTEX_UNLOCK(&capture_prep_mutex);
 }
 
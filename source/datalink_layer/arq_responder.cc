@@ -206,6 +206,8 @@ void cl_arq_controller::process_messages_rx_data_control()
 		{
 			connection_status=ACKNOWLEDGING_DATA;
 		}
+		// The resends of the next batch start over from the first missing message.
+		harq_next_id=0;
 
 		receiving_timer.stop();
 		receiving_timer.reset();
@@ -267,20 +269,20 @@ void cl_arq_controller::process_messages_acknowledging_control()
 			// Subtract the elapsed symbols so the total countdown (load_time +
 			// ftr) matches the intended turnaround, keeping the preamble near
 			// the right edge of the buffer instead of buried in silence.
-			int nUnder_during_load = telecom_system->data_container.nUnder_processing_events.load();
-			telecom_system->data_container.nUnder_processing_events = 0;
+			int nUnder_during_load = telecom_system->data_container->nUnder_processing_events.load();
+			telecom_system->data_container->nUnder_processing_events = 0;
 
-			double sym_time_ms = telecom_system->data_container.Nofdm
-				* telecom_system->data_container.interpolation_rate / 48.0;
+			double sym_time_ms = telecom_system->data_container->Nofdm
+				* telecom_system->data_container->interpolation_rate / 48.0;
 			int turnaround_symb = (int)ceil(1200.0 / sym_time_ms) + 4;
 			turnaround_symb -= nUnder_during_load;
 			if(turnaround_symb < 0) turnaround_symb = 0;
-			int ftr = telecom_system->data_container.preamble_nSymb
-				+ telecom_system->data_container.Nsymb
+			int ftr = telecom_system->data_container->preamble_nSymb
+				+ telecom_system->data_container->Nsymb
 				+ turnaround_symb;
-			int buf_nsymb = telecom_system->data_container.buffer_Nsymb.load();
+			int buf_nsymb = telecom_system->data_container->buffer_Nsymb.load();
 			if(ftr > buf_nsymb) ftr = buf_nsymb;
-			telecom_system->data_container.frames_to_read = ftr;
+			telecom_system->data_container->frames_to_read = ftr;
 
 			printf("[ACK-CTRL] ftr=%d (turnaround=%d - load_shift=%d)\n",
 				ftr, (int)ceil(1200.0 / sym_time_ms) + 4, nUnder_during_load);
@@ -413,9 +415,9 @@ void cl_arq_controller::process_messages_acknowledging_control()
 			this->connection_status=RECEIVING;
 			reset_all_timers();
 			// Reset RX state machine - wait for fresh data (prevents decode of self-received TX audio)
-			telecom_system->data_container.frames_to_read =
-				telecom_system->data_container.preamble_nSymb + telecom_system->data_container.Nsymb;
-			telecom_system->data_container.nUnder_processing_events = 0;
+			telecom_system->data_container->frames_to_read =
+				telecom_system->data_container->preamble_nSymb + telecom_system->data_container->Nsymb;
+			telecom_system->data_container->nUnder_processing_events = 0;
 
 			fifo_buffer_tx.flush();
 			fifo_buffer_backup.flush();
@@ -443,10 +445,15 @@ void cl_arq_controller::process_messages_acknowledging_data()
 				if(messages_rx[i].status==RECEIVED)
 				{
 					messages_rx[i].status=ACKED;
+					telecom_system->harq_release(i);
 					nAck_messages++;
 				}
 			}
 			stats.nAcks_sent_data += nAck_messages;
+			harq_next_id=0;
+
+			// Soft frames still unmatched after nResends ACK rounds will not be resent any more.
+			telecom_system->harq_age_buffers(nResends);
 		}
 		repeating_last_ack=NO;
 		messages_control.status=FREE;
@@ -460,20 +467,20 @@ void cl_arq_controller::process_messages_acknowledging_data()
 		// position exceeding upper_bound when arrival is late.
 		telecom_system->set_mfsk_ctrl_mode(false);
 		{
-			int nUnder_during_load = telecom_system->data_container.nUnder_processing_events.load();
-			telecom_system->data_container.nUnder_processing_events = 0;
+			int nUnder_during_load = telecom_system->data_container->nUnder_processing_events.load();
+			telecom_system->data_container->nUnder_processing_events = 0;
 
-			double sym_time_ms = telecom_system->data_container.Nofdm
-				* telecom_system->data_container.interpolation_rate / 48.0;
+			double sym_time_ms = telecom_system->data_container->Nofdm
+				* telecom_system->data_container->interpolation_rate / 48.0;
 			int turnaround_symb = (int)ceil(1200.0 / sym_time_ms) + 4;
 			turnaround_symb -= nUnder_during_load;
 			if(turnaround_symb < 0) turnaround_symb = 0;
-			int ftr = telecom_system->data_container.preamble_nSymb
-				+ telecom_system->data_container.Nsymb
+			int ftr = telecom_system->data_container->preamble_nSymb
+				+ telecom_system->data_container->Nsymb
 				+ turnaround_symb;
-			int buf_nsymb = telecom_system->data_container.buffer_Nsymb.load();
+			int buf_nsymb = telecom_system->data_container->buffer_Nsymb.load();
 			if(ftr > buf_nsymb) ftr = buf_nsymb;
-			telecom_system->data_container.frames_to_read = ftr;
+			telecom_system->data_container->frames_to_read = ftr;
 
 			printf("[ACK-DATA] ftr=%d (turnaround=%d - load_shift=%d)\n",
 				ftr, (int)ceil(1200.0 / sym_time_ms) + 4, nUnder_during_load);
@@ -535,10 +542,12 @@ void cl_arq_controller::process_messages_acknowledging_data()
 				if(messages_rx[i].status==RECEIVED)
 				{
 					messages_rx[i].status=ACKED;
+					telecom_system->harq_release(i);
 					messages_batch_ack[message_batch_counter_tx].data[counter]=i;
 					counter++;
 				}
 			}
+			harq_next_id=0;
 
 			messages_last_ack_bu.type=messages_batch_ack[message_batch_counter_tx].type;
 			messages_last_ack_bu.id=messages_batch_ack[message_batch_counter_tx].id;
@@ -562,8 +571,8 @@ void cl_arq_controller::process_messages_acknowledging_data()
 		// Expect data frames next: use full Nsymb for capture.
 		// Frame completeness gating handles late arrivals adaptively.
 		telecom_system->set_mfsk_ctrl_mode(false);
-		telecom_system->data_container.frames_to_read =
-			telecom_system->data_container.preamble_nSymb + telecom_system->data_container.Nsymb;
+		telecom_system->data_container->frames_to_read =
+			telecom_system->data_container->preamble_nSymb + telecom_system->data_container->Nsymb;
 
 		connection_status=RECEIVING;
 	}
@@ -40,6 +40,10 @@ WaterfallDisplay::WaterfallDisplay()
 {
     memset(sample_buffer_, 0, sizeof(sample_buffer_));
     memset(fft_magnitudes_, 0, sizeof(fft_magnitudes_));
+    fft_plan_ = cl_fft_plan::get_real(WATERFALL_FFT_SIZE);
+    for (int i = 0; i < WATERFALL_FFT_SIZE; i++) {
+        window_[i] = 0.5 * (1.0 - cos(2.0 * 3.14159265358979 * i / (WATERFALL_FFT_SIZE - 1)));
+    }
     for (int i = 0; i < WATERFALL_HISTORY_LINES; i++) {
         for (int j = 0; j < WATERFALL_DISPLAY_BINS; j++) {
             history_[i][j] = min_db_;
@@ -104,16 +108,15 @@ void WaterfallDisplay::pushSamples(const double* samples, int count) {
 }
 
 void WaterfallDisplay::processFFT() {
-    // Copy samples to complex array
-    std::complex<double> fft_data[WATERFALL_FFT_SIZE];
+    // Apply Hanning window
+    sample_real windowed[WATERFALL_FFT_SIZE];
     for (int i = 0; i < WATERFALL_FFT_SIZE; i++) {
-        // Apply Hanning window
-        double window = 0.5 * (1.0 - cos(2.0 * 3.14159265358979 * i / (WATERFALL_FFT_SIZE - 1)));
-        fft_data[i] = std::complex<double>(sample_buffer_[i] * window, 0.0);
+        windowed[i] = sample_buffer_[i] * window_[i];
     }
 
-    // Perform FFT
-    fft(fft_data, WATERFALL_FFT_SIZE);
+    // Real-input FFT, non-negative frequency bins only
+    sample_complex fft_data[WATERFALL_FFT_SIZE / 2 + 1];
+    fft_plan_->execute(windowed, fft_data);
 
     // Calculate magnitudes in dB (only positive frequencies)
     for (int i = 0; i < WATERFALL_FFT_SIZE / 2; i++) {
@@ -129,44 +132,6 @@ void WaterfallDisplay::processFFT() {
     history_index_ = (history_index_ + 1) % WATERFALL_HISTORY_LINES;
 }
 
-// Cooley-Tukey FFT (in-place, radix-2, DIT, iterative)
-void WaterfallDisplay::fft(std::complex<double>* v, int n) {
-    if (n <= 1) return;
-
-    // Bit-reversal permutation
-    int j = 0;
-    for (int i = 0; i < n; ++i) {
-        if (i < j) {
-            std::complex<double> tmp = v[i];
-            v[i] = v[j];
-            v[j] = tmp;
-        }
-        int m = n >> 1;
-        while (m >= 1 && j >= m) {
-            j -= m;
-            m >>= 1;
-        }
-        j += m;
-    }
-
-    // Iterative butterfly passes
-    for (int len = 2; len <= n; len <<= 1) {
-        double angle = -2.0 * 3.14159265358979 / (double)len;
-        std::complex<double> wlen(cos(angle), sin(angle));
-        for (int i = 0; i < n; i += len) {
-            std::complex<double> w(1.0, 0.0);
-            int half = len >> 1;
-            for (int k = 0; k < half; ++k) {
-                std::complex<double> u = v[i + k];
-                std::complex<double> t = w * v[i + k + half];
-                v[i + k] = u + t;
-                v[i + k + half] = u - t;
-                w *= wlen;
-            }
-        }
-    }
-}
-
 // Jet colormap: blue -> cyan -> green -> yellow -> red
 static void jetColormap(float value, unsigned char* rgb) {
     // value should be 0.0 to 1.0
@@ -120,6 +120,9 @@ int main(int argc, char *argv[])
     int exit_on_disconnect = 0;
     int ldpc_iterations = 0;  // 0 = use default (50 or from INI)
     int puncture_nBits = 0;  // 0 = disabled; >0 = punctured LDPC BER test
+    int estimator_benchmark = NO;  // YES = PLOT_PASSBAND compares the LS and MMSE channel estimators
+    int harq_check = NO;  // YES = PLOT_PASSBAND checks chase combining against the receiver without it
+    int exit_status = EXIT_SUCCESS;
     double tx_gain_override = -999.0;  // -999 = not set; otherwise override TX gain in dB
     double rx_gain_override = -999.0;  // -999 = not set; otherwise override RX gain in dB
 
@@ -173,6 +176,8 @@ int main(int argc, char *argv[])
         printf(" -z                         Lists all available sound cards.\n");
         printf(" -f [offset_hz]             TX carrier offset in Hz for testing frequency sync (e.g., -f 25 for 25 Hz offset).\n");
         printf(" -I [iterations]            LDPC decoder max iterations (5-50, default 50). Lower = less CPU.\n");
+        printf(" -E                         PLOT_PASSBAND: compare the LS and MMSE channel estimators (BER and CPU time per frame).\n");
+        printf(" -H                         PLOT_PASSBAND: check HARQ chase combining against the receiver without it, fails on a mismatch.\n");
         printf(" -R                         Enable Robust mode (MFSK for weak-signal hailing/low-speed data).\n");
         printf(" -T [tx_gain_db]            TX gain in dB (temporary, overrides GUI slider). E.g. -T -25.6 for -30 dBFS output.\n");
         printf(" -G [rx_gain_db]            RX gain in dB (temporary, overrides GUI slider). E.g. -G 25.6 to boost weak input.\n");
@@ -185,7 +190,7 @@ int main(int argc, char *argv[])
     }
 
     int opt;
-    while ((opt = getopt(argc, argv, "hc:m:s:lr:i:o:x:p:zgt:a:k:eCnf:I:RP:vT:G:")) != -1)
+    while ((opt = getopt(argc, argv, "hc:m:s:lr:i:o:x:p:zgt:a:k:eCnf:I:RP:EHvT:G:")) != -1)
     {
         switch (opt)
         {
@@ -316,6 +321,14 @@ int main(int argc, char *argv[])
                 printf("Punctured LDPC BER test: ctrl_nBits=%d\n", puncture_nBits);
             }
             break;
+        case 'E':
+            estimator_benchmark = YES;
+            printf("Channel estimator benchmark (LS vs MMSE) enabled.\n");
+            break;
+        case 'H':
+            harq_check = YES;
+            printf("HARQ check enabled.\n");
+            break;
         case 'R':
             robust_mode = 1;
             printf("Robust mode (MFSK) enabled.\n");
@@ -773,14 +786,18 @@ start_modem:
         printf("Mode selected: PLOT_PASSBAND\n");
         telecom_system.load_configuration(mod_config);
         telecom_system.test_puncture_nBits = puncture_nBits;
+        telecom_system.test_estimator_benchmark = estimator_benchmark;
         if(puncture_nBits > 0)
-            printf("Punctured LDPC: transmitting %d of %d bits\n", puncture_nBits, telecom_system.data_container.nBits);
+            printf("Punctured LDPC: transmitting %d of %d bits\n", puncture_nBits, telecom_system.data_container->nBits);
         printf("Modulation: %d  Bitrate: %.2f bps  Shannon_limit: %.2f db\n",  mod_config, telecom_system.rbc, telecom_system.Shannon_limit);
 
         telecom_system.constellation_plot.open("PLOT");
         telecom_system.constellation_plot.reset("PLOT");
 
-        telecom_system.BER_PLOT_passband_process_main();
+        if (harq_check == YES)
+            exit_status = (telecom_system.harq_check() == YES) ? EXIT_SUCCESS : EXIT_FAILURE;
+        else
+            telecom_system.BER_PLOT_passband_process_main();
 
         telecom_system.constellation_plot.close();
     }
@@ -869,5 +886,5 @@ start_modem:
     audioio_deinit(&radio_capture, &radio_playback, &radio_capture_prep);
 
 
-    return EXIT_SUCCESS;
+    return exit_status;
 }
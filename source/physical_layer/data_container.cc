@@ -21,9 +21,7 @@
  */
 
 #include "physical_layer/data_container.h"
-
-// Debug: shadow copy of data_bit pointer for corruption detection at deinit
-static int* g_data_bit_shadow = NULL;
+#include <cstring>
 
 cl_data_container::cl_data_container()
 {
@@ -36,12 +34,12 @@ cl_data_container::cl_data_container()
 	this->Ngi=0;
 	this->Nsymb=0;
 	this->data_bit=NULL;
+	this->data_bit_shadow=NULL;
 	this->data_bit_energy_dispersal=NULL;
 	this->data_byte=NULL;
 	this->encoded_data=NULL;
 	this->bit_interleaved_data=NULL;
 	this->ofdm_time_freq_interleaved_data=NULL;
-	this->ofdm_time_freq_deinterleaved_data=NULL;
 	this->modulated_data=NULL;
 	this->ofdm_framed_data=NULL;
 	this->ofdm_symbol_modulated_data=NULL;
@@ -63,6 +61,11 @@ cl_data_container::cl_data_container()
 	this->passband_data=NULL;
 	this->passband_delayed_data=NULL;
 	this->ready_to_process_passband_delayed_data=NULL;
+	this->ready_to_process_passband_ring=NULL;
+	this->passband_delayed_head=0;
+	this->ready_to_process_head=0;
+	this->rx_symbol_count=0;
+	this->ready_to_process_symbol_count=-1;
 	this->baseband_data=NULL;
 	this->baseband_data_interpolated=NULL;
 
@@ -80,6 +83,12 @@ cl_data_container::cl_data_container()
 	this->ready_to_transmit_passband_data_tx=NULL;
 
 	this->bit_energy_dispersal_sequence=NULL;
+
+	this->data_bit_packed=NULL;
+	this->data_bit_energy_dispersal_packed=NULL;
+	this->encoded_data_packed=NULL;
+	this->bit_interleaved_data_packed=NULL;
+	this->bit_energy_dispersal_sequence_packed=NULL;
 }
 
 cl_data_container::~cl_data_container()
@@ -99,7 +108,7 @@ void cl_data_container::set_size(int nData, int Nc, int M, int Nfft , int Nofdm,
 	this->Nsymb=Nsymb;
 	this->preamble_nSymb=preamble_nSymb;
 	this->data_bit=new int[N_MAX];
-	g_data_bit_shadow = this->data_bit;
+	this->data_bit_shadow = this->data_bit;
 	printf("[SET_SIZE] this=%p &data_bit=%p data_bit=%p Nc=%d M=%d Nsymb=%d\n",
 		(void*)this, (void*)&this->data_bit, (void*)this->data_bit, Nc, M, Nsymb);
 	fflush(stdout);
@@ -107,22 +116,21 @@ void cl_data_container::set_size(int nData, int Nc, int M, int Nfft , int Nofdm,
 	this->data_byte=new int[N_MAX];
 	this->encoded_data=new int[N_MAX];
 	this->bit_interleaved_data=new int[N_MAX];
-	this->modulated_data=new std::complex <double>[nData];
+	this->modulated_data=new sample_complex[nData];
 	// ACK pattern generation reuses ofdm_framed_data and ofdm_symbol_modulated_data
 	// with ACK_PATTERN_NSYMB=16 symbols. For high-order modulations (16QAM+),
 	// Nsymb < 16, so we must allocate for whichever is larger.
 	int alloc_Nsymb = (Nsymb > 16) ? Nsymb : 16;
-	this->ofdm_framed_data=new std::complex <double>[alloc_Nsymb*Nc];
-	this->ofdm_time_freq_interleaved_data=new std::complex <double>[Nsymb*Nc];
-	this->ofdm_time_freq_deinterleaved_data=new std::complex <double>[Nsymb*Nc];
-	this->ofdm_symbol_modulated_data=new std::complex <double>[Nofdm*alloc_Nsymb];
-	this->ofdm_symbol_demodulated_data=new std::complex <double>[Nsymb*Nc];
-	this->ofdm_deframed_data=new std::complex <double>[Nsymb*Nc];
-	this->ofdm_deframed_data_without_amplitude_restoration=new std::complex <double>[Nsymb*Nc];
-	this->equalized_data= new std::complex <double>[Nsymb*Nc];
-	this->equalized_data_without_amplitude_restoration= new std::complex <double>[Nsymb*Nc];
-	this->preamble_symbol_modulated_data= new std::complex <double>[preamble_nSymb*Nofdm];
-	this->preamble_data= new std::complex <double>[preamble_nSymb*Nc];
+	this->ofdm_framed_data=new sample_complex[alloc_Nsymb*Nc];
+	this->ofdm_time_freq_interleaved_data=new sample_complex[Nsymb*Nc];
+	this->ofdm_symbol_modulated_data=new sample_complex[Nofdm*alloc_Nsymb];
+	this->ofdm_symbol_demodulated_data=new sample_complex[Nsymb*Nc];
+	this->ofdm_deframed_data=new sample_complex[Nsymb*Nc];
+	this->ofdm_deframed_data_without_amplitude_restoration=new sample_complex[Nsymb*Nc];
+	this->equalized_data= new sample_complex[Nsymb*Nc];
+	this->equalized_data_without_amplitude_restoration= new sample_complex[Nsymb*Nc];
+	this->preamble_symbol_modulated_data= new sample_complex[preamble_nSymb*Nofdm];
+	this->preamble_data= new sample_complex[preamble_nSymb*Nc];
 	this->demodulated_data=new float[N_MAX];
 	this->deinterleaved_data=new float[N_MAX];
 	this->hd_decoded_data_bit=new int[N_MAX];
@@ -130,6 +138,20 @@ void cl_data_container::set_size(int nData, int Nc, int M, int Nfft , int Nofdm,
 
 	this->bit_energy_dispersal_sequence=new int[N_MAX];
 
+	this->data_bit_packed=new uint64_t[N_MAX_WORDS];
+	this->data_bit_energy_dispersal_packed=new uint64_t[N_MAX_WORDS];
+	this->encoded_data_packed=new uint64_t[N_MAX_WORDS];
+	this->bit_interleaved_data_packed=new uint64_t[N_MAX_WORDS];
+	this->bit_energy_dispersal_sequence_packed=new uint64_t[N_MAX_WORDS];
+	for(int i=0;i<N_MAX_WORDS;i++)
+	{
+		this->data_bit_packed[i]=0;
+		this->data_bit_energy_dispersal_packed[i]=0;
+		this->encoded_data_packed[i]=0;
+		this->bit_interleaved_data_packed[i]=0;
+		this->bit_energy_dispersal_sequence_packed[i]=0;
+	}
+
 	// Buffer must accommodate frame + turnaround gap after ACK flush.
 	// Turnaround: ~1200ms (VB-Cable + ACK poll + commander guard + ptt_on + VB-Cable).
 	// Also need at least frame*2 for preamble search margin during batch reception.
@@ -148,9 +170,10 @@ void cl_data_container::set_size(int nData, int Nc, int M, int Nfft , int Nofdm,
 	int passband_ack = 16 * Nofdm * frequency_interpolation_rate;
 	this->passband_data=new double[(passband_frame > passband_ack) ? passband_frame : passband_ack];
 	this->passband_delayed_data=new double[2*Nofdm*buffer_Nsymb*frequency_interpolation_rate];
-	this->ready_to_process_passband_delayed_data=new double[Nofdm*buffer_Nsymb*frequency_interpolation_rate];
-	this->baseband_data=new std::complex <double>[Nofdm*buffer_Nsymb];
-	this->baseband_data_interpolated=new std::complex <double>[Nofdm*buffer_Nsymb*frequency_interpolation_rate];
+	this->ready_to_process_passband_ring=new double[2*Nofdm*buffer_Nsymb*frequency_interpolation_rate];
+	this->ready_to_process_passband_delayed_data=this->ready_to_process_passband_ring;
+	this->baseband_data=new sample_complex[Nofdm*buffer_Nsymb];
+	this->baseband_data_interpolated=new sample_complex[Nofdm*buffer_Nsymb*frequency_interpolation_rate];
 
 	this->frames_to_read=preamble_nSymb+Nsymb;
 	this->data_ready=0;
@@ -169,6 +192,93 @@ void cl_data_container::set_size(int nData, int Nc, int M, int Nfft , int Nofdm,
 	{
 		this->passband_delayed_data[i]=(double)(rand()%1000 -500)/1000.0;
 	}
+	for(int i=0;i<Nofdm*buffer_Nsymb*frequency_interpolation_rate;i++)
+	{
+		this->passband_delayed_data[Nofdm*buffer_Nsymb*frequency_interpolation_rate+i]=this->passband_delayed_data[i];
+	}
+	this->passband_delayed_head=0;
+	this->ready_to_process_head=0;
+	this->rx_symbol_count=0;
+	this->ready_to_process_symbol_count=-1;
+}
+
+double* cl_data_container::passband_window()
+{
+	return &passband_delayed_data[passband_delayed_head];
+}
+
+void cl_data_container::append_passband_symbol(const double* symbol)
+{
+	int symbol_period=Nofdm*interpolation_rate;
+	int signal_period=symbol_period*buffer_Nsymb;
+
+	memcpy(&passband_delayed_data[passband_delayed_head],symbol,symbol_period*sizeof(double));
+	memcpy(&passband_delayed_data[passband_delayed_head+signal_period],symbol,symbol_period*sizeof(double));
+	passband_delayed_head=(passband_delayed_head+symbol_period)%signal_period;
+	rx_symbol_count++;
+}
+
+// The snapshot is a mirrored ring as well: when it still holds the previous window, only the
+// symbols captured since are copied and ready_to_process_passband_delayed_data moves on.
+void cl_data_container::snapshot_passband_window()
+{
+	int symbol_period=Nofdm*interpolation_rate;
+	int signal_period=symbol_period*buffer_Nsymb;
+	long long nNew=rx_symbol_count-ready_to_process_symbol_count;
+
+	if(ready_to_process_symbol_count>=0 && nNew>=0 && nNew<buffer_Nsymb)
+	{
+		const double* window=passband_window();
+		for(long long i=buffer_Nsymb-nNew;i<buffer_Nsymb;i++)
+		{
+			memcpy(&ready_to_process_passband_ring[ready_to_process_head],&window[i*symbol_period],symbol_period*sizeof(double));
+			memcpy(&ready_to_process_passband_ring[ready_to_process_head+signal_period],&window[i*symbol_period],symbol_period*sizeof(double));
+			ready_to_process_head=(ready_to_process_head+symbol_period)%signal_period;
+		}
+	}
+	else
+	{
+		memcpy(ready_to_process_passband_ring,passband_window(),signal_period*sizeof(double));
+		memcpy(&ready_to_process_passband_ring[signal_period],ready_to_process_passband_ring,signal_period*sizeof(double));
+		ready_to_process_head=0;
+	}
+	ready_to_process_passband_delayed_data=&ready_to_process_passband_ring[ready_to_process_head];
+	ready_to_process_symbol_count=rx_symbol_count;
+}
+
+void cl_data_container::clear_passband_window()
+{
+	memset(passband_delayed_data,0,2*Nofdm*buffer_Nsymb*interpolation_rate*sizeof(double));
+	// The whole window is replaced, so no earlier window shares samples with the new one.
+	rx_symbol_count+=buffer_Nsymb;
+}
+
+// Goes on with the capture of another container with the same symbol length: its newest symbols
+// become the newest of this window, the older ones are cleared, and the capture counters carry over.
+void cl_data_container::take_passband_window(cl_data_container* from)
+{
+	int symbol_period=Nofdm*interpolation_rate;
+	int signal_period=symbol_period*buffer_Nsymb;
+	int nSymb=(from->buffer_Nsymb<buffer_Nsymb)?from->buffer_Nsymb:buffer_Nsymb;
+	if(from->passband_delayed_data==NULL || from->Nofdm*from->interpolation_rate!=symbol_period)
+	{
+		nSymb=0;
+	}
+	int nCleared=signal_period-nSymb*symbol_period;
+
+	memset(passband_delayed_data,0,nCleared*sizeof(double));
+	if(nSymb>0)
+	{
+		memcpy(&passband_delayed_data[nCleared],from->passband_window()+(from->buffer_Nsymb-nSymb)*symbol_period,nSymb*symbol_period*sizeof(double));
+	}
+	memcpy(&passband_delayed_data[signal_period],passband_delayed_data,signal_period*sizeof(double));
+	passband_delayed_head=0;
+	rx_symbol_count=from->rx_symbol_count+buffer_Nsymb;
+	ready_to_process_symbol_count=-1;
+
+	frames_to_read=from->frames_to_read.load();
+	data_ready=from->data_ready.load();
+	nUnder_processing_events=from->nUnder_processing_events.load();
 }
 
 void cl_data_container::deinit()
@@ -184,12 +294,12 @@ void cl_data_container::deinit()
 	this->total_frame_size=0;
 
 	// Critical corruption check: verify data_bit matches what set_size() allocated
-	if(this->data_bit!=NULL && g_data_bit_shadow!=NULL && this->data_bit != g_data_bit_shadow)
+	if(this->data_bit!=NULL && this->data_bit_shadow!=NULL && this->data_bit != this->data_bit_shadow)
 	{
 		printf("[CORRUPT] !!! data_bit CORRUPTED before delete[] !!!\n");
 		printf("[CORRUPT]   expected=%p actual=%p delta=%lld\n",
-			(void*)g_data_bit_shadow, (void*)this->data_bit,
-			(long long)((char*)this->data_bit - (char*)g_data_bit_shadow));
+			(void*)this->data_bit_shadow, (void*)this->data_bit,
+			(long long)((char*)this->data_bit - (char*)this->data_bit_shadow));
 		printf("[CORRUPT]   this=%p &data_bit=%p (offset %lld)\n",
 			(void*)this, (void*)&this->data_bit,
 			(long long)((char*)&this->data_bit - (char*)this));
@@ -242,11 +352,6 @@ void cl_data_container::deinit()
 		delete[] this->ofdm_time_freq_interleaved_data;
 		this->ofdm_time_freq_interleaved_data=NULL;
 	}
-	if(this->ofdm_time_freq_deinterleaved_data!=NULL)
-	{
-		delete[] this->ofdm_time_freq_deinterleaved_data;
-		this->ofdm_time_freq_deinterleaved_data=NULL;
-	}
 	if(this->ofdm_symbol_modulated_data!=NULL)
 	{
 		delete[] this->ofdm_symbol_modulated_data;
@@ -313,6 +418,31 @@ void cl_data_container::deinit()
 		delete[] this->bit_energy_dispersal_sequence;
 		this->bit_energy_dispersal_sequence=NULL;
 	}
+	if(this->data_bit_packed!=NULL)
+	{
+		delete[] this->data_bit_packed;
+		this->data_bit_packed=NULL;
+	}
+	if(this->data_bit_energy_dispersal_packed!=NULL)
+	{
+		delete[] this->data_bit_energy_dispersal_packed;
+		this->data_bit_energy_dispersal_packed=NULL;
+	}
+	if(this->encoded_data_packed!=NULL)
+	{
+		delete[] this->encoded_data_packed;
+		this->encoded_data_packed=NULL;
+	}
+	if(this->bit_interleaved_data_packed!=NULL)
+	{
+		delete[] this->bit_interleaved_data_packed;
+		this->bit_interleaved_data_packed=NULL;
+	}
+	if(this->bit_energy_dispersal_sequence_packed!=NULL)
+	{
+		delete[] this->bit_energy_dispersal_sequence_packed;
+		this->bit_energy_dispersal_sequence_packed=NULL;
+	}
 
 	this->buffer_Nsymb=0;
 
@@ -326,9 +456,10 @@ void cl_data_container::deinit()
 		delete[] this->passband_delayed_data;
 		this->passband_delayed_data=NULL;
 	}
-	if(this->ready_to_process_passband_delayed_data!=NULL)
+	if(this->ready_to_process_passband_ring!=NULL)
 	{
-		delete[] this->ready_to_process_passband_delayed_data;
+		delete[] this->ready_to_process_passband_ring;
+		this->ready_to_process_passband_ring=NULL;
 		this->ready_to_process_passband_delayed_data=NULL;
 	}
 	if(this->baseband_data!=NULL)
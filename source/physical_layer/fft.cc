@@ -0,0 +1,269 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "physical_layer/fft.h"
+#include <iostream>
+#include <vector>
+#include <mutex>
+#include <cstdlib>
+#include <algorithm>
+
+static std::mutex fft_plan_cache_mutex;
+static std::vector<cl_fft_plan*> fft_plan_cache;
+
+cl_fft_plan* cl_fft_plan::get(int n, int direction)
+{
+	std::lock_guard<std::mutex> lock(fft_plan_cache_mutex);
+	for(unsigned int i=0;i<fft_plan_cache.size();i++)
+	{
+		if(fft_plan_cache[i]->n==n && fft_plan_cache[i]->direction==direction && fft_plan_cache[i]->type==FFT_COMPLEX)
+		{
+			return fft_plan_cache[i];
+		}
+	}
+	cl_fft_plan* plan=new cl_fft_plan(n,direction,FFT_COMPLEX);
+	fft_plan_cache.push_back(plan);
+	return plan;
+}
+
+cl_fft_plan* cl_fft_plan::get_real(int n)
+{
+	cl_fft_plan* half_plan=NULL;
+#ifndef MERCURY_FFTW
+	half_plan=get(n/2,FFT_FORWARD);
+#endif
+	std::lock_guard<std::mutex> lock(fft_plan_cache_mutex);
+	for(unsigned int i=0;i<fft_plan_cache.size();i++)
+	{
+		if(fft_plan_cache[i]->n==n && fft_plan_cache[i]->type==FFT_REAL)
+		{
+			return fft_plan_cache[i];
+		}
+	}
+	cl_fft_plan* plan=new cl_fft_plan(n,FFT_FORWARD,FFT_REAL);
+	plan->half_plan=half_plan;
+	fft_plan_cache.push_back(plan);
+	return plan;
+}
+
+cl_fft_plan::cl_fft_plan(int n, int direction, int type)
+{
+	this->n=n;
+	this->direction=direction;
+	this->type=type;
+	log2_n=0;
+	bit_rev=NULL;
+	twiddle=NULL;
+	real_twiddle=NULL;
+	half_plan=NULL;
+
+#ifdef MERCURY_FFTW
+	// Planned out of place on scratch arrays; execution uses the new-array interface.
+	if(type==FFT_REAL)
+	{
+		sample_real* in=FFTW(alloc_real)(n);
+		FFTW(complex)* out=FFTW(alloc_complex)(n/2+1);
+		fftw=FFTW(plan_dft_r2c_1d)(n,in,out,FFTW_ESTIMATE|FFTW_UNALIGNED);
+		FFTW(free)(in);
+		FFTW(free)(out);
+	}
+	else
+	{
+		FFTW(complex)* in=FFTW(alloc_complex)(n);
+		fftw=FFTW(plan_dft_1d)(n,in,in,(direction==FFT_FORWARD)?FFTW_FORWARD:FFTW_BACKWARD,FFTW_ESTIMATE|FFTW_UNALIGNED);
+		FFTW(free)(in);
+	}
+	if(fftw==NULL)
+	{
+		std::cout<<"FFTW plan error n="<<n<<".. exiting"<<std::endl;
+		exit(-6);
+	}
+#else
+	if(n<2 || (n&(n-1))!=0 || (type==FFT_REAL && n<4))
+	{
+		std::cout<<"FFT size "<<n<<" is not a power of two.. exiting"<<std::endl;
+		exit(-6);
+	}
+	if(type==FFT_REAL)
+	{
+		real_twiddle=new sample_complex[n/4+1];
+		for(int k=0;k<=n/4;k++)
+		{
+			real_twiddle[k]=sample_complex(cos(2*M_PI*k/n),-sin(2*M_PI*k/n));
+		}
+		return;
+	}
+
+	while((1<<log2_n)<n)
+	{
+		log2_n++;
+	}
+	twiddle=new sample_complex[n/2];
+	double sign=(direction==FFT_FORWARD)?-1:1;
+	for(int k=0;k<n/2;k++)
+	{
+		twiddle[k]=sample_complex(cos(2*M_PI*k/n),sign*sin(2*M_PI*k/n));
+	}
+	bit_rev=new int[n];
+	for(int i=0;i<n;i++)
+	{
+		int rev=0;
+		for(int b=0;b<log2_n;b++)
+		{
+			rev|=((i>>b)&1)<<(log2_n-1-b);
+		}
+		bit_rev[i]=rev;
+	}
+#endif
+}
+
+cl_fft_plan::~cl_fft_plan()
+{
+#ifdef MERCURY_FFTW
+	FFTW(destroy_plan)(fftw);
+#endif
+	if(bit_rev!=NULL)
+	{
+		delete[] bit_rev;
+	}
+	if(twiddle!=NULL)
+	{
+		delete[] twiddle;
+	}
+	if(real_twiddle!=NULL)
+	{
+		delete[] real_twiddle;
+	}
+}
+
+// Bit reversal followed by radix-2^2 decimation in time: each pass does two radix-2 stages at once
+// with three complex multiplies per four points, written out in real arithmetic so the compiler
+// does not go through the checked complex multiply.
+void cl_fft_plan::radix4(sample_complex* v) const
+{
+	for(int i=0;i<n;i++)
+	{
+		if(i<bit_rev[i])
+		{
+			std::swap(v[i],v[bit_rev[i]]);
+		}
+	}
+
+	sample_real* x=reinterpret_cast<sample_real*>(v);
+	int len=1;
+	if(log2_n&1)
+	{
+		for(int i=0;i<n;i+=2)
+		{
+			sample_real ar=x[2*i],ai=x[2*i+1];
+			sample_real br=x[2*i+2],bi=x[2*i+3];
+			x[2*i]=ar+br;
+			x[2*i+1]=ai+bi;
+			x[2*i+2]=ar-br;
+			x[2*i+3]=ai-bi;
+		}
+		len=2;
+	}
+	// Multiplying by W^(n/4) is -j forward and +j inverse.
+	sample_real rot=(direction==FFT_FORWARD)?1:-1;
+	for(;len<n;len*=4)
+	{
+		int q=len;
+		int step=n/(4*q);
+		for(int i=0;i<n;i+=4*q)
+		{
+			for(int j=0;j<q;j++)
+			{
+				sample_real w1r=twiddle[j*step].real(),w1i=twiddle[j*step].imag();
+				sample_real w2r=twiddle[2*j*step].real(),w2i=twiddle[2*j*step].imag();
+				sample_real* p0=&x[2*(i+j)];
+				sample_real* p1=&x[2*(i+j+q)];
+				sample_real* p2=&x[2*(i+j+2*q)];
+				sample_real* p3=&x[2*(i+j+3*q)];
+
+				sample_real t1r=w2r*p1[0]-w2i*p1[1],t1i=w2r*p1[1]+w2i*p1[0];
+				sample_real t3r=w2r*p3[0]-w2i*p3[1],t3i=w2r*p3[1]+w2i*p3[0];
+				sample_real b0r=p0[0]+t1r,b0i=p0[1]+t1i;
+				sample_real b1r=p0[0]-t1r,b1i=p0[1]-t1i;
+				sample_real b2r=p2[0]+t3r,b2i=p2[1]+t3i;
+				sample_real b3r=p2[0]-t3r,b3i=p2[1]-t3i;
+
+				sample_real u2r=w1r*b2r-w1i*b2i,u2i=w1r*b2i+w1i*b2r;
+				sample_real u3r=w1r*b3r-w1i*b3i,u3i=w1r*b3i+w1i*b3r;
+				sample_real r3r=rot*u3i,r3i=-rot*u3r;
+
+				p0[0]=b0r+u2r;
+				p0[1]=b0i+u2i;
+				p2[0]=b0r-u2r;
+				p2[1]=b0i-u2i;
+				p1[0]=b1r+r3r;
+				p1[1]=b1i+r3i;
+				p3[0]=b1r-r3r;
+				p3[1]=b1i-r3i;
+			}
+		}
+	}
+}
+
+void cl_fft_plan::execute(sample_complex* v) const
+{
+#ifdef MERCURY_FFTW
+	FFTW(execute_dft)(fftw,reinterpret_cast<FFTW(complex)*>(v),reinterpret_cast<FFTW(complex)*>(v));
+#else
+	radix4(v);
+#endif
+}
+
+// Even samples in the real part and odd samples in the imaginary part of one n/2 point transform,
+// then the two interleaved spectra are separated in place, bins k and n/2-k together.
+void cl_fft_plan::execute(const sample_real* in, sample_complex* out) const
+{
+#ifdef MERCURY_FFTW
+	FFTW(execute_dft_r2c)(fftw,const_cast<sample_real*>(in),reinterpret_cast<FFTW(complex)*>(out));
+#else
+	int m=n/2;
+	for(int i=0;i<m;i++)
+	{
+		out[i]=sample_complex(in[2*i],in[2*i+1]);
+	}
+	half_plan->execute(out);
+
+	sample_real z0r=out[0].real(),z0i=out[0].imag();
+	out[0]=sample_complex(z0r+z0i,0);
+	out[m]=sample_complex(z0r-z0i,0);
+	for(int k=1;k<=m/2;k++)
+	{
+		sample_real ar=out[k].real(),ai=out[k].imag();
+		sample_real br=out[m-k].real(),bi=-out[m-k].imag();
+		sample_real er=(ar+br)/2,ei=(ai+bi)/2;
+		// o=-j*(a-b)/2
+		sample_real or_=(ai-bi)/2,oi=-(ar-br)/2;
+		sample_real wr=real_twiddle[k].real(),wi=real_twiddle[k].imag();
+		sample_real tr=wr*or_-wi*oi,ti=wr*oi+wi*or_;
+		out[k]=sample_complex(er+tr,ei+ti);
+		if(k!=m-k)
+		{
+			out[m-k]=sample_complex(er-tr,-(ei-ti));
+		}
+	}
+#endif
+}
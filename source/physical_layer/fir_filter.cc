@@ -21,6 +21,7 @@
  */
 
 #include "physical_layer/fir_filter.h"
+#include <cstring>
 
 cl_FIR::cl_FIR()
 {
@@ -34,6 +35,15 @@ cl_FIR::cl_FIR()
 	type=LPF;
 
 	filter_coefficients=NULL;
+	padded_real=NULL;
+	padded_complex=NULL;
+	padded_size=0;
+	fft_size=0;
+	fft_coefficients=NULL;
+	fft_block=NULL;
+	fft_forward=NULL;
+	fft_inverse=NULL;
+	stream_history=NULL;
 }
 
 cl_FIR::~cl_FIR()
@@ -162,50 +172,250 @@ void cl_FIR::design()
 			filter_coefficients[i]*=0.42-0.5*cos(2.0*M_PI*(double)i/filter_nTaps)+0.08*cos(4.0*M_PI*(double)i/filter_nTaps);
 		}
 	}
+
+	if(stream_history!=NULL)
+	{
+		delete[] stream_history;
+	}
+	stream_history=new double[filter_nTaps];
+	reset_stream();
+
+	deinit_fft();
+	if(filter_nTaps>=FIR_FFT_MIN_TAPS)
+	{
+		init_fft();
+	}
 }
 
-void cl_FIR::apply(std::complex <double>* in, std::complex <double>* out, int nItems)
+void cl_FIR::init_fft()
 {
-	double acc_r,acc_im;
-	for(int i=0;i<(nItems+filter_nTaps-1);i++)
+	fft_size=1;
+	while(fft_size<8*filter_nTaps)
 	{
-		acc_r=0;
-		acc_im=0;
+		fft_size<<=1;
+	}
+	fft_forward=cl_fft_plan::get(fft_size,FFT_FORWARD);
+	fft_inverse=cl_fft_plan::get(fft_size,FFT_INVERSE);
+	fft_coefficients=new sample_complex[fft_size];
+	fft_block=new sample_complex[fft_size];
+
+	// The 1/fft_size of the inverse transform is folded into the filter spectrum.
+	for(int i=0;i<fft_size;i++)
+	{
+		fft_coefficients[i]=(i<filter_nTaps)?filter_coefficients[i]/(double)fft_size:0;
+	}
+	fft_forward->execute(fft_coefficients);
+}
+
+void cl_FIR::deinit_fft()
+{
+	if(fft_coefficients!=NULL)
+	{
+		delete[] fft_coefficients;
+		delete[] fft_block;
+		fft_coefficients=NULL;
+		fft_block=NULL;
+	}
+	fft_forward=NULL;
+	fft_inverse=NULL;
+	fft_size=0;
+}
+
+void cl_FIR::multiply_spectrum()
+{
+	for(int i=0;i<fft_size;i++)
+	{
+		double br=fft_block[i].real(),bi=fft_block[i].imag();
+		double cr=fft_coefficients[i].real(),ci=fft_coefficients[i].imag();
+		fft_block[i]=sample_complex(br*cr-bi*ci,br*ci+bi*cr);
+	}
+}
+
+void cl_FIR::reserve_padded(int nItems)
+{
+	if(padded_size<nItems+filter_nTaps)
+	{
+		if(padded_real!=NULL)
+		{
+			delete[] padded_real;
+			delete[] padded_complex;
+		}
+		padded_size=nItems+filter_nTaps;
+		padded_real=new double[padded_size];
+		padded_complex=new sample_complex[padded_size];
+	}
+}
+
+void cl_FIR::convolve_valid(const double* in, double* out, int nOut)
+{
+	if(fft_size>0 && nOut>=fft_size)
+	{
+		// Two real blocks per complex transform, one in each of the real and imaginary parts.
+		int step=fft_size-(filter_nTaps-1);
+		int nIn=nOut+filter_nTaps-1;
+		for(int k0=0;k0<nOut;k0+=2*step)
+		{
+			for(int i=0;i<fft_size;i++)
+			{
+				fft_block[i].real((k0+i<nIn)?in[k0+i]:0);
+				fft_block[i].imag((k0+step+i<nIn)?in[k0+step+i]:0);
+			}
+			fft_forward->execute(fft_block);
+			multiply_spectrum();
+			fft_inverse->execute(fft_block);
+			for(int i=0;i<step && k0+i<nOut;i++)
+			{
+				out[k0+i]=fft_block[filter_nTaps-1+i].real();
+			}
+			for(int i=0;i<step && k0+step+i<nOut;i++)
+			{
+				out[k0+step+i]=fft_block[filter_nTaps-1+i].imag();
+			}
+		}
+		return;
+	}
+
+	double acc;
+	for(int k=0;k<nOut;k++)
+	{
+		const double* x=&in[k+filter_nTaps-1];
+		acc=0;
 		for(int j=0;j<filter_nTaps;j++)
 		{
-			if((i-j)>=0 && (i-j)<nItems)
+			acc+=x[-j]*filter_coefficients[j];
+		}
+		out[k]=acc;
+	}
+}
+
+void cl_FIR::convolve_valid(const sample_complex* in, sample_complex* out, int nOut, int stride)
+{
+	if(fft_size>0 && stride==1 && nOut>=fft_size)
+	{
+		int step=fft_size-(filter_nTaps-1);
+		int nIn=nOut+filter_nTaps-1;
+		for(int k0=0;k0<nOut;k0+=step)
+		{
+			for(int i=0;i<fft_size;i++)
 			{
-				acc_r+=in[i-j].real()*filter_coefficients[j];
-				acc_im+=in[i-j].imag()*filter_coefficients[j];
+				fft_block[i]=(k0+i<nIn)?in[k0+i]:0;
+			}
+			fft_forward->execute(fft_block);
+			multiply_spectrum();
+			fft_inverse->execute(fft_block);
+			for(int i=0;i<step && k0+i<nOut;i++)
+			{
+				out[k0+i]=fft_block[filter_nTaps-1+i];
 			}
 		}
+		return;
+	}
 
-		if(i>=((int)(filter_nTaps-1)/2) && i<(nItems+(int)(filter_nTaps-1)/2))
+	double acc_r,acc_im;
+	for(int k=0;k<nOut;k++)
+	{
+		const sample_complex* x=&in[k*stride+filter_nTaps-1];
+		acc_r=0;
+		acc_im=0;
+		for(int j=0;j<filter_nTaps;j++)
 		{
-			out[i-(int)(filter_nTaps-1)/2].real(acc_r);
-			out[i-(int)(filter_nTaps-1)/2].imag(acc_im);
+			acc_r+=x[-j].real()*filter_coefficients[j];
+			acc_im+=x[-j].imag()*filter_coefficients[j];
 		}
+		out[k].real(acc_r);
+		out[k].imag(acc_im);
 	}
 }
 
-void cl_FIR::apply(double* in, double* out, int nItems)
+void cl_FIR::apply(sample_complex* in, sample_complex* out, int nItems)
 {
-	double acc;
-	for(int i=0;i<(nItems+filter_nTaps-1);i++)
+	int center=(int)(filter_nTaps-1)/2;
+	reserve_padded(nItems);
+	for(int i=0;i<center;i++)
 	{
-		acc=0;
+		padded_complex[i]=0;
+	}
+	memcpy(&padded_complex[center],in,nItems*sizeof(sample_complex));
+	for(int i=center+nItems;i<nItems+filter_nTaps-1;i++)
+	{
+		padded_complex[i]=0;
+	}
+	convolve_valid(padded_complex,out,nItems,1);
+}
+
+// Polyphase decimation: only the kept samples out[m]=filtered[m*decimation_rate] are computed.
+void cl_FIR::apply_decimate(sample_complex* in, sample_complex* out, int nItems, int decimation_rate)
+{
+	int center=(int)(filter_nTaps-1)/2;
+	reserve_padded(nItems);
+	for(int i=0;i<center;i++)
+	{
+		padded_complex[i]=0;
+	}
+	memcpy(&padded_complex[center],in,nItems*sizeof(sample_complex));
+	for(int i=center+nItems;i<nItems+filter_nTaps-1;i++)
+	{
+		padded_complex[i]=0;
+	}
+	convolve_valid(padded_complex,out,(nItems+decimation_rate-1)/decimation_rate,decimation_rate);
+}
+
+// Computes only out[first..last-1] of apply(in,out,nItems), with the same zero padding at both
+// ends of the nItems input and the same summation order; reads in[first-(nTaps-1)/2 .. last+nTaps/2].
+void cl_FIR::apply(const sample_complex* in, sample_complex* out, int nItems, int first, int last)
+{
+	double acc_r,acc_im;
+	int center=(int)(filter_nTaps-1)/2;
+	for(int k=first;k<last;k++)
+	{
+		int i=k+center;
+		acc_r=0;
+		acc_im=0;
 		for(int j=0;j<filter_nTaps;j++)
 		{
 			if((i-j)>=0 && (i-j)<nItems)
 			{
-				acc+=in[i-j]*filter_coefficients[j];
+				acc_r+=in[i-j].real()*filter_coefficients[j];
+				acc_im+=in[i-j].imag()*filter_coefficients[j];
 			}
 		}
+		out[k].real(acc_r);
+		out[k].imag(acc_im);
+	}
+}
 
-		if(i>=((int)(filter_nTaps-1)/2) && i<(nItems+(int)(filter_nTaps-1)/2))
-		{
-			out[i-(int)(filter_nTaps-1)/2]=acc;
-		}
+void cl_FIR::apply(double* in, double* out, int nItems)
+{
+	int center=(int)(filter_nTaps-1)/2;
+	reserve_padded(nItems);
+	for(int i=0;i<center;i++)
+	{
+		padded_real[i]=0;
+	}
+	memcpy(&padded_real[center],in,nItems*sizeof(double));
+	for(int i=center+nItems;i<nItems+filter_nTaps-1;i++)
+	{
+		padded_real[i]=0;
+	}
+	convolve_valid(padded_real,out,nItems);
+}
+
+// Causal filtering of a continuous stream in consecutive calls: out[n]=sum_j c[j]*in[n-j], where
+// samples before the current call come from the delay line. Output lags apply() by (nTaps-1)/2.
+void cl_FIR::apply_stream(double* in, double* out, int nItems)
+{
+	reserve_padded(nItems);
+	memcpy(padded_real,stream_history,(filter_nTaps-1)*sizeof(double));
+	memcpy(&padded_real[filter_nTaps-1],in,nItems*sizeof(double));
+	convolve_valid(padded_real,out,nItems);
+	memcpy(stream_history,&padded_real[nItems],(filter_nTaps-1)*sizeof(double));
+}
+
+void cl_FIR::reset_stream()
+{
+	if(stream_history!=NULL)
+	{
+		memset(stream_history,0,filter_nTaps*sizeof(double));
 	}
 }
 
@@ -222,5 +432,19 @@ void cl_FIR::deinit()
 		delete[] filter_coefficients;
 		filter_coefficients=NULL;
 	}
+	if(padded_real!=NULL)
+	{
+		delete[] padded_real;
+		delete[] padded_complex;
+		padded_real=NULL;
+		padded_complex=NULL;
+	}
+	padded_size=0;
+	if(stream_history!=NULL)
+	{
+		delete[] stream_history;
+		stream_history=NULL;
+	}
+	deinit_fft();
 }
 
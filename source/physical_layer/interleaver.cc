@@ -21,6 +21,7 @@
  */
 
 #include "physical_layer/interleaver.h"
+#include "physical_layer/misc.h"
 
 
 void interleaver(int* in, int* out, int nItems, int block_size)
@@ -40,7 +41,7 @@ void interleaver(int* in, int* out, int nItems, int block_size)
 	}
 }
 
-void interleaver(std::complex<double>* in, std::complex<double>* out, int nItems, int block_size)
+void interleaver(sample_complex* in, sample_complex* out, int nItems, int block_size)
 {
 	int nBlocks=nItems/block_size;
 
@@ -91,7 +92,7 @@ void deinterleaver(float* in, float* out, int nItems, int block_size)
 	}
 }
 
-void deinterleaver(std::complex<double>* in, std::complex<double>* out, int nItems, int block_size)
+void deinterleaver(sample_complex* in, sample_complex* out, int nItems, int block_size)
 {
 	int nBlocks=nItems/block_size;
 
@@ -116,3 +117,41 @@ void bit_energy_dispersal(int* in, int* sequence, int* out, int nItems)
 	}
 }
 
+void interleaver(const uint64_t* in, uint64_t* out, int nItems, int block_size)
+{
+	int nBlocks=nItems/block_size;
+
+	// Output order: out bit j*nBlocks+i comes from in bit i*block_size+j, built a word at a time.
+	for(int w=0;w<(nItems+63)/64;w++)
+	{
+		out[w]=0;
+	}
+	int i=0,j=0;
+	for(int k=0;k<nBlocks*block_size;k++)
+	{
+		out[k>>6]|=(uint64_t)get_packed_bit(in,i*block_size+j)<<(k&63);
+		if(++i==nBlocks)
+		{
+			i=0;
+			j++;
+		}
+	}
+	for(int k=nBlocks*block_size;k<nItems;k++)
+	{
+		out[k>>6]|=(uint64_t)get_packed_bit(in,k)<<(k&63);
+	}
+}
+
+void bit_energy_dispersal(const uint64_t* in, const uint64_t* sequence, uint64_t* out, int nItems)
+{
+	for(int w=0;w<nItems/64;w++)
+	{
+		out[w]=in[w] ^ sequence[w];
+	}
+	if(nItems%64!=0)
+	{
+		uint64_t mask=((uint64_t)1<<(nItems%64))-1;
+		out[nItems/64]=(out[nItems/64]&~mask)|((in[nItems/64] ^ sequence[nItems/64])&mask);
+	}
+}
+
@@ -31,11 +31,11 @@ double interpolate_linear(double a,double a_x,double b,double b_x,double x)
 	return return_val;
 }
 
-std::complex <double> interpolate_linear(std::complex <double> a,double a_x,std::complex <double> b,double b_x,double x)
+sample_complex interpolate_linear(sample_complex a,double a_x,sample_complex b,double b_x,double x)
 {
-	std::complex <double> return_val;
+	sample_complex return_val;
 
-	return_val=a+(b-a)*(x-a_x)/(b_x-a_x);
+	return_val=a+(b-a)*(sample_real)((x-a_x)/(b_x-a_x));
 
 	return return_val;
 }
@@ -53,10 +53,10 @@ double interpolate_bilinear(double a,double a_x,double a_y,double b,double b_x,d
 }
 
 
-std::complex <double> interpolate_bilinear(std::complex <double> a,double a_x,double a_y,std::complex <double> b,double b_x,double b_y,std::complex <double> c,double c_x,double c_y,std::complex <double> d,double d_x,double d_y,double x,double y)
+sample_complex interpolate_bilinear(sample_complex a,double a_x,double a_y,sample_complex b,double b_x,double b_y,sample_complex c,double c_x,double c_y,sample_complex d,double d_x,double d_y,double x,double y)
 
 {
-	std::complex <double> e,f,return_val;
+	sample_complex e,f,return_val;
 
 	e=interpolate_linear(a,a_x,b,b_x,x);
 	f=interpolate_linear(c,c_x,d,d_x,x);
@@ -304,7 +304,7 @@ void interpolate_bilinear_matrix(st_channel_real* estimated_channel, int max_col
 
 void interpolate_bilinear_matrix(st_channel_complex* estimated_channel, int max_col, int max_row, int col1,int col2, int row1, int row2)
 {
-	std::complex <double> a,b,c,d;
+	sample_complex a,b,c,d;
 	double a_x,a_y,b_x,b_y,c_x,c_y,d_x,d_y;
 
 
@@ -30,7 +30,10 @@ cl_ldpc::cl_ldpc()
 	P=0;
 	decoding_algorithm_val=0;
 	eta_val=0;
+	MS_alpha_val=0;
+	MS_beta_val=0;
 	nIteration_max_val=0;
+	nThreads_val=0;
 	print_nIteration_val=0;
 	Cwidth=0;
 	r=0;
@@ -39,19 +42,32 @@ cl_ldpc::cl_ldpc()
 	framesize=0;
 	standard=0;
 	nIteration_max=0;
+	nThreads=0;
 	GBF_eta=0;
+	MS_alpha=0;
+	MS_beta=0;
 	print_nIteration=NO;
 
 	Cwidth=0;
 	QCmatrixC=NULL;
 	QCmatrixEnc=NULL;
 	QCmatrixV=NULL;
-	QCmatrixd=NULL;
-	Q=NULL;
 	Vwidth=0;
-	R=NULL;
-	V_pos=NULL;
-	dwidth=0;
+	workspace=NULL;
+	nWorkspaces=0;
+	graph.nEdges=0;
+	graph.check_start=NULL;
+	graph.edge_variable=NULL;
+	graph.variable_start=NULL;
+	graph.variable_edge=NULL;
+	simd_layout.kernel=SIMD_MS_KERNEL_SCALAR;
+	simd_cpu_kernel=SIMD_MS_KERNEL_SCALAR;
+	simd_layout.lanes=0;
+	simd_layout.nGroups=0;
+	simd_layout.group_start=NULL;
+	simd_layout.slot_variable=NULL;
+	simd_layout.slot_contiguous=NULL;
+	simd_layout.alpha=NULL;
 }
 
 cl_ldpc::~cl_ldpc()
@@ -67,7 +83,18 @@ void cl_ldpc::init()
 	P=N-K;
 	decoding_algorithm_val=decoding_algorithm;
 	eta_val=GBF_eta;
+	MS_alpha_val=MS_alpha;
+	MS_beta_val=MS_beta;
 	nIteration_max_val=nIteration_max;
+	nThreads_val=nThreads;
+	if(nThreads_val<=0)
+	{
+		nThreads_val=std::thread::hardware_concurrency();
+	}
+	if(nThreads_val<=0)
+	{
+		nThreads_val=1;
+	}
 	print_nIteration_val= print_nIteration;
 	Cwidth=0;
 	update_code_parameters();
@@ -81,29 +108,63 @@ void cl_ldpc::deinit()
 	P=0;
 	decoding_algorithm_val=0;
 	eta_val=0;
+	MS_alpha_val=0;
+	MS_beta_val=0;
 	nIteration_max_val=0;
+	nThreads_val=0;
 	print_nIteration_val=0;
 	Cwidth=0;
 
-	Cwidth=0;
-	QCmatrixC=NULL;
-	QCmatrixEnc=NULL;
+	if(QCmatrixC!=NULL)
+	{
+		delete[] QCmatrixC;
+		QCmatrixC=NULL;
+	}
+	if(QCmatrixEnc!=NULL)
+	{
+		delete[] QCmatrixEnc;
+		QCmatrixEnc=NULL;
+	}
+	if(QCmatrixV!=NULL)
+	{
+		delete[] QCmatrixV;
+		QCmatrixV=NULL;
+	}
+	Vwidth=0;
 
-	if(R!=NULL)
+	pool.deinit();
+	if(workspace!=NULL)
+	{
+		for(int i=0;i<nWorkspaces;i++)
+		{
+			deinit_workspace(&workspace[i]);
+		}
+		delete[] workspace;
+		workspace=NULL;
+	}
+	nWorkspaces=0;
+	if(graph.check_start!=NULL)
+	{
+		delete[] graph.check_start;
+		graph.check_start=NULL;
+	}
+	if(graph.edge_variable!=NULL)
 	{
-		delete[] R;
-		R=NULL;
+		delete[] graph.edge_variable;
+		graph.edge_variable=NULL;
 	}
-	if(Q!=NULL)
+	if(graph.variable_start!=NULL)
 	{
-		delete[] Q;
-		Q=NULL;
+		delete[] graph.variable_start;
+		graph.variable_start=NULL;
 	}
-	if(V_pos!=NULL)
+	if(graph.variable_edge!=NULL)
 	{
-		delete[] V_pos;
-		V_pos=NULL;
+		delete[] graph.variable_edge;
+		graph.variable_edge=NULL;
 	}
+	graph.nEdges=0;
+	SIMD_MS_layout_free(&simd_layout);
 
 }
 
@@ -132,6 +193,220 @@ void cl_ldpc::encode(const int* data, int*  encoded_data)
  }
 
 
+ void cl_ldpc::encode(const uint64_t* data, uint64_t*  encoded_data)
+ {
+ 	// The codes are IRA: parity i is the XOR of the data bits of check i and parity i-1.
+ 	// The data part of every check is gathered 64 checks to a word, then the accumulator
+ 	// chain is resolved a word at a time with a prefix XOR instead of bit by bit.
+ 	int CwidthMax=Cwidth-1;
+ 	int nWords=(P+63)/64;
+ 	uint64_t carry=0;
+
+ 	for(int i=0;i<K/64;i++)
+ 	{
+ 		encoded_data[i]=data[i];
+ 	}
+ 	if(K%64!=0)
+ 	{
+ 		encoded_data[K/64]=data[K/64]&(((uint64_t)1<<(K%64))-1);
+ 	}
+
+ 	for(int w=0;w<nWords;w++)
+ 	{
+ 		uint64_t checks=0;
+ 		int end=(w*64+64<P)?w*64+64:P;
+ 		for(int i=w*64;i<end;i++)
+ 		{
+ 			const int* row=QCmatrixEnc+i*CwidthMax;
+ 			uint64_t sum=0;
+ 			for(int j=0;j<CwidthMax;j++)
+ 			{
+ 				if(row[j]>=0 && row[j]<K)
+ 				{
+ 					sum^=data[row[j]>>6]>>(row[j]&63);
+ 				}
+ 			}
+ 			checks|=(sum&1)<<(i-w*64);
+ 		}
+
+ 		checks^=checks<<1;
+ 		checks^=checks<<2;
+ 		checks^=checks<<4;
+ 		checks^=checks<<8;
+ 		checks^=checks<<16;
+ 		checks^=checks<<32;
+ 		checks^=carry;
+ 		carry=(uint64_t)0-(checks>>63);
+
+ 		int offset=K+w*64;
+ 		int length=end-w*64;
+ 		uint64_t mask=(length==64)?~(uint64_t)0:(((uint64_t)1<<length)-1);
+ 		checks&=mask;
+ 		encoded_data[offset>>6]=(encoded_data[offset>>6]&~(mask<<(offset&63)))|(checks<<(offset&63));
+ 		if((offset&63)!=0 && (offset&63)+length>64)
+ 		{
+ 			encoded_data[(offset>>6)+1]=checks>>(64-(offset&63));
+ 		}
+ 	}
+ }
+
+
+ void cl_ldpc::expand_code(const int* QCbase, int nGroups)
+ {
+ 	// The codes are stored as groups of variable nodes. Each group lists its size L, its shift q,
+ 	// its degree d and the d checks of its first variable; variable m of the group connects to
+ 	// the same checks advanced by m*q (mod P). The padded QCmatrixV/QCmatrixC/QCmatrixEnc tables
+ 	// of the selected code only are rebuilt from it here.
+ 	const int* group;
+ 	int v;
+
+ 	Vwidth=0;
+ 	group=QCbase;
+ 	for(int g=0;g<nGroups;g++)
+ 	{
+ 		if(group[2]>Vwidth)
+ 		{
+ 			Vwidth=group[2];
+ 		}
+ 		group+=3+group[2];
+ 	}
+
+ 	QCmatrixV=new int[N*Vwidth];
+ 	int* check_degree=new int[P];
+ 	for(int i=0;i<N*Vwidth;i++)
+ 	{
+ 		QCmatrixV[i]=-1;
+ 	}
+ 	for(int i=0;i<P;i++)
+ 	{
+ 		check_degree[i]=0;
+ 	}
+
+ 	v=0;
+ 	group=QCbase;
+ 	for(int g=0;g<nGroups;g++)
+ 	{
+ 		for(int m=0;m<group[0] && v<N;m++)
+ 		{
+ 			for(int k=0;k<group[2];k++)
+ 			{
+ 				int c=(group[3+k]+m*group[1])%P;
+ 				QCmatrixV[v*Vwidth+k]=c;
+ 				check_degree[c]++;
+ 			}
+ 			v++;
+ 		}
+ 		group+=3+group[2];
+ 	}
+ 	if(v!=N)
+ 	{
+ 		std::cout<<"LDPC base matrix describes "<<v<<" of "<<N<<" variables"<<std::endl<<"Exiting.."<<std::endl;
+ 		exit(1);
+ 	}
+
+ 	Cwidth=0;
+ 	for(int i=0;i<P;i++)
+ 	{
+ 		if(check_degree[i]>Cwidth)
+ 		{
+ 			Cwidth=check_degree[i];
+ 		}
+ 		check_degree[i]=0;
+ 	}
+
+ 	// Checks list their variables in increasing order, the encoder rows drop the check's own parity bit.
+ 	QCmatrixC=new int[P*Cwidth];
+ 	QCmatrixEnc=new int[P*(Cwidth-1)];
+ 	for(int i=0;i<P*Cwidth;i++)
+ 	{
+ 		QCmatrixC[i]=-1;
+ 	}
+ 	for(int i=0;i<P*(Cwidth-1);i++)
+ 	{
+ 		QCmatrixEnc[i]=-1;
+ 	}
+ 	for(v=0;v<N;v++)
+ 	{
+ 		for(int k=0;k<Vwidth && QCmatrixV[v*Vwidth+k]!=-1;k++)
+ 		{
+ 			int c=QCmatrixV[v*Vwidth+k];
+ 			QCmatrixC[c*Cwidth+check_degree[c]++]=v;
+ 		}
+ 	}
+ 	for(int i=0;i<P;i++)
+ 	{
+ 		int n=0;
+ 		for(int j=0;j<check_degree[i];j++)
+ 		{
+ 			if(QCmatrixC[i*Cwidth+j]!=K+i && n<Cwidth-1)
+ 			{
+ 				QCmatrixEnc[i*(Cwidth-1)+n++]=QCmatrixC[i*Cwidth+j];
+ 			}
+ 		}
+ 	}
+ 	delete[] check_degree;
+ }
+
+
+ void cl_ldpc::build_graph()
+ {
+ 	// Compile the padded QCmatrixC/QCmatrixV tables into a CSR Tanner graph once per code,
+ 	// the decoders then walk contiguous edge arrays without -1 sentinels or position searches.
+ 	graph.nEdges=0;
+ 	for(int i=0;i<P;i++)
+ 	{
+ 		for(int j=0;j<Cwidth;j++)
+ 		{
+ 			if(*(QCmatrixC+i*Cwidth+j)!=-1)
+ 			{
+ 				graph.nEdges++;
+ 			}
+ 		}
+ 	}
+
+ 	graph.check_start=new int[P+1];
+ 	graph.edge_variable=new int[graph.nEdges];
+ 	graph.variable_start=new int[N+1];
+ 	graph.variable_edge=new int[graph.nEdges];
+
+ 	int e=0;
+ 	for(int i=0;i<P;i++)
+ 	{
+ 		graph.check_start[i]=e;
+ 		for(int j=0;j<Cwidth;j++)
+ 		{
+ 			if(*(QCmatrixC+i*Cwidth+j)!=-1)
+ 			{
+ 				graph.edge_variable[e++]=*(QCmatrixC+i*Cwidth+j);
+ 			}
+ 		}
+ 	}
+ 	graph.check_start[P]=e;
+
+ 	int n=0;
+ 	for(int v=0;v<N;v++)
+ 	{
+ 		graph.variable_start[v]=n;
+ 		for(int k=0;k<Vwidth;k++)
+ 		{
+ 			int c=*(QCmatrixV+v*Vwidth+k);
+ 			if(c==-1)
+ 			{
+ 				continue;
+ 			}
+ 			for(int e1=graph.check_start[c];e1<graph.check_start[c+1];e1++)
+ 			{
+ 				if(graph.edge_variable[e1]==v)
+ 				{
+ 					graph.variable_edge[n++]=e1;
+ 					break;
+ 				}
+ 			}
+ 		}
+ 	}
+ 	graph.variable_start[N]=n;
+ }
+
  int cl_ldpc::update_code_parameters()
   {
   	int success=0;
@@ -141,107 +416,37 @@ void cl_ldpc::encode(const int* data, int*  encoded_data)
   		{
   			if(K==100)//rate == 1/16
   			{
-  				Cwidth=mercury_normal_Cwidth_1_16;
-  				Vwidth=mercury_normal_Vwidth_1_16;
-  				dwidth=mercury_normal_dwidth_1_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_1_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_1_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_1_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_1_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_1_16,mercury_normal_nGroups_1_16);
   			}
   			else if(K==200)//rate == 2/16
   			{
-//  				Cwidth=mercury_met_Cwidth_2_16;
-//  				Vwidth=mercury_met_Vwidth_2_16;
-//  				dwidth=mercury_met_dwidth_2_16;
-//  				QCmatrixC=&mercury_met_QCmatrixC_2_16[0][0];
-//  				QCmatrixEnc=&mercury_met_QCmatrixEnc_2_16[0][0];
-//  				QCmatrixV=&mercury_met_QCmatrixV_2_16[0][0];
-//  				QCmatrixd=&mercury_met_QCmatrixd_2_16[0];
-
-  				Cwidth=mercury_normal_Cwidth_2_16;
-  				Vwidth=mercury_normal_Vwidth_2_16;
-  				dwidth=mercury_normal_dwidth_2_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_2_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_2_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_2_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_2_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+//  				expand_code(mercury_met_QCbase_2_16,mercury_met_nGroups_2_16);
+
+  				expand_code(mercury_normal_QCbase_2_16,mercury_normal_nGroups_2_16);
   			}
   			else if(K==300)//rate == 3/16
   			{
-  				Cwidth=mercury_normal_Cwidth_3_16;
-  				Vwidth=mercury_normal_Vwidth_3_16;
-  				dwidth=mercury_normal_dwidth_3_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_3_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_3_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_3_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_3_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_3_16,mercury_normal_nGroups_3_16);
   			}
   			else if(K==400)//rate == 4/16
   			{
-  				Cwidth=mercury_normal_Cwidth_4_16;
-  				Vwidth=mercury_normal_Vwidth_4_16;
-  				dwidth=mercury_normal_dwidth_4_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_4_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_4_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_4_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_4_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_4_16,mercury_normal_nGroups_4_16);
   			}
   			else if(K==500)//rate == 5/16
   			{
-  				Cwidth=mercury_normal_Cwidth_5_16;
-  				Vwidth=mercury_normal_Vwidth_5_16;
-  				dwidth=mercury_normal_dwidth_5_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_5_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_5_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_5_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_5_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_5_16,mercury_normal_nGroups_5_16);
   			}
   			else if(K==600)//rate == 6/16
   			{
-  				Cwidth=mercury_normal_Cwidth_6_16;
-  				Vwidth=mercury_normal_Vwidth_6_16;
-  				dwidth=mercury_normal_dwidth_6_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_6_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_6_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_6_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_6_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_6_16,mercury_normal_nGroups_6_16);
   			}
   			else if(K==800)//rate == 8/16
   			{
-  				Cwidth=mercury_normal_Cwidth_8_16;
-  				Vwidth=mercury_normal_Vwidth_8_16;
-  				dwidth=mercury_normal_dwidth_8_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_8_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_8_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_8_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_8_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_8_16,mercury_normal_nGroups_8_16);
   			}
   			else if(K==1400)//rate == 14/16
   			{
-  				Cwidth=mercury_normal_Cwidth_14_16;
-  				Vwidth=mercury_normal_Vwidth_14_16;
-  				dwidth=mercury_normal_dwidth_14_16;
-  				QCmatrixC=&mercury_normal_QCmatrixC_14_16[0][0];
-  				QCmatrixEnc=&mercury_normal_QCmatrixEnc_14_16[0][0];
-  				QCmatrixV=&mercury_normal_QCmatrixV_14_16[0][0];
-  				QCmatrixd=&mercury_normal_QCmatrixd_14_16[0];
-  				R=new double [N*Vwidth];
-  				Q=new double [N*Vwidth];
+  				expand_code(mercury_normal_QCbase_14_16,mercury_normal_nGroups_14_16);
   			}
   			else
   			{
@@ -249,13 +454,12 @@ void cl_ldpc::encode(const int* data, int*  encoded_data)
   				success=-1;
   				exit(1);
   			}
-  			if(R==NULL || Q==NULL)
+  			build_graph();
+  			if(decoding_algorithm_val==SIMD_MS)
   			{
-  				std::cout<<"Memory allocation error"<<std::endl;
-  				exit(2);
+  				SIMD_MS_layout_build(&simd_layout,&graph,N,K,P,MS_alpha_val);
+				simd_cpu_kernel=simd_layout.kernel;
   			}
-  			// Pre-allocate V_pos workspace for SPA decoder (eliminates per-frame heap churn)
-  			V_pos=new int[P*Cwidth];
   		}
 
   	}
@@ -263,16 +467,121 @@ void cl_ldpc::encode(const int* data, int*  encoded_data)
   }
 
 
- int cl_ldpc::decode(const float* data,  int*  decoded_data)
+ int cl_ldpc::decode(const float* data,  int*  decoded_data, st_ldpc_workspace* ws)
+ {
+	return decode_codeword(data,decoded_data,ws);
+ }
+
+ void cl_ldpc::init_workspace(st_ldpc_workspace* ws)
+ {
+	if(ws->nEdges<graph.nEdges)
+	{
+		delete[] ws->R;
+		delete[] ws->Q;
+		ws->R=new double [graph.nEdges];
+		ws->Q=new double [graph.nEdges];
+		if(ws->R==NULL || ws->Q==NULL)
+		{
+			std::cout<<"Memory allocation error"<<std::endl;
+			exit(2);
+		}
+		ws->nEdges=graph.nEdges;
+	}
+	if(decoding_algorithm_val==SIMD_MS && ws->simd_size<simd_layout.group_start[simd_layout.nGroups]*simd_layout.lanes)
+	{
+		delete[] ws->simd_R;
+		ws->simd_size=simd_layout.group_start[simd_layout.nGroups]*simd_layout.lanes;
+		ws->simd_R=new short [ws->simd_size];
+		if(ws->simd_L==NULL)
+		{
+			ws->simd_L=new short [N_MAX+1];
+		}
+		if(ws->simd_R==NULL || ws->simd_L==NULL)
+		{
+			std::cout<<"Memory allocation error"<<std::endl;
+			exit(2);
+		}
+	}
+ }
+
+ void cl_ldpc::deinit_workspace(st_ldpc_workspace* ws)
+ {
+	delete[] ws->R;
+	delete[] ws->Q;
+	delete[] ws->simd_R;
+	delete[] ws->simd_L;
+	ws->R=NULL;
+	ws->Q=NULL;
+	ws->simd_R=NULL;
+	ws->simd_L=NULL;
+	ws->nEdges=0;
+	ws->simd_size=0;
+ }
+
+ void cl_ldpc::decode_batch(const float* data,  int*  decoded_data, int nCodewords, int* iterations_done)
+ {
+ 	// The threads and their workspaces are only started by the first batch, a code that is only
+ 	// decoded with decode() never has any.
+ 	if(workspace==NULL)
+ 	{
+ 		nWorkspaces=nThreads_val;
+ 		workspace=new st_ldpc_workspace[nWorkspaces]();
+ 		if(workspace==NULL)
+ 		{
+ 			std::cout<<"Memory allocation error"<<std::endl;
+ 			exit(2);
+ 		}
+ 		for(int i=0;i<nWorkspaces;i++)
+ 		{
+ 			init_workspace(&workspace[i]);
+ 		}
+ 		pool.init(nWorkspaces);
+ 	}
+ 	// Codewords are handed out one at a time so that frames needing more iterations do not
+ 	// leave the other threads idle.
+ 	pool.run(nCodewords,[this,data,decoded_data,iterations_done](int i, int worker)
+ 	{
+ 		iterations_done[i]=decode_codeword(&data[i*N],&decoded_data[i*K],&workspace[worker]);
+ 	});
+ }
+
+ int cl_ldpc::get_nThreads()
+ {
+ 	return nThreads_val;
+ }
+
+ void cl_ldpc::set_SIMD_MS_kernel(int kernel)
+ {
+ 	simd_layout.kernel=(kernel==SIMD_MS_KERNEL_SCALAR)?SIMD_MS_KERNEL_SCALAR:simd_cpu_kernel;
+ }
+
+ int cl_ldpc::get_SIMD_MS_kernel()
+ {
+ 	return simd_layout.kernel;
+ }
+
+ int cl_ldpc::decode_codeword(const float* data,  int*  decoded_data, st_ldpc_workspace* ws)
  {
 	 int iterations_done=0;
  	if(decoding_algorithm_val==GBF)
  	{
- 		iterations_done=decode_GBF(data,decoded_data,QCmatrixC,Cwidth,Cwidth,N,K,P,nIteration_max_val,eta_val);
+ 		iterations_done=decode_GBF(data,decoded_data,&graph,N,K,P,nIteration_max_val,eta_val);
  	}
  	else if(decoding_algorithm_val==SPA)
  	{
- 		iterations_done=decode_SPA(data,decoded_data,QCmatrixC,Cwidth,Cwidth, QCmatrixV,Vwidth,Vwidth,QCmatrixd,dwidth,R,Q,V_pos,N,K,P,nIteration_max_val);
+ 		iterations_done=decode_SPA(data,decoded_data,&graph,ws->R,ws->Q,N,K,P,nIteration_max_val);
+ 	}
+ 	else if(decoding_algorithm_val==LDPC_MS)
+ 	{
+ 		iterations_done=decode_MS(data,decoded_data,&graph,ws->R,ws->Q,N,K,P,nIteration_max_val,MS_alpha_val,MS_beta_val);
+ 	}
+ 	else if(decoding_algorithm_val==LAYERED_MS)
+ 	{
+ 		iterations_done=decode_LAYERED_MS(data,decoded_data,&graph,ws->R,N,K,P,nIteration_max_val,MS_alpha_val,MS_beta_val);
+ 	}
+ 	else if(decoding_algorithm_val==SIMD_MS)
+ 	{
+ 		iterations_done=decode_SIMD_MS(data,decoded_data,&graph,&simd_layout,ws->simd_R,ws->simd_L,N,K,P,nIteration_max_val,MS_beta_val);
  	}
  	return iterations_done;
  }
@@ -25,9 +25,7 @@
 int decode_GBF(
 		const float LLRi[],
 		int LLRo[],
-		int* C,
-		int CWidth,
-		int CWidthMax,
+		const st_ldpc_graph* graph,
 		int N,
 		int K,
 		int P,
@@ -41,7 +39,9 @@ int decode_GBF(
 	float LLRtmp[N_MAX];
 	int delta[N_MAX]={0};
 	int iteration=0;
-	int i,j,nOnes;
+	int i,e,nOnes;
+	const int* check_start=graph->check_start;
+	const int* edge_variable=graph->edge_variable;
 
 
 	for( i=0;i<N;i++)
@@ -56,13 +56,10 @@ int decode_GBF(
 	}
 	for (i=0;i<P;i++)
 	{
-		Cout[i]=LLRbin[*(C+i*CWidthMax+0)];
-		for( j=1;j<CWidth;j++)
+		Cout[i]=0;
+		for( e=check_start[i];e<check_start[i+1];e++)
 		{
-			if(*(C+i*CWidthMax+j)!=-1)
-			{
-				Cout[i]^= LLRbin[*(C+i*CWidthMax+j)];
-			}
+			Cout[i]^= LLRbin[edge_variable[e]];
 		}
 
 		nOnes+=Cout[i];
@@ -78,23 +75,17 @@ int decode_GBF(
 			}
 			for (i=0;i<P;i++)
 			{
-				Cout[i]=LLRbin[*(C+i*CWidthMax+0)];
-				for( j=1;j<CWidth;j++)
+				Cout[i]=0;
+				for( e=check_start[i];e<check_start[i+1];e++)
 				{
-					if(*(C+i*CWidthMax+j)!=-1)
-					{
-						Cout[i]^= LLRbin[*(C+i*CWidthMax+j)];
-					}
+					Cout[i]^= LLRbin[edge_variable[e]];
 				}
 
 				nOnes+=Cout[i];
 
-				for( j=0;j<CWidth;j++)
+				for( e=check_start[i];e<check_start[i+1];e++)
 				{
-					if(*(C+i*CWidthMax+j)!=-1)
-					{
-						delta[*(C+i*CWidthMax+j)]+=2*Cout[i]-1;
-					}
+					delta[edge_variable[e]]+=2*Cout[i]-1;
 				}
 			}
 			if(nOnes==0)
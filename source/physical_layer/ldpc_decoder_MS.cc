@@ -0,0 +1,192 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "physical_layer/ldpc_decoder_MS.h"
+
+int decode_MS(
+		const float LLRi[],
+		int LLRo[],
+		const st_ldpc_graph* graph,
+		double* R,
+		double* Q,
+		int N,
+		int K,
+		int P,
+		int nIteration_max,
+		float alpha,
+		float beta
+)
+{
+	int Cout[N_MAX];
+	int LLRbin[N_MAX];
+	int iteration=0;
+	int i,j,e,nOnes;
+	double LLRtmp[N_MAX];
+	double alpha_degree[C_WIDTH_MAX+1];
+	const int* check_start=graph->check_start;
+	const int* edge_variable=graph->edge_variable;
+	const int* variable_start=graph->variable_start;
+	const int* variable_edge=graph->variable_edge;
+
+	int degree_max=0;
+
+	for( i=0;i<P;i++)
+	{
+		if(check_start[i+1]-check_start[i]>degree_max)
+		{
+			degree_max=check_start[i+1]-check_start[i];
+		}
+	}
+
+	// The Min-Sum overestimate grows with the check degree, so the normalization
+	// compounds once per doubling of the number of incoming messages.
+	for( i=0;i<=degree_max;i++)
+	{
+		alpha_degree[i]=(i>2)?pow(alpha,log2((double)(i-1))):1;
+	}
+
+	for( i=0;i<N;i++)
+	{
+		LLRbin[i]= (LLRi[i]<0);
+		LLRtmp[i]=LLRi[i];
+	}
+
+	nOnes=0;
+	for (i=0;i<P;i++)
+	{
+		Cout[i]=0;
+		for( e=check_start[i];e<check_start[i+1];e++)
+		{
+			Cout[i]^= LLRbin[edge_variable[e]];
+		}
+
+		nOnes+=Cout[i];
+	}
+	if(nOnes!=0)
+	{
+		for( e=0;e<graph->nEdges;e++)
+		{
+			R[e]=0;
+			Q[e]=LLRi[edge_variable[e]];
+		}
+
+		int iindex,min_index,sign,degree;
+		double q,min1,min2,magnitude;
+
+		for(iteration=1;iteration<=nIteration_max;iteration++)
+		{
+			for ( iindex=0;iindex<P;iindex++)
+			{
+				// Single pass over the check row: track the two smallest |Q| and the sign parity,
+				// then every outgoing message is the row minimum excluding its own edge.
+				min1=MS_MESSAGE_MAX;
+				min2=MS_MESSAGE_MAX;
+				min_index=-1;
+				sign=0;
+				for ( e=check_start[iindex];e<check_start[iindex+1];e++)
+				{
+					q=Q[e];
+					sign^=(q<0);
+					q=fabs(q);
+					if(q<min1)
+					{
+						min2=min1;
+						min1=q;
+						min_index=e;
+					}
+					else if(q<min2)
+					{
+						min2=q;
+					}
+				}
+				degree=check_start[iindex+1]-check_start[iindex];
+
+				// Degree-2 checks are exact under Min-Sum, only correct the larger ones.
+				if(degree>2)
+				{
+					min1=alpha_degree[degree]*min1-beta;
+					min2=alpha_degree[degree]*min2-beta;
+					if(min1<0)
+					{
+						min1=0;
+					}
+					if(min2<0)
+					{
+						min2=0;
+					}
+				}
+
+				for ( e=check_start[iindex];e<check_start[iindex+1];e++)
+				{
+					magnitude=(e==min_index)?min2:min1;
+					if(sign ^ (Q[e]<0))
+					{
+						magnitude=-magnitude;
+					}
+					R[e]=magnitude;
+				}
+			}
+
+			for( i=0;i<N;i++)
+			{
+				LLRtmp[i]=LLRi[i];
+				for ( j=variable_start[i];j<variable_start[i+1];j++)
+				{
+					LLRtmp[i]+=R[variable_edge[j]];
+				}
+				LLRbin[i]= (LLRtmp[i]<0);
+			}
+
+
+			nOnes=0;
+			for( i=0;i<P;i++)
+			{
+				Cout[i]=0;
+				for( e=check_start[i];e<check_start[i+1];e++)
+				{
+					Cout[i]^=LLRbin[edge_variable[e]];
+				}
+				nOnes+=Cout[i];
+			}
+
+			if(nOnes==0)
+			{
+				break;
+			}
+
+			for( e=0;e<graph->nEdges;e++)
+			{
+				Q[e]=LLRtmp[edge_variable[e]]-R[e];
+			}
+		}
+	}
+	for( i=0;i<K;i++)
+	{
+		LLRo[i]=(LLRtmp[i]<0);
+	}
+	return iteration;
+
+}
+
+/* J. Chen, A. Dholakia, E. Eleftheriou, M. P. C. Fossorier, and X. Hu, "Reduced-complexity decoding of LDPC codes," IEEE Transactions on Communications, vol. 53, no. 8, pp. 1288-1299, Aug 2005.
+ * https://ieeexplore.ieee.org/document/1495850
+ */
@@ -0,0 +1,591 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "physical_layer/ldpc_decoder_SIMD_MS.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_MS_X86
+#endif
+
+static inline short SIMD_MS_saturate(int x)
+{
+	if(x>SIMD_MS_LLR_MAX)
+	{
+		return SIMD_MS_LLR_MAX;
+	}
+	if(x<-SIMD_MS_LLR_MAX)
+	{
+		return -SIMD_MS_LLR_MAX;
+	}
+	return (short)x;
+}
+
+static int SIMD_MS_select_kernel()
+{
+#ifdef SIMD_MS_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2"))
+	{
+		return SIMD_MS_KERNEL_AVX2;
+	}
+	if(__builtin_cpu_supports("sse4.1"))
+	{
+		return SIMD_MS_KERNEL_SSE41;
+	}
+#endif
+	return SIMD_MS_KERNEL_SCALAR;
+}
+
+void SIMD_MS_layout_build(
+		st_ldpc_simd_layout* layout,
+		const st_ldpc_graph* graph,
+		int N,
+		int K,
+		int P,
+		float alpha
+)
+{
+	const int* check_start=graph->check_start;
+	const int* edge_variable=graph->edge_variable;
+	const int* variable_start=graph->variable_start;
+	const int* variable_edge=graph->variable_edge;
+
+	layout->kernel=SIMD_MS_select_kernel();
+	layout->lanes=(layout->kernel==SIMD_MS_KERNEL_AVX2)?16:8;
+	int lanes=layout->lanes;
+
+	int* edge_check=new int[graph->nEdges];
+	for(int c=0;c<P;c++)
+	{
+		for(int e=check_start[c];e<check_start[c+1];e++)
+		{
+			edge_check[e]=c;
+		}
+	}
+
+	// Circulant step: the row distance between the checks of two consecutive information
+	// bits of the same column group (the q of the DVB-S2 style IRA construction).
+	int* step_count=new int[P];
+	for(int s=0;s<P;s++)
+	{
+		step_count[s]=0;
+	}
+	for(int v=0;v<K-1;v++)
+	{
+		int degree=variable_start[v+1]-variable_start[v];
+		if(degree!=variable_start[v+2]-variable_start[v+1])
+		{
+			continue;
+		}
+		for(int j=0;j<degree;j++)
+		{
+			int s=edge_check[variable_edge[variable_start[v+1]+j]]-edge_check[variable_edge[variable_start[v]+j]];
+			if(s<0)
+			{
+				s+=P;
+			}
+			step_count[s]++;
+		}
+	}
+	int step=0;
+	for(int s=1;s<P;s++)
+	{
+		if(step_count[s]>step_count[step])
+		{
+			step=s;
+		}
+	}
+	if(step_count[step]<K/4)
+	{
+		step=0;
+	}
+
+	int* group_rows=new int[P];
+	int* group_first=new int[P+1];
+	char* assigned=new char[P];
+	int* stamp=new int[N+1];
+	for(int c=0;c<P;c++)
+	{
+		assigned[c]=NO;
+	}
+	for(int v=0;v<=N;v++)
+	{
+		stamp[v]=-1;
+	}
+
+	int nGroups=0;
+	int nRows=0;
+	for(int r=0;r<P;r++)
+	{
+		if(assigned[r]==YES)
+		{
+			continue;
+		}
+		group_first[nGroups]=nRows;
+		int size=0;
+		int degree=check_start[r+1]-check_start[r];
+		for(int pass=0;pass<3 && size<lanes;pass++)
+		{
+			// pass 0: circulant neighbours, pass 1: same degree, pass 2: any disjoint row
+			for(int c=r;c<P && size<lanes;c+=(pass==0)?step:1)
+			{
+				if(assigned[c]==YES || (pass<2 && check_start[c+1]-check_start[c]!=degree))
+				{
+					if(pass==0 && c!=r)
+					{
+						break;
+					}
+					continue;
+				}
+				int disjoint=YES;
+				for(int e=check_start[c];e<check_start[c+1];e++)
+				{
+					if(stamp[edge_variable[e]]==nGroups)
+					{
+						disjoint=NO;
+						break;
+					}
+				}
+				if(disjoint==NO)
+				{
+					if(pass==0)
+					{
+						break;
+					}
+					continue;
+				}
+				for(int e=check_start[c];e<check_start[c+1];e++)
+				{
+					stamp[edge_variable[e]]=nGroups;
+				}
+				assigned[c]=YES;
+				group_rows[nRows++]=c;
+				size++;
+				if(pass==0 && step==0)
+				{
+					break;
+				}
+			}
+		}
+		nGroups++;
+	}
+	group_first[nGroups]=nRows;
+
+	layout->nGroups=nGroups;
+	layout->group_start=new int[nGroups+1];
+	int nSlots=0;
+	for(int g=0;g<nGroups;g++)
+	{
+		layout->group_start[g]=nSlots;
+		int degree_max=0;
+		for(int i=group_first[g];i<group_first[g+1];i++)
+		{
+			int c=group_rows[i];
+			if(check_start[c+1]-check_start[c]>degree_max)
+			{
+				degree_max=check_start[c+1]-check_start[c];
+			}
+		}
+		nSlots+=degree_max;
+	}
+	layout->group_start[nGroups]=nSlots;
+
+	layout->slot_variable=new int[nSlots*lanes];
+	layout->slot_contiguous=new char[nSlots];
+	layout->alpha=new short[nGroups*lanes];
+
+	for(int g=0;g<nGroups;g++)
+	{
+		for(int lane=0;lane<lanes;lane++)
+		{
+			int degree=0;
+			int c=-1;
+			if(group_first[g]+lane<group_first[g+1])
+			{
+				c=group_rows[group_first[g]+lane];
+				degree=check_start[c+1]-check_start[c];
+			}
+			double a=(degree>2)?pow(alpha,log2((double)(degree-1))):1;
+			layout->alpha[g*lanes+lane]=(a>=1)?32767:(short)lround(a*32768);
+
+			for(int k=layout->group_start[g];k<layout->group_start[g+1];k++)
+			{
+				int j=k-layout->group_start[g];
+				layout->slot_variable[k*lanes+lane]=(j<degree)?edge_variable[check_start[c]+j]:N;
+			}
+		}
+		for(int k=layout->group_start[g];k<layout->group_start[g+1];k++)
+		{
+			int* var=&layout->slot_variable[k*lanes];
+			layout->slot_contiguous[k]=(var[0]+lanes<=N)?YES:NO;
+			for(int lane=1;lane<lanes;lane++)
+			{
+				if(var[lane]!=var[0]+lane)
+				{
+					layout->slot_contiguous[k]=NO;
+					break;
+				}
+			}
+		}
+	}
+
+	delete[] edge_check;
+	delete[] step_count;
+	delete[] group_rows;
+	delete[] group_first;
+	delete[] assigned;
+	delete[] stamp;
+}
+
+void SIMD_MS_layout_free(st_ldpc_simd_layout* layout)
+{
+	if(layout->group_start!=NULL)
+	{
+		delete[] layout->group_start;
+		layout->group_start=NULL;
+	}
+	if(layout->slot_variable!=NULL)
+	{
+		delete[] layout->slot_variable;
+		layout->slot_variable=NULL;
+	}
+	if(layout->slot_contiguous!=NULL)
+	{
+		delete[] layout->slot_contiguous;
+		layout->slot_contiguous=NULL;
+	}
+	if(layout->alpha!=NULL)
+	{
+		delete[] layout->alpha;
+		layout->alpha=NULL;
+	}
+	layout->nGroups=0;
+}
+
+static void SIMD_MS_group_scalar(const st_ldpc_simd_layout* layout, short* R, short* L, int group, short beta)
+{
+	const int lanes=layout->lanes;
+	short Qbuf[C_WIDTH_MAX*SIMD_MS_LANES_MAX];
+	short min1[SIMD_MS_LANES_MAX],min2[SIMD_MS_LANES_MAX];
+	int min_index[SIMD_MS_LANES_MAX],sign[SIMD_MS_LANES_MAX];
+	int first=layout->group_start[group];
+	int degree=layout->group_start[group+1]-first;
+	const short* alpha=&layout->alpha[group*lanes];
+
+	for(int lane=0;lane<lanes;lane++)
+	{
+		min1[lane]=SIMD_MS_MESSAGE_MAX;
+		min2[lane]=SIMD_MS_MESSAGE_MAX;
+		min_index[lane]=-1;
+		sign[lane]=0;
+	}
+
+	for(int k=0;k<degree;k++)
+	{
+		const int* var=&layout->slot_variable[(first+k)*lanes];
+		const short* Rk=&R[(first+k)*lanes];
+		for(int lane=0;lane<lanes;lane++)
+		{
+			short q=SIMD_MS_saturate((int)L[var[lane]]-(int)Rk[lane]);
+			short a=(q<0)?-q:q;
+			Qbuf[k*lanes+lane]=q;
+			sign[lane]^=(q<0);
+			if(a<min1[lane])
+			{
+				min2[lane]=min1[lane];
+				min1[lane]=a;
+				min_index[lane]=k;
+			}
+			else if(a<min2[lane])
+			{
+				min2[lane]=a;
+			}
+		}
+	}
+
+	for(int lane=0;lane<lanes;lane++)
+	{
+		int m1=(((int)min1[lane]*alpha[lane])+16384)>>15;
+		int m2=(((int)min2[lane]*alpha[lane])+16384)>>15;
+		m1-=beta;
+		m2-=beta;
+		min1[lane]=(short)((m1<0)?0:m1);
+		min2[lane]=(short)((m2<0)?0:m2);
+	}
+
+	for(int k=0;k<degree;k++)
+	{
+		const int* var=&layout->slot_variable[(first+k)*lanes];
+		short* Rk=&R[(first+k)*lanes];
+		for(int lane=0;lane<lanes;lane++)
+		{
+			short q=Qbuf[k*lanes+lane];
+			short magnitude=(k==min_index[lane])?min2[lane]:min1[lane];
+			if(sign[lane] ^ (q<0))
+			{
+				magnitude=-magnitude;
+			}
+			Rk[lane]=magnitude;
+			L[var[lane]]=SIMD_MS_saturate((int)q+(int)magnitude);
+		}
+	}
+}
+
+#ifdef SIMD_MS_X86
+
+__attribute__((target("sse4.1")))
+static void SIMD_MS_group_sse41(const st_ldpc_simd_layout* layout, short* R, short* L, int group, short beta)
+{
+	alignas(16) short Qbuf[C_WIDTH_MAX*8];
+	alignas(16) short tmp[8];
+	int first=layout->group_start[group];
+	int degree=layout->group_start[group+1]-first;
+
+	const __m128i floor=_mm_set1_epi16(-SIMD_MS_LLR_MAX);
+	const __m128i one=_mm_set1_epi16(1);
+	__m128i min1=_mm_set1_epi16(SIMD_MS_MESSAGE_MAX);
+	__m128i min2=min1;
+	__m128i min_index=_mm_set1_epi16(-1);
+	__m128i sign=_mm_setzero_si128();
+
+	for(int k=0;k<degree;k++)
+	{
+		const int* var=&layout->slot_variable[(first+k)*8];
+		__m128i l;
+		if(layout->slot_contiguous[first+k]==YES)
+		{
+			l=_mm_loadu_si128((const __m128i*)&L[var[0]]);
+		}
+		else
+		{
+			for(int lane=0;lane<8;lane++)
+			{
+				tmp[lane]=L[var[lane]];
+			}
+			l=_mm_load_si128((const __m128i*)tmp);
+		}
+		__m128i q=_mm_max_epi16(_mm_subs_epi16(l,_mm_loadu_si128((const __m128i*)&R[(first+k)*8])),floor);
+		_mm_store_si128((__m128i*)&Qbuf[k*8],q);
+		sign=_mm_xor_si128(sign,q);
+		__m128i a=_mm_abs_epi16(q);
+		__m128i smaller=_mm_cmpgt_epi16(min1,a);
+		min2=_mm_min_epi16(min2,_mm_max_epi16(min1,a));
+		min1=_mm_min_epi16(min1,a);
+		min_index=_mm_blendv_epi8(min_index,_mm_set1_epi16((short)k),smaller);
+	}
+
+	__m128i alpha=_mm_loadu_si128((const __m128i*)&layout->alpha[group*8]);
+	__m128i offset=_mm_set1_epi16(beta);
+	__m128i zero=_mm_setzero_si128();
+	min1=_mm_max_epi16(_mm_subs_epi16(_mm_mulhrs_epi16(min1,alpha),offset),zero);
+	min2=_mm_max_epi16(_mm_subs_epi16(_mm_mulhrs_epi16(min2,alpha),offset),zero);
+
+	for(int k=0;k<degree;k++)
+	{
+		const int* var=&layout->slot_variable[(first+k)*8];
+		__m128i q=_mm_load_si128((const __m128i*)&Qbuf[k*8]);
+		__m128i magnitude=_mm_blendv_epi8(min1,min2,_mm_cmpeq_epi16(min_index,_mm_set1_epi16((short)k)));
+		__m128i r=_mm_sign_epi16(magnitude,_mm_or_si128(_mm_srai_epi16(_mm_xor_si128(sign,q),15),one));
+		_mm_storeu_si128((__m128i*)&R[(first+k)*8],r);
+		__m128i l=_mm_max_epi16(_mm_adds_epi16(q,r),floor);
+		if(layout->slot_contiguous[first+k]==YES)
+		{
+			_mm_storeu_si128((__m128i*)&L[var[0]],l);
+		}
+		else
+		{
+			_mm_store_si128((__m128i*)tmp,l);
+			for(int lane=0;lane<8;lane++)
+			{
+				L[var[lane]]=tmp[lane];
+			}
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+static void SIMD_MS_group_avx2(const st_ldpc_simd_layout* layout, short* R, short* L, int group, short beta)
+{
+	alignas(32) short Qbuf[C_WIDTH_MAX*16];
+	alignas(32) short tmp[16];
+	int first=layout->group_start[group];
+	int degree=layout->group_start[group+1]-first;
+
+	const __m256i floor=_mm256_set1_epi16(-SIMD_MS_LLR_MAX);
+	const __m256i one=_mm256_set1_epi16(1);
+	__m256i min1=_mm256_set1_epi16(SIMD_MS_MESSAGE_MAX);
+	__m256i min2=min1;
+	__m256i min_index=_mm256_set1_epi16(-1);
+	__m256i sign=_mm256_setzero_si256();
+
+	for(int k=0;k<degree;k++)
+	{
+		const int* var=&layout->slot_variable[(first+k)*16];
+		__m256i l;
+		if(layout->slot_contiguous[first+k]==YES)
+		{
+			l=_mm256_loadu_si256((const __m256i*)&L[var[0]]);
+		}
+		else
+		{
+			for(int lane=0;lane<16;lane++)
+			{
+				tmp[lane]=L[var[lane]];
+			}
+			l=_mm256_load_si256((const __m256i*)tmp);
+		}
+		__m256i q=_mm256_max_epi16(_mm256_subs_epi16(l,_mm256_loadu_si256((const __m256i*)&R[(first+k)*16])),floor);
+		_mm256_store_si256((__m256i*)&Qbuf[k*16],q);
+		sign=_mm256_xor_si256(sign,q);
+		__m256i a=_mm256_abs_epi16(q);
+		__m256i smaller=_mm256_cmpgt_epi16(min1,a);
+		min2=_mm256_min_epi16(min2,_mm256_max_epi16(min1,a));
+		min1=_mm256_min_epi16(min1,a);
+		min_index=_mm256_blendv_epi8(min_index,_mm256_set1_epi16((short)k),smaller);
+	}
+
+	__m256i alpha=_mm256_loadu_si256((const __m256i*)&layout->alpha[group*16]);
+	__m256i offset=_mm256_set1_epi16(beta);
+	__m256i zero=_mm256_setzero_si256();
+	min1=_mm256_max_epi16(_mm256_subs_epi16(_mm256_mulhrs_epi16(min1,alpha),offset),zero);
+	min2=_mm256_max_epi16(_mm256_subs_epi16(_mm256_mulhrs_epi16(min2,alpha),offset),zero);
+
+	for(int k=0;k<degree;k++)
+	{
+		const int* var=&layout->slot_variable[(first+k)*16];
+		__m256i q=_mm256_load_si256((const __m256i*)&Qbuf[k*16]);
+		__m256i magnitude=_mm256_blendv_epi8(min1,min2,_mm256_cmpeq_epi16(min_index,_mm256_set1_epi16((short)k)));
+		__m256i r=_mm256_sign_epi16(magnitude,_mm256_or_si256(_mm256_srai_epi16(_mm256_xor_si256(sign,q),15),one));
+		_mm256_storeu_si256((__m256i*)&R[(first+k)*16],r);
+		__m256i l=_mm256_max_epi16(_mm256_adds_epi16(q,r),floor);
+		if(layout->slot_contiguous[first+k]==YES)
+		{
+			_mm256_storeu_si256((__m256i*)&L[var[0]],l);
+		}
+		else
+		{
+			_mm256_store_si256((__m256i*)tmp,l);
+			for(int lane=0;lane<16;lane++)
+			{
+				L[var[lane]]=tmp[lane];
+			}
+		}
+	}
+}
+
+#endif
+
+int decode_SIMD_MS(
+		const float LLRi[],
+		int LLRo[],
+		const st_ldpc_graph* graph,
+		const st_ldpc_simd_layout* layout,
+		short R[],
+		short L[],
+		int N,
+		int K,
+		int P,
+		int nIteration_max,
+		float beta
+)
+{
+	int Cout[N_MAX];
+	int iteration=0;
+	int i,e,nOnes;
+	const int* check_start=graph->check_start;
+	const int* edge_variable=graph->edge_variable;
+	short beta_fixed=(short)lround(beta*SIMD_MS_SCALE);
+
+	void (*group_update)(const st_ldpc_simd_layout*, short*, short*, int, short)=SIMD_MS_group_scalar;
+#ifdef SIMD_MS_X86
+	if(layout->kernel==SIMD_MS_KERNEL_AVX2)
+	{
+		group_update=SIMD_MS_group_avx2;
+	}
+	else if(layout->kernel==SIMD_MS_KERNEL_SSE41)
+	{
+		group_update=SIMD_MS_group_sse41;
+	}
+#endif
+
+	for( i=0;i<N;i++)
+	{
+		L[i]=SIMD_MS_saturate((int)lrintf(LLRi[i]*SIMD_MS_SCALE));
+	}
+	L[N]=SIMD_MS_LLR_MAX;
+
+	nOnes=0;
+	for (i=0;i<P;i++)
+	{
+		Cout[i]=0;
+		for( e=check_start[i];e<check_start[i+1];e++)
+		{
+			Cout[i]^= (L[edge_variable[e]]<0);
+		}
+
+		nOnes+=Cout[i];
+	}
+	if(nOnes!=0)
+	{
+		for( i=0;i<layout->group_start[layout->nGroups]*layout->lanes;i++)
+		{
+			R[i]=0;
+		}
+
+		for(iteration=1;iteration<=nIteration_max;iteration++)
+		{
+			for(int group=0;group<layout->nGroups;group++)
+			{
+				group_update(layout,R,L,group,beta_fixed);
+				// The padding lanes all share L[N], keep it at the "certain zero" value.
+				L[N]=SIMD_MS_LLR_MAX;
+			}
+
+			nOnes=0;
+			for( i=0;i<P;i++)
+			{
+				Cout[i]=0;
+				for( e=check_start[i];e<check_start[i+1];e++)
+				{
+					Cout[i]^=(L[edge_variable[e]]<0);
+				}
+				nOnes+=Cout[i];
+			}
+
+			if(nOnes==0)
+			{
+				break;
+			}
+		}
+	}
+	for( i=0;i<K;i++)
+	{
+		LLRo[i]=(L[i]<0);
+	}
+	return iteration;
+
+}
+
+/* K. Zhang, X. Huang, and Z. Wang, "High-throughput layered decoder implementation for quasi-cyclic LDPC codes," IEEE Journal on Selected Areas in Communications, vol. 27, no. 6, pp. 985-994, Aug 2009.
+ * https://ieeexplore.ieee.org/document/5174521
+ */
@@ -25,17 +25,9 @@
 int decode_SPA(
 		const float LLRi[],
 		int LLRo[],
-		int* C,
-		int CWidth,
-		int CWidthMax,
-		int* V,
-		int VWidth,
-		int VWidthMax,
-		int d[],
-		int dWidth,
+		const st_ldpc_graph* graph,
 		double* R,
 		double* Q,
-		int* V_pos,
 		int N,
 		int K,
 		int P,
@@ -45,16 +37,15 @@ int decode_SPA(
 	int Cout[N_MAX];
 	int LLRbin[N_MAX];
 	int iteration=0;
-	int i,j,nOnes;
+	int i,j,e,nOnes;
 	double LLRtmp[N_MAX];
+	const int* check_start=graph->check_start;
+	const int* edge_variable=graph->edge_variable;
+	const int* variable_start=graph->variable_start;
+	const int* variable_edge=graph->variable_edge;
 
 	for( i=0;i<N;i++)
 	{
-		for(j=0;j<VWidth;j++)
-		{
-			*(R+i*VWidthMax+j)=0;
-			*(Q+i*VWidthMax+j)=0;
-		}
 		LLRbin[i]= (LLRi[i]<0);
 		LLRtmp[i]=LLRi[i];
 	}
@@ -62,109 +53,58 @@ int decode_SPA(
 	nOnes=0;
 	for (i=0;i<P;i++)
 	{
-		Cout[i]=LLRbin[*(C+i*CWidthMax+0)];
-		for( j=1;j<CWidth;j++)
+		Cout[i]=0;
+		for( e=check_start[i];e<check_start[i+1];e++)
 		{
-			if(*(C+i*CWidthMax+j)!=-1)
-			{
-				Cout[i]^= LLRbin[*(C+i*CWidthMax+j)];
-			}
+			Cout[i]^= LLRbin[edge_variable[e]];
 		}
 
 		nOnes+=Cout[i];
 	}
 	if(nOnes!=0)
 	{
-		// Precompute V matrix positions to eliminate linear search in inner loop
-		// V_pos[check * CWidthMax + col] = position of check in V[C[check][col]][]
-		// V_pos buffer is pre-allocated by cl_ldpc::load() and passed in
-		for(int ci=0;ci<P;ci++)
-		{
-			for(int cj=0;cj<CWidth;cj++)
-			{
-				int v=*(C+ci*CWidthMax+cj);
-				if(v!=-1)
-				{
-					int pos=-1;
-					for(int vk=0;vk<VWidth;vk++)
-					{
-						if(*(V+v*VWidthMax+vk)==ci)
-						{
-							pos=vk;
-							break;
-						}
-					}
-					V_pos[ci*CWidthMax+cj]=pos;
-				}
-				else
-				{
-					V_pos[ci*CWidthMax+cj]=-1;
-				}
-			}
-		}
-
-		int start=0;
-		int end=0;
-		int width=0;
-		for (int section=0;section<dWidth;section+=2)
+		for( e=0;e<graph->nEdges;e++)
 		{
-			end+=d[section];
-			width=d[section+1];
-
-			for( i=start;i<end;i++)
-			{
-				for( j=0;j<width;j++)
-				{
-					*(Q+i*VWidthMax+j)=LLRi[i];
-				}
-			}
-			start+=d[section];
+			R[e]=0;
+			Q[e]=LLRi[edge_variable[e]];
 		}
 
-		int iindex,Cindex,i1index,i1;
+		int iindex,e1;
 		double temp;
 
 		for(iteration=1;iteration<=nIteration_max;iteration++)
 		{
 			for ( iindex=0;iindex<P;iindex++)
 			{
-				for ( Cindex=0;Cindex<CWidth;Cindex++)
+				for ( e=check_start[iindex];e<check_start[iindex+1];e++)
 				{
-					j=*(C+iindex*CWidthMax+Cindex);
-					if(j!=-1)
+					temp=1;
+					for ( e1=check_start[iindex];e1<check_start[iindex+1];e1++)
 					{
-						temp=1;
-						for ( i1index=0;i1index<CWidth;i1index++)
-						{
-							i1=*(C+iindex*CWidthMax+i1index);
-							if(i1!=j && i1!=-1)
-							{
-								i=V_pos[iindex*CWidthMax+i1index];
-								temp*=tanh(0.5* (double)*(Q+i1*VWidthMax+i));
-							}
-
-						}
-						if(temp==1) // to avoid the limitation of the float/double
+						if(e1!=e)
 						{
-							temp=0.9999999;
+							temp*=tanh(0.5* Q[e1]);
 						}
-						if(temp==-1)
-						{
-							temp=-0.9999999;
-						}
-						*(R+j*VWidthMax+V_pos[iindex*CWidthMax+Cindex])=2*atanh(temp);
 
 					}
-
+					if(temp==1) // to avoid the limitation of the float/double
+					{
+						temp=0.9999999;
+					}
+					if(temp==-1)
+					{
+						temp=-0.9999999;
+					}
+					R[e]=2*atanh(temp);
 				}
 			}
 
 			for( i=0;i<N;i++)
 			{
 				LLRtmp[i]=LLRi[i];
-				for ( j=0;j<VWidth;j++)
+				for ( j=variable_start[i];j<variable_start[i+1];j++)
 				{
-					LLRtmp[i]+=*(R+i*VWidthMax+j);
+					LLRtmp[i]+=R[variable_edge[j]];
 				}
 				LLRbin[i]= (LLRtmp[i]<0);
 			}
@@ -173,13 +113,10 @@ int decode_SPA(
 			nOnes=0;
 			for( i=0;i<P;i++)
 			{
-				Cout[i]=LLRbin[*(C+i*CWidthMax+0)];
-				for( j=1;j<CWidth;j++)
+				Cout[i]=0;
+				for( e=check_start[i];e<check_start[i+1];e++)
 				{
-					if(*(C+i*CWidthMax+j)!=-1)
-					{
-						Cout[i]^=LLRbin[*(C+i*CWidthMax+j)];
-					}
+					Cout[i]^=LLRbin[edge_variable[e]];
 				}
 				nOnes+=Cout[i];
 			}
@@ -189,23 +126,9 @@ int decode_SPA(
 				break;
 			}
 
-
-			int start=0;
-			int end=0;
-			int width=0;
-			for (int section=0;section<dWidth;section+=2)
+			for( e=0;e<graph->nEdges;e++)
 			{
-				end+=d[section];
-				width=d[section+1];
-
-				for( i=start;i<end;i++)
-				{
-					for( j=0;j<width;j++)
-					{
-						*(Q+i*VWidthMax+j)=LLRtmp[i]-*(R+i*VWidthMax+j);
-					}
-				}
-				start+=d[section];
+				Q[e]=LLRtmp[edge_variable[e]]-R[e];
 			}
 		}
 	}
@@ -25,4410 +25,217 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_met_2_16.h"
-int mercury_met_Cwidth_2_16=9;
-int mercury_met_Vwidth_2_16=15;
-int mercury_met_dwidth_2_16=14;
-int mercury_met_QCmatrixd_2_16[14]={30,6,90,5,30,15,50,10,10,12,139,2,1251,1};
-int mercury_met_QCmatrixC_2_16[1400][9]={
-{13,58,89,114,134,161,197,200,-1},
-{47,87,147,200,201,-1,-1,-1,-1},
-{50,119,153,173,201,202,-1,-1,-1},
-{149,150,168,202,203,-1,-1,-1,-1},
-{203,204,209,-1,-1,-1,-1,-1,-1},
-{14,59,60,115,135,162,198,204,205},
-{48,88,148,205,206,-1,-1,-1,-1},
-{51,90,154,174,206,207,-1,-1,-1},
-{120,151,169,207,208,-1,-1,-1,-1},
-{180,208,209,-1,-1,-1,-1,-1,-1},
-{15,30,61,116,136,163,199,209,210},
-{49,89,149,210,211,-1,-1,-1,-1},
-{52,91,155,175,211,212,-1,-1,-1},
-{121,152,170,212,213,-1,-1,-1,-1},
-{181,213,214,-1,-1,-1,-1,-1,-1},
-{16,31,62,117,137,164,200,214,215},
-{50,60,120,215,216,-1,-1,-1,-1},
-{53,92,156,176,216,217,-1,-1,-1},
-{122,153,171,217,218,-1,-1,-1,-1},
-{182,218,219,-1,-1,-1,-1,-1,-1},
-{17,32,63,118,138,165,201,219,220},
-{51,61,121,220,221,-1,-1,-1,-1},
-{54,93,157,177,221,222,-1,-1,-1},
-{123,154,172,222,223,-1,-1,-1,-1},
-{183,223,224,-1,-1,-1,-1,-1,-1},
-{18,33,64,119,139,166,202,224,225},
-{52,62,122,225,226,-1,-1,-1,-1},
-{55,94,158,178,226,227,-1,-1,-1},
-{124,155,173,227,228,-1,-1,-1,-1},
-{184,228,229,-1,-1,-1,-1,-1,-1},
-{19,34,65,90,140,167,203,229,230},
-{53,63,123,230,231,-1,-1,-1,-1},
-{56,95,159,179,231,232,-1,-1,-1},
-{125,156,174,232,233,-1,-1,-1,-1},
-{185,233,234,-1,-1,-1,-1,-1,-1},
-{20,35,66,91,141,168,204,234,235},
-{54,64,124,235,236,-1,-1,-1,-1},
-{57,96,150,160,236,237,-1,-1,-1},
-{126,157,175,237,238,-1,-1,-1,-1},
-{186,238,239,-1,-1,-1,-1,-1,-1},
-{21,36,67,92,142,169,205,239,240},
-{55,65,125,240,241,-1,-1,-1,-1},
-{58,97,151,161,241,242,-1,-1,-1},
-{127,158,176,242,243,-1,-1,-1,-1},
-{187,243,244,-1,-1,-1,-1,-1,-1},
-{22,37,68,93,143,170,206,244,245},
-{56,66,126,245,246,-1,-1,-1,-1},
-{59,98,152,162,246,247,-1,-1,-1},
-{128,159,177,247,248,-1,-1,-1,-1},
-{188,248,249,-1,-1,-1,-1,-1,-1},
-{23,38,69,94,144,171,207,249,250},
-{57,67,127,250,251,-1,-1,-1,-1},
-{30,99,153,163,251,252,-1,-1,-1},
-{129,160,178,252,253,-1,-1,-1,-1},
-{189,253,254,-1,-1,-1,-1,-1,-1},
-{24,39,70,95,145,172,208,254,255},
-{58,68,128,255,256,-1,-1,-1,-1},
-{31,100,154,164,256,257,-1,-1,-1},
-{130,161,179,257,258,-1,-1,-1,-1},
-{190,258,259,-1,-1,-1,-1,-1,-1},
-{25,40,71,96,146,173,209,259,260},
-{59,69,129,260,261,-1,-1,-1,-1},
-{32,101,155,165,261,262,-1,-1,-1},
-{131,150,162,262,263,-1,-1,-1,-1},
-{191,263,264,-1,-1,-1,-1,-1,-1},
-{26,41,72,97,147,174,180,264,265},
-{30,70,130,265,266,-1,-1,-1,-1},
-{33,102,156,166,266,267,-1,-1,-1},
-{132,151,163,267,268,-1,-1,-1,-1},
-{192,268,269,-1,-1,-1,-1,-1,-1},
-{27,42,73,98,148,175,181,269,270},
-{31,71,131,270,271,-1,-1,-1,-1},
-{34,103,157,167,271,272,-1,-1,-1},
-{133,152,164,272,273,-1,-1,-1,-1},
-{193,273,274,-1,-1,-1,-1,-1,-1},
-{28,43,74,99,149,176,182,274,275},
-{32,72,132,275,276,-1,-1,-1,-1},
-{35,104,158,168,276,277,-1,-1,-1},
-{134,153,165,277,278,-1,-1,-1,-1},
-{194,278,279,-1,-1,-1,-1,-1,-1},
-{29,44,75,100,120,177,183,279,280},
-{33,73,133,280,281,-1,-1,-1,-1},
-{36,105,159,169,281,282,-1,-1,-1},
-{135,154,166,282,283,-1,-1,-1,-1},
-{195,283,284,-1,-1,-1,-1,-1,-1},
-{0,45,76,101,121,178,184,284,285},
-{34,74,134,285,286,-1,-1,-1,-1},
-{37,106,160,170,286,287,-1,-1,-1},
-{136,155,167,287,288,-1,-1,-1,-1},
-{196,288,289,-1,-1,-1,-1,-1,-1},
-{1,46,77,102,122,179,185,289,290},
-{35,75,135,290,291,-1,-1,-1,-1},
-{38,107,161,171,291,292,-1,-1,-1},
-{137,156,168,292,293,-1,-1,-1,-1},
-{197,293,294,-1,-1,-1,-1,-1,-1},
-{2,47,78,103,123,150,186,294,295},
-{36,76,136,295,296,-1,-1,-1,-1},
-{39,108,162,172,296,297,-1,-1,-1},
-{138,157,169,297,298,-1,-1,-1,-1},
-{198,298,299,-1,-1,-1,-1,-1,-1},
-{3,48,79,104,124,151,187,299,300},
-{37,77,137,300,301,-1,-1,-1,-1},
-{40,109,163,173,301,302,-1,-1,-1},
-{139,158,170,302,303,-1,-1,-1,-1},
-{199,303,304,-1,-1,-1,-1,-1,-1},
-{4,49,80,105,125,152,188,304,305},
-{38,78,138,305,306,-1,-1,-1,-1},
-{41,110,164,174,306,307,-1,-1,-1},
-{140,159,171,307,308,-1,-1,-1,-1},
-{200,308,309,-1,-1,-1,-1,-1,-1},
-{5,50,81,106,126,153,189,309,310},
-{39,79,139,310,311,-1,-1,-1,-1},
-{42,111,165,175,311,312,-1,-1,-1},
-{141,160,172,312,313,-1,-1,-1,-1},
-{201,313,314,-1,-1,-1,-1,-1,-1},
-{6,51,82,107,127,154,190,314,315},
-{40,80,140,315,316,-1,-1,-1,-1},
-{43,112,166,176,316,317,-1,-1,-1},
-{142,161,173,317,318,-1,-1,-1,-1},
-{202,318,319,-1,-1,-1,-1,-1,-1},
-{7,52,83,108,128,155,191,319,320},
-{41,81,141,320,321,-1,-1,-1,-1},
-{44,113,167,177,321,322,-1,-1,-1},
-{143,162,174,322,323,-1,-1,-1,-1},
-{203,323,324,-1,-1,-1,-1,-1,-1},
-{8,53,84,109,129,156,192,324,325},
-{42,82,142,325,326,-1,-1,-1,-1},
-{45,114,168,178,326,327,-1,-1,-1},
-{144,163,175,327,328,-1,-1,-1,-1},
-{204,328,329,-1,-1,-1,-1,-1,-1},
-{9,54,85,110,130,157,193,329,330},
-{43,83,143,330,331,-1,-1,-1,-1},
-{46,115,169,179,331,332,-1,-1,-1},
-{145,164,176,332,333,-1,-1,-1,-1},
-{205,333,334,-1,-1,-1,-1,-1,-1},
-{10,55,86,111,131,158,194,334,335},
-{44,84,144,335,336,-1,-1,-1,-1},
-{47,116,150,170,336,337,-1,-1,-1},
-{146,165,177,337,338,-1,-1,-1,-1},
-{206,338,339,-1,-1,-1,-1,-1,-1},
-{11,56,87,112,132,159,195,339,340},
-{45,85,145,340,341,-1,-1,-1,-1},
-{48,117,151,171,341,342,-1,-1,-1},
-{147,166,178,342,343,-1,-1,-1,-1},
-{207,343,344,-1,-1,-1,-1,-1,-1},
-{12,57,88,113,133,160,196,344,345},
-{46,86,146,345,346,-1,-1,-1,-1},
-{49,118,152,172,346,347,-1,-1,-1},
-{148,167,179,347,348,-1,-1,-1,-1},
-{208,348,349,-1,-1,-1,-1,-1,-1},
-{30,71,140,142,144,205,350,-1,-1},
-{152,351,-1,-1,-1,-1,-1,-1,-1},
-{352,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,-1,-1,-1,-1,-1,-1,-1,-1},
-{354,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,182,186,355,-1,-1,-1,-1,-1},
-{122,177,356,-1,-1,-1,-1,-1,-1},
-{120,357,-1,-1,-1,-1,-1,-1,-1},
-{192,200,358,-1,-1,-1,-1,-1,-1},
-{58,140,359,-1,-1,-1,-1,-1,-1},
-{148,207,360,-1,-1,-1,-1,-1,-1},
-{361,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,362,-1,-1,-1,-1,-1,-1,-1},
-{363,-1,-1,-1,-1,-1,-1,-1,-1},
-{364,-1,-1,-1,-1,-1,-1,-1,-1},
-{365,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,146,366,-1,-1,-1,-1,-1,-1},
-{11,136,157,367,-1,-1,-1,-1,-1},
-{368,-1,-1,-1,-1,-1,-1,-1,-1},
-{96,150,176,369,-1,-1,-1,-1,-1},
-{9,24,64,79,117,370,-1,-1,-1},
-{371,-1,-1,-1,-1,-1,-1,-1,-1},
-{372,-1,-1,-1,-1,-1,-1,-1,-1},
-{373,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,374,-1,-1,-1,-1,-1,-1,-1},
-{375,-1,-1,-1,-1,-1,-1,-1,-1},
-{376,-1,-1,-1,-1,-1,-1,-1,-1},
-{377,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,200,378,-1,-1,-1,-1,-1,-1},
-{379,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,72,141,143,145,181,206,380,-1},
-{153,381,-1,-1,-1,-1,-1,-1,-1},
-{382,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,383,-1,-1,-1,-1,-1,-1,-1},
-{384,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,183,187,385,-1,-1,-1,-1,-1},
-{123,178,386,-1,-1,-1,-1,-1,-1},
-{121,387,-1,-1,-1,-1,-1,-1,-1},
-{193,201,388,-1,-1,-1,-1,-1,-1},
-{59,141,389,-1,-1,-1,-1,-1,-1},
-{149,208,390,-1,-1,-1,-1,-1,-1},
-{391,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,392,-1,-1,-1,-1,-1,-1,-1},
-{393,-1,-1,-1,-1,-1,-1,-1,-1},
-{394,-1,-1,-1,-1,-1,-1,-1,-1},
-{395,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,147,396,-1,-1,-1,-1,-1,-1},
-{12,137,158,397,-1,-1,-1,-1,-1},
-{398,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,151,177,399,-1,-1,-1,-1,-1},
-{10,25,65,80,118,400,-1,-1,-1},
-{401,-1,-1,-1,-1,-1,-1,-1,-1},
-{402,-1,-1,-1,-1,-1,-1,-1,-1},
-{403,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,404,-1,-1,-1,-1,-1,-1,-1},
-{405,-1,-1,-1,-1,-1,-1,-1,-1},
-{406,-1,-1,-1,-1,-1,-1,-1,-1},
-{407,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,201,408,-1,-1,-1,-1,-1,-1},
-{409,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,73,142,144,146,182,207,410,-1},
-{154,411,-1,-1,-1,-1,-1,-1,-1},
-{412,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,413,-1,-1,-1,-1,-1,-1,-1},
-{414,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,184,188,415,-1,-1,-1,-1,-1},
-{124,179,416,-1,-1,-1,-1,-1,-1},
-{122,417,-1,-1,-1,-1,-1,-1,-1},
-{194,202,418,-1,-1,-1,-1,-1,-1},
-{30,142,419,-1,-1,-1,-1,-1,-1},
-{209,420,-1,-1,-1,-1,-1,-1,-1},
-{421,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,422,-1,-1,-1,-1,-1,-1,-1},
-{423,-1,-1,-1,-1,-1,-1,-1,-1},
-{424,-1,-1,-1,-1,-1,-1,-1,-1},
-{425,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,148,426,-1,-1,-1,-1,-1,-1},
-{13,138,159,427,-1,-1,-1,-1,-1},
-{428,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,152,178,429,-1,-1,-1,-1,-1},
-{11,26,66,81,119,430,-1,-1,-1},
-{431,-1,-1,-1,-1,-1,-1,-1,-1},
-{432,-1,-1,-1,-1,-1,-1,-1,-1},
-{433,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,434,-1,-1,-1,-1,-1,-1,-1},
-{435,-1,-1,-1,-1,-1,-1,-1,-1},
-{436,-1,-1,-1,-1,-1,-1,-1,-1},
-{437,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,202,438,-1,-1,-1,-1,-1,-1},
-{439,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,74,143,145,147,183,208,440,-1},
-{155,441,-1,-1,-1,-1,-1,-1,-1},
-{442,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,443,-1,-1,-1,-1,-1,-1,-1},
-{444,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,185,189,445,-1,-1,-1,-1,-1},
-{125,150,446,-1,-1,-1,-1,-1,-1},
-{123,447,-1,-1,-1,-1,-1,-1,-1},
-{195,203,448,-1,-1,-1,-1,-1,-1},
-{31,143,449,-1,-1,-1,-1,-1,-1},
-{121,180,450,-1,-1,-1,-1,-1,-1},
-{451,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,452,-1,-1,-1,-1,-1,-1,-1},
-{453,-1,-1,-1,-1,-1,-1,-1,-1},
-{454,-1,-1,-1,-1,-1,-1,-1,-1},
-{455,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,149,456,-1,-1,-1,-1,-1,-1},
-{14,139,160,457,-1,-1,-1,-1,-1},
-{458,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,153,179,459,-1,-1,-1,-1,-1},
-{12,27,67,82,90,460,-1,-1,-1},
-{461,-1,-1,-1,-1,-1,-1,-1,-1},
-{462,-1,-1,-1,-1,-1,-1,-1,-1},
-{463,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,464,-1,-1,-1,-1,-1,-1,-1},
-{465,-1,-1,-1,-1,-1,-1,-1,-1},
-{466,-1,-1,-1,-1,-1,-1,-1,-1},
-{467,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,203,468,-1,-1,-1,-1,-1,-1},
-{469,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,75,144,146,148,184,209,470,-1},
-{156,471,-1,-1,-1,-1,-1,-1,-1},
-{472,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,473,-1,-1,-1,-1,-1,-1,-1},
-{474,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,186,190,475,-1,-1,-1,-1,-1},
-{126,151,476,-1,-1,-1,-1,-1,-1},
-{124,477,-1,-1,-1,-1,-1,-1,-1},
-{196,204,478,-1,-1,-1,-1,-1,-1},
-{32,144,479,-1,-1,-1,-1,-1,-1},
-{122,181,480,-1,-1,-1,-1,-1,-1},
-{481,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,482,-1,-1,-1,-1,-1,-1,-1},
-{483,-1,-1,-1,-1,-1,-1,-1,-1},
-{484,-1,-1,-1,-1,-1,-1,-1,-1},
-{485,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,120,486,-1,-1,-1,-1,-1,-1},
-{15,140,161,487,-1,-1,-1,-1,-1},
-{488,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,150,154,489,-1,-1,-1,-1,-1},
-{13,28,68,83,91,490,-1,-1,-1},
-{491,-1,-1,-1,-1,-1,-1,-1,-1},
-{492,-1,-1,-1,-1,-1,-1,-1,-1},
-{493,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,494,-1,-1,-1,-1,-1,-1,-1},
-{495,-1,-1,-1,-1,-1,-1,-1,-1},
-{496,-1,-1,-1,-1,-1,-1,-1,-1},
-{497,-1,-1,-1,-1,-1,-1,-1,-1},
-{135,204,498,-1,-1,-1,-1,-1,-1},
-{499,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,76,145,147,149,185,500,-1,-1},
-{157,501,-1,-1,-1,-1,-1,-1,-1},
-{502,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,503,-1,-1,-1,-1,-1,-1,-1},
-{504,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,187,191,505,-1,-1,-1,-1,-1},
-{127,152,506,-1,-1,-1,-1,-1,-1},
-{125,507,-1,-1,-1,-1,-1,-1,-1},
-{197,205,508,-1,-1,-1,-1,-1,-1},
-{33,145,509,-1,-1,-1,-1,-1,-1},
-{123,182,510,-1,-1,-1,-1,-1,-1},
-{511,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,512,-1,-1,-1,-1,-1,-1,-1},
-{513,-1,-1,-1,-1,-1,-1,-1,-1},
-{514,-1,-1,-1,-1,-1,-1,-1,-1},
-{515,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,121,516,-1,-1,-1,-1,-1,-1},
-{16,141,162,517,-1,-1,-1,-1,-1},
-{518,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,151,155,519,-1,-1,-1,-1,-1},
-{14,29,69,84,92,520,-1,-1,-1},
-{521,-1,-1,-1,-1,-1,-1,-1,-1},
-{522,-1,-1,-1,-1,-1,-1,-1,-1},
-{523,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,524,-1,-1,-1,-1,-1,-1,-1},
-{525,-1,-1,-1,-1,-1,-1,-1,-1},
-{526,-1,-1,-1,-1,-1,-1,-1,-1},
-{527,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,205,528,-1,-1,-1,-1,-1,-1},
-{529,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,77,146,148,181,186,530,-1,-1},
-{158,531,-1,-1,-1,-1,-1,-1,-1},
-{532,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,533,-1,-1,-1,-1,-1,-1,-1},
-{534,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,188,192,535,-1,-1,-1,-1,-1},
-{128,153,536,-1,-1,-1,-1,-1,-1},
-{126,537,-1,-1,-1,-1,-1,-1,-1},
-{198,206,538,-1,-1,-1,-1,-1,-1},
-{34,146,539,-1,-1,-1,-1,-1,-1},
-{124,183,540,-1,-1,-1,-1,-1,-1},
-{541,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,542,-1,-1,-1,-1,-1,-1,-1},
-{543,-1,-1,-1,-1,-1,-1,-1,-1},
-{544,-1,-1,-1,-1,-1,-1,-1,-1},
-{545,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,122,546,-1,-1,-1,-1,-1,-1},
-{17,142,163,547,-1,-1,-1,-1,-1},
-{548,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,152,156,549,-1,-1,-1,-1,-1},
-{15,70,85,93,550,-1,-1,-1,-1},
-{551,-1,-1,-1,-1,-1,-1,-1,-1},
-{552,-1,-1,-1,-1,-1,-1,-1,-1},
-{553,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,554,-1,-1,-1,-1,-1,-1,-1},
-{555,-1,-1,-1,-1,-1,-1,-1,-1},
-{556,-1,-1,-1,-1,-1,-1,-1,-1},
-{557,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,206,558,-1,-1,-1,-1,-1,-1},
-{559,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,78,121,147,149,182,187,560,-1},
-{159,561,-1,-1,-1,-1,-1,-1,-1},
-{562,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,563,-1,-1,-1,-1,-1,-1,-1},
-{564,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,189,193,565,-1,-1,-1,-1,-1},
-{129,154,566,-1,-1,-1,-1,-1,-1},
-{127,567,-1,-1,-1,-1,-1,-1,-1},
-{199,207,568,-1,-1,-1,-1,-1,-1},
-{35,147,569,-1,-1,-1,-1,-1,-1},
-{125,184,570,-1,-1,-1,-1,-1,-1},
-{571,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,572,-1,-1,-1,-1,-1,-1,-1},
-{573,-1,-1,-1,-1,-1,-1,-1,-1},
-{574,-1,-1,-1,-1,-1,-1,-1,-1},
-{575,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,123,576,-1,-1,-1,-1,-1,-1},
-{18,143,164,577,-1,-1,-1,-1,-1},
-{578,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,153,157,579,-1,-1,-1,-1,-1},
-{1,16,71,86,94,580,-1,-1,-1},
-{581,-1,-1,-1,-1,-1,-1,-1,-1},
-{582,-1,-1,-1,-1,-1,-1,-1,-1},
-{583,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,584,-1,-1,-1,-1,-1,-1,-1},
-{585,-1,-1,-1,-1,-1,-1,-1,-1},
-{586,-1,-1,-1,-1,-1,-1,-1,-1},
-{587,-1,-1,-1,-1,-1,-1,-1,-1},
-{138,207,588,-1,-1,-1,-1,-1,-1},
-{589,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,79,120,122,148,183,188,590,-1},
-{160,591,-1,-1,-1,-1,-1,-1,-1},
-{592,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,593,-1,-1,-1,-1,-1,-1,-1},
-{594,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,190,194,595,-1,-1,-1,-1,-1},
-{130,155,596,-1,-1,-1,-1,-1,-1},
-{128,597,-1,-1,-1,-1,-1,-1,-1},
-{200,208,598,-1,-1,-1,-1,-1,-1},
-{36,148,599,-1,-1,-1,-1,-1,-1},
-{126,185,600,-1,-1,-1,-1,-1,-1},
-{601,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,602,-1,-1,-1,-1,-1,-1,-1},
-{603,-1,-1,-1,-1,-1,-1,-1,-1},
-{604,-1,-1,-1,-1,-1,-1,-1,-1},
-{605,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,124,606,-1,-1,-1,-1,-1,-1},
-{19,144,165,607,-1,-1,-1,-1,-1},
-{608,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,154,158,609,-1,-1,-1,-1,-1},
-{2,17,72,87,95,610,-1,-1,-1},
-{611,-1,-1,-1,-1,-1,-1,-1,-1},
-{612,-1,-1,-1,-1,-1,-1,-1,-1},
-{613,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,614,-1,-1,-1,-1,-1,-1,-1},
-{615,-1,-1,-1,-1,-1,-1,-1,-1},
-{616,-1,-1,-1,-1,-1,-1,-1,-1},
-{617,-1,-1,-1,-1,-1,-1,-1,-1},
-{139,208,618,-1,-1,-1,-1,-1,-1},
-{619,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,80,121,123,149,184,189,620,-1},
-{161,621,-1,-1,-1,-1,-1,-1,-1},
-{622,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,623,-1,-1,-1,-1,-1,-1,-1},
-{624,-1,-1,-1,-1,-1,-1,-1,-1},
-{135,191,195,625,-1,-1,-1,-1,-1},
-{131,156,626,-1,-1,-1,-1,-1,-1},
-{129,627,-1,-1,-1,-1,-1,-1,-1},
-{201,209,628,-1,-1,-1,-1,-1,-1},
-{37,149,629,-1,-1,-1,-1,-1,-1},
-{127,186,630,-1,-1,-1,-1,-1,-1},
-{631,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,632,-1,-1,-1,-1,-1,-1,-1},
-{633,-1,-1,-1,-1,-1,-1,-1,-1},
-{634,-1,-1,-1,-1,-1,-1,-1,-1},
-{635,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,125,636,-1,-1,-1,-1,-1,-1},
-{20,145,166,637,-1,-1,-1,-1,-1},
-{638,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,155,159,639,-1,-1,-1,-1,-1},
-{3,18,73,88,96,640,-1,-1,-1},
-{641,-1,-1,-1,-1,-1,-1,-1,-1},
-{642,-1,-1,-1,-1,-1,-1,-1,-1},
-{643,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,644,-1,-1,-1,-1,-1,-1,-1},
-{645,-1,-1,-1,-1,-1,-1,-1,-1},
-{646,-1,-1,-1,-1,-1,-1,-1,-1},
-{647,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,209,648,-1,-1,-1,-1,-1,-1},
-{649,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,81,122,124,185,190,650,-1,-1},
-{162,651,-1,-1,-1,-1,-1,-1,-1},
-{652,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,653,-1,-1,-1,-1,-1,-1,-1},
-{654,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,192,196,655,-1,-1,-1,-1,-1},
-{132,157,656,-1,-1,-1,-1,-1,-1},
-{130,657,-1,-1,-1,-1,-1,-1,-1},
-{202,658,-1,-1,-1,-1,-1,-1,-1},
-{38,659,-1,-1,-1,-1,-1,-1,-1},
-{128,187,660,-1,-1,-1,-1,-1,-1},
-{661,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,662,-1,-1,-1,-1,-1,-1,-1},
-{663,-1,-1,-1,-1,-1,-1,-1,-1},
-{664,-1,-1,-1,-1,-1,-1,-1,-1},
-{665,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,126,666,-1,-1,-1,-1,-1,-1},
-{21,146,167,667,-1,-1,-1,-1,-1},
-{668,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,156,160,669,-1,-1,-1,-1,-1},
-{4,19,74,89,97,670,-1,-1,-1},
-{671,-1,-1,-1,-1,-1,-1,-1,-1},
-{672,-1,-1,-1,-1,-1,-1,-1,-1},
-{673,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,674,-1,-1,-1,-1,-1,-1,-1},
-{675,-1,-1,-1,-1,-1,-1,-1,-1},
-{676,-1,-1,-1,-1,-1,-1,-1,-1},
-{677,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,180,678,-1,-1,-1,-1,-1,-1},
-{679,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,82,121,123,125,186,191,680,-1},
-{163,681,-1,-1,-1,-1,-1,-1,-1},
-{682,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,683,-1,-1,-1,-1,-1,-1,-1},
-{684,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,193,197,685,-1,-1,-1,-1,-1},
-{133,158,686,-1,-1,-1,-1,-1,-1},
-{131,687,-1,-1,-1,-1,-1,-1,-1},
-{181,203,688,-1,-1,-1,-1,-1,-1},
-{39,121,689,-1,-1,-1,-1,-1,-1},
-{129,188,690,-1,-1,-1,-1,-1,-1},
-{691,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,692,-1,-1,-1,-1,-1,-1,-1},
-{693,-1,-1,-1,-1,-1,-1,-1,-1},
-{694,-1,-1,-1,-1,-1,-1,-1,-1},
-{695,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,127,696,-1,-1,-1,-1,-1,-1},
-{22,147,168,697,-1,-1,-1,-1,-1},
-{698,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,157,161,699,-1,-1,-1,-1,-1},
-{5,20,60,75,98,700,-1,-1,-1},
-{701,-1,-1,-1,-1,-1,-1,-1,-1},
-{702,-1,-1,-1,-1,-1,-1,-1,-1},
-{703,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,704,-1,-1,-1,-1,-1,-1,-1},
-{705,-1,-1,-1,-1,-1,-1,-1,-1},
-{706,-1,-1,-1,-1,-1,-1,-1,-1},
-{707,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,181,708,-1,-1,-1,-1,-1,-1},
-{709,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,83,122,124,126,187,192,710,-1},
-{164,711,-1,-1,-1,-1,-1,-1,-1},
-{712,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,713,-1,-1,-1,-1,-1,-1,-1},
-{714,-1,-1,-1,-1,-1,-1,-1,-1},
-{138,194,198,715,-1,-1,-1,-1,-1},
-{134,159,716,-1,-1,-1,-1,-1,-1},
-{132,717,-1,-1,-1,-1,-1,-1,-1},
-{182,204,718,-1,-1,-1,-1,-1,-1},
-{40,122,719,-1,-1,-1,-1,-1,-1},
-{130,189,720,-1,-1,-1,-1,-1,-1},
-{721,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,722,-1,-1,-1,-1,-1,-1,-1},
-{723,-1,-1,-1,-1,-1,-1,-1,-1},
-{724,-1,-1,-1,-1,-1,-1,-1,-1},
-{725,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,128,726,-1,-1,-1,-1,-1,-1},
-{23,148,169,727,-1,-1,-1,-1,-1},
-{728,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,158,162,729,-1,-1,-1,-1,-1},
-{6,21,61,76,99,730,-1,-1,-1},
-{731,-1,-1,-1,-1,-1,-1,-1,-1},
-{732,-1,-1,-1,-1,-1,-1,-1,-1},
-{733,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,734,-1,-1,-1,-1,-1,-1,-1},
-{735,-1,-1,-1,-1,-1,-1,-1,-1},
-{736,-1,-1,-1,-1,-1,-1,-1,-1},
-{737,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,182,738,-1,-1,-1,-1,-1,-1},
-{739,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,84,123,125,127,188,193,740,-1},
-{165,741,-1,-1,-1,-1,-1,-1,-1},
-{742,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,743,-1,-1,-1,-1,-1,-1,-1},
-{744,-1,-1,-1,-1,-1,-1,-1,-1},
-{139,195,199,745,-1,-1,-1,-1,-1},
-{135,160,746,-1,-1,-1,-1,-1,-1},
-{133,747,-1,-1,-1,-1,-1,-1,-1},
-{183,205,748,-1,-1,-1,-1,-1,-1},
-{41,123,749,-1,-1,-1,-1,-1,-1},
-{131,190,750,-1,-1,-1,-1,-1,-1},
-{751,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,752,-1,-1,-1,-1,-1,-1,-1},
-{753,-1,-1,-1,-1,-1,-1,-1,-1},
-{754,-1,-1,-1,-1,-1,-1,-1,-1},
-{755,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,129,756,-1,-1,-1,-1,-1,-1},
-{24,149,170,757,-1,-1,-1,-1,-1},
-{758,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,159,163,759,-1,-1,-1,-1,-1},
-{7,22,62,77,100,760,-1,-1,-1},
-{761,-1,-1,-1,-1,-1,-1,-1,-1},
-{762,-1,-1,-1,-1,-1,-1,-1,-1},
-{763,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,764,-1,-1,-1,-1,-1,-1,-1},
-{765,-1,-1,-1,-1,-1,-1,-1,-1},
-{766,-1,-1,-1,-1,-1,-1,-1,-1},
-{767,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,183,768,-1,-1,-1,-1,-1,-1},
-{769,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,85,124,126,128,189,194,770,-1},
-{166,771,-1,-1,-1,-1,-1,-1,-1},
-{772,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,773,-1,-1,-1,-1,-1,-1,-1},
-{774,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,196,200,775,-1,-1,-1,-1,-1},
-{136,161,776,-1,-1,-1,-1,-1,-1},
-{134,777,-1,-1,-1,-1,-1,-1,-1},
-{184,206,778,-1,-1,-1,-1,-1,-1},
-{42,124,779,-1,-1,-1,-1,-1,-1},
-{132,191,780,-1,-1,-1,-1,-1,-1},
-{781,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,782,-1,-1,-1,-1,-1,-1,-1},
-{783,-1,-1,-1,-1,-1,-1,-1,-1},
-{784,-1,-1,-1,-1,-1,-1,-1,-1},
-{785,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,130,786,-1,-1,-1,-1,-1,-1},
-{25,120,171,787,-1,-1,-1,-1,-1},
-{788,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,160,164,789,-1,-1,-1,-1,-1},
-{8,23,63,78,101,790,-1,-1,-1},
-{791,-1,-1,-1,-1,-1,-1,-1,-1},
-{792,-1,-1,-1,-1,-1,-1,-1,-1},
-{793,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,794,-1,-1,-1,-1,-1,-1,-1},
-{795,-1,-1,-1,-1,-1,-1,-1,-1},
-{796,-1,-1,-1,-1,-1,-1,-1,-1},
-{797,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,184,798,-1,-1,-1,-1,-1,-1},
-{799,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,86,125,127,129,190,195,800,-1},
-{167,801,-1,-1,-1,-1,-1,-1,-1},
-{802,-1,-1,-1,-1,-1,-1,-1,-1},
-{135,803,-1,-1,-1,-1,-1,-1,-1},
-{804,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,197,201,805,-1,-1,-1,-1,-1},
-{137,162,806,-1,-1,-1,-1,-1,-1},
-{135,807,-1,-1,-1,-1,-1,-1,-1},
-{185,207,808,-1,-1,-1,-1,-1,-1},
-{43,125,809,-1,-1,-1,-1,-1,-1},
-{133,192,810,-1,-1,-1,-1,-1,-1},
-{811,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,812,-1,-1,-1,-1,-1,-1,-1},
-{813,-1,-1,-1,-1,-1,-1,-1,-1},
-{814,-1,-1,-1,-1,-1,-1,-1,-1},
-{815,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,131,816,-1,-1,-1,-1,-1,-1},
-{26,121,172,817,-1,-1,-1,-1,-1},
-{818,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,161,165,819,-1,-1,-1,-1,-1},
-{9,24,64,79,102,820,-1,-1,-1},
-{821,-1,-1,-1,-1,-1,-1,-1,-1},
-{822,-1,-1,-1,-1,-1,-1,-1,-1},
-{823,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,824,-1,-1,-1,-1,-1,-1,-1},
-{825,-1,-1,-1,-1,-1,-1,-1,-1},
-{826,-1,-1,-1,-1,-1,-1,-1,-1},
-{827,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,185,828,-1,-1,-1,-1,-1,-1},
-{829,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,87,126,128,130,191,196,830,-1},
-{168,831,-1,-1,-1,-1,-1,-1,-1},
-{832,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,833,-1,-1,-1,-1,-1,-1,-1},
-{834,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,198,202,835,-1,-1,-1,-1,-1},
-{138,163,836,-1,-1,-1,-1,-1,-1},
-{136,837,-1,-1,-1,-1,-1,-1,-1},
-{186,208,838,-1,-1,-1,-1,-1,-1},
-{44,126,839,-1,-1,-1,-1,-1,-1},
-{134,193,840,-1,-1,-1,-1,-1,-1},
-{841,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,842,-1,-1,-1,-1,-1,-1,-1},
-{843,-1,-1,-1,-1,-1,-1,-1,-1},
-{844,-1,-1,-1,-1,-1,-1,-1,-1},
-{845,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,132,846,-1,-1,-1,-1,-1,-1},
-{27,122,173,847,-1,-1,-1,-1,-1},
-{848,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,162,166,849,-1,-1,-1,-1,-1},
-{10,25,65,80,103,850,-1,-1,-1},
-{851,-1,-1,-1,-1,-1,-1,-1,-1},
-{852,-1,-1,-1,-1,-1,-1,-1,-1},
-{853,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,854,-1,-1,-1,-1,-1,-1,-1},
-{855,-1,-1,-1,-1,-1,-1,-1,-1},
-{856,-1,-1,-1,-1,-1,-1,-1,-1},
-{857,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,186,858,-1,-1,-1,-1,-1,-1},
-{859,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,88,127,129,131,192,197,860,-1},
-{169,861,-1,-1,-1,-1,-1,-1,-1},
-{862,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,863,-1,-1,-1,-1,-1,-1,-1},
-{864,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,199,203,865,-1,-1,-1,-1,-1},
-{139,164,866,-1,-1,-1,-1,-1,-1},
-{137,867,-1,-1,-1,-1,-1,-1,-1},
-{187,209,868,-1,-1,-1,-1,-1,-1},
-{45,127,869,-1,-1,-1,-1,-1,-1},
-{135,194,870,-1,-1,-1,-1,-1,-1},
-{871,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,872,-1,-1,-1,-1,-1,-1,-1},
-{873,-1,-1,-1,-1,-1,-1,-1,-1},
-{874,-1,-1,-1,-1,-1,-1,-1,-1},
-{875,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,133,876,-1,-1,-1,-1,-1,-1},
-{28,123,174,877,-1,-1,-1,-1,-1},
-{878,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,163,167,879,-1,-1,-1,-1,-1},
-{11,26,66,81,104,880,-1,-1,-1},
-{881,-1,-1,-1,-1,-1,-1,-1,-1},
-{882,-1,-1,-1,-1,-1,-1,-1,-1},
-{883,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,884,-1,-1,-1,-1,-1,-1,-1},
-{885,-1,-1,-1,-1,-1,-1,-1,-1},
-{886,-1,-1,-1,-1,-1,-1,-1,-1},
-{887,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,187,888,-1,-1,-1,-1,-1,-1},
-{889,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,89,128,130,132,193,198,890,-1},
-{170,891,-1,-1,-1,-1,-1,-1,-1},
-{892,-1,-1,-1,-1,-1,-1,-1,-1},
-{138,893,-1,-1,-1,-1,-1,-1,-1},
-{894,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,200,204,895,-1,-1,-1,-1,-1},
-{140,165,896,-1,-1,-1,-1,-1,-1},
-{138,897,-1,-1,-1,-1,-1,-1,-1},
-{180,188,898,-1,-1,-1,-1,-1,-1},
-{46,128,899,-1,-1,-1,-1,-1,-1},
-{136,195,900,-1,-1,-1,-1,-1,-1},
-{901,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,902,-1,-1,-1,-1,-1,-1,-1},
-{903,-1,-1,-1,-1,-1,-1,-1,-1},
-{904,-1,-1,-1,-1,-1,-1,-1,-1},
-{905,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,134,906,-1,-1,-1,-1,-1,-1},
-{29,124,175,907,-1,-1,-1,-1,-1},
-{908,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,164,168,909,-1,-1,-1,-1,-1},
-{12,27,67,82,105,910,-1,-1,-1},
-{911,-1,-1,-1,-1,-1,-1,-1,-1},
-{912,-1,-1,-1,-1,-1,-1,-1,-1},
-{913,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,914,-1,-1,-1,-1,-1,-1,-1},
-{915,-1,-1,-1,-1,-1,-1,-1,-1},
-{916,-1,-1,-1,-1,-1,-1,-1,-1},
-{917,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,188,918,-1,-1,-1,-1,-1,-1},
-{919,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,60,129,131,133,194,199,920,-1},
-{171,921,-1,-1,-1,-1,-1,-1,-1},
-{922,-1,-1,-1,-1,-1,-1,-1,-1},
-{139,923,-1,-1,-1,-1,-1,-1,-1},
-{924,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,201,205,925,-1,-1,-1,-1,-1},
-{141,166,926,-1,-1,-1,-1,-1,-1},
-{139,927,-1,-1,-1,-1,-1,-1,-1},
-{181,189,928,-1,-1,-1,-1,-1,-1},
-{47,129,929,-1,-1,-1,-1,-1,-1},
-{137,196,930,-1,-1,-1,-1,-1,-1},
-{931,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,932,-1,-1,-1,-1,-1,-1,-1},
-{933,-1,-1,-1,-1,-1,-1,-1,-1},
-{934,-1,-1,-1,-1,-1,-1,-1,-1},
-{935,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,135,936,-1,-1,-1,-1,-1,-1},
-{0,125,176,937,-1,-1,-1,-1,-1},
-{938,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,165,169,939,-1,-1,-1,-1,-1},
-{13,28,68,83,106,940,-1,-1,-1},
-{941,-1,-1,-1,-1,-1,-1,-1,-1},
-{942,-1,-1,-1,-1,-1,-1,-1,-1},
-{943,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,944,-1,-1,-1,-1,-1,-1,-1},
-{945,-1,-1,-1,-1,-1,-1,-1,-1},
-{946,-1,-1,-1,-1,-1,-1,-1,-1},
-{947,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,189,948,-1,-1,-1,-1,-1,-1},
-{949,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,61,130,132,134,195,200,950,-1},
-{172,951,-1,-1,-1,-1,-1,-1,-1},
-{952,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,953,-1,-1,-1,-1,-1,-1,-1},
-{954,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,202,206,955,-1,-1,-1,-1,-1},
-{142,167,956,-1,-1,-1,-1,-1,-1},
-{140,957,-1,-1,-1,-1,-1,-1,-1},
-{182,190,958,-1,-1,-1,-1,-1,-1},
-{48,130,959,-1,-1,-1,-1,-1,-1},
-{138,197,960,-1,-1,-1,-1,-1,-1},
-{961,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,962,-1,-1,-1,-1,-1,-1,-1},
-{963,-1,-1,-1,-1,-1,-1,-1,-1},
-{964,-1,-1,-1,-1,-1,-1,-1,-1},
-{965,-1,-1,-1,-1,-1,-1,-1,-1},
-{96,136,966,-1,-1,-1,-1,-1,-1},
-{1,126,177,967,-1,-1,-1,-1,-1},
-{968,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,166,170,969,-1,-1,-1,-1,-1},
-{14,29,69,84,107,970,-1,-1,-1},
-{971,-1,-1,-1,-1,-1,-1,-1,-1},
-{972,-1,-1,-1,-1,-1,-1,-1,-1},
-{973,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,974,-1,-1,-1,-1,-1,-1,-1},
-{975,-1,-1,-1,-1,-1,-1,-1,-1},
-{976,-1,-1,-1,-1,-1,-1,-1,-1},
-{977,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,190,978,-1,-1,-1,-1,-1,-1},
-{979,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,62,131,133,135,196,201,980,-1},
-{173,981,-1,-1,-1,-1,-1,-1,-1},
-{982,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,983,-1,-1,-1,-1,-1,-1,-1},
-{984,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,203,207,985,-1,-1,-1,-1,-1},
-{143,168,986,-1,-1,-1,-1,-1,-1},
-{141,987,-1,-1,-1,-1,-1,-1,-1},
-{183,191,988,-1,-1,-1,-1,-1,-1},
-{49,131,989,-1,-1,-1,-1,-1,-1},
-{139,198,990,-1,-1,-1,-1,-1,-1},
-{991,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,992,-1,-1,-1,-1,-1,-1,-1},
-{993,-1,-1,-1,-1,-1,-1,-1,-1},
-{994,-1,-1,-1,-1,-1,-1,-1,-1},
-{995,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,137,996,-1,-1,-1,-1,-1,-1},
-{2,127,178,997,-1,-1,-1,-1,-1},
-{998,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,167,171,999,-1,-1,-1,-1,-1},
-{0,15,70,85,108,1000,-1,-1,-1},
-{1001,-1,-1,-1,-1,-1,-1,-1,-1},
-{1002,-1,-1,-1,-1,-1,-1,-1,-1},
-{1003,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,1004,-1,-1,-1,-1,-1,-1,-1},
-{1005,-1,-1,-1,-1,-1,-1,-1,-1},
-{1006,-1,-1,-1,-1,-1,-1,-1,-1},
-{1007,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,191,1008,-1,-1,-1,-1,-1,-1},
-{1009,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,63,132,134,136,197,202,1010,-1},
-{174,1011,-1,-1,-1,-1,-1,-1,-1},
-{1012,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,1013,-1,-1,-1,-1,-1,-1,-1},
-{1014,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,204,208,1015,-1,-1,-1,-1,-1},
-{144,169,1016,-1,-1,-1,-1,-1,-1},
-{142,1017,-1,-1,-1,-1,-1,-1,-1},
-{184,192,1018,-1,-1,-1,-1,-1,-1},
-{50,132,1019,-1,-1,-1,-1,-1,-1},
-{140,199,1020,-1,-1,-1,-1,-1,-1},
-{1021,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,1022,-1,-1,-1,-1,-1,-1,-1},
-{1023,-1,-1,-1,-1,-1,-1,-1,-1},
-{1024,-1,-1,-1,-1,-1,-1,-1,-1},
-{1025,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,138,1026,-1,-1,-1,-1,-1,-1},
-{3,128,179,1027,-1,-1,-1,-1,-1},
-{1028,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,168,172,1029,-1,-1,-1,-1,-1},
-{1,16,71,86,109,1030,-1,-1,-1},
-{1031,-1,-1,-1,-1,-1,-1,-1,-1},
-{1032,-1,-1,-1,-1,-1,-1,-1,-1},
-{1033,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,1034,-1,-1,-1,-1,-1,-1,-1},
-{1035,-1,-1,-1,-1,-1,-1,-1,-1},
-{1036,-1,-1,-1,-1,-1,-1,-1,-1},
-{1037,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,192,1038,-1,-1,-1,-1,-1,-1},
-{1039,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,64,133,135,137,198,203,1040,-1},
-{175,1041,-1,-1,-1,-1,-1,-1,-1},
-{1042,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,1043,-1,-1,-1,-1,-1,-1,-1},
-{1044,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,205,209,1045,-1,-1,-1,-1,-1},
-{145,170,1046,-1,-1,-1,-1,-1,-1},
-{143,1047,-1,-1,-1,-1,-1,-1,-1},
-{185,193,1048,-1,-1,-1,-1,-1,-1},
-{51,133,1049,-1,-1,-1,-1,-1,-1},
-{141,200,1050,-1,-1,-1,-1,-1,-1},
-{1051,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,1052,-1,-1,-1,-1,-1,-1,-1},
-{1053,-1,-1,-1,-1,-1,-1,-1,-1},
-{1054,-1,-1,-1,-1,-1,-1,-1,-1},
-{1055,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,139,1056,-1,-1,-1,-1,-1,-1},
-{4,129,150,1057,-1,-1,-1,-1,-1},
-{1058,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,169,173,1059,-1,-1,-1,-1,-1},
-{2,17,72,87,110,1060,-1,-1,-1},
-{1061,-1,-1,-1,-1,-1,-1,-1,-1},
-{1062,-1,-1,-1,-1,-1,-1,-1,-1},
-{1063,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,1064,-1,-1,-1,-1,-1,-1,-1},
-{1065,-1,-1,-1,-1,-1,-1,-1,-1},
-{1066,-1,-1,-1,-1,-1,-1,-1,-1},
-{1067,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,193,1068,-1,-1,-1,-1,-1,-1},
-{1069,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,65,134,136,138,199,204,1070,-1},
-{176,1071,-1,-1,-1,-1,-1,-1,-1},
-{1072,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,1073,-1,-1,-1,-1,-1,-1,-1},
-{1074,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,180,206,1075,-1,-1,-1,-1,-1},
-{146,171,1076,-1,-1,-1,-1,-1,-1},
-{144,1077,-1,-1,-1,-1,-1,-1,-1},
-{186,194,1078,-1,-1,-1,-1,-1,-1},
-{52,134,1079,-1,-1,-1,-1,-1,-1},
-{142,201,1080,-1,-1,-1,-1,-1,-1},
-{1081,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,1082,-1,-1,-1,-1,-1,-1,-1},
-{1083,-1,-1,-1,-1,-1,-1,-1,-1},
-{1084,-1,-1,-1,-1,-1,-1,-1,-1},
-{1085,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,140,1086,-1,-1,-1,-1,-1,-1},
-{5,130,151,1087,-1,-1,-1,-1,-1},
-{1088,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,170,174,1089,-1,-1,-1,-1,-1},
-{3,18,73,88,111,1090,-1,-1,-1},
-{1091,-1,-1,-1,-1,-1,-1,-1,-1},
-{1092,-1,-1,-1,-1,-1,-1,-1,-1},
-{1093,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,1094,-1,-1,-1,-1,-1,-1,-1},
-{1095,-1,-1,-1,-1,-1,-1,-1,-1},
-{1096,-1,-1,-1,-1,-1,-1,-1,-1},
-{1097,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,194,1098,-1,-1,-1,-1,-1,-1},
-{1099,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,66,135,137,139,200,205,1100,-1},
-{177,1101,-1,-1,-1,-1,-1,-1,-1},
-{1102,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,1103,-1,-1,-1,-1,-1,-1,-1},
-{1104,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,181,207,1105,-1,-1,-1,-1,-1},
-{147,172,1106,-1,-1,-1,-1,-1,-1},
-{145,1107,-1,-1,-1,-1,-1,-1,-1},
-{187,195,1108,-1,-1,-1,-1,-1,-1},
-{53,135,1109,-1,-1,-1,-1,-1,-1},
-{143,202,1110,-1,-1,-1,-1,-1,-1},
-{1111,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,1112,-1,-1,-1,-1,-1,-1,-1},
-{1113,-1,-1,-1,-1,-1,-1,-1,-1},
-{1114,-1,-1,-1,-1,-1,-1,-1,-1},
-{1115,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,141,1116,-1,-1,-1,-1,-1,-1},
-{6,131,152,1117,-1,-1,-1,-1,-1},
-{1118,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,171,175,1119,-1,-1,-1,-1,-1},
-{4,19,74,89,112,1120,-1,-1,-1},
-{1121,-1,-1,-1,-1,-1,-1,-1,-1},
-{1122,-1,-1,-1,-1,-1,-1,-1,-1},
-{1123,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,1124,-1,-1,-1,-1,-1,-1,-1},
-{1125,-1,-1,-1,-1,-1,-1,-1,-1},
-{1126,-1,-1,-1,-1,-1,-1,-1,-1},
-{1127,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,195,1128,-1,-1,-1,-1,-1,-1},
-{1129,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,67,136,138,140,201,206,1130,-1},
-{178,1131,-1,-1,-1,-1,-1,-1,-1},
-{1132,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,1133,-1,-1,-1,-1,-1,-1,-1},
-{1134,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,182,208,1135,-1,-1,-1,-1,-1},
-{148,173,1136,-1,-1,-1,-1,-1,-1},
-{146,1137,-1,-1,-1,-1,-1,-1,-1},
-{188,196,1138,-1,-1,-1,-1,-1,-1},
-{54,136,1139,-1,-1,-1,-1,-1,-1},
-{144,203,1140,-1,-1,-1,-1,-1,-1},
-{1141,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,1142,-1,-1,-1,-1,-1,-1,-1},
-{1143,-1,-1,-1,-1,-1,-1,-1,-1},
-{1144,-1,-1,-1,-1,-1,-1,-1,-1},
-{1145,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,142,1146,-1,-1,-1,-1,-1,-1},
-{7,132,153,1147,-1,-1,-1,-1,-1},
-{1148,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,172,176,1149,-1,-1,-1,-1,-1},
-{5,20,60,75,113,1150,-1,-1,-1},
-{1151,-1,-1,-1,-1,-1,-1,-1,-1},
-{1152,-1,-1,-1,-1,-1,-1,-1,-1},
-{1153,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,1154,-1,-1,-1,-1,-1,-1,-1},
-{1155,-1,-1,-1,-1,-1,-1,-1,-1},
-{1156,-1,-1,-1,-1,-1,-1,-1,-1},
-{1157,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,196,1158,-1,-1,-1,-1,-1,-1},
-{1159,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,68,137,139,141,202,207,1160,-1},
-{179,1161,-1,-1,-1,-1,-1,-1,-1},
-{1162,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,1163,-1,-1,-1,-1,-1,-1,-1},
-{1164,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,183,209,1165,-1,-1,-1,-1,-1},
-{149,174,1166,-1,-1,-1,-1,-1,-1},
-{147,1167,-1,-1,-1,-1,-1,-1,-1},
-{189,197,1168,-1,-1,-1,-1,-1,-1},
-{55,137,1169,-1,-1,-1,-1,-1,-1},
-{145,204,1170,-1,-1,-1,-1,-1,-1},
-{1171,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,1172,-1,-1,-1,-1,-1,-1,-1},
-{1173,-1,-1,-1,-1,-1,-1,-1,-1},
-{1174,-1,-1,-1,-1,-1,-1,-1,-1},
-{1175,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,143,1176,-1,-1,-1,-1,-1,-1},
-{8,133,154,1177,-1,-1,-1,-1,-1},
-{1178,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,173,177,1179,-1,-1,-1,-1,-1},
-{6,21,61,76,114,1180,-1,-1,-1},
-{1181,-1,-1,-1,-1,-1,-1,-1,-1},
-{1182,-1,-1,-1,-1,-1,-1,-1,-1},
-{1183,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,1184,-1,-1,-1,-1,-1,-1,-1},
-{1185,-1,-1,-1,-1,-1,-1,-1,-1},
-{1186,-1,-1,-1,-1,-1,-1,-1,-1},
-{1187,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,197,1188,-1,-1,-1,-1,-1,-1},
-{1189,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,69,138,140,142,203,208,1190,-1},
-{150,1191,-1,-1,-1,-1,-1,-1,-1},
-{1192,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,1193,-1,-1,-1,-1,-1,-1,-1},
-{1194,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,180,184,1195,-1,-1,-1,-1,-1},
-{120,175,1196,-1,-1,-1,-1,-1,-1},
-{148,1197,-1,-1,-1,-1,-1,-1,-1},
-{190,198,1198,-1,-1,-1,-1,-1,-1},
-{56,138,1199,-1,-1,-1,-1,-1,-1},
-{146,205,1200,-1,-1,-1,-1,-1,-1},
-{1201,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,1202,-1,-1,-1,-1,-1,-1,-1},
-{1203,-1,-1,-1,-1,-1,-1,-1,-1},
-{1204,-1,-1,-1,-1,-1,-1,-1,-1},
-{1205,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,144,1206,-1,-1,-1,-1,-1,-1},
-{9,134,155,1207,-1,-1,-1,-1,-1},
-{1208,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,174,178,1209,-1,-1,-1,-1,-1},
-{7,22,62,77,115,1210,-1,-1,-1},
-{1211,-1,-1,-1,-1,-1,-1,-1,-1},
-{1212,-1,-1,-1,-1,-1,-1,-1,-1},
-{1213,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,1214,-1,-1,-1,-1,-1,-1,-1},
-{1215,-1,-1,-1,-1,-1,-1,-1,-1},
-{1216,-1,-1,-1,-1,-1,-1,-1,-1},
-{1217,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,198,1218,-1,-1,-1,-1,-1,-1},
-{1219,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,70,139,141,143,204,209,1220,-1},
-{151,1221,-1,-1,-1,-1,-1,-1,-1},
-{1222,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,1223,-1,-1,-1,-1,-1,-1,-1},
-{1224,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,181,185,1225,-1,-1,-1,-1,-1},
-{121,176,1226,-1,-1,-1,-1,-1,-1},
-{149,1227,-1,-1,-1,-1,-1,-1,-1},
-{191,199,1228,-1,-1,-1,-1,-1,-1},
-{57,139,1229,-1,-1,-1,-1,-1,-1},
-{147,206,1230,-1,-1,-1,-1,-1,-1},
-{1231,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,1232,-1,-1,-1,-1,-1,-1,-1},
-{1233,-1,-1,-1,-1,-1,-1,-1,-1},
-{1234,-1,-1,-1,-1,-1,-1,-1,-1},
-{1235,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,145,1236,-1,-1,-1,-1,-1,-1},
-{10,135,156,1237,-1,-1,-1,-1,-1},
-{1238,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,175,179,1239,-1,-1,-1,-1,-1},
-{8,23,63,78,116,1240,-1,-1,-1},
-{1241,-1,-1,-1,-1,-1,-1,-1,-1},
-{1242,-1,-1,-1,-1,-1,-1,-1,-1},
-{1243,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,1244,-1,-1,-1,-1,-1,-1,-1},
-{1245,-1,-1,-1,-1,-1,-1,-1,-1},
-{1246,-1,-1,-1,-1,-1,-1,-1,-1},
-{1247,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,199,1248,-1,-1,-1,-1,-1,-1},
-{1249,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,1250,-1,-1,-1,-1,-1,-1,-1},
-{1251,-1,-1,-1,-1,-1,-1,-1,-1},
-{1252,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,1253,-1,-1,-1,-1,-1,-1,-1},
-{1254,-1,-1,-1,-1,-1,-1,-1,-1},
-{1255,-1,-1,-1,-1,-1,-1,-1,-1},
-{1256,-1,-1,-1,-1,-1,-1,-1,-1},
-{1257,-1,-1,-1,-1,-1,-1,-1,-1},
-{1258,-1,-1,-1,-1,-1,-1,-1,-1},
-{1259,-1,-1,-1,-1,-1,-1,-1,-1},
-{1260,-1,-1,-1,-1,-1,-1,-1,-1},
-{1261,-1,-1,-1,-1,-1,-1,-1,-1},
-{1262,-1,-1,-1,-1,-1,-1,-1,-1},
-{1263,-1,-1,-1,-1,-1,-1,-1,-1},
-{1264,-1,-1,-1,-1,-1,-1,-1,-1},
-{1265,-1,-1,-1,-1,-1,-1,-1,-1},
-{1266,-1,-1,-1,-1,-1,-1,-1,-1},
-{1267,-1,-1,-1,-1,-1,-1,-1,-1},
-{1268,-1,-1,-1,-1,-1,-1,-1,-1},
-{1269,-1,-1,-1,-1,-1,-1,-1,-1},
-{1270,-1,-1,-1,-1,-1,-1,-1,-1},
-{1271,-1,-1,-1,-1,-1,-1,-1,-1},
-{1272,-1,-1,-1,-1,-1,-1,-1,-1},
-{1273,-1,-1,-1,-1,-1,-1,-1,-1},
-{1274,-1,-1,-1,-1,-1,-1,-1,-1},
-{1275,-1,-1,-1,-1,-1,-1,-1,-1},
-{1276,-1,-1,-1,-1,-1,-1,-1,-1},
-{1277,-1,-1,-1,-1,-1,-1,-1,-1},
-{1278,-1,-1,-1,-1,-1,-1,-1,-1},
-{1279,-1,-1,-1,-1,-1,-1,-1,-1},
-{1280,-1,-1,-1,-1,-1,-1,-1,-1},
-{1281,-1,-1,-1,-1,-1,-1,-1,-1},
-{1282,-1,-1,-1,-1,-1,-1,-1,-1},
-{1283,-1,-1,-1,-1,-1,-1,-1,-1},
-{1284,-1,-1,-1,-1,-1,-1,-1,-1},
-{1285,-1,-1,-1,-1,-1,-1,-1,-1},
-{1286,-1,-1,-1,-1,-1,-1,-1,-1},
-{1287,-1,-1,-1,-1,-1,-1,-1,-1},
-{1288,-1,-1,-1,-1,-1,-1,-1,-1},
-{1289,-1,-1,-1,-1,-1,-1,-1,-1},
-{1290,-1,-1,-1,-1,-1,-1,-1,-1},
-{1291,-1,-1,-1,-1,-1,-1,-1,-1},
-{1292,-1,-1,-1,-1,-1,-1,-1,-1},
-{1293,-1,-1,-1,-1,-1,-1,-1,-1},
-{1294,-1,-1,-1,-1,-1,-1,-1,-1},
-{1295,-1,-1,-1,-1,-1,-1,-1,-1},
-{1296,-1,-1,-1,-1,-1,-1,-1,-1},
-{1297,-1,-1,-1,-1,-1,-1,-1,-1},
-{1298,-1,-1,-1,-1,-1,-1,-1,-1},
-{1299,-1,-1,-1,-1,-1,-1,-1,-1},
-{1300,-1,-1,-1,-1,-1,-1,-1,-1},
-{1301,-1,-1,-1,-1,-1,-1,-1,-1},
-{1302,-1,-1,-1,-1,-1,-1,-1,-1},
-{1303,-1,-1,-1,-1,-1,-1,-1,-1},
-{1304,-1,-1,-1,-1,-1,-1,-1,-1},
-{1305,-1,-1,-1,-1,-1,-1,-1,-1},
-{1306,-1,-1,-1,-1,-1,-1,-1,-1},
-{1307,-1,-1,-1,-1,-1,-1,-1,-1},
-{1308,-1,-1,-1,-1,-1,-1,-1,-1},
-{1309,-1,-1,-1,-1,-1,-1,-1,-1},
-{1310,-1,-1,-1,-1,-1,-1,-1,-1},
-{1311,-1,-1,-1,-1,-1,-1,-1,-1},
-{1312,-1,-1,-1,-1,-1,-1,-1,-1},
-{1313,-1,-1,-1,-1,-1,-1,-1,-1},
-{1314,-1,-1,-1,-1,-1,-1,-1,-1},
-{1315,-1,-1,-1,-1,-1,-1,-1,-1},
-{1316,-1,-1,-1,-1,-1,-1,-1,-1},
-{1317,-1,-1,-1,-1,-1,-1,-1,-1},
-{1318,-1,-1,-1,-1,-1,-1,-1,-1},
-{1319,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,1320,-1,-1,-1,-1,-1,-1,-1},
-{1321,-1,-1,-1,-1,-1,-1,-1,-1},
-{1322,-1,-1,-1,-1,-1,-1,-1,-1},
-{1323,-1,-1,-1,-1,-1,-1,-1,-1},
-{1324,-1,-1,-1,-1,-1,-1,-1,-1},
-{1325,-1,-1,-1,-1,-1,-1,-1,-1},
-{1326,-1,-1,-1,-1,-1,-1,-1,-1},
-{1327,-1,-1,-1,-1,-1,-1,-1,-1},
-{1328,-1,-1,-1,-1,-1,-1,-1,-1},
-{1329,-1,-1,-1,-1,-1,-1,-1,-1},
-{1330,-1,-1,-1,-1,-1,-1,-1,-1},
-{1331,-1,-1,-1,-1,-1,-1,-1,-1},
-{1332,-1,-1,-1,-1,-1,-1,-1,-1},
-{1333,-1,-1,-1,-1,-1,-1,-1,-1},
-{1334,-1,-1,-1,-1,-1,-1,-1,-1},
-{1335,-1,-1,-1,-1,-1,-1,-1,-1},
-{1336,-1,-1,-1,-1,-1,-1,-1,-1},
-{1337,-1,-1,-1,-1,-1,-1,-1,-1},
-{1338,-1,-1,-1,-1,-1,-1,-1,-1},
-{1339,-1,-1,-1,-1,-1,-1,-1,-1},
-{1340,-1,-1,-1,-1,-1,-1,-1,-1},
-{1341,-1,-1,-1,-1,-1,-1,-1,-1},
-{1342,-1,-1,-1,-1,-1,-1,-1,-1},
-{1343,-1,-1,-1,-1,-1,-1,-1,-1},
-{1344,-1,-1,-1,-1,-1,-1,-1,-1},
-{1345,-1,-1,-1,-1,-1,-1,-1,-1},
-{1346,-1,-1,-1,-1,-1,-1,-1,-1},
-{1347,-1,-1,-1,-1,-1,-1,-1,-1},
-{1348,-1,-1,-1,-1,-1,-1,-1,-1},
-{1349,-1,-1,-1,-1,-1,-1,-1,-1},
-{1350,-1,-1,-1,-1,-1,-1,-1,-1},
-{1351,-1,-1,-1,-1,-1,-1,-1,-1},
-{1352,-1,-1,-1,-1,-1,-1,-1,-1},
-{1353,-1,-1,-1,-1,-1,-1,-1,-1},
-{1354,-1,-1,-1,-1,-1,-1,-1,-1},
-{1355,-1,-1,-1,-1,-1,-1,-1,-1},
-{1356,-1,-1,-1,-1,-1,-1,-1,-1},
-{1357,-1,-1,-1,-1,-1,-1,-1,-1},
-{1358,-1,-1,-1,-1,-1,-1,-1,-1},
-{1359,-1,-1,-1,-1,-1,-1,-1,-1},
-{1360,-1,-1,-1,-1,-1,-1,-1,-1},
-{1361,-1,-1,-1,-1,-1,-1,-1,-1},
-{1362,-1,-1,-1,-1,-1,-1,-1,-1},
-{1363,-1,-1,-1,-1,-1,-1,-1,-1},
-{1364,-1,-1,-1,-1,-1,-1,-1,-1},
-{1365,-1,-1,-1,-1,-1,-1,-1,-1},
-{1366,-1,-1,-1,-1,-1,-1,-1,-1},
-{1367,-1,-1,-1,-1,-1,-1,-1,-1},
-{1368,-1,-1,-1,-1,-1,-1,-1,-1},
-{1369,-1,-1,-1,-1,-1,-1,-1,-1},
-{1370,-1,-1,-1,-1,-1,-1,-1,-1},
-{1371,-1,-1,-1,-1,-1,-1,-1,-1},
-{1372,-1,-1,-1,-1,-1,-1,-1,-1},
-{1373,-1,-1,-1,-1,-1,-1,-1,-1},
-{1374,-1,-1,-1,-1,-1,-1,-1,-1},
-{1375,-1,-1,-1,-1,-1,-1,-1,-1},
-{1376,-1,-1,-1,-1,-1,-1,-1,-1},
-{1377,-1,-1,-1,-1,-1,-1,-1,-1},
-{1378,-1,-1,-1,-1,-1,-1,-1,-1},
-{1379,-1,-1,-1,-1,-1,-1,-1,-1},
-{1380,-1,-1,-1,-1,-1,-1,-1,-1},
-{1381,-1,-1,-1,-1,-1,-1,-1,-1},
-{1382,-1,-1,-1,-1,-1,-1,-1,-1},
-{1383,-1,-1,-1,-1,-1,-1,-1,-1},
-{1384,-1,-1,-1,-1,-1,-1,-1,-1},
-{1385,-1,-1,-1,-1,-1,-1,-1,-1},
-{1386,-1,-1,-1,-1,-1,-1,-1,-1},
-{1387,-1,-1,-1,-1,-1,-1,-1,-1},
-{1388,-1,-1,-1,-1,-1,-1,-1,-1},
-{1389,-1,-1,-1,-1,-1,-1,-1,-1},
-{1390,-1,-1,-1,-1,-1,-1,-1,-1},
-{1391,-1,-1,-1,-1,-1,-1,-1,-1},
-{1392,-1,-1,-1,-1,-1,-1,-1,-1},
-{1393,-1,-1,-1,-1,-1,-1,-1,-1},
-{1394,-1,-1,-1,-1,-1,-1,-1,-1},
-{1395,-1,-1,-1,-1,-1,-1,-1,-1},
-{1396,-1,-1,-1,-1,-1,-1,-1,-1},
-{1397,-1,-1,-1,-1,-1,-1,-1,-1},
-{1398,-1,-1,-1,-1,-1,-1,-1,-1},
-{1399,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,1400,-1,-1,-1,-1,-1,-1,-1},
-{1401,-1,-1,-1,-1,-1,-1,-1,-1},
-{1402,-1,-1,-1,-1,-1,-1,-1,-1},
-{1403,-1,-1,-1,-1,-1,-1,-1,-1},
-{1404,-1,-1,-1,-1,-1,-1,-1,-1},
-{1405,-1,-1,-1,-1,-1,-1,-1,-1},
-{1406,-1,-1,-1,-1,-1,-1,-1,-1},
-{1407,-1,-1,-1,-1,-1,-1,-1,-1},
-{1408,-1,-1,-1,-1,-1,-1,-1,-1},
-{1409,-1,-1,-1,-1,-1,-1,-1,-1},
-{1410,-1,-1,-1,-1,-1,-1,-1,-1},
-{1411,-1,-1,-1,-1,-1,-1,-1,-1},
-{1412,-1,-1,-1,-1,-1,-1,-1,-1},
-{1413,-1,-1,-1,-1,-1,-1,-1,-1},
-{1414,-1,-1,-1,-1,-1,-1,-1,-1},
-{1415,-1,-1,-1,-1,-1,-1,-1,-1},
-{1416,-1,-1,-1,-1,-1,-1,-1,-1},
-{1417,-1,-1,-1,-1,-1,-1,-1,-1},
-{1418,-1,-1,-1,-1,-1,-1,-1,-1},
-{1419,-1,-1,-1,-1,-1,-1,-1,-1},
-{1420,-1,-1,-1,-1,-1,-1,-1,-1},
-{1421,-1,-1,-1,-1,-1,-1,-1,-1},
-{1422,-1,-1,-1,-1,-1,-1,-1,-1},
-{1423,-1,-1,-1,-1,-1,-1,-1,-1},
-{1424,-1,-1,-1,-1,-1,-1,-1,-1},
-{1425,-1,-1,-1,-1,-1,-1,-1,-1},
-{1426,-1,-1,-1,-1,-1,-1,-1,-1},
-{1427,-1,-1,-1,-1,-1,-1,-1,-1},
-{1428,-1,-1,-1,-1,-1,-1,-1,-1},
-{1429,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,1430,-1,-1,-1,-1,-1,-1,-1},
-{1431,-1,-1,-1,-1,-1,-1,-1,-1},
-{1432,-1,-1,-1,-1,-1,-1,-1,-1},
-{1433,-1,-1,-1,-1,-1,-1,-1,-1},
-{1434,-1,-1,-1,-1,-1,-1,-1,-1},
-{1435,-1,-1,-1,-1,-1,-1,-1,-1},
-{1436,-1,-1,-1,-1,-1,-1,-1,-1},
-{1437,-1,-1,-1,-1,-1,-1,-1,-1},
-{1438,-1,-1,-1,-1,-1,-1,-1,-1},
-{1439,-1,-1,-1,-1,-1,-1,-1,-1},
-{1440,-1,-1,-1,-1,-1,-1,-1,-1},
-{1441,-1,-1,-1,-1,-1,-1,-1,-1},
-{1442,-1,-1,-1,-1,-1,-1,-1,-1},
-{1443,-1,-1,-1,-1,-1,-1,-1,-1},
-{1444,-1,-1,-1,-1,-1,-1,-1,-1},
-{1445,-1,-1,-1,-1,-1,-1,-1,-1},
-{1446,-1,-1,-1,-1,-1,-1,-1,-1},
-{1447,-1,-1,-1,-1,-1,-1,-1,-1},
-{1448,-1,-1,-1,-1,-1,-1,-1,-1},
-{1449,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,1450,-1,-1,-1,-1,-1,-1,-1},
-{1451,-1,-1,-1,-1,-1,-1,-1,-1},
-{1452,-1,-1,-1,-1,-1,-1,-1,-1},
-{1453,-1,-1,-1,-1,-1,-1,-1,-1},
-{1454,-1,-1,-1,-1,-1,-1,-1,-1},
-{1455,-1,-1,-1,-1,-1,-1,-1,-1},
-{1456,-1,-1,-1,-1,-1,-1,-1,-1},
-{1457,-1,-1,-1,-1,-1,-1,-1,-1},
-{1458,-1,-1,-1,-1,-1,-1,-1,-1},
-{1459,-1,-1,-1,-1,-1,-1,-1,-1},
-{1460,-1,-1,-1,-1,-1,-1,-1,-1},
-{1461,-1,-1,-1,-1,-1,-1,-1,-1},
-{1462,-1,-1,-1,-1,-1,-1,-1,-1},
-{1463,-1,-1,-1,-1,-1,-1,-1,-1},
-{1464,-1,-1,-1,-1,-1,-1,-1,-1},
-{1465,-1,-1,-1,-1,-1,-1,-1,-1},
-{1466,-1,-1,-1,-1,-1,-1,-1,-1},
-{1467,-1,-1,-1,-1,-1,-1,-1,-1},
-{1468,-1,-1,-1,-1,-1,-1,-1,-1},
-{1469,-1,-1,-1,-1,-1,-1,-1,-1},
-{1470,-1,-1,-1,-1,-1,-1,-1,-1},
-{1471,-1,-1,-1,-1,-1,-1,-1,-1},
-{1472,-1,-1,-1,-1,-1,-1,-1,-1},
-{1473,-1,-1,-1,-1,-1,-1,-1,-1},
-{1474,-1,-1,-1,-1,-1,-1,-1,-1},
-{1475,-1,-1,-1,-1,-1,-1,-1,-1},
-{1476,-1,-1,-1,-1,-1,-1,-1,-1},
-{1477,-1,-1,-1,-1,-1,-1,-1,-1},
-{1478,-1,-1,-1,-1,-1,-1,-1,-1},
-{1479,-1,-1,-1,-1,-1,-1,-1,-1},
-{1480,-1,-1,-1,-1,-1,-1,-1,-1},
-{1481,-1,-1,-1,-1,-1,-1,-1,-1},
-{1482,-1,-1,-1,-1,-1,-1,-1,-1},
-{1483,-1,-1,-1,-1,-1,-1,-1,-1},
-{1484,-1,-1,-1,-1,-1,-1,-1,-1},
-{1485,-1,-1,-1,-1,-1,-1,-1,-1},
-{1486,-1,-1,-1,-1,-1,-1,-1,-1},
-{1487,-1,-1,-1,-1,-1,-1,-1,-1},
-{1488,-1,-1,-1,-1,-1,-1,-1,-1},
-{1489,-1,-1,-1,-1,-1,-1,-1,-1},
-{1490,-1,-1,-1,-1,-1,-1,-1,-1},
-{1491,-1,-1,-1,-1,-1,-1,-1,-1},
-{1492,-1,-1,-1,-1,-1,-1,-1,-1},
-{1493,-1,-1,-1,-1,-1,-1,-1,-1},
-{1494,-1,-1,-1,-1,-1,-1,-1,-1},
-{1495,-1,-1,-1,-1,-1,-1,-1,-1},
-{1496,-1,-1,-1,-1,-1,-1,-1,-1},
-{1497,-1,-1,-1,-1,-1,-1,-1,-1},
-{1498,-1,-1,-1,-1,-1,-1,-1,-1},
-{1499,-1,-1,-1,-1,-1,-1,-1,-1},
-{1500,-1,-1,-1,-1,-1,-1,-1,-1},
-{1501,-1,-1,-1,-1,-1,-1,-1,-1},
-{1502,-1,-1,-1,-1,-1,-1,-1,-1},
-{1503,-1,-1,-1,-1,-1,-1,-1,-1},
-{1504,-1,-1,-1,-1,-1,-1,-1,-1},
-{1505,-1,-1,-1,-1,-1,-1,-1,-1},
-{1506,-1,-1,-1,-1,-1,-1,-1,-1},
-{1507,-1,-1,-1,-1,-1,-1,-1,-1},
-{1508,-1,-1,-1,-1,-1,-1,-1,-1},
-{1509,-1,-1,-1,-1,-1,-1,-1,-1},
-{1510,-1,-1,-1,-1,-1,-1,-1,-1},
-{1511,-1,-1,-1,-1,-1,-1,-1,-1},
-{1512,-1,-1,-1,-1,-1,-1,-1,-1},
-{1513,-1,-1,-1,-1,-1,-1,-1,-1},
-{1514,-1,-1,-1,-1,-1,-1,-1,-1},
-{1515,-1,-1,-1,-1,-1,-1,-1,-1},
-{1516,-1,-1,-1,-1,-1,-1,-1,-1},
-{1517,-1,-1,-1,-1,-1,-1,-1,-1},
-{1518,-1,-1,-1,-1,-1,-1,-1,-1},
-{1519,-1,-1,-1,-1,-1,-1,-1,-1},
-{1520,-1,-1,-1,-1,-1,-1,-1,-1},
-{1521,-1,-1,-1,-1,-1,-1,-1,-1},
-{1522,-1,-1,-1,-1,-1,-1,-1,-1},
-{1523,-1,-1,-1,-1,-1,-1,-1,-1},
-{1524,-1,-1,-1,-1,-1,-1,-1,-1},
-{1525,-1,-1,-1,-1,-1,-1,-1,-1},
-{1526,-1,-1,-1,-1,-1,-1,-1,-1},
-{1527,-1,-1,-1,-1,-1,-1,-1,-1},
-{1528,-1,-1,-1,-1,-1,-1,-1,-1},
-{1529,-1,-1,-1,-1,-1,-1,-1,-1},
-{1530,-1,-1,-1,-1,-1,-1,-1,-1},
-{1531,-1,-1,-1,-1,-1,-1,-1,-1},
-{1532,-1,-1,-1,-1,-1,-1,-1,-1},
-{1533,-1,-1,-1,-1,-1,-1,-1,-1},
-{1534,-1,-1,-1,-1,-1,-1,-1,-1},
-{1535,-1,-1,-1,-1,-1,-1,-1,-1},
-{1536,-1,-1,-1,-1,-1,-1,-1,-1},
-{1537,-1,-1,-1,-1,-1,-1,-1,-1},
-{1538,-1,-1,-1,-1,-1,-1,-1,-1},
-{1539,-1,-1,-1,-1,-1,-1,-1,-1},
-{1540,-1,-1,-1,-1,-1,-1,-1,-1},
-{1541,-1,-1,-1,-1,-1,-1,-1,-1},
-{1542,-1,-1,-1,-1,-1,-1,-1,-1},
-{1543,-1,-1,-1,-1,-1,-1,-1,-1},
-{1544,-1,-1,-1,-1,-1,-1,-1,-1},
-{1545,-1,-1,-1,-1,-1,-1,-1,-1},
-{1546,-1,-1,-1,-1,-1,-1,-1,-1},
-{1547,-1,-1,-1,-1,-1,-1,-1,-1},
-{1548,-1,-1,-1,-1,-1,-1,-1,-1},
-{1549,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,1550,-1,-1,-1,-1,-1,-1,-1},
-{1551,-1,-1,-1,-1,-1,-1,-1,-1},
-{1552,-1,-1,-1,-1,-1,-1,-1,-1},
-{1553,-1,-1,-1,-1,-1,-1,-1,-1},
-{1554,-1,-1,-1,-1,-1,-1,-1,-1},
-{1555,-1,-1,-1,-1,-1,-1,-1,-1},
-{1556,-1,-1,-1,-1,-1,-1,-1,-1},
-{1557,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,1558,-1,-1,-1,-1,-1,-1,-1},
-{120,1559,-1,-1,-1,-1,-1,-1,-1},
-{1560,-1,-1,-1,-1,-1,-1,-1,-1},
-{1561,-1,-1,-1,-1,-1,-1,-1,-1},
-{1562,-1,-1,-1,-1,-1,-1,-1,-1},
-{1563,-1,-1,-1,-1,-1,-1,-1,-1},
-{1564,-1,-1,-1,-1,-1,-1,-1,-1},
-{1565,-1,-1,-1,-1,-1,-1,-1,-1},
-{1566,-1,-1,-1,-1,-1,-1,-1,-1},
-{1567,-1,-1,-1,-1,-1,-1,-1,-1},
-{1568,-1,-1,-1,-1,-1,-1,-1,-1},
-{1569,-1,-1,-1,-1,-1,-1,-1,-1},
-{1570,-1,-1,-1,-1,-1,-1,-1,-1},
-{1571,-1,-1,-1,-1,-1,-1,-1,-1},
-{1572,-1,-1,-1,-1,-1,-1,-1,-1},
-{1573,-1,-1,-1,-1,-1,-1,-1,-1},
-{1574,-1,-1,-1,-1,-1,-1,-1,-1},
-{1575,-1,-1,-1,-1,-1,-1,-1,-1},
-{1576,-1,-1,-1,-1,-1,-1,-1,-1},
-{1577,-1,-1,-1,-1,-1,-1,-1,-1},
-{1578,-1,-1,-1,-1,-1,-1,-1,-1},
-{1579,-1,-1,-1,-1,-1,-1,-1,-1},
-{1580,-1,-1,-1,-1,-1,-1,-1,-1},
-{1581,-1,-1,-1,-1,-1,-1,-1,-1},
-{1582,-1,-1,-1,-1,-1,-1,-1,-1},
-{1583,-1,-1,-1,-1,-1,-1,-1,-1},
-{1584,-1,-1,-1,-1,-1,-1,-1,-1},
-{1585,-1,-1,-1,-1,-1,-1,-1,-1},
-{1586,-1,-1,-1,-1,-1,-1,-1,-1},
-{1587,-1,-1,-1,-1,-1,-1,-1,-1},
-{1588,-1,-1,-1,-1,-1,-1,-1,-1},
-{1589,-1,-1,-1,-1,-1,-1,-1,-1},
-{1590,-1,-1,-1,-1,-1,-1,-1,-1},
-{1591,-1,-1,-1,-1,-1,-1,-1,-1},
-{1592,-1,-1,-1,-1,-1,-1,-1,-1},
-{1593,-1,-1,-1,-1,-1,-1,-1,-1},
-{1594,-1,-1,-1,-1,-1,-1,-1,-1},
-{1595,-1,-1,-1,-1,-1,-1,-1,-1},
-{1596,-1,-1,-1,-1,-1,-1,-1,-1},
-{1597,-1,-1,-1,-1,-1,-1,-1,-1},
-{1598,-1,-1,-1,-1,-1,-1,-1,-1},
-{1599,-1,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_met_QCmatrixEnc_2_16[1400][8]={
-{13,58,89,114,134,161,197,-1},
-{47,87,147,200,-1,-1,-1,-1},
-{50,119,153,173,201,-1,-1,-1},
-{149,150,168,202,-1,-1,-1,-1},
-{209,203,-1,-1,-1,-1,-1,-1},
-{14,59,60,115,135,162,198,204},
-{48,88,148,205,-1,-1,-1,-1},
-{51,90,154,174,206,-1,-1,-1},
-{120,151,169,207,-1,-1,-1,-1},
-{180,208,-1,-1,-1,-1,-1,-1},
-{15,30,61,116,136,163,199,209},
-{49,89,149,210,-1,-1,-1,-1},
-{52,91,155,175,211,-1,-1,-1},
-{121,152,170,212,-1,-1,-1,-1},
-{181,213,-1,-1,-1,-1,-1,-1},
-{16,31,62,117,137,164,200,214},
-{50,60,120,215,-1,-1,-1,-1},
-{53,92,156,176,216,-1,-1,-1},
-{122,153,171,217,-1,-1,-1,-1},
-{182,218,-1,-1,-1,-1,-1,-1},
-{17,32,63,118,138,165,201,219},
-{51,61,121,220,-1,-1,-1,-1},
-{54,93,157,177,221,-1,-1,-1},
-{123,154,172,222,-1,-1,-1,-1},
-{183,223,-1,-1,-1,-1,-1,-1},
-{18,33,64,119,139,166,202,224},
-{52,62,122,225,-1,-1,-1,-1},
-{55,94,158,178,226,-1,-1,-1},
-{124,155,173,227,-1,-1,-1,-1},
-{184,228,-1,-1,-1,-1,-1,-1},
-{19,34,65,90,140,167,203,229},
-{53,63,123,230,-1,-1,-1,-1},
-{56,95,159,179,231,-1,-1,-1},
-{125,156,174,232,-1,-1,-1,-1},
-{185,233,-1,-1,-1,-1,-1,-1},
-{20,35,66,91,141,168,204,234},
-{54,64,124,235,-1,-1,-1,-1},
-{57,96,150,160,236,-1,-1,-1},
-{126,157,175,237,-1,-1,-1,-1},
-{186,238,-1,-1,-1,-1,-1,-1},
-{21,36,67,92,142,169,205,239},
-{55,65,125,240,-1,-1,-1,-1},
-{58,97,151,161,241,-1,-1,-1},
-{127,158,176,242,-1,-1,-1,-1},
-{187,243,-1,-1,-1,-1,-1,-1},
-{22,37,68,93,143,170,206,244},
-{56,66,126,245,-1,-1,-1,-1},
-{59,98,152,162,246,-1,-1,-1},
-{128,159,177,247,-1,-1,-1,-1},
-{188,248,-1,-1,-1,-1,-1,-1},
-{23,38,69,94,144,171,207,249},
-{57,67,127,250,-1,-1,-1,-1},
-{30,99,153,163,251,-1,-1,-1},
-{129,160,178,252,-1,-1,-1,-1},
-{189,253,-1,-1,-1,-1,-1,-1},
-{24,39,70,95,145,172,208,254},
-{58,68,128,255,-1,-1,-1,-1},
-{31,100,154,164,256,-1,-1,-1},
-{130,161,179,257,-1,-1,-1,-1},
-{190,258,-1,-1,-1,-1,-1,-1},
-{25,40,71,96,146,173,209,259},
-{59,69,129,260,-1,-1,-1,-1},
-{32,101,155,165,261,-1,-1,-1},
-{131,150,162,262,-1,-1,-1,-1},
-{191,263,-1,-1,-1,-1,-1,-1},
-{26,41,72,97,147,174,180,264},
-{30,70,130,265,-1,-1,-1,-1},
-{33,102,156,166,266,-1,-1,-1},
-{132,151,163,267,-1,-1,-1,-1},
-{192,268,-1,-1,-1,-1,-1,-1},
-{27,42,73,98,148,175,181,269},
-{31,71,131,270,-1,-1,-1,-1},
-{34,103,157,167,271,-1,-1,-1},
-{133,152,164,272,-1,-1,-1,-1},
-{193,273,-1,-1,-1,-1,-1,-1},
-{28,43,74,99,149,176,182,274},
-{32,72,132,275,-1,-1,-1,-1},
-{35,104,158,168,276,-1,-1,-1},
-{134,153,165,277,-1,-1,-1,-1},
-{194,278,-1,-1,-1,-1,-1,-1},
-{29,44,75,100,120,177,183,279},
-{33,73,133,280,-1,-1,-1,-1},
-{36,105,159,169,281,-1,-1,-1},
-{135,154,166,282,-1,-1,-1,-1},
-{195,283,-1,-1,-1,-1,-1,-1},
-{0,45,76,101,121,178,184,284},
-{34,74,134,285,-1,-1,-1,-1},
-{37,106,160,170,286,-1,-1,-1},
-{136,155,167,287,-1,-1,-1,-1},
-{196,288,-1,-1,-1,-1,-1,-1},
-{1,46,77,102,122,179,185,289},
-{35,75,135,290,-1,-1,-1,-1},
-{38,107,161,171,291,-1,-1,-1},
-{137,156,168,292,-1,-1,-1,-1},
-{197,293,-1,-1,-1,-1,-1,-1},
-{2,47,78,103,123,150,186,294},
-{36,76,136,295,-1,-1,-1,-1},
-{39,108,162,172,296,-1,-1,-1},
-{138,157,169,297,-1,-1,-1,-1},
-{198,298,-1,-1,-1,-1,-1,-1},
-{3,48,79,104,124,151,187,299},
-{37,77,137,300,-1,-1,-1,-1},
-{40,109,163,173,301,-1,-1,-1},
-{139,158,170,302,-1,-1,-1,-1},
-{199,303,-1,-1,-1,-1,-1,-1},
-{4,49,80,105,125,152,188,304},
-{38,78,138,305,-1,-1,-1,-1},
-{41,110,164,174,306,-1,-1,-1},
-{140,159,171,307,-1,-1,-1,-1},
-{200,308,-1,-1,-1,-1,-1,-1},
-{5,50,81,106,126,153,189,309},
-{39,79,139,310,-1,-1,-1,-1},
-{42,111,165,175,311,-1,-1,-1},
-{141,160,172,312,-1,-1,-1,-1},
-{201,313,-1,-1,-1,-1,-1,-1},
-{6,51,82,107,127,154,190,314},
-{40,80,140,315,-1,-1,-1,-1},
-{43,112,166,176,316,-1,-1,-1},
-{142,161,173,317,-1,-1,-1,-1},
-{202,318,-1,-1,-1,-1,-1,-1},
-{7,52,83,108,128,155,191,319},
-{41,81,141,320,-1,-1,-1,-1},
-{44,113,167,177,321,-1,-1,-1},
-{143,162,174,322,-1,-1,-1,-1},
-{203,323,-1,-1,-1,-1,-1,-1},
-{8,53,84,109,129,156,192,324},
-{42,82,142,325,-1,-1,-1,-1},
-{45,114,168,178,326,-1,-1,-1},
-{144,163,175,327,-1,-1,-1,-1},
-{204,328,-1,-1,-1,-1,-1,-1},
-{9,54,85,110,130,157,193,329},
-{43,83,143,330,-1,-1,-1,-1},
-{46,115,169,179,331,-1,-1,-1},
-{145,164,176,332,-1,-1,-1,-1},
-{205,333,-1,-1,-1,-1,-1,-1},
-{10,55,86,111,131,158,194,334},
-{44,84,144,335,-1,-1,-1,-1},
-{47,116,150,170,336,-1,-1,-1},
-{146,165,177,337,-1,-1,-1,-1},
-{206,338,-1,-1,-1,-1,-1,-1},
-{11,56,87,112,132,159,195,339},
-{45,85,145,340,-1,-1,-1,-1},
-{48,117,151,171,341,-1,-1,-1},
-{147,166,178,342,-1,-1,-1,-1},
-{207,343,-1,-1,-1,-1,-1,-1},
-{12,57,88,113,133,160,196,344},
-{46,86,146,345,-1,-1,-1,-1},
-{49,118,152,172,346,-1,-1,-1},
-{148,167,179,347,-1,-1,-1,-1},
-{208,348,-1,-1,-1,-1,-1,-1},
-{30,71,140,142,144,205,-1,-1},
-{152,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{126,182,186,-1,-1,-1,-1,-1},
-{122,177,-1,-1,-1,-1,-1,-1},
-{120,-1,-1,-1,-1,-1,-1,-1},
-{192,200,-1,-1,-1,-1,-1,-1},
-{58,140,-1,-1,-1,-1,-1,-1},
-{148,207,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{10,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{106,146,-1,-1,-1,-1,-1,-1},
-{11,136,157,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{96,150,176,-1,-1,-1,-1,-1},
-{9,24,64,79,117,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{21,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{131,200,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{31,72,141,143,145,181,206,-1},
-{153,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{121,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{127,183,187,-1,-1,-1,-1,-1},
-{123,178,-1,-1,-1,-1,-1,-1},
-{121,-1,-1,-1,-1,-1,-1,-1},
-{193,201,-1,-1,-1,-1,-1,-1},
-{59,141,-1,-1,-1,-1,-1,-1},
-{149,208,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{11,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{107,147,-1,-1,-1,-1,-1,-1},
-{12,137,158,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{97,151,177,-1,-1,-1,-1,-1},
-{10,25,65,80,118,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{22,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{132,201,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{32,73,142,144,146,182,207,-1},
-{154,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{122,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{128,184,188,-1,-1,-1,-1,-1},
-{124,179,-1,-1,-1,-1,-1,-1},
-{122,-1,-1,-1,-1,-1,-1,-1},
-{194,202,-1,-1,-1,-1,-1,-1},
-{30,142,-1,-1,-1,-1,-1,-1},
-{209,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{12,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{108,148,-1,-1,-1,-1,-1,-1},
-{13,138,159,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{98,152,178,-1,-1,-1,-1,-1},
-{11,26,66,81,119,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{23,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{133,202,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{33,74,143,145,147,183,208,-1},
-{155,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{123,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{129,185,189,-1,-1,-1,-1,-1},
-{125,150,-1,-1,-1,-1,-1,-1},
-{123,-1,-1,-1,-1,-1,-1,-1},
-{195,203,-1,-1,-1,-1,-1,-1},
-{31,143,-1,-1,-1,-1,-1,-1},
-{121,180,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{13,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{109,149,-1,-1,-1,-1,-1,-1},
-{14,139,160,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{99,153,179,-1,-1,-1,-1,-1},
-{12,27,67,82,90,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{24,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{134,203,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{34,75,144,146,148,184,209,-1},
-{156,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{124,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{130,186,190,-1,-1,-1,-1,-1},
-{126,151,-1,-1,-1,-1,-1,-1},
-{124,-1,-1,-1,-1,-1,-1,-1},
-{196,204,-1,-1,-1,-1,-1,-1},
-{32,144,-1,-1,-1,-1,-1,-1},
-{122,181,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{14,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{110,120,-1,-1,-1,-1,-1,-1},
-{15,140,161,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{100,150,154,-1,-1,-1,-1,-1},
-{13,28,68,83,91,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{25,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{135,204,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{35,76,145,147,149,185,-1,-1},
-{157,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{125,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{131,187,191,-1,-1,-1,-1,-1},
-{127,152,-1,-1,-1,-1,-1,-1},
-{125,-1,-1,-1,-1,-1,-1,-1},
-{197,205,-1,-1,-1,-1,-1,-1},
-{33,145,-1,-1,-1,-1,-1,-1},
-{123,182,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{15,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{111,121,-1,-1,-1,-1,-1,-1},
-{16,141,162,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{101,151,155,-1,-1,-1,-1,-1},
-{14,29,69,84,92,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{26,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{136,205,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{36,77,146,148,181,186,-1,-1},
-{158,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{126,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{132,188,192,-1,-1,-1,-1,-1},
-{128,153,-1,-1,-1,-1,-1,-1},
-{126,-1,-1,-1,-1,-1,-1,-1},
-{198,206,-1,-1,-1,-1,-1,-1},
-{34,146,-1,-1,-1,-1,-1,-1},
-{124,183,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{16,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{112,122,-1,-1,-1,-1,-1,-1},
-{17,142,163,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{102,152,156,-1,-1,-1,-1,-1},
-{15,70,85,93,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{27,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{137,206,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{37,78,121,147,149,182,187,-1},
-{159,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{127,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{133,189,193,-1,-1,-1,-1,-1},
-{129,154,-1,-1,-1,-1,-1,-1},
-{127,-1,-1,-1,-1,-1,-1,-1},
-{199,207,-1,-1,-1,-1,-1,-1},
-{35,147,-1,-1,-1,-1,-1,-1},
-{125,184,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{17,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{113,123,-1,-1,-1,-1,-1,-1},
-{18,143,164,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{103,153,157,-1,-1,-1,-1,-1},
-{1,16,71,86,94,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{28,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{138,207,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{38,79,120,122,148,183,188,-1},
-{160,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{128,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{134,190,194,-1,-1,-1,-1,-1},
-{130,155,-1,-1,-1,-1,-1,-1},
-{128,-1,-1,-1,-1,-1,-1,-1},
-{200,208,-1,-1,-1,-1,-1,-1},
-{36,148,-1,-1,-1,-1,-1,-1},
-{126,185,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{18,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{114,124,-1,-1,-1,-1,-1,-1},
-{19,144,165,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{104,154,158,-1,-1,-1,-1,-1},
-{2,17,72,87,95,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{29,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{139,208,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{39,80,121,123,149,184,189,-1},
-{161,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{129,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{135,191,195,-1,-1,-1,-1,-1},
-{131,156,-1,-1,-1,-1,-1,-1},
-{129,-1,-1,-1,-1,-1,-1,-1},
-{201,209,-1,-1,-1,-1,-1,-1},
-{37,149,-1,-1,-1,-1,-1,-1},
-{127,186,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{19,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{115,125,-1,-1,-1,-1,-1,-1},
-{20,145,166,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{105,155,159,-1,-1,-1,-1,-1},
-{3,18,73,88,96,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{0,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{140,209,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{40,81,122,124,185,190,-1,-1},
-{162,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{130,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{136,192,196,-1,-1,-1,-1,-1},
-{132,157,-1,-1,-1,-1,-1,-1},
-{130,-1,-1,-1,-1,-1,-1,-1},
-{202,-1,-1,-1,-1,-1,-1,-1},
-{38,-1,-1,-1,-1,-1,-1,-1},
-{128,187,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{20,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{116,126,-1,-1,-1,-1,-1,-1},
-{21,146,167,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{106,156,160,-1,-1,-1,-1,-1},
-{4,19,74,89,97,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{141,180,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{41,82,121,123,125,186,191,-1},
-{163,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{131,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{137,193,197,-1,-1,-1,-1,-1},
-{133,158,-1,-1,-1,-1,-1,-1},
-{131,-1,-1,-1,-1,-1,-1,-1},
-{181,203,-1,-1,-1,-1,-1,-1},
-{39,121,-1,-1,-1,-1,-1,-1},
-{129,188,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{21,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{117,127,-1,-1,-1,-1,-1,-1},
-{22,147,168,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{107,157,161,-1,-1,-1,-1,-1},
-{5,20,60,75,98,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{2,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{142,181,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{42,83,122,124,126,187,192,-1},
-{164,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{132,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{138,194,198,-1,-1,-1,-1,-1},
-{134,159,-1,-1,-1,-1,-1,-1},
-{132,-1,-1,-1,-1,-1,-1,-1},
-{182,204,-1,-1,-1,-1,-1,-1},
-{40,122,-1,-1,-1,-1,-1,-1},
-{130,189,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{22,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{118,128,-1,-1,-1,-1,-1,-1},
-{23,148,169,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{108,158,162,-1,-1,-1,-1,-1},
-{6,21,61,76,99,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{3,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{143,182,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{43,84,123,125,127,188,193,-1},
-{165,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{133,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{139,195,199,-1,-1,-1,-1,-1},
-{135,160,-1,-1,-1,-1,-1,-1},
-{133,-1,-1,-1,-1,-1,-1,-1},
-{183,205,-1,-1,-1,-1,-1,-1},
-{41,123,-1,-1,-1,-1,-1,-1},
-{131,190,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{23,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{119,129,-1,-1,-1,-1,-1,-1},
-{24,149,170,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{109,159,163,-1,-1,-1,-1,-1},
-{7,22,62,77,100,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{4,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{144,183,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{44,85,124,126,128,189,194,-1},
-{166,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{134,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{140,196,200,-1,-1,-1,-1,-1},
-{136,161,-1,-1,-1,-1,-1,-1},
-{134,-1,-1,-1,-1,-1,-1,-1},
-{184,206,-1,-1,-1,-1,-1,-1},
-{42,124,-1,-1,-1,-1,-1,-1},
-{132,191,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{24,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{90,130,-1,-1,-1,-1,-1,-1},
-{25,120,171,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{110,160,164,-1,-1,-1,-1,-1},
-{8,23,63,78,101,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{5,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{145,184,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{45,86,125,127,129,190,195,-1},
-{167,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{135,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{141,197,201,-1,-1,-1,-1,-1},
-{137,162,-1,-1,-1,-1,-1,-1},
-{135,-1,-1,-1,-1,-1,-1,-1},
-{185,207,-1,-1,-1,-1,-1,-1},
-{43,125,-1,-1,-1,-1,-1,-1},
-{133,192,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{25,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{91,131,-1,-1,-1,-1,-1,-1},
-{26,121,172,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{111,161,165,-1,-1,-1,-1,-1},
-{9,24,64,79,102,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{6,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{146,185,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{46,87,126,128,130,191,196,-1},
-{168,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{136,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{142,198,202,-1,-1,-1,-1,-1},
-{138,163,-1,-1,-1,-1,-1,-1},
-{136,-1,-1,-1,-1,-1,-1,-1},
-{186,208,-1,-1,-1,-1,-1,-1},
-{44,126,-1,-1,-1,-1,-1,-1},
-{134,193,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{26,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{92,132,-1,-1,-1,-1,-1,-1},
-{27,122,173,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{112,162,166,-1,-1,-1,-1,-1},
-{10,25,65,80,103,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{7,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{147,186,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{47,88,127,129,131,192,197,-1},
-{169,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{137,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{143,199,203,-1,-1,-1,-1,-1},
-{139,164,-1,-1,-1,-1,-1,-1},
-{137,-1,-1,-1,-1,-1,-1,-1},
-{187,209,-1,-1,-1,-1,-1,-1},
-{45,127,-1,-1,-1,-1,-1,-1},
-{135,194,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{27,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{93,133,-1,-1,-1,-1,-1,-1},
-{28,123,174,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{113,163,167,-1,-1,-1,-1,-1},
-{11,26,66,81,104,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{8,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{148,187,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{48,89,128,130,132,193,198,-1},
-{170,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{138,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{144,200,204,-1,-1,-1,-1,-1},
-{140,165,-1,-1,-1,-1,-1,-1},
-{138,-1,-1,-1,-1,-1,-1,-1},
-{180,188,-1,-1,-1,-1,-1,-1},
-{46,128,-1,-1,-1,-1,-1,-1},
-{136,195,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{28,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{94,134,-1,-1,-1,-1,-1,-1},
-{29,124,175,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{114,164,168,-1,-1,-1,-1,-1},
-{12,27,67,82,105,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{9,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{149,188,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{49,60,129,131,133,194,199,-1},
-{171,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{139,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{145,201,205,-1,-1,-1,-1,-1},
-{141,166,-1,-1,-1,-1,-1,-1},
-{139,-1,-1,-1,-1,-1,-1,-1},
-{181,189,-1,-1,-1,-1,-1,-1},
-{47,129,-1,-1,-1,-1,-1,-1},
-{137,196,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{29,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{95,135,-1,-1,-1,-1,-1,-1},
-{0,125,176,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{115,165,169,-1,-1,-1,-1,-1},
-{13,28,68,83,106,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{10,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{120,189,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{50,61,130,132,134,195,200,-1},
-{172,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{140,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{146,202,206,-1,-1,-1,-1,-1},
-{142,167,-1,-1,-1,-1,-1,-1},
-{140,-1,-1,-1,-1,-1,-1,-1},
-{182,190,-1,-1,-1,-1,-1,-1},
-{48,130,-1,-1,-1,-1,-1,-1},
-{138,197,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{0,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{96,136,-1,-1,-1,-1,-1,-1},
-{1,126,177,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{116,166,170,-1,-1,-1,-1,-1},
-{14,29,69,84,107,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{11,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{121,190,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{51,62,131,133,135,196,201,-1},
-{173,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{141,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{147,203,207,-1,-1,-1,-1,-1},
-{143,168,-1,-1,-1,-1,-1,-1},
-{141,-1,-1,-1,-1,-1,-1,-1},
-{183,191,-1,-1,-1,-1,-1,-1},
-{49,131,-1,-1,-1,-1,-1,-1},
-{139,198,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{97,137,-1,-1,-1,-1,-1,-1},
-{2,127,178,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{117,167,171,-1,-1,-1,-1,-1},
-{0,15,70,85,108,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{12,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{122,191,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{52,63,132,134,136,197,202,-1},
-{174,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{142,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{148,204,208,-1,-1,-1,-1,-1},
-{144,169,-1,-1,-1,-1,-1,-1},
-{142,-1,-1,-1,-1,-1,-1,-1},
-{184,192,-1,-1,-1,-1,-1,-1},
-{50,132,-1,-1,-1,-1,-1,-1},
-{140,199,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{2,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{98,138,-1,-1,-1,-1,-1,-1},
-{3,128,179,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{118,168,172,-1,-1,-1,-1,-1},
-{1,16,71,86,109,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{13,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{123,192,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{53,64,133,135,137,198,203,-1},
-{175,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{143,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{149,205,209,-1,-1,-1,-1,-1},
-{145,170,-1,-1,-1,-1,-1,-1},
-{143,-1,-1,-1,-1,-1,-1,-1},
-{185,193,-1,-1,-1,-1,-1,-1},
-{51,133,-1,-1,-1,-1,-1,-1},
-{141,200,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{3,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{99,139,-1,-1,-1,-1,-1,-1},
-{4,129,150,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{119,169,173,-1,-1,-1,-1,-1},
-{2,17,72,87,110,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{14,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{124,193,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{54,65,134,136,138,199,204,-1},
-{176,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{144,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{120,180,206,-1,-1,-1,-1,-1},
-{146,171,-1,-1,-1,-1,-1,-1},
-{144,-1,-1,-1,-1,-1,-1,-1},
-{186,194,-1,-1,-1,-1,-1,-1},
-{52,134,-1,-1,-1,-1,-1,-1},
-{142,201,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{4,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{100,140,-1,-1,-1,-1,-1,-1},
-{5,130,151,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{90,170,174,-1,-1,-1,-1,-1},
-{3,18,73,88,111,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{15,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{125,194,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{55,66,135,137,139,200,205,-1},
-{177,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{145,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{121,181,207,-1,-1,-1,-1,-1},
-{147,172,-1,-1,-1,-1,-1,-1},
-{145,-1,-1,-1,-1,-1,-1,-1},
-{187,195,-1,-1,-1,-1,-1,-1},
-{53,135,-1,-1,-1,-1,-1,-1},
-{143,202,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{5,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{101,141,-1,-1,-1,-1,-1,-1},
-{6,131,152,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{91,171,175,-1,-1,-1,-1,-1},
-{4,19,74,89,112,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{16,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{126,195,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{56,67,136,138,140,201,206,-1},
-{178,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{146,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{122,182,208,-1,-1,-1,-1,-1},
-{148,173,-1,-1,-1,-1,-1,-1},
-{146,-1,-1,-1,-1,-1,-1,-1},
-{188,196,-1,-1,-1,-1,-1,-1},
-{54,136,-1,-1,-1,-1,-1,-1},
-{144,203,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{6,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{102,142,-1,-1,-1,-1,-1,-1},
-{7,132,153,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{92,172,176,-1,-1,-1,-1,-1},
-{5,20,60,75,113,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{17,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{127,196,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{57,68,137,139,141,202,207,-1},
-{179,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{147,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{123,183,209,-1,-1,-1,-1,-1},
-{149,174,-1,-1,-1,-1,-1,-1},
-{147,-1,-1,-1,-1,-1,-1,-1},
-{189,197,-1,-1,-1,-1,-1,-1},
-{55,137,-1,-1,-1,-1,-1,-1},
-{145,204,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{7,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{103,143,-1,-1,-1,-1,-1,-1},
-{8,133,154,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{93,173,177,-1,-1,-1,-1,-1},
-{6,21,61,76,114,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{18,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{128,197,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{58,69,138,140,142,203,208,-1},
-{150,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{148,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{124,180,184,-1,-1,-1,-1,-1},
-{120,175,-1,-1,-1,-1,-1,-1},
-{148,-1,-1,-1,-1,-1,-1,-1},
-{190,198,-1,-1,-1,-1,-1,-1},
-{56,138,-1,-1,-1,-1,-1,-1},
-{146,205,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{8,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{104,144,-1,-1,-1,-1,-1,-1},
-{9,134,155,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{94,174,178,-1,-1,-1,-1,-1},
-{7,22,62,77,115,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{19,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{129,198,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{59,70,139,141,143,204,209,-1},
-{151,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{149,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{125,181,185,-1,-1,-1,-1,-1},
-{121,176,-1,-1,-1,-1,-1,-1},
-{149,-1,-1,-1,-1,-1,-1,-1},
-{191,199,-1,-1,-1,-1,-1,-1},
-{57,139,-1,-1,-1,-1,-1,-1},
-{147,206,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{9,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{105,145,-1,-1,-1,-1,-1,-1},
-{10,135,156,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{95,175,179,-1,-1,-1,-1,-1},
-{8,23,63,78,116,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{20,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{130,199,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{180,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{120,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{120,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{180,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{120,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{0,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{120,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{180,-1,-1,-1,-1,-1,-1,-1},
-{120,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1},
-{-1,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_met_QCmatrixV_2_16[1600][15]={
-{85,444,737,762,800,1250,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,380,474,767,792,830,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,410,504,797,822,860,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,440,534,827,852,890,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,470,564,857,882,920,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,500,594,887,912,950,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,530,624,917,942,980,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,560,654,947,972,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,590,684,977,1002,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,170,620,714,1007,1032,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{135,162,200,650,744,1037,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,167,192,230,680,774,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,197,222,260,710,804,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,227,252,290,740,834,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,257,282,320,770,864,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,287,312,350,800,894,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,317,342,380,830,924,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,347,372,410,860,954,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,377,402,440,890,984,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,407,432,470,920,1014,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,437,462,500,950,1044,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,174,467,492,530,980,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,204,497,522,560,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,234,527,552,590,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,170,264,557,582,620,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,200,294,587,612,650,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,230,324,617,642,680,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,260,354,647,672,710,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,290,384,677,702,740,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,320,414,707,732,770,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,52,66,150,219,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,57,71,180,249,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,62,76,210,279,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,67,81,240,309,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,72,86,270,339,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,77,91,300,369,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,82,96,330,399,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,87,101,360,429,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,92,106,390,459,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,97,111,420,489,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,102,116,450,519,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,107,121,480,549,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,112,126,510,579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,117,131,540,609,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,122,136,570,639,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,127,141,600,669,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,132,146,630,699,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,95,137,660,729,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,100,142,690,759,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,105,147,720,789,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,16,110,750,819,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,21,115,780,849,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,26,120,810,879,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,31,125,840,909,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,36,130,870,939,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,41,135,900,969,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,46,140,930,999,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,51,145,960,1029,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,42,56,159,990,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,47,61,189,1020,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,16,500,720,950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,21,530,750,980,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,26,560,780,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,31,590,810,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,36,170,620,840,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,41,200,650,870,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,46,230,680,900,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,51,260,710,930,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,56,290,740,960,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,61,320,770,990,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,66,350,800,1020,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,71,150,380,830,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,76,180,410,860,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,81,210,440,890,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,86,240,470,920,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,91,270,500,950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,96,300,530,980,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,101,330,560,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,106,360,590,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,111,170,390,620,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,116,200,420,650,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,121,230,450,680,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,126,260,480,710,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,131,290,510,740,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,136,320,540,770,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,141,350,570,800,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{135,146,380,600,830,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,140,410,630,860,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,145,440,660,890,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,11,470,690,920,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,30,260,586,889,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,35,290,616,919,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,40,320,646,949,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,45,350,676,979,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,50,380,706,1009,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,55,410,736,1039,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,60,169,440,766,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,65,199,470,796,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,70,229,500,826,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,75,259,530,856,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,80,289,560,886,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,85,319,590,916,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,90,349,620,946,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,95,379,650,976,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,100,409,680,1006,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,105,439,710,1036,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,110,166,469,740,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,115,196,499,770,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,120,226,529,800,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,125,256,559,830,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,130,286,589,860,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,135,316,619,890,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,140,346,649,920,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,145,376,679,950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,127,406,709,980,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,132,436,739,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,137,466,769,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,142,170,496,799,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,147,200,526,829,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,25,230,556,859,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,16,80,157,286,390,587,748,875,996,1053,1120,1230,1350,1359},
-{13,21,85,183,187,250,316,360,420,480,489,617,778,905,1026},
-{18,26,90,156,213,217,280,346,390,450,510,519,647,808,935},
-{23,31,95,186,243,247,310,376,420,480,540,549,677,838,965},
-{28,36,100,216,273,277,340,406,450,510,570,579,707,868,995},
-{33,41,105,246,303,307,370,436,480,540,600,609,737,898,1025},
-{38,46,110,155,276,333,337,400,466,510,570,630,639,767,928},
-{43,51,115,185,306,363,367,430,496,540,600,660,669,797,958},
-{48,56,120,215,336,393,397,460,526,570,630,690,699,827,988},
-{53,61,125,245,366,423,427,490,556,600,660,720,729,857,1018},
-{58,66,130,275,396,453,457,520,586,630,690,750,759,887,1048},
-{63,71,135,178,305,426,483,487,550,616,660,720,780,789,917},
-{68,76,140,208,335,456,513,517,580,646,690,750,810,819,947},
-{73,81,145,238,365,486,543,547,610,676,720,780,840,849,977},
-{0,78,86,268,395,516,573,577,640,706,750,810,870,879,1007},
-{5,83,91,298,425,546,603,607,670,736,780,840,900,909,1037},
-{10,88,96,167,328,455,576,633,637,700,766,810,870,930,939},
-{15,93,101,197,358,485,606,663,667,730,796,840,900,960,969},
-{20,98,106,227,388,515,636,693,697,760,826,870,930,990,999},
-{25,103,111,257,418,545,666,723,727,790,856,900,960,1020,1029},
-{30,108,116,150,159,287,448,575,696,753,757,820,886,930,990},
-{35,113,121,180,189,317,478,605,726,783,787,850,916,960,1020},
-{40,118,126,150,210,219,347,508,635,756,813,817,880,946,990},
-{45,123,131,180,240,249,377,538,665,786,843,847,910,976,1020},
-{50,128,136,150,210,270,279,407,568,695,816,873,877,940,1006},
-{55,133,141,180,240,300,309,437,598,725,846,903,907,970,1036},
-{60,138,146,166,210,270,330,339,467,628,755,876,933,937,1000},
-{1,65,143,196,240,300,360,369,497,658,785,906,963,967,1030},
-{6,70,148,160,226,270,330,390,399,527,688,815,936,993,997},
-{3,11,75,190,256,300,360,420,429,557,718,845,966,1023,1027},
-{3,37,63,95,137,169,246,289,857,991,-1,-1,-1,-1,-1},
-{8,42,68,100,142,199,276,319,887,1021,-1,-1,-1,-1,-1},
-{13,47,73,105,147,151,229,306,349,917,-1,-1,-1,-1,-1},
-{2,18,52,78,110,181,259,336,379,947,-1,-1,-1,-1,-1},
-{7,23,57,83,115,211,289,366,409,977,-1,-1,-1,-1,-1},
-{12,28,62,88,120,241,319,396,439,1007,-1,-1,-1,-1,-1},
-{17,33,67,93,125,271,349,426,469,1037,-1,-1,-1,-1,-1},
-{22,38,72,98,130,167,301,379,456,499,-1,-1,-1,-1,-1},
-{27,43,77,103,135,197,331,409,486,529,-1,-1,-1,-1,-1},
-{32,48,82,108,140,227,361,439,516,559,-1,-1,-1,-1,-1},
-{37,53,87,113,145,257,391,469,546,589,-1,-1,-1,-1,-1},
-{0,42,58,92,118,287,421,499,576,619,-1,-1,-1,-1,-1},
-{5,47,63,97,123,317,451,529,606,649,-1,-1,-1,-1,-1},
-{10,52,68,102,128,347,481,559,636,679,-1,-1,-1,-1,-1},
-{15,57,73,107,133,377,511,589,666,709,-1,-1,-1,-1,-1},
-{20,62,78,112,138,407,541,619,696,739,-1,-1,-1,-1,-1},
-{25,67,83,117,143,437,571,649,726,769,-1,-1,-1,-1,-1},
-{30,72,88,122,148,467,601,679,756,799,-1,-1,-1,-1,-1},
-{3,35,77,93,127,497,631,709,786,829,-1,-1,-1,-1,-1},
-{8,40,82,98,132,527,661,739,816,859,-1,-1,-1,-1,-1},
-{13,45,87,103,137,557,691,769,846,889,-1,-1,-1,-1,-1},
-{18,50,92,108,142,587,721,799,876,919,-1,-1,-1,-1,-1},
-{23,55,97,113,147,617,751,829,906,949,-1,-1,-1,-1,-1},
-{2,28,60,102,118,647,781,859,936,979,-1,-1,-1,-1,-1},
-{7,33,65,107,123,677,811,889,966,1009,-1,-1,-1,-1,-1},
-{12,38,70,112,128,707,841,919,996,1039,-1,-1,-1,-1,-1},
-{17,43,75,117,133,169,737,871,949,1026,-1,-1,-1,-1,-1},
-{22,48,80,122,138,156,199,767,901,979,-1,-1,-1,-1,-1},
-{27,53,85,127,143,186,229,797,931,1009,-1,-1,-1,-1,-1},
-{32,58,90,132,148,216,259,827,961,1039,-1,-1,-1,-1,-1},
-{9,65,250,478,698,875,995,1050,1200,1358,-1,-1,-1,-1,-1},
-{14,70,180,280,330,488,508,728,905,1025,-1,-1,-1,-1,-1},
-{19,75,155,210,310,360,518,538,758,935,-1,-1,-1,-1,-1},
-{24,80,185,240,340,390,548,568,788,965,-1,-1,-1,-1,-1},
-{29,85,215,270,370,420,578,598,818,995,-1,-1,-1,-1,-1},
-{34,90,245,300,400,450,608,628,848,1025,-1,-1,-1,-1,-1},
-{39,95,155,275,330,430,480,638,658,878,-1,-1,-1,-1,-1},
-{44,100,185,305,360,460,510,668,688,908,-1,-1,-1,-1,-1},
-{49,105,215,335,390,490,540,698,718,938,-1,-1,-1,-1,-1},
-{54,110,245,365,420,520,570,728,748,968,-1,-1,-1,-1,-1},
-{59,115,275,395,450,550,600,758,778,998,-1,-1,-1,-1,-1},
-{64,120,305,425,480,580,630,788,808,1028,-1,-1,-1,-1,-1},
-{69,125,158,335,455,510,610,660,818,838,-1,-1,-1,-1,-1},
-{74,130,188,365,485,540,640,690,848,868,-1,-1,-1,-1,-1},
-{79,135,218,395,515,570,670,720,878,898,-1,-1,-1,-1,-1},
-{84,140,248,425,545,600,700,750,908,928,-1,-1,-1,-1,-1},
-{89,145,278,455,575,630,730,780,938,958,-1,-1,-1,-1,-1},
-{0,94,308,485,605,660,760,810,968,988,-1,-1,-1,-1,-1},
-{5,99,338,515,635,690,790,840,998,1018,-1,-1,-1,-1,-1},
-{10,104,368,545,665,720,820,870,1028,1048,-1,-1,-1,-1,-1},
-{0,1,15,109,158,178,398,575,695,750,850,900,-1,-1,-1},
-{1,2,20,114,188,208,428,605,725,780,880,930,-1,-1,-1},
-{2,3,25,119,218,238,458,635,755,810,910,960,-1,-1,-1},
-{3,4,30,124,248,268,488,665,785,840,940,990,-1,-1,-1},
-{4,5,35,129,278,298,518,695,815,870,970,1020,-1,-1,-1},
-{5,6,40,134,150,308,328,548,725,845,900,1000,-1,-1,-1},
-{6,7,45,139,180,338,358,578,755,875,930,1030,-1,-1,-1},
-{7,8,50,144,160,210,368,388,608,785,905,960,-1,-1,-1},
-{8,9,55,149,190,240,398,418,638,815,935,990,-1,-1,-1},
-{4,9,10,60,220,270,428,448,668,845,965,1020,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{158,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{166,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{167,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{183,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{184,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{186,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{187,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{188,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{189,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{196,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{197,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{198,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{200,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{203,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{208,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{210,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{211,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{212,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{213,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{215,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{216,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{218,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{219,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{220,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{221,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{227,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{229,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{230,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{231,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{232,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{233,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{234,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{236,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{237,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{238,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{239,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{240,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{241,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{242,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{243,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{245,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{250,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{251,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{252,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{255,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{256,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{265,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{266,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{267,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{268,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{269,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{270,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{271,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{272,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{274,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{277,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{279,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{280,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{281,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{282,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{283,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{284,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{285,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{286,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{287,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{288,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{289,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{290,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{291,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{292,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{293,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{294,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{296,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{297,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{298,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{300,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{301,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{302,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{303,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{304,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{306,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{307,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{308,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{309,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{310,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{311,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{312,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{313,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{314,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{315,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{318,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{319,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{320,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{321,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{328,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{329,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{330,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{331,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{332,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{333,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{334,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{335,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{336,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{337,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{338,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{339,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{343,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{345,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{346,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{347,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{348,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{349,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{350,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{351,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{352,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{354,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{355,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{356,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{357,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{358,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{359,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{361,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{362,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{363,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{364,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{365,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{366,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{367,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{368,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{369,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{370,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{371,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{372,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{373,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{374,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{375,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{376,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{377,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{378,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{379,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{380,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{381,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{382,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{383,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{384,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{385,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{386,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{387,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{388,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{389,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{390,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{393,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{394,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{395,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{396,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{397,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{398,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{399,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{400,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{401,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{402,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{403,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{405,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{406,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{407,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{408,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{410,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{411,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{412,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{413,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{414,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{415,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{416,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{417,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{418,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{419,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{420,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{421,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{422,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{423,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{424,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{425,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{426,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{427,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{428,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{429,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{430,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{431,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{432,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{433,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{434,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{435,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{436,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{437,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{438,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{440,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{441,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{442,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{443,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{444,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{445,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{446,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{447,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{448,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{449,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{451,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{452,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{453,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{454,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{455,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{456,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{457,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{458,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{459,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{460,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{461,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{462,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{463,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{464,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{465,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{466,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{467,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{468,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{469,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{471,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{472,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{473,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{474,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{475,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{476,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{477,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{478,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{479,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{480,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{481,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{482,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{483,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{484,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{485,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{486,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{487,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{488,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{489,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{490,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{491,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{493,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{494,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{495,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{496,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{497,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{498,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{499,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{500,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{501,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{504,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{505,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{507,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{508,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{509,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{510,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{511,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{512,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{513,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{514,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{516,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{517,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{518,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{519,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{520,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{521,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{522,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{523,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{524,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{525,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{526,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{527,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{528,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{529,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{531,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{532,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{533,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{534,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{535,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{536,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{537,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{538,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{539,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{540,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{541,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{542,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{543,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{544,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{545,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{546,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{547,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{548,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{549,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{550,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{551,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{552,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{553,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{554,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{555,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{556,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{557,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{558,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{559,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{560,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{561,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{562,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{563,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{564,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{565,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{572,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{573,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{574,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{575,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{576,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{577,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{580,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{581,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{583,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{584,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{587,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{588,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{589,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{590,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{591,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{592,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{593,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{594,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{595,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{596,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{597,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{598,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{599,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{600,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{601,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{602,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{603,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{604,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{605,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{606,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{607,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{608,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{609,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{610,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{611,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{612,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{613,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{614,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{615,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{616,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{617,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{618,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{619,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{620,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{621,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{622,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{623,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{624,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{625,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{626,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{627,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{628,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{629,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{630,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{631,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{632,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{633,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{634,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{635,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{636,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{637,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{638,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{639,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{640,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{641,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{642,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{643,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{644,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{645,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{646,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{647,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{648,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{649,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{650,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{651,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{652,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{653,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{654,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{655,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{656,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{657,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{658,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{659,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{660,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{661,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{662,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{663,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{664,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{665,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{666,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{667,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{668,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{669,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{670,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{671,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{672,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{673,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{674,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{675,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{676,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{677,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{678,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{679,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{680,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{681,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{682,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{683,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{684,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{685,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{686,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{687,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{688,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{689,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{690,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{691,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{692,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{693,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{694,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{695,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{696,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{697,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{698,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{699,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{700,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{701,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{702,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{703,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{704,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{705,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{706,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{707,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{708,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{709,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{710,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{711,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{712,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{713,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{714,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{715,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{716,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{717,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{718,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{719,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{720,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{721,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{722,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{723,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{724,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{725,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{726,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{727,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{728,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{729,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{730,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{731,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{732,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{733,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{734,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{735,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{736,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{737,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{738,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{739,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{740,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{741,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{742,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{743,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{744,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{745,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{746,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{747,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{748,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{749,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{750,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{751,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{752,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{753,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{754,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{755,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{756,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{757,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{758,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{759,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{760,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{761,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{762,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{763,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{764,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{765,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{766,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{767,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{768,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{769,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{770,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{771,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{772,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{773,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{774,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{775,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{776,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{777,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{778,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{779,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{780,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{781,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{782,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{783,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{784,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{785,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{786,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{787,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{788,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{789,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{790,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{791,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{792,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{793,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{794,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{795,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{796,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{797,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{798,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{799,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{800,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{801,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{802,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{803,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{804,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{805,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{806,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{807,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{808,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{809,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{810,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{811,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{812,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{813,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{814,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{815,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{816,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{817,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{818,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{819,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{820,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{821,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{822,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{823,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{824,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{825,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{826,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{827,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{828,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{829,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{830,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{831,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{832,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{833,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{834,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{835,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{836,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{837,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{838,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{839,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{840,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{841,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{842,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{843,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{844,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{845,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{846,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{847,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{848,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{849,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{850,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{851,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{852,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{853,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{854,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{855,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{856,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{857,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{858,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{859,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{860,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{861,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{862,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{863,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{864,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{865,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{866,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{867,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{868,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{869,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{870,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{871,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{872,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{873,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{874,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{875,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{876,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{877,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{878,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{879,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{880,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{881,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{882,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{883,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{884,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{885,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{886,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{887,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{888,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{889,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{890,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{891,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{892,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{893,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{894,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{895,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{896,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{897,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{898,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{899,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{900,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{901,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{902,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{903,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{904,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{905,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{906,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{907,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{908,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{909,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{910,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{911,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{912,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{913,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{914,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{915,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{916,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{917,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{918,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{919,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{920,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{921,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{922,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{923,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{924,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{925,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{926,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{927,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{928,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{929,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{930,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{931,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{932,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{933,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{934,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{935,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{936,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{937,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{938,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{939,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{940,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{941,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{942,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{943,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{944,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{945,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{946,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{947,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{948,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{949,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{951,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{952,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{953,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{954,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{955,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{956,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{957,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{958,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{959,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{960,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{961,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{962,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{963,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{964,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{965,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{966,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{967,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{968,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{969,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{970,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{971,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{972,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{973,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{974,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{975,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{976,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{977,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{978,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{979,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{980,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{981,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{982,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{983,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{984,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{985,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{986,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{987,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{988,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{989,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{990,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{991,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{992,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{993,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{994,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{995,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{996,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{997,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{998,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{999,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1000,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1001,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1002,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1003,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1004,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1005,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1006,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1007,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1008,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1009,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1010,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1011,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1012,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1013,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1014,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1015,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1016,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1017,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1018,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1019,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1020,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1021,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1022,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1023,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1024,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1025,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1026,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1027,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1028,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1029,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1030,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1031,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1032,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1033,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1034,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1035,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1036,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1037,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1038,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1039,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1040,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1041,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1042,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1043,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1044,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1045,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1046,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1047,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1048,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1049,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1050,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1051,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1052,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1053,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1054,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1055,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1056,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1057,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1058,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1059,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1060,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1061,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1062,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1063,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1064,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1065,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1066,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1067,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1068,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1069,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1070,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1071,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1072,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1073,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1074,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1075,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1076,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1077,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1078,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1079,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1080,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1081,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1082,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1083,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1084,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1085,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1086,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1087,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1088,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1089,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1090,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1091,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1092,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1093,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1094,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1095,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1096,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1097,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1098,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1099,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1101,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1102,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1103,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1104,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1105,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1106,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1107,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1108,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1109,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1110,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1113,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1114,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1115,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1117,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1118,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1119,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1120,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1121,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1122,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1123,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1124,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1125,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1126,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1127,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1128,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1129,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1130,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1131,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1132,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1133,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1135,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1136,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1137,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1138,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1139,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1140,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1141,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1142,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1144,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1145,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1146,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1147,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1148,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1149,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1150,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1151,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1152,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1155,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1156,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1157,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1158,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1159,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1160,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1161,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1162,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1163,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1164,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1165,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1166,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1167,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1168,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1169,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1170,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1171,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1172,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1173,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1174,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1175,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1176,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1177,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1178,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1179,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1180,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1181,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1182,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1183,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1184,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1185,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1186,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1187,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1188,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1189,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1190,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1191,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1192,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1193,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1194,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1195,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1196,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1197,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1198,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1199,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1200,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1201,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1202,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1203,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1204,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1205,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1206,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1207,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1208,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1209,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1210,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1211,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1212,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1213,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1214,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1215,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1216,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1217,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1218,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1219,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1220,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1221,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1222,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1223,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1224,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1225,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1226,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1227,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1228,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1229,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1230,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1231,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1232,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1233,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1234,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1235,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1236,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1237,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1238,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1239,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1240,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1241,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1242,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1243,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1244,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1245,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1246,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1247,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1248,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1249,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1250,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1251,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1252,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1253,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1254,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1255,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1256,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1257,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1258,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1259,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1260,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1261,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1262,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1263,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1264,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1265,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1266,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1267,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1268,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1269,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1270,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1271,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1272,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1273,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1274,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1275,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1276,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1277,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1278,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1279,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1280,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1281,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1282,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1283,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1284,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1285,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1286,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1287,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1288,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1289,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1290,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1291,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1292,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1293,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1294,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1295,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1296,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1297,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1298,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1299,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1300,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1301,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1302,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1303,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1304,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1305,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1306,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1307,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1308,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1309,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1310,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1311,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1312,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1313,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1314,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1315,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1316,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1317,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1318,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1319,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1320,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1321,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1322,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1323,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1324,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1325,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1326,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1327,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1328,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1329,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1330,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1331,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1332,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1333,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1334,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1335,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1336,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1337,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1338,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1339,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1340,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1341,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1342,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1343,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1344,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1345,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1346,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1347,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1348,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1349,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1350,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1351,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1352,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1353,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1354,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1355,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1356,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1357,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1358,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1359,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1360,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1361,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1362,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1363,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1364,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1365,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1366,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1367,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1368,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1369,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1370,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1371,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1372,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1373,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1374,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1375,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1376,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1377,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1378,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1379,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1380,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1381,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1382,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1383,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1384,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1385,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1386,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1387,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1388,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1389,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1390,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1391,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1392,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1393,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1394,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1395,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1396,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1397,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1398,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1399,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_met_nGroups_2_16=212;
+int mercury_met_QCbase_2_16[2339]={
+1,5,6,85,444,737,762,800,1250,
+1,5,6,90,380,474,767,792,830,
+1,5,6,95,410,504,797,822,860,
+1,5,6,100,440,534,827,852,890,
+1,5,6,105,470,564,857,882,920,
+1,5,6,110,500,594,887,912,950,
+1,5,6,115,530,624,917,942,980,
+1,5,6,120,560,654,947,972,1010,
+1,5,6,125,590,684,977,1002,1040,
+1,5,6,130,170,620,714,1007,1032,
+1,5,6,135,162,200,650,744,1037,
+1,5,6,140,167,192,230,680,774,
+1,1255,6,145,197,222,260,710,804,
+1,5,6,0,227,252,290,740,834,
+1,5,6,5,257,282,320,770,864,
+1,5,6,10,287,312,350,800,894,
+1,5,6,15,317,342,380,830,924,
+1,5,6,20,347,372,410,860,954,
+1,5,6,25,377,402,440,890,984,
+1,5,6,30,407,432,470,920,1014,
+1,5,6,35,437,462,500,950,1044,
+1,5,6,40,174,467,492,530,980,
+1,5,6,45,204,497,522,560,1010,
+1,5,6,50,234,527,552,590,1040,
+1,5,6,55,170,264,557,582,620,
+1,5,6,60,200,294,587,612,650,
+1,5,6,65,230,324,617,642,680,
+1,5,6,70,260,354,647,672,710,
+1,5,6,75,290,384,677,702,740,
+1,0,6,80,320,414,707,732,770,
+1,5,5,10,52,66,150,219,
+1,5,5,15,57,71,180,249,
+1,5,5,20,62,76,210,279,
+1,5,5,25,67,81,240,309,
+1,5,5,30,72,86,270,339,
+1,5,5,35,77,91,300,369,
+1,5,5,40,82,96,330,399,
+1,5,5,45,87,101,360,429,
+1,5,5,50,92,106,390,459,
+1,5,5,55,97,111,420,489,
+1,5,5,60,102,116,450,519,
+1,5,5,65,107,121,480,549,
+1,5,5,70,112,126,510,579,
+1,5,5,75,117,131,540,609,
+1,5,5,80,122,136,570,639,
+1,5,5,85,127,141,600,669,
+1,1311,5,90,132,146,630,699,
+1,5,5,1,95,137,660,729,
+1,5,5,6,100,142,690,759,
+1,1391,5,11,105,147,720,789,
+1,5,5,2,16,110,750,819,
+1,5,5,7,21,115,780,849,
+1,5,5,12,26,120,810,879,
+1,5,5,17,31,125,840,909,
+1,5,5,22,36,130,870,939,
+1,5,5,27,41,135,900,969,
+1,5,5,32,46,140,930,999,
+1,1363,5,37,51,145,960,1029,
+1,5,5,0,42,56,159,990,
+1,0,5,5,47,61,189,1020,
+1,5,5,5,16,500,720,950,
+1,5,5,10,21,530,750,980,
+1,5,5,15,26,560,780,1010,
+1,5,5,20,31,590,810,1040,
+1,5,5,25,36,170,620,840,
+1,5,5,30,41,200,650,870,
+1,5,5,35,46,230,680,900,
+1,5,5,40,51,260,710,930,
+1,5,5,45,56,290,740,960,
+1,5,5,50,61,320,770,990,
+1,5,5,55,66,350,800,1020,
+1,5,5,60,71,150,380,830,
+1,5,5,65,76,180,410,860,
+1,5,5,70,81,210,440,890,
+1,5,5,75,86,240,470,920,
+1,5,5,80,91,270,500,950,
+1,5,5,85,96,300,530,980,
+1,5,5,90,101,330,560,1010,
+1,5,5,95,106,360,590,1040,
+1,5,5,100,111,170,390,620,
+1,5,5,105,116,200,420,650,
+1,5,5,110,121,230,450,680,
+1,5,5,115,126,260,480,710,
+1,5,5,120,131,290,510,740,
+1,5,5,125,136,320,540,770,
+1,5,5,130,141,350,570,800,
+1,1266,5,135,146,380,600,830,
+1,5,5,1,140,410,630,860,
+1,1394,5,6,145,440,660,890,
+1,7,5,0,11,470,690,920,
+1,5,5,7,30,260,586,889,
+1,5,5,12,35,290,616,919,
+1,5,5,17,40,320,646,949,
+1,5,5,22,45,350,676,979,
+1,5,5,27,50,380,706,1009,
+1,5,5,32,55,410,736,1039,
+1,5,5,37,60,169,440,766,
+1,5,5,42,65,199,470,796,
+1,5,5,47,70,229,500,826,
+1,5,5,52,75,259,530,856,
+1,5,5,57,80,289,560,886,
+1,5,5,62,85,319,590,916,
+1,5,5,67,90,349,620,946,
+1,5,5,72,95,379,650,976,
+1,5,5,77,100,409,680,1006,
+1,5,5,82,105,439,710,1036,
+1,5,5,87,110,166,469,740,
+1,5,5,92,115,196,499,770,
+1,5,5,97,120,226,529,800,
+1,5,5,102,125,256,559,830,
+1,5,5,107,130,286,589,860,
+1,5,5,112,135,316,619,890,
+1,5,5,117,140,346,649,920,
+1,1278,5,122,145,376,679,950,
+1,5,5,0,127,406,709,980,
+1,5,5,5,132,436,739,1010,
+1,5,5,10,137,466,769,1040,
+1,5,5,15,142,170,496,799,
+1,1382,5,20,147,200,526,829,
+1,0,5,2,25,230,556,859,
+1,5,15,8,16,80,157,286,390,587,748,875,996,1053,1120,1230,1350,1359,
+1,5,15,13,21,85,183,187,250,316,360,420,480,489,617,778,905,1026,
+1,5,15,18,26,90,156,213,217,280,346,390,450,510,519,647,808,935,
+1,5,15,23,31,95,186,243,247,310,376,420,480,540,549,677,838,965,
+1,5,15,28,36,100,216,273,277,340,406,450,510,570,579,707,868,995,
+1,5,15,33,41,105,246,303,307,370,436,480,540,600,609,737,898,1025,
+1,5,15,38,46,110,155,276,333,337,400,466,510,570,630,639,767,928,
+1,5,15,43,51,115,185,306,363,367,430,496,540,600,660,669,797,958,
+1,5,15,48,56,120,215,336,393,397,460,526,570,630,690,699,827,988,
+1,5,15,53,61,125,245,366,423,427,490,556,600,660,720,729,857,1018,
+1,5,15,58,66,130,275,396,453,457,520,586,630,690,750,759,887,1048,
+1,5,15,63,71,135,178,305,426,483,487,550,616,660,720,780,789,917,
+1,5,15,68,76,140,208,335,456,513,517,580,646,690,750,810,819,947,
+1,1327,15,73,81,145,238,365,486,543,547,610,676,720,780,840,849,977,
+1,5,15,0,78,86,268,395,516,573,577,640,706,750,810,870,879,1007,
+1,5,15,5,83,91,298,425,546,603,607,670,736,780,840,900,909,1037,
+1,5,15,10,88,96,167,328,455,576,633,637,700,766,810,870,930,939,
+1,5,15,15,93,101,197,358,485,606,663,667,730,796,840,900,960,969,
+1,5,15,20,98,106,227,388,515,636,693,697,760,826,870,930,990,999,
+1,5,15,25,103,111,257,418,545,666,723,727,790,856,900,960,1020,1029,
+1,5,15,30,108,116,150,159,287,448,575,696,753,757,820,886,930,990,
+1,5,15,35,113,121,180,189,317,478,605,726,783,787,850,916,960,1020,
+1,5,15,40,118,126,150,210,219,347,508,635,756,813,817,880,946,990,
+1,5,15,45,123,131,180,240,249,377,538,665,786,843,847,910,976,1020,
+1,5,15,50,128,136,150,210,270,279,407,568,695,816,873,877,940,1006,
+1,5,15,55,133,141,180,240,300,309,437,598,725,846,903,907,970,1036,
+1,1341,15,60,138,146,166,210,270,330,339,467,628,755,876,933,937,1000,
+1,5,15,1,65,143,196,240,300,360,369,497,658,785,906,963,967,1030,
+1,1397,15,6,70,148,160,226,270,330,390,399,527,688,815,936,993,997,
+1,0,15,3,11,75,190,256,300,360,420,429,557,718,845,966,1023,1027,
+1,5,10,3,37,63,95,137,169,246,289,857,991,
+1,5,10,8,42,68,100,142,199,276,319,887,1021,
+1,1389,10,13,47,73,105,147,151,229,306,349,917,
+1,5,10,2,18,52,78,110,181,259,336,379,947,
+1,5,10,7,23,57,83,115,211,289,366,409,977,
+1,5,10,12,28,62,88,120,241,319,396,439,1007,
+1,5,10,17,33,67,93,125,271,349,426,469,1037,
+1,5,10,22,38,72,98,130,167,301,379,456,499,
+1,5,10,27,43,77,103,135,197,331,409,486,529,
+1,5,10,32,48,82,108,140,227,361,439,516,559,
+1,1363,10,37,53,87,113,145,257,391,469,546,589,
+1,5,10,0,42,58,92,118,287,421,499,576,619,
+1,5,10,5,47,63,97,123,317,451,529,606,649,
+1,5,10,10,52,68,102,128,347,481,559,636,679,
+1,5,10,15,57,73,107,133,377,511,589,666,709,
+1,5,10,20,62,78,112,138,407,541,619,696,739,
+1,5,10,25,67,83,117,143,437,571,649,726,769,
+1,1373,10,30,72,88,122,148,467,601,679,756,799,
+1,5,10,3,35,77,93,127,497,631,709,786,829,
+1,5,10,8,40,82,98,132,527,661,739,816,859,
+1,5,10,13,45,87,103,137,557,691,769,846,889,
+1,5,10,18,50,92,108,142,587,721,799,876,919,
+1,1379,10,23,55,97,113,147,617,751,829,906,949,
+1,5,10,2,28,60,102,118,647,781,859,936,979,
+1,5,10,7,33,65,107,123,677,811,889,966,1009,
+1,5,10,12,38,70,112,128,707,841,919,996,1039,
+1,5,10,17,43,75,117,133,169,737,871,949,1026,
+1,5,10,22,48,80,122,138,156,199,767,901,979,
+1,5,10,27,53,85,127,143,186,229,797,931,1009,
+1,1377,10,32,58,90,132,148,216,259,827,961,1039,
+1,5,10,9,65,250,478,698,875,995,1050,1200,1358,
+1,5,10,14,70,180,280,330,488,508,728,905,1025,
+1,5,10,19,75,155,210,310,360,518,538,758,935,
+1,5,10,24,80,185,240,340,390,548,568,788,965,
+1,5,10,29,85,215,270,370,420,578,598,818,995,
+1,5,10,34,90,245,300,400,450,608,628,848,1025,
+1,5,10,39,95,155,275,330,430,480,638,658,878,
+1,5,10,44,100,185,305,360,460,510,668,688,908,
+1,5,10,49,105,215,335,390,490,540,698,718,938,
+1,5,10,54,110,245,365,420,520,570,728,748,968,
+1,5,10,59,115,275,395,450,550,600,758,778,998,
+1,5,10,64,120,305,425,480,580,630,788,808,1028,
+1,5,10,69,125,158,335,455,510,610,660,818,838,
+1,5,10,74,130,188,365,485,540,640,690,848,868,
+1,5,10,79,135,218,395,515,570,670,720,878,898,
+1,5,10,84,140,248,425,545,600,700,750,908,928,
+1,1311,10,89,145,278,455,575,630,730,780,938,958,
+1,5,10,0,94,308,485,605,660,760,810,968,988,
+1,5,10,5,99,338,515,635,690,790,840,998,1018,
+1,0,10,10,104,368,545,665,720,820,870,1028,1048,
+1,1,12,0,1,15,109,158,178,398,575,695,750,850,900,
+1,1,12,1,2,20,114,188,208,428,605,725,780,880,930,
+1,1,12,2,3,25,119,218,238,458,635,755,810,910,960,
+1,1,12,3,4,30,124,248,268,488,665,785,840,940,990,
+1,1,12,4,5,35,129,278,298,518,695,815,870,970,1020,
+1,1,12,5,6,40,134,150,308,328,548,725,845,900,1000,
+1,1,12,6,7,45,139,180,338,358,578,755,875,930,1030,
+1,1,12,7,8,50,144,160,210,368,388,608,785,905,960,
+1,1396,12,8,9,55,149,190,240,398,418,638,815,935,990,
+1,0,12,4,9,10,60,220,270,428,448,668,845,965,1020,
+139,1,2,10,11,
+1251,1,1,149};
@@ -25,2010 +25,287 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_14_16.h"
-int mercury_normal_Cwidth_14_16=46;
-int mercury_normal_Vwidth_14_16=6;
-int mercury_normal_dwidth_14_16=418;
-int mercury_normal_QCmatrixd_14_16[418]={10,5,5,6,10,5,5,4,5,5,5,6,5,3,10,4,5,3,5,5,5,3,5,6,5,5,5,4,10,6,5,4,5,6,10,4,5,6,5,4,5,3,5,5,5,3,10,5,20,6,5,3,5,6,5,5,5,3,5,5,15,3,5,4,5,6,10,4,5,3,5,6,5,5,5,6,10,3,5,4,5,3,5,6,5,3,10,6,5,5,10,6,5,5,5,3,5,5,5,3,5,6,10,4,5,6,5,4,5,5,10,3,5,6,5,3,5,5,5,3,5,4,5,3,5,6,5,3,5,6,15,5,5,3,5,6,5,5,10,3,5,6,5,3,10,4,15,3,5,5,5,6,5,5,15,3,10,4,10,6,5,5,5,3,5,4,5,3,5,5,5,4,5,5,5,3,5,4,5,3,5,6,5,3,5,4,10,3,5,5,10,4,5,5,5,4,5,5,5,4,5,3,5,5,5,4,5,5,5,4,5,3,10,6,5,5,10,3,5,5,5,4,5,6,5,5,5,4,10,5,10,4,5,6,5,5,5,4,10,5,10,6,5,3,5,5,5,6,5,4,5,3,10,5,5,6,10,5,10,4,5,3,5,5,10,4,5,3,15,5,5,6,5,5,5,6,5,4,15,5,5,3,5,6,5,5,15,4,5,6,5,4,5,5,5,6,5,4,5,6,15,5,5,3,5,4,5,3,5,5,5,4,10,5,5,4,10,6,5,3,5,4,10,5,5,4,5,5,20,4,5,5,5,6,5,4,5,3,5,6,20,4,10,6,5,4,5,6,10,4,5,5,20,3,10,5,5,6,5,3,5,4,5,3,5,4,5,6,5,5,5,6,5,5,5,4,25,3,10,6,5,4,5,5,5,4,5,5,5,4,5,3,10,4,5,5,5,4,5,3,15,4,5,5,5,4,20,3,5,5,5,4,5,6,199,2,1,1};
-int mercury_normal_QCmatrixC_14_16[200][46]={
-{63,349,369,377,748,787,829,856,893,1143,1178,1238,1276,1400,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,75,116,118,141,163,190,295,364,372,433,467,475,493,528,549,566,572,586,646,659,748,750,803,815,827,998,1006,1031,1180,1273,1284,1382,1384,1400,1401,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,16,21,53,157,168,186,190,300,320,710,794,798,874,982,1039,1197,1289,1309,1316,1354,1369,1401,1402,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,45,157,243,286,328,377,487,519,529,566,627,755,887,927,963,988,1063,1085,1197,1225,1238,1281,1402,1403,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,28,61,193,199,401,413,430,505,535,572,683,703,711,762,771,808,810,812,844,888,969,974,997,1055,1063,1082,1112,1125,1144,1172,1247,1276,1302,1311,1347,1360,1394,1403,1404,-1,-1,-1,-1,-1,-1},
-{109,112,142,246,249,252,258,335,366,406,427,483,490,491,543,559,566,606,615,624,628,650,660,687,721,723,727,766,810,907,1101,1158,1179,1213,1289,1295,1323,1328,1404,1405,-1,-1,-1,-1,-1,-1},
-{26,30,69,80,83,88,94,96,129,228,337,344,486,575,616,916,1008,1015,1072,1082,1091,1100,1133,1141,1150,1236,1405,1406,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,77,164,175,220,318,415,495,530,580,707,725,814,852,893,953,1078,1233,1268,1277,1406,1407,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,82,237,463,597,662,734,736,807,815,888,909,942,948,962,972,976,1029,1045,1049,1084,1110,1162,1221,1226,1248,1252,1291,1308,1365,1407,1408,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,20,87,139,165,266,276,301,326,475,528,603,702,865,876,941,959,1004,1032,1039,1135,1208,1252,1370,1408,1409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,163,254,279,434,439,500,526,633,786,787,790,795,809,817,923,966,1016,1109,1131,1149,1216,1290,1366,1377,1409,1410,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,219,297,307,308,438,456,490,524,545,546,569,588,592,598,764,806,817,878,887,986,1002,1023,1079,1116,1148,1167,1203,1257,1263,1352,1360,1410,1411,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,15,30,50,96,149,151,248,295,329,357,398,405,444,476,496,507,579,672,698,711,794,842,867,907,922,979,1023,1087,1138,1143,1153,1179,1190,1197,1205,1239,1242,1275,1281,1288,1294,1341,1411,1412,-1},
-{7,10,133,152,162,188,270,289,307,316,352,384,447,657,666,689,731,749,763,769,867,925,959,989,1029,1054,1057,1210,1237,1240,1243,1259,1412,1413,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,190,213,385,412,419,447,562,587,598,609,618,682,747,857,946,972,991,1008,1019,1074,1077,1099,1161,1318,1323,1413,1414,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,64,118,245,294,316,320,344,354,384,480,589,667,671,689,740,750,755,774,819,877,922,1006,1010,1136,1230,1280,1321,1346,1372,1381,1414,1415,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,38,40,47,87,100,194,256,273,281,291,311,378,410,472,481,524,675,681,704,763,830,897,914,949,961,1094,1128,1165,1204,1226,1399,1415,1416,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,123,145,200,207,262,266,273,307,363,393,406,456,510,577,625,639,715,719,773,809,856,891,909,911,922,953,997,1000,1089,1095,1120,1143,1154,1165,1188,1211,1220,1300,1303,1331,1395,1416,1417,-1,-1},
-{0,53,72,90,98,133,140,183,199,200,219,231,235,263,273,317,396,397,492,530,535,847,856,872,883,884,902,960,964,1060,1097,1163,1280,1417,1418,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,78,93,104,159,181,258,260,274,295,369,371,454,510,680,709,771,827,864,891,898,917,985,1014,1019,1098,1199,1229,1256,1260,1418,1419,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,70,137,153,209,236,515,560,651,726,761,781,796,835,849,877,947,1021,1053,1065,1086,1103,1110,1123,1155,1200,1214,1268,1340,1352,1419,1420,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,114,147,155,167,172,287,304,346,348,407,436,527,593,751,768,775,804,860,934,939,984,989,1051,1062,1138,1156,1191,1252,1278,1346,1420,1421,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,55,93,94,102,126,153,156,179,220,234,247,284,379,387,389,393,443,457,470,524,614,630,635,654,727,755,766,820,851,866,874,894,927,935,955,1023,1029,1215,1218,1271,1298,1324,1337,1421,1422},
-{119,136,176,197,210,264,286,291,328,333,339,518,533,642,666,850,913,1081,1114,1116,1163,1230,1244,1248,1326,1422,1423,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,100,225,378,735,749,788,820,830,857,894,1035,1144,1179,1239,1277,1305,1375,1423,1424,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,76,117,119,142,164,191,296,350,373,420,434,465,468,476,494,529,567,573,587,620,647,749,751,804,816,828,940,999,1007,1032,1181,1274,1330,1383,1424,1425,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,17,22,54,158,169,187,191,301,321,711,740,799,983,1135,1198,1317,1340,1425,1426,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,46,158,230,244,245,287,315,329,378,445,488,567,590,628,720,756,888,928,964,989,1030,1064,1086,1198,1226,1239,1282,1426,1427,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,62,194,402,405,414,431,506,536,573,645,684,704,712,715,763,772,809,811,813,889,975,998,1056,1064,1083,1113,1126,1173,1248,1277,1303,1312,1335,1348,1361,1427,1428,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,85,113,143,247,253,259,336,367,407,428,484,491,492,544,567,607,616,629,651,661,688,715,722,724,728,767,811,908,1102,1159,1205,1214,1260,1296,1324,1329,1428,1429,-1,-1,-1,-1,-1,-1,-1},
-{27,31,81,84,89,97,100,229,338,460,487,576,617,730,815,917,1009,1016,1070,1073,1083,1092,1101,1134,1142,1151,1237,1429,1430,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,78,95,100,176,221,319,325,416,420,496,531,581,708,726,755,853,894,954,1079,1190,1234,1269,1278,1430,1431,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,83,238,310,464,598,663,737,808,816,889,943,949,963,973,977,1046,1111,1163,1222,1227,1249,1253,1292,1309,1366,1431,1432,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,21,88,166,267,277,302,327,370,476,529,604,700,703,866,877,942,1033,1136,1209,1253,1280,1371,1432,1433,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,164,465,501,527,634,640,787,788,791,796,818,924,955,967,1017,1045,1132,1217,1291,1360,1367,1378,1433,1434,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,146,298,308,309,420,439,457,490,491,546,547,589,593,599,807,818,879,888,910,987,1003,1015,1024,1117,1149,1168,1204,1220,1258,1264,1353,1361,1434,1435,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,16,31,51,70,97,152,249,296,335,358,399,406,450,477,497,508,673,675,699,712,775,825,843,868,908,923,930,1024,1088,1139,1144,1154,1191,1198,1206,1243,1276,1282,1289,1330,1342,1435,1436,-1,-1},
-{8,11,90,134,153,163,189,215,271,308,317,330,340,353,448,658,660,667,732,764,865,868,880,926,970,1058,1211,1238,1241,1244,1436,1437,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,25,191,214,386,413,448,550,555,563,565,588,599,619,650,683,748,790,858,947,973,992,1009,1065,1078,1162,1245,1310,1315,1319,1324,1437,1438,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,39,115,119,215,246,317,321,410,481,668,672,741,751,756,878,923,1007,1011,1020,1055,1137,1231,1281,1322,1325,1347,1373,1382,1438,1439,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,39,41,48,88,101,165,257,274,280,282,292,312,355,379,411,473,482,600,676,682,710,764,810,831,898,962,1129,1166,1227,1390,1439,1440,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,30,75,124,146,201,208,263,267,274,308,364,394,407,457,511,535,578,626,710,716,774,775,857,892,912,923,954,998,1001,1010,1096,1121,1144,1166,1189,1212,1221,1301,1304,1332,1385,1396,1440,1441,-1},
-{1,54,73,91,99,134,141,184,201,232,236,264,274,300,318,397,398,485,493,531,536,848,857,873,884,903,961,1040,1061,1098,1164,1281,1375,1441,1442,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,79,94,110,182,210,215,259,261,296,372,511,681,772,780,828,892,899,918,986,1099,1257,1261,1355,1442,1443,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,115,138,154,237,516,561,652,660,727,745,762,775,782,797,835,836,845,878,948,1022,1054,1066,1087,1104,1111,1124,1156,1201,1269,1341,1353,1443,1444,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,110,148,150,156,168,173,288,347,349,408,437,510,528,594,645,680,695,752,769,776,861,880,1052,1063,1139,1157,1192,1230,1253,1279,1300,1347,1444,1445,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,56,94,103,127,154,157,221,248,270,380,388,394,405,444,458,471,631,636,660,685,728,756,767,821,852,867,915,928,936,956,965,1024,1216,1219,1272,1299,1338,1370,1445,1446,-1,-1,-1,-1,-1},
-{20,137,160,175,177,198,211,287,292,329,334,519,534,643,667,851,914,920,1082,1100,1117,1125,1140,1164,1225,1231,1249,1327,1446,1447,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,155,226,375,379,450,500,525,736,789,821,831,858,970,1036,1050,1278,1290,1300,1306,1376,1447,1448,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,77,118,143,192,225,250,297,351,374,421,466,469,477,535,568,574,588,621,648,752,817,829,940,941,1008,1033,1170,1182,1331,1384,1448,1449,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,18,23,159,188,192,302,322,555,685,712,741,880,984,1065,1090,1136,1199,1318,1341,1449,1450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,15,22,47,159,231,246,288,316,379,446,470,489,568,591,629,721,757,889,895,929,1031,1045,1087,1199,1227,1283,1450,1451,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,403,406,432,507,537,574,646,713,716,764,773,812,814,900,925,976,999,1057,1084,1114,1127,1174,1249,1278,1304,1313,1336,1349,1355,1362,1451,1452,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,70,80,86,114,144,248,254,337,368,408,429,492,493,568,608,617,652,662,689,716,723,729,768,812,845,909,1103,1206,1261,1270,1297,1385,1390,1452,1453,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,32,82,85,98,101,290,339,461,488,577,618,675,731,795,816,918,995,1017,1071,1074,1084,1093,1102,1143,1152,1238,1295,1305,1345,1453,1454,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,33,79,96,101,177,180,222,326,417,421,430,497,532,582,709,727,756,830,854,945,1030,1165,1191,1279,1454,1455,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,84,239,290,311,599,664,690,738,809,817,910,944,950,964,974,975,978,1047,1095,1112,1164,1180,1223,1228,1254,1293,1355,1367,1455,1456,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,89,167,268,278,303,328,360,371,477,585,701,704,730,867,878,935,943,1034,1137,1254,1281,1355,1372,1395,1456,1457,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,105,410,450,466,502,528,540,580,641,700,788,789,792,797,819,820,956,968,1018,1046,1133,1218,1292,1361,1368,1379,1457,1458,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,147,299,309,421,425,458,491,492,530,547,548,594,735,780,808,819,889,911,988,1004,1016,1118,1120,1145,1169,1221,1259,1330,1354,1362,1385,1458,1459,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,17,32,52,71,98,153,297,336,340,345,359,407,451,478,498,509,550,655,674,676,710,713,776,826,844,869,909,924,925,931,950,1040,1089,1192,1199,1207,1244,1277,1283,1331,1343,1395,1459,1460,-1},
-{9,12,91,154,164,216,240,272,309,318,331,341,354,365,449,450,535,560,625,659,661,668,733,745,866,869,881,900,927,971,1055,1059,1212,1239,1242,1460,1461,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,165,192,340,387,414,449,485,551,556,564,566,580,589,635,651,684,749,770,791,859,948,974,993,1065,1066,1079,1163,1246,1311,1316,1461,1462,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,36,65,116,120,216,247,318,322,411,482,640,669,673,742,752,757,879,924,1008,1012,1021,1056,1105,1130,1138,1155,1232,1282,1323,1326,1348,1374,1383,1462,1463,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,42,49,89,102,105,166,205,258,281,283,293,295,313,356,365,412,415,474,483,500,515,601,635,677,683,711,775,811,832,899,963,1125,1167,1228,1240,1391,1463,1464,-1,-1,-1,-1,-1,-1,-1},
-{8,31,76,147,200,202,209,235,264,268,309,330,408,458,512,536,560,579,627,711,717,776,790,858,893,913,924,990,999,1002,1011,1097,1110,1122,1167,1185,1213,1222,1290,1302,1315,1333,1386,1397,1464,1465},
-{2,74,92,142,202,233,237,301,319,398,399,435,486,494,532,537,845,849,858,874,900,904,962,1041,1062,1090,1099,1282,1376,1465,1466,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,183,211,216,262,297,373,465,485,512,570,682,773,781,829,893,919,987,1258,1262,1356,1466,1467,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,72,116,139,238,517,555,562,595,653,661,728,746,763,776,783,798,836,837,846,879,949,1023,1067,1088,1112,1157,1202,1342,1354,1385,1467,1468,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,105,111,149,151,157,169,174,240,289,348,409,438,440,511,529,530,646,681,696,753,777,862,881,990,1053,1064,1158,1193,1200,1231,1254,1301,1340,1348,1468,1469,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,104,128,158,222,249,271,275,381,389,406,459,472,632,637,661,686,729,757,768,822,853,868,916,920,929,937,957,966,1150,1200,1217,1265,1273,1275,1339,1371,1469,1470,-1,-1,-1,-1,-1,-1,-1},
-{21,138,161,176,178,199,212,288,293,330,390,395,644,668,740,852,921,1050,1083,1095,1101,1118,1126,1141,1226,1232,1328,1470,1471,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,156,227,305,376,400,415,451,501,526,737,822,832,859,971,1037,1051,1279,1291,1301,1307,1377,1471,1472,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,78,119,144,193,226,251,298,352,400,422,467,478,495,536,569,589,622,649,725,753,818,941,942,1009,1034,1120,1171,1183,1332,1472,1473,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,19,24,150,189,193,303,323,355,395,556,686,713,742,881,1066,1070,1091,1115,1137,1319,1342,1395,1473,1474,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,16,23,48,60,70,130,232,247,289,317,447,471,569,592,610,722,750,758,896,970,1032,1046,1088,1180,1228,1284,1474,1475,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,404,407,433,508,538,647,714,717,770,774,813,820,901,926,977,1058,1065,1128,1135,1279,1314,1337,1356,1363,1475,1476,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,71,81,87,240,249,338,369,409,493,494,569,609,618,653,663,675,717,724,769,813,846,1010,1104,1150,1207,1220,1262,1271,1298,1386,1390,1391,1476,1477,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,33,70,83,86,99,102,180,291,460,462,489,578,619,676,732,796,817,885,919,965,996,1018,1072,1094,1103,1144,1153,1185,1239,1296,1306,1346,1477,1478,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,34,97,102,178,181,223,327,395,418,422,431,498,533,583,728,757,831,946,1031,1166,1192,1360,1478,1479,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,180,291,300,312,585,630,691,739,818,880,911,935,951,960,976,979,1048,1096,1113,1145,1181,1224,1229,1294,1356,1368,1479,1480,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,168,225,265,269,279,304,329,340,361,372,478,586,702,731,835,840,868,870,879,936,944,1030,1075,1138,1282,1335,1356,1373,1396,1480,1481,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,140,320,385,411,451,467,503,529,541,581,642,701,789,793,798,821,957,969,1019,1047,1134,1219,1230,1293,1362,1369,1481,1482,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,35,45,52,60,148,210,280,300,325,422,426,459,492,493,531,548,549,650,680,736,781,809,825,912,989,1017,1119,1121,1146,1222,1331,1363,1385,1386,1482,1483,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,18,33,53,72,99,154,298,337,341,346,408,452,479,499,551,656,677,711,714,777,827,895,905,926,932,951,1041,1150,1193,1208,1278,1284,1332,1344,1396,1483,1484,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,15,92,120,185,217,241,273,319,332,342,366,451,530,536,561,626,662,669,720,734,746,867,882,901,928,972,980,1056,1190,1213,1225,1243,1484,1485,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,166,193,341,388,425,486,540,552,557,567,581,610,636,652,771,792,875,945,949,994,1066,1067,1164,1247,1312,1317,1485,1486,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,37,66,117,121,217,248,319,323,412,483,555,641,674,675,715,743,753,758,835,1009,1013,1022,1057,1106,1131,1139,1156,1233,1283,1285,1324,1327,1349,1384,1486,1487,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,103,106,167,206,259,282,284,294,296,314,357,366,413,416,450,460,484,501,516,602,610,620,630,636,678,684,705,712,776,790,800,812,833,964,1035,1055,1126,1168,1229,1241,1310,1325,1392,1487,1488},
-{9,32,77,148,201,203,236,269,331,409,459,513,537,561,628,635,712,718,740,750,777,791,859,870,894,914,991,1003,1012,1098,1111,1123,1168,1186,1214,1223,1291,1303,1316,1334,1387,1398,1488,1489,-1,-1},
-{3,75,93,130,143,170,203,234,238,302,399,436,487,533,538,605,846,859,890,901,963,1030,1042,1063,1091,1283,1325,1377,1489,1490,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,130,145,184,212,217,263,285,298,374,430,466,486,513,571,683,774,775,782,830,894,988,1190,1259,1263,1350,1357,1490,1491,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,73,117,239,420,495,518,550,556,563,596,654,662,690,729,747,764,777,784,799,837,838,847,1024,1068,1089,1113,1158,1203,1343,1386,1491,1492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,112,152,158,165,241,349,365,439,441,512,531,600,625,647,682,697,754,778,785,863,882,991,1054,1105,1115,1159,1194,1201,1232,1302,1341,1349,1492,1493,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,129,159,223,272,276,382,407,473,575,633,638,662,687,690,695,730,758,769,785,823,850,854,869,917,921,938,958,967,1090,1151,1201,1218,1266,1274,1276,1372,1493,1494,-1,-1,-1,-1,-1,-1,-1},
-{15,22,139,162,177,179,213,220,235,289,294,331,391,396,415,420,430,669,741,853,900,922,1051,1084,1096,1102,1119,1127,1130,1142,1227,1233,1329,1494,1495,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,103,120,157,170,228,306,350,377,401,416,452,495,502,527,615,738,765,820,823,833,972,1025,1038,1052,1200,1292,1302,1308,1378,1395,1495,1496,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,79,140,194,227,252,280,299,353,401,423,468,479,496,537,623,675,726,754,819,942,943,975,1005,1121,1170,1172,1184,1235,1295,1333,1496,1497,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,151,194,304,324,356,396,435,557,620,687,714,743,882,1067,1071,1092,1116,1138,1343,1396,1497,1498,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,17,24,49,61,71,131,175,233,248,280,310,318,448,472,593,611,665,723,751,759,897,971,980,1033,1040,1047,1089,1181,1229,1498,1499,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,240,408,434,509,539,545,648,655,670,718,735,771,814,821,902,927,930,955,978,1059,1066,1110,1129,1136,1195,1338,1357,1364,1499,1500,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,45,72,82,88,125,160,215,220,241,285,339,494,505,520,619,640,654,664,676,718,814,847,930,1011,1035,1151,1208,1221,1263,1272,1299,1387,1391,1392,1500,1501,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,40,71,84,87,103,181,235,292,350,461,463,579,610,677,733,797,818,860,886,966,997,1019,1073,1104,1154,1186,1297,1307,1347,1501,1502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,5,98,103,179,182,224,295,328,396,419,423,432,499,534,584,705,729,758,832,947,980,1032,1035,1165,1167,1193,1355,1361,1502,1503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,292,301,313,345,365,586,631,692,819,825,881,912,936,952,961,977,1049,1097,1114,1146,1182,1357,1369,1503,1504,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,169,226,266,341,360,362,373,479,545,587,655,703,732,836,841,869,871,937,1031,1076,1139,1280,1283,1336,1357,1374,1380,1397,1504,1505,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,141,321,386,412,452,468,504,542,582,643,702,790,794,799,822,870,958,1035,1048,1231,1285,1294,1305,1350,1363,1365,1505,1506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,36,46,53,61,149,211,281,301,326,423,427,493,494,515,525,532,549,651,681,737,782,826,913,1018,1122,1147,1223,1332,1364,1386,1387,1506,1507,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,19,34,54,73,195,299,338,342,347,409,453,552,657,678,712,778,828,840,896,906,927,933,952,965,970,1042,1140,1151,1194,1209,1279,1333,1390,1397,1507,1508,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,16,93,105,121,186,218,242,245,274,333,343,367,452,531,537,555,562,620,627,663,721,747,868,883,902,929,973,981,1057,1175,1191,1214,1226,1244,1285,1508,1509,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,65,90,125,167,194,340,342,389,426,487,541,553,558,568,582,611,637,653,772,793,876,946,1067,1068,1248,1313,1318,1509,1510,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,38,67,118,122,160,218,249,324,413,484,556,642,676,716,744,754,759,810,836,1014,1023,1058,1107,1132,1157,1234,1284,1286,1328,1510,1511,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,104,107,168,207,283,297,358,367,414,417,451,461,502,517,603,611,621,631,637,679,706,713,730,777,791,801,813,834,905,1025,1036,1045,1056,1080,1127,1169,1242,1311,1326,1393,1511,1512,-1,-1,-1},
-{33,78,135,149,202,204,237,332,514,538,562,629,636,713,719,741,751,778,792,871,955,992,1000,1004,1013,1035,1099,1112,1124,1169,1187,1224,1292,1304,1317,1388,1399,1512,1513,-1,-1,-1,-1,-1,-1,-1},
-{4,76,94,131,144,171,204,239,250,275,303,430,435,437,488,534,539,606,805,847,891,902,964,1031,1043,1064,1092,1105,1145,1284,1326,1378,1513,1514,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,131,146,213,215,218,264,286,299,431,467,487,514,520,565,572,684,760,776,783,831,989,1075,1191,1264,1351,1358,1514,1515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,74,118,145,325,421,440,496,519,551,557,564,575,597,663,691,748,778,790,838,839,848,975,1069,1114,1159,1175,1204,1235,1290,1344,1387,1515,1516,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,113,153,159,166,242,285,366,380,442,513,532,601,626,648,683,685,698,745,765,779,786,864,883,955,985,992,1025,1050,1106,1116,1202,1233,1255,1303,1342,1516,1517,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,224,273,277,383,408,415,474,576,605,634,639,663,688,691,696,731,759,786,824,851,918,922,939,959,968,1015,1070,1091,1095,1152,1202,1219,1267,1277,1373,1517,1518,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,23,60,163,178,214,221,236,290,332,340,350,380,392,397,416,421,431,585,685,742,770,815,854,901,923,1052,1097,1103,1128,1131,1143,1228,1234,1518,1519,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,104,121,158,171,190,229,307,351,378,402,417,453,496,503,520,528,616,700,739,766,821,824,834,910,945,973,1026,1039,1053,1090,1200,1201,1293,1303,1309,1379,1395,1396,1519,1520,-1,-1,-1,-1,-1},
-{42,141,228,253,281,354,402,424,469,497,538,624,635,676,715,727,805,905,943,944,976,1006,1085,1122,1150,1171,1173,1236,1296,1334,1520,1521,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,195,215,357,397,436,558,621,688,744,880,883,960,1068,1072,1093,1117,1139,1344,1397,1521,1522,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,18,62,72,100,132,155,176,234,249,270,281,311,319,365,449,450,473,594,612,666,705,724,752,860,898,972,981,1010,1015,1034,1041,1048,1182,1195,1225,1522,1523,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,176,205,241,409,546,649,656,671,719,736,772,822,845,903,928,931,956,979,1067,1111,1137,1196,1210,1339,1358,1523,1524,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,46,73,83,89,110,126,161,216,221,242,286,300,506,521,641,677,719,800,848,930,931,935,980,985,1012,1036,1152,1209,1222,1264,1273,1388,1392,1393,1524,1525,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,72,88,90,104,175,182,230,236,280,293,351,375,385,462,464,520,610,611,650,678,734,798,819,861,870,887,890,967,998,1025,1074,1187,1298,1308,1320,1348,1525,1526,-1,-1,-1,-1,-1,-1,-1},
-{3,6,99,104,115,183,260,296,329,335,397,424,433,706,759,833,948,981,1033,1036,1110,1166,1168,1194,1240,1356,1362,1526,1527,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,182,293,302,314,346,366,587,632,693,745,826,882,890,913,937,953,962,978,1098,1140,1147,1175,1183,1235,1358,1527,1528,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,160,227,267,342,361,363,374,430,490,525,546,588,656,704,733,745,800,837,842,872,938,995,1032,1077,1270,1281,1284,1337,1358,1381,1398,1528,1529,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,108,142,165,322,387,413,453,469,543,583,644,703,791,795,823,871,959,1036,1049,1232,1286,1306,1351,1364,1366,1529,1530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,37,47,54,62,212,240,282,302,325,327,424,428,494,516,526,533,652,682,738,783,827,914,960,985,1019,1060,1123,1148,1224,1235,1333,1387,1388,1530,1531,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,25,74,190,196,339,343,348,410,454,553,658,679,680,700,713,779,805,829,841,885,897,907,928,934,953,966,971,1043,1060,1141,1152,1334,1391,1398,1531,1532,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,94,106,122,187,219,243,246,255,334,344,368,453,480,532,538,540,556,563,621,625,628,664,720,722,748,869,884,903,974,982,1058,1155,1176,1192,1210,1227,1286,1320,1325,1532,1533,-1,-1,-1,-1},
-{29,66,80,85,91,126,168,225,341,343,427,488,542,554,559,569,583,612,638,654,773,794,877,947,1005,1068,1069,1130,1249,1314,1319,1533,1534,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,39,68,119,123,161,219,315,414,557,643,677,717,811,837,890,950,1024,1059,1075,1108,1133,1158,1230,1265,1287,1329,1534,1535,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,169,208,284,298,359,368,418,452,460,462,503,518,604,612,622,632,638,707,714,731,778,792,802,814,885,906,945,1026,1037,1046,1057,1081,1128,1243,1245,1305,1312,1327,1394,1535,1536,-1,-1,-1,-1},
-{5,34,79,136,203,238,333,525,539,563,600,637,714,742,752,779,793,872,956,993,1001,1014,1036,1113,1188,1205,1293,1318,1389,1536,1537,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,132,160,172,251,276,304,431,436,438,489,607,630,806,848,892,903,920,1032,1044,1093,1106,1146,1327,1379,1537,1538,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,132,147,214,216,219,287,305,432,435,468,488,521,566,573,585,595,761,777,784,832,875,1020,1076,1145,1192,1200,1260,1352,1359,1538,1539,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,119,146,245,326,395,422,441,497,552,558,576,598,664,692,695,749,779,791,839,849,976,1020,1135,1140,1150,1176,1236,1285,1291,1388,1539,1540,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,114,130,154,167,185,243,286,367,381,443,514,533,602,627,649,684,686,699,746,760,766,787,884,956,986,993,1026,1051,1107,1117,1203,1234,1240,1256,1304,1343,1540,1541,-1,-1,-1,-1,-1,-1,-1},
-{10,210,274,278,384,409,416,577,595,606,615,664,689,692,697,732,787,852,919,923,969,1005,1016,1071,1092,1096,1153,1203,1268,1278,1315,1320,1374,1541,1542,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,24,35,61,115,164,179,222,237,291,333,341,351,381,393,398,417,422,432,586,686,743,771,816,902,924,1053,1098,1104,1129,1132,1144,1229,1542,1543,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,87,122,159,172,191,270,308,352,375,379,403,418,454,497,504,521,529,617,701,760,767,822,911,946,974,1027,1054,1091,1125,1201,1202,1294,1304,1396,1397,1543,1544,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,120,142,229,254,270,282,360,390,403,498,539,636,677,716,728,770,806,906,944,950,977,1007,1086,1123,1140,1151,1172,1174,1185,1237,1297,1300,1544,1545,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,95,130,153,180,196,216,260,270,358,398,437,559,622,689,880,881,884,961,1069,1073,1094,1118,1160,1398,1545,1546,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,19,63,65,73,75,90,101,133,156,177,255,271,282,312,366,451,474,613,667,706,753,861,895,899,973,982,1011,1016,1042,1049,1095,1183,1196,1226,1546,1547,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,150,177,206,242,547,657,672,737,773,823,846,904,929,932,957,1050,1068,1100,1112,1120,1138,1197,1211,1265,1359,1547,1548,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,74,84,111,127,162,217,222,243,287,301,345,507,522,590,642,678,765,801,849,931,932,936,981,986,1013,1037,1135,1153,1223,1274,1275,1389,1393,1394,1548,1549,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,42,73,89,90,91,150,176,183,231,237,281,294,352,376,386,390,440,463,521,611,612,651,679,799,862,871,888,891,968,999,1020,1026,1188,1215,1295,1299,1309,1321,1349,1549,1550,-1,-1,-1,-1},
-{4,7,116,184,261,297,325,330,336,398,434,515,530,707,834,910,949,982,1034,1037,1111,1160,1167,1169,1241,1245,1357,1363,1550,1551,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,183,294,303,347,367,375,588,633,694,746,785,827,883,891,914,938,954,963,979,1099,1141,1148,1176,1184,1236,1359,1551,1552,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,116,161,228,268,343,362,364,370,431,465,491,526,547,570,589,657,734,746,801,825,838,843,873,939,996,1033,1078,1271,1282,1338,1359,1380,1382,1399,1552,1553,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,109,143,155,166,323,388,414,454,544,584,704,792,796,824,872,980,1037,1195,1233,1287,1307,1352,1367,1553,1554,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,38,48,63,155,213,241,283,303,326,328,375,429,485,517,527,534,625,653,683,739,784,828,885,925,961,986,1061,1124,1149,1195,1236,1334,1388,1389,1554,1555,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,26,191,197,344,349,411,554,570,659,681,701,714,760,806,810,842,886,898,908,929,954,967,972,995,1044,1061,1080,1110,1142,1153,1170,1245,1300,1345,1392,1399,1555,1556,-1,-1,-1,-1,-1,-1,-1},
-{18,107,110,123,140,188,244,247,250,256,369,425,454,481,533,539,541,557,564,622,626,629,685,721,723,725,749,904,905,983,1059,1156,1177,1193,1211,1228,1287,1321,1326,1556,1557,-1,-1,-1,-1,-1},
-{67,81,86,92,127,169,226,335,342,344,428,489,543,584,613,639,774,878,948,1006,1069,1070,1080,1131,1557,1558,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,69,75,124,162,316,558,644,678,705,718,812,838,850,891,951,1076,1109,1134,1159,1231,1266,1275,1288,1558,1559,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,109,209,235,299,369,419,453,461,463,504,519,595,613,623,633,639,660,708,732,779,793,803,805,886,907,940,946,960,970,1027,1038,1047,1058,1082,1129,1160,1244,1246,1250,1306,1313,1328,1559,1560,-1},
-{6,85,137,204,239,334,526,564,601,638,700,743,753,794,873,957,994,1002,1030,1037,1114,1189,1206,1250,1294,1319,1560,1561,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,78,133,161,173,252,277,432,437,439,608,631,785,807,815,849,893,904,921,1033,1094,1107,1147,1328,1375,1561,1562,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,148,217,288,295,305,306,433,436,469,489,522,567,574,586,590,596,762,778,815,833,876,885,1000,1021,1077,1146,1165,1193,1201,1255,1261,1350,1353,1562,1563,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,147,246,327,355,396,423,442,498,505,553,559,577,599,670,693,696,792,840,865,905,920,977,1021,1085,1136,1141,1151,1177,1195,1237,1240,1286,1292,1389,1563,1564,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,109,131,150,160,168,186,244,287,305,350,368,382,444,445,534,603,628,655,687,747,761,767,788,865,957,987,994,1027,1052,1055,1108,1118,1204,1235,1241,1257,1344,1564,1565,-1,-1,-1,-1,-1,-1},
-{11,211,279,410,417,445,560,578,585,596,607,616,680,693,698,733,745,788,853,855,924,970,1006,1017,1072,1075,1093,1097,1154,1204,1269,1279,1316,1321,1565,1566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,36,62,116,223,238,292,334,342,352,382,394,399,418,423,433,587,665,687,744,772,817,875,903,920,1054,1099,1133,1370,1566,1567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,36,45,85,88,123,173,192,271,309,353,376,404,419,470,498,522,618,702,761,768,823,895,912,947,1028,1092,1126,1202,1203,1397,1398,1567,1568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,121,143,205,260,271,283,305,361,391,404,499,575,637,678,717,729,771,807,907,920,951,978,995,1008,1087,1124,1141,1152,1173,1186,1238,1298,1301,1568,1569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,70,96,131,154,181,197,217,261,271,315,359,395,399,438,490,623,845,870,881,882,900,962,1074,1095,1119,1161,1399,1569,1570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,66,74,76,91,102,134,157,178,256,272,283,313,367,452,614,668,707,754,825,862,896,915,974,983,1012,1017,1043,1096,1184,1197,1227,1570,1571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,135,151,178,207,243,548,658,673,738,774,824,847,875,933,945,958,1051,1069,1101,1113,1121,1139,1198,1212,1266,1350,1571,1572,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,48,112,128,145,163,165,170,218,223,244,285,288,302,346,405,508,523,525,591,643,679,766,802,932,933,937,982,987,1014,1038,1060,1136,1154,1224,1250,1276,1394,1572,1573,-1,-1,-1,-1,-1,-1},
-{26,43,74,91,92,100,151,177,184,232,238,245,282,353,377,385,387,391,441,455,464,522,612,613,652,725,863,872,889,892,925,969,1021,1027,1189,1216,1296,1322,1335,1573,1574,-1,-1,-1,-1,-1},
-{8,117,195,262,298,326,331,337,399,516,531,640,708,911,983,1038,1112,1161,1168,1242,1246,1358,1364,1574,1575,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,184,304,348,368,376,589,634,747,786,828,855,884,892,939,964,1142,1149,1177,1237,1275,1575,1576,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,115,117,140,162,229,269,344,363,371,432,466,492,527,548,565,571,585,645,658,747,802,826,839,844,874,997,1005,1030,1034,1079,1272,1283,1339,1381,1383,1576,1577,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,20,52,144,156,167,185,324,389,793,797,873,981,1038,1196,1234,1288,1308,1315,1353,1368,1577,1578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,39,49,64,156,214,242,284,285,304,327,329,376,486,518,528,565,626,654,684,829,886,926,962,987,1062,1196,1237,1280,1389,1578,1579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,27,60,192,198,400,412,571,682,702,710,761,770,807,811,843,887,899,909,968,973,996,1062,1081,1111,1143,1154,1171,1246,1275,1301,1310,1346,1393,1579,1580,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,108,111,124,141,189,245,248,251,257,365,405,426,482,490,534,542,558,565,605,623,627,686,720,722,724,726,765,906,984,1100,1157,1178,1194,1212,1229,1288,1322,1327,1580,1581,-1,-1,-1,-1,-1},
-{25,68,82,87,93,95,128,227,336,343,429,485,544,614,615,879,915,949,1007,1071,1081,1090,1132,1140,1235,1581,1582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,76,163,317,559,679,706,719,813,839,851,892,952,1077,1232,1267,1276,1289,1582,1583,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,81,236,454,462,464,596,614,624,634,661,709,733,735,794,804,806,887,908,941,947,961,971,975,1028,1039,1048,1059,1083,1161,1220,1225,1247,1251,1290,1307,1314,1329,1583,1584,-1,-1,-1,-1,-1,-1},
-{7,86,138,265,275,300,325,527,602,639,701,744,754,874,875,940,958,1003,1031,1038,1207,1251,1584,1585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,79,134,162,174,253,278,433,438,525,609,632,785,786,808,816,894,922,965,1015,1034,1108,1130,1148,1215,1329,1365,1376,1585,1586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,149,218,289,296,306,307,434,437,455,523,545,568,587,591,597,763,779,805,816,834,877,886,985,1001,1022,1078,1115,1147,1166,1194,1202,1256,1262,1351,1354,1586,1587,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,95,148,150,247,328,356,397,424,443,475,495,499,506,554,578,671,694,697,710,793,841,866,906,921,978,1022,1086,1137,1142,1152,1178,1196,1238,1241,1280,1287,1293,1340,1587,1588,-1,-1,-1,-1,-1},
-{6,132,151,161,169,187,288,306,315,351,369,383,446,604,629,656,665,688,730,748,762,768,789,866,958,988,1028,1053,1056,1109,1119,1236,1242,1258,1588,1589,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,212,411,418,446,561,579,586,597,608,617,681,694,699,734,746,789,854,856,945,971,990,1007,1018,1073,1076,1094,1098,1160,1317,1322,1589,1590,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,37,63,117,224,239,293,315,343,353,383,419,424,434,588,666,670,688,773,818,876,904,921,1005,1134,1135,1320,1345,1371,1380,1590,1591,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,37,46,86,89,124,174,193,255,272,280,290,310,354,377,471,480,499,523,619,680,703,762,769,824,896,913,948,960,1029,1093,1127,1203,1204,1225,1398,1399,1591,1592,-1,-1,-1,-1,-1,-1,-1},
-{5,122,144,206,261,265,272,284,306,362,392,405,455,576,638,679,718,772,808,855,890,908,910,921,952,979,996,1009,1088,1142,1153,1174,1187,1210,1239,1299,1302,1330,1592,1593,-1,-1,-1,-1,-1,-1},
-{52,71,97,132,182,198,218,230,262,272,316,395,396,439,491,624,846,855,871,882,883,901,963,1096,1162,1593,1594,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,77,92,103,158,179,180,257,273,284,314,368,370,453,669,708,770,826,863,890,897,916,984,1013,1018,1044,1097,1198,1228,1255,1594,1595,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,136,152,179,208,235,244,549,650,659,674,725,739,760,780,795,848,876,934,946,959,1020,1052,1085,1102,1114,1122,1199,1213,1267,1351,1595,1596,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,49,113,129,146,164,166,171,219,224,286,289,303,345,347,406,435,509,524,526,592,644,750,767,803,933,934,938,983,988,1039,1050,1061,1137,1155,1190,1251,1277,1345,1596,1597,-1,-1,-1,-1,-1},
-{27,44,92,93,101,125,152,155,178,233,239,246,283,354,378,386,388,392,442,456,523,613,614,653,726,765,850,864,865,873,893,926,1022,1028,1217,1270,1297,1323,1336,1597,1598,-1,-1,-1,-1,-1},
-{9,118,135,175,196,263,285,290,299,327,332,338,517,532,641,665,709,912,984,1039,1080,1113,1115,1162,1169,1243,1247,1325,1359,1598,1599,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixEnc_14_16[200][45]={
-{63,349,369,377,748,787,829,856,893,1143,1178,1238,1276,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,75,116,118,141,163,190,295,364,372,433,467,475,493,528,549,566,572,586,646,659,748,750,803,815,827,998,1006,1031,1180,1273,1284,1382,1384,1400,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,16,21,53,157,168,186,190,300,320,710,794,798,874,982,1039,1197,1289,1309,1316,1354,1369,1401,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,45,157,243,286,328,377,487,519,529,566,627,755,887,927,963,988,1063,1085,1197,1225,1238,1281,1402,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,28,61,193,199,401,413,430,505,535,572,683,703,711,762,771,808,810,812,844,888,969,974,997,1055,1063,1082,1112,1125,1144,1172,1247,1276,1302,1311,1347,1360,1394,1403,-1,-1,-1,-1,-1,-1},
-{109,112,142,246,249,252,258,335,366,406,427,483,490,491,543,559,566,606,615,624,628,650,660,687,721,723,727,766,810,907,1101,1158,1179,1213,1289,1295,1323,1328,1404,-1,-1,-1,-1,-1,-1},
-{26,30,69,80,83,88,94,96,129,228,337,344,486,575,616,916,1008,1015,1072,1082,1091,1100,1133,1141,1150,1236,1405,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,77,164,175,220,318,415,495,530,580,707,725,814,852,893,953,1078,1233,1268,1277,1406,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,82,237,463,597,662,734,736,807,815,888,909,942,948,962,972,976,1029,1045,1049,1084,1110,1162,1221,1226,1248,1252,1291,1308,1365,1407,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,20,87,139,165,266,276,301,326,475,528,603,702,865,876,941,959,1004,1032,1039,1135,1208,1252,1370,1408,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,163,254,279,434,439,500,526,633,786,787,790,795,809,817,923,966,1016,1109,1131,1149,1216,1290,1366,1377,1409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,219,297,307,308,438,456,490,524,545,546,569,588,592,598,764,806,817,878,887,986,1002,1023,1079,1116,1148,1167,1203,1257,1263,1352,1360,1410,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,15,30,50,96,149,151,248,295,329,357,398,405,444,476,496,507,579,672,698,711,794,842,867,907,922,979,1023,1087,1138,1143,1153,1179,1190,1197,1205,1239,1242,1275,1281,1288,1294,1341,1411,-1},
-{7,10,133,152,162,188,270,289,307,316,352,384,447,657,666,689,731,749,763,769,867,925,959,989,1029,1054,1057,1210,1237,1240,1243,1259,1412,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,190,213,385,412,419,447,562,587,598,609,618,682,747,857,946,972,991,1008,1019,1074,1077,1099,1161,1318,1323,1413,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,64,118,245,294,316,320,344,354,384,480,589,667,671,689,740,750,755,774,819,877,922,1006,1010,1136,1230,1280,1321,1346,1372,1381,1414,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,38,40,47,87,100,194,256,273,281,291,311,378,410,472,481,524,675,681,704,763,830,897,914,949,961,1094,1128,1165,1204,1226,1399,1415,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,123,145,200,207,262,266,273,307,363,393,406,456,510,577,625,639,715,719,773,809,856,891,909,911,922,953,997,1000,1089,1095,1120,1143,1154,1165,1188,1211,1220,1300,1303,1331,1395,1416,-1,-1},
-{0,53,72,90,98,133,140,183,199,200,219,231,235,263,273,317,396,397,492,530,535,847,856,872,883,884,902,960,964,1060,1097,1163,1280,1417,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,78,93,104,159,181,258,260,274,295,369,371,454,510,680,709,771,827,864,891,898,917,985,1014,1019,1098,1199,1229,1256,1260,1418,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,70,137,153,209,236,515,560,651,726,761,781,796,835,849,877,947,1021,1053,1065,1086,1103,1110,1123,1155,1200,1214,1268,1340,1352,1419,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,114,147,155,167,172,287,304,346,348,407,436,527,593,751,768,775,804,860,934,939,984,989,1051,1062,1138,1156,1191,1252,1278,1346,1420,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,55,93,94,102,126,153,156,179,220,234,247,284,379,387,389,393,443,457,470,524,614,630,635,654,727,755,766,820,851,866,874,894,927,935,955,1023,1029,1215,1218,1271,1298,1324,1337,1421},
-{119,136,176,197,210,264,286,291,328,333,339,518,533,642,666,850,913,1081,1114,1116,1163,1230,1244,1248,1326,1422,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,100,225,378,735,749,788,820,830,857,894,1035,1144,1179,1239,1277,1305,1375,1423,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,76,117,119,142,164,191,296,350,373,420,434,465,468,476,494,529,567,573,587,620,647,749,751,804,816,828,940,999,1007,1032,1181,1274,1330,1383,1424,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,17,22,54,158,169,187,191,301,321,711,740,799,983,1135,1198,1317,1340,1425,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,46,158,230,244,245,287,315,329,378,445,488,567,590,628,720,756,888,928,964,989,1030,1064,1086,1198,1226,1239,1282,1426,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,62,194,402,405,414,431,506,536,573,645,684,704,712,715,763,772,809,811,813,889,975,998,1056,1064,1083,1113,1126,1173,1248,1277,1303,1312,1335,1348,1361,1427,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,85,113,143,247,253,259,336,367,407,428,484,491,492,544,567,607,616,629,651,661,688,715,722,724,728,767,811,908,1102,1159,1205,1214,1260,1296,1324,1329,1428,-1,-1,-1,-1,-1,-1,-1},
-{27,31,81,84,89,97,100,229,338,460,487,576,617,730,815,917,1009,1016,1070,1073,1083,1092,1101,1134,1142,1151,1237,1429,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,78,95,100,176,221,319,325,416,420,496,531,581,708,726,755,853,894,954,1079,1190,1234,1269,1278,1430,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,83,238,310,464,598,663,737,808,816,889,943,949,963,973,977,1046,1111,1163,1222,1227,1249,1253,1292,1309,1366,1431,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,21,88,166,267,277,302,327,370,476,529,604,700,703,866,877,942,1033,1136,1209,1253,1280,1371,1432,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,164,465,501,527,634,640,787,788,791,796,818,924,955,967,1017,1045,1132,1217,1291,1360,1367,1378,1433,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,146,298,308,309,420,439,457,490,491,546,547,589,593,599,807,818,879,888,910,987,1003,1015,1024,1117,1149,1168,1204,1220,1258,1264,1353,1361,1434,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,16,31,51,70,97,152,249,296,335,358,399,406,450,477,497,508,673,675,699,712,775,825,843,868,908,923,930,1024,1088,1139,1144,1154,1191,1198,1206,1243,1276,1282,1289,1330,1342,1435,-1,-1},
-{8,11,90,134,153,163,189,215,271,308,317,330,340,353,448,658,660,667,732,764,865,868,880,926,970,1058,1211,1238,1241,1244,1436,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,25,191,214,386,413,448,550,555,563,565,588,599,619,650,683,748,790,858,947,973,992,1009,1065,1078,1162,1245,1310,1315,1319,1324,1437,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,39,115,119,215,246,317,321,410,481,668,672,741,751,756,878,923,1007,1011,1020,1055,1137,1231,1281,1322,1325,1347,1373,1382,1438,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,39,41,48,88,101,165,257,274,280,282,292,312,355,379,411,473,482,600,676,682,710,764,810,831,898,962,1129,1166,1227,1390,1439,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,30,75,124,146,201,208,263,267,274,308,364,394,407,457,511,535,578,626,710,716,774,775,857,892,912,923,954,998,1001,1010,1096,1121,1144,1166,1189,1212,1221,1301,1304,1332,1385,1396,1440,-1},
-{1,54,73,91,99,134,141,184,201,232,236,264,274,300,318,397,398,485,493,531,536,848,857,873,884,903,961,1040,1061,1098,1164,1281,1375,1441,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,79,94,110,182,210,215,259,261,296,372,511,681,772,780,828,892,899,918,986,1099,1257,1261,1355,1442,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,115,138,154,237,516,561,652,660,727,745,762,775,782,797,835,836,845,878,948,1022,1054,1066,1087,1104,1111,1124,1156,1201,1269,1341,1353,1443,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,110,148,150,156,168,173,288,347,349,408,437,510,528,594,645,680,695,752,769,776,861,880,1052,1063,1139,1157,1192,1230,1253,1279,1300,1347,1444,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,56,94,103,127,154,157,221,248,270,380,388,394,405,444,458,471,631,636,660,685,728,756,767,821,852,867,915,928,936,956,965,1024,1216,1219,1272,1299,1338,1370,1445,-1,-1,-1,-1,-1},
-{20,137,160,175,177,198,211,287,292,329,334,519,534,643,667,851,914,920,1082,1100,1117,1125,1140,1164,1225,1231,1249,1327,1446,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,155,226,375,379,450,500,525,736,789,821,831,858,970,1036,1050,1278,1290,1300,1306,1376,1447,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,77,118,143,192,225,250,297,351,374,421,466,469,477,535,568,574,588,621,648,752,817,829,940,941,1008,1033,1170,1182,1331,1384,1448,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,18,23,159,188,192,302,322,555,685,712,741,880,984,1065,1090,1136,1199,1318,1341,1449,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,15,22,47,159,231,246,288,316,379,446,470,489,568,591,629,721,757,889,895,929,1031,1045,1087,1199,1227,1283,1450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,403,406,432,507,537,574,646,713,716,764,773,812,814,900,925,976,999,1057,1084,1114,1127,1174,1249,1278,1304,1313,1336,1349,1355,1362,1451,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,70,80,86,114,144,248,254,337,368,408,429,492,493,568,608,617,652,662,689,716,723,729,768,812,845,909,1103,1206,1261,1270,1297,1385,1390,1452,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,32,82,85,98,101,290,339,461,488,577,618,675,731,795,816,918,995,1017,1071,1074,1084,1093,1102,1143,1152,1238,1295,1305,1345,1453,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,33,79,96,101,177,180,222,326,417,421,430,497,532,582,709,727,756,830,854,945,1030,1165,1191,1279,1454,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,84,239,290,311,599,664,690,738,809,817,910,944,950,964,974,975,978,1047,1095,1112,1164,1180,1223,1228,1254,1293,1355,1367,1455,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,89,167,268,278,303,328,360,371,477,585,701,704,730,867,878,935,943,1034,1137,1254,1281,1355,1372,1395,1456,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,105,410,450,466,502,528,540,580,641,700,788,789,792,797,819,820,956,968,1018,1046,1133,1218,1292,1361,1368,1379,1457,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,147,299,309,421,425,458,491,492,530,547,548,594,735,780,808,819,889,911,988,1004,1016,1118,1120,1145,1169,1221,1259,1330,1354,1362,1385,1458,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,17,32,52,71,98,153,297,336,340,345,359,407,451,478,498,509,550,655,674,676,710,713,776,826,844,869,909,924,925,931,950,1040,1089,1192,1199,1207,1244,1277,1283,1331,1343,1395,1459,-1},
-{9,12,91,154,164,216,240,272,309,318,331,341,354,365,449,450,535,560,625,659,661,668,733,745,866,869,881,900,927,971,1055,1059,1212,1239,1242,1460,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,165,192,340,387,414,449,485,551,556,564,566,580,589,635,651,684,749,770,791,859,948,974,993,1065,1066,1079,1163,1246,1311,1316,1461,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,36,65,116,120,216,247,318,322,411,482,640,669,673,742,752,757,879,924,1008,1012,1021,1056,1105,1130,1138,1155,1232,1282,1323,1326,1348,1374,1383,1462,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,42,49,89,102,105,166,205,258,281,283,293,295,313,356,365,412,415,474,483,500,515,601,635,677,683,711,775,811,832,899,963,1125,1167,1228,1240,1391,1463,-1,-1,-1,-1,-1,-1,-1},
-{8,31,76,147,200,202,209,235,264,268,309,330,408,458,512,536,560,579,627,711,717,776,790,858,893,913,924,990,999,1002,1011,1097,1110,1122,1167,1185,1213,1222,1290,1302,1315,1333,1386,1397,1464},
-{2,74,92,142,202,233,237,301,319,398,399,435,486,494,532,537,845,849,858,874,900,904,962,1041,1062,1090,1099,1282,1376,1465,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,183,211,216,262,297,373,465,485,512,570,682,773,781,829,893,919,987,1258,1262,1356,1466,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,72,116,139,238,517,555,562,595,653,661,728,746,763,776,783,798,836,837,846,879,949,1023,1067,1088,1112,1157,1202,1342,1354,1385,1467,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,105,111,149,151,157,169,174,240,289,348,409,438,440,511,529,530,646,681,696,753,777,862,881,990,1053,1064,1158,1193,1200,1231,1254,1301,1340,1348,1468,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,104,128,158,222,249,271,275,381,389,406,459,472,632,637,661,686,729,757,768,822,853,868,916,920,929,937,957,966,1150,1200,1217,1265,1273,1275,1339,1371,1469,-1,-1,-1,-1,-1,-1,-1},
-{21,138,161,176,178,199,212,288,293,330,390,395,644,668,740,852,921,1050,1083,1095,1101,1118,1126,1141,1226,1232,1328,1470,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,156,227,305,376,400,415,451,501,526,737,822,832,859,971,1037,1051,1279,1291,1301,1307,1377,1471,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,78,119,144,193,226,251,298,352,400,422,467,478,495,536,569,589,622,649,725,753,818,941,942,1009,1034,1120,1171,1183,1332,1472,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,19,24,150,189,193,303,323,355,395,556,686,713,742,881,1066,1070,1091,1115,1137,1319,1342,1395,1473,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,16,23,48,60,70,130,232,247,289,317,447,471,569,592,610,722,750,758,896,970,1032,1046,1088,1180,1228,1284,1474,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,404,407,433,508,538,647,714,717,770,774,813,820,901,926,977,1058,1065,1128,1135,1279,1314,1337,1356,1363,1475,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,71,81,87,240,249,338,369,409,493,494,569,609,618,653,663,675,717,724,769,813,846,1010,1104,1150,1207,1220,1262,1271,1298,1386,1390,1391,1476,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,33,70,83,86,99,102,180,291,460,462,489,578,619,676,732,796,817,885,919,965,996,1018,1072,1094,1103,1144,1153,1185,1239,1296,1306,1346,1477,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,34,97,102,178,181,223,327,395,418,422,431,498,533,583,728,757,831,946,1031,1166,1192,1360,1478,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,180,291,300,312,585,630,691,739,818,880,911,935,951,960,976,979,1048,1096,1113,1145,1181,1224,1229,1294,1356,1368,1479,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,168,225,265,269,279,304,329,340,361,372,478,586,702,731,835,840,868,870,879,936,944,1030,1075,1138,1282,1335,1356,1373,1396,1480,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,140,320,385,411,451,467,503,529,541,581,642,701,789,793,798,821,957,969,1019,1047,1134,1219,1230,1293,1362,1369,1481,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,35,45,52,60,148,210,280,300,325,422,426,459,492,493,531,548,549,650,680,736,781,809,825,912,989,1017,1119,1121,1146,1222,1331,1363,1385,1386,1482,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,18,33,53,72,99,154,298,337,341,346,408,452,479,499,551,656,677,711,714,777,827,895,905,926,932,951,1041,1150,1193,1208,1278,1284,1332,1344,1396,1483,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,15,92,120,185,217,241,273,319,332,342,366,451,530,536,561,626,662,669,720,734,746,867,882,901,928,972,980,1056,1190,1213,1225,1243,1484,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,166,193,341,388,425,486,540,552,557,567,581,610,636,652,771,792,875,945,949,994,1066,1067,1164,1247,1312,1317,1485,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,37,66,117,121,217,248,319,323,412,483,555,641,674,675,715,743,753,758,835,1009,1013,1022,1057,1106,1131,1139,1156,1233,1283,1285,1324,1327,1349,1384,1486,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,103,106,167,206,259,282,284,294,296,314,357,366,413,416,450,460,484,501,516,602,610,620,630,636,678,684,705,712,776,790,800,812,833,964,1035,1055,1126,1168,1229,1241,1310,1325,1392,1487},
-{9,32,77,148,201,203,236,269,331,409,459,513,537,561,628,635,712,718,740,750,777,791,859,870,894,914,991,1003,1012,1098,1111,1123,1168,1186,1214,1223,1291,1303,1316,1334,1387,1398,1488,-1,-1},
-{3,75,93,130,143,170,203,234,238,302,399,436,487,533,538,605,846,859,890,901,963,1030,1042,1063,1091,1283,1325,1377,1489,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,130,145,184,212,217,263,285,298,374,430,466,486,513,571,683,774,775,782,830,894,988,1190,1259,1263,1350,1357,1490,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,73,117,239,420,495,518,550,556,563,596,654,662,690,729,747,764,777,784,799,837,838,847,1024,1068,1089,1113,1158,1203,1343,1386,1491,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,112,152,158,165,241,349,365,439,441,512,531,600,625,647,682,697,754,778,785,863,882,991,1054,1105,1115,1159,1194,1201,1232,1302,1341,1349,1492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,129,159,223,272,276,382,407,473,575,633,638,662,687,690,695,730,758,769,785,823,850,854,869,917,921,938,958,967,1090,1151,1201,1218,1266,1274,1276,1372,1493,-1,-1,-1,-1,-1,-1,-1},
-{15,22,139,162,177,179,213,220,235,289,294,331,391,396,415,420,430,669,741,853,900,922,1051,1084,1096,1102,1119,1127,1130,1142,1227,1233,1329,1494,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,103,120,157,170,228,306,350,377,401,416,452,495,502,527,615,738,765,820,823,833,972,1025,1038,1052,1200,1292,1302,1308,1378,1395,1495,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,79,140,194,227,252,280,299,353,401,423,468,479,496,537,623,675,726,754,819,942,943,975,1005,1121,1170,1172,1184,1235,1295,1333,1496,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,151,194,304,324,356,396,435,557,620,687,714,743,882,1067,1071,1092,1116,1138,1343,1396,1497,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,17,24,49,61,71,131,175,233,248,280,310,318,448,472,593,611,665,723,751,759,897,971,980,1033,1040,1047,1089,1181,1229,1498,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,240,408,434,509,539,545,648,655,670,718,735,771,814,821,902,927,930,955,978,1059,1066,1110,1129,1136,1195,1338,1357,1364,1499,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,45,72,82,88,125,160,215,220,241,285,339,494,505,520,619,640,654,664,676,718,814,847,930,1011,1035,1151,1208,1221,1263,1272,1299,1387,1391,1392,1500,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,40,71,84,87,103,181,235,292,350,461,463,579,610,677,733,797,818,860,886,966,997,1019,1073,1104,1154,1186,1297,1307,1347,1501,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,5,98,103,179,182,224,295,328,396,419,423,432,499,534,584,705,729,758,832,947,980,1032,1035,1165,1167,1193,1355,1361,1502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,292,301,313,345,365,586,631,692,819,825,881,912,936,952,961,977,1049,1097,1114,1146,1182,1357,1369,1503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,169,226,266,341,360,362,373,479,545,587,655,703,732,836,841,869,871,937,1031,1076,1139,1280,1283,1336,1357,1374,1380,1397,1504,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,141,321,386,412,452,468,504,542,582,643,702,790,794,799,822,870,958,1035,1048,1231,1285,1294,1305,1350,1363,1365,1505,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,36,46,53,61,149,211,281,301,326,423,427,493,494,515,525,532,549,651,681,737,782,826,913,1018,1122,1147,1223,1332,1364,1386,1387,1506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,19,34,54,73,195,299,338,342,347,409,453,552,657,678,712,778,828,840,896,906,927,933,952,965,970,1042,1140,1151,1194,1209,1279,1333,1390,1397,1507,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,16,93,105,121,186,218,242,245,274,333,343,367,452,531,537,555,562,620,627,663,721,747,868,883,902,929,973,981,1057,1175,1191,1214,1226,1244,1285,1508,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,65,90,125,167,194,340,342,389,426,487,541,553,558,568,582,611,637,653,772,793,876,946,1067,1068,1248,1313,1318,1509,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,38,67,118,122,160,218,249,324,413,484,556,642,676,716,744,754,759,810,836,1014,1023,1058,1107,1132,1157,1234,1284,1286,1328,1510,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,104,107,168,207,283,297,358,367,414,417,451,461,502,517,603,611,621,631,637,679,706,713,730,777,791,801,813,834,905,1025,1036,1045,1056,1080,1127,1169,1242,1311,1326,1393,1511,-1,-1,-1},
-{33,78,135,149,202,204,237,332,514,538,562,629,636,713,719,741,751,778,792,871,955,992,1000,1004,1013,1035,1099,1112,1124,1169,1187,1224,1292,1304,1317,1388,1399,1512,-1,-1,-1,-1,-1,-1,-1},
-{4,76,94,131,144,171,204,239,250,275,303,430,435,437,488,534,539,606,805,847,891,902,964,1031,1043,1064,1092,1105,1145,1284,1326,1378,1513,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,131,146,213,215,218,264,286,299,431,467,487,514,520,565,572,684,760,776,783,831,989,1075,1191,1264,1351,1358,1514,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,74,118,145,325,421,440,496,519,551,557,564,575,597,663,691,748,778,790,838,839,848,975,1069,1114,1159,1175,1204,1235,1290,1344,1387,1515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,113,153,159,166,242,285,366,380,442,513,532,601,626,648,683,685,698,745,765,779,786,864,883,955,985,992,1025,1050,1106,1116,1202,1233,1255,1303,1342,1516,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,224,273,277,383,408,415,474,576,605,634,639,663,688,691,696,731,759,786,824,851,918,922,939,959,968,1015,1070,1091,1095,1152,1202,1219,1267,1277,1373,1517,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,23,60,163,178,214,221,236,290,332,340,350,380,392,397,416,421,431,585,685,742,770,815,854,901,923,1052,1097,1103,1128,1131,1143,1228,1234,1518,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,104,121,158,171,190,229,307,351,378,402,417,453,496,503,520,528,616,700,739,766,821,824,834,910,945,973,1026,1039,1053,1090,1200,1201,1293,1303,1309,1379,1395,1396,1519,-1,-1,-1,-1,-1},
-{42,141,228,253,281,354,402,424,469,497,538,624,635,676,715,727,805,905,943,944,976,1006,1085,1122,1150,1171,1173,1236,1296,1334,1520,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,195,215,357,397,436,558,621,688,744,880,883,960,1068,1072,1093,1117,1139,1344,1397,1521,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,18,62,72,100,132,155,176,234,249,270,281,311,319,365,449,450,473,594,612,666,705,724,752,860,898,972,981,1010,1015,1034,1041,1048,1182,1195,1225,1522,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,176,205,241,409,546,649,656,671,719,736,772,822,845,903,928,931,956,979,1067,1111,1137,1196,1210,1339,1358,1523,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,46,73,83,89,110,126,161,216,221,242,286,300,506,521,641,677,719,800,848,930,931,935,980,985,1012,1036,1152,1209,1222,1264,1273,1388,1392,1393,1524,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,72,88,90,104,175,182,230,236,280,293,351,375,385,462,464,520,610,611,650,678,734,798,819,861,870,887,890,967,998,1025,1074,1187,1298,1308,1320,1348,1525,-1,-1,-1,-1,-1,-1,-1},
-{3,6,99,104,115,183,260,296,329,335,397,424,433,706,759,833,948,981,1033,1036,1110,1166,1168,1194,1240,1356,1362,1526,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,182,293,302,314,346,366,587,632,693,745,826,882,890,913,937,953,962,978,1098,1140,1147,1175,1183,1235,1358,1527,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,160,227,267,342,361,363,374,430,490,525,546,588,656,704,733,745,800,837,842,872,938,995,1032,1077,1270,1281,1284,1337,1358,1381,1398,1528,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,108,142,165,322,387,413,453,469,543,583,644,703,791,795,823,871,959,1036,1049,1232,1286,1306,1351,1364,1366,1529,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,37,47,54,62,212,240,282,302,325,327,424,428,494,516,526,533,652,682,738,783,827,914,960,985,1019,1060,1123,1148,1224,1235,1333,1387,1388,1530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,25,74,190,196,339,343,348,410,454,553,658,679,680,700,713,779,805,829,841,885,897,907,928,934,953,966,971,1043,1060,1141,1152,1334,1391,1398,1531,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,94,106,122,187,219,243,246,255,334,344,368,453,480,532,538,540,556,563,621,625,628,664,720,722,748,869,884,903,974,982,1058,1155,1176,1192,1210,1227,1286,1320,1325,1532,-1,-1,-1,-1},
-{29,66,80,85,91,126,168,225,341,343,427,488,542,554,559,569,583,612,638,654,773,794,877,947,1005,1068,1069,1130,1249,1314,1319,1533,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,39,68,119,123,161,219,315,414,557,643,677,717,811,837,890,950,1024,1059,1075,1108,1133,1158,1230,1265,1287,1329,1534,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,169,208,284,298,359,368,418,452,460,462,503,518,604,612,622,632,638,707,714,731,778,792,802,814,885,906,945,1026,1037,1046,1057,1081,1128,1243,1245,1305,1312,1327,1394,1535,-1,-1,-1,-1},
-{5,34,79,136,203,238,333,525,539,563,600,637,714,742,752,779,793,872,956,993,1001,1014,1036,1113,1188,1205,1293,1318,1389,1536,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,132,160,172,251,276,304,431,436,438,489,607,630,806,848,892,903,920,1032,1044,1093,1106,1146,1327,1379,1537,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,132,147,214,216,219,287,305,432,435,468,488,521,566,573,585,595,761,777,784,832,875,1020,1076,1145,1192,1200,1260,1352,1359,1538,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,119,146,245,326,395,422,441,497,552,558,576,598,664,692,695,749,779,791,839,849,976,1020,1135,1140,1150,1176,1236,1285,1291,1388,1539,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,114,130,154,167,185,243,286,367,381,443,514,533,602,627,649,684,686,699,746,760,766,787,884,956,986,993,1026,1051,1107,1117,1203,1234,1240,1256,1304,1343,1540,-1,-1,-1,-1,-1,-1,-1},
-{10,210,274,278,384,409,416,577,595,606,615,664,689,692,697,732,787,852,919,923,969,1005,1016,1071,1092,1096,1153,1203,1268,1278,1315,1320,1374,1541,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,24,35,61,115,164,179,222,237,291,333,341,351,381,393,398,417,422,432,586,686,743,771,816,902,924,1053,1098,1104,1129,1132,1144,1229,1542,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,87,122,159,172,191,270,308,352,375,379,403,418,454,497,504,521,529,617,701,760,767,822,911,946,974,1027,1054,1091,1125,1201,1202,1294,1304,1396,1397,1543,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,120,142,229,254,270,282,360,390,403,498,539,636,677,716,728,770,806,906,944,950,977,1007,1086,1123,1140,1151,1172,1174,1185,1237,1297,1300,1544,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,95,130,153,180,196,216,260,270,358,398,437,559,622,689,880,881,884,961,1069,1073,1094,1118,1160,1398,1545,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,19,63,65,73,75,90,101,133,156,177,255,271,282,312,366,451,474,613,667,706,753,861,895,899,973,982,1011,1016,1042,1049,1095,1183,1196,1226,1546,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,150,177,206,242,547,657,672,737,773,823,846,904,929,932,957,1050,1068,1100,1112,1120,1138,1197,1211,1265,1359,1547,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,74,84,111,127,162,217,222,243,287,301,345,507,522,590,642,678,765,801,849,931,932,936,981,986,1013,1037,1135,1153,1223,1274,1275,1389,1393,1394,1548,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,42,73,89,90,91,150,176,183,231,237,281,294,352,376,386,390,440,463,521,611,612,651,679,799,862,871,888,891,968,999,1020,1026,1188,1215,1295,1299,1309,1321,1349,1549,-1,-1,-1,-1},
-{4,7,116,184,261,297,325,330,336,398,434,515,530,707,834,910,949,982,1034,1037,1111,1160,1167,1169,1241,1245,1357,1363,1550,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,183,294,303,347,367,375,588,633,694,746,785,827,883,891,914,938,954,963,979,1099,1141,1148,1176,1184,1236,1359,1551,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,116,161,228,268,343,362,364,370,431,465,491,526,547,570,589,657,734,746,801,825,838,843,873,939,996,1033,1078,1271,1282,1338,1359,1380,1382,1399,1552,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,109,143,155,166,323,388,414,454,544,584,704,792,796,824,872,980,1037,1195,1233,1287,1307,1352,1367,1553,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,38,48,63,155,213,241,283,303,326,328,375,429,485,517,527,534,625,653,683,739,784,828,885,925,961,986,1061,1124,1149,1195,1236,1334,1388,1389,1554,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,26,191,197,344,349,411,554,570,659,681,701,714,760,806,810,842,886,898,908,929,954,967,972,995,1044,1061,1080,1110,1142,1153,1170,1245,1300,1345,1392,1399,1555,-1,-1,-1,-1,-1,-1,-1},
-{18,107,110,123,140,188,244,247,250,256,369,425,454,481,533,539,541,557,564,622,626,629,685,721,723,725,749,904,905,983,1059,1156,1177,1193,1211,1228,1287,1321,1326,1556,-1,-1,-1,-1,-1},
-{67,81,86,92,127,169,226,335,342,344,428,489,543,584,613,639,774,878,948,1006,1069,1070,1080,1131,1557,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,69,75,124,162,316,558,644,678,705,718,812,838,850,891,951,1076,1109,1134,1159,1231,1266,1275,1288,1558,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,109,209,235,299,369,419,453,461,463,504,519,595,613,623,633,639,660,708,732,779,793,803,805,886,907,940,946,960,970,1027,1038,1047,1058,1082,1129,1160,1244,1246,1250,1306,1313,1328,1559,-1},
-{6,85,137,204,239,334,526,564,601,638,700,743,753,794,873,957,994,1002,1030,1037,1114,1189,1206,1250,1294,1319,1560,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,78,133,161,173,252,277,432,437,439,608,631,785,807,815,849,893,904,921,1033,1094,1107,1147,1328,1375,1561,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,148,217,288,295,305,306,433,436,469,489,522,567,574,586,590,596,762,778,815,833,876,885,1000,1021,1077,1146,1165,1193,1201,1255,1261,1350,1353,1562,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,147,246,327,355,396,423,442,498,505,553,559,577,599,670,693,696,792,840,865,905,920,977,1021,1085,1136,1141,1151,1177,1195,1237,1240,1286,1292,1389,1563,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,109,131,150,160,168,186,244,287,305,350,368,382,444,445,534,603,628,655,687,747,761,767,788,865,957,987,994,1027,1052,1055,1108,1118,1204,1235,1241,1257,1344,1564,-1,-1,-1,-1,-1,-1},
-{11,211,279,410,417,445,560,578,585,596,607,616,680,693,698,733,745,788,853,855,924,970,1006,1017,1072,1075,1093,1097,1154,1204,1269,1279,1316,1321,1565,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,36,62,116,223,238,292,334,342,352,382,394,399,418,423,433,587,665,687,744,772,817,875,903,920,1054,1099,1133,1370,1566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,36,45,85,88,123,173,192,271,309,353,376,404,419,470,498,522,618,702,761,768,823,895,912,947,1028,1092,1126,1202,1203,1397,1398,1567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,121,143,205,260,271,283,305,361,391,404,499,575,637,678,717,729,771,807,907,920,951,978,995,1008,1087,1124,1141,1152,1173,1186,1238,1298,1301,1568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,70,96,131,154,181,197,217,261,271,315,359,395,399,438,490,623,845,870,881,882,900,962,1074,1095,1119,1161,1399,1569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,66,74,76,91,102,134,157,178,256,272,283,313,367,452,614,668,707,754,825,862,896,915,974,983,1012,1017,1043,1096,1184,1197,1227,1570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,135,151,178,207,243,548,658,673,738,774,824,847,875,933,945,958,1051,1069,1101,1113,1121,1139,1198,1212,1266,1350,1571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,48,112,128,145,163,165,170,218,223,244,285,288,302,346,405,508,523,525,591,643,679,766,802,932,933,937,982,987,1014,1038,1060,1136,1154,1224,1250,1276,1394,1572,-1,-1,-1,-1,-1,-1},
-{26,43,74,91,92,100,151,177,184,232,238,245,282,353,377,385,387,391,441,455,464,522,612,613,652,725,863,872,889,892,925,969,1021,1027,1189,1216,1296,1322,1335,1573,-1,-1,-1,-1,-1},
-{8,117,195,262,298,326,331,337,399,516,531,640,708,911,983,1038,1112,1161,1168,1242,1246,1358,1364,1574,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,184,304,348,368,376,589,634,747,786,828,855,884,892,939,964,1142,1149,1177,1237,1275,1575,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,115,117,140,162,229,269,344,363,371,432,466,492,527,548,565,571,585,645,658,747,802,826,839,844,874,997,1005,1030,1034,1079,1272,1283,1339,1381,1383,1576,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,20,52,144,156,167,185,324,389,793,797,873,981,1038,1196,1234,1288,1308,1315,1353,1368,1577,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,39,49,64,156,214,242,284,285,304,327,329,376,486,518,528,565,626,654,684,829,886,926,962,987,1062,1196,1237,1280,1389,1578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,27,60,192,198,400,412,571,682,702,710,761,770,807,811,843,887,899,909,968,973,996,1062,1081,1111,1143,1154,1171,1246,1275,1301,1310,1346,1393,1579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,108,111,124,141,189,245,248,251,257,365,405,426,482,490,534,542,558,565,605,623,627,686,720,722,724,726,765,906,984,1100,1157,1178,1194,1212,1229,1288,1322,1327,1580,-1,-1,-1,-1,-1},
-{25,68,82,87,93,95,128,227,336,343,429,485,544,614,615,879,915,949,1007,1071,1081,1090,1132,1140,1235,1581,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,76,163,317,559,679,706,719,813,839,851,892,952,1077,1232,1267,1276,1289,1582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,81,236,454,462,464,596,614,624,634,661,709,733,735,794,804,806,887,908,941,947,961,971,975,1028,1039,1048,1059,1083,1161,1220,1225,1247,1251,1290,1307,1314,1329,1583,-1,-1,-1,-1,-1,-1},
-{7,86,138,265,275,300,325,527,602,639,701,744,754,874,875,940,958,1003,1031,1038,1207,1251,1584,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,79,134,162,174,253,278,433,438,525,609,632,785,786,808,816,894,922,965,1015,1034,1108,1130,1148,1215,1329,1365,1376,1585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,149,218,289,296,306,307,434,437,455,523,545,568,587,591,597,763,779,805,816,834,877,886,985,1001,1022,1078,1115,1147,1166,1194,1202,1256,1262,1351,1354,1586,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,95,148,150,247,328,356,397,424,443,475,495,499,506,554,578,671,694,697,710,793,841,866,906,921,978,1022,1086,1137,1142,1152,1178,1196,1238,1241,1280,1287,1293,1340,1587,-1,-1,-1,-1,-1},
-{6,132,151,161,169,187,288,306,315,351,369,383,446,604,629,656,665,688,730,748,762,768,789,866,958,988,1028,1053,1056,1109,1119,1236,1242,1258,1588,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,212,411,418,446,561,579,586,597,608,617,681,694,699,734,746,789,854,856,945,971,990,1007,1018,1073,1076,1094,1098,1160,1317,1322,1589,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,37,63,117,224,239,293,315,343,353,383,419,424,434,588,666,670,688,773,818,876,904,921,1005,1134,1135,1320,1345,1371,1380,1590,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,37,46,86,89,124,174,193,255,272,280,290,310,354,377,471,480,499,523,619,680,703,762,769,824,896,913,948,960,1029,1093,1127,1203,1204,1225,1398,1399,1591,-1,-1,-1,-1,-1,-1,-1},
-{5,122,144,206,261,265,272,284,306,362,392,405,455,576,638,679,718,772,808,855,890,908,910,921,952,979,996,1009,1088,1142,1153,1174,1187,1210,1239,1299,1302,1330,1592,-1,-1,-1,-1,-1,-1},
-{52,71,97,132,182,198,218,230,262,272,316,395,396,439,491,624,846,855,871,882,883,901,963,1096,1162,1593,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,77,92,103,158,179,180,257,273,284,314,368,370,453,669,708,770,826,863,890,897,916,984,1013,1018,1044,1097,1198,1228,1255,1594,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,136,152,179,208,235,244,549,650,659,674,725,739,760,780,795,848,876,934,946,959,1020,1052,1085,1102,1114,1122,1199,1213,1267,1351,1595,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,49,113,129,146,164,166,171,219,224,286,289,303,345,347,406,435,509,524,526,592,644,750,767,803,933,934,938,983,988,1039,1050,1061,1137,1155,1190,1251,1277,1345,1596,-1,-1,-1,-1,-1},
-{27,44,92,93,101,125,152,155,178,233,239,246,283,354,378,386,388,392,442,456,523,613,614,653,726,765,850,864,865,873,893,926,1022,1028,1217,1270,1297,1323,1336,1597,-1,-1,-1,-1,-1},
-{9,118,135,175,196,263,285,290,299,327,332,338,517,532,641,665,709,912,984,1039,1080,1113,1115,1162,1169,1243,1247,1325,1359,1598,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixV_14_16[1600][6]={
-{2,18,55,68,173,-1},
-{26,42,79,92,197,-1},
-{50,66,103,116,21,-1},
-{74,90,127,140,45,-1},
-{98,114,151,164,69,-1},
-{29,103,137,165,193,-1},
-{53,127,161,189,17,-1},
-{77,151,185,13,41,-1},
-{101,175,9,37,65,-1},
-{125,199,33,61,89,-1},
-{13,51,108,142,153,188},
-{37,75,132,166,177,12},
-{61,99,156,190,1,36},
-{85,123,180,14,25,60},
-{109,147,4,38,49,84},
-{12,51,85,95,178,-1},
-{36,75,109,119,2,-1},
-{60,99,133,143,26,-1},
-{84,123,157,167,50,-1},
-{108,147,181,191,74,-1},
-{3,9,47,83,178,-1},
-{27,33,71,107,2,-1},
-{51,57,95,131,26,-1},
-{75,81,119,155,50,-1},
-{99,105,143,179,74,-1},
-{38,132,150,182,-1,-1},
-{62,156,174,6,-1,-1},
-{86,180,198,30,-1,-1},
-{110,4,22,54,-1,-1},
-{134,28,46,78,-1,-1},
-{6,12,41,124,183,-1},
-{30,36,65,148,7,-1},
-{54,60,89,172,31,-1},
-{78,84,113,196,55,-1},
-{102,108,137,20,79,-1},
-{39,63,83,143,144,168},
-{63,87,107,167,168,192},
-{87,111,131,191,192,16},
-{111,135,155,15,16,40},
-{135,159,179,39,40,64},
-{16,73,102,-1,-1,-1},
-{40,97,126,-1,-1,-1},
-{64,121,150,-1,-1,-1},
-{88,145,174,-1,-1,-1},
-{112,169,198,-1,-1,-1},
-{3,83,101,168,-1,-1},
-{27,107,125,192,-1,-1},
-{51,131,149,16,-1,-1},
-{75,155,173,40,-1,-1},
-{99,179,197,64,-1,-1},
-{12,35,130,146,-1,-1},
-{36,59,154,170,-1,-1},
-{60,83,178,194,-1,-1},
-{84,107,2,18,-1,-1},
-{108,131,26,42,-1,-1},
-{22,162,184,-1,-1,-1},
-{46,186,8,-1,-1,-1},
-{70,10,32,-1,-1,-1},
-{94,34,56,-1,-1,-1},
-{118,58,80,-1,-1,-1},
-{75,83,119,128,180,-1},
-{99,107,143,152,4,-1},
-{123,131,167,176,28,-1},
-{147,155,191,0,52,-1},
-{171,179,15,24,76,-1},
-{63,110,147,-1,-1,-1},
-{87,134,171,-1,-1,-1},
-{111,158,195,-1,-1,-1},
-{135,182,19,-1,-1,-1},
-{159,6,43,-1,-1,-1},
-{20,36,53,75,78,170},
-{44,60,77,99,102,194},
-{68,84,101,123,126,18},
-{92,108,125,147,150,42},
-{116,132,149,171,174,66},
-{1,41,90,147,159,-1},
-{25,65,114,171,183,-1},
-{49,89,138,195,7,-1},
-{73,113,162,19,31,-1},
-{97,137,186,43,55,-1},
-{6,53,134,160,-1,-1},
-{30,77,158,184,-1,-1},
-{54,101,182,8,-1,-1},
-{78,125,6,32,-1,-1},
-{102,149,30,56,-1,-1},
-{29,54,96,134,161,168},
-{53,78,120,158,185,192},
-{77,102,144,182,9,16},
-{101,126,168,6,33,40},
-{125,150,192,30,57,64},
-{18,37,110,126,147,150},
-{42,61,134,150,171,174},
-{66,85,158,174,195,198},
-{90,109,182,198,19,22},
-{114,133,6,22,43,46},
-{31,146,182,188,-1,-1},
-{55,170,6,12,-1,-1},
-{79,194,30,36,-1,-1},
-{103,18,54,60,-1,-1},
-{127,42,78,84,-1,-1},
-{16,24,30,31,123,174},
-{40,48,54,55,147,198},
-{64,72,78,79,171,22},
-{88,96,102,103,195,46},
-{112,120,126,127,19,70},
-{58,64,69,109,-1,-1},
-{82,88,93,133,-1,-1},
-{106,112,117,157,-1,-1},
-{130,136,141,181,-1,-1},
-{154,160,165,5,-1,-1},
-{43,45,125,157,-1,-1},
-{67,69,149,181,-1,-1},
-{91,93,173,5,-1,-1},
-{115,117,197,29,-1,-1},
-{139,141,21,53,-1,-1},
-{39,44,127,129,143,177},
-{63,68,151,153,167,1},
-{87,92,175,177,191,25},
-{111,116,199,1,15,49},
-{135,140,23,25,39,73},
-{63,85,96,145,-1,-1},
-{87,109,120,169,-1,-1},
-{111,133,144,193,-1,-1},
-{135,157,168,17,-1,-1},
-{159,181,192,41,-1,-1},
-{101,110,198,-1,-1,-1},
-{125,134,22,-1,-1,-1},
-{149,158,46,-1,-1,-1},
-{173,182,70,-1,-1,-1},
-{197,6,94,-1,-1,-1},
-{75,90,91,141,146,-1},
-{99,114,115,165,170,-1},
-{123,138,139,189,194,-1},
-{147,162,163,13,18,-1},
-{171,186,187,37,42,-1},
-{113,172,199,-1,-1,-1},
-{137,196,23,-1,-1,-1},
-{161,20,47,-1,-1,-1},
-{185,44,71,-1,-1,-1},
-{9,68,95,-1,-1,-1},
-{18,82,97,157,177,-1},
-{42,106,121,181,1,-1},
-{66,130,145,5,25,-1},
-{90,154,169,29,49,-1},
-{114,178,193,53,73,-1},
-{11,17,91,116,173,-1},
-{35,41,115,140,197,-1},
-{59,65,139,164,21,-1},
-{83,89,163,188,45,-1},
-{107,113,187,12,69,-1},
-{45,74,148,150,165,188},
-{69,98,172,174,189,12},
-{93,122,196,198,13,36},
-{117,146,20,22,37,60},
-{141,170,44,46,61,84},
-{21,48,123,154,155,198},
-{45,72,147,178,179,22},
-{69,96,171,2,3,46},
-{93,120,195,26,27,70},
-{117,144,19,50,51,94},
-{47,101,111,129,138,165},
-{71,125,135,153,162,189},
-{95,149,159,177,186,13},
-{119,173,183,1,10,37},
-{143,197,7,25,34,61},
-{9,40,62,93,130,173},
-{33,64,86,117,154,197},
-{57,88,110,141,178,21},
-{81,112,134,165,2,45},
-{105,136,158,189,26,69},
-{90,96,173,-1,-1,-1},
-{114,120,197,-1,-1,-1},
-{138,144,21,-1,-1,-1},
-{162,168,45,-1,-1,-1},
-{186,192,69,-1,-1,-1},
-{7,47,99,100,126,199},
-{31,71,123,124,150,23},
-{55,95,147,148,174,47},
-{79,119,171,172,198,71},
-{103,143,195,196,22,95},
-{55,78,80,146,195,-1},
-{79,102,104,170,19,-1},
-{103,126,128,194,43,-1},
-{127,150,152,18,67,-1},
-{151,174,176,42,91,-1},
-{85,141,178,-1,-1,-1},
-{109,165,2,-1,-1,-1},
-{133,189,26,-1,-1,-1},
-{157,13,50,-1,-1,-1},
-{181,37,74,-1,-1,-1},
-{1,2,14,120,132,-1},
-{25,26,38,144,156,-1},
-{49,50,62,168,180,-1},
-{73,74,86,192,4,-1},
-{97,98,110,16,28,-1},
-{108,122,175,-1,-1,-1},
-{132,146,199,-1,-1,-1},
-{156,170,23,-1,-1,-1},
-{180,194,47,-1,-1,-1},
-{4,18,71,-1,-1,-1},
-{17,18,65,-1,-1,-1},
-{41,42,89,-1,-1,-1},
-{65,66,113,-1,-1,-1},
-{89,90,137,-1,-1,-1},
-{113,114,161,-1,-1,-1},
-{64,124,169,-1,-1,-1},
-{88,148,193,-1,-1,-1},
-{112,172,17,-1,-1,-1},
-{136,196,41,-1,-1,-1},
-{160,20,65,-1,-1,-1},
-{23,43,83,142,-1,-1},
-{47,67,107,166,-1,-1},
-{71,91,131,190,-1,-1},
-{95,115,155,14,-1,-1},
-{119,139,179,38,-1,-1},
-{37,39,43,101,115,122},
-{61,63,67,125,139,146},
-{85,87,91,149,163,170},
-{109,111,115,173,187,194},
-{133,135,139,197,11,18},
-{7,22,95,101,-1,-1},
-{31,46,119,125,-1,-1},
-{55,70,143,149,-1,-1},
-{79,94,167,173,-1,-1},
-{103,118,191,197,-1,-1},
-{24,49,81,134,-1,-1},
-{48,73,105,158,-1,-1},
-{72,97,129,182,-1,-1},
-{96,121,153,6,-1,-1},
-{120,145,177,30,-1,-1},
-{27,126,194,-1,-1,-1},
-{51,150,18,-1,-1,-1},
-{75,174,42,-1,-1,-1},
-{99,198,66,-1,-1,-1},
-{123,22,90,-1,-1,-1},
-{18,65,95,102,160,196},
-{42,89,119,126,184,20},
-{66,113,143,150,8,44},
-{90,137,167,174,32,68},
-{114,161,191,198,56,92},
-{61,69,77,100,131,-1},
-{85,93,101,124,155,-1},
-{109,117,125,148,179,-1},
-{133,141,149,172,3,-1},
-{157,165,173,196,27,-1},
-{15,27,109,140,174,181},
-{39,51,133,164,198,5},
-{63,75,157,188,22,29},
-{87,99,181,12,46,53},
-{111,123,5,36,70,77},
-{49,114,157,-1,-1,-1},
-{73,138,181,-1,-1,-1},
-{97,162,5,-1,-1,-1},
-{121,186,29,-1,-1,-1},
-{145,10,53,-1,-1,-1},
-{133,147,192,-1,-1,-1},
-{157,171,16,-1,-1,-1},
-{181,195,40,-1,-1,-1},
-{5,19,64,-1,-1,-1},
-{29,43,88,-1,-1,-1},
-{19,127,146,169,-1,-1},
-{43,151,170,193,-1,-1},
-{67,175,194,17,-1,-1},
-{91,199,18,41,-1,-1},
-{115,23,42,65,-1,-1},
-{81,185,193,-1,-1,-1},
-{105,9,17,-1,-1,-1},
-{129,33,41,-1,-1,-1},
-{153,57,65,-1,-1,-1},
-{177,81,89,-1,-1,-1},
-{13,46,123,144,145,146},
-{37,70,147,168,169,170},
-{61,94,171,192,193,194},
-{85,118,195,16,17,18},
-{109,142,19,40,41,42},
-{70,114,185,-1,-1,-1},
-{94,138,9,-1,-1,-1},
-{118,162,33,-1,-1,-1},
-{142,186,57,-1,-1,-1},
-{166,10,81,-1,-1,-1},
-{40,83,97,99,126,192},
-{64,107,121,123,150,16},
-{88,131,145,147,174,40},
-{112,155,169,171,198,64},
-{136,179,193,195,22,88},
-{91,101,117,173,179,199},
-{115,125,141,197,3,23},
-{139,149,165,21,27,47},
-{163,173,189,45,51,71},
-{187,197,13,69,75,95},
-{54,56,119,192,199,-1},
-{78,80,143,16,23,-1},
-{102,104,167,40,47,-1},
-{126,128,191,64,71,-1},
-{150,152,15,88,95,-1},
-{1,12,19,64,103,163},
-{25,36,43,88,127,187},
-{49,60,67,112,151,11},
-{73,84,91,136,175,35},
-{97,108,115,160,199,59},
-{2,42,80,83,125,185},
-{26,66,104,107,149,9},
-{50,90,128,131,173,33},
-{74,114,152,155,197,57},
-{98,138,176,179,21,81},
-{72,139,163,165,169,-1},
-{96,163,187,189,193,-1},
-{120,187,11,13,17,-1},
-{144,11,35,37,41,-1},
-{168,35,59,61,65,-1},
-{32,99,192,-1,-1,-1},
-{56,123,16,-1,-1,-1},
-{80,147,40,-1,-1,-1},
-{104,171,64,-1,-1,-1},
-{128,195,88,-1,-1,-1},
-{27,135,170,189,191,-1},
-{51,159,194,13,15,-1},
-{75,183,18,37,39,-1},
-{99,7,42,61,63,-1},
-{123,31,66,85,87,-1},
-{2,15,82,-1,-1,-1},
-{26,39,106,-1,-1,-1},
-{50,63,130,-1,-1,-1},
-{74,87,154,-1,-1,-1},
-{98,111,178,-1,-1,-1},
-{31,83,116,131,151,185},
-{55,107,140,155,175,9},
-{79,131,164,179,199,33},
-{103,155,188,3,23,57},
-{127,179,12,27,47,81},
-{37,65,71,151,-1,-1},
-{61,89,95,175,-1,-1},
-{85,113,119,199,-1,-1},
-{109,137,143,23,-1,-1},
-{133,161,167,47,-1,-1},
-{5,36,127,158,-1,-1},
-{29,60,151,182,-1,-1},
-{53,84,175,6,-1,-1},
-{77,108,199,30,-1,-1},
-{101,132,23,54,-1,-1},
-{37,60,62,81,110,119},
-{61,84,86,105,134,143},
-{85,108,110,129,158,167},
-{109,132,134,153,182,191},
-{133,156,158,177,6,15},
-{60,104,149,197,-1,-1},
-{84,128,173,21,-1,-1},
-{108,152,197,45,-1,-1},
-{132,176,21,69,-1,-1},
-{156,0,45,93,-1,-1},
-{25,96,102,119,165,-1},
-{49,120,126,143,189,-1},
-{73,144,150,167,13,-1},
-{97,168,174,191,37,-1},
-{121,192,198,15,61,-1},
-{40,74,164,-1,-1,-1},
-{64,98,188,-1,-1,-1},
-{88,122,12,-1,-1,-1},
-{112,146,36,-1,-1,-1},
-{136,170,60,-1,-1,-1},
-{57,105,145,-1,-1,-1},
-{81,129,169,-1,-1,-1},
-{105,153,193,-1,-1,-1},
-{129,177,17,-1,-1,-1},
-{153,1,41,-1,-1,-1},
-{61,64,93,104,123,181},
-{85,88,117,128,147,5},
-{109,112,141,152,171,29},
-{133,136,165,176,195,53},
-{157,160,189,0,19,77},
-{33,153,195,-1,-1,-1},
-{57,177,19,-1,-1,-1},
-{81,1,43,-1,-1,-1},
-{105,25,67,-1,-1,-1},
-{129,49,91,-1,-1,-1},
-{48,126,144,152,155,-1},
-{72,150,168,176,179,-1},
-{96,174,192,0,3,-1},
-{120,198,16,24,27,-1},
-{144,22,40,48,51,-1},
-{46,117,119,-1,-1,-1},
-{70,141,143,-1,-1,-1},
-{94,165,167,-1,-1,-1},
-{118,189,191,-1,-1,-1},
-{142,13,15,-1,-1,-1},
-{14,82,126,174,-1,-1},
-{38,106,150,198,-1,-1},
-{62,130,174,22,-1,-1},
-{86,154,198,46,-1,-1},
-{110,178,22,70,-1,-1},
-{71,145,150,-1,-1,-1},
-{95,169,174,-1,-1,-1},
-{119,193,198,-1,-1,-1},
-{143,17,22,-1,-1,-1},
-{167,41,46,-1,-1,-1},
-{71,74,79,140,170,194},
-{95,98,103,164,194,18},
-{119,122,127,188,18,42},
-{143,146,151,12,42,66},
-{167,170,175,36,66,90},
-{72,73,180,-1,-1,-1},
-{96,97,4,-1,-1,-1},
-{120,121,28,-1,-1,-1},
-{144,145,52,-1,-1,-1},
-{168,169,76,-1,-1,-1},
-{12,28,46,173,181,193},
-{36,52,70,197,5,17},
-{60,76,94,21,29,41},
-{84,100,118,45,53,65},
-{108,124,142,69,77,89},
-{16,39,58,132,166,-1},
-{40,63,82,156,190,-1},
-{64,87,106,180,14,-1},
-{88,111,130,4,38,-1},
-{112,135,154,28,62,-1},
-{7,64,72,95,118,-1},
-{31,88,96,119,142,-1},
-{55,112,120,143,166,-1},
-{79,136,144,167,190,-1},
-{103,160,168,191,14,-1},
-{25,31,35,92,95,-1},
-{49,55,59,116,119,-1},
-{73,79,83,140,143,-1},
-{97,103,107,164,167,-1},
-{121,127,131,188,191,-1},
-{59,86,157,-1,-1,-1},
-{83,110,181,-1,-1,-1},
-{107,134,5,-1,-1,-1},
-{131,158,29,-1,-1,-1},
-{155,182,53,-1,-1,-1},
-{4,55,91,95,114,129},
-{28,79,115,119,138,153},
-{52,103,139,143,162,177},
-{76,127,163,167,186,1},
-{100,151,187,191,10,25},
-{66,98,114,139,197,-1},
-{90,122,138,163,21,-1},
-{114,146,162,187,45,-1},
-{138,170,186,11,69,-1},
-{162,194,10,35,93,-1},
-{69,116,150,-1,-1,-1},
-{93,140,174,-1,-1,-1},
-{117,164,198,-1,-1,-1},
-{141,188,22,-1,-1,-1},
-{165,12,46,-1,-1,-1},
-{27,165,166,-1,-1,-1},
-{51,189,190,-1,-1,-1},
-{75,13,14,-1,-1,-1},
-{99,37,38,-1,-1,-1},
-{123,61,62,-1,-1,-1},
-{36,48,58,61,88,123},
-{60,72,82,85,112,147},
-{84,96,106,109,136,171},
-{108,120,130,133,160,195},
-{132,144,154,157,184,19},
-{174,187,193,-1,-1,-1},
-{198,11,17,-1,-1,-1},
-{22,35,41,-1,-1,-1},
-{46,59,65,-1,-1,-1},
-{70,83,89,-1,-1,-1},
-{30,78,88,136,-1,-1},
-{54,102,112,160,-1,-1},
-{78,126,136,184,-1,-1},
-{102,150,160,8,-1,-1},
-{126,174,184,32,-1,-1},
-{25,34,67,153,-1,-1},
-{49,58,91,177,-1,-1},
-{73,82,115,1,-1,-1},
-{97,106,139,25,-1,-1},
-{121,130,163,49,-1,-1},
-{22,51,168,-1,-1,-1},
-{46,75,192,-1,-1,-1},
-{70,99,16,-1,-1,-1},
-{94,123,40,-1,-1,-1},
-{118,147,64,-1,-1,-1},
-{1,9,188,-1,-1,-1},
-{25,33,12,-1,-1,-1},
-{49,57,36,-1,-1,-1},
-{73,81,60,-1,-1,-1},
-{97,105,84,-1,-1,-1},
-{15,133,192,-1,-1,-1},
-{39,157,16,-1,-1,-1},
-{63,181,40,-1,-1,-1},
-{87,5,64,-1,-1,-1},
-{111,29,88,-1,-1,-1},
-{42,62,67,155,182,-1},
-{66,86,91,179,6,-1},
-{90,110,115,3,30,-1},
-{114,134,139,27,54,-1},
-{138,158,163,51,78,-1},
-{5,11,35,129,170,181},
-{29,35,59,153,194,5},
-{53,59,83,177,18,29},
-{77,83,107,1,42,53},
-{101,107,131,25,66,77},
-{7,73,92,96,188,-1},
-{31,97,116,120,12,-1},
-{55,121,140,144,36,-1},
-{79,145,164,168,60,-1},
-{103,169,188,192,84,-1},
-{10,48,64,-1,-1,-1},
-{34,72,88,-1,-1,-1},
-{58,96,112,-1,-1,-1},
-{82,120,136,-1,-1,-1},
-{106,144,160,-1,-1,-1},
-{4,101,164,-1,-1,-1},
-{28,125,188,-1,-1,-1},
-{52,149,12,-1,-1,-1},
-{76,173,36,-1,-1,-1},
-{100,197,60,-1,-1,-1},
-{17,19,45,-1,-1,-1},
-{41,43,69,-1,-1,-1},
-{65,67,93,-1,-1,-1},
-{89,91,117,-1,-1,-1},
-{113,115,141,-1,-1,-1},
-{20,64,107,151,-1,-1},
-{44,88,131,175,-1,-1},
-{68,112,155,199,-1,-1},
-{92,136,179,23,-1,-1},
-{116,160,3,47,-1,-1},
-{101,115,120,126,-1,-1},
-{125,139,144,150,-1,-1},
-{149,163,168,174,-1,-1},
-{173,187,192,198,-1,-1},
-{197,11,16,22,-1,-1},
-{48,107,129,137,173,186},
-{72,131,153,161,197,10},
-{96,155,177,185,21,34},
-{120,179,1,9,45,58},
-{144,3,25,33,69,82},
-{7,18,59,69,85,151},
-{31,42,83,93,109,175},
-{55,66,107,117,133,199},
-{79,90,131,141,157,23},
-{103,114,155,165,181,47},
-{4,18,41,49,61,-1},
-{28,42,65,73,85,-1},
-{52,66,89,97,109,-1},
-{76,90,113,121,133,-1},
-{100,114,137,145,157,-1},
-{58,133,86,-1,-1,-1},
-{82,157,110,-1,-1,-1},
-{106,181,134,-1,-1,-1},
-{130,5,158,-1,-1,-1},
-{154,29,182,-1,-1,-1},
-{11,100,105,187,-1,-1},
-{35,124,129,11,-1,-1},
-{59,148,153,35,-1,-1},
-{83,172,177,59,-1,-1},
-{107,196,1,83,-1,-1},
-{38,60,92,-1,-1,-1},
-{62,84,116,-1,-1,-1},
-{86,108,140,-1,-1,-1},
-{110,132,164,-1,-1,-1},
-{134,156,188,-1,-1,-1},
-{38,50,68,87,109,-1},
-{62,74,92,111,133,-1},
-{86,98,116,135,157,-1},
-{110,122,140,159,181,-1},
-{134,146,164,183,5,-1},
-{20,61,65,166,-1,-1},
-{44,85,89,190,-1,-1},
-{68,109,113,14,-1,-1},
-{92,133,137,38,-1,-1},
-{116,157,161,62,-1,-1},
-{38,115,177,179,181,-1},
-{62,139,1,3,5,-1},
-{86,163,25,27,29,-1},
-{110,187,49,51,53,-1},
-{134,11,73,75,77,-1},
-{67,153,156,-1,-1,-1},
-{91,177,180,-1,-1,-1},
-{115,1,4,-1,-1,-1},
-{139,25,28,-1,-1,-1},
-{163,49,52,-1,-1,-1},
-{6,94,116,169,-1,-1},
-{30,118,140,193,-1,-1},
-{54,142,164,17,-1,-1},
-{78,166,188,41,-1,-1},
-{102,190,12,65,-1,-1},
-{7,58,62,-1,-1,-1},
-{31,82,86,-1,-1,-1},
-{55,106,110,-1,-1,-1},
-{79,130,134,-1,-1,-1},
-{103,154,158,-1,-1,-1},
-{57,80,119,139,166,177},
-{81,104,143,163,190,1},
-{105,128,167,187,14,25},
-{129,152,191,11,38,49},
-{153,176,15,35,62,73},
-{27,149,163,-1,-1,-1},
-{51,173,187,-1,-1,-1},
-{75,197,11,-1,-1,-1},
-{99,21,35,-1,-1,-1},
-{123,45,59,-1,-1,-1},
-{68,139,142,160,-1,-1},
-{92,163,166,184,-1,-1},
-{116,187,190,8,-1,-1},
-{140,11,14,32,-1,-1},
-{164,35,38,56,-1,-1},
-{40,93,137,-1,-1,-1},
-{64,117,161,-1,-1,-1},
-{88,141,185,-1,-1,-1},
-{112,165,9,-1,-1,-1},
-{136,189,33,-1,-1,-1},
-{90,118,181,-1,-1,-1},
-{114,142,5,-1,-1,-1},
-{138,166,29,-1,-1,-1},
-{162,190,53,-1,-1,-1},
-{186,14,77,-1,-1,-1},
-{75,86,88,102,126,-1},
-{99,110,112,126,150,-1},
-{123,134,136,150,174,-1},
-{147,158,160,174,198,-1},
-{171,182,184,198,22,-1},
-{5,96,142,182,-1,-1},
-{29,120,166,6,-1,-1},
-{53,144,190,30,-1,-1},
-{77,168,14,54,-1,-1},
-{101,192,38,78,-1,-1},
-{25,88,98,109,-1,-1},
-{49,112,122,133,-1,-1},
-{73,136,146,157,-1,-1},
-{97,160,170,181,-1,-1},
-{121,184,194,5,-1,-1},
-{17,61,93,133,155,-1},
-{41,85,117,157,179,-1},
-{65,109,141,181,3,-1},
-{89,133,165,5,27,-1},
-{113,157,189,29,51,-1},
-{22,80,88,138,-1,-1},
-{46,104,112,162,-1,-1},
-{70,128,136,186,-1,-1},
-{94,152,160,10,-1,-1},
-{118,176,184,34,-1,-1},
-{22,62,64,89,121,-1},
-{46,86,88,113,145,-1},
-{70,110,112,137,169,-1},
-{94,134,136,161,193,-1},
-{118,158,160,185,17,-1},
-{34,63,101,175,-1,-1},
-{58,87,125,199,-1,-1},
-{82,111,149,23,-1,-1},
-{106,135,173,47,-1,-1},
-{130,159,197,71,-1,-1},
-{28,45,177,-1,-1,-1},
-{52,69,1,-1,-1,-1},
-{76,93,25,-1,-1,-1},
-{100,117,49,-1,-1,-1},
-{124,141,73,-1,-1,-1},
-{5,38,83,126,196,-1},
-{29,62,107,150,20,-1},
-{53,86,131,174,44,-1},
-{77,110,155,198,68,-1},
-{101,134,179,22,92,-1},
-{60,100,105,165,-1,-1},
-{84,124,129,189,-1,-1},
-{108,148,153,13,-1,-1},
-{132,172,177,37,-1,-1},
-{156,196,1,61,-1,-1},
-{5,37,44,46,160,-1},
-{29,61,68,70,184,-1},
-{53,85,92,94,8,-1},
-{77,109,116,118,32,-1},
-{101,133,140,142,56,-1},
-{99,167,189,199,-1,-1},
-{123,191,13,23,-1,-1},
-{147,15,37,47,-1,-1},
-{171,39,61,71,-1,-1},
-{195,63,85,95,-1,-1},
-{100,164,191,-1,-1,-1},
-{124,188,15,-1,-1,-1},
-{148,12,39,-1,-1,-1},
-{172,36,63,-1,-1,-1},
-{196,60,87,-1,-1,-1},
-{16,36,54,77,87,97},
-{40,60,78,101,111,121},
-{64,84,102,125,135,145},
-{88,108,126,149,159,169},
-{112,132,150,173,183,193},
-{19,45,83,132,166,192},
-{43,69,107,156,190,16},
-{67,93,131,180,14,40},
-{91,117,155,4,38,64},
-{115,141,179,28,62,88},
-{46,50,117,119,157,-1},
-{70,74,141,143,181,-1},
-{94,98,165,167,5,-1},
-{118,122,189,191,29,-1},
-{142,146,13,15,53,-1},
-{56,92,94,-1,-1,-1},
-{80,116,118,-1,-1,-1},
-{104,140,142,-1,-1,-1},
-{128,164,166,-1,-1,-1},
-{152,188,190,-1,-1,-1},
-{45,94,140,-1,-1,-1},
-{69,118,164,-1,-1,-1},
-{93,142,188,-1,-1,-1},
-{117,166,12,-1,-1,-1},
-{141,190,36,-1,-1,-1},
-{33,58,120,132,161,-1},
-{57,82,144,156,185,-1},
-{81,106,168,180,9,-1},
-{105,130,192,4,33,-1},
-{129,154,16,28,57,-1},
-{88,103,123,159,-1,-1},
-{112,127,147,183,-1,-1},
-{136,151,171,7,-1,-1},
-{160,175,195,31,-1,-1},
-{184,199,19,55,-1,-1},
-{2,40,41,60,180,188},
-{26,64,65,84,4,12},
-{50,88,89,108,28,36},
-{74,112,113,132,52,60},
-{98,136,137,156,76,84},
-{17,28,29,87,121,-1},
-{41,52,53,111,145,-1},
-{65,76,77,135,169,-1},
-{89,100,101,159,193,-1},
-{113,124,125,183,17,-1},
-{27,85,133,181,-1,-1},
-{51,109,157,5,-1,-1},
-{75,133,181,29,-1,-1},
-{99,157,5,53,-1,-1},
-{123,181,29,77,-1,-1},
-{7,73,157,174,196,-1},
-{31,97,181,198,20,-1},
-{55,121,5,22,44,-1},
-{79,145,29,46,68,-1},
-{103,169,53,70,92,-1},
-{30,57,94,112,189,-1},
-{54,81,118,136,13,-1},
-{78,105,142,160,37,-1},
-{102,129,166,184,61,-1},
-{126,153,190,8,85,-1},
-{24,59,100,184,-1,-1},
-{48,83,124,8,-1,-1},
-{72,107,148,32,-1,-1},
-{96,131,172,56,-1,-1},
-{120,155,196,80,-1,-1},
-{15,26,71,89,-1,-1},
-{39,50,95,113,-1,-1},
-{63,74,119,137,-1,-1},
-{87,98,143,161,-1,-1},
-{111,122,167,185,-1,-1},
-{44,61,117,128,129,166},
-{68,85,141,152,153,190},
-{92,109,165,176,177,14},
-{116,133,189,0,1,38},
-{140,157,13,24,25,62},
-{1,15,75,89,197,-1},
-{25,39,99,113,21,-1},
-{49,63,123,137,45,-1},
-{73,87,147,161,69,-1},
-{97,111,171,185,93,-1},
-{3,15,22,31,-1,-1},
-{27,39,46,55,-1,-1},
-{51,63,70,79,-1,-1},
-{75,87,94,103,-1,-1},
-{99,111,118,127,-1,-1},
-{115,141,144,156,196,-1},
-{139,165,168,180,20,-1},
-{163,189,192,4,44,-1},
-{187,13,16,28,68,-1},
-{11,37,40,52,92,-1},
-{96,117,149,181,198,-1},
-{120,141,173,5,22,-1},
-{144,165,197,29,46,-1},
-{168,189,21,53,70,-1},
-{192,13,45,77,94,-1},
-{62,76,119,145,180,195},
-{86,100,143,169,4,19},
-{110,124,167,193,28,43},
-{134,148,191,17,52,67},
-{158,172,15,41,76,91},
-{21,36,41,44,64,91},
-{45,60,65,68,88,115},
-{69,84,89,92,112,139},
-{93,108,113,116,136,163},
-{117,132,137,140,160,187},
-{43,59,196,-1,-1,-1},
-{67,83,20,-1,-1,-1},
-{91,107,44,-1,-1,-1},
-{115,131,68,-1,-1,-1},
-{139,155,92,-1,-1,-1},
-{93,94,152,162,186,-1},
-{117,118,176,186,10,-1},
-{141,142,0,10,34,-1},
-{165,166,24,34,58,-1},
-{189,190,48,58,82,-1},
-{10,38,65,88,106,116},
-{34,62,89,112,130,140},
-{58,86,113,136,154,164},
-{82,110,137,160,178,188},
-{106,134,161,184,2,12},
-{10,54,130,196,-1,-1},
-{34,78,154,20,-1,-1},
-{58,102,178,44,-1,-1},
-{82,126,2,68,-1,-1},
-{106,150,26,92,-1,-1},
-{88,125,129,-1,-1,-1},
-{112,149,153,-1,-1,-1},
-{136,173,177,-1,-1,-1},
-{160,197,1,-1,-1,-1},
-{184,21,25,-1,-1,-1},
-{114,121,132,160,187,-1},
-{138,145,156,184,11,-1},
-{162,169,180,8,35,-1},
-{186,193,4,32,59,-1},
-{10,17,28,56,83,-1},
-{4,5,40,111,156,-1},
-{28,29,64,135,180,-1},
-{52,53,88,159,4,-1},
-{76,77,112,183,28,-1},
-{100,101,136,7,52,-1},
-{1,8,30,119,162,163},
-{25,32,54,143,186,187},
-{49,56,78,167,10,11},
-{73,80,102,191,34,35},
-{97,104,126,15,58,59},
-{22,24,58,76,96,-1},
-{46,48,82,100,120,-1},
-{70,72,106,124,144,-1},
-{94,96,130,148,168,-1},
-{118,120,154,172,192,-1},
-{36,83,104,153,171,-1},
-{60,107,128,177,195,-1},
-{84,131,152,1,19,-1},
-{108,155,176,25,43,-1},
-{132,179,0,49,67,-1},
-{16,24,55,91,-1,-1},
-{40,48,79,115,-1,-1},
-{64,72,103,139,-1,-1},
-{88,96,127,163,-1,-1},
-{112,120,151,187,-1,-1},
-{20,44,81,87,-1,-1},
-{44,68,105,111,-1,-1},
-{68,92,129,135,-1,-1},
-{92,116,153,159,-1,-1},
-{116,140,177,183,-1,-1},
-{81,108,164,-1,-1,-1},
-{105,132,188,-1,-1,-1},
-{129,156,12,-1,-1,-1},
-{153,180,36,-1,-1,-1},
-{177,4,60,-1,-1,-1},
-{44,53,66,124,170,-1},
-{68,77,90,148,194,-1},
-{92,101,114,172,18,-1},
-{116,125,138,196,42,-1},
-{140,149,162,20,66,-1},
-{23,94,159,198,-1,-1},
-{47,118,183,22,-1,-1},
-{71,142,7,46,-1,-1},
-{95,166,31,70,-1,-1},
-{119,190,55,94,-1,-1},
-{166,176,193,194,-1,-1},
-{190,0,17,18,-1,-1},
-{14,24,41,42,-1,-1},
-{38,48,65,66,-1,-1},
-{62,72,89,90,-1,-1},
-{21,102,123,-1,-1,-1},
-{45,126,147,-1,-1,-1},
-{69,150,171,-1,-1,-1},
-{93,174,195,-1,-1,-1},
-{117,198,19,-1,-1,-1},
-{9,37,164,165,198,-1},
-{33,61,188,189,22,-1},
-{57,85,12,13,46,-1},
-{81,109,36,37,70,-1},
-{105,133,60,61,94,-1},
-{81,89,106,126,170,-1},
-{105,113,130,150,194,-1},
-{129,137,154,174,18,-1},
-{153,161,178,198,42,-1},
-{177,185,2,22,66,-1},
-{86,139,167,172,185,-1},
-{110,163,191,196,9,-1},
-{134,187,15,20,33,-1},
-{158,11,39,44,57,-1},
-{182,35,63,68,81,-1},
-{37,45,50,80,122,146},
-{61,69,74,104,146,170},
-{85,93,98,128,170,194},
-{109,117,122,152,194,18},
-{133,141,146,176,18,42},
-{78,132,136,155,163,-1},
-{102,156,160,179,187,-1},
-{126,180,184,3,11,-1},
-{150,4,8,27,35,-1},
-{174,28,32,51,59,-1},
-{90,126,128,135,193,195},
-{114,150,152,159,17,19},
-{138,174,176,183,41,43},
-{162,198,0,7,65,67},
-{186,22,24,31,89,91},
-{51,84,147,168,-1,-1},
-{75,108,171,192,-1,-1},
-{99,132,195,16,-1,-1},
-{123,156,19,40,-1,-1},
-{147,180,43,64,-1,-1},
-{52,61,66,95,170,-1},
-{76,85,90,119,194,-1},
-{100,109,114,143,18,-1},
-{124,133,138,167,42,-1},
-{148,157,162,191,66,-1},
-{84,112,121,157,164,-1},
-{108,136,145,181,188,-1},
-{132,160,169,5,12,-1},
-{156,184,193,29,36,-1},
-{180,8,17,53,60,-1},
-{35,56,120,151,193,-1},
-{59,80,144,175,17,-1},
-{83,104,168,199,41,-1},
-{107,128,192,23,65,-1},
-{131,152,16,47,89,-1},
-{46,171,182,-1,-1,-1},
-{70,195,6,-1,-1,-1},
-{94,19,30,-1,-1,-1},
-{118,43,54,-1,-1,-1},
-{142,67,78,-1,-1,-1},
-{47,70,138,164,167,169},
-{71,94,162,188,191,193},
-{95,118,186,12,15,17},
-{119,142,10,36,39,41},
-{143,166,34,60,63,65},
-{13,52,60,155,174,-1},
-{37,76,84,179,198,-1},
-{61,100,108,3,22,-1},
-{85,124,132,27,46,-1},
-{109,148,156,51,70,-1},
-{36,100,101,125,-1,-1},
-{60,124,125,149,-1,-1},
-{84,148,149,173,-1,-1},
-{108,172,173,197,-1,-1},
-{132,196,197,21,-1,-1},
-{22,57,80,125,-1,-1},
-{46,81,104,149,-1,-1},
-{70,105,128,173,-1,-1},
-{94,129,152,197,-1,-1},
-{118,153,176,21,-1,-1},
-{25,49,160,185,-1,-1},
-{49,73,184,9,-1,-1},
-{73,97,8,33,-1,-1},
-{97,121,32,57,-1,-1},
-{121,145,56,81,-1,-1},
-{55,86,120,136,172,190},
-{79,110,144,160,196,14},
-{103,134,168,184,20,38},
-{127,158,192,8,44,62},
-{151,182,16,32,68,86},
-{56,60,135,145,-1,-1},
-{80,84,159,169,-1,-1},
-{104,108,183,193,-1,-1},
-{128,132,7,17,-1,-1},
-{152,156,31,41,-1,-1},
-{22,34,100,113,117,-1},
-{46,58,124,137,141,-1},
-{70,82,148,161,165,-1},
-{94,106,172,185,189,-1},
-{118,130,196,9,13,-1},
-{18,80,122,131,160,192},
-{42,104,146,155,184,16},
-{66,128,170,179,8,40},
-{90,152,194,3,32,64},
-{114,176,18,27,56,88},
-{46,78,108,186,-1,-1},
-{70,102,132,10,-1,-1},
-{94,126,156,34,-1,-1},
-{118,150,180,58,-1,-1},
-{142,174,4,82,-1,-1},
-{37,48,75,108,160,166},
-{61,72,99,132,184,190},
-{85,96,123,156,8,14},
-{109,120,147,180,32,38},
-{133,144,171,4,56,62},
-{28,56,97,116,184,-1},
-{52,80,121,140,8,-1},
-{76,104,145,164,32,-1},
-{100,128,169,188,56,-1},
-{124,152,193,12,80,-1},
-{85,99,103,125,154,-1},
-{109,123,127,149,178,-1},
-{133,147,151,173,2,-1},
-{157,171,175,197,26,-1},
-{181,195,199,21,50,-1},
-{19,117,125,131,187,-1},
-{43,141,149,155,11,-1},
-{67,165,173,179,35,-1},
-{91,189,197,3,59,-1},
-{115,13,21,27,83,-1},
-{65,69,190,-1,-1,-1},
-{89,93,14,-1,-1,-1},
-{113,117,38,-1,-1,-1},
-{137,141,62,-1,-1,-1},
-{161,165,86,-1,-1,-1},
-{54,129,156,169,-1,-1},
-{78,153,180,193,-1,-1},
-{102,177,4,17,-1,-1},
-{126,1,28,41,-1,-1},
-{150,25,52,65,-1,-1},
-{17,113,163,-1,-1,-1},
-{41,137,187,-1,-1,-1},
-{65,161,11,-1,-1,-1},
-{89,185,35,-1,-1,-1},
-{113,9,59,-1,-1,-1},
-{97,134,142,177,191,-1},
-{121,158,166,1,15,-1},
-{145,182,190,25,39,-1},
-{169,6,14,49,63,-1},
-{193,30,38,73,87,-1},
-{15,41,77,123,-1,-1},
-{39,65,101,147,-1,-1},
-{63,89,125,171,-1,-1},
-{87,113,149,195,-1,-1},
-{111,137,173,19,-1,-1},
-{6,35,118,123,186,-1},
-{30,59,142,147,10,-1},
-{54,83,166,171,34,-1},
-{78,107,190,195,58,-1},
-{102,131,14,19,82,-1},
-{39,139,140,150,196,-1},
-{63,163,164,174,20,-1},
-{87,187,188,198,44,-1},
-{111,11,12,22,68,-1},
-{135,35,36,46,92,-1},
-{96,112,117,126,-1,-1},
-{120,136,141,150,-1,-1},
-{144,160,165,174,-1,-1},
-{168,184,189,198,-1,-1},
-{192,8,13,22,-1,-1},
-{27,55,81,90,161,177},
-{51,79,105,114,185,1},
-{75,103,129,138,9,25},
-{99,127,153,162,33,49},
-{123,151,177,186,57,73},
-{24,88,101,103,106,113},
-{48,112,125,127,130,137},
-{72,136,149,151,154,161},
-{96,160,173,175,178,185},
-{120,184,197,199,2,9},
-{42,60,99,-1,-1,-1},
-{66,84,123,-1,-1,-1},
-{90,108,147,-1,-1,-1},
-{114,132,171,-1,-1,-1},
-{138,156,195,-1,-1,-1},
-{8,34,51,112,-1,-1},
-{32,58,75,136,-1,-1},
-{56,82,99,160,-1,-1},
-{80,106,123,184,-1,-1},
-{104,130,147,8,-1,-1},
-{48,71,117,148,197,-1},
-{72,95,141,172,21,-1},
-{96,119,165,196,45,-1},
-{120,143,189,20,69,-1},
-{144,167,13,44,93,-1},
-{4,39,61,88,165,-1},
-{28,63,85,112,189,-1},
-{52,87,109,136,13,-1},
-{76,111,133,160,37,-1},
-{100,135,157,184,61,-1},
-{18,131,132,173,-1,-1},
-{42,155,156,197,-1,-1},
-{66,179,180,21,-1,-1},
-{90,3,4,45,-1,-1},
-{114,27,28,69,-1,-1},
-{20,38,50,62,76,-1},
-{44,62,74,86,100,-1},
-{68,86,98,110,124,-1},
-{92,110,122,134,148,-1},
-{116,134,146,158,172,-1},
-{30,74,118,158,-1,-1},
-{54,98,142,182,-1,-1},
-{78,122,166,6,-1,-1},
-{102,146,190,30,-1,-1},
-{126,170,14,54,-1,-1},
-{81,115,135,166,-1,-1},
-{105,139,159,190,-1,-1},
-{129,163,183,14,-1,-1},
-{153,187,7,38,-1,-1},
-{177,11,31,62,-1,-1},
-{112,156,158,199,-1,-1},
-{136,180,182,23,-1,-1},
-{160,4,6,47,-1,-1},
-{184,28,30,71,-1,-1},
-{8,52,54,95,-1,-1},
-{3,121,164,196,-1,-1},
-{27,145,188,20,-1,-1},
-{51,169,12,44,-1,-1},
-{75,193,36,68,-1,-1},
-{99,17,60,92,-1,-1},
-{50,66,94,120,182,-1},
-{74,90,118,144,6,-1},
-{98,114,142,168,30,-1},
-{122,138,166,192,54,-1},
-{146,162,190,16,78,-1},
-{17,56,71,118,147,170},
-{41,80,95,142,171,194},
-{65,104,119,166,195,18},
-{89,128,143,190,19,42},
-{113,152,167,14,43,66},
-{6,47,148,181,-1,-1},
-{30,71,172,5,-1,-1},
-{54,95,196,29,-1,-1},
-{78,119,20,53,-1,-1},
-{102,143,44,77,-1,-1},
-{63,93,114,-1,-1,-1},
-{87,117,138,-1,-1,-1},
-{111,141,162,-1,-1,-1},
-{135,165,186,-1,-1,-1},
-{159,189,10,-1,-1,-1},
-{8,20,65,100,127,156},
-{32,44,89,124,151,180},
-{56,68,113,148,175,4},
-{80,92,137,172,199,28},
-{104,116,161,196,23,52},
-{74,93,187,199,-1,-1},
-{98,117,11,23,-1,-1},
-{122,141,35,47,-1,-1},
-{146,165,59,71,-1,-1},
-{170,189,83,95,-1,-1},
-{17,59,73,148,-1,-1},
-{41,83,97,172,-1,-1},
-{65,107,121,196,-1,-1},
-{89,131,145,20,-1,-1},
-{113,155,169,44,-1,-1},
-{4,47,64,144,-1,-1},
-{28,71,88,168,-1,-1},
-{52,95,112,192,-1,-1},
-{76,119,136,16,-1,-1},
-{100,143,160,40,-1,-1},
-{63,95,134,186,-1,-1},
-{87,119,158,10,-1,-1},
-{111,143,182,34,-1,-1},
-{135,167,6,58,-1,-1},
-{159,191,30,82,-1,-1},
-{9,26,76,140,149,191},
-{33,50,100,164,173,15},
-{57,74,124,188,197,39},
-{81,98,148,12,21,63},
-{105,122,172,36,45,87},
-{47,108,128,140,145,182},
-{71,132,152,164,169,6},
-{95,156,176,188,193,30},
-{119,180,0,12,17,54},
-{143,4,24,36,41,78},
-{59,80,114,139,-1,-1},
-{83,104,138,163,-1,-1},
-{107,128,162,187,-1,-1},
-{131,152,186,11,-1,-1},
-{155,176,10,35,-1,-1},
-{6,70,77,84,121,140},
-{30,94,101,108,145,164},
-{54,118,125,132,169,188},
-{78,142,149,156,193,12},
-{102,166,173,180,17,36},
-{20,63,133,197,-1,-1},
-{44,87,157,21,-1,-1},
-{68,111,181,45,-1,-1},
-{92,135,5,69,-1,-1},
-{116,159,29,93,-1,-1},
-{146,151,160,190,-1,-1},
-{170,175,184,14,-1,-1},
-{194,199,8,38,-1,-1},
-{18,23,32,62,-1,-1},
-{42,47,56,86,-1,-1},
-{16,17,55,103,163,-1},
-{40,41,79,127,187,-1},
-{64,65,103,151,11,-1},
-{88,89,127,175,35,-1},
-{112,113,151,199,59,-1},
-{49,97,156,-1,-1,-1},
-{73,121,180,-1,-1,-1},
-{97,145,4,-1,-1,-1},
-{121,169,28,-1,-1,-1},
-{145,193,52,-1,-1,-1},
-{109,116,128,-1,-1,-1},
-{133,140,152,-1,-1,-1},
-{157,164,176,-1,-1,-1},
-{181,188,0,-1,-1,-1},
-{5,12,24,-1,-1,-1},
-{1,56,75,-1,-1,-1},
-{25,80,99,-1,-1,-1},
-{49,104,123,-1,-1,-1},
-{73,128,147,-1,-1,-1},
-{97,152,171,-1,-1,-1},
-{65,78,145,-1,-1,-1},
-{89,102,169,-1,-1,-1},
-{113,126,193,-1,-1,-1},
-{137,150,17,-1,-1,-1},
-{161,174,41,-1,-1,-1},
-{12,31,85,91,197,-1},
-{36,55,109,115,21,-1},
-{60,79,133,139,45,-1},
-{84,103,157,163,69,-1},
-{108,127,181,187,93,-1},
-{100,123,154,155,164,-1},
-{124,147,178,179,188,-1},
-{148,171,2,3,12,-1},
-{172,195,26,27,36,-1},
-{196,19,50,51,60,-1},
-{20,69,70,96,120,139},
-{44,93,94,120,144,163},
-{68,117,118,144,168,187},
-{92,141,142,168,192,11},
-{116,165,166,192,16,35},
-{12,29,137,-1,-1,-1},
-{36,53,161,-1,-1,-1},
-{60,77,185,-1,-1,-1},
-{84,101,9,-1,-1,-1},
-{108,125,33,-1,-1,-1},
-{13,124,133,193,-1,-1},
-{37,148,157,17,-1,-1},
-{61,172,181,41,-1,-1},
-{85,196,5,65,-1,-1},
-{109,20,29,89,-1,-1},
-{22,150,186,-1,-1,-1},
-{46,174,10,-1,-1,-1},
-{70,198,34,-1,-1,-1},
-{94,22,58,-1,-1,-1},
-{118,46,82,-1,-1,-1},
-{17,35,77,184,-1,-1},
-{41,59,101,8,-1,-1},
-{65,83,125,32,-1,-1},
-{89,107,149,56,-1,-1},
-{113,131,173,80,-1,-1},
-{3,47,85,123,184,192},
-{27,71,109,147,8,16},
-{51,95,133,171,32,40},
-{75,119,157,195,56,64},
-{99,143,181,19,80,88},
-{15,23,45,82,135,-1},
-{39,47,69,106,159,-1},
-{63,71,93,130,183,-1},
-{87,95,117,154,7,-1},
-{111,119,141,178,31,-1},
-{97,116,128,131,165,182},
-{121,140,152,155,189,6},
-{145,164,176,179,13,30},
-{169,188,0,3,37,54},
-{193,12,24,27,61,78},
-{13,64,127,141,164,-1},
-{37,88,151,165,188,-1},
-{61,112,175,189,12,-1},
-{85,136,199,13,36,-1},
-{109,160,23,37,60,-1},
-{38,136,151,156,-1,-1},
-{62,160,175,180,-1,-1},
-{86,184,199,4,-1,-1},
-{110,8,23,28,-1,-1},
-{134,32,47,52,-1,-1},
-{160,161,173,-1,-1,-1},
-{184,185,197,-1,-1,-1},
-{8,9,21,-1,-1,-1},
-{32,33,45,-1,-1,-1},
-{56,57,69,-1,-1,-1},
-{117,163,195,-1,-1,-1},
-{141,187,19,-1,-1,-1},
-{165,11,43,-1,-1,-1},
-{189,35,67,-1,-1,-1},
-{13,59,91,-1,-1,-1},
-{19,29,139,-1,-1,-1},
-{43,53,163,-1,-1,-1},
-{67,77,187,-1,-1,-1},
-{91,101,11,-1,-1,-1},
-{115,125,35,-1,-1,-1},
-{70,135,148,-1,-1,-1},
-{94,159,172,-1,-1,-1},
-{118,183,196,-1,-1,-1},
-{142,7,20,-1,-1,-1},
-{166,31,44,-1,-1,-1},
-{53,129,198,-1,-1,-1},
-{77,153,22,-1,-1,-1},
-{101,177,46,-1,-1,-1},
-{125,1,70,-1,-1,-1},
-{149,25,94,-1,-1,-1},
-{12,70,149,159,176,180},
-{36,94,173,183,0,4},
-{60,118,197,7,24,28},
-{84,142,21,31,48,52},
-{108,166,45,55,72,76},
-{15,18,33,105,179,188},
-{39,42,57,129,3,12},
-{63,66,81,153,27,36},
-{87,90,105,177,51,60},
-{111,114,129,1,75,84},
-{87,106,109,140,-1,-1},
-{111,130,133,164,-1,-1},
-{135,154,157,188,-1,-1},
-{159,178,181,12,-1,-1},
-{183,2,5,36,-1,-1},
-{10,48,65,116,184,-1},
-{34,72,89,140,8,-1},
-{58,96,113,164,32,-1},
-{82,120,137,188,56,-1},
-{106,144,161,12,80,-1},
-{5,54,97,150,-1,-1},
-{29,78,121,174,-1,-1},
-{53,102,145,198,-1,-1},
-{77,126,169,22,-1,-1},
-{101,150,193,46,-1,-1},
-{17,45,48,145,156,-1},
-{41,69,72,169,180,-1},
-{65,93,96,193,4,-1},
-{89,117,120,17,28,-1},
-{113,141,144,41,52,-1},
-{24,54,106,136,-1,-1},
-{48,78,130,160,-1,-1},
-{72,102,154,184,-1,-1},
-{96,126,178,8,-1,-1},
-{120,150,2,32,-1,-1},
-{38,88,180,-1,-1,-1},
-{62,112,4,-1,-1,-1},
-{86,136,28,-1,-1,-1},
-{110,160,52,-1,-1,-1},
-{134,184,76,-1,-1,-1},
-{38,65,142,178,-1,-1},
-{62,89,166,2,-1,-1},
-{86,113,190,26,-1,-1},
-{110,137,14,50,-1,-1},
-{134,161,38,74,-1,-1},
-{126,133,142,191,-1,-1},
-{150,157,166,15,-1,-1},
-{174,181,190,39,-1,-1},
-{198,5,14,63,-1,-1},
-{22,29,38,87,-1,-1},
-{39,88,90,133,199,-1},
-{63,112,114,157,23,-1},
-{87,136,138,181,47,-1},
-{111,160,162,5,71,-1},
-{135,184,186,29,95,-1},
-{25,36,59,193,-1,-1},
-{49,60,83,17,-1,-1},
-{73,84,107,41,-1,-1},
-{97,108,131,65,-1,-1},
-{121,132,155,89,-1,-1},
-{28,81,174,-1,-1,-1},
-{52,105,198,-1,-1,-1},
-{76,129,22,-1,-1,-1},
-{100,153,46,-1,-1,-1},
-{124,177,70,-1,-1,-1},
-{20,26,69,188,-1,-1},
-{44,50,93,12,-1,-1},
-{68,74,117,36,-1,-1},
-{92,98,141,60,-1,-1},
-{116,122,165,84,-1,-1},
-{54,156,191,197,-1,-1},
-{78,180,15,21,-1,-1},
-{102,4,39,45,-1,-1},
-{126,28,63,69,-1,-1},
-{150,52,87,93,-1,-1},
-{91,106,163,172,-1,-1},
-{115,130,187,196,-1,-1},
-{139,154,11,20,-1,-1},
-{163,178,35,44,-1,-1},
-{187,2,59,68,-1,-1},
-{43,52,56,57,103,-1},
-{67,76,80,81,127,-1},
-{91,100,104,105,151,-1},
-{115,124,128,129,175,-1},
-{139,148,152,153,199,-1},
-{4,11,34,79,-1,-1},
-{28,35,58,103,-1,-1},
-{52,59,82,127,-1,-1},
-{76,83,106,151,-1,-1},
-{100,107,130,175,-1,-1},
-{8,106,186,-1,-1,-1},
-{32,130,10,-1,-1,-1},
-{56,154,34,-1,-1,-1},
-{80,178,58,-1,-1,-1},
-{104,2,82,-1,-1,-1},
-{9,46,167,-1,-1,-1},
-{33,70,191,-1,-1,-1},
-{57,94,15,-1,-1,-1},
-{81,118,39,-1,-1,-1},
-{105,142,63,-1,-1,-1},
-{24,42,162,-1,-1,-1},
-{48,66,186,-1,-1,-1},
-{72,90,10,-1,-1,-1},
-{96,114,34,-1,-1,-1},
-{120,138,58,-1,-1,-1},
-{105,153,191,-1,-1,-1},
-{129,177,15,-1,-1,-1},
-{153,1,39,-1,-1,-1},
-{177,25,63,-1,-1,-1},
-{1,49,87,-1,-1,-1},
-{41,53,59,68,83,-1},
-{65,77,83,92,107,-1},
-{89,101,107,116,131,-1},
-{113,125,131,140,155,-1},
-{137,149,155,164,179,-1},
-{40,53,77,108,-1,-1},
-{64,77,101,132,-1,-1},
-{88,101,125,156,-1,-1},
-{112,125,149,180,-1,-1},
-{136,149,173,4,-1,-1},
-{17,57,60,74,96,120},
-{41,81,84,98,120,144},
-{65,105,108,122,144,168},
-{89,129,132,146,168,192},
-{113,153,156,170,192,16},
-{0,1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1},
-{199,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_14_16=282;
+int mercury_normal_QCbase_14_16[2090]={
+5,24,5,2,18,55,68,173,
+5,24,5,29,103,137,165,193,
+5,24,6,13,51,108,142,153,188,
+5,24,5,12,51,85,95,178,
+5,24,5,3,9,47,83,178,
+5,24,4,38,132,150,182,
+5,24,5,6,12,41,124,183,
+5,24,6,39,63,83,143,144,168,
+5,24,3,16,73,102,
+5,24,4,3,83,101,168,
+5,24,4,12,35,130,146,
+5,24,3,22,162,184,
+5,24,5,75,83,119,128,180,
+5,24,3,63,110,147,
+5,24,6,20,36,53,75,78,170,
+5,24,5,1,41,90,147,159,
+5,24,4,6,53,134,160,
+5,24,6,29,54,96,134,161,168,
+5,24,6,18,37,110,126,147,150,
+5,24,4,31,146,182,188,
+5,24,6,16,24,30,31,123,174,
+5,24,4,58,64,69,109,
+5,24,4,43,45,125,157,
+5,24,6,39,44,127,129,143,177,
+5,24,4,63,85,96,145,
+5,24,3,101,110,198,
+5,24,5,75,90,91,141,146,
+5,24,3,113,172,199,
+5,24,5,18,82,97,157,177,
+5,24,5,11,17,91,116,173,
+5,24,6,45,74,148,150,165,188,
+5,24,6,21,48,123,154,155,198,
+5,24,6,47,101,111,129,138,165,
+5,24,6,9,40,62,93,130,173,
+5,24,3,90,96,173,
+5,24,6,7,47,99,100,126,199,
+5,24,5,55,78,80,146,195,
+5,24,3,85,141,178,
+5,24,5,1,2,14,120,132,
+5,24,3,108,122,175,
+5,24,3,17,18,65,
+5,24,3,64,124,169,
+5,24,4,23,43,83,142,
+5,24,6,37,39,43,101,115,122,
+5,24,4,7,22,95,101,
+5,24,4,24,49,81,134,
+5,24,3,27,126,194,
+5,24,6,18,65,95,102,160,196,
+5,24,5,61,69,77,100,131,
+5,24,6,15,27,109,140,174,181,
+5,24,3,49,114,157,
+5,24,3,133,147,192,
+5,24,4,19,127,146,169,
+5,24,3,81,185,193,
+5,24,6,13,46,123,144,145,146,
+5,24,3,70,114,185,
+5,24,6,40,83,97,99,126,192,
+5,24,6,91,101,117,173,179,199,
+5,24,5,54,56,119,192,199,
+5,24,6,1,12,19,64,103,163,
+5,24,6,2,42,80,83,125,185,
+5,24,5,72,139,163,165,169,
+5,24,3,32,99,192,
+5,24,5,27,135,170,189,191,
+5,24,3,2,15,82,
+5,24,6,31,83,116,131,151,185,
+5,24,4,37,65,71,151,
+5,24,4,5,36,127,158,
+5,24,6,37,60,62,81,110,119,
+5,24,4,60,104,149,197,
+5,24,5,25,96,102,119,165,
+5,24,3,40,74,164,
+5,24,3,57,105,145,
+5,24,6,61,64,93,104,123,181,
+5,24,3,33,153,195,
+5,24,5,48,126,144,152,155,
+5,24,3,46,117,119,
+5,24,4,14,82,126,174,
+5,24,3,71,145,150,
+5,24,6,71,74,79,140,170,194,
+5,24,3,72,73,180,
+5,24,6,12,28,46,173,181,193,
+5,24,5,16,39,58,132,166,
+5,24,5,7,64,72,95,118,
+5,24,5,25,31,35,92,95,
+5,24,3,59,86,157,
+5,24,6,4,55,91,95,114,129,
+5,24,5,66,98,114,139,197,
+5,24,3,69,116,150,
+5,24,3,27,165,166,
+5,24,6,36,48,58,61,88,123,
+5,24,3,174,187,193,
+5,24,4,30,78,88,136,
+5,24,4,25,34,67,153,
+5,24,3,22,51,168,
+5,24,3,1,9,188,
+5,24,3,15,133,192,
+5,24,5,42,62,67,155,182,
+5,24,6,5,11,35,129,170,181,
+5,24,5,7,73,92,96,188,
+5,24,3,10,48,64,
+5,24,3,4,101,164,
+5,24,3,17,19,45,
+5,24,4,20,64,107,151,
+5,24,4,101,115,120,126,
+5,24,6,48,107,129,137,173,186,
+5,24,6,7,18,59,69,85,151,
+5,24,5,4,18,41,49,61,
+5,24,3,58,133,86,
+5,24,4,11,100,105,187,
+5,24,3,38,60,92,
+5,24,5,38,50,68,87,109,
+5,24,4,20,61,65,166,
+5,24,5,38,115,177,179,181,
+5,24,3,67,153,156,
+5,24,4,6,94,116,169,
+5,24,3,7,58,62,
+5,24,6,57,80,119,139,166,177,
+5,24,3,27,149,163,
+5,24,4,68,139,142,160,
+5,24,3,40,93,137,
+5,24,3,90,118,181,
+5,24,5,75,86,88,102,126,
+5,24,4,5,96,142,182,
+5,24,4,25,88,98,109,
+5,24,5,17,61,93,133,155,
+5,24,4,22,80,88,138,
+5,24,5,22,62,64,89,121,
+5,24,4,34,63,101,175,
+5,24,3,28,45,177,
+5,24,5,5,38,83,126,196,
+5,24,4,60,100,105,165,
+5,24,5,5,37,44,46,160,
+5,24,4,99,167,189,199,
+5,24,3,100,164,191,
+5,24,6,16,36,54,77,87,97,
+5,24,6,19,45,83,132,166,192,
+5,24,5,46,50,117,119,157,
+5,24,3,56,92,94,
+5,24,3,45,94,140,
+5,24,5,33,58,120,132,161,
+5,24,4,88,103,123,159,
+5,24,6,2,40,41,60,180,188,
+5,24,5,17,28,29,87,121,
+5,24,4,27,85,133,181,
+5,24,5,7,73,157,174,196,
+5,24,5,30,57,94,112,189,
+5,24,4,24,59,100,184,
+5,24,4,15,26,71,89,
+5,24,6,44,61,117,128,129,166,
+5,24,5,1,15,75,89,197,
+5,24,4,3,15,22,31,
+5,24,5,115,141,144,156,196,
+5,24,5,96,117,149,181,198,
+5,24,6,62,76,119,145,180,195,
+5,24,6,21,36,41,44,64,91,
+5,24,3,43,59,196,
+5,24,5,93,94,152,162,186,
+5,24,6,10,38,65,88,106,116,
+5,24,4,10,54,130,196,
+5,24,3,88,125,129,
+5,24,5,114,121,132,160,187,
+5,24,5,4,5,40,111,156,
+5,24,6,1,8,30,119,162,163,
+5,24,5,22,24,58,76,96,
+5,24,5,36,83,104,153,171,
+5,24,4,16,24,55,91,
+5,24,4,20,44,81,87,
+5,24,3,81,108,164,
+5,24,5,44,53,66,124,170,
+5,24,4,23,94,159,198,
+5,24,4,166,176,193,194,
+5,24,3,21,102,123,
+5,24,5,9,37,164,165,198,
+5,24,5,81,89,106,126,170,
+5,24,5,86,139,167,172,185,
+5,24,6,37,45,50,80,122,146,
+5,24,5,78,132,136,155,163,
+5,24,6,90,126,128,135,193,195,
+5,24,4,51,84,147,168,
+5,24,5,52,61,66,95,170,
+5,24,5,84,112,121,157,164,
+5,24,5,35,56,120,151,193,
+5,24,3,46,171,182,
+5,24,6,47,70,138,164,167,169,
+5,24,5,13,52,60,155,174,
+5,24,4,36,100,101,125,
+5,24,4,22,57,80,125,
+5,24,4,25,49,160,185,
+5,24,6,55,86,120,136,172,190,
+5,24,4,56,60,135,145,
+5,24,5,22,34,100,113,117,
+5,24,6,18,80,122,131,160,192,
+5,24,4,46,78,108,186,
+5,24,6,37,48,75,108,160,166,
+5,24,5,28,56,97,116,184,
+5,24,5,85,99,103,125,154,
+5,24,5,19,117,125,131,187,
+5,24,3,65,69,190,
+5,24,4,54,129,156,169,
+5,24,3,17,113,163,
+5,24,5,97,134,142,177,191,
+5,24,4,15,41,77,123,
+5,24,5,6,35,118,123,186,
+5,24,5,39,139,140,150,196,
+5,24,4,96,112,117,126,
+5,24,6,27,55,81,90,161,177,
+5,24,6,24,88,101,103,106,113,
+5,24,3,42,60,99,
+5,24,4,8,34,51,112,
+5,24,5,48,71,117,148,197,
+5,24,5,4,39,61,88,165,
+5,24,4,18,131,132,173,
+5,24,5,20,38,50,62,76,
+5,24,4,30,74,118,158,
+5,24,4,81,115,135,166,
+5,24,4,112,156,158,199,
+5,24,4,3,121,164,196,
+5,24,5,50,66,94,120,182,
+5,24,6,17,56,71,118,147,170,
+5,24,4,6,47,148,181,
+5,24,3,63,93,114,
+5,24,6,8,20,65,100,127,156,
+5,24,4,74,93,187,199,
+5,24,4,17,59,73,148,
+5,24,4,4,47,64,144,
+5,24,4,63,95,134,186,
+5,24,6,9,26,76,140,149,191,
+5,24,6,47,108,128,140,145,182,
+5,24,4,59,80,114,139,
+5,24,6,6,70,77,84,121,140,
+5,24,4,20,63,133,197,
+5,24,4,146,151,160,190,
+5,24,5,16,17,55,103,163,
+5,24,3,49,97,156,
+5,24,3,109,116,128,
+5,24,3,1,56,75,
+5,24,3,65,78,145,
+5,24,5,12,31,85,91,197,
+5,24,5,100,123,154,155,164,
+5,24,6,20,69,70,96,120,139,
+5,24,3,12,29,137,
+5,24,4,13,124,133,193,
+5,24,3,22,150,186,
+5,24,4,17,35,77,184,
+5,24,6,3,47,85,123,184,192,
+5,24,5,15,23,45,82,135,
+5,24,6,97,116,128,131,165,182,
+5,24,5,13,64,127,141,164,
+5,24,4,38,136,151,156,
+5,24,3,160,161,173,
+5,24,3,117,163,195,
+5,24,3,19,29,139,
+5,24,3,70,135,148,
+5,24,3,53,129,198,
+5,24,6,12,70,149,159,176,180,
+5,24,6,15,18,33,105,179,188,
+5,24,4,87,106,109,140,
+5,24,5,10,48,65,116,184,
+5,24,4,5,54,97,150,
+5,24,5,17,45,48,145,156,
+5,24,4,24,54,106,136,
+5,24,3,38,88,180,
+5,24,4,38,65,142,178,
+5,24,4,126,133,142,191,
+5,24,5,39,88,90,133,199,
+5,24,4,25,36,59,193,
+5,24,3,28,81,174,
+5,24,4,20,26,69,188,
+5,24,4,54,156,191,197,
+5,24,4,91,106,163,172,
+5,24,5,43,52,56,57,103,
+5,24,4,4,11,34,79,
+5,24,3,8,106,186,
+5,24,3,9,46,167,
+5,24,3,24,42,162,
+5,24,3,105,153,191,
+5,24,5,41,53,59,68,83,
+5,24,4,40,53,77,108,
+5,24,6,17,57,60,74,96,120,
+199,1,2,0,1,
+1,0,1,199};
@@ -25,4410 +25,17 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_2_16.h"
-int mercury_normal_Cwidth_2_16=5;
-int mercury_normal_Vwidth_2_16=9;
-int mercury_normal_dwidth_2_16=24;
-int mercury_normal_QCmatrixd_2_16[24]={20,3,20,9,20,3,20,9,20,4,20,6,20,3,20,4,20,8,20,4,1399,2,1,1};
-int mercury_normal_QCmatrixC_2_16[1400][5]={
-{15,200,-1,-1,-1},
-{200,201,-1,-1,-1},
-{166,201,202,-1,-1},
-{8,202,203,-1,-1},
-{203,204,-1,-1,-1},
-{204,205,-1,-1,-1},
-{205,206,-1,-1,-1},
-{143,206,207,-1,-1},
-{83,177,207,208,-1},
-{119,208,209,-1,-1},
-{73,209,210,-1,-1},
-{33,210,211,-1,-1},
-{181,211,212,-1,-1},
-{105,124,212,213,-1},
-{143,213,214,-1,-1},
-{214,215,-1,-1,-1},
-{74,215,216,-1,-1},
-{216,217,-1,-1,-1},
-{130,173,217,218,-1},
-{218,219,-1,-1,-1},
-{219,220,-1,-1,-1},
-{39,220,221,-1,-1},
-{62,77,221,222,-1},
-{29,222,223,-1,-1},
-{144,223,224,-1,-1},
-{224,225,-1,-1,-1},
-{88,225,226,-1,-1},
-{77,113,168,226,227},
-{45,227,228,-1,-1},
-{116,228,229,-1,-1},
-{229,230,-1,-1,-1},
-{35,230,231,-1,-1},
-{25,50,231,232,-1},
-{232,233,-1,-1,-1},
-{90,233,234,-1,-1},
-{234,235,-1,-1,-1},
-{27,34,235,236,-1},
-{236,237,-1,-1,-1},
-{237,238,-1,-1,-1},
-{238,239,-1,-1,-1},
-{239,240,-1,-1,-1},
-{175,240,241,-1,-1},
-{142,241,242,-1,-1},
-{242,243,-1,-1,-1},
-{243,244,-1,-1,-1},
-{244,245,-1,-1,-1},
-{245,246,-1,-1,-1},
-{60,246,247,-1,-1},
-{247,248,-1,-1,-1},
-{64,172,248,249,-1},
-{119,249,250,-1,-1},
-{195,250,251,-1,-1},
-{29,251,252,-1,-1},
-{252,253,-1,-1,-1},
-{16,253,254,-1,-1},
-{160,254,255,-1,-1},
-{167,255,256,-1,-1},
-{9,256,257,-1,-1},
-{257,258,-1,-1,-1},
-{258,259,-1,-1,-1},
-{259,260,-1,-1,-1},
-{144,260,261,-1,-1},
-{84,178,261,262,-1},
-{262,263,-1,-1,-1},
-{74,263,264,-1,-1},
-{34,264,265,-1,-1},
-{182,265,266,-1,-1},
-{106,125,266,267,-1},
-{144,267,268,-1,-1},
-{268,269,-1,-1,-1},
-{75,269,270,-1,-1},
-{270,271,-1,-1,-1},
-{131,174,271,272,-1},
-{272,273,-1,-1,-1},
-{273,274,-1,-1,-1},
-{274,275,-1,-1,-1},
-{63,78,275,276,-1},
-{30,276,277,-1,-1},
-{145,277,278,-1,-1},
-{278,279,-1,-1,-1},
-{89,279,280,-1,-1},
-{78,114,169,280,281},
-{46,281,282,-1,-1},
-{117,282,283,-1,-1},
-{283,284,-1,-1,-1},
-{36,284,285,-1,-1},
-{26,51,285,286,-1},
-{286,287,-1,-1,-1},
-{91,287,288,-1,-1},
-{288,289,-1,-1,-1},
-{28,35,289,290,-1},
-{290,291,-1,-1,-1},
-{291,292,-1,-1,-1},
-{292,293,-1,-1,-1},
-{293,294,-1,-1,-1},
-{176,294,295,-1,-1},
-{143,295,296,-1,-1},
-{296,297,-1,-1,-1},
-{297,298,-1,-1,-1},
-{298,299,-1,-1,-1},
-{299,300,-1,-1,-1},
-{61,300,301,-1,-1},
-{120,301,302,-1,-1},
-{65,173,302,303,-1},
-{303,304,-1,-1,-1},
-{196,304,305,-1,-1},
-{30,305,306,-1,-1},
-{306,307,-1,-1,-1},
-{17,307,308,-1,-1},
-{161,308,309,-1,-1},
-{168,309,310,-1,-1},
-{10,310,311,-1,-1},
-{311,312,-1,-1,-1},
-{312,313,-1,-1,-1},
-{313,314,-1,-1,-1},
-{145,314,315,-1,-1},
-{85,179,315,316,-1},
-{316,317,-1,-1,-1},
-{75,317,318,-1,-1},
-{35,318,319,-1,-1},
-{183,319,320,-1,-1},
-{107,126,320,321,-1},
-{145,321,322,-1,-1},
-{322,323,-1,-1,-1},
-{76,323,324,-1,-1},
-{324,325,-1,-1,-1},
-{132,175,325,326,-1},
-{326,327,-1,-1,-1},
-{327,328,-1,-1,-1},
-{328,329,-1,-1,-1},
-{64,79,329,330,-1},
-{31,330,331,-1,-1},
-{146,331,332,-1,-1},
-{332,333,-1,-1,-1},
-{90,333,334,-1,-1},
-{79,115,170,334,335},
-{47,335,336,-1,-1},
-{118,336,337,-1,-1},
-{337,338,-1,-1,-1},
-{37,338,339,-1,-1},
-{27,52,339,340,-1},
-{340,341,-1,-1,-1},
-{92,341,342,-1,-1},
-{342,343,-1,-1,-1},
-{29,36,343,344,-1},
-{344,345,-1,-1,-1},
-{345,346,-1,-1,-1},
-{346,347,-1,-1,-1},
-{347,348,-1,-1,-1},
-{177,348,349,-1,-1},
-{144,349,350,-1,-1},
-{350,351,-1,-1,-1},
-{351,352,-1,-1,-1},
-{352,353,-1,-1,-1},
-{353,354,-1,-1,-1},
-{62,354,355,-1,-1},
-{121,355,356,-1,-1},
-{66,174,356,357,-1},
-{357,358,-1,-1,-1},
-{197,358,359,-1,-1},
-{31,359,360,-1,-1},
-{360,361,-1,-1,-1},
-{18,361,362,-1,-1},
-{162,362,363,-1,-1},
-{169,363,364,-1,-1},
-{11,364,365,-1,-1},
-{365,366,-1,-1,-1},
-{366,367,-1,-1,-1},
-{367,368,-1,-1,-1},
-{146,368,369,-1,-1},
-{86,369,370,-1,-1},
-{370,371,-1,-1,-1},
-{76,371,372,-1,-1},
-{36,372,373,-1,-1},
-{184,373,374,-1,-1},
-{108,127,374,375,-1},
-{146,375,376,-1,-1},
-{376,377,-1,-1,-1},
-{77,377,378,-1,-1},
-{378,379,-1,-1,-1},
-{0,133,176,379,380},
-{380,381,-1,-1,-1},
-{381,382,-1,-1,-1},
-{382,383,-1,-1,-1},
-{65,383,384,-1,-1},
-{32,384,385,-1,-1},
-{147,385,386,-1,-1},
-{386,387,-1,-1,-1},
-{91,387,388,-1,-1},
-{116,171,388,389,-1},
-{48,389,390,-1,-1},
-{119,390,391,-1,-1},
-{391,392,-1,-1,-1},
-{38,392,393,-1,-1},
-{28,53,393,394,-1},
-{394,395,-1,-1,-1},
-{93,395,396,-1,-1},
-{396,397,-1,-1,-1},
-{30,37,397,398,-1},
-{398,399,-1,-1,-1},
-{399,400,-1,-1,-1},
-{400,401,-1,-1,-1},
-{401,402,-1,-1,-1},
-{178,402,403,-1,-1},
-{145,403,404,-1,-1},
-{404,405,-1,-1,-1},
-{405,406,-1,-1,-1},
-{406,407,-1,-1,-1},
-{407,408,-1,-1,-1},
-{63,408,409,-1,-1},
-{122,409,410,-1,-1},
-{67,175,410,411,-1},
-{411,412,-1,-1,-1},
-{198,412,413,-1,-1},
-{32,413,414,-1,-1},
-{414,415,-1,-1,-1},
-{19,415,416,-1,-1},
-{163,416,417,-1,-1},
-{170,417,418,-1,-1},
-{12,418,419,-1,-1},
-{419,420,-1,-1,-1},
-{420,421,-1,-1,-1},
-{40,421,422,-1,-1},
-{147,422,423,-1,-1},
-{87,423,424,-1,-1},
-{424,425,-1,-1,-1},
-{77,425,426,-1,-1},
-{37,426,427,-1,-1},
-{185,427,428,-1,-1},
-{109,128,428,429,-1},
-{147,429,430,-1,-1},
-{60,430,431,-1,-1},
-{78,431,432,-1,-1},
-{432,433,-1,-1,-1},
-{1,134,177,433,434},
-{434,435,-1,-1,-1},
-{80,435,436,-1,-1},
-{436,437,-1,-1,-1},
-{66,437,438,-1,-1},
-{33,438,439,-1,-1},
-{148,439,440,-1,-1},
-{440,441,-1,-1,-1},
-{92,441,442,-1,-1},
-{117,172,442,443,-1},
-{49,443,444,-1,-1},
-{444,445,-1,-1,-1},
-{445,446,-1,-1,-1},
-{39,60,446,447,-1},
-{29,54,447,448,-1},
-{448,449,-1,-1,-1},
-{94,449,450,-1,-1},
-{450,451,-1,-1,-1},
-{31,38,451,452,-1},
-{452,453,-1,-1,-1},
-{100,453,454,-1,-1},
-{454,455,-1,-1,-1},
-{455,456,-1,-1,-1},
-{179,456,457,-1,-1},
-{146,457,458,-1,-1},
-{458,459,-1,-1,-1},
-{459,460,-1,-1,-1},
-{160,460,461,-1,-1},
-{461,462,-1,-1,-1},
-{64,462,463,-1,-1},
-{123,463,464,-1,-1},
-{68,176,464,465,-1},
-{465,466,-1,-1,-1},
-{199,466,467,-1,-1},
-{33,467,468,-1,-1},
-{468,469,-1,-1,-1},
-{469,470,-1,-1,-1},
-{164,470,471,-1,-1},
-{171,471,472,-1,-1},
-{13,472,473,-1,-1},
-{473,474,-1,-1,-1},
-{474,475,-1,-1,-1},
-{41,475,476,-1,-1},
-{148,476,477,-1,-1},
-{88,477,478,-1,-1},
-{478,479,-1,-1,-1},
-{78,479,480,-1,-1},
-{38,480,481,-1,-1},
-{186,481,482,-1,-1},
-{110,129,482,483,-1},
-{148,483,484,-1,-1},
-{61,484,485,-1,-1},
-{79,485,486,-1,-1},
-{486,487,-1,-1,-1},
-{2,135,178,487,488},
-{488,489,-1,-1,-1},
-{81,489,490,-1,-1},
-{490,491,-1,-1,-1},
-{67,491,492,-1,-1},
-{34,492,493,-1,-1},
-{149,493,494,-1,-1},
-{494,495,-1,-1,-1},
-{93,495,496,-1,-1},
-{118,173,496,497,-1},
-{50,497,498,-1,-1},
-{498,499,-1,-1,-1},
-{499,500,-1,-1,-1},
-{61,500,501,-1,-1},
-{30,55,501,502,-1},
-{502,503,-1,-1,-1},
-{95,503,504,-1,-1},
-{504,505,-1,-1,-1},
-{32,39,505,506,-1},
-{180,506,507,-1,-1},
-{101,507,508,-1,-1},
-{508,509,-1,-1,-1},
-{509,510,-1,-1,-1},
-{510,511,-1,-1,-1},
-{147,511,512,-1,-1},
-{512,513,-1,-1,-1},
-{513,514,-1,-1,-1},
-{161,514,515,-1,-1},
-{515,516,-1,-1,-1},
-{65,516,517,-1,-1},
-{124,517,518,-1,-1},
-{69,177,518,519,-1},
-{519,520,-1,-1,-1},
-{520,521,-1,-1,-1},
-{34,521,522,-1,-1},
-{522,523,-1,-1,-1},
-{523,524,-1,-1,-1},
-{165,524,525,-1,-1},
-{172,525,526,-1,-1},
-{14,526,527,-1,-1},
-{527,528,-1,-1,-1},
-{528,529,-1,-1,-1},
-{42,529,530,-1,-1},
-{149,530,531,-1,-1},
-{89,531,532,-1,-1},
-{532,533,-1,-1,-1},
-{79,533,534,-1,-1},
-{39,534,535,-1,-1},
-{187,535,536,-1,-1},
-{111,130,536,537,-1},
-{149,537,538,-1,-1},
-{62,538,539,-1,-1},
-{539,540,-1,-1,-1},
-{540,541,-1,-1,-1},
-{3,136,179,541,542},
-{542,543,-1,-1,-1},
-{82,543,544,-1,-1},
-{544,545,-1,-1,-1},
-{68,545,546,-1,-1},
-{35,546,547,-1,-1},
-{150,547,548,-1,-1},
-{548,549,-1,-1,-1},
-{94,549,550,-1,-1},
-{119,174,550,551,-1},
-{51,551,552,-1,-1},
-{552,553,-1,-1,-1},
-{553,554,-1,-1,-1},
-{62,554,555,-1,-1},
-{31,56,555,556,-1},
-{556,557,-1,-1,-1},
-{96,557,558,-1,-1},
-{558,559,-1,-1,-1},
-{33,559,560,-1,-1},
-{181,560,561,-1,-1},
-{102,561,562,-1,-1},
-{562,563,-1,-1,-1},
-{180,563,564,-1,-1},
-{564,565,-1,-1,-1},
-{20,148,565,566,-1},
-{566,567,-1,-1,-1},
-{567,568,-1,-1,-1},
-{162,568,569,-1,-1},
-{569,570,-1,-1,-1},
-{66,570,571,-1,-1},
-{125,571,572,-1,-1},
-{70,178,572,573,-1},
-{573,574,-1,-1,-1},
-{574,575,-1,-1,-1},
-{35,575,576,-1,-1},
-{576,577,-1,-1,-1},
-{577,578,-1,-1,-1},
-{166,578,579,-1,-1},
-{173,579,580,-1,-1},
-{15,580,581,-1,-1},
-{581,582,-1,-1,-1},
-{100,582,583,-1,-1},
-{43,583,584,-1,-1},
-{150,584,585,-1,-1},
-{90,585,586,-1,-1},
-{586,587,-1,-1,-1},
-{587,588,-1,-1,-1},
-{588,589,-1,-1,-1},
-{188,589,590,-1,-1},
-{112,131,590,591,-1},
-{150,591,592,-1,-1},
-{63,592,593,-1,-1},
-{593,594,-1,-1,-1},
-{20,594,595,-1,-1},
-{4,137,595,596,-1},
-{596,597,-1,-1,-1},
-{83,597,598,-1,-1},
-{598,599,-1,-1,-1},
-{69,599,600,-1,-1},
-{36,600,601,-1,-1},
-{151,601,602,-1,-1},
-{602,603,-1,-1,-1},
-{95,603,604,-1,-1},
-{175,604,605,-1,-1},
-{52,605,606,-1,-1},
-{606,607,-1,-1,-1},
-{607,608,-1,-1,-1},
-{63,608,609,-1,-1},
-{32,57,609,610,-1},
-{610,611,-1,-1,-1},
-{97,611,612,-1,-1},
-{612,613,-1,-1,-1},
-{34,613,614,-1,-1},
-{182,614,615,-1,-1},
-{103,615,616,-1,-1},
-{616,617,-1,-1,-1},
-{181,617,618,-1,-1},
-{618,619,-1,-1,-1},
-{21,149,619,620,-1},
-{620,621,-1,-1,-1},
-{621,622,-1,-1,-1},
-{163,622,623,-1,-1},
-{100,623,624,-1,-1},
-{67,624,625,-1,-1},
-{126,625,626,-1,-1},
-{71,179,626,627,-1},
-{627,628,-1,-1,-1},
-{628,629,-1,-1,-1},
-{36,629,630,-1,-1},
-{630,631,-1,-1,-1},
-{631,632,-1,-1,-1},
-{167,632,633,-1,-1},
-{174,633,634,-1,-1},
-{16,634,635,-1,-1},
-{635,636,-1,-1,-1},
-{101,636,637,-1,-1},
-{44,637,638,-1,-1},
-{151,638,639,-1,-1},
-{91,639,640,-1,-1},
-{640,641,-1,-1,-1},
-{641,642,-1,-1,-1},
-{642,643,-1,-1,-1},
-{189,643,644,-1,-1},
-{113,132,644,645,-1},
-{151,645,646,-1,-1},
-{64,646,647,-1,-1},
-{647,648,-1,-1,-1},
-{21,648,649,-1,-1},
-{5,138,649,650,-1},
-{650,651,-1,-1,-1},
-{84,651,652,-1,-1},
-{652,653,-1,-1,-1},
-{70,653,654,-1,-1},
-{37,654,655,-1,-1},
-{152,655,656,-1,-1},
-{656,657,-1,-1,-1},
-{96,657,658,-1,-1},
-{176,658,659,-1,-1},
-{53,659,660,-1,-1},
-{660,661,-1,-1,-1},
-{661,662,-1,-1,-1},
-{64,662,663,-1,-1},
-{33,58,663,664,-1},
-{664,665,-1,-1,-1},
-{98,665,666,-1,-1},
-{666,667,-1,-1,-1},
-{35,667,668,-1,-1},
-{183,668,669,-1,-1},
-{104,669,670,-1,-1},
-{670,671,-1,-1,-1},
-{182,671,672,-1,-1},
-{672,673,-1,-1,-1},
-{22,150,673,674,-1},
-{674,675,-1,-1,-1},
-{675,676,-1,-1,-1},
-{164,676,677,-1,-1},
-{101,677,678,-1,-1},
-{68,678,679,-1,-1},
-{127,679,680,-1,-1},
-{72,680,681,-1,-1},
-{681,682,-1,-1,-1},
-{682,683,-1,-1,-1},
-{37,683,684,-1,-1},
-{684,685,-1,-1,-1},
-{685,686,-1,-1,-1},
-{168,686,687,-1,-1},
-{175,687,688,-1,-1},
-{17,688,689,-1,-1},
-{160,689,690,-1,-1},
-{102,690,691,-1,-1},
-{45,691,692,-1,-1},
-{152,692,693,-1,-1},
-{92,693,694,-1,-1},
-{694,695,-1,-1,-1},
-{695,696,-1,-1,-1},
-{696,697,-1,-1,-1},
-{190,697,698,-1,-1},
-{114,133,698,699,-1},
-{152,699,700,-1,-1},
-{65,700,701,-1,-1},
-{701,702,-1,-1,-1},
-{22,702,703,-1,-1},
-{6,60,139,703,704},
-{704,705,-1,-1,-1},
-{85,705,706,-1,-1},
-{706,707,-1,-1,-1},
-{71,707,708,-1,-1},
-{38,60,708,709,-1},
-{153,709,710,-1,-1},
-{710,711,-1,-1,-1},
-{97,711,712,-1,-1},
-{177,712,713,-1,-1},
-{54,713,714,-1,-1},
-{714,715,-1,-1,-1},
-{715,716,-1,-1,-1},
-{65,716,717,-1,-1},
-{34,59,717,718,-1},
-{718,719,-1,-1,-1},
-{99,719,720,-1,-1},
-{720,721,-1,-1,-1},
-{36,721,722,-1,-1},
-{184,722,723,-1,-1},
-{105,723,724,-1,-1},
-{724,725,-1,-1,-1},
-{183,725,726,-1,-1},
-{726,727,-1,-1,-1},
-{23,151,727,728,-1},
-{728,729,-1,-1,-1},
-{729,730,-1,-1,-1},
-{165,730,731,-1,-1},
-{102,731,732,-1,-1},
-{69,732,733,-1,-1},
-{128,733,734,-1,-1},
-{73,734,735,-1,-1},
-{735,736,-1,-1,-1},
-{736,737,-1,-1,-1},
-{38,737,738,-1,-1},
-{738,739,-1,-1,-1},
-{739,740,-1,-1,-1},
-{169,740,741,-1,-1},
-{176,741,742,-1,-1},
-{18,742,743,-1,-1},
-{161,743,744,-1,-1},
-{103,744,745,-1,-1},
-{46,745,746,-1,-1},
-{153,746,747,-1,-1},
-{93,747,748,-1,-1},
-{748,749,-1,-1,-1},
-{749,750,-1,-1,-1},
-{750,751,-1,-1,-1},
-{191,751,752,-1,-1},
-{115,134,752,753,-1},
-{153,753,754,-1,-1},
-{66,754,755,-1,-1},
-{755,756,-1,-1,-1},
-{23,756,757,-1,-1},
-{7,61,757,758,-1},
-{758,759,-1,-1,-1},
-{86,759,760,-1,-1},
-{760,761,-1,-1,-1},
-{72,761,762,-1,-1},
-{39,61,762,763,-1},
-{154,763,764,-1,-1},
-{100,764,765,-1,-1},
-{98,765,766,-1,-1},
-{178,766,767,-1,-1},
-{55,767,768,-1,-1},
-{768,769,-1,-1,-1},
-{769,770,-1,-1,-1},
-{66,770,771,-1,-1},
-{35,771,772,-1,-1},
-{772,773,-1,-1,-1},
-{773,774,-1,-1,-1},
-{774,775,-1,-1,-1},
-{37,775,776,-1,-1},
-{185,776,777,-1,-1},
-{106,777,778,-1,-1},
-{778,779,-1,-1,-1},
-{184,779,780,-1,-1},
-{780,781,-1,-1,-1},
-{24,152,781,782,-1},
-{782,783,-1,-1,-1},
-{783,784,-1,-1,-1},
-{166,784,785,-1,-1},
-{103,785,786,-1,-1},
-{70,786,787,-1,-1},
-{129,787,788,-1,-1},
-{74,788,789,-1,-1},
-{0,789,790,-1,-1},
-{790,791,-1,-1,-1},
-{39,791,792,-1,-1},
-{792,793,-1,-1,-1},
-{793,794,-1,-1,-1},
-{170,794,795,-1,-1},
-{177,795,796,-1,-1},
-{19,796,797,-1,-1},
-{162,797,798,-1,-1},
-{104,798,799,-1,-1},
-{47,799,800,-1,-1},
-{154,800,801,-1,-1},
-{94,801,802,-1,-1},
-{802,803,-1,-1,-1},
-{803,804,-1,-1,-1},
-{804,805,-1,-1,-1},
-{192,805,806,-1,-1},
-{116,135,806,807,-1},
-{154,807,808,-1,-1},
-{67,808,809,-1,-1},
-{809,810,-1,-1,-1},
-{24,810,811,-1,-1},
-{8,62,811,812,-1},
-{812,813,-1,-1,-1},
-{87,813,814,-1,-1},
-{814,815,-1,-1,-1},
-{73,815,816,-1,-1},
-{62,816,817,-1,-1},
-{155,817,818,-1,-1},
-{101,818,819,-1,-1},
-{99,819,820,-1,-1},
-{20,179,820,821,-1},
-{56,821,822,-1,-1},
-{822,823,-1,-1,-1},
-{823,824,-1,-1,-1},
-{67,824,825,-1,-1},
-{36,825,826,-1,-1},
-{826,827,-1,-1,-1},
-{827,828,-1,-1,-1},
-{828,829,-1,-1,-1},
-{38,829,830,-1,-1},
-{160,186,830,831,-1},
-{107,831,832,-1,-1},
-{832,833,-1,-1,-1},
-{185,833,834,-1,-1},
-{834,835,-1,-1,-1},
-{25,153,835,836,-1},
-{836,837,-1,-1,-1},
-{837,838,-1,-1,-1},
-{167,838,839,-1,-1},
-{104,839,840,-1,-1},
-{71,180,840,841,-1},
-{130,841,842,-1,-1},
-{75,842,843,-1,-1},
-{1,843,844,-1,-1},
-{844,845,-1,-1,-1},
-{845,846,-1,-1,-1},
-{846,847,-1,-1,-1},
-{847,848,-1,-1,-1},
-{171,848,849,-1,-1},
-{178,849,850,-1,-1},
-{850,851,-1,-1,-1},
-{163,851,852,-1,-1},
-{105,852,853,-1,-1},
-{48,853,854,-1,-1},
-{155,854,855,-1,-1},
-{95,855,856,-1,-1},
-{856,857,-1,-1,-1},
-{857,858,-1,-1,-1},
-{858,859,-1,-1,-1},
-{60,193,859,860,-1},
-{117,136,860,861,-1},
-{155,861,862,-1,-1},
-{68,862,863,-1,-1},
-{863,864,-1,-1,-1},
-{25,864,865,-1,-1},
-{9,63,865,866,-1},
-{866,867,-1,-1,-1},
-{88,867,868,-1,-1},
-{868,869,-1,-1,-1},
-{74,869,870,-1,-1},
-{63,870,871,-1,-1},
-{156,871,872,-1,-1},
-{102,872,873,-1,-1},
-{873,874,-1,-1,-1},
-{21,874,875,-1,-1},
-{57,875,876,-1,-1},
-{876,877,-1,-1,-1},
-{877,878,-1,-1,-1},
-{68,878,879,-1,-1},
-{20,37,879,880,-1},
-{880,881,-1,-1,-1},
-{881,882,-1,-1,-1},
-{882,883,-1,-1,-1},
-{39,883,884,-1,-1},
-{161,187,884,885,-1},
-{108,885,886,-1,-1},
-{886,887,-1,-1,-1},
-{186,887,888,-1,-1},
-{888,889,-1,-1,-1},
-{26,154,889,890,-1},
-{890,891,-1,-1,-1},
-{891,892,-1,-1,-1},
-{168,892,893,-1,-1},
-{105,893,894,-1,-1},
-{72,181,894,895,-1},
-{131,895,896,-1,-1},
-{76,896,897,-1,-1},
-{2,897,898,-1,-1},
-{898,899,-1,-1,-1},
-{899,900,-1,-1,-1},
-{900,901,-1,-1,-1},
-{901,902,-1,-1,-1},
-{172,902,903,-1,-1},
-{179,903,904,-1,-1},
-{904,905,-1,-1,-1},
-{164,905,906,-1,-1},
-{106,906,907,-1,-1},
-{49,60,907,908,-1},
-{20,156,908,909,-1},
-{96,909,910,-1,-1},
-{910,911,-1,-1,-1},
-{911,912,-1,-1,-1},
-{912,913,-1,-1,-1},
-{61,194,913,914,-1},
-{118,137,914,915,-1},
-{156,160,915,916,-1},
-{69,916,917,-1,-1},
-{917,918,-1,-1,-1},
-{26,918,919,-1,-1},
-{10,64,919,920,-1},
-{920,921,-1,-1,-1},
-{89,921,922,-1,-1},
-{922,923,-1,-1,-1},
-{75,923,924,-1,-1},
-{64,100,924,925,-1},
-{157,925,926,-1,-1},
-{103,926,927,-1,-1},
-{927,928,-1,-1,-1},
-{22,928,929,-1,-1},
-{58,929,930,-1,-1},
-{930,931,-1,-1,-1},
-{931,932,-1,-1,-1},
-{69,932,933,-1,-1},
-{21,38,933,934,-1},
-{934,935,-1,-1,-1},
-{935,936,-1,-1,-1},
-{936,937,-1,-1,-1},
-{937,938,-1,-1,-1},
-{162,188,938,939,-1},
-{109,939,940,-1,-1},
-{940,941,-1,-1,-1},
-{187,941,942,-1,-1},
-{942,943,-1,-1,-1},
-{27,155,943,944,-1},
-{944,945,-1,-1,-1},
-{945,946,-1,-1,-1},
-{169,946,947,-1,-1},
-{106,947,948,-1,-1},
-{73,182,948,949,-1},
-{132,949,950,-1,-1},
-{77,950,951,-1,-1},
-{3,951,952,-1,-1},
-{952,953,-1,-1,-1},
-{953,954,-1,-1,-1},
-{954,955,-1,-1,-1},
-{955,956,-1,-1,-1},
-{173,956,957,-1,-1},
-{957,958,-1,-1,-1},
-{958,959,-1,-1,-1},
-{165,959,960,-1,-1},
-{107,960,961,-1,-1},
-{50,61,961,962,-1},
-{21,157,962,963,-1},
-{97,963,964,-1,-1},
-{964,965,-1,-1,-1},
-{965,966,-1,-1,-1},
-{966,967,-1,-1,-1},
-{62,195,967,968,-1},
-{119,138,968,969,-1},
-{157,161,969,970,-1},
-{70,970,971,-1,-1},
-{971,972,-1,-1,-1},
-{27,972,973,-1,-1},
-{11,65,973,974,-1},
-{974,975,-1,-1,-1},
-{90,975,976,-1,-1},
-{976,977,-1,-1,-1},
-{76,977,978,-1,-1},
-{65,101,978,979,-1},
-{158,979,980,-1,-1},
-{104,980,981,-1,-1},
-{981,982,-1,-1,-1},
-{23,982,983,-1,-1},
-{59,983,984,-1,-1},
-{984,985,-1,-1,-1},
-{985,986,-1,-1,-1},
-{70,986,987,-1,-1},
-{22,39,987,988,-1},
-{988,989,-1,-1,-1},
-{989,990,-1,-1,-1},
-{990,991,-1,-1,-1},
-{991,992,-1,-1,-1},
-{163,189,992,993,-1},
-{110,993,994,-1,-1},
-{994,995,-1,-1,-1},
-{188,995,996,-1,-1},
-{996,997,-1,-1,-1},
-{28,156,997,998,-1},
-{998,999,-1,-1,-1},
-{999,1000,-1,-1,-1},
-{160,170,1000,1001,-1},
-{107,1001,1002,-1,-1},
-{74,183,1002,1003,-1},
-{133,1003,1004,-1,-1},
-{78,1004,1005,-1,-1},
-{4,1005,1006,-1,-1},
-{1006,1007,-1,-1,-1},
-{1007,1008,-1,-1,-1},
-{1008,1009,-1,-1,-1},
-{1009,1010,-1,-1,-1},
-{174,1010,1011,-1,-1},
-{1011,1012,-1,-1,-1},
-{1012,1013,-1,-1,-1},
-{166,1013,1014,-1,-1},
-{108,1014,1015,-1,-1},
-{51,62,1015,1016,-1},
-{22,158,1016,1017,-1},
-{98,1017,1018,-1,-1},
-{1018,1019,-1,-1,-1},
-{1019,1020,-1,-1,-1},
-{1020,1021,-1,-1,-1},
-{63,196,1021,1022,-1},
-{139,1022,1023,-1,-1},
-{158,162,1023,1024,-1},
-{71,1024,1025,-1,-1},
-{1025,1026,-1,-1,-1},
-{28,1026,1027,-1,-1},
-{12,66,1027,1028,-1},
-{1028,1029,-1,-1,-1},
-{91,1029,1030,-1,-1},
-{1030,1031,-1,-1,-1},
-{77,1031,1032,-1,-1},
-{66,102,1032,1033,-1},
-{159,1033,1034,-1,-1},
-{105,1034,1035,-1,-1},
-{1035,1036,-1,-1,-1},
-{24,1036,1037,-1,-1},
-{1037,1038,-1,-1,-1},
-{1038,1039,-1,-1,-1},
-{1039,1040,-1,-1,-1},
-{71,1040,1041,-1,-1},
-{23,1041,1042,-1,-1},
-{1042,1043,-1,-1,-1},
-{1043,1044,-1,-1,-1},
-{1044,1045,-1,-1,-1},
-{1045,1046,-1,-1,-1},
-{164,190,1046,1047,-1},
-{111,1047,1048,-1,-1},
-{1048,1049,-1,-1,-1},
-{189,1049,1050,-1,-1},
-{1050,1051,-1,-1,-1},
-{29,157,1051,1052,-1},
-{1052,1053,-1,-1,-1},
-{1053,1054,-1,-1,-1},
-{161,171,1054,1055,-1},
-{108,1055,1056,-1,-1},
-{75,184,1056,1057,-1},
-{134,1057,1058,-1,-1},
-{79,1058,1059,-1,-1},
-{5,1059,1060,-1,-1},
-{1060,1061,-1,-1,-1},
-{1061,1062,-1,-1,-1},
-{1062,1063,-1,-1,-1},
-{1063,1064,-1,-1,-1},
-{175,1064,1065,-1,-1},
-{1065,1066,-1,-1,-1},
-{1066,1067,-1,-1,-1},
-{167,1067,1068,-1,-1},
-{109,1068,1069,-1,-1},
-{52,63,1069,1070,-1},
-{23,159,1070,1071,-1},
-{99,1071,1072,-1,-1},
-{1072,1073,-1,-1,-1},
-{1073,1074,-1,-1,-1},
-{1074,1075,-1,-1,-1},
-{64,197,1075,1076,-1},
-{1076,1077,-1,-1,-1},
-{120,159,163,1077,1078},
-{72,1078,1079,-1,-1},
-{1079,1080,-1,-1,-1},
-{29,1080,1081,-1,-1},
-{13,67,1081,1082,-1},
-{1082,1083,-1,-1,-1},
-{92,1083,1084,-1,-1},
-{1084,1085,-1,-1,-1},
-{78,1085,1086,-1,-1},
-{67,103,1086,1087,-1},
-{1087,1088,-1,-1,-1},
-{106,1088,1089,-1,-1},
-{1089,1090,-1,-1,-1},
-{25,1090,1091,-1,-1},
-{40,1091,1092,-1,-1},
-{1092,1093,-1,-1,-1},
-{80,1093,1094,-1,-1},
-{72,1094,1095,-1,-1},
-{24,1095,1096,-1,-1},
-{1096,1097,-1,-1,-1},
-{1097,1098,-1,-1,-1},
-{1098,1099,-1,-1,-1},
-{1099,1100,-1,-1,-1},
-{165,191,1100,1101,-1},
-{112,1101,1102,-1,-1},
-{1102,1103,-1,-1,-1},
-{190,1103,1104,-1,-1},
-{1104,1105,-1,-1,-1},
-{30,158,1105,1106,-1},
-{1106,1107,-1,-1,-1},
-{1107,1108,-1,-1,-1},
-{162,172,1108,1109,-1},
-{109,1109,1110,-1,-1},
-{76,185,1110,1111,-1},
-{135,1111,1112,-1,-1},
-{1112,1113,-1,-1,-1},
-{6,1113,1114,-1,-1},
-{1114,1115,-1,-1,-1},
-{1115,1116,-1,-1,-1},
-{1116,1117,-1,-1,-1},
-{1117,1118,-1,-1,-1},
-{176,1118,1119,-1,-1},
-{1119,1120,-1,-1,-1},
-{1120,1121,-1,-1,-1},
-{168,1121,1122,-1,-1},
-{110,1122,1123,-1,-1},
-{53,64,1123,1124,-1},
-{24,1124,1125,-1,-1},
-{1125,1126,-1,-1,-1},
-{1126,1127,-1,-1,-1},
-{1127,1128,-1,-1,-1},
-{1128,1129,-1,-1,-1},
-{65,198,1129,1130,-1},
-{1130,1131,-1,-1,-1},
-{121,164,1131,1132,-1},
-{73,1132,1133,-1,-1},
-{1133,1134,-1,-1,-1},
-{30,1134,1135,-1,-1},
-{14,68,1135,1136,-1},
-{20,1136,1137,-1,-1},
-{93,1137,1138,-1,-1},
-{1138,1139,-1,-1,-1},
-{79,1139,1140,-1,-1},
-{68,104,1140,1141,-1},
-{1141,1142,-1,-1,-1},
-{107,1142,1143,-1,-1},
-{1143,1144,-1,-1,-1},
-{26,1144,1145,-1,-1},
-{41,1145,1146,-1,-1},
-{1146,1147,-1,-1,-1},
-{81,1147,1148,-1,-1},
-{73,1148,1149,-1,-1},
-{25,1149,1150,-1,-1},
-{1150,1151,-1,-1,-1},
-{1151,1152,-1,-1,-1},
-{1152,1153,-1,-1,-1},
-{1153,1154,-1,-1,-1},
-{166,192,1154,1155,-1},
-{113,1155,1156,-1,-1},
-{1156,1157,-1,-1,-1},
-{191,1157,1158,-1,-1},
-{1158,1159,-1,-1,-1},
-{31,159,1159,1160,-1},
-{1160,1161,-1,-1,-1},
-{1161,1162,-1,-1,-1},
-{163,173,1162,1163,-1},
-{110,1163,1164,-1,-1},
-{77,186,1164,1165,-1},
-{20,136,1165,1166,-1},
-{1166,1167,-1,-1,-1},
-{7,1167,1168,-1,-1},
-{1168,1169,-1,-1,-1},
-{1169,1170,-1,-1,-1},
-{0,1170,1171,-1,-1},
-{1171,1172,-1,-1,-1},
-{177,1172,1173,-1,-1},
-{1173,1174,-1,-1,-1},
-{1174,1175,-1,-1,-1},
-{169,1175,1176,-1,-1},
-{111,1176,1177,-1,-1},
-{54,65,1177,1178,-1},
-{25,1178,1179,-1,-1},
-{1179,1180,-1,-1,-1},
-{1180,1181,-1,-1,-1},
-{1181,1182,-1,-1,-1},
-{1182,1183,-1,-1,-1},
-{66,199,1183,1184,-1},
-{1184,1185,-1,-1,-1},
-{122,165,1185,1186,-1},
-{74,1186,1187,-1,-1},
-{1187,1188,-1,-1,-1},
-{31,1188,1189,-1,-1},
-{15,69,1189,1190,-1},
-{21,1190,1191,-1,-1},
-{94,1191,1192,-1,-1},
-{1192,1193,-1,-1,-1},
-{80,1193,1194,-1,-1},
-{69,105,160,1194,1195},
-{1195,1196,-1,-1,-1},
-{108,1196,1197,-1,-1},
-{1197,1198,-1,-1,-1},
-{27,1198,1199,-1,-1},
-{42,1199,1200,-1,-1},
-{1200,1201,-1,-1,-1},
-{82,1201,1202,-1,-1},
-{74,1202,1203,-1,-1},
-{26,1203,1204,-1,-1},
-{1204,1205,-1,-1,-1},
-{1205,1206,-1,-1,-1},
-{1206,1207,-1,-1,-1},
-{1207,1208,-1,-1,-1},
-{167,193,1208,1209,-1},
-{114,1209,1210,-1,-1},
-{1210,1211,-1,-1,-1},
-{192,1211,1212,-1,-1},
-{1212,1213,-1,-1,-1},
-{32,1213,1214,-1,-1},
-{1214,1215,-1,-1,-1},
-{1215,1216,-1,-1,-1},
-{164,174,1216,1217,-1},
-{111,1217,1218,-1,-1},
-{78,187,1218,1219,-1},
-{21,137,1219,1220,-1},
-{1220,1221,-1,-1,-1},
-{8,1221,1222,-1,-1},
-{1222,1223,-1,-1,-1},
-{1223,1224,-1,-1,-1},
-{1,1224,1225,-1,-1},
-{1225,1226,-1,-1,-1},
-{178,1226,1227,-1,-1},
-{1227,1228,-1,-1,-1},
-{1228,1229,-1,-1,-1},
-{170,1229,1230,-1,-1},
-{112,1230,1231,-1,-1},
-{55,66,1231,1232,-1},
-{26,1232,1233,-1,-1},
-{1233,1234,-1,-1,-1},
-{1234,1235,-1,-1,-1},
-{1235,1236,-1,-1,-1},
-{1236,1237,-1,-1,-1},
-{67,1237,1238,-1,-1},
-{1238,1239,-1,-1,-1},
-{123,166,1239,1240,-1},
-{75,1240,1241,-1,-1},
-{1241,1242,-1,-1,-1},
-{32,1242,1243,-1,-1},
-{16,70,1243,1244,-1},
-{22,1244,1245,-1,-1},
-{95,1245,1246,-1,-1},
-{1246,1247,-1,-1,-1},
-{81,1247,1248,-1,-1},
-{70,106,161,1248,1249},
-{1249,1250,-1,-1,-1},
-{109,1250,1251,-1,-1},
-{1251,1252,-1,-1,-1},
-{28,1252,1253,-1,-1},
-{43,1253,1254,-1,-1},
-{1254,1255,-1,-1,-1},
-{83,1255,1256,-1,-1},
-{75,1256,1257,-1,-1},
-{20,27,1257,1258,-1},
-{1258,1259,-1,-1,-1},
-{1259,1260,-1,-1,-1},
-{1260,1261,-1,-1,-1},
-{1261,1262,-1,-1,-1},
-{168,194,1262,1263,-1},
-{115,1263,1264,-1,-1},
-{1264,1265,-1,-1,-1},
-{193,1265,1266,-1,-1},
-{1266,1267,-1,-1,-1},
-{33,1267,1268,-1,-1},
-{1268,1269,-1,-1,-1},
-{1269,1270,-1,-1,-1},
-{165,175,1270,1271,-1},
-{112,1271,1272,-1,-1},
-{79,188,1272,1273,-1},
-{22,138,1273,1274,-1},
-{1274,1275,-1,-1,-1},
-{9,1275,1276,-1,-1},
-{1276,1277,-1,-1,-1},
-{160,1277,1278,-1,-1},
-{2,1278,1279,-1,-1},
-{1279,1280,-1,-1,-1},
-{179,1280,1281,-1,-1},
-{1281,1282,-1,-1,-1},
-{1282,1283,-1,-1,-1},
-{171,1283,1284,-1,-1},
-{113,1284,1285,-1,-1},
-{56,67,1285,1286,-1},
-{27,1286,1287,-1,-1},
-{1287,1288,-1,-1,-1},
-{1288,1289,-1,-1,-1},
-{1289,1290,-1,-1,-1},
-{1290,1291,-1,-1,-1},
-{68,1291,1292,-1,-1},
-{1292,1293,-1,-1,-1},
-{124,167,1293,1294,-1},
-{76,1294,1295,-1,-1},
-{1295,1296,-1,-1,-1},
-{33,1296,1297,-1,-1},
-{17,71,1297,1298,-1},
-{23,1298,1299,-1,-1},
-{96,1299,1300,-1,-1},
-{1300,1301,-1,-1,-1},
-{82,1301,1302,-1,-1},
-{71,107,162,1302,1303},
-{1303,1304,-1,-1,-1},
-{110,1304,1305,-1,-1},
-{1305,1306,-1,-1,-1},
-{29,1306,1307,-1,-1},
-{44,1307,1308,-1,-1},
-{1308,1309,-1,-1,-1},
-{84,1309,1310,-1,-1},
-{76,1310,1311,-1,-1},
-{21,28,1311,1312,-1},
-{1312,1313,-1,-1,-1},
-{1313,1314,-1,-1,-1},
-{1314,1315,-1,-1,-1},
-{1315,1316,-1,-1,-1},
-{169,195,1316,1317,-1},
-{116,1317,1318,-1,-1},
-{1318,1319,-1,-1,-1},
-{194,1319,1320,-1,-1},
-{1320,1321,-1,-1,-1},
-{34,1321,1322,-1,-1},
-{1322,1323,-1,-1,-1},
-{1323,1324,-1,-1,-1},
-{166,176,1324,1325,-1},
-{113,1325,1326,-1,-1},
-{189,1326,1327,-1,-1},
-{23,139,1327,1328,-1},
-{1328,1329,-1,-1,-1},
-{10,1329,1330,-1,-1},
-{1330,1331,-1,-1,-1},
-{161,1331,1332,-1,-1},
-{3,1332,1333,-1,-1},
-{1333,1334,-1,-1,-1},
-{1334,1335,-1,-1,-1},
-{1335,1336,-1,-1,-1},
-{1336,1337,-1,-1,-1},
-{172,1337,1338,-1,-1},
-{114,1338,1339,-1,-1},
-{57,68,1339,1340,-1},
-{28,1340,1341,-1,-1},
-{1341,1342,-1,-1,-1},
-{100,1342,1343,-1,-1},
-{1343,1344,-1,-1,-1},
-{1344,1345,-1,-1,-1},
-{69,1345,1346,-1,-1},
-{1346,1347,-1,-1,-1},
-{125,168,1347,1348,-1},
-{77,1348,1349,-1,-1},
-{1349,1350,-1,-1,-1},
-{34,1350,1351,-1,-1},
-{18,72,1351,1352,-1},
-{24,1352,1353,-1,-1},
-{97,1353,1354,-1,-1},
-{1354,1355,-1,-1,-1},
-{83,1355,1356,-1,-1},
-{72,108,163,1356,1357},
-{40,1357,1358,-1,-1},
-{111,1358,1359,-1,-1},
-{1359,1360,-1,-1,-1},
-{30,1360,1361,-1,-1},
-{20,45,1361,1362,-1},
-{1362,1363,-1,-1,-1},
-{85,1363,1364,-1,-1},
-{77,1364,1365,-1,-1},
-{22,29,1365,1366,-1},
-{1366,1367,-1,-1,-1},
-{1367,1368,-1,-1,-1},
-{1368,1369,-1,-1,-1},
-{1369,1370,-1,-1,-1},
-{170,196,1370,1371,-1},
-{117,1371,1372,-1,-1},
-{1372,1373,-1,-1,-1},
-{195,1373,1374,-1,-1},
-{1374,1375,-1,-1,-1},
-{35,1375,1376,-1,-1},
-{1376,1377,-1,-1,-1},
-{1377,1378,-1,-1,-1},
-{167,177,1378,1379,-1},
-{114,1379,1380,-1,-1},
-{190,1380,1381,-1,-1},
-{24,1381,1382,-1,-1},
-{1382,1383,-1,-1,-1},
-{11,1383,1384,-1,-1},
-{1384,1385,-1,-1,-1},
-{162,1385,1386,-1,-1},
-{4,1386,1387,-1,-1},
-{1387,1388,-1,-1,-1},
-{1388,1389,-1,-1,-1},
-{1389,1390,-1,-1,-1},
-{1390,1391,-1,-1,-1},
-{173,1391,1392,-1,-1},
-{115,1392,1393,-1,-1},
-{58,69,1393,1394,-1},
-{29,1394,1395,-1,-1},
-{1395,1396,-1,-1,-1},
-{101,120,1396,1397,-1},
-{1397,1398,-1,-1,-1},
-{1398,1399,-1,-1,-1},
-{70,1399,1400,-1,-1},
-{1400,1401,-1,-1,-1},
-{126,169,1401,1402,-1},
-{78,1402,1403,-1,-1},
-{1403,1404,-1,-1,-1},
-{35,1404,1405,-1,-1},
-{19,73,1405,1406,-1},
-{25,1406,1407,-1,-1},
-{98,140,1407,1408,-1},
-{1408,1409,-1,-1,-1},
-{84,1409,1410,-1,-1},
-{73,109,164,1410,1411},
-{41,1411,1412,-1,-1},
-{112,1412,1413,-1,-1},
-{1413,1414,-1,-1,-1},
-{31,1414,1415,-1,-1},
-{21,46,1415,1416,-1},
-{1416,1417,-1,-1,-1},
-{86,1417,1418,-1,-1},
-{78,1418,1419,-1,-1},
-{23,30,1419,1420,-1},
-{1420,1421,-1,-1,-1},
-{1421,1422,-1,-1,-1},
-{1422,1423,-1,-1,-1},
-{1423,1424,-1,-1,-1},
-{171,197,1424,1425,-1},
-{118,1425,1426,-1,-1},
-{1426,1427,-1,-1,-1},
-{196,1427,1428,-1,-1},
-{1428,1429,-1,-1,-1},
-{36,1429,1430,-1,-1},
-{1430,1431,-1,-1,-1},
-{1431,1432,-1,-1,-1},
-{60,168,178,1432,1433},
-{115,1433,1434,-1,-1},
-{191,1434,1435,-1,-1},
-{25,1435,1436,-1,-1},
-{1436,1437,-1,-1,-1},
-{12,1437,1438,-1,-1},
-{1438,1439,-1,-1,-1},
-{163,1439,1440,-1,-1},
-{5,1440,1441,-1,-1},
-{1441,1442,-1,-1,-1},
-{1442,1443,-1,-1,-1},
-{1443,1444,-1,-1,-1},
-{140,1444,1445,-1,-1},
-{80,174,1445,1446,-1},
-{116,1446,1447,-1,-1},
-{59,70,1447,1448,-1},
-{30,1448,1449,-1,-1},
-{1449,1450,-1,-1,-1},
-{102,121,1450,1451,-1},
-{140,1451,1452,-1,-1},
-{1452,1453,-1,-1,-1},
-{71,1453,1454,-1,-1},
-{1454,1455,-1,-1,-1},
-{127,170,1455,1456,-1},
-{79,1456,1457,-1,-1},
-{1457,1458,-1,-1,-1},
-{36,1458,1459,-1,-1},
-{74,1459,1460,-1,-1},
-{26,1460,1461,-1,-1},
-{99,141,1461,1462,-1},
-{1462,1463,-1,-1,-1},
-{85,1463,1464,-1,-1},
-{74,110,165,1464,1465},
-{42,1465,1466,-1,-1},
-{113,1466,1467,-1,-1},
-{1467,1468,-1,-1,-1},
-{32,1468,1469,-1,-1},
-{22,47,1469,1470,-1},
-{1470,1471,-1,-1,-1},
-{87,1471,1472,-1,-1},
-{79,1472,1473,-1,-1},
-{24,31,1473,1474,-1},
-{1474,1475,-1,-1,-1},
-{1475,1476,-1,-1,-1},
-{1476,1477,-1,-1,-1},
-{1477,1478,-1,-1,-1},
-{172,198,1478,1479,-1},
-{119,1479,1480,-1,-1},
-{1480,1481,-1,-1,-1},
-{197,1481,1482,-1,-1},
-{1482,1483,-1,-1,-1},
-{37,1483,1484,-1,-1},
-{1484,1485,-1,-1,-1},
-{1485,1486,-1,-1,-1},
-{61,169,179,1486,1487},
-{116,1487,1488,-1,-1},
-{192,1488,1489,-1,-1},
-{26,1489,1490,-1,-1},
-{1490,1491,-1,-1,-1},
-{13,1491,1492,-1,-1},
-{1492,1493,-1,-1,-1},
-{164,1493,1494,-1,-1},
-{6,1494,1495,-1,-1},
-{1495,1496,-1,-1,-1},
-{1496,1497,-1,-1,-1},
-{1497,1498,-1,-1,-1},
-{141,1498,1499,-1,-1},
-{81,175,1499,1500,-1},
-{117,1500,1501,-1,-1},
-{71,1501,1502,-1,-1},
-{31,1502,1503,-1,-1},
-{1503,1504,-1,-1,-1},
-{103,122,1504,1505,-1},
-{141,1505,1506,-1,-1},
-{1506,1507,-1,-1,-1},
-{72,1507,1508,-1,-1},
-{1508,1509,-1,-1,-1},
-{128,171,1509,1510,-1},
-{1510,1511,-1,-1,-1},
-{1511,1512,-1,-1,-1},
-{37,1512,1513,-1,-1},
-{60,75,1513,1514,-1},
-{27,1514,1515,-1,-1},
-{142,1515,1516,-1,-1},
-{1516,1517,-1,-1,-1},
-{86,1517,1518,-1,-1},
-{75,111,166,1518,1519},
-{43,1519,1520,-1,-1},
-{114,1520,1521,-1,-1},
-{1521,1522,-1,-1,-1},
-{33,1522,1523,-1,-1},
-{23,48,1523,1524,-1},
-{1524,1525,-1,-1,-1},
-{88,1525,1526,-1,-1},
-{1526,1527,-1,-1,-1},
-{25,32,1527,1528,-1},
-{1528,1529,-1,-1,-1},
-{1529,1530,-1,-1,-1},
-{1530,1531,-1,-1,-1},
-{1531,1532,-1,-1,-1},
-{173,199,1532,1533,-1},
-{140,1533,1534,-1,-1},
-{1534,1535,-1,-1,-1},
-{198,1535,1536,-1,-1},
-{1536,1537,-1,-1,-1},
-{38,1537,1538,-1,-1},
-{1538,1539,-1,-1,-1},
-{1539,1540,-1,-1,-1},
-{62,170,1540,1541,-1},
-{117,1541,1542,-1,-1},
-{193,1542,1543,-1,-1},
-{27,1543,1544,-1,-1},
-{1544,1545,-1,-1,-1},
-{14,1545,1546,-1,-1},
-{1546,1547,-1,-1,-1},
-{165,1547,1548,-1,-1},
-{7,1548,1549,-1,-1},
-{1549,1550,-1,-1,-1},
-{1550,1551,-1,-1,-1},
-{1551,1552,-1,-1,-1},
-{142,1552,1553,-1,-1},
-{82,176,1553,1554,-1},
-{118,1554,1555,-1,-1},
-{72,1555,1556,-1,-1},
-{32,1556,1557,-1,-1},
-{180,1557,1558,-1,-1},
-{104,123,1558,1559,-1},
-{142,1559,1560,-1,-1},
-{1560,1561,-1,-1,-1},
-{73,1561,1562,-1,-1},
-{1562,1563,-1,-1,-1},
-{129,172,1563,1564,-1},
-{1564,1565,-1,-1,-1},
-{1565,1566,-1,-1,-1},
-{38,1566,1567,-1,-1},
-{61,76,1567,1568,-1},
-{28,1568,1569,-1,-1},
-{143,1569,1570,-1,-1},
-{1570,1571,-1,-1,-1},
-{87,1571,1572,-1,-1},
-{76,112,167,1572,1573},
-{44,1573,1574,-1,-1},
-{115,1574,1575,-1,-1},
-{1575,1576,-1,-1,-1},
-{34,1576,1577,-1,-1},
-{24,49,1577,1578,-1},
-{1578,1579,-1,-1,-1},
-{89,1579,1580,-1,-1},
-{1580,1581,-1,-1,-1},
-{26,33,1581,1582,-1},
-{1582,1583,-1,-1,-1},
-{1583,1584,-1,-1,-1},
-{1584,1585,-1,-1,-1},
-{1585,1586,-1,-1,-1},
-{174,1586,1587,-1,-1},
-{141,1587,1588,-1,-1},
-{1588,1589,-1,-1,-1},
-{199,1589,1590,-1,-1},
-{1590,1591,-1,-1,-1},
-{39,1591,1592,-1,-1},
-{1592,1593,-1,-1,-1},
-{1593,1594,-1,-1,-1},
-{63,171,1594,1595,-1},
-{118,1595,1596,-1,-1},
-{194,1596,1597,-1,-1},
-{28,1597,1598,-1,-1},
-{1598,1599,-1,-1,-1}};
-int mercury_normal_QCmatrixEnc_2_16[1400][4]={
-{15,-1,-1,-1},
-{200,-1,-1,-1},
-{166,201,-1,-1},
-{8,202,-1,-1},
-{203,-1,-1,-1},
-{204,-1,-1,-1},
-{205,-1,-1,-1},
-{143,206,-1,-1},
-{83,177,207,-1},
-{119,208,-1,-1},
-{73,209,-1,-1},
-{33,210,-1,-1},
-{181,211,-1,-1},
-{105,124,212,-1},
-{143,213,-1,-1},
-{214,-1,-1,-1},
-{74,215,-1,-1},
-{216,-1,-1,-1},
-{130,173,217,-1},
-{218,-1,-1,-1},
-{219,-1,-1,-1},
-{39,220,-1,-1},
-{62,77,221,-1},
-{29,222,-1,-1},
-{144,223,-1,-1},
-{224,-1,-1,-1},
-{88,225,-1,-1},
-{77,113,168,226},
-{45,227,-1,-1},
-{116,228,-1,-1},
-{229,-1,-1,-1},
-{35,230,-1,-1},
-{25,50,231,-1},
-{232,-1,-1,-1},
-{90,233,-1,-1},
-{234,-1,-1,-1},
-{27,34,235,-1},
-{236,-1,-1,-1},
-{237,-1,-1,-1},
-{238,-1,-1,-1},
-{239,-1,-1,-1},
-{175,240,-1,-1},
-{142,241,-1,-1},
-{242,-1,-1,-1},
-{243,-1,-1,-1},
-{244,-1,-1,-1},
-{245,-1,-1,-1},
-{60,246,-1,-1},
-{247,-1,-1,-1},
-{64,172,248,-1},
-{119,249,-1,-1},
-{195,250,-1,-1},
-{29,251,-1,-1},
-{252,-1,-1,-1},
-{16,253,-1,-1},
-{160,254,-1,-1},
-{167,255,-1,-1},
-{9,256,-1,-1},
-{257,-1,-1,-1},
-{258,-1,-1,-1},
-{259,-1,-1,-1},
-{144,260,-1,-1},
-{84,178,261,-1},
-{262,-1,-1,-1},
-{74,263,-1,-1},
-{34,264,-1,-1},
-{182,265,-1,-1},
-{106,125,266,-1},
-{144,267,-1,-1},
-{268,-1,-1,-1},
-{75,269,-1,-1},
-{270,-1,-1,-1},
-{131,174,271,-1},
-{272,-1,-1,-1},
-{273,-1,-1,-1},
-{274,-1,-1,-1},
-{63,78,275,-1},
-{30,276,-1,-1},
-{145,277,-1,-1},
-{278,-1,-1,-1},
-{89,279,-1,-1},
-{78,114,169,280},
-{46,281,-1,-1},
-{117,282,-1,-1},
-{283,-1,-1,-1},
-{36,284,-1,-1},
-{26,51,285,-1},
-{286,-1,-1,-1},
-{91,287,-1,-1},
-{288,-1,-1,-1},
-{28,35,289,-1},
-{290,-1,-1,-1},
-{291,-1,-1,-1},
-{292,-1,-1,-1},
-{293,-1,-1,-1},
-{176,294,-1,-1},
-{143,295,-1,-1},
-{296,-1,-1,-1},
-{297,-1,-1,-1},
-{298,-1,-1,-1},
-{299,-1,-1,-1},
-{61,300,-1,-1},
-{120,301,-1,-1},
-{65,173,302,-1},
-{303,-1,-1,-1},
-{196,304,-1,-1},
-{30,305,-1,-1},
-{306,-1,-1,-1},
-{17,307,-1,-1},
-{161,308,-1,-1},
-{168,309,-1,-1},
-{10,310,-1,-1},
-{311,-1,-1,-1},
-{312,-1,-1,-1},
-{313,-1,-1,-1},
-{145,314,-1,-1},
-{85,179,315,-1},
-{316,-1,-1,-1},
-{75,317,-1,-1},
-{35,318,-1,-1},
-{183,319,-1,-1},
-{107,126,320,-1},
-{145,321,-1,-1},
-{322,-1,-1,-1},
-{76,323,-1,-1},
-{324,-1,-1,-1},
-{132,175,325,-1},
-{326,-1,-1,-1},
-{327,-1,-1,-1},
-{328,-1,-1,-1},
-{64,79,329,-1},
-{31,330,-1,-1},
-{146,331,-1,-1},
-{332,-1,-1,-1},
-{90,333,-1,-1},
-{79,115,170,334},
-{47,335,-1,-1},
-{118,336,-1,-1},
-{337,-1,-1,-1},
-{37,338,-1,-1},
-{27,52,339,-1},
-{340,-1,-1,-1},
-{92,341,-1,-1},
-{342,-1,-1,-1},
-{29,36,343,-1},
-{344,-1,-1,-1},
-{345,-1,-1,-1},
-{346,-1,-1,-1},
-{347,-1,-1,-1},
-{177,348,-1,-1},
-{144,349,-1,-1},
-{350,-1,-1,-1},
-{351,-1,-1,-1},
-{352,-1,-1,-1},
-{353,-1,-1,-1},
-{62,354,-1,-1},
-{121,355,-1,-1},
-{66,174,356,-1},
-{357,-1,-1,-1},
-{197,358,-1,-1},
-{31,359,-1,-1},
-{360,-1,-1,-1},
-{18,361,-1,-1},
-{162,362,-1,-1},
-{169,363,-1,-1},
-{11,364,-1,-1},
-{365,-1,-1,-1},
-{366,-1,-1,-1},
-{367,-1,-1,-1},
-{146,368,-1,-1},
-{86,369,-1,-1},
-{370,-1,-1,-1},
-{76,371,-1,-1},
-{36,372,-1,-1},
-{184,373,-1,-1},
-{108,127,374,-1},
-{146,375,-1,-1},
-{376,-1,-1,-1},
-{77,377,-1,-1},
-{378,-1,-1,-1},
-{0,133,176,379},
-{380,-1,-1,-1},
-{381,-1,-1,-1},
-{382,-1,-1,-1},
-{65,383,-1,-1},
-{32,384,-1,-1},
-{147,385,-1,-1},
-{386,-1,-1,-1},
-{91,387,-1,-1},
-{116,171,388,-1},
-{48,389,-1,-1},
-{119,390,-1,-1},
-{391,-1,-1,-1},
-{38,392,-1,-1},
-{28,53,393,-1},
-{394,-1,-1,-1},
-{93,395,-1,-1},
-{396,-1,-1,-1},
-{30,37,397,-1},
-{398,-1,-1,-1},
-{399,-1,-1,-1},
-{400,-1,-1,-1},
-{401,-1,-1,-1},
-{178,402,-1,-1},
-{145,403,-1,-1},
-{404,-1,-1,-1},
-{405,-1,-1,-1},
-{406,-1,-1,-1},
-{407,-1,-1,-1},
-{63,408,-1,-1},
-{122,409,-1,-1},
-{67,175,410,-1},
-{411,-1,-1,-1},
-{198,412,-1,-1},
-{32,413,-1,-1},
-{414,-1,-1,-1},
-{19,415,-1,-1},
-{163,416,-1,-1},
-{170,417,-1,-1},
-{12,418,-1,-1},
-{419,-1,-1,-1},
-{420,-1,-1,-1},
-{40,421,-1,-1},
-{147,422,-1,-1},
-{87,423,-1,-1},
-{424,-1,-1,-1},
-{77,425,-1,-1},
-{37,426,-1,-1},
-{185,427,-1,-1},
-{109,128,428,-1},
-{147,429,-1,-1},
-{60,430,-1,-1},
-{78,431,-1,-1},
-{432,-1,-1,-1},
-{1,134,177,433},
-{434,-1,-1,-1},
-{80,435,-1,-1},
-{436,-1,-1,-1},
-{66,437,-1,-1},
-{33,438,-1,-1},
-{148,439,-1,-1},
-{440,-1,-1,-1},
-{92,441,-1,-1},
-{117,172,442,-1},
-{49,443,-1,-1},
-{444,-1,-1,-1},
-{445,-1,-1,-1},
-{39,60,446,-1},
-{29,54,447,-1},
-{448,-1,-1,-1},
-{94,449,-1,-1},
-{450,-1,-1,-1},
-{31,38,451,-1},
-{452,-1,-1,-1},
-{100,453,-1,-1},
-{454,-1,-1,-1},
-{455,-1,-1,-1},
-{179,456,-1,-1},
-{146,457,-1,-1},
-{458,-1,-1,-1},
-{459,-1,-1,-1},
-{160,460,-1,-1},
-{461,-1,-1,-1},
-{64,462,-1,-1},
-{123,463,-1,-1},
-{68,176,464,-1},
-{465,-1,-1,-1},
-{199,466,-1,-1},
-{33,467,-1,-1},
-{468,-1,-1,-1},
-{469,-1,-1,-1},
-{164,470,-1,-1},
-{171,471,-1,-1},
-{13,472,-1,-1},
-{473,-1,-1,-1},
-{474,-1,-1,-1},
-{41,475,-1,-1},
-{148,476,-1,-1},
-{88,477,-1,-1},
-{478,-1,-1,-1},
-{78,479,-1,-1},
-{38,480,-1,-1},
-{186,481,-1,-1},
-{110,129,482,-1},
-{148,483,-1,-1},
-{61,484,-1,-1},
-{79,485,-1,-1},
-{486,-1,-1,-1},
-{2,135,178,487},
-{488,-1,-1,-1},
-{81,489,-1,-1},
-{490,-1,-1,-1},
-{67,491,-1,-1},
-{34,492,-1,-1},
-{149,493,-1,-1},
-{494,-1,-1,-1},
-{93,495,-1,-1},
-{118,173,496,-1},
-{50,497,-1,-1},
-{498,-1,-1,-1},
-{499,-1,-1,-1},
-{61,500,-1,-1},
-{30,55,501,-1},
-{502,-1,-1,-1},
-{95,503,-1,-1},
-{504,-1,-1,-1},
-{32,39,505,-1},
-{180,506,-1,-1},
-{101,507,-1,-1},
-{508,-1,-1,-1},
-{509,-1,-1,-1},
-{510,-1,-1,-1},
-{147,511,-1,-1},
-{512,-1,-1,-1},
-{513,-1,-1,-1},
-{161,514,-1,-1},
-{515,-1,-1,-1},
-{65,516,-1,-1},
-{124,517,-1,-1},
-{69,177,518,-1},
-{519,-1,-1,-1},
-{520,-1,-1,-1},
-{34,521,-1,-1},
-{522,-1,-1,-1},
-{523,-1,-1,-1},
-{165,524,-1,-1},
-{172,525,-1,-1},
-{14,526,-1,-1},
-{527,-1,-1,-1},
-{528,-1,-1,-1},
-{42,529,-1,-1},
-{149,530,-1,-1},
-{89,531,-1,-1},
-{532,-1,-1,-1},
-{79,533,-1,-1},
-{39,534,-1,-1},
-{187,535,-1,-1},
-{111,130,536,-1},
-{149,537,-1,-1},
-{62,538,-1,-1},
-{539,-1,-1,-1},
-{540,-1,-1,-1},
-{3,136,179,541},
-{542,-1,-1,-1},
-{82,543,-1,-1},
-{544,-1,-1,-1},
-{68,545,-1,-1},
-{35,546,-1,-1},
-{150,547,-1,-1},
-{548,-1,-1,-1},
-{94,549,-1,-1},
-{119,174,550,-1},
-{51,551,-1,-1},
-{552,-1,-1,-1},
-{553,-1,-1,-1},
-{62,554,-1,-1},
-{31,56,555,-1},
-{556,-1,-1,-1},
-{96,557,-1,-1},
-{558,-1,-1,-1},
-{33,559,-1,-1},
-{181,560,-1,-1},
-{102,561,-1,-1},
-{562,-1,-1,-1},
-{180,563,-1,-1},
-{564,-1,-1,-1},
-{20,148,565,-1},
-{566,-1,-1,-1},
-{567,-1,-1,-1},
-{162,568,-1,-1},
-{569,-1,-1,-1},
-{66,570,-1,-1},
-{125,571,-1,-1},
-{70,178,572,-1},
-{573,-1,-1,-1},
-{574,-1,-1,-1},
-{35,575,-1,-1},
-{576,-1,-1,-1},
-{577,-1,-1,-1},
-{166,578,-1,-1},
-{173,579,-1,-1},
-{15,580,-1,-1},
-{581,-1,-1,-1},
-{100,582,-1,-1},
-{43,583,-1,-1},
-{150,584,-1,-1},
-{90,585,-1,-1},
-{586,-1,-1,-1},
-{587,-1,-1,-1},
-{588,-1,-1,-1},
-{188,589,-1,-1},
-{112,131,590,-1},
-{150,591,-1,-1},
-{63,592,-1,-1},
-{593,-1,-1,-1},
-{20,594,-1,-1},
-{4,137,595,-1},
-{596,-1,-1,-1},
-{83,597,-1,-1},
-{598,-1,-1,-1},
-{69,599,-1,-1},
-{36,600,-1,-1},
-{151,601,-1,-1},
-{602,-1,-1,-1},
-{95,603,-1,-1},
-{175,604,-1,-1},
-{52,605,-1,-1},
-{606,-1,-1,-1},
-{607,-1,-1,-1},
-{63,608,-1,-1},
-{32,57,609,-1},
-{610,-1,-1,-1},
-{97,611,-1,-1},
-{612,-1,-1,-1},
-{34,613,-1,-1},
-{182,614,-1,-1},
-{103,615,-1,-1},
-{616,-1,-1,-1},
-{181,617,-1,-1},
-{618,-1,-1,-1},
-{21,149,619,-1},
-{620,-1,-1,-1},
-{621,-1,-1,-1},
-{163,622,-1,-1},
-{100,623,-1,-1},
-{67,624,-1,-1},
-{126,625,-1,-1},
-{71,179,626,-1},
-{627,-1,-1,-1},
-{628,-1,-1,-1},
-{36,629,-1,-1},
-{630,-1,-1,-1},
-{631,-1,-1,-1},
-{167,632,-1,-1},
-{174,633,-1,-1},
-{16,634,-1,-1},
-{635,-1,-1,-1},
-{101,636,-1,-1},
-{44,637,-1,-1},
-{151,638,-1,-1},
-{91,639,-1,-1},
-{640,-1,-1,-1},
-{641,-1,-1,-1},
-{642,-1,-1,-1},
-{189,643,-1,-1},
-{113,132,644,-1},
-{151,645,-1,-1},
-{64,646,-1,-1},
-{647,-1,-1,-1},
-{21,648,-1,-1},
-{5,138,649,-1},
-{650,-1,-1,-1},
-{84,651,-1,-1},
-{652,-1,-1,-1},
-{70,653,-1,-1},
-{37,654,-1,-1},
-{152,655,-1,-1},
-{656,-1,-1,-1},
-{96,657,-1,-1},
-{176,658,-1,-1},
-{53,659,-1,-1},
-{660,-1,-1,-1},
-{661,-1,-1,-1},
-{64,662,-1,-1},
-{33,58,663,-1},
-{664,-1,-1,-1},
-{98,665,-1,-1},
-{666,-1,-1,-1},
-{35,667,-1,-1},
-{183,668,-1,-1},
-{104,669,-1,-1},
-{670,-1,-1,-1},
-{182,671,-1,-1},
-{672,-1,-1,-1},
-{22,150,673,-1},
-{674,-1,-1,-1},
-{675,-1,-1,-1},
-{164,676,-1,-1},
-{101,677,-1,-1},
-{68,678,-1,-1},
-{127,679,-1,-1},
-{72,680,-1,-1},
-{681,-1,-1,-1},
-{682,-1,-1,-1},
-{37,683,-1,-1},
-{684,-1,-1,-1},
-{685,-1,-1,-1},
-{168,686,-1,-1},
-{175,687,-1,-1},
-{17,688,-1,-1},
-{160,689,-1,-1},
-{102,690,-1,-1},
-{45,691,-1,-1},
-{152,692,-1,-1},
-{92,693,-1,-1},
-{694,-1,-1,-1},
-{695,-1,-1,-1},
-{696,-1,-1,-1},
-{190,697,-1,-1},
-{114,133,698,-1},
-{152,699,-1,-1},
-{65,700,-1,-1},
-{701,-1,-1,-1},
-{22,702,-1,-1},
-{6,60,139,703},
-{704,-1,-1,-1},
-{85,705,-1,-1},
-{706,-1,-1,-1},
-{71,707,-1,-1},
-{38,60,708,-1},
-{153,709,-1,-1},
-{710,-1,-1,-1},
-{97,711,-1,-1},
-{177,712,-1,-1},
-{54,713,-1,-1},
-{714,-1,-1,-1},
-{715,-1,-1,-1},
-{65,716,-1,-1},
-{34,59,717,-1},
-{718,-1,-1,-1},
-{99,719,-1,-1},
-{720,-1,-1,-1},
-{36,721,-1,-1},
-{184,722,-1,-1},
-{105,723,-1,-1},
-{724,-1,-1,-1},
-{183,725,-1,-1},
-{726,-1,-1,-1},
-{23,151,727,-1},
-{728,-1,-1,-1},
-{729,-1,-1,-1},
-{165,730,-1,-1},
-{102,731,-1,-1},
-{69,732,-1,-1},
-{128,733,-1,-1},
-{73,734,-1,-1},
-{735,-1,-1,-1},
-{736,-1,-1,-1},
-{38,737,-1,-1},
-{738,-1,-1,-1},
-{739,-1,-1,-1},
-{169,740,-1,-1},
-{176,741,-1,-1},
-{18,742,-1,-1},
-{161,743,-1,-1},
-{103,744,-1,-1},
-{46,745,-1,-1},
-{153,746,-1,-1},
-{93,747,-1,-1},
-{748,-1,-1,-1},
-{749,-1,-1,-1},
-{750,-1,-1,-1},
-{191,751,-1,-1},
-{115,134,752,-1},
-{153,753,-1,-1},
-{66,754,-1,-1},
-{755,-1,-1,-1},
-{23,756,-1,-1},
-{7,61,757,-1},
-{758,-1,-1,-1},
-{86,759,-1,-1},
-{760,-1,-1,-1},
-{72,761,-1,-1},
-{39,61,762,-1},
-{154,763,-1,-1},
-{100,764,-1,-1},
-{98,765,-1,-1},
-{178,766,-1,-1},
-{55,767,-1,-1},
-{768,-1,-1,-1},
-{769,-1,-1,-1},
-{66,770,-1,-1},
-{35,771,-1,-1},
-{772,-1,-1,-1},
-{773,-1,-1,-1},
-{774,-1,-1,-1},
-{37,775,-1,-1},
-{185,776,-1,-1},
-{106,777,-1,-1},
-{778,-1,-1,-1},
-{184,779,-1,-1},
-{780,-1,-1,-1},
-{24,152,781,-1},
-{782,-1,-1,-1},
-{783,-1,-1,-1},
-{166,784,-1,-1},
-{103,785,-1,-1},
-{70,786,-1,-1},
-{129,787,-1,-1},
-{74,788,-1,-1},
-{0,789,-1,-1},
-{790,-1,-1,-1},
-{39,791,-1,-1},
-{792,-1,-1,-1},
-{793,-1,-1,-1},
-{170,794,-1,-1},
-{177,795,-1,-1},
-{19,796,-1,-1},
-{162,797,-1,-1},
-{104,798,-1,-1},
-{47,799,-1,-1},
-{154,800,-1,-1},
-{94,801,-1,-1},
-{802,-1,-1,-1},
-{803,-1,-1,-1},
-{804,-1,-1,-1},
-{192,805,-1,-1},
-{116,135,806,-1},
-{154,807,-1,-1},
-{67,808,-1,-1},
-{809,-1,-1,-1},
-{24,810,-1,-1},
-{8,62,811,-1},
-{812,-1,-1,-1},
-{87,813,-1,-1},
-{814,-1,-1,-1},
-{73,815,-1,-1},
-{62,816,-1,-1},
-{155,817,-1,-1},
-{101,818,-1,-1},
-{99,819,-1,-1},
-{20,179,820,-1},
-{56,821,-1,-1},
-{822,-1,-1,-1},
-{823,-1,-1,-1},
-{67,824,-1,-1},
-{36,825,-1,-1},
-{826,-1,-1,-1},
-{827,-1,-1,-1},
-{828,-1,-1,-1},
-{38,829,-1,-1},
-{160,186,830,-1},
-{107,831,-1,-1},
-{832,-1,-1,-1},
-{185,833,-1,-1},
-{834,-1,-1,-1},
-{25,153,835,-1},
-{836,-1,-1,-1},
-{837,-1,-1,-1},
-{167,838,-1,-1},
-{104,839,-1,-1},
-{71,180,840,-1},
-{130,841,-1,-1},
-{75,842,-1,-1},
-{1,843,-1,-1},
-{844,-1,-1,-1},
-{845,-1,-1,-1},
-{846,-1,-1,-1},
-{847,-1,-1,-1},
-{171,848,-1,-1},
-{178,849,-1,-1},
-{850,-1,-1,-1},
-{163,851,-1,-1},
-{105,852,-1,-1},
-{48,853,-1,-1},
-{155,854,-1,-1},
-{95,855,-1,-1},
-{856,-1,-1,-1},
-{857,-1,-1,-1},
-{858,-1,-1,-1},
-{60,193,859,-1},
-{117,136,860,-1},
-{155,861,-1,-1},
-{68,862,-1,-1},
-{863,-1,-1,-1},
-{25,864,-1,-1},
-{9,63,865,-1},
-{866,-1,-1,-1},
-{88,867,-1,-1},
-{868,-1,-1,-1},
-{74,869,-1,-1},
-{63,870,-1,-1},
-{156,871,-1,-1},
-{102,872,-1,-1},
-{873,-1,-1,-1},
-{21,874,-1,-1},
-{57,875,-1,-1},
-{876,-1,-1,-1},
-{877,-1,-1,-1},
-{68,878,-1,-1},
-{20,37,879,-1},
-{880,-1,-1,-1},
-{881,-1,-1,-1},
-{882,-1,-1,-1},
-{39,883,-1,-1},
-{161,187,884,-1},
-{108,885,-1,-1},
-{886,-1,-1,-1},
-{186,887,-1,-1},
-{888,-1,-1,-1},
-{26,154,889,-1},
-{890,-1,-1,-1},
-{891,-1,-1,-1},
-{168,892,-1,-1},
-{105,893,-1,-1},
-{72,181,894,-1},
-{131,895,-1,-1},
-{76,896,-1,-1},
-{2,897,-1,-1},
-{898,-1,-1,-1},
-{899,-1,-1,-1},
-{900,-1,-1,-1},
-{901,-1,-1,-1},
-{172,902,-1,-1},
-{179,903,-1,-1},
-{904,-1,-1,-1},
-{164,905,-1,-1},
-{106,906,-1,-1},
-{49,60,907,-1},
-{20,156,908,-1},
-{96,909,-1,-1},
-{910,-1,-1,-1},
-{911,-1,-1,-1},
-{912,-1,-1,-1},
-{61,194,913,-1},
-{118,137,914,-1},
-{156,160,915,-1},
-{69,916,-1,-1},
-{917,-1,-1,-1},
-{26,918,-1,-1},
-{10,64,919,-1},
-{920,-1,-1,-1},
-{89,921,-1,-1},
-{922,-1,-1,-1},
-{75,923,-1,-1},
-{64,100,924,-1},
-{157,925,-1,-1},
-{103,926,-1,-1},
-{927,-1,-1,-1},
-{22,928,-1,-1},
-{58,929,-1,-1},
-{930,-1,-1,-1},
-{931,-1,-1,-1},
-{69,932,-1,-1},
-{21,38,933,-1},
-{934,-1,-1,-1},
-{935,-1,-1,-1},
-{936,-1,-1,-1},
-{937,-1,-1,-1},
-{162,188,938,-1},
-{109,939,-1,-1},
-{940,-1,-1,-1},
-{187,941,-1,-1},
-{942,-1,-1,-1},
-{27,155,943,-1},
-{944,-1,-1,-1},
-{945,-1,-1,-1},
-{169,946,-1,-1},
-{106,947,-1,-1},
-{73,182,948,-1},
-{132,949,-1,-1},
-{77,950,-1,-1},
-{3,951,-1,-1},
-{952,-1,-1,-1},
-{953,-1,-1,-1},
-{954,-1,-1,-1},
-{955,-1,-1,-1},
-{173,956,-1,-1},
-{957,-1,-1,-1},
-{958,-1,-1,-1},
-{165,959,-1,-1},
-{107,960,-1,-1},
-{50,61,961,-1},
-{21,157,962,-1},
-{97,963,-1,-1},
-{964,-1,-1,-1},
-{965,-1,-1,-1},
-{966,-1,-1,-1},
-{62,195,967,-1},
-{119,138,968,-1},
-{157,161,969,-1},
-{70,970,-1,-1},
-{971,-1,-1,-1},
-{27,972,-1,-1},
-{11,65,973,-1},
-{974,-1,-1,-1},
-{90,975,-1,-1},
-{976,-1,-1,-1},
-{76,977,-1,-1},
-{65,101,978,-1},
-{158,979,-1,-1},
-{104,980,-1,-1},
-{981,-1,-1,-1},
-{23,982,-1,-1},
-{59,983,-1,-1},
-{984,-1,-1,-1},
-{985,-1,-1,-1},
-{70,986,-1,-1},
-{22,39,987,-1},
-{988,-1,-1,-1},
-{989,-1,-1,-1},
-{990,-1,-1,-1},
-{991,-1,-1,-1},
-{163,189,992,-1},
-{110,993,-1,-1},
-{994,-1,-1,-1},
-{188,995,-1,-1},
-{996,-1,-1,-1},
-{28,156,997,-1},
-{998,-1,-1,-1},
-{999,-1,-1,-1},
-{160,170,1000,-1},
-{107,1001,-1,-1},
-{74,183,1002,-1},
-{133,1003,-1,-1},
-{78,1004,-1,-1},
-{4,1005,-1,-1},
-{1006,-1,-1,-1},
-{1007,-1,-1,-1},
-{1008,-1,-1,-1},
-{1009,-1,-1,-1},
-{174,1010,-1,-1},
-{1011,-1,-1,-1},
-{1012,-1,-1,-1},
-{166,1013,-1,-1},
-{108,1014,-1,-1},
-{51,62,1015,-1},
-{22,158,1016,-1},
-{98,1017,-1,-1},
-{1018,-1,-1,-1},
-{1019,-1,-1,-1},
-{1020,-1,-1,-1},
-{63,196,1021,-1},
-{139,1022,-1,-1},
-{158,162,1023,-1},
-{71,1024,-1,-1},
-{1025,-1,-1,-1},
-{28,1026,-1,-1},
-{12,66,1027,-1},
-{1028,-1,-1,-1},
-{91,1029,-1,-1},
-{1030,-1,-1,-1},
-{77,1031,-1,-1},
-{66,102,1032,-1},
-{159,1033,-1,-1},
-{105,1034,-1,-1},
-{1035,-1,-1,-1},
-{24,1036,-1,-1},
-{1037,-1,-1,-1},
-{1038,-1,-1,-1},
-{1039,-1,-1,-1},
-{71,1040,-1,-1},
-{23,1041,-1,-1},
-{1042,-1,-1,-1},
-{1043,-1,-1,-1},
-{1044,-1,-1,-1},
-{1045,-1,-1,-1},
-{164,190,1046,-1},
-{111,1047,-1,-1},
-{1048,-1,-1,-1},
-{189,1049,-1,-1},
-{1050,-1,-1,-1},
-{29,157,1051,-1},
-{1052,-1,-1,-1},
-{1053,-1,-1,-1},
-{161,171,1054,-1},
-{108,1055,-1,-1},
-{75,184,1056,-1},
-{134,1057,-1,-1},
-{79,1058,-1,-1},
-{5,1059,-1,-1},
-{1060,-1,-1,-1},
-{1061,-1,-1,-1},
-{1062,-1,-1,-1},
-{1063,-1,-1,-1},
-{175,1064,-1,-1},
-{1065,-1,-1,-1},
-{1066,-1,-1,-1},
-{167,1067,-1,-1},
-{109,1068,-1,-1},
-{52,63,1069,-1},
-{23,159,1070,-1},
-{99,1071,-1,-1},
-{1072,-1,-1,-1},
-{1073,-1,-1,-1},
-{1074,-1,-1,-1},
-{64,197,1075,-1},
-{1076,-1,-1,-1},
-{120,159,163,1077},
-{72,1078,-1,-1},
-{1079,-1,-1,-1},
-{29,1080,-1,-1},
-{13,67,1081,-1},
-{1082,-1,-1,-1},
-{92,1083,-1,-1},
-{1084,-1,-1,-1},
-{78,1085,-1,-1},
-{67,103,1086,-1},
-{1087,-1,-1,-1},
-{106,1088,-1,-1},
-{1089,-1,-1,-1},
-{25,1090,-1,-1},
-{40,1091,-1,-1},
-{1092,-1,-1,-1},
-{80,1093,-1,-1},
-{72,1094,-1,-1},
-{24,1095,-1,-1},
-{1096,-1,-1,-1},
-{1097,-1,-1,-1},
-{1098,-1,-1,-1},
-{1099,-1,-1,-1},
-{165,191,1100,-1},
-{112,1101,-1,-1},
-{1102,-1,-1,-1},
-{190,1103,-1,-1},
-{1104,-1,-1,-1},
-{30,158,1105,-1},
-{1106,-1,-1,-1},
-{1107,-1,-1,-1},
-{162,172,1108,-1},
-{109,1109,-1,-1},
-{76,185,1110,-1},
-{135,1111,-1,-1},
-{1112,-1,-1,-1},
-{6,1113,-1,-1},
-{1114,-1,-1,-1},
-{1115,-1,-1,-1},
-{1116,-1,-1,-1},
-{1117,-1,-1,-1},
-{176,1118,-1,-1},
-{1119,-1,-1,-1},
-{1120,-1,-1,-1},
-{168,1121,-1,-1},
-{110,1122,-1,-1},
-{53,64,1123,-1},
-{24,1124,-1,-1},
-{1125,-1,-1,-1},
-{1126,-1,-1,-1},
-{1127,-1,-1,-1},
-{1128,-1,-1,-1},
-{65,198,1129,-1},
-{1130,-1,-1,-1},
-{121,164,1131,-1},
-{73,1132,-1,-1},
-{1133,-1,-1,-1},
-{30,1134,-1,-1},
-{14,68,1135,-1},
-{20,1136,-1,-1},
-{93,1137,-1,-1},
-{1138,-1,-1,-1},
-{79,1139,-1,-1},
-{68,104,1140,-1},
-{1141,-1,-1,-1},
-{107,1142,-1,-1},
-{1143,-1,-1,-1},
-{26,1144,-1,-1},
-{41,1145,-1,-1},
-{1146,-1,-1,-1},
-{81,1147,-1,-1},
-{73,1148,-1,-1},
-{25,1149,-1,-1},
-{1150,-1,-1,-1},
-{1151,-1,-1,-1},
-{1152,-1,-1,-1},
-{1153,-1,-1,-1},
-{166,192,1154,-1},
-{113,1155,-1,-1},
-{1156,-1,-1,-1},
-{191,1157,-1,-1},
-{1158,-1,-1,-1},
-{31,159,1159,-1},
-{1160,-1,-1,-1},
-{1161,-1,-1,-1},
-{163,173,1162,-1},
-{110,1163,-1,-1},
-{77,186,1164,-1},
-{20,136,1165,-1},
-{1166,-1,-1,-1},
-{7,1167,-1,-1},
-{1168,-1,-1,-1},
-{1169,-1,-1,-1},
-{0,1170,-1,-1},
-{1171,-1,-1,-1},
-{177,1172,-1,-1},
-{1173,-1,-1,-1},
-{1174,-1,-1,-1},
-{169,1175,-1,-1},
-{111,1176,-1,-1},
-{54,65,1177,-1},
-{25,1178,-1,-1},
-{1179,-1,-1,-1},
-{1180,-1,-1,-1},
-{1181,-1,-1,-1},
-{1182,-1,-1,-1},
-{66,199,1183,-1},
-{1184,-1,-1,-1},
-{122,165,1185,-1},
-{74,1186,-1,-1},
-{1187,-1,-1,-1},
-{31,1188,-1,-1},
-{15,69,1189,-1},
-{21,1190,-1,-1},
-{94,1191,-1,-1},
-{1192,-1,-1,-1},
-{80,1193,-1,-1},
-{69,105,160,1194},
-{1195,-1,-1,-1},
-{108,1196,-1,-1},
-{1197,-1,-1,-1},
-{27,1198,-1,-1},
-{42,1199,-1,-1},
-{1200,-1,-1,-1},
-{82,1201,-1,-1},
-{74,1202,-1,-1},
-{26,1203,-1,-1},
-{1204,-1,-1,-1},
-{1205,-1,-1,-1},
-{1206,-1,-1,-1},
-{1207,-1,-1,-1},
-{167,193,1208,-1},
-{114,1209,-1,-1},
-{1210,-1,-1,-1},
-{192,1211,-1,-1},
-{1212,-1,-1,-1},
-{32,1213,-1,-1},
-{1214,-1,-1,-1},
-{1215,-1,-1,-1},
-{164,174,1216,-1},
-{111,1217,-1,-1},
-{78,187,1218,-1},
-{21,137,1219,-1},
-{1220,-1,-1,-1},
-{8,1221,-1,-1},
-{1222,-1,-1,-1},
-{1223,-1,-1,-1},
-{1,1224,-1,-1},
-{1225,-1,-1,-1},
-{178,1226,-1,-1},
-{1227,-1,-1,-1},
-{1228,-1,-1,-1},
-{170,1229,-1,-1},
-{112,1230,-1,-1},
-{55,66,1231,-1},
-{26,1232,-1,-1},
-{1233,-1,-1,-1},
-{1234,-1,-1,-1},
-{1235,-1,-1,-1},
-{1236,-1,-1,-1},
-{67,1237,-1,-1},
-{1238,-1,-1,-1},
-{123,166,1239,-1},
-{75,1240,-1,-1},
-{1241,-1,-1,-1},
-{32,1242,-1,-1},
-{16,70,1243,-1},
-{22,1244,-1,-1},
-{95,1245,-1,-1},
-{1246,-1,-1,-1},
-{81,1247,-1,-1},
-{70,106,161,1248},
-{1249,-1,-1,-1},
-{109,1250,-1,-1},
-{1251,-1,-1,-1},
-{28,1252,-1,-1},
-{43,1253,-1,-1},
-{1254,-1,-1,-1},
-{83,1255,-1,-1},
-{75,1256,-1,-1},
-{20,27,1257,-1},
-{1258,-1,-1,-1},
-{1259,-1,-1,-1},
-{1260,-1,-1,-1},
-{1261,-1,-1,-1},
-{168,194,1262,-1},
-{115,1263,-1,-1},
-{1264,-1,-1,-1},
-{193,1265,-1,-1},
-{1266,-1,-1,-1},
-{33,1267,-1,-1},
-{1268,-1,-1,-1},
-{1269,-1,-1,-1},
-{165,175,1270,-1},
-{112,1271,-1,-1},
-{79,188,1272,-1},
-{22,138,1273,-1},
-{1274,-1,-1,-1},
-{9,1275,-1,-1},
-{1276,-1,-1,-1},
-{160,1277,-1,-1},
-{2,1278,-1,-1},
-{1279,-1,-1,-1},
-{179,1280,-1,-1},
-{1281,-1,-1,-1},
-{1282,-1,-1,-1},
-{171,1283,-1,-1},
-{113,1284,-1,-1},
-{56,67,1285,-1},
-{27,1286,-1,-1},
-{1287,-1,-1,-1},
-{1288,-1,-1,-1},
-{1289,-1,-1,-1},
-{1290,-1,-1,-1},
-{68,1291,-1,-1},
-{1292,-1,-1,-1},
-{124,167,1293,-1},
-{76,1294,-1,-1},
-{1295,-1,-1,-1},
-{33,1296,-1,-1},
-{17,71,1297,-1},
-{23,1298,-1,-1},
-{96,1299,-1,-1},
-{1300,-1,-1,-1},
-{82,1301,-1,-1},
-{71,107,162,1302},
-{1303,-1,-1,-1},
-{110,1304,-1,-1},
-{1305,-1,-1,-1},
-{29,1306,-1,-1},
-{44,1307,-1,-1},
-{1308,-1,-1,-1},
-{84,1309,-1,-1},
-{76,1310,-1,-1},
-{21,28,1311,-1},
-{1312,-1,-1,-1},
-{1313,-1,-1,-1},
-{1314,-1,-1,-1},
-{1315,-1,-1,-1},
-{169,195,1316,-1},
-{116,1317,-1,-1},
-{1318,-1,-1,-1},
-{194,1319,-1,-1},
-{1320,-1,-1,-1},
-{34,1321,-1,-1},
-{1322,-1,-1,-1},
-{1323,-1,-1,-1},
-{166,176,1324,-1},
-{113,1325,-1,-1},
-{189,1326,-1,-1},
-{23,139,1327,-1},
-{1328,-1,-1,-1},
-{10,1329,-1,-1},
-{1330,-1,-1,-1},
-{161,1331,-1,-1},
-{3,1332,-1,-1},
-{1333,-1,-1,-1},
-{1334,-1,-1,-1},
-{1335,-1,-1,-1},
-{1336,-1,-1,-1},
-{172,1337,-1,-1},
-{114,1338,-1,-1},
-{57,68,1339,-1},
-{28,1340,-1,-1},
-{1341,-1,-1,-1},
-{100,1342,-1,-1},
-{1343,-1,-1,-1},
-{1344,-1,-1,-1},
-{69,1345,-1,-1},
-{1346,-1,-1,-1},
-{125,168,1347,-1},
-{77,1348,-1,-1},
-{1349,-1,-1,-1},
-{34,1350,-1,-1},
-{18,72,1351,-1},
-{24,1352,-1,-1},
-{97,1353,-1,-1},
-{1354,-1,-1,-1},
-{83,1355,-1,-1},
-{72,108,163,1356},
-{40,1357,-1,-1},
-{111,1358,-1,-1},
-{1359,-1,-1,-1},
-{30,1360,-1,-1},
-{20,45,1361,-1},
-{1362,-1,-1,-1},
-{85,1363,-1,-1},
-{77,1364,-1,-1},
-{22,29,1365,-1},
-{1366,-1,-1,-1},
-{1367,-1,-1,-1},
-{1368,-1,-1,-1},
-{1369,-1,-1,-1},
-{170,196,1370,-1},
-{117,1371,-1,-1},
-{1372,-1,-1,-1},
-{195,1373,-1,-1},
-{1374,-1,-1,-1},
-{35,1375,-1,-1},
-{1376,-1,-1,-1},
-{1377,-1,-1,-1},
-{167,177,1378,-1},
-{114,1379,-1,-1},
-{190,1380,-1,-1},
-{24,1381,-1,-1},
-{1382,-1,-1,-1},
-{11,1383,-1,-1},
-{1384,-1,-1,-1},
-{162,1385,-1,-1},
-{4,1386,-1,-1},
-{1387,-1,-1,-1},
-{1388,-1,-1,-1},
-{1389,-1,-1,-1},
-{1390,-1,-1,-1},
-{173,1391,-1,-1},
-{115,1392,-1,-1},
-{58,69,1393,-1},
-{29,1394,-1,-1},
-{1395,-1,-1,-1},
-{101,120,1396,-1},
-{1397,-1,-1,-1},
-{1398,-1,-1,-1},
-{70,1399,-1,-1},
-{1400,-1,-1,-1},
-{126,169,1401,-1},
-{78,1402,-1,-1},
-{1403,-1,-1,-1},
-{35,1404,-1,-1},
-{19,73,1405,-1},
-{25,1406,-1,-1},
-{98,140,1407,-1},
-{1408,-1,-1,-1},
-{84,1409,-1,-1},
-{73,109,164,1410},
-{41,1411,-1,-1},
-{112,1412,-1,-1},
-{1413,-1,-1,-1},
-{31,1414,-1,-1},
-{21,46,1415,-1},
-{1416,-1,-1,-1},
-{86,1417,-1,-1},
-{78,1418,-1,-1},
-{23,30,1419,-1},
-{1420,-1,-1,-1},
-{1421,-1,-1,-1},
-{1422,-1,-1,-1},
-{1423,-1,-1,-1},
-{171,197,1424,-1},
-{118,1425,-1,-1},
-{1426,-1,-1,-1},
-{196,1427,-1,-1},
-{1428,-1,-1,-1},
-{36,1429,-1,-1},
-{1430,-1,-1,-1},
-{1431,-1,-1,-1},
-{60,168,178,1432},
-{115,1433,-1,-1},
-{191,1434,-1,-1},
-{25,1435,-1,-1},
-{1436,-1,-1,-1},
-{12,1437,-1,-1},
-{1438,-1,-1,-1},
-{163,1439,-1,-1},
-{5,1440,-1,-1},
-{1441,-1,-1,-1},
-{1442,-1,-1,-1},
-{1443,-1,-1,-1},
-{140,1444,-1,-1},
-{80,174,1445,-1},
-{116,1446,-1,-1},
-{59,70,1447,-1},
-{30,1448,-1,-1},
-{1449,-1,-1,-1},
-{102,121,1450,-1},
-{140,1451,-1,-1},
-{1452,-1,-1,-1},
-{71,1453,-1,-1},
-{1454,-1,-1,-1},
-{127,170,1455,-1},
-{79,1456,-1,-1},
-{1457,-1,-1,-1},
-{36,1458,-1,-1},
-{74,1459,-1,-1},
-{26,1460,-1,-1},
-{99,141,1461,-1},
-{1462,-1,-1,-1},
-{85,1463,-1,-1},
-{74,110,165,1464},
-{42,1465,-1,-1},
-{113,1466,-1,-1},
-{1467,-1,-1,-1},
-{32,1468,-1,-1},
-{22,47,1469,-1},
-{1470,-1,-1,-1},
-{87,1471,-1,-1},
-{79,1472,-1,-1},
-{24,31,1473,-1},
-{1474,-1,-1,-1},
-{1475,-1,-1,-1},
-{1476,-1,-1,-1},
-{1477,-1,-1,-1},
-{172,198,1478,-1},
-{119,1479,-1,-1},
-{1480,-1,-1,-1},
-{197,1481,-1,-1},
-{1482,-1,-1,-1},
-{37,1483,-1,-1},
-{1484,-1,-1,-1},
-{1485,-1,-1,-1},
-{61,169,179,1486},
-{116,1487,-1,-1},
-{192,1488,-1,-1},
-{26,1489,-1,-1},
-{1490,-1,-1,-1},
-{13,1491,-1,-1},
-{1492,-1,-1,-1},
-{164,1493,-1,-1},
-{6,1494,-1,-1},
-{1495,-1,-1,-1},
-{1496,-1,-1,-1},
-{1497,-1,-1,-1},
-{141,1498,-1,-1},
-{81,175,1499,-1},
-{117,1500,-1,-1},
-{71,1501,-1,-1},
-{31,1502,-1,-1},
-{1503,-1,-1,-1},
-{103,122,1504,-1},
-{141,1505,-1,-1},
-{1506,-1,-1,-1},
-{72,1507,-1,-1},
-{1508,-1,-1,-1},
-{128,171,1509,-1},
-{1510,-1,-1,-1},
-{1511,-1,-1,-1},
-{37,1512,-1,-1},
-{60,75,1513,-1},
-{27,1514,-1,-1},
-{142,1515,-1,-1},
-{1516,-1,-1,-1},
-{86,1517,-1,-1},
-{75,111,166,1518},
-{43,1519,-1,-1},
-{114,1520,-1,-1},
-{1521,-1,-1,-1},
-{33,1522,-1,-1},
-{23,48,1523,-1},
-{1524,-1,-1,-1},
-{88,1525,-1,-1},
-{1526,-1,-1,-1},
-{25,32,1527,-1},
-{1528,-1,-1,-1},
-{1529,-1,-1,-1},
-{1530,-1,-1,-1},
-{1531,-1,-1,-1},
-{173,199,1532,-1},
-{140,1533,-1,-1},
-{1534,-1,-1,-1},
-{198,1535,-1,-1},
-{1536,-1,-1,-1},
-{38,1537,-1,-1},
-{1538,-1,-1,-1},
-{1539,-1,-1,-1},
-{62,170,1540,-1},
-{117,1541,-1,-1},
-{193,1542,-1,-1},
-{27,1543,-1,-1},
-{1544,-1,-1,-1},
-{14,1545,-1,-1},
-{1546,-1,-1,-1},
-{165,1547,-1,-1},
-{7,1548,-1,-1},
-{1549,-1,-1,-1},
-{1550,-1,-1,-1},
-{1551,-1,-1,-1},
-{142,1552,-1,-1},
-{82,176,1553,-1},
-{118,1554,-1,-1},
-{72,1555,-1,-1},
-{32,1556,-1,-1},
-{180,1557,-1,-1},
-{104,123,1558,-1},
-{142,1559,-1,-1},
-{1560,-1,-1,-1},
-{73,1561,-1,-1},
-{1562,-1,-1,-1},
-{129,172,1563,-1},
-{1564,-1,-1,-1},
-{1565,-1,-1,-1},
-{38,1566,-1,-1},
-{61,76,1567,-1},
-{28,1568,-1,-1},
-{143,1569,-1,-1},
-{1570,-1,-1,-1},
-{87,1571,-1,-1},
-{76,112,167,1572},
-{44,1573,-1,-1},
-{115,1574,-1,-1},
-{1575,-1,-1,-1},
-{34,1576,-1,-1},
-{24,49,1577,-1},
-{1578,-1,-1,-1},
-{89,1579,-1,-1},
-{1580,-1,-1,-1},
-{26,33,1581,-1},
-{1582,-1,-1,-1},
-{1583,-1,-1,-1},
-{1584,-1,-1,-1},
-{1585,-1,-1,-1},
-{174,1586,-1,-1},
-{141,1587,-1,-1},
-{1588,-1,-1,-1},
-{199,1589,-1,-1},
-{1590,-1,-1,-1},
-{39,1591,-1,-1},
-{1592,-1,-1,-1},
-{1593,-1,-1,-1},
-{63,171,1594,-1},
-{118,1595,-1,-1},
-{194,1596,-1,-1},
-{28,1597,-1,-1},
-{1598,-1,-1,-1}};
-int mercury_normal_QCmatrixV_2_16[1600][9]={
-{180,590,971,-1,-1,-1,-1,-1,-1},
-{234,644,1025,-1,-1,-1,-1,-1,-1},
-{288,698,1079,-1,-1,-1,-1,-1,-1},
-{342,752,1133,-1,-1,-1,-1,-1,-1},
-{396,806,1187,-1,-1,-1,-1,-1,-1},
-{450,860,1241,-1,-1,-1,-1,-1,-1},
-{504,914,1295,-1,-1,-1,-1,-1,-1},
-{558,968,1349,-1,-1,-1,-1,-1,-1},
-{612,1022,3,-1,-1,-1,-1,-1,-1},
-{666,1076,57,-1,-1,-1,-1,-1,-1},
-{720,1130,111,-1,-1,-1,-1,-1,-1},
-{774,1184,165,-1,-1,-1,-1,-1,-1},
-{828,1238,219,-1,-1,-1,-1,-1,-1},
-{882,1292,273,-1,-1,-1,-1,-1,-1},
-{936,1346,327,-1,-1,-1,-1,-1,-1},
-{990,0,381,-1,-1,-1,-1,-1,-1},
-{1044,54,435,-1,-1,-1,-1,-1,-1},
-{1098,108,489,-1,-1,-1,-1,-1,-1},
-{1152,162,543,-1,-1,-1,-1,-1,-1},
-{1206,216,597,-1,-1,-1,-1,-1,-1},
-{366,395,621,680,709,937,966,1058,1162},
-{420,449,675,734,763,991,1020,1112,1216},
-{474,503,729,788,817,1045,1074,1166,1270},
-{528,557,783,842,871,1099,1128,1220,1324},
-{582,611,837,896,925,1153,1182,1274,1378},
-{636,665,891,950,979,1207,1236,1328,32},
-{690,719,945,1004,1033,1261,1290,1382,86},
-{744,773,999,1058,1087,1315,1344,36,140},
-{798,827,1053,1112,1141,1369,1398,90,194},
-{852,881,1107,1166,1195,23,52,144,248},
-{906,935,1161,1220,1249,77,106,198,302},
-{960,989,1215,1274,1303,131,160,252,356},
-{1014,1043,1269,1328,1357,185,214,306,410},
-{1068,1097,1323,1382,11,239,268,360,464},
-{1122,1151,1377,36,65,293,322,414,518},
-{1176,1205,31,90,119,347,376,468,572},
-{1230,1259,85,144,173,401,430,522,626},
-{1284,1313,139,198,227,455,484,576,680},
-{1338,1367,193,252,281,509,538,630,734},
-{1392,21,247,306,335,563,592,684,788},
-{222,892,1158,-1,-1,-1,-1,-1,-1},
-{276,946,1212,-1,-1,-1,-1,-1,-1},
-{330,1000,1266,-1,-1,-1,-1,-1,-1},
-{384,1054,1320,-1,-1,-1,-1,-1,-1},
-{438,1108,1374,-1,-1,-1,-1,-1,-1},
-{492,1162,28,-1,-1,-1,-1,-1,-1},
-{546,1216,82,-1,-1,-1,-1,-1,-1},
-{600,1270,136,-1,-1,-1,-1,-1,-1},
-{654,1324,190,-1,-1,-1,-1,-1,-1},
-{708,1378,244,-1,-1,-1,-1,-1,-1},
-{762,32,298,-1,-1,-1,-1,-1,-1},
-{816,86,352,-1,-1,-1,-1,-1,-1},
-{870,140,406,-1,-1,-1,-1,-1,-1},
-{924,194,460,-1,-1,-1,-1,-1,-1},
-{978,248,514,-1,-1,-1,-1,-1,-1},
-{1032,302,568,-1,-1,-1,-1,-1,-1},
-{1086,356,622,-1,-1,-1,-1,-1,-1},
-{1140,410,676,-1,-1,-1,-1,-1,-1},
-{1194,464,730,-1,-1,-1,-1,-1,-1},
-{1248,518,784,-1,-1,-1,-1,-1,-1},
-{47,231,247,504,509,660,708,1233,1314},
-{101,285,301,558,563,714,762,1287,1368},
-{155,339,355,612,617,768,816,1341,22},
-{209,393,409,666,671,822,870,1395,76},
-{263,447,463,720,725,876,924,49,130},
-{317,501,517,774,779,930,978,103,184},
-{371,555,571,828,833,984,1032,157,238},
-{425,609,625,882,887,1038,1086,211,292},
-{479,663,679,936,941,1092,1140,265,346},
-{533,717,733,990,995,1146,1194,319,400},
-{587,771,787,1044,1049,1200,1248,373,454},
-{641,825,841,1098,1103,1254,1302,427,508},
-{695,879,895,1152,1157,1308,1356,481,562},
-{749,933,949,1206,1211,1362,10,535,616},
-{803,987,1003,1260,1265,16,64,589,670},
-{857,1041,1057,1314,1319,70,118,643,724},
-{911,1095,1111,1368,1373,124,172,697,778},
-{965,1149,1165,22,27,178,226,751,832},
-{1019,1203,1219,76,81,232,280,805,886},
-{1073,1257,1273,130,135,286,334,859,940},
-{236,894,994,1246,-1,-1,-1,-1,-1},
-{290,948,1048,1300,-1,-1,-1,-1,-1},
-{344,1002,1102,1354,-1,-1,-1,-1,-1},
-{398,1056,1156,8,-1,-1,-1,-1,-1},
-{452,1110,1210,62,-1,-1,-1,-1,-1},
-{506,1164,1264,116,-1,-1,-1,-1,-1},
-{560,1218,1318,170,-1,-1,-1,-1,-1},
-{614,1272,1372,224,-1,-1,-1,-1,-1},
-{668,1326,26,278,-1,-1,-1,-1,-1},
-{722,1380,80,332,-1,-1,-1,-1,-1},
-{776,34,134,386,-1,-1,-1,-1,-1},
-{830,88,188,440,-1,-1,-1,-1,-1},
-{884,142,242,494,-1,-1,-1,-1,-1},
-{938,196,296,548,-1,-1,-1,-1,-1},
-{992,250,350,602,-1,-1,-1,-1,-1},
-{1046,304,404,656,-1,-1,-1,-1,-1},
-{1100,358,458,710,-1,-1,-1,-1,-1},
-{1154,412,512,764,-1,-1,-1,-1,-1},
-{1208,466,566,818,-1,-1,-1,-1,-1},
-{1262,520,620,872,-1,-1,-1,-1,-1},
-{254,383,424,565,725,1143,-1,-1,-1},
-{308,437,478,619,779,1197,-1,-1,-1},
-{362,491,532,673,833,1251,-1,-1,-1},
-{416,545,586,727,887,1305,-1,-1,-1},
-{470,599,640,781,941,1359,-1,-1,-1},
-{524,653,694,835,995,13,-1,-1,-1},
-{578,707,748,889,1049,67,-1,-1,-1},
-{632,761,802,943,1103,121,-1,-1,-1},
-{686,815,856,997,1157,175,-1,-1,-1},
-{740,869,910,1051,1211,229,-1,-1,-1},
-{794,923,964,1105,1265,283,-1,-1,-1},
-{848,977,1018,1159,1319,337,-1,-1,-1},
-{902,1031,1072,1213,1373,391,-1,-1,-1},
-{956,1085,1126,1267,27,445,-1,-1,-1},
-{1010,1139,1180,1321,81,499,-1,-1,-1},
-{1064,1193,1234,1375,135,553,-1,-1,-1},
-{1118,1247,1288,29,189,607,-1,-1,-1},
-{1172,1301,1342,83,243,661,-1,-1,-1},
-{1226,1355,1396,137,297,715,-1,-1,-1},
-{1280,9,50,191,351,769,-1,-1,-1},
-{102,878,1197,-1,-1,-1,-1,-1,-1},
-{156,932,1251,-1,-1,-1,-1,-1,-1},
-{210,986,1305,-1,-1,-1,-1,-1,-1},
-{264,1040,1359,-1,-1,-1,-1,-1,-1},
-{318,1094,13,-1,-1,-1,-1,-1,-1},
-{372,1148,67,-1,-1,-1,-1,-1,-1},
-{426,1202,121,-1,-1,-1,-1,-1,-1},
-{480,1256,175,-1,-1,-1,-1,-1,-1},
-{534,1310,229,-1,-1,-1,-1,-1,-1},
-{588,1364,283,-1,-1,-1,-1,-1,-1},
-{642,18,337,-1,-1,-1,-1,-1,-1},
-{696,72,391,-1,-1,-1,-1,-1,-1},
-{750,126,445,-1,-1,-1,-1,-1,-1},
-{804,180,499,-1,-1,-1,-1,-1,-1},
-{858,234,553,-1,-1,-1,-1,-1,-1},
-{912,288,607,-1,-1,-1,-1,-1,-1},
-{966,342,661,-1,-1,-1,-1,-1,-1},
-{1020,396,715,-1,-1,-1,-1,-1,-1},
-{1074,450,769,-1,-1,-1,-1,-1,-1},
-{1128,504,823,-1,-1,-1,-1,-1,-1},
-{1208,1245,1252,1334,-1,-1,-1,-1,-1},
-{1262,1299,1306,1388,-1,-1,-1,-1,-1},
-{1316,1353,1360,42,-1,-1,-1,-1,-1},
-{1370,7,14,96,-1,-1,-1,-1,-1},
-{24,61,68,150,-1,-1,-1,-1,-1},
-{78,115,122,204,-1,-1,-1,-1,-1},
-{132,169,176,258,-1,-1,-1,-1,-1},
-{186,223,230,312,-1,-1,-1,-1,-1},
-{240,277,284,366,-1,-1,-1,-1,-1},
-{294,331,338,420,-1,-1,-1,-1,-1},
-{348,385,392,474,-1,-1,-1,-1,-1},
-{402,439,446,528,-1,-1,-1,-1,-1},
-{456,493,500,582,-1,-1,-1,-1,-1},
-{510,547,554,636,-1,-1,-1,-1,-1},
-{564,601,608,690,-1,-1,-1,-1,-1},
-{618,655,662,744,-1,-1,-1,-1,-1},
-{672,709,716,798,-1,-1,-1,-1,-1},
-{726,763,770,852,-1,-1,-1,-1,-1},
-{780,817,824,906,-1,-1,-1,-1,-1},
-{834,871,878,960,-1,-1,-1,-1,-1},
-{55,261,490,631,716,801,995,1078,-1},
-{109,315,544,685,770,855,1049,1132,-1},
-{163,369,598,739,824,909,1103,1186,-1},
-{217,423,652,793,878,963,1157,1240,-1},
-{271,477,706,847,932,1017,1211,1294,-1},
-{325,531,760,901,986,1071,1265,1348,-1},
-{379,585,814,955,1040,1125,1319,2,-1},
-{433,639,868,1009,1094,1179,1373,56,-1},
-{487,693,922,1063,1148,1233,27,110,-1},
-{541,747,976,1117,1202,1287,81,164,-1},
-{595,801,1030,1171,1256,1341,135,218,-1},
-{649,855,1084,1225,1310,1395,189,272,-1},
-{703,909,1138,1279,1364,49,243,326,-1},
-{757,963,1192,1333,18,103,297,380,-1},
-{811,1017,1246,1387,72,157,351,434,-1},
-{865,1071,1300,41,126,211,405,488,-1},
-{919,1125,1354,95,180,265,459,542,-1},
-{973,1179,8,149,234,319,513,596,-1},
-{1027,1233,62,203,288,373,567,650,-1},
-{1081,1287,116,257,342,427,621,704,-1},
-{307,364,641,1358,-1,-1,-1,-1,-1},
-{361,418,695,12,-1,-1,-1,-1,-1},
-{415,472,749,66,-1,-1,-1,-1,-1},
-{469,526,803,120,-1,-1,-1,-1,-1},
-{523,580,857,174,-1,-1,-1,-1,-1},
-{577,634,911,228,-1,-1,-1,-1,-1},
-{631,688,965,282,-1,-1,-1,-1,-1},
-{685,742,1019,336,-1,-1,-1,-1,-1},
-{739,796,1073,390,-1,-1,-1,-1,-1},
-{793,850,1127,444,-1,-1,-1,-1,-1},
-{847,904,1181,498,-1,-1,-1,-1,-1},
-{901,958,1235,552,-1,-1,-1,-1,-1},
-{955,1012,1289,606,-1,-1,-1,-1,-1},
-{1009,1066,1343,660,-1,-1,-1,-1,-1},
-{1063,1120,1397,714,-1,-1,-1,-1,-1},
-{1117,1174,51,768,-1,-1,-1,-1,-1},
-{1171,1228,105,822,-1,-1,-1,-1,-1},
-{1225,1282,159,876,-1,-1,-1,-1,-1},
-{1279,1336,213,930,-1,-1,-1,-1,-1},
-{1333,1390,267,984,-1,-1,-1,-1,-1},
-{0,1,-1,-1,-1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1,-1,-1,-1},
-{199,200,-1,-1,-1,-1,-1,-1,-1},
-{200,201,-1,-1,-1,-1,-1,-1,-1},
-{201,202,-1,-1,-1,-1,-1,-1,-1},
-{202,203,-1,-1,-1,-1,-1,-1,-1},
-{203,204,-1,-1,-1,-1,-1,-1,-1},
-{204,205,-1,-1,-1,-1,-1,-1,-1},
-{205,206,-1,-1,-1,-1,-1,-1,-1},
-{206,207,-1,-1,-1,-1,-1,-1,-1},
-{207,208,-1,-1,-1,-1,-1,-1,-1},
-{208,209,-1,-1,-1,-1,-1,-1,-1},
-{209,210,-1,-1,-1,-1,-1,-1,-1},
-{210,211,-1,-1,-1,-1,-1,-1,-1},
-{211,212,-1,-1,-1,-1,-1,-1,-1},
-{212,213,-1,-1,-1,-1,-1,-1,-1},
-{213,214,-1,-1,-1,-1,-1,-1,-1},
-{214,215,-1,-1,-1,-1,-1,-1,-1},
-{215,216,-1,-1,-1,-1,-1,-1,-1},
-{216,217,-1,-1,-1,-1,-1,-1,-1},
-{217,218,-1,-1,-1,-1,-1,-1,-1},
-{218,219,-1,-1,-1,-1,-1,-1,-1},
-{219,220,-1,-1,-1,-1,-1,-1,-1},
-{220,221,-1,-1,-1,-1,-1,-1,-1},
-{221,222,-1,-1,-1,-1,-1,-1,-1},
-{222,223,-1,-1,-1,-1,-1,-1,-1},
-{223,224,-1,-1,-1,-1,-1,-1,-1},
-{224,225,-1,-1,-1,-1,-1,-1,-1},
-{225,226,-1,-1,-1,-1,-1,-1,-1},
-{226,227,-1,-1,-1,-1,-1,-1,-1},
-{227,228,-1,-1,-1,-1,-1,-1,-1},
-{228,229,-1,-1,-1,-1,-1,-1,-1},
-{229,230,-1,-1,-1,-1,-1,-1,-1},
-{230,231,-1,-1,-1,-1,-1,-1,-1},
-{231,232,-1,-1,-1,-1,-1,-1,-1},
-{232,233,-1,-1,-1,-1,-1,-1,-1},
-{233,234,-1,-1,-1,-1,-1,-1,-1},
-{234,235,-1,-1,-1,-1,-1,-1,-1},
-{235,236,-1,-1,-1,-1,-1,-1,-1},
-{236,237,-1,-1,-1,-1,-1,-1,-1},
-{237,238,-1,-1,-1,-1,-1,-1,-1},
-{238,239,-1,-1,-1,-1,-1,-1,-1},
-{239,240,-1,-1,-1,-1,-1,-1,-1},
-{240,241,-1,-1,-1,-1,-1,-1,-1},
-{241,242,-1,-1,-1,-1,-1,-1,-1},
-{242,243,-1,-1,-1,-1,-1,-1,-1},
-{243,244,-1,-1,-1,-1,-1,-1,-1},
-{244,245,-1,-1,-1,-1,-1,-1,-1},
-{245,246,-1,-1,-1,-1,-1,-1,-1},
-{246,247,-1,-1,-1,-1,-1,-1,-1},
-{247,248,-1,-1,-1,-1,-1,-1,-1},
-{248,249,-1,-1,-1,-1,-1,-1,-1},
-{249,250,-1,-1,-1,-1,-1,-1,-1},
-{250,251,-1,-1,-1,-1,-1,-1,-1},
-{251,252,-1,-1,-1,-1,-1,-1,-1},
-{252,253,-1,-1,-1,-1,-1,-1,-1},
-{253,254,-1,-1,-1,-1,-1,-1,-1},
-{254,255,-1,-1,-1,-1,-1,-1,-1},
-{255,256,-1,-1,-1,-1,-1,-1,-1},
-{256,257,-1,-1,-1,-1,-1,-1,-1},
-{257,258,-1,-1,-1,-1,-1,-1,-1},
-{258,259,-1,-1,-1,-1,-1,-1,-1},
-{259,260,-1,-1,-1,-1,-1,-1,-1},
-{260,261,-1,-1,-1,-1,-1,-1,-1},
-{261,262,-1,-1,-1,-1,-1,-1,-1},
-{262,263,-1,-1,-1,-1,-1,-1,-1},
-{263,264,-1,-1,-1,-1,-1,-1,-1},
-{264,265,-1,-1,-1,-1,-1,-1,-1},
-{265,266,-1,-1,-1,-1,-1,-1,-1},
-{266,267,-1,-1,-1,-1,-1,-1,-1},
-{267,268,-1,-1,-1,-1,-1,-1,-1},
-{268,269,-1,-1,-1,-1,-1,-1,-1},
-{269,270,-1,-1,-1,-1,-1,-1,-1},
-{270,271,-1,-1,-1,-1,-1,-1,-1},
-{271,272,-1,-1,-1,-1,-1,-1,-1},
-{272,273,-1,-1,-1,-1,-1,-1,-1},
-{273,274,-1,-1,-1,-1,-1,-1,-1},
-{274,275,-1,-1,-1,-1,-1,-1,-1},
-{275,276,-1,-1,-1,-1,-1,-1,-1},
-{276,277,-1,-1,-1,-1,-1,-1,-1},
-{277,278,-1,-1,-1,-1,-1,-1,-1},
-{278,279,-1,-1,-1,-1,-1,-1,-1},
-{279,280,-1,-1,-1,-1,-1,-1,-1},
-{280,281,-1,-1,-1,-1,-1,-1,-1},
-{281,282,-1,-1,-1,-1,-1,-1,-1},
-{282,283,-1,-1,-1,-1,-1,-1,-1},
-{283,284,-1,-1,-1,-1,-1,-1,-1},
-{284,285,-1,-1,-1,-1,-1,-1,-1},
-{285,286,-1,-1,-1,-1,-1,-1,-1},
-{286,287,-1,-1,-1,-1,-1,-1,-1},
-{287,288,-1,-1,-1,-1,-1,-1,-1},
-{288,289,-1,-1,-1,-1,-1,-1,-1},
-{289,290,-1,-1,-1,-1,-1,-1,-1},
-{290,291,-1,-1,-1,-1,-1,-1,-1},
-{291,292,-1,-1,-1,-1,-1,-1,-1},
-{292,293,-1,-1,-1,-1,-1,-1,-1},
-{293,294,-1,-1,-1,-1,-1,-1,-1},
-{294,295,-1,-1,-1,-1,-1,-1,-1},
-{295,296,-1,-1,-1,-1,-1,-1,-1},
-{296,297,-1,-1,-1,-1,-1,-1,-1},
-{297,298,-1,-1,-1,-1,-1,-1,-1},
-{298,299,-1,-1,-1,-1,-1,-1,-1},
-{299,300,-1,-1,-1,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1,-1,-1,-1},
-{301,302,-1,-1,-1,-1,-1,-1,-1},
-{302,303,-1,-1,-1,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1,-1,-1,-1},
-{304,305,-1,-1,-1,-1,-1,-1,-1},
-{305,306,-1,-1,-1,-1,-1,-1,-1},
-{306,307,-1,-1,-1,-1,-1,-1,-1},
-{307,308,-1,-1,-1,-1,-1,-1,-1},
-{308,309,-1,-1,-1,-1,-1,-1,-1},
-{309,310,-1,-1,-1,-1,-1,-1,-1},
-{310,311,-1,-1,-1,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1,-1,-1,-1},
-{312,313,-1,-1,-1,-1,-1,-1,-1},
-{313,314,-1,-1,-1,-1,-1,-1,-1},
-{314,315,-1,-1,-1,-1,-1,-1,-1},
-{315,316,-1,-1,-1,-1,-1,-1,-1},
-{316,317,-1,-1,-1,-1,-1,-1,-1},
-{317,318,-1,-1,-1,-1,-1,-1,-1},
-{318,319,-1,-1,-1,-1,-1,-1,-1},
-{319,320,-1,-1,-1,-1,-1,-1,-1},
-{320,321,-1,-1,-1,-1,-1,-1,-1},
-{321,322,-1,-1,-1,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1,-1,-1,-1},
-{323,324,-1,-1,-1,-1,-1,-1,-1},
-{324,325,-1,-1,-1,-1,-1,-1,-1},
-{325,326,-1,-1,-1,-1,-1,-1,-1},
-{326,327,-1,-1,-1,-1,-1,-1,-1},
-{327,328,-1,-1,-1,-1,-1,-1,-1},
-{328,329,-1,-1,-1,-1,-1,-1,-1},
-{329,330,-1,-1,-1,-1,-1,-1,-1},
-{330,331,-1,-1,-1,-1,-1,-1,-1},
-{331,332,-1,-1,-1,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1,-1,-1,-1},
-{333,334,-1,-1,-1,-1,-1,-1,-1},
-{334,335,-1,-1,-1,-1,-1,-1,-1},
-{335,336,-1,-1,-1,-1,-1,-1,-1},
-{336,337,-1,-1,-1,-1,-1,-1,-1},
-{337,338,-1,-1,-1,-1,-1,-1,-1},
-{338,339,-1,-1,-1,-1,-1,-1,-1},
-{339,340,-1,-1,-1,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1,-1,-1,-1},
-{341,342,-1,-1,-1,-1,-1,-1,-1},
-{342,343,-1,-1,-1,-1,-1,-1,-1},
-{343,344,-1,-1,-1,-1,-1,-1,-1},
-{344,345,-1,-1,-1,-1,-1,-1,-1},
-{345,346,-1,-1,-1,-1,-1,-1,-1},
-{346,347,-1,-1,-1,-1,-1,-1,-1},
-{347,348,-1,-1,-1,-1,-1,-1,-1},
-{348,349,-1,-1,-1,-1,-1,-1,-1},
-{349,350,-1,-1,-1,-1,-1,-1,-1},
-{350,351,-1,-1,-1,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1,-1,-1,-1},
-{352,353,-1,-1,-1,-1,-1,-1,-1},
-{353,354,-1,-1,-1,-1,-1,-1,-1},
-{354,355,-1,-1,-1,-1,-1,-1,-1},
-{355,356,-1,-1,-1,-1,-1,-1,-1},
-{356,357,-1,-1,-1,-1,-1,-1,-1},
-{357,358,-1,-1,-1,-1,-1,-1,-1},
-{358,359,-1,-1,-1,-1,-1,-1,-1},
-{359,360,-1,-1,-1,-1,-1,-1,-1},
-{360,361,-1,-1,-1,-1,-1,-1,-1},
-{361,362,-1,-1,-1,-1,-1,-1,-1},
-{362,363,-1,-1,-1,-1,-1,-1,-1},
-{363,364,-1,-1,-1,-1,-1,-1,-1},
-{364,365,-1,-1,-1,-1,-1,-1,-1},
-{365,366,-1,-1,-1,-1,-1,-1,-1},
-{366,367,-1,-1,-1,-1,-1,-1,-1},
-{367,368,-1,-1,-1,-1,-1,-1,-1},
-{368,369,-1,-1,-1,-1,-1,-1,-1},
-{369,370,-1,-1,-1,-1,-1,-1,-1},
-{370,371,-1,-1,-1,-1,-1,-1,-1},
-{371,372,-1,-1,-1,-1,-1,-1,-1},
-{372,373,-1,-1,-1,-1,-1,-1,-1},
-{373,374,-1,-1,-1,-1,-1,-1,-1},
-{374,375,-1,-1,-1,-1,-1,-1,-1},
-{375,376,-1,-1,-1,-1,-1,-1,-1},
-{376,377,-1,-1,-1,-1,-1,-1,-1},
-{377,378,-1,-1,-1,-1,-1,-1,-1},
-{378,379,-1,-1,-1,-1,-1,-1,-1},
-{379,380,-1,-1,-1,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1,-1,-1,-1},
-{381,382,-1,-1,-1,-1,-1,-1,-1},
-{382,383,-1,-1,-1,-1,-1,-1,-1},
-{383,384,-1,-1,-1,-1,-1,-1,-1},
-{384,385,-1,-1,-1,-1,-1,-1,-1},
-{385,386,-1,-1,-1,-1,-1,-1,-1},
-{386,387,-1,-1,-1,-1,-1,-1,-1},
-{387,388,-1,-1,-1,-1,-1,-1,-1},
-{388,389,-1,-1,-1,-1,-1,-1,-1},
-{389,390,-1,-1,-1,-1,-1,-1,-1},
-{390,391,-1,-1,-1,-1,-1,-1,-1},
-{391,392,-1,-1,-1,-1,-1,-1,-1},
-{392,393,-1,-1,-1,-1,-1,-1,-1},
-{393,394,-1,-1,-1,-1,-1,-1,-1},
-{394,395,-1,-1,-1,-1,-1,-1,-1},
-{395,396,-1,-1,-1,-1,-1,-1,-1},
-{396,397,-1,-1,-1,-1,-1,-1,-1},
-{397,398,-1,-1,-1,-1,-1,-1,-1},
-{398,399,-1,-1,-1,-1,-1,-1,-1},
-{399,400,-1,-1,-1,-1,-1,-1,-1},
-{400,401,-1,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1,-1},
-{402,403,-1,-1,-1,-1,-1,-1,-1},
-{403,404,-1,-1,-1,-1,-1,-1,-1},
-{404,405,-1,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1,-1},
-{406,407,-1,-1,-1,-1,-1,-1,-1},
-{407,408,-1,-1,-1,-1,-1,-1,-1},
-{408,409,-1,-1,-1,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1,-1},
-{410,411,-1,-1,-1,-1,-1,-1,-1},
-{411,412,-1,-1,-1,-1,-1,-1,-1},
-{412,413,-1,-1,-1,-1,-1,-1,-1},
-{413,414,-1,-1,-1,-1,-1,-1,-1},
-{414,415,-1,-1,-1,-1,-1,-1,-1},
-{415,416,-1,-1,-1,-1,-1,-1,-1},
-{416,417,-1,-1,-1,-1,-1,-1,-1},
-{417,418,-1,-1,-1,-1,-1,-1,-1},
-{418,419,-1,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1,-1},
-{420,421,-1,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1,-1},
-{422,423,-1,-1,-1,-1,-1,-1,-1},
-{423,424,-1,-1,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1,-1},
-{425,426,-1,-1,-1,-1,-1,-1,-1},
-{426,427,-1,-1,-1,-1,-1,-1,-1},
-{427,428,-1,-1,-1,-1,-1,-1,-1},
-{428,429,-1,-1,-1,-1,-1,-1,-1},
-{429,430,-1,-1,-1,-1,-1,-1,-1},
-{430,431,-1,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1,-1},
-{432,433,-1,-1,-1,-1,-1,-1,-1},
-{433,434,-1,-1,-1,-1,-1,-1,-1},
-{434,435,-1,-1,-1,-1,-1,-1,-1},
-{435,436,-1,-1,-1,-1,-1,-1,-1},
-{436,437,-1,-1,-1,-1,-1,-1,-1},
-{437,438,-1,-1,-1,-1,-1,-1,-1},
-{438,439,-1,-1,-1,-1,-1,-1,-1},
-{439,440,-1,-1,-1,-1,-1,-1,-1},
-{440,441,-1,-1,-1,-1,-1,-1,-1},
-{441,442,-1,-1,-1,-1,-1,-1,-1},
-{442,443,-1,-1,-1,-1,-1,-1,-1},
-{443,444,-1,-1,-1,-1,-1,-1,-1},
-{444,445,-1,-1,-1,-1,-1,-1,-1},
-{445,446,-1,-1,-1,-1,-1,-1,-1},
-{446,447,-1,-1,-1,-1,-1,-1,-1},
-{447,448,-1,-1,-1,-1,-1,-1,-1},
-{448,449,-1,-1,-1,-1,-1,-1,-1},
-{449,450,-1,-1,-1,-1,-1,-1,-1},
-{450,451,-1,-1,-1,-1,-1,-1,-1},
-{451,452,-1,-1,-1,-1,-1,-1,-1},
-{452,453,-1,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1,-1},
-{454,455,-1,-1,-1,-1,-1,-1,-1},
-{455,456,-1,-1,-1,-1,-1,-1,-1},
-{456,457,-1,-1,-1,-1,-1,-1,-1},
-{457,458,-1,-1,-1,-1,-1,-1,-1},
-{458,459,-1,-1,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1,-1},
-{460,461,-1,-1,-1,-1,-1,-1,-1},
-{461,462,-1,-1,-1,-1,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1,-1},
-{463,464,-1,-1,-1,-1,-1,-1,-1},
-{464,465,-1,-1,-1,-1,-1,-1,-1},
-{465,466,-1,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1,-1},
-{467,468,-1,-1,-1,-1,-1,-1,-1},
-{468,469,-1,-1,-1,-1,-1,-1,-1},
-{469,470,-1,-1,-1,-1,-1,-1,-1},
-{470,471,-1,-1,-1,-1,-1,-1,-1},
-{471,472,-1,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1,-1},
-{473,474,-1,-1,-1,-1,-1,-1,-1},
-{474,475,-1,-1,-1,-1,-1,-1,-1},
-{475,476,-1,-1,-1,-1,-1,-1,-1},
-{476,477,-1,-1,-1,-1,-1,-1,-1},
-{477,478,-1,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1,-1},
-{480,481,-1,-1,-1,-1,-1,-1,-1},
-{481,482,-1,-1,-1,-1,-1,-1,-1},
-{482,483,-1,-1,-1,-1,-1,-1,-1},
-{483,484,-1,-1,-1,-1,-1,-1,-1},
-{484,485,-1,-1,-1,-1,-1,-1,-1},
-{485,486,-1,-1,-1,-1,-1,-1,-1},
-{486,487,-1,-1,-1,-1,-1,-1,-1},
-{487,488,-1,-1,-1,-1,-1,-1,-1},
-{488,489,-1,-1,-1,-1,-1,-1,-1},
-{489,490,-1,-1,-1,-1,-1,-1,-1},
-{490,491,-1,-1,-1,-1,-1,-1,-1},
-{491,492,-1,-1,-1,-1,-1,-1,-1},
-{492,493,-1,-1,-1,-1,-1,-1,-1},
-{493,494,-1,-1,-1,-1,-1,-1,-1},
-{494,495,-1,-1,-1,-1,-1,-1,-1},
-{495,496,-1,-1,-1,-1,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1,-1},
-{497,498,-1,-1,-1,-1,-1,-1,-1},
-{498,499,-1,-1,-1,-1,-1,-1,-1},
-{499,500,-1,-1,-1,-1,-1,-1,-1},
-{500,501,-1,-1,-1,-1,-1,-1,-1},
-{501,502,-1,-1,-1,-1,-1,-1,-1},
-{502,503,-1,-1,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1,-1},
-{504,505,-1,-1,-1,-1,-1,-1,-1},
-{505,506,-1,-1,-1,-1,-1,-1,-1},
-{506,507,-1,-1,-1,-1,-1,-1,-1},
-{507,508,-1,-1,-1,-1,-1,-1,-1},
-{508,509,-1,-1,-1,-1,-1,-1,-1},
-{509,510,-1,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1,-1},
-{512,513,-1,-1,-1,-1,-1,-1,-1},
-{513,514,-1,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1,-1},
-{515,516,-1,-1,-1,-1,-1,-1,-1},
-{516,517,-1,-1,-1,-1,-1,-1,-1},
-{517,518,-1,-1,-1,-1,-1,-1,-1},
-{518,519,-1,-1,-1,-1,-1,-1,-1},
-{519,520,-1,-1,-1,-1,-1,-1,-1},
-{520,521,-1,-1,-1,-1,-1,-1,-1},
-{521,522,-1,-1,-1,-1,-1,-1,-1},
-{522,523,-1,-1,-1,-1,-1,-1,-1},
-{523,524,-1,-1,-1,-1,-1,-1,-1},
-{524,525,-1,-1,-1,-1,-1,-1,-1},
-{525,526,-1,-1,-1,-1,-1,-1,-1},
-{526,527,-1,-1,-1,-1,-1,-1,-1},
-{527,528,-1,-1,-1,-1,-1,-1,-1},
-{528,529,-1,-1,-1,-1,-1,-1,-1},
-{529,530,-1,-1,-1,-1,-1,-1,-1},
-{530,531,-1,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1,-1},
-{532,533,-1,-1,-1,-1,-1,-1,-1},
-{533,534,-1,-1,-1,-1,-1,-1,-1},
-{534,535,-1,-1,-1,-1,-1,-1,-1},
-{535,536,-1,-1,-1,-1,-1,-1,-1},
-{536,537,-1,-1,-1,-1,-1,-1,-1},
-{537,538,-1,-1,-1,-1,-1,-1,-1},
-{538,539,-1,-1,-1,-1,-1,-1,-1},
-{539,540,-1,-1,-1,-1,-1,-1,-1},
-{540,541,-1,-1,-1,-1,-1,-1,-1},
-{541,542,-1,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1,-1},
-{543,544,-1,-1,-1,-1,-1,-1,-1},
-{544,545,-1,-1,-1,-1,-1,-1,-1},
-{545,546,-1,-1,-1,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1,-1},
-{547,548,-1,-1,-1,-1,-1,-1,-1},
-{548,549,-1,-1,-1,-1,-1,-1,-1},
-{549,550,-1,-1,-1,-1,-1,-1,-1},
-{550,551,-1,-1,-1,-1,-1,-1,-1},
-{551,552,-1,-1,-1,-1,-1,-1,-1},
-{552,553,-1,-1,-1,-1,-1,-1,-1},
-{553,554,-1,-1,-1,-1,-1,-1,-1},
-{554,555,-1,-1,-1,-1,-1,-1,-1},
-{555,556,-1,-1,-1,-1,-1,-1,-1},
-{556,557,-1,-1,-1,-1,-1,-1,-1},
-{557,558,-1,-1,-1,-1,-1,-1,-1},
-{558,559,-1,-1,-1,-1,-1,-1,-1},
-{559,560,-1,-1,-1,-1,-1,-1,-1},
-{560,561,-1,-1,-1,-1,-1,-1,-1},
-{561,562,-1,-1,-1,-1,-1,-1,-1},
-{562,563,-1,-1,-1,-1,-1,-1,-1},
-{563,564,-1,-1,-1,-1,-1,-1,-1},
-{564,565,-1,-1,-1,-1,-1,-1,-1},
-{565,566,-1,-1,-1,-1,-1,-1,-1},
-{566,567,-1,-1,-1,-1,-1,-1,-1},
-{567,568,-1,-1,-1,-1,-1,-1,-1},
-{568,569,-1,-1,-1,-1,-1,-1,-1},
-{569,570,-1,-1,-1,-1,-1,-1,-1},
-{570,571,-1,-1,-1,-1,-1,-1,-1},
-{571,572,-1,-1,-1,-1,-1,-1,-1},
-{572,573,-1,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1,-1},
-{574,575,-1,-1,-1,-1,-1,-1,-1},
-{575,576,-1,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1,-1},
-{578,579,-1,-1,-1,-1,-1,-1,-1},
-{579,580,-1,-1,-1,-1,-1,-1,-1},
-{580,581,-1,-1,-1,-1,-1,-1,-1},
-{581,582,-1,-1,-1,-1,-1,-1,-1},
-{582,583,-1,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1,-1},
-{584,585,-1,-1,-1,-1,-1,-1,-1},
-{585,586,-1,-1,-1,-1,-1,-1,-1},
-{586,587,-1,-1,-1,-1,-1,-1,-1},
-{587,588,-1,-1,-1,-1,-1,-1,-1},
-{588,589,-1,-1,-1,-1,-1,-1,-1},
-{589,590,-1,-1,-1,-1,-1,-1,-1},
-{590,591,-1,-1,-1,-1,-1,-1,-1},
-{591,592,-1,-1,-1,-1,-1,-1,-1},
-{592,593,-1,-1,-1,-1,-1,-1,-1},
-{593,594,-1,-1,-1,-1,-1,-1,-1},
-{594,595,-1,-1,-1,-1,-1,-1,-1},
-{595,596,-1,-1,-1,-1,-1,-1,-1},
-{596,597,-1,-1,-1,-1,-1,-1,-1},
-{597,598,-1,-1,-1,-1,-1,-1,-1},
-{598,599,-1,-1,-1,-1,-1,-1,-1},
-{599,600,-1,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1,-1},
-{601,602,-1,-1,-1,-1,-1,-1,-1},
-{602,603,-1,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1,-1},
-{605,606,-1,-1,-1,-1,-1,-1,-1},
-{606,607,-1,-1,-1,-1,-1,-1,-1},
-{607,608,-1,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1,-1},
-{609,610,-1,-1,-1,-1,-1,-1,-1},
-{610,611,-1,-1,-1,-1,-1,-1,-1},
-{611,612,-1,-1,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1,-1},
-{613,614,-1,-1,-1,-1,-1,-1,-1},
-{614,615,-1,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1,-1},
-{617,618,-1,-1,-1,-1,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1,-1},
-{619,620,-1,-1,-1,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1,-1},
-{621,622,-1,-1,-1,-1,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1,-1},
-{623,624,-1,-1,-1,-1,-1,-1,-1},
-{624,625,-1,-1,-1,-1,-1,-1,-1},
-{625,626,-1,-1,-1,-1,-1,-1,-1},
-{626,627,-1,-1,-1,-1,-1,-1,-1},
-{627,628,-1,-1,-1,-1,-1,-1,-1},
-{628,629,-1,-1,-1,-1,-1,-1,-1},
-{629,630,-1,-1,-1,-1,-1,-1,-1},
-{630,631,-1,-1,-1,-1,-1,-1,-1},
-{631,632,-1,-1,-1,-1,-1,-1,-1},
-{632,633,-1,-1,-1,-1,-1,-1,-1},
-{633,634,-1,-1,-1,-1,-1,-1,-1},
-{634,635,-1,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1,-1},
-{636,637,-1,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1,-1},
-{638,639,-1,-1,-1,-1,-1,-1,-1},
-{639,640,-1,-1,-1,-1,-1,-1,-1},
-{640,641,-1,-1,-1,-1,-1,-1,-1},
-{641,642,-1,-1,-1,-1,-1,-1,-1},
-{642,643,-1,-1,-1,-1,-1,-1,-1},
-{643,644,-1,-1,-1,-1,-1,-1,-1},
-{644,645,-1,-1,-1,-1,-1,-1,-1},
-{645,646,-1,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1,-1},
-{647,648,-1,-1,-1,-1,-1,-1,-1},
-{648,649,-1,-1,-1,-1,-1,-1,-1},
-{649,650,-1,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1,-1},
-{651,652,-1,-1,-1,-1,-1,-1,-1},
-{652,653,-1,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1,-1},
-{655,656,-1,-1,-1,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1,-1},
-{657,658,-1,-1,-1,-1,-1,-1,-1},
-{658,659,-1,-1,-1,-1,-1,-1,-1},
-{659,660,-1,-1,-1,-1,-1,-1,-1},
-{660,661,-1,-1,-1,-1,-1,-1,-1},
-{661,662,-1,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1,-1},
-{663,664,-1,-1,-1,-1,-1,-1,-1},
-{664,665,-1,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1,-1},
-{667,668,-1,-1,-1,-1,-1,-1,-1},
-{668,669,-1,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1,-1},
-{670,671,-1,-1,-1,-1,-1,-1,-1},
-{671,672,-1,-1,-1,-1,-1,-1,-1},
-{672,673,-1,-1,-1,-1,-1,-1,-1},
-{673,674,-1,-1,-1,-1,-1,-1,-1},
-{674,675,-1,-1,-1,-1,-1,-1,-1},
-{675,676,-1,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1,-1},
-{677,678,-1,-1,-1,-1,-1,-1,-1},
-{678,679,-1,-1,-1,-1,-1,-1,-1},
-{679,680,-1,-1,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1,-1},
-{681,682,-1,-1,-1,-1,-1,-1,-1},
-{682,683,-1,-1,-1,-1,-1,-1,-1},
-{683,684,-1,-1,-1,-1,-1,-1,-1},
-{684,685,-1,-1,-1,-1,-1,-1,-1},
-{685,686,-1,-1,-1,-1,-1,-1,-1},
-{686,687,-1,-1,-1,-1,-1,-1,-1},
-{687,688,-1,-1,-1,-1,-1,-1,-1},
-{688,689,-1,-1,-1,-1,-1,-1,-1},
-{689,690,-1,-1,-1,-1,-1,-1,-1},
-{690,691,-1,-1,-1,-1,-1,-1,-1},
-{691,692,-1,-1,-1,-1,-1,-1,-1},
-{692,693,-1,-1,-1,-1,-1,-1,-1},
-{693,694,-1,-1,-1,-1,-1,-1,-1},
-{694,695,-1,-1,-1,-1,-1,-1,-1},
-{695,696,-1,-1,-1,-1,-1,-1,-1},
-{696,697,-1,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1,-1},
-{699,700,-1,-1,-1,-1,-1,-1,-1},
-{700,701,-1,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1,-1},
-{702,703,-1,-1,-1,-1,-1,-1,-1},
-{703,704,-1,-1,-1,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1,-1},
-{705,706,-1,-1,-1,-1,-1,-1,-1},
-{706,707,-1,-1,-1,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1,-1},
-{708,709,-1,-1,-1,-1,-1,-1,-1},
-{709,710,-1,-1,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1,-1},
-{711,712,-1,-1,-1,-1,-1,-1,-1},
-{712,713,-1,-1,-1,-1,-1,-1,-1},
-{713,714,-1,-1,-1,-1,-1,-1,-1},
-{714,715,-1,-1,-1,-1,-1,-1,-1},
-{715,716,-1,-1,-1,-1,-1,-1,-1},
-{716,717,-1,-1,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1,-1},
-{718,719,-1,-1,-1,-1,-1,-1,-1},
-{719,720,-1,-1,-1,-1,-1,-1,-1},
-{720,721,-1,-1,-1,-1,-1,-1,-1},
-{721,722,-1,-1,-1,-1,-1,-1,-1},
-{722,723,-1,-1,-1,-1,-1,-1,-1},
-{723,724,-1,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1,-1},
-{725,726,-1,-1,-1,-1,-1,-1,-1},
-{726,727,-1,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1,-1},
-{730,731,-1,-1,-1,-1,-1,-1,-1},
-{731,732,-1,-1,-1,-1,-1,-1,-1},
-{732,733,-1,-1,-1,-1,-1,-1,-1},
-{733,734,-1,-1,-1,-1,-1,-1,-1},
-{734,735,-1,-1,-1,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1,-1},
-{736,737,-1,-1,-1,-1,-1,-1,-1},
-{737,738,-1,-1,-1,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1,-1},
-{739,740,-1,-1,-1,-1,-1,-1,-1},
-{740,741,-1,-1,-1,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1,-1},
-{742,743,-1,-1,-1,-1,-1,-1,-1},
-{743,744,-1,-1,-1,-1,-1,-1,-1},
-{744,745,-1,-1,-1,-1,-1,-1,-1},
-{745,746,-1,-1,-1,-1,-1,-1,-1},
-{746,747,-1,-1,-1,-1,-1,-1,-1},
-{747,748,-1,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1,-1},
-{749,750,-1,-1,-1,-1,-1,-1,-1},
-{750,751,-1,-1,-1,-1,-1,-1,-1},
-{751,752,-1,-1,-1,-1,-1,-1,-1},
-{752,753,-1,-1,-1,-1,-1,-1,-1},
-{753,754,-1,-1,-1,-1,-1,-1,-1},
-{754,755,-1,-1,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1,-1},
-{756,757,-1,-1,-1,-1,-1,-1,-1},
-{757,758,-1,-1,-1,-1,-1,-1,-1},
-{758,759,-1,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1},
-{760,761,-1,-1,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1,-1},
-{762,763,-1,-1,-1,-1,-1,-1,-1},
-{763,764,-1,-1,-1,-1,-1,-1,-1},
-{764,765,-1,-1,-1,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1,-1},
-{766,767,-1,-1,-1,-1,-1,-1,-1},
-{767,768,-1,-1,-1,-1,-1,-1,-1},
-{768,769,-1,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1,-1},
-{770,771,-1,-1,-1,-1,-1,-1,-1},
-{771,772,-1,-1,-1,-1,-1,-1,-1},
-{772,773,-1,-1,-1,-1,-1,-1,-1},
-{773,774,-1,-1,-1,-1,-1,-1,-1},
-{774,775,-1,-1,-1,-1,-1,-1,-1},
-{775,776,-1,-1,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1,-1},
-{777,778,-1,-1,-1,-1,-1,-1,-1},
-{778,779,-1,-1,-1,-1,-1,-1,-1},
-{779,780,-1,-1,-1,-1,-1,-1,-1},
-{780,781,-1,-1,-1,-1,-1,-1,-1},
-{781,782,-1,-1,-1,-1,-1,-1,-1},
-{782,783,-1,-1,-1,-1,-1,-1,-1},
-{783,784,-1,-1,-1,-1,-1,-1,-1},
-{784,785,-1,-1,-1,-1,-1,-1,-1},
-{785,786,-1,-1,-1,-1,-1,-1,-1},
-{786,787,-1,-1,-1,-1,-1,-1,-1},
-{787,788,-1,-1,-1,-1,-1,-1,-1},
-{788,789,-1,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1},
-{792,793,-1,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1},
-{794,795,-1,-1,-1,-1,-1,-1,-1},
-{795,796,-1,-1,-1,-1,-1,-1,-1},
-{796,797,-1,-1,-1,-1,-1,-1,-1},
-{797,798,-1,-1,-1,-1,-1,-1,-1},
-{798,799,-1,-1,-1,-1,-1,-1,-1},
-{799,800,-1,-1,-1,-1,-1,-1,-1},
-{800,801,-1,-1,-1,-1,-1,-1,-1},
-{801,802,-1,-1,-1,-1,-1,-1,-1},
-{802,803,-1,-1,-1,-1,-1,-1,-1},
-{803,804,-1,-1,-1,-1,-1,-1,-1},
-{804,805,-1,-1,-1,-1,-1,-1,-1},
-{805,806,-1,-1,-1,-1,-1,-1,-1},
-{806,807,-1,-1,-1,-1,-1,-1,-1},
-{807,808,-1,-1,-1,-1,-1,-1,-1},
-{808,809,-1,-1,-1,-1,-1,-1,-1},
-{809,810,-1,-1,-1,-1,-1,-1,-1},
-{810,811,-1,-1,-1,-1,-1,-1,-1},
-{811,812,-1,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1},
-{813,814,-1,-1,-1,-1,-1,-1,-1},
-{814,815,-1,-1,-1,-1,-1,-1,-1},
-{815,816,-1,-1,-1,-1,-1,-1,-1},
-{816,817,-1,-1,-1,-1,-1,-1,-1},
-{817,818,-1,-1,-1,-1,-1,-1,-1},
-{818,819,-1,-1,-1,-1,-1,-1,-1},
-{819,820,-1,-1,-1,-1,-1,-1,-1},
-{820,821,-1,-1,-1,-1,-1,-1,-1},
-{821,822,-1,-1,-1,-1,-1,-1,-1},
-{822,823,-1,-1,-1,-1,-1,-1,-1},
-{823,824,-1,-1,-1,-1,-1,-1,-1},
-{824,825,-1,-1,-1,-1,-1,-1,-1},
-{825,826,-1,-1,-1,-1,-1,-1,-1},
-{826,827,-1,-1,-1,-1,-1,-1,-1},
-{827,828,-1,-1,-1,-1,-1,-1,-1},
-{828,829,-1,-1,-1,-1,-1,-1,-1},
-{829,830,-1,-1,-1,-1,-1,-1,-1},
-{830,831,-1,-1,-1,-1,-1,-1,-1},
-{831,832,-1,-1,-1,-1,-1,-1,-1},
-{832,833,-1,-1,-1,-1,-1,-1,-1},
-{833,834,-1,-1,-1,-1,-1,-1,-1},
-{834,835,-1,-1,-1,-1,-1,-1,-1},
-{835,836,-1,-1,-1,-1,-1,-1,-1},
-{836,837,-1,-1,-1,-1,-1,-1,-1},
-{837,838,-1,-1,-1,-1,-1,-1,-1},
-{838,839,-1,-1,-1,-1,-1,-1,-1},
-{839,840,-1,-1,-1,-1,-1,-1,-1},
-{840,841,-1,-1,-1,-1,-1,-1,-1},
-{841,842,-1,-1,-1,-1,-1,-1,-1},
-{842,843,-1,-1,-1,-1,-1,-1,-1},
-{843,844,-1,-1,-1,-1,-1,-1,-1},
-{844,845,-1,-1,-1,-1,-1,-1,-1},
-{845,846,-1,-1,-1,-1,-1,-1,-1},
-{846,847,-1,-1,-1,-1,-1,-1,-1},
-{847,848,-1,-1,-1,-1,-1,-1,-1},
-{848,849,-1,-1,-1,-1,-1,-1,-1},
-{849,850,-1,-1,-1,-1,-1,-1,-1},
-{850,851,-1,-1,-1,-1,-1,-1,-1},
-{851,852,-1,-1,-1,-1,-1,-1,-1},
-{852,853,-1,-1,-1,-1,-1,-1,-1},
-{853,854,-1,-1,-1,-1,-1,-1,-1},
-{854,855,-1,-1,-1,-1,-1,-1,-1},
-{855,856,-1,-1,-1,-1,-1,-1,-1},
-{856,857,-1,-1,-1,-1,-1,-1,-1},
-{857,858,-1,-1,-1,-1,-1,-1,-1},
-{858,859,-1,-1,-1,-1,-1,-1,-1},
-{859,860,-1,-1,-1,-1,-1,-1,-1},
-{860,861,-1,-1,-1,-1,-1,-1,-1},
-{861,862,-1,-1,-1,-1,-1,-1,-1},
-{862,863,-1,-1,-1,-1,-1,-1,-1},
-{863,864,-1,-1,-1,-1,-1,-1,-1},
-{864,865,-1,-1,-1,-1,-1,-1,-1},
-{865,866,-1,-1,-1,-1,-1,-1,-1},
-{866,867,-1,-1,-1,-1,-1,-1,-1},
-{867,868,-1,-1,-1,-1,-1,-1,-1},
-{868,869,-1,-1,-1,-1,-1,-1,-1},
-{869,870,-1,-1,-1,-1,-1,-1,-1},
-{870,871,-1,-1,-1,-1,-1,-1,-1},
-{871,872,-1,-1,-1,-1,-1,-1,-1},
-{872,873,-1,-1,-1,-1,-1,-1,-1},
-{873,874,-1,-1,-1,-1,-1,-1,-1},
-{874,875,-1,-1,-1,-1,-1,-1,-1},
-{875,876,-1,-1,-1,-1,-1,-1,-1},
-{876,877,-1,-1,-1,-1,-1,-1,-1},
-{877,878,-1,-1,-1,-1,-1,-1,-1},
-{878,879,-1,-1,-1,-1,-1,-1,-1},
-{879,880,-1,-1,-1,-1,-1,-1,-1},
-{880,881,-1,-1,-1,-1,-1,-1,-1},
-{881,882,-1,-1,-1,-1,-1,-1,-1},
-{882,883,-1,-1,-1,-1,-1,-1,-1},
-{883,884,-1,-1,-1,-1,-1,-1,-1},
-{884,885,-1,-1,-1,-1,-1,-1,-1},
-{885,886,-1,-1,-1,-1,-1,-1,-1},
-{886,887,-1,-1,-1,-1,-1,-1,-1},
-{887,888,-1,-1,-1,-1,-1,-1,-1},
-{888,889,-1,-1,-1,-1,-1,-1,-1},
-{889,890,-1,-1,-1,-1,-1,-1,-1},
-{890,891,-1,-1,-1,-1,-1,-1,-1},
-{891,892,-1,-1,-1,-1,-1,-1,-1},
-{892,893,-1,-1,-1,-1,-1,-1,-1},
-{893,894,-1,-1,-1,-1,-1,-1,-1},
-{894,895,-1,-1,-1,-1,-1,-1,-1},
-{895,896,-1,-1,-1,-1,-1,-1,-1},
-{896,897,-1,-1,-1,-1,-1,-1,-1},
-{897,898,-1,-1,-1,-1,-1,-1,-1},
-{898,899,-1,-1,-1,-1,-1,-1,-1},
-{899,900,-1,-1,-1,-1,-1,-1,-1},
-{900,901,-1,-1,-1,-1,-1,-1,-1},
-{901,902,-1,-1,-1,-1,-1,-1,-1},
-{902,903,-1,-1,-1,-1,-1,-1,-1},
-{903,904,-1,-1,-1,-1,-1,-1,-1},
-{904,905,-1,-1,-1,-1,-1,-1,-1},
-{905,906,-1,-1,-1,-1,-1,-1,-1},
-{906,907,-1,-1,-1,-1,-1,-1,-1},
-{907,908,-1,-1,-1,-1,-1,-1,-1},
-{908,909,-1,-1,-1,-1,-1,-1,-1},
-{909,910,-1,-1,-1,-1,-1,-1,-1},
-{910,911,-1,-1,-1,-1,-1,-1,-1},
-{911,912,-1,-1,-1,-1,-1,-1,-1},
-{912,913,-1,-1,-1,-1,-1,-1,-1},
-{913,914,-1,-1,-1,-1,-1,-1,-1},
-{914,915,-1,-1,-1,-1,-1,-1,-1},
-{915,916,-1,-1,-1,-1,-1,-1,-1},
-{916,917,-1,-1,-1,-1,-1,-1,-1},
-{917,918,-1,-1,-1,-1,-1,-1,-1},
-{918,919,-1,-1,-1,-1,-1,-1,-1},
-{919,920,-1,-1,-1,-1,-1,-1,-1},
-{920,921,-1,-1,-1,-1,-1,-1,-1},
-{921,922,-1,-1,-1,-1,-1,-1,-1},
-{922,923,-1,-1,-1,-1,-1,-1,-1},
-{923,924,-1,-1,-1,-1,-1,-1,-1},
-{924,925,-1,-1,-1,-1,-1,-1,-1},
-{925,926,-1,-1,-1,-1,-1,-1,-1},
-{926,927,-1,-1,-1,-1,-1,-1,-1},
-{927,928,-1,-1,-1,-1,-1,-1,-1},
-{928,929,-1,-1,-1,-1,-1,-1,-1},
-{929,930,-1,-1,-1,-1,-1,-1,-1},
-{930,931,-1,-1,-1,-1,-1,-1,-1},
-{931,932,-1,-1,-1,-1,-1,-1,-1},
-{932,933,-1,-1,-1,-1,-1,-1,-1},
-{933,934,-1,-1,-1,-1,-1,-1,-1},
-{934,935,-1,-1,-1,-1,-1,-1,-1},
-{935,936,-1,-1,-1,-1,-1,-1,-1},
-{936,937,-1,-1,-1,-1,-1,-1,-1},
-{937,938,-1,-1,-1,-1,-1,-1,-1},
-{938,939,-1,-1,-1,-1,-1,-1,-1},
-{939,940,-1,-1,-1,-1,-1,-1,-1},
-{940,941,-1,-1,-1,-1,-1,-1,-1},
-{941,942,-1,-1,-1,-1,-1,-1,-1},
-{942,943,-1,-1,-1,-1,-1,-1,-1},
-{943,944,-1,-1,-1,-1,-1,-1,-1},
-{944,945,-1,-1,-1,-1,-1,-1,-1},
-{945,946,-1,-1,-1,-1,-1,-1,-1},
-{946,947,-1,-1,-1,-1,-1,-1,-1},
-{947,948,-1,-1,-1,-1,-1,-1,-1},
-{948,949,-1,-1,-1,-1,-1,-1,-1},
-{949,950,-1,-1,-1,-1,-1,-1,-1},
-{950,951,-1,-1,-1,-1,-1,-1,-1},
-{951,952,-1,-1,-1,-1,-1,-1,-1},
-{952,953,-1,-1,-1,-1,-1,-1,-1},
-{953,954,-1,-1,-1,-1,-1,-1,-1},
-{954,955,-1,-1,-1,-1,-1,-1,-1},
-{955,956,-1,-1,-1,-1,-1,-1,-1},
-{956,957,-1,-1,-1,-1,-1,-1,-1},
-{957,958,-1,-1,-1,-1,-1,-1,-1},
-{958,959,-1,-1,-1,-1,-1,-1,-1},
-{959,960,-1,-1,-1,-1,-1,-1,-1},
-{960,961,-1,-1,-1,-1,-1,-1,-1},
-{961,962,-1,-1,-1,-1,-1,-1,-1},
-{962,963,-1,-1,-1,-1,-1,-1,-1},
-{963,964,-1,-1,-1,-1,-1,-1,-1},
-{964,965,-1,-1,-1,-1,-1,-1,-1},
-{965,966,-1,-1,-1,-1,-1,-1,-1},
-{966,967,-1,-1,-1,-1,-1,-1,-1},
-{967,968,-1,-1,-1,-1,-1,-1,-1},
-{968,969,-1,-1,-1,-1,-1,-1,-1},
-{969,970,-1,-1,-1,-1,-1,-1,-1},
-{970,971,-1,-1,-1,-1,-1,-1,-1},
-{971,972,-1,-1,-1,-1,-1,-1,-1},
-{972,973,-1,-1,-1,-1,-1,-1,-1},
-{973,974,-1,-1,-1,-1,-1,-1,-1},
-{974,975,-1,-1,-1,-1,-1,-1,-1},
-{975,976,-1,-1,-1,-1,-1,-1,-1},
-{976,977,-1,-1,-1,-1,-1,-1,-1},
-{977,978,-1,-1,-1,-1,-1,-1,-1},
-{978,979,-1,-1,-1,-1,-1,-1,-1},
-{979,980,-1,-1,-1,-1,-1,-1,-1},
-{980,981,-1,-1,-1,-1,-1,-1,-1},
-{981,982,-1,-1,-1,-1,-1,-1,-1},
-{982,983,-1,-1,-1,-1,-1,-1,-1},
-{983,984,-1,-1,-1,-1,-1,-1,-1},
-{984,985,-1,-1,-1,-1,-1,-1,-1},
-{985,986,-1,-1,-1,-1,-1,-1,-1},
-{986,987,-1,-1,-1,-1,-1,-1,-1},
-{987,988,-1,-1,-1,-1,-1,-1,-1},
-{988,989,-1,-1,-1,-1,-1,-1,-1},
-{989,990,-1,-1,-1,-1,-1,-1,-1},
-{990,991,-1,-1,-1,-1,-1,-1,-1},
-{991,992,-1,-1,-1,-1,-1,-1,-1},
-{992,993,-1,-1,-1,-1,-1,-1,-1},
-{993,994,-1,-1,-1,-1,-1,-1,-1},
-{994,995,-1,-1,-1,-1,-1,-1,-1},
-{995,996,-1,-1,-1,-1,-1,-1,-1},
-{996,997,-1,-1,-1,-1,-1,-1,-1},
-{997,998,-1,-1,-1,-1,-1,-1,-1},
-{998,999,-1,-1,-1,-1,-1,-1,-1},
-{999,1000,-1,-1,-1,-1,-1,-1,-1},
-{1000,1001,-1,-1,-1,-1,-1,-1,-1},
-{1001,1002,-1,-1,-1,-1,-1,-1,-1},
-{1002,1003,-1,-1,-1,-1,-1,-1,-1},
-{1003,1004,-1,-1,-1,-1,-1,-1,-1},
-{1004,1005,-1,-1,-1,-1,-1,-1,-1},
-{1005,1006,-1,-1,-1,-1,-1,-1,-1},
-{1006,1007,-1,-1,-1,-1,-1,-1,-1},
-{1007,1008,-1,-1,-1,-1,-1,-1,-1},
-{1008,1009,-1,-1,-1,-1,-1,-1,-1},
-{1009,1010,-1,-1,-1,-1,-1,-1,-1},
-{1010,1011,-1,-1,-1,-1,-1,-1,-1},
-{1011,1012,-1,-1,-1,-1,-1,-1,-1},
-{1012,1013,-1,-1,-1,-1,-1,-1,-1},
-{1013,1014,-1,-1,-1,-1,-1,-1,-1},
-{1014,1015,-1,-1,-1,-1,-1,-1,-1},
-{1015,1016,-1,-1,-1,-1,-1,-1,-1},
-{1016,1017,-1,-1,-1,-1,-1,-1,-1},
-{1017,1018,-1,-1,-1,-1,-1,-1,-1},
-{1018,1019,-1,-1,-1,-1,-1,-1,-1},
-{1019,1020,-1,-1,-1,-1,-1,-1,-1},
-{1020,1021,-1,-1,-1,-1,-1,-1,-1},
-{1021,1022,-1,-1,-1,-1,-1,-1,-1},
-{1022,1023,-1,-1,-1,-1,-1,-1,-1},
-{1023,1024,-1,-1,-1,-1,-1,-1,-1},
-{1024,1025,-1,-1,-1,-1,-1,-1,-1},
-{1025,1026,-1,-1,-1,-1,-1,-1,-1},
-{1026,1027,-1,-1,-1,-1,-1,-1,-1},
-{1027,1028,-1,-1,-1,-1,-1,-1,-1},
-{1028,1029,-1,-1,-1,-1,-1,-1,-1},
-{1029,1030,-1,-1,-1,-1,-1,-1,-1},
-{1030,1031,-1,-1,-1,-1,-1,-1,-1},
-{1031,1032,-1,-1,-1,-1,-1,-1,-1},
-{1032,1033,-1,-1,-1,-1,-1,-1,-1},
-{1033,1034,-1,-1,-1,-1,-1,-1,-1},
-{1034,1035,-1,-1,-1,-1,-1,-1,-1},
-{1035,1036,-1,-1,-1,-1,-1,-1,-1},
-{1036,1037,-1,-1,-1,-1,-1,-1,-1},
-{1037,1038,-1,-1,-1,-1,-1,-1,-1},
-{1038,1039,-1,-1,-1,-1,-1,-1,-1},
-{1039,1040,-1,-1,-1,-1,-1,-1,-1},
-{1040,1041,-1,-1,-1,-1,-1,-1,-1},
-{1041,1042,-1,-1,-1,-1,-1,-1,-1},
-{1042,1043,-1,-1,-1,-1,-1,-1,-1},
-{1043,1044,-1,-1,-1,-1,-1,-1,-1},
-{1044,1045,-1,-1,-1,-1,-1,-1,-1},
-{1045,1046,-1,-1,-1,-1,-1,-1,-1},
-{1046,1047,-1,-1,-1,-1,-1,-1,-1},
-{1047,1048,-1,-1,-1,-1,-1,-1,-1},
-{1048,1049,-1,-1,-1,-1,-1,-1,-1},
-{1049,1050,-1,-1,-1,-1,-1,-1,-1},
-{1050,1051,-1,-1,-1,-1,-1,-1,-1},
-{1051,1052,-1,-1,-1,-1,-1,-1,-1},
-{1052,1053,-1,-1,-1,-1,-1,-1,-1},
-{1053,1054,-1,-1,-1,-1,-1,-1,-1},
-{1054,1055,-1,-1,-1,-1,-1,-1,-1},
-{1055,1056,-1,-1,-1,-1,-1,-1,-1},
-{1056,1057,-1,-1,-1,-1,-1,-1,-1},
-{1057,1058,-1,-1,-1,-1,-1,-1,-1},
-{1058,1059,-1,-1,-1,-1,-1,-1,-1},
-{1059,1060,-1,-1,-1,-1,-1,-1,-1},
-{1060,1061,-1,-1,-1,-1,-1,-1,-1},
-{1061,1062,-1,-1,-1,-1,-1,-1,-1},
-{1062,1063,-1,-1,-1,-1,-1,-1,-1},
-{1063,1064,-1,-1,-1,-1,-1,-1,-1},
-{1064,1065,-1,-1,-1,-1,-1,-1,-1},
-{1065,1066,-1,-1,-1,-1,-1,-1,-1},
-{1066,1067,-1,-1,-1,-1,-1,-1,-1},
-{1067,1068,-1,-1,-1,-1,-1,-1,-1},
-{1068,1069,-1,-1,-1,-1,-1,-1,-1},
-{1069,1070,-1,-1,-1,-1,-1,-1,-1},
-{1070,1071,-1,-1,-1,-1,-1,-1,-1},
-{1071,1072,-1,-1,-1,-1,-1,-1,-1},
-{1072,1073,-1,-1,-1,-1,-1,-1,-1},
-{1073,1074,-1,-1,-1,-1,-1,-1,-1},
-{1074,1075,-1,-1,-1,-1,-1,-1,-1},
-{1075,1076,-1,-1,-1,-1,-1,-1,-1},
-{1076,1077,-1,-1,-1,-1,-1,-1,-1},
-{1077,1078,-1,-1,-1,-1,-1,-1,-1},
-{1078,1079,-1,-1,-1,-1,-1,-1,-1},
-{1079,1080,-1,-1,-1,-1,-1,-1,-1},
-{1080,1081,-1,-1,-1,-1,-1,-1,-1},
-{1081,1082,-1,-1,-1,-1,-1,-1,-1},
-{1082,1083,-1,-1,-1,-1,-1,-1,-1},
-{1083,1084,-1,-1,-1,-1,-1,-1,-1},
-{1084,1085,-1,-1,-1,-1,-1,-1,-1},
-{1085,1086,-1,-1,-1,-1,-1,-1,-1},
-{1086,1087,-1,-1,-1,-1,-1,-1,-1},
-{1087,1088,-1,-1,-1,-1,-1,-1,-1},
-{1088,1089,-1,-1,-1,-1,-1,-1,-1},
-{1089,1090,-1,-1,-1,-1,-1,-1,-1},
-{1090,1091,-1,-1,-1,-1,-1,-1,-1},
-{1091,1092,-1,-1,-1,-1,-1,-1,-1},
-{1092,1093,-1,-1,-1,-1,-1,-1,-1},
-{1093,1094,-1,-1,-1,-1,-1,-1,-1},
-{1094,1095,-1,-1,-1,-1,-1,-1,-1},
-{1095,1096,-1,-1,-1,-1,-1,-1,-1},
-{1096,1097,-1,-1,-1,-1,-1,-1,-1},
-{1097,1098,-1,-1,-1,-1,-1,-1,-1},
-{1098,1099,-1,-1,-1,-1,-1,-1,-1},
-{1099,1100,-1,-1,-1,-1,-1,-1,-1},
-{1100,1101,-1,-1,-1,-1,-1,-1,-1},
-{1101,1102,-1,-1,-1,-1,-1,-1,-1},
-{1102,1103,-1,-1,-1,-1,-1,-1,-1},
-{1103,1104,-1,-1,-1,-1,-1,-1,-1},
-{1104,1105,-1,-1,-1,-1,-1,-1,-1},
-{1105,1106,-1,-1,-1,-1,-1,-1,-1},
-{1106,1107,-1,-1,-1,-1,-1,-1,-1},
-{1107,1108,-1,-1,-1,-1,-1,-1,-1},
-{1108,1109,-1,-1,-1,-1,-1,-1,-1},
-{1109,1110,-1,-1,-1,-1,-1,-1,-1},
-{1110,1111,-1,-1,-1,-1,-1,-1,-1},
-{1111,1112,-1,-1,-1,-1,-1,-1,-1},
-{1112,1113,-1,-1,-1,-1,-1,-1,-1},
-{1113,1114,-1,-1,-1,-1,-1,-1,-1},
-{1114,1115,-1,-1,-1,-1,-1,-1,-1},
-{1115,1116,-1,-1,-1,-1,-1,-1,-1},
-{1116,1117,-1,-1,-1,-1,-1,-1,-1},
-{1117,1118,-1,-1,-1,-1,-1,-1,-1},
-{1118,1119,-1,-1,-1,-1,-1,-1,-1},
-{1119,1120,-1,-1,-1,-1,-1,-1,-1},
-{1120,1121,-1,-1,-1,-1,-1,-1,-1},
-{1121,1122,-1,-1,-1,-1,-1,-1,-1},
-{1122,1123,-1,-1,-1,-1,-1,-1,-1},
-{1123,1124,-1,-1,-1,-1,-1,-1,-1},
-{1124,1125,-1,-1,-1,-1,-1,-1,-1},
-{1125,1126,-1,-1,-1,-1,-1,-1,-1},
-{1126,1127,-1,-1,-1,-1,-1,-1,-1},
-{1127,1128,-1,-1,-1,-1,-1,-1,-1},
-{1128,1129,-1,-1,-1,-1,-1,-1,-1},
-{1129,1130,-1,-1,-1,-1,-1,-1,-1},
-{1130,1131,-1,-1,-1,-1,-1,-1,-1},
-{1131,1132,-1,-1,-1,-1,-1,-1,-1},
-{1132,1133,-1,-1,-1,-1,-1,-1,-1},
-{1133,1134,-1,-1,-1,-1,-1,-1,-1},
-{1134,1135,-1,-1,-1,-1,-1,-1,-1},
-{1135,1136,-1,-1,-1,-1,-1,-1,-1},
-{1136,1137,-1,-1,-1,-1,-1,-1,-1},
-{1137,1138,-1,-1,-1,-1,-1,-1,-1},
-{1138,1139,-1,-1,-1,-1,-1,-1,-1},
-{1139,1140,-1,-1,-1,-1,-1,-1,-1},
-{1140,1141,-1,-1,-1,-1,-1,-1,-1},
-{1141,1142,-1,-1,-1,-1,-1,-1,-1},
-{1142,1143,-1,-1,-1,-1,-1,-1,-1},
-{1143,1144,-1,-1,-1,-1,-1,-1,-1},
-{1144,1145,-1,-1,-1,-1,-1,-1,-1},
-{1145,1146,-1,-1,-1,-1,-1,-1,-1},
-{1146,1147,-1,-1,-1,-1,-1,-1,-1},
-{1147,1148,-1,-1,-1,-1,-1,-1,-1},
-{1148,1149,-1,-1,-1,-1,-1,-1,-1},
-{1149,1150,-1,-1,-1,-1,-1,-1,-1},
-{1150,1151,-1,-1,-1,-1,-1,-1,-1},
-{1151,1152,-1,-1,-1,-1,-1,-1,-1},
-{1152,1153,-1,-1,-1,-1,-1,-1,-1},
-{1153,1154,-1,-1,-1,-1,-1,-1,-1},
-{1154,1155,-1,-1,-1,-1,-1,-1,-1},
-{1155,1156,-1,-1,-1,-1,-1,-1,-1},
-{1156,1157,-1,-1,-1,-1,-1,-1,-1},
-{1157,1158,-1,-1,-1,-1,-1,-1,-1},
-{1158,1159,-1,-1,-1,-1,-1,-1,-1},
-{1159,1160,-1,-1,-1,-1,-1,-1,-1},
-{1160,1161,-1,-1,-1,-1,-1,-1,-1},
-{1161,1162,-1,-1,-1,-1,-1,-1,-1},
-{1162,1163,-1,-1,-1,-1,-1,-1,-1},
-{1163,1164,-1,-1,-1,-1,-1,-1,-1},
-{1164,1165,-1,-1,-1,-1,-1,-1,-1},
-{1165,1166,-1,-1,-1,-1,-1,-1,-1},
-{1166,1167,-1,-1,-1,-1,-1,-1,-1},
-{1167,1168,-1,-1,-1,-1,-1,-1,-1},
-{1168,1169,-1,-1,-1,-1,-1,-1,-1},
-{1169,1170,-1,-1,-1,-1,-1,-1,-1},
-{1170,1171,-1,-1,-1,-1,-1,-1,-1},
-{1171,1172,-1,-1,-1,-1,-1,-1,-1},
-{1172,1173,-1,-1,-1,-1,-1,-1,-1},
-{1173,1174,-1,-1,-1,-1,-1,-1,-1},
-{1174,1175,-1,-1,-1,-1,-1,-1,-1},
-{1175,1176,-1,-1,-1,-1,-1,-1,-1},
-{1176,1177,-1,-1,-1,-1,-1,-1,-1},
-{1177,1178,-1,-1,-1,-1,-1,-1,-1},
-{1178,1179,-1,-1,-1,-1,-1,-1,-1},
-{1179,1180,-1,-1,-1,-1,-1,-1,-1},
-{1180,1181,-1,-1,-1,-1,-1,-1,-1},
-{1181,1182,-1,-1,-1,-1,-1,-1,-1},
-{1182,1183,-1,-1,-1,-1,-1,-1,-1},
-{1183,1184,-1,-1,-1,-1,-1,-1,-1},
-{1184,1185,-1,-1,-1,-1,-1,-1,-1},
-{1185,1186,-1,-1,-1,-1,-1,-1,-1},
-{1186,1187,-1,-1,-1,-1,-1,-1,-1},
-{1187,1188,-1,-1,-1,-1,-1,-1,-1},
-{1188,1189,-1,-1,-1,-1,-1,-1,-1},
-{1189,1190,-1,-1,-1,-1,-1,-1,-1},
-{1190,1191,-1,-1,-1,-1,-1,-1,-1},
-{1191,1192,-1,-1,-1,-1,-1,-1,-1},
-{1192,1193,-1,-1,-1,-1,-1,-1,-1},
-{1193,1194,-1,-1,-1,-1,-1,-1,-1},
-{1194,1195,-1,-1,-1,-1,-1,-1,-1},
-{1195,1196,-1,-1,-1,-1,-1,-1,-1},
-{1196,1197,-1,-1,-1,-1,-1,-1,-1},
-{1197,1198,-1,-1,-1,-1,-1,-1,-1},
-{1198,1199,-1,-1,-1,-1,-1,-1,-1},
-{1199,1200,-1,-1,-1,-1,-1,-1,-1},
-{1200,1201,-1,-1,-1,-1,-1,-1,-1},
-{1201,1202,-1,-1,-1,-1,-1,-1,-1},
-{1202,1203,-1,-1,-1,-1,-1,-1,-1},
-{1203,1204,-1,-1,-1,-1,-1,-1,-1},
-{1204,1205,-1,-1,-1,-1,-1,-1,-1},
-{1205,1206,-1,-1,-1,-1,-1,-1,-1},
-{1206,1207,-1,-1,-1,-1,-1,-1,-1},
-{1207,1208,-1,-1,-1,-1,-1,-1,-1},
-{1208,1209,-1,-1,-1,-1,-1,-1,-1},
-{1209,1210,-1,-1,-1,-1,-1,-1,-1},
-{1210,1211,-1,-1,-1,-1,-1,-1,-1},
-{1211,1212,-1,-1,-1,-1,-1,-1,-1},
-{1212,1213,-1,-1,-1,-1,-1,-1,-1},
-{1213,1214,-1,-1,-1,-1,-1,-1,-1},
-{1214,1215,-1,-1,-1,-1,-1,-1,-1},
-{1215,1216,-1,-1,-1,-1,-1,-1,-1},
-{1216,1217,-1,-1,-1,-1,-1,-1,-1},
-{1217,1218,-1,-1,-1,-1,-1,-1,-1},
-{1218,1219,-1,-1,-1,-1,-1,-1,-1},
-{1219,1220,-1,-1,-1,-1,-1,-1,-1},
-{1220,1221,-1,-1,-1,-1,-1,-1,-1},
-{1221,1222,-1,-1,-1,-1,-1,-1,-1},
-{1222,1223,-1,-1,-1,-1,-1,-1,-1},
-{1223,1224,-1,-1,-1,-1,-1,-1,-1},
-{1224,1225,-1,-1,-1,-1,-1,-1,-1},
-{1225,1226,-1,-1,-1,-1,-1,-1,-1},
-{1226,1227,-1,-1,-1,-1,-1,-1,-1},
-{1227,1228,-1,-1,-1,-1,-1,-1,-1},
-{1228,1229,-1,-1,-1,-1,-1,-1,-1},
-{1229,1230,-1,-1,-1,-1,-1,-1,-1},
-{1230,1231,-1,-1,-1,-1,-1,-1,-1},
-{1231,1232,-1,-1,-1,-1,-1,-1,-1},
-{1232,1233,-1,-1,-1,-1,-1,-1,-1},
-{1233,1234,-1,-1,-1,-1,-1,-1,-1},
-{1234,1235,-1,-1,-1,-1,-1,-1,-1},
-{1235,1236,-1,-1,-1,-1,-1,-1,-1},
-{1236,1237,-1,-1,-1,-1,-1,-1,-1},
-{1237,1238,-1,-1,-1,-1,-1,-1,-1},
-{1238,1239,-1,-1,-1,-1,-1,-1,-1},
-{1239,1240,-1,-1,-1,-1,-1,-1,-1},
-{1240,1241,-1,-1,-1,-1,-1,-1,-1},
-{1241,1242,-1,-1,-1,-1,-1,-1,-1},
-{1242,1243,-1,-1,-1,-1,-1,-1,-1},
-{1243,1244,-1,-1,-1,-1,-1,-1,-1},
-{1244,1245,-1,-1,-1,-1,-1,-1,-1},
-{1245,1246,-1,-1,-1,-1,-1,-1,-1},
-{1246,1247,-1,-1,-1,-1,-1,-1,-1},
-{1247,1248,-1,-1,-1,-1,-1,-1,-1},
-{1248,1249,-1,-1,-1,-1,-1,-1,-1},
-{1249,1250,-1,-1,-1,-1,-1,-1,-1},
-{1250,1251,-1,-1,-1,-1,-1,-1,-1},
-{1251,1252,-1,-1,-1,-1,-1,-1,-1},
-{1252,1253,-1,-1,-1,-1,-1,-1,-1},
-{1253,1254,-1,-1,-1,-1,-1,-1,-1},
-{1254,1255,-1,-1,-1,-1,-1,-1,-1},
-{1255,1256,-1,-1,-1,-1,-1,-1,-1},
-{1256,1257,-1,-1,-1,-1,-1,-1,-1},
-{1257,1258,-1,-1,-1,-1,-1,-1,-1},
-{1258,1259,-1,-1,-1,-1,-1,-1,-1},
-{1259,1260,-1,-1,-1,-1,-1,-1,-1},
-{1260,1261,-1,-1,-1,-1,-1,-1,-1},
-{1261,1262,-1,-1,-1,-1,-1,-1,-1},
-{1262,1263,-1,-1,-1,-1,-1,-1,-1},
-{1263,1264,-1,-1,-1,-1,-1,-1,-1},
-{1264,1265,-1,-1,-1,-1,-1,-1,-1},
-{1265,1266,-1,-1,-1,-1,-1,-1,-1},
-{1266,1267,-1,-1,-1,-1,-1,-1,-1},
-{1267,1268,-1,-1,-1,-1,-1,-1,-1},
-{1268,1269,-1,-1,-1,-1,-1,-1,-1},
-{1269,1270,-1,-1,-1,-1,-1,-1,-1},
-{1270,1271,-1,-1,-1,-1,-1,-1,-1},
-{1271,1272,-1,-1,-1,-1,-1,-1,-1},
-{1272,1273,-1,-1,-1,-1,-1,-1,-1},
-{1273,1274,-1,-1,-1,-1,-1,-1,-1},
-{1274,1275,-1,-1,-1,-1,-1,-1,-1},
-{1275,1276,-1,-1,-1,-1,-1,-1,-1},
-{1276,1277,-1,-1,-1,-1,-1,-1,-1},
-{1277,1278,-1,-1,-1,-1,-1,-1,-1},
-{1278,1279,-1,-1,-1,-1,-1,-1,-1},
-{1279,1280,-1,-1,-1,-1,-1,-1,-1},
-{1280,1281,-1,-1,-1,-1,-1,-1,-1},
-{1281,1282,-1,-1,-1,-1,-1,-1,-1},
-{1282,1283,-1,-1,-1,-1,-1,-1,-1},
-{1283,1284,-1,-1,-1,-1,-1,-1,-1},
-{1284,1285,-1,-1,-1,-1,-1,-1,-1},
-{1285,1286,-1,-1,-1,-1,-1,-1,-1},
-{1286,1287,-1,-1,-1,-1,-1,-1,-1},
-{1287,1288,-1,-1,-1,-1,-1,-1,-1},
-{1288,1289,-1,-1,-1,-1,-1,-1,-1},
-{1289,1290,-1,-1,-1,-1,-1,-1,-1},
-{1290,1291,-1,-1,-1,-1,-1,-1,-1},
-{1291,1292,-1,-1,-1,-1,-1,-1,-1},
-{1292,1293,-1,-1,-1,-1,-1,-1,-1},
-{1293,1294,-1,-1,-1,-1,-1,-1,-1},
-{1294,1295,-1,-1,-1,-1,-1,-1,-1},
-{1295,1296,-1,-1,-1,-1,-1,-1,-1},
-{1296,1297,-1,-1,-1,-1,-1,-1,-1},
-{1297,1298,-1,-1,-1,-1,-1,-1,-1},
-{1298,1299,-1,-1,-1,-1,-1,-1,-1},
-{1299,1300,-1,-1,-1,-1,-1,-1,-1},
-{1300,1301,-1,-1,-1,-1,-1,-1,-1},
-{1301,1302,-1,-1,-1,-1,-1,-1,-1},
-{1302,1303,-1,-1,-1,-1,-1,-1,-1},
-{1303,1304,-1,-1,-1,-1,-1,-1,-1},
-{1304,1305,-1,-1,-1,-1,-1,-1,-1},
-{1305,1306,-1,-1,-1,-1,-1,-1,-1},
-{1306,1307,-1,-1,-1,-1,-1,-1,-1},
-{1307,1308,-1,-1,-1,-1,-1,-1,-1},
-{1308,1309,-1,-1,-1,-1,-1,-1,-1},
-{1309,1310,-1,-1,-1,-1,-1,-1,-1},
-{1310,1311,-1,-1,-1,-1,-1,-1,-1},
-{1311,1312,-1,-1,-1,-1,-1,-1,-1},
-{1312,1313,-1,-1,-1,-1,-1,-1,-1},
-{1313,1314,-1,-1,-1,-1,-1,-1,-1},
-{1314,1315,-1,-1,-1,-1,-1,-1,-1},
-{1315,1316,-1,-1,-1,-1,-1,-1,-1},
-{1316,1317,-1,-1,-1,-1,-1,-1,-1},
-{1317,1318,-1,-1,-1,-1,-1,-1,-1},
-{1318,1319,-1,-1,-1,-1,-1,-1,-1},
-{1319,1320,-1,-1,-1,-1,-1,-1,-1},
-{1320,1321,-1,-1,-1,-1,-1,-1,-1},
-{1321,1322,-1,-1,-1,-1,-1,-1,-1},
-{1322,1323,-1,-1,-1,-1,-1,-1,-1},
-{1323,1324,-1,-1,-1,-1,-1,-1,-1},
-{1324,1325,-1,-1,-1,-1,-1,-1,-1},
-{1325,1326,-1,-1,-1,-1,-1,-1,-1},
-{1326,1327,-1,-1,-1,-1,-1,-1,-1},
-{1327,1328,-1,-1,-1,-1,-1,-1,-1},
-{1328,1329,-1,-1,-1,-1,-1,-1,-1},
-{1329,1330,-1,-1,-1,-1,-1,-1,-1},
-{1330,1331,-1,-1,-1,-1,-1,-1,-1},
-{1331,1332,-1,-1,-1,-1,-1,-1,-1},
-{1332,1333,-1,-1,-1,-1,-1,-1,-1},
-{1333,1334,-1,-1,-1,-1,-1,-1,-1},
-{1334,1335,-1,-1,-1,-1,-1,-1,-1},
-{1335,1336,-1,-1,-1,-1,-1,-1,-1},
-{1336,1337,-1,-1,-1,-1,-1,-1,-1},
-{1337,1338,-1,-1,-1,-1,-1,-1,-1},
-{1338,1339,-1,-1,-1,-1,-1,-1,-1},
-{1339,1340,-1,-1,-1,-1,-1,-1,-1},
-{1340,1341,-1,-1,-1,-1,-1,-1,-1},
-{1341,1342,-1,-1,-1,-1,-1,-1,-1},
-{1342,1343,-1,-1,-1,-1,-1,-1,-1},
-{1343,1344,-1,-1,-1,-1,-1,-1,-1},
-{1344,1345,-1,-1,-1,-1,-1,-1,-1},
-{1345,1346,-1,-1,-1,-1,-1,-1,-1},
-{1346,1347,-1,-1,-1,-1,-1,-1,-1},
-{1347,1348,-1,-1,-1,-1,-1,-1,-1},
-{1348,1349,-1,-1,-1,-1,-1,-1,-1},
-{1349,1350,-1,-1,-1,-1,-1,-1,-1},
-{1350,1351,-1,-1,-1,-1,-1,-1,-1},
-{1351,1352,-1,-1,-1,-1,-1,-1,-1},
-{1352,1353,-1,-1,-1,-1,-1,-1,-1},
-{1353,1354,-1,-1,-1,-1,-1,-1,-1},
-{1354,1355,-1,-1,-1,-1,-1,-1,-1},
-{1355,1356,-1,-1,-1,-1,-1,-1,-1},
-{1356,1357,-1,-1,-1,-1,-1,-1,-1},
-{1357,1358,-1,-1,-1,-1,-1,-1,-1},
-{1358,1359,-1,-1,-1,-1,-1,-1,-1},
-{1359,1360,-1,-1,-1,-1,-1,-1,-1},
-{1360,1361,-1,-1,-1,-1,-1,-1,-1},
-{1361,1362,-1,-1,-1,-1,-1,-1,-1},
-{1362,1363,-1,-1,-1,-1,-1,-1,-1},
-{1363,1364,-1,-1,-1,-1,-1,-1,-1},
-{1364,1365,-1,-1,-1,-1,-1,-1,-1},
-{1365,1366,-1,-1,-1,-1,-1,-1,-1},
-{1366,1367,-1,-1,-1,-1,-1,-1,-1},
-{1367,1368,-1,-1,-1,-1,-1,-1,-1},
-{1368,1369,-1,-1,-1,-1,-1,-1,-1},
-{1369,1370,-1,-1,-1,-1,-1,-1,-1},
-{1370,1371,-1,-1,-1,-1,-1,-1,-1},
-{1371,1372,-1,-1,-1,-1,-1,-1,-1},
-{1372,1373,-1,-1,-1,-1,-1,-1,-1},
-{1373,1374,-1,-1,-1,-1,-1,-1,-1},
-{1374,1375,-1,-1,-1,-1,-1,-1,-1},
-{1375,1376,-1,-1,-1,-1,-1,-1,-1},
-{1376,1377,-1,-1,-1,-1,-1,-1,-1},
-{1377,1378,-1,-1,-1,-1,-1,-1,-1},
-{1378,1379,-1,-1,-1,-1,-1,-1,-1},
-{1379,1380,-1,-1,-1,-1,-1,-1,-1},
-{1380,1381,-1,-1,-1,-1,-1,-1,-1},
-{1381,1382,-1,-1,-1,-1,-1,-1,-1},
-{1382,1383,-1,-1,-1,-1,-1,-1,-1},
-{1383,1384,-1,-1,-1,-1,-1,-1,-1},
-{1384,1385,-1,-1,-1,-1,-1,-1,-1},
-{1385,1386,-1,-1,-1,-1,-1,-1,-1},
-{1386,1387,-1,-1,-1,-1,-1,-1,-1},
-{1387,1388,-1,-1,-1,-1,-1,-1,-1},
-{1388,1389,-1,-1,-1,-1,-1,-1,-1},
-{1389,1390,-1,-1,-1,-1,-1,-1,-1},
-{1390,1391,-1,-1,-1,-1,-1,-1,-1},
-{1391,1392,-1,-1,-1,-1,-1,-1,-1},
-{1392,1393,-1,-1,-1,-1,-1,-1,-1},
-{1393,1394,-1,-1,-1,-1,-1,-1,-1},
-{1394,1395,-1,-1,-1,-1,-1,-1,-1},
-{1395,1396,-1,-1,-1,-1,-1,-1,-1},
-{1396,1397,-1,-1,-1,-1,-1,-1,-1},
-{1397,1398,-1,-1,-1,-1,-1,-1,-1},
-{1398,1399,-1,-1,-1,-1,-1,-1,-1},
-{1399,-1,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_2_16=12;
+int mercury_normal_QCbase_2_16[92]={
+20,54,3,180,590,971,
+20,54,9,366,395,621,680,709,937,966,1058,1162,
+20,54,3,222,892,1158,
+20,54,9,47,231,247,504,509,660,708,1233,1314,
+20,54,4,236,894,994,1246,
+20,54,6,254,383,424,565,725,1143,
+20,54,3,102,878,1197,
+20,54,4,1208,1245,1252,1334,
+20,54,8,55,261,490,631,716,801,995,1078,
+20,54,4,307,364,641,1358,
+1399,1,2,0,1,
+1,0,1,1399};
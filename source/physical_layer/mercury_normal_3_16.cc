@@ -25,4210 +25,22 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_3_16.h"
-int mercury_normal_Cwidth_3_16=6;
-int mercury_normal_Vwidth_3_16=9;
-int mercury_normal_dwidth_3_16=30;
-int mercury_normal_QCmatrixd_3_16[30]={20,7,20,5,20,7,20,9,20,3,20,9,20,8,20,5,20,8,60,3,20,8,20,9,20,5,1299,2,1,1};
-int mercury_normal_QCmatrixC_3_16[1300][6]={
-{110,300,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1},
-{67,301,302,-1,-1,-1},
-{302,303,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1},
-{49,122,296,304,305,-1},
-{294,305,306,-1,-1,-1},
-{161,306,307,-1,-1,-1},
-{275,307,308,-1,-1,-1},
-{123,308,309,-1,-1,-1},
-{290,309,310,-1,-1,-1},
-{310,311,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1},
-{160,253,260,312,313,-1},
-{4,159,313,314,-1,-1},
-{314,315,-1,-1,-1,-1},
-{113,315,316,-1,-1,-1},
-{116,146,316,317,-1,-1},
-{169,317,318,-1,-1,-1},
-{318,319,-1,-1,-1,-1},
-{244,319,320,-1,-1,-1},
-{30,69,72,320,321,-1},
-{321,322,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1},
-{255,323,324,-1,-1,-1},
-{44,129,266,324,325,-1},
-{175,242,325,326,-1,-1},
-{267,326,327,-1,-1,-1},
-{136,327,328,-1,-1,-1},
-{40,111,328,329,-1,-1},
-{329,330,-1,-1,-1,-1},
-{68,330,331,-1,-1,-1},
-{331,332,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1},
-{50,123,297,333,334,-1},
-{295,334,335,-1,-1,-1},
-{162,335,336,-1,-1,-1},
-{276,336,337,-1,-1,-1},
-{124,337,338,-1,-1,-1},
-{291,338,339,-1,-1,-1},
-{339,340,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1},
-{161,254,261,341,342,-1},
-{5,342,343,-1,-1,-1},
-{343,344,-1,-1,-1,-1},
-{114,344,345,-1,-1,-1},
-{117,147,345,346,-1,-1},
-{0,170,346,347,-1,-1},
-{347,348,-1,-1,-1,-1},
-{245,348,349,-1,-1,-1},
-{31,70,73,349,350,-1},
-{350,351,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1},
-{256,352,353,-1,-1,-1},
-{45,130,267,353,354,-1},
-{176,243,354,355,-1,-1},
-{268,355,356,-1,-1,-1},
-{137,356,357,-1,-1,-1},
-{41,112,357,358,-1,-1},
-{358,359,-1,-1,-1,-1},
-{69,359,360,-1,-1,-1},
-{360,361,-1,-1,-1,-1},
-{80,361,362,-1,-1,-1},
-{51,124,260,298,362,363},
-{296,363,364,-1,-1,-1},
-{160,163,364,365,-1,-1},
-{277,365,366,-1,-1,-1},
-{125,366,367,-1,-1,-1},
-{292,367,368,-1,-1,-1},
-{100,368,369,-1,-1,-1},
-{369,370,-1,-1,-1,-1},
-{162,255,262,370,371,-1},
-{6,371,372,-1,-1,-1},
-{372,373,-1,-1,-1,-1},
-{115,373,374,-1,-1,-1},
-{118,148,374,375,-1,-1},
-{1,171,375,376,-1,-1},
-{376,377,-1,-1,-1,-1},
-{246,377,378,-1,-1,-1},
-{32,71,74,378,379,-1},
-{379,380,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1},
-{257,381,382,-1,-1,-1},
-{46,131,268,382,383,-1},
-{177,244,383,384,-1,-1},
-{269,384,385,-1,-1,-1},
-{138,240,385,386,-1,-1},
-{42,113,386,387,-1,-1},
-{387,388,-1,-1,-1,-1},
-{70,388,389,-1,-1,-1},
-{389,390,-1,-1,-1,-1},
-{81,390,391,-1,-1,-1},
-{52,125,261,299,391,392},
-{297,392,393,-1,-1,-1},
-{161,164,393,394,-1,-1},
-{278,394,395,-1,-1,-1},
-{126,395,396,-1,-1,-1},
-{293,396,397,-1,-1,-1},
-{101,397,398,-1,-1,-1},
-{398,399,-1,-1,-1,-1},
-{163,256,263,399,400,-1},
-{7,60,400,401,-1,-1},
-{401,402,-1,-1,-1,-1},
-{116,402,403,-1,-1,-1},
-{119,149,403,404,-1,-1},
-{2,172,404,405,-1,-1},
-{405,406,-1,-1,-1,-1},
-{247,406,407,-1,-1,-1},
-{33,72,75,407,408,-1},
-{408,409,-1,-1,-1,-1},
-{200,409,410,-1,-1,-1},
-{258,410,411,-1,-1,-1},
-{47,132,269,411,412,-1},
-{178,245,412,413,-1,-1},
-{270,413,414,-1,-1,-1},
-{139,241,414,415,-1,-1},
-{43,114,415,416,-1,-1},
-{416,417,-1,-1,-1,-1},
-{71,417,418,-1,-1,-1},
-{418,419,-1,-1,-1,-1},
-{82,100,419,420,-1,-1},
-{53,126,262,420,421,-1},
-{298,421,422,-1,-1,-1},
-{162,165,422,423,-1,-1},
-{279,423,424,-1,-1,-1},
-{127,424,425,-1,-1,-1},
-{294,425,426,-1,-1,-1},
-{102,426,427,-1,-1,-1},
-{427,428,-1,-1,-1,-1},
-{164,257,264,428,429,-1},
-{8,61,429,430,-1,-1},
-{430,431,-1,-1,-1,-1},
-{117,240,431,432,-1,-1},
-{150,432,433,-1,-1,-1},
-{3,173,433,434,-1,-1},
-{434,435,-1,-1,-1,-1},
-{248,435,436,-1,-1,-1},
-{34,73,76,436,437,-1},
-{437,438,-1,-1,-1,-1},
-{201,438,439,-1,-1,-1},
-{259,439,440,-1,-1,-1},
-{48,133,270,440,441,-1},
-{179,246,441,442,-1,-1},
-{271,442,443,-1,-1,-1},
-{242,443,444,-1,-1,-1},
-{44,115,160,444,445,-1},
-{445,446,-1,-1,-1,-1},
-{72,446,447,-1,-1,-1},
-{447,448,-1,-1,-1,-1},
-{83,101,448,449,-1,-1},
-{54,127,263,449,450,-1},
-{299,450,451,-1,-1,-1},
-{163,166,451,452,-1,-1},
-{452,453,-1,-1,-1,-1},
-{128,453,454,-1,-1,-1},
-{295,454,455,-1,-1,-1},
-{103,455,456,-1,-1,-1},
-{456,457,-1,-1,-1,-1},
-{165,258,265,457,458,-1},
-{9,62,458,459,-1,-1},
-{459,460,-1,-1,-1,-1},
-{118,241,460,461,-1,-1},
-{151,461,462,-1,-1,-1},
-{4,174,462,463,-1,-1},
-{463,464,-1,-1,-1,-1},
-{249,464,465,-1,-1,-1},
-{35,74,77,465,466,-1},
-{466,467,-1,-1,-1,-1},
-{202,467,468,-1,-1,-1},
-{468,469,-1,-1,-1,-1},
-{49,134,271,469,470,-1},
-{247,470,471,-1,-1,-1},
-{272,471,472,-1,-1,-1},
-{243,472,473,-1,-1,-1},
-{45,116,161,200,473,474},
-{220,474,475,-1,-1,-1},
-{73,475,476,-1,-1,-1},
-{476,477,-1,-1,-1,-1},
-{84,102,477,478,-1,-1},
-{55,128,264,478,479,-1},
-{479,480,-1,-1,-1,-1},
-{60,164,167,480,481,-1},
-{481,482,-1,-1,-1,-1},
-{129,482,483,-1,-1,-1},
-{296,483,484,-1,-1,-1},
-{104,484,485,-1,-1,-1},
-{485,486,-1,-1,-1,-1},
-{166,259,266,486,487,-1},
-{10,63,487,488,-1,-1},
-{488,489,-1,-1,-1,-1},
-{119,242,489,490,-1,-1},
-{152,490,491,-1,-1,-1},
-{5,175,491,492,-1,-1},
-{492,493,-1,-1,-1,-1},
-{250,493,494,-1,-1,-1},
-{36,75,78,494,495,-1},
-{495,496,-1,-1,-1,-1},
-{203,496,497,-1,-1,-1},
-{497,498,-1,-1,-1,-1},
-{50,135,272,498,499,-1},
-{248,499,500,-1,-1,-1},
-{273,500,501,-1,-1,-1},
-{244,501,502,-1,-1,-1},
-{46,117,162,201,502,503},
-{221,503,504,-1,-1,-1},
-{74,504,505,-1,-1,-1},
-{505,506,-1,-1,-1,-1},
-{85,103,506,507,-1,-1},
-{56,129,265,507,508,-1},
-{508,509,-1,-1,-1,-1},
-{61,165,168,509,510,-1},
-{510,511,-1,-1,-1,-1},
-{130,511,512,-1,-1,-1},
-{297,512,513,-1,-1,-1},
-{105,513,514,-1,-1,-1},
-{514,515,-1,-1,-1,-1},
-{167,267,515,516,-1,-1},
-{11,64,516,517,-1,-1},
-{517,518,-1,-1,-1,-1},
-{60,243,518,519,-1,-1},
-{153,519,520,-1,-1,-1},
-{6,176,520,521,-1,-1},
-{100,521,522,-1,-1,-1},
-{251,522,523,-1,-1,-1},
-{37,76,79,523,524,-1},
-{524,525,-1,-1,-1,-1},
-{204,525,526,-1,-1,-1},
-{180,526,527,-1,-1,-1},
-{51,136,273,527,528,-1},
-{249,528,529,-1,-1,-1},
-{274,529,530,-1,-1,-1},
-{240,245,530,531,-1,-1},
-{47,118,163,202,531,532},
-{222,532,533,-1,-1,-1},
-{75,533,534,-1,-1,-1},
-{534,535,-1,-1,-1,-1},
-{86,104,535,536,-1,-1},
-{57,130,266,536,537,-1},
-{537,538,-1,-1,-1,-1},
-{62,166,169,538,539,-1},
-{539,540,-1,-1,-1,-1},
-{131,540,541,-1,-1,-1},
-{298,541,542,-1,-1,-1},
-{60,106,542,543,-1,-1},
-{543,544,-1,-1,-1,-1},
-{168,268,544,545,-1,-1},
-{12,65,545,546,-1,-1},
-{546,547,-1,-1,-1,-1},
-{61,244,547,548,-1,-1},
-{154,548,549,-1,-1,-1},
-{7,177,549,550,-1,-1},
-{101,550,551,-1,-1,-1},
-{252,551,552,-1,-1,-1},
-{38,77,552,553,-1,-1},
-{553,554,-1,-1,-1,-1},
-{205,554,555,-1,-1,-1},
-{181,555,556,-1,-1,-1},
-{52,137,274,556,557,-1},
-{250,557,558,-1,-1,-1},
-{275,558,559,-1,-1,-1},
-{241,246,559,560,-1,-1},
-{48,119,164,203,560,561},
-{223,561,562,-1,-1,-1},
-{76,562,563,-1,-1,-1},
-{563,564,-1,-1,-1,-1},
-{87,105,564,565,-1,-1},
-{58,131,267,565,566,-1},
-{566,567,-1,-1,-1,-1},
-{63,167,170,567,568,-1},
-{568,569,-1,-1,-1,-1},
-{132,260,569,570,-1,-1},
-{299,570,571,-1,-1,-1},
-{61,107,571,572,-1,-1},
-{572,573,-1,-1,-1,-1},
-{169,269,573,574,-1,-1},
-{13,66,574,575,-1,-1},
-{575,576,-1,-1,-1,-1},
-{62,245,576,577,-1,-1},
-{155,577,578,-1,-1,-1},
-{8,178,578,579,-1,-1},
-{102,579,580,-1,-1,-1},
-{253,580,581,-1,-1,-1},
-{39,78,581,582,-1,-1},
-{582,583,-1,-1,-1,-1},
-{206,583,584,-1,-1,-1},
-{182,584,585,-1,-1,-1},
-{53,138,275,585,586,-1},
-{251,586,587,-1,-1,-1},
-{276,587,588,-1,-1,-1},
-{242,247,588,589,-1,-1},
-{49,165,204,589,590,-1},
-{224,590,591,-1,-1,-1},
-{77,591,592,-1,-1,-1},
-{220,592,593,-1,-1,-1},
-{88,106,593,594,-1,-1},
-{59,132,268,594,595,-1},
-{80,595,596,-1,-1,-1},
-{64,168,171,596,597,-1},
-{597,598,-1,-1,-1,-1},
-{133,261,598,599,-1,-1},
-{599,600,-1,-1,-1,-1},
-{62,108,600,601,-1,-1},
-{601,602,-1,-1,-1,-1},
-{170,270,602,603,-1,-1},
-{14,67,603,604,-1,-1},
-{604,605,-1,-1,-1,-1},
-{60,63,246,605,606,-1},
-{156,606,607,-1,-1,-1},
-{9,179,607,608,-1,-1},
-{103,608,609,-1,-1,-1},
-{254,609,610,-1,-1,-1},
-{79,610,611,-1,-1,-1},
-{611,612,-1,-1,-1,-1},
-{207,612,613,-1,-1,-1},
-{183,613,614,-1,-1,-1},
-{54,139,276,614,615,-1},
-{20,252,615,616,-1,-1},
-{277,616,617,-1,-1,-1},
-{243,248,617,618,-1,-1},
-{50,166,205,618,619,-1},
-{225,619,620,-1,-1,-1},
-{78,620,621,-1,-1,-1},
-{221,621,622,-1,-1,-1},
-{89,107,260,622,623,-1},
-{133,269,623,624,-1,-1},
-{81,624,625,-1,-1,-1},
-{65,169,172,625,626,-1},
-{100,626,627,-1,-1,-1},
-{134,262,627,628,-1,-1},
-{628,629,-1,-1,-1,-1},
-{63,109,629,630,-1,-1},
-{180,280,630,631,-1,-1},
-{171,271,631,632,-1,-1},
-{15,68,632,633,-1,-1},
-{633,634,-1,-1,-1,-1},
-{61,64,247,634,635,-1},
-{157,635,636,-1,-1,-1},
-{10,636,637,-1,-1,-1},
-{104,637,638,-1,-1,-1},
-{255,638,639,-1,-1,-1},
-{240,639,640,-1,-1,-1},
-{640,641,-1,-1,-1,-1},
-{208,641,642,-1,-1,-1},
-{184,642,643,-1,-1,-1},
-{55,277,643,644,-1,-1},
-{21,253,644,645,-1,-1},
-{278,645,646,-1,-1,-1},
-{244,249,646,647,-1,-1},
-{51,167,206,647,648,-1},
-{226,648,649,-1,-1,-1},
-{79,649,650,-1,-1,-1},
-{222,650,651,-1,-1,-1},
-{90,108,261,651,652,-1},
-{134,270,652,653,-1,-1},
-{82,653,654,-1,-1,-1},
-{66,170,173,654,655,-1},
-{101,655,656,-1,-1,-1},
-{40,135,263,656,657,-1},
-{657,658,-1,-1,-1,-1},
-{64,110,658,659,-1,-1},
-{181,281,659,660,-1,-1},
-{172,272,660,661,-1,-1},
-{16,69,661,662,-1,-1},
-{662,663,-1,-1,-1,-1},
-{62,65,248,663,664,-1},
-{158,664,665,-1,-1,-1},
-{11,665,666,-1,-1,-1},
-{105,666,667,-1,-1,-1},
-{256,667,668,-1,-1,-1},
-{241,668,669,-1,-1,-1},
-{669,670,-1,-1,-1,-1},
-{209,670,671,-1,-1,-1},
-{185,671,672,-1,-1,-1},
-{56,278,672,673,-1,-1},
-{22,254,673,674,-1,-1},
-{279,674,675,-1,-1,-1},
-{245,250,675,676,-1,-1},
-{52,168,207,676,677,-1},
-{227,677,678,-1,-1,-1},
-{678,679,-1,-1,-1,-1},
-{223,679,680,-1,-1,-1},
-{91,109,262,680,681,-1},
-{135,271,681,682,-1,-1},
-{83,682,683,-1,-1,-1},
-{67,171,174,683,684,-1},
-{102,684,685,-1,-1,-1},
-{41,136,264,685,686,-1},
-{686,687,-1,-1,-1,-1},
-{65,111,140,687,688,-1},
-{182,282,688,689,-1,-1},
-{173,273,689,690,-1,-1},
-{17,70,690,691,-1,-1},
-{691,692,-1,-1,-1,-1},
-{63,66,249,692,693,-1},
-{159,693,694,-1,-1,-1},
-{12,694,695,-1,-1,-1},
-{106,695,696,-1,-1,-1},
-{257,696,697,-1,-1,-1},
-{242,697,698,-1,-1,-1},
-{698,699,-1,-1,-1,-1},
-{210,699,700,-1,-1,-1},
-{186,700,701,-1,-1,-1},
-{0,57,279,701,702,-1},
-{23,255,702,703,-1,-1},
-{703,704,-1,-1,-1,-1},
-{246,251,704,705,-1,-1},
-{53,169,208,705,706,-1},
-{228,706,707,-1,-1,-1},
-{707,708,-1,-1,-1,-1},
-{200,224,708,709,-1,-1},
-{92,110,263,709,710,-1},
-{136,260,272,710,711,-1},
-{84,711,712,-1,-1,-1},
-{68,172,175,712,713,-1},
-{40,103,713,714,-1,-1},
-{42,137,265,714,715,-1},
-{715,716,-1,-1,-1,-1},
-{66,112,141,716,717,-1},
-{183,283,717,718,-1,-1},
-{174,274,718,719,-1,-1},
-{18,71,719,720,-1,-1},
-{720,721,-1,-1,-1,-1},
-{64,67,250,721,722,-1},
-{722,723,-1,-1,-1,-1},
-{13,723,724,-1,-1,-1},
-{107,724,725,-1,-1,-1},
-{258,725,726,-1,-1,-1},
-{243,726,727,-1,-1,-1},
-{727,728,-1,-1,-1,-1},
-{211,728,729,-1,-1,-1},
-{187,729,730,-1,-1,-1},
-{1,58,730,731,-1,-1},
-{24,256,731,732,-1,-1},
-{732,733,-1,-1,-1,-1},
-{247,252,733,734,-1,-1},
-{54,170,209,734,735,-1},
-{229,735,736,-1,-1,-1},
-{736,737,-1,-1,-1,-1},
-{201,225,737,738,-1,-1},
-{93,111,264,738,739,-1},
-{137,261,273,739,740,-1},
-{85,740,741,-1,-1,-1},
-{69,173,176,741,742,-1},
-{41,104,742,743,-1,-1},
-{43,138,266,743,744,-1},
-{0,744,745,-1,-1,-1},
-{67,113,142,745,746,-1},
-{184,284,746,747,-1,-1},
-{175,275,747,748,-1,-1},
-{19,72,748,749,-1,-1},
-{749,750,-1,-1,-1,-1},
-{65,68,251,750,751,-1},
-{751,752,-1,-1,-1,-1},
-{14,752,753,-1,-1,-1},
-{108,753,754,-1,-1,-1},
-{259,754,755,-1,-1,-1},
-{244,755,756,-1,-1,-1},
-{756,757,-1,-1,-1,-1},
-{212,757,758,-1,-1,-1},
-{188,758,759,-1,-1,-1},
-{2,59,759,760,-1,-1},
-{25,257,760,761,-1,-1},
-{761,762,-1,-1,-1,-1},
-{248,253,762,763,-1,-1},
-{55,171,210,763,764,-1},
-{230,764,765,-1,-1,-1},
-{765,766,-1,-1,-1,-1},
-{0,202,226,766,767,-1},
-{94,112,265,767,768,-1},
-{138,262,274,768,769,-1},
-{86,769,770,-1,-1,-1},
-{70,174,177,770,771,-1},
-{42,105,771,772,-1,-1},
-{44,139,267,772,773,-1},
-{1,773,774,-1,-1,-1},
-{68,114,143,180,774,775},
-{185,285,775,776,-1,-1},
-{176,276,776,777,-1,-1},
-{73,777,778,-1,-1,-1},
-{778,779,-1,-1,-1,-1},
-{66,69,252,779,780,-1},
-{780,781,-1,-1,-1,-1},
-{15,781,782,-1,-1,-1},
-{109,782,783,-1,-1,-1},
-{783,784,-1,-1,-1,-1},
-{245,784,785,-1,-1,-1},
-{785,786,-1,-1,-1,-1},
-{213,786,787,-1,-1,-1},
-{189,787,788,-1,-1,-1},
-{3,788,789,-1,-1,-1},
-{20,26,258,789,790,-1},
-{790,791,-1,-1,-1,-1},
-{120,249,254,791,792,-1},
-{56,172,211,792,793,-1},
-{231,793,794,-1,-1,-1},
-{20,794,795,-1,-1,-1},
-{1,203,227,795,796,-1},
-{95,113,266,796,797,-1},
-{60,139,263,275,797,798},
-{87,798,799,-1,-1,-1},
-{71,175,178,799,800,-1},
-{43,106,800,801,-1,-1},
-{45,268,801,802,-1,-1},
-{0,2,802,803,-1,-1},
-{69,115,144,181,803,804},
-{186,286,804,805,-1,-1},
-{177,277,805,806,-1,-1},
-{74,806,807,-1,-1,-1},
-{100,807,808,-1,-1,-1},
-{67,70,253,808,809,-1},
-{809,810,-1,-1,-1,-1},
-{16,810,811,-1,-1,-1},
-{110,811,812,-1,-1,-1},
-{812,813,-1,-1,-1,-1},
-{246,813,814,-1,-1,-1},
-{814,815,-1,-1,-1,-1},
-{214,815,816,-1,-1,-1},
-{190,816,817,-1,-1,-1},
-{4,817,818,-1,-1,-1},
-{21,27,259,818,819,-1},
-{819,820,-1,-1,-1,-1},
-{121,250,255,820,821,-1},
-{57,173,212,821,822,-1},
-{232,822,823,-1,-1,-1},
-{21,280,823,824,-1,-1},
-{2,204,228,824,825,-1},
-{96,114,267,825,826,-1},
-{61,264,276,826,827,-1},
-{88,827,828,-1,-1,-1},
-{72,176,179,828,829,-1},
-{44,107,829,830,-1,-1},
-{46,269,830,831,-1,-1},
-{1,3,831,832,-1,-1},
-{70,116,145,182,832,833},
-{120,187,287,833,834,-1},
-{0,178,278,834,835,-1},
-{75,835,836,-1,-1,-1},
-{101,836,837,-1,-1,-1},
-{68,71,254,837,838,-1},
-{838,839,-1,-1,-1,-1},
-{17,839,840,-1,-1,-1},
-{111,840,841,-1,-1,-1},
-{841,842,-1,-1,-1,-1},
-{160,247,842,843,-1,-1},
-{843,844,-1,-1,-1,-1},
-{215,844,845,-1,-1,-1},
-{191,845,846,-1,-1,-1},
-{5,846,847,-1,-1,-1},
-{22,28,847,848,-1,-1},
-{848,849,-1,-1,-1,-1},
-{122,251,256,849,850,-1},
-{58,174,213,850,851,-1},
-{233,851,852,-1,-1,-1},
-{22,281,852,853,-1,-1},
-{3,205,229,853,854,-1},
-{97,115,268,854,855,-1},
-{62,265,277,855,856,-1},
-{89,856,857,-1,-1,-1},
-{73,177,857,858,-1,-1},
-{45,108,858,859,-1,-1},
-{47,260,270,859,860,-1},
-{2,4,860,861,-1,-1},
-{71,117,146,183,861,862},
-{121,188,288,862,863,-1},
-{1,179,279,863,864,-1},
-{76,864,865,-1,-1,-1},
-{102,865,866,-1,-1,-1},
-{69,72,255,866,867,-1},
-{867,868,-1,-1,-1,-1},
-{18,868,869,-1,-1,-1},
-{112,869,870,-1,-1,-1},
-{870,871,-1,-1,-1,-1},
-{161,248,871,872,-1,-1},
-{872,873,-1,-1,-1,-1},
-{216,873,874,-1,-1,-1},
-{192,874,875,-1,-1,-1},
-{6,875,876,-1,-1,-1},
-{23,29,876,877,-1,-1},
-{877,878,-1,-1,-1,-1},
-{123,252,257,878,879,-1},
-{59,175,214,879,880,-1},
-{234,880,881,-1,-1,-1},
-{23,282,881,882,-1,-1},
-{4,206,230,882,883,-1},
-{98,116,269,883,884,-1},
-{63,266,278,884,885,-1},
-{90,220,885,886,-1,-1},
-{74,178,886,887,-1,-1},
-{46,109,887,888,-1,-1},
-{48,261,271,888,889,-1},
-{3,5,889,890,-1,-1},
-{72,118,147,184,890,891},
-{122,189,289,891,892,-1},
-{2,892,893,-1,-1,-1},
-{77,893,894,-1,-1,-1},
-{103,894,895,-1,-1,-1},
-{70,73,256,895,896,-1},
-{896,897,-1,-1,-1,-1},
-{19,897,898,-1,-1,-1},
-{113,898,899,-1,-1,-1},
-{899,900,-1,-1,-1,-1},
-{40,162,249,900,901,-1},
-{901,902,-1,-1,-1,-1},
-{217,902,903,-1,-1,-1},
-{193,903,904,-1,-1,-1},
-{7,904,905,-1,-1,-1},
-{24,30,905,906,-1,-1},
-{906,907,-1,-1,-1,-1},
-{124,253,258,907,908,-1},
-{176,215,908,909,-1,-1},
-{235,909,910,-1,-1,-1},
-{24,283,910,911,-1,-1},
-{5,207,231,911,912,-1},
-{99,117,270,912,913,-1},
-{64,267,279,913,914,-1},
-{91,221,914,915,-1,-1},
-{75,179,915,916,-1,-1},
-{47,110,916,917,-1,-1},
-{49,262,272,917,918,-1},
-{4,6,918,919,-1,-1},
-{73,119,148,185,919,920},
-{123,190,290,920,921,-1},
-{3,921,922,-1,-1,-1},
-{78,922,923,-1,-1,-1},
-{104,923,924,-1,-1,-1},
-{71,74,257,924,925,-1},
-{925,926,-1,-1,-1,-1},
-{926,927,-1,-1,-1,-1},
-{80,114,927,928,-1,-1},
-{928,929,-1,-1,-1,-1},
-{41,163,250,929,930,-1},
-{930,931,-1,-1,-1,-1},
-{218,931,932,-1,-1,-1},
-{194,932,933,-1,-1,-1},
-{8,933,934,-1,-1,-1},
-{25,31,934,935,-1,-1},
-{935,936,-1,-1,-1,-1},
-{125,254,259,936,937,-1},
-{177,216,937,938,-1,-1},
-{236,938,939,-1,-1,-1},
-{25,284,939,940,-1,-1},
-{6,208,232,940,941,-1},
-{118,271,941,942,-1,-1},
-{65,268,942,943,-1,-1},
-{92,222,943,944,-1,-1},
-{76,140,944,945,-1,-1},
-{48,111,945,946,-1,-1},
-{50,263,273,946,947,-1},
-{5,7,947,948,-1,-1},
-{74,149,186,948,949,-1},
-{124,191,291,949,950,-1},
-{4,950,951,-1,-1,-1},
-{79,951,952,-1,-1,-1},
-{105,952,953,-1,-1,-1},
-{72,75,258,953,954,-1},
-{954,955,-1,-1,-1,-1},
-{955,956,-1,-1,-1,-1},
-{81,115,956,957,-1,-1},
-{957,958,-1,-1,-1,-1},
-{42,164,251,958,959,-1},
-{959,960,-1,-1,-1,-1},
-{219,960,961,-1,-1,-1},
-{120,195,961,962,-1,-1},
-{9,962,963,-1,-1,-1},
-{26,32,963,964,-1,-1},
-{964,965,-1,-1,-1,-1},
-{126,255,965,966,-1,-1},
-{178,217,966,967,-1,-1},
-{237,967,968,-1,-1,-1},
-{26,285,968,969,-1,-1},
-{7,209,233,969,970,-1},
-{119,272,970,971,-1,-1},
-{66,269,971,972,-1,-1},
-{93,223,972,973,-1,-1},
-{77,141,973,974,-1,-1},
-{49,112,974,975,-1,-1},
-{51,264,274,975,976,-1},
-{6,8,976,977,-1,-1},
-{75,150,187,977,978,-1},
-{125,192,292,978,979,-1},
-{5,979,980,-1,-1,-1},
-{980,981,-1,-1,-1,-1},
-{20,106,981,982,-1,-1},
-{73,76,259,982,983,-1},
-{983,984,-1,-1,-1,-1},
-{984,985,-1,-1,-1,-1},
-{82,116,985,986,-1,-1},
-{986,987,-1,-1,-1,-1},
-{43,165,252,987,988,-1},
-{988,989,-1,-1,-1,-1},
-{989,990,-1,-1,-1,-1},
-{121,196,990,991,-1,-1},
-{10,991,992,-1,-1,-1},
-{27,33,992,993,-1,-1},
-{993,994,-1,-1,-1,-1},
-{127,160,256,994,995,-1},
-{179,218,995,996,-1,-1},
-{238,996,997,-1,-1,-1},
-{27,286,997,998,-1,-1},
-{8,210,234,998,999,-1},
-{273,999,1000,-1,-1,-1},
-{67,270,1000,1001,-1,-1},
-{94,100,224,1001,1002,-1},
-{78,142,1002,1003,-1,-1},
-{50,113,1003,1004,-1,-1},
-{52,265,275,1004,1005,-1},
-{7,9,1005,1006,-1,-1},
-{76,151,188,1006,1007,-1},
-{126,193,293,1007,1008,-1},
-{6,1008,1009,-1,-1,-1},
-{40,1009,1010,-1,-1,-1},
-{21,107,1010,1011,-1,-1},
-{74,77,1011,1012,-1,-1},
-{1012,1013,-1,-1,-1,-1},
-{140,1013,1014,-1,-1,-1},
-{83,117,1014,1015,-1,-1},
-{1015,1016,-1,-1,-1,-1},
-{44,166,253,1016,1017,-1},
-{1017,1018,-1,-1,-1,-1},
-{1018,1019,-1,-1,-1,-1},
-{122,197,1019,1020,-1,-1},
-{11,1020,1021,-1,-1,-1},
-{28,34,1021,1022,-1,-1},
-{1022,1023,-1,-1,-1,-1},
-{128,161,257,1023,1024,-1},
-{219,1024,1025,-1,-1,-1},
-{239,1025,1026,-1,-1,-1},
-{28,287,1026,1027,-1,-1},
-{9,211,235,1027,1028,-1},
-{274,1028,1029,-1,-1,-1},
-{68,120,271,1029,1030,-1},
-{95,101,225,1030,1031,-1},
-{79,143,1031,1032,-1,-1},
-{51,114,1032,1033,-1,-1},
-{53,266,276,1033,1034,-1},
-{8,10,1034,1035,-1,-1},
-{77,152,189,1035,1036,-1},
-{127,194,294,1036,1037,-1},
-{7,1037,1038,-1,-1,-1},
-{41,1038,1039,-1,-1,-1},
-{22,108,1039,1040,-1,-1},
-{75,78,1040,1041,-1,-1},
-{1041,1042,-1,-1,-1,-1},
-{141,1042,1043,-1,-1,-1},
-{84,118,1043,1044,-1,-1},
-{1044,1045,-1,-1,-1,-1},
-{45,167,254,1045,1046,-1},
-{1046,1047,-1,-1,-1,-1},
-{1047,1048,-1,-1,-1,-1},
-{123,198,1048,1049,-1,-1},
-{12,1049,1050,-1,-1,-1},
-{29,35,1050,1051,-1,-1},
-{1051,1052,-1,-1,-1,-1},
-{129,162,258,1052,1053,-1},
-{1053,1054,-1,-1,-1,-1},
-{1054,1055,-1,-1,-1,-1},
-{29,288,1055,1056,-1,-1},
-{10,212,236,1056,1057,-1},
-{275,1057,1058,-1,-1,-1},
-{69,121,272,1058,1059,-1},
-{96,102,226,1059,1060,-1},
-{144,1060,1061,-1,-1,-1},
-{52,115,1061,1062,-1,-1},
-{54,140,267,277,1062,1063},
-{9,11,1063,1064,-1,-1},
-{78,153,190,1064,1065,-1},
-{128,195,295,1065,1066,-1},
-{8,1066,1067,-1,-1,-1},
-{42,1067,1068,-1,-1,-1},
-{23,109,1068,1069,-1,-1},
-{76,79,1069,1070,-1,-1},
-{1070,1071,-1,-1,-1,-1},
-{142,1071,1072,-1,-1,-1},
-{85,119,1072,1073,-1,-1},
-{1073,1074,-1,-1,-1,-1},
-{46,168,255,1074,1075,-1},
-{1075,1076,-1,-1,-1,-1},
-{1076,1077,-1,-1,-1,-1},
-{124,199,1077,1078,-1,-1},
-{13,1078,1079,-1,-1,-1},
-{30,36,1079,1080,-1,-1},
-{1080,1081,-1,-1,-1,-1},
-{130,163,259,1081,1082,-1},
-{1082,1083,-1,-1,-1,-1},
-{1083,1084,-1,-1,-1,-1},
-{30,289,1084,1085,-1,-1},
-{11,213,237,1085,1086,-1},
-{276,1086,1087,-1,-1,-1},
-{70,122,273,1087,1088,-1},
-{97,103,227,1088,1089,-1},
-{145,1089,1090,-1,-1,-1},
-{53,116,1090,1091,-1,-1},
-{55,141,268,278,1091,1092},
-{10,12,1092,1093,-1,-1},
-{79,154,191,1093,1094,-1},
-{129,196,296,1094,1095,-1},
-{9,1095,1096,-1,-1,-1},
-{43,1096,1097,-1,-1,-1},
-{24,110,1097,1098,-1,-1},
-{77,1098,1099,-1,-1,-1},
-{1099,1100,-1,-1,-1,-1},
-{143,1100,1101,-1,-1,-1},
-{86,1101,1102,-1,-1,-1},
-{1102,1103,-1,-1,-1,-1},
-{47,169,256,1103,1104,-1},
-{1104,1105,-1,-1,-1,-1},
-{1105,1106,-1,-1,-1,-1},
-{125,1106,1107,-1,-1,-1},
-{14,1107,1108,-1,-1,-1},
-{31,37,1108,1109,-1,-1},
-{1109,1110,-1,-1,-1,-1},
-{131,164,1110,1111,-1,-1},
-{1111,1112,-1,-1,-1,-1},
-{1112,1113,-1,-1,-1,-1},
-{31,290,1113,1114,-1,-1},
-{12,214,238,1114,1115,-1},
-{277,1115,1116,-1,-1,-1},
-{71,123,274,1116,1117,-1},
-{98,104,228,1117,1118,-1},
-{146,1118,1119,-1,-1,-1},
-{54,117,1119,1120,-1,-1},
-{56,142,269,279,1120,1121},
-{11,13,1121,1122,-1,-1},
-{155,192,1122,1123,-1,-1},
-{130,197,297,1123,1124,-1},
-{10,1124,1125,-1,-1,-1},
-{44,1125,1126,-1,-1,-1},
-{25,111,1126,1127,-1,-1},
-{78,1127,1128,-1,-1,-1},
-{1128,1129,-1,-1,-1,-1},
-{144,1129,1130,-1,-1,-1},
-{87,1130,1131,-1,-1,-1},
-{1131,1132,-1,-1,-1,-1},
-{48,170,257,1132,1133,-1},
-{1133,1134,-1,-1,-1,-1},
-{1134,1135,-1,-1,-1,-1},
-{126,1135,1136,-1,-1,-1},
-{15,1136,1137,-1,-1,-1},
-{32,38,1137,1138,-1,-1},
-{1138,1139,-1,-1,-1,-1},
-{132,165,1139,1140,-1,-1},
-{280,1140,1141,-1,-1,-1},
-{1141,1142,-1,-1,-1,-1},
-{32,291,1142,1143,-1,-1},
-{13,215,239,1143,1144,-1},
-{278,1144,1145,-1,-1,-1},
-{72,124,275,1145,1146,-1},
-{99,105,229,1146,1147,-1},
-{147,1147,1148,-1,-1,-1},
-{55,118,1148,1149,-1,-1},
-{57,143,270,1149,1150,-1},
-{12,14,1150,1151,-1,-1},
-{156,193,1151,1152,-1,-1},
-{100,131,198,298,1152,1153},
-{11,1153,1154,-1,-1,-1},
-{45,1154,1155,-1,-1,-1},
-{26,112,1155,1156,-1,-1},
-{79,1156,1157,-1,-1,-1},
-{1157,1158,-1,-1,-1,-1},
-{145,1158,1159,-1,-1,-1},
-{88,1159,1160,-1,-1,-1},
-{1160,1161,-1,-1,-1,-1},
-{49,171,258,1161,1162,-1},
-{1162,1163,-1,-1,-1,-1},
-{120,1163,1164,-1,-1,-1},
-{127,1164,1165,-1,-1,-1},
-{16,1165,1166,-1,-1,-1},
-{33,39,1166,1167,-1,-1},
-{1167,1168,-1,-1,-1,-1},
-{133,166,1168,1169,-1,-1},
-{281,1169,1170,-1,-1,-1},
-{1170,1171,-1,-1,-1,-1},
-{33,292,1171,1172,-1,-1},
-{14,216,260,1172,1173,-1},
-{279,1173,1174,-1,-1,-1},
-{73,125,276,1174,1175,-1},
-{106,230,1175,1176,-1,-1},
-{148,1176,1177,-1,-1,-1},
-{56,119,1177,1178,-1,-1},
-{58,144,271,1178,1179,-1},
-{13,15,1179,1180,-1,-1},
-{157,194,1180,1181,-1,-1},
-{101,132,199,299,1181,1182},
-{12,1182,1183,-1,-1,-1},
-{46,1183,1184,-1,-1,-1},
-{27,113,1184,1185,-1,-1},
-{1185,1186,-1,-1,-1,-1},
-{1186,1187,-1,-1,-1,-1},
-{146,1187,1188,-1,-1,-1},
-{89,240,1188,1189,-1,-1},
-{1189,1190,-1,-1,-1,-1},
-{50,160,172,259,1190,1191},
-{1191,1192,-1,-1,-1,-1},
-{121,1192,1193,-1,-1,-1},
-{128,1193,1194,-1,-1,-1},
-{17,1194,1195,-1,-1,-1},
-{34,1195,1196,-1,-1,-1},
-{1196,1197,-1,-1,-1,-1},
-{134,167,1197,1198,-1,-1},
-{282,1198,1199,-1,-1,-1},
-{280,1199,1200,-1,-1,-1},
-{34,293,1200,1201,-1,-1},
-{15,217,261,1201,1202,-1},
-{1202,1203,-1,-1,-1,-1},
-{74,126,277,1203,1204,-1},
-{107,231,1204,1205,-1,-1},
-{149,1205,1206,-1,-1,-1},
-{57,1206,1207,-1,-1,-1},
-{59,145,272,1207,1208,-1},
-{14,16,1208,1209,-1,-1},
-{158,195,1209,1210,-1,-1},
-{102,133,1210,1211,-1,-1},
-{13,1211,1212,-1,-1,-1},
-{47,1212,1213,-1,-1,-1},
-{28,114,1213,1214,-1,-1},
-{1214,1215,-1,-1,-1,-1},
-{1215,1216,-1,-1,-1,-1},
-{147,1216,1217,-1,-1,-1},
-{90,241,1217,1218,-1,-1},
-{1218,1219,-1,-1,-1,-1},
-{51,161,173,1219,1220,-1},
-{1220,1221,-1,-1,-1,-1},
-{122,1221,1222,-1,-1,-1},
-{129,1222,1223,-1,-1,-1},
-{18,1223,1224,-1,-1,-1},
-{35,1224,1225,-1,-1,-1},
-{1225,1226,-1,-1,-1,-1},
-{135,168,1226,1227,-1,-1},
-{283,1227,1228,-1,-1,-1},
-{281,1228,1229,-1,-1,-1},
-{35,294,1229,1230,-1,-1},
-{16,218,262,1230,1231,-1},
-{1231,1232,-1,-1,-1,-1},
-{75,127,278,1232,1233,-1},
-{108,232,1233,1234,-1,-1},
-{150,1234,1235,-1,-1,-1},
-{58,240,1235,1236,-1,-1},
-{146,273,1236,1237,-1,-1},
-{15,17,1237,1238,-1,-1},
-{100,159,196,1238,1239,-1},
-{103,134,1239,1240,-1,-1},
-{14,1240,1241,-1,-1,-1},
-{48,1241,1242,-1,-1,-1},
-{29,115,1242,1243,-1,-1},
-{1243,1244,-1,-1,-1,-1},
-{1244,1245,-1,-1,-1,-1},
-{148,1245,1246,-1,-1,-1},
-{91,242,1246,1247,-1,-1},
-{1247,1248,-1,-1,-1,-1},
-{52,162,174,1248,1249,-1},
-{1249,1250,-1,-1,-1,-1},
-{123,1250,1251,-1,-1,-1},
-{130,1251,1252,-1,-1,-1},
-{19,1252,1253,-1,-1,-1},
-{36,1253,1254,-1,-1,-1},
-{1254,1255,-1,-1,-1,-1},
-{136,169,1255,1256,-1,-1},
-{284,1256,1257,-1,-1,-1},
-{282,1257,1258,-1,-1,-1},
-{36,295,1258,1259,-1,-1},
-{17,219,263,1259,1260,-1},
-{1260,1261,-1,-1,-1,-1},
-{76,128,279,1261,1262,-1},
-{109,233,1262,1263,-1,-1},
-{151,1263,1264,-1,-1,-1},
-{59,241,1264,1265,-1,-1},
-{147,274,1265,1266,-1,-1},
-{16,18,1266,1267,-1,-1},
-{101,197,1267,1268,-1,-1},
-{104,135,1268,1269,-1,-1},
-{15,1269,1270,-1,-1,-1},
-{49,1270,1271,-1,-1,-1},
-{30,116,1271,1272,-1,-1},
-{60,1272,1273,-1,-1,-1},
-{1273,1274,-1,-1,-1,-1},
-{149,1274,1275,-1,-1,-1},
-{92,243,1275,1276,-1,-1},
-{1276,1277,-1,-1,-1,-1},
-{53,163,175,1277,1278,-1},
-{1278,1279,-1,-1,-1,-1},
-{124,1279,1280,-1,-1,-1},
-{131,1280,1281,-1,-1,-1},
-{1281,1282,-1,-1,-1,-1},
-{37,1282,1283,-1,-1,-1},
-{1283,1284,-1,-1,-1,-1},
-{137,170,1284,1285,-1,-1},
-{285,1285,1286,-1,-1,-1},
-{283,1286,1287,-1,-1,-1},
-{37,296,1287,1288,-1,-1},
-{18,264,1288,1289,-1,-1},
-{1289,1290,-1,-1,-1,-1},
-{77,129,1290,1291,-1,-1},
-{110,234,1291,1292,-1,-1},
-{152,1292,1293,-1,-1,-1},
-{242,1293,1294,-1,-1,-1},
-{148,275,1294,1295,-1,-1},
-{17,19,1295,1296,-1,-1},
-{102,198,1296,1297,-1,-1},
-{105,136,1297,1298,-1,-1},
-{16,1298,1299,-1,-1,-1},
-{50,1299,1300,-1,-1,-1},
-{31,117,1300,1301,-1,-1},
-{61,1301,1302,-1,-1,-1},
-{1302,1303,-1,-1,-1,-1},
-{150,1303,1304,-1,-1,-1},
-{93,244,1304,1305,-1,-1},
-{1305,1306,-1,-1,-1,-1},
-{54,164,176,1306,1307,-1},
-{1307,1308,-1,-1,-1,-1},
-{125,1308,1309,-1,-1,-1},
-{100,132,1309,1310,-1,-1},
-{1310,1311,-1,-1,-1,-1},
-{38,1311,1312,-1,-1,-1},
-{1312,1313,-1,-1,-1,-1},
-{138,171,1313,1314,-1,-1},
-{286,1314,1315,-1,-1,-1},
-{284,1315,1316,-1,-1,-1},
-{38,297,1316,1317,-1,-1},
-{19,265,1317,1318,-1,-1},
-{1318,1319,-1,-1,-1,-1},
-{78,130,280,1319,1320,-1},
-{111,235,1320,1321,-1,-1},
-{153,1321,1322,-1,-1,-1},
-{243,1322,1323,-1,-1,-1},
-{149,276,1323,1324,-1,-1},
-{18,1324,1325,-1,-1,-1},
-{103,199,1325,1326,-1,-1},
-{106,137,1326,1327,-1,-1},
-{17,1327,1328,-1,-1,-1},
-{51,1328,1329,-1,-1,-1},
-{32,118,1329,1330,-1,-1},
-{20,62,1330,1331,-1,-1},
-{1331,1332,-1,-1,-1,-1},
-{151,1332,1333,-1,-1,-1},
-{94,245,1333,1334,-1,-1},
-{1334,1335,-1,-1,-1,-1},
-{55,165,177,1335,1336,-1},
-{1336,1337,-1,-1,-1,-1},
-{126,1337,1338,-1,-1,-1},
-{101,133,1338,1339,-1,-1},
-{1339,1340,-1,-1,-1,-1},
-{39,1340,1341,-1,-1,-1},
-{1341,1342,-1,-1,-1,-1},
-{139,172,1342,1343,-1,-1},
-{40,287,1343,1344,-1,-1},
-{285,1344,1345,-1,-1,-1},
-{39,298,1345,1346,-1,-1},
-{266,1346,1347,-1,-1,-1},
-{1347,1348,-1,-1,-1,-1},
-{79,131,281,1348,1349,-1},
-{112,236,1349,1350,-1,-1},
-{154,1350,1351,-1,-1,-1},
-{244,1351,1352,-1,-1,-1},
-{150,277,1352,1353,-1,-1},
-{19,1353,1354,-1,-1,-1},
-{104,1354,1355,-1,-1,-1},
-{107,138,1355,1356,-1,-1},
-{18,160,1356,1357,-1,-1},
-{52,1357,1358,-1,-1,-1},
-{33,119,1358,1359,-1,-1},
-{21,60,63,1359,1360,-1},
-{1360,1361,-1,-1,-1,-1},
-{152,1361,1362,-1,-1,-1},
-{95,246,1362,1363,-1,-1},
-{120,1363,1364,-1,-1,-1},
-{56,166,178,1364,1365,-1},
-{1365,1366,-1,-1,-1,-1},
-{127,1366,1367,-1,-1,-1},
-{102,134,1367,1368,-1,-1},
-{1368,1369,-1,-1,-1,-1},
-{1369,1370,-1,-1,-1,-1},
-{1370,1371,-1,-1,-1,-1},
-{173,1371,1372,-1,-1,-1},
-{41,288,1372,1373,-1,-1},
-{286,1373,1374,-1,-1,-1},
-{299,1374,1375,-1,-1,-1},
-{267,1375,1376,-1,-1,-1},
-{1376,1377,-1,-1,-1,-1},
-{132,282,1377,1378,-1,-1},
-{113,237,1378,1379,-1,-1},
-{155,1379,1380,-1,-1,-1},
-{245,1380,1381,-1,-1,-1},
-{151,278,1381,1382,-1,-1},
-{1382,1383,-1,-1,-1,-1},
-{105,1383,1384,-1,-1,-1},
-{108,139,1384,1385,-1,-1},
-{19,161,1385,1386,-1,-1},
-{53,1386,1387,-1,-1,-1},
-{34,1387,1388,-1,-1,-1},
-{22,61,64,1388,1389,-1},
-{1389,1390,-1,-1,-1,-1},
-{153,1390,1391,-1,-1,-1},
-{96,247,1391,1392,-1,-1},
-{121,1392,1393,-1,-1,-1},
-{57,167,179,1393,1394,-1},
-{1394,1395,-1,-1,-1,-1},
-{128,1395,1396,-1,-1,-1},
-{103,135,1396,1397,-1,-1},
-{1397,1398,-1,-1,-1,-1},
-{60,1398,1399,-1,-1,-1},
-{1399,1400,-1,-1,-1,-1},
-{174,1400,1401,-1,-1,-1},
-{42,289,1401,1402,-1,-1},
-{287,1402,1403,-1,-1,-1},
-{1403,1404,-1,-1,-1,-1},
-{268,1404,1405,-1,-1,-1},
-{1405,1406,-1,-1,-1,-1},
-{133,283,1406,1407,-1,-1},
-{114,238,1407,1408,-1,-1},
-{156,1408,1409,-1,-1,-1},
-{246,1409,1410,-1,-1,-1},
-{152,279,1410,1411,-1,-1},
-{1411,1412,-1,-1,-1,-1},
-{106,1412,1413,-1,-1,-1},
-{109,1413,1414,-1,-1,-1},
-{162,1414,1415,-1,-1,-1},
-{54,1415,1416,-1,-1,-1},
-{35,1416,1417,-1,-1,-1},
-{23,62,65,1417,1418,-1},
-{1418,1419,-1,-1,-1,-1},
-{154,1419,1420,-1,-1,-1},
-{97,248,1420,1421,-1,-1},
-{122,1421,1422,-1,-1,-1},
-{58,168,1422,1423,-1,-1},
-{260,1423,1424,-1,-1,-1},
-{129,1424,1425,-1,-1,-1},
-{104,136,1425,1426,-1,-1},
-{1426,1427,-1,-1,-1,-1},
-{61,1427,1428,-1,-1,-1},
-{1428,1429,-1,-1,-1,-1},
-{175,1429,1430,-1,-1,-1},
-{43,290,1430,1431,-1,-1},
-{288,1431,1432,-1,-1,-1},
-{1432,1433,-1,-1,-1,-1},
-{269,1433,1434,-1,-1,-1},
-{1434,1435,-1,-1,-1,-1},
-{134,284,1435,1436,-1,-1},
-{115,239,1436,1437,-1,-1},
-{157,1437,1438,-1,-1,-1},
-{247,1438,1439,-1,-1,-1},
-{153,1439,1440,-1,-1,-1},
-{1440,1441,-1,-1,-1,-1},
-{107,1441,1442,-1,-1,-1},
-{110,140,1442,1443,-1,-1},
-{163,1443,1444,-1,-1,-1},
-{55,1444,1445,-1,-1,-1},
-{36,1445,1446,-1,-1,-1},
-{24,63,66,1446,1447,-1},
-{1447,1448,-1,-1,-1,-1},
-{155,1448,1449,-1,-1,-1},
-{98,249,1449,1450,-1,-1},
-{123,260,1450,1451,-1,-1},
-{59,169,1451,1452,-1,-1},
-{261,1452,1453,-1,-1,-1},
-{130,1453,1454,-1,-1,-1},
-{105,137,1454,1455,-1,-1},
-{1455,1456,-1,-1,-1,-1},
-{62,1456,1457,-1,-1,-1},
-{1457,1458,-1,-1,-1,-1},
-{176,1458,1459,-1,-1,-1},
-{44,291,1459,1460,-1,-1},
-{289,1460,1461,-1,-1,-1},
-{1461,1462,-1,-1,-1,-1},
-{270,1462,1463,-1,-1,-1},
-{1463,1464,-1,-1,-1,-1},
-{135,285,1464,1465,-1,-1},
-{116,1465,1466,-1,-1,-1},
-{158,1466,1467,-1,-1,-1},
-{248,1467,1468,-1,-1,-1},
-{154,1468,1469,-1,-1,-1},
-{1469,1470,-1,-1,-1,-1},
-{108,1470,1471,-1,-1,-1},
-{111,141,1471,1472,-1,-1},
-{164,1472,1473,-1,-1,-1},
-{56,1473,1474,-1,-1,-1},
-{37,1474,1475,-1,-1,-1},
-{25,64,67,1475,1476,-1},
-{1476,1477,-1,-1,-1,-1},
-{156,1477,1478,-1,-1,-1},
-{99,250,1478,1479,-1,-1},
-{124,261,1479,1480,-1,-1},
-{170,1480,1481,-1,-1,-1},
-{262,1481,1482,-1,-1,-1},
-{131,1482,1483,-1,-1,-1},
-{106,138,1483,1484,-1,-1},
-{1484,1485,-1,-1,-1,-1},
-{63,1485,1486,-1,-1,-1},
-{1486,1487,-1,-1,-1,-1},
-{177,1487,1488,-1,-1,-1},
-{45,292,1488,1489,-1,-1},
-{290,1489,1490,-1,-1,-1},
-{1490,1491,-1,-1,-1,-1},
-{271,1491,1492,-1,-1,-1},
-{1492,1493,-1,-1,-1,-1},
-{136,286,1493,1494,-1,-1},
-{117,1494,1495,-1,-1,-1},
-{159,1495,1496,-1,-1,-1},
-{249,1496,1497,-1,-1,-1},
-{0,155,1497,1498,-1,-1},
-{1498,1499,-1,-1,-1,-1},
-{109,1499,1500,-1,-1,-1},
-{112,142,1500,1501,-1,-1},
-{165,1501,1502,-1,-1,-1},
-{57,1502,1503,-1,-1,-1},
-{38,240,1503,1504,-1,-1},
-{26,65,68,1504,1505,-1},
-{1505,1506,-1,-1,-1,-1},
-{157,1506,1507,-1,-1,-1},
-{251,1507,1508,-1,-1,-1},
-{40,125,262,1508,1509,-1},
-{171,1509,1510,-1,-1,-1},
-{263,1510,1511,-1,-1,-1},
-{132,1511,1512,-1,-1,-1},
-{107,139,1512,1513,-1,-1},
-{1513,1514,-1,-1,-1,-1},
-{64,1514,1515,-1,-1,-1},
-{1515,1516,-1,-1,-1,-1},
-{178,1516,1517,-1,-1,-1},
-{46,293,1517,1518,-1,-1},
-{291,1518,1519,-1,-1,-1},
-{1519,1520,-1,-1,-1,-1},
-{272,1520,1521,-1,-1,-1},
-{120,1521,1522,-1,-1,-1},
-{137,287,1522,1523,-1,-1},
-{118,1523,1524,-1,-1,-1},
-{1524,1525,-1,-1,-1,-1},
-{250,1525,1526,-1,-1,-1},
-{1,156,1526,1527,-1,-1},
-{1527,1528,-1,-1,-1,-1},
-{110,1528,1529,-1,-1,-1},
-{113,143,1529,1530,-1,-1},
-{166,1530,1531,-1,-1,-1},
-{58,1531,1532,-1,-1,-1},
-{39,241,1532,1533,-1,-1},
-{27,66,69,1533,1534,-1},
-{1534,1535,-1,-1,-1,-1},
-{158,1535,1536,-1,-1,-1},
-{252,1536,1537,-1,-1,-1},
-{41,126,263,1537,1538,-1},
-{172,1538,1539,-1,-1,-1},
-{264,1539,1540,-1,-1,-1},
-{133,1540,1541,-1,-1,-1},
-{108,1541,1542,-1,-1,-1},
-{1542,1543,-1,-1,-1,-1},
-{65,1543,1544,-1,-1,-1},
-{1544,1545,-1,-1,-1,-1},
-{179,1545,1546,-1,-1,-1},
-{47,120,294,1546,1547,-1},
-{292,1547,1548,-1,-1,-1},
-{1548,1549,-1,-1,-1,-1},
-{273,1549,1550,-1,-1,-1},
-{121,1550,1551,-1,-1,-1},
-{138,288,1551,1552,-1,-1},
-{119,1552,1553,-1,-1,-1},
-{1553,1554,-1,-1,-1,-1},
-{251,1554,1555,-1,-1,-1},
-{2,157,1555,1556,-1,-1},
-{1556,1557,-1,-1,-1,-1},
-{111,1557,1558,-1,-1,-1},
-{114,144,1558,1559,-1,-1},
-{167,1559,1560,-1,-1,-1},
-{59,1560,1561,-1,-1,-1},
-{242,1561,1562,-1,-1,-1},
-{28,67,70,1562,1563,-1},
-{1563,1564,-1,-1,-1,-1},
-{159,1564,1565,-1,-1,-1},
-{253,1565,1566,-1,-1,-1},
-{42,127,264,1566,1567,-1},
-{173,240,1567,1568,-1,-1},
-{265,1568,1569,-1,-1,-1},
-{134,1569,1570,-1,-1,-1},
-{109,1570,1571,-1,-1,-1},
-{1571,1572,-1,-1,-1,-1},
-{66,1572,1573,-1,-1,-1},
-{1573,1574,-1,-1,-1,-1},
-{1574,1575,-1,-1,-1,-1},
-{48,121,295,1575,1576,-1},
-{293,1576,1577,-1,-1,-1},
-{160,1577,1578,-1,-1,-1},
-{274,1578,1579,-1,-1,-1},
-{122,1579,1580,-1,-1,-1},
-{139,289,1580,1581,-1,-1},
-{1581,1582,-1,-1,-1,-1},
-{1582,1583,-1,-1,-1,-1},
-{252,1583,1584,-1,-1,-1},
-{3,158,1584,1585,-1,-1},
-{1585,1586,-1,-1,-1,-1},
-{112,1586,1587,-1,-1,-1},
-{115,145,1587,1588,-1,-1},
-{168,1588,1589,-1,-1,-1},
-{1589,1590,-1,-1,-1,-1},
-{243,1590,1591,-1,-1,-1},
-{29,68,71,1591,1592,-1},
-{1592,1593,-1,-1,-1,-1},
-{1593,1594,-1,-1,-1,-1},
-{254,1594,1595,-1,-1,-1},
-{43,128,265,1595,1596,-1},
-{174,241,1596,1597,-1,-1},
-{266,1597,1598,-1,-1,-1},
-{135,1598,1599,-1,-1,-1}};
-int mercury_normal_QCmatrixEnc_3_16[1300][5]={
-{110,-1,-1,-1,-1},
-{300,-1,-1,-1,-1},
-{67,301,-1,-1,-1},
-{302,-1,-1,-1,-1},
-{303,-1,-1,-1,-1},
-{49,122,296,304,-1},
-{294,305,-1,-1,-1},
-{161,306,-1,-1,-1},
-{275,307,-1,-1,-1},
-{123,308,-1,-1,-1},
-{290,309,-1,-1,-1},
-{310,-1,-1,-1,-1},
-{311,-1,-1,-1,-1},
-{160,253,260,312,-1},
-{4,159,313,-1,-1},
-{314,-1,-1,-1,-1},
-{113,315,-1,-1,-1},
-{116,146,316,-1,-1},
-{169,317,-1,-1,-1},
-{318,-1,-1,-1,-1},
-{244,319,-1,-1,-1},
-{30,69,72,320,-1},
-{321,-1,-1,-1,-1},
-{322,-1,-1,-1,-1},
-{255,323,-1,-1,-1},
-{44,129,266,324,-1},
-{175,242,325,-1,-1},
-{267,326,-1,-1,-1},
-{136,327,-1,-1,-1},
-{40,111,328,-1,-1},
-{329,-1,-1,-1,-1},
-{68,330,-1,-1,-1},
-{331,-1,-1,-1,-1},
-{332,-1,-1,-1,-1},
-{50,123,297,333,-1},
-{295,334,-1,-1,-1},
-{162,335,-1,-1,-1},
-{276,336,-1,-1,-1},
-{124,337,-1,-1,-1},
-{291,338,-1,-1,-1},
-{339,-1,-1,-1,-1},
-{340,-1,-1,-1,-1},
-{161,254,261,341,-1},
-{5,342,-1,-1,-1},
-{343,-1,-1,-1,-1},
-{114,344,-1,-1,-1},
-{117,147,345,-1,-1},
-{0,170,346,-1,-1},
-{347,-1,-1,-1,-1},
-{245,348,-1,-1,-1},
-{31,70,73,349,-1},
-{350,-1,-1,-1,-1},
-{351,-1,-1,-1,-1},
-{256,352,-1,-1,-1},
-{45,130,267,353,-1},
-{176,243,354,-1,-1},
-{268,355,-1,-1,-1},
-{137,356,-1,-1,-1},
-{41,112,357,-1,-1},
-{358,-1,-1,-1,-1},
-{69,359,-1,-1,-1},
-{360,-1,-1,-1,-1},
-{80,361,-1,-1,-1},
-{51,124,260,298,362},
-{296,363,-1,-1,-1},
-{160,163,364,-1,-1},
-{277,365,-1,-1,-1},
-{125,366,-1,-1,-1},
-{292,367,-1,-1,-1},
-{100,368,-1,-1,-1},
-{369,-1,-1,-1,-1},
-{162,255,262,370,-1},
-{6,371,-1,-1,-1},
-{372,-1,-1,-1,-1},
-{115,373,-1,-1,-1},
-{118,148,374,-1,-1},
-{1,171,375,-1,-1},
-{376,-1,-1,-1,-1},
-{246,377,-1,-1,-1},
-{32,71,74,378,-1},
-{379,-1,-1,-1,-1},
-{380,-1,-1,-1,-1},
-{257,381,-1,-1,-1},
-{46,131,268,382,-1},
-{177,244,383,-1,-1},
-{269,384,-1,-1,-1},
-{138,240,385,-1,-1},
-{42,113,386,-1,-1},
-{387,-1,-1,-1,-1},
-{70,388,-1,-1,-1},
-{389,-1,-1,-1,-1},
-{81,390,-1,-1,-1},
-{52,125,261,299,391},
-{297,392,-1,-1,-1},
-{161,164,393,-1,-1},
-{278,394,-1,-1,-1},
-{126,395,-1,-1,-1},
-{293,396,-1,-1,-1},
-{101,397,-1,-1,-1},
-{398,-1,-1,-1,-1},
-{163,256,263,399,-1},
-{7,60,400,-1,-1},
-{401,-1,-1,-1,-1},
-{116,402,-1,-1,-1},
-{119,149,403,-1,-1},
-{2,172,404,-1,-1},
-{405,-1,-1,-1,-1},
-{247,406,-1,-1,-1},
-{33,72,75,407,-1},
-{408,-1,-1,-1,-1},
-{200,409,-1,-1,-1},
-{258,410,-1,-1,-1},
-{47,132,269,411,-1},
-{178,245,412,-1,-1},
-{270,413,-1,-1,-1},
-{139,241,414,-1,-1},
-{43,114,415,-1,-1},
-{416,-1,-1,-1,-1},
-{71,417,-1,-1,-1},
-{418,-1,-1,-1,-1},
-{82,100,419,-1,-1},
-{53,126,262,420,-1},
-{298,421,-1,-1,-1},
-{162,165,422,-1,-1},
-{279,423,-1,-1,-1},
-{127,424,-1,-1,-1},
-{294,425,-1,-1,-1},
-{102,426,-1,-1,-1},
-{427,-1,-1,-1,-1},
-{164,257,264,428,-1},
-{8,61,429,-1,-1},
-{430,-1,-1,-1,-1},
-{117,240,431,-1,-1},
-{150,432,-1,-1,-1},
-{3,173,433,-1,-1},
-{434,-1,-1,-1,-1},
-{248,435,-1,-1,-1},
-{34,73,76,436,-1},
-{437,-1,-1,-1,-1},
-{201,438,-1,-1,-1},
-{259,439,-1,-1,-1},
-{48,133,270,440,-1},
-{179,246,441,-1,-1},
-{271,442,-1,-1,-1},
-{242,443,-1,-1,-1},
-{44,115,160,444,-1},
-{445,-1,-1,-1,-1},
-{72,446,-1,-1,-1},
-{447,-1,-1,-1,-1},
-{83,101,448,-1,-1},
-{54,127,263,449,-1},
-{299,450,-1,-1,-1},
-{163,166,451,-1,-1},
-{452,-1,-1,-1,-1},
-{128,453,-1,-1,-1},
-{295,454,-1,-1,-1},
-{103,455,-1,-1,-1},
-{456,-1,-1,-1,-1},
-{165,258,265,457,-1},
-{9,62,458,-1,-1},
-{459,-1,-1,-1,-1},
-{118,241,460,-1,-1},
-{151,461,-1,-1,-1},
-{4,174,462,-1,-1},
-{463,-1,-1,-1,-1},
-{249,464,-1,-1,-1},
-{35,74,77,465,-1},
-{466,-1,-1,-1,-1},
-{202,467,-1,-1,-1},
-{468,-1,-1,-1,-1},
-{49,134,271,469,-1},
-{247,470,-1,-1,-1},
-{272,471,-1,-1,-1},
-{243,472,-1,-1,-1},
-{45,116,161,200,473},
-{220,474,-1,-1,-1},
-{73,475,-1,-1,-1},
-{476,-1,-1,-1,-1},
-{84,102,477,-1,-1},
-{55,128,264,478,-1},
-{479,-1,-1,-1,-1},
-{60,164,167,480,-1},
-{481,-1,-1,-1,-1},
-{129,482,-1,-1,-1},
-{296,483,-1,-1,-1},
-{104,484,-1,-1,-1},
-{485,-1,-1,-1,-1},
-{166,259,266,486,-1},
-{10,63,487,-1,-1},
-{488,-1,-1,-1,-1},
-{119,242,489,-1,-1},
-{152,490,-1,-1,-1},
-{5,175,491,-1,-1},
-{492,-1,-1,-1,-1},
-{250,493,-1,-1,-1},
-{36,75,78,494,-1},
-{495,-1,-1,-1,-1},
-{203,496,-1,-1,-1},
-{497,-1,-1,-1,-1},
-{50,135,272,498,-1},
-{248,499,-1,-1,-1},
-{273,500,-1,-1,-1},
-{244,501,-1,-1,-1},
-{46,117,162,201,502},
-{221,503,-1,-1,-1},
-{74,504,-1,-1,-1},
-{505,-1,-1,-1,-1},
-{85,103,506,-1,-1},
-{56,129,265,507,-1},
-{508,-1,-1,-1,-1},
-{61,165,168,509,-1},
-{510,-1,-1,-1,-1},
-{130,511,-1,-1,-1},
-{297,512,-1,-1,-1},
-{105,513,-1,-1,-1},
-{514,-1,-1,-1,-1},
-{167,267,515,-1,-1},
-{11,64,516,-1,-1},
-{517,-1,-1,-1,-1},
-{60,243,518,-1,-1},
-{153,519,-1,-1,-1},
-{6,176,520,-1,-1},
-{100,521,-1,-1,-1},
-{251,522,-1,-1,-1},
-{37,76,79,523,-1},
-{524,-1,-1,-1,-1},
-{204,525,-1,-1,-1},
-{180,526,-1,-1,-1},
-{51,136,273,527,-1},
-{249,528,-1,-1,-1},
-{274,529,-1,-1,-1},
-{240,245,530,-1,-1},
-{47,118,163,202,531},
-{222,532,-1,-1,-1},
-{75,533,-1,-1,-1},
-{534,-1,-1,-1,-1},
-{86,104,535,-1,-1},
-{57,130,266,536,-1},
-{537,-1,-1,-1,-1},
-{62,166,169,538,-1},
-{539,-1,-1,-1,-1},
-{131,540,-1,-1,-1},
-{298,541,-1,-1,-1},
-{60,106,542,-1,-1},
-{543,-1,-1,-1,-1},
-{168,268,544,-1,-1},
-{12,65,545,-1,-1},
-{546,-1,-1,-1,-1},
-{61,244,547,-1,-1},
-{154,548,-1,-1,-1},
-{7,177,549,-1,-1},
-{101,550,-1,-1,-1},
-{252,551,-1,-1,-1},
-{38,77,552,-1,-1},
-{553,-1,-1,-1,-1},
-{205,554,-1,-1,-1},
-{181,555,-1,-1,-1},
-{52,137,274,556,-1},
-{250,557,-1,-1,-1},
-{275,558,-1,-1,-1},
-{241,246,559,-1,-1},
-{48,119,164,203,560},
-{223,561,-1,-1,-1},
-{76,562,-1,-1,-1},
-{563,-1,-1,-1,-1},
-{87,105,564,-1,-1},
-{58,131,267,565,-1},
-{566,-1,-1,-1,-1},
-{63,167,170,567,-1},
-{568,-1,-1,-1,-1},
-{132,260,569,-1,-1},
-{299,570,-1,-1,-1},
-{61,107,571,-1,-1},
-{572,-1,-1,-1,-1},
-{169,269,573,-1,-1},
-{13,66,574,-1,-1},
-{575,-1,-1,-1,-1},
-{62,245,576,-1,-1},
-{155,577,-1,-1,-1},
-{8,178,578,-1,-1},
-{102,579,-1,-1,-1},
-{253,580,-1,-1,-1},
-{39,78,581,-1,-1},
-{582,-1,-1,-1,-1},
-{206,583,-1,-1,-1},
-{182,584,-1,-1,-1},
-{53,138,275,585,-1},
-{251,586,-1,-1,-1},
-{276,587,-1,-1,-1},
-{242,247,588,-1,-1},
-{49,165,204,589,-1},
-{224,590,-1,-1,-1},
-{77,591,-1,-1,-1},
-{220,592,-1,-1,-1},
-{88,106,593,-1,-1},
-{59,132,268,594,-1},
-{80,595,-1,-1,-1},
-{64,168,171,596,-1},
-{597,-1,-1,-1,-1},
-{133,261,598,-1,-1},
-{599,-1,-1,-1,-1},
-{62,108,600,-1,-1},
-{601,-1,-1,-1,-1},
-{170,270,602,-1,-1},
-{14,67,603,-1,-1},
-{604,-1,-1,-1,-1},
-{60,63,246,605,-1},
-{156,606,-1,-1,-1},
-{9,179,607,-1,-1},
-{103,608,-1,-1,-1},
-{254,609,-1,-1,-1},
-{79,610,-1,-1,-1},
-{611,-1,-1,-1,-1},
-{207,612,-1,-1,-1},
-{183,613,-1,-1,-1},
-{54,139,276,614,-1},
-{20,252,615,-1,-1},
-{277,616,-1,-1,-1},
-{243,248,617,-1,-1},
-{50,166,205,618,-1},
-{225,619,-1,-1,-1},
-{78,620,-1,-1,-1},
-{221,621,-1,-1,-1},
-{89,107,260,622,-1},
-{133,269,623,-1,-1},
-{81,624,-1,-1,-1},
-{65,169,172,625,-1},
-{100,626,-1,-1,-1},
-{134,262,627,-1,-1},
-{628,-1,-1,-1,-1},
-{63,109,629,-1,-1},
-{180,280,630,-1,-1},
-{171,271,631,-1,-1},
-{15,68,632,-1,-1},
-{633,-1,-1,-1,-1},
-{61,64,247,634,-1},
-{157,635,-1,-1,-1},
-{10,636,-1,-1,-1},
-{104,637,-1,-1,-1},
-{255,638,-1,-1,-1},
-{240,639,-1,-1,-1},
-{640,-1,-1,-1,-1},
-{208,641,-1,-1,-1},
-{184,642,-1,-1,-1},
-{55,277,643,-1,-1},
-{21,253,644,-1,-1},
-{278,645,-1,-1,-1},
-{244,249,646,-1,-1},
-{51,167,206,647,-1},
-{226,648,-1,-1,-1},
-{79,649,-1,-1,-1},
-{222,650,-1,-1,-1},
-{90,108,261,651,-1},
-{134,270,652,-1,-1},
-{82,653,-1,-1,-1},
-{66,170,173,654,-1},
-{101,655,-1,-1,-1},
-{40,135,263,656,-1},
-{657,-1,-1,-1,-1},
-{64,110,658,-1,-1},
-{181,281,659,-1,-1},
-{172,272,660,-1,-1},
-{16,69,661,-1,-1},
-{662,-1,-1,-1,-1},
-{62,65,248,663,-1},
-{158,664,-1,-1,-1},
-{11,665,-1,-1,-1},
-{105,666,-1,-1,-1},
-{256,667,-1,-1,-1},
-{241,668,-1,-1,-1},
-{669,-1,-1,-1,-1},
-{209,670,-1,-1,-1},
-{185,671,-1,-1,-1},
-{56,278,672,-1,-1},
-{22,254,673,-1,-1},
-{279,674,-1,-1,-1},
-{245,250,675,-1,-1},
-{52,168,207,676,-1},
-{227,677,-1,-1,-1},
-{678,-1,-1,-1,-1},
-{223,679,-1,-1,-1},
-{91,109,262,680,-1},
-{135,271,681,-1,-1},
-{83,682,-1,-1,-1},
-{67,171,174,683,-1},
-{102,684,-1,-1,-1},
-{41,136,264,685,-1},
-{686,-1,-1,-1,-1},
-{65,111,140,687,-1},
-{182,282,688,-1,-1},
-{173,273,689,-1,-1},
-{17,70,690,-1,-1},
-{691,-1,-1,-1,-1},
-{63,66,249,692,-1},
-{159,693,-1,-1,-1},
-{12,694,-1,-1,-1},
-{106,695,-1,-1,-1},
-{257,696,-1,-1,-1},
-{242,697,-1,-1,-1},
-{698,-1,-1,-1,-1},
-{210,699,-1,-1,-1},
-{186,700,-1,-1,-1},
-{0,57,279,701,-1},
-{23,255,702,-1,-1},
-{703,-1,-1,-1,-1},
-{246,251,704,-1,-1},
-{53,169,208,705,-1},
-{228,706,-1,-1,-1},
-{707,-1,-1,-1,-1},
-{200,224,708,-1,-1},
-{92,110,263,709,-1},
-{136,260,272,710,-1},
-{84,711,-1,-1,-1},
-{68,172,175,712,-1},
-{40,103,713,-1,-1},
-{42,137,265,714,-1},
-{715,-1,-1,-1,-1},
-{66,112,141,716,-1},
-{183,283,717,-1,-1},
-{174,274,718,-1,-1},
-{18,71,719,-1,-1},
-{720,-1,-1,-1,-1},
-{64,67,250,721,-1},
-{722,-1,-1,-1,-1},
-{13,723,-1,-1,-1},
-{107,724,-1,-1,-1},
-{258,725,-1,-1,-1},
-{243,726,-1,-1,-1},
-{727,-1,-1,-1,-1},
-{211,728,-1,-1,-1},
-{187,729,-1,-1,-1},
-{1,58,730,-1,-1},
-{24,256,731,-1,-1},
-{732,-1,-1,-1,-1},
-{247,252,733,-1,-1},
-{54,170,209,734,-1},
-{229,735,-1,-1,-1},
-{736,-1,-1,-1,-1},
-{201,225,737,-1,-1},
-{93,111,264,738,-1},
-{137,261,273,739,-1},
-{85,740,-1,-1,-1},
-{69,173,176,741,-1},
-{41,104,742,-1,-1},
-{43,138,266,743,-1},
-{0,744,-1,-1,-1},
-{67,113,142,745,-1},
-{184,284,746,-1,-1},
-{175,275,747,-1,-1},
-{19,72,748,-1,-1},
-{749,-1,-1,-1,-1},
-{65,68,251,750,-1},
-{751,-1,-1,-1,-1},
-{14,752,-1,-1,-1},
-{108,753,-1,-1,-1},
-{259,754,-1,-1,-1},
-{244,755,-1,-1,-1},
-{756,-1,-1,-1,-1},
-{212,757,-1,-1,-1},
-{188,758,-1,-1,-1},
-{2,59,759,-1,-1},
-{25,257,760,-1,-1},
-{761,-1,-1,-1,-1},
-{248,253,762,-1,-1},
-{55,171,210,763,-1},
-{230,764,-1,-1,-1},
-{765,-1,-1,-1,-1},
-{0,202,226,766,-1},
-{94,112,265,767,-1},
-{138,262,274,768,-1},
-{86,769,-1,-1,-1},
-{70,174,177,770,-1},
-{42,105,771,-1,-1},
-{44,139,267,772,-1},
-{1,773,-1,-1,-1},
-{68,114,143,180,774},
-{185,285,775,-1,-1},
-{176,276,776,-1,-1},
-{73,777,-1,-1,-1},
-{778,-1,-1,-1,-1},
-{66,69,252,779,-1},
-{780,-1,-1,-1,-1},
-{15,781,-1,-1,-1},
-{109,782,-1,-1,-1},
-{783,-1,-1,-1,-1},
-{245,784,-1,-1,-1},
-{785,-1,-1,-1,-1},
-{213,786,-1,-1,-1},
-{189,787,-1,-1,-1},
-{3,788,-1,-1,-1},
-{20,26,258,789,-1},
-{790,-1,-1,-1,-1},
-{120,249,254,791,-1},
-{56,172,211,792,-1},
-{231,793,-1,-1,-1},
-{20,794,-1,-1,-1},
-{1,203,227,795,-1},
-{95,113,266,796,-1},
-{60,139,263,275,797},
-{87,798,-1,-1,-1},
-{71,175,178,799,-1},
-{43,106,800,-1,-1},
-{45,268,801,-1,-1},
-{0,2,802,-1,-1},
-{69,115,144,181,803},
-{186,286,804,-1,-1},
-{177,277,805,-1,-1},
-{74,806,-1,-1,-1},
-{100,807,-1,-1,-1},
-{67,70,253,808,-1},
-{809,-1,-1,-1,-1},
-{16,810,-1,-1,-1},
-{110,811,-1,-1,-1},
-{812,-1,-1,-1,-1},
-{246,813,-1,-1,-1},
-{814,-1,-1,-1,-1},
-{214,815,-1,-1,-1},
-{190,816,-1,-1,-1},
-{4,817,-1,-1,-1},
-{21,27,259,818,-1},
-{819,-1,-1,-1,-1},
-{121,250,255,820,-1},
-{57,173,212,821,-1},
-{232,822,-1,-1,-1},
-{21,280,823,-1,-1},
-{2,204,228,824,-1},
-{96,114,267,825,-1},
-{61,264,276,826,-1},
-{88,827,-1,-1,-1},
-{72,176,179,828,-1},
-{44,107,829,-1,-1},
-{46,269,830,-1,-1},
-{1,3,831,-1,-1},
-{70,116,145,182,832},
-{120,187,287,833,-1},
-{0,178,278,834,-1},
-{75,835,-1,-1,-1},
-{101,836,-1,-1,-1},
-{68,71,254,837,-1},
-{838,-1,-1,-1,-1},
-{17,839,-1,-1,-1},
-{111,840,-1,-1,-1},
-{841,-1,-1,-1,-1},
-{160,247,842,-1,-1},
-{843,-1,-1,-1,-1},
-{215,844,-1,-1,-1},
-{191,845,-1,-1,-1},
-{5,846,-1,-1,-1},
-{22,28,847,-1,-1},
-{848,-1,-1,-1,-1},
-{122,251,256,849,-1},
-{58,174,213,850,-1},
-{233,851,-1,-1,-1},
-{22,281,852,-1,-1},
-{3,205,229,853,-1},
-{97,115,268,854,-1},
-{62,265,277,855,-1},
-{89,856,-1,-1,-1},
-{73,177,857,-1,-1},
-{45,108,858,-1,-1},
-{47,260,270,859,-1},
-{2,4,860,-1,-1},
-{71,117,146,183,861},
-{121,188,288,862,-1},
-{1,179,279,863,-1},
-{76,864,-1,-1,-1},
-{102,865,-1,-1,-1},
-{69,72,255,866,-1},
-{867,-1,-1,-1,-1},
-{18,868,-1,-1,-1},
-{112,869,-1,-1,-1},
-{870,-1,-1,-1,-1},
-{161,248,871,-1,-1},
-{872,-1,-1,-1,-1},
-{216,873,-1,-1,-1},
-{192,874,-1,-1,-1},
-{6,875,-1,-1,-1},
-{23,29,876,-1,-1},
-{877,-1,-1,-1,-1},
-{123,252,257,878,-1},
-{59,175,214,879,-1},
-{234,880,-1,-1,-1},
-{23,282,881,-1,-1},
-{4,206,230,882,-1},
-{98,116,269,883,-1},
-{63,266,278,884,-1},
-{90,220,885,-1,-1},
-{74,178,886,-1,-1},
-{46,109,887,-1,-1},
-{48,261,271,888,-1},
-{3,5,889,-1,-1},
-{72,118,147,184,890},
-{122,189,289,891,-1},
-{2,892,-1,-1,-1},
-{77,893,-1,-1,-1},
-{103,894,-1,-1,-1},
-{70,73,256,895,-1},
-{896,-1,-1,-1,-1},
-{19,897,-1,-1,-1},
-{113,898,-1,-1,-1},
-{899,-1,-1,-1,-1},
-{40,162,249,900,-1},
-{901,-1,-1,-1,-1},
-{217,902,-1,-1,-1},
-{193,903,-1,-1,-1},
-{7,904,-1,-1,-1},
-{24,30,905,-1,-1},
-{906,-1,-1,-1,-1},
-{124,253,258,907,-1},
-{176,215,908,-1,-1},
-{235,909,-1,-1,-1},
-{24,283,910,-1,-1},
-{5,207,231,911,-1},
-{99,117,270,912,-1},
-{64,267,279,913,-1},
-{91,221,914,-1,-1},
-{75,179,915,-1,-1},
-{47,110,916,-1,-1},
-{49,262,272,917,-1},
-{4,6,918,-1,-1},
-{73,119,148,185,919},
-{123,190,290,920,-1},
-{3,921,-1,-1,-1},
-{78,922,-1,-1,-1},
-{104,923,-1,-1,-1},
-{71,74,257,924,-1},
-{925,-1,-1,-1,-1},
-{926,-1,-1,-1,-1},
-{80,114,927,-1,-1},
-{928,-1,-1,-1,-1},
-{41,163,250,929,-1},
-{930,-1,-1,-1,-1},
-{218,931,-1,-1,-1},
-{194,932,-1,-1,-1},
-{8,933,-1,-1,-1},
-{25,31,934,-1,-1},
-{935,-1,-1,-1,-1},
-{125,254,259,936,-1},
-{177,216,937,-1,-1},
-{236,938,-1,-1,-1},
-{25,284,939,-1,-1},
-{6,208,232,940,-1},
-{118,271,941,-1,-1},
-{65,268,942,-1,-1},
-{92,222,943,-1,-1},
-{76,140,944,-1,-1},
-{48,111,945,-1,-1},
-{50,263,273,946,-1},
-{5,7,947,-1,-1},
-{74,149,186,948,-1},
-{124,191,291,949,-1},
-{4,950,-1,-1,-1},
-{79,951,-1,-1,-1},
-{105,952,-1,-1,-1},
-{72,75,258,953,-1},
-{954,-1,-1,-1,-1},
-{955,-1,-1,-1,-1},
-{81,115,956,-1,-1},
-{957,-1,-1,-1,-1},
-{42,164,251,958,-1},
-{959,-1,-1,-1,-1},
-{219,960,-1,-1,-1},
-{120,195,961,-1,-1},
-{9,962,-1,-1,-1},
-{26,32,963,-1,-1},
-{964,-1,-1,-1,-1},
-{126,255,965,-1,-1},
-{178,217,966,-1,-1},
-{237,967,-1,-1,-1},
-{26,285,968,-1,-1},
-{7,209,233,969,-1},
-{119,272,970,-1,-1},
-{66,269,971,-1,-1},
-{93,223,972,-1,-1},
-{77,141,973,-1,-1},
-{49,112,974,-1,-1},
-{51,264,274,975,-1},
-{6,8,976,-1,-1},
-{75,150,187,977,-1},
-{125,192,292,978,-1},
-{5,979,-1,-1,-1},
-{980,-1,-1,-1,-1},
-{20,106,981,-1,-1},
-{73,76,259,982,-1},
-{983,-1,-1,-1,-1},
-{984,-1,-1,-1,-1},
-{82,116,985,-1,-1},
-{986,-1,-1,-1,-1},
-{43,165,252,987,-1},
-{988,-1,-1,-1,-1},
-{989,-1,-1,-1,-1},
-{121,196,990,-1,-1},
-{10,991,-1,-1,-1},
-{27,33,992,-1,-1},
-{993,-1,-1,-1,-1},
-{127,160,256,994,-1},
-{179,218,995,-1,-1},
-{238,996,-1,-1,-1},
-{27,286,997,-1,-1},
-{8,210,234,998,-1},
-{273,999,-1,-1,-1},
-{67,270,1000,-1,-1},
-{94,100,224,1001,-1},
-{78,142,1002,-1,-1},
-{50,113,1003,-1,-1},
-{52,265,275,1004,-1},
-{7,9,1005,-1,-1},
-{76,151,188,1006,-1},
-{126,193,293,1007,-1},
-{6,1008,-1,-1,-1},
-{40,1009,-1,-1,-1},
-{21,107,1010,-1,-1},
-{74,77,1011,-1,-1},
-{1012,-1,-1,-1,-1},
-{140,1013,-1,-1,-1},
-{83,117,1014,-1,-1},
-{1015,-1,-1,-1,-1},
-{44,166,253,1016,-1},
-{1017,-1,-1,-1,-1},
-{1018,-1,-1,-1,-1},
-{122,197,1019,-1,-1},
-{11,1020,-1,-1,-1},
-{28,34,1021,-1,-1},
-{1022,-1,-1,-1,-1},
-{128,161,257,1023,-1},
-{219,1024,-1,-1,-1},
-{239,1025,-1,-1,-1},
-{28,287,1026,-1,-1},
-{9,211,235,1027,-1},
-{274,1028,-1,-1,-1},
-{68,120,271,1029,-1},
-{95,101,225,1030,-1},
-{79,143,1031,-1,-1},
-{51,114,1032,-1,-1},
-{53,266,276,1033,-1},
-{8,10,1034,-1,-1},
-{77,152,189,1035,-1},
-{127,194,294,1036,-1},
-{7,1037,-1,-1,-1},
-{41,1038,-1,-1,-1},
-{22,108,1039,-1,-1},
-{75,78,1040,-1,-1},
-{1041,-1,-1,-1,-1},
-{141,1042,-1,-1,-1},
-{84,118,1043,-1,-1},
-{1044,-1,-1,-1,-1},
-{45,167,254,1045,-1},
-{1046,-1,-1,-1,-1},
-{1047,-1,-1,-1,-1},
-{123,198,1048,-1,-1},
-{12,1049,-1,-1,-1},
-{29,35,1050,-1,-1},
-{1051,-1,-1,-1,-1},
-{129,162,258,1052,-1},
-{1053,-1,-1,-1,-1},
-{1054,-1,-1,-1,-1},
-{29,288,1055,-1,-1},
-{10,212,236,1056,-1},
-{275,1057,-1,-1,-1},
-{69,121,272,1058,-1},
-{96,102,226,1059,-1},
-{144,1060,-1,-1,-1},
-{52,115,1061,-1,-1},
-{54,140,267,277,1062},
-{9,11,1063,-1,-1},
-{78,153,190,1064,-1},
-{128,195,295,1065,-1},
-{8,1066,-1,-1,-1},
-{42,1067,-1,-1,-1},
-{23,109,1068,-1,-1},
-{76,79,1069,-1,-1},
-{1070,-1,-1,-1,-1},
-{142,1071,-1,-1,-1},
-{85,119,1072,-1,-1},
-{1073,-1,-1,-1,-1},
-{46,168,255,1074,-1},
-{1075,-1,-1,-1,-1},
-{1076,-1,-1,-1,-1},
-{124,199,1077,-1,-1},
-{13,1078,-1,-1,-1},
-{30,36,1079,-1,-1},
-{1080,-1,-1,-1,-1},
-{130,163,259,1081,-1},
-{1082,-1,-1,-1,-1},
-{1083,-1,-1,-1,-1},
-{30,289,1084,-1,-1},
-{11,213,237,1085,-1},
-{276,1086,-1,-1,-1},
-{70,122,273,1087,-1},
-{97,103,227,1088,-1},
-{145,1089,-1,-1,-1},
-{53,116,1090,-1,-1},
-{55,141,268,278,1091},
-{10,12,1092,-1,-1},
-{79,154,191,1093,-1},
-{129,196,296,1094,-1},
-{9,1095,-1,-1,-1},
-{43,1096,-1,-1,-1},
-{24,110,1097,-1,-1},
-{77,1098,-1,-1,-1},
-{1099,-1,-1,-1,-1},
-{143,1100,-1,-1,-1},
-{86,1101,-1,-1,-1},
-{1102,-1,-1,-1,-1},
-{47,169,256,1103,-1},
-{1104,-1,-1,-1,-1},
-{1105,-1,-1,-1,-1},
-{125,1106,-1,-1,-1},
-{14,1107,-1,-1,-1},
-{31,37,1108,-1,-1},
-{1109,-1,-1,-1,-1},
-{131,164,1110,-1,-1},
-{1111,-1,-1,-1,-1},
-{1112,-1,-1,-1,-1},
-{31,290,1113,-1,-1},
-{12,214,238,1114,-1},
-{277,1115,-1,-1,-1},
-{71,123,274,1116,-1},
-{98,104,228,1117,-1},
-{146,1118,-1,-1,-1},
-{54,117,1119,-1,-1},
-{56,142,269,279,1120},
-{11,13,1121,-1,-1},
-{155,192,1122,-1,-1},
-{130,197,297,1123,-1},
-{10,1124,-1,-1,-1},
-{44,1125,-1,-1,-1},
-{25,111,1126,-1,-1},
-{78,1127,-1,-1,-1},
-{1128,-1,-1,-1,-1},
-{144,1129,-1,-1,-1},
-{87,1130,-1,-1,-1},
-{1131,-1,-1,-1,-1},
-{48,170,257,1132,-1},
-{1133,-1,-1,-1,-1},
-{1134,-1,-1,-1,-1},
-{126,1135,-1,-1,-1},
-{15,1136,-1,-1,-1},
-{32,38,1137,-1,-1},
-{1138,-1,-1,-1,-1},
-{132,165,1139,-1,-1},
-{280,1140,-1,-1,-1},
-{1141,-1,-1,-1,-1},
-{32,291,1142,-1,-1},
-{13,215,239,1143,-1},
-{278,1144,-1,-1,-1},
-{72,124,275,1145,-1},
-{99,105,229,1146,-1},
-{147,1147,-1,-1,-1},
-{55,118,1148,-1,-1},
-{57,143,270,1149,-1},
-{12,14,1150,-1,-1},
-{156,193,1151,-1,-1},
-{100,131,198,298,1152},
-{11,1153,-1,-1,-1},
-{45,1154,-1,-1,-1},
-{26,112,1155,-1,-1},
-{79,1156,-1,-1,-1},
-{1157,-1,-1,-1,-1},
-{145,1158,-1,-1,-1},
-{88,1159,-1,-1,-1},
-{1160,-1,-1,-1,-1},
-{49,171,258,1161,-1},
-{1162,-1,-1,-1,-1},
-{120,1163,-1,-1,-1},
-{127,1164,-1,-1,-1},
-{16,1165,-1,-1,-1},
-{33,39,1166,-1,-1},
-{1167,-1,-1,-1,-1},
-{133,166,1168,-1,-1},
-{281,1169,-1,-1,-1},
-{1170,-1,-1,-1,-1},
-{33,292,1171,-1,-1},
-{14,216,260,1172,-1},
-{279,1173,-1,-1,-1},
-{73,125,276,1174,-1},
-{106,230,1175,-1,-1},
-{148,1176,-1,-1,-1},
-{56,119,1177,-1,-1},
-{58,144,271,1178,-1},
-{13,15,1179,-1,-1},
-{157,194,1180,-1,-1},
-{101,132,199,299,1181},
-{12,1182,-1,-1,-1},
-{46,1183,-1,-1,-1},
-{27,113,1184,-1,-1},
-{1185,-1,-1,-1,-1},
-{1186,-1,-1,-1,-1},
-{146,1187,-1,-1,-1},
-{89,240,1188,-1,-1},
-{1189,-1,-1,-1,-1},
-{50,160,172,259,1190},
-{1191,-1,-1,-1,-1},
-{121,1192,-1,-1,-1},
-{128,1193,-1,-1,-1},
-{17,1194,-1,-1,-1},
-{34,1195,-1,-1,-1},
-{1196,-1,-1,-1,-1},
-{134,167,1197,-1,-1},
-{282,1198,-1,-1,-1},
-{280,1199,-1,-1,-1},
-{34,293,1200,-1,-1},
-{15,217,261,1201,-1},
-{1202,-1,-1,-1,-1},
-{74,126,277,1203,-1},
-{107,231,1204,-1,-1},
-{149,1205,-1,-1,-1},
-{57,1206,-1,-1,-1},
-{59,145,272,1207,-1},
-{14,16,1208,-1,-1},
-{158,195,1209,-1,-1},
-{102,133,1210,-1,-1},
-{13,1211,-1,-1,-1},
-{47,1212,-1,-1,-1},
-{28,114,1213,-1,-1},
-{1214,-1,-1,-1,-1},
-{1215,-1,-1,-1,-1},
-{147,1216,-1,-1,-1},
-{90,241,1217,-1,-1},
-{1218,-1,-1,-1,-1},
-{51,161,173,1219,-1},
-{1220,-1,-1,-1,-1},
-{122,1221,-1,-1,-1},
-{129,1222,-1,-1,-1},
-{18,1223,-1,-1,-1},
-{35,1224,-1,-1,-1},
-{1225,-1,-1,-1,-1},
-{135,168,1226,-1,-1},
-{283,1227,-1,-1,-1},
-{281,1228,-1,-1,-1},
-{35,294,1229,-1,-1},
-{16,218,262,1230,-1},
-{1231,-1,-1,-1,-1},
-{75,127,278,1232,-1},
-{108,232,1233,-1,-1},
-{150,1234,-1,-1,-1},
-{58,240,1235,-1,-1},
-{146,273,1236,-1,-1},
-{15,17,1237,-1,-1},
-{100,159,196,1238,-1},
-{103,134,1239,-1,-1},
-{14,1240,-1,-1,-1},
-{48,1241,-1,-1,-1},
-{29,115,1242,-1,-1},
-{1243,-1,-1,-1,-1},
-{1244,-1,-1,-1,-1},
-{148,1245,-1,-1,-1},
-{91,242,1246,-1,-1},
-{1247,-1,-1,-1,-1},
-{52,162,174,1248,-1},
-{1249,-1,-1,-1,-1},
-{123,1250,-1,-1,-1},
-{130,1251,-1,-1,-1},
-{19,1252,-1,-1,-1},
-{36,1253,-1,-1,-1},
-{1254,-1,-1,-1,-1},
-{136,169,1255,-1,-1},
-{284,1256,-1,-1,-1},
-{282,1257,-1,-1,-1},
-{36,295,1258,-1,-1},
-{17,219,263,1259,-1},
-{1260,-1,-1,-1,-1},
-{76,128,279,1261,-1},
-{109,233,1262,-1,-1},
-{151,1263,-1,-1,-1},
-{59,241,1264,-1,-1},
-{147,274,1265,-1,-1},
-{16,18,1266,-1,-1},
-{101,197,1267,-1,-1},
-{104,135,1268,-1,-1},
-{15,1269,-1,-1,-1},
-{49,1270,-1,-1,-1},
-{30,116,1271,-1,-1},
-{60,1272,-1,-1,-1},
-{1273,-1,-1,-1,-1},
-{149,1274,-1,-1,-1},
-{92,243,1275,-1,-1},
-{1276,-1,-1,-1,-1},
-{53,163,175,1277,-1},
-{1278,-1,-1,-1,-1},
-{124,1279,-1,-1,-1},
-{131,1280,-1,-1,-1},
-{1281,-1,-1,-1,-1},
-{37,1282,-1,-1,-1},
-{1283,-1,-1,-1,-1},
-{137,170,1284,-1,-1},
-{285,1285,-1,-1,-1},
-{283,1286,-1,-1,-1},
-{37,296,1287,-1,-1},
-{18,264,1288,-1,-1},
-{1289,-1,-1,-1,-1},
-{77,129,1290,-1,-1},
-{110,234,1291,-1,-1},
-{152,1292,-1,-1,-1},
-{242,1293,-1,-1,-1},
-{148,275,1294,-1,-1},
-{17,19,1295,-1,-1},
-{102,198,1296,-1,-1},
-{105,136,1297,-1,-1},
-{16,1298,-1,-1,-1},
-{50,1299,-1,-1,-1},
-{31,117,1300,-1,-1},
-{61,1301,-1,-1,-1},
-{1302,-1,-1,-1,-1},
-{150,1303,-1,-1,-1},
-{93,244,1304,-1,-1},
-{1305,-1,-1,-1,-1},
-{54,164,176,1306,-1},
-{1307,-1,-1,-1,-1},
-{125,1308,-1,-1,-1},
-{100,132,1309,-1,-1},
-{1310,-1,-1,-1,-1},
-{38,1311,-1,-1,-1},
-{1312,-1,-1,-1,-1},
-{138,171,1313,-1,-1},
-{286,1314,-1,-1,-1},
-{284,1315,-1,-1,-1},
-{38,297,1316,-1,-1},
-{19,265,1317,-1,-1},
-{1318,-1,-1,-1,-1},
-{78,130,280,1319,-1},
-{111,235,1320,-1,-1},
-{153,1321,-1,-1,-1},
-{243,1322,-1,-1,-1},
-{149,276,1323,-1,-1},
-{18,1324,-1,-1,-1},
-{103,199,1325,-1,-1},
-{106,137,1326,-1,-1},
-{17,1327,-1,-1,-1},
-{51,1328,-1,-1,-1},
-{32,118,1329,-1,-1},
-{20,62,1330,-1,-1},
-{1331,-1,-1,-1,-1},
-{151,1332,-1,-1,-1},
-{94,245,1333,-1,-1},
-{1334,-1,-1,-1,-1},
-{55,165,177,1335,-1},
-{1336,-1,-1,-1,-1},
-{126,1337,-1,-1,-1},
-{101,133,1338,-1,-1},
-{1339,-1,-1,-1,-1},
-{39,1340,-1,-1,-1},
-{1341,-1,-1,-1,-1},
-{139,172,1342,-1,-1},
-{40,287,1343,-1,-1},
-{285,1344,-1,-1,-1},
-{39,298,1345,-1,-1},
-{266,1346,-1,-1,-1},
-{1347,-1,-1,-1,-1},
-{79,131,281,1348,-1},
-{112,236,1349,-1,-1},
-{154,1350,-1,-1,-1},
-{244,1351,-1,-1,-1},
-{150,277,1352,-1,-1},
-{19,1353,-1,-1,-1},
-{104,1354,-1,-1,-1},
-{107,138,1355,-1,-1},
-{18,160,1356,-1,-1},
-{52,1357,-1,-1,-1},
-{33,119,1358,-1,-1},
-{21,60,63,1359,-1},
-{1360,-1,-1,-1,-1},
-{152,1361,-1,-1,-1},
-{95,246,1362,-1,-1},
-{120,1363,-1,-1,-1},
-{56,166,178,1364,-1},
-{1365,-1,-1,-1,-1},
-{127,1366,-1,-1,-1},
-{102,134,1367,-1,-1},
-{1368,-1,-1,-1,-1},
-{1369,-1,-1,-1,-1},
-{1370,-1,-1,-1,-1},
-{173,1371,-1,-1,-1},
-{41,288,1372,-1,-1},
-{286,1373,-1,-1,-1},
-{299,1374,-1,-1,-1},
-{267,1375,-1,-1,-1},
-{1376,-1,-1,-1,-1},
-{132,282,1377,-1,-1},
-{113,237,1378,-1,-1},
-{155,1379,-1,-1,-1},
-{245,1380,-1,-1,-1},
-{151,278,1381,-1,-1},
-{1382,-1,-1,-1,-1},
-{105,1383,-1,-1,-1},
-{108,139,1384,-1,-1},
-{19,161,1385,-1,-1},
-{53,1386,-1,-1,-1},
-{34,1387,-1,-1,-1},
-{22,61,64,1388,-1},
-{1389,-1,-1,-1,-1},
-{153,1390,-1,-1,-1},
-{96,247,1391,-1,-1},
-{121,1392,-1,-1,-1},
-{57,167,179,1393,-1},
-{1394,-1,-1,-1,-1},
-{128,1395,-1,-1,-1},
-{103,135,1396,-1,-1},
-{1397,-1,-1,-1,-1},
-{60,1398,-1,-1,-1},
-{1399,-1,-1,-1,-1},
-{174,1400,-1,-1,-1},
-{42,289,1401,-1,-1},
-{287,1402,-1,-1,-1},
-{1403,-1,-1,-1,-1},
-{268,1404,-1,-1,-1},
-{1405,-1,-1,-1,-1},
-{133,283,1406,-1,-1},
-{114,238,1407,-1,-1},
-{156,1408,-1,-1,-1},
-{246,1409,-1,-1,-1},
-{152,279,1410,-1,-1},
-{1411,-1,-1,-1,-1},
-{106,1412,-1,-1,-1},
-{109,1413,-1,-1,-1},
-{162,1414,-1,-1,-1},
-{54,1415,-1,-1,-1},
-{35,1416,-1,-1,-1},
-{23,62,65,1417,-1},
-{1418,-1,-1,-1,-1},
-{154,1419,-1,-1,-1},
-{97,248,1420,-1,-1},
-{122,1421,-1,-1,-1},
-{58,168,1422,-1,-1},
-{260,1423,-1,-1,-1},
-{129,1424,-1,-1,-1},
-{104,136,1425,-1,-1},
-{1426,-1,-1,-1,-1},
-{61,1427,-1,-1,-1},
-{1428,-1,-1,-1,-1},
-{175,1429,-1,-1,-1},
-{43,290,1430,-1,-1},
-{288,1431,-1,-1,-1},
-{1432,-1,-1,-1,-1},
-{269,1433,-1,-1,-1},
-{1434,-1,-1,-1,-1},
-{134,284,1435,-1,-1},
-{115,239,1436,-1,-1},
-{157,1437,-1,-1,-1},
-{247,1438,-1,-1,-1},
-{153,1439,-1,-1,-1},
-{1440,-1,-1,-1,-1},
-{107,1441,-1,-1,-1},
-{110,140,1442,-1,-1},
-{163,1443,-1,-1,-1},
-{55,1444,-1,-1,-1},
-{36,1445,-1,-1,-1},
-{24,63,66,1446,-1},
-{1447,-1,-1,-1,-1},
-{155,1448,-1,-1,-1},
-{98,249,1449,-1,-1},
-{123,260,1450,-1,-1},
-{59,169,1451,-1,-1},
-{261,1452,-1,-1,-1},
-{130,1453,-1,-1,-1},
-{105,137,1454,-1,-1},
-{1455,-1,-1,-1,-1},
-{62,1456,-1,-1,-1},
-{1457,-1,-1,-1,-1},
-{176,1458,-1,-1,-1},
-{44,291,1459,-1,-1},
-{289,1460,-1,-1,-1},
-{1461,-1,-1,-1,-1},
-{270,1462,-1,-1,-1},
-{1463,-1,-1,-1,-1},
-{135,285,1464,-1,-1},
-{116,1465,-1,-1,-1},
-{158,1466,-1,-1,-1},
-{248,1467,-1,-1,-1},
-{154,1468,-1,-1,-1},
-{1469,-1,-1,-1,-1},
-{108,1470,-1,-1,-1},
-{111,141,1471,-1,-1},
-{164,1472,-1,-1,-1},
-{56,1473,-1,-1,-1},
-{37,1474,-1,-1,-1},
-{25,64,67,1475,-1},
-{1476,-1,-1,-1,-1},
-{156,1477,-1,-1,-1},
-{99,250,1478,-1,-1},
-{124,261,1479,-1,-1},
-{170,1480,-1,-1,-1},
-{262,1481,-1,-1,-1},
-{131,1482,-1,-1,-1},
-{106,138,1483,-1,-1},
-{1484,-1,-1,-1,-1},
-{63,1485,-1,-1,-1},
-{1486,-1,-1,-1,-1},
-{177,1487,-1,-1,-1},
-{45,292,1488,-1,-1},
-{290,1489,-1,-1,-1},
-{1490,-1,-1,-1,-1},
-{271,1491,-1,-1,-1},
-{1492,-1,-1,-1,-1},
-{136,286,1493,-1,-1},
-{117,1494,-1,-1,-1},
-{159,1495,-1,-1,-1},
-{249,1496,-1,-1,-1},
-{0,155,1497,-1,-1},
-{1498,-1,-1,-1,-1},
-{109,1499,-1,-1,-1},
-{112,142,1500,-1,-1},
-{165,1501,-1,-1,-1},
-{57,1502,-1,-1,-1},
-{38,240,1503,-1,-1},
-{26,65,68,1504,-1},
-{1505,-1,-1,-1,-1},
-{157,1506,-1,-1,-1},
-{251,1507,-1,-1,-1},
-{40,125,262,1508,-1},
-{171,1509,-1,-1,-1},
-{263,1510,-1,-1,-1},
-{132,1511,-1,-1,-1},
-{107,139,1512,-1,-1},
-{1513,-1,-1,-1,-1},
-{64,1514,-1,-1,-1},
-{1515,-1,-1,-1,-1},
-{178,1516,-1,-1,-1},
-{46,293,1517,-1,-1},
-{291,1518,-1,-1,-1},
-{1519,-1,-1,-1,-1},
-{272,1520,-1,-1,-1},
-{120,1521,-1,-1,-1},
-{137,287,1522,-1,-1},
-{118,1523,-1,-1,-1},
-{1524,-1,-1,-1,-1},
-{250,1525,-1,-1,-1},
-{1,156,1526,-1,-1},
-{1527,-1,-1,-1,-1},
-{110,1528,-1,-1,-1},
-{113,143,1529,-1,-1},
-{166,1530,-1,-1,-1},
-{58,1531,-1,-1,-1},
-{39,241,1532,-1,-1},
-{27,66,69,1533,-1},
-{1534,-1,-1,-1,-1},
-{158,1535,-1,-1,-1},
-{252,1536,-1,-1,-1},
-{41,126,263,1537,-1},
-{172,1538,-1,-1,-1},
-{264,1539,-1,-1,-1},
-{133,1540,-1,-1,-1},
-{108,1541,-1,-1,-1},
-{1542,-1,-1,-1,-1},
-{65,1543,-1,-1,-1},
-{1544,-1,-1,-1,-1},
-{179,1545,-1,-1,-1},
-{47,120,294,1546,-1},
-{292,1547,-1,-1,-1},
-{1548,-1,-1,-1,-1},
-{273,1549,-1,-1,-1},
-{121,1550,-1,-1,-1},
-{138,288,1551,-1,-1},
-{119,1552,-1,-1,-1},
-{1553,-1,-1,-1,-1},
-{251,1554,-1,-1,-1},
-{2,157,1555,-1,-1},
-{1556,-1,-1,-1,-1},
-{111,1557,-1,-1,-1},
-{114,144,1558,-1,-1},
-{167,1559,-1,-1,-1},
-{59,1560,-1,-1,-1},
-{242,1561,-1,-1,-1},
-{28,67,70,1562,-1},
-{1563,-1,-1,-1,-1},
-{159,1564,-1,-1,-1},
-{253,1565,-1,-1,-1},
-{42,127,264,1566,-1},
-{173,240,1567,-1,-1},
-{265,1568,-1,-1,-1},
-{134,1569,-1,-1,-1},
-{109,1570,-1,-1,-1},
-{1571,-1,-1,-1,-1},
-{66,1572,-1,-1,-1},
-{1573,-1,-1,-1,-1},
-{1574,-1,-1,-1,-1},
-{48,121,295,1575,-1},
-{293,1576,-1,-1,-1},
-{160,1577,-1,-1,-1},
-{274,1578,-1,-1,-1},
-{122,1579,-1,-1,-1},
-{139,289,1580,-1,-1},
-{1581,-1,-1,-1,-1},
-{1582,-1,-1,-1,-1},
-{252,1583,-1,-1,-1},
-{3,158,1584,-1,-1},
-{1585,-1,-1,-1,-1},
-{112,1586,-1,-1,-1},
-{115,145,1587,-1,-1},
-{168,1588,-1,-1,-1},
-{1589,-1,-1,-1,-1},
-{243,1590,-1,-1,-1},
-{29,68,71,1591,-1},
-{1592,-1,-1,-1,-1},
-{1593,-1,-1,-1,-1},
-{254,1594,-1,-1,-1},
-{43,128,265,1595,-1},
-{174,241,1596,-1,-1},
-{266,1597,-1,-1,-1},
-{135,1598,-1,-1,-1}};
-int mercury_normal_QCmatrixV_3_16[1600][9]={
-{47,402,467,503,535,445,1198,-1,-1},
-{76,431,496,532,564,474,1227,-1,-1},
-{105,460,525,561,593,503,1256,-1,-1},
-{134,489,554,590,622,532,1285,-1,-1},
-{163,518,583,619,651,561,14,-1,-1},
-{192,547,612,648,680,590,43,-1,-1},
-{221,576,641,677,709,619,72,-1,-1},
-{250,605,670,706,738,648,101,-1,-1},
-{279,634,699,735,767,677,130,-1,-1},
-{308,663,728,764,796,706,159,-1,-1},
-{337,692,757,793,825,735,188,-1,-1},
-{366,721,786,822,854,764,217,-1,-1},
-{395,750,815,851,883,793,246,-1,-1},
-{424,779,844,880,912,822,275,-1,-1},
-{453,808,873,909,941,851,304,-1,-1},
-{482,837,902,938,970,880,333,-1,-1},
-{511,866,931,967,999,909,362,-1,-1},
-{540,895,960,996,1028,938,391,-1,-1},
-{569,924,989,1025,1057,967,420,-1,-1},
-{598,953,1018,1054,1086,996,449,-1,-1},
-{316,490,682,495,1031,-1,-1,-1,-1},
-{345,519,711,524,1060,-1,-1,-1,-1},
-{374,548,740,553,1089,-1,-1,-1,-1},
-{403,577,769,582,1118,-1,-1,-1,-1},
-{432,606,798,611,1147,-1,-1,-1,-1},
-{461,635,827,640,1176,-1,-1,-1,-1},
-{490,664,856,669,1205,-1,-1,-1,-1},
-{519,693,885,698,1234,-1,-1,-1,-1},
-{548,722,914,727,1263,-1,-1,-1,-1},
-{577,751,943,756,1292,-1,-1,-1,-1},
-{606,780,972,785,21,-1,-1,-1,-1},
-{635,809,1001,814,50,-1,-1,-1,-1},
-{664,838,1030,843,79,-1,-1,-1,-1},
-{693,867,1059,872,108,-1,-1,-1,-1},
-{722,896,1088,901,137,-1,-1,-1,-1},
-{751,925,1117,930,166,-1,-1,-1,-1},
-{780,954,1146,959,195,-1,-1,-1,-1},
-{809,983,1175,988,224,-1,-1,-1,-1},
-{838,1012,1204,1017,253,-1,-1,-1,-1},
-{867,1041,1233,1046,282,-1,-1,-1,-1},
-{357,414,1209,1044,29,601,710,-1,-1},
-{386,443,1238,1073,58,630,739,-1,-1},
-{415,472,1267,1102,87,659,768,-1,-1},
-{444,501,1296,1131,116,688,797,-1,-1},
-{473,530,25,1160,145,717,826,-1,-1},
-{502,559,54,1189,174,746,855,-1,-1},
-{531,588,83,1218,203,775,884,-1,-1},
-{560,617,112,1247,232,804,913,-1,-1},
-{589,646,141,1276,261,833,942,-1,-1},
-{618,675,170,5,290,862,971,-1,-1},
-{647,704,199,34,319,891,1000,-1,-1},
-{676,733,228,63,348,920,1029,-1,-1},
-{705,762,257,92,377,949,1058,-1,-1},
-{734,791,286,121,406,978,1087,-1,-1},
-{763,820,315,150,435,1007,1116,-1,-1},
-{792,849,344,179,464,1036,1145,-1,-1},
-{821,878,373,208,493,1065,1174,-1,-1},
-{850,907,402,237,522,1094,1203,-1,-1},
-{879,936,431,266,551,1123,1232,-1,-1},
-{908,965,460,295,580,1152,1261,-1,-1},
-{306,498,973,101,1060,1099,181,219,243},
-{335,527,1002,130,1089,1128,210,248,272},
-{364,556,1031,159,1118,1157,239,277,301},
-{393,585,1060,188,1147,1186,268,306,330},
-{422,614,1089,217,1176,1215,297,335,359},
-{451,643,1118,246,1205,1244,326,364,388},
-{480,672,1147,275,1234,1273,355,393,417},
-{509,701,1176,304,1263,2,384,422,446},
-{538,730,1205,333,1292,31,413,451,475},
-{567,759,1234,362,21,60,442,480,504},
-{596,788,1263,391,50,89,471,509,533},
-{625,817,1292,420,79,118,500,538,562},
-{654,846,21,449,108,147,529,567,591},
-{683,875,50,478,137,176,558,596,620},
-{712,904,79,507,166,205,587,625,649},
-{741,933,108,536,195,234,616,654,678},
-{770,962,137,565,224,263,645,683,707},
-{799,991,166,594,253,292,674,712,736},
-{828,1020,195,623,282,321,703,741,765},
-{857,1049,224,652,311,350,732,770,794},
-{62,296,628,-1,-1,-1,-1,-1,-1},
-{91,325,657,-1,-1,-1,-1,-1,-1},
-{120,354,686,-1,-1,-1,-1,-1,-1},
-{149,383,715,-1,-1,-1,-1,-1,-1},
-{178,412,744,-1,-1,-1,-1,-1,-1},
-{207,441,773,-1,-1,-1,-1,-1,-1},
-{236,470,802,-1,-1,-1,-1,-1,-1},
-{265,499,831,-1,-1,-1,-1,-1,-1},
-{294,528,860,-1,-1,-1,-1,-1,-1},
-{323,557,889,-1,-1,-1,-1,-1,-1},
-{352,586,918,-1,-1,-1,-1,-1,-1},
-{381,615,947,-1,-1,-1,-1,-1,-1},
-{410,644,976,-1,-1,-1,-1,-1,-1},
-{439,673,1005,-1,-1,-1,-1,-1,-1},
-{468,702,1034,-1,-1,-1,-1,-1,-1},
-{497,731,1063,-1,-1,-1,-1,-1,-1},
-{526,760,1092,-1,-1,-1,-1,-1,-1},
-{555,789,1121,-1,-1,-1,-1,-1,-1},
-{584,818,1150,-1,-1,-1,-1,-1,-1},
-{613,847,1179,-1,-1,-1,-1,-1,-1},
-{327,120,222,1010,702,508,853,69,939},
-{356,149,251,1039,731,537,882,98,968},
-{385,178,280,1068,760,566,911,127,997},
-{414,207,309,1097,789,595,940,156,1026},
-{443,236,338,1126,818,624,969,185,1055},
-{472,265,367,1155,847,653,998,214,1084},
-{501,294,396,1184,876,682,1027,243,1113},
-{530,323,425,1213,905,711,1056,272,1142},
-{559,352,454,1242,934,740,1085,301,1171},
-{588,381,483,1271,963,769,1114,330,1200},
-{617,410,512,0,992,798,1143,359,1229},
-{646,439,541,29,1021,827,1172,388,1258},
-{675,468,570,58,1050,856,1201,417,1287},
-{704,497,599,87,1079,885,1230,446,16},
-{733,526,628,116,1108,914,1259,475,45},
-{762,555,657,145,1137,943,1288,504,74},
-{791,584,686,174,1166,972,17,533,103},
-{820,613,715,203,1195,1001,46,562,132},
-{849,642,744,232,1224,1030,75,591,161},
-{878,671,773,261,1253,1059,104,620,190},
-{492,534,662,730,864,1064,1222,1247,-1},
-{521,563,691,759,893,1093,1251,1276,-1},
-{550,592,720,788,922,1122,1280,5,-1},
-{579,621,749,817,951,1151,9,34,-1},
-{608,650,778,846,980,1180,38,63,-1},
-{637,679,807,875,1009,1209,67,92,-1},
-{666,708,836,904,1038,1238,96,121,-1},
-{695,737,865,933,1067,1267,125,150,-1},
-{724,766,894,962,1096,1296,154,179,-1},
-{753,795,923,991,1125,25,183,208,-1},
-{782,824,952,1020,1154,54,212,237,-1},
-{811,853,981,1049,1183,83,241,266,-1},
-{840,882,1010,1078,1212,112,270,295,-1},
-{869,911,1039,1107,1241,141,299,324,-1},
-{898,940,1068,1136,1270,170,328,353,-1},
-{927,969,1097,1165,1299,199,357,382,-1},
-{956,998,1126,1194,28,228,386,411,-1},
-{985,1027,1155,1223,57,257,415,440,-1},
-{1014,1056,1184,1252,86,286,444,469,-1},
-{1043,1085,1213,1281,115,315,473,498,-1},
-{388,645,714,763,1143,-1,-1,-1,-1},
-{417,674,743,792,1172,-1,-1,-1,-1},
-{446,703,772,821,1201,-1,-1,-1,-1},
-{475,732,801,850,1230,-1,-1,-1,-1},
-{504,761,830,879,1259,-1,-1,-1,-1},
-{533,790,859,908,1288,-1,-1,-1,-1},
-{562,819,888,937,17,-1,-1,-1,-1},
-{591,848,917,966,46,-1,-1,-1,-1},
-{620,877,946,995,75,-1,-1,-1,-1},
-{649,906,975,1024,104,-1,-1,-1,-1},
-{678,935,1004,1053,133,-1,-1,-1,-1},
-{707,964,1033,1082,162,-1,-1,-1,-1},
-{736,993,1062,1111,191,-1,-1,-1,-1},
-{765,1022,1091,1140,220,-1,-1,-1,-1},
-{794,1051,1120,1169,249,-1,-1,-1,-1},
-{823,1080,1149,1198,278,-1,-1,-1,-1},
-{852,1109,1178,1227,307,-1,-1,-1,-1},
-{881,1138,1207,1256,336,-1,-1,-1,-1},
-{910,1167,1236,1285,365,-1,-1,-1,-1},
-{939,1196,1265,14,394,-1,-1,-1,-1},
-{543,695,1278,13,891,145,65,1057,-1},
-{572,724,7,42,920,174,94,1086,-1},
-{601,753,36,71,949,203,123,1115,-1},
-{630,782,65,100,978,232,152,1144,-1},
-{659,811,94,129,1007,261,181,1173,-1},
-{688,840,123,158,1036,290,210,1202,-1},
-{717,869,152,187,1065,319,239,1231,-1},
-{746,898,181,216,1094,348,268,1260,-1},
-{775,927,210,245,1123,377,297,1289,-1},
-{804,956,239,274,1152,406,326,18,-1},
-{833,985,268,303,1181,435,355,47,-1},
-{862,1014,297,332,1210,464,384,76,-1},
-{891,1043,326,361,1239,493,413,105,-1},
-{920,1072,355,390,1268,522,442,134,-1},
-{949,1101,384,419,1297,551,471,163,-1},
-{978,1130,413,448,26,580,500,192,-1},
-{1007,1159,442,477,55,609,529,221,-1},
-{1036,1188,471,506,84,638,558,250,-1},
-{1065,1217,500,535,113,667,587,279,-1},
-{1094,1246,529,564,142,696,616,308,-1},
-{227,331,475,-1,-1,-1,-1,-1,-1},
-{256,360,504,-1,-1,-1,-1,-1,-1},
-{285,389,533,-1,-1,-1,-1,-1,-1},
-{314,418,562,-1,-1,-1,-1,-1,-1},
-{343,447,591,-1,-1,-1,-1,-1,-1},
-{372,476,620,-1,-1,-1,-1,-1,-1},
-{401,505,649,-1,-1,-1,-1,-1,-1},
-{430,534,678,-1,-1,-1,-1,-1,-1},
-{459,563,707,-1,-1,-1,-1,-1,-1},
-{488,592,736,-1,-1,-1,-1,-1,-1},
-{517,621,765,-1,-1,-1,-1,-1,-1},
-{546,650,794,-1,-1,-1,-1,-1,-1},
-{575,679,823,-1,-1,-1,-1,-1,-1},
-{604,708,852,-1,-1,-1,-1,-1,-1},
-{633,737,881,-1,-1,-1,-1,-1,-1},
-{662,766,910,-1,-1,-1,-1,-1,-1},
-{691,795,939,-1,-1,-1,-1,-1,-1},
-{720,824,968,-1,-1,-1,-1,-1,-1},
-{749,853,997,-1,-1,-1,-1,-1,-1},
-{778,882,1026,-1,-1,-1,-1,-1,-1},
-{110,409,174,-1,-1,-1,-1,-1,-1},
-{139,438,203,-1,-1,-1,-1,-1,-1},
-{168,467,232,-1,-1,-1,-1,-1,-1},
-{197,496,261,-1,-1,-1,-1,-1,-1},
-{226,525,290,-1,-1,-1,-1,-1,-1},
-{255,554,319,-1,-1,-1,-1,-1,-1},
-{284,583,348,-1,-1,-1,-1,-1,-1},
-{313,612,377,-1,-1,-1,-1,-1,-1},
-{342,641,406,-1,-1,-1,-1,-1,-1},
-{371,670,435,-1,-1,-1,-1,-1,-1},
-{400,699,464,-1,-1,-1,-1,-1,-1},
-{429,728,493,-1,-1,-1,-1,-1,-1},
-{458,757,522,-1,-1,-1,-1,-1,-1},
-{487,786,551,-1,-1,-1,-1,-1,-1},
-{516,815,580,-1,-1,-1,-1,-1,-1},
-{545,844,609,-1,-1,-1,-1,-1,-1},
-{574,873,638,-1,-1,-1,-1,-1,-1},
-{603,902,667,-1,-1,-1,-1,-1,-1},
-{632,931,696,-1,-1,-1,-1,-1,-1},
-{661,960,725,-1,-1,-1,-1,-1,-1},
-{175,293,586,-1,-1,-1,-1,-1,-1},
-{204,322,615,-1,-1,-1,-1,-1,-1},
-{233,351,644,-1,-1,-1,-1,-1,-1},
-{262,380,673,-1,-1,-1,-1,-1,-1},
-{291,409,702,-1,-1,-1,-1,-1,-1},
-{320,438,731,-1,-1,-1,-1,-1,-1},
-{349,467,760,-1,-1,-1,-1,-1,-1},
-{378,496,789,-1,-1,-1,-1,-1,-1},
-{407,525,818,-1,-1,-1,-1,-1,-1},
-{436,554,847,-1,-1,-1,-1,-1,-1},
-{465,583,876,-1,-1,-1,-1,-1,-1},
-{494,612,905,-1,-1,-1,-1,-1,-1},
-{523,641,934,-1,-1,-1,-1,-1,-1},
-{552,670,963,-1,-1,-1,-1,-1,-1},
-{581,699,992,-1,-1,-1,-1,-1,-1},
-{610,728,1021,-1,-1,-1,-1,-1,-1},
-{639,757,1050,-1,-1,-1,-1,-1,-1},
-{668,786,1079,-1,-1,-1,-1,-1,-1},
-{697,815,1108,-1,-1,-1,-1,-1,-1},
-{726,844,1137,-1,-1,-1,-1,-1,-1},
-{86,132,231,889,936,1204,340,1268,-1},
-{115,161,260,918,965,1233,369,1297,-1},
-{144,190,289,947,994,1262,398,26,-1},
-{173,219,318,976,1023,1291,427,55,-1},
-{202,248,347,1005,1052,20,456,84,-1},
-{231,277,376,1034,1081,49,485,113,-1},
-{260,306,405,1063,1110,78,514,142,-1},
-{289,335,434,1092,1139,107,543,171,-1},
-{318,364,463,1121,1168,136,572,200,-1},
-{347,393,492,1150,1197,165,601,229,-1},
-{376,422,521,1179,1226,194,630,258,-1},
-{405,451,550,1208,1255,223,659,287,-1},
-{434,480,579,1237,1284,252,688,316,-1},
-{463,509,608,1266,13,281,717,345,-1},
-{492,538,637,1295,42,310,746,374,-1},
-{521,567,666,24,71,339,775,403,-1},
-{550,596,695,53,100,368,804,432,-1},
-{579,625,724,82,129,397,833,461,-1},
-{608,654,753,111,158,426,862,490,-1},
-{637,683,782,140,187,455,891,519,-1},
-{63,323,13,411,1151,873,1124,560,270},
-{92,352,42,440,1180,902,1153,589,299},
-{121,381,71,469,1209,931,1182,618,328},
-{150,410,100,498,1238,960,1211,647,357},
-{179,439,129,527,1267,989,1240,676,386},
-{208,468,158,556,1296,1018,1269,705,415},
-{237,497,187,585,25,1047,1298,734,444},
-{266,526,216,614,54,1076,27,763,473},
-{295,555,245,643,83,1105,56,792,502},
-{324,584,274,672,112,1134,85,821,531},
-{353,613,303,701,141,1163,114,850,560},
-{382,642,332,730,170,1192,143,879,589},
-{411,671,361,759,199,1221,172,908,618},
-{440,700,390,788,228,1250,201,937,647},
-{469,729,419,817,257,1279,230,966,676},
-{498,758,448,846,286,8,259,995,705},
-{527,787,477,875,315,37,288,1024,734},
-{556,816,506,904,344,66,317,1053,763},
-{585,845,535,933,373,95,346,1082,792},
-{614,874,564,962,402,124,375,1111,821},
-{331,900,841,1020,524,-1,-1,-1,-1},
-{360,929,870,1049,553,-1,-1,-1,-1},
-{389,958,899,1078,582,-1,-1,-1,-1},
-{418,987,928,1107,611,-1,-1,-1,-1},
-{447,1016,957,1136,640,-1,-1,-1,-1},
-{476,1045,986,1165,669,-1,-1,-1,-1},
-{505,1074,1015,1194,698,-1,-1,-1,-1},
-{534,1103,1044,1223,727,-1,-1,-1,-1},
-{563,1132,1073,1252,756,-1,-1,-1,-1},
-{592,1161,1102,1281,785,-1,-1,-1,-1},
-{621,1190,1131,10,814,-1,-1,-1,-1},
-{650,1219,1160,39,843,-1,-1,-1,-1},
-{679,1248,1189,68,872,-1,-1,-1,-1},
-{708,1277,1218,97,901,-1,-1,-1,-1},
-{737,6,1247,126,930,-1,-1,-1,-1},
-{766,35,1276,155,959,-1,-1,-1,-1},
-{795,64,5,184,988,-1,-1,-1,-1},
-{824,93,34,213,1017,-1,-1,-1,-1},
-{853,122,63,242,1046,-1,-1,-1,-1},
-{882,151,92,271,1075,-1,-1,-1,-1},
-{0,1,-1,-1,-1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1,-1,-1,-1},
-{199,200,-1,-1,-1,-1,-1,-1,-1},
-{200,201,-1,-1,-1,-1,-1,-1,-1},
-{201,202,-1,-1,-1,-1,-1,-1,-1},
-{202,203,-1,-1,-1,-1,-1,-1,-1},
-{203,204,-1,-1,-1,-1,-1,-1,-1},
-{204,205,-1,-1,-1,-1,-1,-1,-1},
-{205,206,-1,-1,-1,-1,-1,-1,-1},
-{206,207,-1,-1,-1,-1,-1,-1,-1},
-{207,208,-1,-1,-1,-1,-1,-1,-1},
-{208,209,-1,-1,-1,-1,-1,-1,-1},
-{209,210,-1,-1,-1,-1,-1,-1,-1},
-{210,211,-1,-1,-1,-1,-1,-1,-1},
-{211,212,-1,-1,-1,-1,-1,-1,-1},
-{212,213,-1,-1,-1,-1,-1,-1,-1},
-{213,214,-1,-1,-1,-1,-1,-1,-1},
-{214,215,-1,-1,-1,-1,-1,-1,-1},
-{215,216,-1,-1,-1,-1,-1,-1,-1},
-{216,217,-1,-1,-1,-1,-1,-1,-1},
-{217,218,-1,-1,-1,-1,-1,-1,-1},
-{218,219,-1,-1,-1,-1,-1,-1,-1},
-{219,220,-1,-1,-1,-1,-1,-1,-1},
-{220,221,-1,-1,-1,-1,-1,-1,-1},
-{221,222,-1,-1,-1,-1,-1,-1,-1},
-{222,223,-1,-1,-1,-1,-1,-1,-1},
-{223,224,-1,-1,-1,-1,-1,-1,-1},
-{224,225,-1,-1,-1,-1,-1,-1,-1},
-{225,226,-1,-1,-1,-1,-1,-1,-1},
-{226,227,-1,-1,-1,-1,-1,-1,-1},
-{227,228,-1,-1,-1,-1,-1,-1,-1},
-{228,229,-1,-1,-1,-1,-1,-1,-1},
-{229,230,-1,-1,-1,-1,-1,-1,-1},
-{230,231,-1,-1,-1,-1,-1,-1,-1},
-{231,232,-1,-1,-1,-1,-1,-1,-1},
-{232,233,-1,-1,-1,-1,-1,-1,-1},
-{233,234,-1,-1,-1,-1,-1,-1,-1},
-{234,235,-1,-1,-1,-1,-1,-1,-1},
-{235,236,-1,-1,-1,-1,-1,-1,-1},
-{236,237,-1,-1,-1,-1,-1,-1,-1},
-{237,238,-1,-1,-1,-1,-1,-1,-1},
-{238,239,-1,-1,-1,-1,-1,-1,-1},
-{239,240,-1,-1,-1,-1,-1,-1,-1},
-{240,241,-1,-1,-1,-1,-1,-1,-1},
-{241,242,-1,-1,-1,-1,-1,-1,-1},
-{242,243,-1,-1,-1,-1,-1,-1,-1},
-{243,244,-1,-1,-1,-1,-1,-1,-1},
-{244,245,-1,-1,-1,-1,-1,-1,-1},
-{245,246,-1,-1,-1,-1,-1,-1,-1},
-{246,247,-1,-1,-1,-1,-1,-1,-1},
-{247,248,-1,-1,-1,-1,-1,-1,-1},
-{248,249,-1,-1,-1,-1,-1,-1,-1},
-{249,250,-1,-1,-1,-1,-1,-1,-1},
-{250,251,-1,-1,-1,-1,-1,-1,-1},
-{251,252,-1,-1,-1,-1,-1,-1,-1},
-{252,253,-1,-1,-1,-1,-1,-1,-1},
-{253,254,-1,-1,-1,-1,-1,-1,-1},
-{254,255,-1,-1,-1,-1,-1,-1,-1},
-{255,256,-1,-1,-1,-1,-1,-1,-1},
-{256,257,-1,-1,-1,-1,-1,-1,-1},
-{257,258,-1,-1,-1,-1,-1,-1,-1},
-{258,259,-1,-1,-1,-1,-1,-1,-1},
-{259,260,-1,-1,-1,-1,-1,-1,-1},
-{260,261,-1,-1,-1,-1,-1,-1,-1},
-{261,262,-1,-1,-1,-1,-1,-1,-1},
-{262,263,-1,-1,-1,-1,-1,-1,-1},
-{263,264,-1,-1,-1,-1,-1,-1,-1},
-{264,265,-1,-1,-1,-1,-1,-1,-1},
-{265,266,-1,-1,-1,-1,-1,-1,-1},
-{266,267,-1,-1,-1,-1,-1,-1,-1},
-{267,268,-1,-1,-1,-1,-1,-1,-1},
-{268,269,-1,-1,-1,-1,-1,-1,-1},
-{269,270,-1,-1,-1,-1,-1,-1,-1},
-{270,271,-1,-1,-1,-1,-1,-1,-1},
-{271,272,-1,-1,-1,-1,-1,-1,-1},
-{272,273,-1,-1,-1,-1,-1,-1,-1},
-{273,274,-1,-1,-1,-1,-1,-1,-1},
-{274,275,-1,-1,-1,-1,-1,-1,-1},
-{275,276,-1,-1,-1,-1,-1,-1,-1},
-{276,277,-1,-1,-1,-1,-1,-1,-1},
-{277,278,-1,-1,-1,-1,-1,-1,-1},
-{278,279,-1,-1,-1,-1,-1,-1,-1},
-{279,280,-1,-1,-1,-1,-1,-1,-1},
-{280,281,-1,-1,-1,-1,-1,-1,-1},
-{281,282,-1,-1,-1,-1,-1,-1,-1},
-{282,283,-1,-1,-1,-1,-1,-1,-1},
-{283,284,-1,-1,-1,-1,-1,-1,-1},
-{284,285,-1,-1,-1,-1,-1,-1,-1},
-{285,286,-1,-1,-1,-1,-1,-1,-1},
-{286,287,-1,-1,-1,-1,-1,-1,-1},
-{287,288,-1,-1,-1,-1,-1,-1,-1},
-{288,289,-1,-1,-1,-1,-1,-1,-1},
-{289,290,-1,-1,-1,-1,-1,-1,-1},
-{290,291,-1,-1,-1,-1,-1,-1,-1},
-{291,292,-1,-1,-1,-1,-1,-1,-1},
-{292,293,-1,-1,-1,-1,-1,-1,-1},
-{293,294,-1,-1,-1,-1,-1,-1,-1},
-{294,295,-1,-1,-1,-1,-1,-1,-1},
-{295,296,-1,-1,-1,-1,-1,-1,-1},
-{296,297,-1,-1,-1,-1,-1,-1,-1},
-{297,298,-1,-1,-1,-1,-1,-1,-1},
-{298,299,-1,-1,-1,-1,-1,-1,-1},
-{299,300,-1,-1,-1,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1,-1,-1,-1},
-{301,302,-1,-1,-1,-1,-1,-1,-1},
-{302,303,-1,-1,-1,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1,-1,-1,-1},
-{304,305,-1,-1,-1,-1,-1,-1,-1},
-{305,306,-1,-1,-1,-1,-1,-1,-1},
-{306,307,-1,-1,-1,-1,-1,-1,-1},
-{307,308,-1,-1,-1,-1,-1,-1,-1},
-{308,309,-1,-1,-1,-1,-1,-1,-1},
-{309,310,-1,-1,-1,-1,-1,-1,-1},
-{310,311,-1,-1,-1,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1,-1,-1,-1},
-{312,313,-1,-1,-1,-1,-1,-1,-1},
-{313,314,-1,-1,-1,-1,-1,-1,-1},
-{314,315,-1,-1,-1,-1,-1,-1,-1},
-{315,316,-1,-1,-1,-1,-1,-1,-1},
-{316,317,-1,-1,-1,-1,-1,-1,-1},
-{317,318,-1,-1,-1,-1,-1,-1,-1},
-{318,319,-1,-1,-1,-1,-1,-1,-1},
-{319,320,-1,-1,-1,-1,-1,-1,-1},
-{320,321,-1,-1,-1,-1,-1,-1,-1},
-{321,322,-1,-1,-1,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1,-1,-1,-1},
-{323,324,-1,-1,-1,-1,-1,-1,-1},
-{324,325,-1,-1,-1,-1,-1,-1,-1},
-{325,326,-1,-1,-1,-1,-1,-1,-1},
-{326,327,-1,-1,-1,-1,-1,-1,-1},
-{327,328,-1,-1,-1,-1,-1,-1,-1},
-{328,329,-1,-1,-1,-1,-1,-1,-1},
-{329,330,-1,-1,-1,-1,-1,-1,-1},
-{330,331,-1,-1,-1,-1,-1,-1,-1},
-{331,332,-1,-1,-1,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1,-1,-1,-1},
-{333,334,-1,-1,-1,-1,-1,-1,-1},
-{334,335,-1,-1,-1,-1,-1,-1,-1},
-{335,336,-1,-1,-1,-1,-1,-1,-1},
-{336,337,-1,-1,-1,-1,-1,-1,-1},
-{337,338,-1,-1,-1,-1,-1,-1,-1},
-{338,339,-1,-1,-1,-1,-1,-1,-1},
-{339,340,-1,-1,-1,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1,-1,-1,-1},
-{341,342,-1,-1,-1,-1,-1,-1,-1},
-{342,343,-1,-1,-1,-1,-1,-1,-1},
-{343,344,-1,-1,-1,-1,-1,-1,-1},
-{344,345,-1,-1,-1,-1,-1,-1,-1},
-{345,346,-1,-1,-1,-1,-1,-1,-1},
-{346,347,-1,-1,-1,-1,-1,-1,-1},
-{347,348,-1,-1,-1,-1,-1,-1,-1},
-{348,349,-1,-1,-1,-1,-1,-1,-1},
-{349,350,-1,-1,-1,-1,-1,-1,-1},
-{350,351,-1,-1,-1,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1,-1,-1,-1},
-{352,353,-1,-1,-1,-1,-1,-1,-1},
-{353,354,-1,-1,-1,-1,-1,-1,-1},
-{354,355,-1,-1,-1,-1,-1,-1,-1},
-{355,356,-1,-1,-1,-1,-1,-1,-1},
-{356,357,-1,-1,-1,-1,-1,-1,-1},
-{357,358,-1,-1,-1,-1,-1,-1,-1},
-{358,359,-1,-1,-1,-1,-1,-1,-1},
-{359,360,-1,-1,-1,-1,-1,-1,-1},
-{360,361,-1,-1,-1,-1,-1,-1,-1},
-{361,362,-1,-1,-1,-1,-1,-1,-1},
-{362,363,-1,-1,-1,-1,-1,-1,-1},
-{363,364,-1,-1,-1,-1,-1,-1,-1},
-{364,365,-1,-1,-1,-1,-1,-1,-1},
-{365,366,-1,-1,-1,-1,-1,-1,-1},
-{366,367,-1,-1,-1,-1,-1,-1,-1},
-{367,368,-1,-1,-1,-1,-1,-1,-1},
-{368,369,-1,-1,-1,-1,-1,-1,-1},
-{369,370,-1,-1,-1,-1,-1,-1,-1},
-{370,371,-1,-1,-1,-1,-1,-1,-1},
-{371,372,-1,-1,-1,-1,-1,-1,-1},
-{372,373,-1,-1,-1,-1,-1,-1,-1},
-{373,374,-1,-1,-1,-1,-1,-1,-1},
-{374,375,-1,-1,-1,-1,-1,-1,-1},
-{375,376,-1,-1,-1,-1,-1,-1,-1},
-{376,377,-1,-1,-1,-1,-1,-1,-1},
-{377,378,-1,-1,-1,-1,-1,-1,-1},
-{378,379,-1,-1,-1,-1,-1,-1,-1},
-{379,380,-1,-1,-1,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1,-1,-1,-1},
-{381,382,-1,-1,-1,-1,-1,-1,-1},
-{382,383,-1,-1,-1,-1,-1,-1,-1},
-{383,384,-1,-1,-1,-1,-1,-1,-1},
-{384,385,-1,-1,-1,-1,-1,-1,-1},
-{385,386,-1,-1,-1,-1,-1,-1,-1},
-{386,387,-1,-1,-1,-1,-1,-1,-1},
-{387,388,-1,-1,-1,-1,-1,-1,-1},
-{388,389,-1,-1,-1,-1,-1,-1,-1},
-{389,390,-1,-1,-1,-1,-1,-1,-1},
-{390,391,-1,-1,-1,-1,-1,-1,-1},
-{391,392,-1,-1,-1,-1,-1,-1,-1},
-{392,393,-1,-1,-1,-1,-1,-1,-1},
-{393,394,-1,-1,-1,-1,-1,-1,-1},
-{394,395,-1,-1,-1,-1,-1,-1,-1},
-{395,396,-1,-1,-1,-1,-1,-1,-1},
-{396,397,-1,-1,-1,-1,-1,-1,-1},
-{397,398,-1,-1,-1,-1,-1,-1,-1},
-{398,399,-1,-1,-1,-1,-1,-1,-1},
-{399,400,-1,-1,-1,-1,-1,-1,-1},
-{400,401,-1,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1,-1},
-{402,403,-1,-1,-1,-1,-1,-1,-1},
-{403,404,-1,-1,-1,-1,-1,-1,-1},
-{404,405,-1,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1,-1},
-{406,407,-1,-1,-1,-1,-1,-1,-1},
-{407,408,-1,-1,-1,-1,-1,-1,-1},
-{408,409,-1,-1,-1,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1,-1},
-{410,411,-1,-1,-1,-1,-1,-1,-1},
-{411,412,-1,-1,-1,-1,-1,-1,-1},
-{412,413,-1,-1,-1,-1,-1,-1,-1},
-{413,414,-1,-1,-1,-1,-1,-1,-1},
-{414,415,-1,-1,-1,-1,-1,-1,-1},
-{415,416,-1,-1,-1,-1,-1,-1,-1},
-{416,417,-1,-1,-1,-1,-1,-1,-1},
-{417,418,-1,-1,-1,-1,-1,-1,-1},
-{418,419,-1,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1,-1},
-{420,421,-1,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1,-1},
-{422,423,-1,-1,-1,-1,-1,-1,-1},
-{423,424,-1,-1,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1,-1},
-{425,426,-1,-1,-1,-1,-1,-1,-1},
-{426,427,-1,-1,-1,-1,-1,-1,-1},
-{427,428,-1,-1,-1,-1,-1,-1,-1},
-{428,429,-1,-1,-1,-1,-1,-1,-1},
-{429,430,-1,-1,-1,-1,-1,-1,-1},
-{430,431,-1,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1,-1},
-{432,433,-1,-1,-1,-1,-1,-1,-1},
-{433,434,-1,-1,-1,-1,-1,-1,-1},
-{434,435,-1,-1,-1,-1,-1,-1,-1},
-{435,436,-1,-1,-1,-1,-1,-1,-1},
-{436,437,-1,-1,-1,-1,-1,-1,-1},
-{437,438,-1,-1,-1,-1,-1,-1,-1},
-{438,439,-1,-1,-1,-1,-1,-1,-1},
-{439,440,-1,-1,-1,-1,-1,-1,-1},
-{440,441,-1,-1,-1,-1,-1,-1,-1},
-{441,442,-1,-1,-1,-1,-1,-1,-1},
-{442,443,-1,-1,-1,-1,-1,-1,-1},
-{443,444,-1,-1,-1,-1,-1,-1,-1},
-{444,445,-1,-1,-1,-1,-1,-1,-1},
-{445,446,-1,-1,-1,-1,-1,-1,-1},
-{446,447,-1,-1,-1,-1,-1,-1,-1},
-{447,448,-1,-1,-1,-1,-1,-1,-1},
-{448,449,-1,-1,-1,-1,-1,-1,-1},
-{449,450,-1,-1,-1,-1,-1,-1,-1},
-{450,451,-1,-1,-1,-1,-1,-1,-1},
-{451,452,-1,-1,-1,-1,-1,-1,-1},
-{452,453,-1,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1,-1},
-{454,455,-1,-1,-1,-1,-1,-1,-1},
-{455,456,-1,-1,-1,-1,-1,-1,-1},
-{456,457,-1,-1,-1,-1,-1,-1,-1},
-{457,458,-1,-1,-1,-1,-1,-1,-1},
-{458,459,-1,-1,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1,-1},
-{460,461,-1,-1,-1,-1,-1,-1,-1},
-{461,462,-1,-1,-1,-1,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1,-1},
-{463,464,-1,-1,-1,-1,-1,-1,-1},
-{464,465,-1,-1,-1,-1,-1,-1,-1},
-{465,466,-1,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1,-1},
-{467,468,-1,-1,-1,-1,-1,-1,-1},
-{468,469,-1,-1,-1,-1,-1,-1,-1},
-{469,470,-1,-1,-1,-1,-1,-1,-1},
-{470,471,-1,-1,-1,-1,-1,-1,-1},
-{471,472,-1,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1,-1},
-{473,474,-1,-1,-1,-1,-1,-1,-1},
-{474,475,-1,-1,-1,-1,-1,-1,-1},
-{475,476,-1,-1,-1,-1,-1,-1,-1},
-{476,477,-1,-1,-1,-1,-1,-1,-1},
-{477,478,-1,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1,-1},
-{480,481,-1,-1,-1,-1,-1,-1,-1},
-{481,482,-1,-1,-1,-1,-1,-1,-1},
-{482,483,-1,-1,-1,-1,-1,-1,-1},
-{483,484,-1,-1,-1,-1,-1,-1,-1},
-{484,485,-1,-1,-1,-1,-1,-1,-1},
-{485,486,-1,-1,-1,-1,-1,-1,-1},
-{486,487,-1,-1,-1,-1,-1,-1,-1},
-{487,488,-1,-1,-1,-1,-1,-1,-1},
-{488,489,-1,-1,-1,-1,-1,-1,-1},
-{489,490,-1,-1,-1,-1,-1,-1,-1},
-{490,491,-1,-1,-1,-1,-1,-1,-1},
-{491,492,-1,-1,-1,-1,-1,-1,-1},
-{492,493,-1,-1,-1,-1,-1,-1,-1},
-{493,494,-1,-1,-1,-1,-1,-1,-1},
-{494,495,-1,-1,-1,-1,-1,-1,-1},
-{495,496,-1,-1,-1,-1,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1,-1},
-{497,498,-1,-1,-1,-1,-1,-1,-1},
-{498,499,-1,-1,-1,-1,-1,-1,-1},
-{499,500,-1,-1,-1,-1,-1,-1,-1},
-{500,501,-1,-1,-1,-1,-1,-1,-1},
-{501,502,-1,-1,-1,-1,-1,-1,-1},
-{502,503,-1,-1,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1,-1},
-{504,505,-1,-1,-1,-1,-1,-1,-1},
-{505,506,-1,-1,-1,-1,-1,-1,-1},
-{506,507,-1,-1,-1,-1,-1,-1,-1},
-{507,508,-1,-1,-1,-1,-1,-1,-1},
-{508,509,-1,-1,-1,-1,-1,-1,-1},
-{509,510,-1,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1,-1},
-{512,513,-1,-1,-1,-1,-1,-1,-1},
-{513,514,-1,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1,-1},
-{515,516,-1,-1,-1,-1,-1,-1,-1},
-{516,517,-1,-1,-1,-1,-1,-1,-1},
-{517,518,-1,-1,-1,-1,-1,-1,-1},
-{518,519,-1,-1,-1,-1,-1,-1,-1},
-{519,520,-1,-1,-1,-1,-1,-1,-1},
-{520,521,-1,-1,-1,-1,-1,-1,-1},
-{521,522,-1,-1,-1,-1,-1,-1,-1},
-{522,523,-1,-1,-1,-1,-1,-1,-1},
-{523,524,-1,-1,-1,-1,-1,-1,-1},
-{524,525,-1,-1,-1,-1,-1,-1,-1},
-{525,526,-1,-1,-1,-1,-1,-1,-1},
-{526,527,-1,-1,-1,-1,-1,-1,-1},
-{527,528,-1,-1,-1,-1,-1,-1,-1},
-{528,529,-1,-1,-1,-1,-1,-1,-1},
-{529,530,-1,-1,-1,-1,-1,-1,-1},
-{530,531,-1,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1,-1},
-{532,533,-1,-1,-1,-1,-1,-1,-1},
-{533,534,-1,-1,-1,-1,-1,-1,-1},
-{534,535,-1,-1,-1,-1,-1,-1,-1},
-{535,536,-1,-1,-1,-1,-1,-1,-1},
-{536,537,-1,-1,-1,-1,-1,-1,-1},
-{537,538,-1,-1,-1,-1,-1,-1,-1},
-{538,539,-1,-1,-1,-1,-1,-1,-1},
-{539,540,-1,-1,-1,-1,-1,-1,-1},
-{540,541,-1,-1,-1,-1,-1,-1,-1},
-{541,542,-1,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1,-1},
-{543,544,-1,-1,-1,-1,-1,-1,-1},
-{544,545,-1,-1,-1,-1,-1,-1,-1},
-{545,546,-1,-1,-1,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1,-1},
-{547,548,-1,-1,-1,-1,-1,-1,-1},
-{548,549,-1,-1,-1,-1,-1,-1,-1},
-{549,550,-1,-1,-1,-1,-1,-1,-1},
-{550,551,-1,-1,-1,-1,-1,-1,-1},
-{551,552,-1,-1,-1,-1,-1,-1,-1},
-{552,553,-1,-1,-1,-1,-1,-1,-1},
-{553,554,-1,-1,-1,-1,-1,-1,-1},
-{554,555,-1,-1,-1,-1,-1,-1,-1},
-{555,556,-1,-1,-1,-1,-1,-1,-1},
-{556,557,-1,-1,-1,-1,-1,-1,-1},
-{557,558,-1,-1,-1,-1,-1,-1,-1},
-{558,559,-1,-1,-1,-1,-1,-1,-1},
-{559,560,-1,-1,-1,-1,-1,-1,-1},
-{560,561,-1,-1,-1,-1,-1,-1,-1},
-{561,562,-1,-1,-1,-1,-1,-1,-1},
-{562,563,-1,-1,-1,-1,-1,-1,-1},
-{563,564,-1,-1,-1,-1,-1,-1,-1},
-{564,565,-1,-1,-1,-1,-1,-1,-1},
-{565,566,-1,-1,-1,-1,-1,-1,-1},
-{566,567,-1,-1,-1,-1,-1,-1,-1},
-{567,568,-1,-1,-1,-1,-1,-1,-1},
-{568,569,-1,-1,-1,-1,-1,-1,-1},
-{569,570,-1,-1,-1,-1,-1,-1,-1},
-{570,571,-1,-1,-1,-1,-1,-1,-1},
-{571,572,-1,-1,-1,-1,-1,-1,-1},
-{572,573,-1,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1,-1},
-{574,575,-1,-1,-1,-1,-1,-1,-1},
-{575,576,-1,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1,-1},
-{578,579,-1,-1,-1,-1,-1,-1,-1},
-{579,580,-1,-1,-1,-1,-1,-1,-1},
-{580,581,-1,-1,-1,-1,-1,-1,-1},
-{581,582,-1,-1,-1,-1,-1,-1,-1},
-{582,583,-1,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1,-1},
-{584,585,-1,-1,-1,-1,-1,-1,-1},
-{585,586,-1,-1,-1,-1,-1,-1,-1},
-{586,587,-1,-1,-1,-1,-1,-1,-1},
-{587,588,-1,-1,-1,-1,-1,-1,-1},
-{588,589,-1,-1,-1,-1,-1,-1,-1},
-{589,590,-1,-1,-1,-1,-1,-1,-1},
-{590,591,-1,-1,-1,-1,-1,-1,-1},
-{591,592,-1,-1,-1,-1,-1,-1,-1},
-{592,593,-1,-1,-1,-1,-1,-1,-1},
-{593,594,-1,-1,-1,-1,-1,-1,-1},
-{594,595,-1,-1,-1,-1,-1,-1,-1},
-{595,596,-1,-1,-1,-1,-1,-1,-1},
-{596,597,-1,-1,-1,-1,-1,-1,-1},
-{597,598,-1,-1,-1,-1,-1,-1,-1},
-{598,599,-1,-1,-1,-1,-1,-1,-1},
-{599,600,-1,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1,-1},
-{601,602,-1,-1,-1,-1,-1,-1,-1},
-{602,603,-1,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1,-1},
-{605,606,-1,-1,-1,-1,-1,-1,-1},
-{606,607,-1,-1,-1,-1,-1,-1,-1},
-{607,608,-1,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1,-1},
-{609,610,-1,-1,-1,-1,-1,-1,-1},
-{610,611,-1,-1,-1,-1,-1,-1,-1},
-{611,612,-1,-1,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1,-1},
-{613,614,-1,-1,-1,-1,-1,-1,-1},
-{614,615,-1,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1,-1},
-{617,618,-1,-1,-1,-1,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1,-1},
-{619,620,-1,-1,-1,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1,-1},
-{621,622,-1,-1,-1,-1,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1,-1},
-{623,624,-1,-1,-1,-1,-1,-1,-1},
-{624,625,-1,-1,-1,-1,-1,-1,-1},
-{625,626,-1,-1,-1,-1,-1,-1,-1},
-{626,627,-1,-1,-1,-1,-1,-1,-1},
-{627,628,-1,-1,-1,-1,-1,-1,-1},
-{628,629,-1,-1,-1,-1,-1,-1,-1},
-{629,630,-1,-1,-1,-1,-1,-1,-1},
-{630,631,-1,-1,-1,-1,-1,-1,-1},
-{631,632,-1,-1,-1,-1,-1,-1,-1},
-{632,633,-1,-1,-1,-1,-1,-1,-1},
-{633,634,-1,-1,-1,-1,-1,-1,-1},
-{634,635,-1,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1,-1},
-{636,637,-1,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1,-1},
-{638,639,-1,-1,-1,-1,-1,-1,-1},
-{639,640,-1,-1,-1,-1,-1,-1,-1},
-{640,641,-1,-1,-1,-1,-1,-1,-1},
-{641,642,-1,-1,-1,-1,-1,-1,-1},
-{642,643,-1,-1,-1,-1,-1,-1,-1},
-{643,644,-1,-1,-1,-1,-1,-1,-1},
-{644,645,-1,-1,-1,-1,-1,-1,-1},
-{645,646,-1,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1,-1},
-{647,648,-1,-1,-1,-1,-1,-1,-1},
-{648,649,-1,-1,-1,-1,-1,-1,-1},
-{649,650,-1,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1,-1},
-{651,652,-1,-1,-1,-1,-1,-1,-1},
-{652,653,-1,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1,-1},
-{655,656,-1,-1,-1,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1,-1},
-{657,658,-1,-1,-1,-1,-1,-1,-1},
-{658,659,-1,-1,-1,-1,-1,-1,-1},
-{659,660,-1,-1,-1,-1,-1,-1,-1},
-{660,661,-1,-1,-1,-1,-1,-1,-1},
-{661,662,-1,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1,-1},
-{663,664,-1,-1,-1,-1,-1,-1,-1},
-{664,665,-1,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1,-1},
-{667,668,-1,-1,-1,-1,-1,-1,-1},
-{668,669,-1,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1,-1},
-{670,671,-1,-1,-1,-1,-1,-1,-1},
-{671,672,-1,-1,-1,-1,-1,-1,-1},
-{672,673,-1,-1,-1,-1,-1,-1,-1},
-{673,674,-1,-1,-1,-1,-1,-1,-1},
-{674,675,-1,-1,-1,-1,-1,-1,-1},
-{675,676,-1,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1,-1},
-{677,678,-1,-1,-1,-1,-1,-1,-1},
-{678,679,-1,-1,-1,-1,-1,-1,-1},
-{679,680,-1,-1,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1,-1},
-{681,682,-1,-1,-1,-1,-1,-1,-1},
-{682,683,-1,-1,-1,-1,-1,-1,-1},
-{683,684,-1,-1,-1,-1,-1,-1,-1},
-{684,685,-1,-1,-1,-1,-1,-1,-1},
-{685,686,-1,-1,-1,-1,-1,-1,-1},
-{686,687,-1,-1,-1,-1,-1,-1,-1},
-{687,688,-1,-1,-1,-1,-1,-1,-1},
-{688,689,-1,-1,-1,-1,-1,-1,-1},
-{689,690,-1,-1,-1,-1,-1,-1,-1},
-{690,691,-1,-1,-1,-1,-1,-1,-1},
-{691,692,-1,-1,-1,-1,-1,-1,-1},
-{692,693,-1,-1,-1,-1,-1,-1,-1},
-{693,694,-1,-1,-1,-1,-1,-1,-1},
-{694,695,-1,-1,-1,-1,-1,-1,-1},
-{695,696,-1,-1,-1,-1,-1,-1,-1},
-{696,697,-1,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1,-1},
-{699,700,-1,-1,-1,-1,-1,-1,-1},
-{700,701,-1,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1,-1},
-{702,703,-1,-1,-1,-1,-1,-1,-1},
-{703,704,-1,-1,-1,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1,-1},
-{705,706,-1,-1,-1,-1,-1,-1,-1},
-{706,707,-1,-1,-1,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1,-1},
-{708,709,-1,-1,-1,-1,-1,-1,-1},
-{709,710,-1,-1,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1,-1},
-{711,712,-1,-1,-1,-1,-1,-1,-1},
-{712,713,-1,-1,-1,-1,-1,-1,-1},
-{713,714,-1,-1,-1,-1,-1,-1,-1},
-{714,715,-1,-1,-1,-1,-1,-1,-1},
-{715,716,-1,-1,-1,-1,-1,-1,-1},
-{716,717,-1,-1,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1,-1},
-{718,719,-1,-1,-1,-1,-1,-1,-1},
-{719,720,-1,-1,-1,-1,-1,-1,-1},
-{720,721,-1,-1,-1,-1,-1,-1,-1},
-{721,722,-1,-1,-1,-1,-1,-1,-1},
-{722,723,-1,-1,-1,-1,-1,-1,-1},
-{723,724,-1,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1,-1},
-{725,726,-1,-1,-1,-1,-1,-1,-1},
-{726,727,-1,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1,-1},
-{730,731,-1,-1,-1,-1,-1,-1,-1},
-{731,732,-1,-1,-1,-1,-1,-1,-1},
-{732,733,-1,-1,-1,-1,-1,-1,-1},
-{733,734,-1,-1,-1,-1,-1,-1,-1},
-{734,735,-1,-1,-1,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1,-1},
-{736,737,-1,-1,-1,-1,-1,-1,-1},
-{737,738,-1,-1,-1,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1,-1},
-{739,740,-1,-1,-1,-1,-1,-1,-1},
-{740,741,-1,-1,-1,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1,-1},
-{742,743,-1,-1,-1,-1,-1,-1,-1},
-{743,744,-1,-1,-1,-1,-1,-1,-1},
-{744,745,-1,-1,-1,-1,-1,-1,-1},
-{745,746,-1,-1,-1,-1,-1,-1,-1},
-{746,747,-1,-1,-1,-1,-1,-1,-1},
-{747,748,-1,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1,-1},
-{749,750,-1,-1,-1,-1,-1,-1,-1},
-{750,751,-1,-1,-1,-1,-1,-1,-1},
-{751,752,-1,-1,-1,-1,-1,-1,-1},
-{752,753,-1,-1,-1,-1,-1,-1,-1},
-{753,754,-1,-1,-1,-1,-1,-1,-1},
-{754,755,-1,-1,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1,-1},
-{756,757,-1,-1,-1,-1,-1,-1,-1},
-{757,758,-1,-1,-1,-1,-1,-1,-1},
-{758,759,-1,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1},
-{760,761,-1,-1,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1,-1},
-{762,763,-1,-1,-1,-1,-1,-1,-1},
-{763,764,-1,-1,-1,-1,-1,-1,-1},
-{764,765,-1,-1,-1,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1,-1},
-{766,767,-1,-1,-1,-1,-1,-1,-1},
-{767,768,-1,-1,-1,-1,-1,-1,-1},
-{768,769,-1,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1,-1},
-{770,771,-1,-1,-1,-1,-1,-1,-1},
-{771,772,-1,-1,-1,-1,-1,-1,-1},
-{772,773,-1,-1,-1,-1,-1,-1,-1},
-{773,774,-1,-1,-1,-1,-1,-1,-1},
-{774,775,-1,-1,-1,-1,-1,-1,-1},
-{775,776,-1,-1,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1,-1},
-{777,778,-1,-1,-1,-1,-1,-1,-1},
-{778,779,-1,-1,-1,-1,-1,-1,-1},
-{779,780,-1,-1,-1,-1,-1,-1,-1},
-{780,781,-1,-1,-1,-1,-1,-1,-1},
-{781,782,-1,-1,-1,-1,-1,-1,-1},
-{782,783,-1,-1,-1,-1,-1,-1,-1},
-{783,784,-1,-1,-1,-1,-1,-1,-1},
-{784,785,-1,-1,-1,-1,-1,-1,-1},
-{785,786,-1,-1,-1,-1,-1,-1,-1},
-{786,787,-1,-1,-1,-1,-1,-1,-1},
-{787,788,-1,-1,-1,-1,-1,-1,-1},
-{788,789,-1,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1},
-{792,793,-1,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1},
-{794,795,-1,-1,-1,-1,-1,-1,-1},
-{795,796,-1,-1,-1,-1,-1,-1,-1},
-{796,797,-1,-1,-1,-1,-1,-1,-1},
-{797,798,-1,-1,-1,-1,-1,-1,-1},
-{798,799,-1,-1,-1,-1,-1,-1,-1},
-{799,800,-1,-1,-1,-1,-1,-1,-1},
-{800,801,-1,-1,-1,-1,-1,-1,-1},
-{801,802,-1,-1,-1,-1,-1,-1,-1},
-{802,803,-1,-1,-1,-1,-1,-1,-1},
-{803,804,-1,-1,-1,-1,-1,-1,-1},
-{804,805,-1,-1,-1,-1,-1,-1,-1},
-{805,806,-1,-1,-1,-1,-1,-1,-1},
-{806,807,-1,-1,-1,-1,-1,-1,-1},
-{807,808,-1,-1,-1,-1,-1,-1,-1},
-{808,809,-1,-1,-1,-1,-1,-1,-1},
-{809,810,-1,-1,-1,-1,-1,-1,-1},
-{810,811,-1,-1,-1,-1,-1,-1,-1},
-{811,812,-1,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1},
-{813,814,-1,-1,-1,-1,-1,-1,-1},
-{814,815,-1,-1,-1,-1,-1,-1,-1},
-{815,816,-1,-1,-1,-1,-1,-1,-1},
-{816,817,-1,-1,-1,-1,-1,-1,-1},
-{817,818,-1,-1,-1,-1,-1,-1,-1},
-{818,819,-1,-1,-1,-1,-1,-1,-1},
-{819,820,-1,-1,-1,-1,-1,-1,-1},
-{820,821,-1,-1,-1,-1,-1,-1,-1},
-{821,822,-1,-1,-1,-1,-1,-1,-1},
-{822,823,-1,-1,-1,-1,-1,-1,-1},
-{823,824,-1,-1,-1,-1,-1,-1,-1},
-{824,825,-1,-1,-1,-1,-1,-1,-1},
-{825,826,-1,-1,-1,-1,-1,-1,-1},
-{826,827,-1,-1,-1,-1,-1,-1,-1},
-{827,828,-1,-1,-1,-1,-1,-1,-1},
-{828,829,-1,-1,-1,-1,-1,-1,-1},
-{829,830,-1,-1,-1,-1,-1,-1,-1},
-{830,831,-1,-1,-1,-1,-1,-1,-1},
-{831,832,-1,-1,-1,-1,-1,-1,-1},
-{832,833,-1,-1,-1,-1,-1,-1,-1},
-{833,834,-1,-1,-1,-1,-1,-1,-1},
-{834,835,-1,-1,-1,-1,-1,-1,-1},
-{835,836,-1,-1,-1,-1,-1,-1,-1},
-{836,837,-1,-1,-1,-1,-1,-1,-1},
-{837,838,-1,-1,-1,-1,-1,-1,-1},
-{838,839,-1,-1,-1,-1,-1,-1,-1},
-{839,840,-1,-1,-1,-1,-1,-1,-1},
-{840,841,-1,-1,-1,-1,-1,-1,-1},
-{841,842,-1,-1,-1,-1,-1,-1,-1},
-{842,843,-1,-1,-1,-1,-1,-1,-1},
-{843,844,-1,-1,-1,-1,-1,-1,-1},
-{844,845,-1,-1,-1,-1,-1,-1,-1},
-{845,846,-1,-1,-1,-1,-1,-1,-1},
-{846,847,-1,-1,-1,-1,-1,-1,-1},
-{847,848,-1,-1,-1,-1,-1,-1,-1},
-{848,849,-1,-1,-1,-1,-1,-1,-1},
-{849,850,-1,-1,-1,-1,-1,-1,-1},
-{850,851,-1,-1,-1,-1,-1,-1,-1},
-{851,852,-1,-1,-1,-1,-1,-1,-1},
-{852,853,-1,-1,-1,-1,-1,-1,-1},
-{853,854,-1,-1,-1,-1,-1,-1,-1},
-{854,855,-1,-1,-1,-1,-1,-1,-1},
-{855,856,-1,-1,-1,-1,-1,-1,-1},
-{856,857,-1,-1,-1,-1,-1,-1,-1},
-{857,858,-1,-1,-1,-1,-1,-1,-1},
-{858,859,-1,-1,-1,-1,-1,-1,-1},
-{859,860,-1,-1,-1,-1,-1,-1,-1},
-{860,861,-1,-1,-1,-1,-1,-1,-1},
-{861,862,-1,-1,-1,-1,-1,-1,-1},
-{862,863,-1,-1,-1,-1,-1,-1,-1},
-{863,864,-1,-1,-1,-1,-1,-1,-1},
-{864,865,-1,-1,-1,-1,-1,-1,-1},
-{865,866,-1,-1,-1,-1,-1,-1,-1},
-{866,867,-1,-1,-1,-1,-1,-1,-1},
-{867,868,-1,-1,-1,-1,-1,-1,-1},
-{868,869,-1,-1,-1,-1,-1,-1,-1},
-{869,870,-1,-1,-1,-1,-1,-1,-1},
-{870,871,-1,-1,-1,-1,-1,-1,-1},
-{871,872,-1,-1,-1,-1,-1,-1,-1},
-{872,873,-1,-1,-1,-1,-1,-1,-1},
-{873,874,-1,-1,-1,-1,-1,-1,-1},
-{874,875,-1,-1,-1,-1,-1,-1,-1},
-{875,876,-1,-1,-1,-1,-1,-1,-1},
-{876,877,-1,-1,-1,-1,-1,-1,-1},
-{877,878,-1,-1,-1,-1,-1,-1,-1},
-{878,879,-1,-1,-1,-1,-1,-1,-1},
-{879,880,-1,-1,-1,-1,-1,-1,-1},
-{880,881,-1,-1,-1,-1,-1,-1,-1},
-{881,882,-1,-1,-1,-1,-1,-1,-1},
-{882,883,-1,-1,-1,-1,-1,-1,-1},
-{883,884,-1,-1,-1,-1,-1,-1,-1},
-{884,885,-1,-1,-1,-1,-1,-1,-1},
-{885,886,-1,-1,-1,-1,-1,-1,-1},
-{886,887,-1,-1,-1,-1,-1,-1,-1},
-{887,888,-1,-1,-1,-1,-1,-1,-1},
-{888,889,-1,-1,-1,-1,-1,-1,-1},
-{889,890,-1,-1,-1,-1,-1,-1,-1},
-{890,891,-1,-1,-1,-1,-1,-1,-1},
-{891,892,-1,-1,-1,-1,-1,-1,-1},
-{892,893,-1,-1,-1,-1,-1,-1,-1},
-{893,894,-1,-1,-1,-1,-1,-1,-1},
-{894,895,-1,-1,-1,-1,-1,-1,-1},
-{895,896,-1,-1,-1,-1,-1,-1,-1},
-{896,897,-1,-1,-1,-1,-1,-1,-1},
-{897,898,-1,-1,-1,-1,-1,-1,-1},
-{898,899,-1,-1,-1,-1,-1,-1,-1},
-{899,900,-1,-1,-1,-1,-1,-1,-1},
-{900,901,-1,-1,-1,-1,-1,-1,-1},
-{901,902,-1,-1,-1,-1,-1,-1,-1},
-{902,903,-1,-1,-1,-1,-1,-1,-1},
-{903,904,-1,-1,-1,-1,-1,-1,-1},
-{904,905,-1,-1,-1,-1,-1,-1,-1},
-{905,906,-1,-1,-1,-1,-1,-1,-1},
-{906,907,-1,-1,-1,-1,-1,-1,-1},
-{907,908,-1,-1,-1,-1,-1,-1,-1},
-{908,909,-1,-1,-1,-1,-1,-1,-1},
-{909,910,-1,-1,-1,-1,-1,-1,-1},
-{910,911,-1,-1,-1,-1,-1,-1,-1},
-{911,912,-1,-1,-1,-1,-1,-1,-1},
-{912,913,-1,-1,-1,-1,-1,-1,-1},
-{913,914,-1,-1,-1,-1,-1,-1,-1},
-{914,915,-1,-1,-1,-1,-1,-1,-1},
-{915,916,-1,-1,-1,-1,-1,-1,-1},
-{916,917,-1,-1,-1,-1,-1,-1,-1},
-{917,918,-1,-1,-1,-1,-1,-1,-1},
-{918,919,-1,-1,-1,-1,-1,-1,-1},
-{919,920,-1,-1,-1,-1,-1,-1,-1},
-{920,921,-1,-1,-1,-1,-1,-1,-1},
-{921,922,-1,-1,-1,-1,-1,-1,-1},
-{922,923,-1,-1,-1,-1,-1,-1,-1},
-{923,924,-1,-1,-1,-1,-1,-1,-1},
-{924,925,-1,-1,-1,-1,-1,-1,-1},
-{925,926,-1,-1,-1,-1,-1,-1,-1},
-{926,927,-1,-1,-1,-1,-1,-1,-1},
-{927,928,-1,-1,-1,-1,-1,-1,-1},
-{928,929,-1,-1,-1,-1,-1,-1,-1},
-{929,930,-1,-1,-1,-1,-1,-1,-1},
-{930,931,-1,-1,-1,-1,-1,-1,-1},
-{931,932,-1,-1,-1,-1,-1,-1,-1},
-{932,933,-1,-1,-1,-1,-1,-1,-1},
-{933,934,-1,-1,-1,-1,-1,-1,-1},
-{934,935,-1,-1,-1,-1,-1,-1,-1},
-{935,936,-1,-1,-1,-1,-1,-1,-1},
-{936,937,-1,-1,-1,-1,-1,-1,-1},
-{937,938,-1,-1,-1,-1,-1,-1,-1},
-{938,939,-1,-1,-1,-1,-1,-1,-1},
-{939,940,-1,-1,-1,-1,-1,-1,-1},
-{940,941,-1,-1,-1,-1,-1,-1,-1},
-{941,942,-1,-1,-1,-1,-1,-1,-1},
-{942,943,-1,-1,-1,-1,-1,-1,-1},
-{943,944,-1,-1,-1,-1,-1,-1,-1},
-{944,945,-1,-1,-1,-1,-1,-1,-1},
-{945,946,-1,-1,-1,-1,-1,-1,-1},
-{946,947,-1,-1,-1,-1,-1,-1,-1},
-{947,948,-1,-1,-1,-1,-1,-1,-1},
-{948,949,-1,-1,-1,-1,-1,-1,-1},
-{949,950,-1,-1,-1,-1,-1,-1,-1},
-{950,951,-1,-1,-1,-1,-1,-1,-1},
-{951,952,-1,-1,-1,-1,-1,-1,-1},
-{952,953,-1,-1,-1,-1,-1,-1,-1},
-{953,954,-1,-1,-1,-1,-1,-1,-1},
-{954,955,-1,-1,-1,-1,-1,-1,-1},
-{955,956,-1,-1,-1,-1,-1,-1,-1},
-{956,957,-1,-1,-1,-1,-1,-1,-1},
-{957,958,-1,-1,-1,-1,-1,-1,-1},
-{958,959,-1,-1,-1,-1,-1,-1,-1},
-{959,960,-1,-1,-1,-1,-1,-1,-1},
-{960,961,-1,-1,-1,-1,-1,-1,-1},
-{961,962,-1,-1,-1,-1,-1,-1,-1},
-{962,963,-1,-1,-1,-1,-1,-1,-1},
-{963,964,-1,-1,-1,-1,-1,-1,-1},
-{964,965,-1,-1,-1,-1,-1,-1,-1},
-{965,966,-1,-1,-1,-1,-1,-1,-1},
-{966,967,-1,-1,-1,-1,-1,-1,-1},
-{967,968,-1,-1,-1,-1,-1,-1,-1},
-{968,969,-1,-1,-1,-1,-1,-1,-1},
-{969,970,-1,-1,-1,-1,-1,-1,-1},
-{970,971,-1,-1,-1,-1,-1,-1,-1},
-{971,972,-1,-1,-1,-1,-1,-1,-1},
-{972,973,-1,-1,-1,-1,-1,-1,-1},
-{973,974,-1,-1,-1,-1,-1,-1,-1},
-{974,975,-1,-1,-1,-1,-1,-1,-1},
-{975,976,-1,-1,-1,-1,-1,-1,-1},
-{976,977,-1,-1,-1,-1,-1,-1,-1},
-{977,978,-1,-1,-1,-1,-1,-1,-1},
-{978,979,-1,-1,-1,-1,-1,-1,-1},
-{979,980,-1,-1,-1,-1,-1,-1,-1},
-{980,981,-1,-1,-1,-1,-1,-1,-1},
-{981,982,-1,-1,-1,-1,-1,-1,-1},
-{982,983,-1,-1,-1,-1,-1,-1,-1},
-{983,984,-1,-1,-1,-1,-1,-1,-1},
-{984,985,-1,-1,-1,-1,-1,-1,-1},
-{985,986,-1,-1,-1,-1,-1,-1,-1},
-{986,987,-1,-1,-1,-1,-1,-1,-1},
-{987,988,-1,-1,-1,-1,-1,-1,-1},
-{988,989,-1,-1,-1,-1,-1,-1,-1},
-{989,990,-1,-1,-1,-1,-1,-1,-1},
-{990,991,-1,-1,-1,-1,-1,-1,-1},
-{991,992,-1,-1,-1,-1,-1,-1,-1},
-{992,993,-1,-1,-1,-1,-1,-1,-1},
-{993,994,-1,-1,-1,-1,-1,-1,-1},
-{994,995,-1,-1,-1,-1,-1,-1,-1},
-{995,996,-1,-1,-1,-1,-1,-1,-1},
-{996,997,-1,-1,-1,-1,-1,-1,-1},
-{997,998,-1,-1,-1,-1,-1,-1,-1},
-{998,999,-1,-1,-1,-1,-1,-1,-1},
-{999,1000,-1,-1,-1,-1,-1,-1,-1},
-{1000,1001,-1,-1,-1,-1,-1,-1,-1},
-{1001,1002,-1,-1,-1,-1,-1,-1,-1},
-{1002,1003,-1,-1,-1,-1,-1,-1,-1},
-{1003,1004,-1,-1,-1,-1,-1,-1,-1},
-{1004,1005,-1,-1,-1,-1,-1,-1,-1},
-{1005,1006,-1,-1,-1,-1,-1,-1,-1},
-{1006,1007,-1,-1,-1,-1,-1,-1,-1},
-{1007,1008,-1,-1,-1,-1,-1,-1,-1},
-{1008,1009,-1,-1,-1,-1,-1,-1,-1},
-{1009,1010,-1,-1,-1,-1,-1,-1,-1},
-{1010,1011,-1,-1,-1,-1,-1,-1,-1},
-{1011,1012,-1,-1,-1,-1,-1,-1,-1},
-{1012,1013,-1,-1,-1,-1,-1,-1,-1},
-{1013,1014,-1,-1,-1,-1,-1,-1,-1},
-{1014,1015,-1,-1,-1,-1,-1,-1,-1},
-{1015,1016,-1,-1,-1,-1,-1,-1,-1},
-{1016,1017,-1,-1,-1,-1,-1,-1,-1},
-{1017,1018,-1,-1,-1,-1,-1,-1,-1},
-{1018,1019,-1,-1,-1,-1,-1,-1,-1},
-{1019,1020,-1,-1,-1,-1,-1,-1,-1},
-{1020,1021,-1,-1,-1,-1,-1,-1,-1},
-{1021,1022,-1,-1,-1,-1,-1,-1,-1},
-{1022,1023,-1,-1,-1,-1,-1,-1,-1},
-{1023,1024,-1,-1,-1,-1,-1,-1,-1},
-{1024,1025,-1,-1,-1,-1,-1,-1,-1},
-{1025,1026,-1,-1,-1,-1,-1,-1,-1},
-{1026,1027,-1,-1,-1,-1,-1,-1,-1},
-{1027,1028,-1,-1,-1,-1,-1,-1,-1},
-{1028,1029,-1,-1,-1,-1,-1,-1,-1},
-{1029,1030,-1,-1,-1,-1,-1,-1,-1},
-{1030,1031,-1,-1,-1,-1,-1,-1,-1},
-{1031,1032,-1,-1,-1,-1,-1,-1,-1},
-{1032,1033,-1,-1,-1,-1,-1,-1,-1},
-{1033,1034,-1,-1,-1,-1,-1,-1,-1},
-{1034,1035,-1,-1,-1,-1,-1,-1,-1},
-{1035,1036,-1,-1,-1,-1,-1,-1,-1},
-{1036,1037,-1,-1,-1,-1,-1,-1,-1},
-{1037,1038,-1,-1,-1,-1,-1,-1,-1},
-{1038,1039,-1,-1,-1,-1,-1,-1,-1},
-{1039,1040,-1,-1,-1,-1,-1,-1,-1},
-{1040,1041,-1,-1,-1,-1,-1,-1,-1},
-{1041,1042,-1,-1,-1,-1,-1,-1,-1},
-{1042,1043,-1,-1,-1,-1,-1,-1,-1},
-{1043,1044,-1,-1,-1,-1,-1,-1,-1},
-{1044,1045,-1,-1,-1,-1,-1,-1,-1},
-{1045,1046,-1,-1,-1,-1,-1,-1,-1},
-{1046,1047,-1,-1,-1,-1,-1,-1,-1},
-{1047,1048,-1,-1,-1,-1,-1,-1,-1},
-{1048,1049,-1,-1,-1,-1,-1,-1,-1},
-{1049,1050,-1,-1,-1,-1,-1,-1,-1},
-{1050,1051,-1,-1,-1,-1,-1,-1,-1},
-{1051,1052,-1,-1,-1,-1,-1,-1,-1},
-{1052,1053,-1,-1,-1,-1,-1,-1,-1},
-{1053,1054,-1,-1,-1,-1,-1,-1,-1},
-{1054,1055,-1,-1,-1,-1,-1,-1,-1},
-{1055,1056,-1,-1,-1,-1,-1,-1,-1},
-{1056,1057,-1,-1,-1,-1,-1,-1,-1},
-{1057,1058,-1,-1,-1,-1,-1,-1,-1},
-{1058,1059,-1,-1,-1,-1,-1,-1,-1},
-{1059,1060,-1,-1,-1,-1,-1,-1,-1},
-{1060,1061,-1,-1,-1,-1,-1,-1,-1},
-{1061,1062,-1,-1,-1,-1,-1,-1,-1},
-{1062,1063,-1,-1,-1,-1,-1,-1,-1},
-{1063,1064,-1,-1,-1,-1,-1,-1,-1},
-{1064,1065,-1,-1,-1,-1,-1,-1,-1},
-{1065,1066,-1,-1,-1,-1,-1,-1,-1},
-{1066,1067,-1,-1,-1,-1,-1,-1,-1},
-{1067,1068,-1,-1,-1,-1,-1,-1,-1},
-{1068,1069,-1,-1,-1,-1,-1,-1,-1},
-{1069,1070,-1,-1,-1,-1,-1,-1,-1},
-{1070,1071,-1,-1,-1,-1,-1,-1,-1},
-{1071,1072,-1,-1,-1,-1,-1,-1,-1},
-{1072,1073,-1,-1,-1,-1,-1,-1,-1},
-{1073,1074,-1,-1,-1,-1,-1,-1,-1},
-{1074,1075,-1,-1,-1,-1,-1,-1,-1},
-{1075,1076,-1,-1,-1,-1,-1,-1,-1},
-{1076,1077,-1,-1,-1,-1,-1,-1,-1},
-{1077,1078,-1,-1,-1,-1,-1,-1,-1},
-{1078,1079,-1,-1,-1,-1,-1,-1,-1},
-{1079,1080,-1,-1,-1,-1,-1,-1,-1},
-{1080,1081,-1,-1,-1,-1,-1,-1,-1},
-{1081,1082,-1,-1,-1,-1,-1,-1,-1},
-{1082,1083,-1,-1,-1,-1,-1,-1,-1},
-{1083,1084,-1,-1,-1,-1,-1,-1,-1},
-{1084,1085,-1,-1,-1,-1,-1,-1,-1},
-{1085,1086,-1,-1,-1,-1,-1,-1,-1},
-{1086,1087,-1,-1,-1,-1,-1,-1,-1},
-{1087,1088,-1,-1,-1,-1,-1,-1,-1},
-{1088,1089,-1,-1,-1,-1,-1,-1,-1},
-{1089,1090,-1,-1,-1,-1,-1,-1,-1},
-{1090,1091,-1,-1,-1,-1,-1,-1,-1},
-{1091,1092,-1,-1,-1,-1,-1,-1,-1},
-{1092,1093,-1,-1,-1,-1,-1,-1,-1},
-{1093,1094,-1,-1,-1,-1,-1,-1,-1},
-{1094,1095,-1,-1,-1,-1,-1,-1,-1},
-{1095,1096,-1,-1,-1,-1,-1,-1,-1},
-{1096,1097,-1,-1,-1,-1,-1,-1,-1},
-{1097,1098,-1,-1,-1,-1,-1,-1,-1},
-{1098,1099,-1,-1,-1,-1,-1,-1,-1},
-{1099,1100,-1,-1,-1,-1,-1,-1,-1},
-{1100,1101,-1,-1,-1,-1,-1,-1,-1},
-{1101,1102,-1,-1,-1,-1,-1,-1,-1},
-{1102,1103,-1,-1,-1,-1,-1,-1,-1},
-{1103,1104,-1,-1,-1,-1,-1,-1,-1},
-{1104,1105,-1,-1,-1,-1,-1,-1,-1},
-{1105,1106,-1,-1,-1,-1,-1,-1,-1},
-{1106,1107,-1,-1,-1,-1,-1,-1,-1},
-{1107,1108,-1,-1,-1,-1,-1,-1,-1},
-{1108,1109,-1,-1,-1,-1,-1,-1,-1},
-{1109,1110,-1,-1,-1,-1,-1,-1,-1},
-{1110,1111,-1,-1,-1,-1,-1,-1,-1},
-{1111,1112,-1,-1,-1,-1,-1,-1,-1},
-{1112,1113,-1,-1,-1,-1,-1,-1,-1},
-{1113,1114,-1,-1,-1,-1,-1,-1,-1},
-{1114,1115,-1,-1,-1,-1,-1,-1,-1},
-{1115,1116,-1,-1,-1,-1,-1,-1,-1},
-{1116,1117,-1,-1,-1,-1,-1,-1,-1},
-{1117,1118,-1,-1,-1,-1,-1,-1,-1},
-{1118,1119,-1,-1,-1,-1,-1,-1,-1},
-{1119,1120,-1,-1,-1,-1,-1,-1,-1},
-{1120,1121,-1,-1,-1,-1,-1,-1,-1},
-{1121,1122,-1,-1,-1,-1,-1,-1,-1},
-{1122,1123,-1,-1,-1,-1,-1,-1,-1},
-{1123,1124,-1,-1,-1,-1,-1,-1,-1},
-{1124,1125,-1,-1,-1,-1,-1,-1,-1},
-{1125,1126,-1,-1,-1,-1,-1,-1,-1},
-{1126,1127,-1,-1,-1,-1,-1,-1,-1},
-{1127,1128,-1,-1,-1,-1,-1,-1,-1},
-{1128,1129,-1,-1,-1,-1,-1,-1,-1},
-{1129,1130,-1,-1,-1,-1,-1,-1,-1},
-{1130,1131,-1,-1,-1,-1,-1,-1,-1},
-{1131,1132,-1,-1,-1,-1,-1,-1,-1},
-{1132,1133,-1,-1,-1,-1,-1,-1,-1},
-{1133,1134,-1,-1,-1,-1,-1,-1,-1},
-{1134,1135,-1,-1,-1,-1,-1,-1,-1},
-{1135,1136,-1,-1,-1,-1,-1,-1,-1},
-{1136,1137,-1,-1,-1,-1,-1,-1,-1},
-{1137,1138,-1,-1,-1,-1,-1,-1,-1},
-{1138,1139,-1,-1,-1,-1,-1,-1,-1},
-{1139,1140,-1,-1,-1,-1,-1,-1,-1},
-{1140,1141,-1,-1,-1,-1,-1,-1,-1},
-{1141,1142,-1,-1,-1,-1,-1,-1,-1},
-{1142,1143,-1,-1,-1,-1,-1,-1,-1},
-{1143,1144,-1,-1,-1,-1,-1,-1,-1},
-{1144,1145,-1,-1,-1,-1,-1,-1,-1},
-{1145,1146,-1,-1,-1,-1,-1,-1,-1},
-{1146,1147,-1,-1,-1,-1,-1,-1,-1},
-{1147,1148,-1,-1,-1,-1,-1,-1,-1},
-{1148,1149,-1,-1,-1,-1,-1,-1,-1},
-{1149,1150,-1,-1,-1,-1,-1,-1,-1},
-{1150,1151,-1,-1,-1,-1,-1,-1,-1},
-{1151,1152,-1,-1,-1,-1,-1,-1,-1},
-{1152,1153,-1,-1,-1,-1,-1,-1,-1},
-{1153,1154,-1,-1,-1,-1,-1,-1,-1},
-{1154,1155,-1,-1,-1,-1,-1,-1,-1},
-{1155,1156,-1,-1,-1,-1,-1,-1,-1},
-{1156,1157,-1,-1,-1,-1,-1,-1,-1},
-{1157,1158,-1,-1,-1,-1,-1,-1,-1},
-{1158,1159,-1,-1,-1,-1,-1,-1,-1},
-{1159,1160,-1,-1,-1,-1,-1,-1,-1},
-{1160,1161,-1,-1,-1,-1,-1,-1,-1},
-{1161,1162,-1,-1,-1,-1,-1,-1,-1},
-{1162,1163,-1,-1,-1,-1,-1,-1,-1},
-{1163,1164,-1,-1,-1,-1,-1,-1,-1},
-{1164,1165,-1,-1,-1,-1,-1,-1,-1},
-{1165,1166,-1,-1,-1,-1,-1,-1,-1},
-{1166,1167,-1,-1,-1,-1,-1,-1,-1},
-{1167,1168,-1,-1,-1,-1,-1,-1,-1},
-{1168,1169,-1,-1,-1,-1,-1,-1,-1},
-{1169,1170,-1,-1,-1,-1,-1,-1,-1},
-{1170,1171,-1,-1,-1,-1,-1,-1,-1},
-{1171,1172,-1,-1,-1,-1,-1,-1,-1},
-{1172,1173,-1,-1,-1,-1,-1,-1,-1},
-{1173,1174,-1,-1,-1,-1,-1,-1,-1},
-{1174,1175,-1,-1,-1,-1,-1,-1,-1},
-{1175,1176,-1,-1,-1,-1,-1,-1,-1},
-{1176,1177,-1,-1,-1,-1,-1,-1,-1},
-{1177,1178,-1,-1,-1,-1,-1,-1,-1},
-{1178,1179,-1,-1,-1,-1,-1,-1,-1},
-{1179,1180,-1,-1,-1,-1,-1,-1,-1},
-{1180,1181,-1,-1,-1,-1,-1,-1,-1},
-{1181,1182,-1,-1,-1,-1,-1,-1,-1},
-{1182,1183,-1,-1,-1,-1,-1,-1,-1},
-{1183,1184,-1,-1,-1,-1,-1,-1,-1},
-{1184,1185,-1,-1,-1,-1,-1,-1,-1},
-{1185,1186,-1,-1,-1,-1,-1,-1,-1},
-{1186,1187,-1,-1,-1,-1,-1,-1,-1},
-{1187,1188,-1,-1,-1,-1,-1,-1,-1},
-{1188,1189,-1,-1,-1,-1,-1,-1,-1},
-{1189,1190,-1,-1,-1,-1,-1,-1,-1},
-{1190,1191,-1,-1,-1,-1,-1,-1,-1},
-{1191,1192,-1,-1,-1,-1,-1,-1,-1},
-{1192,1193,-1,-1,-1,-1,-1,-1,-1},
-{1193,1194,-1,-1,-1,-1,-1,-1,-1},
-{1194,1195,-1,-1,-1,-1,-1,-1,-1},
-{1195,1196,-1,-1,-1,-1,-1,-1,-1},
-{1196,1197,-1,-1,-1,-1,-1,-1,-1},
-{1197,1198,-1,-1,-1,-1,-1,-1,-1},
-{1198,1199,-1,-1,-1,-1,-1,-1,-1},
-{1199,1200,-1,-1,-1,-1,-1,-1,-1},
-{1200,1201,-1,-1,-1,-1,-1,-1,-1},
-{1201,1202,-1,-1,-1,-1,-1,-1,-1},
-{1202,1203,-1,-1,-1,-1,-1,-1,-1},
-{1203,1204,-1,-1,-1,-1,-1,-1,-1},
-{1204,1205,-1,-1,-1,-1,-1,-1,-1},
-{1205,1206,-1,-1,-1,-1,-1,-1,-1},
-{1206,1207,-1,-1,-1,-1,-1,-1,-1},
-{1207,1208,-1,-1,-1,-1,-1,-1,-1},
-{1208,1209,-1,-1,-1,-1,-1,-1,-1},
-{1209,1210,-1,-1,-1,-1,-1,-1,-1},
-{1210,1211,-1,-1,-1,-1,-1,-1,-1},
-{1211,1212,-1,-1,-1,-1,-1,-1,-1},
-{1212,1213,-1,-1,-1,-1,-1,-1,-1},
-{1213,1214,-1,-1,-1,-1,-1,-1,-1},
-{1214,1215,-1,-1,-1,-1,-1,-1,-1},
-{1215,1216,-1,-1,-1,-1,-1,-1,-1},
-{1216,1217,-1,-1,-1,-1,-1,-1,-1},
-{1217,1218,-1,-1,-1,-1,-1,-1,-1},
-{1218,1219,-1,-1,-1,-1,-1,-1,-1},
-{1219,1220,-1,-1,-1,-1,-1,-1,-1},
-{1220,1221,-1,-1,-1,-1,-1,-1,-1},
-{1221,1222,-1,-1,-1,-1,-1,-1,-1},
-{1222,1223,-1,-1,-1,-1,-1,-1,-1},
-{1223,1224,-1,-1,-1,-1,-1,-1,-1},
-{1224,1225,-1,-1,-1,-1,-1,-1,-1},
-{1225,1226,-1,-1,-1,-1,-1,-1,-1},
-{1226,1227,-1,-1,-1,-1,-1,-1,-1},
-{1227,1228,-1,-1,-1,-1,-1,-1,-1},
-{1228,1229,-1,-1,-1,-1,-1,-1,-1},
-{1229,1230,-1,-1,-1,-1,-1,-1,-1},
-{1230,1231,-1,-1,-1,-1,-1,-1,-1},
-{1231,1232,-1,-1,-1,-1,-1,-1,-1},
-{1232,1233,-1,-1,-1,-1,-1,-1,-1},
-{1233,1234,-1,-1,-1,-1,-1,-1,-1},
-{1234,1235,-1,-1,-1,-1,-1,-1,-1},
-{1235,1236,-1,-1,-1,-1,-1,-1,-1},
-{1236,1237,-1,-1,-1,-1,-1,-1,-1},
-{1237,1238,-1,-1,-1,-1,-1,-1,-1},
-{1238,1239,-1,-1,-1,-1,-1,-1,-1},
-{1239,1240,-1,-1,-1,-1,-1,-1,-1},
-{1240,1241,-1,-1,-1,-1,-1,-1,-1},
-{1241,1242,-1,-1,-1,-1,-1,-1,-1},
-{1242,1243,-1,-1,-1,-1,-1,-1,-1},
-{1243,1244,-1,-1,-1,-1,-1,-1,-1},
-{1244,1245,-1,-1,-1,-1,-1,-1,-1},
-{1245,1246,-1,-1,-1,-1,-1,-1,-1},
-{1246,1247,-1,-1,-1,-1,-1,-1,-1},
-{1247,1248,-1,-1,-1,-1,-1,-1,-1},
-{1248,1249,-1,-1,-1,-1,-1,-1,-1},
-{1249,1250,-1,-1,-1,-1,-1,-1,-1},
-{1250,1251,-1,-1,-1,-1,-1,-1,-1},
-{1251,1252,-1,-1,-1,-1,-1,-1,-1},
-{1252,1253,-1,-1,-1,-1,-1,-1,-1},
-{1253,1254,-1,-1,-1,-1,-1,-1,-1},
-{1254,1255,-1,-1,-1,-1,-1,-1,-1},
-{1255,1256,-1,-1,-1,-1,-1,-1,-1},
-{1256,1257,-1,-1,-1,-1,-1,-1,-1},
-{1257,1258,-1,-1,-1,-1,-1,-1,-1},
-{1258,1259,-1,-1,-1,-1,-1,-1,-1},
-{1259,1260,-1,-1,-1,-1,-1,-1,-1},
-{1260,1261,-1,-1,-1,-1,-1,-1,-1},
-{1261,1262,-1,-1,-1,-1,-1,-1,-1},
-{1262,1263,-1,-1,-1,-1,-1,-1,-1},
-{1263,1264,-1,-1,-1,-1,-1,-1,-1},
-{1264,1265,-1,-1,-1,-1,-1,-1,-1},
-{1265,1266,-1,-1,-1,-1,-1,-1,-1},
-{1266,1267,-1,-1,-1,-1,-1,-1,-1},
-{1267,1268,-1,-1,-1,-1,-1,-1,-1},
-{1268,1269,-1,-1,-1,-1,-1,-1,-1},
-{1269,1270,-1,-1,-1,-1,-1,-1,-1},
-{1270,1271,-1,-1,-1,-1,-1,-1,-1},
-{1271,1272,-1,-1,-1,-1,-1,-1,-1},
-{1272,1273,-1,-1,-1,-1,-1,-1,-1},
-{1273,1274,-1,-1,-1,-1,-1,-1,-1},
-{1274,1275,-1,-1,-1,-1,-1,-1,-1},
-{1275,1276,-1,-1,-1,-1,-1,-1,-1},
-{1276,1277,-1,-1,-1,-1,-1,-1,-1},
-{1277,1278,-1,-1,-1,-1,-1,-1,-1},
-{1278,1279,-1,-1,-1,-1,-1,-1,-1},
-{1279,1280,-1,-1,-1,-1,-1,-1,-1},
-{1280,1281,-1,-1,-1,-1,-1,-1,-1},
-{1281,1282,-1,-1,-1,-1,-1,-1,-1},
-{1282,1283,-1,-1,-1,-1,-1,-1,-1},
-{1283,1284,-1,-1,-1,-1,-1,-1,-1},
-{1284,1285,-1,-1,-1,-1,-1,-1,-1},
-{1285,1286,-1,-1,-1,-1,-1,-1,-1},
-{1286,1287,-1,-1,-1,-1,-1,-1,-1},
-{1287,1288,-1,-1,-1,-1,-1,-1,-1},
-{1288,1289,-1,-1,-1,-1,-1,-1,-1},
-{1289,1290,-1,-1,-1,-1,-1,-1,-1},
-{1290,1291,-1,-1,-1,-1,-1,-1,-1},
-{1291,1292,-1,-1,-1,-1,-1,-1,-1},
-{1292,1293,-1,-1,-1,-1,-1,-1,-1},
-{1293,1294,-1,-1,-1,-1,-1,-1,-1},
-{1294,1295,-1,-1,-1,-1,-1,-1,-1},
-{1295,1296,-1,-1,-1,-1,-1,-1,-1},
-{1296,1297,-1,-1,-1,-1,-1,-1,-1},
-{1297,1298,-1,-1,-1,-1,-1,-1,-1},
-{1298,1299,-1,-1,-1,-1,-1,-1,-1},
-{1299,-1,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_3_16=17;
+int mercury_normal_QCbase_3_16[146]={
+20,29,7,47,402,467,503,535,445,1198,
+20,29,5,316,490,682,495,1031,
+20,29,7,357,414,1209,1044,29,601,710,
+20,29,9,306,498,973,101,1060,1099,181,219,243,
+20,29,3,62,296,628,
+20,29,9,327,120,222,1010,702,508,853,69,939,
+20,29,8,492,534,662,730,864,1064,1222,1247,
+20,29,5,388,645,714,763,1143,
+20,29,8,543,695,1278,13,891,145,65,1057,
+20,29,3,227,331,475,
+20,29,3,110,409,174,
+20,29,3,175,293,586,
+20,29,8,86,132,231,889,936,1204,340,1268,
+20,29,9,63,323,13,411,1151,873,1124,560,270,
+20,29,5,331,900,841,1020,524,
+1299,1,2,0,1,
+1,0,1,1299};
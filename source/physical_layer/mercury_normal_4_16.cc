@@ -25,4010 +25,107 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_4_16.h"
-int mercury_normal_Cwidth_4_16=9;
-int mercury_normal_Vwidth_4_16=9;
-int mercury_normal_dwidth_4_16=180;
-int mercury_normal_QCmatrixd_4_16[180]={4,8,8,4,4,5,4,8,4,3,8,7,4,6,4,7,4,5,8,3,4,6,4,8,4,5,4,9,4,4,4,8,4,5,4,8,4,7,12,5,4,6,4,3,4,9,4,4,8,3,4,4,4,9,4,7,4,4,4,5,4,9,4,6,4,3,4,4,4,5,4,8,4,3,4,4,4,9,4,5,12,6,4,5,4,4,4,3,4,6,8,5,4,8,4,7,4,3,4,8,4,9,4,4,4,8,8,4,4,5,4,8,4,7,4,3,4,4,4,3,4,7,4,9,4,6,4,3,4,7,4,8,4,5,4,4,4,6,4,4,4,3,4,6,4,8,4,5,4,8,4,6,4,4,4,3,4,7,4,5,4,9,4,3,4,9,4,3,8,7,4,8,4,6,8,4,1199,2,1,1};
-int mercury_normal_QCmatrixC_4_16[1200][9]={
-{290,400,-1,-1,-1,-1,-1,-1,-1},
-{83,400,401,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1,-1},
-{7,222,360,402,403,-1,-1,-1,-1},
-{224,403,404,-1,-1,-1,-1,-1,-1},
-{122,404,405,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1,-1},
-{369,406,407,-1,-1,-1,-1,-1,-1},
-{52,56,273,407,408,-1,-1,-1,-1},
-{54,182,226,408,409,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1,-1},
-{348,410,411,-1,-1,-1,-1,-1,-1},
-{27,135,147,411,412,-1,-1,-1,-1},
-{112,412,413,-1,-1,-1,-1,-1,-1},
-{173,413,414,-1,-1,-1,-1,-1,-1},
-{19,385,414,415,-1,-1,-1,-1,-1},
-{118,244,388,389,415,416,-1,-1,-1},
-{263,336,416,417,-1,-1,-1,-1,-1},
-{83,383,417,418,-1,-1,-1,-1,-1},
-{32,418,419,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1,-1},
-{282,420,421,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1,-1},
-{73,148,154,372,422,423,-1,-1,-1},
-{59,82,423,424,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1,-1},
-{293,425,426,-1,-1,-1,-1,-1,-1},
-{62,90,426,427,-1,-1,-1,-1,-1},
-{173,427,428,-1,-1,-1,-1,-1,-1},
-{194,428,429,-1,-1,-1,-1,-1,-1},
-{170,429,430,-1,-1,-1,-1,-1,-1},
-{117,430,431,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1,-1},
-{142,338,432,433,-1,-1,-1,-1,-1},
-{356,433,434,-1,-1,-1,-1,-1,-1},
-{35,82,263,434,435,-1,-1,-1,-1},
-{287,435,436,-1,-1,-1,-1,-1,-1},
-{235,344,436,437,-1,-1,-1,-1,-1},
-{121,324,342,437,438,-1,-1,-1,-1},
-{85,187,233,237,291,363,385,438,439},
-{162,439,440,-1,-1,-1,-1,-1,-1},
-{125,164,180,281,440,441,-1,-1,-1},
-{45,282,441,442,-1,-1,-1,-1,-1},
-{71,245,261,442,443,-1,-1,-1,-1},
-{78,164,237,443,444,-1,-1,-1,-1},
-{51,444,445,-1,-1,-1,-1,-1,-1},
-{42,445,446,-1,-1,-1,-1,-1,-1},
-{18,391,446,447,-1,-1,-1,-1,-1},
-{178,194,367,447,448,-1,-1,-1,-1},
-{66,448,449,-1,-1,-1,-1,-1,-1},
-{185,449,450,-1,-1,-1,-1,-1,-1},
-{236,450,451,-1,-1,-1,-1,-1,-1},
-{2,132,284,354,451,452,-1,-1,-1},
-{74,452,453,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1,-1},
-{381,454,455,-1,-1,-1,-1,-1,-1},
-{14,166,219,255,455,456,-1,-1,-1},
-{108,117,194,339,385,456,457,-1,-1},
-{137,457,458,-1,-1,-1,-1,-1,-1},
-{30,261,458,459,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1,-1},
-{28,460,461,-1,-1,-1,-1,-1,-1},
-{24,191,218,233,461,462,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1,-1},
-{66,463,464,-1,-1,-1,-1,-1,-1},
-{47,239,464,465,-1,-1,-1,-1,-1},
-{147,465,466,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1,-1},
-{34,264,282,325,467,468,-1,-1,-1},
-{60,468,469,-1,-1,-1,-1,-1,-1},
-{37,210,469,470,-1,-1,-1,-1,-1},
-{392,470,471,-1,-1,-1,-1,-1,-1},
-{309,471,472,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1,-1},
-{76,473,474,-1,-1,-1,-1,-1,-1},
-{227,272,284,474,475,-1,-1,-1,-1},
-{124,475,476,-1,-1,-1,-1,-1,-1},
-{276,284,287,476,477,-1,-1,-1,-1},
-{52,477,478,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1,-1},
-{98,220,334,480,481,-1,-1,-1,-1},
-{212,481,482,-1,-1,-1,-1,-1,-1},
-{154,482,483,-1,-1,-1,-1,-1,-1},
-{130,483,484,-1,-1,-1,-1,-1,-1},
-{301,484,485,-1,-1,-1,-1,-1,-1},
-{85,103,379,485,486,-1,-1,-1,-1},
-{27,308,486,487,-1,-1,-1,-1,-1},
-{105,305,363,389,487,488,-1,-1,-1},
-{41,291,488,489,-1,-1,-1,-1,-1},
-{98,250,489,490,-1,-1,-1,-1,-1},
-{315,490,491,-1,-1,-1,-1,-1,-1},
-{356,491,492,-1,-1,-1,-1,-1,-1},
-{110,148,492,493,-1,-1,-1,-1,-1},
-{355,493,494,-1,-1,-1,-1,-1,-1},
-{313,384,494,495,-1,-1,-1,-1,-1},
-{29,87,245,257,495,496,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1,-1},
-{52,56,497,498,-1,-1,-1,-1,-1},
-{11,298,498,499,-1,-1,-1,-1,-1},
-{24,95,301,499,500,-1,-1,-1,-1},
-{76,101,153,500,501,-1,-1,-1,-1},
-{178,193,227,501,502,-1,-1,-1,-1},
-{187,291,502,503,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1,-1},
-{21,339,504,505,-1,-1,-1,-1,-1},
-{187,505,506,-1,-1,-1,-1,-1,-1},
-{343,506,507,-1,-1,-1,-1,-1,-1},
-{234,507,508,-1,-1,-1,-1,-1,-1},
-{362,508,509,-1,-1,-1,-1,-1,-1},
-{188,509,510,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1,-1},
-{41,254,257,511,512,-1,-1,-1,-1},
-{283,345,512,513,-1,-1,-1,-1,-1},
-{332,513,514,-1,-1,-1,-1,-1,-1},
-{91,514,515,-1,-1,-1,-1,-1,-1},
-{179,354,383,515,516,-1,-1,-1,-1},
-{223,516,517,-1,-1,-1,-1,-1,-1},
-{2,30,38,200,399,517,518,-1,-1},
-{24,67,109,247,518,519,-1,-1,-1},
-{72,519,520,-1,-1,-1,-1,-1,-1},
-{203,520,521,-1,-1,-1,-1,-1,-1},
-{305,329,521,522,-1,-1,-1,-1,-1},
-{64,96,146,244,390,522,523,-1,-1},
-{43,63,64,109,196,267,294,523,524},
-{313,524,525,-1,-1,-1,-1,-1,-1},
-{337,525,526,-1,-1,-1,-1,-1,-1},
-{209,239,526,527,-1,-1,-1,-1,-1},
-{36,78,161,255,527,528,-1,-1,-1},
-{0,528,529,-1,-1,-1,-1,-1,-1},
-{190,529,530,-1,-1,-1,-1,-1,-1},
-{221,530,531,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1,-1},
-{59,111,222,276,532,533,-1,-1,-1},
-{176,220,367,386,533,534,-1,-1,-1},
-{198,331,534,535,-1,-1,-1,-1,-1},
-{10,112,191,535,536,-1,-1,-1,-1},
-{5,57,124,305,536,537,-1,-1,-1},
-{34,50,537,538,-1,-1,-1,-1,-1},
-{109,159,204,309,352,359,538,539,-1},
-{350,369,539,540,-1,-1,-1,-1,-1},
-{188,284,343,540,541,-1,-1,-1,-1},
-{8,108,250,541,542,-1,-1,-1,-1},
-{261,542,543,-1,-1,-1,-1,-1,-1},
-{380,543,544,-1,-1,-1,-1,-1,-1},
-{234,240,364,544,545,-1,-1,-1,-1},
-{176,300,390,545,546,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1,-1},
-{28,547,548,-1,-1,-1,-1,-1,-1},
-{183,548,549,-1,-1,-1,-1,-1,-1},
-{69,549,550,-1,-1,-1,-1,-1,-1},
-{272,550,551,-1,-1,-1,-1,-1,-1},
-{214,235,259,551,552,-1,-1,-1,-1},
-{163,552,553,-1,-1,-1,-1,-1,-1},
-{238,553,554,-1,-1,-1,-1,-1,-1},
-{179,554,555,-1,-1,-1,-1,-1,-1},
-{65,555,556,-1,-1,-1,-1,-1,-1},
-{333,556,557,-1,-1,-1,-1,-1,-1},
-{73,195,557,558,-1,-1,-1,-1,-1},
-{159,558,559,-1,-1,-1,-1,-1,-1},
-{126,131,559,560,-1,-1,-1,-1,-1},
-{223,247,300,560,561,-1,-1,-1,-1},
-{370,379,561,562,-1,-1,-1,-1,-1},
-{96,254,383,562,563,-1,-1,-1,-1},
-{72,130,563,564,-1,-1,-1,-1,-1},
-{98,134,564,565,-1,-1,-1,-1,-1},
-{248,565,566,-1,-1,-1,-1,-1,-1},
-{12,566,567,-1,-1,-1,-1,-1,-1},
-{299,567,568,-1,-1,-1,-1,-1,-1},
-{89,568,569,-1,-1,-1,-1,-1,-1},
-{5,40,395,569,570,-1,-1,-1,-1},
-{185,570,571,-1,-1,-1,-1,-1,-1},
-{129,271,331,398,571,572,-1,-1,-1},
-{344,572,573,-1,-1,-1,-1,-1,-1},
-{232,573,574,-1,-1,-1,-1,-1,-1},
-{38,574,575,-1,-1,-1,-1,-1,-1},
-{134,385,575,576,-1,-1,-1,-1,-1},
-{39,176,576,577,-1,-1,-1,-1,-1},
-{324,577,578,-1,-1,-1,-1,-1,-1},
-{161,208,342,578,579,-1,-1,-1,-1},
-{25,363,579,580,-1,-1,-1,-1,-1},
-{142,580,581,-1,-1,-1,-1,-1,-1},
-{103,316,351,581,582,-1,-1,-1,-1},
-{303,582,583,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1,-1},
-{70,584,585,-1,-1,-1,-1,-1,-1},
-{199,362,585,586,-1,-1,-1,-1,-1},
-{91,94,227,256,586,587,-1,-1,-1},
-{21,587,588,-1,-1,-1,-1,-1,-1},
-{151,361,588,589,-1,-1,-1,-1,-1},
-{276,589,590,-1,-1,-1,-1,-1,-1},
-{109,146,590,591,-1,-1,-1,-1,-1},
-{160,165,591,592,-1,-1,-1,-1,-1},
-{183,298,592,593,-1,-1,-1,-1,-1},
-{209,593,594,-1,-1,-1,-1,-1,-1},
-{35,197,266,594,595,-1,-1,-1,-1},
-{145,595,596,-1,-1,-1,-1,-1,-1},
-{84,101,377,596,597,-1,-1,-1,-1},
-{93,225,316,320,597,598,-1,-1,-1},
-{148,150,598,599,-1,-1,-1,-1,-1},
-{353,599,600,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1,-1},
-{27,60,601,602,-1,-1,-1,-1,-1},
-{199,602,603,-1,-1,-1,-1,-1,-1},
-{0,603,604,-1,-1,-1,-1,-1,-1},
-{369,604,605,-1,-1,-1,-1,-1,-1},
-{16,165,605,606,-1,-1,-1,-1,-1},
-{5,165,361,370,606,607,-1,-1,-1},
-{18,131,221,607,608,-1,-1,-1,-1},
-{67,94,302,355,608,609,-1,-1,-1},
-{130,290,305,323,609,610,-1,-1,-1},
-{299,356,610,611,-1,-1,-1,-1,-1},
-{176,331,611,612,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1,-1},
-{123,613,614,-1,-1,-1,-1,-1,-1},
-{202,614,615,-1,-1,-1,-1,-1,-1},
-{110,336,615,616,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1,-1},
-{31,130,145,146,617,618,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1,-1},
-{80,171,394,619,620,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1,-1},
-{66,84,173,375,621,622,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1,-1},
-{14,212,623,624,-1,-1,-1,-1,-1},
-{392,624,625,-1,-1,-1,-1,-1,-1},
-{1,3,299,625,626,-1,-1,-1,-1},
-{38,140,164,626,627,-1,-1,-1,-1},
-{20,72,244,360,627,628,-1,-1,-1},
-{74,285,315,628,629,-1,-1,-1,-1},
-{134,629,630,-1,-1,-1,-1,-1,-1},
-{179,630,631,-1,-1,-1,-1,-1,-1},
-{50,283,357,631,632,-1,-1,-1,-1},
-{256,371,632,633,-1,-1,-1,-1,-1},
-{383,633,634,-1,-1,-1,-1,-1,-1},
-{95,330,634,635,-1,-1,-1,-1,-1},
-{82,341,635,636,-1,-1,-1,-1,-1},
-{103,209,636,637,-1,-1,-1,-1,-1},
-{2,212,213,262,637,638,-1,-1,-1},
-{141,638,639,-1,-1,-1,-1,-1,-1},
-{138,216,261,639,640,-1,-1,-1,-1},
-{151,640,641,-1,-1,-1,-1,-1,-1},
-{132,238,641,642,-1,-1,-1,-1,-1},
-{57,134,203,642,643,-1,-1,-1,-1},
-{39,157,246,286,309,643,644,-1,-1},
-{100,291,300,644,645,-1,-1,-1,-1},
-{208,645,646,-1,-1,-1,-1,-1,-1},
-{340,646,647,-1,-1,-1,-1,-1,-1},
-{223,361,380,647,648,-1,-1,-1,-1},
-{225,648,649,-1,-1,-1,-1,-1,-1},
-{123,649,650,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1,-1},
-{370,651,652,-1,-1,-1,-1,-1,-1},
-{53,57,274,652,653,-1,-1,-1,-1},
-{55,183,227,653,654,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1,-1},
-{324,349,376,655,656,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1,-1},
-{113,657,658,-1,-1,-1,-1,-1,-1},
-{174,658,659,-1,-1,-1,-1,-1,-1},
-{112,386,659,660,-1,-1,-1,-1,-1},
-{119,245,389,390,660,661,-1,-1,-1},
-{337,661,662,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1,-1},
-{33,663,664,-1,-1,-1,-1,-1,-1},
-{68,384,664,665,-1,-1,-1,-1,-1},
-{283,332,665,666,-1,-1,-1,-1,-1},
-{240,666,667,-1,-1,-1,-1,-1,-1},
-{74,149,155,373,667,668,-1,-1,-1},
-{83,668,669,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1,-1},
-{294,670,671,-1,-1,-1,-1,-1,-1},
-{63,91,671,672,-1,-1,-1,-1,-1},
-{172,174,672,673,-1,-1,-1,-1,-1},
-{72,195,673,674,-1,-1,-1,-1,-1},
-{171,674,675,-1,-1,-1,-1,-1,-1},
-{118,675,676,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1,-1},
-{143,339,677,678,-1,-1,-1,-1,-1},
-{357,678,679,-1,-1,-1,-1,-1,-1},
-{83,144,679,680,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1,-1},
-{345,681,682,-1,-1,-1,-1,-1,-1},
-{122,324,325,343,376,396,682,683,-1},
-{86,234,238,386,683,684,-1,-1,-1},
-{28,163,684,685,-1,-1,-1,-1,-1},
-{52,126,165,181,282,685,686,-1,-1},
-{46,283,686,687,-1,-1,-1,-1,-1},
-{246,262,687,688,-1,-1,-1,-1,-1},
-{79,165,238,344,688,689,-1,-1,-1},
-{264,689,690,-1,-1,-1,-1,-1,-1},
-{43,690,691,-1,-1,-1,-1,-1,-1},
-{19,84,691,692,-1,-1,-1,-1,-1},
-{179,195,692,693,-1,-1,-1,-1,-1},
-{67,693,694,-1,-1,-1,-1,-1,-1},
-{128,186,240,352,694,695,-1,-1,-1},
-{156,237,695,696,-1,-1,-1,-1,-1},
-{3,133,188,285,336,355,696,697,-1},
-{16,75,697,698,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1,-1},
-{382,699,700,-1,-1,-1,-1,-1,-1},
-{15,167,700,701,-1,-1,-1,-1,-1},
-{109,118,195,386,701,702,-1,-1,-1},
-{138,140,702,703,-1,-1,-1,-1,-1},
-{31,240,262,703,704,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1,-1},
-{29,705,706,-1,-1,-1,-1,-1,-1},
-{25,219,234,706,707,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1,-1},
-{67,708,709,-1,-1,-1,-1,-1,-1},
-{52,272,709,710,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1,-1},
-{248,711,712,-1,-1,-1,-1,-1,-1},
-{35,265,283,326,336,712,713,-1,-1},
-{61,713,714,-1,-1,-1,-1,-1,-1},
-{38,211,714,715,-1,-1,-1,-1,-1},
-{393,715,716,-1,-1,-1,-1,-1,-1},
-{16,310,716,717,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1,-1},
-{77,718,719,-1,-1,-1,-1,-1,-1},
-{273,285,719,720,-1,-1,-1,-1,-1},
-{125,720,721,-1,-1,-1,-1,-1,-1},
-{277,285,721,722,-1,-1,-1,-1,-1},
-{53,722,723,-1,-1,-1,-1,-1,-1},
-{216,723,724,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1,-1},
-{64,99,221,335,725,726,-1,-1,-1},
-{213,726,727,-1,-1,-1,-1,-1,-1},
-{155,727,728,-1,-1,-1,-1,-1,-1},
-{131,728,729,-1,-1,-1,-1,-1,-1},
-{302,729,730,-1,-1,-1,-1,-1,-1},
-{86,288,730,731,-1,-1,-1,-1,-1},
-{76,309,731,732,-1,-1,-1,-1,-1},
-{106,224,306,368,390,732,733,-1,-1},
-{42,292,312,733,734,-1,-1,-1,-1},
-{99,184,251,734,735,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1,-1},
-{357,736,737,-1,-1,-1,-1,-1,-1},
-{44,111,149,737,738,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1,-1},
-{314,332,385,739,740,-1,-1,-1,-1},
-{30,246,258,740,741,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1,-1},
-{53,57,742,743,-1,-1,-1,-1,-1},
-{299,376,743,744,-1,-1,-1,-1,-1},
-{25,302,744,745,-1,-1,-1,-1,-1},
-{77,102,154,745,746,-1,-1,-1,-1},
-{164,179,194,746,747,-1,-1,-1,-1},
-{296,747,748,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1,-1},
-{22,749,750,-1,-1,-1,-1,-1,-1},
-{300,750,751,-1,-1,-1,-1,-1,-1},
-{12,88,751,752,-1,-1,-1,-1,-1},
-{235,752,753,-1,-1,-1,-1,-1,-1},
-{363,753,754,-1,-1,-1,-1,-1,-1},
-{189,368,754,755,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1,-1},
-{42,255,258,756,757,-1,-1,-1,-1},
-{346,757,758,-1,-1,-1,-1,-1,-1},
-{333,758,759,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1},
-{316,355,760,761,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1,-1},
-{3,31,39,201,762,763,-1,-1,-1},
-{25,110,296,763,764,-1,-1,-1,-1},
-{73,284,368,764,765,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1,-1},
-{306,330,766,767,-1,-1,-1,-1,-1},
-{65,97,147,232,245,391,767,768,-1},
-{65,110,197,268,295,768,769,-1,-1},
-{228,314,769,770,-1,-1,-1,-1,-1},
-{338,770,771,-1,-1,-1,-1,-1,-1},
-{210,771,772,-1,-1,-1,-1,-1,-1},
-{37,79,162,772,773,-1,-1,-1,-1},
-{1,773,774,-1,-1,-1,-1,-1,-1},
-{191,774,775,-1,-1,-1,-1,-1,-1},
-{222,280,775,776,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1,-1},
-{223,277,777,778,-1,-1,-1,-1,-1},
-{177,221,324,387,778,779,-1,-1,-1},
-{199,779,780,-1,-1,-1,-1,-1,-1},
-{11,113,304,780,781,-1,-1,-1,-1},
-{6,58,125,306,376,781,782,-1,-1},
-{35,51,782,783,-1,-1,-1,-1,-1},
-{110,205,310,353,783,784,-1,-1,-1},
-{351,370,784,785,-1,-1,-1,-1,-1},
-{189,285,785,786,-1,-1,-1,-1,-1},
-{9,109,251,264,786,787,-1,-1,-1},
-{262,787,788,-1,-1,-1,-1,-1,-1},
-{381,788,789,-1,-1,-1,-1,-1,-1},
-{235,241,365,789,790,-1,-1,-1,-1},
-{177,301,391,790,791,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1},
-{29,80,792,793,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1},
-{70,216,794,795,-1,-1,-1,-1,-1},
-{136,273,795,796,-1,-1,-1,-1,-1},
-{204,215,312,796,797,-1,-1,-1,-1},
-{8,797,798,-1,-1,-1,-1,-1,-1},
-{236,239,798,799,-1,-1,-1,-1,-1},
-{80,799,800,-1,-1,-1,-1,-1,-1},
-{66,800,801,-1,-1,-1,-1,-1,-1},
-{334,801,802,-1,-1,-1,-1,-1,-1},
-{74,802,803,-1,-1,-1,-1,-1,-1},
-{803,804,-1,-1,-1,-1,-1,-1,-1},
-{127,804,805,-1,-1,-1,-1,-1,-1},
-{136,180,301,805,806,-1,-1,-1,-1},
-{371,806,807,-1,-1,-1,-1,-1,-1},
-{97,255,807,808,-1,-1,-1,-1,-1},
-{32,73,131,808,809,-1,-1,-1,-1},
-{0,99,135,809,810,-1,-1,-1,-1},
-{144,249,810,811,-1,-1,-1,-1,-1},
-{13,811,812,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1},
-{90,813,814,-1,-1,-1,-1,-1,-1},
-{6,41,814,815,-1,-1,-1,-1,-1},
-{104,186,815,816,-1,-1,-1,-1,-1},
-{130,399,816,817,-1,-1,-1,-1,-1},
-{345,817,818,-1,-1,-1,-1,-1,-1},
-{60,233,818,819,-1,-1,-1,-1,-1},
-{39,396,819,820,-1,-1,-1,-1,-1},
-{128,135,228,386,820,821,-1,-1,-1},
-{177,821,822,-1,-1,-1,-1,-1,-1},
-{56,264,325,822,823,-1,-1,-1,-1},
-{162,209,343,384,823,824,-1,-1,-1},
-{26,824,825,-1,-1,-1,-1,-1,-1},
-{143,264,328,825,826,-1,-1,-1,-1},
-{268,317,328,826,827,-1,-1,-1,-1},
-{827,828,-1,-1,-1,-1,-1,-1,-1},
-{828,829,-1,-1,-1,-1,-1,-1,-1},
-{71,316,328,829,830,-1,-1,-1,-1},
-{168,363,830,831,-1,-1,-1,-1,-1},
-{95,257,320,831,832,-1,-1,-1,-1},
-{22,832,833,-1,-1,-1,-1,-1,-1},
-{12,362,833,834,-1,-1,-1,-1,-1},
-{277,834,835,-1,-1,-1,-1,-1,-1},
-{110,147,835,836,-1,-1,-1,-1,-1},
-{161,166,836,837,-1,-1,-1,-1,-1},
-{299,837,838,-1,-1,-1,-1,-1,-1},
-{112,192,210,838,839,-1,-1,-1,-1},
-{198,267,839,840,-1,-1,-1,-1,-1},
-{146,840,841,-1,-1,-1,-1,-1,-1},
-{16,85,102,104,378,841,842,-1,-1},
-{94,226,317,321,842,843,-1,-1,-1},
-{149,151,843,844,-1,-1,-1,-1,-1},
-{354,844,845,-1,-1,-1,-1,-1,-1},
-{845,846,-1,-1,-1,-1,-1,-1,-1},
-{61,846,847,-1,-1,-1,-1,-1,-1},
-{847,848,-1,-1,-1,-1,-1,-1,-1},
-{1,848,849,-1,-1,-1,-1,-1,-1},
-{370,849,850,-1,-1,-1,-1,-1,-1},
-{17,166,260,850,851,-1,-1,-1,-1},
-{6,166,228,362,371,851,852,-1,-1},
-{19,222,852,853,-1,-1,-1,-1,-1},
-{95,303,853,854,-1,-1,-1,-1,-1},
-{131,291,306,854,855,-1,-1,-1,-1},
-{357,855,856,-1,-1,-1,-1,-1,-1},
-{16,177,856,857,-1,-1,-1,-1,-1},
-{372,857,858,-1,-1,-1,-1,-1,-1},
-{204,858,859,-1,-1,-1,-1,-1,-1},
-{56,203,859,860,-1,-1,-1,-1,-1},
-{111,337,860,861,-1,-1,-1,-1,-1},
-{861,862,-1,-1,-1,-1,-1,-1,-1},
-{84,131,146,147,236,862,863,-1,-1},
-{863,864,-1,-1,-1,-1,-1,-1,-1},
-{81,395,864,865,-1,-1,-1,-1,-1},
-{80,865,866,-1,-1,-1,-1,-1,-1},
-{67,85,174,866,867,-1,-1,-1,-1},
-{4,867,868,-1,-1,-1,-1,-1,-1},
-{15,213,868,869,-1,-1,-1,-1,-1},
-{393,869,870,-1,-1,-1,-1,-1,-1},
-{2,870,871,-1,-1,-1,-1,-1,-1},
-{39,141,165,871,872,-1,-1,-1,-1},
-{21,73,245,361,872,873,-1,-1,-1},
-{75,286,873,874,-1,-1,-1,-1,-1},
-{135,874,875,-1,-1,-1,-1,-1,-1},
-{875,876,-1,-1,-1,-1,-1,-1,-1},
-{24,51,132,144,358,876,877,-1,-1},
-{257,877,878,-1,-1,-1,-1,-1,-1},
-{878,879,-1,-1,-1,-1,-1,-1,-1},
-{16,331,879,880,-1,-1,-1,-1,-1},
-{83,342,880,881,-1,-1,-1,-1,-1},
-{210,260,881,882,-1,-1,-1,-1,-1},
-{3,80,213,214,263,380,882,883,-1},
-{142,883,884,-1,-1,-1,-1,-1,-1},
-{139,217,262,884,885,-1,-1,-1,-1},
-{885,886,-1,-1,-1,-1,-1,-1,-1},
-{133,239,886,887,-1,-1,-1,-1,-1},
-{58,135,887,888,-1,-1,-1,-1,-1},
-{56,158,247,287,310,888,889,-1,-1},
-{101,301,889,890,-1,-1,-1,-1,-1},
-{209,890,891,-1,-1,-1,-1,-1,-1},
-{341,891,892,-1,-1,-1,-1,-1,-1},
-{362,381,892,893,-1,-1,-1,-1,-1},
-{226,893,894,-1,-1,-1,-1,-1,-1},
-{894,895,-1,-1,-1,-1,-1,-1,-1},
-{895,896,-1,-1,-1,-1,-1,-1,-1},
-{371,896,897,-1,-1,-1,-1,-1,-1},
-{54,58,275,897,898,-1,-1,-1,-1},
-{898,899,-1,-1,-1,-1,-1,-1,-1},
-{32,260,899,900,-1,-1,-1,-1,-1},
-{284,325,350,377,900,901,-1,-1,-1},
-{232,901,902,-1,-1,-1,-1,-1,-1},
-{114,902,903,-1,-1,-1,-1,-1,-1},
-{175,184,288,360,903,904,-1,-1,-1},
-{113,387,904,905,-1,-1,-1,-1,-1},
-{246,390,391,905,906,-1,-1,-1,-1},
-{338,906,907,-1,-1,-1,-1,-1,-1},
-{68,907,908,-1,-1,-1,-1,-1,-1},
-{34,908,909,-1,-1,-1,-1,-1,-1},
-{48,69,385,909,910,-1,-1,-1,-1},
-{333,910,911,-1,-1,-1,-1,-1,-1},
-{241,388,911,912,-1,-1,-1,-1,-1},
-{75,150,364,374,912,913,-1,-1,-1},
-{913,914,-1,-1,-1,-1,-1,-1,-1},
-{914,915,-1,-1,-1,-1,-1,-1,-1},
-{295,915,916,-1,-1,-1,-1,-1,-1},
-{916,917,-1,-1,-1,-1,-1,-1,-1},
-{173,175,917,918,-1,-1,-1,-1,-1},
-{73,918,919,-1,-1,-1,-1,-1,-1},
-{919,920,-1,-1,-1,-1,-1,-1,-1},
-{119,216,252,920,921,-1,-1,-1,-1},
-{336,921,922,-1,-1,-1,-1,-1,-1},
-{922,923,-1,-1,-1,-1,-1,-1,-1},
-{358,923,924,-1,-1,-1,-1,-1,-1},
-{145,924,925,-1,-1,-1,-1,-1,-1},
-{925,926,-1,-1,-1,-1,-1,-1,-1},
-{188,346,926,927,-1,-1,-1,-1,-1},
-{123,325,326,377,397,927,928,-1,-1},
-{87,235,239,387,928,929,-1,-1,-1},
-{29,44,236,929,930,-1,-1,-1,-1},
-{53,127,144,166,182,283,930,931,-1},
-{47,931,932,-1,-1,-1,-1,-1,-1},
-{247,263,932,933,-1,-1,-1,-1,-1},
-{166,239,345,933,934,-1,-1,-1,-1},
-{265,934,935,-1,-1,-1,-1,-1,-1},
-{935,936,-1,-1,-1,-1,-1,-1,-1},
-{85,936,937,-1,-1,-1,-1,-1,-1},
-{937,938,-1,-1,-1,-1,-1,-1,-1},
-{938,939,-1,-1,-1,-1,-1,-1,-1},
-{129,187,224,241,353,939,940,-1,-1},
-{157,238,940,941,-1,-1,-1,-1,-1},
-{134,189,284,286,337,941,942,-1,-1},
-{17,942,943,-1,-1,-1,-1,-1,-1},
-{943,944,-1,-1,-1,-1,-1,-1,-1},
-{383,944,945,-1,-1,-1,-1,-1,-1},
-{945,946,-1,-1,-1,-1,-1,-1,-1},
-{110,119,387,946,947,-1,-1,-1,-1},
-{139,141,947,948,-1,-1,-1,-1,-1},
-{241,263,948,949,-1,-1,-1,-1,-1},
-{949,950,-1,-1,-1,-1,-1,-1,-1},
-{30,100,376,950,951,-1,-1,-1,-1},
-{24,26,235,951,952,-1,-1,-1,-1},
-{360,952,953,-1,-1,-1,-1,-1,-1},
-{288,953,954,-1,-1,-1,-1,-1,-1},
-{53,273,954,955,-1,-1,-1,-1,-1},
-{312,955,956,-1,-1,-1,-1,-1,-1},
-{249,956,957,-1,-1,-1,-1,-1,-1},
-{266,327,337,957,958,-1,-1,-1,-1},
-{62,352,958,959,-1,-1,-1,-1,-1},
-{39,959,960,-1,-1,-1,-1,-1,-1},
-{84,394,960,961,-1,-1,-1,-1,-1},
-{17,311,961,962,-1,-1,-1,-1,-1},
-{962,963,-1,-1,-1,-1,-1,-1,-1},
-{8,78,963,964,-1,-1,-1,-1,-1},
-{92,274,286,964,965,-1,-1,-1,-1},
-{126,965,966,-1,-1,-1,-1,-1,-1},
-{224,278,286,966,967,-1,-1,-1,-1},
-{54,184,288,967,968,-1,-1,-1,-1},
-{217,968,969,-1,-1,-1,-1,-1,-1},
-{336,969,970,-1,-1,-1,-1,-1,-1},
-{65,184,222,970,971,-1,-1,-1,-1},
-{214,340,971,972,-1,-1,-1,-1,-1},
-{972,973,-1,-1,-1,-1,-1,-1,-1},
-{973,974,-1,-1,-1,-1,-1,-1,-1},
-{303,974,975,-1,-1,-1,-1,-1,-1},
-{87,289,975,976,-1,-1,-1,-1,-1},
-{77,310,976,977,-1,-1,-1,-1,-1},
-{107,225,280,307,369,391,977,978,-1},
-{43,293,313,978,979,-1,-1,-1,-1},
-{88,185,979,980,-1,-1,-1,-1,-1},
-{176,380,980,981,-1,-1,-1,-1,-1},
-{220,358,981,982,-1,-1,-1,-1,-1},
-{45,150,396,982,983,-1,-1,-1,-1},
-{64,244,983,984,-1,-1,-1,-1,-1},
-{315,333,386,984,985,-1,-1,-1,-1},
-{31,200,247,259,985,986,-1,-1,-1},
-{986,987,-1,-1,-1,-1,-1,-1,-1},
-{54,58,987,988,-1,-1,-1,-1,-1},
-{40,60,264,377,988,989,-1,-1,-1},
-{26,303,989,990,-1,-1,-1,-1,-1},
-{78,103,155,990,991,-1,-1,-1,-1},
-{165,195,236,991,992,-1,-1,-1,-1},
-{252,297,992,993,-1,-1,-1,-1,-1},
-{993,994,-1,-1,-1,-1,-1,-1,-1},
-{23,994,995,-1,-1,-1,-1,-1,-1},
-{301,995,996,-1,-1,-1,-1,-1,-1},
-{13,89,996,997,-1,-1,-1,-1,-1},
-{56,108,997,998,-1,-1,-1,-1,-1},
-{364,998,999,-1,-1,-1,-1,-1,-1},
-{190,328,369,999,1000,-1,-1,-1,-1},
-{188,1000,1001,-1,-1,-1,-1,-1,-1},
-{43,259,1001,1002,-1,-1,-1,-1,-1},
-{347,1002,1003,-1,-1,-1,-1,-1,-1},
-{156,334,356,1003,1004,-1,-1,-1,-1},
-{1004,1005,-1,-1,-1,-1,-1,-1,-1},
-{317,340,1005,1006,-1,-1,-1,-1,-1},
-{1006,1007,-1,-1,-1,-1,-1,-1,-1},
-{202,1007,1008,-1,-1,-1,-1,-1,-1},
-{26,111,297,1008,1009,-1,-1,-1,-1},
-{74,285,369,1009,1010,-1,-1,-1,-1},
-{1010,1011,-1,-1,-1,-1,-1,-1,-1},
-{307,331,1011,1012,-1,-1,-1,-1,-1},
-{66,98,233,246,1012,1013,-1,-1,-1},
-{66,111,180,198,269,1013,1014,-1,-1},
-{229,315,1014,1015,-1,-1,-1,-1,-1},
-{339,1015,1016,-1,-1,-1,-1,-1,-1},
-{211,232,256,1016,1017,-1,-1,-1,-1},
-{38,160,163,1017,1018,-1,-1,-1,-1},
-{2,1018,1019,-1,-1,-1,-1,-1,-1},
-{176,1019,1020,-1,-1,-1,-1,-1,-1},
-{223,281,1020,1021,-1,-1,-1,-1,-1},
-{1021,1022,-1,-1,-1,-1,-1,-1,-1},
-{192,278,1022,1023,-1,-1,-1,-1,-1},
-{156,178,222,325,1023,1024,-1,-1,-1},
-{128,1024,1025,-1,-1,-1,-1,-1,-1},
-{114,220,244,305,1025,1026,-1,-1,-1},
-{7,59,126,307,376,377,1026,1027,-1},
-{380,1027,1028,-1,-1,-1,-1,-1,-1},
-{111,206,311,354,1028,1029,-1,-1,-1},
-{371,1029,1030,-1,-1,-1,-1,-1,-1},
-{190,286,1030,1031,-1,-1,-1,-1,-1},
-{10,110,265,1031,1032,-1,-1,-1,-1},
-{263,296,1032,1033,-1,-1,-1,-1,-1},
-{382,1033,1034,-1,-1,-1,-1,-1,-1},
-{242,366,392,1034,1035,-1,-1,-1,-1},
-{178,302,1035,1036,-1,-1,-1,-1,-1},
-{268,328,1036,1037,-1,-1,-1,-1,-1},
-{30,81,1037,1038,-1,-1,-1,-1,-1},
-{1038,1039,-1,-1,-1,-1,-1,-1,-1},
-{71,217,1039,1040,-1,-1,-1,-1,-1},
-{137,274,1040,1041,-1,-1,-1,-1,-1},
-{36,205,313,1041,1042,-1,-1,-1,-1},
-{9,1042,1043,-1,-1,-1,-1,-1,-1},
-{237,1043,1044,-1,-1,-1,-1,-1,-1},
-{81,360,1044,1045,-1,-1,-1,-1,-1},
-{67,1045,1046,-1,-1,-1,-1,-1,-1},
-{100,335,348,1046,1047,-1,-1,-1,-1},
-{75,300,1047,1048,-1,-1,-1,-1,-1},
-{1048,1049,-1,-1,-1,-1,-1,-1,-1},
-{1049,1050,-1,-1,-1,-1,-1,-1,-1},
-{137,181,196,302,1050,1051,-1,-1,-1},
-{88,224,1051,1052,-1,-1,-1,-1,-1},
-{98,1052,1053,-1,-1,-1,-1,-1,-1},
-{33,74,148,1053,1054,-1,-1,-1,-1},
-{1,1054,1055,-1,-1,-1,-1,-1,-1},
-{145,250,1055,1056,-1,-1,-1,-1,-1},
-{14,1056,1057,-1,-1,-1,-1,-1,-1},
-{180,1057,1058,-1,-1,-1,-1,-1,-1},
-{91,1058,1059,-1,-1,-1,-1,-1,-1},
-{7,32,42,1059,1060,-1,-1,-1,-1},
-{105,187,1060,1061,-1,-1,-1,-1,-1},
-{131,1061,1062,-1,-1,-1,-1,-1,-1},
-{346,1062,1063,-1,-1,-1,-1,-1,-1},
-{61,234,1063,1064,-1,-1,-1,-1,-1},
-{397,1064,1065,-1,-1,-1,-1,-1,-1},
-{129,229,387,1065,1066,-1,-1,-1,-1},
-{24,178,1066,1067,-1,-1,-1,-1,-1},
-{57,196,265,326,1067,1068,-1,-1,-1},
-{163,210,385,1068,1069,-1,-1,-1,-1},
-{27,1069,1070,-1,-1,-1,-1,-1,-1},
-{265,329,1070,1071,-1,-1,-1,-1,-1},
-{269,318,329,1071,1072,-1,-1,-1,-1},
-{128,1072,1073,-1,-1,-1,-1,-1,-1},
-{64,352,1073,1074,-1,-1,-1,-1,-1},
-{317,320,329,1074,1075,-1,-1,-1,-1},
-{169,296,1075,1076,-1,-1,-1,-1,-1},
-{258,321,328,1076,1077,-1,-1,-1,-1},
-{23,1077,1078,-1,-1,-1,-1,-1,-1},
-{13,120,363,1078,1079,-1,-1,-1,-1},
-{278,1079,1080,-1,-1,-1,-1,-1,-1},
-{111,1080,1081,-1,-1,-1,-1,-1,-1},
-{162,167,1081,1082,-1,-1,-1,-1,-1},
-{28,1082,1083,-1,-1,-1,-1,-1,-1},
-{113,193,211,1083,1084,-1,-1,-1,-1},
-{168,199,1084,1085,-1,-1,-1,-1,-1},
-{147,1085,1086,-1,-1,-1,-1,-1,-1},
-{17,86,103,105,372,379,1086,1087,-1},
-{95,227,318,322,1087,1088,-1,-1,-1},
-{150,1088,1089,-1,-1,-1,-1,-1,-1},
-{355,1089,1090,-1,-1,-1,-1,-1,-1},
-{0,296,1090,1091,-1,-1,-1,-1,-1},
-{62,1091,1092,-1,-1,-1,-1,-1,-1},
-{1092,1093,-1,-1,-1,-1,-1,-1,-1},
-{2,312,1093,1094,-1,-1,-1,-1,-1},
-{371,1094,1095,-1,-1,-1,-1,-1,-1},
-{18,167,176,261,1095,1096,-1,-1,-1},
-{7,167,229,280,363,1096,1097,-1,-1},
-{223,368,1097,1098,-1,-1,-1,-1,-1},
-{380,1098,1099,-1,-1,-1,-1,-1,-1},
-{92,307,1099,1100,-1,-1,-1,-1,-1},
-{358,1100,1101,-1,-1,-1,-1,-1,-1},
-{17,100,178,1101,1102,-1,-1,-1,-1},
-{373,1102,1103,-1,-1,-1,-1,-1,-1},
-{205,1103,1104,-1,-1,-1,-1,-1,-1},
-{57,1104,1105,-1,-1,-1,-1,-1,-1},
-{148,338,1105,1106,-1,-1,-1,-1,-1},
-{1106,1107,-1,-1,-1,-1,-1,-1,-1},
-{85,147,200,237,1107,1108,-1,-1,-1},
-{36,1108,1109,-1,-1,-1,-1,-1,-1},
-{82,288,1109,1110,-1,-1,-1,-1,-1},
-{81,1110,1111,-1,-1,-1,-1,-1,-1},
-{86,175,1111,1112,-1,-1,-1,-1,-1},
-{5,220,1112,1113,-1,-1,-1,-1,-1},
-{214,1113,1114,-1,-1,-1,-1,-1,-1},
-{120,394,1114,1115,-1,-1,-1,-1,-1},
-{3,1115,1116,-1,-1,-1,-1,-1,-1},
-{142,166,1116,1117,-1,-1,-1,-1,-1},
-{22,74,246,362,1117,1118,-1,-1,-1},
-{52,180,224,287,1118,1119,-1,-1,-1},
-{1119,1120,-1,-1,-1,-1,-1,-1,-1},
-{1120,1121,-1,-1,-1,-1,-1,-1,-1},
-{25,133,145,359,1121,1122,-1,-1,-1},
-{258,1122,1123,-1,-1,-1,-1,-1,-1},
-{1123,1124,-1,-1,-1,-1,-1,-1,-1},
-{17,1124,1125,-1,-1,-1,-1,-1,-1},
-{116,343,1125,1126,-1,-1,-1,-1,-1},
-{211,261,1126,1127,-1,-1,-1,-1,-1},
-{81,214,215,381,1127,1128,-1,-1,-1},
-{143,1128,1129,-1,-1,-1,-1,-1,-1},
-{218,263,1129,1130,-1,-1,-1,-1,-1},
-{280,1130,1131,-1,-1,-1,-1,-1,-1},
-{134,1131,1132,-1,-1,-1,-1,-1,-1},
-{59,152,1132,1133,-1,-1,-1,-1,-1},
-{57,80,159,311,1133,1134,-1,-1,-1},
-{102,302,1134,1135,-1,-1,-1,-1,-1},
-{210,1135,1136,-1,-1,-1,-1,-1,-1},
-{60,88,342,1136,1137,-1,-1,-1,-1},
-{363,382,1137,1138,-1,-1,-1,-1,-1},
-{192,227,1138,1139,-1,-1,-1,-1,-1},
-{168,1139,1140,-1,-1,-1,-1,-1,-1},
-{1140,1141,-1,-1,-1,-1,-1,-1,-1},
-{1141,1142,-1,-1,-1,-1,-1,-1,-1},
-{55,59,140,336,1142,1143,-1,-1,-1},
-{1143,1144,-1,-1,-1,-1,-1,-1,-1},
-{33,80,261,1144,1145,-1,-1,-1,-1},
-{285,326,351,378,1145,1146,-1,-1,-1},
-{233,1146,1147,-1,-1,-1,-1,-1,-1},
-{115,340,1147,1148,-1,-1,-1,-1,-1},
-{185,289,361,1148,1149,-1,-1,-1,-1},
-{114,160,1149,1150,-1,-1,-1,-1,-1},
-{247,391,1150,1151,-1,-1,-1,-1,-1},
-{280,339,1151,1152,-1,-1,-1,-1,-1},
-{69,1152,1153,-1,-1,-1,-1,-1,-1},
-{35,76,1153,1154,-1,-1,-1,-1,-1},
-{49,70,386,1154,1155,-1,-1,-1,-1},
-{40,334,1155,1156,-1,-1,-1,-1,-1},
-{16,242,389,1156,1157,-1,-1,-1,-1},
-{151,176,192,365,375,1157,1158,-1,-1},
-{64,1158,1159,-1,-1,-1,-1,-1,-1},
-{1159,1160,-1,-1,-1,-1,-1,-1,-1},
-{1160,1161,-1,-1,-1,-1,-1,-1,-1},
-{0,352,1161,1162,-1,-1,-1,-1,-1},
-{72,174,1162,1163,-1,-1,-1,-1,-1},
-{74,1163,1164,-1,-1,-1,-1,-1,-1},
-{1164,1165,-1,-1,-1,-1,-1,-1,-1},
-{12,164,217,253,1165,1166,-1,-1,-1},
-{192,337,1166,1167,-1,-1,-1,-1,-1},
-{1167,1168,-1,-1,-1,-1,-1,-1,-1},
-{28,359,1168,1169,-1,-1,-1,-1,-1},
-{146,1169,1170,-1,-1,-1,-1,-1,-1},
-{1170,1171,-1,-1,-1,-1,-1,-1,-1},
-{189,216,347,1171,1172,-1,-1,-1,-1},
-{326,327,378,398,1172,1173,-1,-1,-1},
-{64,1173,1174,-1,-1,-1,-1,-1,-1},
-{30,45,237,1174,1175,-1,-1,-1,-1},
-{54,145,167,183,1175,1176,-1,-1,-1},
-{1176,1177,-1,-1,-1,-1,-1,-1,-1},
-{32,280,1177,1178,-1,-1,-1,-1,-1},
-{167,346,1178,1179,-1,-1,-1,-1,-1},
-{208,266,1179,1180,-1,-1,-1,-1,-1},
-{1180,1181,-1,-1,-1,-1,-1,-1,-1},
-{86,1181,1182,-1,-1,-1,-1,-1,-1},
-{1182,1183,-1,-1,-1,-1,-1,-1,-1},
-{1183,1184,-1,-1,-1,-1,-1,-1,-1},
-{130,225,242,354,1184,1185,-1,-1,-1},
-{158,239,1185,1186,-1,-1,-1,-1,-1},
-{135,190,285,287,338,1186,1187,-1,-1},
-{18,1187,1188,-1,-1,-1,-1,-1,-1},
-{1188,1189,-1,-1,-1,-1,-1,-1,-1},
-{1189,1190,-1,-1,-1,-1,-1,-1,-1},
-{96,332,1190,1191,-1,-1,-1,-1,-1},
-{111,1191,1192,-1,-1,-1,-1,-1,-1},
-{142,152,1192,1193,-1,-1,-1,-1,-1},
-{128,242,1193,1194,-1,-1,-1,-1,-1},
-{1194,1195,-1,-1,-1,-1,-1,-1,-1},
-{31,101,377,1195,1196,-1,-1,-1,-1},
-{25,27,1196,1197,-1,-1,-1,-1,-1},
-{361,1197,1198,-1,-1,-1,-1,-1,-1},
-{289,1198,1199,-1,-1,-1,-1,-1,-1},
-{54,96,248,274,1199,1200,-1,-1,-1},
-{313,1200,1201,-1,-1,-1,-1,-1,-1},
-{250,1201,1202,-1,-1,-1,-1,-1,-1},
-{108,267,338,1202,1203,-1,-1,-1,-1},
-{63,353,1203,1204,-1,-1,-1,-1,-1},
-{1204,1205,-1,-1,-1,-1,-1,-1,-1},
-{85,395,1205,1206,-1,-1,-1,-1,-1},
-{18,1206,1207,-1,-1,-1,-1,-1,-1},
-{1207,1208,-1,-1,-1,-1,-1,-1,-1},
-{9,79,296,1208,1209,-1,-1,-1,-1},
-{93,275,287,1209,1210,-1,-1,-1,-1},
-{127,1210,1211,-1,-1,-1,-1,-1,-1},
-{176,225,279,287,1211,1212,-1,-1,-1},
-{55,185,289,1212,1213,-1,-1,-1,-1},
-{218,1213,1214,-1,-1,-1,-1,-1,-1},
-{337,1214,1215,-1,-1,-1,-1,-1,-1},
-{66,185,223,1215,1216,-1,-1,-1,-1},
-{215,341,1216,1217,-1,-1,-1,-1,-1},
-{232,1217,1218,-1,-1,-1,-1,-1,-1},
-{360,1218,1219,-1,-1,-1,-1,-1,-1},
-{1219,1220,-1,-1,-1,-1,-1,-1,-1},
-{290,1220,1221,-1,-1,-1,-1,-1,-1},
-{78,252,311,1221,1222,-1,-1,-1,-1},
-{226,281,370,1222,1223,-1,-1,-1,-1},
-{294,314,1223,1224,-1,-1,-1,-1,-1},
-{89,186,1224,1225,-1,-1,-1,-1,-1},
-{177,352,381,1225,1226,-1,-1,-1,-1},
-{221,359,1226,1227,-1,-1,-1,-1,-1},
-{0,28,36,46,151,397,1227,1228,-1},
-{65,245,1228,1229,-1,-1,-1,-1,-1},
-{334,387,1229,1230,-1,-1,-1,-1,-1},
-{201,1230,1231,-1,-1,-1,-1,-1,-1},
-{1231,1232,-1,-1,-1,-1,-1,-1,-1},
-{55,59,144,388,1232,1233,-1,-1,-1},
-{41,61,265,292,378,1233,1234,-1,-1},
-{27,1234,1235,-1,-1,-1,-1,-1,-1},
-{79,1235,1236,-1,-1,-1,-1,-1,-1},
-{166,237,1236,1237,-1,-1,-1,-1,-1},
-{76,253,298,1237,1238,-1,-1,-1,-1},
-{1238,1239,-1,-1,-1,-1,-1,-1,-1},
-{188,1239,1240,-1,-1,-1,-1,-1,-1},
-{302,1240,1241,-1,-1,-1,-1,-1,-1},
-{14,90,1241,1242,-1,-1,-1,-1,-1},
-{57,109,220,1242,1243,-1,-1,-1,-1},
-{365,384,1243,1244,-1,-1,-1,-1,-1},
-{191,196,329,370,1244,1245,-1,-1,-1},
-{8,189,1245,1246,-1,-1,-1,-1,-1},
-{1246,1247,-1,-1,-1,-1,-1,-1,-1},
-{32,48,1247,1248,-1,-1,-1,-1,-1},
-{157,335,357,1248,1249,-1,-1,-1,-1},
-{348,1249,1250,-1,-1,-1,-1,-1,-1},
-{318,341,1250,1251,-1,-1,-1,-1,-1},
-{248,1251,1252,-1,-1,-1,-1,-1,-1},
-{203,1252,1253,-1,-1,-1,-1,-1,-1},
-{27,298,1253,1254,-1,-1,-1,-1,-1},
-{75,232,286,370,1254,1255,-1,-1,-1},
-{388,1255,1256,-1,-1,-1,-1,-1,-1},
-{1256,1257,-1,-1,-1,-1,-1,-1,-1},
-{67,99,234,247,1257,1258,-1,-1,-1},
-{67,181,199,270,1258,1259,-1,-1,-1},
-{230,1259,1260,-1,-1,-1,-1,-1,-1},
-{1260,1261,-1,-1,-1,-1,-1,-1,-1},
-{212,233,257,1261,1262,-1,-1,-1,-1},
-{39,161,1262,1263,-1,-1,-1,-1,-1},
-{3,236,1263,1264,-1,-1,-1,-1,-1},
-{177,1264,1265,-1,-1,-1,-1,-1,-1},
-{282,1265,1266,-1,-1,-1,-1,-1,-1},
-{1266,1267,-1,-1,-1,-1,-1,-1,-1},
-{193,279,1267,1268,-1,-1,-1,-1,-1},
-{157,179,223,326,1268,1269,-1,-1,-1},
-{124,129,1269,1270,-1,-1,-1,-1,-1},
-{115,221,245,306,1270,1271,-1,-1,-1},
-{127,368,377,378,1271,1272,-1,-1,-1},
-{252,381,1272,1273,-1,-1,-1,-1,-1},
-{128,207,355,1273,1274,-1,-1,-1,-1},
-{96,132,1274,1275,-1,-1,-1,-1,-1},
-{191,287,1275,1276,-1,-1,-1,-1,-1},
-{11,111,266,1276,1277,-1,-1,-1,-1},
-{297,1277,1278,-1,-1,-1,-1,-1,-1},
-{383,1278,1279,-1,-1,-1,-1,-1,-1},
-{243,367,393,1279,1280,-1,-1,-1,-1},
-{179,303,1280,1281,-1,-1,-1,-1,-1},
-{269,329,396,1281,1282,-1,-1,-1,-1},
-{31,82,1282,1283,-1,-1,-1,-1,-1},
-{1283,1284,-1,-1,-1,-1,-1,-1,-1},
-{36,218,1284,1285,-1,-1,-1,-1,-1},
-{132,138,275,1285,1286,-1,-1,-1,-1},
-{37,206,314,1286,1287,-1,-1,-1,-1},
-{10,1287,1288,-1,-1,-1,-1,-1,-1},
-{238,340,1288,1289,-1,-1,-1,-1,-1},
-{82,361,1289,1290,-1,-1,-1,-1,-1},
-{140,1290,1291,-1,-1,-1,-1,-1,-1},
-{101,349,1291,1292,-1,-1,-1,-1,-1},
-{301,1292,1293,-1,-1,-1,-1,-1,-1},
-{1293,1294,-1,-1,-1,-1,-1,-1,-1},
-{68,1294,1295,-1,-1,-1,-1,-1,-1},
-{138,182,197,303,360,1295,1296,-1,-1},
-{89,92,225,1296,1297,-1,-1,-1,-1},
-{99,1297,1298,-1,-1,-1,-1,-1,-1},
-{34,75,149,1298,1299,-1,-1,-1,-1},
-{2,1299,1300,-1,-1,-1,-1,-1,-1},
-{144,146,251,1300,1301,-1,-1,-1,-1},
-{15,1301,1302,-1,-1,-1,-1,-1,-1},
-{181,296,1302,1303,-1,-1,-1,-1,-1},
-{1303,1304,-1,-1,-1,-1,-1,-1,-1},
-{33,43,264,1304,1305,-1,-1,-1,-1},
-{106,1305,1306,-1,-1,-1,-1,-1,-1},
-{1306,1307,-1,-1,-1,-1,-1,-1,-1},
-{347,1307,1308,-1,-1,-1,-1,-1,-1},
-{62,148,235,1308,1309,-1,-1,-1,-1},
-{398,1309,1310,-1,-1,-1,-1,-1,-1},
-{130,230,1310,1311,-1,-1,-1,-1,-1},
-{25,179,1311,1312,-1,-1,-1,-1,-1},
-{58,197,266,327,1312,1313,-1,-1,-1},
-{211,386,1313,1314,-1,-1,-1,-1,-1},
-{1314,1315,-1,-1,-1,-1,-1,-1,-1},
-{266,330,1315,1316,-1,-1,-1,-1,-1},
-{270,319,330,368,1316,1317,-1,-1,-1},
-{16,129,1317,1318,-1,-1,-1,-1,-1},
-{65,92,300,353,1318,1319,-1,-1,-1},
-{128,288,318,321,330,1319,1320,-1,-1},
-{170,297,1320,1321,-1,-1,-1,-1,-1},
-{259,322,329,1321,1322,-1,-1,-1,-1},
-{1322,1323,-1,-1,-1,-1,-1,-1,-1},
-{14,121,1323,1324,-1,-1,-1,-1,-1},
-{200,279,1324,1325,-1,-1,-1,-1,-1},
-{108,1325,1326,-1,-1,-1,-1,-1,-1},
-{163,1326,1327,-1,-1,-1,-1,-1,-1},
-{29,128,144,1327,1328,-1,-1,-1,-1},
-{114,194,1328,1329,-1,-1,-1,-1,-1},
-{169,392,1329,1330,-1,-1,-1,-1,-1},
-{1330,1331,-1,-1,-1,-1,-1,-1,-1},
-{18,64,87,106,373,1331,1332,-1,-1},
-{319,323,1332,1333,-1,-1,-1,-1,-1},
-{12,151,1333,1334,-1,-1,-1,-1,-1},
-{1334,1335,-1,-1,-1,-1,-1,-1,-1},
-{1,297,1335,1336,-1,-1,-1,-1,-1},
-{36,63,1336,1337,-1,-1,-1,-1,-1},
-{1337,1338,-1,-1,-1,-1,-1,-1,-1},
-{3,72,313,1338,1339,-1,-1,-1,-1},
-{132,1339,1340,-1,-1,-1,-1,-1,-1},
-{19,177,262,1340,1341,-1,-1,-1,-1},
-{48,230,281,1341,1342,-1,-1,-1,-1},
-{369,1342,1343,-1,-1,-1,-1,-1,-1},
-{381,1343,1344,-1,-1,-1,-1,-1,-1},
-{93,328,1344,1345,-1,-1,-1,-1,-1},
-{80,359,1345,1346,-1,-1,-1,-1,-1},
-{18,101,179,1346,1347,-1,-1,-1,-1},
-{0,260,374,1347,1348,-1,-1,-1,-1},
-{206,1348,1349,-1,-1,-1,-1,-1,-1},
-{58,136,1349,1350,-1,-1,-1,-1,-1},
-{149,339,1350,1351,-1,-1,-1,-1,-1},
-{236,1351,1352,-1,-1,-1,-1,-1,-1},
-{86,132,201,238,1352,1353,-1,-1,-1},
-{37,244,284,1353,1354,-1,-1,-1,-1},
-{83,289,1354,1355,-1,-1,-1,-1,-1},
-{82,1355,1356,-1,-1,-1,-1,-1,-1},
-{87,1356,1357,-1,-1,-1,-1,-1,-1},
-{6,221,1357,1358,-1,-1,-1,-1,-1},
-{215,1358,1359,-1,-1,-1,-1,-1,-1},
-{121,395,1359,1360,-1,-1,-1,-1,-1},
-{1360,1361,-1,-1,-1,-1,-1,-1,-1},
-{143,167,368,1361,1362,-1,-1,-1,-1},
-{23,75,247,272,363,1362,1363,-1,-1},
-{53,181,225,1363,1364,-1,-1,-1,-1},
-{1364,1365,-1,-1,-1,-1,-1,-1,-1},
-{1365,1366,-1,-1,-1,-1,-1,-1,-1},
-{26,134,146,1366,1367,-1,-1,-1,-1},
-{259,1367,1368,-1,-1,-1,-1,-1,-1},
-{172,1368,1369,-1,-1,-1,-1,-1,-1},
-{18,384,1369,1370,-1,-1,-1,-1,-1},
-{117,388,1370,1371,-1,-1,-1,-1,-1},
-{262,1371,1372,-1,-1,-1,-1,-1,-1},
-{82,215,382,1372,1373,-1,-1,-1,-1},
-{1373,1374,-1,-1,-1,-1,-1,-1,-1},
-{219,1374,1375,-1,-1,-1,-1,-1,-1},
-{281,1375,1376,-1,-1,-1,-1,-1,-1},
-{135,1376,1377,-1,-1,-1,-1,-1,-1},
-{72,153,1377,1378,-1,-1,-1,-1,-1},
-{58,81,1378,1379,-1,-1,-1,-1,-1},
-{103,303,1379,1380,-1,-1,-1,-1,-1},
-{211,292,1380,1381,-1,-1,-1,-1,-1},
-{61,89,343,1381,1382,-1,-1,-1,-1},
-{172,383,1382,1383,-1,-1,-1,-1,-1},
-{193,1383,1384,-1,-1,-1,-1,-1,-1},
-{169,1384,1385,-1,-1,-1,-1,-1,-1},
-{116,1385,1386,-1,-1,-1,-1,-1,-1},
-{1386,1387,-1,-1,-1,-1,-1,-1,-1},
-{141,337,1387,1388,-1,-1,-1,-1,-1},
-{1388,1389,-1,-1,-1,-1,-1,-1,-1},
-{34,81,262,1389,1390,-1,-1,-1,-1},
-{286,327,379,1390,1391,-1,-1,-1,-1},
-{234,1391,1392,-1,-1,-1,-1,-1,-1},
-{120,341,1392,1393,-1,-1,-1,-1,-1},
-{84,186,232,236,290,362,384,1393,1394},
-{115,161,1394,1395,-1,-1,-1,-1,-1},
-{124,280,1395,1396,-1,-1,-1,-1,-1},
-{44,281,1396,1397,-1,-1,-1,-1,-1},
-{70,244,260,1397,1398,-1,-1,-1,-1},
-{77,236,1398,1399,-1,-1,-1,-1,-1},
-{50,71,387,1399,1400,-1,-1,-1,-1},
-{41,335,1400,1401,-1,-1,-1,-1,-1},
-{17,243,390,1401,1402,-1,-1,-1,-1},
-{177,193,366,1402,1403,-1,-1,-1,-1},
-{65,1403,1404,-1,-1,-1,-1,-1,-1},
-{184,1404,1405,-1,-1,-1,-1,-1,-1},
-{1405,1406,-1,-1,-1,-1,-1,-1,-1},
-{1,353,1406,1407,-1,-1,-1,-1,-1},
-{73,175,1407,1408,-1,-1,-1,-1,-1},
-{75,1408,1409,-1,-1,-1,-1,-1,-1},
-{380,1409,1410,-1,-1,-1,-1,-1,-1},
-{13,165,218,254,1410,1411,-1,-1,-1},
-{116,193,338,384,1411,1412,-1,-1,-1},
-{136,1412,1413,-1,-1,-1,-1,-1,-1},
-{29,260,1413,1414,-1,-1,-1,-1,-1},
-{147,1414,1415,-1,-1,-1,-1,-1,-1},
-{1415,1416,-1,-1,-1,-1,-1,-1,-1},
-{190,217,232,1416,1417,-1,-1,-1,-1},
-{327,379,399,1417,1418,-1,-1,-1,-1},
-{65,1418,1419,-1,-1,-1,-1,-1,-1},
-{31,46,238,1419,1420,-1,-1,-1,-1},
-{55,146,1420,1421,-1,-1,-1,-1,-1},
-{1421,1422,-1,-1,-1,-1,-1,-1,-1},
-{33,281,324,1422,1423,-1,-1,-1,-1},
-{347,1423,1424,-1,-1,-1,-1,-1,-1},
-{36,209,267,1424,1425,-1,-1,-1,-1},
-{1425,1426,-1,-1,-1,-1,-1,-1,-1},
-{87,308,1426,1427,-1,-1,-1,-1,-1},
-{1427,1428,-1,-1,-1,-1,-1,-1,-1},
-{1428,1429,-1,-1,-1,-1,-1,-1,-1},
-{131,226,243,355,1429,1430,-1,-1,-1},
-{159,1430,1431,-1,-1,-1,-1,-1,-1},
-{191,286,339,1431,1432,-1,-1,-1,-1},
-{19,1432,1433,-1,-1,-1,-1,-1,-1},
-{1433,1434,-1,-1,-1,-1,-1,-1,-1},
-{1434,1435,-1,-1,-1,-1,-1,-1,-1},
-{97,333,1435,1436,-1,-1,-1,-1,-1},
-{1436,1437,-1,-1,-1,-1,-1,-1,-1},
-{143,153,1437,1438,-1,-1,-1,-1,-1},
-{129,243,1438,1439,-1,-1,-1,-1,-1},
-{300,1439,1440,-1,-1,-1,-1,-1,-1},
-{84,102,378,1440,1441,-1,-1,-1,-1},
-{26,1441,1442,-1,-1,-1,-1,-1,-1},
-{104,304,362,388,1442,1443,-1,-1,-1},
-{40,290,1443,1444,-1,-1,-1,-1,-1},
-{55,97,249,275,1444,1445,-1,-1,-1},
-{314,1445,1446,-1,-1,-1,-1,-1,-1},
-{251,1446,1447,-1,-1,-1,-1,-1,-1},
-{109,339,1447,1448,-1,-1,-1,-1,-1},
-{354,1448,1449,-1,-1,-1,-1,-1,-1},
-{312,1449,1450,-1,-1,-1,-1,-1,-1},
-{28,86,244,256,1450,1451,-1,-1,-1},
-{19,1451,1452,-1,-1,-1,-1,-1,-1},
-{1452,1453,-1,-1,-1,-1,-1,-1,-1},
-{10,297,1453,1454,-1,-1,-1,-1,-1},
-{94,300,1454,1455,-1,-1,-1,-1,-1},
-{100,152,1455,1456,-1,-1,-1,-1,-1},
-{177,192,226,1456,1457,-1,-1,-1,-1},
-{186,290,1457,1458,-1,-1,-1,-1,-1},
-{219,1458,1459,-1,-1,-1,-1,-1,-1},
-{20,338,1459,1460,-1,-1,-1,-1,-1},
-{67,186,1460,1461,-1,-1,-1,-1,-1},
-{342,1461,1462,-1,-1,-1,-1,-1,-1},
-{233,1462,1463,-1,-1,-1,-1,-1,-1},
-{361,1463,1464,-1,-1,-1,-1,-1,-1},
-{1464,1465,-1,-1,-1,-1,-1,-1,-1},
-{291,1465,1466,-1,-1,-1,-1,-1,-1},
-{40,79,253,256,1466,1467,-1,-1,-1},
-{227,282,344,371,1467,1468,-1,-1,-1},
-{295,315,1468,1469,-1,-1,-1,-1,-1},
-{90,187,1469,1470,-1,-1,-1,-1,-1},
-{178,353,382,1470,1471,-1,-1,-1,-1},
-{222,1471,1472,-1,-1,-1,-1,-1,-1},
-{1,29,37,47,398,1472,1473,-1,-1},
-{66,108,246,1473,1474,-1,-1,-1,-1},
-{335,1474,1475,-1,-1,-1,-1,-1,-1},
-{202,1475,1476,-1,-1,-1,-1,-1,-1},
-{304,328,1476,1477,-1,-1,-1,-1,-1},
-{145,389,1477,1478,-1,-1,-1,-1,-1},
-{42,62,108,266,293,379,1478,1479,-1},
-{312,1479,1480,-1,-1,-1,-1,-1,-1},
-{336,1480,1481,-1,-1,-1,-1,-1,-1},
-{167,208,238,1481,1482,-1,-1,-1,-1},
-{77,160,254,299,1482,1483,-1,-1,-1},
-{1483,1484,-1,-1,-1,-1,-1,-1,-1},
-{189,1484,1485,-1,-1,-1,-1,-1,-1},
-{220,303,1485,1486,-1,-1,-1,-1,-1},
-{15,91,1486,1487,-1,-1,-1,-1,-1},
-{58,110,221,1487,1488,-1,-1,-1,-1},
-{366,385,1488,1489,-1,-1,-1,-1,-1},
-{197,330,371,1489,1490,-1,-1,-1,-1},
-{9,190,1490,1491,-1,-1,-1,-1,-1},
-{4,56,304,1491,1492,-1,-1,-1,-1},
-{33,49,1492,1493,-1,-1,-1,-1,-1},
-{108,158,308,358,1493,1494,-1,-1,-1},
-{349,368,1494,1495,-1,-1,-1,-1,-1},
-{319,342,1495,1496,-1,-1,-1,-1,-1},
-{249,1496,1497,-1,-1,-1,-1,-1,-1},
-{260,1497,1498,-1,-1,-1,-1,-1,-1},
-{299,1498,1499,-1,-1,-1,-1,-1,-1},
-{233,287,371,1499,1500,-1,-1,-1,-1},
-{389,1500,1501,-1,-1,-1,-1,-1,-1},
-{1501,1502,-1,-1,-1,-1,-1,-1,-1},
-{235,1502,1503,-1,-1,-1,-1,-1,-1},
-{182,271,1503,1504,-1,-1,-1,-1,-1},
-{68,231,1504,1505,-1,-1,-1,-1,-1},
-{1505,1506,-1,-1,-1,-1,-1,-1,-1},
-{213,234,258,1506,1507,-1,-1,-1,-1},
-{162,1507,1508,-1,-1,-1,-1,-1,-1},
-{237,1508,1509,-1,-1,-1,-1,-1,-1},
-{178,1509,1510,-1,-1,-1,-1,-1,-1},
-{64,283,1510,1511,-1,-1,-1,-1,-1},
-{332,1511,1512,-1,-1,-1,-1,-1,-1},
-{72,194,1512,1513,-1,-1,-1,-1,-1},
-{158,327,1513,1514,-1,-1,-1,-1,-1},
-{125,130,1514,1515,-1,-1,-1,-1,-1},
-{222,246,307,1515,1516,-1,-1,-1,-1},
-{369,378,379,1516,1517,-1,-1,-1,-1},
-{253,382,1517,1518,-1,-1,-1,-1,-1},
-{129,1518,1519,-1,-1,-1,-1,-1,-1},
-{97,133,1519,1520,-1,-1,-1,-1,-1},
-{1520,1521,-1,-1,-1,-1,-1,-1,-1},
-{267,1521,1522,-1,-1,-1,-1,-1,-1},
-{298,1522,1523,-1,-1,-1,-1,-1,-1},
-{88,1523,1524,-1,-1,-1,-1,-1,-1},
-{4,394,1524,1525,-1,-1,-1,-1,-1},
-{184,1525,1526,-1,-1,-1,-1,-1,-1},
-{128,270,330,397,1526,1527,-1,-1,-1},
-{83,1527,1528,-1,-1,-1,-1,-1,-1},
-{1528,1529,-1,-1,-1,-1,-1,-1,-1},
-{37,219,1529,1530,-1,-1,-1,-1,-1},
-{133,139,384,1530,1531,-1,-1,-1,-1},
-{38,207,315,1531,1532,-1,-1,-1,-1},
-{11,1532,1533,-1,-1,-1,-1,-1,-1},
-{160,239,341,1533,1534,-1,-1,-1,-1},
-{24,83,362,1534,1535,-1,-1,-1,-1},
-{141,1535,1536,-1,-1,-1,-1,-1,-1},
-{102,350,1536,1537,-1,-1,-1,-1,-1},
-{302,1537,1538,-1,-1,-1,-1,-1,-1},
-{1538,1539,-1,-1,-1,-1,-1,-1,-1},
-{69,1539,1540,-1,-1,-1,-1,-1,-1},
-{139,183,198,361,1540,1541,-1,-1,-1},
-{90,93,226,1541,1542,-1,-1,-1,-1},
-{20,1542,1543,-1,-1,-1,-1,-1,-1},
-{35,150,360,1543,1544,-1,-1,-1,-1},
-{3,1544,1545,-1,-1,-1,-1,-1,-1},
-{108,145,147,1545,1546,-1,-1,-1,-1},
-{164,1546,1547,-1,-1,-1,-1,-1,-1},
-{182,297,1547,1548,-1,-1,-1,-1,-1},
-{208,1548,1549,-1,-1,-1,-1,-1,-1},
-{34,196,265,1549,1550,-1,-1,-1,-1},
-{107,144,1550,1551,-1,-1,-1,-1,-1},
-{100,376,1551,1552,-1,-1,-1,-1,-1},
-{92,224,1552,1553,-1,-1,-1,-1,-1},
-{63,149,1553,1554,-1,-1,-1,-1,-1},
-{352,399,1554,1555,-1,-1,-1,-1,-1},
-{131,231,1555,1556,-1,-1,-1,-1,-1},
-{26,1556,1557,-1,-1,-1,-1,-1,-1},
-{59,198,267,1557,1558,-1,-1,-1,-1},
-{387,1558,1559,-1,-1,-1,-1,-1,-1},
-{368,1559,1560,-1,-1,-1,-1,-1,-1},
-{164,267,331,1560,1561,-1,-1,-1,-1},
-{4,164,271,331,360,369,1561,1562,-1},
-{17,130,220,1562,1563,-1,-1,-1,-1},
-{66,93,301,354,1563,1564,-1,-1,-1},
-{129,289,304,319,322,331,1564,1565,-1},
-{171,298,1565,1566,-1,-1,-1,-1,-1},
-{323,330,1566,1567,-1,-1,-1,-1,-1},
-{1567,1568,-1,-1,-1,-1,-1,-1,-1},
-{15,122,1568,1569,-1,-1,-1,-1,-1},
-{201,1569,1570,-1,-1,-1,-1,-1,-1},
-{109,1570,1571,-1,-1,-1,-1,-1,-1},
-{1571,1572,-1,-1,-1,-1,-1,-1,-1},
-{30,129,144,145,1572,1573,-1,-1,-1},
-{115,195,1573,1574,-1,-1,-1,-1,-1},
-{170,393,1574,1575,-1,-1,-1,-1,-1},
-{1575,1576,-1,-1,-1,-1,-1,-1,-1},
-{19,65,107,172,374,1576,1577,-1,-1},
-{1577,1578,-1,-1,-1,-1,-1,-1,-1},
-{13,1578,1579,-1,-1,-1,-1,-1,-1},
-{1579,1580,-1,-1,-1,-1,-1,-1,-1},
-{0,2,298,1580,1581,-1,-1,-1,-1},
-{37,1581,1582,-1,-1,-1,-1,-1,-1},
-{1582,1583,-1,-1,-1,-1,-1,-1,-1},
-{73,284,314,1583,1584,-1,-1,-1,-1},
-{133,1584,1585,-1,-1,-1,-1,-1,-1},
-{178,263,1585,1586,-1,-1,-1,-1,-1},
-{49,231,282,356,1586,1587,-1,-1,-1},
-{370,1587,1588,-1,-1,-1,-1,-1,-1},
-{382,1588,1589,-1,-1,-1,-1,-1,-1},
-{94,329,1589,1590,-1,-1,-1,-1,-1},
-{81,340,1590,1591,-1,-1,-1,-1,-1},
-{19,102,208,1591,1592,-1,-1,-1,-1},
-{1,212,261,375,1592,1593,-1,-1,-1},
-{140,207,1593,1594,-1,-1,-1,-1,-1},
-{59,137,260,1594,1595,-1,-1,-1,-1},
-{150,1595,1596,-1,-1,-1,-1,-1,-1},
-{237,1596,1597,-1,-1,-1,-1,-1,-1},
-{56,87,133,202,239,1597,1598,-1,-1},
-{38,156,245,285,308,1598,1599,-1,-1}};
-int mercury_normal_QCmatrixEnc_4_16[1200][8]={
-{290,-1,-1,-1,-1,-1,-1,-1},
-{83,400,-1,-1,-1,-1,-1,-1},
-{401,-1,-1,-1,-1,-1,-1,-1},
-{7,222,360,402,-1,-1,-1,-1},
-{224,403,-1,-1,-1,-1,-1,-1},
-{122,404,-1,-1,-1,-1,-1,-1},
-{405,-1,-1,-1,-1,-1,-1,-1},
-{369,406,-1,-1,-1,-1,-1,-1},
-{52,56,273,407,-1,-1,-1,-1},
-{54,182,226,408,-1,-1,-1,-1},
-{409,-1,-1,-1,-1,-1,-1,-1},
-{348,410,-1,-1,-1,-1,-1,-1},
-{27,135,147,411,-1,-1,-1,-1},
-{112,412,-1,-1,-1,-1,-1,-1},
-{173,413,-1,-1,-1,-1,-1,-1},
-{19,385,414,-1,-1,-1,-1,-1},
-{118,244,388,389,415,-1,-1,-1},
-{263,336,416,-1,-1,-1,-1,-1},
-{83,383,417,-1,-1,-1,-1,-1},
-{32,418,-1,-1,-1,-1,-1,-1},
-{419,-1,-1,-1,-1,-1,-1,-1},
-{282,420,-1,-1,-1,-1,-1,-1},
-{421,-1,-1,-1,-1,-1,-1,-1},
-{73,148,154,372,422,-1,-1,-1},
-{59,82,423,-1,-1,-1,-1,-1},
-{424,-1,-1,-1,-1,-1,-1,-1},
-{293,425,-1,-1,-1,-1,-1,-1},
-{62,90,426,-1,-1,-1,-1,-1},
-{173,427,-1,-1,-1,-1,-1,-1},
-{194,428,-1,-1,-1,-1,-1,-1},
-{170,429,-1,-1,-1,-1,-1,-1},
-{117,430,-1,-1,-1,-1,-1,-1},
-{431,-1,-1,-1,-1,-1,-1,-1},
-{142,338,432,-1,-1,-1,-1,-1},
-{356,433,-1,-1,-1,-1,-1,-1},
-{35,82,263,434,-1,-1,-1,-1},
-{287,435,-1,-1,-1,-1,-1,-1},
-{235,344,436,-1,-1,-1,-1,-1},
-{121,324,342,437,-1,-1,-1,-1},
-{85,187,233,237,291,363,385,438},
-{162,439,-1,-1,-1,-1,-1,-1},
-{125,164,180,281,440,-1,-1,-1},
-{45,282,441,-1,-1,-1,-1,-1},
-{71,245,261,442,-1,-1,-1,-1},
-{78,164,237,443,-1,-1,-1,-1},
-{51,444,-1,-1,-1,-1,-1,-1},
-{42,445,-1,-1,-1,-1,-1,-1},
-{18,391,446,-1,-1,-1,-1,-1},
-{178,194,367,447,-1,-1,-1,-1},
-{66,448,-1,-1,-1,-1,-1,-1},
-{185,449,-1,-1,-1,-1,-1,-1},
-{236,450,-1,-1,-1,-1,-1,-1},
-{2,132,284,354,451,-1,-1,-1},
-{74,452,-1,-1,-1,-1,-1,-1},
-{453,-1,-1,-1,-1,-1,-1,-1},
-{381,454,-1,-1,-1,-1,-1,-1},
-{14,166,219,255,455,-1,-1,-1},
-{108,117,194,339,385,456,-1,-1},
-{137,457,-1,-1,-1,-1,-1,-1},
-{30,261,458,-1,-1,-1,-1,-1},
-{459,-1,-1,-1,-1,-1,-1,-1},
-{28,460,-1,-1,-1,-1,-1,-1},
-{24,191,218,233,461,-1,-1,-1},
-{462,-1,-1,-1,-1,-1,-1,-1},
-{66,463,-1,-1,-1,-1,-1,-1},
-{47,239,464,-1,-1,-1,-1,-1},
-{147,465,-1,-1,-1,-1,-1,-1},
-{466,-1,-1,-1,-1,-1,-1,-1},
-{34,264,282,325,467,-1,-1,-1},
-{60,468,-1,-1,-1,-1,-1,-1},
-{37,210,469,-1,-1,-1,-1,-1},
-{392,470,-1,-1,-1,-1,-1,-1},
-{309,471,-1,-1,-1,-1,-1,-1},
-{472,-1,-1,-1,-1,-1,-1,-1},
-{76,473,-1,-1,-1,-1,-1,-1},
-{227,272,284,474,-1,-1,-1,-1},
-{124,475,-1,-1,-1,-1,-1,-1},
-{276,284,287,476,-1,-1,-1,-1},
-{52,477,-1,-1,-1,-1,-1,-1},
-{478,-1,-1,-1,-1,-1,-1,-1},
-{479,-1,-1,-1,-1,-1,-1,-1},
-{98,220,334,480,-1,-1,-1,-1},
-{212,481,-1,-1,-1,-1,-1,-1},
-{154,482,-1,-1,-1,-1,-1,-1},
-{130,483,-1,-1,-1,-1,-1,-1},
-{301,484,-1,-1,-1,-1,-1,-1},
-{85,103,379,485,-1,-1,-1,-1},
-{27,308,486,-1,-1,-1,-1,-1},
-{105,305,363,389,487,-1,-1,-1},
-{41,291,488,-1,-1,-1,-1,-1},
-{98,250,489,-1,-1,-1,-1,-1},
-{315,490,-1,-1,-1,-1,-1,-1},
-{356,491,-1,-1,-1,-1,-1,-1},
-{110,148,492,-1,-1,-1,-1,-1},
-{355,493,-1,-1,-1,-1,-1,-1},
-{313,384,494,-1,-1,-1,-1,-1},
-{29,87,245,257,495,-1,-1,-1},
-{496,-1,-1,-1,-1,-1,-1,-1},
-{52,56,497,-1,-1,-1,-1,-1},
-{11,298,498,-1,-1,-1,-1,-1},
-{24,95,301,499,-1,-1,-1,-1},
-{76,101,153,500,-1,-1,-1,-1},
-{178,193,227,501,-1,-1,-1,-1},
-{187,291,502,-1,-1,-1,-1,-1},
-{503,-1,-1,-1,-1,-1,-1,-1},
-{21,339,504,-1,-1,-1,-1,-1},
-{187,505,-1,-1,-1,-1,-1,-1},
-{343,506,-1,-1,-1,-1,-1,-1},
-{234,507,-1,-1,-1,-1,-1,-1},
-{362,508,-1,-1,-1,-1,-1,-1},
-{188,509,-1,-1,-1,-1,-1,-1},
-{510,-1,-1,-1,-1,-1,-1,-1},
-{41,254,257,511,-1,-1,-1,-1},
-{283,345,512,-1,-1,-1,-1,-1},
-{332,513,-1,-1,-1,-1,-1,-1},
-{91,514,-1,-1,-1,-1,-1,-1},
-{179,354,383,515,-1,-1,-1,-1},
-{223,516,-1,-1,-1,-1,-1,-1},
-{2,30,38,200,399,517,-1,-1},
-{24,67,109,247,518,-1,-1,-1},
-{72,519,-1,-1,-1,-1,-1,-1},
-{203,520,-1,-1,-1,-1,-1,-1},
-{305,329,521,-1,-1,-1,-1,-1},
-{64,96,146,244,390,522,-1,-1},
-{43,63,64,109,196,267,294,523},
-{313,524,-1,-1,-1,-1,-1,-1},
-{337,525,-1,-1,-1,-1,-1,-1},
-{209,239,526,-1,-1,-1,-1,-1},
-{36,78,161,255,527,-1,-1,-1},
-{0,528,-1,-1,-1,-1,-1,-1},
-{190,529,-1,-1,-1,-1,-1,-1},
-{221,530,-1,-1,-1,-1,-1,-1},
-{531,-1,-1,-1,-1,-1,-1,-1},
-{59,111,222,276,532,-1,-1,-1},
-{176,220,367,386,533,-1,-1,-1},
-{198,331,534,-1,-1,-1,-1,-1},
-{10,112,191,535,-1,-1,-1,-1},
-{5,57,124,305,536,-1,-1,-1},
-{34,50,537,-1,-1,-1,-1,-1},
-{109,159,204,309,352,359,538,-1},
-{350,369,539,-1,-1,-1,-1,-1},
-{188,284,343,540,-1,-1,-1,-1},
-{8,108,250,541,-1,-1,-1,-1},
-{261,542,-1,-1,-1,-1,-1,-1},
-{380,543,-1,-1,-1,-1,-1,-1},
-{234,240,364,544,-1,-1,-1,-1},
-{176,300,390,545,-1,-1,-1,-1},
-{546,-1,-1,-1,-1,-1,-1,-1},
-{28,547,-1,-1,-1,-1,-1,-1},
-{183,548,-1,-1,-1,-1,-1,-1},
-{69,549,-1,-1,-1,-1,-1,-1},
-{272,550,-1,-1,-1,-1,-1,-1},
-{214,235,259,551,-1,-1,-1,-1},
-{163,552,-1,-1,-1,-1,-1,-1},
-{238,553,-1,-1,-1,-1,-1,-1},
-{179,554,-1,-1,-1,-1,-1,-1},
-{65,555,-1,-1,-1,-1,-1,-1},
-{333,556,-1,-1,-1,-1,-1,-1},
-{73,195,557,-1,-1,-1,-1,-1},
-{159,558,-1,-1,-1,-1,-1,-1},
-{126,131,559,-1,-1,-1,-1,-1},
-{223,247,300,560,-1,-1,-1,-1},
-{370,379,561,-1,-1,-1,-1,-1},
-{96,254,383,562,-1,-1,-1,-1},
-{72,130,563,-1,-1,-1,-1,-1},
-{98,134,564,-1,-1,-1,-1,-1},
-{248,565,-1,-1,-1,-1,-1,-1},
-{12,566,-1,-1,-1,-1,-1,-1},
-{299,567,-1,-1,-1,-1,-1,-1},
-{89,568,-1,-1,-1,-1,-1,-1},
-{5,40,395,569,-1,-1,-1,-1},
-{185,570,-1,-1,-1,-1,-1,-1},
-{129,271,331,398,571,-1,-1,-1},
-{344,572,-1,-1,-1,-1,-1,-1},
-{232,573,-1,-1,-1,-1,-1,-1},
-{38,574,-1,-1,-1,-1,-1,-1},
-{134,385,575,-1,-1,-1,-1,-1},
-{39,176,576,-1,-1,-1,-1,-1},
-{324,577,-1,-1,-1,-1,-1,-1},
-{161,208,342,578,-1,-1,-1,-1},
-{25,363,579,-1,-1,-1,-1,-1},
-{142,580,-1,-1,-1,-1,-1,-1},
-{103,316,351,581,-1,-1,-1,-1},
-{303,582,-1,-1,-1,-1,-1,-1},
-{583,-1,-1,-1,-1,-1,-1,-1},
-{70,584,-1,-1,-1,-1,-1,-1},
-{199,362,585,-1,-1,-1,-1,-1},
-{91,94,227,256,586,-1,-1,-1},
-{21,587,-1,-1,-1,-1,-1,-1},
-{151,361,588,-1,-1,-1,-1,-1},
-{276,589,-1,-1,-1,-1,-1,-1},
-{109,146,590,-1,-1,-1,-1,-1},
-{160,165,591,-1,-1,-1,-1,-1},
-{183,298,592,-1,-1,-1,-1,-1},
-{209,593,-1,-1,-1,-1,-1,-1},
-{35,197,266,594,-1,-1,-1,-1},
-{145,595,-1,-1,-1,-1,-1,-1},
-{84,101,377,596,-1,-1,-1,-1},
-{93,225,316,320,597,-1,-1,-1},
-{148,150,598,-1,-1,-1,-1,-1},
-{353,599,-1,-1,-1,-1,-1,-1},
-{600,-1,-1,-1,-1,-1,-1,-1},
-{27,60,601,-1,-1,-1,-1,-1},
-{199,602,-1,-1,-1,-1,-1,-1},
-{0,603,-1,-1,-1,-1,-1,-1},
-{369,604,-1,-1,-1,-1,-1,-1},
-{16,165,605,-1,-1,-1,-1,-1},
-{5,165,361,370,606,-1,-1,-1},
-{18,131,221,607,-1,-1,-1,-1},
-{67,94,302,355,608,-1,-1,-1},
-{130,290,305,323,609,-1,-1,-1},
-{299,356,610,-1,-1,-1,-1,-1},
-{176,331,611,-1,-1,-1,-1,-1},
-{612,-1,-1,-1,-1,-1,-1,-1},
-{123,613,-1,-1,-1,-1,-1,-1},
-{202,614,-1,-1,-1,-1,-1,-1},
-{110,336,615,-1,-1,-1,-1,-1},
-{616,-1,-1,-1,-1,-1,-1,-1},
-{31,130,145,146,617,-1,-1,-1},
-{618,-1,-1,-1,-1,-1,-1,-1},
-{80,171,394,619,-1,-1,-1,-1},
-{620,-1,-1,-1,-1,-1,-1,-1},
-{66,84,173,375,621,-1,-1,-1},
-{622,-1,-1,-1,-1,-1,-1,-1},
-{14,212,623,-1,-1,-1,-1,-1},
-{392,624,-1,-1,-1,-1,-1,-1},
-{1,3,299,625,-1,-1,-1,-1},
-{38,140,164,626,-1,-1,-1,-1},
-{20,72,244,360,627,-1,-1,-1},
-{74,285,315,628,-1,-1,-1,-1},
-{134,629,-1,-1,-1,-1,-1,-1},
-{179,630,-1,-1,-1,-1,-1,-1},
-{50,283,357,631,-1,-1,-1,-1},
-{256,371,632,-1,-1,-1,-1,-1},
-{383,633,-1,-1,-1,-1,-1,-1},
-{95,330,634,-1,-1,-1,-1,-1},
-{82,341,635,-1,-1,-1,-1,-1},
-{103,209,636,-1,-1,-1,-1,-1},
-{2,212,213,262,637,-1,-1,-1},
-{141,638,-1,-1,-1,-1,-1,-1},
-{138,216,261,639,-1,-1,-1,-1},
-{151,640,-1,-1,-1,-1,-1,-1},
-{132,238,641,-1,-1,-1,-1,-1},
-{57,134,203,642,-1,-1,-1,-1},
-{39,157,246,286,309,643,-1,-1},
-{100,291,300,644,-1,-1,-1,-1},
-{208,645,-1,-1,-1,-1,-1,-1},
-{340,646,-1,-1,-1,-1,-1,-1},
-{223,361,380,647,-1,-1,-1,-1},
-{225,648,-1,-1,-1,-1,-1,-1},
-{123,649,-1,-1,-1,-1,-1,-1},
-{650,-1,-1,-1,-1,-1,-1,-1},
-{370,651,-1,-1,-1,-1,-1,-1},
-{53,57,274,652,-1,-1,-1,-1},
-{55,183,227,653,-1,-1,-1,-1},
-{654,-1,-1,-1,-1,-1,-1,-1},
-{324,349,376,655,-1,-1,-1,-1},
-{656,-1,-1,-1,-1,-1,-1,-1},
-{113,657,-1,-1,-1,-1,-1,-1},
-{174,658,-1,-1,-1,-1,-1,-1},
-{112,386,659,-1,-1,-1,-1,-1},
-{119,245,389,390,660,-1,-1,-1},
-{337,661,-1,-1,-1,-1,-1,-1},
-{662,-1,-1,-1,-1,-1,-1,-1},
-{33,663,-1,-1,-1,-1,-1,-1},
-{68,384,664,-1,-1,-1,-1,-1},
-{283,332,665,-1,-1,-1,-1,-1},
-{240,666,-1,-1,-1,-1,-1,-1},
-{74,149,155,373,667,-1,-1,-1},
-{83,668,-1,-1,-1,-1,-1,-1},
-{669,-1,-1,-1,-1,-1,-1,-1},
-{294,670,-1,-1,-1,-1,-1,-1},
-{63,91,671,-1,-1,-1,-1,-1},
-{172,174,672,-1,-1,-1,-1,-1},
-{72,195,673,-1,-1,-1,-1,-1},
-{171,674,-1,-1,-1,-1,-1,-1},
-{118,675,-1,-1,-1,-1,-1,-1},
-{676,-1,-1,-1,-1,-1,-1,-1},
-{143,339,677,-1,-1,-1,-1,-1},
-{357,678,-1,-1,-1,-1,-1,-1},
-{83,144,679,-1,-1,-1,-1,-1},
-{680,-1,-1,-1,-1,-1,-1,-1},
-{345,681,-1,-1,-1,-1,-1,-1},
-{122,324,325,343,376,396,682,-1},
-{86,234,238,386,683,-1,-1,-1},
-{28,163,684,-1,-1,-1,-1,-1},
-{52,126,165,181,282,685,-1,-1},
-{46,283,686,-1,-1,-1,-1,-1},
-{246,262,687,-1,-1,-1,-1,-1},
-{79,165,238,344,688,-1,-1,-1},
-{264,689,-1,-1,-1,-1,-1,-1},
-{43,690,-1,-1,-1,-1,-1,-1},
-{19,84,691,-1,-1,-1,-1,-1},
-{179,195,692,-1,-1,-1,-1,-1},
-{67,693,-1,-1,-1,-1,-1,-1},
-{128,186,240,352,694,-1,-1,-1},
-{156,237,695,-1,-1,-1,-1,-1},
-{3,133,188,285,336,355,696,-1},
-{16,75,697,-1,-1,-1,-1,-1},
-{698,-1,-1,-1,-1,-1,-1,-1},
-{382,699,-1,-1,-1,-1,-1,-1},
-{15,167,700,-1,-1,-1,-1,-1},
-{109,118,195,386,701,-1,-1,-1},
-{138,140,702,-1,-1,-1,-1,-1},
-{31,240,262,703,-1,-1,-1,-1},
-{704,-1,-1,-1,-1,-1,-1,-1},
-{29,705,-1,-1,-1,-1,-1,-1},
-{25,219,234,706,-1,-1,-1,-1},
-{707,-1,-1,-1,-1,-1,-1,-1},
-{67,708,-1,-1,-1,-1,-1,-1},
-{52,272,709,-1,-1,-1,-1,-1},
-{710,-1,-1,-1,-1,-1,-1,-1},
-{248,711,-1,-1,-1,-1,-1,-1},
-{35,265,283,326,336,712,-1,-1},
-{61,713,-1,-1,-1,-1,-1,-1},
-{38,211,714,-1,-1,-1,-1,-1},
-{393,715,-1,-1,-1,-1,-1,-1},
-{16,310,716,-1,-1,-1,-1,-1},
-{717,-1,-1,-1,-1,-1,-1,-1},
-{77,718,-1,-1,-1,-1,-1,-1},
-{273,285,719,-1,-1,-1,-1,-1},
-{125,720,-1,-1,-1,-1,-1,-1},
-{277,285,721,-1,-1,-1,-1,-1},
-{53,722,-1,-1,-1,-1,-1,-1},
-{216,723,-1,-1,-1,-1,-1,-1},
-{724,-1,-1,-1,-1,-1,-1,-1},
-{64,99,221,335,725,-1,-1,-1},
-{213,726,-1,-1,-1,-1,-1,-1},
-{155,727,-1,-1,-1,-1,-1,-1},
-{131,728,-1,-1,-1,-1,-1,-1},
-{302,729,-1,-1,-1,-1,-1,-1},
-{86,288,730,-1,-1,-1,-1,-1},
-{76,309,731,-1,-1,-1,-1,-1},
-{106,224,306,368,390,732,-1,-1},
-{42,292,312,733,-1,-1,-1,-1},
-{99,184,251,734,-1,-1,-1,-1},
-{735,-1,-1,-1,-1,-1,-1,-1},
-{357,736,-1,-1,-1,-1,-1,-1},
-{44,111,149,737,-1,-1,-1,-1},
-{738,-1,-1,-1,-1,-1,-1,-1},
-{314,332,385,739,-1,-1,-1,-1},
-{30,246,258,740,-1,-1,-1,-1},
-{741,-1,-1,-1,-1,-1,-1,-1},
-{53,57,742,-1,-1,-1,-1,-1},
-{299,376,743,-1,-1,-1,-1,-1},
-{25,302,744,-1,-1,-1,-1,-1},
-{77,102,154,745,-1,-1,-1,-1},
-{164,179,194,746,-1,-1,-1,-1},
-{296,747,-1,-1,-1,-1,-1,-1},
-{748,-1,-1,-1,-1,-1,-1,-1},
-{22,749,-1,-1,-1,-1,-1,-1},
-{300,750,-1,-1,-1,-1,-1,-1},
-{12,88,751,-1,-1,-1,-1,-1},
-{235,752,-1,-1,-1,-1,-1,-1},
-{363,753,-1,-1,-1,-1,-1,-1},
-{189,368,754,-1,-1,-1,-1,-1},
-{755,-1,-1,-1,-1,-1,-1,-1},
-{42,255,258,756,-1,-1,-1,-1},
-{346,757,-1,-1,-1,-1,-1,-1},
-{333,758,-1,-1,-1,-1,-1,-1},
-{759,-1,-1,-1,-1,-1,-1,-1},
-{316,355,760,-1,-1,-1,-1,-1},
-{761,-1,-1,-1,-1,-1,-1,-1},
-{3,31,39,201,762,-1,-1,-1},
-{25,110,296,763,-1,-1,-1,-1},
-{73,284,368,764,-1,-1,-1,-1},
-{765,-1,-1,-1,-1,-1,-1,-1},
-{306,330,766,-1,-1,-1,-1,-1},
-{65,97,147,232,245,391,767,-1},
-{65,110,197,268,295,768,-1,-1},
-{228,314,769,-1,-1,-1,-1,-1},
-{338,770,-1,-1,-1,-1,-1,-1},
-{210,771,-1,-1,-1,-1,-1,-1},
-{37,79,162,772,-1,-1,-1,-1},
-{1,773,-1,-1,-1,-1,-1,-1},
-{191,774,-1,-1,-1,-1,-1,-1},
-{222,280,775,-1,-1,-1,-1,-1},
-{776,-1,-1,-1,-1,-1,-1,-1},
-{223,277,777,-1,-1,-1,-1,-1},
-{177,221,324,387,778,-1,-1,-1},
-{199,779,-1,-1,-1,-1,-1,-1},
-{11,113,304,780,-1,-1,-1,-1},
-{6,58,125,306,376,781,-1,-1},
-{35,51,782,-1,-1,-1,-1,-1},
-{110,205,310,353,783,-1,-1,-1},
-{351,370,784,-1,-1,-1,-1,-1},
-{189,285,785,-1,-1,-1,-1,-1},
-{9,109,251,264,786,-1,-1,-1},
-{262,787,-1,-1,-1,-1,-1,-1},
-{381,788,-1,-1,-1,-1,-1,-1},
-{235,241,365,789,-1,-1,-1,-1},
-{177,301,391,790,-1,-1,-1,-1},
-{791,-1,-1,-1,-1,-1,-1,-1},
-{29,80,792,-1,-1,-1,-1,-1},
-{793,-1,-1,-1,-1,-1,-1,-1},
-{70,216,794,-1,-1,-1,-1,-1},
-{136,273,795,-1,-1,-1,-1,-1},
-{204,215,312,796,-1,-1,-1,-1},
-{8,797,-1,-1,-1,-1,-1,-1},
-{236,239,798,-1,-1,-1,-1,-1},
-{80,799,-1,-1,-1,-1,-1,-1},
-{66,800,-1,-1,-1,-1,-1,-1},
-{334,801,-1,-1,-1,-1,-1,-1},
-{74,802,-1,-1,-1,-1,-1,-1},
-{803,-1,-1,-1,-1,-1,-1,-1},
-{127,804,-1,-1,-1,-1,-1,-1},
-{136,180,301,805,-1,-1,-1,-1},
-{371,806,-1,-1,-1,-1,-1,-1},
-{97,255,807,-1,-1,-1,-1,-1},
-{32,73,131,808,-1,-1,-1,-1},
-{0,99,135,809,-1,-1,-1,-1},
-{144,249,810,-1,-1,-1,-1,-1},
-{13,811,-1,-1,-1,-1,-1,-1},
-{812,-1,-1,-1,-1,-1,-1,-1},
-{90,813,-1,-1,-1,-1,-1,-1},
-{6,41,814,-1,-1,-1,-1,-1},
-{104,186,815,-1,-1,-1,-1,-1},
-{130,399,816,-1,-1,-1,-1,-1},
-{345,817,-1,-1,-1,-1,-1,-1},
-{60,233,818,-1,-1,-1,-1,-1},
-{39,396,819,-1,-1,-1,-1,-1},
-{128,135,228,386,820,-1,-1,-1},
-{177,821,-1,-1,-1,-1,-1,-1},
-{56,264,325,822,-1,-1,-1,-1},
-{162,209,343,384,823,-1,-1,-1},
-{26,824,-1,-1,-1,-1,-1,-1},
-{143,264,328,825,-1,-1,-1,-1},
-{268,317,328,826,-1,-1,-1,-1},
-{827,-1,-1,-1,-1,-1,-1,-1},
-{828,-1,-1,-1,-1,-1,-1,-1},
-{71,316,328,829,-1,-1,-1,-1},
-{168,363,830,-1,-1,-1,-1,-1},
-{95,257,320,831,-1,-1,-1,-1},
-{22,832,-1,-1,-1,-1,-1,-1},
-{12,362,833,-1,-1,-1,-1,-1},
-{277,834,-1,-1,-1,-1,-1,-1},
-{110,147,835,-1,-1,-1,-1,-1},
-{161,166,836,-1,-1,-1,-1,-1},
-{299,837,-1,-1,-1,-1,-1,-1},
-{112,192,210,838,-1,-1,-1,-1},
-{198,267,839,-1,-1,-1,-1,-1},
-{146,840,-1,-1,-1,-1,-1,-1},
-{16,85,102,104,378,841,-1,-1},
-{94,226,317,321,842,-1,-1,-1},
-{149,151,843,-1,-1,-1,-1,-1},
-{354,844,-1,-1,-1,-1,-1,-1},
-{845,-1,-1,-1,-1,-1,-1,-1},
-{61,846,-1,-1,-1,-1,-1,-1},
-{847,-1,-1,-1,-1,-1,-1,-1},
-{1,848,-1,-1,-1,-1,-1,-1},
-{370,849,-1,-1,-1,-1,-1,-1},
-{17,166,260,850,-1,-1,-1,-1},
-{6,166,228,362,371,851,-1,-1},
-{19,222,852,-1,-1,-1,-1,-1},
-{95,303,853,-1,-1,-1,-1,-1},
-{131,291,306,854,-1,-1,-1,-1},
-{357,855,-1,-1,-1,-1,-1,-1},
-{16,177,856,-1,-1,-1,-1,-1},
-{372,857,-1,-1,-1,-1,-1,-1},
-{204,858,-1,-1,-1,-1,-1,-1},
-{56,203,859,-1,-1,-1,-1,-1},
-{111,337,860,-1,-1,-1,-1,-1},
-{861,-1,-1,-1,-1,-1,-1,-1},
-{84,131,146,147,236,862,-1,-1},
-{863,-1,-1,-1,-1,-1,-1,-1},
-{81,395,864,-1,-1,-1,-1,-1},
-{80,865,-1,-1,-1,-1,-1,-1},
-{67,85,174,866,-1,-1,-1,-1},
-{4,867,-1,-1,-1,-1,-1,-1},
-{15,213,868,-1,-1,-1,-1,-1},
-{393,869,-1,-1,-1,-1,-1,-1},
-{2,870,-1,-1,-1,-1,-1,-1},
-{39,141,165,871,-1,-1,-1,-1},
-{21,73,245,361,872,-1,-1,-1},
-{75,286,873,-1,-1,-1,-1,-1},
-{135,874,-1,-1,-1,-1,-1,-1},
-{875,-1,-1,-1,-1,-1,-1,-1},
-{24,51,132,144,358,876,-1,-1},
-{257,877,-1,-1,-1,-1,-1,-1},
-{878,-1,-1,-1,-1,-1,-1,-1},
-{16,331,879,-1,-1,-1,-1,-1},
-{83,342,880,-1,-1,-1,-1,-1},
-{210,260,881,-1,-1,-1,-1,-1},
-{3,80,213,214,263,380,882,-1},
-{142,883,-1,-1,-1,-1,-1,-1},
-{139,217,262,884,-1,-1,-1,-1},
-{885,-1,-1,-1,-1,-1,-1,-1},
-{133,239,886,-1,-1,-1,-1,-1},
-{58,135,887,-1,-1,-1,-1,-1},
-{56,158,247,287,310,888,-1,-1},
-{101,301,889,-1,-1,-1,-1,-1},
-{209,890,-1,-1,-1,-1,-1,-1},
-{341,891,-1,-1,-1,-1,-1,-1},
-{362,381,892,-1,-1,-1,-1,-1},
-{226,893,-1,-1,-1,-1,-1,-1},
-{894,-1,-1,-1,-1,-1,-1,-1},
-{895,-1,-1,-1,-1,-1,-1,-1},
-{371,896,-1,-1,-1,-1,-1,-1},
-{54,58,275,897,-1,-1,-1,-1},
-{898,-1,-1,-1,-1,-1,-1,-1},
-{32,260,899,-1,-1,-1,-1,-1},
-{284,325,350,377,900,-1,-1,-1},
-{232,901,-1,-1,-1,-1,-1,-1},
-{114,902,-1,-1,-1,-1,-1,-1},
-{175,184,288,360,903,-1,-1,-1},
-{113,387,904,-1,-1,-1,-1,-1},
-{246,390,391,905,-1,-1,-1,-1},
-{338,906,-1,-1,-1,-1,-1,-1},
-{68,907,-1,-1,-1,-1,-1,-1},
-{34,908,-1,-1,-1,-1,-1,-1},
-{48,69,385,909,-1,-1,-1,-1},
-{333,910,-1,-1,-1,-1,-1,-1},
-{241,388,911,-1,-1,-1,-1,-1},
-{75,150,364,374,912,-1,-1,-1},
-{913,-1,-1,-1,-1,-1,-1,-1},
-{914,-1,-1,-1,-1,-1,-1,-1},
-{295,915,-1,-1,-1,-1,-1,-1},
-{916,-1,-1,-1,-1,-1,-1,-1},
-{173,175,917,-1,-1,-1,-1,-1},
-{73,918,-1,-1,-1,-1,-1,-1},
-{919,-1,-1,-1,-1,-1,-1,-1},
-{119,216,252,920,-1,-1,-1,-1},
-{336,921,-1,-1,-1,-1,-1,-1},
-{922,-1,-1,-1,-1,-1,-1,-1},
-{358,923,-1,-1,-1,-1,-1,-1},
-{145,924,-1,-1,-1,-1,-1,-1},
-{925,-1,-1,-1,-1,-1,-1,-1},
-{188,346,926,-1,-1,-1,-1,-1},
-{123,325,326,377,397,927,-1,-1},
-{87,235,239,387,928,-1,-1,-1},
-{29,44,236,929,-1,-1,-1,-1},
-{53,127,144,166,182,283,930,-1},
-{47,931,-1,-1,-1,-1,-1,-1},
-{247,263,932,-1,-1,-1,-1,-1},
-{166,239,345,933,-1,-1,-1,-1},
-{265,934,-1,-1,-1,-1,-1,-1},
-{935,-1,-1,-1,-1,-1,-1,-1},
-{85,936,-1,-1,-1,-1,-1,-1},
-{937,-1,-1,-1,-1,-1,-1,-1},
-{938,-1,-1,-1,-1,-1,-1,-1},
-{129,187,224,241,353,939,-1,-1},
-{157,238,940,-1,-1,-1,-1,-1},
-{134,189,284,286,337,941,-1,-1},
-{17,942,-1,-1,-1,-1,-1,-1},
-{943,-1,-1,-1,-1,-1,-1,-1},
-{383,944,-1,-1,-1,-1,-1,-1},
-{945,-1,-1,-1,-1,-1,-1,-1},
-{110,119,387,946,-1,-1,-1,-1},
-{139,141,947,-1,-1,-1,-1,-1},
-{241,263,948,-1,-1,-1,-1,-1},
-{949,-1,-1,-1,-1,-1,-1,-1},
-{30,100,376,950,-1,-1,-1,-1},
-{24,26,235,951,-1,-1,-1,-1},
-{360,952,-1,-1,-1,-1,-1,-1},
-{288,953,-1,-1,-1,-1,-1,-1},
-{53,273,954,-1,-1,-1,-1,-1},
-{312,955,-1,-1,-1,-1,-1,-1},
-{249,956,-1,-1,-1,-1,-1,-1},
-{266,327,337,957,-1,-1,-1,-1},
-{62,352,958,-1,-1,-1,-1,-1},
-{39,959,-1,-1,-1,-1,-1,-1},
-{84,394,960,-1,-1,-1,-1,-1},
-{17,311,961,-1,-1,-1,-1,-1},
-{962,-1,-1,-1,-1,-1,-1,-1},
-{8,78,963,-1,-1,-1,-1,-1},
-{92,274,286,964,-1,-1,-1,-1},
-{126,965,-1,-1,-1,-1,-1,-1},
-{224,278,286,966,-1,-1,-1,-1},
-{54,184,288,967,-1,-1,-1,-1},
-{217,968,-1,-1,-1,-1,-1,-1},
-{336,969,-1,-1,-1,-1,-1,-1},
-{65,184,222,970,-1,-1,-1,-1},
-{214,340,971,-1,-1,-1,-1,-1},
-{972,-1,-1,-1,-1,-1,-1,-1},
-{973,-1,-1,-1,-1,-1,-1,-1},
-{303,974,-1,-1,-1,-1,-1,-1},
-{87,289,975,-1,-1,-1,-1,-1},
-{77,310,976,-1,-1,-1,-1,-1},
-{107,225,280,307,369,391,977,-1},
-{43,293,313,978,-1,-1,-1,-1},
-{88,185,979,-1,-1,-1,-1,-1},
-{176,380,980,-1,-1,-1,-1,-1},
-{220,358,981,-1,-1,-1,-1,-1},
-{45,150,396,982,-1,-1,-1,-1},
-{64,244,983,-1,-1,-1,-1,-1},
-{315,333,386,984,-1,-1,-1,-1},
-{31,200,247,259,985,-1,-1,-1},
-{986,-1,-1,-1,-1,-1,-1,-1},
-{54,58,987,-1,-1,-1,-1,-1},
-{40,60,264,377,988,-1,-1,-1},
-{26,303,989,-1,-1,-1,-1,-1},
-{78,103,155,990,-1,-1,-1,-1},
-{165,195,236,991,-1,-1,-1,-1},
-{252,297,992,-1,-1,-1,-1,-1},
-{993,-1,-1,-1,-1,-1,-1,-1},
-{23,994,-1,-1,-1,-1,-1,-1},
-{301,995,-1,-1,-1,-1,-1,-1},
-{13,89,996,-1,-1,-1,-1,-1},
-{56,108,997,-1,-1,-1,-1,-1},
-{364,998,-1,-1,-1,-1,-1,-1},
-{190,328,369,999,-1,-1,-1,-1},
-{188,1000,-1,-1,-1,-1,-1,-1},
-{43,259,1001,-1,-1,-1,-1,-1},
-{347,1002,-1,-1,-1,-1,-1,-1},
-{156,334,356,1003,-1,-1,-1,-1},
-{1004,-1,-1,-1,-1,-1,-1,-1},
-{317,340,1005,-1,-1,-1,-1,-1},
-{1006,-1,-1,-1,-1,-1,-1,-1},
-{202,1007,-1,-1,-1,-1,-1,-1},
-{26,111,297,1008,-1,-1,-1,-1},
-{74,285,369,1009,-1,-1,-1,-1},
-{1010,-1,-1,-1,-1,-1,-1,-1},
-{307,331,1011,-1,-1,-1,-1,-1},
-{66,98,233,246,1012,-1,-1,-1},
-{66,111,180,198,269,1013,-1,-1},
-{229,315,1014,-1,-1,-1,-1,-1},
-{339,1015,-1,-1,-1,-1,-1,-1},
-{211,232,256,1016,-1,-1,-1,-1},
-{38,160,163,1017,-1,-1,-1,-1},
-{2,1018,-1,-1,-1,-1,-1,-1},
-{176,1019,-1,-1,-1,-1,-1,-1},
-{223,281,1020,-1,-1,-1,-1,-1},
-{1021,-1,-1,-1,-1,-1,-1,-1},
-{192,278,1022,-1,-1,-1,-1,-1},
-{156,178,222,325,1023,-1,-1,-1},
-{128,1024,-1,-1,-1,-1,-1,-1},
-{114,220,244,305,1025,-1,-1,-1},
-{7,59,126,307,376,377,1026,-1},
-{380,1027,-1,-1,-1,-1,-1,-1},
-{111,206,311,354,1028,-1,-1,-1},
-{371,1029,-1,-1,-1,-1,-1,-1},
-{190,286,1030,-1,-1,-1,-1,-1},
-{10,110,265,1031,-1,-1,-1,-1},
-{263,296,1032,-1,-1,-1,-1,-1},
-{382,1033,-1,-1,-1,-1,-1,-1},
-{242,366,392,1034,-1,-1,-1,-1},
-{178,302,1035,-1,-1,-1,-1,-1},
-{268,328,1036,-1,-1,-1,-1,-1},
-{30,81,1037,-1,-1,-1,-1,-1},
-{1038,-1,-1,-1,-1,-1,-1,-1},
-{71,217,1039,-1,-1,-1,-1,-1},
-{137,274,1040,-1,-1,-1,-1,-1},
-{36,205,313,1041,-1,-1,-1,-1},
-{9,1042,-1,-1,-1,-1,-1,-1},
-{237,1043,-1,-1,-1,-1,-1,-1},
-{81,360,1044,-1,-1,-1,-1,-1},
-{67,1045,-1,-1,-1,-1,-1,-1},
-{100,335,348,1046,-1,-1,-1,-1},
-{75,300,1047,-1,-1,-1,-1,-1},
-{1048,-1,-1,-1,-1,-1,-1,-1},
-{1049,-1,-1,-1,-1,-1,-1,-1},
-{137,181,196,302,1050,-1,-1,-1},
-{88,224,1051,-1,-1,-1,-1,-1},
-{98,1052,-1,-1,-1,-1,-1,-1},
-{33,74,148,1053,-1,-1,-1,-1},
-{1,1054,-1,-1,-1,-1,-1,-1},
-{145,250,1055,-1,-1,-1,-1,-1},
-{14,1056,-1,-1,-1,-1,-1,-1},
-{180,1057,-1,-1,-1,-1,-1,-1},
-{91,1058,-1,-1,-1,-1,-1,-1},
-{7,32,42,1059,-1,-1,-1,-1},
-{105,187,1060,-1,-1,-1,-1,-1},
-{131,1061,-1,-1,-1,-1,-1,-1},
-{346,1062,-1,-1,-1,-1,-1,-1},
-{61,234,1063,-1,-1,-1,-1,-1},
-{397,1064,-1,-1,-1,-1,-1,-1},
-{129,229,387,1065,-1,-1,-1,-1},
-{24,178,1066,-1,-1,-1,-1,-1},
-{57,196,265,326,1067,-1,-1,-1},
-{163,210,385,1068,-1,-1,-1,-1},
-{27,1069,-1,-1,-1,-1,-1,-1},
-{265,329,1070,-1,-1,-1,-1,-1},
-{269,318,329,1071,-1,-1,-1,-1},
-{128,1072,-1,-1,-1,-1,-1,-1},
-{64,352,1073,-1,-1,-1,-1,-1},
-{317,320,329,1074,-1,-1,-1,-1},
-{169,296,1075,-1,-1,-1,-1,-1},
-{258,321,328,1076,-1,-1,-1,-1},
-{23,1077,-1,-1,-1,-1,-1,-1},
-{13,120,363,1078,-1,-1,-1,-1},
-{278,1079,-1,-1,-1,-1,-1,-1},
-{111,1080,-1,-1,-1,-1,-1,-1},
-{162,167,1081,-1,-1,-1,-1,-1},
-{28,1082,-1,-1,-1,-1,-1,-1},
-{113,193,211,1083,-1,-1,-1,-1},
-{168,199,1084,-1,-1,-1,-1,-1},
-{147,1085,-1,-1,-1,-1,-1,-1},
-{17,86,103,105,372,379,1086,-1},
-{95,227,318,322,1087,-1,-1,-1},
-{150,1088,-1,-1,-1,-1,-1,-1},
-{355,1089,-1,-1,-1,-1,-1,-1},
-{0,296,1090,-1,-1,-1,-1,-1},
-{62,1091,-1,-1,-1,-1,-1,-1},
-{1092,-1,-1,-1,-1,-1,-1,-1},
-{2,312,1093,-1,-1,-1,-1,-1},
-{371,1094,-1,-1,-1,-1,-1,-1},
-{18,167,176,261,1095,-1,-1,-1},
-{7,167,229,280,363,1096,-1,-1},
-{223,368,1097,-1,-1,-1,-1,-1},
-{380,1098,-1,-1,-1,-1,-1,-1},
-{92,307,1099,-1,-1,-1,-1,-1},
-{358,1100,-1,-1,-1,-1,-1,-1},
-{17,100,178,1101,-1,-1,-1,-1},
-{373,1102,-1,-1,-1,-1,-1,-1},
-{205,1103,-1,-1,-1,-1,-1,-1},
-{57,1104,-1,-1,-1,-1,-1,-1},
-{148,338,1105,-1,-1,-1,-1,-1},
-{1106,-1,-1,-1,-1,-1,-1,-1},
-{85,147,200,237,1107,-1,-1,-1},
-{36,1108,-1,-1,-1,-1,-1,-1},
-{82,288,1109,-1,-1,-1,-1,-1},
-{81,1110,-1,-1,-1,-1,-1,-1},
-{86,175,1111,-1,-1,-1,-1,-1},
-{5,220,1112,-1,-1,-1,-1,-1},
-{214,1113,-1,-1,-1,-1,-1,-1},
-{120,394,1114,-1,-1,-1,-1,-1},
-{3,1115,-1,-1,-1,-1,-1,-1},
-{142,166,1116,-1,-1,-1,-1,-1},
-{22,74,246,362,1117,-1,-1,-1},
-{52,180,224,287,1118,-1,-1,-1},
-{1119,-1,-1,-1,-1,-1,-1,-1},
-{1120,-1,-1,-1,-1,-1,-1,-1},
-{25,133,145,359,1121,-1,-1,-1},
-{258,1122,-1,-1,-1,-1,-1,-1},
-{1123,-1,-1,-1,-1,-1,-1,-1},
-{17,1124,-1,-1,-1,-1,-1,-1},
-{116,343,1125,-1,-1,-1,-1,-1},
-{211,261,1126,-1,-1,-1,-1,-1},
-{81,214,215,381,1127,-1,-1,-1},
-{143,1128,-1,-1,-1,-1,-1,-1},
-{218,263,1129,-1,-1,-1,-1,-1},
-{280,1130,-1,-1,-1,-1,-1,-1},
-{134,1131,-1,-1,-1,-1,-1,-1},
-{59,152,1132,-1,-1,-1,-1,-1},
-{57,80,159,311,1133,-1,-1,-1},
-{102,302,1134,-1,-1,-1,-1,-1},
-{210,1135,-1,-1,-1,-1,-1,-1},
-{60,88,342,1136,-1,-1,-1,-1},
-{363,382,1137,-1,-1,-1,-1,-1},
-{192,227,1138,-1,-1,-1,-1,-1},
-{168,1139,-1,-1,-1,-1,-1,-1},
-{1140,-1,-1,-1,-1,-1,-1,-1},
-{1141,-1,-1,-1,-1,-1,-1,-1},
-{55,59,140,336,1142,-1,-1,-1},
-{1143,-1,-1,-1,-1,-1,-1,-1},
-{33,80,261,1144,-1,-1,-1,-1},
-{285,326,351,378,1145,-1,-1,-1},
-{233,1146,-1,-1,-1,-1,-1,-1},
-{115,340,1147,-1,-1,-1,-1,-1},
-{185,289,361,1148,-1,-1,-1,-1},
-{114,160,1149,-1,-1,-1,-1,-1},
-{247,391,1150,-1,-1,-1,-1,-1},
-{280,339,1151,-1,-1,-1,-1,-1},
-{69,1152,-1,-1,-1,-1,-1,-1},
-{35,76,1153,-1,-1,-1,-1,-1},
-{49,70,386,1154,-1,-1,-1,-1},
-{40,334,1155,-1,-1,-1,-1,-1},
-{16,242,389,1156,-1,-1,-1,-1},
-{151,176,192,365,375,1157,-1,-1},
-{64,1158,-1,-1,-1,-1,-1,-1},
-{1159,-1,-1,-1,-1,-1,-1,-1},
-{1160,-1,-1,-1,-1,-1,-1,-1},
-{0,352,1161,-1,-1,-1,-1,-1},
-{72,174,1162,-1,-1,-1,-1,-1},
-{74,1163,-1,-1,-1,-1,-1,-1},
-{1164,-1,-1,-1,-1,-1,-1,-1},
-{12,164,217,253,1165,-1,-1,-1},
-{192,337,1166,-1,-1,-1,-1,-1},
-{1167,-1,-1,-1,-1,-1,-1,-1},
-{28,359,1168,-1,-1,-1,-1,-1},
-{146,1169,-1,-1,-1,-1,-1,-1},
-{1170,-1,-1,-1,-1,-1,-1,-1},
-{189,216,347,1171,-1,-1,-1,-1},
-{326,327,378,398,1172,-1,-1,-1},
-{64,1173,-1,-1,-1,-1,-1,-1},
-{30,45,237,1174,-1,-1,-1,-1},
-{54,145,167,183,1175,-1,-1,-1},
-{1176,-1,-1,-1,-1,-1,-1,-1},
-{32,280,1177,-1,-1,-1,-1,-1},
-{167,346,1178,-1,-1,-1,-1,-1},
-{208,266,1179,-1,-1,-1,-1,-1},
-{1180,-1,-1,-1,-1,-1,-1,-1},
-{86,1181,-1,-1,-1,-1,-1,-1},
-{1182,-1,-1,-1,-1,-1,-1,-1},
-{1183,-1,-1,-1,-1,-1,-1,-1},
-{130,225,242,354,1184,-1,-1,-1},
-{158,239,1185,-1,-1,-1,-1,-1},
-{135,190,285,287,338,1186,-1,-1},
-{18,1187,-1,-1,-1,-1,-1,-1},
-{1188,-1,-1,-1,-1,-1,-1,-1},
-{1189,-1,-1,-1,-1,-1,-1,-1},
-{96,332,1190,-1,-1,-1,-1,-1},
-{111,1191,-1,-1,-1,-1,-1,-1},
-{142,152,1192,-1,-1,-1,-1,-1},
-{128,242,1193,-1,-1,-1,-1,-1},
-{1194,-1,-1,-1,-1,-1,-1,-1},
-{31,101,377,1195,-1,-1,-1,-1},
-{25,27,1196,-1,-1,-1,-1,-1},
-{361,1197,-1,-1,-1,-1,-1,-1},
-{289,1198,-1,-1,-1,-1,-1,-1},
-{54,96,248,274,1199,-1,-1,-1},
-{313,1200,-1,-1,-1,-1,-1,-1},
-{250,1201,-1,-1,-1,-1,-1,-1},
-{108,267,338,1202,-1,-1,-1,-1},
-{63,353,1203,-1,-1,-1,-1,-1},
-{1204,-1,-1,-1,-1,-1,-1,-1},
-{85,395,1205,-1,-1,-1,-1,-1},
-{18,1206,-1,-1,-1,-1,-1,-1},
-{1207,-1,-1,-1,-1,-1,-1,-1},
-{9,79,296,1208,-1,-1,-1,-1},
-{93,275,287,1209,-1,-1,-1,-1},
-{127,1210,-1,-1,-1,-1,-1,-1},
-{176,225,279,287,1211,-1,-1,-1},
-{55,185,289,1212,-1,-1,-1,-1},
-{218,1213,-1,-1,-1,-1,-1,-1},
-{337,1214,-1,-1,-1,-1,-1,-1},
-{66,185,223,1215,-1,-1,-1,-1},
-{215,341,1216,-1,-1,-1,-1,-1},
-{232,1217,-1,-1,-1,-1,-1,-1},
-{360,1218,-1,-1,-1,-1,-1,-1},
-{1219,-1,-1,-1,-1,-1,-1,-1},
-{290,1220,-1,-1,-1,-1,-1,-1},
-{78,252,311,1221,-1,-1,-1,-1},
-{226,281,370,1222,-1,-1,-1,-1},
-{294,314,1223,-1,-1,-1,-1,-1},
-{89,186,1224,-1,-1,-1,-1,-1},
-{177,352,381,1225,-1,-1,-1,-1},
-{221,359,1226,-1,-1,-1,-1,-1},
-{0,28,36,46,151,397,1227,-1},
-{65,245,1228,-1,-1,-1,-1,-1},
-{334,387,1229,-1,-1,-1,-1,-1},
-{201,1230,-1,-1,-1,-1,-1,-1},
-{1231,-1,-1,-1,-1,-1,-1,-1},
-{55,59,144,388,1232,-1,-1,-1},
-{41,61,265,292,378,1233,-1,-1},
-{27,1234,-1,-1,-1,-1,-1,-1},
-{79,1235,-1,-1,-1,-1,-1,-1},
-{166,237,1236,-1,-1,-1,-1,-1},
-{76,253,298,1237,-1,-1,-1,-1},
-{1238,-1,-1,-1,-1,-1,-1,-1},
-{188,1239,-1,-1,-1,-1,-1,-1},
-{302,1240,-1,-1,-1,-1,-1,-1},
-{14,90,1241,-1,-1,-1,-1,-1},
-{57,109,220,1242,-1,-1,-1,-1},
-{365,384,1243,-1,-1,-1,-1,-1},
-{191,196,329,370,1244,-1,-1,-1},
-{8,189,1245,-1,-1,-1,-1,-1},
-{1246,-1,-1,-1,-1,-1,-1,-1},
-{32,48,1247,-1,-1,-1,-1,-1},
-{157,335,357,1248,-1,-1,-1,-1},
-{348,1249,-1,-1,-1,-1,-1,-1},
-{318,341,1250,-1,-1,-1,-1,-1},
-{248,1251,-1,-1,-1,-1,-1,-1},
-{203,1252,-1,-1,-1,-1,-1,-1},
-{27,298,1253,-1,-1,-1,-1,-1},
-{75,232,286,370,1254,-1,-1,-1},
-{388,1255,-1,-1,-1,-1,-1,-1},
-{1256,-1,-1,-1,-1,-1,-1,-1},
-{67,99,234,247,1257,-1,-1,-1},
-{67,181,199,270,1258,-1,-1,-1},
-{230,1259,-1,-1,-1,-1,-1,-1},
-{1260,-1,-1,-1,-1,-1,-1,-1},
-{212,233,257,1261,-1,-1,-1,-1},
-{39,161,1262,-1,-1,-1,-1,-1},
-{3,236,1263,-1,-1,-1,-1,-1},
-{177,1264,-1,-1,-1,-1,-1,-1},
-{282,1265,-1,-1,-1,-1,-1,-1},
-{1266,-1,-1,-1,-1,-1,-1,-1},
-{193,279,1267,-1,-1,-1,-1,-1},
-{157,179,223,326,1268,-1,-1,-1},
-{124,129,1269,-1,-1,-1,-1,-1},
-{115,221,245,306,1270,-1,-1,-1},
-{127,368,377,378,1271,-1,-1,-1},
-{252,381,1272,-1,-1,-1,-1,-1},
-{128,207,355,1273,-1,-1,-1,-1},
-{96,132,1274,-1,-1,-1,-1,-1},
-{191,287,1275,-1,-1,-1,-1,-1},
-{11,111,266,1276,-1,-1,-1,-1},
-{297,1277,-1,-1,-1,-1,-1,-1},
-{383,1278,-1,-1,-1,-1,-1,-1},
-{243,367,393,1279,-1,-1,-1,-1},
-{179,303,1280,-1,-1,-1,-1,-1},
-{269,329,396,1281,-1,-1,-1,-1},
-{31,82,1282,-1,-1,-1,-1,-1},
-{1283,-1,-1,-1,-1,-1,-1,-1},
-{36,218,1284,-1,-1,-1,-1,-1},
-{132,138,275,1285,-1,-1,-1,-1},
-{37,206,314,1286,-1,-1,-1,-1},
-{10,1287,-1,-1,-1,-1,-1,-1},
-{238,340,1288,-1,-1,-1,-1,-1},
-{82,361,1289,-1,-1,-1,-1,-1},
-{140,1290,-1,-1,-1,-1,-1,-1},
-{101,349,1291,-1,-1,-1,-1,-1},
-{301,1292,-1,-1,-1,-1,-1,-1},
-{1293,-1,-1,-1,-1,-1,-1,-1},
-{68,1294,-1,-1,-1,-1,-1,-1},
-{138,182,197,303,360,1295,-1,-1},
-{89,92,225,1296,-1,-1,-1,-1},
-{99,1297,-1,-1,-1,-1,-1,-1},
-{34,75,149,1298,-1,-1,-1,-1},
-{2,1299,-1,-1,-1,-1,-1,-1},
-{144,146,251,1300,-1,-1,-1,-1},
-{15,1301,-1,-1,-1,-1,-1,-1},
-{181,296,1302,-1,-1,-1,-1,-1},
-{1303,-1,-1,-1,-1,-1,-1,-1},
-{33,43,264,1304,-1,-1,-1,-1},
-{106,1305,-1,-1,-1,-1,-1,-1},
-{1306,-1,-1,-1,-1,-1,-1,-1},
-{347,1307,-1,-1,-1,-1,-1,-1},
-{62,148,235,1308,-1,-1,-1,-1},
-{398,1309,-1,-1,-1,-1,-1,-1},
-{130,230,1310,-1,-1,-1,-1,-1},
-{25,179,1311,-1,-1,-1,-1,-1},
-{58,197,266,327,1312,-1,-1,-1},
-{211,386,1313,-1,-1,-1,-1,-1},
-{1314,-1,-1,-1,-1,-1,-1,-1},
-{266,330,1315,-1,-1,-1,-1,-1},
-{270,319,330,368,1316,-1,-1,-1},
-{16,129,1317,-1,-1,-1,-1,-1},
-{65,92,300,353,1318,-1,-1,-1},
-{128,288,318,321,330,1319,-1,-1},
-{170,297,1320,-1,-1,-1,-1,-1},
-{259,322,329,1321,-1,-1,-1,-1},
-{1322,-1,-1,-1,-1,-1,-1,-1},
-{14,121,1323,-1,-1,-1,-1,-1},
-{200,279,1324,-1,-1,-1,-1,-1},
-{108,1325,-1,-1,-1,-1,-1,-1},
-{163,1326,-1,-1,-1,-1,-1,-1},
-{29,128,144,1327,-1,-1,-1,-1},
-{114,194,1328,-1,-1,-1,-1,-1},
-{169,392,1329,-1,-1,-1,-1,-1},
-{1330,-1,-1,-1,-1,-1,-1,-1},
-{18,64,87,106,373,1331,-1,-1},
-{319,323,1332,-1,-1,-1,-1,-1},
-{12,151,1333,-1,-1,-1,-1,-1},
-{1334,-1,-1,-1,-1,-1,-1,-1},
-{1,297,1335,-1,-1,-1,-1,-1},
-{36,63,1336,-1,-1,-1,-1,-1},
-{1337,-1,-1,-1,-1,-1,-1,-1},
-{3,72,313,1338,-1,-1,-1,-1},
-{132,1339,-1,-1,-1,-1,-1,-1},
-{19,177,262,1340,-1,-1,-1,-1},
-{48,230,281,1341,-1,-1,-1,-1},
-{369,1342,-1,-1,-1,-1,-1,-1},
-{381,1343,-1,-1,-1,-1,-1,-1},
-{93,328,1344,-1,-1,-1,-1,-1},
-{80,359,1345,-1,-1,-1,-1,-1},
-{18,101,179,1346,-1,-1,-1,-1},
-{0,260,374,1347,-1,-1,-1,-1},
-{206,1348,-1,-1,-1,-1,-1,-1},
-{58,136,1349,-1,-1,-1,-1,-1},
-{149,339,1350,-1,-1,-1,-1,-1},
-{236,1351,-1,-1,-1,-1,-1,-1},
-{86,132,201,238,1352,-1,-1,-1},
-{37,244,284,1353,-1,-1,-1,-1},
-{83,289,1354,-1,-1,-1,-1,-1},
-{82,1355,-1,-1,-1,-1,-1,-1},
-{87,1356,-1,-1,-1,-1,-1,-1},
-{6,221,1357,-1,-1,-1,-1,-1},
-{215,1358,-1,-1,-1,-1,-1,-1},
-{121,395,1359,-1,-1,-1,-1,-1},
-{1360,-1,-1,-1,-1,-1,-1,-1},
-{143,167,368,1361,-1,-1,-1,-1},
-{23,75,247,272,363,1362,-1,-1},
-{53,181,225,1363,-1,-1,-1,-1},
-{1364,-1,-1,-1,-1,-1,-1,-1},
-{1365,-1,-1,-1,-1,-1,-1,-1},
-{26,134,146,1366,-1,-1,-1,-1},
-{259,1367,-1,-1,-1,-1,-1,-1},
-{172,1368,-1,-1,-1,-1,-1,-1},
-{18,384,1369,-1,-1,-1,-1,-1},
-{117,388,1370,-1,-1,-1,-1,-1},
-{262,1371,-1,-1,-1,-1,-1,-1},
-{82,215,382,1372,-1,-1,-1,-1},
-{1373,-1,-1,-1,-1,-1,-1,-1},
-{219,1374,-1,-1,-1,-1,-1,-1},
-{281,1375,-1,-1,-1,-1,-1,-1},
-{135,1376,-1,-1,-1,-1,-1,-1},
-{72,153,1377,-1,-1,-1,-1,-1},
-{58,81,1378,-1,-1,-1,-1,-1},
-{103,303,1379,-1,-1,-1,-1,-1},
-{211,292,1380,-1,-1,-1,-1,-1},
-{61,89,343,1381,-1,-1,-1,-1},
-{172,383,1382,-1,-1,-1,-1,-1},
-{193,1383,-1,-1,-1,-1,-1,-1},
-{169,1384,-1,-1,-1,-1,-1,-1},
-{116,1385,-1,-1,-1,-1,-1,-1},
-{1386,-1,-1,-1,-1,-1,-1,-1},
-{141,337,1387,-1,-1,-1,-1,-1},
-{1388,-1,-1,-1,-1,-1,-1,-1},
-{34,81,262,1389,-1,-1,-1,-1},
-{286,327,379,1390,-1,-1,-1,-1},
-{234,1391,-1,-1,-1,-1,-1,-1},
-{120,341,1392,-1,-1,-1,-1,-1},
-{84,186,232,236,290,362,384,1393},
-{115,161,1394,-1,-1,-1,-1,-1},
-{124,280,1395,-1,-1,-1,-1,-1},
-{44,281,1396,-1,-1,-1,-1,-1},
-{70,244,260,1397,-1,-1,-1,-1},
-{77,236,1398,-1,-1,-1,-1,-1},
-{50,71,387,1399,-1,-1,-1,-1},
-{41,335,1400,-1,-1,-1,-1,-1},
-{17,243,390,1401,-1,-1,-1,-1},
-{177,193,366,1402,-1,-1,-1,-1},
-{65,1403,-1,-1,-1,-1,-1,-1},
-{184,1404,-1,-1,-1,-1,-1,-1},
-{1405,-1,-1,-1,-1,-1,-1,-1},
-{1,353,1406,-1,-1,-1,-1,-1},
-{73,175,1407,-1,-1,-1,-1,-1},
-{75,1408,-1,-1,-1,-1,-1,-1},
-{380,1409,-1,-1,-1,-1,-1,-1},
-{13,165,218,254,1410,-1,-1,-1},
-{116,193,338,384,1411,-1,-1,-1},
-{136,1412,-1,-1,-1,-1,-1,-1},
-{29,260,1413,-1,-1,-1,-1,-1},
-{147,1414,-1,-1,-1,-1,-1,-1},
-{1415,-1,-1,-1,-1,-1,-1,-1},
-{190,217,232,1416,-1,-1,-1,-1},
-{327,379,399,1417,-1,-1,-1,-1},
-{65,1418,-1,-1,-1,-1,-1,-1},
-{31,46,238,1419,-1,-1,-1,-1},
-{55,146,1420,-1,-1,-1,-1,-1},
-{1421,-1,-1,-1,-1,-1,-1,-1},
-{33,281,324,1422,-1,-1,-1,-1},
-{347,1423,-1,-1,-1,-1,-1,-1},
-{36,209,267,1424,-1,-1,-1,-1},
-{1425,-1,-1,-1,-1,-1,-1,-1},
-{87,308,1426,-1,-1,-1,-1,-1},
-{1427,-1,-1,-1,-1,-1,-1,-1},
-{1428,-1,-1,-1,-1,-1,-1,-1},
-{131,226,243,355,1429,-1,-1,-1},
-{159,1430,-1,-1,-1,-1,-1,-1},
-{191,286,339,1431,-1,-1,-1,-1},
-{19,1432,-1,-1,-1,-1,-1,-1},
-{1433,-1,-1,-1,-1,-1,-1,-1},
-{1434,-1,-1,-1,-1,-1,-1,-1},
-{97,333,1435,-1,-1,-1,-1,-1},
-{1436,-1,-1,-1,-1,-1,-1,-1},
-{143,153,1437,-1,-1,-1,-1,-1},
-{129,243,1438,-1,-1,-1,-1,-1},
-{300,1439,-1,-1,-1,-1,-1,-1},
-{84,102,378,1440,-1,-1,-1,-1},
-{26,1441,-1,-1,-1,-1,-1,-1},
-{104,304,362,388,1442,-1,-1,-1},
-{40,290,1443,-1,-1,-1,-1,-1},
-{55,97,249,275,1444,-1,-1,-1},
-{314,1445,-1,-1,-1,-1,-1,-1},
-{251,1446,-1,-1,-1,-1,-1,-1},
-{109,339,1447,-1,-1,-1,-1,-1},
-{354,1448,-1,-1,-1,-1,-1,-1},
-{312,1449,-1,-1,-1,-1,-1,-1},
-{28,86,244,256,1450,-1,-1,-1},
-{19,1451,-1,-1,-1,-1,-1,-1},
-{1452,-1,-1,-1,-1,-1,-1,-1},
-{10,297,1453,-1,-1,-1,-1,-1},
-{94,300,1454,-1,-1,-1,-1,-1},
-{100,152,1455,-1,-1,-1,-1,-1},
-{177,192,226,1456,-1,-1,-1,-1},
-{186,290,1457,-1,-1,-1,-1,-1},
-{219,1458,-1,-1,-1,-1,-1,-1},
-{20,338,1459,-1,-1,-1,-1,-1},
-{67,186,1460,-1,-1,-1,-1,-1},
-{342,1461,-1,-1,-1,-1,-1,-1},
-{233,1462,-1,-1,-1,-1,-1,-1},
-{361,1463,-1,-1,-1,-1,-1,-1},
-{1464,-1,-1,-1,-1,-1,-1,-1},
-{291,1465,-1,-1,-1,-1,-1,-1},
-{40,79,253,256,1466,-1,-1,-1},
-{227,282,344,371,1467,-1,-1,-1},
-{295,315,1468,-1,-1,-1,-1,-1},
-{90,187,1469,-1,-1,-1,-1,-1},
-{178,353,382,1470,-1,-1,-1,-1},
-{222,1471,-1,-1,-1,-1,-1,-1},
-{1,29,37,47,398,1472,-1,-1},
-{66,108,246,1473,-1,-1,-1,-1},
-{335,1474,-1,-1,-1,-1,-1,-1},
-{202,1475,-1,-1,-1,-1,-1,-1},
-{304,328,1476,-1,-1,-1,-1,-1},
-{145,389,1477,-1,-1,-1,-1,-1},
-{42,62,108,266,293,379,1478,-1},
-{312,1479,-1,-1,-1,-1,-1,-1},
-{336,1480,-1,-1,-1,-1,-1,-1},
-{167,208,238,1481,-1,-1,-1,-1},
-{77,160,254,299,1482,-1,-1,-1},
-{1483,-1,-1,-1,-1,-1,-1,-1},
-{189,1484,-1,-1,-1,-1,-1,-1},
-{220,303,1485,-1,-1,-1,-1,-1},
-{15,91,1486,-1,-1,-1,-1,-1},
-{58,110,221,1487,-1,-1,-1,-1},
-{366,385,1488,-1,-1,-1,-1,-1},
-{197,330,371,1489,-1,-1,-1,-1},
-{9,190,1490,-1,-1,-1,-1,-1},
-{4,56,304,1491,-1,-1,-1,-1},
-{33,49,1492,-1,-1,-1,-1,-1},
-{108,158,308,358,1493,-1,-1,-1},
-{349,368,1494,-1,-1,-1,-1,-1},
-{319,342,1495,-1,-1,-1,-1,-1},
-{249,1496,-1,-1,-1,-1,-1,-1},
-{260,1497,-1,-1,-1,-1,-1,-1},
-{299,1498,-1,-1,-1,-1,-1,-1},
-{233,287,371,1499,-1,-1,-1,-1},
-{389,1500,-1,-1,-1,-1,-1,-1},
-{1501,-1,-1,-1,-1,-1,-1,-1},
-{235,1502,-1,-1,-1,-1,-1,-1},
-{182,271,1503,-1,-1,-1,-1,-1},
-{68,231,1504,-1,-1,-1,-1,-1},
-{1505,-1,-1,-1,-1,-1,-1,-1},
-{213,234,258,1506,-1,-1,-1,-1},
-{162,1507,-1,-1,-1,-1,-1,-1},
-{237,1508,-1,-1,-1,-1,-1,-1},
-{178,1509,-1,-1,-1,-1,-1,-1},
-{64,283,1510,-1,-1,-1,-1,-1},
-{332,1511,-1,-1,-1,-1,-1,-1},
-{72,194,1512,-1,-1,-1,-1,-1},
-{158,327,1513,-1,-1,-1,-1,-1},
-{125,130,1514,-1,-1,-1,-1,-1},
-{222,246,307,1515,-1,-1,-1,-1},
-{369,378,379,1516,-1,-1,-1,-1},
-{253,382,1517,-1,-1,-1,-1,-1},
-{129,1518,-1,-1,-1,-1,-1,-1},
-{97,133,1519,-1,-1,-1,-1,-1},
-{1520,-1,-1,-1,-1,-1,-1,-1},
-{267,1521,-1,-1,-1,-1,-1,-1},
-{298,1522,-1,-1,-1,-1,-1,-1},
-{88,1523,-1,-1,-1,-1,-1,-1},
-{4,394,1524,-1,-1,-1,-1,-1},
-{184,1525,-1,-1,-1,-1,-1,-1},
-{128,270,330,397,1526,-1,-1,-1},
-{83,1527,-1,-1,-1,-1,-1,-1},
-{1528,-1,-1,-1,-1,-1,-1,-1},
-{37,219,1529,-1,-1,-1,-1,-1},
-{133,139,384,1530,-1,-1,-1,-1},
-{38,207,315,1531,-1,-1,-1,-1},
-{11,1532,-1,-1,-1,-1,-1,-1},
-{160,239,341,1533,-1,-1,-1,-1},
-{24,83,362,1534,-1,-1,-1,-1},
-{141,1535,-1,-1,-1,-1,-1,-1},
-{102,350,1536,-1,-1,-1,-1,-1},
-{302,1537,-1,-1,-1,-1,-1,-1},
-{1538,-1,-1,-1,-1,-1,-1,-1},
-{69,1539,-1,-1,-1,-1,-1,-1},
-{139,183,198,361,1540,-1,-1,-1},
-{90,93,226,1541,-1,-1,-1,-1},
-{20,1542,-1,-1,-1,-1,-1,-1},
-{35,150,360,1543,-1,-1,-1,-1},
-{3,1544,-1,-1,-1,-1,-1,-1},
-{108,145,147,1545,-1,-1,-1,-1},
-{164,1546,-1,-1,-1,-1,-1,-1},
-{182,297,1547,-1,-1,-1,-1,-1},
-{208,1548,-1,-1,-1,-1,-1,-1},
-{34,196,265,1549,-1,-1,-1,-1},
-{107,144,1550,-1,-1,-1,-1,-1},
-{100,376,1551,-1,-1,-1,-1,-1},
-{92,224,1552,-1,-1,-1,-1,-1},
-{63,149,1553,-1,-1,-1,-1,-1},
-{352,399,1554,-1,-1,-1,-1,-1},
-{131,231,1555,-1,-1,-1,-1,-1},
-{26,1556,-1,-1,-1,-1,-1,-1},
-{59,198,267,1557,-1,-1,-1,-1},
-{387,1558,-1,-1,-1,-1,-1,-1},
-{368,1559,-1,-1,-1,-1,-1,-1},
-{164,267,331,1560,-1,-1,-1,-1},
-{4,164,271,331,360,369,1561,-1},
-{17,130,220,1562,-1,-1,-1,-1},
-{66,93,301,354,1563,-1,-1,-1},
-{129,289,304,319,322,331,1564,-1},
-{171,298,1565,-1,-1,-1,-1,-1},
-{323,330,1566,-1,-1,-1,-1,-1},
-{1567,-1,-1,-1,-1,-1,-1,-1},
-{15,122,1568,-1,-1,-1,-1,-1},
-{201,1569,-1,-1,-1,-1,-1,-1},
-{109,1570,-1,-1,-1,-1,-1,-1},
-{1571,-1,-1,-1,-1,-1,-1,-1},
-{30,129,144,145,1572,-1,-1,-1},
-{115,195,1573,-1,-1,-1,-1,-1},
-{170,393,1574,-1,-1,-1,-1,-1},
-{1575,-1,-1,-1,-1,-1,-1,-1},
-{19,65,107,172,374,1576,-1,-1},
-{1577,-1,-1,-1,-1,-1,-1,-1},
-{13,1578,-1,-1,-1,-1,-1,-1},
-{1579,-1,-1,-1,-1,-1,-1,-1},
-{0,2,298,1580,-1,-1,-1,-1},
-{37,1581,-1,-1,-1,-1,-1,-1},
-{1582,-1,-1,-1,-1,-1,-1,-1},
-{73,284,314,1583,-1,-1,-1,-1},
-{133,1584,-1,-1,-1,-1,-1,-1},
-{178,263,1585,-1,-1,-1,-1,-1},
-{49,231,282,356,1586,-1,-1,-1},
-{370,1587,-1,-1,-1,-1,-1,-1},
-{382,1588,-1,-1,-1,-1,-1,-1},
-{94,329,1589,-1,-1,-1,-1,-1},
-{81,340,1590,-1,-1,-1,-1,-1},
-{19,102,208,1591,-1,-1,-1,-1},
-{1,212,261,375,1592,-1,-1,-1},
-{140,207,1593,-1,-1,-1,-1,-1},
-{59,137,260,1594,-1,-1,-1,-1},
-{150,1595,-1,-1,-1,-1,-1,-1},
-{237,1596,-1,-1,-1,-1,-1,-1},
-{56,87,133,202,239,1597,-1,-1},
-{38,156,245,285,308,1598,-1,-1}};
-int mercury_normal_QCmatrixV_4_16[1600][9]={
-{129,204,410,691,762,828,948,1181,-1},
-{374,449,655,936,1007,1073,1193,226,-1},
-{619,694,900,1181,52,118,238,471,-1},
-{864,939,1145,226,297,363,483,716,-1},
-{468,1092,1125,1162,-1,-1,-1,-1,-1},
-{713,137,170,207,-1,-1,-1,-1,-1},
-{958,382,415,452,-1,-1,-1,-1,-1},
-{3,627,660,697,-1,-1,-1,-1,-1},
-{142,398,564,846,-1,-1,-1,-1,-1},
-{387,643,809,1091,-1,-1,-1,-1,-1},
-{632,888,1054,136,-1,-1,-1,-1,-1},
-{877,1133,99,381,-1,-1,-1,-1,-1},
-{167,352,434,766,934,-1,-1,-1,-1},
-{412,597,679,1011,1179,-1,-1,-1,-1},
-{657,842,924,56,224,-1,-1,-1,-1},
-{902,1087,1169,301,469,-1,-1,-1,-1},
-{206,298,317,442,457,480,757,918,-1},
-{451,543,562,687,702,725,1002,1163,-1},
-{696,788,807,932,947,970,47,208,-1},
-{941,1033,1052,1177,1192,15,292,453,-1},
-{228,1060,1143,-1,-1,-1,-1,-1,-1},
-{473,105,188,-1,-1,-1,-1,-1,-1},
-{718,350,433,-1,-1,-1,-1,-1,-1},
-{963,595,678,-1,-1,-1,-1,-1,-1},
-{62,100,119,477,552,667,1135,-1,-1},
-{307,345,364,722,797,912,180,-1,-1},
-{552,590,609,967,1042,1157,425,-1,-1},
-{797,835,854,12,87,202,670,-1,-1},
-{61,148,285,683,769,828,1051,-1,-1},
-{306,393,530,928,1014,1073,96,-1,-1},
-{551,638,775,1173,59,118,341,-1,-1},
-{796,883,1020,218,304,363,586,-1,-1},
-{19,409,500,660,778,848,-1,-1,-1},
-{264,654,745,905,1023,1093,-1,-1,-1},
-{509,899,990,1150,68,138,-1,-1,-1},
-{754,1144,35,195,313,383,-1,-1,-1},
-{128,642,709,828,885,937,1025,-1,-1},
-{373,887,954,1073,1130,1182,70,-1,-1},
-{618,1132,1199,118,175,227,315,-1,-1},
-{863,177,244,363,420,472,560,-1,-1},
-{170,589,756,1044,1067,-1,-1,-1,-1},
-{415,834,1001,89,112,-1,-1,-1,-1},
-{660,1079,46,334,357,-1,-1,-1,-1},
-{905,124,291,579,602,-1,-1,-1,-1},
-{338,530,997,-1,-1,-1,-1,-1,-1},
-{583,775,42,-1,-1,-1,-1,-1,-1},
-{828,1020,287,-1,-1,-1,-1,-1,-1},
-{1073,65,532,-1,-1,-1,-1,-1,-1},
-{510,848,942,-1,-1,-1,-1,-1,-1},
-{755,1093,1187,-1,-1,-1,-1,-1,-1},
-{1000,138,232,-1,-1,-1,-1,-1,-1},
-{45,383,477,-1,-1,-1,-1,-1,-1},
-{8,78,98,286,310,719,-1,-1,-1},
-{253,323,343,531,555,964,-1,-1,-1},
-{498,568,588,776,800,9,-1,-1,-1},
-{743,813,833,1021,1045,254,-1,-1,-1},
-{8,98,423,460,489,598,1092,1198,-1},
-{253,343,668,705,734,843,137,243,-1},
-{498,588,913,950,979,1088,382,488,-1},
-{743,833,1158,1195,24,133,627,733,-1},
-{69,202,419,589,737,-1,-1,-1,-1},
-{314,447,664,834,982,-1,-1,-1,-1},
-{559,692,909,1079,27,-1,-1,-1,-1},
-{804,937,1154,124,272,-1,-1,-1,-1},
-{123,124,326,584,674,759,774,932,1111},
-{368,369,571,829,919,1004,1019,1177,156},
-{613,614,816,1074,1164,49,64,222,401},
-{858,859,1061,119,209,294,309,467,646},
-{265,508,895,1105,-1,-1,-1,-1,-1},
-{510,753,1140,150,-1,-1,-1,-1,-1},
-{755,998,185,395,-1,-1,-1,-1,-1},
-{1000,43,430,640,-1,-1,-1,-1,-1},
-{120,164,228,274,763,939,978,1113,-1},
-{365,409,473,519,1008,1184,23,158,-1},
-{610,654,718,764,53,229,268,403,-1},
-{855,899,963,1009,298,474,513,648,-1},
-{74,101,332,754,838,-1,-1,-1,-1},
-{319,346,577,999,1083,-1,-1,-1,-1},
-{564,591,822,44,128,-1,-1,-1,-1},
-{809,836,1067,289,373,-1,-1,-1,-1},
-{946,220,400,466,483,734,393,745,-1},
-{1191,465,645,711,728,979,638,990,-1},
-{236,710,890,956,973,24,883,35,-1},
-{481,955,1135,1,18,269,1128,280,-1},
-{197,222,292,463,561,994,1041,-1,-1},
-{442,467,537,708,806,39,86,-1,-1},
-{687,712,782,953,1051,284,331,-1,-1},
-{932,957,1027,1198,96,529,576,-1,-1},
-{352,580,652,737,1124,-1,-1,-1,-1},
-{597,825,897,982,169,-1,-1,-1,-1},
-{842,1070,1142,27,414,-1,-1,-1,-1},
-{1087,115,187,272,659,-1,-1,-1,-1},
-{565,700,897,919,1153,-1,-1,-1,-1},
-{810,945,1142,1164,198,-1,-1,-1,-1},
-{1055,1190,187,209,443,-1,-1,-1,-1},
-{100,235,432,454,688,-1,-1,-1,-1},
-{123,163,791,800,875,-1,-1,-1,-1},
-{368,408,1036,1045,1120,-1,-1,-1,-1},
-{613,653,81,90,165,-1,-1,-1,-1},
-{858,898,326,335,410,-1,-1,-1,-1},
-{245,551,647,702,1056,1152,-1,-1,-1},
-{490,796,892,947,101,197,-1,-1,-1},
-{735,1041,1137,1192,346,442,-1,-1,-1},
-{980,86,182,237,591,687,-1,-1,-1},
-{416,442,1043,-1,-1,-1,-1,-1,-1},
-{661,687,88,-1,-1,-1,-1,-1,-1},
-{906,932,333,-1,-1,-1,-1,-1,-1},
-{1151,1177,578,-1,-1,-1,-1,-1,-1},
-{57,142,598,803,926,1074,1079,1094,1146},
-{302,387,843,1048,1171,119,124,139,191},
-{547,632,1088,93,216,364,369,384,436},
-{792,877,133,338,461,609,614,629,681},
-{13,136,439,260,-1,-1,-1,-1,-1},
-{258,381,684,505,-1,-1,-1,-1,-1},
-{503,626,929,750,-1,-1,-1,-1,-1},
-{748,871,1174,995,-1,-1,-1,-1,-1},
-{726,986,1012,-1,-1,-1,-1,-1,-1},
-{971,31,57,-1,-1,-1,-1,-1,-1},
-{16,276,302,-1,-1,-1,-1,-1,-1},
-{261,521,547,-1,-1,-1,-1,-1,-1},
-{679,715,993,-1,-1,-1,-1,-1,-1},
-{924,960,38,-1,-1,-1,-1,-1,-1},
-{1169,5,283,-1,-1,-1,-1,-1,-1},
-{214,250,528,-1,-1,-1,-1,-1,-1},
-{76,137,870,996,-1,-1,-1,-1,-1},
-{321,382,1115,41,-1,-1,-1,-1,-1},
-{566,627,160,286,-1,-1,-1,-1,-1},
-{811,872,405,531,-1,-1,-1,-1,-1},
-{295,421,625,673,794,874,920,928,1127},
-{540,666,870,918,1039,1119,1165,1173,172},
-{785,911,1115,1163,84,164,210,218,417},
-{1030,1156,160,208,329,409,455,463,662},
-{52,242,477,875,886,940,953,-1,-1},
-{297,487,722,1120,1131,1185,1198,-1,-1},
-{542,732,967,165,176,230,243,-1,-1},
-{787,977,12,410,421,475,488,-1,-1},
-{396,406,950,1013,-1,-1,-1,-1,-1},
-{641,651,1195,58,-1,-1,-1,-1,-1},
-{886,896,240,303,-1,-1,-1,-1,-1},
-{1131,1141,485,548,-1,-1,-1,-1,-1},
-{227,303,743,891,1194,-1,-1,-1,-1},
-{472,548,988,1136,239,-1,-1,-1,-1},
-{717,793,33,181,484,-1,-1,-1,-1},
-{962,1038,278,426,729,-1,-1,-1,-1},
-{280,411,477,531,833,901,928,1151,1173},
-{525,656,722,776,1078,1146,1173,196,218},
-{770,901,967,1021,123,191,218,441,463},
-{1015,1146,12,66,368,436,463,686,708},
-{23,93,199,654,706,909,-1,-1,-1},
-{268,338,444,899,951,1154,-1,-1,-1},
-{513,583,689,1144,1196,199,-1,-1,-1},
-{758,828,934,189,241,444,-1,-1,-1},
-{733,793,1056,-1,-1,-1,-1,-1,-1},
-{978,1038,101,-1,-1,-1,-1,-1,-1},
-{23,83,346,-1,-1,-1,-1,-1,-1},
-{268,328,591,-1,-1,-1,-1,-1,-1},
-{296,604,624,1199,-1,-1,-1,-1,-1},
-{541,849,869,244,-1,-1,-1,-1,-1},
-{786,1094,1114,489,-1,-1,-1,-1,-1},
-{1031,139,159,734,-1,-1,-1,-1,-1},
-{192,618,750,1083,1134,-1,-1,-1,-1},
-{437,863,995,128,179,-1,-1,-1,-1},
-{682,1108,40,373,424,-1,-1,-1,-1},
-{927,153,285,618,669,-1,-1,-1,-1},
-{41,44,227,347,766,1147,1161,1162,-1},
-{286,289,472,592,1011,192,206,207,-1},
-{531,534,717,837,56,437,451,452,-1},
-{776,779,962,1082,301,682,696,697,-1},
-{685,431,740,-1,-1,-1,-1,-1,-1},
-{930,676,985,-1,-1,-1,-1,-1,-1},
-{1175,921,30,-1,-1,-1,-1,-1,-1},
-{220,1166,275,-1,-1,-1,-1,-1,-1},
-{273,969,983,1177,-1,-1,-1,-1,-1},
-{518,14,28,222,-1,-1,-1,-1,-1},
-{763,259,273,467,-1,-1,-1,-1,-1},
-{1008,504,518,712,-1,-1,-1,-1,-1},
-{134,146,177,212,581,620,696,758,812},
-{379,391,422,457,826,865,941,1003,1057},
-{624,636,667,702,1071,1110,1186,48,102},
-{869,881,912,947,116,155,231,293,347},
-{41,406,614,658,719,-1,-1,-1,-1},
-{286,651,859,903,964,-1,-1,-1,-1},
-{531,896,1104,1148,9,-1,-1,-1,-1},
-{776,1141,149,193,254,-1,-1,-1,-1},
-{568,1005,1126,571,335,504,-1,-1,-1},
-{813,50,171,816,580,749,-1,-1,-1},
-{1058,295,416,1061,825,994,-1,-1,-1},
-{103,540,661,106,1070,39,-1,-1,-1},
-{110,141,297,527,601,840,-1,-1,-1},
-{355,386,542,772,846,1085,-1,-1,-1},
-{600,631,787,1017,1091,130,-1,-1,-1},
-{845,876,1032,62,136,375,-1,-1,-1},
-{439,623,739,758,767,1057,-1,-1,-1},
-{684,868,984,1003,1012,102,-1,-1,-1},
-{929,1113,29,48,57,347,-1,-1,-1},
-{1174,158,274,293,302,592,-1,-1,-1},
-{124,651,668,845,1150,-1,-1,-1,-1},
-{369,896,913,1090,195,-1,-1,-1,-1},
-{614,1141,1158,135,440,-1,-1,-1,-1},
-{859,186,203,380,685,-1,-1,-1,-1},
-{118,586,708,925,-1,-1,-1,-1,-1},
-{363,831,953,1170,-1,-1,-1,-1,-1},
-{608,1076,1198,215,-1,-1,-1,-1,-1},
-{853,121,243,460,-1,-1,-1,-1,-1},
-{139,397,459,-1,-1,-1,-1,-1,-1},
-{384,642,704,-1,-1,-1,-1,-1,-1},
-{629,887,949,-1,-1,-1,-1,-1,-1},
-{874,1132,1194,-1,-1,-1,-1,-1,-1},
-{179,246,780,1082,1149,1192,-1,-1,-1},
-{424,491,1025,127,194,237,-1,-1,-1},
-{669,736,70,372,439,482,-1,-1,-1},
-{914,981,315,617,684,727,-1,-1,-1},
-{82,224,238,862,1193,-1,-1,-1,-1},
-{327,469,483,1107,238,-1,-1,-1,-1},
-{572,714,728,152,483,-1,-1,-1,-1},
-{817,959,973,397,728,-1,-1,-1,-1},
-{240,324,395,521,772,-1,-1,-1,-1},
-{485,569,640,766,1017,-1,-1,-1,-1},
-{730,814,885,1011,62,-1,-1,-1,-1},
-{975,1059,1130,56,307,-1,-1,-1,-1},
-{81,134,582,626,713,843,1086,1163,-1},
-{326,379,827,871,958,1088,131,208,-1},
-{571,624,1072,1116,3,133,376,453,-1},
-{816,869,117,161,248,378,621,698,-1},
-{4,333,540,567,652,719,1153,-1,-1},
-{249,578,785,812,897,964,198,-1,-1},
-{494,823,1030,1057,1142,9,443,-1,-1},
-{739,1068,75,102,187,254,688,-1,-1},
-{370,421,452,-1,-1,-1,-1,-1,-1},
-{615,666,697,-1,-1,-1,-1,-1,-1},
-{860,911,942,-1,-1,-1,-1,-1,-1},
-{1105,1156,1187,-1,-1,-1,-1,-1,-1},
-{174,368,502,617,818,855,994,1017,-1},
-{419,613,747,862,1063,1100,39,62,-1},
-{664,858,992,1107,108,145,284,307,-1},
-{909,1103,37,152,353,390,529,552,-1},
-{51,399,463,530,592,864,952,994,999},
-{296,644,708,775,837,1109,1197,39,44},
-{541,889,953,1020,1082,154,242,284,289},
-{786,1134,1198,65,127,399,487,529,534},
-{145,267,295,304,-1,-1,-1,-1,-1},
-{390,512,540,549,-1,-1,-1,-1,-1},
-{635,757,785,794,-1,-1,-1,-1,-1},
-{880,1002,1030,1039,-1,-1,-1,-1,-1},
-{16,123,228,584,626,954,998,1051,-1},
-{261,368,473,829,871,1199,43,96,-1},
-{506,613,718,1074,1116,244,288,341,-1},
-{751,858,963,119,161,489,533,586,-1},
-{166,312,800,852,-1,-1,-1,-1,-1},
-{411,557,1045,1097,-1,-1,-1,-1,-1},
-{656,802,90,142,-1,-1,-1,-1,-1},
-{901,1047,335,387,-1,-1,-1,-1,-1},
-{521,593,822,873,-1,-1,-1,-1,-1},
-{766,838,1067,1118,-1,-1,-1,-1,-1},
-{1011,1083,112,163,-1,-1,-1,-1,-1},
-{56,128,357,408,-1,-1,-1,-1,-1},
-{187,233,617,1051,1067,-1,-1,-1,-1},
-{432,478,862,96,112,-1,-1,-1,-1},
-{677,723,1107,341,357,-1,-1,-1,-1},
-{922,968,152,586,602,-1,-1,-1,-1},
-{451,482,500,948,998,1014,1098,1195,-1},
-{696,727,745,1193,43,59,143,240,-1},
-{941,972,990,238,288,304,388,485,-1},
-{1186,17,35,483,533,549,633,730,-1},
-{68,290,387,423,426,589,905,-1,-1},
-{313,535,632,668,671,834,1150,-1,-1},
-{558,780,877,913,916,1079,195,-1,-1},
-{803,1025,1122,1158,1161,124,440,-1,-1},
-{369,427,637,-1,-1,-1,-1,-1,-1},
-{614,672,882,-1,-1,-1,-1,-1,-1},
-{859,917,1127,-1,-1,-1,-1,-1,-1},
-{1104,1162,172,-1,-1,-1,-1,-1,-1},
-{75,151,310,963,-1,-1,-1,-1,-1},
-{320,396,555,8,-1,-1,-1,-1,-1},
-{565,641,800,253,-1,-1,-1,-1,-1},
-{810,886,1045,498,-1,-1,-1,-1,-1},
-{190,77,133,-1,-1,-1,-1,-1,-1},
-{435,322,378,-1,-1,-1,-1,-1,-1},
-{680,567,623,-1,-1,-1,-1,-1,-1},
-{925,812,868,-1,-1,-1,-1,-1,-1},
-{376,578,731,778,996,752,697,-1,-1},
-{621,823,976,1023,41,997,942,-1,-1},
-{866,1068,21,68,286,42,1187,-1,-1},
-{1111,113,266,313,531,287,232,-1,-1},
-{52,75,77,141,365,501,542,954,1184},
-{297,320,322,386,610,746,787,1199,229},
-{542,565,567,631,855,991,1032,244,474},
-{787,810,812,876,1100,36,77,489,719},
-{331,504,554,568,710,920,-1,-1,-1},
-{576,749,799,813,955,1165,-1,-1,-1},
-{821,994,1044,1058,0,210,-1,-1,-1},
-{1066,39,89,103,245,455,-1,-1,-1},
-{334,834,981,-1,-1,-1,-1,-1,-1},
-{579,1079,26,-1,-1,-1,-1,-1,-1},
-{824,124,271,-1,-1,-1,-1,-1,-1},
-{1069,369,516,-1,-1,-1,-1,-1,-1},
-{348,364,633,676,691,809,903,-1,-1},
-{593,609,878,921,936,1054,1148,-1,-1},
-{838,854,1123,1166,1181,99,193,-1,-1},
-{1083,1099,168,211,226,344,438,-1,-1},
-{146,161,245,351,648,919,1040,1055,-1},
-{391,406,490,596,893,1164,85,100,-1},
-{636,651,735,841,1138,209,330,345,-1},
-{881,896,980,1086,183,454,575,590,-1},
-{381,1043,1077,1092,1165,-1,-1,-1,-1},
-{626,88,122,137,210,-1,-1,-1,-1},
-{871,333,367,382,455,-1,-1,-1,-1},
-{1116,578,612,627,700,-1,-1,-1,-1},
-{87,1027,1094,1199,-1,-1,-1,-1,-1},
-{332,72,139,244,-1,-1,-1,-1,-1},
-{577,317,384,489,-1,-1,-1,-1,-1},
-{822,562,629,734,-1,-1,-1,-1,-1},
-{334,397,556,694,1050,1080,-1,-1,-1},
-{579,642,801,939,95,125,-1,-1,-1},
-{824,887,1046,1184,340,370,-1,-1,-1},
-{1069,1132,91,229,585,615,-1,-1,-1},
-{182,198,361,430,-1,-1,-1,-1,-1},
-{427,443,606,675,-1,-1,-1,-1,-1},
-{672,688,851,920,-1,-1,-1,-1,-1},
-{917,933,1096,1165,-1,-1,-1,-1,-1},
-{198,432,675,-1,-1,-1,-1,-1,-1},
-{443,677,920,-1,-1,-1,-1,-1,-1},
-{688,922,1165,-1,-1,-1,-1,-1,-1},
-{933,1167,210,-1,-1,-1,-1,-1,-1},
-{38,178,256,283,379,1023,-1,-1,-1},
-{283,423,501,528,624,68,-1,-1,-1},
-{528,668,746,773,869,313,-1,-1,-1},
-{773,913,991,1018,1114,558,-1,-1,-1},
-{426,427,430,600,637,677,945,1077,-1},
-{671,672,675,845,882,922,1190,122,-1},
-{916,917,920,1090,1127,1167,235,367,-1},
-{1161,1162,1165,135,172,212,480,612,-1},
-{114,266,340,791,1112,-1,-1,-1,-1},
-{359,511,585,1036,157,-1,-1,-1,-1},
-{604,756,830,81,402,-1,-1,-1,-1},
-{849,1001,1075,326,647,-1,-1,-1,-1},
-{17,216,297,313,522,570,743,1081,-1},
-{262,461,542,558,767,815,988,126,-1},
-{507,706,787,803,1012,1060,33,371,-1},
-{752,951,1032,1048,57,105,278,616,-1},
-{247,572,606,748,889,1191,-1,-1,-1},
-{492,817,851,993,1134,236,-1,-1,-1},
-{737,1062,1096,38,179,481,-1,-1,-1},
-{982,107,141,283,424,726,-1,-1,-1},
-{37,173,289,1068,-1,-1,-1,-1,-1},
-{282,418,534,113,-1,-1,-1,-1,-1},
-{527,663,779,358,-1,-1,-1,-1,-1},
-{772,908,1024,603,-1,-1,-1,-1,-1},
-{11,647,850,-1,-1,-1,-1,-1,-1},
-{256,892,1095,-1,-1,-1,-1,-1,-1},
-{501,1137,140,-1,-1,-1,-1,-1,-1},
-{746,182,385,-1,-1,-1,-1,-1,-1},
-{139,295,559,674,762,826,1155,-1,-1},
-{384,540,804,919,1007,1071,200,-1,-1},
-{629,785,1049,1164,52,116,445,-1,-1},
-{874,1030,94,209,297,361,690,-1,-1},
-{34,92,211,604,1187,-1,-1,-1,-1},
-{279,337,456,849,232,-1,-1,-1,-1},
-{524,582,701,1094,477,-1,-1,-1,-1},
-{769,827,946,139,722,-1,-1,-1,-1},
-{3,228,504,553,645,819,896,1144,1162},
-{248,473,749,798,890,1064,1141,189,207},
-{493,718,994,1043,1135,109,186,434,452},
-{738,963,39,88,180,354,431,679,697},
-{145,513,599,-1,-1,-1,-1,-1,-1},
-{390,758,844,-1,-1,-1,-1,-1,-1},
-{635,1003,1089,-1,-1,-1,-1,-1,-1},
-{880,48,134,-1,-1,-1,-1,-1,-1},
-{333,355,365,698,872,917,962,1095,1160},
-{578,600,610,943,1117,1162,7,140,205},
-{823,845,855,1188,162,207,252,385,450},
-{1068,1090,1100,233,407,452,497,630,695},
-{23,458,687,-1,-1,-1,-1,-1,-1},
-{268,703,932,-1,-1,-1,-1,-1,-1},
-{513,948,1177,-1,-1,-1,-1,-1,-1},
-{758,1193,222,-1,-1,-1,-1,-1,-1},
-{256,283,344,382,551,627,1152,-1,-1},
-{501,528,589,627,796,872,197,-1,-1},
-{746,773,834,872,1041,1117,442,-1,-1},
-{991,1018,1079,1117,86,162,687,-1,-1},
-{144,248,483,581,628,699,1010,-1,-1},
-{389,493,728,826,873,944,55,-1,-1},
-{634,738,973,1071,1118,1189,300,-1,-1},
-{879,983,18,116,163,234,545,-1,-1},
-{95,265,424,844,970,994,1012,1131,-1},
-{340,510,669,1089,15,39,57,176,-1},
-{585,755,914,134,260,284,302,421,-1},
-{830,1000,1159,379,505,529,547,666,-1},
-{16,512,833,856,971,1043,-1,-1,-1},
-{261,757,1078,1101,16,88,-1,-1,-1},
-{506,1002,123,146,261,333,-1,-1,-1},
-{751,47,368,391,506,578,-1,-1,-1},
-{71,225,635,930,-1,-1,-1,-1,-1},
-{316,470,880,1175,-1,-1,-1,-1,-1},
-{561,715,1125,220,-1,-1,-1,-1,-1},
-{806,960,170,465,-1,-1,-1,-1,-1},
-{283,420,583,882,-1,-1,-1,-1,-1},
-{528,665,828,1127,-1,-1,-1,-1,-1},
-{773,910,1073,172,-1,-1,-1,-1,-1},
-{1018,1155,118,417,-1,-1,-1,-1,-1},
-{0,1,-1,-1,-1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1,-1,-1,-1},
-{199,200,-1,-1,-1,-1,-1,-1,-1},
-{200,201,-1,-1,-1,-1,-1,-1,-1},
-{201,202,-1,-1,-1,-1,-1,-1,-1},
-{202,203,-1,-1,-1,-1,-1,-1,-1},
-{203,204,-1,-1,-1,-1,-1,-1,-1},
-{204,205,-1,-1,-1,-1,-1,-1,-1},
-{205,206,-1,-1,-1,-1,-1,-1,-1},
-{206,207,-1,-1,-1,-1,-1,-1,-1},
-{207,208,-1,-1,-1,-1,-1,-1,-1},
-{208,209,-1,-1,-1,-1,-1,-1,-1},
-{209,210,-1,-1,-1,-1,-1,-1,-1},
-{210,211,-1,-1,-1,-1,-1,-1,-1},
-{211,212,-1,-1,-1,-1,-1,-1,-1},
-{212,213,-1,-1,-1,-1,-1,-1,-1},
-{213,214,-1,-1,-1,-1,-1,-1,-1},
-{214,215,-1,-1,-1,-1,-1,-1,-1},
-{215,216,-1,-1,-1,-1,-1,-1,-1},
-{216,217,-1,-1,-1,-1,-1,-1,-1},
-{217,218,-1,-1,-1,-1,-1,-1,-1},
-{218,219,-1,-1,-1,-1,-1,-1,-1},
-{219,220,-1,-1,-1,-1,-1,-1,-1},
-{220,221,-1,-1,-1,-1,-1,-1,-1},
-{221,222,-1,-1,-1,-1,-1,-1,-1},
-{222,223,-1,-1,-1,-1,-1,-1,-1},
-{223,224,-1,-1,-1,-1,-1,-1,-1},
-{224,225,-1,-1,-1,-1,-1,-1,-1},
-{225,226,-1,-1,-1,-1,-1,-1,-1},
-{226,227,-1,-1,-1,-1,-1,-1,-1},
-{227,228,-1,-1,-1,-1,-1,-1,-1},
-{228,229,-1,-1,-1,-1,-1,-1,-1},
-{229,230,-1,-1,-1,-1,-1,-1,-1},
-{230,231,-1,-1,-1,-1,-1,-1,-1},
-{231,232,-1,-1,-1,-1,-1,-1,-1},
-{232,233,-1,-1,-1,-1,-1,-1,-1},
-{233,234,-1,-1,-1,-1,-1,-1,-1},
-{234,235,-1,-1,-1,-1,-1,-1,-1},
-{235,236,-1,-1,-1,-1,-1,-1,-1},
-{236,237,-1,-1,-1,-1,-1,-1,-1},
-{237,238,-1,-1,-1,-1,-1,-1,-1},
-{238,239,-1,-1,-1,-1,-1,-1,-1},
-{239,240,-1,-1,-1,-1,-1,-1,-1},
-{240,241,-1,-1,-1,-1,-1,-1,-1},
-{241,242,-1,-1,-1,-1,-1,-1,-1},
-{242,243,-1,-1,-1,-1,-1,-1,-1},
-{243,244,-1,-1,-1,-1,-1,-1,-1},
-{244,245,-1,-1,-1,-1,-1,-1,-1},
-{245,246,-1,-1,-1,-1,-1,-1,-1},
-{246,247,-1,-1,-1,-1,-1,-1,-1},
-{247,248,-1,-1,-1,-1,-1,-1,-1},
-{248,249,-1,-1,-1,-1,-1,-1,-1},
-{249,250,-1,-1,-1,-1,-1,-1,-1},
-{250,251,-1,-1,-1,-1,-1,-1,-1},
-{251,252,-1,-1,-1,-1,-1,-1,-1},
-{252,253,-1,-1,-1,-1,-1,-1,-1},
-{253,254,-1,-1,-1,-1,-1,-1,-1},
-{254,255,-1,-1,-1,-1,-1,-1,-1},
-{255,256,-1,-1,-1,-1,-1,-1,-1},
-{256,257,-1,-1,-1,-1,-1,-1,-1},
-{257,258,-1,-1,-1,-1,-1,-1,-1},
-{258,259,-1,-1,-1,-1,-1,-1,-1},
-{259,260,-1,-1,-1,-1,-1,-1,-1},
-{260,261,-1,-1,-1,-1,-1,-1,-1},
-{261,262,-1,-1,-1,-1,-1,-1,-1},
-{262,263,-1,-1,-1,-1,-1,-1,-1},
-{263,264,-1,-1,-1,-1,-1,-1,-1},
-{264,265,-1,-1,-1,-1,-1,-1,-1},
-{265,266,-1,-1,-1,-1,-1,-1,-1},
-{266,267,-1,-1,-1,-1,-1,-1,-1},
-{267,268,-1,-1,-1,-1,-1,-1,-1},
-{268,269,-1,-1,-1,-1,-1,-1,-1},
-{269,270,-1,-1,-1,-1,-1,-1,-1},
-{270,271,-1,-1,-1,-1,-1,-1,-1},
-{271,272,-1,-1,-1,-1,-1,-1,-1},
-{272,273,-1,-1,-1,-1,-1,-1,-1},
-{273,274,-1,-1,-1,-1,-1,-1,-1},
-{274,275,-1,-1,-1,-1,-1,-1,-1},
-{275,276,-1,-1,-1,-1,-1,-1,-1},
-{276,277,-1,-1,-1,-1,-1,-1,-1},
-{277,278,-1,-1,-1,-1,-1,-1,-1},
-{278,279,-1,-1,-1,-1,-1,-1,-1},
-{279,280,-1,-1,-1,-1,-1,-1,-1},
-{280,281,-1,-1,-1,-1,-1,-1,-1},
-{281,282,-1,-1,-1,-1,-1,-1,-1},
-{282,283,-1,-1,-1,-1,-1,-1,-1},
-{283,284,-1,-1,-1,-1,-1,-1,-1},
-{284,285,-1,-1,-1,-1,-1,-1,-1},
-{285,286,-1,-1,-1,-1,-1,-1,-1},
-{286,287,-1,-1,-1,-1,-1,-1,-1},
-{287,288,-1,-1,-1,-1,-1,-1,-1},
-{288,289,-1,-1,-1,-1,-1,-1,-1},
-{289,290,-1,-1,-1,-1,-1,-1,-1},
-{290,291,-1,-1,-1,-1,-1,-1,-1},
-{291,292,-1,-1,-1,-1,-1,-1,-1},
-{292,293,-1,-1,-1,-1,-1,-1,-1},
-{293,294,-1,-1,-1,-1,-1,-1,-1},
-{294,295,-1,-1,-1,-1,-1,-1,-1},
-{295,296,-1,-1,-1,-1,-1,-1,-1},
-{296,297,-1,-1,-1,-1,-1,-1,-1},
-{297,298,-1,-1,-1,-1,-1,-1,-1},
-{298,299,-1,-1,-1,-1,-1,-1,-1},
-{299,300,-1,-1,-1,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1,-1,-1,-1},
-{301,302,-1,-1,-1,-1,-1,-1,-1},
-{302,303,-1,-1,-1,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1,-1,-1,-1},
-{304,305,-1,-1,-1,-1,-1,-1,-1},
-{305,306,-1,-1,-1,-1,-1,-1,-1},
-{306,307,-1,-1,-1,-1,-1,-1,-1},
-{307,308,-1,-1,-1,-1,-1,-1,-1},
-{308,309,-1,-1,-1,-1,-1,-1,-1},
-{309,310,-1,-1,-1,-1,-1,-1,-1},
-{310,311,-1,-1,-1,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1,-1,-1,-1},
-{312,313,-1,-1,-1,-1,-1,-1,-1},
-{313,314,-1,-1,-1,-1,-1,-1,-1},
-{314,315,-1,-1,-1,-1,-1,-1,-1},
-{315,316,-1,-1,-1,-1,-1,-1,-1},
-{316,317,-1,-1,-1,-1,-1,-1,-1},
-{317,318,-1,-1,-1,-1,-1,-1,-1},
-{318,319,-1,-1,-1,-1,-1,-1,-1},
-{319,320,-1,-1,-1,-1,-1,-1,-1},
-{320,321,-1,-1,-1,-1,-1,-1,-1},
-{321,322,-1,-1,-1,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1,-1,-1,-1},
-{323,324,-1,-1,-1,-1,-1,-1,-1},
-{324,325,-1,-1,-1,-1,-1,-1,-1},
-{325,326,-1,-1,-1,-1,-1,-1,-1},
-{326,327,-1,-1,-1,-1,-1,-1,-1},
-{327,328,-1,-1,-1,-1,-1,-1,-1},
-{328,329,-1,-1,-1,-1,-1,-1,-1},
-{329,330,-1,-1,-1,-1,-1,-1,-1},
-{330,331,-1,-1,-1,-1,-1,-1,-1},
-{331,332,-1,-1,-1,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1,-1,-1,-1},
-{333,334,-1,-1,-1,-1,-1,-1,-1},
-{334,335,-1,-1,-1,-1,-1,-1,-1},
-{335,336,-1,-1,-1,-1,-1,-1,-1},
-{336,337,-1,-1,-1,-1,-1,-1,-1},
-{337,338,-1,-1,-1,-1,-1,-1,-1},
-{338,339,-1,-1,-1,-1,-1,-1,-1},
-{339,340,-1,-1,-1,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1,-1,-1,-1},
-{341,342,-1,-1,-1,-1,-1,-1,-1},
-{342,343,-1,-1,-1,-1,-1,-1,-1},
-{343,344,-1,-1,-1,-1,-1,-1,-1},
-{344,345,-1,-1,-1,-1,-1,-1,-1},
-{345,346,-1,-1,-1,-1,-1,-1,-1},
-{346,347,-1,-1,-1,-1,-1,-1,-1},
-{347,348,-1,-1,-1,-1,-1,-1,-1},
-{348,349,-1,-1,-1,-1,-1,-1,-1},
-{349,350,-1,-1,-1,-1,-1,-1,-1},
-{350,351,-1,-1,-1,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1,-1,-1,-1},
-{352,353,-1,-1,-1,-1,-1,-1,-1},
-{353,354,-1,-1,-1,-1,-1,-1,-1},
-{354,355,-1,-1,-1,-1,-1,-1,-1},
-{355,356,-1,-1,-1,-1,-1,-1,-1},
-{356,357,-1,-1,-1,-1,-1,-1,-1},
-{357,358,-1,-1,-1,-1,-1,-1,-1},
-{358,359,-1,-1,-1,-1,-1,-1,-1},
-{359,360,-1,-1,-1,-1,-1,-1,-1},
-{360,361,-1,-1,-1,-1,-1,-1,-1},
-{361,362,-1,-1,-1,-1,-1,-1,-1},
-{362,363,-1,-1,-1,-1,-1,-1,-1},
-{363,364,-1,-1,-1,-1,-1,-1,-1},
-{364,365,-1,-1,-1,-1,-1,-1,-1},
-{365,366,-1,-1,-1,-1,-1,-1,-1},
-{366,367,-1,-1,-1,-1,-1,-1,-1},
-{367,368,-1,-1,-1,-1,-1,-1,-1},
-{368,369,-1,-1,-1,-1,-1,-1,-1},
-{369,370,-1,-1,-1,-1,-1,-1,-1},
-{370,371,-1,-1,-1,-1,-1,-1,-1},
-{371,372,-1,-1,-1,-1,-1,-1,-1},
-{372,373,-1,-1,-1,-1,-1,-1,-1},
-{373,374,-1,-1,-1,-1,-1,-1,-1},
-{374,375,-1,-1,-1,-1,-1,-1,-1},
-{375,376,-1,-1,-1,-1,-1,-1,-1},
-{376,377,-1,-1,-1,-1,-1,-1,-1},
-{377,378,-1,-1,-1,-1,-1,-1,-1},
-{378,379,-1,-1,-1,-1,-1,-1,-1},
-{379,380,-1,-1,-1,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1,-1,-1,-1},
-{381,382,-1,-1,-1,-1,-1,-1,-1},
-{382,383,-1,-1,-1,-1,-1,-1,-1},
-{383,384,-1,-1,-1,-1,-1,-1,-1},
-{384,385,-1,-1,-1,-1,-1,-1,-1},
-{385,386,-1,-1,-1,-1,-1,-1,-1},
-{386,387,-1,-1,-1,-1,-1,-1,-1},
-{387,388,-1,-1,-1,-1,-1,-1,-1},
-{388,389,-1,-1,-1,-1,-1,-1,-1},
-{389,390,-1,-1,-1,-1,-1,-1,-1},
-{390,391,-1,-1,-1,-1,-1,-1,-1},
-{391,392,-1,-1,-1,-1,-1,-1,-1},
-{392,393,-1,-1,-1,-1,-1,-1,-1},
-{393,394,-1,-1,-1,-1,-1,-1,-1},
-{394,395,-1,-1,-1,-1,-1,-1,-1},
-{395,396,-1,-1,-1,-1,-1,-1,-1},
-{396,397,-1,-1,-1,-1,-1,-1,-1},
-{397,398,-1,-1,-1,-1,-1,-1,-1},
-{398,399,-1,-1,-1,-1,-1,-1,-1},
-{399,400,-1,-1,-1,-1,-1,-1,-1},
-{400,401,-1,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1,-1},
-{402,403,-1,-1,-1,-1,-1,-1,-1},
-{403,404,-1,-1,-1,-1,-1,-1,-1},
-{404,405,-1,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1,-1},
-{406,407,-1,-1,-1,-1,-1,-1,-1},
-{407,408,-1,-1,-1,-1,-1,-1,-1},
-{408,409,-1,-1,-1,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1,-1},
-{410,411,-1,-1,-1,-1,-1,-1,-1},
-{411,412,-1,-1,-1,-1,-1,-1,-1},
-{412,413,-1,-1,-1,-1,-1,-1,-1},
-{413,414,-1,-1,-1,-1,-1,-1,-1},
-{414,415,-1,-1,-1,-1,-1,-1,-1},
-{415,416,-1,-1,-1,-1,-1,-1,-1},
-{416,417,-1,-1,-1,-1,-1,-1,-1},
-{417,418,-1,-1,-1,-1,-1,-1,-1},
-{418,419,-1,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1,-1},
-{420,421,-1,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1,-1},
-{422,423,-1,-1,-1,-1,-1,-1,-1},
-{423,424,-1,-1,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1,-1},
-{425,426,-1,-1,-1,-1,-1,-1,-1},
-{426,427,-1,-1,-1,-1,-1,-1,-1},
-{427,428,-1,-1,-1,-1,-1,-1,-1},
-{428,429,-1,-1,-1,-1,-1,-1,-1},
-{429,430,-1,-1,-1,-1,-1,-1,-1},
-{430,431,-1,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1,-1},
-{432,433,-1,-1,-1,-1,-1,-1,-1},
-{433,434,-1,-1,-1,-1,-1,-1,-1},
-{434,435,-1,-1,-1,-1,-1,-1,-1},
-{435,436,-1,-1,-1,-1,-1,-1,-1},
-{436,437,-1,-1,-1,-1,-1,-1,-1},
-{437,438,-1,-1,-1,-1,-1,-1,-1},
-{438,439,-1,-1,-1,-1,-1,-1,-1},
-{439,440,-1,-1,-1,-1,-1,-1,-1},
-{440,441,-1,-1,-1,-1,-1,-1,-1},
-{441,442,-1,-1,-1,-1,-1,-1,-1},
-{442,443,-1,-1,-1,-1,-1,-1,-1},
-{443,444,-1,-1,-1,-1,-1,-1,-1},
-{444,445,-1,-1,-1,-1,-1,-1,-1},
-{445,446,-1,-1,-1,-1,-1,-1,-1},
-{446,447,-1,-1,-1,-1,-1,-1,-1},
-{447,448,-1,-1,-1,-1,-1,-1,-1},
-{448,449,-1,-1,-1,-1,-1,-1,-1},
-{449,450,-1,-1,-1,-1,-1,-1,-1},
-{450,451,-1,-1,-1,-1,-1,-1,-1},
-{451,452,-1,-1,-1,-1,-1,-1,-1},
-{452,453,-1,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1,-1},
-{454,455,-1,-1,-1,-1,-1,-1,-1},
-{455,456,-1,-1,-1,-1,-1,-1,-1},
-{456,457,-1,-1,-1,-1,-1,-1,-1},
-{457,458,-1,-1,-1,-1,-1,-1,-1},
-{458,459,-1,-1,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1,-1},
-{460,461,-1,-1,-1,-1,-1,-1,-1},
-{461,462,-1,-1,-1,-1,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1,-1},
-{463,464,-1,-1,-1,-1,-1,-1,-1},
-{464,465,-1,-1,-1,-1,-1,-1,-1},
-{465,466,-1,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1,-1},
-{467,468,-1,-1,-1,-1,-1,-1,-1},
-{468,469,-1,-1,-1,-1,-1,-1,-1},
-{469,470,-1,-1,-1,-1,-1,-1,-1},
-{470,471,-1,-1,-1,-1,-1,-1,-1},
-{471,472,-1,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1,-1},
-{473,474,-1,-1,-1,-1,-1,-1,-1},
-{474,475,-1,-1,-1,-1,-1,-1,-1},
-{475,476,-1,-1,-1,-1,-1,-1,-1},
-{476,477,-1,-1,-1,-1,-1,-1,-1},
-{477,478,-1,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1,-1},
-{480,481,-1,-1,-1,-1,-1,-1,-1},
-{481,482,-1,-1,-1,-1,-1,-1,-1},
-{482,483,-1,-1,-1,-1,-1,-1,-1},
-{483,484,-1,-1,-1,-1,-1,-1,-1},
-{484,485,-1,-1,-1,-1,-1,-1,-1},
-{485,486,-1,-1,-1,-1,-1,-1,-1},
-{486,487,-1,-1,-1,-1,-1,-1,-1},
-{487,488,-1,-1,-1,-1,-1,-1,-1},
-{488,489,-1,-1,-1,-1,-1,-1,-1},
-{489,490,-1,-1,-1,-1,-1,-1,-1},
-{490,491,-1,-1,-1,-1,-1,-1,-1},
-{491,492,-1,-1,-1,-1,-1,-1,-1},
-{492,493,-1,-1,-1,-1,-1,-1,-1},
-{493,494,-1,-1,-1,-1,-1,-1,-1},
-{494,495,-1,-1,-1,-1,-1,-1,-1},
-{495,496,-1,-1,-1,-1,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1,-1},
-{497,498,-1,-1,-1,-1,-1,-1,-1},
-{498,499,-1,-1,-1,-1,-1,-1,-1},
-{499,500,-1,-1,-1,-1,-1,-1,-1},
-{500,501,-1,-1,-1,-1,-1,-1,-1},
-{501,502,-1,-1,-1,-1,-1,-1,-1},
-{502,503,-1,-1,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1,-1},
-{504,505,-1,-1,-1,-1,-1,-1,-1},
-{505,506,-1,-1,-1,-1,-1,-1,-1},
-{506,507,-1,-1,-1,-1,-1,-1,-1},
-{507,508,-1,-1,-1,-1,-1,-1,-1},
-{508,509,-1,-1,-1,-1,-1,-1,-1},
-{509,510,-1,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1,-1},
-{512,513,-1,-1,-1,-1,-1,-1,-1},
-{513,514,-1,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1,-1},
-{515,516,-1,-1,-1,-1,-1,-1,-1},
-{516,517,-1,-1,-1,-1,-1,-1,-1},
-{517,518,-1,-1,-1,-1,-1,-1,-1},
-{518,519,-1,-1,-1,-1,-1,-1,-1},
-{519,520,-1,-1,-1,-1,-1,-1,-1},
-{520,521,-1,-1,-1,-1,-1,-1,-1},
-{521,522,-1,-1,-1,-1,-1,-1,-1},
-{522,523,-1,-1,-1,-1,-1,-1,-1},
-{523,524,-1,-1,-1,-1,-1,-1,-1},
-{524,525,-1,-1,-1,-1,-1,-1,-1},
-{525,526,-1,-1,-1,-1,-1,-1,-1},
-{526,527,-1,-1,-1,-1,-1,-1,-1},
-{527,528,-1,-1,-1,-1,-1,-1,-1},
-{528,529,-1,-1,-1,-1,-1,-1,-1},
-{529,530,-1,-1,-1,-1,-1,-1,-1},
-{530,531,-1,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1,-1},
-{532,533,-1,-1,-1,-1,-1,-1,-1},
-{533,534,-1,-1,-1,-1,-1,-1,-1},
-{534,535,-1,-1,-1,-1,-1,-1,-1},
-{535,536,-1,-1,-1,-1,-1,-1,-1},
-{536,537,-1,-1,-1,-1,-1,-1,-1},
-{537,538,-1,-1,-1,-1,-1,-1,-1},
-{538,539,-1,-1,-1,-1,-1,-1,-1},
-{539,540,-1,-1,-1,-1,-1,-1,-1},
-{540,541,-1,-1,-1,-1,-1,-1,-1},
-{541,542,-1,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1,-1},
-{543,544,-1,-1,-1,-1,-1,-1,-1},
-{544,545,-1,-1,-1,-1,-1,-1,-1},
-{545,546,-1,-1,-1,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1,-1},
-{547,548,-1,-1,-1,-1,-1,-1,-1},
-{548,549,-1,-1,-1,-1,-1,-1,-1},
-{549,550,-1,-1,-1,-1,-1,-1,-1},
-{550,551,-1,-1,-1,-1,-1,-1,-1},
-{551,552,-1,-1,-1,-1,-1,-1,-1},
-{552,553,-1,-1,-1,-1,-1,-1,-1},
-{553,554,-1,-1,-1,-1,-1,-1,-1},
-{554,555,-1,-1,-1,-1,-1,-1,-1},
-{555,556,-1,-1,-1,-1,-1,-1,-1},
-{556,557,-1,-1,-1,-1,-1,-1,-1},
-{557,558,-1,-1,-1,-1,-1,-1,-1},
-{558,559,-1,-1,-1,-1,-1,-1,-1},
-{559,560,-1,-1,-1,-1,-1,-1,-1},
-{560,561,-1,-1,-1,-1,-1,-1,-1},
-{561,562,-1,-1,-1,-1,-1,-1,-1},
-{562,563,-1,-1,-1,-1,-1,-1,-1},
-{563,564,-1,-1,-1,-1,-1,-1,-1},
-{564,565,-1,-1,-1,-1,-1,-1,-1},
-{565,566,-1,-1,-1,-1,-1,-1,-1},
-{566,567,-1,-1,-1,-1,-1,-1,-1},
-{567,568,-1,-1,-1,-1,-1,-1,-1},
-{568,569,-1,-1,-1,-1,-1,-1,-1},
-{569,570,-1,-1,-1,-1,-1,-1,-1},
-{570,571,-1,-1,-1,-1,-1,-1,-1},
-{571,572,-1,-1,-1,-1,-1,-1,-1},
-{572,573,-1,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1,-1},
-{574,575,-1,-1,-1,-1,-1,-1,-1},
-{575,576,-1,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1,-1},
-{578,579,-1,-1,-1,-1,-1,-1,-1},
-{579,580,-1,-1,-1,-1,-1,-1,-1},
-{580,581,-1,-1,-1,-1,-1,-1,-1},
-{581,582,-1,-1,-1,-1,-1,-1,-1},
-{582,583,-1,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1,-1},
-{584,585,-1,-1,-1,-1,-1,-1,-1},
-{585,586,-1,-1,-1,-1,-1,-1,-1},
-{586,587,-1,-1,-1,-1,-1,-1,-1},
-{587,588,-1,-1,-1,-1,-1,-1,-1},
-{588,589,-1,-1,-1,-1,-1,-1,-1},
-{589,590,-1,-1,-1,-1,-1,-1,-1},
-{590,591,-1,-1,-1,-1,-1,-1,-1},
-{591,592,-1,-1,-1,-1,-1,-1,-1},
-{592,593,-1,-1,-1,-1,-1,-1,-1},
-{593,594,-1,-1,-1,-1,-1,-1,-1},
-{594,595,-1,-1,-1,-1,-1,-1,-1},
-{595,596,-1,-1,-1,-1,-1,-1,-1},
-{596,597,-1,-1,-1,-1,-1,-1,-1},
-{597,598,-1,-1,-1,-1,-1,-1,-1},
-{598,599,-1,-1,-1,-1,-1,-1,-1},
-{599,600,-1,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1,-1},
-{601,602,-1,-1,-1,-1,-1,-1,-1},
-{602,603,-1,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1,-1},
-{605,606,-1,-1,-1,-1,-1,-1,-1},
-{606,607,-1,-1,-1,-1,-1,-1,-1},
-{607,608,-1,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1,-1},
-{609,610,-1,-1,-1,-1,-1,-1,-1},
-{610,611,-1,-1,-1,-1,-1,-1,-1},
-{611,612,-1,-1,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1,-1},
-{613,614,-1,-1,-1,-1,-1,-1,-1},
-{614,615,-1,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1,-1},
-{617,618,-1,-1,-1,-1,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1,-1},
-{619,620,-1,-1,-1,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1,-1},
-{621,622,-1,-1,-1,-1,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1,-1},
-{623,624,-1,-1,-1,-1,-1,-1,-1},
-{624,625,-1,-1,-1,-1,-1,-1,-1},
-{625,626,-1,-1,-1,-1,-1,-1,-1},
-{626,627,-1,-1,-1,-1,-1,-1,-1},
-{627,628,-1,-1,-1,-1,-1,-1,-1},
-{628,629,-1,-1,-1,-1,-1,-1,-1},
-{629,630,-1,-1,-1,-1,-1,-1,-1},
-{630,631,-1,-1,-1,-1,-1,-1,-1},
-{631,632,-1,-1,-1,-1,-1,-1,-1},
-{632,633,-1,-1,-1,-1,-1,-1,-1},
-{633,634,-1,-1,-1,-1,-1,-1,-1},
-{634,635,-1,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1,-1},
-{636,637,-1,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1,-1},
-{638,639,-1,-1,-1,-1,-1,-1,-1},
-{639,640,-1,-1,-1,-1,-1,-1,-1},
-{640,641,-1,-1,-1,-1,-1,-1,-1},
-{641,642,-1,-1,-1,-1,-1,-1,-1},
-{642,643,-1,-1,-1,-1,-1,-1,-1},
-{643,644,-1,-1,-1,-1,-1,-1,-1},
-{644,645,-1,-1,-1,-1,-1,-1,-1},
-{645,646,-1,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1,-1},
-{647,648,-1,-1,-1,-1,-1,-1,-1},
-{648,649,-1,-1,-1,-1,-1,-1,-1},
-{649,650,-1,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1,-1},
-{651,652,-1,-1,-1,-1,-1,-1,-1},
-{652,653,-1,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1,-1},
-{655,656,-1,-1,-1,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1,-1},
-{657,658,-1,-1,-1,-1,-1,-1,-1},
-{658,659,-1,-1,-1,-1,-1,-1,-1},
-{659,660,-1,-1,-1,-1,-1,-1,-1},
-{660,661,-1,-1,-1,-1,-1,-1,-1},
-{661,662,-1,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1,-1},
-{663,664,-1,-1,-1,-1,-1,-1,-1},
-{664,665,-1,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1,-1},
-{667,668,-1,-1,-1,-1,-1,-1,-1},
-{668,669,-1,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1,-1},
-{670,671,-1,-1,-1,-1,-1,-1,-1},
-{671,672,-1,-1,-1,-1,-1,-1,-1},
-{672,673,-1,-1,-1,-1,-1,-1,-1},
-{673,674,-1,-1,-1,-1,-1,-1,-1},
-{674,675,-1,-1,-1,-1,-1,-1,-1},
-{675,676,-1,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1,-1},
-{677,678,-1,-1,-1,-1,-1,-1,-1},
-{678,679,-1,-1,-1,-1,-1,-1,-1},
-{679,680,-1,-1,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1,-1},
-{681,682,-1,-1,-1,-1,-1,-1,-1},
-{682,683,-1,-1,-1,-1,-1,-1,-1},
-{683,684,-1,-1,-1,-1,-1,-1,-1},
-{684,685,-1,-1,-1,-1,-1,-1,-1},
-{685,686,-1,-1,-1,-1,-1,-1,-1},
-{686,687,-1,-1,-1,-1,-1,-1,-1},
-{687,688,-1,-1,-1,-1,-1,-1,-1},
-{688,689,-1,-1,-1,-1,-1,-1,-1},
-{689,690,-1,-1,-1,-1,-1,-1,-1},
-{690,691,-1,-1,-1,-1,-1,-1,-1},
-{691,692,-1,-1,-1,-1,-1,-1,-1},
-{692,693,-1,-1,-1,-1,-1,-1,-1},
-{693,694,-1,-1,-1,-1,-1,-1,-1},
-{694,695,-1,-1,-1,-1,-1,-1,-1},
-{695,696,-1,-1,-1,-1,-1,-1,-1},
-{696,697,-1,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1,-1},
-{699,700,-1,-1,-1,-1,-1,-1,-1},
-{700,701,-1,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1,-1},
-{702,703,-1,-1,-1,-1,-1,-1,-1},
-{703,704,-1,-1,-1,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1,-1},
-{705,706,-1,-1,-1,-1,-1,-1,-1},
-{706,707,-1,-1,-1,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1,-1},
-{708,709,-1,-1,-1,-1,-1,-1,-1},
-{709,710,-1,-1,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1,-1},
-{711,712,-1,-1,-1,-1,-1,-1,-1},
-{712,713,-1,-1,-1,-1,-1,-1,-1},
-{713,714,-1,-1,-1,-1,-1,-1,-1},
-{714,715,-1,-1,-1,-1,-1,-1,-1},
-{715,716,-1,-1,-1,-1,-1,-1,-1},
-{716,717,-1,-1,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1,-1},
-{718,719,-1,-1,-1,-1,-1,-1,-1},
-{719,720,-1,-1,-1,-1,-1,-1,-1},
-{720,721,-1,-1,-1,-1,-1,-1,-1},
-{721,722,-1,-1,-1,-1,-1,-1,-1},
-{722,723,-1,-1,-1,-1,-1,-1,-1},
-{723,724,-1,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1,-1},
-{725,726,-1,-1,-1,-1,-1,-1,-1},
-{726,727,-1,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1,-1},
-{730,731,-1,-1,-1,-1,-1,-1,-1},
-{731,732,-1,-1,-1,-1,-1,-1,-1},
-{732,733,-1,-1,-1,-1,-1,-1,-1},
-{733,734,-1,-1,-1,-1,-1,-1,-1},
-{734,735,-1,-1,-1,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1,-1},
-{736,737,-1,-1,-1,-1,-1,-1,-1},
-{737,738,-1,-1,-1,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1,-1},
-{739,740,-1,-1,-1,-1,-1,-1,-1},
-{740,741,-1,-1,-1,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1,-1},
-{742,743,-1,-1,-1,-1,-1,-1,-1},
-{743,744,-1,-1,-1,-1,-1,-1,-1},
-{744,745,-1,-1,-1,-1,-1,-1,-1},
-{745,746,-1,-1,-1,-1,-1,-1,-1},
-{746,747,-1,-1,-1,-1,-1,-1,-1},
-{747,748,-1,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1,-1},
-{749,750,-1,-1,-1,-1,-1,-1,-1},
-{750,751,-1,-1,-1,-1,-1,-1,-1},
-{751,752,-1,-1,-1,-1,-1,-1,-1},
-{752,753,-1,-1,-1,-1,-1,-1,-1},
-{753,754,-1,-1,-1,-1,-1,-1,-1},
-{754,755,-1,-1,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1,-1},
-{756,757,-1,-1,-1,-1,-1,-1,-1},
-{757,758,-1,-1,-1,-1,-1,-1,-1},
-{758,759,-1,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1},
-{760,761,-1,-1,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1,-1},
-{762,763,-1,-1,-1,-1,-1,-1,-1},
-{763,764,-1,-1,-1,-1,-1,-1,-1},
-{764,765,-1,-1,-1,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1,-1},
-{766,767,-1,-1,-1,-1,-1,-1,-1},
-{767,768,-1,-1,-1,-1,-1,-1,-1},
-{768,769,-1,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1,-1},
-{770,771,-1,-1,-1,-1,-1,-1,-1},
-{771,772,-1,-1,-1,-1,-1,-1,-1},
-{772,773,-1,-1,-1,-1,-1,-1,-1},
-{773,774,-1,-1,-1,-1,-1,-1,-1},
-{774,775,-1,-1,-1,-1,-1,-1,-1},
-{775,776,-1,-1,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1,-1},
-{777,778,-1,-1,-1,-1,-1,-1,-1},
-{778,779,-1,-1,-1,-1,-1,-1,-1},
-{779,780,-1,-1,-1,-1,-1,-1,-1},
-{780,781,-1,-1,-1,-1,-1,-1,-1},
-{781,782,-1,-1,-1,-1,-1,-1,-1},
-{782,783,-1,-1,-1,-1,-1,-1,-1},
-{783,784,-1,-1,-1,-1,-1,-1,-1},
-{784,785,-1,-1,-1,-1,-1,-1,-1},
-{785,786,-1,-1,-1,-1,-1,-1,-1},
-{786,787,-1,-1,-1,-1,-1,-1,-1},
-{787,788,-1,-1,-1,-1,-1,-1,-1},
-{788,789,-1,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1},
-{792,793,-1,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1},
-{794,795,-1,-1,-1,-1,-1,-1,-1},
-{795,796,-1,-1,-1,-1,-1,-1,-1},
-{796,797,-1,-1,-1,-1,-1,-1,-1},
-{797,798,-1,-1,-1,-1,-1,-1,-1},
-{798,799,-1,-1,-1,-1,-1,-1,-1},
-{799,800,-1,-1,-1,-1,-1,-1,-1},
-{800,801,-1,-1,-1,-1,-1,-1,-1},
-{801,802,-1,-1,-1,-1,-1,-1,-1},
-{802,803,-1,-1,-1,-1,-1,-1,-1},
-{803,804,-1,-1,-1,-1,-1,-1,-1},
-{804,805,-1,-1,-1,-1,-1,-1,-1},
-{805,806,-1,-1,-1,-1,-1,-1,-1},
-{806,807,-1,-1,-1,-1,-1,-1,-1},
-{807,808,-1,-1,-1,-1,-1,-1,-1},
-{808,809,-1,-1,-1,-1,-1,-1,-1},
-{809,810,-1,-1,-1,-1,-1,-1,-1},
-{810,811,-1,-1,-1,-1,-1,-1,-1},
-{811,812,-1,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1},
-{813,814,-1,-1,-1,-1,-1,-1,-1},
-{814,815,-1,-1,-1,-1,-1,-1,-1},
-{815,816,-1,-1,-1,-1,-1,-1,-1},
-{816,817,-1,-1,-1,-1,-1,-1,-1},
-{817,818,-1,-1,-1,-1,-1,-1,-1},
-{818,819,-1,-1,-1,-1,-1,-1,-1},
-{819,820,-1,-1,-1,-1,-1,-1,-1},
-{820,821,-1,-1,-1,-1,-1,-1,-1},
-{821,822,-1,-1,-1,-1,-1,-1,-1},
-{822,823,-1,-1,-1,-1,-1,-1,-1},
-{823,824,-1,-1,-1,-1,-1,-1,-1},
-{824,825,-1,-1,-1,-1,-1,-1,-1},
-{825,826,-1,-1,-1,-1,-1,-1,-1},
-{826,827,-1,-1,-1,-1,-1,-1,-1},
-{827,828,-1,-1,-1,-1,-1,-1,-1},
-{828,829,-1,-1,-1,-1,-1,-1,-1},
-{829,830,-1,-1,-1,-1,-1,-1,-1},
-{830,831,-1,-1,-1,-1,-1,-1,-1},
-{831,832,-1,-1,-1,-1,-1,-1,-1},
-{832,833,-1,-1,-1,-1,-1,-1,-1},
-{833,834,-1,-1,-1,-1,-1,-1,-1},
-{834,835,-1,-1,-1,-1,-1,-1,-1},
-{835,836,-1,-1,-1,-1,-1,-1,-1},
-{836,837,-1,-1,-1,-1,-1,-1,-1},
-{837,838,-1,-1,-1,-1,-1,-1,-1},
-{838,839,-1,-1,-1,-1,-1,-1,-1},
-{839,840,-1,-1,-1,-1,-1,-1,-1},
-{840,841,-1,-1,-1,-1,-1,-1,-1},
-{841,842,-1,-1,-1,-1,-1,-1,-1},
-{842,843,-1,-1,-1,-1,-1,-1,-1},
-{843,844,-1,-1,-1,-1,-1,-1,-1},
-{844,845,-1,-1,-1,-1,-1,-1,-1},
-{845,846,-1,-1,-1,-1,-1,-1,-1},
-{846,847,-1,-1,-1,-1,-1,-1,-1},
-{847,848,-1,-1,-1,-1,-1,-1,-1},
-{848,849,-1,-1,-1,-1,-1,-1,-1},
-{849,850,-1,-1,-1,-1,-1,-1,-1},
-{850,851,-1,-1,-1,-1,-1,-1,-1},
-{851,852,-1,-1,-1,-1,-1,-1,-1},
-{852,853,-1,-1,-1,-1,-1,-1,-1},
-{853,854,-1,-1,-1,-1,-1,-1,-1},
-{854,855,-1,-1,-1,-1,-1,-1,-1},
-{855,856,-1,-1,-1,-1,-1,-1,-1},
-{856,857,-1,-1,-1,-1,-1,-1,-1},
-{857,858,-1,-1,-1,-1,-1,-1,-1},
-{858,859,-1,-1,-1,-1,-1,-1,-1},
-{859,860,-1,-1,-1,-1,-1,-1,-1},
-{860,861,-1,-1,-1,-1,-1,-1,-1},
-{861,862,-1,-1,-1,-1,-1,-1,-1},
-{862,863,-1,-1,-1,-1,-1,-1,-1},
-{863,864,-1,-1,-1,-1,-1,-1,-1},
-{864,865,-1,-1,-1,-1,-1,-1,-1},
-{865,866,-1,-1,-1,-1,-1,-1,-1},
-{866,867,-1,-1,-1,-1,-1,-1,-1},
-{867,868,-1,-1,-1,-1,-1,-1,-1},
-{868,869,-1,-1,-1,-1,-1,-1,-1},
-{869,870,-1,-1,-1,-1,-1,-1,-1},
-{870,871,-1,-1,-1,-1,-1,-1,-1},
-{871,872,-1,-1,-1,-1,-1,-1,-1},
-{872,873,-1,-1,-1,-1,-1,-1,-1},
-{873,874,-1,-1,-1,-1,-1,-1,-1},
-{874,875,-1,-1,-1,-1,-1,-1,-1},
-{875,876,-1,-1,-1,-1,-1,-1,-1},
-{876,877,-1,-1,-1,-1,-1,-1,-1},
-{877,878,-1,-1,-1,-1,-1,-1,-1},
-{878,879,-1,-1,-1,-1,-1,-1,-1},
-{879,880,-1,-1,-1,-1,-1,-1,-1},
-{880,881,-1,-1,-1,-1,-1,-1,-1},
-{881,882,-1,-1,-1,-1,-1,-1,-1},
-{882,883,-1,-1,-1,-1,-1,-1,-1},
-{883,884,-1,-1,-1,-1,-1,-1,-1},
-{884,885,-1,-1,-1,-1,-1,-1,-1},
-{885,886,-1,-1,-1,-1,-1,-1,-1},
-{886,887,-1,-1,-1,-1,-1,-1,-1},
-{887,888,-1,-1,-1,-1,-1,-1,-1},
-{888,889,-1,-1,-1,-1,-1,-1,-1},
-{889,890,-1,-1,-1,-1,-1,-1,-1},
-{890,891,-1,-1,-1,-1,-1,-1,-1},
-{891,892,-1,-1,-1,-1,-1,-1,-1},
-{892,893,-1,-1,-1,-1,-1,-1,-1},
-{893,894,-1,-1,-1,-1,-1,-1,-1},
-{894,895,-1,-1,-1,-1,-1,-1,-1},
-{895,896,-1,-1,-1,-1,-1,-1,-1},
-{896,897,-1,-1,-1,-1,-1,-1,-1},
-{897,898,-1,-1,-1,-1,-1,-1,-1},
-{898,899,-1,-1,-1,-1,-1,-1,-1},
-{899,900,-1,-1,-1,-1,-1,-1,-1},
-{900,901,-1,-1,-1,-1,-1,-1,-1},
-{901,902,-1,-1,-1,-1,-1,-1,-1},
-{902,903,-1,-1,-1,-1,-1,-1,-1},
-{903,904,-1,-1,-1,-1,-1,-1,-1},
-{904,905,-1,-1,-1,-1,-1,-1,-1},
-{905,906,-1,-1,-1,-1,-1,-1,-1},
-{906,907,-1,-1,-1,-1,-1,-1,-1},
-{907,908,-1,-1,-1,-1,-1,-1,-1},
-{908,909,-1,-1,-1,-1,-1,-1,-1},
-{909,910,-1,-1,-1,-1,-1,-1,-1},
-{910,911,-1,-1,-1,-1,-1,-1,-1},
-{911,912,-1,-1,-1,-1,-1,-1,-1},
-{912,913,-1,-1,-1,-1,-1,-1,-1},
-{913,914,-1,-1,-1,-1,-1,-1,-1},
-{914,915,-1,-1,-1,-1,-1,-1,-1},
-{915,916,-1,-1,-1,-1,-1,-1,-1},
-{916,917,-1,-1,-1,-1,-1,-1,-1},
-{917,918,-1,-1,-1,-1,-1,-1,-1},
-{918,919,-1,-1,-1,-1,-1,-1,-1},
-{919,920,-1,-1,-1,-1,-1,-1,-1},
-{920,921,-1,-1,-1,-1,-1,-1,-1},
-{921,922,-1,-1,-1,-1,-1,-1,-1},
-{922,923,-1,-1,-1,-1,-1,-1,-1},
-{923,924,-1,-1,-1,-1,-1,-1,-1},
-{924,925,-1,-1,-1,-1,-1,-1,-1},
-{925,926,-1,-1,-1,-1,-1,-1,-1},
-{926,927,-1,-1,-1,-1,-1,-1,-1},
-{927,928,-1,-1,-1,-1,-1,-1,-1},
-{928,929,-1,-1,-1,-1,-1,-1,-1},
-{929,930,-1,-1,-1,-1,-1,-1,-1},
-{930,931,-1,-1,-1,-1,-1,-1,-1},
-{931,932,-1,-1,-1,-1,-1,-1,-1},
-{932,933,-1,-1,-1,-1,-1,-1,-1},
-{933,934,-1,-1,-1,-1,-1,-1,-1},
-{934,935,-1,-1,-1,-1,-1,-1,-1},
-{935,936,-1,-1,-1,-1,-1,-1,-1},
-{936,937,-1,-1,-1,-1,-1,-1,-1},
-{937,938,-1,-1,-1,-1,-1,-1,-1},
-{938,939,-1,-1,-1,-1,-1,-1,-1},
-{939,940,-1,-1,-1,-1,-1,-1,-1},
-{940,941,-1,-1,-1,-1,-1,-1,-1},
-{941,942,-1,-1,-1,-1,-1,-1,-1},
-{942,943,-1,-1,-1,-1,-1,-1,-1},
-{943,944,-1,-1,-1,-1,-1,-1,-1},
-{944,945,-1,-1,-1,-1,-1,-1,-1},
-{945,946,-1,-1,-1,-1,-1,-1,-1},
-{946,947,-1,-1,-1,-1,-1,-1,-1},
-{947,948,-1,-1,-1,-1,-1,-1,-1},
-{948,949,-1,-1,-1,-1,-1,-1,-1},
-{949,950,-1,-1,-1,-1,-1,-1,-1},
-{950,951,-1,-1,-1,-1,-1,-1,-1},
-{951,952,-1,-1,-1,-1,-1,-1,-1},
-{952,953,-1,-1,-1,-1,-1,-1,-1},
-{953,954,-1,-1,-1,-1,-1,-1,-1},
-{954,955,-1,-1,-1,-1,-1,-1,-1},
-{955,956,-1,-1,-1,-1,-1,-1,-1},
-{956,957,-1,-1,-1,-1,-1,-1,-1},
-{957,958,-1,-1,-1,-1,-1,-1,-1},
-{958,959,-1,-1,-1,-1,-1,-1,-1},
-{959,960,-1,-1,-1,-1,-1,-1,-1},
-{960,961,-1,-1,-1,-1,-1,-1,-1},
-{961,962,-1,-1,-1,-1,-1,-1,-1},
-{962,963,-1,-1,-1,-1,-1,-1,-1},
-{963,964,-1,-1,-1,-1,-1,-1,-1},
-{964,965,-1,-1,-1,-1,-1,-1,-1},
-{965,966,-1,-1,-1,-1,-1,-1,-1},
-{966,967,-1,-1,-1,-1,-1,-1,-1},
-{967,968,-1,-1,-1,-1,-1,-1,-1},
-{968,969,-1,-1,-1,-1,-1,-1,-1},
-{969,970,-1,-1,-1,-1,-1,-1,-1},
-{970,971,-1,-1,-1,-1,-1,-1,-1},
-{971,972,-1,-1,-1,-1,-1,-1,-1},
-{972,973,-1,-1,-1,-1,-1,-1,-1},
-{973,974,-1,-1,-1,-1,-1,-1,-1},
-{974,975,-1,-1,-1,-1,-1,-1,-1},
-{975,976,-1,-1,-1,-1,-1,-1,-1},
-{976,977,-1,-1,-1,-1,-1,-1,-1},
-{977,978,-1,-1,-1,-1,-1,-1,-1},
-{978,979,-1,-1,-1,-1,-1,-1,-1},
-{979,980,-1,-1,-1,-1,-1,-1,-1},
-{980,981,-1,-1,-1,-1,-1,-1,-1},
-{981,982,-1,-1,-1,-1,-1,-1,-1},
-{982,983,-1,-1,-1,-1,-1,-1,-1},
-{983,984,-1,-1,-1,-1,-1,-1,-1},
-{984,985,-1,-1,-1,-1,-1,-1,-1},
-{985,986,-1,-1,-1,-1,-1,-1,-1},
-{986,987,-1,-1,-1,-1,-1,-1,-1},
-{987,988,-1,-1,-1,-1,-1,-1,-1},
-{988,989,-1,-1,-1,-1,-1,-1,-1},
-{989,990,-1,-1,-1,-1,-1,-1,-1},
-{990,991,-1,-1,-1,-1,-1,-1,-1},
-{991,992,-1,-1,-1,-1,-1,-1,-1},
-{992,993,-1,-1,-1,-1,-1,-1,-1},
-{993,994,-1,-1,-1,-1,-1,-1,-1},
-{994,995,-1,-1,-1,-1,-1,-1,-1},
-{995,996,-1,-1,-1,-1,-1,-1,-1},
-{996,997,-1,-1,-1,-1,-1,-1,-1},
-{997,998,-1,-1,-1,-1,-1,-1,-1},
-{998,999,-1,-1,-1,-1,-1,-1,-1},
-{999,1000,-1,-1,-1,-1,-1,-1,-1},
-{1000,1001,-1,-1,-1,-1,-1,-1,-1},
-{1001,1002,-1,-1,-1,-1,-1,-1,-1},
-{1002,1003,-1,-1,-1,-1,-1,-1,-1},
-{1003,1004,-1,-1,-1,-1,-1,-1,-1},
-{1004,1005,-1,-1,-1,-1,-1,-1,-1},
-{1005,1006,-1,-1,-1,-1,-1,-1,-1},
-{1006,1007,-1,-1,-1,-1,-1,-1,-1},
-{1007,1008,-1,-1,-1,-1,-1,-1,-1},
-{1008,1009,-1,-1,-1,-1,-1,-1,-1},
-{1009,1010,-1,-1,-1,-1,-1,-1,-1},
-{1010,1011,-1,-1,-1,-1,-1,-1,-1},
-{1011,1012,-1,-1,-1,-1,-1,-1,-1},
-{1012,1013,-1,-1,-1,-1,-1,-1,-1},
-{1013,1014,-1,-1,-1,-1,-1,-1,-1},
-{1014,1015,-1,-1,-1,-1,-1,-1,-1},
-{1015,1016,-1,-1,-1,-1,-1,-1,-1},
-{1016,1017,-1,-1,-1,-1,-1,-1,-1},
-{1017,1018,-1,-1,-1,-1,-1,-1,-1},
-{1018,1019,-1,-1,-1,-1,-1,-1,-1},
-{1019,1020,-1,-1,-1,-1,-1,-1,-1},
-{1020,1021,-1,-1,-1,-1,-1,-1,-1},
-{1021,1022,-1,-1,-1,-1,-1,-1,-1},
-{1022,1023,-1,-1,-1,-1,-1,-1,-1},
-{1023,1024,-1,-1,-1,-1,-1,-1,-1},
-{1024,1025,-1,-1,-1,-1,-1,-1,-1},
-{1025,1026,-1,-1,-1,-1,-1,-1,-1},
-{1026,1027,-1,-1,-1,-1,-1,-1,-1},
-{1027,1028,-1,-1,-1,-1,-1,-1,-1},
-{1028,1029,-1,-1,-1,-1,-1,-1,-1},
-{1029,1030,-1,-1,-1,-1,-1,-1,-1},
-{1030,1031,-1,-1,-1,-1,-1,-1,-1},
-{1031,1032,-1,-1,-1,-1,-1,-1,-1},
-{1032,1033,-1,-1,-1,-1,-1,-1,-1},
-{1033,1034,-1,-1,-1,-1,-1,-1,-1},
-{1034,1035,-1,-1,-1,-1,-1,-1,-1},
-{1035,1036,-1,-1,-1,-1,-1,-1,-1},
-{1036,1037,-1,-1,-1,-1,-1,-1,-1},
-{1037,1038,-1,-1,-1,-1,-1,-1,-1},
-{1038,1039,-1,-1,-1,-1,-1,-1,-1},
-{1039,1040,-1,-1,-1,-1,-1,-1,-1},
-{1040,1041,-1,-1,-1,-1,-1,-1,-1},
-{1041,1042,-1,-1,-1,-1,-1,-1,-1},
-{1042,1043,-1,-1,-1,-1,-1,-1,-1},
-{1043,1044,-1,-1,-1,-1,-1,-1,-1},
-{1044,1045,-1,-1,-1,-1,-1,-1,-1},
-{1045,1046,-1,-1,-1,-1,-1,-1,-1},
-{1046,1047,-1,-1,-1,-1,-1,-1,-1},
-{1047,1048,-1,-1,-1,-1,-1,-1,-1},
-{1048,1049,-1,-1,-1,-1,-1,-1,-1},
-{1049,1050,-1,-1,-1,-1,-1,-1,-1},
-{1050,1051,-1,-1,-1,-1,-1,-1,-1},
-{1051,1052,-1,-1,-1,-1,-1,-1,-1},
-{1052,1053,-1,-1,-1,-1,-1,-1,-1},
-{1053,1054,-1,-1,-1,-1,-1,-1,-1},
-{1054,1055,-1,-1,-1,-1,-1,-1,-1},
-{1055,1056,-1,-1,-1,-1,-1,-1,-1},
-{1056,1057,-1,-1,-1,-1,-1,-1,-1},
-{1057,1058,-1,-1,-1,-1,-1,-1,-1},
-{1058,1059,-1,-1,-1,-1,-1,-1,-1},
-{1059,1060,-1,-1,-1,-1,-1,-1,-1},
-{1060,1061,-1,-1,-1,-1,-1,-1,-1},
-{1061,1062,-1,-1,-1,-1,-1,-1,-1},
-{1062,1063,-1,-1,-1,-1,-1,-1,-1},
-{1063,1064,-1,-1,-1,-1,-1,-1,-1},
-{1064,1065,-1,-1,-1,-1,-1,-1,-1},
-{1065,1066,-1,-1,-1,-1,-1,-1,-1},
-{1066,1067,-1,-1,-1,-1,-1,-1,-1},
-{1067,1068,-1,-1,-1,-1,-1,-1,-1},
-{1068,1069,-1,-1,-1,-1,-1,-1,-1},
-{1069,1070,-1,-1,-1,-1,-1,-1,-1},
-{1070,1071,-1,-1,-1,-1,-1,-1,-1},
-{1071,1072,-1,-1,-1,-1,-1,-1,-1},
-{1072,1073,-1,-1,-1,-1,-1,-1,-1},
-{1073,1074,-1,-1,-1,-1,-1,-1,-1},
-{1074,1075,-1,-1,-1,-1,-1,-1,-1},
-{1075,1076,-1,-1,-1,-1,-1,-1,-1},
-{1076,1077,-1,-1,-1,-1,-1,-1,-1},
-{1077,1078,-1,-1,-1,-1,-1,-1,-1},
-{1078,1079,-1,-1,-1,-1,-1,-1,-1},
-{1079,1080,-1,-1,-1,-1,-1,-1,-1},
-{1080,1081,-1,-1,-1,-1,-1,-1,-1},
-{1081,1082,-1,-1,-1,-1,-1,-1,-1},
-{1082,1083,-1,-1,-1,-1,-1,-1,-1},
-{1083,1084,-1,-1,-1,-1,-1,-1,-1},
-{1084,1085,-1,-1,-1,-1,-1,-1,-1},
-{1085,1086,-1,-1,-1,-1,-1,-1,-1},
-{1086,1087,-1,-1,-1,-1,-1,-1,-1},
-{1087,1088,-1,-1,-1,-1,-1,-1,-1},
-{1088,1089,-1,-1,-1,-1,-1,-1,-1},
-{1089,1090,-1,-1,-1,-1,-1,-1,-1},
-{1090,1091,-1,-1,-1,-1,-1,-1,-1},
-{1091,1092,-1,-1,-1,-1,-1,-1,-1},
-{1092,1093,-1,-1,-1,-1,-1,-1,-1},
-{1093,1094,-1,-1,-1,-1,-1,-1,-1},
-{1094,1095,-1,-1,-1,-1,-1,-1,-1},
-{1095,1096,-1,-1,-1,-1,-1,-1,-1},
-{1096,1097,-1,-1,-1,-1,-1,-1,-1},
-{1097,1098,-1,-1,-1,-1,-1,-1,-1},
-{1098,1099,-1,-1,-1,-1,-1,-1,-1},
-{1099,1100,-1,-1,-1,-1,-1,-1,-1},
-{1100,1101,-1,-1,-1,-1,-1,-1,-1},
-{1101,1102,-1,-1,-1,-1,-1,-1,-1},
-{1102,1103,-1,-1,-1,-1,-1,-1,-1},
-{1103,1104,-1,-1,-1,-1,-1,-1,-1},
-{1104,1105,-1,-1,-1,-1,-1,-1,-1},
-{1105,1106,-1,-1,-1,-1,-1,-1,-1},
-{1106,1107,-1,-1,-1,-1,-1,-1,-1},
-{1107,1108,-1,-1,-1,-1,-1,-1,-1},
-{1108,1109,-1,-1,-1,-1,-1,-1,-1},
-{1109,1110,-1,-1,-1,-1,-1,-1,-1},
-{1110,1111,-1,-1,-1,-1,-1,-1,-1},
-{1111,1112,-1,-1,-1,-1,-1,-1,-1},
-{1112,1113,-1,-1,-1,-1,-1,-1,-1},
-{1113,1114,-1,-1,-1,-1,-1,-1,-1},
-{1114,1115,-1,-1,-1,-1,-1,-1,-1},
-{1115,1116,-1,-1,-1,-1,-1,-1,-1},
-{1116,1117,-1,-1,-1,-1,-1,-1,-1},
-{1117,1118,-1,-1,-1,-1,-1,-1,-1},
-{1118,1119,-1,-1,-1,-1,-1,-1,-1},
-{1119,1120,-1,-1,-1,-1,-1,-1,-1},
-{1120,1121,-1,-1,-1,-1,-1,-1,-1},
-{1121,1122,-1,-1,-1,-1,-1,-1,-1},
-{1122,1123,-1,-1,-1,-1,-1,-1,-1},
-{1123,1124,-1,-1,-1,-1,-1,-1,-1},
-{1124,1125,-1,-1,-1,-1,-1,-1,-1},
-{1125,1126,-1,-1,-1,-1,-1,-1,-1},
-{1126,1127,-1,-1,-1,-1,-1,-1,-1},
-{1127,1128,-1,-1,-1,-1,-1,-1,-1},
-{1128,1129,-1,-1,-1,-1,-1,-1,-1},
-{1129,1130,-1,-1,-1,-1,-1,-1,-1},
-{1130,1131,-1,-1,-1,-1,-1,-1,-1},
-{1131,1132,-1,-1,-1,-1,-1,-1,-1},
-{1132,1133,-1,-1,-1,-1,-1,-1,-1},
-{1133,1134,-1,-1,-1,-1,-1,-1,-1},
-{1134,1135,-1,-1,-1,-1,-1,-1,-1},
-{1135,1136,-1,-1,-1,-1,-1,-1,-1},
-{1136,1137,-1,-1,-1,-1,-1,-1,-1},
-{1137,1138,-1,-1,-1,-1,-1,-1,-1},
-{1138,1139,-1,-1,-1,-1,-1,-1,-1},
-{1139,1140,-1,-1,-1,-1,-1,-1,-1},
-{1140,1141,-1,-1,-1,-1,-1,-1,-1},
-{1141,1142,-1,-1,-1,-1,-1,-1,-1},
-{1142,1143,-1,-1,-1,-1,-1,-1,-1},
-{1143,1144,-1,-1,-1,-1,-1,-1,-1},
-{1144,1145,-1,-1,-1,-1,-1,-1,-1},
-{1145,1146,-1,-1,-1,-1,-1,-1,-1},
-{1146,1147,-1,-1,-1,-1,-1,-1,-1},
-{1147,1148,-1,-1,-1,-1,-1,-1,-1},
-{1148,1149,-1,-1,-1,-1,-1,-1,-1},
-{1149,1150,-1,-1,-1,-1,-1,-1,-1},
-{1150,1151,-1,-1,-1,-1,-1,-1,-1},
-{1151,1152,-1,-1,-1,-1,-1,-1,-1},
-{1152,1153,-1,-1,-1,-1,-1,-1,-1},
-{1153,1154,-1,-1,-1,-1,-1,-1,-1},
-{1154,1155,-1,-1,-1,-1,-1,-1,-1},
-{1155,1156,-1,-1,-1,-1,-1,-1,-1},
-{1156,1157,-1,-1,-1,-1,-1,-1,-1},
-{1157,1158,-1,-1,-1,-1,-1,-1,-1},
-{1158,1159,-1,-1,-1,-1,-1,-1,-1},
-{1159,1160,-1,-1,-1,-1,-1,-1,-1},
-{1160,1161,-1,-1,-1,-1,-1,-1,-1},
-{1161,1162,-1,-1,-1,-1,-1,-1,-1},
-{1162,1163,-1,-1,-1,-1,-1,-1,-1},
-{1163,1164,-1,-1,-1,-1,-1,-1,-1},
-{1164,1165,-1,-1,-1,-1,-1,-1,-1},
-{1165,1166,-1,-1,-1,-1,-1,-1,-1},
-{1166,1167,-1,-1,-1,-1,-1,-1,-1},
-{1167,1168,-1,-1,-1,-1,-1,-1,-1},
-{1168,1169,-1,-1,-1,-1,-1,-1,-1},
-{1169,1170,-1,-1,-1,-1,-1,-1,-1},
-{1170,1171,-1,-1,-1,-1,-1,-1,-1},
-{1171,1172,-1,-1,-1,-1,-1,-1,-1},
-{1172,1173,-1,-1,-1,-1,-1,-1,-1},
-{1173,1174,-1,-1,-1,-1,-1,-1,-1},
-{1174,1175,-1,-1,-1,-1,-1,-1,-1},
-{1175,1176,-1,-1,-1,-1,-1,-1,-1},
-{1176,1177,-1,-1,-1,-1,-1,-1,-1},
-{1177,1178,-1,-1,-1,-1,-1,-1,-1},
-{1178,1179,-1,-1,-1,-1,-1,-1,-1},
-{1179,1180,-1,-1,-1,-1,-1,-1,-1},
-{1180,1181,-1,-1,-1,-1,-1,-1,-1},
-{1181,1182,-1,-1,-1,-1,-1,-1,-1},
-{1182,1183,-1,-1,-1,-1,-1,-1,-1},
-{1183,1184,-1,-1,-1,-1,-1,-1,-1},
-{1184,1185,-1,-1,-1,-1,-1,-1,-1},
-{1185,1186,-1,-1,-1,-1,-1,-1,-1},
-{1186,1187,-1,-1,-1,-1,-1,-1,-1},
-{1187,1188,-1,-1,-1,-1,-1,-1,-1},
-{1188,1189,-1,-1,-1,-1,-1,-1,-1},
-{1189,1190,-1,-1,-1,-1,-1,-1,-1},
-{1190,1191,-1,-1,-1,-1,-1,-1,-1},
-{1191,1192,-1,-1,-1,-1,-1,-1,-1},
-{1192,1193,-1,-1,-1,-1,-1,-1,-1},
-{1193,1194,-1,-1,-1,-1,-1,-1,-1},
-{1194,1195,-1,-1,-1,-1,-1,-1,-1},
-{1195,1196,-1,-1,-1,-1,-1,-1,-1},
-{1196,1197,-1,-1,-1,-1,-1,-1,-1},
-{1197,1198,-1,-1,-1,-1,-1,-1,-1},
-{1198,1199,-1,-1,-1,-1,-1,-1,-1},
-{1199,-1,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_4_16=102;
+int mercury_normal_QCbase_4_16[872]={
+4,245,8,129,204,410,691,762,828,948,1181,
+4,245,4,468,1092,1125,1162,
+4,245,4,142,398,564,846,
+4,245,5,167,352,434,766,934,
+4,245,8,206,298,317,442,457,480,757,918,
+4,245,3,228,1060,1143,
+4,245,7,62,100,119,477,552,667,1135,
+4,245,7,61,148,285,683,769,828,1051,
+4,245,6,19,409,500,660,778,848,
+4,245,7,128,642,709,828,885,937,1025,
+4,245,5,170,589,756,1044,1067,
+4,245,3,338,530,997,
+4,245,3,510,848,942,
+4,245,6,8,78,98,286,310,719,
+4,245,8,8,98,423,460,489,598,1092,1198,
+4,245,5,69,202,419,589,737,
+4,245,9,123,124,326,584,674,759,774,932,1111,
+4,245,4,265,508,895,1105,
+4,245,8,120,164,228,274,763,939,978,1113,
+4,245,5,74,101,332,754,838,
+4,245,8,946,220,400,466,483,734,393,745,
+4,245,7,197,222,292,463,561,994,1041,
+4,245,5,352,580,652,737,1124,
+4,245,5,565,700,897,919,1153,
+4,245,5,123,163,791,800,875,
+4,245,6,245,551,647,702,1056,1152,
+4,245,3,416,442,1043,
+4,245,9,57,142,598,803,926,1074,1079,1094,1146,
+4,245,4,13,136,439,260,
+4,245,3,726,986,1012,
+4,245,3,679,715,993,
+4,245,4,76,137,870,996,
+4,245,9,295,421,625,673,794,874,920,928,1127,
+4,245,7,52,242,477,875,886,940,953,
+4,245,4,396,406,950,1013,
+4,245,5,227,303,743,891,1194,
+4,245,9,280,411,477,531,833,901,928,1151,1173,
+4,245,6,23,93,199,654,706,909,
+4,245,3,733,793,1056,
+4,245,4,296,604,624,1199,
+4,245,5,192,618,750,1083,1134,
+4,245,8,41,44,227,347,766,1147,1161,1162,
+4,245,3,685,431,740,
+4,245,4,273,969,983,1177,
+4,245,9,134,146,177,212,581,620,696,758,812,
+4,245,5,41,406,614,658,719,
+4,245,6,568,1005,1126,571,335,504,
+4,245,6,110,141,297,527,601,840,
+4,245,6,439,623,739,758,767,1057,
+4,245,5,124,651,668,845,1150,
+4,245,4,118,586,708,925,
+4,245,3,139,397,459,
+4,245,6,179,246,780,1082,1149,1192,
+4,245,5,82,224,238,862,1193,
+4,245,5,240,324,395,521,772,
+4,245,8,81,134,582,626,713,843,1086,1163,
+4,245,7,4,333,540,567,652,719,1153,
+4,245,3,370,421,452,
+4,245,8,174,368,502,617,818,855,994,1017,
+4,245,9,51,399,463,530,592,864,952,994,999,
+4,245,4,145,267,295,304,
+4,245,8,16,123,228,584,626,954,998,1051,
+4,245,4,166,312,800,852,
+4,245,4,521,593,822,873,
+4,245,5,187,233,617,1051,1067,
+4,245,8,451,482,500,948,998,1014,1098,1195,
+4,245,7,68,290,387,423,426,589,905,
+4,245,3,369,427,637,
+4,245,4,75,151,310,963,
+4,245,3,190,77,133,
+4,245,7,376,578,731,778,996,752,697,
+4,245,9,52,75,77,141,365,501,542,954,1184,
+4,245,6,331,504,554,568,710,920,
+4,245,3,334,834,981,
+4,245,7,348,364,633,676,691,809,903,
+4,245,8,146,161,245,351,648,919,1040,1055,
+4,245,5,381,1043,1077,1092,1165,
+4,245,4,87,1027,1094,1199,
+4,245,6,334,397,556,694,1050,1080,
+4,245,4,182,198,361,430,
+4,245,3,198,432,675,
+4,245,6,38,178,256,283,379,1023,
+4,245,8,426,427,430,600,637,677,945,1077,
+4,245,5,114,266,340,791,1112,
+4,245,8,17,216,297,313,522,570,743,1081,
+4,245,6,247,572,606,748,889,1191,
+4,245,4,37,173,289,1068,
+4,245,3,11,647,850,
+4,245,7,139,295,559,674,762,826,1155,
+4,245,5,34,92,211,604,1187,
+4,245,9,3,228,504,553,645,819,896,1144,1162,
+4,245,3,145,513,599,
+4,245,9,333,355,365,698,872,917,962,1095,1160,
+4,245,3,23,458,687,
+4,245,7,256,283,344,382,551,627,1152,
+4,245,7,144,248,483,581,628,699,1010,
+4,245,8,95,265,424,844,970,994,1012,1131,
+4,245,6,16,512,833,856,971,1043,
+4,245,4,71,225,635,930,
+4,245,4,283,420,583,882,
+1199,1,2,0,1,
+1,0,1,1199};
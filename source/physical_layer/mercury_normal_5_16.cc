@@ -25,3810 +25,107 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_5_16.h"
-int mercury_normal_Cwidth_5_16=15;
-int mercury_normal_Vwidth_5_16=9;
-int mercury_normal_dwidth_5_16=180;
-int mercury_normal_QCmatrixd_5_16[180]={5,6,5,4,10,3,10,9,5,6,5,3,5,9,5,4,5,5,5,9,5,7,10,9,5,5,5,7,5,8,5,4,5,6,5,9,5,8,5,7,5,3,5,6,10,8,5,3,10,7,5,9,5,5,5,7,5,5,5,6,5,8,10,6,5,7,5,8,5,5,5,7,5,5,5,3,5,9,5,4,5,5,5,7,5,6,5,7,5,8,5,7,5,9,5,3,5,6,5,7,5,8,5,3,5,7,5,9,5,6,10,8,5,9,5,8,10,4,5,8,10,7,5,6,10,3,5,9,5,3,5,7,10,9,5,7,5,5,5,4,5,7,5,4,5,8,5,7,5,6,5,4,5,7,5,4,5,9,5,3,5,8,5,4,5,9,5,8,5,6,5,5,10,9,5,8,1099,2,1,1};
-int mercury_normal_QCmatrixC_5_16[1100][15]={
-{57,61,89,283,293,500,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{242,408,458,500,501,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,87,436,457,462,501,502,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,496,502,503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,503,504,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,269,303,365,368,379,504,505,-1,-1,-1,-1,-1,-1,-1},
-{315,453,505,506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,506,507,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,195,260,507,508,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,409,508,509,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,345,509,510,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,209,221,307,477,510,511,-1,-1,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,137,196,291,512,513,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,513,514,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,515,516,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,444,516,517,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,296,327,517,518,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,101,152,262,367,518,519,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,338,343,475,519,520,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,353,520,521,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{251,521,522,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,473,522,523,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,313,383,523,524,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,484,524,525,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{265,343,525,526,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,68,186,391,526,527,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,264,527,528,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,386,528,529,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,103,529,530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{432,530,531,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,408,419,531,532,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,350,365,532,533,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,489,533,534,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,203,251,273,534,535,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,535,536,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,290,462,536,537,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,192,194,307,382,386,481,537,538,-1,-1,-1,-1,-1,-1},
-{144,199,321,538,539,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,81,82,340,478,539,540,-1,-1,-1,-1,-1,-1,-1,-1},
-{497,499,540,541,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{279,541,542,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{382,543,544,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,345,544,545,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,22,154,224,545,546,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,399,444,546,547,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,184,235,547,548,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,257,466,548,549,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,323,445,549,550,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,150,228,436,466,487,550,551,-1,-1,-1,-1,-1,-1,-1},
-{125,230,248,309,551,552,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,382,552,553,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,553,554,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{315,335,554,555,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,295,555,556,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,72,303,556,557,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,100,105,192,557,558,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,265,309,492,558,559,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,257,394,559,560,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,124,313,444,458,467,560,561,-1,-1,-1,-1,-1,-1,-1},
-{58,62,284,294,561,562,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{243,280,409,459,562,563,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,88,240,437,458,463,563,564,-1,-1,-1,-1,-1,-1,-1},
-{130,497,564,565,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,565,566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,135,304,366,369,445,566,567,-1,-1,-1,-1,-1,-1,-1},
-{240,316,454,567,568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,57,385,568,569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,196,261,569,570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,335,570,571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,114,346,571,572,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{203,222,308,310,478,572,573,-1,-1,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,138,197,292,445,574,575,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,575,576,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{208,420,578,579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,297,328,579,580,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,140,153,263,368,580,581,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,339,344,476,581,582,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,354,582,583,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{252,583,584,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{474,584,585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,314,384,585,586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,125,157,190,195,586,587,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,165,266,344,475,587,588,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,69,187,392,588,589,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,95,105,295,589,590,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{387,590,591,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,591,592,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,395,433,592,593,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,409,593,594,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,245,351,366,594,595,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,595,596,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,204,252,274,596,597,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,175,195,420,425,495,597,598,-1,-1,-1,-1,-1,-1,-1},
-{224,291,463,598,599,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,308,383,387,482,599,600,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,600,601,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,82,83,341,479,601,602,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,498,602,603,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{383,605,606,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,346,606,607,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,23,607,608,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,236,295,609,610,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,225,258,467,610,611,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,324,446,611,612,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,56,151,229,437,467,488,612,613,-1,-1,-1,-1,-1,-1},
-{126,231,249,613,614,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,280,380,383,614,615,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,615,616,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,336,616,617,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,296,617,618,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,73,304,618,619,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,101,106,193,619,620,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,266,493,620,621,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,621,622,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,314,315,459,468,622,623,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,63,623,624,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,281,490,624,625,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{83,89,241,438,459,464,625,626,-1,-1,-1,-1,-1,-1,-1},
-{0,131,485,498,626,627,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,163,375,627,628,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,136,367,446,628,629,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,241,317,629,630,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,58,386,630,631,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{197,262,631,632,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,310,336,415,490,632,633,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,347,633,634,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,223,309,311,479,485,634,635,-1,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{139,198,293,446,636,637,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,638,639,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,639,640,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,421,470,640,641,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,255,298,329,465,641,642,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,141,154,175,264,369,642,643,-1,-1,-1,-1,-1,-1,-1},
-{270,477,643,644,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,133,644,645,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,645,646,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,110,245,647,648,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,126,158,191,196,425,648,649,-1,-1,-1,-1,-1,-1,-1},
-{40,121,166,267,275,476,649,650,-1,-1,-1,-1,-1,-1,-1},
-{23,188,375,393,420,650,651,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,80,92,96,106,296,651,652,-1,-1,-1,-1,-1,-1,-1},
-{388,652,653,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,653,654,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,55,396,434,495,654,655,-1,-1,-1,-1,-1,-1,-1,-1},
-{343,655,656,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{83,246,352,367,656,657,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,657,658,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,280,658,659,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,176,196,210,245,270,421,426,496,659,660,-1,-1,-1,-1},
-{292,464,660,661,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,309,384,388,483,661,662,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,662,663,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,83,84,342,663,664,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,499,664,665,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{384,667,668,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,347,668,669,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,24,365,470,669,670,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,670,671,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,237,296,330,671,672,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,226,259,468,672,673,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,447,673,674,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,57,152,285,405,438,468,489,674,675,-1,-1,-1,-1,-1},
-{127,232,675,676,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,281,381,384,676,677,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,263,677,678,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,337,678,679,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,297,679,680,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,74,680,681,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,107,194,681,682,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,154,240,267,494,682,683,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,270,683,684,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,42,70,316,469,684,685,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,390,685,686,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{282,491,686,687,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,84,242,330,439,687,688,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,132,486,499,688,689,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,164,376,460,689,690,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,137,368,447,690,691,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,242,318,691,692,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,59,387,485,692,693,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{198,263,693,694,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,63,311,337,416,491,694,695,-1,-1,-1,-1,-1,-1,-1},
-{77,145,195,348,695,696,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,295,312,486,696,697,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,294,447,698,699,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,699,700,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,700,701,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,701,702,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{422,471,702,703,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{256,299,466,703,704,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,142,176,704,705,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{271,478,495,705,706,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,126,134,320,706,707,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,707,708,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{425,708,709,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,111,246,260,709,710,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,127,159,192,197,426,710,711,-1,-1,-1,-1,-1,-1,-1},
-{25,41,122,167,268,276,477,711,712,-1,-1,-1,-1,-1,-1},
-{24,189,376,394,421,712,713,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,81,93,97,107,255,297,713,714,-1,-1,-1,-1,-1,-1},
-{389,714,715,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,140,361,715,716,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,56,210,397,496,716,717,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,717,718,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,247,353,368,718,719,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,250,719,720,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,281,720,721,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,177,197,211,246,250,271,422,427,497,721,722,-1,-1,-1},
-{293,722,723,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{389,484,723,724,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,724,725,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,343,380,725,726,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,465,726,727,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,348,730,731,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,366,471,731,732,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,236,240,732,733,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,238,297,331,733,734,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,227,469,734,735,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,448,735,736,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,30,50,58,153,286,406,439,469,736,737,-1,-1,-1,-1},
-{128,233,737,738,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,282,382,738,739,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,264,739,740,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{318,338,740,741,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,298,741,742,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{310,315,742,743,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,108,743,744,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,241,268,744,745,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,271,745,746,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,43,71,317,746,747,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,747,748,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{283,492,748,749,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,243,331,749,750,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,133,487,750,751,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,82,377,461,751,752,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,79,138,369,448,752,753,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,243,319,753,754,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,130,388,486,754,755,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,264,755,756,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,64,312,338,417,492,756,757,-1,-1,-1,-1,-1,-1,-1},
-{78,146,196,349,425,757,758,-1,-1,-1,-1,-1,-1,-1,-1},
-{296,313,487,758,759,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{448,760,761,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{361,380,761,762,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{277,762,763,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,185,763,764,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{423,472,764,765,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,405,467,765,766,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,150,177,766,767,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{272,479,496,767,768,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,40,127,145,321,405,768,769,-1,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{426,770,771,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,112,247,261,355,771,772,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,128,193,198,427,772,773,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,42,123,168,269,277,478,773,774,-1,-1,-1,-1,-1,-1},
-{377,422,490,774,775,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,82,94,98,108,256,298,360,775,776,-1,-1,-1,-1,-1},
-{390,776,777,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,141,362,777,778,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,57,211,398,497,778,779,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,779,780,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,354,369,780,781,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,251,781,782,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,282,782,783,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,178,198,212,235,247,251,272,423,428,498,783,784,-1,-1},
-{294,385,784,785,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,785,786,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,786,787,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,381,787,788,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,466,788,789,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{349,375,792,793,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,365,367,472,793,794,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,237,241,794,795,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,70,239,298,332,795,796,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,796,797,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,449,797,798,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,31,51,59,154,287,407,798,799,-1,-1,-1,-1,-1,-1},
-{129,234,799,800,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,283,383,800,801,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,801,802,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{319,339,802,803,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,299,803,804,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{311,316,804,805,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,105,109,805,806,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,242,269,806,807,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,272,807,808,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,44,72,318,808,809,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,809,810,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{284,493,810,811,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,244,332,811,812,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,20,134,140,488,812,813,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,83,320,378,462,813,814,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,139,449,814,815,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,108,244,390,815,816,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,131,389,487,816,817,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,90,817,818,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,313,339,418,493,818,819,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,147,197,426,819,820,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{297,314,445,488,820,821,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{821,822,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,449,822,823,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,362,381,823,824,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,824,825,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,186,825,826,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,424,473,826,827,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,406,435,468,827,828,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,151,178,280,828,829,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,497,829,830,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,41,128,146,322,405,406,830,831,-1,-1,-1,-1,-1,-1},
-{831,832,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,427,832,833,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,248,262,356,833,834,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,129,194,199,428,834,835,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,27,43,124,169,278,479,835,836,-1,-1,-1,-1,-1,-1},
-{378,423,491,836,837,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,83,99,109,257,299,361,837,838,-1,-1,-1,-1,-1,-1},
-{391,415,838,839,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,140,142,363,465,839,840,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,58,212,399,498,840,841,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,226,350,841,842,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,842,843,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,252,843,844,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,283,844,845,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,199,213,236,248,252,273,424,429,499,845,846,-1,-1,-1},
-{386,846,847,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{236,455,847,848,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,370,440,848,849,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{382,849,850,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,120,467,850,851,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,851,852,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,445,852,853,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{853,854,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{376,854,855,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,366,368,473,855,856,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,127,238,242,856,857,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,71,100,299,333,857,858,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,195,229,245,858,859,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{859,860,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,32,52,288,408,860,861,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,861,862,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,284,384,385,862,863,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,863,864,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,864,865,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{415,865,866,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{312,317,866,867,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,190,867,868,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,165,243,868,869,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,207,273,315,869,870,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,73,319,870,871,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{255,393,871,872,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{230,494,872,873,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,333,345,355,873,874,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,21,141,415,489,874,875,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,84,321,379,463,875,876,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,95,876,877,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,109,391,877,878,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,295,488,878,879,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,91,879,880,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,314,419,494,880,881,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,198,427,881,882,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{298,446,489,882,883,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{320,420,883,884,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,305,884,885,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,205,363,382,885,886,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,279,886,887,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,187,240,887,888,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,474,888,889,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,407,436,469,889,890,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,179,281,890,891,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{274,455,498,891,892,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,42,129,147,323,406,407,892,893,-1,-1,-1,-1,-1,-1},
-{95,893,894,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,428,894,895,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,249,263,357,375,895,896,-1,-1,-1,-1,-1,-1,-1,-1},
-{429,896,897,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,28,44,279,897,898,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{379,424,492,898,899,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,84,258,362,899,900,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,416,900,901,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,141,143,215,364,466,901,902,-1,-1,-1,-1,-1,-1,-1},
-{59,213,499,902,903,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,96,227,351,903,904,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{480,904,905,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,253,280,905,906,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,284,906,907,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,237,249,253,274,907,908,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,387,908,909,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{237,456,909,910,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,371,441,910,911,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,383,911,912,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,415,468,912,913,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,186,385,913,914,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,111,446,914,915,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,915,916,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,175,377,916,917,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,130,196,367,369,425,474,917,918,-1,-1,-1,-1,-1,-1},
-{66,128,239,243,918,919,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,72,101,334,395,919,920,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,196,246,410,920,921,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{921,922,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,53,255,289,385,409,922,923,-1,-1,-1,-1,-1,-1,-1},
-{56,923,924,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{386,924,925,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,925,926,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,926,927,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,416,927,928,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{290,313,318,928,929,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,191,929,930,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,166,244,930,931,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,208,274,316,931,932,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,74,420,430,932,933,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,256,394,933,934,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{231,934,935,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,334,346,356,935,936,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,142,416,936,937,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,68,322,395,464,937,938,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,96,125,938,939,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,230,392,939,940,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,296,335,489,940,941,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,92,385,941,942,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,942,943,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,199,428,943,944,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,365,447,490,944,945,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{321,421,945,946,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,306,365,490,946,947,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,206,364,383,947,948,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,300,948,949,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{188,241,949,950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,385,950,951,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{408,437,951,952,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,282,952,953,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,456,499,953,954,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,43,148,324,407,408,954,955,-1,-1,-1,-1,-1,-1,-1},
-{96,955,956,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,162,429,956,957,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,358,376,957,958,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,958,959,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,29,959,960,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{493,960,961,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,363,370,961,962,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{220,393,417,962,963,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,142,144,216,467,963,964,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,230,964,965,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,97,150,228,352,965,966,-1,-1,-1,-1,-1,-1,-1,-1},
-{481,966,967,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,281,967,968,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,968,969,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{238,254,969,970,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,388,970,971,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{238,457,971,972,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,372,442,972,973,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,384,973,974,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,122,416,435,469,974,975,-1,-1,-1,-1,-1,-1,-1,-1},
-{96,187,386,975,976,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,112,447,976,977,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,977,978,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,176,310,378,978,979,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,96,131,197,220,368,426,979,980,-1,-1,-1,-1,-1,-1},
-{67,129,244,980,981,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,73,102,180,396,981,982,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,197,247,411,982,983,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{983,984,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,54,256,386,984,985,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,450,985,986,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{350,387,986,987,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{987,988,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{277,988,989,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,140,186,417,989,990,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{291,314,319,990,991,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,192,320,991,992,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{167,992,993,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,172,209,317,993,994,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{421,431,994,995,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,257,995,996,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,232,425,996,997,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{347,357,997,998,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,143,315,417,998,999,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,69,323,396,400,999,1000,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,97,126,280,1000,1001,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,231,345,393,445,1001,1002,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,134,297,336,1002,1003,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,28,93,386,1003,1004,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1004,1005,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{429,1005,1006,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{366,448,491,1006,1007,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,422,1007,1008,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,305,307,366,491,1008,1009,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,183,207,384,1009,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,107,301,1010,1011,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{189,242,1011,1012,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,145,386,1012,1013,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,409,438,1013,1014,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,283,1014,1015,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,457,1015,1016,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,149,408,409,1016,1017,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,1017,1018,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,163,215,1018,1019,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{359,377,1019,1020,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,1020,1021,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,160,1021,1022,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{494,1022,1023,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{364,371,1023,1024,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{221,394,418,1024,1025,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,217,468,1025,1026,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,231,1026,1027,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,30,98,151,229,255,353,1027,1028,-1,-1,-1,-1,-1,-1},
-{482,1028,1029,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,282,1029,1030,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,9,1030,1031,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,239,1031,1032,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,389,455,1032,1033,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{239,458,1033,1034,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,373,443,1034,1035,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,1035,1036,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,100,123,417,436,1036,1037,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,188,387,1037,1038,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,113,335,380,448,1038,1039,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,1039,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,177,311,379,1040,1041,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,55,91,97,132,198,221,369,427,435,1041,1042,-1,-1,-1},
-{68,1042,1043,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,103,181,397,1043,1044,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,85,198,248,412,1044,1045,-1,-1,-1,-1,-1,-1,-1,-1},
-{1045,1046,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,387,1046,1047,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,451,1047,1048,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{351,388,1048,1049,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{220,1049,1050,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,460,1050,1051,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,141,187,190,250,418,1051,1052,-1,-1,-1,-1,-1,-1,-1},
-{115,292,1052,1053,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,193,321,1053,1054,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,1054,1055,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,173,318,465,1055,1056,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{422,432,1056,1057,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,258,1057,1058,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,186,233,426,1058,1059,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{348,358,1059,1060,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,144,316,418,1060,1061,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,220,324,397,401,1061,1062,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,127,281,1062,1063,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,105,232,346,394,446,1063,1064,-1,-1,-1,-1,-1,-1,-1},
-{66,220,298,337,375,480,1064,1065,-1,-1,-1,-1,-1,-1,-1},
-{11,29,94,387,1065,1066,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1066,1067,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,165,1067,1068,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{367,449,492,1068,1069,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,423,1069,1070,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,306,308,367,492,1070,1071,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,184,208,1071,1072,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,108,302,1072,1073,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{243,1073,1074,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,34,146,387,1074,1075,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,439,1075,1076,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,200,284,300,1076,1077,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,458,1077,1078,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{409,1078,1079,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,1079,1080,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,164,216,1080,1081,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{378,395,1081,1082,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,435,1082,1083,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,161,415,1083,1084,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1084,1085,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,185,372,1085,1086,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,419,1086,1087,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,218,310,469,1087,1088,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,220,232,1088,1089,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,31,99,152,256,350,354,1089,1090,-1,-1,-1,-1,-1,-1},
-{483,1090,1091,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,283,1091,1092,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,320,1092,1093,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,1093,1094,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,456,1094,1095,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,135,459,1095,1096,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{374,444,1096,1097,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{343,1097,1098,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,101,120,124,285,418,437,445,1098,1099,-1,-1,-1,-1,-1},
-{98,189,388,1099,1100,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,114,336,381,449,1100,1101,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,235,1101,1102,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,178,260,312,1102,1103,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,56,92,98,133,160,199,222,428,436,1103,1104,-1,-1,-1},
-{69,435,1104,1105,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,182,398,1105,1106,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,86,199,249,330,413,1106,1107,-1,-1,-1,-1,-1,-1,-1},
-{1107,1108,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,388,1108,1109,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,225,452,1109,1110,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{352,389,470,1110,1111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{221,1111,1112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{279,390,461,1112,1113,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,142,188,191,251,419,1113,1114,-1,-1,-1,-1,-1,-1,-1},
-{116,293,1114,1115,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,322,1115,1116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,1116,1117,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,174,319,466,1117,1118,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{390,423,433,1118,1119,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,259,1119,1120,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,100,187,234,427,450,475,1120,1121,-1,-1,-1,-1,-1,-1},
-{349,359,1121,1122,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,419,1122,1123,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,221,398,402,1123,1124,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,128,282,445,1124,1125,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,233,347,447,1125,1126,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,221,299,338,376,481,1126,1127,-1,-1,-1,-1,-1,-1,-1},
-{12,65,170,370,388,1127,1128,-1,-1,-1,-1,-1,-1,-1,-1},
-{1128,1129,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,166,1129,1130,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{368,493,1130,1131,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,324,424,1131,1132,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{307,309,368,493,1132,1133,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,209,1133,1134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,109,303,1134,1135,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,455,1135,1136,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,125,147,170,235,388,1136,1137,-1,-1,-1,-1,-1,-1,-1},
-{82,1137,1138,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,201,301,1138,1139,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,120,459,1139,1140,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,495,1140,1141,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,1141,1142,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,217,415,1142,1143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{379,396,470,1143,1144,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,436,1144,1145,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,275,416,1145,1146,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{375,1146,1147,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,186,340,373,1147,1148,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,1148,1149,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,210,219,245,311,1149,1150,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,221,233,1150,1151,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,32,145,153,257,351,1151,1152,-1,-1,-1,-1,-1,-1,-1},
-{484,1152,1153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,284,380,1153,1154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,321,1154,1155,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,475,1155,1156,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,457,1156,1157,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,136,1157,1158,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,1158,1159,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,1159,1160,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,102,121,286,419,438,446,1160,1161,-1,-1,-1,-1,-1,-1},
-{99,389,1161,1162,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,337,382,1162,1163,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,100,236,1163,1164,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,179,261,313,1164,1165,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,57,93,99,134,161,223,429,437,1165,1166,-1,-1,-1,-1},
-{436,1166,1167,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{183,399,1167,1168,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,331,414,1168,1169,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1169,1170,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,389,485,1170,1171,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,335,453,1171,1172,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,471,1172,1173,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,350,420,1173,1174,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,462,1174,1175,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,113,143,189,192,252,305,1175,1176,-1,-1,-1,-1,-1,-1},
-{117,294,1176,1177,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,445,1177,1178,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1178,1179,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,115,467,1179,1180,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,424,434,1180,1181,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,200,1181,1182,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,27,101,188,400,428,451,476,1182,1183,-1,-1,-1,-1,-1},
-{1183,1184,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{318,1184,1185,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,222,250,399,403,480,1185,1186,-1,-1,-1,-1,-1,-1,-1},
-{129,283,446,1186,1187,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,234,348,448,1187,1188,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,222,339,377,482,1188,1189,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,66,171,180,230,371,389,1189,1190,-1,-1,-1,-1,-1,-1},
-{1190,1191,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,167,1191,1192,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,369,494,1192,1193,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,315,1193,1194,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,308,369,494,1194,1195,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,1195,1196,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,260,304,1196,1197,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{456,1197,1198,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,126,148,171,236,389,1198,1199,-1,-1,-1,-1,-1,-1,-1},
-{83,1199,1200,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,157,202,302,1200,1201,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,121,250,1201,1202,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,496,1202,1203,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,410,1203,1204,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,145,218,416,1204,1205,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{397,471,1205,1206,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,437,1206,1207,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,270,276,417,1207,1208,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{376,1208,1209,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,187,341,374,1209,1210,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,224,300,1210,1211,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,151,211,246,312,1211,1212,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,200,222,234,1212,1213,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,146,154,258,295,352,1213,1214,-1,-1,-1,-1,-1,-1,-1},
-{1214,1215,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,381,1215,1216,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,322,1216,1217,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,476,1217,1218,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{458,1218,1219,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,112,137,1219,1220,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{296,1220,1221,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1221,1222,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,103,122,287,439,447,1222,1223,-1,-1,-1,-1,-1,-1,-1},
-{280,1223,1224,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{338,383,1224,1225,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,237,1225,1226,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,262,314,1226,1227,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,58,94,162,224,438,1227,1228,-1,-1,-1,-1,-1,-1,-1},
-{20,270,290,437,1228,1229,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{184,1229,1230,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,332,1230,1231,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,1231,1232,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{486,1232,1233,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{227,336,454,1233,1234,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,354,472,1234,1235,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,351,421,490,1235,1236,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,400,463,1236,1237,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,71,114,144,193,253,306,1237,1238,-1,-1,-1,-1,-1,-1},
-{118,1238,1239,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,324,446,1239,1240,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,1240,1241,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,116,345,365,468,1241,1242,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,1242,1243,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,1243,1244,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,28,102,189,205,401,429,452,477,1244,1245,-1,-1,-1,-1},
-{310,1245,1246,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,319,490,1246,1247,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,251,275,404,410,481,1247,1248,-1,-1,-1,-1,-1,-1,-1},
-{215,250,284,447,490,1248,1249,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,349,449,1249,1250,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,223,378,483,1250,1251,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,67,145,172,175,181,231,235,372,1251,1252,-1,-1,-1,-1},
-{1252,1253,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,168,1253,1254,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,295,1254,1255,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,316,1255,1256,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,155,309,1256,1257,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,1257,1258,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,261,1258,1259,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,457,1259,1260,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,127,149,172,237,1260,1261,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,1261,1262,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,158,203,303,1262,1263,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,251,1263,1264,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,327,497,1264,1265,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,411,1265,1266,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,219,417,465,1266,1267,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{398,472,1267,1268,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{438,1268,1269,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,271,277,418,1269,1270,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,377,1270,1271,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,188,342,1271,1272,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,301,1272,1273,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,152,212,247,313,315,1273,1274,-1,-1,-1,-1,-1,-1,-1},
-{4,201,223,1274,1275,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,147,259,296,353,1275,1276,-1,-1,-1,-1,-1,-1,-1,-1},
-{1276,1277,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,382,455,1277,1278,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,323,1278,1279,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,477,1279,1280,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{290,459,1280,1281,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,113,138,410,1281,1282,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{297,1282,1283,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,1283,1284,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,123,288,300,448,1284,1285,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,281,495,1285,1286,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{315,339,384,1286,1287,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,238,1287,1288,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,263,1288,1289,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,59,90,163,165,170,439,1289,1290,-1,-1,-1,-1,-1,-1},
-{21,271,291,438,1290,1291,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{335,485,1291,1292,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,333,1292,1293,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,1293,1294,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,487,1294,1295,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,337,345,420,1295,1296,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,20,21,210,473,1296,1297,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,352,422,491,1297,1298,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{210,393,401,464,1298,1299,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,72,194,254,307,1299,1300,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,485,1300,1301,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,447,1301,1302,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,1302,1303,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,346,366,469,1303,1304,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{393,1304,1305,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,430,1305,1306,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,29,103,206,402,453,478,1306,1307,-1,-1,-1,-1,-1,-1},
-{260,311,1307,1308,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,345,491,1308,1309,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,252,276,411,482,1309,1310,-1,-1,-1,-1,-1,-1,-1,-1},
-{216,251,448,491,1310,1311,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,109,130,1311,1312,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,355,379,484,1312,1313,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,110,146,173,176,182,205,232,236,373,400,470,485,1313,1314},
-{305,1314,1315,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,169,245,285,1315,1316,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,296,1316,1317,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,317,1317,1318,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,156,1318,1319,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,1319,1320,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,1320,1321,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,458,1321,1322,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,128,173,238,1322,1323,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1323,1324,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,159,204,304,1324,1325,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,252,465,1325,1326,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,328,430,498,1326,1327,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,412,1327,1328,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,335,418,466,1328,1329,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{399,473,1329,1330,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,1330,1331,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,180,272,278,290,330,419,1331,1332,-1,-1,-1,-1,-1,-1},
-{86,378,1332,1333,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,189,343,1333,1334,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,302,1334,1335,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,130,153,213,248,314,316,1335,1336,-1,-1,-1,-1,-1,-1},
-{55,202,224,1336,1337,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,150,297,354,1337,1338,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1338,1339,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,383,456,1339,1340,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,1340,1341,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,478,1341,1342,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,291,1342,1343,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,114,139,411,1343,1344,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{298,1344,1345,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,471,1345,1346,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,289,301,449,1346,1347,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,282,496,1347,1348,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,1348,1349,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,239,1349,1350,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,120,264,1350,1351,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,91,164,166,171,1351,1352,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,272,292,439,1352,1353,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{336,486,1353,1354,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,334,1354,1355,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,1355,1356,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,265,375,488,1356,1357,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{229,338,346,421,1357,1358,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,21,22,211,474,1358,1359,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,423,492,1359,1360,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{211,394,402,405,1360,1361,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,73,308,1361,1362,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,486,1362,1363,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,448,1363,1364,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,1364,1365,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,347,367,1365,1366,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{394,1366,1367,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,203,431,1367,1368,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,104,207,403,440,454,479,1368,1369,-1,-1,-1,-1,-1,-1},
-{261,312,1369,1370,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,207,346,492,1370,1371,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,277,412,483,1371,1372,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,252,449,492,1372,1373,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,131,1373,1374,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,356,1374,1375,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,111,147,174,177,183,206,233,237,374,401,471,486,1375,1376},
-{306,480,1376,1377,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,286,1377,1378,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,297,1378,1379,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,264,318,1379,1380,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,125,157,1380,1381,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,276,1381,1382,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,1382,1383,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,415,459,1383,1384,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,174,239,1384,1385,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{485,1385,1386,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,1386,1387,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,253,466,1387,1388,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,329,431,499,1388,1389,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,190,343,413,1389,1390,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,148,195,336,419,467,1390,1391,-1,-1,-1,-1,-1,-1,-1},
-{474,1391,1392,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{495,1392,1393,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,181,273,275,279,291,331,1393,1394,-1,-1,-1,-1,-1,-1},
-{87,379,1394,1395,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,1395,1396,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{158,303,1396,1397,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,131,150,154,214,220,249,317,1397,1398,-1,-1,-1,-1,-1},
-{10,56,203,395,440,1398,1399,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,151,180,298,1399,1400,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1400,1401,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{166,384,457,1401,1402,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1402,1403,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,471,479,1403,1404,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,155,292,1404,1405,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,412,1405,1406,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,1406,1407,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,472,1407,1408,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{302,1408,1409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,283,497,1409,1410,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,317,1410,1411,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,140,390,1411,1412,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,120,121,440,1412,1413,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,92,167,172,280,290,1413,1414,-1,-1,-1,-1,-1,-1,-1},
-{23,273,293,405,455,1414,1415,-1,-1,-1,-1,-1,-1,-1,-1},
-{337,487,1415,1416,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,1416,1417,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{328,1417,1418,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,266,300,365,376,489,1418,1419,-1,-1,-1,-1,-1,-1,-1},
-{339,347,422,450,1419,1420,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,22,23,212,1420,1421,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,354,424,493,1421,1422,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{212,403,406,1422,1423,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,74,110,309,1423,1424,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,487,1424,1425,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,449,1425,1426,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,55,1426,1427,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,320,348,368,1427,1428,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1428,1429,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,204,432,1429,1430,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,208,404,441,1430,1431,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,313,1431,1432,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,208,347,493,1432,1433,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,254,278,335,340,413,484,1433,1434,-1,-1,-1,-1,-1,-1},
-{218,253,350,493,1434,1435,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,132,1435,1436,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,357,470,1436,1437,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,148,178,184,207,234,238,310,380,402,472,487,1437,1438,-1},
-{307,481,1438,1439,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,287,340,1439,1440,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,65,298,1440,1441,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,319,1441,1442,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,126,158,1442,1443,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,100,277,1443,1444,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,1444,1445,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{328,405,416,1445,1446,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1446,1447,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,486,1447,1448,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,74,200,270,1448,1449,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,467,1449,1450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,220,432,1450,1451,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,191,344,414,1451,1452,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,149,196,337,468,1452,1453,-1,-1,-1,-1,-1,-1,-1,-1},
-{475,1453,1454,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{496,1454,1455,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,182,274,276,292,332,1455,1456,-1,-1,-1,-1,-1,-1,-1},
-{88,1456,1457,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1457,1458,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,304,1458,1459,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,132,151,221,318,1459,1460,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,57,204,396,441,1460,1461,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,181,299,1461,1462,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1462,1463,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{167,320,458,1463,1464,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,1464,1465,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{245,306,472,1465,1466,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,156,293,1466,1467,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,413,1467,1468,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1468,1469,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,473,1469,1470,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{300,303,1470,1471,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,153,284,498,1471,1472,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{306,318,1472,1473,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,391,1473,1474,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,121,122,310,441,455,1474,1475,-1,-1,-1,-1,-1,-1,-1},
-{55,87,93,168,173,281,291,1475,1476,-1,-1,-1,-1,-1,-1},
-{24,240,274,294,406,456,1476,1477,-1,-1,-1,-1,-1,-1,-1},
-{85,338,455,460,488,1477,1478,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,1478,1479,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{329,1479,1480,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,267,301,366,377,1480,1481,-1,-1,-1,-1,-1,-1,-1,-1},
-{348,423,451,1481,1482,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,23,24,213,1482,1483,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,494,1483,1484,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{213,404,407,1484,1485,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,111,1485,1486,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{200,207,305,475,488,1486,1487,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,1487,1488,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,56,135,1488,1489,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{321,349,369,1489,1490,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1490,1491,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,433,1491,1492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,209,442,1492,1493,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,263,314,325,1493,1494,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,150,209,260,348,365,494,1494,1495,-1,-1,-1,-1,-1,-1},
-{161,279,336,341,414,1495,1496,-1,-1,-1,-1,-1,-1,-1,-1},
-{219,254,351,494,1496,1497,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,133,1497,1498,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,358,471,1498,1499,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,149,179,208,239,311,381,403,473,488,1499,1500,-1,-1,-1},
-{308,482,1500,1501,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,288,341,1501,1502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,299,1502,1503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,1503,1504,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,159,1504,1505,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,101,278,1505,1506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{430,1506,1507,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{329,406,417,1507,1508,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1508,1509,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,487,1509,1510,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,201,271,1510,1511,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{468,1511,1512,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,221,433,460,1512,1513,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,190,192,305,380,1513,1514,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,197,338,469,1514,1515,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,80,476,1515,1516,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{495,497,1516,1517,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,183,277,293,333,1517,1518,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,1518,1519,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{380,1519,1520,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1520,1521,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,133,152,222,319,1521,1522,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,58,397,442,1522,1523,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,153,182,1523,1524,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{255,1524,1525,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,321,459,1525,1526,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,485,1526,1527,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,307,473,1527,1528,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,157,294,380,1528,1529,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{414,1529,1530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1530,1531,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{183,474,1531,1532,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,70,301,304,1532,1533,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,154,190,499,1533,1534,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,307,319,490,1534,1535,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,255,392,1535,1536,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,123,311,442,456,465,1536,1537,-1,-1,-1,-1,-1,-1,-1},
-{56,60,88,94,169,174,282,292,1537,1538,-1,-1,-1,-1,-1},
-{241,407,457,1538,1539,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,86,339,435,456,461,489,1539,1540,-1,-1,-1,-1,-1,-1},
-{178,495,1540,1541,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,1541,1542,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,268,302,367,378,1542,1543,-1,-1,-1,-1,-1,-1,-1,-1},
-{349,424,452,1543,1544,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,24,55,214,1544,1545,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,1545,1546,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,408,1546,1547,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,1547,1548,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,208,220,306,476,489,1548,1549,-1,-1,-1,-1,-1,-1,-1},
-{1549,1550,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,136,195,290,1550,1551,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,1551,1552,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1552,1553,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,434,1553,1554,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,443,1554,1555,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,264,295,326,1555,1556,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,100,151,261,349,366,1556,1557,-1,-1,-1,-1,-1,-1,-1},
-{162,337,342,1557,1558,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,352,1558,1559,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,134,250,1559,1560,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,359,472,1560,1561,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,209,312,382,404,474,489,1561,1562,-1,-1,-1,-1,-1,-1},
-{155,309,483,1562,1563,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,289,342,1563,1564,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,67,185,390,1564,1565,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,1565,1566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,385,1566,1567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,102,279,1567,1568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{431,1568,1569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,407,418,1569,1570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,1570,1571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,488,1571,1572,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,202,250,272,1572,1573,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{469,1573,1574,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,434,461,1574,1575,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,191,193,306,381,385,480,1575,1576,-1,-1,-1,-1,-1,-1},
-{143,198,320,339,1576,1577,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,80,81,477,1577,1578,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{496,498,1578,1579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,184,278,294,334,1579,1580,-1,-1,-1,-1,-1,-1,-1,-1},
-{1580,1581,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{381,1581,1582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,1582,1583,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,134,153,223,1583,1584,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,59,398,443,1584,1585,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,154,183,1585,1586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,256,465,1586,1587,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,322,1587,1588,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{227,435,465,486,1588,1589,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,308,474,1589,1590,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,158,381,1590,1591,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,1591,1592,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1592,1593,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{184,1593,1594,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,71,302,1594,1595,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,191,1595,1596,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,308,491,1596,1597,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,256,393,1597,1598,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,124,312,443,457,466,1598,1599,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixEnc_5_16[1100][14]={
-{57,61,89,283,293,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{242,408,458,500,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,87,436,457,462,501,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,496,502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,269,303,365,368,379,504,-1,-1,-1,-1,-1,-1,-1},
-{315,453,505,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,195,260,507,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,409,508,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,345,509,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,209,221,307,477,510,-1,-1,-1,-1,-1,-1,-1,-1},
-{511,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,137,196,291,512,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,513,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{514,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,444,516,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,296,327,517,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,101,152,262,367,518,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,338,343,475,519,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,353,520,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{251,521,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,473,522,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,313,383,523,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,484,524,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{265,343,525,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,68,186,391,526,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,264,527,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,386,528,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,103,529,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{432,530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,408,419,531,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,350,365,532,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,489,533,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,203,251,273,534,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,535,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,290,462,536,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,192,194,307,382,386,481,537,-1,-1,-1,-1,-1,-1},
-{144,199,321,538,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,81,82,340,478,539,-1,-1,-1,-1,-1,-1,-1,-1},
-{497,499,540,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{279,541,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{542,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{382,543,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,345,544,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,22,154,224,545,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,399,444,546,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,184,235,547,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,257,466,548,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,323,445,549,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,150,228,436,466,487,550,-1,-1,-1,-1,-1,-1,-1},
-{125,230,248,309,551,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,382,552,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,553,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{315,335,554,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,295,555,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,72,303,556,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,100,105,192,557,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,265,309,492,558,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,257,394,559,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,124,313,444,458,467,560,-1,-1,-1,-1,-1,-1,-1},
-{58,62,284,294,561,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{243,280,409,459,562,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,88,240,437,458,463,563,-1,-1,-1,-1,-1,-1,-1},
-{130,497,564,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,565,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,135,304,366,369,445,566,-1,-1,-1,-1,-1,-1,-1},
-{240,316,454,567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,57,385,568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,196,261,569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,335,570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,114,346,571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{203,222,308,310,478,572,-1,-1,-1,-1,-1,-1,-1,-1},
-{573,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,138,197,292,445,574,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,575,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{576,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{577,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{208,420,578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,297,328,579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,140,153,263,368,580,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,339,344,476,581,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,354,582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{252,583,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{474,584,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,314,384,585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,125,157,190,195,586,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,165,266,344,475,587,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,69,187,392,588,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,95,105,295,589,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{387,590,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,591,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,395,433,592,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,409,593,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,245,351,366,594,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,595,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,204,252,274,596,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,175,195,420,425,495,597,-1,-1,-1,-1,-1,-1,-1},
-{224,291,463,598,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,308,383,387,482,599,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,600,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,82,83,341,479,601,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,498,602,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{603,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{604,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{383,605,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,346,606,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,23,607,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{608,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,236,295,609,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,225,258,467,610,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,324,446,611,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,56,151,229,437,467,488,612,-1,-1,-1,-1,-1,-1},
-{126,231,249,613,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,280,380,383,614,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,615,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,336,616,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,296,617,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,73,304,618,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,101,106,193,619,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,266,493,620,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,621,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,314,315,459,468,622,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,63,623,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,281,490,624,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{83,89,241,438,459,464,625,-1,-1,-1,-1,-1,-1,-1},
-{0,131,485,498,626,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,163,375,627,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,136,367,446,628,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,241,317,629,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,58,386,630,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{197,262,631,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,310,336,415,490,632,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,347,633,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,223,309,311,479,485,634,-1,-1,-1,-1,-1,-1,-1},
-{635,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{139,198,293,446,636,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{637,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,638,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,639,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,421,470,640,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,255,298,329,465,641,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,141,154,175,264,369,642,-1,-1,-1,-1,-1,-1,-1},
-{270,477,643,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,133,644,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,645,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{646,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,110,245,647,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,126,158,191,196,425,648,-1,-1,-1,-1,-1,-1,-1},
-{40,121,166,267,275,476,649,-1,-1,-1,-1,-1,-1,-1},
-{23,188,375,393,420,650,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,80,92,96,106,296,651,-1,-1,-1,-1,-1,-1,-1},
-{388,652,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,653,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,55,396,434,495,654,-1,-1,-1,-1,-1,-1,-1,-1},
-{343,655,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{83,246,352,367,656,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,657,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,280,658,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,176,196,210,245,270,421,426,496,659,-1,-1,-1,-1},
-{292,464,660,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,309,384,388,483,661,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,662,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,83,84,342,663,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,499,664,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{665,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{666,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{384,667,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,347,668,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,24,365,470,669,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,670,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,237,296,330,671,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,226,259,468,672,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,447,673,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,57,152,285,405,438,468,489,674,-1,-1,-1,-1,-1},
-{127,232,675,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,281,381,384,676,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,263,677,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,337,678,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,297,679,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,74,680,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,107,194,681,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,154,240,267,494,682,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,270,683,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,42,70,316,469,684,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,390,685,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{282,491,686,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,84,242,330,439,687,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,132,486,499,688,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,164,376,460,689,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,137,368,447,690,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,242,318,691,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,59,387,485,692,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{198,263,693,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,63,311,337,416,491,694,-1,-1,-1,-1,-1,-1,-1},
-{77,145,195,348,695,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,295,312,486,696,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{697,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,294,447,698,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,699,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,700,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,701,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{422,471,702,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{256,299,466,703,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,142,176,704,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{271,478,495,705,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,126,134,320,706,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,707,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{425,708,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,111,246,260,709,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,127,159,192,197,426,710,-1,-1,-1,-1,-1,-1,-1},
-{25,41,122,167,268,276,477,711,-1,-1,-1,-1,-1,-1},
-{24,189,376,394,421,712,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,81,93,97,107,255,297,713,-1,-1,-1,-1,-1,-1},
-{389,714,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,140,361,715,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,56,210,397,496,716,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,717,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,247,353,368,718,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,250,719,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,281,720,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,177,197,211,246,250,271,422,427,497,721,-1,-1,-1},
-{293,722,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{389,484,723,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,724,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,343,380,725,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,465,726,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{727,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{728,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{729,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,348,730,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,366,471,731,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,236,240,732,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,238,297,331,733,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,227,469,734,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,448,735,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,30,50,58,153,286,406,439,469,736,-1,-1,-1,-1},
-{128,233,737,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,282,382,738,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,264,739,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{318,338,740,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,298,741,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{310,315,742,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,108,743,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,241,268,744,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,271,745,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,43,71,317,746,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,747,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{283,492,748,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,243,331,749,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,133,487,750,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,82,377,461,751,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,79,138,369,448,752,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,243,319,753,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,130,388,486,754,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,264,755,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,64,312,338,417,492,756,-1,-1,-1,-1,-1,-1,-1},
-{78,146,196,349,425,757,-1,-1,-1,-1,-1,-1,-1,-1},
-{296,313,487,758,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{759,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{448,760,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{361,380,761,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{277,762,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,185,763,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{423,472,764,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,405,467,765,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,150,177,766,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{272,479,496,767,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,40,127,145,321,405,768,-1,-1,-1,-1,-1,-1,-1},
-{769,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{426,770,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,112,247,261,355,771,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,128,193,198,427,772,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,42,123,168,269,277,478,773,-1,-1,-1,-1,-1,-1},
-{377,422,490,774,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,82,94,98,108,256,298,360,775,-1,-1,-1,-1,-1},
-{390,776,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,141,362,777,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,57,211,398,497,778,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,779,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,354,369,780,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,251,781,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,282,782,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,178,198,212,235,247,251,272,423,428,498,783,-1,-1},
-{294,385,784,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,785,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,786,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,381,787,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,466,788,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{789,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{790,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{791,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{349,375,792,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,365,367,472,793,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,237,241,794,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,70,239,298,332,795,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,796,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,449,797,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,31,51,59,154,287,407,798,-1,-1,-1,-1,-1,-1},
-{129,234,799,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,283,383,800,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,801,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{319,339,802,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,299,803,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{311,316,804,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,105,109,805,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,242,269,806,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,272,807,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,44,72,318,808,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,809,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{284,493,810,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,244,332,811,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,20,134,140,488,812,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,83,320,378,462,813,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,139,449,814,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,108,244,390,815,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,131,389,487,816,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,90,817,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,313,339,418,493,818,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,147,197,426,819,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{297,314,445,488,820,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{821,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,449,822,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,362,381,823,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,824,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,186,825,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,424,473,826,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,406,435,468,827,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,151,178,280,828,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,497,829,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,41,128,146,322,405,406,830,-1,-1,-1,-1,-1,-1},
-{831,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,427,832,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,248,262,356,833,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,129,194,199,428,834,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,27,43,124,169,278,479,835,-1,-1,-1,-1,-1,-1},
-{378,423,491,836,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,83,99,109,257,299,361,837,-1,-1,-1,-1,-1,-1},
-{391,415,838,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,140,142,363,465,839,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,58,212,399,498,840,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,226,350,841,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,842,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,252,843,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,283,844,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,199,213,236,248,252,273,424,429,499,845,-1,-1,-1},
-{386,846,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{236,455,847,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,370,440,848,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{382,849,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,120,467,850,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,851,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,445,852,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{853,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{376,854,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,366,368,473,855,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,127,238,242,856,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,71,100,299,333,857,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,195,229,245,858,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{859,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,32,52,288,408,860,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,861,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,284,384,385,862,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,863,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,864,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{415,865,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{312,317,866,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,190,867,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,165,243,868,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,207,273,315,869,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,73,319,870,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{255,393,871,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{230,494,872,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,333,345,355,873,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,21,141,415,489,874,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,84,321,379,463,875,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,95,876,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,109,391,877,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,295,488,878,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,91,879,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,314,419,494,880,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,198,427,881,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{298,446,489,882,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{320,420,883,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{126,305,884,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,205,363,382,885,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,279,886,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,187,240,887,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,474,888,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,407,436,469,889,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,179,281,890,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{274,455,498,891,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,42,129,147,323,406,407,892,-1,-1,-1,-1,-1,-1},
-{95,893,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,428,894,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,249,263,357,375,895,-1,-1,-1,-1,-1,-1,-1,-1},
-{429,896,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,28,44,279,897,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{379,424,492,898,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,84,258,362,899,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,416,900,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,141,143,215,364,466,901,-1,-1,-1,-1,-1,-1,-1},
-{59,213,499,902,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,96,227,351,903,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{480,904,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,253,280,905,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,284,906,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,237,249,253,274,907,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,387,908,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{237,456,909,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,371,441,910,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,383,911,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,415,468,912,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,186,385,913,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,111,446,914,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,915,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,175,377,916,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,130,196,367,369,425,474,917,-1,-1,-1,-1,-1,-1},
-{66,128,239,243,918,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,72,101,334,395,919,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,196,246,410,920,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{921,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,53,255,289,385,409,922,-1,-1,-1,-1,-1,-1,-1},
-{56,923,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{386,924,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,925,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,926,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,416,927,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{290,313,318,928,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,191,929,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,166,244,930,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,208,274,316,931,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,74,420,430,932,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,256,394,933,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{231,934,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,334,346,356,935,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,142,416,936,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,68,322,395,464,937,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,96,125,938,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,230,392,939,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,296,335,489,940,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,92,385,941,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,942,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,199,428,943,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,365,447,490,944,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{321,421,945,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,306,365,490,946,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,206,364,383,947,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,300,948,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{188,241,949,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,385,950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{408,437,951,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,282,952,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,456,499,953,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,43,148,324,407,408,954,-1,-1,-1,-1,-1,-1,-1},
-{96,955,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,162,429,956,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,358,376,957,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,958,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,29,959,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{493,960,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,363,370,961,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{220,393,417,962,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,142,144,216,467,963,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,230,964,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,97,150,228,352,965,-1,-1,-1,-1,-1,-1,-1,-1},
-{481,966,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,281,967,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,968,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{238,254,969,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,388,970,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{238,457,971,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,372,442,972,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,384,973,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,122,416,435,469,974,-1,-1,-1,-1,-1,-1,-1,-1},
-{96,187,386,975,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,112,447,976,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,977,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,176,310,378,978,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,96,131,197,220,368,426,979,-1,-1,-1,-1,-1,-1},
-{67,129,244,980,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,73,102,180,396,981,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,197,247,411,982,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{983,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,54,256,386,984,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,450,985,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{350,387,986,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{987,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{277,988,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,140,186,417,989,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{291,314,319,990,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,192,320,991,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{167,992,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,172,209,317,993,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{421,431,994,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,257,995,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,232,425,996,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{347,357,997,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,143,315,417,998,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,69,323,396,400,999,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,97,126,280,1000,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,231,345,393,445,1001,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,134,297,336,1002,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,28,93,386,1003,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1004,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{429,1005,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{366,448,491,1006,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,422,1007,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,305,307,366,491,1008,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,183,207,384,1009,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,107,301,1010,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{189,242,1011,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,145,386,1012,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,409,438,1013,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,283,1014,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,457,1015,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,149,408,409,1016,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,1017,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,163,215,1018,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{359,377,1019,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,1020,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,160,1021,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{494,1022,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{364,371,1023,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{221,394,418,1024,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,217,468,1025,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,231,1026,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,30,98,151,229,255,353,1027,-1,-1,-1,-1,-1,-1},
-{482,1028,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,282,1029,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,9,1030,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,239,1031,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,389,455,1032,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{239,458,1033,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,373,443,1034,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,1035,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,100,123,417,436,1036,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,188,387,1037,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,113,335,380,448,1038,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,1039,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,177,311,379,1040,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,55,91,97,132,198,221,369,427,435,1041,-1,-1,-1},
-{68,1042,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,103,181,397,1043,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,85,198,248,412,1044,-1,-1,-1,-1,-1,-1,-1,-1},
-{1045,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,387,1046,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,451,1047,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{351,388,1048,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{220,1049,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,460,1050,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,141,187,190,250,418,1051,-1,-1,-1,-1,-1,-1,-1},
-{115,292,1052,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,193,321,1053,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,1054,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,173,318,465,1055,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{422,432,1056,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,258,1057,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,186,233,426,1058,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{348,358,1059,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,144,316,418,1060,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,220,324,397,401,1061,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,127,281,1062,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,105,232,346,394,446,1063,-1,-1,-1,-1,-1,-1,-1},
-{66,220,298,337,375,480,1064,-1,-1,-1,-1,-1,-1,-1},
-{11,29,94,387,1065,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1066,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,165,1067,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{367,449,492,1068,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,423,1069,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,306,308,367,492,1070,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,184,208,1071,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{76,108,302,1072,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{243,1073,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,34,146,387,1074,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,439,1075,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,200,284,300,1076,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,458,1077,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{409,1078,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,1079,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,164,216,1080,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{378,395,1081,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,435,1082,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,161,415,1083,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1084,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{170,185,372,1085,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,419,1086,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,218,310,469,1087,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,220,232,1088,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,31,99,152,256,350,354,1089,-1,-1,-1,-1,-1,-1},
-{483,1090,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,283,1091,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,320,1092,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,1093,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,456,1094,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,135,459,1095,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{374,444,1096,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{343,1097,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,101,120,124,285,418,437,445,1098,-1,-1,-1,-1,-1},
-{98,189,388,1099,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,114,336,381,449,1100,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,235,1101,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,178,260,312,1102,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,56,92,98,133,160,199,222,428,436,1103,-1,-1,-1},
-{69,435,1104,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,182,398,1105,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,86,199,249,330,413,1106,-1,-1,-1,-1,-1,-1,-1},
-{1107,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,388,1108,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,225,452,1109,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{352,389,470,1110,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{221,1111,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{279,390,461,1112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,142,188,191,251,419,1113,-1,-1,-1,-1,-1,-1,-1},
-{116,293,1114,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,322,1115,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,1116,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,174,319,466,1117,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{390,423,433,1118,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,259,1119,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,100,187,234,427,450,475,1120,-1,-1,-1,-1,-1,-1},
-{349,359,1121,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,419,1122,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,221,398,402,1123,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,128,282,445,1124,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,233,347,447,1125,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,221,299,338,376,481,1126,-1,-1,-1,-1,-1,-1,-1},
-{12,65,170,370,388,1127,-1,-1,-1,-1,-1,-1,-1,-1},
-{1128,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,166,1129,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{368,493,1130,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,324,424,1131,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{307,309,368,493,1132,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,209,1133,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,109,303,1134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,455,1135,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,125,147,170,235,388,1136,-1,-1,-1,-1,-1,-1,-1},
-{82,1137,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,201,301,1138,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,120,459,1139,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,495,1140,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{99,1141,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,217,415,1142,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{379,396,470,1143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,436,1144,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,275,416,1145,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{375,1146,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,186,340,373,1147,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,1148,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,210,219,245,311,1149,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,221,233,1150,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,32,145,153,257,351,1151,-1,-1,-1,-1,-1,-1,-1},
-{484,1152,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,284,380,1153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,321,1154,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,475,1155,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,457,1156,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{111,136,1157,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,1158,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,1159,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,102,121,286,419,438,446,1160,-1,-1,-1,-1,-1,-1},
-{99,389,1161,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,337,382,1162,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,100,236,1163,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{134,179,261,313,1164,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,57,93,99,134,161,223,429,437,1165,-1,-1,-1,-1},
-{436,1166,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{183,399,1167,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,331,414,1168,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1169,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,389,485,1170,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,335,453,1171,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,471,1172,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,350,420,1173,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,462,1174,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,113,143,189,192,252,305,1175,-1,-1,-1,-1,-1,-1},
-{117,294,1176,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,445,1177,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1178,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,115,467,1179,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{391,424,434,1180,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,200,1181,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,27,101,188,400,428,451,476,1182,-1,-1,-1,-1,-1},
-{1183,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{318,1184,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,222,250,399,403,480,1185,-1,-1,-1,-1,-1,-1,-1},
-{129,283,446,1186,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,234,348,448,1187,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,222,339,377,482,1188,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,66,171,180,230,371,389,1189,-1,-1,-1,-1,-1,-1},
-{1190,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,167,1191,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,369,494,1192,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,315,1193,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,308,369,494,1194,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,1195,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,260,304,1196,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{456,1197,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,126,148,171,236,389,1198,-1,-1,-1,-1,-1,-1,-1},
-{83,1199,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,157,202,302,1200,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,121,250,1201,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,496,1202,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,410,1203,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,145,218,416,1204,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{397,471,1205,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,437,1206,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,270,276,417,1207,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{376,1208,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,187,341,374,1209,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,224,300,1210,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,151,211,246,312,1211,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,200,222,234,1212,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,146,154,258,295,352,1213,-1,-1,-1,-1,-1,-1,-1},
-{1214,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,381,1215,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,322,1216,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,476,1217,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{458,1218,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,112,137,1219,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{296,1220,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1221,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,103,122,287,439,447,1222,-1,-1,-1,-1,-1,-1,-1},
-{280,1223,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{338,383,1224,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{101,237,1225,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,262,314,1226,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,58,94,162,224,438,1227,-1,-1,-1,-1,-1,-1,-1},
-{20,270,290,437,1228,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{184,1229,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,332,1230,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,1231,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{486,1232,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{227,336,454,1233,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,354,472,1234,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,351,421,490,1235,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,400,463,1236,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,71,114,144,193,253,306,1237,-1,-1,-1,-1,-1,-1},
-{118,1238,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,324,446,1239,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,1240,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,116,345,365,468,1241,-1,-1,-1,-1,-1,-1,-1,-1},
-{392,1242,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,1243,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,28,102,189,205,401,429,452,477,1244,-1,-1,-1,-1},
-{310,1245,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,319,490,1246,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,251,275,404,410,481,1247,-1,-1,-1,-1,-1,-1,-1},
-{215,250,284,447,490,1248,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,349,449,1249,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,223,378,483,1250,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,67,145,172,175,181,231,235,372,1251,-1,-1,-1,-1},
-{1252,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,168,1253,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,295,1254,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,316,1255,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,155,309,1256,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,1257,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{79,261,1258,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,457,1259,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,127,149,172,237,1260,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,1261,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,158,203,303,1262,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,251,1263,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,327,497,1264,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,411,1265,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,219,417,465,1266,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{398,472,1267,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{438,1268,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{164,271,277,418,1269,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,377,1270,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,188,342,1271,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,301,1272,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,152,212,247,313,315,1273,-1,-1,-1,-1,-1,-1,-1},
-{4,201,223,1274,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,147,259,296,353,1275,-1,-1,-1,-1,-1,-1,-1,-1},
-{1276,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,382,455,1277,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,323,1278,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,477,1279,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{290,459,1280,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,113,138,410,1281,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{297,1282,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,1283,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,123,288,300,448,1284,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,281,495,1285,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{315,339,384,1286,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{102,238,1287,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,263,1288,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,59,90,163,165,170,439,1289,-1,-1,-1,-1,-1,-1},
-{21,271,291,438,1290,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{335,485,1291,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,333,1292,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,1293,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,487,1294,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,337,345,420,1295,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,20,21,210,473,1296,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,352,422,491,1297,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{210,393,401,464,1298,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,72,194,254,307,1299,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,485,1300,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,447,1301,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,1302,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,346,366,469,1303,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{393,1304,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,430,1305,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,29,103,206,402,453,478,1306,-1,-1,-1,-1,-1,-1},
-{260,311,1307,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,345,491,1308,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,252,276,411,482,1309,-1,-1,-1,-1,-1,-1,-1,-1},
-{216,251,448,491,1310,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,109,130,1311,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{224,355,379,484,1312,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,110,146,173,176,182,205,232,236,373,400,470,485,1313},
-{305,1314,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,169,245,285,1315,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,296,1316,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,317,1317,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{107,156,1318,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{275,1319,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,1320,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,458,1321,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,128,173,238,1322,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1323,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,159,204,304,1324,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,252,465,1325,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,328,430,498,1326,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{342,412,1327,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,335,418,466,1328,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{399,473,1329,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,1330,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,180,272,278,290,330,419,1331,-1,-1,-1,-1,-1,-1},
-{86,378,1332,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,189,343,1333,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,302,1334,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,130,153,213,248,314,316,1335,-1,-1,-1,-1,-1,-1},
-{55,202,224,1336,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{148,150,297,354,1337,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1338,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,383,456,1339,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,1340,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,478,1341,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,291,1342,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,114,139,411,1343,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{298,1344,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{180,471,1345,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,289,301,449,1346,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,282,496,1347,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,1348,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,239,1349,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,120,264,1350,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,91,164,166,171,1351,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,272,292,439,1352,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{336,486,1353,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,334,1354,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,1355,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,265,375,488,1356,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{229,338,346,421,1357,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,21,22,211,474,1358,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,423,492,1359,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{211,394,402,405,1360,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,73,308,1361,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,486,1362,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,448,1363,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,1364,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{118,347,367,1365,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{394,1366,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,203,431,1367,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,104,207,403,440,454,479,1368,-1,-1,-1,-1,-1,-1},
-{261,312,1369,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,207,346,492,1370,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,277,412,483,1371,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,252,449,492,1372,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,131,1373,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,356,1374,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,111,147,174,177,183,206,233,237,374,401,471,486,1375},
-{306,480,1376,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,286,1377,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,297,1378,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,264,318,1379,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,125,157,1380,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,276,1381,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,1382,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,415,459,1383,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,174,239,1384,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{485,1385,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,1386,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,253,466,1387,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,329,431,499,1388,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,190,343,413,1389,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,148,195,336,419,467,1390,-1,-1,-1,-1,-1,-1,-1},
-{474,1391,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{495,1392,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,181,273,275,279,291,331,1393,-1,-1,-1,-1,-1,-1},
-{87,379,1394,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{344,1395,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{158,303,1396,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,131,150,154,214,220,249,317,1397,-1,-1,-1,-1,-1},
-{10,56,203,395,440,1398,-1,-1,-1,-1,-1,-1,-1,-1},
-{149,151,180,298,1399,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1400,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{166,384,457,1401,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1402,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,471,479,1403,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,155,292,1404,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,412,1405,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,1406,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,472,1407,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{302,1408,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,283,497,1409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,317,1410,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,140,390,1411,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,120,121,440,1412,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,92,167,172,280,290,1413,-1,-1,-1,-1,-1,-1,-1},
-{23,273,293,405,455,1414,-1,-1,-1,-1,-1,-1,-1,-1},
-{337,487,1415,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,1416,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{328,1417,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,266,300,365,376,489,1418,-1,-1,-1,-1,-1,-1,-1},
-{339,347,422,450,1419,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,22,23,212,1420,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,354,424,493,1421,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{212,403,406,1422,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,74,110,309,1423,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,487,1424,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,449,1425,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,55,1426,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,320,348,368,1427,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1428,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,204,432,1429,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,208,404,441,1430,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,313,1431,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,208,347,493,1432,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,254,278,335,340,413,484,1433,-1,-1,-1,-1,-1,-1},
-{218,253,350,493,1434,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,132,1435,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,357,470,1436,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,148,178,184,207,234,238,310,380,402,472,487,1437,-1},
-{307,481,1438,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,287,340,1439,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,65,298,1440,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{261,319,1441,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{109,126,158,1442,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,100,277,1443,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,1444,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{328,405,416,1445,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1446,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,486,1447,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,74,200,270,1448,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,467,1449,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,220,432,1450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{161,191,344,414,1451,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,149,196,337,468,1452,-1,-1,-1,-1,-1,-1,-1,-1},
-{475,1453,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{496,1454,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,182,274,276,292,332,1455,-1,-1,-1,-1,-1,-1,-1},
-{88,1456,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1457,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,304,1458,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,132,151,221,318,1459,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,57,204,396,441,1460,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,181,299,1461,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1462,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{167,320,458,1463,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,1464,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{245,306,472,1465,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,156,293,1466,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,413,1467,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1468,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,473,1469,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{300,303,1470,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,153,284,498,1471,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{306,318,1472,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,391,1473,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,121,122,310,441,455,1474,-1,-1,-1,-1,-1,-1,-1},
-{55,87,93,168,173,281,291,1475,-1,-1,-1,-1,-1,-1},
-{24,240,274,294,406,456,1476,-1,-1,-1,-1,-1,-1,-1},
-{85,338,455,460,488,1477,-1,-1,-1,-1,-1,-1,-1,-1},
-{177,1478,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{329,1479,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{178,267,301,366,377,1480,-1,-1,-1,-1,-1,-1,-1,-1},
-{348,423,451,1481,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,23,24,213,1482,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,494,1483,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{213,404,407,1484,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,111,1485,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{200,207,305,475,488,1486,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,1487,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,56,135,1488,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{321,349,369,1489,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1490,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,433,1491,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{205,209,442,1492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,263,314,325,1493,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,150,209,260,348,365,494,1494,-1,-1,-1,-1,-1,-1},
-{161,279,336,341,414,1495,-1,-1,-1,-1,-1,-1,-1,-1},
-{219,254,351,494,1496,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,133,1497,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,358,471,1498,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{113,149,179,208,239,311,381,403,473,488,1499,-1,-1,-1},
-{308,482,1500,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,288,341,1501,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,299,1502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,1503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,159,1504,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,101,278,1505,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{430,1506,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{329,406,417,1507,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1508,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,487,1509,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,201,271,1510,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{468,1511,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,221,433,460,1512,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,190,192,305,380,1513,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,197,338,469,1514,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{45,80,476,1515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{495,497,1516,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,183,277,293,333,1517,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,1518,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{380,1519,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1520,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,133,152,222,319,1521,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,58,397,442,1522,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,153,182,1523,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{255,1524,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,321,459,1525,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,485,1526,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,307,473,1527,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,157,294,380,1528,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{414,1529,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1530,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{183,474,1531,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,70,301,304,1532,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,154,190,499,1533,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,307,319,490,1534,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,255,392,1535,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,123,311,442,456,465,1536,-1,-1,-1,-1,-1,-1,-1},
-{56,60,88,94,169,174,282,292,1537,-1,-1,-1,-1,-1},
-{241,407,457,1538,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,86,339,435,456,461,489,1539,-1,-1,-1,-1,-1,-1},
-{178,495,1540,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,1541,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,268,302,367,378,1542,-1,-1,-1,-1,-1,-1,-1,-1},
-{349,424,452,1543,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,24,55,214,1544,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,1545,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{214,408,1546,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,1547,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,208,220,306,476,489,1548,-1,-1,-1,-1,-1,-1,-1},
-{1549,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,136,195,290,1550,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{322,1551,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1552,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,434,1553,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{206,443,1554,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,264,295,326,1555,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,100,151,261,349,366,1556,-1,-1,-1,-1,-1,-1,-1},
-{162,337,342,1557,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,352,1558,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,134,250,1559,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,359,472,1560,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,209,312,382,404,474,489,1561,-1,-1,-1,-1,-1,-1},
-{155,309,483,1562,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,289,342,1563,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,67,185,390,1564,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,1565,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{128,385,1566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,102,279,1567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{431,1568,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,407,418,1569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{80,1570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,488,1571,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,202,250,272,1572,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{469,1573,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,434,461,1574,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,191,193,306,381,385,480,1575,-1,-1,-1,-1,-1,-1},
-{143,198,320,339,1576,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,80,81,477,1577,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{496,498,1578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,184,278,294,334,1579,-1,-1,-1,-1,-1,-1,-1,-1},
-{1580,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{381,1581,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,1582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,134,153,223,1583,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,59,398,443,1584,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,154,183,1585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,256,465,1586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,322,1587,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{227,435,465,486,1588,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,308,474,1589,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,158,381,1590,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{260,1591,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1592,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{184,1593,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,71,302,1594,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,191,1595,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,308,491,1596,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,256,393,1597,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,124,312,443,457,466,1598,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixV_5_16[1600][9]={
-{287,336,127,527,531,683,-1,-1,-1},
-{349,398,189,589,593,745,-1,-1,-1},
-{411,460,251,651,655,807,-1,-1,-1},
-{473,522,313,713,717,869,-1,-1,-1},
-{535,584,375,775,779,931,-1,-1,-1},
-{185,195,283,765,-1,-1,-1,-1,-1},
-{247,257,345,827,-1,-1,-1,-1,-1},
-{309,319,407,889,-1,-1,-1,-1,-1},
-{371,381,469,951,-1,-1,-1,-1,-1},
-{433,443,531,1013,-1,-1,-1,-1,-1},
-{504,797,899,-1,-1,-1,-1,-1,-1},
-{566,859,961,-1,-1,-1,-1,-1,-1},
-{628,921,1023,-1,-1,-1,-1,-1,-1},
-{690,983,1085,-1,-1,-1,-1,-1,-1},
-{752,1045,47,-1,-1,-1,-1,-1,-1},
-{46,103,740,-1,-1,-1,-1,-1,-1},
-{108,165,802,-1,-1,-1,-1,-1,-1},
-{170,227,864,-1,-1,-1,-1,-1,-1},
-{232,289,926,-1,-1,-1,-1,-1,-1},
-{294,351,988,-1,-1,-1,-1,-1,-1},
-{113,207,313,530,729,735,797,1022,1065},
-{175,269,375,592,791,797,859,1084,27},
-{237,331,437,654,853,859,921,46,89},
-{299,393,499,716,915,921,983,108,151},
-{361,455,561,778,977,983,1045,170,213},
-{115,212,318,404,438,559,741,1024,1083},
-{177,274,380,466,500,621,803,1086,45},
-{239,336,442,528,562,683,865,48,107},
-{301,398,504,590,624,745,927,110,169},
-{363,460,566,652,686,807,989,172,231},
-{542,237,327,475,528,575,-1,-1,-1},
-{604,299,389,537,590,637,-1,-1,-1},
-{666,361,451,599,652,699,-1,-1,-1},
-{728,423,513,661,714,761,-1,-1,-1},
-{790,485,575,723,776,823,-1,-1,-1},
-{568,738,1087,-1,-1,-1,-1,-1,-1},
-{630,800,49,-1,-1,-1,-1,-1,-1},
-{692,862,111,-1,-1,-1,-1,-1,-1},
-{754,924,173,-1,-1,-1,-1,-1,-1},
-{816,986,235,-1,-1,-1,-1,-1,-1},
-{56,61,93,150,253,269,416,832,949},
-{118,123,155,212,315,331,478,894,1011},
-{180,185,217,274,377,393,540,956,1073},
-{242,247,279,336,439,455,602,1018,35},
-{304,309,341,398,501,517,664,1080,97},
-{457,510,994,1016,-1,-1,-1,-1,-1},
-{519,572,1056,1078,-1,-1,-1,-1,-1},
-{581,634,18,40,-1,-1,-1,-1,-1},
-{643,696,80,102,-1,-1,-1,-1,-1},
-{705,758,142,164,-1,-1,-1,-1,-1},
-{69,183,237,843,948,-1,-1,-1,-1},
-{131,245,299,905,1010,-1,-1,-1,-1},
-{193,307,361,967,1072,-1,-1,-1,-1},
-{255,369,423,1029,34,-1,-1,-1,-1},
-{317,431,485,1091,96,-1,-1,-1,-1},
-{51,155,362,542,837,922,927,976,1045},
-{113,217,424,604,899,984,989,1038,7},
-{175,279,486,666,961,1046,1051,0,69},
-{237,341,548,728,1023,8,13,62,131},
-{299,403,610,790,1085,70,75,124,193},
-{9,359,415,693,882,1033,1038,-1,-1},
-{71,421,477,755,944,1095,0,-1,-1},
-{133,483,539,817,1006,57,62,-1,-1},
-{195,545,601,879,1068,119,124,-1,-1},
-{257,607,663,941,30,181,186,-1,-1},
-{188,234,252,357,503,628,712,812,941},
-{250,296,314,419,565,690,774,874,1003},
-{312,358,376,481,627,752,836,936,1065},
-{374,420,438,543,689,814,898,998,27},
-{436,482,500,605,751,876,960,1060,89},
-{185,296,676,701,720,727,875,972,1033},
-{247,358,738,763,782,789,937,1034,1095},
-{309,420,800,825,844,851,999,1096,57},
-{371,482,862,887,906,913,1061,58,119},
-{433,544,924,949,968,975,23,120,181},
-{5,72,459,152,511,-1,-1,-1,-1},
-{67,134,521,214,573,-1,-1,-1,-1},
-{129,196,583,276,635,-1,-1,-1,-1},
-{191,258,645,338,697,-1,-1,-1,-1},
-{253,320,707,400,759,-1,-1,-1,-1},
-{128,152,514,1016,1040,1071,1078,-1,-1},
-{190,214,576,1078,2,33,40,-1,-1},
-{252,276,638,40,64,95,102,-1,-1},
-{314,338,700,102,126,157,164,-1,-1},
-{376,400,762,164,188,219,226,-1,-1},
-{24,409,494,545,771,852,871,978,-1},
-{86,471,556,607,833,914,933,1040,-1},
-{148,533,618,669,895,976,995,2,-1},
-{210,595,680,731,957,1038,1057,64,-1},
-{272,657,742,793,1019,0,19,126,-1},
-{28,318,480,790,-1,-1,-1,-1,-1},
-{90,380,542,852,-1,-1,-1,-1,-1},
-{152,442,604,914,-1,-1,-1,-1,-1},
-{214,504,666,976,-1,-1,-1,-1,-1},
-{276,566,728,1038,-1,-1,-1,-1,-1},
-{90,342,377,394,414,418,-1,-1,-1},
-{152,404,439,456,476,480,-1,-1,-1},
-{214,466,501,518,538,542,-1,-1,-1},
-{276,528,563,580,600,604,-1,-1,-1},
-{338,590,625,642,662,666,-1,-1,-1},
-{58,87,316,358,537,621,664,944,1057},
-{120,149,378,420,599,683,726,1006,19},
-{182,211,440,482,661,745,788,1068,81},
-{244,273,502,544,723,807,850,30,143},
-{306,335,564,606,785,869,912,92,205},
-{58,90,130,454,306,387,564,695,-1},
-{120,152,192,516,368,449,626,757,-1},
-{182,214,254,578,430,511,688,819,-1},
-{244,276,316,640,492,573,750,881,-1},
-{306,338,378,702,554,635,812,943,-1},
-{50,148,353,490,596,814,924,-1,-1},
-{112,210,415,552,658,876,986,-1,-1},
-{174,272,477,614,720,938,1048,-1,-1},
-{236,334,539,676,782,1000,10,-1,-1},
-{298,396,601,738,844,1062,72,-1,-1},
-{140,553,680,-1,-1,-1,-1,-1,-1},
-{202,615,742,-1,-1,-1,-1,-1,-1},
-{264,677,804,-1,-1,-1,-1,-1,-1},
-{326,739,866,-1,-1,-1,-1,-1,-1},
-{388,801,928,-1,-1,-1,-1,-1,-1},
-{88,351,599,640,851,913,-1,-1,-1},
-{150,413,661,702,913,975,-1,-1,-1},
-{212,475,723,764,975,1037,-1,-1,-1},
-{274,537,785,826,1037,1099,-1,-1,-1},
-{336,599,847,888,1099,61,-1,-1,-1},
-{52,87,145,233,323,439,637,881,-1},
-{114,149,207,295,385,501,699,943,-1},
-{176,211,269,357,447,563,761,1005,-1},
-{238,273,331,419,509,625,823,1067,-1},
-{300,335,393,481,571,687,885,29,-1},
-{65,216,255,417,418,812,836,1059,-1},
-{127,278,317,479,480,874,898,21,-1},
-{189,340,379,541,542,936,960,83,-1},
-{251,402,441,603,604,998,1022,145,-1},
-{313,464,503,665,666,1060,1084,207,-1},
-{67,596,989,-1,-1,-1,-1,-1,-1},
-{129,658,1051,-1,-1,-1,-1,-1,-1},
-{191,720,13,-1,-1,-1,-1,-1,-1},
-{253,782,75,-1,-1,-1,-1,-1,-1},
-{315,844,137,-1,-1,-1,-1,-1,-1},
-{340,81,216,313,912,891,490,-1,-1},
-{402,143,278,375,974,953,552,-1,-1},
-{464,205,340,437,1036,1015,614,-1,-1},
-{526,267,402,499,1098,1077,676,-1,-1},
-{588,329,464,561,60,39,738,-1,-1},
-{36,196,269,513,652,705,752,-1,-1},
-{98,258,331,575,714,767,814,-1,-1},
-{160,320,393,637,776,829,876,-1,-1},
-{222,382,455,699,838,891,938,-1,-1},
-{284,444,517,761,900,953,1000,-1,-1},
-{51,267,466,650,786,838,898,995,1035},
-{113,329,528,712,848,900,960,1057,1097},
-{175,391,590,774,910,962,1022,19,59},
-{237,453,652,836,972,1024,1084,81,121},
-{299,515,714,898,1034,1086,46,143,183},
-{577,711,757,905,1063,-1,-1,-1,-1},
-{639,773,819,967,25,-1,-1,-1,-1},
-{701,835,881,1029,87,-1,-1,-1,-1},
-{763,897,943,1091,149,-1,-1,-1,-1},
-{825,959,1005,53,211,-1,-1,-1,-1},
-{158,333,522,604,890,934,1042,-1,-1},
-{220,395,584,666,952,996,4,-1,-1},
-{282,457,646,728,1014,1058,66,-1,-1},
-{344,519,708,790,1076,20,128,-1,-1},
-{406,581,770,852,38,82,190,-1,-1},
-{88,369,568,790,840,-1,-1,-1,-1},
-{150,431,630,852,902,-1,-1,-1,-1},
-{212,493,692,914,964,-1,-1,-1,-1},
-{274,555,754,976,1026,-1,-1,-1,-1},
-{336,617,816,1038,1088,-1,-1,-1,-1},
-{370,434,586,628,637,790,-1,-1,-1},
-{432,496,648,690,699,852,-1,-1,-1},
-{494,558,710,752,761,914,-1,-1,-1},
-{556,620,772,814,823,976,-1,-1,-1},
-{618,682,834,876,885,1038,-1,-1,-1},
-{98,143,178,417,532,752,795,855,-1},
-{160,205,240,479,594,814,857,917,-1},
-{222,267,302,541,656,876,919,979,-1},
-{284,329,364,603,718,938,981,1041,-1},
-{346,391,426,665,780,1000,1043,3,-1},
-{324,482,690,832,846,900,-1,-1,-1},
-{386,544,752,894,908,962,-1,-1,-1},
-{448,606,814,956,970,1024,-1,-1,-1},
-{510,668,876,1018,1032,1086,-1,-1,-1},
-{572,730,938,1080,1094,48,-1,-1,-1},
-{264,352,428,497,586,1065,-1,-1,-1},
-{326,414,490,559,648,27,-1,-1,-1},
-{388,476,552,621,710,89,-1,-1,-1},
-{450,538,614,683,772,151,-1,-1,-1},
-{512,600,676,745,834,213,-1,-1,-1},
-{87,368,552,868,890,1014,1034,-1,-1},
-{149,430,614,930,952,1076,1096,-1,-1},
-{211,492,676,992,1014,38,58,-1,-1},
-{273,554,738,1054,1076,100,120,-1,-1},
-{335,616,800,16,38,162,182,-1,-1},
-{8,87,98,196,356,359,891,1051,-1},
-{70,149,160,258,418,421,953,13,-1},
-{132,211,222,320,480,483,1015,75,-1},
-{194,273,284,382,542,545,1077,137,-1},
-{256,335,346,444,604,607,39,199,-1},
-{577,682,713,949,987,-1,-1,-1,-1},
-{639,744,775,1011,1049,-1,-1,-1,-1},
-{701,806,837,1073,11,-1,-1,-1,-1},
-{763,868,899,35,73,-1,-1,-1,-1},
-{825,930,961,97,135,-1,-1,-1,-1},
-{246,386,745,747,814,863,993,-1,-1},
-{308,448,807,809,876,925,1055,-1,-1},
-{370,510,869,871,938,987,17,-1,-1},
-{432,572,931,933,1000,1049,79,-1,-1},
-{494,634,993,995,1062,11,141,-1,-1},
-{160,217,799,650,797,-1,-1,-1,-1},
-{222,279,861,712,859,-1,-1,-1,-1},
-{284,341,923,774,921,-1,-1,-1,-1},
-{346,403,985,836,983,-1,-1,-1,-1},
-{408,465,1047,898,1045,-1,-1,-1,-1},
-{402,519,749,-1,-1,-1,-1,-1,-1},
-{464,581,811,-1,-1,-1,-1,-1,-1},
-{526,643,873,-1,-1,-1,-1,-1,-1},
-{588,705,935,-1,-1,-1,-1,-1,-1},
-{650,767,997,-1,-1,-1,-1,-1,-1},
-{463,480,550,562,565,589,898,951,1049},
-{525,542,612,624,627,651,960,1013,11},
-{587,604,674,686,689,713,1022,1075,73},
-{649,666,736,748,751,775,1084,37,135},
-{711,728,798,810,813,837,46,99,197},
-{111,280,610,965,-1,-1,-1,-1,-1},
-{173,342,672,1027,-1,-1,-1,-1,-1},
-{235,404,734,1089,-1,-1,-1,-1,-1},
-{297,466,796,51,-1,-1,-1,-1,-1},
-{359,528,858,113,-1,-1,-1,-1,-1},
-{52,690,373,440,465,-1,-1,-1,-1},
-{114,752,435,502,527,-1,-1,-1,-1},
-{176,814,497,564,589,-1,-1,-1,-1},
-{238,876,559,626,651,-1,-1,-1,-1},
-{300,938,621,688,713,-1,-1,-1,-1},
-{48,171,284,286,602,637,752,-1,-1},
-{110,233,346,348,664,699,814,-1,-1},
-{172,295,408,410,726,761,876,-1,-1},
-{234,357,470,472,788,823,938,-1,-1},
-{296,419,532,534,850,885,1000,-1,-1},
-{64,68,183,233,388,977,-1,-1,-1},
-{126,130,245,295,450,1039,-1,-1,-1},
-{188,192,307,357,512,1,-1,-1,-1},
-{250,254,369,419,574,63,-1,-1,-1},
-{312,316,431,481,636,125,-1,-1,-1},
-{95,148,160,359,650,816,966,-1,-1},
-{157,210,222,421,712,878,1028,-1,-1},
-{219,272,284,483,774,940,1090,-1,-1},
-{281,334,346,545,836,1002,52,-1,-1},
-{343,396,408,607,898,1064,114,-1,-1},
-{220,222,552,686,702,749,1060,1073,-1},
-{282,284,614,748,764,811,22,35,-1},
-{344,346,676,810,826,873,84,97,-1},
-{406,408,738,872,888,935,146,159,-1},
-{468,470,800,934,950,997,208,221,-1},
-{142,214,372,423,528,1025,1036,-1,-1},
-{204,276,434,485,590,1087,1098,-1,-1},
-{266,338,496,547,652,49,60,-1,-1},
-{328,400,558,609,714,111,122,-1,-1},
-{390,462,620,671,776,173,184,-1,-1},
-{8,210,603,632,697,808,880,995,1092},
-{70,272,665,694,759,870,942,1057,54},
-{132,334,727,756,821,932,1004,19,116},
-{194,396,789,818,883,994,1066,81,178},
-{256,458,851,880,945,1056,28,143,240},
-{26,59,857,-1,-1,-1,-1,-1,-1},
-{88,121,919,-1,-1,-1,-1,-1,-1},
-{150,183,981,-1,-1,-1,-1,-1,-1},
-{212,245,1043,-1,-1,-1,-1,-1,-1},
-{274,307,5,-1,-1,-1,-1,-1,-1},
-{144,160,184,708,729,949,-1,-1,-1},
-{206,222,246,770,791,1011,-1,-1,-1},
-{268,284,308,832,853,1073,-1,-1,-1},
-{330,346,370,894,915,35,-1,-1,-1},
-{392,408,432,956,977,97,-1,-1,-1},
-{365,646,894,150,139,748,820,-1,-1},
-{427,708,956,212,201,810,882,-1,-1},
-{489,770,1018,274,263,872,944,-1,-1},
-{551,832,1080,336,325,934,1006,-1,-1},
-{613,894,42,398,387,996,1068,-1,-1},
-{63,329,159,406,724,914,501,115,-1},
-{125,391,221,468,786,976,563,177,-1},
-{187,453,283,530,848,1038,625,239,-1},
-{249,515,345,592,910,0,687,301,-1},
-{311,577,407,654,972,62,749,363,-1},
-{175,816,599,-1,-1,-1,-1,-1,-1},
-{237,878,661,-1,-1,-1,-1,-1,-1},
-{299,940,723,-1,-1,-1,-1,-1,-1},
-{361,1002,785,-1,-1,-1,-1,-1,-1},
-{423,1064,847,-1,-1,-1,-1,-1,-1},
-{37,429,729,781,832,914,1051,-1,-1},
-{99,491,791,843,894,976,13,-1,-1},
-{161,553,853,905,956,1038,75,-1,-1},
-{223,615,915,967,1018,0,137,-1,-1},
-{285,677,977,1029,1080,62,199,-1,-1},
-{56,90,110,197,379,659,714,755,1056},
-{118,152,172,259,441,721,776,817,18},
-{180,214,234,321,503,783,838,879,80},
-{242,276,296,383,565,845,900,941,142},
-{304,338,358,445,627,907,962,1003,204},
-{449,577,711,785,919,971,-1,-1,-1},
-{511,639,773,847,981,1033,-1,-1,-1},
-{573,701,835,909,1043,1095,-1,-1,-1},
-{635,763,897,971,5,57,-1,-1,-1},
-{697,825,959,1033,67,119,-1,-1,-1},
-{385,509,676,815,904,911,987,1014,-1},
-{447,571,738,877,966,973,1049,1076,-1},
-{509,633,800,939,1028,1035,11,38,-1},
-{571,695,862,1001,1090,1097,73,100,-1},
-{633,757,924,1063,52,59,135,162,-1},
-{73,133,243,479,588,746,938,975,-1},
-{135,195,305,541,650,808,1000,1037,-1},
-{197,257,367,603,712,870,1062,1099,-1},
-{259,319,429,665,774,932,24,61,-1},
-{321,381,491,727,836,994,86,123,-1},
-{6,55,123,243,370,499,694,774,787},
-{68,117,185,305,432,561,756,836,849},
-{130,179,247,367,494,623,818,898,911},
-{192,241,309,429,556,685,880,960,973},
-{254,303,371,491,618,747,942,1022,1035},
-{207,384,492,593,314,928,964,1077,-1},
-{269,446,554,655,376,990,1026,39,-1},
-{331,508,616,717,438,1052,1088,101,-1},
-{393,570,678,779,500,14,50,163,-1},
-{455,632,740,841,562,76,112,225,-1},
-{641,732,760,994,-1,-1,-1,-1,-1},
-{703,794,822,1056,-1,-1,-1,-1,-1},
-{765,856,884,18,-1,-1,-1,-1,-1},
-{827,918,946,80,-1,-1,-1,-1,-1},
-{889,980,1008,142,-1,-1,-1,-1,-1},
-{172,188,607,832,-1,-1,-1,-1,-1},
-{234,250,669,894,-1,-1,-1,-1,-1},
-{296,312,731,956,-1,-1,-1,-1,-1},
-{358,374,793,1018,-1,-1,-1,-1,-1},
-{420,436,855,1080,-1,-1,-1,-1,-1},
-{55,71,441,539,672,792,829,934,-1},
-{117,133,503,601,734,854,891,996,-1},
-{179,195,565,663,796,916,953,1058,-1},
-{241,257,627,725,858,978,1015,20,-1},
-{303,319,689,787,920,1040,1077,82,-1},
-{40,412,648,704,934,940,1070,-1,-1},
-{102,474,710,766,996,1002,32,-1,-1},
-{164,536,772,828,1058,1064,94,-1,-1},
-{226,598,834,890,20,26,156,-1,-1},
-{288,660,896,952,82,88,218,-1,-1},
-{45,374,502,742,796,809,10,-1,-1},
-{107,436,564,804,858,871,72,-1,-1},
-{169,498,626,866,920,933,134,-1,-1},
-{231,560,688,928,982,995,196,-1,-1},
-{293,622,750,990,1044,1057,258,-1,-1},
-{33,487,590,674,935,342,-1,-1,-1},
-{95,549,652,736,997,404,-1,-1,-1},
-{157,611,714,798,1059,466,-1,-1,-1},
-{219,673,776,860,21,528,-1,-1,-1},
-{281,735,838,922,83,590,-1,-1,-1},
-{272,374,813,-1,-1,-1,-1,-1,-1},
-{334,436,875,-1,-1,-1,-1,-1,-1},
-{396,498,937,-1,-1,-1,-1,-1,-1},
-{458,560,999,-1,-1,-1,-1,-1,-1},
-{520,622,1061,-1,-1,-1,-1,-1,-1},
-{154,200,276,-1,-1,-1,-1,-1,-1},
-{216,262,338,-1,-1,-1,-1,-1,-1},
-{278,324,400,-1,-1,-1,-1,-1,-1},
-{340,386,462,-1,-1,-1,-1,-1,-1},
-{402,448,524,-1,-1,-1,-1,-1,-1},
-{5,33,170,294,445,447,742,919,995},
-{67,95,232,356,507,509,804,981,1057},
-{129,157,294,418,569,571,866,1043,19},
-{191,219,356,480,631,633,928,5,81},
-{253,281,418,542,693,695,990,67,143},
-{349,462,628,-1,-1,-1,-1,-1,-1},
-{411,524,690,-1,-1,-1,-1,-1,-1},
-{473,586,752,-1,-1,-1,-1,-1,-1},
-{535,648,814,-1,-1,-1,-1,-1,-1},
-{597,710,876,-1,-1,-1,-1,-1,-1},
-{128,151,293,396,565,647,857,-1,-1},
-{190,213,355,458,627,709,919,-1,-1},
-{252,275,417,520,689,771,981,-1,-1},
-{314,337,479,582,751,833,1043,-1,-1},
-{376,399,541,644,813,895,5,-1,-1},
-{115,226,262,539,654,938,1014,1020,1029},
-{177,288,324,601,716,1000,1076,1082,1091},
-{239,350,386,663,778,1062,38,44,53},
-{301,412,448,725,840,24,100,106,115},
-{363,474,510,787,902,86,162,168,177},
-{69,285,363,414,423,442,451,1067,1076},
-{131,347,425,476,485,504,513,29,38},
-{193,409,487,538,547,566,575,91,100},
-{255,471,549,600,609,628,637,153,162},
-{317,533,611,662,671,690,699,215,224},
-{186,277,316,613,619,912,1065,-1,-1},
-{248,339,378,675,681,974,27,-1,-1},
-{310,401,440,737,743,1036,89,-1,-1},
-{372,463,502,799,805,1098,151,-1,-1},
-{434,525,564,861,867,60,213,-1,-1},
-{93,420,438,582,899,-1,-1,-1,-1},
-{155,482,500,644,961,-1,-1,-1,-1},
-{217,544,562,706,1023,-1,-1,-1,-1},
-{279,606,624,768,1085,-1,-1,-1,-1},
-{341,668,686,830,47,-1,-1,-1,-1},
-{500,683,737,814,-1,-1,-1,-1,-1},
-{562,745,799,876,-1,-1,-1,-1,-1},
-{624,807,861,938,-1,-1,-1,-1,-1},
-{686,869,923,1000,-1,-1,-1,-1,-1},
-{748,931,985,1062,-1,-1,-1,-1,-1},
-{175,266,269,331,861,915,946,-1,-1},
-{237,328,331,393,923,977,1008,-1,-1},
-{299,390,393,455,985,1039,1070,-1,-1},
-{361,452,455,517,1047,1,32,-1,-1},
-{423,514,517,579,9,63,94,-1,-1},
-{421,704,748,782,-1,-1,-1,-1,-1},
-{483,766,810,844,-1,-1,-1,-1,-1},
-{545,828,872,906,-1,-1,-1,-1,-1},
-{607,890,934,968,-1,-1,-1,-1,-1},
-{669,952,996,1030,-1,-1,-1,-1,-1},
-{133,339,366,375,413,584,643,884,-1},
-{195,401,428,437,475,646,705,946,-1},
-{257,463,490,499,537,708,767,1008,-1},
-{319,525,552,561,599,770,829,1070,-1},
-{381,587,614,623,661,832,891,32,-1},
-{79,98,151,384,433,674,796,-1,-1},
-{141,160,213,446,495,736,858,-1,-1},
-{203,222,275,508,557,798,920,-1,-1},
-{265,284,337,570,619,860,982,-1,-1},
-{327,346,399,632,681,922,1044,-1,-1},
-{149,258,418,497,209,98,-1,-1,-1},
-{211,320,480,559,271,160,-1,-1,-1},
-{273,382,542,621,333,222,-1,-1,-1},
-{335,444,604,683,395,284,-1,-1,-1},
-{397,506,666,745,457,346,-1,-1,-1},
-{433,806,827,1007,-1,-1,-1,-1,-1},
-{495,868,889,1069,-1,-1,-1,-1,-1},
-{557,930,951,31,-1,-1,-1,-1,-1},
-{619,992,1013,93,-1,-1,-1,-1,-1},
-{681,1054,1075,155,-1,-1,-1,-1,-1},
-{328,475,542,583,605,1040,1089,-1,-1},
-{390,537,604,645,667,2,51,-1,-1},
-{452,599,666,707,729,64,113,-1,-1},
-{514,661,728,769,791,126,175,-1,-1},
-{576,723,790,831,853,188,237,-1,-1},
-{349,869,899,913,-1,-1,-1,-1,-1},
-{411,931,961,975,-1,-1,-1,-1,-1},
-{473,993,1023,1037,-1,-1,-1,-1,-1},
-{535,1055,1085,1099,-1,-1,-1,-1,-1},
-{597,17,47,61,-1,-1,-1,-1,-1},
-{50,67,75,321,353,502,599,625,678},
-{112,129,137,383,415,564,661,687,740},
-{174,191,199,445,477,626,723,749,802},
-{236,253,261,507,539,688,785,811,864},
-{298,315,323,569,601,750,847,873,926},
-{486,621,920,-1,-1,-1,-1,-1,-1},
-{548,683,982,-1,-1,-1,-1,-1,-1},
-{610,745,1044,-1,-1,-1,-1,-1,-1},
-{672,807,6,-1,-1,-1,-1,-1,-1},
-{734,869,68,-1,-1,-1,-1,-1,-1},
-{348,392,533,636,778,915,975,978,-1},
-{410,454,595,698,840,977,1037,1040,-1},
-{472,516,657,760,902,1039,1099,2,-1},
-{534,578,719,822,964,1,61,64,-1},
-{596,640,781,884,1026,63,123,126,-1},
-{190,551,978,1013,-1,-1,-1,-1,-1},
-{252,613,1040,1075,-1,-1,-1,-1,-1},
-{314,675,2,37,-1,-1,-1,-1,-1},
-{376,737,64,99,-1,-1,-1,-1,-1},
-{438,799,126,161,-1,-1,-1,-1,-1},
-{142,227,340,556,767,826,1037,1087,1089},
-{204,289,402,618,829,888,1099,49,51},
-{266,351,464,680,891,950,61,111,113},
-{328,413,526,742,953,1012,123,173,175},
-{390,475,588,804,1015,1074,185,235,237},
-{141,170,611,644,784,814,842,937,-1},
-{203,232,673,706,846,876,904,999,-1},
-{265,294,735,768,908,938,966,1061,-1},
-{327,356,797,830,970,1000,1028,23,-1},
-{389,418,859,892,1032,1062,1090,85,-1},
-{20,88,621,656,954,987,-1,-1,-1},
-{82,150,683,718,1016,1049,-1,-1,-1},
-{144,212,745,780,1078,11,-1,-1,-1},
-{206,274,807,842,40,73,-1,-1,-1},
-{268,336,869,904,102,135,-1,-1,-1},
-{405,565,686,877,1076,-1,-1,-1,-1},
-{467,627,748,939,38,-1,-1,-1,-1},
-{529,689,810,1001,100,-1,-1,-1,-1},
-{591,751,872,1063,162,-1,-1,-1,-1},
-{653,813,934,25,224,-1,-1,-1,-1},
-{127,135,193,671,792,801,814,886,1027},
-{189,197,255,733,854,863,876,948,1089},
-{251,259,317,795,916,925,938,1010,51},
-{313,321,379,857,978,987,1000,1072,113},
-{375,383,441,919,1040,1049,1062,34,175},
-{125,133,275,445,447,736,747,749,1035},
-{187,195,337,507,509,798,809,811,1097},
-{249,257,399,569,571,860,871,873,59},
-{311,319,461,631,633,922,933,935,121},
-{373,381,523,693,695,984,995,997,183},
-{98,155,206,641,786,893,1017,1041,-1},
-{160,217,268,703,848,955,1079,3,-1},
-{222,279,330,765,910,1017,41,65,-1},
-{284,341,392,827,972,1079,103,127,-1},
-{346,403,454,889,1034,41,165,189,-1},
-{0,1,-1,-1,-1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1,-1,-1,-1},
-{199,200,-1,-1,-1,-1,-1,-1,-1},
-{200,201,-1,-1,-1,-1,-1,-1,-1},
-{201,202,-1,-1,-1,-1,-1,-1,-1},
-{202,203,-1,-1,-1,-1,-1,-1,-1},
-{203,204,-1,-1,-1,-1,-1,-1,-1},
-{204,205,-1,-1,-1,-1,-1,-1,-1},
-{205,206,-1,-1,-1,-1,-1,-1,-1},
-{206,207,-1,-1,-1,-1,-1,-1,-1},
-{207,208,-1,-1,-1,-1,-1,-1,-1},
-{208,209,-1,-1,-1,-1,-1,-1,-1},
-{209,210,-1,-1,-1,-1,-1,-1,-1},
-{210,211,-1,-1,-1,-1,-1,-1,-1},
-{211,212,-1,-1,-1,-1,-1,-1,-1},
-{212,213,-1,-1,-1,-1,-1,-1,-1},
-{213,214,-1,-1,-1,-1,-1,-1,-1},
-{214,215,-1,-1,-1,-1,-1,-1,-1},
-{215,216,-1,-1,-1,-1,-1,-1,-1},
-{216,217,-1,-1,-1,-1,-1,-1,-1},
-{217,218,-1,-1,-1,-1,-1,-1,-1},
-{218,219,-1,-1,-1,-1,-1,-1,-1},
-{219,220,-1,-1,-1,-1,-1,-1,-1},
-{220,221,-1,-1,-1,-1,-1,-1,-1},
-{221,222,-1,-1,-1,-1,-1,-1,-1},
-{222,223,-1,-1,-1,-1,-1,-1,-1},
-{223,224,-1,-1,-1,-1,-1,-1,-1},
-{224,225,-1,-1,-1,-1,-1,-1,-1},
-{225,226,-1,-1,-1,-1,-1,-1,-1},
-{226,227,-1,-1,-1,-1,-1,-1,-1},
-{227,228,-1,-1,-1,-1,-1,-1,-1},
-{228,229,-1,-1,-1,-1,-1,-1,-1},
-{229,230,-1,-1,-1,-1,-1,-1,-1},
-{230,231,-1,-1,-1,-1,-1,-1,-1},
-{231,232,-1,-1,-1,-1,-1,-1,-1},
-{232,233,-1,-1,-1,-1,-1,-1,-1},
-{233,234,-1,-1,-1,-1,-1,-1,-1},
-{234,235,-1,-1,-1,-1,-1,-1,-1},
-{235,236,-1,-1,-1,-1,-1,-1,-1},
-{236,237,-1,-1,-1,-1,-1,-1,-1},
-{237,238,-1,-1,-1,-1,-1,-1,-1},
-{238,239,-1,-1,-1,-1,-1,-1,-1},
-{239,240,-1,-1,-1,-1,-1,-1,-1},
-{240,241,-1,-1,-1,-1,-1,-1,-1},
-{241,242,-1,-1,-1,-1,-1,-1,-1},
-{242,243,-1,-1,-1,-1,-1,-1,-1},
-{243,244,-1,-1,-1,-1,-1,-1,-1},
-{244,245,-1,-1,-1,-1,-1,-1,-1},
-{245,246,-1,-1,-1,-1,-1,-1,-1},
-{246,247,-1,-1,-1,-1,-1,-1,-1},
-{247,248,-1,-1,-1,-1,-1,-1,-1},
-{248,249,-1,-1,-1,-1,-1,-1,-1},
-{249,250,-1,-1,-1,-1,-1,-1,-1},
-{250,251,-1,-1,-1,-1,-1,-1,-1},
-{251,252,-1,-1,-1,-1,-1,-1,-1},
-{252,253,-1,-1,-1,-1,-1,-1,-1},
-{253,254,-1,-1,-1,-1,-1,-1,-1},
-{254,255,-1,-1,-1,-1,-1,-1,-1},
-{255,256,-1,-1,-1,-1,-1,-1,-1},
-{256,257,-1,-1,-1,-1,-1,-1,-1},
-{257,258,-1,-1,-1,-1,-1,-1,-1},
-{258,259,-1,-1,-1,-1,-1,-1,-1},
-{259,260,-1,-1,-1,-1,-1,-1,-1},
-{260,261,-1,-1,-1,-1,-1,-1,-1},
-{261,262,-1,-1,-1,-1,-1,-1,-1},
-{262,263,-1,-1,-1,-1,-1,-1,-1},
-{263,264,-1,-1,-1,-1,-1,-1,-1},
-{264,265,-1,-1,-1,-1,-1,-1,-1},
-{265,266,-1,-1,-1,-1,-1,-1,-1},
-{266,267,-1,-1,-1,-1,-1,-1,-1},
-{267,268,-1,-1,-1,-1,-1,-1,-1},
-{268,269,-1,-1,-1,-1,-1,-1,-1},
-{269,270,-1,-1,-1,-1,-1,-1,-1},
-{270,271,-1,-1,-1,-1,-1,-1,-1},
-{271,272,-1,-1,-1,-1,-1,-1,-1},
-{272,273,-1,-1,-1,-1,-1,-1,-1},
-{273,274,-1,-1,-1,-1,-1,-1,-1},
-{274,275,-1,-1,-1,-1,-1,-1,-1},
-{275,276,-1,-1,-1,-1,-1,-1,-1},
-{276,277,-1,-1,-1,-1,-1,-1,-1},
-{277,278,-1,-1,-1,-1,-1,-1,-1},
-{278,279,-1,-1,-1,-1,-1,-1,-1},
-{279,280,-1,-1,-1,-1,-1,-1,-1},
-{280,281,-1,-1,-1,-1,-1,-1,-1},
-{281,282,-1,-1,-1,-1,-1,-1,-1},
-{282,283,-1,-1,-1,-1,-1,-1,-1},
-{283,284,-1,-1,-1,-1,-1,-1,-1},
-{284,285,-1,-1,-1,-1,-1,-1,-1},
-{285,286,-1,-1,-1,-1,-1,-1,-1},
-{286,287,-1,-1,-1,-1,-1,-1,-1},
-{287,288,-1,-1,-1,-1,-1,-1,-1},
-{288,289,-1,-1,-1,-1,-1,-1,-1},
-{289,290,-1,-1,-1,-1,-1,-1,-1},
-{290,291,-1,-1,-1,-1,-1,-1,-1},
-{291,292,-1,-1,-1,-1,-1,-1,-1},
-{292,293,-1,-1,-1,-1,-1,-1,-1},
-{293,294,-1,-1,-1,-1,-1,-1,-1},
-{294,295,-1,-1,-1,-1,-1,-1,-1},
-{295,296,-1,-1,-1,-1,-1,-1,-1},
-{296,297,-1,-1,-1,-1,-1,-1,-1},
-{297,298,-1,-1,-1,-1,-1,-1,-1},
-{298,299,-1,-1,-1,-1,-1,-1,-1},
-{299,300,-1,-1,-1,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1,-1,-1,-1},
-{301,302,-1,-1,-1,-1,-1,-1,-1},
-{302,303,-1,-1,-1,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1,-1,-1,-1},
-{304,305,-1,-1,-1,-1,-1,-1,-1},
-{305,306,-1,-1,-1,-1,-1,-1,-1},
-{306,307,-1,-1,-1,-1,-1,-1,-1},
-{307,308,-1,-1,-1,-1,-1,-1,-1},
-{308,309,-1,-1,-1,-1,-1,-1,-1},
-{309,310,-1,-1,-1,-1,-1,-1,-1},
-{310,311,-1,-1,-1,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1,-1,-1,-1},
-{312,313,-1,-1,-1,-1,-1,-1,-1},
-{313,314,-1,-1,-1,-1,-1,-1,-1},
-{314,315,-1,-1,-1,-1,-1,-1,-1},
-{315,316,-1,-1,-1,-1,-1,-1,-1},
-{316,317,-1,-1,-1,-1,-1,-1,-1},
-{317,318,-1,-1,-1,-1,-1,-1,-1},
-{318,319,-1,-1,-1,-1,-1,-1,-1},
-{319,320,-1,-1,-1,-1,-1,-1,-1},
-{320,321,-1,-1,-1,-1,-1,-1,-1},
-{321,322,-1,-1,-1,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1,-1,-1,-1},
-{323,324,-1,-1,-1,-1,-1,-1,-1},
-{324,325,-1,-1,-1,-1,-1,-1,-1},
-{325,326,-1,-1,-1,-1,-1,-1,-1},
-{326,327,-1,-1,-1,-1,-1,-1,-1},
-{327,328,-1,-1,-1,-1,-1,-1,-1},
-{328,329,-1,-1,-1,-1,-1,-1,-1},
-{329,330,-1,-1,-1,-1,-1,-1,-1},
-{330,331,-1,-1,-1,-1,-1,-1,-1},
-{331,332,-1,-1,-1,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1,-1,-1,-1},
-{333,334,-1,-1,-1,-1,-1,-1,-1},
-{334,335,-1,-1,-1,-1,-1,-1,-1},
-{335,336,-1,-1,-1,-1,-1,-1,-1},
-{336,337,-1,-1,-1,-1,-1,-1,-1},
-{337,338,-1,-1,-1,-1,-1,-1,-1},
-{338,339,-1,-1,-1,-1,-1,-1,-1},
-{339,340,-1,-1,-1,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1,-1,-1,-1},
-{341,342,-1,-1,-1,-1,-1,-1,-1},
-{342,343,-1,-1,-1,-1,-1,-1,-1},
-{343,344,-1,-1,-1,-1,-1,-1,-1},
-{344,345,-1,-1,-1,-1,-1,-1,-1},
-{345,346,-1,-1,-1,-1,-1,-1,-1},
-{346,347,-1,-1,-1,-1,-1,-1,-1},
-{347,348,-1,-1,-1,-1,-1,-1,-1},
-{348,349,-1,-1,-1,-1,-1,-1,-1},
-{349,350,-1,-1,-1,-1,-1,-1,-1},
-{350,351,-1,-1,-1,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1,-1,-1,-1},
-{352,353,-1,-1,-1,-1,-1,-1,-1},
-{353,354,-1,-1,-1,-1,-1,-1,-1},
-{354,355,-1,-1,-1,-1,-1,-1,-1},
-{355,356,-1,-1,-1,-1,-1,-1,-1},
-{356,357,-1,-1,-1,-1,-1,-1,-1},
-{357,358,-1,-1,-1,-1,-1,-1,-1},
-{358,359,-1,-1,-1,-1,-1,-1,-1},
-{359,360,-1,-1,-1,-1,-1,-1,-1},
-{360,361,-1,-1,-1,-1,-1,-1,-1},
-{361,362,-1,-1,-1,-1,-1,-1,-1},
-{362,363,-1,-1,-1,-1,-1,-1,-1},
-{363,364,-1,-1,-1,-1,-1,-1,-1},
-{364,365,-1,-1,-1,-1,-1,-1,-1},
-{365,366,-1,-1,-1,-1,-1,-1,-1},
-{366,367,-1,-1,-1,-1,-1,-1,-1},
-{367,368,-1,-1,-1,-1,-1,-1,-1},
-{368,369,-1,-1,-1,-1,-1,-1,-1},
-{369,370,-1,-1,-1,-1,-1,-1,-1},
-{370,371,-1,-1,-1,-1,-1,-1,-1},
-{371,372,-1,-1,-1,-1,-1,-1,-1},
-{372,373,-1,-1,-1,-1,-1,-1,-1},
-{373,374,-1,-1,-1,-1,-1,-1,-1},
-{374,375,-1,-1,-1,-1,-1,-1,-1},
-{375,376,-1,-1,-1,-1,-1,-1,-1},
-{376,377,-1,-1,-1,-1,-1,-1,-1},
-{377,378,-1,-1,-1,-1,-1,-1,-1},
-{378,379,-1,-1,-1,-1,-1,-1,-1},
-{379,380,-1,-1,-1,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1,-1,-1,-1},
-{381,382,-1,-1,-1,-1,-1,-1,-1},
-{382,383,-1,-1,-1,-1,-1,-1,-1},
-{383,384,-1,-1,-1,-1,-1,-1,-1},
-{384,385,-1,-1,-1,-1,-1,-1,-1},
-{385,386,-1,-1,-1,-1,-1,-1,-1},
-{386,387,-1,-1,-1,-1,-1,-1,-1},
-{387,388,-1,-1,-1,-1,-1,-1,-1},
-{388,389,-1,-1,-1,-1,-1,-1,-1},
-{389,390,-1,-1,-1,-1,-1,-1,-1},
-{390,391,-1,-1,-1,-1,-1,-1,-1},
-{391,392,-1,-1,-1,-1,-1,-1,-1},
-{392,393,-1,-1,-1,-1,-1,-1,-1},
-{393,394,-1,-1,-1,-1,-1,-1,-1},
-{394,395,-1,-1,-1,-1,-1,-1,-1},
-{395,396,-1,-1,-1,-1,-1,-1,-1},
-{396,397,-1,-1,-1,-1,-1,-1,-1},
-{397,398,-1,-1,-1,-1,-1,-1,-1},
-{398,399,-1,-1,-1,-1,-1,-1,-1},
-{399,400,-1,-1,-1,-1,-1,-1,-1},
-{400,401,-1,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1,-1},
-{402,403,-1,-1,-1,-1,-1,-1,-1},
-{403,404,-1,-1,-1,-1,-1,-1,-1},
-{404,405,-1,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1,-1},
-{406,407,-1,-1,-1,-1,-1,-1,-1},
-{407,408,-1,-1,-1,-1,-1,-1,-1},
-{408,409,-1,-1,-1,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1,-1},
-{410,411,-1,-1,-1,-1,-1,-1,-1},
-{411,412,-1,-1,-1,-1,-1,-1,-1},
-{412,413,-1,-1,-1,-1,-1,-1,-1},
-{413,414,-1,-1,-1,-1,-1,-1,-1},
-{414,415,-1,-1,-1,-1,-1,-1,-1},
-{415,416,-1,-1,-1,-1,-1,-1,-1},
-{416,417,-1,-1,-1,-1,-1,-1,-1},
-{417,418,-1,-1,-1,-1,-1,-1,-1},
-{418,419,-1,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1,-1},
-{420,421,-1,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1,-1},
-{422,423,-1,-1,-1,-1,-1,-1,-1},
-{423,424,-1,-1,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1,-1},
-{425,426,-1,-1,-1,-1,-1,-1,-1},
-{426,427,-1,-1,-1,-1,-1,-1,-1},
-{427,428,-1,-1,-1,-1,-1,-1,-1},
-{428,429,-1,-1,-1,-1,-1,-1,-1},
-{429,430,-1,-1,-1,-1,-1,-1,-1},
-{430,431,-1,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1,-1},
-{432,433,-1,-1,-1,-1,-1,-1,-1},
-{433,434,-1,-1,-1,-1,-1,-1,-1},
-{434,435,-1,-1,-1,-1,-1,-1,-1},
-{435,436,-1,-1,-1,-1,-1,-1,-1},
-{436,437,-1,-1,-1,-1,-1,-1,-1},
-{437,438,-1,-1,-1,-1,-1,-1,-1},
-{438,439,-1,-1,-1,-1,-1,-1,-1},
-{439,440,-1,-1,-1,-1,-1,-1,-1},
-{440,441,-1,-1,-1,-1,-1,-1,-1},
-{441,442,-1,-1,-1,-1,-1,-1,-1},
-{442,443,-1,-1,-1,-1,-1,-1,-1},
-{443,444,-1,-1,-1,-1,-1,-1,-1},
-{444,445,-1,-1,-1,-1,-1,-1,-1},
-{445,446,-1,-1,-1,-1,-1,-1,-1},
-{446,447,-1,-1,-1,-1,-1,-1,-1},
-{447,448,-1,-1,-1,-1,-1,-1,-1},
-{448,449,-1,-1,-1,-1,-1,-1,-1},
-{449,450,-1,-1,-1,-1,-1,-1,-1},
-{450,451,-1,-1,-1,-1,-1,-1,-1},
-{451,452,-1,-1,-1,-1,-1,-1,-1},
-{452,453,-1,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1,-1},
-{454,455,-1,-1,-1,-1,-1,-1,-1},
-{455,456,-1,-1,-1,-1,-1,-1,-1},
-{456,457,-1,-1,-1,-1,-1,-1,-1},
-{457,458,-1,-1,-1,-1,-1,-1,-1},
-{458,459,-1,-1,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1,-1},
-{460,461,-1,-1,-1,-1,-1,-1,-1},
-{461,462,-1,-1,-1,-1,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1,-1},
-{463,464,-1,-1,-1,-1,-1,-1,-1},
-{464,465,-1,-1,-1,-1,-1,-1,-1},
-{465,466,-1,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1,-1},
-{467,468,-1,-1,-1,-1,-1,-1,-1},
-{468,469,-1,-1,-1,-1,-1,-1,-1},
-{469,470,-1,-1,-1,-1,-1,-1,-1},
-{470,471,-1,-1,-1,-1,-1,-1,-1},
-{471,472,-1,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1,-1},
-{473,474,-1,-1,-1,-1,-1,-1,-1},
-{474,475,-1,-1,-1,-1,-1,-1,-1},
-{475,476,-1,-1,-1,-1,-1,-1,-1},
-{476,477,-1,-1,-1,-1,-1,-1,-1},
-{477,478,-1,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1,-1},
-{480,481,-1,-1,-1,-1,-1,-1,-1},
-{481,482,-1,-1,-1,-1,-1,-1,-1},
-{482,483,-1,-1,-1,-1,-1,-1,-1},
-{483,484,-1,-1,-1,-1,-1,-1,-1},
-{484,485,-1,-1,-1,-1,-1,-1,-1},
-{485,486,-1,-1,-1,-1,-1,-1,-1},
-{486,487,-1,-1,-1,-1,-1,-1,-1},
-{487,488,-1,-1,-1,-1,-1,-1,-1},
-{488,489,-1,-1,-1,-1,-1,-1,-1},
-{489,490,-1,-1,-1,-1,-1,-1,-1},
-{490,491,-1,-1,-1,-1,-1,-1,-1},
-{491,492,-1,-1,-1,-1,-1,-1,-1},
-{492,493,-1,-1,-1,-1,-1,-1,-1},
-{493,494,-1,-1,-1,-1,-1,-1,-1},
-{494,495,-1,-1,-1,-1,-1,-1,-1},
-{495,496,-1,-1,-1,-1,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1,-1},
-{497,498,-1,-1,-1,-1,-1,-1,-1},
-{498,499,-1,-1,-1,-1,-1,-1,-1},
-{499,500,-1,-1,-1,-1,-1,-1,-1},
-{500,501,-1,-1,-1,-1,-1,-1,-1},
-{501,502,-1,-1,-1,-1,-1,-1,-1},
-{502,503,-1,-1,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1,-1},
-{504,505,-1,-1,-1,-1,-1,-1,-1},
-{505,506,-1,-1,-1,-1,-1,-1,-1},
-{506,507,-1,-1,-1,-1,-1,-1,-1},
-{507,508,-1,-1,-1,-1,-1,-1,-1},
-{508,509,-1,-1,-1,-1,-1,-1,-1},
-{509,510,-1,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1,-1},
-{512,513,-1,-1,-1,-1,-1,-1,-1},
-{513,514,-1,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1,-1},
-{515,516,-1,-1,-1,-1,-1,-1,-1},
-{516,517,-1,-1,-1,-1,-1,-1,-1},
-{517,518,-1,-1,-1,-1,-1,-1,-1},
-{518,519,-1,-1,-1,-1,-1,-1,-1},
-{519,520,-1,-1,-1,-1,-1,-1,-1},
-{520,521,-1,-1,-1,-1,-1,-1,-1},
-{521,522,-1,-1,-1,-1,-1,-1,-1},
-{522,523,-1,-1,-1,-1,-1,-1,-1},
-{523,524,-1,-1,-1,-1,-1,-1,-1},
-{524,525,-1,-1,-1,-1,-1,-1,-1},
-{525,526,-1,-1,-1,-1,-1,-1,-1},
-{526,527,-1,-1,-1,-1,-1,-1,-1},
-{527,528,-1,-1,-1,-1,-1,-1,-1},
-{528,529,-1,-1,-1,-1,-1,-1,-1},
-{529,530,-1,-1,-1,-1,-1,-1,-1},
-{530,531,-1,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1,-1},
-{532,533,-1,-1,-1,-1,-1,-1,-1},
-{533,534,-1,-1,-1,-1,-1,-1,-1},
-{534,535,-1,-1,-1,-1,-1,-1,-1},
-{535,536,-1,-1,-1,-1,-1,-1,-1},
-{536,537,-1,-1,-1,-1,-1,-1,-1},
-{537,538,-1,-1,-1,-1,-1,-1,-1},
-{538,539,-1,-1,-1,-1,-1,-1,-1},
-{539,540,-1,-1,-1,-1,-1,-1,-1},
-{540,541,-1,-1,-1,-1,-1,-1,-1},
-{541,542,-1,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1,-1},
-{543,544,-1,-1,-1,-1,-1,-1,-1},
-{544,545,-1,-1,-1,-1,-1,-1,-1},
-{545,546,-1,-1,-1,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1,-1},
-{547,548,-1,-1,-1,-1,-1,-1,-1},
-{548,549,-1,-1,-1,-1,-1,-1,-1},
-{549,550,-1,-1,-1,-1,-1,-1,-1},
-{550,551,-1,-1,-1,-1,-1,-1,-1},
-{551,552,-1,-1,-1,-1,-1,-1,-1},
-{552,553,-1,-1,-1,-1,-1,-1,-1},
-{553,554,-1,-1,-1,-1,-1,-1,-1},
-{554,555,-1,-1,-1,-1,-1,-1,-1},
-{555,556,-1,-1,-1,-1,-1,-1,-1},
-{556,557,-1,-1,-1,-1,-1,-1,-1},
-{557,558,-1,-1,-1,-1,-1,-1,-1},
-{558,559,-1,-1,-1,-1,-1,-1,-1},
-{559,560,-1,-1,-1,-1,-1,-1,-1},
-{560,561,-1,-1,-1,-1,-1,-1,-1},
-{561,562,-1,-1,-1,-1,-1,-1,-1},
-{562,563,-1,-1,-1,-1,-1,-1,-1},
-{563,564,-1,-1,-1,-1,-1,-1,-1},
-{564,565,-1,-1,-1,-1,-1,-1,-1},
-{565,566,-1,-1,-1,-1,-1,-1,-1},
-{566,567,-1,-1,-1,-1,-1,-1,-1},
-{567,568,-1,-1,-1,-1,-1,-1,-1},
-{568,569,-1,-1,-1,-1,-1,-1,-1},
-{569,570,-1,-1,-1,-1,-1,-1,-1},
-{570,571,-1,-1,-1,-1,-1,-1,-1},
-{571,572,-1,-1,-1,-1,-1,-1,-1},
-{572,573,-1,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1,-1},
-{574,575,-1,-1,-1,-1,-1,-1,-1},
-{575,576,-1,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1,-1},
-{578,579,-1,-1,-1,-1,-1,-1,-1},
-{579,580,-1,-1,-1,-1,-1,-1,-1},
-{580,581,-1,-1,-1,-1,-1,-1,-1},
-{581,582,-1,-1,-1,-1,-1,-1,-1},
-{582,583,-1,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1,-1},
-{584,585,-1,-1,-1,-1,-1,-1,-1},
-{585,586,-1,-1,-1,-1,-1,-1,-1},
-{586,587,-1,-1,-1,-1,-1,-1,-1},
-{587,588,-1,-1,-1,-1,-1,-1,-1},
-{588,589,-1,-1,-1,-1,-1,-1,-1},
-{589,590,-1,-1,-1,-1,-1,-1,-1},
-{590,591,-1,-1,-1,-1,-1,-1,-1},
-{591,592,-1,-1,-1,-1,-1,-1,-1},
-{592,593,-1,-1,-1,-1,-1,-1,-1},
-{593,594,-1,-1,-1,-1,-1,-1,-1},
-{594,595,-1,-1,-1,-1,-1,-1,-1},
-{595,596,-1,-1,-1,-1,-1,-1,-1},
-{596,597,-1,-1,-1,-1,-1,-1,-1},
-{597,598,-1,-1,-1,-1,-1,-1,-1},
-{598,599,-1,-1,-1,-1,-1,-1,-1},
-{599,600,-1,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1,-1},
-{601,602,-1,-1,-1,-1,-1,-1,-1},
-{602,603,-1,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1,-1},
-{605,606,-1,-1,-1,-1,-1,-1,-1},
-{606,607,-1,-1,-1,-1,-1,-1,-1},
-{607,608,-1,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1,-1},
-{609,610,-1,-1,-1,-1,-1,-1,-1},
-{610,611,-1,-1,-1,-1,-1,-1,-1},
-{611,612,-1,-1,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1,-1},
-{613,614,-1,-1,-1,-1,-1,-1,-1},
-{614,615,-1,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1,-1},
-{617,618,-1,-1,-1,-1,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1,-1},
-{619,620,-1,-1,-1,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1,-1},
-{621,622,-1,-1,-1,-1,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1,-1},
-{623,624,-1,-1,-1,-1,-1,-1,-1},
-{624,625,-1,-1,-1,-1,-1,-1,-1},
-{625,626,-1,-1,-1,-1,-1,-1,-1},
-{626,627,-1,-1,-1,-1,-1,-1,-1},
-{627,628,-1,-1,-1,-1,-1,-1,-1},
-{628,629,-1,-1,-1,-1,-1,-1,-1},
-{629,630,-1,-1,-1,-1,-1,-1,-1},
-{630,631,-1,-1,-1,-1,-1,-1,-1},
-{631,632,-1,-1,-1,-1,-1,-1,-1},
-{632,633,-1,-1,-1,-1,-1,-1,-1},
-{633,634,-1,-1,-1,-1,-1,-1,-1},
-{634,635,-1,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1,-1},
-{636,637,-1,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1,-1},
-{638,639,-1,-1,-1,-1,-1,-1,-1},
-{639,640,-1,-1,-1,-1,-1,-1,-1},
-{640,641,-1,-1,-1,-1,-1,-1,-1},
-{641,642,-1,-1,-1,-1,-1,-1,-1},
-{642,643,-1,-1,-1,-1,-1,-1,-1},
-{643,644,-1,-1,-1,-1,-1,-1,-1},
-{644,645,-1,-1,-1,-1,-1,-1,-1},
-{645,646,-1,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1,-1},
-{647,648,-1,-1,-1,-1,-1,-1,-1},
-{648,649,-1,-1,-1,-1,-1,-1,-1},
-{649,650,-1,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1,-1},
-{651,652,-1,-1,-1,-1,-1,-1,-1},
-{652,653,-1,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1,-1},
-{655,656,-1,-1,-1,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1,-1},
-{657,658,-1,-1,-1,-1,-1,-1,-1},
-{658,659,-1,-1,-1,-1,-1,-1,-1},
-{659,660,-1,-1,-1,-1,-1,-1,-1},
-{660,661,-1,-1,-1,-1,-1,-1,-1},
-{661,662,-1,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1,-1},
-{663,664,-1,-1,-1,-1,-1,-1,-1},
-{664,665,-1,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1,-1},
-{667,668,-1,-1,-1,-1,-1,-1,-1},
-{668,669,-1,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1,-1},
-{670,671,-1,-1,-1,-1,-1,-1,-1},
-{671,672,-1,-1,-1,-1,-1,-1,-1},
-{672,673,-1,-1,-1,-1,-1,-1,-1},
-{673,674,-1,-1,-1,-1,-1,-1,-1},
-{674,675,-1,-1,-1,-1,-1,-1,-1},
-{675,676,-1,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1,-1},
-{677,678,-1,-1,-1,-1,-1,-1,-1},
-{678,679,-1,-1,-1,-1,-1,-1,-1},
-{679,680,-1,-1,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1,-1},
-{681,682,-1,-1,-1,-1,-1,-1,-1},
-{682,683,-1,-1,-1,-1,-1,-1,-1},
-{683,684,-1,-1,-1,-1,-1,-1,-1},
-{684,685,-1,-1,-1,-1,-1,-1,-1},
-{685,686,-1,-1,-1,-1,-1,-1,-1},
-{686,687,-1,-1,-1,-1,-1,-1,-1},
-{687,688,-1,-1,-1,-1,-1,-1,-1},
-{688,689,-1,-1,-1,-1,-1,-1,-1},
-{689,690,-1,-1,-1,-1,-1,-1,-1},
-{690,691,-1,-1,-1,-1,-1,-1,-1},
-{691,692,-1,-1,-1,-1,-1,-1,-1},
-{692,693,-1,-1,-1,-1,-1,-1,-1},
-{693,694,-1,-1,-1,-1,-1,-1,-1},
-{694,695,-1,-1,-1,-1,-1,-1,-1},
-{695,696,-1,-1,-1,-1,-1,-1,-1},
-{696,697,-1,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1,-1},
-{699,700,-1,-1,-1,-1,-1,-1,-1},
-{700,701,-1,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1,-1},
-{702,703,-1,-1,-1,-1,-1,-1,-1},
-{703,704,-1,-1,-1,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1,-1},
-{705,706,-1,-1,-1,-1,-1,-1,-1},
-{706,707,-1,-1,-1,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1,-1},
-{708,709,-1,-1,-1,-1,-1,-1,-1},
-{709,710,-1,-1,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1,-1},
-{711,712,-1,-1,-1,-1,-1,-1,-1},
-{712,713,-1,-1,-1,-1,-1,-1,-1},
-{713,714,-1,-1,-1,-1,-1,-1,-1},
-{714,715,-1,-1,-1,-1,-1,-1,-1},
-{715,716,-1,-1,-1,-1,-1,-1,-1},
-{716,717,-1,-1,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1,-1},
-{718,719,-1,-1,-1,-1,-1,-1,-1},
-{719,720,-1,-1,-1,-1,-1,-1,-1},
-{720,721,-1,-1,-1,-1,-1,-1,-1},
-{721,722,-1,-1,-1,-1,-1,-1,-1},
-{722,723,-1,-1,-1,-1,-1,-1,-1},
-{723,724,-1,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1,-1},
-{725,726,-1,-1,-1,-1,-1,-1,-1},
-{726,727,-1,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1,-1},
-{730,731,-1,-1,-1,-1,-1,-1,-1},
-{731,732,-1,-1,-1,-1,-1,-1,-1},
-{732,733,-1,-1,-1,-1,-1,-1,-1},
-{733,734,-1,-1,-1,-1,-1,-1,-1},
-{734,735,-1,-1,-1,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1,-1},
-{736,737,-1,-1,-1,-1,-1,-1,-1},
-{737,738,-1,-1,-1,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1,-1},
-{739,740,-1,-1,-1,-1,-1,-1,-1},
-{740,741,-1,-1,-1,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1,-1},
-{742,743,-1,-1,-1,-1,-1,-1,-1},
-{743,744,-1,-1,-1,-1,-1,-1,-1},
-{744,745,-1,-1,-1,-1,-1,-1,-1},
-{745,746,-1,-1,-1,-1,-1,-1,-1},
-{746,747,-1,-1,-1,-1,-1,-1,-1},
-{747,748,-1,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1,-1},
-{749,750,-1,-1,-1,-1,-1,-1,-1},
-{750,751,-1,-1,-1,-1,-1,-1,-1},
-{751,752,-1,-1,-1,-1,-1,-1,-1},
-{752,753,-1,-1,-1,-1,-1,-1,-1},
-{753,754,-1,-1,-1,-1,-1,-1,-1},
-{754,755,-1,-1,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1,-1},
-{756,757,-1,-1,-1,-1,-1,-1,-1},
-{757,758,-1,-1,-1,-1,-1,-1,-1},
-{758,759,-1,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1},
-{760,761,-1,-1,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1,-1},
-{762,763,-1,-1,-1,-1,-1,-1,-1},
-{763,764,-1,-1,-1,-1,-1,-1,-1},
-{764,765,-1,-1,-1,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1,-1},
-{766,767,-1,-1,-1,-1,-1,-1,-1},
-{767,768,-1,-1,-1,-1,-1,-1,-1},
-{768,769,-1,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1,-1},
-{770,771,-1,-1,-1,-1,-1,-1,-1},
-{771,772,-1,-1,-1,-1,-1,-1,-1},
-{772,773,-1,-1,-1,-1,-1,-1,-1},
-{773,774,-1,-1,-1,-1,-1,-1,-1},
-{774,775,-1,-1,-1,-1,-1,-1,-1},
-{775,776,-1,-1,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1,-1},
-{777,778,-1,-1,-1,-1,-1,-1,-1},
-{778,779,-1,-1,-1,-1,-1,-1,-1},
-{779,780,-1,-1,-1,-1,-1,-1,-1},
-{780,781,-1,-1,-1,-1,-1,-1,-1},
-{781,782,-1,-1,-1,-1,-1,-1,-1},
-{782,783,-1,-1,-1,-1,-1,-1,-1},
-{783,784,-1,-1,-1,-1,-1,-1,-1},
-{784,785,-1,-1,-1,-1,-1,-1,-1},
-{785,786,-1,-1,-1,-1,-1,-1,-1},
-{786,787,-1,-1,-1,-1,-1,-1,-1},
-{787,788,-1,-1,-1,-1,-1,-1,-1},
-{788,789,-1,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1},
-{792,793,-1,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1},
-{794,795,-1,-1,-1,-1,-1,-1,-1},
-{795,796,-1,-1,-1,-1,-1,-1,-1},
-{796,797,-1,-1,-1,-1,-1,-1,-1},
-{797,798,-1,-1,-1,-1,-1,-1,-1},
-{798,799,-1,-1,-1,-1,-1,-1,-1},
-{799,800,-1,-1,-1,-1,-1,-1,-1},
-{800,801,-1,-1,-1,-1,-1,-1,-1},
-{801,802,-1,-1,-1,-1,-1,-1,-1},
-{802,803,-1,-1,-1,-1,-1,-1,-1},
-{803,804,-1,-1,-1,-1,-1,-1,-1},
-{804,805,-1,-1,-1,-1,-1,-1,-1},
-{805,806,-1,-1,-1,-1,-1,-1,-1},
-{806,807,-1,-1,-1,-1,-1,-1,-1},
-{807,808,-1,-1,-1,-1,-1,-1,-1},
-{808,809,-1,-1,-1,-1,-1,-1,-1},
-{809,810,-1,-1,-1,-1,-1,-1,-1},
-{810,811,-1,-1,-1,-1,-1,-1,-1},
-{811,812,-1,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1},
-{813,814,-1,-1,-1,-1,-1,-1,-1},
-{814,815,-1,-1,-1,-1,-1,-1,-1},
-{815,816,-1,-1,-1,-1,-1,-1,-1},
-{816,817,-1,-1,-1,-1,-1,-1,-1},
-{817,818,-1,-1,-1,-1,-1,-1,-1},
-{818,819,-1,-1,-1,-1,-1,-1,-1},
-{819,820,-1,-1,-1,-1,-1,-1,-1},
-{820,821,-1,-1,-1,-1,-1,-1,-1},
-{821,822,-1,-1,-1,-1,-1,-1,-1},
-{822,823,-1,-1,-1,-1,-1,-1,-1},
-{823,824,-1,-1,-1,-1,-1,-1,-1},
-{824,825,-1,-1,-1,-1,-1,-1,-1},
-{825,826,-1,-1,-1,-1,-1,-1,-1},
-{826,827,-1,-1,-1,-1,-1,-1,-1},
-{827,828,-1,-1,-1,-1,-1,-1,-1},
-{828,829,-1,-1,-1,-1,-1,-1,-1},
-{829,830,-1,-1,-1,-1,-1,-1,-1},
-{830,831,-1,-1,-1,-1,-1,-1,-1},
-{831,832,-1,-1,-1,-1,-1,-1,-1},
-{832,833,-1,-1,-1,-1,-1,-1,-1},
-{833,834,-1,-1,-1,-1,-1,-1,-1},
-{834,835,-1,-1,-1,-1,-1,-1,-1},
-{835,836,-1,-1,-1,-1,-1,-1,-1},
-{836,837,-1,-1,-1,-1,-1,-1,-1},
-{837,838,-1,-1,-1,-1,-1,-1,-1},
-{838,839,-1,-1,-1,-1,-1,-1,-1},
-{839,840,-1,-1,-1,-1,-1,-1,-1},
-{840,841,-1,-1,-1,-1,-1,-1,-1},
-{841,842,-1,-1,-1,-1,-1,-1,-1},
-{842,843,-1,-1,-1,-1,-1,-1,-1},
-{843,844,-1,-1,-1,-1,-1,-1,-1},
-{844,845,-1,-1,-1,-1,-1,-1,-1},
-{845,846,-1,-1,-1,-1,-1,-1,-1},
-{846,847,-1,-1,-1,-1,-1,-1,-1},
-{847,848,-1,-1,-1,-1,-1,-1,-1},
-{848,849,-1,-1,-1,-1,-1,-1,-1},
-{849,850,-1,-1,-1,-1,-1,-1,-1},
-{850,851,-1,-1,-1,-1,-1,-1,-1},
-{851,852,-1,-1,-1,-1,-1,-1,-1},
-{852,853,-1,-1,-1,-1,-1,-1,-1},
-{853,854,-1,-1,-1,-1,-1,-1,-1},
-{854,855,-1,-1,-1,-1,-1,-1,-1},
-{855,856,-1,-1,-1,-1,-1,-1,-1},
-{856,857,-1,-1,-1,-1,-1,-1,-1},
-{857,858,-1,-1,-1,-1,-1,-1,-1},
-{858,859,-1,-1,-1,-1,-1,-1,-1},
-{859,860,-1,-1,-1,-1,-1,-1,-1},
-{860,861,-1,-1,-1,-1,-1,-1,-1},
-{861,862,-1,-1,-1,-1,-1,-1,-1},
-{862,863,-1,-1,-1,-1,-1,-1,-1},
-{863,864,-1,-1,-1,-1,-1,-1,-1},
-{864,865,-1,-1,-1,-1,-1,-1,-1},
-{865,866,-1,-1,-1,-1,-1,-1,-1},
-{866,867,-1,-1,-1,-1,-1,-1,-1},
-{867,868,-1,-1,-1,-1,-1,-1,-1},
-{868,869,-1,-1,-1,-1,-1,-1,-1},
-{869,870,-1,-1,-1,-1,-1,-1,-1},
-{870,871,-1,-1,-1,-1,-1,-1,-1},
-{871,872,-1,-1,-1,-1,-1,-1,-1},
-{872,873,-1,-1,-1,-1,-1,-1,-1},
-{873,874,-1,-1,-1,-1,-1,-1,-1},
-{874,875,-1,-1,-1,-1,-1,-1,-1},
-{875,876,-1,-1,-1,-1,-1,-1,-1},
-{876,877,-1,-1,-1,-1,-1,-1,-1},
-{877,878,-1,-1,-1,-1,-1,-1,-1},
-{878,879,-1,-1,-1,-1,-1,-1,-1},
-{879,880,-1,-1,-1,-1,-1,-1,-1},
-{880,881,-1,-1,-1,-1,-1,-1,-1},
-{881,882,-1,-1,-1,-1,-1,-1,-1},
-{882,883,-1,-1,-1,-1,-1,-1,-1},
-{883,884,-1,-1,-1,-1,-1,-1,-1},
-{884,885,-1,-1,-1,-1,-1,-1,-1},
-{885,886,-1,-1,-1,-1,-1,-1,-1},
-{886,887,-1,-1,-1,-1,-1,-1,-1},
-{887,888,-1,-1,-1,-1,-1,-1,-1},
-{888,889,-1,-1,-1,-1,-1,-1,-1},
-{889,890,-1,-1,-1,-1,-1,-1,-1},
-{890,891,-1,-1,-1,-1,-1,-1,-1},
-{891,892,-1,-1,-1,-1,-1,-1,-1},
-{892,893,-1,-1,-1,-1,-1,-1,-1},
-{893,894,-1,-1,-1,-1,-1,-1,-1},
-{894,895,-1,-1,-1,-1,-1,-1,-1},
-{895,896,-1,-1,-1,-1,-1,-1,-1},
-{896,897,-1,-1,-1,-1,-1,-1,-1},
-{897,898,-1,-1,-1,-1,-1,-1,-1},
-{898,899,-1,-1,-1,-1,-1,-1,-1},
-{899,900,-1,-1,-1,-1,-1,-1,-1},
-{900,901,-1,-1,-1,-1,-1,-1,-1},
-{901,902,-1,-1,-1,-1,-1,-1,-1},
-{902,903,-1,-1,-1,-1,-1,-1,-1},
-{903,904,-1,-1,-1,-1,-1,-1,-1},
-{904,905,-1,-1,-1,-1,-1,-1,-1},
-{905,906,-1,-1,-1,-1,-1,-1,-1},
-{906,907,-1,-1,-1,-1,-1,-1,-1},
-{907,908,-1,-1,-1,-1,-1,-1,-1},
-{908,909,-1,-1,-1,-1,-1,-1,-1},
-{909,910,-1,-1,-1,-1,-1,-1,-1},
-{910,911,-1,-1,-1,-1,-1,-1,-1},
-{911,912,-1,-1,-1,-1,-1,-1,-1},
-{912,913,-1,-1,-1,-1,-1,-1,-1},
-{913,914,-1,-1,-1,-1,-1,-1,-1},
-{914,915,-1,-1,-1,-1,-1,-1,-1},
-{915,916,-1,-1,-1,-1,-1,-1,-1},
-{916,917,-1,-1,-1,-1,-1,-1,-1},
-{917,918,-1,-1,-1,-1,-1,-1,-1},
-{918,919,-1,-1,-1,-1,-1,-1,-1},
-{919,920,-1,-1,-1,-1,-1,-1,-1},
-{920,921,-1,-1,-1,-1,-1,-1,-1},
-{921,922,-1,-1,-1,-1,-1,-1,-1},
-{922,923,-1,-1,-1,-1,-1,-1,-1},
-{923,924,-1,-1,-1,-1,-1,-1,-1},
-{924,925,-1,-1,-1,-1,-1,-1,-1},
-{925,926,-1,-1,-1,-1,-1,-1,-1},
-{926,927,-1,-1,-1,-1,-1,-1,-1},
-{927,928,-1,-1,-1,-1,-1,-1,-1},
-{928,929,-1,-1,-1,-1,-1,-1,-1},
-{929,930,-1,-1,-1,-1,-1,-1,-1},
-{930,931,-1,-1,-1,-1,-1,-1,-1},
-{931,932,-1,-1,-1,-1,-1,-1,-1},
-{932,933,-1,-1,-1,-1,-1,-1,-1},
-{933,934,-1,-1,-1,-1,-1,-1,-1},
-{934,935,-1,-1,-1,-1,-1,-1,-1},
-{935,936,-1,-1,-1,-1,-1,-1,-1},
-{936,937,-1,-1,-1,-1,-1,-1,-1},
-{937,938,-1,-1,-1,-1,-1,-1,-1},
-{938,939,-1,-1,-1,-1,-1,-1,-1},
-{939,940,-1,-1,-1,-1,-1,-1,-1},
-{940,941,-1,-1,-1,-1,-1,-1,-1},
-{941,942,-1,-1,-1,-1,-1,-1,-1},
-{942,943,-1,-1,-1,-1,-1,-1,-1},
-{943,944,-1,-1,-1,-1,-1,-1,-1},
-{944,945,-1,-1,-1,-1,-1,-1,-1},
-{945,946,-1,-1,-1,-1,-1,-1,-1},
-{946,947,-1,-1,-1,-1,-1,-1,-1},
-{947,948,-1,-1,-1,-1,-1,-1,-1},
-{948,949,-1,-1,-1,-1,-1,-1,-1},
-{949,950,-1,-1,-1,-1,-1,-1,-1},
-{950,951,-1,-1,-1,-1,-1,-1,-1},
-{951,952,-1,-1,-1,-1,-1,-1,-1},
-{952,953,-1,-1,-1,-1,-1,-1,-1},
-{953,954,-1,-1,-1,-1,-1,-1,-1},
-{954,955,-1,-1,-1,-1,-1,-1,-1},
-{955,956,-1,-1,-1,-1,-1,-1,-1},
-{956,957,-1,-1,-1,-1,-1,-1,-1},
-{957,958,-1,-1,-1,-1,-1,-1,-1},
-{958,959,-1,-1,-1,-1,-1,-1,-1},
-{959,960,-1,-1,-1,-1,-1,-1,-1},
-{960,961,-1,-1,-1,-1,-1,-1,-1},
-{961,962,-1,-1,-1,-1,-1,-1,-1},
-{962,963,-1,-1,-1,-1,-1,-1,-1},
-{963,964,-1,-1,-1,-1,-1,-1,-1},
-{964,965,-1,-1,-1,-1,-1,-1,-1},
-{965,966,-1,-1,-1,-1,-1,-1,-1},
-{966,967,-1,-1,-1,-1,-1,-1,-1},
-{967,968,-1,-1,-1,-1,-1,-1,-1},
-{968,969,-1,-1,-1,-1,-1,-1,-1},
-{969,970,-1,-1,-1,-1,-1,-1,-1},
-{970,971,-1,-1,-1,-1,-1,-1,-1},
-{971,972,-1,-1,-1,-1,-1,-1,-1},
-{972,973,-1,-1,-1,-1,-1,-1,-1},
-{973,974,-1,-1,-1,-1,-1,-1,-1},
-{974,975,-1,-1,-1,-1,-1,-1,-1},
-{975,976,-1,-1,-1,-1,-1,-1,-1},
-{976,977,-1,-1,-1,-1,-1,-1,-1},
-{977,978,-1,-1,-1,-1,-1,-1,-1},
-{978,979,-1,-1,-1,-1,-1,-1,-1},
-{979,980,-1,-1,-1,-1,-1,-1,-1},
-{980,981,-1,-1,-1,-1,-1,-1,-1},
-{981,982,-1,-1,-1,-1,-1,-1,-1},
-{982,983,-1,-1,-1,-1,-1,-1,-1},
-{983,984,-1,-1,-1,-1,-1,-1,-1},
-{984,985,-1,-1,-1,-1,-1,-1,-1},
-{985,986,-1,-1,-1,-1,-1,-1,-1},
-{986,987,-1,-1,-1,-1,-1,-1,-1},
-{987,988,-1,-1,-1,-1,-1,-1,-1},
-{988,989,-1,-1,-1,-1,-1,-1,-1},
-{989,990,-1,-1,-1,-1,-1,-1,-1},
-{990,991,-1,-1,-1,-1,-1,-1,-1},
-{991,992,-1,-1,-1,-1,-1,-1,-1},
-{992,993,-1,-1,-1,-1,-1,-1,-1},
-{993,994,-1,-1,-1,-1,-1,-1,-1},
-{994,995,-1,-1,-1,-1,-1,-1,-1},
-{995,996,-1,-1,-1,-1,-1,-1,-1},
-{996,997,-1,-1,-1,-1,-1,-1,-1},
-{997,998,-1,-1,-1,-1,-1,-1,-1},
-{998,999,-1,-1,-1,-1,-1,-1,-1},
-{999,1000,-1,-1,-1,-1,-1,-1,-1},
-{1000,1001,-1,-1,-1,-1,-1,-1,-1},
-{1001,1002,-1,-1,-1,-1,-1,-1,-1},
-{1002,1003,-1,-1,-1,-1,-1,-1,-1},
-{1003,1004,-1,-1,-1,-1,-1,-1,-1},
-{1004,1005,-1,-1,-1,-1,-1,-1,-1},
-{1005,1006,-1,-1,-1,-1,-1,-1,-1},
-{1006,1007,-1,-1,-1,-1,-1,-1,-1},
-{1007,1008,-1,-1,-1,-1,-1,-1,-1},
-{1008,1009,-1,-1,-1,-1,-1,-1,-1},
-{1009,1010,-1,-1,-1,-1,-1,-1,-1},
-{1010,1011,-1,-1,-1,-1,-1,-1,-1},
-{1011,1012,-1,-1,-1,-1,-1,-1,-1},
-{1012,1013,-1,-1,-1,-1,-1,-1,-1},
-{1013,1014,-1,-1,-1,-1,-1,-1,-1},
-{1014,1015,-1,-1,-1,-1,-1,-1,-1},
-{1015,1016,-1,-1,-1,-1,-1,-1,-1},
-{1016,1017,-1,-1,-1,-1,-1,-1,-1},
-{1017,1018,-1,-1,-1,-1,-1,-1,-1},
-{1018,1019,-1,-1,-1,-1,-1,-1,-1},
-{1019,1020,-1,-1,-1,-1,-1,-1,-1},
-{1020,1021,-1,-1,-1,-1,-1,-1,-1},
-{1021,1022,-1,-1,-1,-1,-1,-1,-1},
-{1022,1023,-1,-1,-1,-1,-1,-1,-1},
-{1023,1024,-1,-1,-1,-1,-1,-1,-1},
-{1024,1025,-1,-1,-1,-1,-1,-1,-1},
-{1025,1026,-1,-1,-1,-1,-1,-1,-1},
-{1026,1027,-1,-1,-1,-1,-1,-1,-1},
-{1027,1028,-1,-1,-1,-1,-1,-1,-1},
-{1028,1029,-1,-1,-1,-1,-1,-1,-1},
-{1029,1030,-1,-1,-1,-1,-1,-1,-1},
-{1030,1031,-1,-1,-1,-1,-1,-1,-1},
-{1031,1032,-1,-1,-1,-1,-1,-1,-1},
-{1032,1033,-1,-1,-1,-1,-1,-1,-1},
-{1033,1034,-1,-1,-1,-1,-1,-1,-1},
-{1034,1035,-1,-1,-1,-1,-1,-1,-1},
-{1035,1036,-1,-1,-1,-1,-1,-1,-1},
-{1036,1037,-1,-1,-1,-1,-1,-1,-1},
-{1037,1038,-1,-1,-1,-1,-1,-1,-1},
-{1038,1039,-1,-1,-1,-1,-1,-1,-1},
-{1039,1040,-1,-1,-1,-1,-1,-1,-1},
-{1040,1041,-1,-1,-1,-1,-1,-1,-1},
-{1041,1042,-1,-1,-1,-1,-1,-1,-1},
-{1042,1043,-1,-1,-1,-1,-1,-1,-1},
-{1043,1044,-1,-1,-1,-1,-1,-1,-1},
-{1044,1045,-1,-1,-1,-1,-1,-1,-1},
-{1045,1046,-1,-1,-1,-1,-1,-1,-1},
-{1046,1047,-1,-1,-1,-1,-1,-1,-1},
-{1047,1048,-1,-1,-1,-1,-1,-1,-1},
-{1048,1049,-1,-1,-1,-1,-1,-1,-1},
-{1049,1050,-1,-1,-1,-1,-1,-1,-1},
-{1050,1051,-1,-1,-1,-1,-1,-1,-1},
-{1051,1052,-1,-1,-1,-1,-1,-1,-1},
-{1052,1053,-1,-1,-1,-1,-1,-1,-1},
-{1053,1054,-1,-1,-1,-1,-1,-1,-1},
-{1054,1055,-1,-1,-1,-1,-1,-1,-1},
-{1055,1056,-1,-1,-1,-1,-1,-1,-1},
-{1056,1057,-1,-1,-1,-1,-1,-1,-1},
-{1057,1058,-1,-1,-1,-1,-1,-1,-1},
-{1058,1059,-1,-1,-1,-1,-1,-1,-1},
-{1059,1060,-1,-1,-1,-1,-1,-1,-1},
-{1060,1061,-1,-1,-1,-1,-1,-1,-1},
-{1061,1062,-1,-1,-1,-1,-1,-1,-1},
-{1062,1063,-1,-1,-1,-1,-1,-1,-1},
-{1063,1064,-1,-1,-1,-1,-1,-1,-1},
-{1064,1065,-1,-1,-1,-1,-1,-1,-1},
-{1065,1066,-1,-1,-1,-1,-1,-1,-1},
-{1066,1067,-1,-1,-1,-1,-1,-1,-1},
-{1067,1068,-1,-1,-1,-1,-1,-1,-1},
-{1068,1069,-1,-1,-1,-1,-1,-1,-1},
-{1069,1070,-1,-1,-1,-1,-1,-1,-1},
-{1070,1071,-1,-1,-1,-1,-1,-1,-1},
-{1071,1072,-1,-1,-1,-1,-1,-1,-1},
-{1072,1073,-1,-1,-1,-1,-1,-1,-1},
-{1073,1074,-1,-1,-1,-1,-1,-1,-1},
-{1074,1075,-1,-1,-1,-1,-1,-1,-1},
-{1075,1076,-1,-1,-1,-1,-1,-1,-1},
-{1076,1077,-1,-1,-1,-1,-1,-1,-1},
-{1077,1078,-1,-1,-1,-1,-1,-1,-1},
-{1078,1079,-1,-1,-1,-1,-1,-1,-1},
-{1079,1080,-1,-1,-1,-1,-1,-1,-1},
-{1080,1081,-1,-1,-1,-1,-1,-1,-1},
-{1081,1082,-1,-1,-1,-1,-1,-1,-1},
-{1082,1083,-1,-1,-1,-1,-1,-1,-1},
-{1083,1084,-1,-1,-1,-1,-1,-1,-1},
-{1084,1085,-1,-1,-1,-1,-1,-1,-1},
-{1085,1086,-1,-1,-1,-1,-1,-1,-1},
-{1086,1087,-1,-1,-1,-1,-1,-1,-1},
-{1087,1088,-1,-1,-1,-1,-1,-1,-1},
-{1088,1089,-1,-1,-1,-1,-1,-1,-1},
-{1089,1090,-1,-1,-1,-1,-1,-1,-1},
-{1090,1091,-1,-1,-1,-1,-1,-1,-1},
-{1091,1092,-1,-1,-1,-1,-1,-1,-1},
-{1092,1093,-1,-1,-1,-1,-1,-1,-1},
-{1093,1094,-1,-1,-1,-1,-1,-1,-1},
-{1094,1095,-1,-1,-1,-1,-1,-1,-1},
-{1095,1096,-1,-1,-1,-1,-1,-1,-1},
-{1096,1097,-1,-1,-1,-1,-1,-1,-1},
-{1097,1098,-1,-1,-1,-1,-1,-1,-1},
-{1098,1099,-1,-1,-1,-1,-1,-1,-1},
-{1099,-1,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_5_16=102;
+int mercury_normal_QCbase_5_16[951]={
+5,62,6,287,336,127,527,531,683,
+5,62,4,185,195,283,765,
+5,62,3,504,797,899,
+5,62,3,46,103,740,
+5,62,9,113,207,313,530,729,735,797,1022,1065,
+5,62,9,115,212,318,404,438,559,741,1024,1083,
+5,62,6,542,237,327,475,528,575,
+5,62,3,568,738,1087,
+5,62,9,56,61,93,150,253,269,416,832,949,
+5,62,4,457,510,994,1016,
+5,62,5,69,183,237,843,948,
+5,62,9,51,155,362,542,837,922,927,976,1045,
+5,62,7,9,359,415,693,882,1033,1038,
+5,62,9,188,234,252,357,503,628,712,812,941,
+5,62,9,185,296,676,701,720,727,875,972,1033,
+5,62,5,5,72,459,152,511,
+5,62,7,128,152,514,1016,1040,1071,1078,
+5,62,8,24,409,494,545,771,852,871,978,
+5,62,4,28,318,480,790,
+5,62,6,90,342,377,394,414,418,
+5,62,9,58,87,316,358,537,621,664,944,1057,
+5,62,8,58,90,130,454,306,387,564,695,
+5,62,7,50,148,353,490,596,814,924,
+5,62,3,140,553,680,
+5,62,6,88,351,599,640,851,913,
+5,62,8,52,87,145,233,323,439,637,881,
+5,62,8,65,216,255,417,418,812,836,1059,
+5,62,3,67,596,989,
+5,62,7,340,81,216,313,912,891,490,
+5,62,7,36,196,269,513,652,705,752,
+5,62,9,51,267,466,650,786,838,898,995,1035,
+5,62,5,577,711,757,905,1063,
+5,62,7,158,333,522,604,890,934,1042,
+5,62,5,88,369,568,790,840,
+5,62,6,370,434,586,628,637,790,
+5,62,8,98,143,178,417,532,752,795,855,
+5,62,6,324,482,690,832,846,900,
+5,62,6,264,352,428,497,586,1065,
+5,62,7,87,368,552,868,890,1014,1034,
+5,62,8,8,87,98,196,356,359,891,1051,
+5,62,5,577,682,713,949,987,
+5,62,7,246,386,745,747,814,863,993,
+5,62,5,160,217,799,650,797,
+5,62,3,402,519,749,
+5,62,9,463,480,550,562,565,589,898,951,1049,
+5,62,4,111,280,610,965,
+5,62,5,52,690,373,440,465,
+5,62,7,48,171,284,286,602,637,752,
+5,62,6,64,68,183,233,388,977,
+5,62,7,95,148,160,359,650,816,966,
+5,62,8,220,222,552,686,702,749,1060,1073,
+5,62,7,142,214,372,423,528,1025,1036,
+5,62,9,8,210,603,632,697,808,880,995,1092,
+5,62,3,26,59,857,
+5,62,6,144,160,184,708,729,949,
+5,62,7,365,646,894,150,139,748,820,
+5,62,8,63,329,159,406,724,914,501,115,
+5,62,3,175,816,599,
+5,62,7,37,429,729,781,832,914,1051,
+5,62,9,56,90,110,197,379,659,714,755,1056,
+5,62,6,449,577,711,785,919,971,
+5,62,8,385,509,676,815,904,911,987,1014,
+5,62,8,73,133,243,479,588,746,938,975,
+5,62,9,6,55,123,243,370,499,694,774,787,
+5,62,8,207,384,492,593,314,928,964,1077,
+5,62,4,641,732,760,994,
+5,62,4,172,188,607,832,
+5,62,8,55,71,441,539,672,792,829,934,
+5,62,7,40,412,648,704,934,940,1070,
+5,62,7,45,374,502,742,796,809,10,
+5,62,6,33,487,590,674,935,342,
+5,62,3,272,374,813,
+5,62,3,154,200,276,
+5,62,9,5,33,170,294,445,447,742,919,995,
+5,62,3,349,462,628,
+5,62,7,128,151,293,396,565,647,857,
+5,62,9,115,226,262,539,654,938,1014,1020,1029,
+5,62,9,69,285,363,414,423,442,451,1067,1076,
+5,62,7,186,277,316,613,619,912,1065,
+5,62,5,93,420,438,582,899,
+5,62,4,500,683,737,814,
+5,62,7,175,266,269,331,861,915,946,
+5,62,4,421,704,748,782,
+5,62,8,133,339,366,375,413,584,643,884,
+5,62,7,79,98,151,384,433,674,796,
+5,62,6,149,258,418,497,209,98,
+5,62,4,433,806,827,1007,
+5,62,7,328,475,542,583,605,1040,1089,
+5,62,4,349,869,899,913,
+5,62,9,50,67,75,321,353,502,599,625,678,
+5,62,3,486,621,920,
+5,62,8,348,392,533,636,778,915,975,978,
+5,62,4,190,551,978,1013,
+5,62,9,142,227,340,556,767,826,1037,1087,1089,
+5,62,8,141,170,611,644,784,814,842,937,
+5,62,6,20,88,621,656,954,987,
+5,62,5,405,565,686,877,1076,
+5,62,9,127,135,193,671,792,801,814,886,1027,
+5,62,9,125,133,275,445,447,736,747,749,1035,
+5,62,8,98,155,206,641,786,893,1017,1041,
+1099,1,2,0,1,
+1,0,1,1099};
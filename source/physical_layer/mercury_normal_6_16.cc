@@ -25,3610 +25,607 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_6_16.h"
-int mercury_normal_Cwidth_6_16=13;
-int mercury_normal_Vwidth_6_16=9;
-int mercury_normal_dwidth_6_16=1048;
-int mercury_normal_QCmatrixd_6_16[1048]={1,3,1,6,2,8,1,9,1,5,2,7,1,6,1,7,1,5,1,9,2,7,1,6,1,9,1,3,1,4,1,3,2,7,1,9,1,8,1,4,1,3,1,6,1,3,1,5,1,6,1,7,1,5,2,9,1,7,1,3,1,6,2,5,1,8,1,4,1,3,1,6,1,8,1,6,1,7,1,3,1,4,1,6,1,5,1,9,1,7,1,4,1,7,1,6,1,8,3,4,1,8,1,9,1,3,1,7,1,3,2,9,1,5,1,9,1,8,1,5,1,7,2,3,1,7,1,6,1,9,2,3,1,9,1,7,1,9,1,7,3,4,1,7,1,6,1,4,1,6,1,4,2,9,2,6,2,7,1,6,2,5,1,4,1,3,1,5,1,7,1,6,1,7,1,9,1,7,1,3,1,5,1,4,1,8,1,9,2,3,1,4,1,7,1,5,1,8,1,6,1,7,1,8,3,9,1,7,1,6,1,8,1,4,1,7,1,3,1,6,1,7,1,9,1,7,1,4,1,9,1,3,1,4,1,8,3,4,2,7,1,4,1,8,1,4,1,8,1,7,1,3,1,6,1,9,1,6,1,4,1,3,1,9,1,5,1,6,1,9,1,3,1,7,1,5,2,6,1,9,1,8,2,6,1,5,1,7,1,8,1,6,2,8,1,5,1,7,1,9,1,4,1,5,1,4,1,8,1,6,1,9,1,8,1,3,1,9,2,7,1,4,1,9,1,7,1,4,1,9,1,7,1,3,1,7,1,6,1,3,1,7,1,3,1,6,1,8,2,7,1,5,1,9,1,3,1,6,1,7,1,6,1,9,1,8,1,4,1,3,1,5,2,8,1,6,1,7,1,9,1,8,1,9,1,8,1,7,1,4,1,5,1,3,2,7,1,4,1,3,1,5,1,6,1,8,1,9,1,4,1,7,1,9,1,7,1,6,1,8,1,5,1,6,1,8,1,7,1,9,1,6,1,9,1,8,2,4,1,5,1,4,1,3,2,9,2,8,1,9,1,6,1,9,1,7,1,5,1,9,1,5,1,6,1,4,1,7,1,5,1,6,1,9,1,4,1,5,1,3,1,7,1,5,1,8,1,3,1,5,2,7,1,5,1,8,2,7,1,5,1,9,1,7,2,3,1,6,2,7,1,5,2,9,1,7,2,5,1,8,1,9,1,4,1,6,1,5,1,4,2,9,1,7,1,3,1,4,1,8,1,3,1,9,1,8,1,5,1,3,1,9,1,8,1,9,1,3,1,5,1,4,2,6,1,4,2,7,2,4,1,3,1,7,1,3,2,7,1,6,1,3,1,6,1,3,1,4,2,3,1,8,1,9,1,6,1,7,1,8,1,9,1,8,2,3,1,8,1,9,2,8,1,9,1,6,2,4,1,3,1,7,2,3,1,5,1,7,1,6,1,3,1,4,1,5,1,3,1,5,3,3,1,4,1,5,1,9,1,7,1,3,1,9,1,3,1,7,1,4,1,5,2,3,2,9,1,4,1,6,1,8,1,4,1,7,1,3,1,4,1,6,1,8,1,3,2,8,1,3,1,4,1,5,1,9,1,8,1,4,1,7,1,9,1,4,1,8,2,9,1,3,1,7,1,4,3,7,1,6,1,9,1,6,1,3,1,7,1,5,1,4,1,3,2,7,1,4,2,5,1,9,1,6,1,3,1,4,1,5,1,9,2,3,1,7,1,3,1,9,1,7,1,6,1,9,1,7,1,6,1,7,1,9,1,7,2,4,1,7,1,8,1,9,1,5,1,9,1,6,1,4,2,5,1,8,1,4,1,7,2,9,1,4,3,5,1,9,1,5,1,3,1,6,1,3,1,4,1,8,1,9,2,6,1,5,1,3,1,7,1,8,1,7,2,9,1,5,1,3,1,5,1,3,1,8,4,6,1,5,1,3,1,5,1,9,1,7,1,5,1,4,1,9,1,8,1,4,1,8,1,4,1,6,1,4,1,5,1,3,1,8,1,7,1,8,1,9,1,4,1,8,1,6,1,5,1,9,1,7,1,8,1,5,1,9,1,3,1,9,1,4,1,7,2,9,1,5,1,8,1,6,1,7,1,3,1,6,1,7,1,3,1,6,1,3,1,4,1,8,1,6,2,7,1,8,1,7,1,6,1,7,1,6,1,7,1,6,1,7,1,4,1,8,1,4,1,3,1,8,2,4,1,6,1,8,1,6,1,8,1,5,3,3,1,8,1,4,1,3,1,4,1,3,1,7,1,8,1,6,1,3,1,7,1,8,1,5,2,7,1,8,1,6,1,4,1,3,1,6,1,9,2,4,2,3,1,9,1,6,1,4,1,5,1,4,1,8,1,5,1,9,1,5,999,2,1,1};
-int mercury_normal_QCmatrixC_6_16[1000][13]={
-{63,159,195,557,600,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,294,299,600,601,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,327,377,601,602,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,91,137,247,404,447,602,603,-1,-1,-1,-1,-1},
-{13,166,211,603,604,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,58,200,345,449,526,545,604,605,-1,-1,-1,-1},
-{179,200,371,605,606,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,118,220,297,606,607,-1,-1,-1,-1,-1,-1,-1},
-{85,125,145,224,462,567,607,608,-1,-1,-1,-1,-1},
-{14,214,296,315,414,448,608,609,-1,-1,-1,-1,-1},
-{141,389,609,610,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,77,254,298,408,522,593,610,611,-1,-1,-1,-1},
-{173,611,612,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,302,411,612,613,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,240,384,423,478,582,613,614,-1,-1,-1,-1,-1},
-{38,186,197,237,321,614,615,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,147,341,464,571,616,617,-1,-1,-1,-1,-1,-1},
-{12,19,160,413,427,617,618,-1,-1,-1,-1,-1,-1},
-{243,361,618,619,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,118,230,619,620,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,253,256,335,620,621,-1,-1,-1,-1,-1,-1,-1},
-{83,163,202,203,493,621,622,-1,-1,-1,-1,-1,-1},
-{2,375,622,623,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,623,624,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,387,624,625,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,166,333,513,625,626,-1,-1,-1,-1,-1,-1,-1},
-{203,315,381,530,545,626,627,-1,-1,-1,-1,-1,-1},
-{251,282,424,493,627,628,-1,-1,-1,-1,-1,-1,-1},
-{146,169,212,325,425,628,629,-1,-1,-1,-1,-1,-1},
-{35,181,238,485,629,630,-1,-1,-1,-1,-1,-1,-1},
-{246,391,507,518,630,631,-1,-1,-1,-1,-1,-1,-1},
-{303,428,555,631,632,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,632,633,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,152,463,633,634,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,189,235,634,635,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,387,511,635,636,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,10,21,77,595,636,637,-1,-1,-1,-1,-1,-1},
-{222,456,637,638,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,221,466,468,638,639,-1,-1,-1,-1,-1,-1,-1},
-{154,236,639,640,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{283,312,640,641,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,282,547,582,641,642,-1,-1,-1,-1,-1,-1,-1},
-{88,403,642,643,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{402,537,643,644,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,169,585,644,645,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,306,645,646,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,455,646,647,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,167,195,230,647,648,-1,-1,-1,-1,-1,-1,-1},
-{29,241,576,648,649,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,569,649,650,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,434,650,651,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,556,651,652,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,163,541,652,653,-1,-1,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,58,170,454,492,567,654,655,-1,-1,-1,-1,-1},
-{43,565,655,656,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,368,388,406,656,657,-1,-1,-1,-1,-1,-1,-1},
-{26,185,196,285,336,531,657,658,-1,-1,-1,-1,-1},
-{209,658,659,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,504,515,581,659,660,-1,-1,-1,-1,-1,-1,-1},
-{407,408,522,660,661,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,661,662,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,42,90,95,235,662,663,-1,-1,-1,-1,-1,-1},
-{188,324,386,407,663,664,-1,-1,-1,-1,-1,-1,-1},
-{411,664,665,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,336,380,665,666,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,247,586,666,667,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,106,290,500,667,668,-1,-1,-1,-1,-1,-1,-1},
-{175,372,468,577,582,668,669,-1,-1,-1,-1,-1,-1},
-{335,669,670,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,196,245,358,442,670,671,-1,-1,-1,-1,-1,-1},
-{66,261,465,671,672,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,324,385,672,673,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,233,561,673,674,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,340,378,474,674,675,-1,-1,-1,-1,-1,-1,-1},
-{119,402,557,675,676,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,676,677,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,238,402,677,678,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,373,598,678,679,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,289,532,679,680,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,132,236,285,466,680,681,-1,-1,-1,-1,-1,-1},
-{168,385,542,578,681,682,-1,-1,-1,-1,-1,-1,-1},
-{6,53,96,116,220,309,345,468,682,683,-1,-1,-1},
-{195,309,319,683,684,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,527,592,684,685,-1,-1,-1,-1,-1,-1,-1,-1},
-{242,365,507,685,686,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,220,342,405,686,687,-1,-1,-1,-1,-1,-1,-1},
-{352,687,688,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,257,498,527,688,689,-1,-1,-1,-1,-1,-1,-1},
-{188,482,689,690,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,146,690,691,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,195,420,441,579,587,691,692,-1,-1,-1,-1,-1},
-{192,362,366,374,427,469,472,556,692,693,-1,-1,-1},
-{496,693,694,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,548,559,579,694,695,-1,-1,-1,-1,-1,-1,-1},
-{59,100,221,314,695,696,-1,-1,-1,-1,-1,-1,-1},
-{38,188,323,413,416,424,439,696,697,-1,-1,-1,-1},
-{32,453,697,698,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,698,699,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,417,455,469,546,699,700,-1,-1,-1,-1,-1,-1},
-{41,94,334,489,545,700,701,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{284,449,498,525,702,703,-1,-1,-1,-1,-1,-1,-1},
-{182,311,375,445,703,704,-1,-1,-1,-1,-1,-1,-1},
-{281,314,430,586,704,705,-1,-1,-1,-1,-1,-1,-1},
-{79,214,235,317,705,706,-1,-1,-1,-1,-1,-1,-1},
-{228,231,385,706,707,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,471,577,707,708,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,124,215,242,255,458,708,709,-1,-1,-1,-1,-1},
-{313,553,595,709,710,-1,-1,-1,-1,-1,-1,-1,-1},
-{371,404,563,710,711,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,110,111,219,244,245,253,400,711,712,-1,-1,-1},
-{75,232,518,580,712,713,-1,-1,-1,-1,-1,-1,-1},
-{353,713,714,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,237,366,457,499,714,715,-1,-1,-1,-1,-1,-1},
-{63,130,395,404,416,524,715,716,-1,-1,-1,-1,-1},
-{222,243,279,286,434,560,716,717,-1,-1,-1,-1,-1},
-{96,118,157,717,718,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,274,718,719,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,59,66,283,389,425,719,720,-1,-1,-1,-1,-1},
-{567,720,721,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{542,547,573,721,722,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,172,546,722,723,-1,-1,-1,-1,-1,-1,-1,-1},
-{452,481,723,724,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,191,355,585,724,725,-1,-1,-1,-1,-1,-1,-1},
-{390,411,462,580,725,726,-1,-1,-1,-1,-1,-1,-1},
-{271,462,726,727,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,177,253,727,728,-1,-1,-1,-1,-1,-1,-1,-1},
-{307,514,527,581,728,729,-1,-1,-1,-1,-1,-1,-1},
-{6,266,729,730,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,281,385,474,730,731,-1,-1,-1,-1,-1,-1,-1},
-{163,188,210,295,423,450,473,482,731,732,-1,-1,-1},
-{104,125,256,332,732,733,-1,-1,-1,-1,-1,-1,-1},
-{120,263,317,411,733,734,-1,-1,-1,-1,-1,-1,-1},
-{38,551,568,570,734,735,-1,-1,-1,-1,-1,-1,-1},
-{149,264,306,735,736,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,181,438,736,737,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,189,223,737,738,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,443,499,509,526,738,739,-1,-1,-1,-1,-1,-1},
-{131,320,739,740,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,187,448,588,740,741,-1,-1,-1,-1,-1,-1,-1},
-{53,215,305,468,522,741,742,-1,-1,-1,-1,-1,-1},
-{54,305,319,345,422,494,520,742,743,-1,-1,-1,-1},
-{167,743,744,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,312,313,429,507,744,745,-1,-1,-1,-1,-1,-1},
-{109,412,420,426,524,745,746,-1,-1,-1,-1,-1,-1},
-{224,227,440,478,523,524,746,747,-1,-1,-1,-1,-1},
-{435,471,747,748,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,109,748,749,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,198,301,540,561,749,750,-1,-1,-1,-1,-1,-1},
-{144,570,750,751,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,395,446,510,751,752,-1,-1,-1,-1,-1,-1,-1},
-{64,363,365,461,752,753,-1,-1,-1,-1,-1,-1,-1},
-{28,221,358,753,754,-1,-1,-1,-1,-1,-1,-1,-1},
-{581,754,755,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,755,756,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{269,561,756,757,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{312,757,758,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{292,522,552,758,759,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,162,172,519,759,760,-1,-1,-1,-1,-1,-1,-1},
-{42,401,437,515,760,761,-1,-1,-1,-1,-1,-1,-1},
-{127,488,761,762,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,169,285,358,762,763,-1,-1,-1,-1,-1,-1,-1},
-{52,217,303,335,374,394,544,763,764,-1,-1,-1,-1},
-{255,513,764,765,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,765,766,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,480,483,766,767,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,458,568,767,768,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,163,310,327,768,769,-1,-1,-1,-1,-1,-1,-1},
-{379,405,454,465,769,770,-1,-1,-1,-1,-1,-1,-1},
-{189,206,262,484,770,771,-1,-1,-1,-1,-1,-1,-1},
-{396,508,550,591,771,772,-1,-1,-1,-1,-1,-1,-1},
-{49,78,216,254,288,407,772,773,-1,-1,-1,-1,-1},
-{285,416,430,439,446,484,491,572,586,773,774,-1,-1},
-{125,180,261,275,491,774,775,-1,-1,-1,-1,-1,-1},
-{15,191,192,775,776,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,385,583,776,777,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,34,189,299,777,778,-1,-1,-1,-1,-1,-1,-1},
-{13,46,166,353,384,394,427,778,779,-1,-1,-1,-1},
-{149,212,294,484,779,780,-1,-1,-1,-1,-1,-1,-1},
-{56,121,243,246,377,437,780,781,-1,-1,-1,-1,-1},
-{137,572,599,781,782,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,782,783,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{417,550,562,581,783,784,-1,-1,-1,-1,-1,-1,-1},
-{174,216,252,296,306,349,534,784,785,-1,-1,-1,-1},
-{510,511,785,786,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,379,556,559,786,787,-1,-1,-1,-1,-1,-1,-1},
-{253,304,450,787,788,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,174,218,587,788,789,-1,-1,-1,-1,-1,-1,-1},
-{74,90,344,789,790,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,252,790,791,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,133,154,239,396,442,489,526,791,792,-1,-1,-1},
-{231,475,591,594,792,793,-1,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{291,794,795,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,194,260,311,517,795,796,-1,-1,-1,-1,-1,-1},
-{214,477,490,585,796,797,-1,-1,-1,-1,-1,-1,-1},
-{84,218,289,450,578,797,798,-1,-1,-1,-1,-1,-1},
-{124,236,291,798,799,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,377,799,800,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,119,124,166,234,474,479,528,599,800,801,-1,-1},
-{77,452,522,801,802,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,802,803,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,264,377,803,804,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,133,340,409,804,805,-1,-1,-1,-1,-1,-1,-1},
-{805,806,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,443,598,806,807,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,204,210,467,807,808,-1,-1,-1,-1,-1,-1,-1},
-{79,149,256,305,336,475,511,592,808,809,-1,-1,-1},
-{588,809,810,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{810,811,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{239,246,811,812,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,164,171,283,427,457,813,814,-1,-1,-1,-1,-1},
-{3,215,814,815,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,489,815,816,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,180,816,817,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{398,408,503,512,514,817,818,-1,-1,-1,-1,-1,-1},
-{141,280,295,446,818,819,-1,-1,-1,-1,-1,-1,-1},
-{114,233,236,305,433,596,819,820,-1,-1,-1,-1,-1},
-{820,821,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,65,105,175,186,821,822,-1,-1,-1,-1,-1,-1},
-{345,478,822,823,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,420,456,459,823,824,-1,-1,-1,-1,-1,-1,-1},
-{227,463,473,506,824,825,-1,-1,-1,-1,-1,-1,-1},
-{246,286,825,826,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{390,420,433,826,827,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,244,262,352,827,828,-1,-1,-1,-1,-1,-1,-1},
-{87,121,129,306,323,422,580,828,829,-1,-1,-1,-1},
-{61,258,547,829,830,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,259,304,830,831,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,45,84,109,333,421,572,831,832,-1,-1,-1,-1},
-{198,285,544,598,832,833,-1,-1,-1,-1,-1,-1,-1},
-{497,586,833,834,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,144,161,177,202,232,350,356,492,834,835,-1,-1},
-{79,121,154,442,835,836,-1,-1,-1,-1,-1,-1,-1},
-{139,380,836,837,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,77,79,147,176,184,412,493,518,837,838,-1,-1},
-{49,199,268,587,838,839,-1,-1,-1,-1,-1,-1,-1},
-{120,201,394,839,840,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,110,840,841,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,311,841,842,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,136,842,843,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,157,181,182,206,253,843,844,-1,-1,-1,-1,-1},
-{103,214,844,845,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,103,331,452,506,845,846,-1,-1,-1,-1,-1,-1},
-{101,453,528,573,846,847,-1,-1,-1,-1,-1,-1,-1},
-{144,207,550,554,847,848,-1,-1,-1,-1,-1,-1,-1},
-{101,202,848,849,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,381,467,480,849,850,-1,-1,-1,-1,-1,-1,-1},
-{28,56,304,488,850,851,-1,-1,-1,-1,-1,-1,-1},
-{59,851,852,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,68,506,852,853,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,192,232,247,269,286,299,570,853,854,-1,-1,-1},
-{257,261,263,346,452,569,571,854,855,-1,-1,-1,-1},
-{77,89,377,474,577,855,856,-1,-1,-1,-1,-1,-1},
-{134,856,857,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,346,355,857,858,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,232,374,858,859,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,93,116,859,860,-1,-1,-1,-1,-1,-1,-1,-1},
-{300,397,403,860,861,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,332,455,861,862,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,115,168,862,863,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,316,349,431,863,864,-1,-1,-1,-1,-1,-1,-1},
-{40,181,257,353,459,483,594,864,865,-1,-1,-1,-1},
-{58,402,420,513,539,865,866,-1,-1,-1,-1,-1,-1},
-{414,866,867,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{250,287,358,461,556,867,868,-1,-1,-1,-1,-1,-1},
-{18,67,581,588,868,869,-1,-1,-1,-1,-1,-1,-1},
-{72,194,203,469,584,869,870,-1,-1,-1,-1,-1,-1},
-{11,68,92,429,870,871,-1,-1,-1,-1,-1,-1,-1},
-{560,871,872,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{352,466,550,872,873,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,127,302,321,575,873,874,-1,-1,-1,-1,-1,-1},
-{89,117,459,874,875,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,131,289,875,876,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,90,876,877,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{442,591,877,878,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,430,471,548,878,879,-1,-1,-1,-1,-1,-1,-1},
-{254,879,880,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{405,551,880,881,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,27,203,310,881,882,-1,-1,-1,-1,-1,-1,-1},
-{104,444,545,882,883,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,443,883,884,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{233,353,519,884,885,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,119,212,265,417,446,524,885,886,-1,-1,-1,-1},
-{3,451,886,887,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,189,343,887,888,-1,-1,-1,-1,-1,-1,-1,-1},
-{231,335,888,889,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,311,459,889,890,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,94,393,497,526,529,582,890,891,-1,-1,-1,-1},
-{238,342,349,537,581,891,892,-1,-1,-1,-1,-1,-1},
-{205,261,275,305,380,428,892,893,-1,-1,-1,-1,-1},
-{19,134,154,340,471,544,893,894,-1,-1,-1,-1,-1},
-{13,245,373,375,484,566,894,895,-1,-1,-1,-1,-1},
-{1,105,347,529,597,895,896,-1,-1,-1,-1,-1,-1},
-{463,537,896,897,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,354,897,898,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,108,168,197,314,898,899,-1,-1,-1,-1,-1,-1},
-{227,899,900,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{200,285,376,492,516,900,901,-1,-1,-1,-1,-1,-1},
-{10,218,388,395,409,901,902,-1,-1,-1,-1,-1,-1},
-{95,276,433,472,597,902,903,-1,-1,-1,-1,-1,-1},
-{244,337,461,518,903,904,-1,-1,-1,-1,-1,-1,-1},
-{9,64,164,180,904,905,-1,-1,-1,-1,-1,-1,-1},
-{185,559,905,906,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{306,308,363,385,489,906,907,-1,-1,-1,-1,-1,-1},
-{100,119,173,210,214,413,577,907,908,-1,-1,-1,-1},
-{9,117,171,209,288,543,586,908,909,-1,-1,-1,-1},
-{12,13,490,909,910,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,37,63,114,213,254,910,911,-1,-1,-1,-1,-1},
-{21,219,264,322,331,460,911,912,-1,-1,-1,-1,-1},
-{38,282,451,912,913,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,193,322,327,530,913,914,-1,-1,-1,-1,-1,-1},
-{77,85,143,151,269,286,914,915,-1,-1,-1,-1,-1},
-{213,363,915,916,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,64,229,916,917,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,279,531,917,918,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,248,271,408,447,509,918,919,-1,-1,-1,-1,-1},
-{66,311,505,919,920,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,128,374,430,466,475,573,920,921,-1,-1,-1,-1},
-{8,164,222,264,501,921,922,-1,-1,-1,-1,-1,-1},
-{101,162,308,521,922,923,-1,-1,-1,-1,-1,-1,-1},
-{94,194,405,527,923,924,-1,-1,-1,-1,-1,-1,-1},
-{91,158,352,425,924,925,-1,-1,-1,-1,-1,-1,-1},
-{240,269,415,516,555,925,926,-1,-1,-1,-1,-1,-1},
-{91,121,189,278,300,561,579,926,927,-1,-1,-1,-1},
-{88,387,422,927,928,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,495,580,585,928,929,-1,-1,-1,-1,-1,-1,-1},
-{214,929,930,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{331,930,931,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{364,464,931,932,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{461,932,933,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{351,397,522,537,933,934,-1,-1,-1,-1,-1,-1,-1},
-{15,24,72,125,250,283,366,934,935,-1,-1,-1,-1},
-{360,935,936,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,36,40,66,144,251,936,937,-1,-1,-1,-1,-1},
-{84,182,188,197,358,443,937,938,-1,-1,-1,-1,-1},
-{383,491,526,536,938,939,-1,-1,-1,-1,-1,-1,-1},
-{22,218,330,939,940,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,167,419,540,940,941,-1,-1,-1,-1,-1,-1,-1},
-{153,284,941,942,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,112,179,434,942,943,-1,-1,-1,-1,-1,-1,-1},
-{271,286,441,943,944,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,227,463,944,945,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,275,316,542,945,946,-1,-1,-1,-1,-1,-1,-1},
-{215,263,946,947,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,257,352,355,498,947,948,-1,-1,-1,-1,-1,-1},
-{209,244,298,302,460,948,949,-1,-1,-1,-1,-1,-1},
-{273,949,950,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,474,553,950,951,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,221,321,951,952,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,952,953,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{953,954,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,200,426,512,954,955,-1,-1,-1,-1,-1,-1,-1},
-{54,134,337,955,956,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,182,277,956,957,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,266,349,379,957,958,-1,-1,-1,-1,-1,-1,-1},
-{20,958,959,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,346,386,392,480,558,959,960,-1,-1,-1,-1,-1},
-{220,561,594,960,961,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,242,258,961,962,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,278,300,962,963,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,130,215,266,350,398,541,963,964,-1,-1,-1,-1},
-{260,295,964,965,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,71,218,240,251,326,965,966,-1,-1,-1,-1,-1},
-{39,147,329,353,482,539,541,547,966,967,-1,-1,-1},
-{384,514,967,968,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,108,120,191,409,527,542,547,968,969,-1,-1,-1},
-{273,969,970,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,70,184,326,970,971,-1,-1,-1,-1,-1,-1,-1},
-{401,435,453,971,972,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,175,199,266,389,550,972,973,-1,-1,-1,-1,-1},
-{6,205,320,324,973,974,-1,-1,-1,-1,-1,-1,-1},
-{19,974,975,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{446,464,975,976,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,54,373,432,480,976,977,-1,-1,-1,-1,-1,-1},
-{25,334,399,461,548,977,978,-1,-1,-1,-1,-1,-1},
-{79,179,978,979,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{441,579,979,980,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{980,981,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,97,312,333,446,450,469,528,981,982,-1,-1,-1},
-{8,227,335,443,467,982,983,-1,-1,-1,-1,-1,-1},
-{109,477,983,984,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,558,984,985,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,219,985,986,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,217,287,392,544,592,986,987,-1,-1,-1,-1,-1},
-{428,987,988,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,61,444,566,988,989,-1,-1,-1,-1,-1,-1,-1},
-{122,233,249,534,577,989,990,-1,-1,-1,-1,-1,-1},
-{38,454,990,991,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,329,568,991,992,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,174,213,299,342,453,992,993,-1,-1,-1,-1,-1},
-{388,476,506,993,994,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,139,240,344,526,591,994,995,-1,-1,-1,-1,-1},
-{444,524,995,996,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,339,374,399,453,996,997,-1,-1,-1,-1,-1,-1},
-{47,95,219,249,997,998,-1,-1,-1,-1,-1,-1,-1},
-{101,178,357,468,998,999,-1,-1,-1,-1,-1,-1,-1},
-{321,417,418,999,1000,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,311,359,1000,1001,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,142,154,534,1001,1002,-1,-1,-1,-1,-1,-1,-1},
-{492,1002,1003,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,1003,1004,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,88,130,298,521,1004,1005,-1,-1,-1,-1,-1,-1},
-{299,312,346,572,1005,1006,-1,-1,-1,-1,-1,-1,-1},
-{12,137,208,349,405,462,549,1006,1007,-1,-1,-1,-1},
-{42,156,304,505,1007,1008,-1,-1,-1,-1,-1,-1,-1},
-{142,439,1008,1009,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{330,440,480,1009,1010,-1,-1,-1,-1,-1,-1,-1,-1},
-{445,511,579,1010,1011,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,328,338,369,576,1011,1012,-1,-1,-1,-1,-1,-1},
-{48,218,414,495,1012,1013,-1,-1,-1,-1,-1,-1,-1},
-{85,262,518,583,1013,1014,-1,-1,-1,-1,-1,-1,-1},
-{63,1014,1015,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,379,562,1015,1016,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,195,1016,1017,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{269,417,481,494,1017,1018,-1,-1,-1,-1,-1,-1,-1},
-{79,164,296,306,532,1018,1019,-1,-1,-1,-1,-1,-1},
-{315,513,528,1019,1020,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,535,1020,1021,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,317,365,466,1021,1022,-1,-1,-1,-1,-1,-1,-1},
-{344,383,1022,1023,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,145,206,1023,1024,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,82,113,163,219,258,362,437,534,1024,1025,-1,-1},
-{160,552,1025,1026,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,83,231,402,591,598,1026,1027,-1,-1,-1,-1,-1},
-{89,269,372,396,1027,1028,-1,-1,-1,-1,-1,-1,-1},
-{32,108,524,1028,1029,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,74,81,549,1029,1030,-1,-1,-1,-1,-1,-1,-1},
-{74,134,253,255,526,1030,1031,-1,-1,-1,-1,-1,-1},
-{79,83,407,483,1031,1032,-1,-1,-1,-1,-1,-1,-1},
-{209,231,1032,1033,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,262,265,429,1033,1034,-1,-1,-1,-1,-1,-1,-1},
-{29,89,210,311,376,481,590,1034,1035,-1,-1,-1,-1},
-{137,213,452,1035,1036,-1,-1,-1,-1,-1,-1,-1,-1},
-{463,1036,1037,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,114,362,465,1037,1038,-1,-1,-1,-1,-1,-1,-1},
-{146,150,159,494,1038,1039,-1,-1,-1,-1,-1,-1,-1},
-{242,248,379,1039,1040,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,452,527,531,1040,1041,-1,-1,-1,-1,-1,-1,-1},
-{35,301,351,383,598,1041,1042,-1,-1,-1,-1,-1,-1},
-{32,134,260,269,358,475,560,1042,1043,-1,-1,-1,-1},
-{104,315,1043,1044,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,110,122,310,421,1044,1045,-1,-1,-1,-1,-1,-1},
-{331,388,586,1045,1046,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,494,1046,1047,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,293,487,1047,1048,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,121,165,250,260,277,292,294,335,592,1048,1049,-1},
-{49,272,282,407,512,533,1049,1050,-1,-1,-1,-1,-1},
-{154,449,450,1050,1051,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,343,418,425,517,563,592,1051,1052,-1,-1,-1,-1},
-{132,306,346,396,446,577,1052,1053,-1,-1,-1,-1,-1},
-{4,223,256,396,515,528,1053,1054,-1,-1,-1,-1,-1},
-{184,229,261,470,563,1054,1055,-1,-1,-1,-1,-1,-1},
-{150,170,384,435,518,573,1055,1056,-1,-1,-1,-1,-1},
-{279,360,1056,1057,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1057,1058,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,387,392,1058,1059,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,396,468,496,1059,1060,-1,-1,-1,-1,-1,-1,-1},
-{122,415,546,1060,1061,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,107,184,198,221,282,363,429,1061,1062,-1,-1,-1},
-{194,1062,1063,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,183,438,487,501,1063,1064,-1,-1,-1,-1,-1,-1},
-{32,1064,1065,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,96,400,1065,1066,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,518,1066,1067,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,122,151,287,354,456,486,519,545,1067,1068,-1,-1},
-{67,94,113,140,455,499,530,1068,1069,-1,-1,-1,-1},
-{274,1069,1070,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{208,397,544,1070,1071,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,208,230,293,440,460,572,1071,1072,-1,-1,-1,-1},
-{14,72,120,140,149,163,164,525,591,1072,1073,-1,-1},
-{136,172,194,289,349,372,480,1073,1074,-1,-1,-1,-1},
-{83,308,572,1074,1075,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,219,280,497,1075,1076,-1,-1,-1,-1,-1,-1,-1},
-{21,142,161,574,1076,1077,-1,-1,-1,-1,-1,-1,-1},
-{3,21,1077,1078,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,349,457,523,1078,1079,-1,-1,-1,-1,-1,-1,-1},
-{504,510,1079,1080,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,163,210,518,1080,1081,-1,-1,-1,-1,-1,-1,-1},
-{59,104,246,351,357,1081,1082,-1,-1,-1,-1,-1,-1},
-{393,1082,1083,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,301,1083,1084,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,346,365,519,586,1084,1085,-1,-1,-1,-1,-1,-1},
-{194,299,1085,1086,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,209,476,520,1086,1087,-1,-1,-1,-1,-1,-1,-1},
-{131,331,475,1087,1088,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,155,281,382,1088,1089,-1,-1,-1,-1,-1,-1,-1},
-{345,408,476,515,583,594,1089,1090,-1,-1,-1,-1,-1},
-{39,165,172,241,313,315,1090,1091,-1,-1,-1,-1,-1},
-{110,507,1091,1092,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,113,147,200,294,351,393,1092,1093,-1,-1,-1,-1},
-{76,102,1093,1094,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{559,1094,1095,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,1095,1096,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,556,584,1096,1097,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,175,318,328,418,428,489,498,539,596,1097,1098,-1},
-{25,275,278,313,427,1098,1099,-1,-1,-1,-1,-1,-1},
-{121,279,1099,1100,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,217,353,398,1100,1101,-1,-1,-1,-1,-1,-1,-1},
-{255,290,552,574,1101,1102,-1,-1,-1,-1,-1,-1,-1},
-{246,294,1102,1103,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{252,491,530,1103,1104,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,262,374,500,1104,1105,-1,-1,-1,-1,-1,-1,-1},
-{236,1105,1106,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{332,342,463,498,557,1106,1107,-1,-1,-1,-1,-1,-1},
-{218,220,224,239,1107,1108,-1,-1,-1,-1,-1,-1,-1},
-{105,410,413,549,1108,1109,-1,-1,-1,-1,-1,-1,-1},
-{166,337,1109,1110,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,292,298,528,563,1110,1111,-1,-1,-1,-1,-1,-1},
-{90,281,1111,1112,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{388,1112,1113,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,401,474,1113,1114,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,363,559,1114,1115,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,64,113,120,168,197,559,1115,1116,-1,-1,-1,-1},
-{159,384,467,1116,1117,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,245,316,344,351,1117,1118,-1,-1,-1,-1,-1,-1},
-{140,396,511,520,581,1118,1119,-1,-1,-1,-1,-1,-1},
-{169,190,343,491,1119,1120,-1,-1,-1,-1,-1,-1,-1},
-{157,1120,1121,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,1121,1122,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,298,451,1122,1123,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,149,226,477,515,1123,1124,-1,-1,-1,-1,-1,-1},
-{217,220,238,535,1124,1125,-1,-1,-1,-1,-1,-1,-1},
-{1125,1126,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,253,1126,1127,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,351,1127,1128,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,290,316,325,346,582,1128,1129,-1,-1,-1,-1,-1},
-{233,260,362,411,431,1129,1130,-1,-1,-1,-1,-1,-1},
-{186,251,444,1130,1131,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,38,207,234,1131,1132,-1,-1,-1,-1,-1,-1,-1},
-{132,512,528,1132,1133,-1,-1,-1,-1,-1,-1,-1,-1},
-{415,1133,1134,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,408,485,1134,1135,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,186,372,1135,1136,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,239,1136,1137,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,1137,1138,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,297,1138,1139,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,233,312,348,1139,1140,-1,-1,-1,-1,-1,-1,-1},
-{54,207,236,318,325,394,552,1140,1141,-1,-1,-1,-1},
-{361,493,1141,1142,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{449,1142,1143,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,117,169,267,1143,1144,-1,-1,-1,-1,-1,-1,-1},
-{80,105,188,564,597,1144,1145,-1,-1,-1,-1,-1,-1},
-{9,216,485,488,1145,1146,-1,-1,-1,-1,-1,-1,-1},
-{65,110,116,134,265,1146,1147,-1,-1,-1,-1,-1,-1},
-{143,215,416,426,1147,1148,-1,-1,-1,-1,-1,-1,-1},
-{8,87,97,116,159,273,320,412,414,498,499,1148,1149},
-{48,228,332,1149,1150,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,63,475,573,1150,1151,-1,-1,-1,-1,-1,-1,-1},
-{115,184,469,551,1151,1152,-1,-1,-1,-1,-1,-1,-1},
-{177,1152,1153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{397,459,1153,1154,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,90,151,370,406,1154,1155,-1,-1,-1,-1,-1,-1},
-{157,384,1155,1156,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{211,241,525,1156,1157,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,53,84,1157,1158,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,1158,1159,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,110,244,433,1159,1160,-1,-1,-1,-1,-1,-1,-1},
-{44,236,279,1160,1161,-1,-1,-1,-1,-1,-1,-1,-1},
-{301,1161,1162,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,317,496,1162,1163,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,268,1163,1164,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,101,375,401,482,504,556,574,576,1164,1165,-1,-1},
-{103,226,289,322,411,543,1165,1166,-1,-1,-1,-1,-1},
-{59,164,1166,1167,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,319,551,1167,1168,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,489,562,1168,1169,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,459,1169,1170,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{301,412,454,1170,1171,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,106,283,347,438,467,1171,1172,-1,-1,-1,-1,-1},
-{32,246,422,502,1172,1173,-1,-1,-1,-1,-1,-1,-1},
-{577,1173,1174,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,319,320,405,413,433,463,1174,1175,-1,-1,-1,-1},
-{21,22,29,61,89,1175,1176,-1,-1,-1,-1,-1,-1},
-{153,341,345,556,1176,1177,-1,-1,-1,-1,-1,-1,-1},
-{297,340,424,483,562,1177,1178,-1,-1,-1,-1,-1,-1},
-{305,439,505,535,1178,1179,-1,-1,-1,-1,-1,-1,-1},
-{169,277,585,1179,1180,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,134,222,233,377,434,590,1180,1181,-1,-1,-1,-1},
-{209,354,429,548,1181,1182,-1,-1,-1,-1,-1,-1,-1},
-{11,44,371,393,1182,1183,-1,-1,-1,-1,-1,-1,-1},
-{204,352,546,1183,1184,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,174,1184,1185,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,591,1185,1186,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,363,370,1186,1187,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,1187,1188,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{339,342,352,390,404,1188,1189,-1,-1,-1,-1,-1,-1},
-{11,599,1189,1190,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{596,1190,1191,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,118,174,437,476,485,1191,1192,-1,-1,-1,-1,-1},
-{15,161,182,481,1192,1193,-1,-1,-1,-1,-1,-1,-1},
-{19,137,340,381,411,429,502,577,1193,1194,-1,-1,-1},
-{148,1194,1195,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,145,530,1195,1196,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,458,1196,1197,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,74,502,1197,1198,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,303,423,501,515,1198,1199,-1,-1,-1,-1,-1,-1},
-{240,598,1199,1200,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,94,512,520,572,597,1200,1201,-1,-1,-1,-1,-1},
-{99,102,157,408,501,1201,1202,-1,-1,-1,-1,-1,-1},
-{35,36,1202,1203,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,1203,1204,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,4,297,329,1204,1205,-1,-1,-1,-1,-1,-1,-1},
-{362,462,553,1205,1206,-1,-1,-1,-1,-1,-1,-1,-1},
-{330,1206,1207,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,586,1207,1208,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1208,1209,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,334,513,1209,1210,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,367,403,484,1210,1211,-1,-1,-1,-1,-1,-1,-1},
-{73,332,429,598,1211,1212,-1,-1,-1,-1,-1,-1,-1},
-{204,254,1212,1213,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,483,1213,1214,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{188,238,410,1214,1215,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,434,497,1215,1216,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,275,308,416,1216,1217,-1,-1,-1,-1,-1,-1,-1},
-{394,399,418,1217,1218,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,115,236,1218,1219,-1,-1,-1,-1,-1,-1,-1,-1},
-{532,1219,1220,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,233,247,560,1220,1221,-1,-1,-1,-1,-1,-1,-1},
-{356,1221,1222,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,120,141,351,379,474,501,1222,1223,-1,-1,-1,-1},
-{48,74,275,344,588,1223,1224,-1,-1,-1,-1,-1,-1},
-{141,238,417,532,1224,1225,-1,-1,-1,-1,-1,-1,-1},
-{28,127,361,379,1225,1226,-1,-1,-1,-1,-1,-1,-1},
-{159,418,450,497,509,1226,1227,-1,-1,-1,-1,-1,-1},
-{533,575,1227,1228,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,373,521,1228,1229,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,311,377,414,424,1229,1230,-1,-1,-1,-1,-1,-1},
-{214,452,477,501,1230,1231,-1,-1,-1,-1,-1,-1,-1},
-{268,269,413,563,1231,1232,-1,-1,-1,-1,-1,-1,-1},
-{138,464,1232,1233,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,86,237,317,354,1233,1234,-1,-1,-1,-1,-1,-1},
-{72,454,1234,1235,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,150,237,344,476,519,1235,1236,-1,-1,-1,-1,-1},
-{473,1236,1237,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{380,536,1237,1238,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,184,348,490,1238,1239,-1,-1,-1,-1,-1,-1,-1},
-{55,134,393,1239,1240,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,119,515,1240,1241,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,207,498,543,1241,1242,-1,-1,-1,-1,-1,-1,-1},
-{98,146,209,576,1242,1243,-1,-1,-1,-1,-1,-1,-1},
-{63,86,96,403,593,1243,1244,-1,-1,-1,-1,-1,-1},
-{1244,1245,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,481,532,1245,1246,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,224,256,281,1246,1247,-1,-1,-1,-1,-1,-1,-1},
-{31,1247,1248,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{447,480,580,1248,1249,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,202,499,1249,1250,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,194,536,1250,1251,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,262,434,482,1251,1252,-1,-1,-1,-1,-1,-1,-1},
-{129,333,1252,1253,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,176,186,406,434,579,1253,1254,-1,-1,-1,-1,-1},
-{37,325,1254,1255,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,91,127,309,529,1255,1256,-1,-1,-1,-1,-1,-1},
-{203,234,442,500,1256,1257,-1,-1,-1,-1,-1,-1,-1},
-{17,142,186,206,276,461,1257,1258,-1,-1,-1,-1,-1},
-{66,123,246,451,1258,1259,-1,-1,-1,-1,-1,-1,-1},
-{50,206,375,440,546,1259,1260,-1,-1,-1,-1,-1,-1},
-{109,127,182,394,415,1260,1261,-1,-1,-1,-1,-1,-1},
-{52,158,219,315,545,1261,1262,-1,-1,-1,-1,-1,-1},
-{14,242,428,454,1262,1263,-1,-1,-1,-1,-1,-1,-1},
-{201,211,376,402,1263,1264,-1,-1,-1,-1,-1,-1,-1},
-{150,1264,1265,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,69,89,109,184,417,462,1265,1266,-1,-1,-1,-1},
-{8,116,267,292,325,528,1266,1267,-1,-1,-1,-1,-1},
-{17,25,107,407,510,1267,1268,-1,-1,-1,-1,-1,-1},
-{230,538,1268,1269,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,126,1269,1270,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,74,244,283,378,497,502,1270,1271,-1,-1,-1,-1},
-{58,67,122,259,381,1271,1272,-1,-1,-1,-1,-1,-1},
-{294,1272,1273,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,119,447,1273,1274,-1,-1,-1,-1,-1,-1,-1,-1},
-{378,417,445,1274,1275,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,430,502,565,1275,1276,-1,-1,-1,-1,-1,-1,-1},
-{187,208,1276,1277,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,298,1277,1278,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,221,444,445,501,517,558,1278,1279,-1,-1,-1,-1},
-{165,300,390,451,1279,1280,-1,-1,-1,-1,-1,-1,-1},
-{7,74,170,350,520,553,1280,1281,-1,-1,-1,-1,-1},
-{400,1281,1282,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,1282,1283,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,147,173,516,522,1283,1284,-1,-1,-1,-1,-1,-1},
-{134,241,401,471,503,1284,1285,-1,-1,-1,-1,-1,-1},
-{439,474,590,1285,1286,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,293,502,1286,1287,-1,-1,-1,-1,-1,-1,-1,-1},
-{229,293,323,1287,1288,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,228,243,256,501,1288,1289,-1,-1,-1,-1,-1,-1},
-{534,1289,1290,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,521,1290,1291,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,290,523,1291,1292,-1,-1,-1,-1,-1,-1,-1,-1},
-{236,242,255,1292,1293,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,343,347,414,1293,1294,-1,-1,-1,-1,-1,-1,-1},
-{138,321,455,1294,1295,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,242,439,596,1295,1296,-1,-1,-1,-1,-1,-1,-1},
-{183,200,387,587,1296,1297,-1,-1,-1,-1,-1,-1,-1},
-{78,125,256,1297,1298,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,561,568,580,1298,1299,-1,-1,-1,-1,-1,-1,-1},
-{61,130,220,1299,1300,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,274,400,542,580,1300,1301,-1,-1,-1,-1,-1,-1},
-{97,463,1301,1302,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,309,331,547,553,1302,1303,-1,-1,-1,-1,-1,-1},
-{180,247,294,388,452,1303,1304,-1,-1,-1,-1,-1,-1},
-{218,341,1304,1305,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,93,162,1305,1306,-1,-1,-1,-1,-1,-1,-1,-1},
-{543,1306,1307,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,104,233,290,369,375,1307,1308,-1,-1,-1,-1,-1},
-{9,71,476,544,1308,1309,-1,-1,-1,-1,-1,-1,-1},
-{390,517,1309,1310,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,257,1310,1311,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,1311,1312,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,102,123,541,1312,1313,-1,-1,-1,-1,-1,-1,-1},
-{176,345,442,454,541,1313,1314,-1,-1,-1,-1,-1,-1},
-{282,1314,1315,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{508,537,1315,1316,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,80,273,567,1316,1317,-1,-1,-1,-1,-1,-1,-1},
-{164,171,520,524,1317,1318,-1,-1,-1,-1,-1,-1,-1},
-{47,95,102,368,484,1318,1319,-1,-1,-1,-1,-1,-1},
-{298,345,472,504,596,599,1319,1320,-1,-1,-1,-1,-1},
-{161,492,1320,1321,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,266,529,1321,1322,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,1322,1323,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,151,201,215,444,1323,1324,-1,-1,-1,-1,-1,-1},
-{47,114,328,490,1324,1325,-1,-1,-1,-1,-1,-1,-1},
-{18,78,122,222,489,1325,1326,-1,-1,-1,-1,-1,-1},
-{192,324,415,508,1326,1327,-1,-1,-1,-1,-1,-1,-1},
-{49,146,442,540,1327,1328,-1,-1,-1,-1,-1,-1,-1},
-{227,255,259,417,487,1328,1329,-1,-1,-1,-1,-1,-1},
-{33,1329,1330,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,116,201,219,296,301,1330,1331,-1,-1,-1,-1,-1},
-{437,442,564,1331,1332,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,482,1332,1333,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,41,148,503,1333,1334,-1,-1,-1,-1,-1,-1,-1},
-{244,257,343,436,478,1334,1335,-1,-1,-1,-1,-1,-1},
-{23,173,1335,1336,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,239,354,392,504,510,521,582,1336,1337,-1,-1,-1},
-{3,425,1337,1338,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,53,484,1338,1339,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,45,191,267,332,446,1339,1340,-1,-1,-1,-1,-1},
-{468,553,1340,1341,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,197,341,384,538,1341,1342,-1,-1,-1,-1,-1,-1},
-{43,100,471,1342,1343,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,137,171,226,254,1343,1344,-1,-1,-1,-1,-1,-1},
-{64,181,315,397,416,549,1344,1345,-1,-1,-1,-1,-1},
-{9,123,235,285,391,504,1345,1346,-1,-1,-1,-1,-1},
-{152,190,202,390,574,1346,1347,-1,-1,-1,-1,-1,-1},
-{66,258,271,527,585,1347,1348,-1,-1,-1,-1,-1,-1},
-{244,304,486,1348,1349,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,81,150,181,274,405,576,1349,1350,-1,-1,-1,-1},
-{1350,1351,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,226,413,447,1351,1352,-1,-1,-1,-1,-1,-1,-1},
-{104,343,374,508,1352,1353,-1,-1,-1,-1,-1,-1,-1},
-{11,268,533,1353,1354,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,490,496,504,1354,1355,-1,-1,-1,-1,-1,-1,-1},
-{424,497,1355,1356,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,262,350,352,540,1356,1357,-1,-1,-1,-1,-1,-1},
-{17,68,96,475,1357,1358,-1,-1,-1,-1,-1,-1,-1},
-{132,172,1358,1359,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,235,447,1359,1360,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,349,1360,1361,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,429,540,548,578,1361,1362,-1,-1,-1,-1,-1,-1},
-{179,247,1362,1363,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,420,575,1363,1364,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,177,239,465,1364,1365,-1,-1,-1,-1,-1,-1,-1},
-{68,126,130,368,542,1365,1366,-1,-1,-1,-1,-1,-1},
-{57,305,551,1366,1367,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,152,293,294,385,1367,1368,-1,-1,-1,-1,-1,-1},
-{66,331,431,560,1368,1369,-1,-1,-1,-1,-1,-1,-1},
-{304,333,1369,1370,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,79,126,388,445,484,514,1370,1371,-1,-1,-1,-1},
-{57,193,322,1371,1372,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,199,1372,1373,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{508,595,1373,1374,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,204,420,430,1374,1375,-1,-1,-1,-1,-1,-1,-1},
-{333,594,1375,1376,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,101,143,599,1376,1377,-1,-1,-1,-1,-1,-1,-1},
-{311,510,544,1377,1378,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,1378,1379,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,97,436,1379,1380,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,524,1380,1381,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,80,350,1381,1382,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,267,409,461,531,579,1382,1383,-1,-1,-1,-1,-1},
-{20,64,73,139,281,564,596,1383,1384,-1,-1,-1,-1},
-{55,277,393,1384,1385,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,213,513,518,549,565,593,1385,1386,-1,-1,-1,-1},
-{84,111,131,432,1386,1387,-1,-1,-1,-1,-1,-1,-1},
-{173,202,405,520,1387,1388,-1,-1,-1,-1,-1,-1,-1},
-{29,184,200,424,473,1388,1389,-1,-1,-1,-1,-1,-1},
-{26,52,370,554,1389,1390,-1,-1,-1,-1,-1,-1,-1},
-{161,317,410,543,1390,1391,-1,-1,-1,-1,-1,-1,-1},
-{53,117,321,1391,1392,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,266,421,513,549,1392,1393,-1,-1,-1,-1,-1,-1},
-{44,141,156,272,350,483,484,1393,1394,-1,-1,-1,-1},
-{64,162,207,386,512,1394,1395,-1,-1,-1,-1,-1,-1},
-{62,63,100,189,544,1395,1396,-1,-1,-1,-1,-1,-1},
-{267,462,576,1396,1397,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,255,324,329,425,506,574,593,1397,1398,-1,-1,-1},
-{4,160,329,350,409,1398,1399,-1,-1,-1,-1,-1,-1},
-{24,569,597,1399,1400,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,80,99,131,269,270,460,1400,1401,-1,-1,-1,-1},
-{117,179,215,1401,1402,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,260,322,1402,1403,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,29,70,206,492,539,1403,1404,-1,-1,-1,-1,-1},
-{32,1404,1405,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{138,249,290,394,531,1405,1406,-1,-1,-1,-1,-1,-1},
-{118,187,1406,1407,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,329,1407,1408,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,1408,1409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,1409,1410,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{421,458,1410,1411,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,232,591,1411,1412,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,163,338,1412,1413,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,100,101,1413,1414,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,1414,1415,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{354,1415,1416,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,242,291,407,515,1416,1417,-1,-1,-1,-1,-1,-1},
-{76,112,284,1417,1418,-1,-1,-1,-1,-1,-1,-1,-1},
-{280,356,375,500,1418,1419,-1,-1,-1,-1,-1,-1,-1},
-{42,51,226,292,312,553,1419,1420,-1,-1,-1,-1,-1},
-{121,289,337,366,373,1420,1421,-1,-1,-1,-1,-1,-1},
-{245,385,426,551,560,1421,1422,-1,-1,-1,-1,-1,-1},
-{46,49,243,359,436,443,1422,1423,-1,-1,-1,-1,-1},
-{204,254,288,293,326,441,1423,1424,-1,-1,-1,-1,-1},
-{105,135,299,362,377,1424,1425,-1,-1,-1,-1,-1,-1},
-{36,44,59,322,451,553,1425,1426,-1,-1,-1,-1,-1},
-{172,397,489,1426,1427,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,350,1427,1428,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,341,534,1428,1429,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,192,241,432,477,1429,1430,-1,-1,-1,-1,-1,-1},
-{266,275,297,535,1430,1431,-1,-1,-1,-1,-1,-1,-1},
-{196,304,442,589,1431,1432,-1,-1,-1,-1,-1,-1,-1},
-{50,130,241,279,388,1432,1433,-1,-1,-1,-1,-1,-1},
-{462,1433,1434,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,178,183,1434,1435,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,350,1435,1436,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,407,510,1436,1437,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,135,348,409,1437,1438,-1,-1,-1,-1,-1,-1,-1},
-{520,1438,1439,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,367,1439,1440,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,309,513,1440,1441,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,511,1441,1442,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,250,1442,1443,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,239,503,1443,1444,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,254,344,401,527,540,1444,1445,-1,-1,-1,-1,-1},
-{2,135,540,567,1445,1446,-1,-1,-1,-1,-1,-1,-1},
-{58,103,128,281,522,570,1446,1447,-1,-1,-1,-1,-1},
-{5,19,454,517,554,1447,1448,-1,-1,-1,-1,-1,-1},
-{109,214,315,316,529,1448,1449,-1,-1,-1,-1,-1,-1},
-{67,1449,1450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,1450,1451,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,85,364,382,573,1451,1452,-1,-1,-1,-1,-1,-1},
-{208,415,1452,1453,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,197,280,295,1453,1454,-1,-1,-1,-1,-1,-1,-1},
-{8,247,309,573,589,1454,1455,-1,-1,-1,-1,-1,-1},
-{1455,1456,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,356,421,1456,1457,-1,-1,-1,-1,-1,-1,-1,-1},
-{504,1457,1458,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,535,538,1458,1459,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,456,1459,1460,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,443,1460,1461,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,30,86,167,178,182,270,497,548,1461,1462,-1,-1},
-{279,543,1462,1463,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,144,190,271,274,447,1463,1464,-1,-1,-1,-1,-1},
-{123,146,298,562,1464,1465,-1,-1,-1,-1,-1,-1,-1},
-{414,1465,1466,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{218,463,535,1466,1467,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,102,186,221,307,546,1467,1468,-1,-1,-1,-1,-1},
-{519,1468,1469,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,201,385,1469,1470,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,567,574,1470,1471,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,210,315,598,1471,1472,-1,-1,-1,-1,-1,-1,-1},
-{12,31,457,1472,1473,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,127,530,1473,1474,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,129,141,146,268,270,316,1474,1475,-1,-1,-1,-1},
-{170,1475,1476,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,80,175,180,329,341,1476,1477,-1,-1,-1,-1,-1},
-{188,286,302,409,441,493,522,545,584,1477,1478,-1,-1},
-{125,239,342,451,573,1478,1479,-1,-1,-1,-1,-1,-1},
-{52,118,120,124,457,459,1479,1480,-1,-1,-1,-1,-1},
-{111,340,557,1480,1481,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,170,282,318,397,448,1481,1482,-1,-1,-1,-1,-1},
-{1,2,1482,1483,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,179,210,262,317,409,424,1483,1484,-1,-1,-1,-1},
-{87,576,1484,1485,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,92,225,258,359,409,419,516,1485,1486,-1,-1,-1},
-{191,1486,1487,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,123,191,1487,1488,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,227,560,1488,1489,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,185,199,490,1489,1490,-1,-1,-1,-1,-1,-1,-1},
-{37,43,291,468,1490,1491,-1,-1,-1,-1,-1,-1,-1},
-{1491,1492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1492,1493,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,107,290,502,1493,1494,-1,-1,-1,-1,-1,-1,-1},
-{1494,1495,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,283,341,368,1495,1496,-1,-1,-1,-1,-1,-1,-1},
-{52,64,79,1496,1497,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,293,475,1497,1498,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,89,157,401,485,495,1498,1499,-1,-1,-1,-1,-1},
-{268,505,1499,1500,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,402,1500,1501,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{387,1501,1502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{567,1502,1503,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,159,172,284,437,1503,1504,-1,-1,-1,-1,-1,-1},
-{116,131,220,440,494,1504,1505,-1,-1,-1,-1,-1,-1},
-{11,20,33,562,1505,1506,-1,-1,-1,-1,-1,-1,-1},
-{103,296,312,578,1506,1507,-1,-1,-1,-1,-1,-1,-1},
-{245,361,408,1507,1508,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,161,232,243,377,524,1508,1509,-1,-1,-1,-1,-1},
-{185,275,309,437,459,591,1509,1510,-1,-1,-1,-1,-1},
-{160,178,551,1510,1511,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,175,208,210,357,432,1511,1512,-1,-1,-1,-1,-1},
-{107,131,358,397,1512,1513,-1,-1,-1,-1,-1,-1,-1},
-{256,341,425,1513,1514,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,1514,1515,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,78,204,211,257,535,1515,1516,-1,-1,-1,-1,-1},
-{45,110,468,479,1516,1517,-1,-1,-1,-1,-1,-1,-1},
-{338,1517,1518,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,177,187,197,257,293,351,369,1518,1519,-1,-1,-1},
-{139,148,250,286,451,479,1519,1520,-1,-1,-1,-1,-1},
-{90,99,216,285,400,511,512,1520,1521,-1,-1,-1,-1},
-{93,168,284,291,1521,1522,-1,-1,-1,-1,-1,-1,-1},
-{175,434,1522,1523,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,217,1523,1524,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,243,302,475,1524,1525,-1,-1,-1,-1,-1,-1,-1},
-{21,402,1525,1526,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,32,114,205,304,1526,1527,-1,-1,-1,-1,-1,-1},
-{138,174,525,1527,1528,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,144,319,1528,1529,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,305,1529,1530,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,184,487,1530,1531,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,6,154,281,448,562,1531,1532,-1,-1,-1,-1,-1},
-{23,67,237,381,1532,1533,-1,-1,-1,-1,-1,-1,-1},
-{221,230,384,446,1533,1534,-1,-1,-1,-1,-1,-1,-1},
-{109,291,481,547,1534,1535,-1,-1,-1,-1,-1,-1,-1},
-{167,562,1535,1536,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,273,465,483,571,1536,1537,-1,-1,-1,-1,-1,-1},
-{200,259,368,1537,1538,-1,-1,-1,-1,-1,-1,-1,-1},
-{265,353,496,532,1538,1539,-1,-1,-1,-1,-1,-1,-1},
-{125,164,180,185,415,567,1539,1540,-1,-1,-1,-1,-1},
-{2,80,596,598,1540,1541,-1,-1,-1,-1,-1,-1,-1},
-{204,367,482,527,543,1541,1542,-1,-1,-1,-1,-1,-1},
-{28,193,259,513,1542,1543,-1,-1,-1,-1,-1,-1,-1},
-{54,259,291,355,556,1543,1544,-1,-1,-1,-1,-1,-1},
-{147,170,339,406,578,1544,1545,-1,-1,-1,-1,-1,-1},
-{22,270,450,1545,1546,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,401,445,1546,1547,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,95,224,280,332,389,455,481,1547,1548,-1,-1,-1},
-{77,118,188,384,1548,1549,-1,-1,-1,-1,-1,-1,-1},
-{216,278,1549,1550,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,1550,1551,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,313,390,550,595,1551,1552,-1,-1,-1,-1,-1,-1},
-{15,126,586,1552,1553,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,419,441,1553,1554,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,80,102,120,343,528,1554,1555,-1,-1,-1,-1,-1},
-{234,272,362,1555,1556,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,566,1556,1557,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,299,532,1557,1558,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,1558,1559,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{309,462,1559,1560,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,235,317,396,429,581,1560,1561,-1,-1,-1,-1,-1},
-{452,549,1561,1562,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,345,361,458,481,555,1562,1563,-1,-1,-1,-1,-1},
-{2,157,220,366,445,516,537,1563,1564,-1,-1,-1,-1},
-{89,263,1564,1565,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,81,128,1565,1566,-1,-1,-1,-1,-1,-1,-1,-1},
-{1566,1567,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,98,277,344,364,483,540,1567,1568,-1,-1,-1,-1},
-{31,107,191,307,530,1568,1569,-1,-1,-1,-1,-1,-1},
-{583,1569,1570,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,346,477,510,541,1570,1571,-1,-1,-1,-1,-1,-1},
-{144,158,325,440,1571,1572,-1,-1,-1,-1,-1,-1,-1},
-{149,201,405,470,1572,1573,-1,-1,-1,-1,-1,-1,-1},
-{61,226,501,512,558,1573,1574,-1,-1,-1,-1,-1,-1},
-{5,278,285,1574,1575,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,519,554,560,1575,1576,-1,-1,-1,-1,-1,-1,-1},
-{486,516,542,1576,1577,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,408,596,1577,1578,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,1578,1579,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,76,122,260,394,1579,1580,-1,-1,-1,-1,-1,-1},
-{1580,1581,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,1581,1582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,1582,1583,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,222,382,1583,1584,-1,-1,-1,-1,-1,-1,-1,-1},
-{1584,1585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{294,1585,1586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{530,1586,1587,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,232,374,1587,1588,-1,-1,-1,-1,-1,-1,-1,-1},
-{166,374,497,1588,1589,-1,-1,-1,-1,-1,-1,-1,-1},
-{232,418,439,531,589,1589,1590,-1,-1,-1,-1,-1,-1},
-{324,478,491,1590,1591,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,303,506,1591,1592,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,216,237,255,440,502,592,1592,1593,-1,-1,-1,-1},
-{231,304,487,1593,1594,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,401,493,1594,1595,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,454,483,1595,1596,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,237,293,1596,1597,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,399,1597,1598,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{386,391,434,1598,1599,-1,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixEnc_6_16[1000][12]={
-{63,159,195,557,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,294,299,600,-1,-1,-1,-1,-1,-1,-1,-1},
-{24,327,377,601,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,91,137,247,404,447,602,-1,-1,-1,-1,-1},
-{13,166,211,603,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,58,200,345,449,526,545,604,-1,-1,-1,-1},
-{179,200,371,605,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,118,220,297,606,-1,-1,-1,-1,-1,-1,-1},
-{85,125,145,224,462,567,607,-1,-1,-1,-1,-1},
-{14,214,296,315,414,448,608,-1,-1,-1,-1,-1},
-{141,389,609,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,77,254,298,408,522,593,610,-1,-1,-1,-1},
-{173,611,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,302,411,612,-1,-1,-1,-1,-1,-1,-1,-1},
-{144,240,384,423,478,582,613,-1,-1,-1,-1,-1},
-{38,186,197,237,321,614,-1,-1,-1,-1,-1,-1},
-{615,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,147,341,464,571,616,-1,-1,-1,-1,-1,-1},
-{12,19,160,413,427,617,-1,-1,-1,-1,-1,-1},
-{243,361,618,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,118,230,619,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,253,256,335,620,-1,-1,-1,-1,-1,-1,-1},
-{83,163,202,203,493,621,-1,-1,-1,-1,-1,-1},
-{2,375,622,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,623,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{18,387,624,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,166,333,513,625,-1,-1,-1,-1,-1,-1,-1},
-{203,315,381,530,545,626,-1,-1,-1,-1,-1,-1},
-{251,282,424,493,627,-1,-1,-1,-1,-1,-1,-1},
-{146,169,212,325,425,628,-1,-1,-1,-1,-1,-1},
-{35,181,238,485,629,-1,-1,-1,-1,-1,-1,-1},
-{246,391,507,518,630,-1,-1,-1,-1,-1,-1,-1},
-{303,428,555,631,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,632,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,152,463,633,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,189,235,634,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,387,511,635,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,10,21,77,595,636,-1,-1,-1,-1,-1,-1},
-{222,456,637,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,221,466,468,638,-1,-1,-1,-1,-1,-1,-1},
-{154,236,639,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{283,312,640,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,282,547,582,641,-1,-1,-1,-1,-1,-1,-1},
-{88,403,642,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{402,537,643,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{106,169,585,644,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,306,645,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,455,646,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,167,195,230,647,-1,-1,-1,-1,-1,-1,-1},
-{29,241,576,648,-1,-1,-1,-1,-1,-1,-1,-1},
-{317,569,649,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,434,650,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{112,556,651,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,163,541,652,-1,-1,-1,-1,-1,-1,-1,-1},
-{653,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,58,170,454,492,567,654,-1,-1,-1,-1,-1},
-{43,565,655,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,368,388,406,656,-1,-1,-1,-1,-1,-1,-1},
-{26,185,196,285,336,531,657,-1,-1,-1,-1,-1},
-{209,658,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{470,504,515,581,659,-1,-1,-1,-1,-1,-1,-1},
-{407,408,522,660,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,661,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,42,90,95,235,662,-1,-1,-1,-1,-1,-1},
-{188,324,386,407,663,-1,-1,-1,-1,-1,-1,-1},
-{411,664,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,336,380,665,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,247,586,666,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,106,290,500,667,-1,-1,-1,-1,-1,-1,-1},
-{175,372,468,577,582,668,-1,-1,-1,-1,-1,-1},
-{335,669,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,196,245,358,442,670,-1,-1,-1,-1,-1,-1},
-{66,261,465,671,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,324,385,672,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,233,561,673,-1,-1,-1,-1,-1,-1,-1,-1},
-{117,340,378,474,674,-1,-1,-1,-1,-1,-1,-1},
-{119,402,557,675,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,676,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,238,402,677,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,373,598,678,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,289,532,679,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,132,236,285,466,680,-1,-1,-1,-1,-1,-1},
-{168,385,542,578,681,-1,-1,-1,-1,-1,-1,-1},
-{6,53,96,116,220,309,345,468,682,-1,-1,-1},
-{195,309,319,683,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,527,592,684,-1,-1,-1,-1,-1,-1,-1,-1},
-{242,365,507,685,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,220,342,405,686,-1,-1,-1,-1,-1,-1,-1},
-{352,687,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,257,498,527,688,-1,-1,-1,-1,-1,-1,-1},
-{188,482,689,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,146,690,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,195,420,441,579,587,691,-1,-1,-1,-1,-1},
-{192,362,366,374,427,469,472,556,692,-1,-1,-1},
-{496,693,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,548,559,579,694,-1,-1,-1,-1,-1,-1,-1},
-{59,100,221,314,695,-1,-1,-1,-1,-1,-1,-1},
-{38,188,323,413,416,424,439,696,-1,-1,-1,-1},
-{32,453,697,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,698,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,417,455,469,546,699,-1,-1,-1,-1,-1,-1},
-{41,94,334,489,545,700,-1,-1,-1,-1,-1,-1},
-{701,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{284,449,498,525,702,-1,-1,-1,-1,-1,-1,-1},
-{182,311,375,445,703,-1,-1,-1,-1,-1,-1,-1},
-{281,314,430,586,704,-1,-1,-1,-1,-1,-1,-1},
-{79,214,235,317,705,-1,-1,-1,-1,-1,-1,-1},
-{228,231,385,706,-1,-1,-1,-1,-1,-1,-1,-1},
-{262,471,577,707,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,124,215,242,255,458,708,-1,-1,-1,-1,-1},
-{313,553,595,709,-1,-1,-1,-1,-1,-1,-1,-1},
-{371,404,563,710,-1,-1,-1,-1,-1,-1,-1,-1},
-{108,110,111,219,244,245,253,400,711,-1,-1,-1},
-{75,232,518,580,712,-1,-1,-1,-1,-1,-1,-1},
-{353,713,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,237,366,457,499,714,-1,-1,-1,-1,-1,-1},
-{63,130,395,404,416,524,715,-1,-1,-1,-1,-1},
-{222,243,279,286,434,560,716,-1,-1,-1,-1,-1},
-{96,118,157,717,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,274,718,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,59,66,283,389,425,719,-1,-1,-1,-1,-1},
-{567,720,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{542,547,573,721,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,172,546,722,-1,-1,-1,-1,-1,-1,-1,-1},
-{452,481,723,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,191,355,585,724,-1,-1,-1,-1,-1,-1,-1},
-{390,411,462,580,725,-1,-1,-1,-1,-1,-1,-1},
-{271,462,726,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,177,253,727,-1,-1,-1,-1,-1,-1,-1,-1},
-{307,514,527,581,728,-1,-1,-1,-1,-1,-1,-1},
-{6,266,729,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,281,385,474,730,-1,-1,-1,-1,-1,-1,-1},
-{163,188,210,295,423,450,473,482,731,-1,-1,-1},
-{104,125,256,332,732,-1,-1,-1,-1,-1,-1,-1},
-{120,263,317,411,733,-1,-1,-1,-1,-1,-1,-1},
-{38,551,568,570,734,-1,-1,-1,-1,-1,-1,-1},
-{149,264,306,735,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,181,438,736,-1,-1,-1,-1,-1,-1,-1,-1},
-{137,189,223,737,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,443,499,509,526,738,-1,-1,-1,-1,-1,-1},
-{131,320,739,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,187,448,588,740,-1,-1,-1,-1,-1,-1,-1},
-{53,215,305,468,522,741,-1,-1,-1,-1,-1,-1},
-{54,305,319,345,422,494,520,742,-1,-1,-1,-1},
-{167,743,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{70,312,313,429,507,744,-1,-1,-1,-1,-1,-1},
-{109,412,420,426,524,745,-1,-1,-1,-1,-1,-1},
-{224,227,440,478,523,524,746,-1,-1,-1,-1,-1},
-{435,471,747,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,109,748,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,198,301,540,561,749,-1,-1,-1,-1,-1,-1},
-{144,570,750,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,395,446,510,751,-1,-1,-1,-1,-1,-1,-1},
-{64,363,365,461,752,-1,-1,-1,-1,-1,-1,-1},
-{28,221,358,753,-1,-1,-1,-1,-1,-1,-1,-1},
-{581,754,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,755,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{269,561,756,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{312,757,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{292,522,552,758,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,162,172,519,759,-1,-1,-1,-1,-1,-1,-1},
-{42,401,437,515,760,-1,-1,-1,-1,-1,-1,-1},
-{127,488,761,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,169,285,358,762,-1,-1,-1,-1,-1,-1,-1},
-{52,217,303,335,374,394,544,763,-1,-1,-1,-1},
-{255,513,764,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{341,765,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,480,483,766,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,458,568,767,-1,-1,-1,-1,-1,-1,-1,-1},
-{152,163,310,327,768,-1,-1,-1,-1,-1,-1,-1},
-{379,405,454,465,769,-1,-1,-1,-1,-1,-1,-1},
-{189,206,262,484,770,-1,-1,-1,-1,-1,-1,-1},
-{396,508,550,591,771,-1,-1,-1,-1,-1,-1,-1},
-{49,78,216,254,288,407,772,-1,-1,-1,-1,-1},
-{285,416,430,439,446,484,491,572,586,773,-1,-1},
-{125,180,261,275,491,774,-1,-1,-1,-1,-1,-1},
-{15,191,192,775,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,385,583,776,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,34,189,299,777,-1,-1,-1,-1,-1,-1,-1},
-{13,46,166,353,384,394,427,778,-1,-1,-1,-1},
-{149,212,294,484,779,-1,-1,-1,-1,-1,-1,-1},
-{56,121,243,246,377,437,780,-1,-1,-1,-1,-1},
-{137,572,599,781,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,782,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{417,550,562,581,783,-1,-1,-1,-1,-1,-1,-1},
-{174,216,252,296,306,349,534,784,-1,-1,-1,-1},
-{510,511,785,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,379,556,559,786,-1,-1,-1,-1,-1,-1,-1},
-{253,304,450,787,-1,-1,-1,-1,-1,-1,-1,-1},
-{129,174,218,587,788,-1,-1,-1,-1,-1,-1,-1},
-{74,90,344,789,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,252,790,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,133,154,239,396,442,489,526,791,-1,-1,-1},
-{231,475,591,594,792,-1,-1,-1,-1,-1,-1,-1},
-{793,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{291,794,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{162,194,260,311,517,795,-1,-1,-1,-1,-1,-1},
-{214,477,490,585,796,-1,-1,-1,-1,-1,-1,-1},
-{84,218,289,450,578,797,-1,-1,-1,-1,-1,-1},
-{124,236,291,798,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,377,799,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{89,119,124,166,234,474,479,528,599,800,-1,-1},
-{77,452,522,801,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,802,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{168,264,377,803,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,133,340,409,804,-1,-1,-1,-1,-1,-1,-1},
-{805,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,443,598,806,-1,-1,-1,-1,-1,-1,-1,-1},
-{202,204,210,467,807,-1,-1,-1,-1,-1,-1,-1},
-{79,149,256,305,336,475,511,592,808,-1,-1,-1},
-{588,809,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{810,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{239,246,811,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{812,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{86,164,171,283,427,457,813,-1,-1,-1,-1,-1},
-{3,215,814,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{324,489,815,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,180,816,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{398,408,503,512,514,817,-1,-1,-1,-1,-1,-1},
-{141,280,295,446,818,-1,-1,-1,-1,-1,-1,-1},
-{114,233,236,305,433,596,819,-1,-1,-1,-1,-1},
-{820,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,65,105,175,186,821,-1,-1,-1,-1,-1,-1},
-{345,478,822,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,420,456,459,823,-1,-1,-1,-1,-1,-1,-1},
-{227,463,473,506,824,-1,-1,-1,-1,-1,-1,-1},
-{246,286,825,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{390,420,433,826,-1,-1,-1,-1,-1,-1,-1,-1},
-{120,244,262,352,827,-1,-1,-1,-1,-1,-1,-1},
-{87,121,129,306,323,422,580,828,-1,-1,-1,-1},
-{61,258,547,829,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,259,304,830,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,45,84,109,333,421,572,831,-1,-1,-1,-1},
-{198,285,544,598,832,-1,-1,-1,-1,-1,-1,-1},
-{497,586,833,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,144,161,177,202,232,350,356,492,834,-1,-1},
-{79,121,154,442,835,-1,-1,-1,-1,-1,-1,-1},
-{139,380,836,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,77,79,147,176,184,412,493,518,837,-1,-1},
-{49,199,268,587,838,-1,-1,-1,-1,-1,-1,-1},
-{120,201,394,839,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,110,840,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,311,841,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,136,842,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,157,181,182,206,253,843,-1,-1,-1,-1,-1},
-{103,214,844,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,103,331,452,506,845,-1,-1,-1,-1,-1,-1},
-{101,453,528,573,846,-1,-1,-1,-1,-1,-1,-1},
-{144,207,550,554,847,-1,-1,-1,-1,-1,-1,-1},
-{101,202,848,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,381,467,480,849,-1,-1,-1,-1,-1,-1,-1},
-{28,56,304,488,850,-1,-1,-1,-1,-1,-1,-1},
-{59,851,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,68,506,852,-1,-1,-1,-1,-1,-1,-1,-1},
-{132,192,232,247,269,286,299,570,853,-1,-1,-1},
-{257,261,263,346,452,569,571,854,-1,-1,-1,-1},
-{77,89,377,474,577,855,-1,-1,-1,-1,-1,-1},
-{134,856,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,346,355,857,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,232,374,858,-1,-1,-1,-1,-1,-1,-1,-1},
-{88,93,116,859,-1,-1,-1,-1,-1,-1,-1,-1},
-{300,397,403,860,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,332,455,861,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,115,168,862,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,316,349,431,863,-1,-1,-1,-1,-1,-1,-1},
-{40,181,257,353,459,483,594,864,-1,-1,-1,-1},
-{58,402,420,513,539,865,-1,-1,-1,-1,-1,-1},
-{414,866,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{250,287,358,461,556,867,-1,-1,-1,-1,-1,-1},
-{18,67,581,588,868,-1,-1,-1,-1,-1,-1,-1},
-{72,194,203,469,584,869,-1,-1,-1,-1,-1,-1},
-{11,68,92,429,870,-1,-1,-1,-1,-1,-1,-1},
-{560,871,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{352,466,550,872,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,127,302,321,575,873,-1,-1,-1,-1,-1,-1},
-{89,117,459,874,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,131,289,875,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,90,876,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{442,591,877,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{244,430,471,548,878,-1,-1,-1,-1,-1,-1,-1},
-{254,879,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{405,551,880,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,27,203,310,881,-1,-1,-1,-1,-1,-1,-1},
-{104,444,545,882,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,443,883,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{233,353,519,884,-1,-1,-1,-1,-1,-1,-1,-1},
-{23,119,212,265,417,446,524,885,-1,-1,-1,-1},
-{3,451,886,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{121,189,343,887,-1,-1,-1,-1,-1,-1,-1,-1},
-{231,335,888,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,311,459,889,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,94,393,497,526,529,582,890,-1,-1,-1,-1},
-{238,342,349,537,581,891,-1,-1,-1,-1,-1,-1},
-{205,261,275,305,380,428,892,-1,-1,-1,-1,-1},
-{19,134,154,340,471,544,893,-1,-1,-1,-1,-1},
-{13,245,373,375,484,566,894,-1,-1,-1,-1,-1},
-{1,105,347,529,597,895,-1,-1,-1,-1,-1,-1},
-{463,537,896,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,354,897,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,108,168,197,314,898,-1,-1,-1,-1,-1,-1},
-{227,899,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{200,285,376,492,516,900,-1,-1,-1,-1,-1,-1},
-{10,218,388,395,409,901,-1,-1,-1,-1,-1,-1},
-{95,276,433,472,597,902,-1,-1,-1,-1,-1,-1},
-{244,337,461,518,903,-1,-1,-1,-1,-1,-1,-1},
-{9,64,164,180,904,-1,-1,-1,-1,-1,-1,-1},
-{185,559,905,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{306,308,363,385,489,906,-1,-1,-1,-1,-1,-1},
-{100,119,173,210,214,413,577,907,-1,-1,-1,-1},
-{9,117,171,209,288,543,586,908,-1,-1,-1,-1},
-{12,13,490,909,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,37,63,114,213,254,910,-1,-1,-1,-1,-1},
-{21,219,264,322,331,460,911,-1,-1,-1,-1,-1},
-{38,282,451,912,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,193,322,327,530,913,-1,-1,-1,-1,-1,-1},
-{77,85,143,151,269,286,914,-1,-1,-1,-1,-1},
-{213,363,915,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,64,229,916,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,279,531,917,-1,-1,-1,-1,-1,-1,-1,-1},
-{141,248,271,408,447,509,918,-1,-1,-1,-1,-1},
-{66,311,505,919,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,128,374,430,466,475,573,920,-1,-1,-1,-1},
-{8,164,222,264,501,921,-1,-1,-1,-1,-1,-1},
-{101,162,308,521,922,-1,-1,-1,-1,-1,-1,-1},
-{94,194,405,527,923,-1,-1,-1,-1,-1,-1,-1},
-{91,158,352,425,924,-1,-1,-1,-1,-1,-1,-1},
-{240,269,415,516,555,925,-1,-1,-1,-1,-1,-1},
-{91,121,189,278,300,561,579,926,-1,-1,-1,-1},
-{88,387,422,927,-1,-1,-1,-1,-1,-1,-1,-1},
-{140,495,580,585,928,-1,-1,-1,-1,-1,-1,-1},
-{214,929,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{331,930,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{364,464,931,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{461,932,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{351,397,522,537,933,-1,-1,-1,-1,-1,-1,-1},
-{15,24,72,125,250,283,366,934,-1,-1,-1,-1},
-{360,935,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,36,40,66,144,251,936,-1,-1,-1,-1,-1},
-{84,182,188,197,358,443,937,-1,-1,-1,-1,-1},
-{383,491,526,536,938,-1,-1,-1,-1,-1,-1,-1},
-{22,218,330,939,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,167,419,540,940,-1,-1,-1,-1,-1,-1,-1},
-{153,284,941,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{110,112,179,434,942,-1,-1,-1,-1,-1,-1,-1},
-{271,286,441,943,-1,-1,-1,-1,-1,-1,-1,-1},
-{130,227,463,944,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,275,316,542,945,-1,-1,-1,-1,-1,-1,-1},
-{215,263,946,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,257,352,355,498,947,-1,-1,-1,-1,-1,-1},
-{209,244,298,302,460,948,-1,-1,-1,-1,-1,-1},
-{273,949,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{323,474,553,950,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,221,321,951,-1,-1,-1,-1,-1,-1,-1,-1},
-{360,952,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{953,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{81,200,426,512,954,-1,-1,-1,-1,-1,-1,-1},
-{54,134,337,955,-1,-1,-1,-1,-1,-1,-1,-1},
-{153,182,277,956,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,266,349,379,957,-1,-1,-1,-1,-1,-1,-1},
-{20,958,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{253,346,386,392,480,558,959,-1,-1,-1,-1,-1},
-{220,561,594,960,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,242,258,961,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,278,300,962,-1,-1,-1,-1,-1,-1,-1,-1},
-{48,130,215,266,350,398,541,963,-1,-1,-1,-1},
-{260,295,964,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,71,218,240,251,326,965,-1,-1,-1,-1,-1},
-{39,147,329,353,482,539,541,547,966,-1,-1,-1},
-{384,514,967,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,108,120,191,409,527,542,547,968,-1,-1,-1},
-{273,969,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,70,184,326,970,-1,-1,-1,-1,-1,-1,-1},
-{401,435,453,971,-1,-1,-1,-1,-1,-1,-1,-1},
-{17,175,199,266,389,550,972,-1,-1,-1,-1,-1},
-{6,205,320,324,973,-1,-1,-1,-1,-1,-1,-1},
-{19,974,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{446,464,975,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,54,373,432,480,976,-1,-1,-1,-1,-1,-1},
-{25,334,399,461,548,977,-1,-1,-1,-1,-1,-1},
-{79,179,978,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{441,579,979,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{980,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,97,312,333,446,450,469,528,981,-1,-1,-1},
-{8,227,335,443,467,982,-1,-1,-1,-1,-1,-1},
-{109,477,983,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,558,984,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,219,985,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{143,217,287,392,544,592,986,-1,-1,-1,-1,-1},
-{428,987,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,61,444,566,988,-1,-1,-1,-1,-1,-1,-1},
-{122,233,249,534,577,989,-1,-1,-1,-1,-1,-1},
-{38,454,990,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{259,329,568,991,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,174,213,299,342,453,992,-1,-1,-1,-1,-1},
-{388,476,506,993,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,139,240,344,526,591,994,-1,-1,-1,-1,-1},
-{444,524,995,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{95,339,374,399,453,996,-1,-1,-1,-1,-1,-1},
-{47,95,219,249,997,-1,-1,-1,-1,-1,-1,-1},
-{101,178,357,468,998,-1,-1,-1,-1,-1,-1,-1},
-{321,417,418,999,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,311,359,1000,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,142,154,534,1001,-1,-1,-1,-1,-1,-1,-1},
-{492,1002,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{263,1003,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,88,130,298,521,1004,-1,-1,-1,-1,-1,-1},
-{299,312,346,572,1005,-1,-1,-1,-1,-1,-1,-1},
-{12,137,208,349,405,462,549,1006,-1,-1,-1,-1},
-{42,156,304,505,1007,-1,-1,-1,-1,-1,-1,-1},
-{142,439,1008,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{330,440,480,1009,-1,-1,-1,-1,-1,-1,-1,-1},
-{445,511,579,1010,-1,-1,-1,-1,-1,-1,-1,-1},
-{97,328,338,369,576,1011,-1,-1,-1,-1,-1,-1},
-{48,218,414,495,1012,-1,-1,-1,-1,-1,-1,-1},
-{85,262,518,583,1013,-1,-1,-1,-1,-1,-1,-1},
-{63,1014,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,379,562,1015,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,195,1016,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{269,417,481,494,1017,-1,-1,-1,-1,-1,-1,-1},
-{79,164,296,306,532,1018,-1,-1,-1,-1,-1,-1},
-{315,513,528,1019,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,535,1020,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,317,365,466,1021,-1,-1,-1,-1,-1,-1,-1},
-{344,383,1022,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,145,206,1023,-1,-1,-1,-1,-1,-1,-1,-1},
-{26,82,113,163,219,258,362,437,534,1024,-1,-1},
-{160,552,1025,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,83,231,402,591,598,1026,-1,-1,-1,-1,-1},
-{89,269,372,396,1027,-1,-1,-1,-1,-1,-1,-1},
-{32,108,524,1028,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,74,81,549,1029,-1,-1,-1,-1,-1,-1,-1},
-{74,134,253,255,526,1030,-1,-1,-1,-1,-1,-1},
-{79,83,407,483,1031,-1,-1,-1,-1,-1,-1,-1},
-{209,231,1032,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{8,262,265,429,1033,-1,-1,-1,-1,-1,-1,-1},
-{29,89,210,311,376,481,590,1034,-1,-1,-1,-1},
-{137,213,452,1035,-1,-1,-1,-1,-1,-1,-1,-1},
-{463,1036,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{41,114,362,465,1037,-1,-1,-1,-1,-1,-1,-1},
-{146,150,159,494,1038,-1,-1,-1,-1,-1,-1,-1},
-{242,248,379,1039,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,452,527,531,1040,-1,-1,-1,-1,-1,-1,-1},
-{35,301,351,383,598,1041,-1,-1,-1,-1,-1,-1},
-{32,134,260,269,358,475,560,1042,-1,-1,-1,-1},
-{104,315,1043,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,110,122,310,421,1044,-1,-1,-1,-1,-1,-1},
-{331,388,586,1045,-1,-1,-1,-1,-1,-1,-1,-1},
-{326,494,1046,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,293,487,1047,-1,-1,-1,-1,-1,-1,-1,-1},
-{68,121,165,250,260,277,292,294,335,592,1048,-1},
-{49,272,282,407,512,533,1049,-1,-1,-1,-1,-1},
-{154,449,450,1050,-1,-1,-1,-1,-1,-1,-1,-1},
-{257,343,418,425,517,563,592,1051,-1,-1,-1,-1},
-{132,306,346,396,446,577,1052,-1,-1,-1,-1,-1},
-{4,223,256,396,515,528,1053,-1,-1,-1,-1,-1},
-{184,229,261,470,563,1054,-1,-1,-1,-1,-1,-1},
-{150,170,384,435,518,573,1055,-1,-1,-1,-1,-1},
-{279,360,1056,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1057,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,387,392,1058,-1,-1,-1,-1,-1,-1,-1,-1},
-{299,396,468,496,1059,-1,-1,-1,-1,-1,-1,-1},
-{122,415,546,1060,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,107,184,198,221,282,363,429,1061,-1,-1,-1},
-{194,1062,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,183,438,487,501,1063,-1,-1,-1,-1,-1,-1},
-{32,1064,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,96,400,1065,-1,-1,-1,-1,-1,-1,-1,-1},
-{254,518,1066,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,122,151,287,354,456,486,519,545,1067,-1,-1},
-{67,94,113,140,455,499,530,1068,-1,-1,-1,-1},
-{274,1069,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{208,397,544,1070,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,208,230,293,440,460,572,1071,-1,-1,-1,-1},
-{14,72,120,140,149,163,164,525,591,1072,-1,-1},
-{136,172,194,289,349,372,480,1073,-1,-1,-1,-1},
-{83,308,572,1074,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,219,280,497,1075,-1,-1,-1,-1,-1,-1,-1},
-{21,142,161,574,1076,-1,-1,-1,-1,-1,-1,-1},
-{3,21,1077,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,349,457,523,1078,-1,-1,-1,-1,-1,-1,-1},
-{504,510,1079,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,163,210,518,1080,-1,-1,-1,-1,-1,-1,-1},
-{59,104,246,351,357,1081,-1,-1,-1,-1,-1,-1},
-{393,1082,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,301,1083,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,346,365,519,586,1084,-1,-1,-1,-1,-1,-1},
-{194,299,1085,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,209,476,520,1086,-1,-1,-1,-1,-1,-1,-1},
-{131,331,475,1087,-1,-1,-1,-1,-1,-1,-1,-1},
-{77,155,281,382,1088,-1,-1,-1,-1,-1,-1,-1},
-{345,408,476,515,583,594,1089,-1,-1,-1,-1,-1},
-{39,165,172,241,313,315,1090,-1,-1,-1,-1,-1},
-{110,507,1091,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,113,147,200,294,351,393,1092,-1,-1,-1,-1},
-{76,102,1093,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{559,1094,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{305,1095,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{235,556,584,1096,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,175,318,328,418,428,489,498,539,596,1097,-1},
-{25,275,278,313,427,1098,-1,-1,-1,-1,-1,-1},
-{121,279,1099,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{142,217,353,398,1100,-1,-1,-1,-1,-1,-1,-1},
-{255,290,552,574,1101,-1,-1,-1,-1,-1,-1,-1},
-{246,294,1102,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{252,491,530,1103,-1,-1,-1,-1,-1,-1,-1,-1},
-{105,262,374,500,1104,-1,-1,-1,-1,-1,-1,-1},
-{236,1105,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{332,342,463,498,557,1106,-1,-1,-1,-1,-1,-1},
-{218,220,224,239,1107,-1,-1,-1,-1,-1,-1,-1},
-{105,410,413,549,1108,-1,-1,-1,-1,-1,-1,-1},
-{166,337,1109,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,292,298,528,563,1110,-1,-1,-1,-1,-1,-1},
-{90,281,1111,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{388,1112,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{325,401,474,1113,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,363,559,1114,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,64,113,120,168,197,559,1115,-1,-1,-1,-1},
-{159,384,467,1116,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,245,316,344,351,1117,-1,-1,-1,-1,-1,-1},
-{140,396,511,520,581,1118,-1,-1,-1,-1,-1,-1},
-{169,190,343,491,1119,-1,-1,-1,-1,-1,-1,-1},
-{157,1120,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{439,1121,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{171,298,451,1122,-1,-1,-1,-1,-1,-1,-1,-1},
-{73,149,226,477,515,1123,-1,-1,-1,-1,-1,-1},
-{217,220,238,535,1124,-1,-1,-1,-1,-1,-1,-1},
-{1125,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,253,1126,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{176,351,1127,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,290,316,325,346,582,1128,-1,-1,-1,-1,-1},
-{233,260,362,411,431,1129,-1,-1,-1,-1,-1,-1},
-{186,251,444,1130,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,38,207,234,1131,-1,-1,-1,-1,-1,-1,-1},
-{132,512,528,1132,-1,-1,-1,-1,-1,-1,-1,-1},
-{415,1133,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,408,485,1134,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,186,372,1135,-1,-1,-1,-1,-1,-1,-1,-1},
-{133,239,1136,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,1137,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{55,297,1138,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,233,312,348,1139,-1,-1,-1,-1,-1,-1,-1},
-{54,207,236,318,325,394,552,1140,-1,-1,-1,-1},
-{361,493,1141,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{449,1142,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,117,169,267,1143,-1,-1,-1,-1,-1,-1,-1},
-{80,105,188,564,597,1144,-1,-1,-1,-1,-1,-1},
-{9,216,485,488,1145,-1,-1,-1,-1,-1,-1,-1},
-{65,110,116,134,265,1146,-1,-1,-1,-1,-1,-1},
-{143,215,416,426,1147,-1,-1,-1,-1,-1,-1,-1},
-{8,87,97,116,159,273,320,412,414,498,499,1148},
-{48,228,332,1149,-1,-1,-1,-1,-1,-1,-1,-1},
-{9,63,475,573,1150,-1,-1,-1,-1,-1,-1,-1},
-{115,184,469,551,1151,-1,-1,-1,-1,-1,-1,-1},
-{177,1152,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{397,459,1153,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,90,151,370,406,1154,-1,-1,-1,-1,-1,-1},
-{157,384,1155,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{211,241,525,1156,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,53,84,1157,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,1158,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,110,244,433,1159,-1,-1,-1,-1,-1,-1,-1},
-{44,236,279,1160,-1,-1,-1,-1,-1,-1,-1,-1},
-{301,1161,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,317,496,1162,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,268,1163,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,101,375,401,482,504,556,574,576,1164,-1,-1},
-{103,226,289,322,411,543,1165,-1,-1,-1,-1,-1},
-{59,164,1166,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{278,319,551,1167,-1,-1,-1,-1,-1,-1,-1,-1},
-{204,489,562,1168,-1,-1,-1,-1,-1,-1,-1,-1},
-{163,459,1169,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{301,412,454,1170,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,106,283,347,438,467,1171,-1,-1,-1,-1,-1},
-{32,246,422,502,1172,-1,-1,-1,-1,-1,-1,-1},
-{577,1173,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,319,320,405,413,433,463,1174,-1,-1,-1,-1},
-{21,22,29,61,89,1175,-1,-1,-1,-1,-1,-1},
-{153,341,345,556,1176,-1,-1,-1,-1,-1,-1,-1},
-{297,340,424,483,562,1177,-1,-1,-1,-1,-1,-1},
-{305,439,505,535,1178,-1,-1,-1,-1,-1,-1,-1},
-{169,277,585,1179,-1,-1,-1,-1,-1,-1,-1,-1},
-{44,134,222,233,377,434,590,1180,-1,-1,-1,-1},
-{209,354,429,548,1181,-1,-1,-1,-1,-1,-1,-1},
-{11,44,371,393,1182,-1,-1,-1,-1,-1,-1,-1},
-{204,352,546,1183,-1,-1,-1,-1,-1,-1,-1,-1},
-{114,174,1184,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,591,1185,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,363,370,1186,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,1187,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{339,342,352,390,404,1188,-1,-1,-1,-1,-1,-1},
-{11,599,1189,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{596,1190,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{98,118,174,437,476,485,1191,-1,-1,-1,-1,-1},
-{15,161,182,481,1192,-1,-1,-1,-1,-1,-1,-1},
-{19,137,340,381,411,429,502,577,1193,-1,-1,-1},
-{148,1194,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,145,530,1195,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,458,1196,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{71,74,502,1197,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,303,423,501,515,1198,-1,-1,-1,-1,-1,-1},
-{240,598,1199,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,94,512,520,572,597,1200,-1,-1,-1,-1,-1},
-{99,102,157,408,501,1201,-1,-1,-1,-1,-1,-1},
-{35,36,1202,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,1203,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{2,4,297,329,1204,-1,-1,-1,-1,-1,-1,-1},
-{362,462,553,1205,-1,-1,-1,-1,-1,-1,-1,-1},
-{330,1206,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,586,1207,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1208,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{151,334,513,1209,-1,-1,-1,-1,-1,-1,-1,-1},
-{150,367,403,484,1210,-1,-1,-1,-1,-1,-1,-1},
-{73,332,429,598,1211,-1,-1,-1,-1,-1,-1,-1},
-{204,254,1212,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{207,483,1213,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{188,238,410,1214,-1,-1,-1,-1,-1,-1,-1,-1},
-{172,434,497,1215,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,275,308,416,1216,-1,-1,-1,-1,-1,-1,-1},
-{394,399,418,1217,-1,-1,-1,-1,-1,-1,-1,-1},
-{74,115,236,1218,-1,-1,-1,-1,-1,-1,-1,-1},
-{532,1219,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,233,247,560,1220,-1,-1,-1,-1,-1,-1,-1},
-{356,1221,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,120,141,351,379,474,501,1222,-1,-1,-1,-1},
-{48,74,275,344,588,1223,-1,-1,-1,-1,-1,-1},
-{141,238,417,532,1224,-1,-1,-1,-1,-1,-1,-1},
-{28,127,361,379,1225,-1,-1,-1,-1,-1,-1,-1},
-{159,418,450,497,509,1226,-1,-1,-1,-1,-1,-1},
-{533,575,1227,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{147,373,521,1228,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,311,377,414,424,1229,-1,-1,-1,-1,-1,-1},
-{214,452,477,501,1230,-1,-1,-1,-1,-1,-1,-1},
-{268,269,413,563,1231,-1,-1,-1,-1,-1,-1,-1},
-{138,464,1232,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,86,237,317,354,1233,-1,-1,-1,-1,-1,-1},
-{72,454,1234,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{11,150,237,344,476,519,1235,-1,-1,-1,-1,-1},
-{473,1236,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{380,536,1237,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{84,184,348,490,1238,-1,-1,-1,-1,-1,-1,-1},
-{55,134,393,1239,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,119,515,1240,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,207,498,543,1241,-1,-1,-1,-1,-1,-1,-1},
-{98,146,209,576,1242,-1,-1,-1,-1,-1,-1,-1},
-{63,86,96,403,593,1243,-1,-1,-1,-1,-1,-1},
-{1244,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{40,481,532,1245,-1,-1,-1,-1,-1,-1,-1,-1},
-{57,224,256,281,1246,-1,-1,-1,-1,-1,-1,-1},
-{31,1247,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{447,480,580,1248,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,202,499,1249,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,194,536,1250,-1,-1,-1,-1,-1,-1,-1,-1},
-{29,262,434,482,1251,-1,-1,-1,-1,-1,-1,-1},
-{129,333,1252,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,176,186,406,434,579,1253,-1,-1,-1,-1,-1},
-{37,325,1254,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{82,91,127,309,529,1255,-1,-1,-1,-1,-1,-1},
-{203,234,442,500,1256,-1,-1,-1,-1,-1,-1,-1},
-{17,142,186,206,276,461,1257,-1,-1,-1,-1,-1},
-{66,123,246,451,1258,-1,-1,-1,-1,-1,-1,-1},
-{50,206,375,440,546,1259,-1,-1,-1,-1,-1,-1},
-{109,127,182,394,415,1260,-1,-1,-1,-1,-1,-1},
-{52,158,219,315,545,1261,-1,-1,-1,-1,-1,-1},
-{14,242,428,454,1262,-1,-1,-1,-1,-1,-1,-1},
-{201,211,376,402,1263,-1,-1,-1,-1,-1,-1,-1},
-{150,1264,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{46,69,89,109,184,417,462,1265,-1,-1,-1,-1},
-{8,116,267,292,325,528,1266,-1,-1,-1,-1,-1},
-{17,25,107,407,510,1267,-1,-1,-1,-1,-1,-1},
-{230,538,1268,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,126,1269,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{72,74,244,283,378,497,502,1270,-1,-1,-1,-1},
-{58,67,122,259,381,1271,-1,-1,-1,-1,-1,-1},
-{294,1272,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,119,447,1273,-1,-1,-1,-1,-1,-1,-1,-1},
-{378,417,445,1274,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,430,502,565,1275,-1,-1,-1,-1,-1,-1,-1},
-{187,208,1276,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{226,298,1277,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,221,444,445,501,517,558,1278,-1,-1,-1,-1},
-{165,300,390,451,1279,-1,-1,-1,-1,-1,-1,-1},
-{7,74,170,350,520,553,1280,-1,-1,-1,-1,-1},
-{400,1281,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{404,1282,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,147,173,516,522,1283,-1,-1,-1,-1,-1,-1},
-{134,241,401,471,503,1284,-1,-1,-1,-1,-1,-1},
-{439,474,590,1285,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,293,502,1286,-1,-1,-1,-1,-1,-1,-1,-1},
-{229,293,323,1287,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,228,243,256,501,1288,-1,-1,-1,-1,-1,-1},
-{534,1289,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,521,1290,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,290,523,1291,-1,-1,-1,-1,-1,-1,-1,-1},
-{236,242,255,1292,-1,-1,-1,-1,-1,-1,-1,-1},
-{174,343,347,414,1293,-1,-1,-1,-1,-1,-1,-1},
-{138,321,455,1294,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,242,439,596,1295,-1,-1,-1,-1,-1,-1,-1},
-{183,200,387,587,1296,-1,-1,-1,-1,-1,-1,-1},
-{78,125,256,1297,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,561,568,580,1298,-1,-1,-1,-1,-1,-1,-1},
-{61,130,220,1299,-1,-1,-1,-1,-1,-1,-1,-1},
-{124,274,400,542,580,1300,-1,-1,-1,-1,-1,-1},
-{97,463,1301,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,309,331,547,553,1302,-1,-1,-1,-1,-1,-1},
-{180,247,294,388,452,1303,-1,-1,-1,-1,-1,-1},
-{218,341,1304,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,93,162,1305,-1,-1,-1,-1,-1,-1,-1,-1},
-{543,1306,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,104,233,290,369,375,1307,-1,-1,-1,-1,-1},
-{9,71,476,544,1308,-1,-1,-1,-1,-1,-1,-1},
-{390,517,1309,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{181,257,1310,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{115,1311,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,102,123,541,1312,-1,-1,-1,-1,-1,-1,-1},
-{176,345,442,454,541,1313,-1,-1,-1,-1,-1,-1},
-{282,1314,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{508,537,1315,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{20,80,273,567,1316,-1,-1,-1,-1,-1,-1,-1},
-{164,171,520,524,1317,-1,-1,-1,-1,-1,-1,-1},
-{47,95,102,368,484,1318,-1,-1,-1,-1,-1,-1},
-{298,345,472,504,596,599,1319,-1,-1,-1,-1,-1},
-{161,492,1320,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,266,529,1321,-1,-1,-1,-1,-1,-1,-1,-1},
-{222,1322,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{30,151,201,215,444,1323,-1,-1,-1,-1,-1,-1},
-{47,114,328,490,1324,-1,-1,-1,-1,-1,-1,-1},
-{18,78,122,222,489,1325,-1,-1,-1,-1,-1,-1},
-{192,324,415,508,1326,-1,-1,-1,-1,-1,-1,-1},
-{49,146,442,540,1327,-1,-1,-1,-1,-1,-1,-1},
-{227,255,259,417,487,1328,-1,-1,-1,-1,-1,-1},
-{33,1329,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,116,201,219,296,301,1330,-1,-1,-1,-1,-1},
-{437,442,564,1331,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,482,1332,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{37,41,148,503,1333,-1,-1,-1,-1,-1,-1,-1},
-{244,257,343,436,478,1334,-1,-1,-1,-1,-1,-1},
-{23,173,1335,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{49,239,354,392,504,510,521,582,1336,-1,-1,-1},
-{3,425,1337,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,53,484,1338,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,45,191,267,332,446,1339,-1,-1,-1,-1,-1},
-{468,553,1340,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,197,341,384,538,1341,-1,-1,-1,-1,-1,-1},
-{43,100,471,1342,-1,-1,-1,-1,-1,-1,-1,-1},
-{103,137,171,226,254,1343,-1,-1,-1,-1,-1,-1},
-{64,181,315,397,416,549,1344,-1,-1,-1,-1,-1},
-{9,123,235,285,391,504,1345,-1,-1,-1,-1,-1},
-{152,190,202,390,574,1346,-1,-1,-1,-1,-1,-1},
-{66,258,271,527,585,1347,-1,-1,-1,-1,-1,-1},
-{244,304,486,1348,-1,-1,-1,-1,-1,-1,-1,-1},
-{42,81,150,181,274,405,576,1349,-1,-1,-1,-1},
-{1350,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{122,226,413,447,1351,-1,-1,-1,-1,-1,-1,-1},
-{104,343,374,508,1352,-1,-1,-1,-1,-1,-1,-1},
-{11,268,533,1353,-1,-1,-1,-1,-1,-1,-1,-1},
-{58,490,496,504,1354,-1,-1,-1,-1,-1,-1,-1},
-{424,497,1355,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{157,262,350,352,540,1356,-1,-1,-1,-1,-1,-1},
-{17,68,96,475,1357,-1,-1,-1,-1,-1,-1,-1},
-{132,172,1358,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{123,235,447,1359,-1,-1,-1,-1,-1,-1,-1,-1},
-{264,349,1360,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,429,540,548,578,1361,-1,-1,-1,-1,-1,-1},
-{179,247,1362,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{175,420,575,1363,-1,-1,-1,-1,-1,-1,-1,-1},
-{165,177,239,465,1364,-1,-1,-1,-1,-1,-1,-1},
-{68,126,130,368,542,1365,-1,-1,-1,-1,-1,-1},
-{57,305,551,1366,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,152,293,294,385,1367,-1,-1,-1,-1,-1,-1},
-{66,331,431,560,1368,-1,-1,-1,-1,-1,-1,-1},
-{304,333,1369,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,79,126,388,445,484,514,1370,-1,-1,-1,-1},
-{57,193,322,1371,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,199,1372,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{508,595,1373,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,204,420,430,1374,-1,-1,-1,-1,-1,-1,-1},
-{333,594,1375,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{91,101,143,599,1376,-1,-1,-1,-1,-1,-1,-1},
-{311,510,544,1377,-1,-1,-1,-1,-1,-1,-1,-1},
-{340,1378,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{31,97,436,1379,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,524,1380,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,80,350,1381,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,267,409,461,531,579,1382,-1,-1,-1,-1,-1},
-{20,64,73,139,281,564,596,1383,-1,-1,-1,-1},
-{55,277,393,1384,-1,-1,-1,-1,-1,-1,-1,-1},
-{131,213,513,518,549,565,593,1385,-1,-1,-1,-1},
-{84,111,131,432,1386,-1,-1,-1,-1,-1,-1,-1},
-{173,202,405,520,1387,-1,-1,-1,-1,-1,-1,-1},
-{29,184,200,424,473,1388,-1,-1,-1,-1,-1,-1},
-{26,52,370,554,1389,-1,-1,-1,-1,-1,-1,-1},
-{161,317,410,543,1390,-1,-1,-1,-1,-1,-1,-1},
-{53,117,321,1391,-1,-1,-1,-1,-1,-1,-1,-1},
-{258,266,421,513,549,1392,-1,-1,-1,-1,-1,-1},
-{44,141,156,272,350,483,484,1393,-1,-1,-1,-1},
-{64,162,207,386,512,1394,-1,-1,-1,-1,-1,-1},
-{62,63,100,189,544,1395,-1,-1,-1,-1,-1,-1},
-{267,462,576,1396,-1,-1,-1,-1,-1,-1,-1,-1},
-{78,255,324,329,425,506,574,593,1397,-1,-1,-1},
-{4,160,329,350,409,1398,-1,-1,-1,-1,-1,-1},
-{24,569,597,1399,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,80,99,131,269,270,460,1400,-1,-1,-1,-1},
-{117,179,215,1401,-1,-1,-1,-1,-1,-1,-1,-1},
-{104,260,322,1402,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,29,70,206,492,539,1403,-1,-1,-1,-1,-1},
-{32,1404,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{138,249,290,394,531,1405,-1,-1,-1,-1,-1,-1},
-{118,187,1406,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,329,1407,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,1408,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{327,1409,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{421,458,1410,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{14,232,591,1411,-1,-1,-1,-1,-1,-1,-1,-1},
-{16,163,338,1412,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,100,101,1413,-1,-1,-1,-1,-1,-1,-1,-1},
-{223,1414,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{354,1415,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{75,242,291,407,515,1416,-1,-1,-1,-1,-1,-1},
-{76,112,284,1417,-1,-1,-1,-1,-1,-1,-1,-1},
-{280,356,375,500,1418,-1,-1,-1,-1,-1,-1,-1},
-{42,51,226,292,312,553,1419,-1,-1,-1,-1,-1},
-{121,289,337,366,373,1420,-1,-1,-1,-1,-1,-1},
-{245,385,426,551,560,1421,-1,-1,-1,-1,-1,-1},
-{46,49,243,359,436,443,1422,-1,-1,-1,-1,-1},
-{204,254,288,293,326,441,1423,-1,-1,-1,-1,-1},
-{105,135,299,362,377,1424,-1,-1,-1,-1,-1,-1},
-{36,44,59,322,451,553,1425,-1,-1,-1,-1,-1},
-{172,397,489,1426,-1,-1,-1,-1,-1,-1,-1,-1},
-{276,350,1427,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,341,534,1428,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,192,241,432,477,1429,-1,-1,-1,-1,-1,-1},
-{266,275,297,535,1430,-1,-1,-1,-1,-1,-1,-1},
-{196,304,442,589,1431,-1,-1,-1,-1,-1,-1,-1},
-{50,130,241,279,388,1432,-1,-1,-1,-1,-1,-1},
-{462,1433,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{38,178,183,1434,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,350,1435,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,407,510,1436,-1,-1,-1,-1,-1,-1,-1,-1},
-{15,135,348,409,1437,-1,-1,-1,-1,-1,-1,-1},
-{520,1438,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,367,1439,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{160,309,513,1440,-1,-1,-1,-1,-1,-1,-1,-1},
-{353,511,1441,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,250,1442,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{34,239,503,1443,-1,-1,-1,-1,-1,-1,-1,-1},
-{225,254,344,401,527,540,1444,-1,-1,-1,-1,-1},
-{2,135,540,567,1445,-1,-1,-1,-1,-1,-1,-1},
-{58,103,128,281,522,570,1446,-1,-1,-1,-1,-1},
-{5,19,454,517,554,1447,-1,-1,-1,-1,-1,-1},
-{109,214,315,316,529,1448,-1,-1,-1,-1,-1,-1},
-{67,1449,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{21,1450,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{7,85,364,382,573,1451,-1,-1,-1,-1,-1,-1},
-{208,415,1452,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,197,280,295,1453,-1,-1,-1,-1,-1,-1,-1},
-{8,247,309,573,589,1454,-1,-1,-1,-1,-1,-1},
-{1455,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,356,421,1456,-1,-1,-1,-1,-1,-1,-1,-1},
-{504,1457,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{33,535,538,1458,-1,-1,-1,-1,-1,-1,-1,-1},
-{12,456,1459,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,443,1460,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{25,30,86,167,178,182,270,497,548,1461,-1,-1},
-{279,543,1462,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{32,144,190,271,274,447,1463,-1,-1,-1,-1,-1},
-{123,146,298,562,1464,-1,-1,-1,-1,-1,-1,-1},
-{414,1465,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{218,463,535,1466,-1,-1,-1,-1,-1,-1,-1,-1},
-{66,102,186,221,307,546,1467,-1,-1,-1,-1,-1},
-{519,1468,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,201,385,1469,-1,-1,-1,-1,-1,-1,-1,-1},
-{116,567,574,1470,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,210,315,598,1471,-1,-1,-1,-1,-1,-1,-1},
-{12,31,457,1472,-1,-1,-1,-1,-1,-1,-1,-1},
-{94,127,530,1473,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,129,141,146,268,270,316,1474,-1,-1,-1,-1},
-{170,1475,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{6,80,175,180,329,341,1476,-1,-1,-1,-1,-1},
-{188,286,302,409,441,493,522,545,584,1477,-1,-1},
-{125,239,342,451,573,1478,-1,-1,-1,-1,-1,-1},
-{52,118,120,124,457,459,1479,-1,-1,-1,-1,-1},
-{111,340,557,1480,-1,-1,-1,-1,-1,-1,-1,-1},
-{36,170,282,318,397,448,1481,-1,-1,-1,-1,-1},
-{1,2,1482,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{5,179,210,262,317,409,424,1483,-1,-1,-1,-1},
-{87,576,1484,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{47,92,225,258,359,409,419,516,1485,-1,-1,-1},
-{191,1486,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,123,191,1487,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,227,560,1488,-1,-1,-1,-1,-1,-1,-1,-1},
-{155,185,199,490,1489,-1,-1,-1,-1,-1,-1,-1},
-{37,43,291,468,1490,-1,-1,-1,-1,-1,-1,-1},
-{1491,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1492,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{39,107,290,502,1493,-1,-1,-1,-1,-1,-1,-1},
-{1494,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{22,283,341,368,1495,-1,-1,-1,-1,-1,-1,-1},
-{52,64,79,1496,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,293,475,1497,-1,-1,-1,-1,-1,-1,-1,-1},
-{69,89,157,401,485,495,1498,-1,-1,-1,-1,-1},
-{268,505,1499,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{127,402,1500,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{387,1501,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{567,1502,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{43,159,172,284,437,1503,-1,-1,-1,-1,-1,-1},
-{116,131,220,440,494,1504,-1,-1,-1,-1,-1,-1},
-{11,20,33,562,1505,-1,-1,-1,-1,-1,-1,-1},
-{103,296,312,578,1506,-1,-1,-1,-1,-1,-1,-1},
-{245,361,408,1507,-1,-1,-1,-1,-1,-1,-1,-1},
-{93,161,232,243,377,524,1508,-1,-1,-1,-1,-1},
-{185,275,309,437,459,591,1509,-1,-1,-1,-1,-1},
-{160,178,551,1510,-1,-1,-1,-1,-1,-1,-1,-1},
-{19,175,208,210,357,432,1511,-1,-1,-1,-1,-1},
-{107,131,358,397,1512,-1,-1,-1,-1,-1,-1,-1},
-{256,341,425,1513,-1,-1,-1,-1,-1,-1,-1,-1},
-{273,1514,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{0,78,204,211,257,535,1515,-1,-1,-1,-1,-1},
-{45,110,468,479,1516,-1,-1,-1,-1,-1,-1,-1},
-{338,1517,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{154,177,187,197,257,293,351,369,1518,-1,-1,-1},
-{139,148,250,286,451,479,1519,-1,-1,-1,-1,-1},
-{90,99,216,285,400,511,512,1520,-1,-1,-1,-1},
-{93,168,284,291,1521,-1,-1,-1,-1,-1,-1,-1},
-{175,434,1522,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{169,217,1523,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{54,243,302,475,1524,-1,-1,-1,-1,-1,-1,-1},
-{21,402,1525,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{28,32,114,205,304,1526,-1,-1,-1,-1,-1,-1},
-{138,174,525,1527,-1,-1,-1,-1,-1,-1,-1,-1},
-{87,144,319,1528,-1,-1,-1,-1,-1,-1,-1,-1},
-{27,305,1529,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,184,487,1530,-1,-1,-1,-1,-1,-1,-1,-1},
-{4,6,154,281,448,562,1531,-1,-1,-1,-1,-1},
-{23,67,237,381,1532,-1,-1,-1,-1,-1,-1,-1},
-{221,230,384,446,1533,-1,-1,-1,-1,-1,-1,-1},
-{109,291,481,547,1534,-1,-1,-1,-1,-1,-1,-1},
-{167,562,1535,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{56,273,465,483,571,1536,-1,-1,-1,-1,-1,-1},
-{200,259,368,1537,-1,-1,-1,-1,-1,-1,-1,-1},
-{265,353,496,532,1538,-1,-1,-1,-1,-1,-1,-1},
-{125,164,180,185,415,567,1539,-1,-1,-1,-1,-1},
-{2,80,596,598,1540,-1,-1,-1,-1,-1,-1,-1},
-{204,367,482,527,543,1541,-1,-1,-1,-1,-1,-1},
-{28,193,259,513,1542,-1,-1,-1,-1,-1,-1,-1},
-{54,259,291,355,556,1543,-1,-1,-1,-1,-1,-1},
-{147,170,339,406,578,1544,-1,-1,-1,-1,-1,-1},
-{22,270,450,1545,-1,-1,-1,-1,-1,-1,-1,-1},
-{228,401,445,1546,-1,-1,-1,-1,-1,-1,-1,-1},
-{67,95,224,280,332,389,455,481,1547,-1,-1,-1},
-{77,118,188,384,1548,-1,-1,-1,-1,-1,-1,-1},
-{216,278,1549,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{1,1550,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{179,313,390,550,595,1551,-1,-1,-1,-1,-1,-1},
-{15,126,586,1552,-1,-1,-1,-1,-1,-1,-1,-1},
-{209,419,441,1553,-1,-1,-1,-1,-1,-1,-1,-1},
-{35,80,102,120,343,528,1554,-1,-1,-1,-1,-1},
-{234,272,362,1555,-1,-1,-1,-1,-1,-1,-1,-1},
-{156,566,1556,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{146,299,532,1557,-1,-1,-1,-1,-1,-1,-1,-1},
-{85,1558,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{309,462,1559,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{119,235,317,396,429,581,1560,-1,-1,-1,-1,-1},
-{452,549,1561,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{295,345,361,458,481,555,1562,-1,-1,-1,-1,-1},
-{2,157,220,366,445,516,537,1563,-1,-1,-1,-1},
-{89,263,1564,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,81,128,1565,-1,-1,-1,-1,-1,-1,-1,-1},
-{1566,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{13,98,277,344,364,483,540,1567,-1,-1,-1,-1},
-{31,107,191,307,530,1568,-1,-1,-1,-1,-1,-1},
-{583,1569,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{145,346,477,510,541,1570,-1,-1,-1,-1,-1,-1},
-{144,158,325,440,1571,-1,-1,-1,-1,-1,-1,-1},
-{149,201,405,470,1572,-1,-1,-1,-1,-1,-1,-1},
-{61,226,501,512,558,1573,-1,-1,-1,-1,-1,-1},
-{5,278,285,1574,-1,-1,-1,-1,-1,-1,-1,-1},
-{90,519,554,560,1575,-1,-1,-1,-1,-1,-1,-1},
-{486,516,542,1576,-1,-1,-1,-1,-1,-1,-1,-1},
-{136,408,596,1577,-1,-1,-1,-1,-1,-1,-1,-1},
-{217,1578,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,76,122,260,394,1579,-1,-1,-1,-1,-1,-1},
-{1580,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{316,1581,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{50,1582,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{3,222,382,1583,-1,-1,-1,-1,-1,-1,-1,-1},
-{1584,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{294,1585,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{530,1586,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{201,232,374,1587,-1,-1,-1,-1,-1,-1,-1,-1},
-{166,374,497,1588,-1,-1,-1,-1,-1,-1,-1,-1},
-{232,418,439,531,589,1589,-1,-1,-1,-1,-1,-1},
-{324,478,491,1590,-1,-1,-1,-1,-1,-1,-1,-1},
-{185,303,506,1591,-1,-1,-1,-1,-1,-1,-1,-1},
-{10,216,237,255,440,502,592,1592,-1,-1,-1,-1},
-{231,304,487,1593,-1,-1,-1,-1,-1,-1,-1,-1},
-{182,401,493,1594,-1,-1,-1,-1,-1,-1,-1,-1},
-{92,454,483,1595,-1,-1,-1,-1,-1,-1,-1,-1},
-{159,237,293,1596,-1,-1,-1,-1,-1,-1,-1,-1},
-{125,399,1597,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{386,391,434,1598,-1,-1,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixV_6_16[1600][9]={
-{246,468,916,-1,-1,-1,-1,-1,-1},
-{78,296,386,572,883,951,-1,-1,-1},
-{23,37,100,605,846,883,941,964,-1},
-{215,274,287,478,601,738,857,984,-1},
-{68,276,284,454,464,605,799,875,932},
-{34,402,848,884,975,-1,-1,-1,-1},
-{83,120,130,374,466,877,932,-1,-1},
-{46,139,282,681,829,837,852,-1,-1},
-{322,383,434,549,667,855,-1,-1,-1},
-{305,309,382,546,551,709,746,-1,-1},
-{37,123,302,830,993,-1,-1,-1,-1},
-{238,263,271,401,583,590,636,754,906},
-{18,310,407,560,739,860,873,-1,-1},
-{4,80,179,295,310,775,968,-1,-1},
-{9,63,473,575,663,812,-1,-1,-1},
-{176,241,335,593,597,642,654,838,953},
-{337,771,813,-1,-1,-1,-1,-1,-1},
-{373,658,668,758,-1,-1,-1,-1,-1},
-{25,269,726,-1,-1,-1,-1,-1,-1},
-{18,294,375,594,630,848,912,-1,-1},
-{192,359,377,599,717,784,906,-1,-1},
-{37,312,477,478,576,586,804,851,926},
-{115,321,340,576,623,676,896,946,-1},
-{222,286,736,933,-1,-1,-1,-1,-1},
-{2,335,800,-1,-1,-1,-1,-1,-1},
-{378,499,668,706,713,862,-1,-1,-1},
-{58,425,790,-1,-1,-1,-1,-1,-1},
-{53,178,282,814,930,-1,-1,-1,-1},
-{150,154,251,626,927,943,-1,-1,-1},
-{49,362,435,576,652,789,804,-1,-1},
-{95,232,596,724,862,-1,-1,-1,-1},
-{39,243,311,498,515,648,780,873,969},
-{98,429,443,465,516,573,805,864,927},
-{5,730,768,782,854,859,906,-1,-1},
-{178,532,844,-1,-1,-1,-1,-1,-1},
-{30,51,163,442,603,955,-1,-1,-1},
-{291,337,603,826,882,-1,-1,-1,-1},
-{311,527,655,734,891,-1,-1,-1,-1},
-{15,97,135,231,313,391,532,835,-1},
-{367,491,691,894,-1,-1,-1,-1,-1},
-{265,337,646,-1,-1,-1,-1,-1,-1},
-{87,91,101,205,438,734,-1,-1,-1},
-{63,160,161,277,299,408,750,820,-1},
-{56,559,740,743,891,904,-1,-1,-1},
-{131,459,561,581,583,794,826,-1,-1},
-{232,740,917,-1,-1,-1,-1,-1,-1},
-{3,179,666,823,-1,-1,-1,-1,-1},
-{317,398,558,719,725,886,-1,-1,-1},
-{141,364,413,550,624,-1,-1,-1,-1},
-{173,239,244,450,563,708,728,737,823},
-{1,660,801,833,836,980,983,-1,-1},
-{318,395,820,898,-1,-1,-1,-1,-1},
-{164,540,662,692,790,880,897,-1,-1},
-{55,83,142,558,739,792,-1,-1,-1},
-{143,356,377,427,541,762,925,944,-1},
-{389,539,640,785,-1,-1,-1,-1,-1},
-{181,251,430,937,-1,-1,-1,-1,-1},
-{92,647,767,772,-1,-1,-1,-1,-1},
-{5,55,266,472,555,672,755,847,-1},
-{11,96,120,252,366,482,567,826,843},
-{207,371,448,-1,-1,-1,-1,-1,-1},
-{230,389,576,674,700,742,974,-1,-1},
-{109,796,966,-1,-1,-1,-1,-1,-1},
-{0,48,116,217,311,415,551,644,796},
-{153,305,317,516,518,745,784,795,897},
-{81,222,235,547,781,-1,-1,-1,-1},
-{72,120,320,337,659,748,769,773,868},
-{253,269,469,672,684,850,933,948,-1},
-{253,271,449,758,766,-1,-1,-1,-1},
-{621,666,679,703,840,888,899,-1,-1},
-{145,371,804,-1,-1,-1,-1,-1,-1},
-{366,598,709,-1,-1,-1,-1,-1,-1},
-{270,335,473,588,604,635,671,-1,-1},
-{26,341,405,524,612,784,-1,-1,-1},
-{190,430,431,462,598,619,624,671,681},
-{113,544,817,-1,-1,-1,-1,-1,-1},
-{494,818,980,-1,-1,-1,-1,-1,-1},
-{11,37,202,238,256,315,445,489,949},
-{173,424,641,698,726,798,916,-1,-1},
-{106,209,236,238,379,419,432,771,897},
-{545,717,782,801,877,941,955,-1,-1},
-{355,430,750,966,-1,-1,-1,-1,-1},
-{156,425,529,656,-1,-1,-1,-1,-1},
-{22,427,432,475,-1,-1,-1,-1,-1},
-{198,232,338,536,558,639,787,-1,-1},
-{8,315,414,634,852,959,-1,-1,-1},
-{214,634,644,862,-1,-1,-1,-1,-1},
-{152,229,549,870,885,929,-1,-1,-1},
-{43,260,328,405,-1,-1,-1,-1,-1},
-{201,256,275,428,435,576,666,899,965},
-{63,190,277,512,555,565,921,931,976},
-{3,73,325,327,656,777,-1,-1,-1},
-{7,20,271,369,886,996,-1,-1,-1},
-{260,314,481,538,706,909,922,-1,-1},
-{35,101,291,324,469,601,874,-1,-1},
-{63,303,397,398,719,948,-1,-1,-1},
-{83,118,466,644,758,-1,-1,-1,-1},
-{382,412,549,702,780,-1,-1,-1,-1},
-{149,592,643,968,-1,-1,-1,-1,-1},
-{602,801,921,-1,-1,-1,-1,-1,-1},
-{96,308,743,796,814,-1,-1,-1,-1},
-{247,249,323,399,565,777,814,-1,-1},
-{494,602,713,719,868,955,-1,-1,-1},
-{245,246,493,566,744,847,907,-1,-1},
-{133,283,444,482,617,708,731,753,803},
-{222,262,296,505,509,545,825,-1,-1},
-{45,68,572,-1,-1,-1,-1,-1,-1},
-{462,668,894,913,969,-1,-1,-1,-1},
-{112,299,369,429,-1,-1,-1,-1,-1},
-{146,149,232,384,661,666,849,935,-1},
-{66,112,241,343,445,492,547,560,917},
-{112,787,881,-1,-1,-1,-1,-1,-1},
-{52,343,818,-1,-1,-1,-1,-1,-1},
-{425,469,493,516,-1,-1,-1,-1,-1},
-{71,220,311,438,585,725,927,-1,-1},
-{17,263,552,619,712,-1,-1,-1,-1},
-{83,260,547,549,667,731,871,905,-1},
-{75,275,309,544,792,802,-1,-1,-1},
-{7,20,118,592,807,880,949,-1,-1},
-{76,201,286,308,641,670,674,961,-1},
-{134,228,240,369,473,516,623,880,955},
-{168,181,229,236,288,327,449,500,821},
-{119,390,445,461,468,672,726,752,980},
-{352,659,713,746,760,865,888,-1,-1},
-{109,199,201,487,701,880,-1,-1,-1},
-{8,133,175,335,698,879,940,998,-1},
-{670,766,771,953,-1,-1,-1,-1,-1},
-{162,274,626,656,661,874,901,-1,-1},
-{321,847,966,-1,-1,-1,-1,-1,-1},
-{13,79,189,229,653,875,-1,-1,-1},
-{116,345,364,405,700,766,833,-1,-1},
-{140,276,488,650,786,787,801,905,913},
-{21,81,187,254,453,533,759,-1,-1},
-{74,192,205,537,-1,-1,-1,-1,-1},
-{257,294,356,431,443,547,581,640,685},
-{825,838,846,-1,-1,-1,-1,-1,-1},
-{33,243,474,978,-1,-1,-1,-1,-1},
-{3,67,138,182,407,436,594,744,-1},
-{633,695,806,928,-1,-1,-1,-1,-1},
-{237,395,784,920,-1,-1,-1,-1,-1},
-{329,469,473,519,-1,-1,-1,-1,-1},
-{10,219,319,623,625,794,875,-1,-1},
-{363,402,409,417,477,501,658,-1,-1},
-{315,387,548,777,-1,-1,-1,-1,-1},
-{14,151,235,248,337,864,929,972,-1},
-{8,424,596,971,-1,-1,-1,-1,-1},
-{29,91,439,643,728,865,875,958,-1},
-{17,238,367,493,629,684,945,-1,-1},
-{595,734,920,-1,-1,-1,-1,-1,-1},
-{136,180,209,473,524,973,-1,-1,-1},
-{128,167,393,439,456,611,636,665,750},
-{315,468,485,555,610,724,-1,-1,-1},
-{34,169,747,768,-1,-1,-1,-1,-1},
-{342,357,577,-1,-1,-1,-1,-1,-1},
-{40,192,236,294,402,451,872,919,932},
-{346,489,651,889,890,-1,-1,-1,-1},
-{89,408,422,794,809,957,-1,-1,-1},
-{118,244,521,556,602,687,757,899,964},
-{325,662,972,-1,-1,-1,-1,-1,-1},
-{0,439,517,549,627,904,997,-1,-1},
-{18,426,799,841,911,-1,-1,-1,-1},
-{235,477,593,721,791,909,-1,-1,-1},
-{42,160,196,323,706,795,-1,-1,-1},
-{22,53,132,169,425,473,481,570,813},
-{214,305,322,419,473,567,718,940,-1},
-{441,449,491,680,699,765,-1,-1,-1},
-{4,26,179,201,510,989,-1,-1,-1},
-{48,144,341,862,936,-1,-1,-1,-1},
-{82,125,204,263,299,516,922,-1,-1},
-{29,45,163,224,520,544,580,924,-1},
-{55,456,681,876,882,945,-1,-1,-1},
-{85,191,214,309,348,523,718,744,-1},
-{123,160,474,491,616,759,827,904,-1},
-{12,308,684,736,788,-1,-1,-1,-1},
-{185,189,393,585,592,694,928,-1,-1},
-{69,137,222,373,498,764,877,912,923},
-{238,528,654,714,-1,-1,-1,-1,-1},
-{128,235,553,765,919,-1,-1,-1,-1},
-{399,835,862,911,-1,-1,-1,-1,-1},
-{6,242,343,379,763,802,884,952,-1},
-{175,217,305,704,877,940,-1,-1,-1},
-{30,137,244,265,476,479,711,745,750},
-{104,244,338,357,593,661,862,995,-1},
-{464,697,835,-1,-1,-1,-1,-1,-1},
-{238,371,455,462,552,639,666,789,931},
-{58,306,689,890,910,940,992,-1,-1},
-{15,222,531,536,654,658,868,-1,-1},
-{141,677,807,919,-1,-1,-1,-1,-1},
-{64,90,97,132,338,545,615,878,949},
-{35,138,171,178,288,327,796,-1,-1},
-{177,520,747,864,-1,-1,-1,-1,-1},
-{57,125,176,369,564,740,887,888,969},
-{93,176,254,484,727,783,830,-1,-1},
-{314,772,943,-1,-1,-1,-1,-1,-1},
-{196,270,324,463,474,486,651,-1,-1},
-{0,48,84,92,203,417,-1,-1,-1},
-{58,71,832,-1,-1,-1,-1,-1,-1},
-{15,299,338,516,742,854,919,-1,-1},
-{150,233,462,-1,-1,-1,-1,-1,-1},
-{239,259,373,696,773,890,-1,-1,-1},
-{5,6,301,355,493,697,789,938,-1},
-{240,664,724,731,870,973,988,-1,-1},
-{22,208,235,249,650,747,788,-1,-1},
-{22,27,270,282,657,-1,-1,-1,-1},
-{208,358,569,584,613,775,824,916,942},
-{293,374,927,-1,-1,-1,-1,-1,-1},
-{171,244,424,658,660,804,-1,-1,-1},
-{248,421,532,541,614,642,795,-1,-1},
-{407,471,472,677,853,912,-1,-1,-1},
-{59,309,349,433,487,582,643,861,954},
-{132,208,308,435,481,872,884,912,-1},
-{4,557,664,916,-1,-1,-1,-1,-1},
-{29,180,286,-1,-1,-1,-1,-1,-1},
-{311,316,393,436,786,-1,-1,-1,-1},
-{9,106,197,245,308,330,631,849,-1},
-{109,142,215,347,364,548,724,802,-1},
-{173,185,546,921,950,993,-1,-1,-1},
-{164,387,501,525,722,924,979,-1,-1},
-{189,198,302,340,366,413,508,705,867},
-{112,312,386,398,425,476,662,731,-1},
-{7,83,87,361,508,525,700,905,964},
-{39,96,154,352,462,679,868,934,-1},
-{38,117,322,581,723,726,984,-1,-1},
-{138,454,808,815,-1,-1,-1,-1,-1},
-{8,147,508,647,948,-1,-1,-1,-1},
-{264,845,886,-1,-1,-1,-1,-1,-1},
-{524,566,678,744,752,820,974,-1,-1},
-{147,225,300,345,383,729,889,-1,-1},
-{107,550,689,947,-1,-1,-1,-1,-1},
-{317,455,688,-1,-1,-1,-1,-1,-1},
-{20,48,472,669,934,-1,-1,-1,-1},
-{107,193,289,427,433,994,-1,-1,-1},
-{113,235,254,259,812,909,988,990,-1},
-{74,220,285,390,530,540,581,621,708},
-{201,532,657,956,-1,-1,-1,-1,-1},
-{35,63,106,497,746,760,961,-1,-1},
-{40,81,199,220,506,541,561,619,693},
-{15,115,634,636,933,993,997,-1,-1},
-{30,78,292,525,615,625,-1,-1,-1},
-{192,212,508,537,737,765,844,879,-1},
-{14,326,366,395,600,-1,-1,-1,-1},
-{49,491,557,685,830,833,-1,-1,-1},
-{86,109,362,440,663,693,696,817,-1},
-{19,117,181,689,823,909,925,-1,-1},
-{112,228,279,304,349,560,671,735,749},
-{71,112,295,518,822,908,-1,-1,-1},
-{31,62,181,212,226,482,503,573,659},
-{3,67,254,416,621,704,763,855,-1},
-{47,319,440,511,-1,-1,-1,-1,-1},
-{298,390,398,806,-1,-1,-1,-1,-1},
-{268,335,449,843,920,-1,-1,-1,-1},
-{28,337,366,531,-1,-1,-1,-1,-1},
-{185,191,504,-1,-1,-1,-1,-1,-1},
-{21,36,112,128,188,244,360,431,527},
-{11,173,280,311,467,613,744,824,845},
-{109,165,431,502,693,729,798,993,-1},
-{21,133,209,454,647,689,698,914,-1},
-{89,255,265,348,452,711,735,916,919},
-{230,362,425,748,793,886,-1,-1,-1},
-{231,250,290,392,672,729,938,943,944},
-{196,365,443,449,530,803,980,-1,-1},
-{72,175,255,293,455,-1,-1,-1,-1},
-{108,171,228,414,434,505,652,757,884},
-{134,255,347,404,965,-1,-1,-1,-1},
-{136,204,312,322,587,761,-1,-1,-1},
-{286,434,547,939,-1,-1,-1,-1,-1},
-{130,358,364,373,722,793,831,-1,-1},
-{544,667,740,783,797,-1,-1,-1,-1},
-{239,564,632,754,875,900,-1,-1,-1},
-{157,254,315,326,418,428,443,632,801},
-{801,862,875,946,-1,-1,-1,-1,-1},
-{127,319,344,748,864,-1,-1,-1,-1},
-{450,794,956,-1,-1,-1,-1,-1,-1},
-{183,350,370,549,717,915,937,-1,-1},
-{119,470,701,750,864,-1,-1,-1,-1},
-{175,293,346,499,617,624,831,910,-1},
-{303,658,828,-1,-1,-1,-1,-1,-1},
-{357,449,580,785,968,-1,-1,-1,-1},
-{258,327,363,499,568,950,975,-1,-1},
-{117,318,457,500,561,833,863,-1,-1},
-{219,476,819,854,948,-1,-1,-1,-1},
-{105,131,489,512,647,784,847,932,-1},
-{28,42,313,450,462,715,882,-1,-1},
-{41,120,214,335,572,671,896,-1,-1},
-{103,342,818,904,922,-1,-1,-1,-1},
-{58,81,163,174,233,301,746,921,975},
-{117,226,254,315,344,878,920,-1,-1},
-{268,468,387,-1,-1,-1,-1,-1,-1},
-{173,309,824,-1,-1,-1,-1,-1,-1},
-{80,198,276,474,566,821,-1,-1,-1},
-{68,502,529,692,708,806,894,-1,-1},
-{195,199,817,891,922,935,944,-1,-1},
-{159,449,511,667,820,-1,-1,-1,-1},
-{448,472,687,688,768,824,898,919,997},
-{1,180,449,493,503,673,704,768,986},
-{132,200,219,365,608,854,963,-1,-1},
-{9,185,419,731,907,-1,-1,-1,-1},
-{7,539,578,605,831,-1,-1,-1,-1},
-{11,349,405,511,523,678,720,865,-1},
-{1,178,254,393,406,460,486,825,958},
-{261,327,363,680,-1,-1,-1,-1,-1},
-{150,442,484,562,571,731,-1,-1,-1},
-{13,274,349,878,925,-1,-1,-1,-1},
-{32,164,599,992,-1,-1,-1,-1,-1},
-{188,231,251,408,749,770,832,927,994},
-{142,143,209,220,293,496,579,767,930},
-{46,136,185,229,307,419,453,-1,-1},
-{129,868,969,-1,-1,-1,-1,-1,-1},
-{307,323,475,617,-1,-1,-1,-1,-1},
-{83,84,656,703,841,855,910,960,-1},
-{169,282,445,-1,-1,-1,-1,-1,-1},
-{104,196,242,290,320,401,435,630,778},
-{41,145,158,382,406,540,820,907,-1},
-{110,145,491,499,952,-1,-1,-1,-1},
-{96,105,299,-1,-1,-1,-1,-1,-1},
-{9,27,420,444,491,662,745,849,872},
-{264,346,385,518,529,849,875,982,-1},
-{50,106,134,422,563,634,791,884,961},
-{498,541,882,-1,-1,-1,-1,-1,-1},
-{84,143,568,575,929,-1,-1,-1,-1},
-{140,374,549,575,-1,-1,-1,-1,-1},
-{15,274,352,400,695,792,-1,-1,-1},
-{312,314,566,772,803,826,-1,-1,-1},
-{97,229,351,688,-1,-1,-1,-1,-1},
-{64,73,216,374,727,798,991,-1,-1},
-{29,514,529,541,655,667,972,-1,-1},
-{366,371,447,824,-1,-1,-1,-1,-1},
-{2,169,314,810,-1,-1,-1,-1,-1},
-{412,498,725,-1,-1,-1,-1,-1,-1},
-{367,392,605,798,799,808,877,-1,-1},
-{340,410,607,-1,-1,-1,-1,-1,-1},
-{246,312,331,446,488,703,769,-1,-1},
-{133,262,507,550,612,740,948,-1,-1},
-{26,232,382,653,770,776,-1,-1,-1},
-{101,378,610,-1,-1,-1,-1,-1,-1},
-{21,70,164,289,383,449,-1,-1,-1},
-{58,66,209,-1,-1,-1,-1,-1,-1},
-{304,356,510,821,-1,-1,-1,-1,-1},
-{412,813,918,-1,-1,-1,-1,-1,-1},
-{397,589,945,-1,-1,-1,-1,-1,-1},
-{24,75,205,294,578,594,779,881,-1},
-{17,166,577,705,742,829,877,896,914},
-{87,292,393,507,589,879,-1,-1,-1},
-{288,452,520,694,735,753,955,-1,-1},
-{190,395,423,518,624,636,845,968,-1},
-{5,83,143,223,490,577,714,720,963},
-{255,258,360,406,453,485,529,971,-1},
-{296,572,694,-1,-1,-1,-1,-1,-1},
-{540,639,838,-1,-1,-1,-1,-1,-1},
-{185,264,292,358,407,474,479,761,-1},
-{235,364,681,757,782,794,799,828,836},
-{334,442,482,493,518,528,623,919,-1},
-{88,228,273,325,348,584,589,757,-1},
-{114,179,265,285,367,501,733,842,939},
-{298,468,582,634,737,816,-1,-1,-1},
-{125,258,348,944,-1,-1,-1,-1,-1},
-{235,622,819,857,-1,-1,-1,-1,-1},
-{399,482,912,-1,-1,-1,-1,-1,-1},
-{71,154,163,268,338,443,913,-1,-1},
-{401,823,886,-1,-1,-1,-1,-1,-1},
-{336,353,457,-1,-1,-1,-1,-1,-1},
-{19,542,626,908,963,-1,-1,-1,-1},
-{93,425,438,530,606,825,956,-1,-1},
-{153,307,316,462,515,587,-1,-1,-1},
-{332,852,968,-1,-1,-1,-1,-1,-1},
-{86,153,422,485,-1,-1,-1,-1,-1},
-{93,115,335,821,964,-1,-1,-1,-1},
-{611,840,942,-1,-1,-1,-1,-1,-1},
-{57,719,766,896,938,-1,-1,-1,-1},
-{412,708,919,-1,-1,-1,-1,-1,-1},
-{555,587,790,-1,-1,-1,-1,-1,-1},
-{6,111,583,-1,-1,-1,-1,-1,-1},
-{69,428,474,536,-1,-1,-1,-1,-1},
-{79,295,377,629,821,-1,-1,-1,-1},
-{93,164,259,321,397,505,753,988,989},
-{23,104,295,565,660,708,819,-1,-1},
-{301,435,664,-1,-1,-1,-1,-1,-1},
-{2,181,200,204,256,581,630,825,909},
-{75,671,675,-1,-1,-1,-1,-1,-1},
-{170,187,358,416,440,623,626,-1,-1},
-{66,237,293,638,-1,-1,-1,-1,-1},
-{27,250,594,672,933,-1,-1,-1,-1},
-{489,852,984,-1,-1,-1,-1,-1,-1},
-{339,423,442,-1,-1,-1,-1,-1,-1},
-{14,179,368,456,517,556,742,934,949},
-{73,82,107,131,177,307,768,822,870},
-{64,360,795,999,-1,-1,-1,-1,-1},
-{25,36,328,459,697,902,-1,-1,-1},
-{57,302,394,446,513,704,771,833,-1},
-{10,120,373,948,-1,-1,-1,-1,-1},
-{126,227,589,680,710,747,952,-1,-1},
-{31,746,999,-1,-1,-1,-1,-1,-1},
-{360,387,459,737,-1,-1,-1,-1,-1},
-{291,483,493,583,640,785,-1,-1,-1},
-{164,179,240,541,618,661,806,980,-1},
-{116,152,302,-1,-1,-1,-1,-1,-1},
-{172,192,428,453,454,460,519,961,-1},
-{261,334,471,554,745,827,882,913,-1},
-{218,364,501,-1,-1,-1,-1,-1,-1},
-{378,397,618,998,-1,-1,-1,-1,-1},
-{112,466,682,701,921,-1,-1,-1,-1},
-{161,372,514,565,685,845,899,947,995},
-{44,76,78,266,427,664,901,926,-1},
-{43,261,611,644,-1,-1,-1,-1,-1},
-{3,77,111,116,535,589,683,-1,-1},
-{87,170,281,324,407,575,750,788,973},
-{57,555,654,945,-1,-1,-1,-1,-1},
-{61,64,173,432,450,668,817,837,-1},
-{11,61,218,319,490,535,602,908,978},
-{205,302,369,783,799,838,878,884,886},
-{509,615,791,-1,-1,-1,-1,-1,-1},
-{13,65,126,134,530,566,594,-1,-1},
-{146,238,549,571,-1,-1,-1,-1,-1},
-{18,97,308,509,575,632,752,-1,-1},
-{9,267,413,549,630,694,866,-1,-1},
-{326,461,534,661,727,853,940,-1,-1},
-{97,116,174,548,617,745,-1,-1,-1},
-{100,184,286,400,418,625,666,675,729},
-{400,452,498,618,627,990,-1,-1,-1},
-{341,886,954,-1,-1,-1,-1,-1,-1},
-{92,146,224,227,266,764,775,-1,-1},
-{232,445,793,811,857,-1,-1,-1,-1},
-{143,229,328,573,-1,-1,-1,-1,-1},
-{14,132,599,-1,-1,-1,-1,-1,-1},
-{28,97,578,630,756,789,884,-1,-1},
-{29,120,325,452,738,798,914,-1,-1},
-{146,355,548,822,-1,-1,-1,-1,-1},
-{18,93,179,214,499,-1,-1,-1,-1},
-{32,293,388,498,663,-1,-1,-1,-1},
-{145,271,434,462,582,594,612,762,961},
-{105,174,279,321,676,775,-1,-1,-1},
-{264,530,769,-1,-1,-1,-1,-1,-1},
-{377,787,830,912,-1,-1,-1,-1,-1},
-{220,227,303,560,575,-1,-1,-1,-1},
-{51,117,343,581,616,652,654,923,999},
-{148,372,456,-1,-1,-1,-1,-1,-1},
-{735,780,823,-1,-1,-1,-1,-1,-1},
-{161,181,425,592,732,904,910,-1,-1},
-{137,464,572,-1,-1,-1,-1,-1,-1},
-{97,99,174,409,522,579,686,696,990},
-{147,410,472,660,905,972,993,-1,-1},
-{92,344,380,824,878,954,-1,-1,-1},
-{71,192,236,278,657,714,728,732,832},
-{139,207,284,338,383,823,861,-1,-1},
-{283,389,396,531,679,724,-1,-1,-1},
-{104,411,675,679,771,947,964,-1,-1},
-{152,174,219,286,376,382,453,740,934},
-{3,319,649,674,752,760,864,-1,-1},
-{9,141,882,932,-1,-1,-1,-1,-1},
-{5,103,451,543,-1,-1,-1,-1,-1},
-{132,188,198,382,451,627,946,-1,-1},
-{287,313,523,659,680,826,879,920,-1},
-{124,202,246,255,436,441,631,704,962},
-{98,247,372,393,397,-1,-1,-1,-1},
-{55,170,391,571,635,663,714,848,996},
-{47,100,262,469,695,948,-1,-1,-1},
-{38,224,468,860,-1,-1,-1,-1,-1},
-{115,214,479,873,880,-1,-1,-1,-1},
-{109,168,597,811,963,-1,-1,-1,-1},
-{224,265,275,290,554,570,880,910,-1},
-{312,349,472,801,-1,-1,-1,-1,-1},
-{153,268,304,333,378,658,783,-1,-1},
-{8,126,127,407,606,666,797,834,960},
-{34,225,297,345,437,507,575,702,867},
-{17,332,376,633,-1,-1,-1,-1,-1},
-{72,170,438,765,937,-1,-1,-1,-1},
-{39,81,273,321,422,-1,-1,-1,-1},
-{208,250,383,517,572,-1,-1,-1,-1},
-{39,69,83,142,399,460,741,891,917},
-{93,100,270,382,552,-1,-1,-1,-1},
-{60,455,973,-1,-1,-1,-1,-1,-1},
-{108,148,279,294,685,743,-1,-1,-1},
-{93,303,720,-1,-1,-1,-1,-1,-1},
-{132,225,637,789,-1,-1,-1,-1,-1},
-{75,131,201,256,351,514,623,686,-1},
-{193,209,321,443,488,551,758,898,925},
-{394,487,490,592,636,709,-1,-1,-1},
-{197,384,524,631,830,971,-1,-1,-1},
-{14,147,223,735,991,-1,-1,-1,-1},
-{201,917,920,-1,-1,-1,-1,-1,-1},
-{167,250,360,377,410,474,649,-1,-1},
-{124,418,435,593,646,935,948,963,-1},
-{90,132,367,565,652,733,942,-1,-1},
-{167,265,432,578,614,794,937,968,996},
-{171,174,180,295,611,719,739,771,794},
-{30,535,546,592,899,-1,-1,-1,-1},
-{468,749,977,-1,-1,-1,-1,-1,-1},
-{448,464,729,931,994,-1,-1,-1,-1},
-{162,251,546,-1,-1,-1,-1,-1,-1},
-{101,192,216,307,498,569,726,827,-1},
-{197,310,639,725,755,890,-1,-1,-1},
-{174,175,339,504,520,991,-1,-1,-1},
-{55,235,301,403,721,804,-1,-1,-1},
-{22,28,238,542,878,995,-1,-1,-1},
-{143,418,439,447,905,-1,-1,-1,-1},
-{329,413,899,-1,-1,-1,-1,-1,-1},
-{94,460,563,755,939,-1,-1,-1,-1},
-{234,291,476,616,627,671,756,862,989},
-{89,103,348,498,507,549,642,-1,-1},
-{115,139,469,549,650,-1,-1,-1,-1},
-{68,505,657,819,-1,-1,-1,-1,-1},
-{322,464,599,602,623,631,679,689,974},
-{573,594,598,671,676,687,894,993,-1},
-{218,685,734,844,-1,-1,-1,-1,-1},
-{60,480,565,720,737,746,755,858,-1},
-{320,408,579,900,-1,-1,-1,-1,-1},
-{225,246,253,394,798,992,-1,-1,-1},
-{31,86,145,492,-1,-1,-1,-1,-1},
-{172,716,727,753,774,-1,-1,-1,-1},
-{139,319,627,-1,-1,-1,-1,-1,-1},
-{152,186,480,668,737,778,837,971,-1},
-{36,186,209,411,519,842,921,-1,-1},
-{218,355,450,533,601,795,921,974,-1},
-{26,165,266,420,610,786,793,841,943},
-{129,218,368,771,-1,-1,-1,-1,-1},
-{60,161,454,490,524,599,641,817,-1},
-{301,326,684,886,964,977,-1,-1,-1},
-{196,452,679,710,848,-1,-1,-1,-1},
-{31,113,238,304,414,456,467,481,786},
-{160,285,468,485,636,869,976,-1,-1},
-{143,487,519,601,681,718,788,839,-1},
-{323,405,629,691,737,-1,-1,-1,-1},
-{11,61,142,159,202,334,684,847,878},
-{147,479,692,-1,-1,-1,-1,-1,-1},
-{116,146,147,286,396,429,718,781,909},
-{103,473,557,928,-1,-1,-1,-1,-1},
-{5,139,192,291,339,395,431,-1,-1},
-{85,89,129,324,369,441,748,845,942},
-{201,247,382,420,454,511,533,667,955},
-{291,296,656,722,849,-1,-1,-1,-1},
-{27,314,469,504,596,874,969,987,-1},
-{58,318,441,783,806,990,-1,-1,-1},
-{80,419,620,625,646,939,958,-1,-1},
-{450,628,754,-1,-1,-1,-1,-1,-1},
-{185,390,402,425,690,829,-1,-1,-1},
-{421,525,579,831,859,867,916,-1,-1},
-{339,638,651,-1,-1,-1,-1,-1,-1},
-{44,292,297,334,716,964,-1,-1,-1},
-{669,742,859,-1,-1,-1,-1,-1,-1},
-{266,367,498,804,-1,-1,-1,-1,-1},
-{150,341,728,757,762,845,846,968,-1},
-{53,364,367,713,714,971,-1,-1,-1},
-{82,122,346,369,701,766,977,-1,-1},
-{309,566,642,707,791,863,942,-1,-1},
-{164,233,294,387,471,709,778,796,-1},
-{5,27,101,283,468,662,878,-1,-1},
-{100,123,461,584,660,868,-1,-1,-1},
-{42,122,230,367,369,703,935,-1,-1},
-{95,279,378,582,762,862,-1,-1,-1},
-{407,430,509,745,786,793,962,-1,-1},
-{172,184,248,273,373,952,-1,-1,-1},
-{135,281,552,568,767,822,911,-1,-1},
-{159,426,502,541,-1,-1,-1,-1,-1},
-{110,351,606,681,703,741,820,826,-1},
-{248,790,848,976,-1,-1,-1,-1,-1},
-{32,326,963,-1,-1,-1,-1,-1,-1},
-{52,93,187,268,497,565,577,944,-1},
-{0,76,507,881,-1,-1,-1,-1,-1},
-{360,385,679,974,-1,-1,-1,-1,-1},
-{95,187,306,495,515,516,-1,-1,-1},
-{117,272,443,621,769,822,889,976,-1},
-{74,150,157,327,361,699,-1,-1,-1},
-{184,416,569,578,865,906,932,936,-1},
-{111,452,455,511,632,-1,-1,-1,-1},
-{545,732,784,-1,-1,-1,-1,-1,-1},
-{56,676,786,-1,-1,-1,-1,-1,-1},
-{295,389,957,-1,-1,-1,-1,-1,-1},
-{8,55,121,717,846,871,903,940,-1},
-{135,168,392,699,-1,-1,-1,-1,-1},
-{50,255,800,-1,-1,-1,-1,-1,-1},
-{135,151,254,847,-1,-1,-1,-1,-1},
-{17,255,937,-1,-1,-1,-1,-1,-1},
-{174,182,232,406,472,475,601,-1,-1},
-{122,247,321,456,551,852,855,879,-1},
-{477,502,565,747,798,871,-1,-1,-1},
-{274,628,764,-1,-1,-1,-1,-1,-1},
-{49,412,565,643,750,797,885,-1,-1},
-{69,108,256,308,390,453,574,594,-1},
-{82,198,762,907,945,-1,-1,-1,-1},
-{92,95,327,380,411,654,783,-1,-1},
-{113,126,229,329,649,699,701,-1,-1},
-{60,129,155,184,269,292,519,961,-1},
-{14,42,69,291,529,737,-1,-1,-1},
-{177,414,490,970,-1,-1,-1,-1,-1},
-{270,497,878,-1,-1,-1,-1,-1,-1},
-{45,125,197,329,580,748,-1,-1,-1},
-{67,105,174,234,309,446,485,608,953},
-{92,189,239,697,-1,-1,-1,-1,-1},
-{141,210,269,624,-1,-1,-1,-1,-1},
-{832,855,990,-1,-1,-1,-1,-1,-1},
-{435,581,686,-1,-1,-1,-1,-1,-1},
-{172,193,278,395,427,473,586,812,910},
-{85,209,387,449,452,993,-1,-1,-1},
-{11,644,786,798,-1,-1,-1,-1,-1},
-{193,265,361,490,776,-1,-1,-1,-1},
-{37,110,774,952,-1,-1,-1,-1,-1},
-{220,498,591,696,720,784,941,978,-1},
-{296,303,545,601,800,-1,-1,-1,-1},
-{79,207,233,427,442,600,612,872,941},
-{182,201,590,720,777,-1,-1,-1,-1},
-{0,1,-1,-1,-1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1,-1,-1,-1},
-{199,200,-1,-1,-1,-1,-1,-1,-1},
-{200,201,-1,-1,-1,-1,-1,-1,-1},
-{201,202,-1,-1,-1,-1,-1,-1,-1},
-{202,203,-1,-1,-1,-1,-1,-1,-1},
-{203,204,-1,-1,-1,-1,-1,-1,-1},
-{204,205,-1,-1,-1,-1,-1,-1,-1},
-{205,206,-1,-1,-1,-1,-1,-1,-1},
-{206,207,-1,-1,-1,-1,-1,-1,-1},
-{207,208,-1,-1,-1,-1,-1,-1,-1},
-{208,209,-1,-1,-1,-1,-1,-1,-1},
-{209,210,-1,-1,-1,-1,-1,-1,-1},
-{210,211,-1,-1,-1,-1,-1,-1,-1},
-{211,212,-1,-1,-1,-1,-1,-1,-1},
-{212,213,-1,-1,-1,-1,-1,-1,-1},
-{213,214,-1,-1,-1,-1,-1,-1,-1},
-{214,215,-1,-1,-1,-1,-1,-1,-1},
-{215,216,-1,-1,-1,-1,-1,-1,-1},
-{216,217,-1,-1,-1,-1,-1,-1,-1},
-{217,218,-1,-1,-1,-1,-1,-1,-1},
-{218,219,-1,-1,-1,-1,-1,-1,-1},
-{219,220,-1,-1,-1,-1,-1,-1,-1},
-{220,221,-1,-1,-1,-1,-1,-1,-1},
-{221,222,-1,-1,-1,-1,-1,-1,-1},
-{222,223,-1,-1,-1,-1,-1,-1,-1},
-{223,224,-1,-1,-1,-1,-1,-1,-1},
-{224,225,-1,-1,-1,-1,-1,-1,-1},
-{225,226,-1,-1,-1,-1,-1,-1,-1},
-{226,227,-1,-1,-1,-1,-1,-1,-1},
-{227,228,-1,-1,-1,-1,-1,-1,-1},
-{228,229,-1,-1,-1,-1,-1,-1,-1},
-{229,230,-1,-1,-1,-1,-1,-1,-1},
-{230,231,-1,-1,-1,-1,-1,-1,-1},
-{231,232,-1,-1,-1,-1,-1,-1,-1},
-{232,233,-1,-1,-1,-1,-1,-1,-1},
-{233,234,-1,-1,-1,-1,-1,-1,-1},
-{234,235,-1,-1,-1,-1,-1,-1,-1},
-{235,236,-1,-1,-1,-1,-1,-1,-1},
-{236,237,-1,-1,-1,-1,-1,-1,-1},
-{237,238,-1,-1,-1,-1,-1,-1,-1},
-{238,239,-1,-1,-1,-1,-1,-1,-1},
-{239,240,-1,-1,-1,-1,-1,-1,-1},
-{240,241,-1,-1,-1,-1,-1,-1,-1},
-{241,242,-1,-1,-1,-1,-1,-1,-1},
-{242,243,-1,-1,-1,-1,-1,-1,-1},
-{243,244,-1,-1,-1,-1,-1,-1,-1},
-{244,245,-1,-1,-1,-1,-1,-1,-1},
-{245,246,-1,-1,-1,-1,-1,-1,-1},
-{246,247,-1,-1,-1,-1,-1,-1,-1},
-{247,248,-1,-1,-1,-1,-1,-1,-1},
-{248,249,-1,-1,-1,-1,-1,-1,-1},
-{249,250,-1,-1,-1,-1,-1,-1,-1},
-{250,251,-1,-1,-1,-1,-1,-1,-1},
-{251,252,-1,-1,-1,-1,-1,-1,-1},
-{252,253,-1,-1,-1,-1,-1,-1,-1},
-{253,254,-1,-1,-1,-1,-1,-1,-1},
-{254,255,-1,-1,-1,-1,-1,-1,-1},
-{255,256,-1,-1,-1,-1,-1,-1,-1},
-{256,257,-1,-1,-1,-1,-1,-1,-1},
-{257,258,-1,-1,-1,-1,-1,-1,-1},
-{258,259,-1,-1,-1,-1,-1,-1,-1},
-{259,260,-1,-1,-1,-1,-1,-1,-1},
-{260,261,-1,-1,-1,-1,-1,-1,-1},
-{261,262,-1,-1,-1,-1,-1,-1,-1},
-{262,263,-1,-1,-1,-1,-1,-1,-1},
-{263,264,-1,-1,-1,-1,-1,-1,-1},
-{264,265,-1,-1,-1,-1,-1,-1,-1},
-{265,266,-1,-1,-1,-1,-1,-1,-1},
-{266,267,-1,-1,-1,-1,-1,-1,-1},
-{267,268,-1,-1,-1,-1,-1,-1,-1},
-{268,269,-1,-1,-1,-1,-1,-1,-1},
-{269,270,-1,-1,-1,-1,-1,-1,-1},
-{270,271,-1,-1,-1,-1,-1,-1,-1},
-{271,272,-1,-1,-1,-1,-1,-1,-1},
-{272,273,-1,-1,-1,-1,-1,-1,-1},
-{273,274,-1,-1,-1,-1,-1,-1,-1},
-{274,275,-1,-1,-1,-1,-1,-1,-1},
-{275,276,-1,-1,-1,-1,-1,-1,-1},
-{276,277,-1,-1,-1,-1,-1,-1,-1},
-{277,278,-1,-1,-1,-1,-1,-1,-1},
-{278,279,-1,-1,-1,-1,-1,-1,-1},
-{279,280,-1,-1,-1,-1,-1,-1,-1},
-{280,281,-1,-1,-1,-1,-1,-1,-1},
-{281,282,-1,-1,-1,-1,-1,-1,-1},
-{282,283,-1,-1,-1,-1,-1,-1,-1},
-{283,284,-1,-1,-1,-1,-1,-1,-1},
-{284,285,-1,-1,-1,-1,-1,-1,-1},
-{285,286,-1,-1,-1,-1,-1,-1,-1},
-{286,287,-1,-1,-1,-1,-1,-1,-1},
-{287,288,-1,-1,-1,-1,-1,-1,-1},
-{288,289,-1,-1,-1,-1,-1,-1,-1},
-{289,290,-1,-1,-1,-1,-1,-1,-1},
-{290,291,-1,-1,-1,-1,-1,-1,-1},
-{291,292,-1,-1,-1,-1,-1,-1,-1},
-{292,293,-1,-1,-1,-1,-1,-1,-1},
-{293,294,-1,-1,-1,-1,-1,-1,-1},
-{294,295,-1,-1,-1,-1,-1,-1,-1},
-{295,296,-1,-1,-1,-1,-1,-1,-1},
-{296,297,-1,-1,-1,-1,-1,-1,-1},
-{297,298,-1,-1,-1,-1,-1,-1,-1},
-{298,299,-1,-1,-1,-1,-1,-1,-1},
-{299,300,-1,-1,-1,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1,-1,-1,-1},
-{301,302,-1,-1,-1,-1,-1,-1,-1},
-{302,303,-1,-1,-1,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1,-1,-1,-1},
-{304,305,-1,-1,-1,-1,-1,-1,-1},
-{305,306,-1,-1,-1,-1,-1,-1,-1},
-{306,307,-1,-1,-1,-1,-1,-1,-1},
-{307,308,-1,-1,-1,-1,-1,-1,-1},
-{308,309,-1,-1,-1,-1,-1,-1,-1},
-{309,310,-1,-1,-1,-1,-1,-1,-1},
-{310,311,-1,-1,-1,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1,-1,-1,-1},
-{312,313,-1,-1,-1,-1,-1,-1,-1},
-{313,314,-1,-1,-1,-1,-1,-1,-1},
-{314,315,-1,-1,-1,-1,-1,-1,-1},
-{315,316,-1,-1,-1,-1,-1,-1,-1},
-{316,317,-1,-1,-1,-1,-1,-1,-1},
-{317,318,-1,-1,-1,-1,-1,-1,-1},
-{318,319,-1,-1,-1,-1,-1,-1,-1},
-{319,320,-1,-1,-1,-1,-1,-1,-1},
-{320,321,-1,-1,-1,-1,-1,-1,-1},
-{321,322,-1,-1,-1,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1,-1,-1,-1},
-{323,324,-1,-1,-1,-1,-1,-1,-1},
-{324,325,-1,-1,-1,-1,-1,-1,-1},
-{325,326,-1,-1,-1,-1,-1,-1,-1},
-{326,327,-1,-1,-1,-1,-1,-1,-1},
-{327,328,-1,-1,-1,-1,-1,-1,-1},
-{328,329,-1,-1,-1,-1,-1,-1,-1},
-{329,330,-1,-1,-1,-1,-1,-1,-1},
-{330,331,-1,-1,-1,-1,-1,-1,-1},
-{331,332,-1,-1,-1,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1,-1,-1,-1},
-{333,334,-1,-1,-1,-1,-1,-1,-1},
-{334,335,-1,-1,-1,-1,-1,-1,-1},
-{335,336,-1,-1,-1,-1,-1,-1,-1},
-{336,337,-1,-1,-1,-1,-1,-1,-1},
-{337,338,-1,-1,-1,-1,-1,-1,-1},
-{338,339,-1,-1,-1,-1,-1,-1,-1},
-{339,340,-1,-1,-1,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1,-1,-1,-1},
-{341,342,-1,-1,-1,-1,-1,-1,-1},
-{342,343,-1,-1,-1,-1,-1,-1,-1},
-{343,344,-1,-1,-1,-1,-1,-1,-1},
-{344,345,-1,-1,-1,-1,-1,-1,-1},
-{345,346,-1,-1,-1,-1,-1,-1,-1},
-{346,347,-1,-1,-1,-1,-1,-1,-1},
-{347,348,-1,-1,-1,-1,-1,-1,-1},
-{348,349,-1,-1,-1,-1,-1,-1,-1},
-{349,350,-1,-1,-1,-1,-1,-1,-1},
-{350,351,-1,-1,-1,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1,-1,-1,-1},
-{352,353,-1,-1,-1,-1,-1,-1,-1},
-{353,354,-1,-1,-1,-1,-1,-1,-1},
-{354,355,-1,-1,-1,-1,-1,-1,-1},
-{355,356,-1,-1,-1,-1,-1,-1,-1},
-{356,357,-1,-1,-1,-1,-1,-1,-1},
-{357,358,-1,-1,-1,-1,-1,-1,-1},
-{358,359,-1,-1,-1,-1,-1,-1,-1},
-{359,360,-1,-1,-1,-1,-1,-1,-1},
-{360,361,-1,-1,-1,-1,-1,-1,-1},
-{361,362,-1,-1,-1,-1,-1,-1,-1},
-{362,363,-1,-1,-1,-1,-1,-1,-1},
-{363,364,-1,-1,-1,-1,-1,-1,-1},
-{364,365,-1,-1,-1,-1,-1,-1,-1},
-{365,366,-1,-1,-1,-1,-1,-1,-1},
-{366,367,-1,-1,-1,-1,-1,-1,-1},
-{367,368,-1,-1,-1,-1,-1,-1,-1},
-{368,369,-1,-1,-1,-1,-1,-1,-1},
-{369,370,-1,-1,-1,-1,-1,-1,-1},
-{370,371,-1,-1,-1,-1,-1,-1,-1},
-{371,372,-1,-1,-1,-1,-1,-1,-1},
-{372,373,-1,-1,-1,-1,-1,-1,-1},
-{373,374,-1,-1,-1,-1,-1,-1,-1},
-{374,375,-1,-1,-1,-1,-1,-1,-1},
-{375,376,-1,-1,-1,-1,-1,-1,-1},
-{376,377,-1,-1,-1,-1,-1,-1,-1},
-{377,378,-1,-1,-1,-1,-1,-1,-1},
-{378,379,-1,-1,-1,-1,-1,-1,-1},
-{379,380,-1,-1,-1,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1,-1,-1,-1},
-{381,382,-1,-1,-1,-1,-1,-1,-1},
-{382,383,-1,-1,-1,-1,-1,-1,-1},
-{383,384,-1,-1,-1,-1,-1,-1,-1},
-{384,385,-1,-1,-1,-1,-1,-1,-1},
-{385,386,-1,-1,-1,-1,-1,-1,-1},
-{386,387,-1,-1,-1,-1,-1,-1,-1},
-{387,388,-1,-1,-1,-1,-1,-1,-1},
-{388,389,-1,-1,-1,-1,-1,-1,-1},
-{389,390,-1,-1,-1,-1,-1,-1,-1},
-{390,391,-1,-1,-1,-1,-1,-1,-1},
-{391,392,-1,-1,-1,-1,-1,-1,-1},
-{392,393,-1,-1,-1,-1,-1,-1,-1},
-{393,394,-1,-1,-1,-1,-1,-1,-1},
-{394,395,-1,-1,-1,-1,-1,-1,-1},
-{395,396,-1,-1,-1,-1,-1,-1,-1},
-{396,397,-1,-1,-1,-1,-1,-1,-1},
-{397,398,-1,-1,-1,-1,-1,-1,-1},
-{398,399,-1,-1,-1,-1,-1,-1,-1},
-{399,400,-1,-1,-1,-1,-1,-1,-1},
-{400,401,-1,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1,-1},
-{402,403,-1,-1,-1,-1,-1,-1,-1},
-{403,404,-1,-1,-1,-1,-1,-1,-1},
-{404,405,-1,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1,-1},
-{406,407,-1,-1,-1,-1,-1,-1,-1},
-{407,408,-1,-1,-1,-1,-1,-1,-1},
-{408,409,-1,-1,-1,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1,-1},
-{410,411,-1,-1,-1,-1,-1,-1,-1},
-{411,412,-1,-1,-1,-1,-1,-1,-1},
-{412,413,-1,-1,-1,-1,-1,-1,-1},
-{413,414,-1,-1,-1,-1,-1,-1,-1},
-{414,415,-1,-1,-1,-1,-1,-1,-1},
-{415,416,-1,-1,-1,-1,-1,-1,-1},
-{416,417,-1,-1,-1,-1,-1,-1,-1},
-{417,418,-1,-1,-1,-1,-1,-1,-1},
-{418,419,-1,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1,-1},
-{420,421,-1,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1,-1},
-{422,423,-1,-1,-1,-1,-1,-1,-1},
-{423,424,-1,-1,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1,-1},
-{425,426,-1,-1,-1,-1,-1,-1,-1},
-{426,427,-1,-1,-1,-1,-1,-1,-1},
-{427,428,-1,-1,-1,-1,-1,-1,-1},
-{428,429,-1,-1,-1,-1,-1,-1,-1},
-{429,430,-1,-1,-1,-1,-1,-1,-1},
-{430,431,-1,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1,-1},
-{432,433,-1,-1,-1,-1,-1,-1,-1},
-{433,434,-1,-1,-1,-1,-1,-1,-1},
-{434,435,-1,-1,-1,-1,-1,-1,-1},
-{435,436,-1,-1,-1,-1,-1,-1,-1},
-{436,437,-1,-1,-1,-1,-1,-1,-1},
-{437,438,-1,-1,-1,-1,-1,-1,-1},
-{438,439,-1,-1,-1,-1,-1,-1,-1},
-{439,440,-1,-1,-1,-1,-1,-1,-1},
-{440,441,-1,-1,-1,-1,-1,-1,-1},
-{441,442,-1,-1,-1,-1,-1,-1,-1},
-{442,443,-1,-1,-1,-1,-1,-1,-1},
-{443,444,-1,-1,-1,-1,-1,-1,-1},
-{444,445,-1,-1,-1,-1,-1,-1,-1},
-{445,446,-1,-1,-1,-1,-1,-1,-1},
-{446,447,-1,-1,-1,-1,-1,-1,-1},
-{447,448,-1,-1,-1,-1,-1,-1,-1},
-{448,449,-1,-1,-1,-1,-1,-1,-1},
-{449,450,-1,-1,-1,-1,-1,-1,-1},
-{450,451,-1,-1,-1,-1,-1,-1,-1},
-{451,452,-1,-1,-1,-1,-1,-1,-1},
-{452,453,-1,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1,-1},
-{454,455,-1,-1,-1,-1,-1,-1,-1},
-{455,456,-1,-1,-1,-1,-1,-1,-1},
-{456,457,-1,-1,-1,-1,-1,-1,-1},
-{457,458,-1,-1,-1,-1,-1,-1,-1},
-{458,459,-1,-1,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1,-1},
-{460,461,-1,-1,-1,-1,-1,-1,-1},
-{461,462,-1,-1,-1,-1,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1,-1},
-{463,464,-1,-1,-1,-1,-1,-1,-1},
-{464,465,-1,-1,-1,-1,-1,-1,-1},
-{465,466,-1,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1,-1},
-{467,468,-1,-1,-1,-1,-1,-1,-1},
-{468,469,-1,-1,-1,-1,-1,-1,-1},
-{469,470,-1,-1,-1,-1,-1,-1,-1},
-{470,471,-1,-1,-1,-1,-1,-1,-1},
-{471,472,-1,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1,-1},
-{473,474,-1,-1,-1,-1,-1,-1,-1},
-{474,475,-1,-1,-1,-1,-1,-1,-1},
-{475,476,-1,-1,-1,-1,-1,-1,-1},
-{476,477,-1,-1,-1,-1,-1,-1,-1},
-{477,478,-1,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1,-1},
-{480,481,-1,-1,-1,-1,-1,-1,-1},
-{481,482,-1,-1,-1,-1,-1,-1,-1},
-{482,483,-1,-1,-1,-1,-1,-1,-1},
-{483,484,-1,-1,-1,-1,-1,-1,-1},
-{484,485,-1,-1,-1,-1,-1,-1,-1},
-{485,486,-1,-1,-1,-1,-1,-1,-1},
-{486,487,-1,-1,-1,-1,-1,-1,-1},
-{487,488,-1,-1,-1,-1,-1,-1,-1},
-{488,489,-1,-1,-1,-1,-1,-1,-1},
-{489,490,-1,-1,-1,-1,-1,-1,-1},
-{490,491,-1,-1,-1,-1,-1,-1,-1},
-{491,492,-1,-1,-1,-1,-1,-1,-1},
-{492,493,-1,-1,-1,-1,-1,-1,-1},
-{493,494,-1,-1,-1,-1,-1,-1,-1},
-{494,495,-1,-1,-1,-1,-1,-1,-1},
-{495,496,-1,-1,-1,-1,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1,-1},
-{497,498,-1,-1,-1,-1,-1,-1,-1},
-{498,499,-1,-1,-1,-1,-1,-1,-1},
-{499,500,-1,-1,-1,-1,-1,-1,-1},
-{500,501,-1,-1,-1,-1,-1,-1,-1},
-{501,502,-1,-1,-1,-1,-1,-1,-1},
-{502,503,-1,-1,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1,-1},
-{504,505,-1,-1,-1,-1,-1,-1,-1},
-{505,506,-1,-1,-1,-1,-1,-1,-1},
-{506,507,-1,-1,-1,-1,-1,-1,-1},
-{507,508,-1,-1,-1,-1,-1,-1,-1},
-{508,509,-1,-1,-1,-1,-1,-1,-1},
-{509,510,-1,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1,-1},
-{512,513,-1,-1,-1,-1,-1,-1,-1},
-{513,514,-1,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1,-1},
-{515,516,-1,-1,-1,-1,-1,-1,-1},
-{516,517,-1,-1,-1,-1,-1,-1,-1},
-{517,518,-1,-1,-1,-1,-1,-1,-1},
-{518,519,-1,-1,-1,-1,-1,-1,-1},
-{519,520,-1,-1,-1,-1,-1,-1,-1},
-{520,521,-1,-1,-1,-1,-1,-1,-1},
-{521,522,-1,-1,-1,-1,-1,-1,-1},
-{522,523,-1,-1,-1,-1,-1,-1,-1},
-{523,524,-1,-1,-1,-1,-1,-1,-1},
-{524,525,-1,-1,-1,-1,-1,-1,-1},
-{525,526,-1,-1,-1,-1,-1,-1,-1},
-{526,527,-1,-1,-1,-1,-1,-1,-1},
-{527,528,-1,-1,-1,-1,-1,-1,-1},
-{528,529,-1,-1,-1,-1,-1,-1,-1},
-{529,530,-1,-1,-1,-1,-1,-1,-1},
-{530,531,-1,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1,-1},
-{532,533,-1,-1,-1,-1,-1,-1,-1},
-{533,534,-1,-1,-1,-1,-1,-1,-1},
-{534,535,-1,-1,-1,-1,-1,-1,-1},
-{535,536,-1,-1,-1,-1,-1,-1,-1},
-{536,537,-1,-1,-1,-1,-1,-1,-1},
-{537,538,-1,-1,-1,-1,-1,-1,-1},
-{538,539,-1,-1,-1,-1,-1,-1,-1},
-{539,540,-1,-1,-1,-1,-1,-1,-1},
-{540,541,-1,-1,-1,-1,-1,-1,-1},
-{541,542,-1,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1,-1},
-{543,544,-1,-1,-1,-1,-1,-1,-1},
-{544,545,-1,-1,-1,-1,-1,-1,-1},
-{545,546,-1,-1,-1,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1,-1},
-{547,548,-1,-1,-1,-1,-1,-1,-1},
-{548,549,-1,-1,-1,-1,-1,-1,-1},
-{549,550,-1,-1,-1,-1,-1,-1,-1},
-{550,551,-1,-1,-1,-1,-1,-1,-1},
-{551,552,-1,-1,-1,-1,-1,-1,-1},
-{552,553,-1,-1,-1,-1,-1,-1,-1},
-{553,554,-1,-1,-1,-1,-1,-1,-1},
-{554,555,-1,-1,-1,-1,-1,-1,-1},
-{555,556,-1,-1,-1,-1,-1,-1,-1},
-{556,557,-1,-1,-1,-1,-1,-1,-1},
-{557,558,-1,-1,-1,-1,-1,-1,-1},
-{558,559,-1,-1,-1,-1,-1,-1,-1},
-{559,560,-1,-1,-1,-1,-1,-1,-1},
-{560,561,-1,-1,-1,-1,-1,-1,-1},
-{561,562,-1,-1,-1,-1,-1,-1,-1},
-{562,563,-1,-1,-1,-1,-1,-1,-1},
-{563,564,-1,-1,-1,-1,-1,-1,-1},
-{564,565,-1,-1,-1,-1,-1,-1,-1},
-{565,566,-1,-1,-1,-1,-1,-1,-1},
-{566,567,-1,-1,-1,-1,-1,-1,-1},
-{567,568,-1,-1,-1,-1,-1,-1,-1},
-{568,569,-1,-1,-1,-1,-1,-1,-1},
-{569,570,-1,-1,-1,-1,-1,-1,-1},
-{570,571,-1,-1,-1,-1,-1,-1,-1},
-{571,572,-1,-1,-1,-1,-1,-1,-1},
-{572,573,-1,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1,-1},
-{574,575,-1,-1,-1,-1,-1,-1,-1},
-{575,576,-1,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1,-1},
-{578,579,-1,-1,-1,-1,-1,-1,-1},
-{579,580,-1,-1,-1,-1,-1,-1,-1},
-{580,581,-1,-1,-1,-1,-1,-1,-1},
-{581,582,-1,-1,-1,-1,-1,-1,-1},
-{582,583,-1,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1,-1},
-{584,585,-1,-1,-1,-1,-1,-1,-1},
-{585,586,-1,-1,-1,-1,-1,-1,-1},
-{586,587,-1,-1,-1,-1,-1,-1,-1},
-{587,588,-1,-1,-1,-1,-1,-1,-1},
-{588,589,-1,-1,-1,-1,-1,-1,-1},
-{589,590,-1,-1,-1,-1,-1,-1,-1},
-{590,591,-1,-1,-1,-1,-1,-1,-1},
-{591,592,-1,-1,-1,-1,-1,-1,-1},
-{592,593,-1,-1,-1,-1,-1,-1,-1},
-{593,594,-1,-1,-1,-1,-1,-1,-1},
-{594,595,-1,-1,-1,-1,-1,-1,-1},
-{595,596,-1,-1,-1,-1,-1,-1,-1},
-{596,597,-1,-1,-1,-1,-1,-1,-1},
-{597,598,-1,-1,-1,-1,-1,-1,-1},
-{598,599,-1,-1,-1,-1,-1,-1,-1},
-{599,600,-1,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1,-1},
-{601,602,-1,-1,-1,-1,-1,-1,-1},
-{602,603,-1,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1,-1},
-{605,606,-1,-1,-1,-1,-1,-1,-1},
-{606,607,-1,-1,-1,-1,-1,-1,-1},
-{607,608,-1,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1,-1},
-{609,610,-1,-1,-1,-1,-1,-1,-1},
-{610,611,-1,-1,-1,-1,-1,-1,-1},
-{611,612,-1,-1,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1,-1},
-{613,614,-1,-1,-1,-1,-1,-1,-1},
-{614,615,-1,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1,-1},
-{617,618,-1,-1,-1,-1,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1,-1},
-{619,620,-1,-1,-1,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1,-1},
-{621,622,-1,-1,-1,-1,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1,-1},
-{623,624,-1,-1,-1,-1,-1,-1,-1},
-{624,625,-1,-1,-1,-1,-1,-1,-1},
-{625,626,-1,-1,-1,-1,-1,-1,-1},
-{626,627,-1,-1,-1,-1,-1,-1,-1},
-{627,628,-1,-1,-1,-1,-1,-1,-1},
-{628,629,-1,-1,-1,-1,-1,-1,-1},
-{629,630,-1,-1,-1,-1,-1,-1,-1},
-{630,631,-1,-1,-1,-1,-1,-1,-1},
-{631,632,-1,-1,-1,-1,-1,-1,-1},
-{632,633,-1,-1,-1,-1,-1,-1,-1},
-{633,634,-1,-1,-1,-1,-1,-1,-1},
-{634,635,-1,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1,-1},
-{636,637,-1,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1,-1},
-{638,639,-1,-1,-1,-1,-1,-1,-1},
-{639,640,-1,-1,-1,-1,-1,-1,-1},
-{640,641,-1,-1,-1,-1,-1,-1,-1},
-{641,642,-1,-1,-1,-1,-1,-1,-1},
-{642,643,-1,-1,-1,-1,-1,-1,-1},
-{643,644,-1,-1,-1,-1,-1,-1,-1},
-{644,645,-1,-1,-1,-1,-1,-1,-1},
-{645,646,-1,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1,-1},
-{647,648,-1,-1,-1,-1,-1,-1,-1},
-{648,649,-1,-1,-1,-1,-1,-1,-1},
-{649,650,-1,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1,-1},
-{651,652,-1,-1,-1,-1,-1,-1,-1},
-{652,653,-1,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1,-1},
-{655,656,-1,-1,-1,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1,-1},
-{657,658,-1,-1,-1,-1,-1,-1,-1},
-{658,659,-1,-1,-1,-1,-1,-1,-1},
-{659,660,-1,-1,-1,-1,-1,-1,-1},
-{660,661,-1,-1,-1,-1,-1,-1,-1},
-{661,662,-1,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1,-1},
-{663,664,-1,-1,-1,-1,-1,-1,-1},
-{664,665,-1,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1,-1},
-{667,668,-1,-1,-1,-1,-1,-1,-1},
-{668,669,-1,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1,-1},
-{670,671,-1,-1,-1,-1,-1,-1,-1},
-{671,672,-1,-1,-1,-1,-1,-1,-1},
-{672,673,-1,-1,-1,-1,-1,-1,-1},
-{673,674,-1,-1,-1,-1,-1,-1,-1},
-{674,675,-1,-1,-1,-1,-1,-1,-1},
-{675,676,-1,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1,-1},
-{677,678,-1,-1,-1,-1,-1,-1,-1},
-{678,679,-1,-1,-1,-1,-1,-1,-1},
-{679,680,-1,-1,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1,-1},
-{681,682,-1,-1,-1,-1,-1,-1,-1},
-{682,683,-1,-1,-1,-1,-1,-1,-1},
-{683,684,-1,-1,-1,-1,-1,-1,-1},
-{684,685,-1,-1,-1,-1,-1,-1,-1},
-{685,686,-1,-1,-1,-1,-1,-1,-1},
-{686,687,-1,-1,-1,-1,-1,-1,-1},
-{687,688,-1,-1,-1,-1,-1,-1,-1},
-{688,689,-1,-1,-1,-1,-1,-1,-1},
-{689,690,-1,-1,-1,-1,-1,-1,-1},
-{690,691,-1,-1,-1,-1,-1,-1,-1},
-{691,692,-1,-1,-1,-1,-1,-1,-1},
-{692,693,-1,-1,-1,-1,-1,-1,-1},
-{693,694,-1,-1,-1,-1,-1,-1,-1},
-{694,695,-1,-1,-1,-1,-1,-1,-1},
-{695,696,-1,-1,-1,-1,-1,-1,-1},
-{696,697,-1,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1,-1},
-{699,700,-1,-1,-1,-1,-1,-1,-1},
-{700,701,-1,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1,-1},
-{702,703,-1,-1,-1,-1,-1,-1,-1},
-{703,704,-1,-1,-1,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1,-1},
-{705,706,-1,-1,-1,-1,-1,-1,-1},
-{706,707,-1,-1,-1,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1,-1},
-{708,709,-1,-1,-1,-1,-1,-1,-1},
-{709,710,-1,-1,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1,-1},
-{711,712,-1,-1,-1,-1,-1,-1,-1},
-{712,713,-1,-1,-1,-1,-1,-1,-1},
-{713,714,-1,-1,-1,-1,-1,-1,-1},
-{714,715,-1,-1,-1,-1,-1,-1,-1},
-{715,716,-1,-1,-1,-1,-1,-1,-1},
-{716,717,-1,-1,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1,-1},
-{718,719,-1,-1,-1,-1,-1,-1,-1},
-{719,720,-1,-1,-1,-1,-1,-1,-1},
-{720,721,-1,-1,-1,-1,-1,-1,-1},
-{721,722,-1,-1,-1,-1,-1,-1,-1},
-{722,723,-1,-1,-1,-1,-1,-1,-1},
-{723,724,-1,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1,-1},
-{725,726,-1,-1,-1,-1,-1,-1,-1},
-{726,727,-1,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1,-1},
-{730,731,-1,-1,-1,-1,-1,-1,-1},
-{731,732,-1,-1,-1,-1,-1,-1,-1},
-{732,733,-1,-1,-1,-1,-1,-1,-1},
-{733,734,-1,-1,-1,-1,-1,-1,-1},
-{734,735,-1,-1,-1,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1,-1},
-{736,737,-1,-1,-1,-1,-1,-1,-1},
-{737,738,-1,-1,-1,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1,-1},
-{739,740,-1,-1,-1,-1,-1,-1,-1},
-{740,741,-1,-1,-1,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1,-1},
-{742,743,-1,-1,-1,-1,-1,-1,-1},
-{743,744,-1,-1,-1,-1,-1,-1,-1},
-{744,745,-1,-1,-1,-1,-1,-1,-1},
-{745,746,-1,-1,-1,-1,-1,-1,-1},
-{746,747,-1,-1,-1,-1,-1,-1,-1},
-{747,748,-1,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1,-1},
-{749,750,-1,-1,-1,-1,-1,-1,-1},
-{750,751,-1,-1,-1,-1,-1,-1,-1},
-{751,752,-1,-1,-1,-1,-1,-1,-1},
-{752,753,-1,-1,-1,-1,-1,-1,-1},
-{753,754,-1,-1,-1,-1,-1,-1,-1},
-{754,755,-1,-1,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1,-1},
-{756,757,-1,-1,-1,-1,-1,-1,-1},
-{757,758,-1,-1,-1,-1,-1,-1,-1},
-{758,759,-1,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1,-1},
-{760,761,-1,-1,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1,-1},
-{762,763,-1,-1,-1,-1,-1,-1,-1},
-{763,764,-1,-1,-1,-1,-1,-1,-1},
-{764,765,-1,-1,-1,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1,-1},
-{766,767,-1,-1,-1,-1,-1,-1,-1},
-{767,768,-1,-1,-1,-1,-1,-1,-1},
-{768,769,-1,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1,-1},
-{770,771,-1,-1,-1,-1,-1,-1,-1},
-{771,772,-1,-1,-1,-1,-1,-1,-1},
-{772,773,-1,-1,-1,-1,-1,-1,-1},
-{773,774,-1,-1,-1,-1,-1,-1,-1},
-{774,775,-1,-1,-1,-1,-1,-1,-1},
-{775,776,-1,-1,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1,-1},
-{777,778,-1,-1,-1,-1,-1,-1,-1},
-{778,779,-1,-1,-1,-1,-1,-1,-1},
-{779,780,-1,-1,-1,-1,-1,-1,-1},
-{780,781,-1,-1,-1,-1,-1,-1,-1},
-{781,782,-1,-1,-1,-1,-1,-1,-1},
-{782,783,-1,-1,-1,-1,-1,-1,-1},
-{783,784,-1,-1,-1,-1,-1,-1,-1},
-{784,785,-1,-1,-1,-1,-1,-1,-1},
-{785,786,-1,-1,-1,-1,-1,-1,-1},
-{786,787,-1,-1,-1,-1,-1,-1,-1},
-{787,788,-1,-1,-1,-1,-1,-1,-1},
-{788,789,-1,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1,-1},
-{792,793,-1,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1,-1},
-{794,795,-1,-1,-1,-1,-1,-1,-1},
-{795,796,-1,-1,-1,-1,-1,-1,-1},
-{796,797,-1,-1,-1,-1,-1,-1,-1},
-{797,798,-1,-1,-1,-1,-1,-1,-1},
-{798,799,-1,-1,-1,-1,-1,-1,-1},
-{799,800,-1,-1,-1,-1,-1,-1,-1},
-{800,801,-1,-1,-1,-1,-1,-1,-1},
-{801,802,-1,-1,-1,-1,-1,-1,-1},
-{802,803,-1,-1,-1,-1,-1,-1,-1},
-{803,804,-1,-1,-1,-1,-1,-1,-1},
-{804,805,-1,-1,-1,-1,-1,-1,-1},
-{805,806,-1,-1,-1,-1,-1,-1,-1},
-{806,807,-1,-1,-1,-1,-1,-1,-1},
-{807,808,-1,-1,-1,-1,-1,-1,-1},
-{808,809,-1,-1,-1,-1,-1,-1,-1},
-{809,810,-1,-1,-1,-1,-1,-1,-1},
-{810,811,-1,-1,-1,-1,-1,-1,-1},
-{811,812,-1,-1,-1,-1,-1,-1,-1},
-{812,813,-1,-1,-1,-1,-1,-1,-1},
-{813,814,-1,-1,-1,-1,-1,-1,-1},
-{814,815,-1,-1,-1,-1,-1,-1,-1},
-{815,816,-1,-1,-1,-1,-1,-1,-1},
-{816,817,-1,-1,-1,-1,-1,-1,-1},
-{817,818,-1,-1,-1,-1,-1,-1,-1},
-{818,819,-1,-1,-1,-1,-1,-1,-1},
-{819,820,-1,-1,-1,-1,-1,-1,-1},
-{820,821,-1,-1,-1,-1,-1,-1,-1},
-{821,822,-1,-1,-1,-1,-1,-1,-1},
-{822,823,-1,-1,-1,-1,-1,-1,-1},
-{823,824,-1,-1,-1,-1,-1,-1,-1},
-{824,825,-1,-1,-1,-1,-1,-1,-1},
-{825,826,-1,-1,-1,-1,-1,-1,-1},
-{826,827,-1,-1,-1,-1,-1,-1,-1},
-{827,828,-1,-1,-1,-1,-1,-1,-1},
-{828,829,-1,-1,-1,-1,-1,-1,-1},
-{829,830,-1,-1,-1,-1,-1,-1,-1},
-{830,831,-1,-1,-1,-1,-1,-1,-1},
-{831,832,-1,-1,-1,-1,-1,-1,-1},
-{832,833,-1,-1,-1,-1,-1,-1,-1},
-{833,834,-1,-1,-1,-1,-1,-1,-1},
-{834,835,-1,-1,-1,-1,-1,-1,-1},
-{835,836,-1,-1,-1,-1,-1,-1,-1},
-{836,837,-1,-1,-1,-1,-1,-1,-1},
-{837,838,-1,-1,-1,-1,-1,-1,-1},
-{838,839,-1,-1,-1,-1,-1,-1,-1},
-{839,840,-1,-1,-1,-1,-1,-1,-1},
-{840,841,-1,-1,-1,-1,-1,-1,-1},
-{841,842,-1,-1,-1,-1,-1,-1,-1},
-{842,843,-1,-1,-1,-1,-1,-1,-1},
-{843,844,-1,-1,-1,-1,-1,-1,-1},
-{844,845,-1,-1,-1,-1,-1,-1,-1},
-{845,846,-1,-1,-1,-1,-1,-1,-1},
-{846,847,-1,-1,-1,-1,-1,-1,-1},
-{847,848,-1,-1,-1,-1,-1,-1,-1},
-{848,849,-1,-1,-1,-1,-1,-1,-1},
-{849,850,-1,-1,-1,-1,-1,-1,-1},
-{850,851,-1,-1,-1,-1,-1,-1,-1},
-{851,852,-1,-1,-1,-1,-1,-1,-1},
-{852,853,-1,-1,-1,-1,-1,-1,-1},
-{853,854,-1,-1,-1,-1,-1,-1,-1},
-{854,855,-1,-1,-1,-1,-1,-1,-1},
-{855,856,-1,-1,-1,-1,-1,-1,-1},
-{856,857,-1,-1,-1,-1,-1,-1,-1},
-{857,858,-1,-1,-1,-1,-1,-1,-1},
-{858,859,-1,-1,-1,-1,-1,-1,-1},
-{859,860,-1,-1,-1,-1,-1,-1,-1},
-{860,861,-1,-1,-1,-1,-1,-1,-1},
-{861,862,-1,-1,-1,-1,-1,-1,-1},
-{862,863,-1,-1,-1,-1,-1,-1,-1},
-{863,864,-1,-1,-1,-1,-1,-1,-1},
-{864,865,-1,-1,-1,-1,-1,-1,-1},
-{865,866,-1,-1,-1,-1,-1,-1,-1},
-{866,867,-1,-1,-1,-1,-1,-1,-1},
-{867,868,-1,-1,-1,-1,-1,-1,-1},
-{868,869,-1,-1,-1,-1,-1,-1,-1},
-{869,870,-1,-1,-1,-1,-1,-1,-1},
-{870,871,-1,-1,-1,-1,-1,-1,-1},
-{871,872,-1,-1,-1,-1,-1,-1,-1},
-{872,873,-1,-1,-1,-1,-1,-1,-1},
-{873,874,-1,-1,-1,-1,-1,-1,-1},
-{874,875,-1,-1,-1,-1,-1,-1,-1},
-{875,876,-1,-1,-1,-1,-1,-1,-1},
-{876,877,-1,-1,-1,-1,-1,-1,-1},
-{877,878,-1,-1,-1,-1,-1,-1,-1},
-{878,879,-1,-1,-1,-1,-1,-1,-1},
-{879,880,-1,-1,-1,-1,-1,-1,-1},
-{880,881,-1,-1,-1,-1,-1,-1,-1},
-{881,882,-1,-1,-1,-1,-1,-1,-1},
-{882,883,-1,-1,-1,-1,-1,-1,-1},
-{883,884,-1,-1,-1,-1,-1,-1,-1},
-{884,885,-1,-1,-1,-1,-1,-1,-1},
-{885,886,-1,-1,-1,-1,-1,-1,-1},
-{886,887,-1,-1,-1,-1,-1,-1,-1},
-{887,888,-1,-1,-1,-1,-1,-1,-1},
-{888,889,-1,-1,-1,-1,-1,-1,-1},
-{889,890,-1,-1,-1,-1,-1,-1,-1},
-{890,891,-1,-1,-1,-1,-1,-1,-1},
-{891,892,-1,-1,-1,-1,-1,-1,-1},
-{892,893,-1,-1,-1,-1,-1,-1,-1},
-{893,894,-1,-1,-1,-1,-1,-1,-1},
-{894,895,-1,-1,-1,-1,-1,-1,-1},
-{895,896,-1,-1,-1,-1,-1,-1,-1},
-{896,897,-1,-1,-1,-1,-1,-1,-1},
-{897,898,-1,-1,-1,-1,-1,-1,-1},
-{898,899,-1,-1,-1,-1,-1,-1,-1},
-{899,900,-1,-1,-1,-1,-1,-1,-1},
-{900,901,-1,-1,-1,-1,-1,-1,-1},
-{901,902,-1,-1,-1,-1,-1,-1,-1},
-{902,903,-1,-1,-1,-1,-1,-1,-1},
-{903,904,-1,-1,-1,-1,-1,-1,-1},
-{904,905,-1,-1,-1,-1,-1,-1,-1},
-{905,906,-1,-1,-1,-1,-1,-1,-1},
-{906,907,-1,-1,-1,-1,-1,-1,-1},
-{907,908,-1,-1,-1,-1,-1,-1,-1},
-{908,909,-1,-1,-1,-1,-1,-1,-1},
-{909,910,-1,-1,-1,-1,-1,-1,-1},
-{910,911,-1,-1,-1,-1,-1,-1,-1},
-{911,912,-1,-1,-1,-1,-1,-1,-1},
-{912,913,-1,-1,-1,-1,-1,-1,-1},
-{913,914,-1,-1,-1,-1,-1,-1,-1},
-{914,915,-1,-1,-1,-1,-1,-1,-1},
-{915,916,-1,-1,-1,-1,-1,-1,-1},
-{916,917,-1,-1,-1,-1,-1,-1,-1},
-{917,918,-1,-1,-1,-1,-1,-1,-1},
-{918,919,-1,-1,-1,-1,-1,-1,-1},
-{919,920,-1,-1,-1,-1,-1,-1,-1},
-{920,921,-1,-1,-1,-1,-1,-1,-1},
-{921,922,-1,-1,-1,-1,-1,-1,-1},
-{922,923,-1,-1,-1,-1,-1,-1,-1},
-{923,924,-1,-1,-1,-1,-1,-1,-1},
-{924,925,-1,-1,-1,-1,-1,-1,-1},
-{925,926,-1,-1,-1,-1,-1,-1,-1},
-{926,927,-1,-1,-1,-1,-1,-1,-1},
-{927,928,-1,-1,-1,-1,-1,-1,-1},
-{928,929,-1,-1,-1,-1,-1,-1,-1},
-{929,930,-1,-1,-1,-1,-1,-1,-1},
-{930,931,-1,-1,-1,-1,-1,-1,-1},
-{931,932,-1,-1,-1,-1,-1,-1,-1},
-{932,933,-1,-1,-1,-1,-1,-1,-1},
-{933,934,-1,-1,-1,-1,-1,-1,-1},
-{934,935,-1,-1,-1,-1,-1,-1,-1},
-{935,936,-1,-1,-1,-1,-1,-1,-1},
-{936,937,-1,-1,-1,-1,-1,-1,-1},
-{937,938,-1,-1,-1,-1,-1,-1,-1},
-{938,939,-1,-1,-1,-1,-1,-1,-1},
-{939,940,-1,-1,-1,-1,-1,-1,-1},
-{940,941,-1,-1,-1,-1,-1,-1,-1},
-{941,942,-1,-1,-1,-1,-1,-1,-1},
-{942,943,-1,-1,-1,-1,-1,-1,-1},
-{943,944,-1,-1,-1,-1,-1,-1,-1},
-{944,945,-1,-1,-1,-1,-1,-1,-1},
-{945,946,-1,-1,-1,-1,-1,-1,-1},
-{946,947,-1,-1,-1,-1,-1,-1,-1},
-{947,948,-1,-1,-1,-1,-1,-1,-1},
-{948,949,-1,-1,-1,-1,-1,-1,-1},
-{949,950,-1,-1,-1,-1,-1,-1,-1},
-{950,951,-1,-1,-1,-1,-1,-1,-1},
-{951,952,-1,-1,-1,-1,-1,-1,-1},
-{952,953,-1,-1,-1,-1,-1,-1,-1},
-{953,954,-1,-1,-1,-1,-1,-1,-1},
-{954,955,-1,-1,-1,-1,-1,-1,-1},
-{955,956,-1,-1,-1,-1,-1,-1,-1},
-{956,957,-1,-1,-1,-1,-1,-1,-1},
-{957,958,-1,-1,-1,-1,-1,-1,-1},
-{958,959,-1,-1,-1,-1,-1,-1,-1},
-{959,960,-1,-1,-1,-1,-1,-1,-1},
-{960,961,-1,-1,-1,-1,-1,-1,-1},
-{961,962,-1,-1,-1,-1,-1,-1,-1},
-{962,963,-1,-1,-1,-1,-1,-1,-1},
-{963,964,-1,-1,-1,-1,-1,-1,-1},
-{964,965,-1,-1,-1,-1,-1,-1,-1},
-{965,966,-1,-1,-1,-1,-1,-1,-1},
-{966,967,-1,-1,-1,-1,-1,-1,-1},
-{967,968,-1,-1,-1,-1,-1,-1,-1},
-{968,969,-1,-1,-1,-1,-1,-1,-1},
-{969,970,-1,-1,-1,-1,-1,-1,-1},
-{970,971,-1,-1,-1,-1,-1,-1,-1},
-{971,972,-1,-1,-1,-1,-1,-1,-1},
-{972,973,-1,-1,-1,-1,-1,-1,-1},
-{973,974,-1,-1,-1,-1,-1,-1,-1},
-{974,975,-1,-1,-1,-1,-1,-1,-1},
-{975,976,-1,-1,-1,-1,-1,-1,-1},
-{976,977,-1,-1,-1,-1,-1,-1,-1},
-{977,978,-1,-1,-1,-1,-1,-1,-1},
-{978,979,-1,-1,-1,-1,-1,-1,-1},
-{979,980,-1,-1,-1,-1,-1,-1,-1},
-{980,981,-1,-1,-1,-1,-1,-1,-1},
-{981,982,-1,-1,-1,-1,-1,-1,-1},
-{982,983,-1,-1,-1,-1,-1,-1,-1},
-{983,984,-1,-1,-1,-1,-1,-1,-1},
-{984,985,-1,-1,-1,-1,-1,-1,-1},
-{985,986,-1,-1,-1,-1,-1,-1,-1},
-{986,987,-1,-1,-1,-1,-1,-1,-1},
-{987,988,-1,-1,-1,-1,-1,-1,-1},
-{988,989,-1,-1,-1,-1,-1,-1,-1},
-{989,990,-1,-1,-1,-1,-1,-1,-1},
-{990,991,-1,-1,-1,-1,-1,-1,-1},
-{991,992,-1,-1,-1,-1,-1,-1,-1},
-{992,993,-1,-1,-1,-1,-1,-1,-1},
-{993,994,-1,-1,-1,-1,-1,-1,-1},
-{994,995,-1,-1,-1,-1,-1,-1,-1},
-{995,996,-1,-1,-1,-1,-1,-1,-1},
-{996,997,-1,-1,-1,-1,-1,-1,-1},
-{997,998,-1,-1,-1,-1,-1,-1,-1},
-{998,999,-1,-1,-1,-1,-1,-1,-1},
-{999,-1,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_6_16=602;
+int mercury_normal_QCbase_6_16[5426]={
+1,0,3,246,468,916,
+1,0,6,78,296,386,572,883,951,
+1,192,8,23,37,100,605,846,883,941,964,
+1,0,8,215,274,287,478,601,738,857,984,
+1,0,9,68,276,284,454,464,605,799,875,932,
+1,0,5,34,402,848,884,975,
+1,963,7,83,120,130,374,466,877,932,
+1,0,7,46,139,282,681,829,837,852,
+1,0,6,322,383,434,549,667,855,
+1,0,7,305,309,382,546,551,709,746,
+1,0,5,37,123,302,830,993,
+1,0,9,238,263,271,401,583,590,636,754,906,
+1,986,7,18,310,407,560,739,860,873,
+1,0,7,4,80,179,295,310,775,968,
+1,0,6,9,63,473,575,663,812,
+1,0,9,176,241,335,593,597,642,654,838,953,
+1,0,3,337,771,813,
+1,0,4,373,658,668,758,
+1,0,3,25,269,726,
+1,174,7,18,294,375,594,630,848,912,
+1,0,7,192,359,377,599,717,784,906,
+1,0,9,37,312,477,478,576,586,804,851,926,
+1,0,8,115,321,340,576,623,676,896,946,
+1,0,4,222,286,736,933,
+1,0,3,2,335,800,
+1,0,6,378,499,668,706,713,862,
+1,0,3,58,425,790,
+1,0,5,53,178,282,814,930,
+1,0,6,150,154,251,626,927,943,
+1,0,7,49,362,435,576,652,789,804,
+1,0,5,95,232,596,724,862,
+1,59,9,39,243,311,498,515,648,780,873,969,
+1,0,9,98,429,443,465,516,573,805,864,927,
+1,0,7,5,730,768,782,854,859,906,
+1,0,3,178,532,844,
+1,0,6,30,51,163,442,603,955,
+1,20,5,291,337,603,826,882,
+1,0,5,311,527,655,734,891,
+1,0,8,15,97,135,231,313,391,532,835,
+1,0,4,367,491,691,894,
+1,0,3,265,337,646,
+1,0,6,87,91,101,205,438,734,
+1,0,8,63,160,161,277,299,408,750,820,
+1,0,6,56,559,740,743,891,904,
+1,0,7,131,459,561,581,583,794,826,
+1,0,3,232,740,917,
+1,0,4,3,179,666,823,
+1,0,6,317,398,558,719,725,886,
+1,0,5,141,364,413,550,624,
+1,0,9,173,239,244,450,563,708,728,737,823,
+1,0,7,1,660,801,833,836,980,983,
+1,0,4,318,395,820,898,
+1,0,7,164,540,662,692,790,880,897,
+1,0,6,55,83,142,558,739,792,
+1,0,8,143,356,377,427,541,762,925,944,
+1,792,4,389,539,640,785,
+1,911,4,181,251,430,937,
+1,0,4,92,647,767,772,
+1,0,8,5,55,266,472,555,672,755,847,
+1,0,9,11,96,120,252,366,482,567,826,843,
+1,0,3,207,371,448,
+1,0,7,230,389,576,674,700,742,974,
+1,0,3,109,796,966,
+1,153,9,0,48,116,217,311,415,551,644,796,
+1,0,9,153,305,317,516,518,745,784,795,897,
+1,0,5,81,222,235,547,781,
+1,0,9,72,120,320,337,659,748,769,773,868,
+1,0,8,253,269,469,672,684,850,933,948,
+1,0,5,253,271,449,758,766,
+1,0,7,621,666,679,703,840,888,899,
+1,221,3,145,371,804,
+1,0,3,366,598,709,
+1,0,7,270,335,473,588,604,635,671,
+1,0,6,26,341,405,524,612,784,
+1,0,9,190,430,431,462,598,619,624,671,681,
+1,381,3,113,544,817,
+1,0,3,494,818,980,
+1,0,9,11,37,202,238,256,315,445,489,949,
+1,0,7,173,424,641,698,726,798,916,
+1,0,9,106,209,236,238,379,419,432,771,897,
+1,0,7,545,717,782,801,877,941,955,
+1,801,4,355,430,750,966,
+1,866,4,156,425,529,656,
+1,0,4,22,427,432,475,
+1,0,7,198,232,338,536,558,639,787,
+1,0,6,8,315,414,634,852,959,
+1,0,4,214,634,644,862,
+1,0,6,152,229,549,870,885,929,
+1,0,4,43,260,328,405,
+1,862,9,201,256,275,428,435,576,666,899,965,
+1,0,9,63,190,277,512,555,565,921,931,976,
+1,4,6,3,73,325,327,656,777,
+1,0,6,7,20,271,369,886,996,
+1,775,7,260,314,481,538,706,909,922,
+1,0,7,35,101,291,324,469,601,874,
+1,0,6,63,303,397,398,719,948,
+1,299,5,83,118,466,644,758,
+1,0,5,382,412,549,702,780,
+1,0,4,149,592,643,968,
+1,0,3,602,801,921,
+1,0,5,96,308,743,796,814,
+1,0,7,247,249,323,399,565,777,814,
+1,0,6,494,602,713,719,868,955,
+1,0,7,245,246,493,566,744,847,907,
+1,0,9,133,283,444,482,617,708,731,753,803,
+1,0,7,222,262,296,505,509,545,825,
+1,0,3,45,68,572,
+1,0,5,462,668,894,913,969,
+1,0,4,112,299,369,429,
+1,0,8,146,149,232,384,661,666,849,935,
+1,0,9,66,112,241,343,445,492,547,560,917,
+1,940,3,112,787,881,
+1,0,3,52,343,818,
+1,0,4,425,469,493,516,
+1,0,7,71,220,311,438,585,725,927,
+1,0,5,17,263,552,619,712,
+1,0,8,83,260,547,549,667,731,871,905,
+1,0,6,75,275,309,544,792,802,
+1,0,7,7,20,118,592,807,880,949,
+1,0,8,76,201,286,308,641,670,674,961,
+1,34,9,134,228,240,369,473,516,623,880,955,
+1,951,9,168,181,229,236,288,327,449,500,821,
+1,0,9,119,390,445,461,468,672,726,752,980,
+1,0,7,352,659,713,746,760,865,888,
+1,0,6,109,199,201,487,701,880,
+1,0,8,8,133,175,335,698,879,940,998,
+1,0,4,670,766,771,953,
+1,0,7,162,274,626,656,661,874,901,
+1,0,3,321,847,966,
+1,0,6,13,79,189,229,653,875,
+1,0,7,116,345,364,405,700,766,833,
+1,0,9,140,276,488,650,786,787,801,905,913,
+1,0,7,21,81,187,254,453,533,759,
+1,0,4,74,192,205,537,
+1,0,9,257,294,356,431,443,547,581,640,685,
+1,0,3,825,838,846,
+1,0,4,33,243,474,978,
+1,0,8,3,67,138,182,407,436,594,744,
+1,604,4,633,695,806,928,
+1,92,4,237,395,784,920,
+1,0,4,329,469,473,519,
+1,353,7,10,219,319,623,625,794,875,
+1,0,7,363,402,409,417,477,501,658,
+1,0,4,315,387,548,777,
+1,0,8,14,151,235,248,337,864,929,972,
+1,0,4,8,424,596,971,
+1,0,8,29,91,439,643,728,865,875,958,
+1,0,7,17,238,367,493,629,684,945,
+1,0,3,595,734,920,
+1,0,6,136,180,209,473,524,973,
+1,0,9,128,167,393,439,456,611,636,665,750,
+1,0,6,315,468,485,555,610,724,
+1,0,4,34,169,747,768,
+1,0,3,342,357,577,
+1,0,9,40,192,236,294,402,451,872,919,932,
+1,0,5,346,489,651,889,890,
+1,0,6,89,408,422,794,809,957,
+1,0,9,118,244,521,556,602,687,757,899,964,
+1,0,3,325,662,972,
+1,0,7,0,439,517,549,627,904,997,
+1,0,5,18,426,799,841,911,
+1,807,6,235,477,593,721,791,909,
+1,0,6,42,160,196,323,706,795,
+1,0,9,22,53,132,169,425,473,481,570,813,
+1,0,8,214,305,322,419,473,567,718,940,
+1,563,6,441,449,491,680,699,765,
+1,0,6,4,26,179,201,510,989,
+1,0,5,48,144,341,862,936,
+1,0,7,82,125,204,263,299,516,922,
+1,0,8,29,45,163,224,520,544,580,924,
+1,0,6,55,456,681,876,882,945,
+1,38,8,85,191,214,309,348,523,718,744,
+1,0,8,123,160,474,491,616,759,827,904,
+1,0,5,12,308,684,736,788,
+1,0,7,185,189,393,585,592,694,928,
+1,0,9,69,137,222,373,498,764,877,912,923,
+1,0,4,238,528,654,714,
+1,0,5,128,235,553,765,919,
+1,0,4,399,835,862,911,
+1,0,8,6,242,343,379,763,802,884,952,
+1,0,6,175,217,305,704,877,940,
+1,0,9,30,137,244,265,476,479,711,745,750,
+1,0,8,104,244,338,357,593,661,862,995,
+1,0,3,464,697,835,
+1,0,9,238,371,455,462,552,639,666,789,931,
+1,957,7,58,306,689,890,910,940,992,
+1,0,7,15,222,531,536,654,658,868,
+1,0,4,141,677,807,919,
+1,0,9,64,90,97,132,338,545,615,878,949,
+1,0,7,35,138,171,178,288,327,796,
+1,0,4,177,520,747,864,
+1,0,9,57,125,176,369,564,740,887,888,969,
+1,0,7,93,176,254,484,727,783,830,
+1,0,3,314,772,943,
+1,0,7,196,270,324,463,474,486,651,
+1,0,6,0,48,84,92,203,417,
+1,0,3,58,71,832,
+1,0,7,15,299,338,516,742,854,919,
+1,0,3,150,233,462,
+1,0,6,239,259,373,696,773,890,
+1,0,8,5,6,301,355,493,697,789,938,
+1,782,7,240,664,724,731,870,973,988,
+1,0,7,22,208,235,249,650,747,788,
+1,0,5,22,27,270,282,657,
+1,0,9,208,358,569,584,613,775,824,916,942,
+1,0,3,293,374,927,
+1,0,6,171,244,424,658,660,804,
+1,0,7,248,421,532,541,614,642,795,
+1,0,6,407,471,472,677,853,912,
+1,0,9,59,309,349,433,487,582,643,861,954,
+1,0,8,132,208,308,435,481,872,884,912,
+1,0,4,4,557,664,916,
+1,0,3,29,180,286,
+1,0,5,311,316,393,436,786,
+1,100,8,9,106,197,245,308,330,631,849,
+1,0,8,109,142,215,347,364,548,724,802,
+1,0,6,173,185,546,921,950,993,
+1,0,7,164,387,501,525,722,924,979,
+1,0,9,189,198,302,340,366,413,508,705,867,
+1,0,8,112,312,386,398,425,476,662,731,
+1,0,9,7,83,87,361,508,525,700,905,964,
+1,0,8,39,96,154,352,462,679,868,934,
+1,0,7,38,117,322,581,723,726,984,
+1,0,4,138,454,808,815,
+1,0,5,8,147,508,647,948,
+1,0,3,264,845,886,
+1,623,7,524,566,678,744,752,820,974,
+1,0,7,147,225,300,345,383,729,889,
+1,0,4,107,550,689,947,
+1,0,3,317,455,688,
+1,0,5,20,48,472,669,934,
+1,0,6,107,193,289,427,433,994,
+1,0,8,113,235,254,259,812,909,988,990,
+1,0,9,74,220,285,390,530,540,581,621,708,
+1,0,4,201,532,657,956,
+1,0,7,35,63,106,497,746,760,961,
+1,0,9,40,81,199,220,506,541,561,619,693,
+1,0,7,15,115,634,636,933,993,997,
+1,0,6,30,78,292,525,615,625,
+1,0,8,192,212,508,537,737,765,844,879,
+1,0,5,14,326,366,395,600,
+1,0,6,49,491,557,685,830,833,
+1,0,8,86,109,362,440,663,693,696,817,
+1,0,7,19,117,181,689,823,909,925,
+1,0,9,112,228,279,304,349,560,671,735,749,
+1,0,6,71,112,295,518,822,908,
+1,0,9,31,62,181,212,226,482,503,573,659,
+1,0,8,3,67,254,416,621,704,763,855,
+1,251,4,47,319,440,511,
+1,0,4,298,390,398,806,
+1,0,5,268,335,449,843,920,
+1,0,4,28,337,366,531,
+1,0,3,185,191,504,
+1,990,9,21,36,112,128,188,244,360,431,527,
+1,0,9,11,173,280,311,467,613,744,824,845,
+1,912,8,109,165,431,502,693,729,798,993,
+1,0,8,21,133,209,454,647,689,698,914,
+1,0,9,89,255,265,348,452,711,735,916,919,
+1,0,6,230,362,425,748,793,886,
+1,0,9,231,250,290,392,672,729,938,943,944,
+1,0,7,196,365,443,449,530,803,980,
+1,0,5,72,175,255,293,455,
+1,0,9,108,171,228,414,434,505,652,757,884,
+1,0,5,134,255,347,404,965,
+1,0,6,136,204,312,322,587,761,
+1,0,4,286,434,547,939,
+1,0,7,130,358,364,373,722,793,831,
+1,0,5,544,667,740,783,797,
+1,0,6,239,564,632,754,875,900,
+1,0,9,157,254,315,326,418,428,443,632,801,
+1,0,4,801,862,875,946,
+1,0,5,127,319,344,748,864,
+1,0,3,450,794,956,
+1,0,7,183,350,370,549,717,915,937,
+1,0,5,119,470,701,750,864,
+1,0,8,175,293,346,499,617,624,831,910,
+1,0,3,303,658,828,
+1,0,5,357,449,580,785,968,
+1,859,7,258,327,363,499,568,950,975,
+1,0,7,117,318,457,500,561,833,863,
+1,0,5,219,476,819,854,948,
+1,0,8,105,131,489,512,647,784,847,932,
+1,13,7,28,42,313,450,462,715,882,
+1,0,7,41,120,214,335,572,671,896,
+1,0,5,103,342,818,904,922,
+1,0,9,58,81,163,174,233,301,746,921,975,
+1,0,7,117,226,254,315,344,878,920,
+1,905,3,268,468,387,
+1,0,3,173,309,824,
+1,0,6,80,198,276,474,566,821,
+1,127,7,68,502,529,692,708,806,894,
+1,0,7,195,199,817,891,922,935,944,
+1,0,5,159,449,511,667,820,
+1,553,9,448,472,687,688,768,824,898,919,997,
+1,0,9,1,180,449,493,503,673,704,768,986,
+1,0,7,132,200,219,365,608,854,963,
+1,998,5,9,185,419,731,907,
+1,0,5,7,539,578,605,831,
+1,0,8,11,349,405,511,523,678,720,865,
+1,0,9,1,178,254,393,406,460,486,825,958,
+1,0,4,261,327,363,680,
+1,0,6,150,442,484,562,571,731,
+1,0,5,13,274,349,878,925,
+1,0,4,32,164,599,992,
+1,954,9,188,231,251,408,749,770,832,927,994,
+1,0,9,142,143,209,220,293,496,579,767,930,
+1,0,7,46,136,185,229,307,419,453,
+1,0,3,129,868,969,
+1,0,4,307,323,475,617,
+1,0,8,83,84,656,703,841,855,910,960,
+1,0,3,169,282,445,
+1,0,9,104,196,242,290,320,401,435,630,778,
+1,0,8,41,145,158,382,406,540,820,907,
+1,0,5,110,145,491,499,952,
+1,0,3,96,105,299,
+1,0,9,9,27,420,444,491,662,745,849,872,
+1,0,8,264,346,385,518,529,849,875,982,
+1,0,9,50,106,134,422,563,634,791,884,961,
+1,0,3,498,541,882,
+1,0,5,84,143,568,575,929,
+1,0,4,140,374,549,575,
+1,297,6,15,274,352,400,695,792,
+1,0,6,312,314,566,772,803,826,
+1,0,4,97,229,351,688,
+1,965,7,64,73,216,374,727,798,991,
+1,0,7,29,514,529,541,655,667,972,
+1,636,4,366,371,447,824,
+1,0,4,2,169,314,810,
+1,0,3,412,498,725,
+1,0,7,367,392,605,798,799,808,877,
+1,0,3,340,410,607,
+1,887,7,246,312,331,446,488,703,769,
+1,0,7,133,262,507,550,612,740,948,
+1,0,6,26,232,382,653,770,776,
+1,0,3,101,378,610,
+1,0,6,21,70,164,289,383,449,
+1,0,3,58,66,209,
+1,0,4,304,356,510,821,
+1,985,3,412,813,918,
+1,0,3,397,589,945,
+1,0,8,24,75,205,294,578,594,779,881,
+1,0,9,17,166,577,705,742,829,877,896,914,
+1,0,6,87,292,393,507,589,879,
+1,0,7,288,452,520,694,735,753,955,
+1,0,8,190,395,423,518,624,636,845,968,
+1,0,9,5,83,143,223,490,577,714,720,963,
+1,0,8,255,258,360,406,453,485,529,971,
+1,244,3,296,572,694,
+1,0,3,540,639,838,
+1,0,8,185,264,292,358,407,474,479,761,
+1,0,9,235,364,681,757,782,794,799,828,836,
+1,754,8,334,442,482,493,518,528,623,919,
+1,0,8,88,228,273,325,348,584,589,757,
+1,0,9,114,179,265,285,367,501,733,842,939,
+1,0,6,298,468,582,634,737,816,
+1,110,4,125,258,348,944,
+1,0,4,235,622,819,857,
+1,0,3,399,482,912,
+1,0,7,71,154,163,268,338,443,913,
+1,935,3,401,823,886,
+1,0,3,336,353,457,
+1,0,5,19,542,626,908,963,
+1,0,7,93,425,438,530,606,825,956,
+1,0,6,153,307,316,462,515,587,
+1,0,3,332,852,968,
+1,0,4,86,153,422,485,
+1,0,5,93,115,335,821,964,
+1,0,3,611,840,942,
+1,0,5,57,719,766,896,938,
+1,143,3,412,708,919,
+1,451,3,555,587,790,
+1,0,3,6,111,583,
+1,0,4,69,428,474,536,
+1,0,5,79,295,377,629,821,
+1,0,9,93,164,259,321,397,505,753,988,989,
+1,0,7,23,104,295,565,660,708,819,
+1,0,3,301,435,664,
+1,0,9,2,181,200,204,256,581,630,825,909,
+1,0,3,75,671,675,
+1,0,7,170,187,358,416,440,623,626,
+1,0,4,66,237,293,638,
+1,0,5,27,250,594,672,933,
+1,850,3,489,852,984,
+1,0,3,339,423,442,
+1,59,9,14,179,368,456,517,556,742,934,949,
+1,0,9,73,82,107,131,177,307,768,822,870,
+1,0,4,64,360,795,999,
+1,0,6,25,36,328,459,697,902,
+1,0,8,57,302,394,446,513,704,771,833,
+1,0,4,10,120,373,948,
+1,0,7,126,227,589,680,710,747,952,
+1,0,3,31,746,999,
+1,0,4,360,387,459,737,
+1,0,6,291,483,493,583,640,785,
+1,0,8,164,179,240,541,618,661,806,980,
+1,0,3,116,152,302,
+1,89,8,172,192,428,453,454,460,519,961,
+1,0,8,261,334,471,554,745,827,882,913,
+1,0,3,218,364,501,
+1,0,4,378,397,618,998,
+1,0,5,112,466,682,701,921,
+1,0,9,161,372,514,565,685,845,899,947,995,
+1,0,8,44,76,78,266,427,664,901,926,
+1,0,4,43,261,611,644,
+1,0,7,3,77,111,116,535,589,683,
+1,0,9,87,170,281,324,407,575,750,788,973,
+1,0,4,57,555,654,945,
+1,0,8,61,64,173,432,450,668,817,837,
+1,194,9,11,61,218,319,490,535,602,908,978,
+1,0,9,205,302,369,783,799,838,878,884,886,
+1,0,3,509,615,791,
+1,0,7,13,65,126,134,530,566,594,
+1,0,4,146,238,549,571,
+1,991,7,18,97,308,509,575,632,752,
+1,317,7,9,267,413,549,630,694,866,
+1,0,7,326,461,534,661,727,853,940,
+1,0,6,97,116,174,548,617,745,
+1,0,9,100,184,286,400,418,625,666,675,729,
+1,0,6,400,452,498,618,627,990,
+1,0,3,341,886,954,
+1,0,7,92,146,224,227,266,764,775,
+1,0,5,232,445,793,811,857,
+1,0,4,143,229,328,573,
+1,0,3,14,132,599,
+1,1,7,28,97,578,630,756,789,884,
+1,0,7,29,120,325,452,738,798,914,
+1,0,4,146,355,548,822,
+1,14,5,18,93,179,214,499,
+1,0,5,32,293,388,498,663,
+1,0,9,145,271,434,462,582,594,612,762,961,
+1,0,6,105,174,279,321,676,775,
+1,0,3,264,530,769,
+1,0,4,377,787,830,912,
+1,0,5,220,227,303,560,575,
+1,0,9,51,117,343,581,616,652,654,923,999,
+1,587,3,148,372,456,
+1,0,3,735,780,823,
+1,0,7,161,181,425,592,732,904,910,
+1,0,3,137,464,572,
+1,0,9,97,99,174,409,522,579,686,696,990,
+1,0,7,147,410,472,660,905,972,993,
+1,0,6,92,344,380,824,878,954,
+1,0,9,71,192,236,278,657,714,728,732,832,
+1,0,7,139,207,284,338,383,823,861,
+1,0,6,283,389,396,531,679,724,
+1,0,7,104,411,675,679,771,947,964,
+1,0,9,152,174,219,286,376,382,453,740,934,
+1,0,7,3,319,649,674,752,760,864,
+1,996,4,9,141,882,932,
+1,0,4,5,103,451,543,
+1,0,7,132,188,198,382,451,627,946,
+1,0,8,287,313,523,659,680,826,879,920,
+1,0,9,124,202,246,255,436,441,631,704,962,
+1,0,5,98,247,372,393,397,
+1,0,9,55,170,391,571,635,663,714,848,996,
+1,0,6,47,100,262,469,695,948,
+1,0,4,38,224,468,860,
+1,994,5,115,214,479,873,880,
+1,0,5,109,168,597,811,963,
+1,0,8,224,265,275,290,554,570,880,910,
+1,0,4,312,349,472,801,
+1,0,7,153,268,304,333,378,658,783,
+1,26,9,8,126,127,407,606,666,797,834,960,
+1,0,9,34,225,297,345,437,507,575,702,867,
+1,0,4,17,332,376,633,
+1,967,5,72,170,438,765,937,
+1,169,5,39,81,273,321,422,
+1,0,5,208,250,383,517,572,
+1,0,9,39,69,83,142,399,460,741,891,917,
+1,0,5,93,100,270,382,552,
+1,0,3,60,455,973,
+1,0,6,108,148,279,294,685,743,
+1,0,3,93,303,720,
+1,0,4,132,225,637,789,
+1,0,8,75,131,201,256,351,514,623,686,
+1,0,9,193,209,321,443,488,551,758,898,925,
+1,803,6,394,487,490,592,636,709,
+1,0,6,197,384,524,631,830,971,
+1,0,5,14,147,223,735,991,
+1,0,3,201,917,920,
+1,0,7,167,250,360,377,410,474,649,
+1,0,8,124,418,435,593,646,935,948,963,
+1,0,7,90,132,367,565,652,733,942,
+1,4,9,167,265,432,578,614,794,937,968,996,
+1,0,9,171,174,180,295,611,719,739,771,794,
+1,0,5,30,535,546,592,899,
+1,0,3,468,749,977,
+1,0,5,448,464,729,931,994,
+1,0,3,162,251,546,
+1,0,8,101,192,216,307,498,569,726,827,
+1,977,6,197,310,639,725,755,890,
+1,881,6,174,175,339,504,520,991,
+1,967,6,55,235,301,403,721,804,
+1,0,6,22,28,238,542,878,995,
+1,0,5,143,418,439,447,905,
+1,0,3,329,413,899,
+1,0,5,94,460,563,755,939,
+1,0,9,234,291,476,616,627,671,756,862,989,
+1,0,7,89,103,348,498,507,549,642,
+1,0,5,115,139,469,549,650,
+1,0,4,68,505,657,819,
+1,0,9,322,464,599,602,623,631,679,689,974,
+1,0,8,573,594,598,671,676,687,894,993,
+1,0,4,218,685,734,844,
+1,0,8,60,480,565,720,737,746,755,858,
+1,0,4,320,408,579,900,
+1,0,6,225,246,253,394,798,992,
+1,0,4,31,86,145,492,
+1,0,5,172,716,727,753,774,
+1,0,3,139,319,627,
+1,0,8,152,186,480,668,737,778,837,971,
+1,0,7,36,186,209,411,519,842,921,
+1,0,8,218,355,450,533,601,795,921,974,
+1,0,9,26,165,266,420,610,786,793,841,943,
+1,0,4,129,218,368,771,
+1,0,8,60,161,454,490,524,599,641,817,
+1,0,6,301,326,684,886,964,977,
+1,0,5,196,452,679,710,848,
+1,0,9,31,113,238,304,414,456,467,481,786,
+1,0,7,160,285,468,485,636,869,976,
+1,0,8,143,487,519,601,681,718,788,839,
+1,0,5,323,405,629,691,737,
+1,0,9,11,61,142,159,202,334,684,847,878,
+1,0,3,147,479,692,
+1,0,9,116,146,147,286,396,429,718,781,909,
+1,0,4,103,473,557,928,
+1,0,7,5,139,192,291,339,395,431,
+1,116,9,85,89,129,324,369,441,748,845,942,
+1,0,9,201,247,382,420,454,511,533,667,955,
+1,0,5,291,296,656,722,849,
+1,0,8,27,314,469,504,596,874,969,987,
+1,0,6,58,318,441,783,806,990,
+1,0,7,80,419,620,625,646,939,958,
+1,0,3,450,628,754,
+1,0,6,185,390,402,425,690,829,
+1,0,7,421,525,579,831,859,867,916,
+1,0,3,339,638,651,
+1,0,6,44,292,297,334,716,964,
+1,0,3,669,742,859,
+1,0,4,266,367,498,804,
+1,0,8,150,341,728,757,762,845,846,968,
+1,0,6,53,364,367,713,714,971,
+1,227,7,82,122,346,369,701,766,977,
+1,0,7,309,566,642,707,791,863,942,
+1,0,8,164,233,294,387,471,709,778,796,
+1,0,7,5,27,101,283,468,662,878,
+1,0,6,100,123,461,584,660,868,
+1,0,7,42,122,230,367,369,703,935,
+1,0,6,95,279,378,582,762,862,
+1,0,7,407,430,509,745,786,793,962,
+1,0,6,172,184,248,273,373,952,
+1,0,7,135,281,552,568,767,822,911,
+1,0,4,159,426,502,541,
+1,0,8,110,351,606,681,703,741,820,826,
+1,0,4,248,790,848,976,
+1,0,3,32,326,963,
+1,0,8,52,93,187,268,497,565,577,944,
+1,360,4,0,76,507,881,
+1,0,4,360,385,679,974,
+1,0,6,95,187,306,495,515,516,
+1,0,8,117,272,443,621,769,822,889,976,
+1,0,6,74,150,157,327,361,699,
+1,0,8,184,416,569,578,865,906,932,936,
+1,0,5,111,452,455,511,632,
+1,511,3,545,732,784,
+1,239,3,56,676,786,
+1,0,3,295,389,957,
+1,0,8,8,55,121,717,846,871,903,940,
+1,0,4,135,168,392,699,
+1,0,3,50,255,800,
+1,0,4,135,151,254,847,
+1,0,3,17,255,937,
+1,0,7,174,182,232,406,472,475,601,
+1,0,8,122,247,321,456,551,852,855,879,
+1,0,6,477,502,565,747,798,871,
+1,0,3,274,628,764,
+1,0,7,49,412,565,643,750,797,885,
+1,0,8,69,108,256,308,390,453,574,594,
+1,0,5,82,198,762,907,945,
+1,21,7,92,95,327,380,411,654,783,
+1,0,7,113,126,229,329,649,699,701,
+1,0,8,60,129,155,184,269,292,519,961,
+1,0,6,14,42,69,291,529,737,
+1,0,4,177,414,490,970,
+1,0,3,270,497,878,
+1,0,6,45,125,197,329,580,748,
+1,0,9,67,105,174,234,309,446,485,608,953,
+1,49,4,92,189,239,697,
+1,0,4,141,210,269,624,
+1,603,3,832,855,990,
+1,0,3,435,581,686,
+1,0,9,172,193,278,395,427,473,586,812,910,
+1,0,6,85,209,387,449,452,993,
+1,0,4,11,644,786,798,
+1,0,5,193,265,361,490,776,
+1,0,4,37,110,774,952,
+1,0,8,220,498,591,696,720,784,941,978,
+1,0,5,296,303,545,601,800,
+1,0,9,79,207,233,427,442,600,612,872,941,
+1,0,5,182,201,590,720,777,
+999,1,2,0,1,
+1,0,1,999};
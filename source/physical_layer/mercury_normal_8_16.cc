@@ -25,3210 +25,23 @@
 // Ref: https://www.mathworks.com/help/comm/ref/dvbs2ldpc.html (Try This Example >> dvbs2ldpc.m)
 
 #include "physical_layer/mercury_normal_8_16.h"
-int mercury_normal_Cwidth_8_16=12;
-int mercury_normal_Vwidth_8_16=8;
-int mercury_normal_dwidth_8_16=30;
-int mercury_normal_QCmatrixd_8_16[30]={50,3,50,7,50,6,50,5,100,4,150,7,50,5,50,7,50,6,50,5,50,3,50,5,50,8,799,2,1,1};
-int mercury_normal_QCmatrixC_8_16[800][12]={
-{131,388,581,800,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,219,542,582,772,800,801,-1,-1,-1,-1,-1},
-{150,322,615,753,801,802,-1,-1,-1,-1,-1,-1},
-{69,123,210,548,698,802,803,-1,-1,-1,-1,-1},
-{18,235,381,803,804,-1,-1,-1,-1,-1,-1,-1},
-{66,370,433,792,804,805,-1,-1,-1,-1,-1,-1},
-{132,389,582,805,806,-1,-1,-1,-1,-1,-1,-1},
-{174,220,543,583,773,806,807,-1,-1,-1,-1,-1},
-{151,323,616,754,807,808,-1,-1,-1,-1,-1,-1},
-{70,124,211,549,699,808,809,-1,-1,-1,-1,-1},
-{19,236,382,500,809,810,-1,-1,-1,-1,-1,-1},
-{67,371,434,793,810,811,-1,-1,-1,-1,-1,-1},
-{133,390,583,811,812,-1,-1,-1,-1,-1,-1,-1},
-{175,221,544,584,774,812,813,-1,-1,-1,-1,-1},
-{152,324,617,755,813,814,-1,-1,-1,-1,-1,-1},
-{71,125,212,550,814,815,-1,-1,-1,-1,-1,-1},
-{20,237,383,501,815,816,-1,-1,-1,-1,-1,-1},
-{68,372,435,794,816,817,-1,-1,-1,-1,-1,-1},
-{134,391,584,817,818,-1,-1,-1,-1,-1,-1,-1},
-{176,222,545,585,775,818,819,-1,-1,-1,-1,-1},
-{153,325,618,756,819,820,-1,-1,-1,-1,-1,-1},
-{72,126,213,250,551,820,821,-1,-1,-1,-1,-1},
-{21,238,384,502,821,822,-1,-1,-1,-1,-1,-1},
-{69,100,373,436,795,822,823,-1,-1,-1,-1,-1},
-{135,392,585,823,824,-1,-1,-1,-1,-1,-1,-1},
-{177,223,546,586,776,824,825,-1,-1,-1,-1,-1},
-{154,326,619,757,825,826,-1,-1,-1,-1,-1,-1},
-{73,127,214,251,552,826,827,-1,-1,-1,-1,-1},
-{22,239,385,503,827,828,-1,-1,-1,-1,-1,-1},
-{70,101,374,437,796,828,829,-1,-1,-1,-1,-1},
-{136,393,586,829,830,-1,-1,-1,-1,-1,-1,-1},
-{178,224,547,587,777,830,831,-1,-1,-1,-1,-1},
-{155,327,620,758,831,832,-1,-1,-1,-1,-1,-1},
-{74,128,215,252,553,832,833,-1,-1,-1,-1,-1},
-{23,240,386,504,833,834,-1,-1,-1,-1,-1,-1},
-{71,102,375,438,797,834,835,-1,-1,-1,-1,-1},
-{137,150,394,587,835,836,-1,-1,-1,-1,-1,-1},
-{179,225,548,588,778,836,837,-1,-1,-1,-1,-1},
-{156,328,621,759,837,838,-1,-1,-1,-1,-1,-1},
-{75,129,216,253,554,838,839,-1,-1,-1,-1,-1},
-{24,241,387,505,839,840,-1,-1,-1,-1,-1,-1},
-{0,72,103,376,439,798,840,841,-1,-1,-1,-1},
-{138,151,395,588,841,842,-1,-1,-1,-1,-1,-1},
-{180,226,549,589,779,842,843,-1,-1,-1,-1,-1},
-{157,329,622,760,843,844,-1,-1,-1,-1,-1,-1},
-{76,130,217,254,555,844,845,-1,-1,-1,-1,-1},
-{25,242,388,506,845,846,-1,-1,-1,-1,-1,-1},
-{1,73,104,377,440,799,846,847,-1,-1,-1,-1},
-{139,152,396,589,847,848,-1,-1,-1,-1,-1,-1},
-{181,227,590,780,848,849,-1,-1,-1,-1,-1,-1},
-{158,330,623,761,849,850,-1,-1,-1,-1,-1,-1},
-{77,131,218,255,556,850,851,-1,-1,-1,-1,-1},
-{26,243,389,507,851,852,-1,-1,-1,-1,-1,-1},
-{2,74,105,378,441,852,853,-1,-1,-1,-1,-1},
-{140,153,397,590,853,854,-1,-1,-1,-1,-1,-1},
-{182,228,591,781,854,855,-1,-1,-1,-1,-1,-1},
-{159,331,624,762,855,856,-1,-1,-1,-1,-1,-1},
-{78,132,219,256,557,856,857,-1,-1,-1,-1,-1},
-{27,244,390,508,857,858,-1,-1,-1,-1,-1,-1},
-{3,75,106,379,442,858,859,-1,-1,-1,-1,-1},
-{141,154,398,591,859,860,-1,-1,-1,-1,-1,-1},
-{183,229,592,782,860,861,-1,-1,-1,-1,-1,-1},
-{160,332,625,763,861,862,-1,-1,-1,-1,-1,-1},
-{79,133,220,257,558,862,863,-1,-1,-1,-1,-1},
-{28,50,245,391,509,863,864,-1,-1,-1,-1,-1},
-{4,76,107,380,443,864,865,-1,-1,-1,-1,-1},
-{142,155,399,592,865,866,-1,-1,-1,-1,-1,-1},
-{184,230,593,783,866,867,-1,-1,-1,-1,-1,-1},
-{161,333,626,764,867,868,-1,-1,-1,-1,-1,-1},
-{80,134,221,258,559,868,869,-1,-1,-1,-1,-1},
-{29,51,246,392,510,869,870,-1,-1,-1,-1,-1},
-{5,77,108,381,444,870,871,-1,-1,-1,-1,-1},
-{143,156,593,871,872,-1,-1,-1,-1,-1,-1,-1},
-{185,231,594,784,872,873,-1,-1,-1,-1,-1,-1},
-{162,334,627,765,873,874,-1,-1,-1,-1,-1,-1},
-{81,135,222,259,560,874,875,-1,-1,-1,-1,-1},
-{30,52,247,393,511,875,876,-1,-1,-1,-1,-1},
-{6,78,109,382,445,876,877,-1,-1,-1,-1,-1},
-{144,157,594,877,878,-1,-1,-1,-1,-1,-1,-1},
-{186,232,595,785,878,879,-1,-1,-1,-1,-1,-1},
-{163,335,628,766,879,880,-1,-1,-1,-1,-1,-1},
-{82,136,223,260,561,880,881,-1,-1,-1,-1,-1},
-{31,53,248,394,512,881,882,-1,-1,-1,-1,-1},
-{7,79,110,383,446,882,883,-1,-1,-1,-1,-1},
-{145,158,595,883,884,-1,-1,-1,-1,-1,-1,-1},
-{187,233,596,786,884,885,-1,-1,-1,-1,-1,-1},
-{164,336,629,767,885,886,-1,-1,-1,-1,-1,-1},
-{83,137,224,261,562,886,887,-1,-1,-1,-1,-1},
-{32,54,249,395,513,887,888,-1,-1,-1,-1,-1},
-{8,80,111,384,447,888,889,-1,-1,-1,-1,-1},
-{146,159,596,889,890,-1,-1,-1,-1,-1,-1,-1},
-{188,234,597,787,890,891,-1,-1,-1,-1,-1,-1},
-{165,337,630,768,891,892,-1,-1,-1,-1,-1,-1},
-{84,138,225,262,563,892,893,-1,-1,-1,-1,-1},
-{33,55,396,514,893,894,-1,-1,-1,-1,-1,-1},
-{9,81,112,385,448,894,895,-1,-1,-1,-1,-1},
-{147,160,597,895,896,-1,-1,-1,-1,-1,-1,-1},
-{189,235,598,788,896,897,-1,-1,-1,-1,-1,-1},
-{166,338,631,769,897,898,-1,-1,-1,-1,-1,-1},
-{85,139,226,263,564,898,899,-1,-1,-1,-1,-1},
-{34,56,397,515,899,900,-1,-1,-1,-1,-1,-1},
-{10,82,113,386,449,900,901,-1,-1,-1,-1,-1},
-{148,161,598,901,902,-1,-1,-1,-1,-1,-1,-1},
-{190,236,599,789,902,903,-1,-1,-1,-1,-1,-1},
-{167,339,632,770,903,904,-1,-1,-1,-1,-1,-1},
-{86,140,227,264,565,904,905,-1,-1,-1,-1,-1},
-{35,57,398,516,905,906,-1,-1,-1,-1,-1,-1},
-{11,83,114,387,906,907,-1,-1,-1,-1,-1,-1},
-{149,162,599,907,908,-1,-1,-1,-1,-1,-1,-1},
-{191,237,790,908,909,-1,-1,-1,-1,-1,-1,-1},
-{168,340,633,771,909,910,-1,-1,-1,-1,-1,-1},
-{87,141,228,265,566,910,911,-1,-1,-1,-1,-1},
-{36,58,399,517,911,912,-1,-1,-1,-1,-1,-1},
-{12,84,115,388,912,913,-1,-1,-1,-1,-1,-1},
-{163,913,914,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,238,791,914,915,-1,-1,-1,-1,-1,-1,-1},
-{169,341,634,772,915,916,-1,-1,-1,-1,-1,-1},
-{88,142,229,266,567,916,917,-1,-1,-1,-1,-1},
-{37,59,518,917,918,-1,-1,-1,-1,-1,-1,-1},
-{13,85,116,389,918,919,-1,-1,-1,-1,-1,-1},
-{164,919,920,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,239,792,920,921,-1,-1,-1,-1,-1,-1,-1},
-{170,342,635,773,921,922,-1,-1,-1,-1,-1,-1},
-{89,143,230,267,568,922,923,-1,-1,-1,-1,-1},
-{38,60,519,923,924,-1,-1,-1,-1,-1,-1,-1},
-{14,86,117,390,924,925,-1,-1,-1,-1,-1,-1},
-{165,925,926,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,240,793,926,927,-1,-1,-1,-1,-1,-1,-1},
-{171,343,636,774,927,928,-1,-1,-1,-1,-1,-1},
-{90,144,231,268,569,928,929,-1,-1,-1,-1,-1},
-{39,61,520,929,930,-1,-1,-1,-1,-1,-1,-1},
-{15,87,118,391,930,931,-1,-1,-1,-1,-1,-1},
-{166,931,932,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,241,794,932,933,-1,-1,-1,-1,-1,-1,-1},
-{172,344,637,775,933,934,-1,-1,-1,-1,-1,-1},
-{91,145,232,269,570,934,935,-1,-1,-1,-1,-1},
-{40,62,521,935,936,-1,-1,-1,-1,-1,-1,-1},
-{16,88,119,392,936,937,-1,-1,-1,-1,-1,-1},
-{167,937,938,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{196,242,300,795,938,939,-1,-1,-1,-1,-1,-1},
-{173,345,638,750,776,939,940,-1,-1,-1,-1,-1},
-{92,146,233,270,571,940,941,-1,-1,-1,-1,-1},
-{41,63,100,300,522,941,942,-1,-1,-1,-1,-1},
-{17,89,120,150,393,450,942,943,-1,-1,-1,-1},
-{168,943,944,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{197,243,301,700,796,944,945,-1,-1,-1,-1,-1},
-{174,346,639,751,777,945,946,-1,-1,-1,-1,-1},
-{93,147,234,271,572,946,947,-1,-1,-1,-1,-1},
-{42,64,101,301,523,947,948,-1,-1,-1,-1,-1},
-{18,90,121,151,394,451,948,949,-1,-1,-1,-1},
-{169,949,950,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{198,244,302,701,797,950,951,-1,-1,-1,-1,-1},
-{175,347,640,752,778,951,952,-1,-1,-1,-1,-1},
-{94,148,235,272,573,952,953,-1,-1,-1,-1,-1},
-{43,65,102,302,524,953,954,-1,-1,-1,-1,-1},
-{19,91,122,152,300,395,452,954,955,-1,-1,-1},
-{170,955,956,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,245,303,350,702,798,956,957,-1,-1,-1,-1},
-{176,348,641,753,779,957,958,-1,-1,-1,-1,-1},
-{95,149,236,273,574,958,959,-1,-1,-1,-1,-1},
-{44,66,103,303,525,959,960,-1,-1,-1,-1,-1},
-{20,92,123,153,301,396,453,960,961,-1,-1,-1},
-{171,961,962,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,304,351,703,799,962,963,-1,-1,-1,-1,-1},
-{177,349,642,754,780,963,964,-1,-1,-1,-1,-1},
-{96,237,274,575,964,965,-1,-1,-1,-1,-1,-1},
-{45,67,104,304,526,965,966,-1,-1,-1,-1,-1},
-{21,93,124,154,302,397,454,966,967,-1,-1,-1},
-{172,967,968,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,305,352,704,968,969,-1,-1,-1,-1,-1,-1},
-{178,643,755,781,969,970,-1,-1,-1,-1,-1,-1},
-{97,238,275,576,750,970,971,-1,-1,-1,-1,-1},
-{46,68,105,305,527,971,972,-1,-1,-1,-1,-1},
-{22,94,125,155,303,398,455,972,973,-1,-1,-1},
-{173,400,973,974,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,306,353,650,705,974,975,-1,-1,-1,-1,-1},
-{179,500,644,756,782,975,976,-1,-1,-1,-1,-1},
-{98,239,276,450,577,751,976,977,-1,-1,-1,-1},
-{47,69,106,306,528,977,978,-1,-1,-1,-1,-1},
-{23,95,126,156,304,399,456,978,979,-1,-1,-1},
-{174,401,979,980,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,307,354,651,706,980,981,-1,-1,-1,-1,-1},
-{180,501,645,757,783,981,982,-1,-1,-1,-1,-1},
-{99,240,277,451,578,752,982,983,-1,-1,-1,-1},
-{48,70,107,307,529,983,984,-1,-1,-1,-1,-1},
-{24,96,127,157,305,457,984,985,-1,-1,-1,-1},
-{175,402,600,985,986,-1,-1,-1,-1,-1,-1,-1},
-{308,355,652,707,986,987,-1,-1,-1,-1,-1,-1},
-{181,400,502,646,758,784,987,988,-1,-1,-1,-1},
-{241,278,452,579,753,988,989,-1,-1,-1,-1,-1},
-{49,71,108,308,530,989,990,-1,-1,-1,-1,-1},
-{25,97,128,158,306,458,990,991,-1,-1,-1,-1},
-{176,403,601,991,992,-1,-1,-1,-1,-1,-1,-1},
-{309,356,653,708,992,993,-1,-1,-1,-1,-1,-1},
-{182,401,503,647,759,785,993,994,-1,-1,-1,-1},
-{242,279,350,453,580,754,994,995,-1,-1,-1,-1},
-{72,109,309,531,995,996,-1,-1,-1,-1,-1,-1},
-{26,98,129,159,307,459,996,997,-1,-1,-1,-1},
-{177,404,602,997,998,-1,-1,-1,-1,-1,-1,-1},
-{310,357,654,709,998,999,-1,-1,-1,-1,-1,-1},
-{183,402,504,648,760,786,999,1000,-1,-1,-1,-1},
-{243,280,351,454,581,755,1000,1001,-1,-1,-1,-1},
-{73,110,310,532,1001,1002,-1,-1,-1,-1,-1,-1},
-{27,99,130,160,308,460,1002,1003,-1,-1,-1,-1},
-{178,405,603,1003,1004,-1,-1,-1,-1,-1,-1,-1},
-{311,358,400,655,710,1004,1005,-1,-1,-1,-1,-1},
-{184,403,505,649,761,787,1005,1006,-1,-1,-1,-1},
-{244,281,352,455,582,756,1006,1007,-1,-1,-1,-1},
-{74,111,311,533,1007,1008,-1,-1,-1,-1,-1,-1},
-{28,131,161,309,461,1008,1009,-1,-1,-1,-1,-1},
-{179,406,604,1009,1010,-1,-1,-1,-1,-1,-1,-1},
-{312,359,401,656,711,1010,1011,-1,-1,-1,-1,-1},
-{185,404,506,700,762,788,1011,1012,-1,-1,-1,-1},
-{245,282,300,350,353,456,583,757,1012,1013,-1,-1},
-{75,112,312,534,1013,1014,-1,-1,-1,-1,-1,-1},
-{29,132,162,310,462,1014,1015,-1,-1,-1,-1,-1},
-{180,300,407,605,1015,1016,-1,-1,-1,-1,-1,-1},
-{313,360,402,657,712,1016,1017,-1,-1,-1,-1,-1},
-{186,405,507,701,763,789,1017,1018,-1,-1,-1,-1},
-{246,283,301,351,354,457,584,758,1018,1019,-1,-1},
-{76,113,313,535,1019,1020,-1,-1,-1,-1,-1,-1},
-{30,133,163,311,463,1020,1021,-1,-1,-1,-1,-1},
-{181,301,408,606,1021,1022,-1,-1,-1,-1,-1,-1},
-{314,361,403,658,713,1022,1023,-1,-1,-1,-1,-1},
-{187,406,508,702,764,790,1023,1024,-1,-1,-1,-1},
-{247,284,302,352,355,458,585,759,1024,1025,-1,-1},
-{77,114,314,536,1025,1026,-1,-1,-1,-1,-1,-1},
-{31,134,164,312,464,1026,1027,-1,-1,-1,-1,-1},
-{182,302,409,607,1027,1028,-1,-1,-1,-1,-1,-1},
-{315,362,404,659,714,1028,1029,-1,-1,-1,-1,-1},
-{188,407,509,703,765,791,1029,1030,-1,-1,-1,-1},
-{248,285,303,353,356,459,586,760,1030,1031,-1,-1},
-{78,115,315,537,1031,1032,-1,-1,-1,-1,-1,-1},
-{32,135,165,313,465,1032,1033,-1,-1,-1,-1,-1},
-{183,303,410,608,1033,1034,-1,-1,-1,-1,-1,-1},
-{316,363,405,660,715,1034,1035,-1,-1,-1,-1,-1},
-{189,408,510,550,704,766,792,1035,1036,-1,-1,-1},
-{249,286,304,354,357,460,587,761,1036,1037,-1,-1},
-{79,116,316,538,1037,1038,-1,-1,-1,-1,-1,-1},
-{33,136,166,314,466,1038,1039,-1,-1,-1,-1,-1},
-{184,304,411,500,609,1039,1040,-1,-1,-1,-1,-1},
-{317,364,406,661,716,1040,1041,-1,-1,-1,-1,-1},
-{190,409,511,551,705,767,793,1041,1042,-1,-1,-1},
-{287,305,355,358,461,588,600,762,1042,1043,-1,-1},
-{80,117,317,539,1043,1044,-1,-1,-1,-1,-1,-1},
-{34,137,167,315,467,1044,1045,-1,-1,-1,-1,-1},
-{185,305,412,501,610,1045,1046,-1,-1,-1,-1,-1},
-{318,365,407,662,717,1046,1047,-1,-1,-1,-1,-1},
-{191,410,512,552,706,768,794,1047,1048,-1,-1,-1},
-{288,306,356,359,462,589,601,763,1048,1049,-1,-1},
-{81,118,318,540,1049,1050,-1,-1,-1,-1,-1,-1},
-{35,138,168,316,468,1050,1051,-1,-1,-1,-1,-1},
-{186,306,413,502,611,1051,1052,-1,-1,-1,-1,-1},
-{319,366,408,500,663,718,1052,1053,-1,-1,-1,-1},
-{192,411,513,553,707,769,795,1053,1054,-1,-1,-1},
-{289,307,357,360,463,590,602,764,1054,1055,-1,-1},
-{82,119,319,541,1055,1056,-1,-1,-1,-1,-1,-1},
-{36,139,169,317,469,1056,1057,-1,-1,-1,-1,-1},
-{187,307,414,503,612,1057,1058,-1,-1,-1,-1,-1},
-{320,367,409,501,664,719,1058,1059,-1,-1,-1,-1},
-{193,412,514,554,708,770,796,1059,1060,-1,-1,-1},
-{290,308,358,361,464,591,603,765,1060,1061,-1,-1},
-{83,120,300,320,542,1061,1062,-1,-1,-1,-1,-1},
-{37,140,170,318,470,1062,1063,-1,-1,-1,-1,-1},
-{188,308,415,504,613,1063,1064,-1,-1,-1,-1,-1},
-{321,368,410,502,665,720,1064,1065,-1,-1,-1,-1},
-{194,413,515,555,709,771,797,1065,1066,-1,-1,-1},
-{291,309,359,362,465,592,604,766,1066,1067,-1,-1},
-{84,121,301,321,543,1067,1068,-1,-1,-1,-1,-1},
-{38,141,171,319,471,1068,1069,-1,-1,-1,-1,-1},
-{189,309,416,505,614,1069,1070,-1,-1,-1,-1,-1},
-{322,369,411,503,666,721,1070,1071,-1,-1,-1,-1},
-{195,414,516,556,710,772,798,1071,1072,-1,-1,-1},
-{292,310,360,363,466,593,605,767,1072,1073,-1,-1},
-{85,122,302,322,544,1073,1074,-1,-1,-1,-1,-1},
-{39,142,172,320,472,1074,1075,-1,-1,-1,-1,-1},
-{190,310,417,506,615,1075,1076,-1,-1,-1,-1,-1},
-{323,370,412,504,667,722,1076,1077,-1,-1,-1,-1},
-{196,415,517,557,711,773,799,1077,1078,-1,-1,-1},
-{293,311,361,364,467,594,606,768,1078,1079,-1,-1},
-{86,123,303,323,545,1079,1080,-1,-1,-1,-1,-1},
-{40,143,173,321,473,1080,1081,-1,-1,-1,-1,-1},
-{191,311,418,507,616,1081,1082,-1,-1,-1,-1,-1},
-{324,371,413,505,668,723,1082,1083,-1,-1,-1,-1},
-{197,416,518,558,712,774,1083,1084,-1,-1,-1,-1},
-{294,312,362,365,468,595,607,769,1084,1085,-1,-1},
-{87,124,304,324,546,1085,1086,-1,-1,-1,-1,-1},
-{41,144,174,322,474,1086,1087,-1,-1,-1,-1,-1},
-{192,312,419,508,617,1087,1088,-1,-1,-1,-1,-1},
-{325,372,414,506,669,724,1088,1089,-1,-1,-1,-1},
-{198,417,519,559,713,775,1089,1090,-1,-1,-1,-1},
-{295,313,363,366,469,596,608,770,1090,1091,-1,-1},
-{88,125,305,325,547,1091,1092,-1,-1,-1,-1,-1},
-{42,145,175,323,475,1092,1093,-1,-1,-1,-1,-1},
-{193,313,420,509,618,1093,1094,-1,-1,-1,-1,-1},
-{326,373,415,507,670,700,725,1094,1095,-1,-1,-1},
-{199,418,520,560,714,776,1095,1096,-1,-1,-1,-1},
-{296,314,364,367,470,597,609,771,1096,1097,-1,-1},
-{89,126,306,326,548,1097,1098,-1,-1,-1,-1,-1},
-{43,146,176,324,476,1098,1099,-1,-1,-1,-1,-1},
-{194,314,421,510,619,1099,1100,-1,-1,-1,-1,-1},
-{327,374,416,508,671,701,726,1100,1101,-1,-1,-1},
-{419,521,561,715,777,1101,1102,-1,-1,-1,-1,-1},
-{297,315,365,368,471,598,610,772,1102,1103,-1,-1},
-{90,127,307,327,549,1103,1104,-1,-1,-1,-1,-1},
-{44,50,147,177,325,477,1104,1105,-1,-1,-1,-1},
-{195,315,422,511,620,1105,1106,-1,-1,-1,-1,-1},
-{328,375,417,509,672,702,727,1106,1107,-1,-1,-1},
-{400,420,522,562,716,778,1107,1108,-1,-1,-1,-1},
-{298,316,366,369,472,599,611,773,1108,1109,-1,-1},
-{91,128,308,328,1109,1110,-1,-1,-1,-1,-1,-1},
-{45,51,148,178,326,478,1110,1111,-1,-1,-1,-1},
-{196,316,423,512,621,1111,1112,-1,-1,-1,-1,-1},
-{329,376,418,510,673,700,703,728,1112,1113,-1,-1},
-{401,421,523,563,717,779,1113,1114,-1,-1,-1,-1},
-{299,317,367,370,473,612,774,1114,1115,-1,-1,-1},
-{92,129,309,329,550,1115,1116,-1,-1,-1,-1,-1},
-{46,52,149,179,327,479,1116,1117,-1,-1,-1,-1},
-{197,317,424,513,622,1117,1118,-1,-1,-1,-1,-1},
-{330,377,419,511,674,701,704,729,1118,1119,-1,-1},
-{402,422,524,564,718,780,1119,1120,-1,-1,-1,-1},
-{250,318,368,371,474,613,775,1120,1121,-1,-1,-1},
-{93,130,310,330,551,700,1121,1122,-1,-1,-1,-1},
-{47,53,180,328,350,450,480,1122,1123,-1,-1,-1},
-{198,318,425,514,623,1123,1124,-1,-1,-1,-1,-1},
-{331,378,420,512,675,702,705,730,1124,1125,-1,-1},
-{403,423,525,565,719,781,1125,1126,-1,-1,-1,-1},
-{251,319,369,372,475,614,776,1126,1127,-1,-1,-1},
-{94,131,311,331,552,701,1127,1128,-1,-1,-1,-1},
-{48,54,181,329,351,451,481,1128,1129,-1,-1,-1},
-{199,319,426,515,624,1129,1130,-1,-1,-1,-1,-1},
-{332,379,421,513,676,703,706,731,1130,1131,-1,-1},
-{404,424,526,566,720,782,1131,1132,-1,-1,-1,-1},
-{252,320,370,373,476,615,777,1132,1133,-1,-1,-1},
-{95,132,312,332,553,702,1133,1134,-1,-1,-1,-1},
-{49,55,182,330,352,452,482,1134,1135,-1,-1,-1},
-{320,427,516,625,1135,1136,-1,-1,-1,-1,-1,-1},
-{333,380,422,514,677,704,707,732,1136,1137,-1,-1},
-{405,425,527,567,721,783,1137,1138,-1,-1,-1,-1},
-{253,321,371,374,477,616,778,1138,1139,-1,-1,-1},
-{96,133,313,333,554,703,1139,1140,-1,-1,-1,-1},
-{56,183,331,353,453,483,1140,1141,-1,-1,-1,-1},
-{321,428,517,626,1141,1142,-1,-1,-1,-1,-1,-1},
-{334,381,423,515,678,705,708,733,1142,1143,-1,-1},
-{406,426,528,568,722,784,1143,1144,-1,-1,-1,-1},
-{254,322,372,375,478,617,779,1144,1145,-1,-1,-1},
-{97,134,314,334,555,704,1145,1146,-1,-1,-1,-1},
-{57,184,332,354,454,484,1146,1147,-1,-1,-1,-1},
-{322,429,518,627,1147,1148,-1,-1,-1,-1,-1,-1},
-{335,382,424,516,679,706,709,734,1148,1149,-1,-1},
-{50,407,427,529,569,723,785,1149,1150,-1,-1,-1},
-{255,323,373,376,479,618,780,1150,1151,-1,-1,-1},
-{98,135,315,335,556,705,1151,1152,-1,-1,-1,-1},
-{58,185,333,355,455,485,1152,1153,-1,-1,-1,-1},
-{323,430,519,628,1153,1154,-1,-1,-1,-1,-1,-1},
-{336,383,425,517,680,707,710,735,1154,1155,-1,-1},
-{51,408,428,530,570,724,786,1155,1156,-1,-1,-1},
-{256,324,374,377,480,619,781,1156,1157,-1,-1,-1},
-{99,136,316,336,557,706,1157,1158,-1,-1,-1,-1},
-{59,186,334,356,456,486,1158,1159,-1,-1,-1,-1},
-{324,431,520,629,1159,1160,-1,-1,-1,-1,-1,-1},
-{337,384,426,518,681,708,711,736,1160,1161,-1,-1},
-{52,409,429,531,571,725,787,1161,1162,-1,-1,-1},
-{257,325,375,378,481,620,782,1162,1163,-1,-1,-1},
-{137,317,337,558,707,1163,1164,-1,-1,-1,-1,-1},
-{60,187,335,357,457,487,1164,1165,-1,-1,-1,-1},
-{325,432,521,630,1165,1166,-1,-1,-1,-1,-1,-1},
-{338,385,427,519,600,682,709,712,737,1166,1167,-1},
-{53,410,430,532,572,726,788,1167,1168,-1,-1,-1},
-{258,326,376,379,482,621,750,783,1168,1169,-1,-1},
-{138,318,338,559,708,1169,1170,-1,-1,-1,-1,-1},
-{61,188,336,358,458,488,1170,1171,-1,-1,-1,-1},
-{326,400,433,522,631,1171,1172,-1,-1,-1,-1,-1},
-{339,386,428,520,601,683,710,713,738,1172,1173,-1},
-{54,411,431,533,573,727,789,1173,1174,-1,-1,-1},
-{259,327,377,380,483,622,751,784,1174,1175,-1,-1},
-{139,319,339,560,709,1175,1176,-1,-1,-1,-1,-1},
-{62,189,337,359,459,489,1176,1177,-1,-1,-1,-1},
-{327,401,434,523,632,1177,1178,-1,-1,-1,-1,-1},
-{340,387,429,521,602,684,711,714,739,1178,1179,-1},
-{55,412,432,534,574,728,790,1179,1180,-1,-1,-1},
-{260,328,378,381,484,623,752,785,1180,1181,-1,-1},
-{140,320,340,561,710,1181,1182,-1,-1,-1,-1,-1},
-{63,150,190,338,360,460,490,1182,1183,-1,-1,-1},
-{328,402,435,524,633,1183,1184,-1,-1,-1,-1,-1},
-{341,388,430,522,603,685,712,715,740,1184,1185,-1},
-{56,413,433,535,575,729,791,1185,1186,-1,-1,-1},
-{100,261,329,379,382,485,624,753,786,1186,1187,-1},
-{141,321,341,562,711,1187,1188,-1,-1,-1,-1,-1},
-{64,151,191,339,361,461,491,1188,1189,-1,-1,-1},
-{329,403,436,525,634,1189,1190,-1,-1,-1,-1,-1},
-{342,389,431,523,604,686,713,716,741,1190,1191,-1},
-{57,414,434,536,576,730,792,1191,1192,-1,-1,-1},
-{101,262,330,380,383,486,625,754,787,1192,1193,-1},
-{100,142,322,342,563,712,1193,1194,-1,-1,-1,-1},
-{65,152,192,200,250,340,362,462,492,1194,1195,-1},
-{330,404,437,526,635,1195,1196,-1,-1,-1,-1,-1},
-{343,390,432,524,605,687,714,717,742,1196,1197,-1},
-{58,415,435,537,577,731,793,1197,1198,-1,-1,-1},
-{102,263,331,381,384,487,626,755,788,1198,1199,-1},
-{101,143,323,343,564,713,1199,1200,-1,-1,-1,-1},
-{66,153,193,201,251,341,363,463,493,1200,1201,-1},
-{331,405,438,527,636,1201,1202,-1,-1,-1,-1,-1},
-{50,344,391,433,525,606,688,715,718,743,1202,1203},
-{59,416,436,538,578,732,794,1203,1204,-1,-1,-1},
-{103,264,332,382,385,488,627,756,789,1204,1205,-1},
-{102,144,324,344,565,714,1205,1206,-1,-1,-1,-1},
-{67,154,194,202,252,342,364,464,494,1206,1207,-1},
-{332,406,439,528,637,1207,1208,-1,-1,-1,-1,-1},
-{51,345,392,434,526,607,689,716,719,744,1208,1209},
-{60,417,437,539,579,733,795,1209,1210,-1,-1,-1},
-{104,265,333,383,386,489,628,757,790,1210,1211,-1},
-{103,145,325,345,566,715,1211,1212,-1,-1,-1,-1},
-{68,155,195,203,253,343,365,465,495,1212,1213,-1},
-{333,407,440,529,638,1213,1214,-1,-1,-1,-1,-1},
-{52,346,393,435,527,608,690,717,720,745,1214,1215},
-{61,418,438,540,580,734,796,1215,1216,-1,-1,-1},
-{105,266,334,384,387,490,629,758,791,1216,1217,-1},
-{104,146,326,346,567,716,1217,1218,-1,-1,-1,-1},
-{69,156,196,204,254,344,366,466,496,1218,1219,-1},
-{334,408,441,530,639,1219,1220,-1,-1,-1,-1,-1},
-{53,347,394,436,528,609,691,718,721,746,1220,1221},
-{50,62,419,439,541,581,735,797,1221,1222,-1,-1},
-{106,267,335,385,388,491,630,759,792,1222,1223,-1},
-{105,147,327,347,568,717,1223,1224,-1,-1,-1,-1},
-{70,157,197,205,255,345,367,467,497,1224,1225,-1},
-{335,409,442,531,640,750,1225,1226,-1,-1,-1,-1},
-{54,348,395,437,529,610,692,719,722,747,1226,1227},
-{51,63,420,440,450,542,582,736,798,1227,1228,-1},
-{107,268,336,386,389,492,631,760,793,1228,1229,-1},
-{106,148,328,348,569,718,1229,1230,-1,-1,-1,-1},
-{71,158,198,206,256,346,368,468,498,1230,1231,-1},
-{336,410,443,532,641,751,1231,1232,-1,-1,-1,-1},
-{55,349,396,438,530,611,693,720,723,748,1232,1233},
-{52,64,421,441,451,543,583,737,799,1233,1234,-1},
-{108,269,337,387,390,493,632,761,794,1234,1235,-1},
-{107,149,329,349,570,719,1235,1236,-1,-1,-1,-1},
-{72,159,199,207,250,257,347,369,469,499,1236,1237},
-{337,411,444,533,642,752,1237,1238,-1,-1,-1,-1},
-{56,397,439,531,612,694,721,724,749,1238,1239,-1},
-{53,65,422,442,452,544,584,738,1239,1240,-1,-1},
-{109,270,338,388,391,494,633,650,762,795,1240,1241},
-{108,330,571,720,750,1241,1242,-1,-1,-1,-1,-1},
-{73,160,208,251,258,348,370,470,1242,1243,-1,-1},
-{338,412,445,534,643,753,1243,1244,-1,-1,-1,-1},
-{57,398,440,532,613,695,722,725,1244,1245,-1,-1},
-{54,66,423,443,453,545,585,739,1245,1246,-1,-1},
-{110,271,339,389,392,495,634,651,763,796,1246,1247},
-{109,331,572,721,751,1247,1248,-1,-1,-1,-1,-1},
-{74,161,209,252,259,349,371,471,1248,1249,-1,-1},
-{339,413,446,535,550,644,754,1249,1250,-1,-1,-1},
-{58,399,441,533,614,696,723,726,1250,1251,-1,-1},
-{55,67,424,444,454,546,586,740,1251,1252,-1,-1},
-{111,272,340,390,393,496,635,652,764,797,1252,1253},
-{110,332,573,722,752,1253,1254,-1,-1,-1,-1,-1},
-{75,162,210,253,260,372,472,1254,1255,-1,-1,-1},
-{340,414,447,536,551,645,755,1255,1256,-1,-1,-1},
-{59,442,534,615,697,724,727,1256,1257,-1,-1,-1},
-{56,68,425,445,455,547,587,741,1257,1258,-1,-1},
-{112,273,341,391,394,497,636,653,765,798,1258,1259},
-{111,333,574,723,753,1259,1260,-1,-1,-1,-1,-1},
-{76,163,211,254,261,373,450,473,1260,1261,-1,-1},
-{341,415,448,537,552,646,756,1261,1262,-1,-1,-1},
-{60,443,535,616,698,725,728,1262,1263,-1,-1,-1},
-{57,69,426,446,456,548,588,742,1263,1264,-1,-1},
-{113,274,342,392,395,498,637,654,766,799,1264,1265},
-{112,334,575,724,754,1265,1266,-1,-1,-1,-1,-1},
-{77,164,212,255,262,374,451,474,1266,1267,-1,-1},
-{342,416,449,538,553,647,757,1267,1268,-1,-1,-1},
-{61,444,536,617,699,726,729,1268,1269,-1,-1,-1},
-{58,70,427,447,457,549,589,600,743,1269,1270,-1},
-{114,275,343,393,396,499,638,655,767,1270,1271,-1},
-{113,335,576,725,755,1271,1272,-1,-1,-1,-1,-1},
-{78,165,213,256,263,375,452,475,1272,1273,-1,-1},
-{343,417,500,539,554,648,758,1273,1274,-1,-1,-1},
-{62,445,537,618,727,730,1274,1275,-1,-1,-1,-1},
-{59,71,428,448,458,590,601,744,1275,1276,-1,-1},
-{115,276,344,394,397,639,656,768,1276,1277,-1,-1},
-{114,336,577,726,756,1277,1278,-1,-1,-1,-1,-1},
-{79,166,214,257,264,376,453,476,1278,1279,-1,-1},
-{344,418,501,540,555,649,759,1279,1280,-1,-1,-1},
-{63,446,538,619,728,731,1280,1281,-1,-1,-1,-1},
-{60,72,429,449,459,591,602,745,1281,1282,-1,-1},
-{116,277,345,395,398,640,657,769,1282,1283,-1,-1},
-{115,337,578,727,757,1283,1284,-1,-1,-1,-1,-1},
-{80,167,215,258,265,377,454,477,1284,1285,-1,-1},
-{345,419,502,541,556,760,1285,1286,-1,-1,-1,-1},
-{64,400,447,539,620,729,732,1286,1287,-1,-1,-1},
-{61,73,430,460,592,603,746,1287,1288,-1,-1,-1},
-{117,278,346,396,399,641,658,770,1288,1289,-1,-1},
-{116,338,579,728,758,1289,1290,-1,-1,-1,-1,-1},
-{81,168,216,259,266,378,455,478,1290,1291,-1,-1},
-{346,420,503,542,557,761,1291,1292,-1,-1,-1,-1},
-{65,401,448,540,621,730,733,1292,1293,-1,-1,-1},
-{62,74,431,461,593,604,747,1293,1294,-1,-1,-1},
-{118,279,347,397,642,659,771,1294,1295,-1,-1,-1},
-{117,339,580,729,759,1295,1296,-1,-1,-1,-1,-1},
-{82,169,217,260,267,379,456,479,1296,1297,-1,-1},
-{347,421,504,543,558,762,1297,1298,-1,-1,-1,-1},
-{66,402,449,541,622,731,734,1298,1299,-1,-1,-1},
-{63,75,432,462,594,605,748,1299,1300,-1,-1,-1},
-{119,280,348,398,643,660,772,1300,1301,-1,-1,-1},
-{118,340,581,730,760,1301,1302,-1,-1,-1,-1,-1},
-{83,170,218,261,268,380,457,480,1302,1303,-1,-1},
-{0,348,422,505,544,559,763,1303,1304,-1,-1,-1},
-{67,403,542,623,732,735,1304,1305,-1,-1,-1,-1},
-{64,76,433,463,595,606,749,1305,1306,-1,-1,-1},
-{120,281,349,399,644,661,773,1306,1307,-1,-1,-1},
-{119,341,582,731,761,1307,1308,-1,-1,-1,-1,-1},
-{84,171,219,262,269,381,458,481,1308,1309,-1,-1},
-{1,349,423,506,545,560,764,1309,1310,-1,-1,-1},
-{68,404,543,624,733,736,1310,1311,-1,-1,-1,-1},
-{65,77,434,464,596,607,1311,1312,-1,-1,-1,-1},
-{121,282,645,662,774,1312,1313,-1,-1,-1,-1,-1},
-{120,342,583,732,762,1313,1314,-1,-1,-1,-1,-1},
-{85,172,220,263,270,382,459,482,500,650,1314,1315},
-{2,424,507,546,561,765,1315,1316,-1,-1,-1,-1},
-{69,405,544,625,734,737,1316,1317,-1,-1,-1,-1},
-{66,78,435,465,597,608,1317,1318,-1,-1,-1,-1},
-{122,283,646,663,775,1318,1319,-1,-1,-1,-1,-1},
-{121,343,584,733,763,1319,1320,-1,-1,-1,-1,-1},
-{86,173,221,264,271,383,460,483,501,651,1320,1321},
-{3,425,508,547,562,766,1321,1322,-1,-1,-1,-1},
-{70,406,545,626,735,738,1322,1323,-1,-1,-1,-1},
-{67,79,436,466,598,609,1323,1324,-1,-1,-1,-1},
-{123,284,647,664,776,1324,1325,-1,-1,-1,-1,-1},
-{122,344,585,734,764,1325,1326,-1,-1,-1,-1,-1},
-{87,174,222,265,272,384,461,484,502,652,1326,1327},
-{4,426,509,548,563,767,1327,1328,-1,-1,-1,-1},
-{71,407,546,627,736,739,1328,1329,-1,-1,-1,-1},
-{68,80,437,467,599,610,1329,1330,-1,-1,-1,-1},
-{124,285,648,665,777,1330,1331,-1,-1,-1,-1,-1},
-{123,345,586,735,765,1331,1332,-1,-1,-1,-1,-1},
-{88,175,223,266,273,385,462,485,503,653,1332,1333},
-{5,427,510,549,564,768,1333,1334,-1,-1,-1,-1},
-{72,408,547,628,737,740,1334,1335,-1,-1,-1,-1},
-{69,81,438,468,611,1335,1336,-1,-1,-1,-1,-1},
-{125,286,649,666,778,1336,1337,-1,-1,-1,-1,-1},
-{124,346,587,736,766,1337,1338,-1,-1,-1,-1,-1},
-{89,176,224,267,274,386,463,486,504,654,1338,1339},
-{6,428,511,565,769,1339,1340,-1,-1,-1,-1,-1},
-{73,409,548,629,738,741,1340,1341,-1,-1,-1,-1},
-{70,82,439,469,612,1341,1342,-1,-1,-1,-1,-1},
-{126,287,667,779,1342,1343,-1,-1,-1,-1,-1,-1},
-{125,347,588,737,767,1343,1344,-1,-1,-1,-1,-1},
-{90,177,225,268,275,387,464,487,505,655,1344,1345},
-{7,429,512,566,770,1345,1346,-1,-1,-1,-1,-1},
-{74,410,549,630,739,742,1346,1347,-1,-1,-1,-1},
-{71,83,440,470,613,1347,1348,-1,-1,-1,-1,-1},
-{127,288,500,668,780,1348,1349,-1,-1,-1,-1,-1},
-{126,348,589,738,768,1349,1350,-1,-1,-1,-1,-1},
-{91,178,226,269,276,388,465,488,506,656,1350,1351},
-{8,430,513,567,771,1351,1352,-1,-1,-1,-1,-1},
-{75,411,631,740,743,750,1352,1353,-1,-1,-1,-1},
-{72,84,441,471,614,1353,1354,-1,-1,-1,-1,-1},
-{128,289,501,669,781,1354,1355,-1,-1,-1,-1,-1},
-{127,349,590,739,769,1355,1356,-1,-1,-1,-1,-1},
-{92,179,227,270,277,389,466,489,507,657,1356,1357},
-{9,431,514,568,772,1357,1358,-1,-1,-1,-1,-1},
-{76,412,632,741,744,751,1358,1359,-1,-1,-1,-1},
-{73,85,442,472,615,1359,1360,-1,-1,-1,-1,-1},
-{129,290,502,670,782,1360,1361,-1,-1,-1,-1,-1},
-{128,591,740,770,1361,1362,-1,-1,-1,-1,-1,-1},
-{93,180,228,271,278,390,467,490,508,658,1362,1363},
-{10,432,515,569,773,1363,1364,-1,-1,-1,-1,-1},
-{77,413,633,742,745,752,1364,1365,-1,-1,-1,-1},
-{74,86,443,473,616,1365,1366,-1,-1,-1,-1,-1},
-{130,291,503,671,783,1366,1367,-1,-1,-1,-1,-1},
-{129,592,741,771,1367,1368,-1,-1,-1,-1,-1,-1},
-{94,181,229,272,279,391,468,491,509,659,1368,1369},
-{11,433,516,570,774,1369,1370,-1,-1,-1,-1,-1},
-{78,414,634,743,746,753,1370,1371,-1,-1,-1,-1},
-{75,87,350,444,474,617,1371,1372,-1,-1,-1,-1},
-{131,292,504,672,784,1372,1373,-1,-1,-1,-1,-1},
-{130,593,742,772,1373,1374,-1,-1,-1,-1,-1,-1},
-{95,182,230,273,280,392,469,492,510,660,1374,1375},
-{12,434,517,571,775,1375,1376,-1,-1,-1,-1,-1},
-{79,415,635,744,747,754,1376,1377,-1,-1,-1,-1},
-{76,88,351,445,475,618,1377,1378,-1,-1,-1,-1},
-{132,293,505,673,785,1378,1379,-1,-1,-1,-1,-1},
-{131,594,743,773,1379,1380,-1,-1,-1,-1,-1,-1},
-{96,183,231,274,281,393,470,493,511,661,1380,1381},
-{13,435,518,572,776,1381,1382,-1,-1,-1,-1,-1},
-{80,416,636,745,748,755,1382,1383,-1,-1,-1,-1},
-{77,89,352,446,476,619,1383,1384,-1,-1,-1,-1},
-{133,294,506,674,786,1384,1385,-1,-1,-1,-1,-1},
-{132,595,744,774,1385,1386,-1,-1,-1,-1,-1,-1},
-{97,184,232,275,282,394,471,494,512,662,1386,1387},
-{14,436,519,573,777,1387,1388,-1,-1,-1,-1,-1},
-{81,417,637,746,749,756,1388,1389,-1,-1,-1,-1},
-{78,90,353,447,477,620,1389,1390,-1,-1,-1,-1},
-{134,295,507,675,787,1390,1391,-1,-1,-1,-1,-1},
-{133,596,745,775,1391,1392,-1,-1,-1,-1,-1,-1},
-{98,185,233,276,283,395,472,495,513,663,1392,1393},
-{15,200,437,520,574,778,1393,1394,-1,-1,-1,-1},
-{82,418,638,747,757,1394,1395,-1,-1,-1,-1,-1},
-{79,91,354,448,478,621,1395,1396,-1,-1,-1,-1},
-{135,296,508,676,788,1396,1397,-1,-1,-1,-1,-1},
-{134,597,746,776,1397,1398,-1,-1,-1,-1,-1,-1},
-{99,186,234,277,284,396,473,496,514,664,1398,1399},
-{16,201,438,521,575,779,1399,1400,-1,-1,-1,-1},
-{83,419,639,748,758,1400,1401,-1,-1,-1,-1,-1},
-{80,92,355,449,479,622,1401,1402,-1,-1,-1,-1},
-{136,297,509,677,789,1402,1403,-1,-1,-1,-1,-1},
-{135,598,747,777,1403,1404,-1,-1,-1,-1,-1,-1},
-{187,235,278,285,397,474,497,515,665,1404,1405,-1},
-{17,202,439,522,576,780,1405,1406,-1,-1,-1,-1},
-{84,400,420,640,749,759,1406,1407,-1,-1,-1,-1},
-{81,93,356,480,623,1407,1408,-1,-1,-1,-1,-1},
-{137,298,510,550,678,790,1408,1409,-1,-1,-1,-1},
-{136,599,748,778,1409,1410,-1,-1,-1,-1,-1,-1},
-{188,236,279,286,398,475,498,516,666,1410,1411,-1},
-{18,203,440,523,577,781,1411,1412,-1,-1,-1,-1},
-{85,401,421,641,760,1412,1413,-1,-1,-1,-1,-1},
-{82,94,100,357,481,550,624,1413,1414,-1,-1,-1},
-{138,299,511,551,679,791,1414,1415,-1,-1,-1,-1},
-{137,749,779,1415,1416,-1,-1,-1,-1,-1,-1,-1},
-{189,237,280,287,399,476,499,517,667,1416,1417,-1},
-{19,204,350,441,524,578,782,1417,1418,-1,-1,-1},
-{86,402,422,642,761,1418,1419,-1,-1,-1,-1,-1},
-{83,95,101,358,482,551,625,1419,1420,-1,-1,-1},
-{139,512,552,680,792,1420,1421,-1,-1,-1,-1,-1},
-{138,780,1421,1422,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,238,281,288,477,518,668,1422,1423,-1,-1,-1},
-{20,205,351,442,525,579,783,1423,1424,-1,-1,-1},
-{87,403,423,643,762,1424,1425,-1,-1,-1,-1,-1},
-{84,96,102,359,483,552,626,1425,1426,-1,-1,-1},
-{140,513,553,681,793,1426,1427,-1,-1,-1,-1,-1},
-{139,781,1427,1428,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,239,282,289,478,519,669,1428,1429,-1,-1,-1},
-{21,206,352,443,526,580,784,1429,1430,-1,-1,-1},
-{88,404,424,644,763,1430,1431,-1,-1,-1,-1,-1},
-{85,97,103,360,484,553,627,1431,1432,-1,-1,-1},
-{141,514,554,682,794,1432,1433,-1,-1,-1,-1,-1},
-{140,782,1433,1434,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,240,283,290,479,520,670,1434,1435,-1,-1,-1},
-{22,207,353,444,527,581,785,1435,1436,-1,-1,-1},
-{89,405,425,645,764,1436,1437,-1,-1,-1,-1,-1},
-{86,98,104,361,485,554,628,1437,1438,-1,-1,-1},
-{142,515,555,683,795,1438,1439,-1,-1,-1,-1,-1},
-{141,783,1439,1440,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,241,284,291,480,521,671,1440,1441,-1,-1,-1},
-{23,208,354,445,528,582,786,1441,1442,-1,-1,-1},
-{90,406,426,646,765,1442,1443,-1,-1,-1,-1,-1},
-{87,99,105,362,486,555,629,1443,1444,-1,-1,-1},
-{143,516,556,684,796,1444,1445,-1,-1,-1,-1,-1},
-{142,784,1445,1446,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,242,285,292,481,522,672,1446,1447,-1,-1,-1},
-{24,209,355,446,529,583,787,1447,1448,-1,-1,-1},
-{91,407,427,647,766,1448,1449,-1,-1,-1,-1,-1},
-{88,106,363,487,556,630,1449,1450,-1,-1,-1,-1},
-{144,517,557,685,797,1450,1451,-1,-1,-1,-1,-1},
-{143,785,1451,1452,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,243,286,293,482,523,673,1452,1453,-1,-1,-1},
-{25,210,356,447,530,584,788,1453,1454,-1,-1,-1},
-{92,408,428,648,767,1454,1455,-1,-1,-1,-1,-1},
-{89,107,364,488,557,631,1455,1456,-1,-1,-1,-1},
-{145,518,558,686,798,1456,1457,-1,-1,-1,-1,-1},
-{144,786,1457,1458,-1,-1,-1,-1,-1,-1,-1,-1},
-{196,244,287,294,483,524,674,1458,1459,-1,-1,-1},
-{26,211,357,448,531,585,789,1459,1460,-1,-1,-1},
-{93,409,429,649,768,1460,1461,-1,-1,-1,-1,-1},
-{90,108,365,489,558,632,1461,1462,-1,-1,-1,-1},
-{146,150,519,559,687,799,1462,1463,-1,-1,-1,-1},
-{145,787,1463,1464,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,197,245,288,295,484,525,675,1464,1465,-1,-1},
-{27,212,358,449,532,586,790,1465,1466,-1,-1,-1},
-{94,410,430,769,1466,1467,-1,-1,-1,-1,-1,-1},
-{91,109,366,490,559,633,1467,1468,-1,-1,-1,-1},
-{147,151,520,560,688,750,1468,1469,-1,-1,-1,-1},
-{146,300,788,1469,1470,-1,-1,-1,-1,-1,-1,-1},
-{101,198,246,289,296,485,526,676,1470,1471,-1,-1},
-{28,213,359,533,587,791,1471,1472,-1,-1,-1,-1},
-{95,411,431,770,1472,1473,-1,-1,-1,-1,-1,-1},
-{92,110,367,491,560,634,1473,1474,-1,-1,-1,-1},
-{148,152,521,561,689,751,1474,1475,-1,-1,-1,-1},
-{147,301,789,1475,1476,-1,-1,-1,-1,-1,-1,-1},
-{102,199,247,290,297,486,527,677,1476,1477,-1,-1},
-{29,214,360,534,588,792,1477,1478,-1,-1,-1,-1},
-{96,412,432,771,1478,1479,-1,-1,-1,-1,-1,-1},
-{93,111,368,492,561,635,1479,1480,-1,-1,-1,-1},
-{149,153,522,562,690,752,1480,1481,-1,-1,-1,-1},
-{148,302,790,1481,1482,-1,-1,-1,-1,-1,-1,-1},
-{103,248,291,298,487,528,678,1482,1483,-1,-1,-1},
-{30,215,361,535,589,793,1483,1484,-1,-1,-1,-1},
-{97,350,413,433,772,1484,1485,-1,-1,-1,-1,-1},
-{94,112,369,493,562,636,1485,1486,-1,-1,-1,-1},
-{154,200,523,563,691,753,1486,1487,-1,-1,-1,-1},
-{149,303,791,1487,1488,-1,-1,-1,-1,-1,-1,-1},
-{50,104,249,292,299,488,529,679,1488,1489,-1,-1},
-{31,216,362,536,590,794,1489,1490,-1,-1,-1,-1},
-{98,351,414,434,773,1490,1491,-1,-1,-1,-1,-1},
-{95,113,370,494,563,637,1491,1492,-1,-1,-1,-1},
-{155,201,524,564,692,754,1492,1493,-1,-1,-1,-1},
-{304,792,1493,1494,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,105,293,489,530,680,1494,1495,-1,-1,-1,-1},
-{0,32,217,363,537,591,795,1495,1496,-1,-1,-1},
-{99,352,415,435,774,1496,1497,-1,-1,-1,-1,-1},
-{96,114,371,495,564,638,1497,1498,-1,-1,-1,-1},
-{156,202,525,565,693,755,1498,1499,-1,-1,-1,-1},
-{305,793,1499,1500,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,106,294,490,531,681,1500,1501,-1,-1,-1,-1},
-{1,33,218,364,538,592,796,1501,1502,-1,-1,-1},
-{353,416,436,775,1502,1503,-1,-1,-1,-1,-1,-1},
-{97,115,372,496,565,639,1503,1504,-1,-1,-1,-1},
-{157,203,526,566,694,756,1504,1505,-1,-1,-1,-1},
-{306,794,1505,1506,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,107,295,491,532,682,1506,1507,-1,-1,-1,-1},
-{2,34,219,365,539,593,797,1507,1508,-1,-1,-1},
-{50,354,417,437,776,1508,1509,-1,-1,-1,-1,-1},
-{98,116,373,497,566,640,1509,1510,-1,-1,-1,-1},
-{158,204,527,567,695,757,1510,1511,-1,-1,-1,-1},
-{307,600,795,1511,1512,-1,-1,-1,-1,-1,-1,-1},
-{54,108,296,492,533,683,1512,1513,-1,-1,-1,-1},
-{3,35,220,366,540,594,798,1513,1514,-1,-1,-1},
-{51,355,418,438,777,1514,1515,-1,-1,-1,-1,-1},
-{99,117,374,498,567,641,1515,1516,-1,-1,-1,-1},
-{159,205,528,568,696,758,1516,1517,-1,-1,-1,-1},
-{308,601,796,1517,1518,-1,-1,-1,-1,-1,-1,-1},
-{55,109,297,493,534,684,1518,1519,-1,-1,-1,-1},
-{4,36,221,367,541,595,799,1519,1520,-1,-1,-1},
-{52,356,419,439,778,1520,1521,-1,-1,-1,-1,-1},
-{118,375,499,568,642,1521,1522,-1,-1,-1,-1,-1},
-{160,206,529,569,697,759,1522,1523,-1,-1,-1,-1},
-{309,602,797,1523,1524,-1,-1,-1,-1,-1,-1,-1},
-{56,110,298,494,535,685,1524,1525,-1,-1,-1,-1},
-{5,37,222,368,542,596,1525,1526,-1,-1,-1,-1},
-{53,357,420,440,779,1526,1527,-1,-1,-1,-1,-1},
-{119,376,569,643,1527,1528,-1,-1,-1,-1,-1,-1},
-{161,207,530,570,698,760,1528,1529,-1,-1,-1,-1},
-{310,603,798,1529,1530,-1,-1,-1,-1,-1,-1,-1},
-{57,111,299,495,536,686,1530,1531,-1,-1,-1,-1},
-{6,38,223,369,543,597,1531,1532,-1,-1,-1,-1},
-{54,358,421,441,780,1532,1533,-1,-1,-1,-1,-1},
-{120,377,570,644,1533,1534,-1,-1,-1,-1,-1,-1},
-{162,208,531,571,699,761,1534,1535,-1,-1,-1,-1},
-{311,604,799,1535,1536,-1,-1,-1,-1,-1,-1,-1},
-{58,112,496,537,687,1536,1537,-1,-1,-1,-1,-1},
-{7,39,224,370,544,598,1537,1538,-1,-1,-1,-1},
-{55,359,422,442,781,1538,1539,-1,-1,-1,-1,-1},
-{121,378,571,645,1539,1540,-1,-1,-1,-1,-1,-1},
-{163,209,532,572,762,1540,1541,-1,-1,-1,-1,-1},
-{312,605,1541,1542,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,113,200,497,538,688,1542,1543,-1,-1,-1,-1},
-{8,40,225,371,545,599,1543,1544,-1,-1,-1,-1},
-{56,360,423,443,782,1544,1545,-1,-1,-1,-1,-1},
-{122,379,572,646,1545,1546,-1,-1,-1,-1,-1,-1},
-{164,210,533,573,763,1546,1547,-1,-1,-1,-1,-1},
-{313,606,1547,1548,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,114,201,498,539,689,1548,1549,-1,-1,-1,-1},
-{9,41,226,372,546,1549,1550,-1,-1,-1,-1,-1},
-{57,361,424,444,783,1550,1551,-1,-1,-1,-1,-1},
-{123,380,573,647,1551,1552,-1,-1,-1,-1,-1,-1},
-{165,211,534,574,764,1552,1553,-1,-1,-1,-1,-1},
-{314,607,1553,1554,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,115,202,499,540,690,1554,1555,-1,-1,-1,-1},
-{10,42,227,373,547,1555,1556,-1,-1,-1,-1,-1},
-{58,362,425,445,784,1556,1557,-1,-1,-1,-1,-1},
-{124,381,574,648,1557,1558,-1,-1,-1,-1,-1,-1},
-{166,212,535,575,765,1558,1559,-1,-1,-1,-1,-1},
-{315,608,1559,1560,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,116,203,541,691,1560,1561,-1,-1,-1,-1,-1},
-{11,43,228,374,548,1561,1562,-1,-1,-1,-1,-1},
-{59,363,426,446,785,1562,1563,-1,-1,-1,-1,-1},
-{125,382,575,649,1563,1564,-1,-1,-1,-1,-1,-1},
-{167,213,536,576,766,1564,1565,-1,-1,-1,-1,-1},
-{316,609,1565,1566,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,117,204,542,692,1566,1567,-1,-1,-1,-1,-1},
-{12,44,229,375,549,1567,1568,-1,-1,-1,-1,-1},
-{60,364,427,447,786,1568,1569,-1,-1,-1,-1,-1},
-{126,383,576,1569,1570,-1,-1,-1,-1,-1,-1,-1},
-{168,214,537,577,767,1570,1571,-1,-1,-1,-1,-1},
-{317,610,1571,1572,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,118,205,543,693,1572,1573,-1,-1,-1,-1,-1},
-{13,45,230,376,1573,1574,-1,-1,-1,-1,-1,-1},
-{61,365,428,448,787,1574,1575,-1,-1,-1,-1,-1},
-{127,384,577,1575,1576,-1,-1,-1,-1,-1,-1,-1},
-{169,215,538,578,768,1576,1577,-1,-1,-1,-1,-1},
-{318,611,1577,1578,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,119,206,544,694,1578,1579,-1,-1,-1,-1,-1},
-{14,46,231,377,1579,1580,-1,-1,-1,-1,-1,-1},
-{62,366,429,449,788,1580,1581,-1,-1,-1,-1,-1},
-{128,385,578,1581,1582,-1,-1,-1,-1,-1,-1,-1},
-{170,216,539,579,769,1582,1583,-1,-1,-1,-1,-1},
-{319,612,750,1583,1584,-1,-1,-1,-1,-1,-1,-1},
-{66,120,207,545,695,1584,1585,-1,-1,-1,-1,-1},
-{15,47,232,378,1585,1586,-1,-1,-1,-1,-1,-1},
-{63,367,430,789,1586,1587,-1,-1,-1,-1,-1,-1},
-{129,386,579,1587,1588,-1,-1,-1,-1,-1,-1,-1},
-{171,217,540,580,770,1588,1589,-1,-1,-1,-1,-1},
-{320,613,751,1589,1590,-1,-1,-1,-1,-1,-1,-1},
-{67,121,208,546,696,1590,1591,-1,-1,-1,-1,-1},
-{16,48,233,379,1591,1592,-1,-1,-1,-1,-1,-1},
-{64,368,431,790,1592,1593,-1,-1,-1,-1,-1,-1},
-{130,387,580,1593,1594,-1,-1,-1,-1,-1,-1,-1},
-{172,218,541,581,771,1594,1595,-1,-1,-1,-1,-1},
-{321,614,752,1595,1596,-1,-1,-1,-1,-1,-1,-1},
-{68,122,209,547,697,1596,1597,-1,-1,-1,-1,-1},
-{17,49,234,380,1597,1598,-1,-1,-1,-1,-1,-1},
-{65,369,432,791,1598,1599,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixEnc_8_16[800][11]={
-{131,388,581,-1,-1,-1,-1,-1,-1,-1,-1},
-{173,219,542,582,772,800,-1,-1,-1,-1,-1},
-{150,322,615,753,801,-1,-1,-1,-1,-1,-1},
-{69,123,210,548,698,802,-1,-1,-1,-1,-1},
-{18,235,381,803,-1,-1,-1,-1,-1,-1,-1},
-{66,370,433,792,804,-1,-1,-1,-1,-1,-1},
-{132,389,582,805,-1,-1,-1,-1,-1,-1,-1},
-{174,220,543,583,773,806,-1,-1,-1,-1,-1},
-{151,323,616,754,807,-1,-1,-1,-1,-1,-1},
-{70,124,211,549,699,808,-1,-1,-1,-1,-1},
-{19,236,382,500,809,-1,-1,-1,-1,-1,-1},
-{67,371,434,793,810,-1,-1,-1,-1,-1,-1},
-{133,390,583,811,-1,-1,-1,-1,-1,-1,-1},
-{175,221,544,584,774,812,-1,-1,-1,-1,-1},
-{152,324,617,755,813,-1,-1,-1,-1,-1,-1},
-{71,125,212,550,814,-1,-1,-1,-1,-1,-1},
-{20,237,383,501,815,-1,-1,-1,-1,-1,-1},
-{68,372,435,794,816,-1,-1,-1,-1,-1,-1},
-{134,391,584,817,-1,-1,-1,-1,-1,-1,-1},
-{176,222,545,585,775,818,-1,-1,-1,-1,-1},
-{153,325,618,756,819,-1,-1,-1,-1,-1,-1},
-{72,126,213,250,551,820,-1,-1,-1,-1,-1},
-{21,238,384,502,821,-1,-1,-1,-1,-1,-1},
-{69,100,373,436,795,822,-1,-1,-1,-1,-1},
-{135,392,585,823,-1,-1,-1,-1,-1,-1,-1},
-{177,223,546,586,776,824,-1,-1,-1,-1,-1},
-{154,326,619,757,825,-1,-1,-1,-1,-1,-1},
-{73,127,214,251,552,826,-1,-1,-1,-1,-1},
-{22,239,385,503,827,-1,-1,-1,-1,-1,-1},
-{70,101,374,437,796,828,-1,-1,-1,-1,-1},
-{136,393,586,829,-1,-1,-1,-1,-1,-1,-1},
-{178,224,547,587,777,830,-1,-1,-1,-1,-1},
-{155,327,620,758,831,-1,-1,-1,-1,-1,-1},
-{74,128,215,252,553,832,-1,-1,-1,-1,-1},
-{23,240,386,504,833,-1,-1,-1,-1,-1,-1},
-{71,102,375,438,797,834,-1,-1,-1,-1,-1},
-{137,150,394,587,835,-1,-1,-1,-1,-1,-1},
-{179,225,548,588,778,836,-1,-1,-1,-1,-1},
-{156,328,621,759,837,-1,-1,-1,-1,-1,-1},
-{75,129,216,253,554,838,-1,-1,-1,-1,-1},
-{24,241,387,505,839,-1,-1,-1,-1,-1,-1},
-{0,72,103,376,439,798,840,-1,-1,-1,-1},
-{138,151,395,588,841,-1,-1,-1,-1,-1,-1},
-{180,226,549,589,779,842,-1,-1,-1,-1,-1},
-{157,329,622,760,843,-1,-1,-1,-1,-1,-1},
-{76,130,217,254,555,844,-1,-1,-1,-1,-1},
-{25,242,388,506,845,-1,-1,-1,-1,-1,-1},
-{1,73,104,377,440,799,846,-1,-1,-1,-1},
-{139,152,396,589,847,-1,-1,-1,-1,-1,-1},
-{181,227,590,780,848,-1,-1,-1,-1,-1,-1},
-{158,330,623,761,849,-1,-1,-1,-1,-1,-1},
-{77,131,218,255,556,850,-1,-1,-1,-1,-1},
-{26,243,389,507,851,-1,-1,-1,-1,-1,-1},
-{2,74,105,378,441,852,-1,-1,-1,-1,-1},
-{140,153,397,590,853,-1,-1,-1,-1,-1,-1},
-{182,228,591,781,854,-1,-1,-1,-1,-1,-1},
-{159,331,624,762,855,-1,-1,-1,-1,-1,-1},
-{78,132,219,256,557,856,-1,-1,-1,-1,-1},
-{27,244,390,508,857,-1,-1,-1,-1,-1,-1},
-{3,75,106,379,442,858,-1,-1,-1,-1,-1},
-{141,154,398,591,859,-1,-1,-1,-1,-1,-1},
-{183,229,592,782,860,-1,-1,-1,-1,-1,-1},
-{160,332,625,763,861,-1,-1,-1,-1,-1,-1},
-{79,133,220,257,558,862,-1,-1,-1,-1,-1},
-{28,50,245,391,509,863,-1,-1,-1,-1,-1},
-{4,76,107,380,443,864,-1,-1,-1,-1,-1},
-{142,155,399,592,865,-1,-1,-1,-1,-1,-1},
-{184,230,593,783,866,-1,-1,-1,-1,-1,-1},
-{161,333,626,764,867,-1,-1,-1,-1,-1,-1},
-{80,134,221,258,559,868,-1,-1,-1,-1,-1},
-{29,51,246,392,510,869,-1,-1,-1,-1,-1},
-{5,77,108,381,444,870,-1,-1,-1,-1,-1},
-{143,156,593,871,-1,-1,-1,-1,-1,-1,-1},
-{185,231,594,784,872,-1,-1,-1,-1,-1,-1},
-{162,334,627,765,873,-1,-1,-1,-1,-1,-1},
-{81,135,222,259,560,874,-1,-1,-1,-1,-1},
-{30,52,247,393,511,875,-1,-1,-1,-1,-1},
-{6,78,109,382,445,876,-1,-1,-1,-1,-1},
-{144,157,594,877,-1,-1,-1,-1,-1,-1,-1},
-{186,232,595,785,878,-1,-1,-1,-1,-1,-1},
-{163,335,628,766,879,-1,-1,-1,-1,-1,-1},
-{82,136,223,260,561,880,-1,-1,-1,-1,-1},
-{31,53,248,394,512,881,-1,-1,-1,-1,-1},
-{7,79,110,383,446,882,-1,-1,-1,-1,-1},
-{145,158,595,883,-1,-1,-1,-1,-1,-1,-1},
-{187,233,596,786,884,-1,-1,-1,-1,-1,-1},
-{164,336,629,767,885,-1,-1,-1,-1,-1,-1},
-{83,137,224,261,562,886,-1,-1,-1,-1,-1},
-{32,54,249,395,513,887,-1,-1,-1,-1,-1},
-{8,80,111,384,447,888,-1,-1,-1,-1,-1},
-{146,159,596,889,-1,-1,-1,-1,-1,-1,-1},
-{188,234,597,787,890,-1,-1,-1,-1,-1,-1},
-{165,337,630,768,891,-1,-1,-1,-1,-1,-1},
-{84,138,225,262,563,892,-1,-1,-1,-1,-1},
-{33,55,396,514,893,-1,-1,-1,-1,-1,-1},
-{9,81,112,385,448,894,-1,-1,-1,-1,-1},
-{147,160,597,895,-1,-1,-1,-1,-1,-1,-1},
-{189,235,598,788,896,-1,-1,-1,-1,-1,-1},
-{166,338,631,769,897,-1,-1,-1,-1,-1,-1},
-{85,139,226,263,564,898,-1,-1,-1,-1,-1},
-{34,56,397,515,899,-1,-1,-1,-1,-1,-1},
-{10,82,113,386,449,900,-1,-1,-1,-1,-1},
-{148,161,598,901,-1,-1,-1,-1,-1,-1,-1},
-{190,236,599,789,902,-1,-1,-1,-1,-1,-1},
-{167,339,632,770,903,-1,-1,-1,-1,-1,-1},
-{86,140,227,264,565,904,-1,-1,-1,-1,-1},
-{35,57,398,516,905,-1,-1,-1,-1,-1,-1},
-{11,83,114,387,906,-1,-1,-1,-1,-1,-1},
-{149,162,599,907,-1,-1,-1,-1,-1,-1,-1},
-{191,237,790,908,-1,-1,-1,-1,-1,-1,-1},
-{168,340,633,771,909,-1,-1,-1,-1,-1,-1},
-{87,141,228,265,566,910,-1,-1,-1,-1,-1},
-{36,58,399,517,911,-1,-1,-1,-1,-1,-1},
-{12,84,115,388,912,-1,-1,-1,-1,-1,-1},
-{163,913,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,238,791,914,-1,-1,-1,-1,-1,-1,-1},
-{169,341,634,772,915,-1,-1,-1,-1,-1,-1},
-{88,142,229,266,567,916,-1,-1,-1,-1,-1},
-{37,59,518,917,-1,-1,-1,-1,-1,-1,-1},
-{13,85,116,389,918,-1,-1,-1,-1,-1,-1},
-{164,919,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,239,792,920,-1,-1,-1,-1,-1,-1,-1},
-{170,342,635,773,921,-1,-1,-1,-1,-1,-1},
-{89,143,230,267,568,922,-1,-1,-1,-1,-1},
-{38,60,519,923,-1,-1,-1,-1,-1,-1,-1},
-{14,86,117,390,924,-1,-1,-1,-1,-1,-1},
-{165,925,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,240,793,926,-1,-1,-1,-1,-1,-1,-1},
-{171,343,636,774,927,-1,-1,-1,-1,-1,-1},
-{90,144,231,268,569,928,-1,-1,-1,-1,-1},
-{39,61,520,929,-1,-1,-1,-1,-1,-1,-1},
-{15,87,118,391,930,-1,-1,-1,-1,-1,-1},
-{166,931,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,241,794,932,-1,-1,-1,-1,-1,-1,-1},
-{172,344,637,775,933,-1,-1,-1,-1,-1,-1},
-{91,145,232,269,570,934,-1,-1,-1,-1,-1},
-{40,62,521,935,-1,-1,-1,-1,-1,-1,-1},
-{16,88,119,392,936,-1,-1,-1,-1,-1,-1},
-{167,937,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{196,242,300,795,938,-1,-1,-1,-1,-1,-1},
-{173,345,638,750,776,939,-1,-1,-1,-1,-1},
-{92,146,233,270,571,940,-1,-1,-1,-1,-1},
-{41,63,100,300,522,941,-1,-1,-1,-1,-1},
-{17,89,120,150,393,450,942,-1,-1,-1,-1},
-{168,943,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{197,243,301,700,796,944,-1,-1,-1,-1,-1},
-{174,346,639,751,777,945,-1,-1,-1,-1,-1},
-{93,147,234,271,572,946,-1,-1,-1,-1,-1},
-{42,64,101,301,523,947,-1,-1,-1,-1,-1},
-{18,90,121,151,394,451,948,-1,-1,-1,-1},
-{169,949,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{198,244,302,701,797,950,-1,-1,-1,-1,-1},
-{175,347,640,752,778,951,-1,-1,-1,-1,-1},
-{94,148,235,272,573,952,-1,-1,-1,-1,-1},
-{43,65,102,302,524,953,-1,-1,-1,-1,-1},
-{19,91,122,152,300,395,452,954,-1,-1,-1},
-{170,955,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{199,245,303,350,702,798,956,-1,-1,-1,-1},
-{176,348,641,753,779,957,-1,-1,-1,-1,-1},
-{95,149,236,273,574,958,-1,-1,-1,-1,-1},
-{44,66,103,303,525,959,-1,-1,-1,-1,-1},
-{20,92,123,153,301,396,453,960,-1,-1,-1},
-{171,961,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{246,304,351,703,799,962,-1,-1,-1,-1,-1},
-{177,349,642,754,780,963,-1,-1,-1,-1,-1},
-{96,237,274,575,964,-1,-1,-1,-1,-1,-1},
-{45,67,104,304,526,965,-1,-1,-1,-1,-1},
-{21,93,124,154,302,397,454,966,-1,-1,-1},
-{172,967,-1,-1,-1,-1,-1,-1,-1,-1,-1},
-{247,305,352,704,968,-1,-1,-1,-1,-1,-1},
-{178,643,755,781,969,-1,-1,-1,-1,-1,-1},
-{97,238,275,576,750,970,-1,-1,-1,-1,-1},
-{46,68,105,305,527,971,-1,-1,-1,-1,-1},
-{22,94,125,155,303,398,455,972,-1,-1,-1},
-{173,400,973,-1,-1,-1,-1,-1,-1,-1,-1},
-{248,306,353,650,705,974,-1,-1,-1,-1,-1},
-{179,500,644,756,782,975,-1,-1,-1,-1,-1},
-{98,239,276,450,577,751,976,-1,-1,-1,-1},
-{47,69,106,306,528,977,-1,-1,-1,-1,-1},
-{23,95,126,156,304,399,456,978,-1,-1,-1},
-{174,401,979,-1,-1,-1,-1,-1,-1,-1,-1},
-{249,307,354,651,706,980,-1,-1,-1,-1,-1},
-{180,501,645,757,783,981,-1,-1,-1,-1,-1},
-{99,240,277,451,578,752,982,-1,-1,-1,-1},
-{48,70,107,307,529,983,-1,-1,-1,-1,-1},
-{24,96,127,157,305,457,984,-1,-1,-1,-1},
-{175,402,600,985,-1,-1,-1,-1,-1,-1,-1},
-{308,355,652,707,986,-1,-1,-1,-1,-1,-1},
-{181,400,502,646,758,784,987,-1,-1,-1,-1},
-{241,278,452,579,753,988,-1,-1,-1,-1,-1},
-{49,71,108,308,530,989,-1,-1,-1,-1,-1},
-{25,97,128,158,306,458,990,-1,-1,-1,-1},
-{176,403,601,991,-1,-1,-1,-1,-1,-1,-1},
-{309,356,653,708,992,-1,-1,-1,-1,-1,-1},
-{182,401,503,647,759,785,993,-1,-1,-1,-1},
-{242,279,350,453,580,754,994,-1,-1,-1,-1},
-{72,109,309,531,995,-1,-1,-1,-1,-1,-1},
-{26,98,129,159,307,459,996,-1,-1,-1,-1},
-{177,404,602,997,-1,-1,-1,-1,-1,-1,-1},
-{310,357,654,709,998,-1,-1,-1,-1,-1,-1},
-{183,402,504,648,760,786,999,-1,-1,-1,-1},
-{243,280,351,454,581,755,1000,-1,-1,-1,-1},
-{73,110,310,532,1001,-1,-1,-1,-1,-1,-1},
-{27,99,130,160,308,460,1002,-1,-1,-1,-1},
-{178,405,603,1003,-1,-1,-1,-1,-1,-1,-1},
-{311,358,400,655,710,1004,-1,-1,-1,-1,-1},
-{184,403,505,649,761,787,1005,-1,-1,-1,-1},
-{244,281,352,455,582,756,1006,-1,-1,-1,-1},
-{74,111,311,533,1007,-1,-1,-1,-1,-1,-1},
-{28,131,161,309,461,1008,-1,-1,-1,-1,-1},
-{179,406,604,1009,-1,-1,-1,-1,-1,-1,-1},
-{312,359,401,656,711,1010,-1,-1,-1,-1,-1},
-{185,404,506,700,762,788,1011,-1,-1,-1,-1},
-{245,282,300,350,353,456,583,757,1012,-1,-1},
-{75,112,312,534,1013,-1,-1,-1,-1,-1,-1},
-{29,132,162,310,462,1014,-1,-1,-1,-1,-1},
-{180,300,407,605,1015,-1,-1,-1,-1,-1,-1},
-{313,360,402,657,712,1016,-1,-1,-1,-1,-1},
-{186,405,507,701,763,789,1017,-1,-1,-1,-1},
-{246,283,301,351,354,457,584,758,1018,-1,-1},
-{76,113,313,535,1019,-1,-1,-1,-1,-1,-1},
-{30,133,163,311,463,1020,-1,-1,-1,-1,-1},
-{181,301,408,606,1021,-1,-1,-1,-1,-1,-1},
-{314,361,403,658,713,1022,-1,-1,-1,-1,-1},
-{187,406,508,702,764,790,1023,-1,-1,-1,-1},
-{247,284,302,352,355,458,585,759,1024,-1,-1},
-{77,114,314,536,1025,-1,-1,-1,-1,-1,-1},
-{31,134,164,312,464,1026,-1,-1,-1,-1,-1},
-{182,302,409,607,1027,-1,-1,-1,-1,-1,-1},
-{315,362,404,659,714,1028,-1,-1,-1,-1,-1},
-{188,407,509,703,765,791,1029,-1,-1,-1,-1},
-{248,285,303,353,356,459,586,760,1030,-1,-1},
-{78,115,315,537,1031,-1,-1,-1,-1,-1,-1},
-{32,135,165,313,465,1032,-1,-1,-1,-1,-1},
-{183,303,410,608,1033,-1,-1,-1,-1,-1,-1},
-{316,363,405,660,715,1034,-1,-1,-1,-1,-1},
-{189,408,510,550,704,766,792,1035,-1,-1,-1},
-{249,286,304,354,357,460,587,761,1036,-1,-1},
-{79,116,316,538,1037,-1,-1,-1,-1,-1,-1},
-{33,136,166,314,466,1038,-1,-1,-1,-1,-1},
-{184,304,411,500,609,1039,-1,-1,-1,-1,-1},
-{317,364,406,661,716,1040,-1,-1,-1,-1,-1},
-{190,409,511,551,705,767,793,1041,-1,-1,-1},
-{287,305,355,358,461,588,600,762,1042,-1,-1},
-{80,117,317,539,1043,-1,-1,-1,-1,-1,-1},
-{34,137,167,315,467,1044,-1,-1,-1,-1,-1},
-{185,305,412,501,610,1045,-1,-1,-1,-1,-1},
-{318,365,407,662,717,1046,-1,-1,-1,-1,-1},
-{191,410,512,552,706,768,794,1047,-1,-1,-1},
-{288,306,356,359,462,589,601,763,1048,-1,-1},
-{81,118,318,540,1049,-1,-1,-1,-1,-1,-1},
-{35,138,168,316,468,1050,-1,-1,-1,-1,-1},
-{186,306,413,502,611,1051,-1,-1,-1,-1,-1},
-{319,366,408,500,663,718,1052,-1,-1,-1,-1},
-{192,411,513,553,707,769,795,1053,-1,-1,-1},
-{289,307,357,360,463,590,602,764,1054,-1,-1},
-{82,119,319,541,1055,-1,-1,-1,-1,-1,-1},
-{36,139,169,317,469,1056,-1,-1,-1,-1,-1},
-{187,307,414,503,612,1057,-1,-1,-1,-1,-1},
-{320,367,409,501,664,719,1058,-1,-1,-1,-1},
-{193,412,514,554,708,770,796,1059,-1,-1,-1},
-{290,308,358,361,464,591,603,765,1060,-1,-1},
-{83,120,300,320,542,1061,-1,-1,-1,-1,-1},
-{37,140,170,318,470,1062,-1,-1,-1,-1,-1},
-{188,308,415,504,613,1063,-1,-1,-1,-1,-1},
-{321,368,410,502,665,720,1064,-1,-1,-1,-1},
-{194,413,515,555,709,771,797,1065,-1,-1,-1},
-{291,309,359,362,465,592,604,766,1066,-1,-1},
-{84,121,301,321,543,1067,-1,-1,-1,-1,-1},
-{38,141,171,319,471,1068,-1,-1,-1,-1,-1},
-{189,309,416,505,614,1069,-1,-1,-1,-1,-1},
-{322,369,411,503,666,721,1070,-1,-1,-1,-1},
-{195,414,516,556,710,772,798,1071,-1,-1,-1},
-{292,310,360,363,466,593,605,767,1072,-1,-1},
-{85,122,302,322,544,1073,-1,-1,-1,-1,-1},
-{39,142,172,320,472,1074,-1,-1,-1,-1,-1},
-{190,310,417,506,615,1075,-1,-1,-1,-1,-1},
-{323,370,412,504,667,722,1076,-1,-1,-1,-1},
-{196,415,517,557,711,773,799,1077,-1,-1,-1},
-{293,311,361,364,467,594,606,768,1078,-1,-1},
-{86,123,303,323,545,1079,-1,-1,-1,-1,-1},
-{40,143,173,321,473,1080,-1,-1,-1,-1,-1},
-{191,311,418,507,616,1081,-1,-1,-1,-1,-1},
-{324,371,413,505,668,723,1082,-1,-1,-1,-1},
-{197,416,518,558,712,774,1083,-1,-1,-1,-1},
-{294,312,362,365,468,595,607,769,1084,-1,-1},
-{87,124,304,324,546,1085,-1,-1,-1,-1,-1},
-{41,144,174,322,474,1086,-1,-1,-1,-1,-1},
-{192,312,419,508,617,1087,-1,-1,-1,-1,-1},
-{325,372,414,506,669,724,1088,-1,-1,-1,-1},
-{198,417,519,559,713,775,1089,-1,-1,-1,-1},
-{295,313,363,366,469,596,608,770,1090,-1,-1},
-{88,125,305,325,547,1091,-1,-1,-1,-1,-1},
-{42,145,175,323,475,1092,-1,-1,-1,-1,-1},
-{193,313,420,509,618,1093,-1,-1,-1,-1,-1},
-{326,373,415,507,670,700,725,1094,-1,-1,-1},
-{199,418,520,560,714,776,1095,-1,-1,-1,-1},
-{296,314,364,367,470,597,609,771,1096,-1,-1},
-{89,126,306,326,548,1097,-1,-1,-1,-1,-1},
-{43,146,176,324,476,1098,-1,-1,-1,-1,-1},
-{194,314,421,510,619,1099,-1,-1,-1,-1,-1},
-{327,374,416,508,671,701,726,1100,-1,-1,-1},
-{419,521,561,715,777,1101,-1,-1,-1,-1,-1},
-{297,315,365,368,471,598,610,772,1102,-1,-1},
-{90,127,307,327,549,1103,-1,-1,-1,-1,-1},
-{44,50,147,177,325,477,1104,-1,-1,-1,-1},
-{195,315,422,511,620,1105,-1,-1,-1,-1,-1},
-{328,375,417,509,672,702,727,1106,-1,-1,-1},
-{400,420,522,562,716,778,1107,-1,-1,-1,-1},
-{298,316,366,369,472,599,611,773,1108,-1,-1},
-{91,128,308,328,1109,-1,-1,-1,-1,-1,-1},
-{45,51,148,178,326,478,1110,-1,-1,-1,-1},
-{196,316,423,512,621,1111,-1,-1,-1,-1,-1},
-{329,376,418,510,673,700,703,728,1112,-1,-1},
-{401,421,523,563,717,779,1113,-1,-1,-1,-1},
-{299,317,367,370,473,612,774,1114,-1,-1,-1},
-{92,129,309,329,550,1115,-1,-1,-1,-1,-1},
-{46,52,149,179,327,479,1116,-1,-1,-1,-1},
-{197,317,424,513,622,1117,-1,-1,-1,-1,-1},
-{330,377,419,511,674,701,704,729,1118,-1,-1},
-{402,422,524,564,718,780,1119,-1,-1,-1,-1},
-{250,318,368,371,474,613,775,1120,-1,-1,-1},
-{93,130,310,330,551,700,1121,-1,-1,-1,-1},
-{47,53,180,328,350,450,480,1122,-1,-1,-1},
-{198,318,425,514,623,1123,-1,-1,-1,-1,-1},
-{331,378,420,512,675,702,705,730,1124,-1,-1},
-{403,423,525,565,719,781,1125,-1,-1,-1,-1},
-{251,319,369,372,475,614,776,1126,-1,-1,-1},
-{94,131,311,331,552,701,1127,-1,-1,-1,-1},
-{48,54,181,329,351,451,481,1128,-1,-1,-1},
-{199,319,426,515,624,1129,-1,-1,-1,-1,-1},
-{332,379,421,513,676,703,706,731,1130,-1,-1},
-{404,424,526,566,720,782,1131,-1,-1,-1,-1},
-{252,320,370,373,476,615,777,1132,-1,-1,-1},
-{95,132,312,332,553,702,1133,-1,-1,-1,-1},
-{49,55,182,330,352,452,482,1134,-1,-1,-1},
-{320,427,516,625,1135,-1,-1,-1,-1,-1,-1},
-{333,380,422,514,677,704,707,732,1136,-1,-1},
-{405,425,527,567,721,783,1137,-1,-1,-1,-1},
-{253,321,371,374,477,616,778,1138,-1,-1,-1},
-{96,133,313,333,554,703,1139,-1,-1,-1,-1},
-{56,183,331,353,453,483,1140,-1,-1,-1,-1},
-{321,428,517,626,1141,-1,-1,-1,-1,-1,-1},
-{334,381,423,515,678,705,708,733,1142,-1,-1},
-{406,426,528,568,722,784,1143,-1,-1,-1,-1},
-{254,322,372,375,478,617,779,1144,-1,-1,-1},
-{97,134,314,334,555,704,1145,-1,-1,-1,-1},
-{57,184,332,354,454,484,1146,-1,-1,-1,-1},
-{322,429,518,627,1147,-1,-1,-1,-1,-1,-1},
-{335,382,424,516,679,706,709,734,1148,-1,-1},
-{50,407,427,529,569,723,785,1149,-1,-1,-1},
-{255,323,373,376,479,618,780,1150,-1,-1,-1},
-{98,135,315,335,556,705,1151,-1,-1,-1,-1},
-{58,185,333,355,455,485,1152,-1,-1,-1,-1},
-{323,430,519,628,1153,-1,-1,-1,-1,-1,-1},
-{336,383,425,517,680,707,710,735,1154,-1,-1},
-{51,408,428,530,570,724,786,1155,-1,-1,-1},
-{256,324,374,377,480,619,781,1156,-1,-1,-1},
-{99,136,316,336,557,706,1157,-1,-1,-1,-1},
-{59,186,334,356,456,486,1158,-1,-1,-1,-1},
-{324,431,520,629,1159,-1,-1,-1,-1,-1,-1},
-{337,384,426,518,681,708,711,736,1160,-1,-1},
-{52,409,429,531,571,725,787,1161,-1,-1,-1},
-{257,325,375,378,481,620,782,1162,-1,-1,-1},
-{137,317,337,558,707,1163,-1,-1,-1,-1,-1},
-{60,187,335,357,457,487,1164,-1,-1,-1,-1},
-{325,432,521,630,1165,-1,-1,-1,-1,-1,-1},
-{338,385,427,519,600,682,709,712,737,1166,-1},
-{53,410,430,532,572,726,788,1167,-1,-1,-1},
-{258,326,376,379,482,621,750,783,1168,-1,-1},
-{138,318,338,559,708,1169,-1,-1,-1,-1,-1},
-{61,188,336,358,458,488,1170,-1,-1,-1,-1},
-{326,400,433,522,631,1171,-1,-1,-1,-1,-1},
-{339,386,428,520,601,683,710,713,738,1172,-1},
-{54,411,431,533,573,727,789,1173,-1,-1,-1},
-{259,327,377,380,483,622,751,784,1174,-1,-1},
-{139,319,339,560,709,1175,-1,-1,-1,-1,-1},
-{62,189,337,359,459,489,1176,-1,-1,-1,-1},
-{327,401,434,523,632,1177,-1,-1,-1,-1,-1},
-{340,387,429,521,602,684,711,714,739,1178,-1},
-{55,412,432,534,574,728,790,1179,-1,-1,-1},
-{260,328,378,381,484,623,752,785,1180,-1,-1},
-{140,320,340,561,710,1181,-1,-1,-1,-1,-1},
-{63,150,190,338,360,460,490,1182,-1,-1,-1},
-{328,402,435,524,633,1183,-1,-1,-1,-1,-1},
-{341,388,430,522,603,685,712,715,740,1184,-1},
-{56,413,433,535,575,729,791,1185,-1,-1,-1},
-{100,261,329,379,382,485,624,753,786,1186,-1},
-{141,321,341,562,711,1187,-1,-1,-1,-1,-1},
-{64,151,191,339,361,461,491,1188,-1,-1,-1},
-{329,403,436,525,634,1189,-1,-1,-1,-1,-1},
-{342,389,431,523,604,686,713,716,741,1190,-1},
-{57,414,434,536,576,730,792,1191,-1,-1,-1},
-{101,262,330,380,383,486,625,754,787,1192,-1},
-{100,142,322,342,563,712,1193,-1,-1,-1,-1},
-{65,152,192,200,250,340,362,462,492,1194,-1},
-{330,404,437,526,635,1195,-1,-1,-1,-1,-1},
-{343,390,432,524,605,687,714,717,742,1196,-1},
-{58,415,435,537,577,731,793,1197,-1,-1,-1},
-{102,263,331,381,384,487,626,755,788,1198,-1},
-{101,143,323,343,564,713,1199,-1,-1,-1,-1},
-{66,153,193,201,251,341,363,463,493,1200,-1},
-{331,405,438,527,636,1201,-1,-1,-1,-1,-1},
-{50,344,391,433,525,606,688,715,718,743,1202},
-{59,416,436,538,578,732,794,1203,-1,-1,-1},
-{103,264,332,382,385,488,627,756,789,1204,-1},
-{102,144,324,344,565,714,1205,-1,-1,-1,-1},
-{67,154,194,202,252,342,364,464,494,1206,-1},
-{332,406,439,528,637,1207,-1,-1,-1,-1,-1},
-{51,345,392,434,526,607,689,716,719,744,1208},
-{60,417,437,539,579,733,795,1209,-1,-1,-1},
-{104,265,333,383,386,489,628,757,790,1210,-1},
-{103,145,325,345,566,715,1211,-1,-1,-1,-1},
-{68,155,195,203,253,343,365,465,495,1212,-1},
-{333,407,440,529,638,1213,-1,-1,-1,-1,-1},
-{52,346,393,435,527,608,690,717,720,745,1214},
-{61,418,438,540,580,734,796,1215,-1,-1,-1},
-{105,266,334,384,387,490,629,758,791,1216,-1},
-{104,146,326,346,567,716,1217,-1,-1,-1,-1},
-{69,156,196,204,254,344,366,466,496,1218,-1},
-{334,408,441,530,639,1219,-1,-1,-1,-1,-1},
-{53,347,394,436,528,609,691,718,721,746,1220},
-{50,62,419,439,541,581,735,797,1221,-1,-1},
-{106,267,335,385,388,491,630,759,792,1222,-1},
-{105,147,327,347,568,717,1223,-1,-1,-1,-1},
-{70,157,197,205,255,345,367,467,497,1224,-1},
-{335,409,442,531,640,750,1225,-1,-1,-1,-1},
-{54,348,395,437,529,610,692,719,722,747,1226},
-{51,63,420,440,450,542,582,736,798,1227,-1},
-{107,268,336,386,389,492,631,760,793,1228,-1},
-{106,148,328,348,569,718,1229,-1,-1,-1,-1},
-{71,158,198,206,256,346,368,468,498,1230,-1},
-{336,410,443,532,641,751,1231,-1,-1,-1,-1},
-{55,349,396,438,530,611,693,720,723,748,1232},
-{52,64,421,441,451,543,583,737,799,1233,-1},
-{108,269,337,387,390,493,632,761,794,1234,-1},
-{107,149,329,349,570,719,1235,-1,-1,-1,-1},
-{72,159,199,207,250,257,347,369,469,499,1236},
-{337,411,444,533,642,752,1237,-1,-1,-1,-1},
-{56,397,439,531,612,694,721,724,749,1238,-1},
-{53,65,422,442,452,544,584,738,1239,-1,-1},
-{109,270,338,388,391,494,633,650,762,795,1240},
-{108,330,571,720,750,1241,-1,-1,-1,-1,-1},
-{73,160,208,251,258,348,370,470,1242,-1,-1},
-{338,412,445,534,643,753,1243,-1,-1,-1,-1},
-{57,398,440,532,613,695,722,725,1244,-1,-1},
-{54,66,423,443,453,545,585,739,1245,-1,-1},
-{110,271,339,389,392,495,634,651,763,796,1246},
-{109,331,572,721,751,1247,-1,-1,-1,-1,-1},
-{74,161,209,252,259,349,371,471,1248,-1,-1},
-{339,413,446,535,550,644,754,1249,-1,-1,-1},
-{58,399,441,533,614,696,723,726,1250,-1,-1},
-{55,67,424,444,454,546,586,740,1251,-1,-1},
-{111,272,340,390,393,496,635,652,764,797,1252},
-{110,332,573,722,752,1253,-1,-1,-1,-1,-1},
-{75,162,210,253,260,372,472,1254,-1,-1,-1},
-{340,414,447,536,551,645,755,1255,-1,-1,-1},
-{59,442,534,615,697,724,727,1256,-1,-1,-1},
-{56,68,425,445,455,547,587,741,1257,-1,-1},
-{112,273,341,391,394,497,636,653,765,798,1258},
-{111,333,574,723,753,1259,-1,-1,-1,-1,-1},
-{76,163,211,254,261,373,450,473,1260,-1,-1},
-{341,415,448,537,552,646,756,1261,-1,-1,-1},
-{60,443,535,616,698,725,728,1262,-1,-1,-1},
-{57,69,426,446,456,548,588,742,1263,-1,-1},
-{113,274,342,392,395,498,637,654,766,799,1264},
-{112,334,575,724,754,1265,-1,-1,-1,-1,-1},
-{77,164,212,255,262,374,451,474,1266,-1,-1},
-{342,416,449,538,553,647,757,1267,-1,-1,-1},
-{61,444,536,617,699,726,729,1268,-1,-1,-1},
-{58,70,427,447,457,549,589,600,743,1269,-1},
-{114,275,343,393,396,499,638,655,767,1270,-1},
-{113,335,576,725,755,1271,-1,-1,-1,-1,-1},
-{78,165,213,256,263,375,452,475,1272,-1,-1},
-{343,417,500,539,554,648,758,1273,-1,-1,-1},
-{62,445,537,618,727,730,1274,-1,-1,-1,-1},
-{59,71,428,448,458,590,601,744,1275,-1,-1},
-{115,276,344,394,397,639,656,768,1276,-1,-1},
-{114,336,577,726,756,1277,-1,-1,-1,-1,-1},
-{79,166,214,257,264,376,453,476,1278,-1,-1},
-{344,418,501,540,555,649,759,1279,-1,-1,-1},
-{63,446,538,619,728,731,1280,-1,-1,-1,-1},
-{60,72,429,449,459,591,602,745,1281,-1,-1},
-{116,277,345,395,398,640,657,769,1282,-1,-1},
-{115,337,578,727,757,1283,-1,-1,-1,-1,-1},
-{80,167,215,258,265,377,454,477,1284,-1,-1},
-{345,419,502,541,556,760,1285,-1,-1,-1,-1},
-{64,400,447,539,620,729,732,1286,-1,-1,-1},
-{61,73,430,460,592,603,746,1287,-1,-1,-1},
-{117,278,346,396,399,641,658,770,1288,-1,-1},
-{116,338,579,728,758,1289,-1,-1,-1,-1,-1},
-{81,168,216,259,266,378,455,478,1290,-1,-1},
-{346,420,503,542,557,761,1291,-1,-1,-1,-1},
-{65,401,448,540,621,730,733,1292,-1,-1,-1},
-{62,74,431,461,593,604,747,1293,-1,-1,-1},
-{118,279,347,397,642,659,771,1294,-1,-1,-1},
-{117,339,580,729,759,1295,-1,-1,-1,-1,-1},
-{82,169,217,260,267,379,456,479,1296,-1,-1},
-{347,421,504,543,558,762,1297,-1,-1,-1,-1},
-{66,402,449,541,622,731,734,1298,-1,-1,-1},
-{63,75,432,462,594,605,748,1299,-1,-1,-1},
-{119,280,348,398,643,660,772,1300,-1,-1,-1},
-{118,340,581,730,760,1301,-1,-1,-1,-1,-1},
-{83,170,218,261,268,380,457,480,1302,-1,-1},
-{0,348,422,505,544,559,763,1303,-1,-1,-1},
-{67,403,542,623,732,735,1304,-1,-1,-1,-1},
-{64,76,433,463,595,606,749,1305,-1,-1,-1},
-{120,281,349,399,644,661,773,1306,-1,-1,-1},
-{119,341,582,731,761,1307,-1,-1,-1,-1,-1},
-{84,171,219,262,269,381,458,481,1308,-1,-1},
-{1,349,423,506,545,560,764,1309,-1,-1,-1},
-{68,404,543,624,733,736,1310,-1,-1,-1,-1},
-{65,77,434,464,596,607,1311,-1,-1,-1,-1},
-{121,282,645,662,774,1312,-1,-1,-1,-1,-1},
-{120,342,583,732,762,1313,-1,-1,-1,-1,-1},
-{85,172,220,263,270,382,459,482,500,650,1314},
-{2,424,507,546,561,765,1315,-1,-1,-1,-1},
-{69,405,544,625,734,737,1316,-1,-1,-1,-1},
-{66,78,435,465,597,608,1317,-1,-1,-1,-1},
-{122,283,646,663,775,1318,-1,-1,-1,-1,-1},
-{121,343,584,733,763,1319,-1,-1,-1,-1,-1},
-{86,173,221,264,271,383,460,483,501,651,1320},
-{3,425,508,547,562,766,1321,-1,-1,-1,-1},
-{70,406,545,626,735,738,1322,-1,-1,-1,-1},
-{67,79,436,466,598,609,1323,-1,-1,-1,-1},
-{123,284,647,664,776,1324,-1,-1,-1,-1,-1},
-{122,344,585,734,764,1325,-1,-1,-1,-1,-1},
-{87,174,222,265,272,384,461,484,502,652,1326},
-{4,426,509,548,563,767,1327,-1,-1,-1,-1},
-{71,407,546,627,736,739,1328,-1,-1,-1,-1},
-{68,80,437,467,599,610,1329,-1,-1,-1,-1},
-{124,285,648,665,777,1330,-1,-1,-1,-1,-1},
-{123,345,586,735,765,1331,-1,-1,-1,-1,-1},
-{88,175,223,266,273,385,462,485,503,653,1332},
-{5,427,510,549,564,768,1333,-1,-1,-1,-1},
-{72,408,547,628,737,740,1334,-1,-1,-1,-1},
-{69,81,438,468,611,1335,-1,-1,-1,-1,-1},
-{125,286,649,666,778,1336,-1,-1,-1,-1,-1},
-{124,346,587,736,766,1337,-1,-1,-1,-1,-1},
-{89,176,224,267,274,386,463,486,504,654,1338},
-{6,428,511,565,769,1339,-1,-1,-1,-1,-1},
-{73,409,548,629,738,741,1340,-1,-1,-1,-1},
-{70,82,439,469,612,1341,-1,-1,-1,-1,-1},
-{126,287,667,779,1342,-1,-1,-1,-1,-1,-1},
-{125,347,588,737,767,1343,-1,-1,-1,-1,-1},
-{90,177,225,268,275,387,464,487,505,655,1344},
-{7,429,512,566,770,1345,-1,-1,-1,-1,-1},
-{74,410,549,630,739,742,1346,-1,-1,-1,-1},
-{71,83,440,470,613,1347,-1,-1,-1,-1,-1},
-{127,288,500,668,780,1348,-1,-1,-1,-1,-1},
-{126,348,589,738,768,1349,-1,-1,-1,-1,-1},
-{91,178,226,269,276,388,465,488,506,656,1350},
-{8,430,513,567,771,1351,-1,-1,-1,-1,-1},
-{75,411,631,740,743,750,1352,-1,-1,-1,-1},
-{72,84,441,471,614,1353,-1,-1,-1,-1,-1},
-{128,289,501,669,781,1354,-1,-1,-1,-1,-1},
-{127,349,590,739,769,1355,-1,-1,-1,-1,-1},
-{92,179,227,270,277,389,466,489,507,657,1356},
-{9,431,514,568,772,1357,-1,-1,-1,-1,-1},
-{76,412,632,741,744,751,1358,-1,-1,-1,-1},
-{73,85,442,472,615,1359,-1,-1,-1,-1,-1},
-{129,290,502,670,782,1360,-1,-1,-1,-1,-1},
-{128,591,740,770,1361,-1,-1,-1,-1,-1,-1},
-{93,180,228,271,278,390,467,490,508,658,1362},
-{10,432,515,569,773,1363,-1,-1,-1,-1,-1},
-{77,413,633,742,745,752,1364,-1,-1,-1,-1},
-{74,86,443,473,616,1365,-1,-1,-1,-1,-1},
-{130,291,503,671,783,1366,-1,-1,-1,-1,-1},
-{129,592,741,771,1367,-1,-1,-1,-1,-1,-1},
-{94,181,229,272,279,391,468,491,509,659,1368},
-{11,433,516,570,774,1369,-1,-1,-1,-1,-1},
-{78,414,634,743,746,753,1370,-1,-1,-1,-1},
-{75,87,350,444,474,617,1371,-1,-1,-1,-1},
-{131,292,504,672,784,1372,-1,-1,-1,-1,-1},
-{130,593,742,772,1373,-1,-1,-1,-1,-1,-1},
-{95,182,230,273,280,392,469,492,510,660,1374},
-{12,434,517,571,775,1375,-1,-1,-1,-1,-1},
-{79,415,635,744,747,754,1376,-1,-1,-1,-1},
-{76,88,351,445,475,618,1377,-1,-1,-1,-1},
-{132,293,505,673,785,1378,-1,-1,-1,-1,-1},
-{131,594,743,773,1379,-1,-1,-1,-1,-1,-1},
-{96,183,231,274,281,393,470,493,511,661,1380},
-{13,435,518,572,776,1381,-1,-1,-1,-1,-1},
-{80,416,636,745,748,755,1382,-1,-1,-1,-1},
-{77,89,352,446,476,619,1383,-1,-1,-1,-1},
-{133,294,506,674,786,1384,-1,-1,-1,-1,-1},
-{132,595,744,774,1385,-1,-1,-1,-1,-1,-1},
-{97,184,232,275,282,394,471,494,512,662,1386},
-{14,436,519,573,777,1387,-1,-1,-1,-1,-1},
-{81,417,637,746,749,756,1388,-1,-1,-1,-1},
-{78,90,353,447,477,620,1389,-1,-1,-1,-1},
-{134,295,507,675,787,1390,-1,-1,-1,-1,-1},
-{133,596,745,775,1391,-1,-1,-1,-1,-1,-1},
-{98,185,233,276,283,395,472,495,513,663,1392},
-{15,200,437,520,574,778,1393,-1,-1,-1,-1},
-{82,418,638,747,757,1394,-1,-1,-1,-1,-1},
-{79,91,354,448,478,621,1395,-1,-1,-1,-1},
-{135,296,508,676,788,1396,-1,-1,-1,-1,-1},
-{134,597,746,776,1397,-1,-1,-1,-1,-1,-1},
-{99,186,234,277,284,396,473,496,514,664,1398},
-{16,201,438,521,575,779,1399,-1,-1,-1,-1},
-{83,419,639,748,758,1400,-1,-1,-1,-1,-1},
-{80,92,355,449,479,622,1401,-1,-1,-1,-1},
-{136,297,509,677,789,1402,-1,-1,-1,-1,-1},
-{135,598,747,777,1403,-1,-1,-1,-1,-1,-1},
-{187,235,278,285,397,474,497,515,665,1404,-1},
-{17,202,439,522,576,780,1405,-1,-1,-1,-1},
-{84,400,420,640,749,759,1406,-1,-1,-1,-1},
-{81,93,356,480,623,1407,-1,-1,-1,-1,-1},
-{137,298,510,550,678,790,1408,-1,-1,-1,-1},
-{136,599,748,778,1409,-1,-1,-1,-1,-1,-1},
-{188,236,279,286,398,475,498,516,666,1410,-1},
-{18,203,440,523,577,781,1411,-1,-1,-1,-1},
-{85,401,421,641,760,1412,-1,-1,-1,-1,-1},
-{82,94,100,357,481,550,624,1413,-1,-1,-1},
-{138,299,511,551,679,791,1414,-1,-1,-1,-1},
-{137,749,779,1415,-1,-1,-1,-1,-1,-1,-1},
-{189,237,280,287,399,476,499,517,667,1416,-1},
-{19,204,350,441,524,578,782,1417,-1,-1,-1},
-{86,402,422,642,761,1418,-1,-1,-1,-1,-1},
-{83,95,101,358,482,551,625,1419,-1,-1,-1},
-{139,512,552,680,792,1420,-1,-1,-1,-1,-1},
-{138,780,1421,-1,-1,-1,-1,-1,-1,-1,-1},
-{190,238,281,288,477,518,668,1422,-1,-1,-1},
-{20,205,351,442,525,579,783,1423,-1,-1,-1},
-{87,403,423,643,762,1424,-1,-1,-1,-1,-1},
-{84,96,102,359,483,552,626,1425,-1,-1,-1},
-{140,513,553,681,793,1426,-1,-1,-1,-1,-1},
-{139,781,1427,-1,-1,-1,-1,-1,-1,-1,-1},
-{191,239,282,289,478,519,669,1428,-1,-1,-1},
-{21,206,352,443,526,580,784,1429,-1,-1,-1},
-{88,404,424,644,763,1430,-1,-1,-1,-1,-1},
-{85,97,103,360,484,553,627,1431,-1,-1,-1},
-{141,514,554,682,794,1432,-1,-1,-1,-1,-1},
-{140,782,1433,-1,-1,-1,-1,-1,-1,-1,-1},
-{192,240,283,290,479,520,670,1434,-1,-1,-1},
-{22,207,353,444,527,581,785,1435,-1,-1,-1},
-{89,405,425,645,764,1436,-1,-1,-1,-1,-1},
-{86,98,104,361,485,554,628,1437,-1,-1,-1},
-{142,515,555,683,795,1438,-1,-1,-1,-1,-1},
-{141,783,1439,-1,-1,-1,-1,-1,-1,-1,-1},
-{193,241,284,291,480,521,671,1440,-1,-1,-1},
-{23,208,354,445,528,582,786,1441,-1,-1,-1},
-{90,406,426,646,765,1442,-1,-1,-1,-1,-1},
-{87,99,105,362,486,555,629,1443,-1,-1,-1},
-{143,516,556,684,796,1444,-1,-1,-1,-1,-1},
-{142,784,1445,-1,-1,-1,-1,-1,-1,-1,-1},
-{194,242,285,292,481,522,672,1446,-1,-1,-1},
-{24,209,355,446,529,583,787,1447,-1,-1,-1},
-{91,407,427,647,766,1448,-1,-1,-1,-1,-1},
-{88,106,363,487,556,630,1449,-1,-1,-1,-1},
-{144,517,557,685,797,1450,-1,-1,-1,-1,-1},
-{143,785,1451,-1,-1,-1,-1,-1,-1,-1,-1},
-{195,243,286,293,482,523,673,1452,-1,-1,-1},
-{25,210,356,447,530,584,788,1453,-1,-1,-1},
-{92,408,428,648,767,1454,-1,-1,-1,-1,-1},
-{89,107,364,488,557,631,1455,-1,-1,-1,-1},
-{145,518,558,686,798,1456,-1,-1,-1,-1,-1},
-{144,786,1457,-1,-1,-1,-1,-1,-1,-1,-1},
-{196,244,287,294,483,524,674,1458,-1,-1,-1},
-{26,211,357,448,531,585,789,1459,-1,-1,-1},
-{93,409,429,649,768,1460,-1,-1,-1,-1,-1},
-{90,108,365,489,558,632,1461,-1,-1,-1,-1},
-{146,150,519,559,687,799,1462,-1,-1,-1,-1},
-{145,787,1463,-1,-1,-1,-1,-1,-1,-1,-1},
-{100,197,245,288,295,484,525,675,1464,-1,-1},
-{27,212,358,449,532,586,790,1465,-1,-1,-1},
-{94,410,430,769,1466,-1,-1,-1,-1,-1,-1},
-{91,109,366,490,559,633,1467,-1,-1,-1,-1},
-{147,151,520,560,688,750,1468,-1,-1,-1,-1},
-{146,300,788,1469,-1,-1,-1,-1,-1,-1,-1},
-{101,198,246,289,296,485,526,676,1470,-1,-1},
-{28,213,359,533,587,791,1471,-1,-1,-1,-1},
-{95,411,431,770,1472,-1,-1,-1,-1,-1,-1},
-{92,110,367,491,560,634,1473,-1,-1,-1,-1},
-{148,152,521,561,689,751,1474,-1,-1,-1,-1},
-{147,301,789,1475,-1,-1,-1,-1,-1,-1,-1},
-{102,199,247,290,297,486,527,677,1476,-1,-1},
-{29,214,360,534,588,792,1477,-1,-1,-1,-1},
-{96,412,432,771,1478,-1,-1,-1,-1,-1,-1},
-{93,111,368,492,561,635,1479,-1,-1,-1,-1},
-{149,153,522,562,690,752,1480,-1,-1,-1,-1},
-{148,302,790,1481,-1,-1,-1,-1,-1,-1,-1},
-{103,248,291,298,487,528,678,1482,-1,-1,-1},
-{30,215,361,535,589,793,1483,-1,-1,-1,-1},
-{97,350,413,433,772,1484,-1,-1,-1,-1,-1},
-{94,112,369,493,562,636,1485,-1,-1,-1,-1},
-{154,200,523,563,691,753,1486,-1,-1,-1,-1},
-{149,303,791,1487,-1,-1,-1,-1,-1,-1,-1},
-{50,104,249,292,299,488,529,679,1488,-1,-1},
-{31,216,362,536,590,794,1489,-1,-1,-1,-1},
-{98,351,414,434,773,1490,-1,-1,-1,-1,-1},
-{95,113,370,494,563,637,1491,-1,-1,-1,-1},
-{155,201,524,564,692,754,1492,-1,-1,-1,-1},
-{304,792,1493,-1,-1,-1,-1,-1,-1,-1,-1},
-{51,105,293,489,530,680,1494,-1,-1,-1,-1},
-{0,32,217,363,537,591,795,1495,-1,-1,-1},
-{99,352,415,435,774,1496,-1,-1,-1,-1,-1},
-{96,114,371,495,564,638,1497,-1,-1,-1,-1},
-{156,202,525,565,693,755,1498,-1,-1,-1,-1},
-{305,793,1499,-1,-1,-1,-1,-1,-1,-1,-1},
-{52,106,294,490,531,681,1500,-1,-1,-1,-1},
-{1,33,218,364,538,592,796,1501,-1,-1,-1},
-{353,416,436,775,1502,-1,-1,-1,-1,-1,-1},
-{97,115,372,496,565,639,1503,-1,-1,-1,-1},
-{157,203,526,566,694,756,1504,-1,-1,-1,-1},
-{306,794,1505,-1,-1,-1,-1,-1,-1,-1,-1},
-{53,107,295,491,532,682,1506,-1,-1,-1,-1},
-{2,34,219,365,539,593,797,1507,-1,-1,-1},
-{50,354,417,437,776,1508,-1,-1,-1,-1,-1},
-{98,116,373,497,566,640,1509,-1,-1,-1,-1},
-{158,204,527,567,695,757,1510,-1,-1,-1,-1},
-{307,600,795,1511,-1,-1,-1,-1,-1,-1,-1},
-{54,108,296,492,533,683,1512,-1,-1,-1,-1},
-{3,35,220,366,540,594,798,1513,-1,-1,-1},
-{51,355,418,438,777,1514,-1,-1,-1,-1,-1},
-{99,117,374,498,567,641,1515,-1,-1,-1,-1},
-{159,205,528,568,696,758,1516,-1,-1,-1,-1},
-{308,601,796,1517,-1,-1,-1,-1,-1,-1,-1},
-{55,109,297,493,534,684,1518,-1,-1,-1,-1},
-{4,36,221,367,541,595,799,1519,-1,-1,-1},
-{52,356,419,439,778,1520,-1,-1,-1,-1,-1},
-{118,375,499,568,642,1521,-1,-1,-1,-1,-1},
-{160,206,529,569,697,759,1522,-1,-1,-1,-1},
-{309,602,797,1523,-1,-1,-1,-1,-1,-1,-1},
-{56,110,298,494,535,685,1524,-1,-1,-1,-1},
-{5,37,222,368,542,596,1525,-1,-1,-1,-1},
-{53,357,420,440,779,1526,-1,-1,-1,-1,-1},
-{119,376,569,643,1527,-1,-1,-1,-1,-1,-1},
-{161,207,530,570,698,760,1528,-1,-1,-1,-1},
-{310,603,798,1529,-1,-1,-1,-1,-1,-1,-1},
-{57,111,299,495,536,686,1530,-1,-1,-1,-1},
-{6,38,223,369,543,597,1531,-1,-1,-1,-1},
-{54,358,421,441,780,1532,-1,-1,-1,-1,-1},
-{120,377,570,644,1533,-1,-1,-1,-1,-1,-1},
-{162,208,531,571,699,761,1534,-1,-1,-1,-1},
-{311,604,799,1535,-1,-1,-1,-1,-1,-1,-1},
-{58,112,496,537,687,1536,-1,-1,-1,-1,-1},
-{7,39,224,370,544,598,1537,-1,-1,-1,-1},
-{55,359,422,442,781,1538,-1,-1,-1,-1,-1},
-{121,378,571,645,1539,-1,-1,-1,-1,-1,-1},
-{163,209,532,572,762,1540,-1,-1,-1,-1,-1},
-{312,605,1541,-1,-1,-1,-1,-1,-1,-1,-1},
-{59,113,200,497,538,688,1542,-1,-1,-1,-1},
-{8,40,225,371,545,599,1543,-1,-1,-1,-1},
-{56,360,423,443,782,1544,-1,-1,-1,-1,-1},
-{122,379,572,646,1545,-1,-1,-1,-1,-1,-1},
-{164,210,533,573,763,1546,-1,-1,-1,-1,-1},
-{313,606,1547,-1,-1,-1,-1,-1,-1,-1,-1},
-{60,114,201,498,539,689,1548,-1,-1,-1,-1},
-{9,41,226,372,546,1549,-1,-1,-1,-1,-1},
-{57,361,424,444,783,1550,-1,-1,-1,-1,-1},
-{123,380,573,647,1551,-1,-1,-1,-1,-1,-1},
-{165,211,534,574,764,1552,-1,-1,-1,-1,-1},
-{314,607,1553,-1,-1,-1,-1,-1,-1,-1,-1},
-{61,115,202,499,540,690,1554,-1,-1,-1,-1},
-{10,42,227,373,547,1555,-1,-1,-1,-1,-1},
-{58,362,425,445,784,1556,-1,-1,-1,-1,-1},
-{124,381,574,648,1557,-1,-1,-1,-1,-1,-1},
-{166,212,535,575,765,1558,-1,-1,-1,-1,-1},
-{315,608,1559,-1,-1,-1,-1,-1,-1,-1,-1},
-{62,116,203,541,691,1560,-1,-1,-1,-1,-1},
-{11,43,228,374,548,1561,-1,-1,-1,-1,-1},
-{59,363,426,446,785,1562,-1,-1,-1,-1,-1},
-{125,382,575,649,1563,-1,-1,-1,-1,-1,-1},
-{167,213,536,576,766,1564,-1,-1,-1,-1,-1},
-{316,609,1565,-1,-1,-1,-1,-1,-1,-1,-1},
-{63,117,204,542,692,1566,-1,-1,-1,-1,-1},
-{12,44,229,375,549,1567,-1,-1,-1,-1,-1},
-{60,364,427,447,786,1568,-1,-1,-1,-1,-1},
-{126,383,576,1569,-1,-1,-1,-1,-1,-1,-1},
-{168,214,537,577,767,1570,-1,-1,-1,-1,-1},
-{317,610,1571,-1,-1,-1,-1,-1,-1,-1,-1},
-{64,118,205,543,693,1572,-1,-1,-1,-1,-1},
-{13,45,230,376,1573,-1,-1,-1,-1,-1,-1},
-{61,365,428,448,787,1574,-1,-1,-1,-1,-1},
-{127,384,577,1575,-1,-1,-1,-1,-1,-1,-1},
-{169,215,538,578,768,1576,-1,-1,-1,-1,-1},
-{318,611,1577,-1,-1,-1,-1,-1,-1,-1,-1},
-{65,119,206,544,694,1578,-1,-1,-1,-1,-1},
-{14,46,231,377,1579,-1,-1,-1,-1,-1,-1},
-{62,366,429,449,788,1580,-1,-1,-1,-1,-1},
-{128,385,578,1581,-1,-1,-1,-1,-1,-1,-1},
-{170,216,539,579,769,1582,-1,-1,-1,-1,-1},
-{319,612,750,1583,-1,-1,-1,-1,-1,-1,-1},
-{66,120,207,545,695,1584,-1,-1,-1,-1,-1},
-{15,47,232,378,1585,-1,-1,-1,-1,-1,-1},
-{63,367,430,789,1586,-1,-1,-1,-1,-1,-1},
-{129,386,579,1587,-1,-1,-1,-1,-1,-1,-1},
-{171,217,540,580,770,1588,-1,-1,-1,-1,-1},
-{320,613,751,1589,-1,-1,-1,-1,-1,-1,-1},
-{67,121,208,546,696,1590,-1,-1,-1,-1,-1},
-{16,48,233,379,1591,-1,-1,-1,-1,-1,-1},
-{64,368,431,790,1592,-1,-1,-1,-1,-1,-1},
-{130,387,580,1593,-1,-1,-1,-1,-1,-1,-1},
-{172,218,541,581,771,1594,-1,-1,-1,-1,-1},
-{321,614,752,1595,-1,-1,-1,-1,-1,-1,-1},
-{68,122,209,547,697,1596,-1,-1,-1,-1,-1},
-{17,49,234,380,1597,-1,-1,-1,-1,-1,-1},
-{65,369,432,791,1598,-1,-1,-1,-1,-1,-1}};
-int mercury_normal_QCmatrixV_8_16[1600][8]={
-{41,504,696,-1,-1,-1,-1,-1},
-{47,510,702,-1,-1,-1,-1,-1},
-{53,516,708,-1,-1,-1,-1,-1},
-{59,522,714,-1,-1,-1,-1,-1},
-{65,528,720,-1,-1,-1,-1,-1},
-{71,534,726,-1,-1,-1,-1,-1},
-{77,540,732,-1,-1,-1,-1,-1},
-{83,546,738,-1,-1,-1,-1,-1},
-{89,552,744,-1,-1,-1,-1,-1},
-{95,558,750,-1,-1,-1,-1,-1},
-{101,564,756,-1,-1,-1,-1,-1},
-{107,570,762,-1,-1,-1,-1,-1},
-{113,576,768,-1,-1,-1,-1,-1},
-{119,582,774,-1,-1,-1,-1,-1},
-{125,588,780,-1,-1,-1,-1,-1},
-{131,594,786,-1,-1,-1,-1,-1},
-{137,600,792,-1,-1,-1,-1,-1},
-{143,606,798,-1,-1,-1,-1,-1},
-{149,612,4,-1,-1,-1,-1,-1},
-{155,618,10,-1,-1,-1,-1,-1},
-{161,624,16,-1,-1,-1,-1,-1},
-{167,630,22,-1,-1,-1,-1,-1},
-{173,636,28,-1,-1,-1,-1,-1},
-{179,642,34,-1,-1,-1,-1,-1},
-{185,648,40,-1,-1,-1,-1,-1},
-{191,654,46,-1,-1,-1,-1,-1},
-{197,660,52,-1,-1,-1,-1,-1},
-{203,666,58,-1,-1,-1,-1,-1},
-{209,672,64,-1,-1,-1,-1,-1},
-{215,678,70,-1,-1,-1,-1,-1},
-{221,684,76,-1,-1,-1,-1,-1},
-{227,690,82,-1,-1,-1,-1,-1},
-{233,696,88,-1,-1,-1,-1,-1},
-{239,702,94,-1,-1,-1,-1,-1},
-{245,708,100,-1,-1,-1,-1,-1},
-{251,714,106,-1,-1,-1,-1,-1},
-{257,720,112,-1,-1,-1,-1,-1},
-{263,726,118,-1,-1,-1,-1,-1},
-{269,732,124,-1,-1,-1,-1,-1},
-{275,738,130,-1,-1,-1,-1,-1},
-{281,744,136,-1,-1,-1,-1,-1},
-{287,750,142,-1,-1,-1,-1,-1},
-{293,756,148,-1,-1,-1,-1,-1},
-{299,762,154,-1,-1,-1,-1,-1},
-{305,768,160,-1,-1,-1,-1,-1},
-{311,774,166,-1,-1,-1,-1,-1},
-{317,780,172,-1,-1,-1,-1,-1},
-{323,786,178,-1,-1,-1,-1,-1},
-{329,792,184,-1,-1,-1,-1,-1},
-{335,798,190,-1,-1,-1,-1,-1},
-{64,305,350,403,422,689,709,-1},
-{70,311,356,409,428,695,715,-1},
-{76,317,362,415,434,701,721,-1},
-{82,323,368,421,440,707,727,-1},
-{88,329,374,427,446,713,733,-1},
-{94,335,380,433,452,719,739,-1},
-{100,341,386,439,458,725,745,-1},
-{106,347,392,445,464,731,751,-1},
-{112,353,398,451,470,737,757,-1},
-{118,359,404,457,476,743,763,-1},
-{124,365,410,463,482,749,769,-1},
-{130,371,416,469,488,755,775,-1},
-{136,377,422,475,494,761,781,-1},
-{142,383,428,481,500,767,787,-1},
-{148,389,434,487,506,773,793,-1},
-{154,395,440,493,512,779,799,-1},
-{160,401,446,499,518,785,5,-1},
-{166,407,452,505,524,791,11,-1},
-{172,413,458,511,530,797,17,-1},
-{178,419,464,517,536,3,23,-1},
-{184,425,470,523,542,9,29,-1},
-{190,431,476,529,548,15,35,-1},
-{196,437,482,535,554,21,41,-1},
-{202,443,488,541,560,27,47,-1},
-{208,449,494,547,566,33,53,-1},
-{214,455,500,553,572,39,59,-1},
-{220,461,506,559,578,45,65,-1},
-{226,467,512,565,584,51,71,-1},
-{232,473,518,571,590,57,77,-1},
-{238,479,524,577,596,63,83,-1},
-{244,485,530,583,602,69,89,-1},
-{250,491,536,589,608,75,95,-1},
-{256,497,542,595,614,81,101,-1},
-{262,503,548,601,620,87,107,-1},
-{268,509,554,607,626,93,113,-1},
-{274,515,560,613,632,99,119,-1},
-{280,521,566,619,638,105,125,-1},
-{286,527,572,625,644,111,131,-1},
-{292,533,578,631,650,117,137,-1},
-{298,539,584,637,656,123,143,-1},
-{304,545,590,643,662,129,149,-1},
-{310,551,596,649,668,135,155,-1},
-{316,557,602,655,674,141,161,-1},
-{322,563,608,661,680,147,167,-1},
-{328,569,614,667,686,153,173,-1},
-{334,575,620,673,692,159,179,-1},
-{340,581,626,679,698,165,185,-1},
-{346,587,632,685,704,171,191,-1},
-{352,593,638,691,710,177,197,-1},
-{358,599,644,697,716,183,203,-1},
-{23,142,387,394,614,665,-1,-1},
-{29,148,393,400,620,671,-1,-1},
-{35,154,399,406,626,677,-1,-1},
-{41,160,405,412,632,683,-1,-1},
-{47,166,411,418,638,689,-1,-1},
-{53,172,417,424,644,695,-1,-1},
-{59,178,423,430,650,701,-1,-1},
-{65,184,429,436,656,707,-1,-1},
-{71,190,435,442,662,713,-1,-1},
-{77,196,441,448,668,719,-1,-1},
-{83,202,447,454,674,725,-1,-1},
-{89,208,453,460,680,731,-1,-1},
-{95,214,459,466,686,737,-1,-1},
-{101,220,465,472,692,743,-1,-1},
-{107,226,471,478,698,749,-1,-1},
-{113,232,477,484,704,755,-1,-1},
-{119,238,483,490,710,761,-1,-1},
-{125,244,489,496,716,767,-1,-1},
-{131,250,495,502,722,773,-1,-1},
-{137,256,501,508,728,779,-1,-1},
-{143,262,507,514,734,785,-1,-1},
-{149,268,513,520,740,791,-1,-1},
-{155,274,519,526,746,797,-1,-1},
-{161,280,525,532,752,3,-1,-1},
-{167,286,531,538,758,9,-1,-1},
-{173,292,537,544,764,15,-1,-1},
-{179,298,543,550,770,21,-1,-1},
-{185,304,549,556,776,27,-1,-1},
-{191,310,555,562,782,33,-1,-1},
-{197,316,561,568,788,39,-1,-1},
-{203,322,567,574,794,45,-1,-1},
-{209,328,573,580,0,51,-1,-1},
-{215,334,579,586,6,57,-1,-1},
-{221,340,585,592,12,63,-1,-1},
-{227,346,591,598,18,69,-1,-1},
-{233,352,597,604,24,75,-1,-1},
-{239,358,603,610,30,81,-1,-1},
-{245,364,609,616,36,87,-1,-1},
-{251,370,615,622,42,93,-1,-1},
-{257,376,621,628,48,99,-1,-1},
-{263,382,627,634,54,105,-1,-1},
-{269,388,633,640,60,111,-1,-1},
-{275,394,639,646,66,117,-1,-1},
-{281,400,645,652,72,123,-1,-1},
-{287,406,651,658,78,129,-1,-1},
-{293,412,657,664,84,135,-1,-1},
-{299,418,663,670,90,141,-1,-1},
-{305,424,669,676,96,147,-1,-1},
-{311,430,675,682,102,153,-1,-1},
-{317,436,681,688,108,159,-1,-1},
-{2,36,383,143,663,-1,-1,-1},
-{8,42,389,149,669,-1,-1,-1},
-{14,48,395,155,675,-1,-1,-1},
-{20,54,401,161,681,-1,-1,-1},
-{26,60,407,167,687,-1,-1,-1},
-{32,66,413,173,693,-1,-1,-1},
-{38,72,419,179,699,-1,-1,-1},
-{44,78,425,185,705,-1,-1,-1},
-{50,84,431,191,711,-1,-1,-1},
-{56,90,437,197,717,-1,-1,-1},
-{62,96,443,203,723,-1,-1,-1},
-{68,102,449,209,729,-1,-1,-1},
-{74,108,455,215,735,-1,-1,-1},
-{80,114,461,221,741,-1,-1,-1},
-{86,120,467,227,747,-1,-1,-1},
-{92,126,473,233,753,-1,-1,-1},
-{98,132,479,239,759,-1,-1,-1},
-{104,138,485,245,765,-1,-1,-1},
-{110,144,491,251,771,-1,-1,-1},
-{116,150,497,257,777,-1,-1,-1},
-{122,156,503,263,783,-1,-1,-1},
-{128,162,509,269,789,-1,-1,-1},
-{134,168,515,275,795,-1,-1,-1},
-{140,174,521,281,1,-1,-1,-1},
-{146,180,527,287,7,-1,-1,-1},
-{152,186,533,293,13,-1,-1,-1},
-{158,192,539,299,19,-1,-1,-1},
-{164,198,545,305,25,-1,-1,-1},
-{170,204,551,311,31,-1,-1,-1},
-{176,210,557,317,37,-1,-1,-1},
-{182,216,563,323,43,-1,-1,-1},
-{188,222,569,329,49,-1,-1,-1},
-{194,228,575,335,55,-1,-1,-1},
-{200,234,581,341,61,-1,-1,-1},
-{206,240,587,347,67,-1,-1,-1},
-{212,246,593,353,73,-1,-1,-1},
-{218,252,599,359,79,-1,-1,-1},
-{224,258,605,365,85,-1,-1,-1},
-{230,264,611,371,91,-1,-1,-1},
-{236,270,617,377,97,-1,-1,-1},
-{242,276,623,383,103,-1,-1,-1},
-{248,282,629,389,109,-1,-1,-1},
-{254,288,635,395,115,-1,-1,-1},
-{260,294,641,401,121,-1,-1,-1},
-{266,300,647,407,127,-1,-1,-1},
-{272,306,653,413,133,-1,-1,-1},
-{278,312,659,419,139,-1,-1,-1},
-{284,318,665,425,145,-1,-1,-1},
-{290,324,671,431,151,-1,-1,-1},
-{296,330,677,437,157,-1,-1,-1},
-{395,594,687,743,-1,-1,-1,-1},
-{401,600,693,749,-1,-1,-1,-1},
-{407,606,699,755,-1,-1,-1,-1},
-{413,612,705,761,-1,-1,-1,-1},
-{419,618,711,767,-1,-1,-1,-1},
-{425,624,717,773,-1,-1,-1,-1},
-{431,630,723,779,-1,-1,-1,-1},
-{437,636,729,785,-1,-1,-1,-1},
-{443,642,735,791,-1,-1,-1,-1},
-{449,648,741,797,-1,-1,-1,-1},
-{455,654,747,3,-1,-1,-1,-1},
-{461,660,753,9,-1,-1,-1,-1},
-{467,666,759,15,-1,-1,-1,-1},
-{473,672,765,21,-1,-1,-1,-1},
-{479,678,771,27,-1,-1,-1,-1},
-{485,684,777,33,-1,-1,-1,-1},
-{491,690,783,39,-1,-1,-1,-1},
-{497,696,789,45,-1,-1,-1,-1},
-{503,702,795,51,-1,-1,-1,-1},
-{509,708,1,57,-1,-1,-1,-1},
-{515,714,7,63,-1,-1,-1,-1},
-{521,720,13,69,-1,-1,-1,-1},
-{527,726,19,75,-1,-1,-1,-1},
-{533,732,25,81,-1,-1,-1,-1},
-{539,738,31,87,-1,-1,-1,-1},
-{545,744,37,93,-1,-1,-1,-1},
-{551,750,43,99,-1,-1,-1,-1},
-{557,756,49,105,-1,-1,-1,-1},
-{563,762,55,111,-1,-1,-1,-1},
-{569,768,61,117,-1,-1,-1,-1},
-{575,774,67,123,-1,-1,-1,-1},
-{581,780,73,129,-1,-1,-1,-1},
-{587,786,79,135,-1,-1,-1,-1},
-{593,792,85,141,-1,-1,-1,-1},
-{599,798,91,147,-1,-1,-1,-1},
-{605,4,97,153,-1,-1,-1,-1},
-{611,10,103,159,-1,-1,-1,-1},
-{617,16,109,165,-1,-1,-1,-1},
-{623,22,115,171,-1,-1,-1,-1},
-{629,28,121,177,-1,-1,-1,-1},
-{635,34,127,183,-1,-1,-1,-1},
-{641,40,133,189,-1,-1,-1,-1},
-{647,46,139,195,-1,-1,-1,-1},
-{653,52,145,201,-1,-1,-1,-1},
-{659,58,151,207,-1,-1,-1,-1},
-{665,64,157,213,-1,-1,-1,-1},
-{671,70,163,219,-1,-1,-1,-1},
-{677,76,169,225,-1,-1,-1,-1},
-{683,82,175,231,-1,-1,-1,-1},
-{689,88,181,237,-1,-1,-1,-1},
-{21,395,437,321,-1,-1,-1,-1},
-{27,401,443,327,-1,-1,-1,-1},
-{33,407,449,333,-1,-1,-1,-1},
-{39,413,455,339,-1,-1,-1,-1},
-{45,419,461,345,-1,-1,-1,-1},
-{51,425,467,351,-1,-1,-1,-1},
-{57,431,473,357,-1,-1,-1,-1},
-{63,437,479,363,-1,-1,-1,-1},
-{69,443,485,369,-1,-1,-1,-1},
-{75,449,491,375,-1,-1,-1,-1},
-{81,455,497,381,-1,-1,-1,-1},
-{87,461,503,387,-1,-1,-1,-1},
-{93,467,509,393,-1,-1,-1,-1},
-{99,473,515,399,-1,-1,-1,-1},
-{105,479,521,405,-1,-1,-1,-1},
-{111,485,527,411,-1,-1,-1,-1},
-{117,491,533,417,-1,-1,-1,-1},
-{123,497,539,423,-1,-1,-1,-1},
-{129,503,545,429,-1,-1,-1,-1},
-{135,509,551,435,-1,-1,-1,-1},
-{141,515,557,441,-1,-1,-1,-1},
-{147,521,563,447,-1,-1,-1,-1},
-{153,527,569,453,-1,-1,-1,-1},
-{159,533,575,459,-1,-1,-1,-1},
-{165,539,581,465,-1,-1,-1,-1},
-{171,545,587,471,-1,-1,-1,-1},
-{177,551,593,477,-1,-1,-1,-1},
-{183,557,599,483,-1,-1,-1,-1},
-{189,563,605,489,-1,-1,-1,-1},
-{195,569,611,495,-1,-1,-1,-1},
-{201,575,617,501,-1,-1,-1,-1},
-{207,581,623,507,-1,-1,-1,-1},
-{213,587,629,513,-1,-1,-1,-1},
-{219,593,635,519,-1,-1,-1,-1},
-{225,599,641,525,-1,-1,-1,-1},
-{231,605,647,531,-1,-1,-1,-1},
-{237,611,653,537,-1,-1,-1,-1},
-{243,617,659,543,-1,-1,-1,-1},
-{249,623,665,549,-1,-1,-1,-1},
-{255,629,671,555,-1,-1,-1,-1},
-{261,635,677,561,-1,-1,-1,-1},
-{267,641,683,567,-1,-1,-1,-1},
-{273,647,689,573,-1,-1,-1,-1},
-{279,653,695,579,-1,-1,-1,-1},
-{285,659,701,585,-1,-1,-1,-1},
-{291,665,707,591,-1,-1,-1,-1},
-{297,671,713,597,-1,-1,-1,-1},
-{303,677,719,603,-1,-1,-1,-1},
-{309,683,725,609,-1,-1,-1,-1},
-{315,689,731,615,-1,-1,-1,-1},
-{139,262,670,155,213,142,216,-1},
-{145,268,676,161,219,148,222,-1},
-{151,274,682,167,225,154,228,-1},
-{157,280,688,173,231,160,234,-1},
-{163,286,694,179,237,166,240,-1},
-{169,292,700,185,243,172,246,-1},
-{175,298,706,191,249,178,252,-1},
-{181,304,712,197,255,184,258,-1},
-{187,310,718,203,261,190,264,-1},
-{193,316,724,209,267,196,270,-1},
-{199,322,730,215,273,202,276,-1},
-{205,328,736,221,279,208,282,-1},
-{211,334,742,227,285,214,288,-1},
-{217,340,748,233,291,220,294,-1},
-{223,346,754,239,297,226,300,-1},
-{229,352,760,245,303,232,306,-1},
-{235,358,766,251,309,238,312,-1},
-{241,364,772,257,315,244,318,-1},
-{247,370,778,263,321,250,324,-1},
-{253,376,784,269,327,256,330,-1},
-{259,382,790,275,333,262,336,-1},
-{265,388,796,281,339,268,342,-1},
-{271,394,2,287,345,274,348,-1},
-{277,400,8,293,351,280,354,-1},
-{283,406,14,299,357,286,360,-1},
-{289,412,20,305,363,292,366,-1},
-{295,418,26,311,369,298,372,-1},
-{301,424,32,317,375,304,378,-1},
-{307,430,38,323,381,310,384,-1},
-{313,436,44,329,387,316,390,-1},
-{319,442,50,335,393,322,396,-1},
-{325,448,56,341,399,328,402,-1},
-{331,454,62,347,405,334,408,-1},
-{337,460,68,353,411,340,414,-1},
-{343,466,74,359,417,346,420,-1},
-{349,472,80,365,423,352,426,-1},
-{355,478,86,371,429,358,432,-1},
-{361,484,92,377,435,364,438,-1},
-{367,490,98,383,441,370,444,-1},
-{373,496,104,389,447,376,450,-1},
-{379,502,110,395,453,382,456,-1},
-{385,508,116,401,459,388,462,-1},
-{391,514,122,407,465,394,468,-1},
-{397,520,128,413,471,400,474,-1},
-{403,526,134,419,477,406,480,-1},
-{409,532,140,425,483,412,486,-1},
-{415,538,146,431,489,418,492,-1},
-{421,544,152,437,495,424,498,-1},
-{427,550,158,443,501,430,504,-1},
-{433,556,164,449,507,436,510,-1},
-{213,572,618,195,685,157,323,-1},
-{219,578,624,201,691,163,329,-1},
-{225,584,630,207,697,169,335,-1},
-{231,590,636,213,703,175,341,-1},
-{237,596,642,219,709,181,347,-1},
-{243,602,648,225,715,187,353,-1},
-{249,608,654,231,721,193,359,-1},
-{255,614,660,237,727,199,365,-1},
-{261,620,666,243,733,205,371,-1},
-{267,626,672,249,739,211,377,-1},
-{273,632,678,255,745,217,383,-1},
-{279,638,684,261,751,223,389,-1},
-{285,644,690,267,757,229,395,-1},
-{291,650,696,273,763,235,401,-1},
-{297,656,702,279,769,241,407,-1},
-{303,662,708,285,775,247,413,-1},
-{309,668,714,291,781,253,419,-1},
-{315,674,720,297,787,259,425,-1},
-{321,680,726,303,793,265,431,-1},
-{327,686,732,309,799,271,437,-1},
-{333,692,738,315,5,277,443,-1},
-{339,698,744,321,11,283,449,-1},
-{345,704,750,327,17,289,455,-1},
-{351,710,756,333,23,295,461,-1},
-{357,716,762,339,29,301,467,-1},
-{363,722,768,345,35,307,473,-1},
-{369,728,774,351,41,313,479,-1},
-{375,734,780,357,47,319,485,-1},
-{381,740,786,363,53,325,491,-1},
-{387,746,792,369,59,331,497,-1},
-{393,752,798,375,65,337,503,-1},
-{399,758,4,381,71,343,509,-1},
-{405,764,10,387,77,349,515,-1},
-{411,770,16,393,83,355,521,-1},
-{417,776,22,399,89,361,527,-1},
-{423,782,28,405,95,367,533,-1},
-{429,788,34,411,101,373,539,-1},
-{435,794,40,417,107,379,545,-1},
-{441,0,46,423,113,385,551,-1},
-{447,6,52,429,119,391,557,-1},
-{453,12,58,435,125,397,563,-1},
-{459,18,64,441,131,403,569,-1},
-{465,24,70,447,137,409,575,-1},
-{471,30,76,453,143,415,581,-1},
-{477,36,82,459,149,421,587,-1},
-{483,42,88,465,155,427,593,-1},
-{489,48,94,471,161,433,599,-1},
-{495,54,100,477,167,439,605,-1},
-{501,60,106,483,173,445,611,-1},
-{507,66,112,489,179,451,617,-1},
-{174,188,205,308,372,487,607,-1},
-{180,194,211,314,378,493,613,-1},
-{186,200,217,320,384,499,619,-1},
-{192,206,223,326,390,505,625,-1},
-{198,212,229,332,396,511,631,-1},
-{204,218,235,338,402,517,637,-1},
-{210,224,241,344,408,523,643,-1},
-{216,230,247,350,414,529,649,-1},
-{222,236,253,356,420,535,655,-1},
-{228,242,259,362,426,541,661,-1},
-{234,248,265,368,432,547,667,-1},
-{240,254,271,374,438,553,673,-1},
-{246,260,277,380,444,559,679,-1},
-{252,266,283,386,450,565,685,-1},
-{258,272,289,392,456,571,691,-1},
-{264,278,295,398,462,577,697,-1},
-{270,284,301,404,468,583,703,-1},
-{276,290,307,410,474,589,709,-1},
-{282,296,313,416,480,595,715,-1},
-{288,302,319,422,486,601,721,-1},
-{294,308,325,428,492,607,727,-1},
-{300,314,331,434,498,613,733,-1},
-{306,320,337,440,504,619,739,-1},
-{312,326,343,446,510,625,745,-1},
-{318,332,349,452,516,631,751,-1},
-{324,338,355,458,522,637,757,-1},
-{330,344,361,464,528,643,763,-1},
-{336,350,367,470,534,649,769,-1},
-{342,356,373,476,540,655,775,-1},
-{348,362,379,482,546,661,781,-1},
-{354,368,385,488,552,667,787,-1},
-{360,374,391,494,558,673,793,-1},
-{366,380,397,500,564,679,799,-1},
-{372,386,403,506,570,685,5,-1},
-{378,392,409,512,576,691,11,-1},
-{384,398,415,518,582,697,17,-1},
-{390,404,421,524,588,703,23,-1},
-{396,410,427,530,594,709,29,-1},
-{402,416,433,536,600,715,35,-1},
-{408,422,439,542,606,721,41,-1},
-{414,428,445,548,612,727,47,-1},
-{420,434,451,554,618,733,53,-1},
-{426,440,457,560,624,739,59,-1},
-{432,446,463,566,630,745,65,-1},
-{438,452,469,572,636,751,71,-1},
-{444,458,475,578,642,757,77,-1},
-{450,464,481,584,648,763,83,-1},
-{456,470,487,590,654,769,89,-1},
-{462,476,493,596,660,775,95,-1},
-{468,482,499,602,666,781,101,-1},
-{143,177,323,428,461,-1,-1,-1},
-{149,183,329,434,467,-1,-1,-1},
-{155,189,335,440,473,-1,-1,-1},
-{161,195,341,446,479,-1,-1,-1},
-{167,201,347,452,485,-1,-1,-1},
-{173,207,353,458,491,-1,-1,-1},
-{179,213,359,464,497,-1,-1,-1},
-{185,219,365,470,503,-1,-1,-1},
-{191,225,371,476,509,-1,-1,-1},
-{197,231,377,482,515,-1,-1,-1},
-{203,237,383,488,521,-1,-1,-1},
-{209,243,389,494,527,-1,-1,-1},
-{215,249,395,500,533,-1,-1,-1},
-{221,255,401,506,539,-1,-1,-1},
-{227,261,407,512,545,-1,-1,-1},
-{233,267,413,518,551,-1,-1,-1},
-{239,273,419,524,557,-1,-1,-1},
-{245,279,425,530,563,-1,-1,-1},
-{251,285,431,536,569,-1,-1,-1},
-{257,291,437,542,575,-1,-1,-1},
-{263,297,443,548,581,-1,-1,-1},
-{269,303,449,554,587,-1,-1,-1},
-{275,309,455,560,593,-1,-1,-1},
-{281,315,461,566,599,-1,-1,-1},
-{287,321,467,572,605,-1,-1,-1},
-{293,327,473,578,611,-1,-1,-1},
-{299,333,479,584,617,-1,-1,-1},
-{305,339,485,590,623,-1,-1,-1},
-{311,345,491,596,629,-1,-1,-1},
-{317,351,497,602,635,-1,-1,-1},
-{323,357,503,608,641,-1,-1,-1},
-{329,363,509,614,647,-1,-1,-1},
-{335,369,515,620,653,-1,-1,-1},
-{341,375,521,626,659,-1,-1,-1},
-{347,381,527,632,665,-1,-1,-1},
-{353,387,533,638,671,-1,-1,-1},
-{359,393,539,644,677,-1,-1,-1},
-{365,399,545,650,683,-1,-1,-1},
-{371,405,551,656,689,-1,-1,-1},
-{377,411,557,662,695,-1,-1,-1},
-{383,417,563,668,701,-1,-1,-1},
-{389,423,569,674,707,-1,-1,-1},
-{395,429,575,680,713,-1,-1,-1},
-{401,435,581,686,719,-1,-1,-1},
-{407,441,587,692,725,-1,-1,-1},
-{413,447,593,698,731,-1,-1,-1},
-{419,453,599,704,737,-1,-1,-1},
-{425,459,605,710,743,-1,-1,-1},
-{431,465,611,716,749,-1,-1,-1},
-{437,471,617,722,755,-1,-1,-1},
-{10,176,240,253,474,515,549,-1},
-{16,182,246,259,480,521,555,-1},
-{22,188,252,265,486,527,561,-1},
-{28,194,258,271,492,533,567,-1},
-{34,200,264,277,498,539,573,-1},
-{40,206,270,283,504,545,579,-1},
-{46,212,276,289,510,551,585,-1},
-{52,218,282,295,516,557,591,-1},
-{58,224,288,301,522,563,597,-1},
-{64,230,294,307,528,569,603,-1},
-{70,236,300,313,534,575,609,-1},
-{76,242,306,319,540,581,615,-1},
-{82,248,312,325,546,587,621,-1},
-{88,254,318,331,552,593,627,-1},
-{94,260,324,337,558,599,633,-1},
-{100,266,330,343,564,605,639,-1},
-{106,272,336,349,570,611,645,-1},
-{112,278,342,355,576,617,651,-1},
-{118,284,348,361,582,623,657,-1},
-{124,290,354,367,588,629,663,-1},
-{130,296,360,373,594,635,669,-1},
-{136,302,366,379,600,641,675,-1},
-{142,308,372,385,606,647,681,-1},
-{148,314,378,391,612,653,687,-1},
-{154,320,384,397,618,659,693,-1},
-{160,326,390,403,624,665,699,-1},
-{166,332,396,409,630,671,705,-1},
-{172,338,402,415,636,677,711,-1},
-{178,344,408,421,642,683,717,-1},
-{184,350,414,427,648,689,723,-1},
-{190,356,420,433,654,695,729,-1},
-{196,362,426,439,660,701,735,-1},
-{202,368,432,445,666,707,741,-1},
-{208,374,438,451,672,713,747,-1},
-{214,380,444,457,678,719,753,-1},
-{220,386,450,463,684,725,759,-1},
-{226,392,456,469,690,731,765,-1},
-{232,398,462,475,696,737,771,-1},
-{238,404,468,481,702,743,777,-1},
-{244,410,474,487,708,749,783,-1},
-{250,416,480,493,714,755,789,-1},
-{256,422,486,499,720,761,795,-1},
-{262,428,492,505,726,767,1,-1},
-{268,434,498,511,732,773,7,-1},
-{274,440,504,517,738,779,13,-1},
-{280,446,510,523,744,785,19,-1},
-{286,452,516,529,750,791,25,-1},
-{292,458,522,535,756,797,31,-1},
-{298,464,528,541,762,3,37,-1},
-{304,470,534,547,768,9,43,-1},
-{15,316,236,450,609,614,-1,-1},
-{21,322,242,456,615,620,-1,-1},
-{27,328,248,462,621,626,-1,-1},
-{33,334,254,468,627,632,-1,-1},
-{39,340,260,474,633,638,-1,-1},
-{45,346,266,480,639,644,-1,-1},
-{51,352,272,486,645,650,-1,-1},
-{57,358,278,492,651,656,-1,-1},
-{63,364,284,498,657,662,-1,-1},
-{69,370,290,504,663,668,-1,-1},
-{75,376,296,510,669,674,-1,-1},
-{81,382,302,516,675,680,-1,-1},
-{87,388,308,522,681,686,-1,-1},
-{93,394,314,528,687,692,-1,-1},
-{99,400,320,534,693,698,-1,-1},
-{105,406,326,540,699,704,-1,-1},
-{111,412,332,546,705,710,-1,-1},
-{117,418,338,552,711,716,-1,-1},
-{123,424,344,558,717,722,-1,-1},
-{129,430,350,564,723,728,-1,-1},
-{135,436,356,570,729,734,-1,-1},
-{141,442,362,576,735,740,-1,-1},
-{147,448,368,582,741,746,-1,-1},
-{153,454,374,588,747,752,-1,-1},
-{159,460,380,594,753,758,-1,-1},
-{165,466,386,600,759,764,-1,-1},
-{171,472,392,606,765,770,-1,-1},
-{177,478,398,612,771,776,-1,-1},
-{183,484,404,618,777,782,-1,-1},
-{189,490,410,624,783,788,-1,-1},
-{195,496,416,630,789,794,-1,-1},
-{201,502,422,636,795,0,-1,-1},
-{207,508,428,642,1,6,-1,-1},
-{213,514,434,648,7,12,-1,-1},
-{219,520,440,654,13,18,-1,-1},
-{225,526,446,660,19,24,-1,-1},
-{231,532,452,666,25,30,-1,-1},
-{237,538,458,672,31,36,-1,-1},
-{243,544,464,678,37,42,-1,-1},
-{249,550,470,684,43,48,-1,-1},
-{255,556,476,690,49,54,-1,-1},
-{261,562,482,696,55,60,-1,-1},
-{267,568,488,702,61,66,-1,-1},
-{273,574,494,708,67,72,-1,-1},
-{279,580,500,714,73,78,-1,-1},
-{285,586,506,720,79,84,-1,-1},
-{291,592,512,726,85,90,-1,-1},
-{297,598,518,732,91,96,-1,-1},
-{303,604,524,738,97,102,-1,-1},
-{309,610,530,744,103,108,-1,-1},
-{186,243,367,470,712,-1,-1,-1},
-{192,249,373,476,718,-1,-1,-1},
-{198,255,379,482,724,-1,-1,-1},
-{204,261,385,488,730,-1,-1,-1},
-{210,267,391,494,736,-1,-1,-1},
-{216,273,397,500,742,-1,-1,-1},
-{222,279,403,506,748,-1,-1,-1},
-{228,285,409,512,754,-1,-1,-1},
-{234,291,415,518,760,-1,-1,-1},
-{240,297,421,524,766,-1,-1,-1},
-{246,303,427,530,772,-1,-1,-1},
-{252,309,433,536,778,-1,-1,-1},
-{258,315,439,542,784,-1,-1,-1},
-{264,321,445,548,790,-1,-1,-1},
-{270,327,451,554,796,-1,-1,-1},
-{276,333,457,560,2,-1,-1,-1},
-{282,339,463,566,8,-1,-1,-1},
-{288,345,469,572,14,-1,-1,-1},
-{294,351,475,578,20,-1,-1,-1},
-{300,357,481,584,26,-1,-1,-1},
-{306,363,487,590,32,-1,-1,-1},
-{312,369,493,596,38,-1,-1,-1},
-{318,375,499,602,44,-1,-1,-1},
-{324,381,505,608,50,-1,-1,-1},
-{330,387,511,614,56,-1,-1,-1},
-{336,393,517,620,62,-1,-1,-1},
-{342,399,523,626,68,-1,-1,-1},
-{348,405,529,632,74,-1,-1,-1},
-{354,411,535,638,80,-1,-1,-1},
-{360,417,541,644,86,-1,-1,-1},
-{366,423,547,650,92,-1,-1,-1},
-{372,429,553,656,98,-1,-1,-1},
-{378,435,559,662,104,-1,-1,-1},
-{384,441,565,668,110,-1,-1,-1},
-{390,447,571,674,116,-1,-1,-1},
-{396,453,577,680,122,-1,-1,-1},
-{402,459,583,686,128,-1,-1,-1},
-{408,465,589,692,134,-1,-1,-1},
-{414,471,595,698,140,-1,-1,-1},
-{420,477,601,704,146,-1,-1,-1},
-{426,483,607,710,152,-1,-1,-1},
-{432,489,613,716,158,-1,-1,-1},
-{438,495,619,722,164,-1,-1,-1},
-{444,501,625,728,170,-1,-1,-1},
-{450,507,631,734,176,-1,-1,-1},
-{456,513,637,740,182,-1,-1,-1},
-{462,519,643,746,188,-1,-1,-1},
-{468,525,649,752,194,-1,-1,-1},
-{474,531,655,758,200,-1,-1,-1},
-{480,537,661,764,206,-1,-1,-1},
-{175,441,515,-1,-1,-1,-1,-1},
-{181,447,521,-1,-1,-1,-1,-1},
-{187,453,527,-1,-1,-1,-1,-1},
-{193,459,533,-1,-1,-1,-1,-1},
-{199,465,539,-1,-1,-1,-1,-1},
-{205,471,545,-1,-1,-1,-1,-1},
-{211,477,551,-1,-1,-1,-1,-1},
-{217,483,557,-1,-1,-1,-1,-1},
-{223,489,563,-1,-1,-1,-1,-1},
-{229,495,569,-1,-1,-1,-1,-1},
-{235,501,575,-1,-1,-1,-1,-1},
-{241,507,581,-1,-1,-1,-1,-1},
-{247,513,587,-1,-1,-1,-1,-1},
-{253,519,593,-1,-1,-1,-1,-1},
-{259,525,599,-1,-1,-1,-1,-1},
-{265,531,605,-1,-1,-1,-1,-1},
-{271,537,611,-1,-1,-1,-1,-1},
-{277,543,617,-1,-1,-1,-1,-1},
-{283,549,623,-1,-1,-1,-1,-1},
-{289,555,629,-1,-1,-1,-1,-1},
-{295,561,635,-1,-1,-1,-1,-1},
-{301,567,641,-1,-1,-1,-1,-1},
-{307,573,647,-1,-1,-1,-1,-1},
-{313,579,653,-1,-1,-1,-1,-1},
-{319,585,659,-1,-1,-1,-1,-1},
-{325,591,665,-1,-1,-1,-1,-1},
-{331,597,671,-1,-1,-1,-1,-1},
-{337,603,677,-1,-1,-1,-1,-1},
-{343,609,683,-1,-1,-1,-1,-1},
-{349,615,689,-1,-1,-1,-1,-1},
-{355,621,695,-1,-1,-1,-1,-1},
-{361,627,701,-1,-1,-1,-1,-1},
-{367,633,707,-1,-1,-1,-1,-1},
-{373,639,713,-1,-1,-1,-1,-1},
-{379,645,719,-1,-1,-1,-1,-1},
-{385,651,725,-1,-1,-1,-1,-1},
-{391,657,731,-1,-1,-1,-1,-1},
-{397,663,737,-1,-1,-1,-1,-1},
-{403,669,743,-1,-1,-1,-1,-1},
-{409,675,749,-1,-1,-1,-1,-1},
-{415,681,755,-1,-1,-1,-1,-1},
-{421,687,761,-1,-1,-1,-1,-1},
-{427,693,767,-1,-1,-1,-1,-1},
-{433,699,773,-1,-1,-1,-1,-1},
-{439,705,779,-1,-1,-1,-1,-1},
-{445,711,785,-1,-1,-1,-1,-1},
-{451,717,791,-1,-1,-1,-1,-1},
-{457,723,797,-1,-1,-1,-1,-1},
-{463,729,3,-1,-1,-1,-1,-1},
-{469,735,9,-1,-1,-1,-1,-1},
-{145,295,212,313,322,-1,-1,-1},
-{151,301,218,319,328,-1,-1,-1},
-{157,307,224,325,334,-1,-1,-1},
-{163,313,230,331,340,-1,-1,-1},
-{169,319,236,337,346,-1,-1,-1},
-{175,325,242,343,352,-1,-1,-1},
-{181,331,248,349,358,-1,-1,-1},
-{187,337,254,355,364,-1,-1,-1},
-{193,343,260,361,370,-1,-1,-1},
-{199,349,266,367,376,-1,-1,-1},
-{205,355,272,373,382,-1,-1,-1},
-{211,361,278,379,388,-1,-1,-1},
-{217,367,284,385,394,-1,-1,-1},
-{223,373,290,391,400,-1,-1,-1},
-{229,379,296,397,406,-1,-1,-1},
-{235,385,302,403,412,-1,-1,-1},
-{241,391,308,409,418,-1,-1,-1},
-{247,397,314,415,424,-1,-1,-1},
-{253,403,320,421,430,-1,-1,-1},
-{259,409,326,427,436,-1,-1,-1},
-{265,415,332,433,442,-1,-1,-1},
-{271,421,338,439,448,-1,-1,-1},
-{277,427,344,445,454,-1,-1,-1},
-{283,433,350,451,460,-1,-1,-1},
-{289,439,356,457,466,-1,-1,-1},
-{295,445,362,463,472,-1,-1,-1},
-{301,451,368,469,478,-1,-1,-1},
-{307,457,374,475,484,-1,-1,-1},
-{313,463,380,481,490,-1,-1,-1},
-{319,469,386,487,496,-1,-1,-1},
-{325,475,392,493,502,-1,-1,-1},
-{331,481,398,499,508,-1,-1,-1},
-{337,487,404,505,514,-1,-1,-1},
-{343,493,410,511,520,-1,-1,-1},
-{349,499,416,517,526,-1,-1,-1},
-{355,505,422,523,532,-1,-1,-1},
-{361,511,428,529,538,-1,-1,-1},
-{367,517,434,535,544,-1,-1,-1},
-{373,523,440,541,550,-1,-1,-1},
-{379,529,446,547,556,-1,-1,-1},
-{385,535,452,553,562,-1,-1,-1},
-{391,541,458,559,568,-1,-1,-1},
-{397,547,464,565,574,-1,-1,-1},
-{403,553,470,571,580,-1,-1,-1},
-{409,559,476,577,586,-1,-1,-1},
-{415,565,482,583,592,-1,-1,-1},
-{421,571,488,589,598,-1,-1,-1},
-{427,577,494,595,604,-1,-1,-1},
-{433,583,500,601,610,-1,-1,-1},
-{439,589,506,607,616,-1,-1,-1},
-{140,171,369,426,553,784,669,442},
-{146,177,375,432,559,790,675,448},
-{152,183,381,438,565,796,681,454},
-{158,189,387,444,571,2,687,460},
-{164,195,393,450,577,8,693,466},
-{170,201,399,456,583,14,699,472},
-{176,207,405,462,589,20,705,478},
-{182,213,411,468,595,26,711,484},
-{188,219,417,474,601,32,717,490},
-{194,225,423,480,607,38,723,496},
-{200,231,429,486,613,44,729,502},
-{206,237,435,492,619,50,735,508},
-{212,243,441,498,625,56,741,514},
-{218,249,447,504,631,62,747,520},
-{224,255,453,510,637,68,753,526},
-{230,261,459,516,643,74,759,532},
-{236,267,465,522,649,80,765,538},
-{242,273,471,528,655,86,771,544},
-{248,279,477,534,661,92,777,550},
-{254,285,483,540,667,98,783,556},
-{260,291,489,546,673,104,789,562},
-{266,297,495,552,679,110,795,568},
-{272,303,501,558,685,116,1,574},
-{278,309,507,564,691,122,7,580},
-{284,315,513,570,697,128,13,586},
-{290,321,519,576,703,134,19,592},
-{296,327,525,582,709,140,25,598},
-{302,333,531,588,715,146,31,604},
-{308,339,537,594,721,152,37,610},
-{314,345,543,600,727,158,43,616},
-{320,351,549,606,733,164,49,622},
-{326,357,555,612,739,170,55,628},
-{332,363,561,618,745,176,61,634},
-{338,369,567,624,751,182,67,640},
-{344,375,573,630,757,188,73,646},
-{350,381,579,636,763,194,79,652},
-{356,387,585,642,769,200,85,658},
-{362,393,591,648,775,206,91,664},
-{368,399,597,654,781,212,97,670},
-{374,405,603,660,787,218,103,676},
-{380,411,609,666,793,224,109,682},
-{386,417,615,672,799,230,115,688},
-{392,423,621,678,5,236,121,694},
-{398,429,627,684,11,242,127,700},
-{404,435,633,690,17,248,133,706},
-{410,441,639,696,23,254,139,712},
-{416,447,645,702,29,260,145,718},
-{422,453,651,708,35,266,151,724},
-{428,459,657,714,41,272,157,730},
-{434,465,663,720,47,278,163,736},
-{0,1,-1,-1,-1,-1,-1,-1},
-{1,2,-1,-1,-1,-1,-1,-1},
-{2,3,-1,-1,-1,-1,-1,-1},
-{3,4,-1,-1,-1,-1,-1,-1},
-{4,5,-1,-1,-1,-1,-1,-1},
-{5,6,-1,-1,-1,-1,-1,-1},
-{6,7,-1,-1,-1,-1,-1,-1},
-{7,8,-1,-1,-1,-1,-1,-1},
-{8,9,-1,-1,-1,-1,-1,-1},
-{9,10,-1,-1,-1,-1,-1,-1},
-{10,11,-1,-1,-1,-1,-1,-1},
-{11,12,-1,-1,-1,-1,-1,-1},
-{12,13,-1,-1,-1,-1,-1,-1},
-{13,14,-1,-1,-1,-1,-1,-1},
-{14,15,-1,-1,-1,-1,-1,-1},
-{15,16,-1,-1,-1,-1,-1,-1},
-{16,17,-1,-1,-1,-1,-1,-1},
-{17,18,-1,-1,-1,-1,-1,-1},
-{18,19,-1,-1,-1,-1,-1,-1},
-{19,20,-1,-1,-1,-1,-1,-1},
-{20,21,-1,-1,-1,-1,-1,-1},
-{21,22,-1,-1,-1,-1,-1,-1},
-{22,23,-1,-1,-1,-1,-1,-1},
-{23,24,-1,-1,-1,-1,-1,-1},
-{24,25,-1,-1,-1,-1,-1,-1},
-{25,26,-1,-1,-1,-1,-1,-1},
-{26,27,-1,-1,-1,-1,-1,-1},
-{27,28,-1,-1,-1,-1,-1,-1},
-{28,29,-1,-1,-1,-1,-1,-1},
-{29,30,-1,-1,-1,-1,-1,-1},
-{30,31,-1,-1,-1,-1,-1,-1},
-{31,32,-1,-1,-1,-1,-1,-1},
-{32,33,-1,-1,-1,-1,-1,-1},
-{33,34,-1,-1,-1,-1,-1,-1},
-{34,35,-1,-1,-1,-1,-1,-1},
-{35,36,-1,-1,-1,-1,-1,-1},
-{36,37,-1,-1,-1,-1,-1,-1},
-{37,38,-1,-1,-1,-1,-1,-1},
-{38,39,-1,-1,-1,-1,-1,-1},
-{39,40,-1,-1,-1,-1,-1,-1},
-{40,41,-1,-1,-1,-1,-1,-1},
-{41,42,-1,-1,-1,-1,-1,-1},
-{42,43,-1,-1,-1,-1,-1,-1},
-{43,44,-1,-1,-1,-1,-1,-1},
-{44,45,-1,-1,-1,-1,-1,-1},
-{45,46,-1,-1,-1,-1,-1,-1},
-{46,47,-1,-1,-1,-1,-1,-1},
-{47,48,-1,-1,-1,-1,-1,-1},
-{48,49,-1,-1,-1,-1,-1,-1},
-{49,50,-1,-1,-1,-1,-1,-1},
-{50,51,-1,-1,-1,-1,-1,-1},
-{51,52,-1,-1,-1,-1,-1,-1},
-{52,53,-1,-1,-1,-1,-1,-1},
-{53,54,-1,-1,-1,-1,-1,-1},
-{54,55,-1,-1,-1,-1,-1,-1},
-{55,56,-1,-1,-1,-1,-1,-1},
-{56,57,-1,-1,-1,-1,-1,-1},
-{57,58,-1,-1,-1,-1,-1,-1},
-{58,59,-1,-1,-1,-1,-1,-1},
-{59,60,-1,-1,-1,-1,-1,-1},
-{60,61,-1,-1,-1,-1,-1,-1},
-{61,62,-1,-1,-1,-1,-1,-1},
-{62,63,-1,-1,-1,-1,-1,-1},
-{63,64,-1,-1,-1,-1,-1,-1},
-{64,65,-1,-1,-1,-1,-1,-1},
-{65,66,-1,-1,-1,-1,-1,-1},
-{66,67,-1,-1,-1,-1,-1,-1},
-{67,68,-1,-1,-1,-1,-1,-1},
-{68,69,-1,-1,-1,-1,-1,-1},
-{69,70,-1,-1,-1,-1,-1,-1},
-{70,71,-1,-1,-1,-1,-1,-1},
-{71,72,-1,-1,-1,-1,-1,-1},
-{72,73,-1,-1,-1,-1,-1,-1},
-{73,74,-1,-1,-1,-1,-1,-1},
-{74,75,-1,-1,-1,-1,-1,-1},
-{75,76,-1,-1,-1,-1,-1,-1},
-{76,77,-1,-1,-1,-1,-1,-1},
-{77,78,-1,-1,-1,-1,-1,-1},
-{78,79,-1,-1,-1,-1,-1,-1},
-{79,80,-1,-1,-1,-1,-1,-1},
-{80,81,-1,-1,-1,-1,-1,-1},
-{81,82,-1,-1,-1,-1,-1,-1},
-{82,83,-1,-1,-1,-1,-1,-1},
-{83,84,-1,-1,-1,-1,-1,-1},
-{84,85,-1,-1,-1,-1,-1,-1},
-{85,86,-1,-1,-1,-1,-1,-1},
-{86,87,-1,-1,-1,-1,-1,-1},
-{87,88,-1,-1,-1,-1,-1,-1},
-{88,89,-1,-1,-1,-1,-1,-1},
-{89,90,-1,-1,-1,-1,-1,-1},
-{90,91,-1,-1,-1,-1,-1,-1},
-{91,92,-1,-1,-1,-1,-1,-1},
-{92,93,-1,-1,-1,-1,-1,-1},
-{93,94,-1,-1,-1,-1,-1,-1},
-{94,95,-1,-1,-1,-1,-1,-1},
-{95,96,-1,-1,-1,-1,-1,-1},
-{96,97,-1,-1,-1,-1,-1,-1},
-{97,98,-1,-1,-1,-1,-1,-1},
-{98,99,-1,-1,-1,-1,-1,-1},
-{99,100,-1,-1,-1,-1,-1,-1},
-{100,101,-1,-1,-1,-1,-1,-1},
-{101,102,-1,-1,-1,-1,-1,-1},
-{102,103,-1,-1,-1,-1,-1,-1},
-{103,104,-1,-1,-1,-1,-1,-1},
-{104,105,-1,-1,-1,-1,-1,-1},
-{105,106,-1,-1,-1,-1,-1,-1},
-{106,107,-1,-1,-1,-1,-1,-1},
-{107,108,-1,-1,-1,-1,-1,-1},
-{108,109,-1,-1,-1,-1,-1,-1},
-{109,110,-1,-1,-1,-1,-1,-1},
-{110,111,-1,-1,-1,-1,-1,-1},
-{111,112,-1,-1,-1,-1,-1,-1},
-{112,113,-1,-1,-1,-1,-1,-1},
-{113,114,-1,-1,-1,-1,-1,-1},
-{114,115,-1,-1,-1,-1,-1,-1},
-{115,116,-1,-1,-1,-1,-1,-1},
-{116,117,-1,-1,-1,-1,-1,-1},
-{117,118,-1,-1,-1,-1,-1,-1},
-{118,119,-1,-1,-1,-1,-1,-1},
-{119,120,-1,-1,-1,-1,-1,-1},
-{120,121,-1,-1,-1,-1,-1,-1},
-{121,122,-1,-1,-1,-1,-1,-1},
-{122,123,-1,-1,-1,-1,-1,-1},
-{123,124,-1,-1,-1,-1,-1,-1},
-{124,125,-1,-1,-1,-1,-1,-1},
-{125,126,-1,-1,-1,-1,-1,-1},
-{126,127,-1,-1,-1,-1,-1,-1},
-{127,128,-1,-1,-1,-1,-1,-1},
-{128,129,-1,-1,-1,-1,-1,-1},
-{129,130,-1,-1,-1,-1,-1,-1},
-{130,131,-1,-1,-1,-1,-1,-1},
-{131,132,-1,-1,-1,-1,-1,-1},
-{132,133,-1,-1,-1,-1,-1,-1},
-{133,134,-1,-1,-1,-1,-1,-1},
-{134,135,-1,-1,-1,-1,-1,-1},
-{135,136,-1,-1,-1,-1,-1,-1},
-{136,137,-1,-1,-1,-1,-1,-1},
-{137,138,-1,-1,-1,-1,-1,-1},
-{138,139,-1,-1,-1,-1,-1,-1},
-{139,140,-1,-1,-1,-1,-1,-1},
-{140,141,-1,-1,-1,-1,-1,-1},
-{141,142,-1,-1,-1,-1,-1,-1},
-{142,143,-1,-1,-1,-1,-1,-1},
-{143,144,-1,-1,-1,-1,-1,-1},
-{144,145,-1,-1,-1,-1,-1,-1},
-{145,146,-1,-1,-1,-1,-1,-1},
-{146,147,-1,-1,-1,-1,-1,-1},
-{147,148,-1,-1,-1,-1,-1,-1},
-{148,149,-1,-1,-1,-1,-1,-1},
-{149,150,-1,-1,-1,-1,-1,-1},
-{150,151,-1,-1,-1,-1,-1,-1},
-{151,152,-1,-1,-1,-1,-1,-1},
-{152,153,-1,-1,-1,-1,-1,-1},
-{153,154,-1,-1,-1,-1,-1,-1},
-{154,155,-1,-1,-1,-1,-1,-1},
-{155,156,-1,-1,-1,-1,-1,-1},
-{156,157,-1,-1,-1,-1,-1,-1},
-{157,158,-1,-1,-1,-1,-1,-1},
-{158,159,-1,-1,-1,-1,-1,-1},
-{159,160,-1,-1,-1,-1,-1,-1},
-{160,161,-1,-1,-1,-1,-1,-1},
-{161,162,-1,-1,-1,-1,-1,-1},
-{162,163,-1,-1,-1,-1,-1,-1},
-{163,164,-1,-1,-1,-1,-1,-1},
-{164,165,-1,-1,-1,-1,-1,-1},
-{165,166,-1,-1,-1,-1,-1,-1},
-{166,167,-1,-1,-1,-1,-1,-1},
-{167,168,-1,-1,-1,-1,-1,-1},
-{168,169,-1,-1,-1,-1,-1,-1},
-{169,170,-1,-1,-1,-1,-1,-1},
-{170,171,-1,-1,-1,-1,-1,-1},
-{171,172,-1,-1,-1,-1,-1,-1},
-{172,173,-1,-1,-1,-1,-1,-1},
-{173,174,-1,-1,-1,-1,-1,-1},
-{174,175,-1,-1,-1,-1,-1,-1},
-{175,176,-1,-1,-1,-1,-1,-1},
-{176,177,-1,-1,-1,-1,-1,-1},
-{177,178,-1,-1,-1,-1,-1,-1},
-{178,179,-1,-1,-1,-1,-1,-1},
-{179,180,-1,-1,-1,-1,-1,-1},
-{180,181,-1,-1,-1,-1,-1,-1},
-{181,182,-1,-1,-1,-1,-1,-1},
-{182,183,-1,-1,-1,-1,-1,-1},
-{183,184,-1,-1,-1,-1,-1,-1},
-{184,185,-1,-1,-1,-1,-1,-1},
-{185,186,-1,-1,-1,-1,-1,-1},
-{186,187,-1,-1,-1,-1,-1,-1},
-{187,188,-1,-1,-1,-1,-1,-1},
-{188,189,-1,-1,-1,-1,-1,-1},
-{189,190,-1,-1,-1,-1,-1,-1},
-{190,191,-1,-1,-1,-1,-1,-1},
-{191,192,-1,-1,-1,-1,-1,-1},
-{192,193,-1,-1,-1,-1,-1,-1},
-{193,194,-1,-1,-1,-1,-1,-1},
-{194,195,-1,-1,-1,-1,-1,-1},
-{195,196,-1,-1,-1,-1,-1,-1},
-{196,197,-1,-1,-1,-1,-1,-1},
-{197,198,-1,-1,-1,-1,-1,-1},
-{198,199,-1,-1,-1,-1,-1,-1},
-{199,200,-1,-1,-1,-1,-1,-1},
-{200,201,-1,-1,-1,-1,-1,-1},
-{201,202,-1,-1,-1,-1,-1,-1},
-{202,203,-1,-1,-1,-1,-1,-1},
-{203,204,-1,-1,-1,-1,-1,-1},
-{204,205,-1,-1,-1,-1,-1,-1},
-{205,206,-1,-1,-1,-1,-1,-1},
-{206,207,-1,-1,-1,-1,-1,-1},
-{207,208,-1,-1,-1,-1,-1,-1},
-{208,209,-1,-1,-1,-1,-1,-1},
-{209,210,-1,-1,-1,-1,-1,-1},
-{210,211,-1,-1,-1,-1,-1,-1},
-{211,212,-1,-1,-1,-1,-1,-1},
-{212,213,-1,-1,-1,-1,-1,-1},
-{213,214,-1,-1,-1,-1,-1,-1},
-{214,215,-1,-1,-1,-1,-1,-1},
-{215,216,-1,-1,-1,-1,-1,-1},
-{216,217,-1,-1,-1,-1,-1,-1},
-{217,218,-1,-1,-1,-1,-1,-1},
-{218,219,-1,-1,-1,-1,-1,-1},
-{219,220,-1,-1,-1,-1,-1,-1},
-{220,221,-1,-1,-1,-1,-1,-1},
-{221,222,-1,-1,-1,-1,-1,-1},
-{222,223,-1,-1,-1,-1,-1,-1},
-{223,224,-1,-1,-1,-1,-1,-1},
-{224,225,-1,-1,-1,-1,-1,-1},
-{225,226,-1,-1,-1,-1,-1,-1},
-{226,227,-1,-1,-1,-1,-1,-1},
-{227,228,-1,-1,-1,-1,-1,-1},
-{228,229,-1,-1,-1,-1,-1,-1},
-{229,230,-1,-1,-1,-1,-1,-1},
-{230,231,-1,-1,-1,-1,-1,-1},
-{231,232,-1,-1,-1,-1,-1,-1},
-{232,233,-1,-1,-1,-1,-1,-1},
-{233,234,-1,-1,-1,-1,-1,-1},
-{234,235,-1,-1,-1,-1,-1,-1},
-{235,236,-1,-1,-1,-1,-1,-1},
-{236,237,-1,-1,-1,-1,-1,-1},
-{237,238,-1,-1,-1,-1,-1,-1},
-{238,239,-1,-1,-1,-1,-1,-1},
-{239,240,-1,-1,-1,-1,-1,-1},
-{240,241,-1,-1,-1,-1,-1,-1},
-{241,242,-1,-1,-1,-1,-1,-1},
-{242,243,-1,-1,-1,-1,-1,-1},
-{243,244,-1,-1,-1,-1,-1,-1},
-{244,245,-1,-1,-1,-1,-1,-1},
-{245,246,-1,-1,-1,-1,-1,-1},
-{246,247,-1,-1,-1,-1,-1,-1},
-{247,248,-1,-1,-1,-1,-1,-1},
-{248,249,-1,-1,-1,-1,-1,-1},
-{249,250,-1,-1,-1,-1,-1,-1},
-{250,251,-1,-1,-1,-1,-1,-1},
-{251,252,-1,-1,-1,-1,-1,-1},
-{252,253,-1,-1,-1,-1,-1,-1},
-{253,254,-1,-1,-1,-1,-1,-1},
-{254,255,-1,-1,-1,-1,-1,-1},
-{255,256,-1,-1,-1,-1,-1,-1},
-{256,257,-1,-1,-1,-1,-1,-1},
-{257,258,-1,-1,-1,-1,-1,-1},
-{258,259,-1,-1,-1,-1,-1,-1},
-{259,260,-1,-1,-1,-1,-1,-1},
-{260,261,-1,-1,-1,-1,-1,-1},
-{261,262,-1,-1,-1,-1,-1,-1},
-{262,263,-1,-1,-1,-1,-1,-1},
-{263,264,-1,-1,-1,-1,-1,-1},
-{264,265,-1,-1,-1,-1,-1,-1},
-{265,266,-1,-1,-1,-1,-1,-1},
-{266,267,-1,-1,-1,-1,-1,-1},
-{267,268,-1,-1,-1,-1,-1,-1},
-{268,269,-1,-1,-1,-1,-1,-1},
-{269,270,-1,-1,-1,-1,-1,-1},
-{270,271,-1,-1,-1,-1,-1,-1},
-{271,272,-1,-1,-1,-1,-1,-1},
-{272,273,-1,-1,-1,-1,-1,-1},
-{273,274,-1,-1,-1,-1,-1,-1},
-{274,275,-1,-1,-1,-1,-1,-1},
-{275,276,-1,-1,-1,-1,-1,-1},
-{276,277,-1,-1,-1,-1,-1,-1},
-{277,278,-1,-1,-1,-1,-1,-1},
-{278,279,-1,-1,-1,-1,-1,-1},
-{279,280,-1,-1,-1,-1,-1,-1},
-{280,281,-1,-1,-1,-1,-1,-1},
-{281,282,-1,-1,-1,-1,-1,-1},
-{282,283,-1,-1,-1,-1,-1,-1},
-{283,284,-1,-1,-1,-1,-1,-1},
-{284,285,-1,-1,-1,-1,-1,-1},
-{285,286,-1,-1,-1,-1,-1,-1},
-{286,287,-1,-1,-1,-1,-1,-1},
-{287,288,-1,-1,-1,-1,-1,-1},
-{288,289,-1,-1,-1,-1,-1,-1},
-{289,290,-1,-1,-1,-1,-1,-1},
-{290,291,-1,-1,-1,-1,-1,-1},
-{291,292,-1,-1,-1,-1,-1,-1},
-{292,293,-1,-1,-1,-1,-1,-1},
-{293,294,-1,-1,-1,-1,-1,-1},
-{294,295,-1,-1,-1,-1,-1,-1},
-{295,296,-1,-1,-1,-1,-1,-1},
-{296,297,-1,-1,-1,-1,-1,-1},
-{297,298,-1,-1,-1,-1,-1,-1},
-{298,299,-1,-1,-1,-1,-1,-1},
-{299,300,-1,-1,-1,-1,-1,-1},
-{300,301,-1,-1,-1,-1,-1,-1},
-{301,302,-1,-1,-1,-1,-1,-1},
-{302,303,-1,-1,-1,-1,-1,-1},
-{303,304,-1,-1,-1,-1,-1,-1},
-{304,305,-1,-1,-1,-1,-1,-1},
-{305,306,-1,-1,-1,-1,-1,-1},
-{306,307,-1,-1,-1,-1,-1,-1},
-{307,308,-1,-1,-1,-1,-1,-1},
-{308,309,-1,-1,-1,-1,-1,-1},
-{309,310,-1,-1,-1,-1,-1,-1},
-{310,311,-1,-1,-1,-1,-1,-1},
-{311,312,-1,-1,-1,-1,-1,-1},
-{312,313,-1,-1,-1,-1,-1,-1},
-{313,314,-1,-1,-1,-1,-1,-1},
-{314,315,-1,-1,-1,-1,-1,-1},
-{315,316,-1,-1,-1,-1,-1,-1},
-{316,317,-1,-1,-1,-1,-1,-1},
-{317,318,-1,-1,-1,-1,-1,-1},
-{318,319,-1,-1,-1,-1,-1,-1},
-{319,320,-1,-1,-1,-1,-1,-1},
-{320,321,-1,-1,-1,-1,-1,-1},
-{321,322,-1,-1,-1,-1,-1,-1},
-{322,323,-1,-1,-1,-1,-1,-1},
-{323,324,-1,-1,-1,-1,-1,-1},
-{324,325,-1,-1,-1,-1,-1,-1},
-{325,326,-1,-1,-1,-1,-1,-1},
-{326,327,-1,-1,-1,-1,-1,-1},
-{327,328,-1,-1,-1,-1,-1,-1},
-{328,329,-1,-1,-1,-1,-1,-1},
-{329,330,-1,-1,-1,-1,-1,-1},
-{330,331,-1,-1,-1,-1,-1,-1},
-{331,332,-1,-1,-1,-1,-1,-1},
-{332,333,-1,-1,-1,-1,-1,-1},
-{333,334,-1,-1,-1,-1,-1,-1},
-{334,335,-1,-1,-1,-1,-1,-1},
-{335,336,-1,-1,-1,-1,-1,-1},
-{336,337,-1,-1,-1,-1,-1,-1},
-{337,338,-1,-1,-1,-1,-1,-1},
-{338,339,-1,-1,-1,-1,-1,-1},
-{339,340,-1,-1,-1,-1,-1,-1},
-{340,341,-1,-1,-1,-1,-1,-1},
-{341,342,-1,-1,-1,-1,-1,-1},
-{342,343,-1,-1,-1,-1,-1,-1},
-{343,344,-1,-1,-1,-1,-1,-1},
-{344,345,-1,-1,-1,-1,-1,-1},
-{345,346,-1,-1,-1,-1,-1,-1},
-{346,347,-1,-1,-1,-1,-1,-1},
-{347,348,-1,-1,-1,-1,-1,-1},
-{348,349,-1,-1,-1,-1,-1,-1},
-{349,350,-1,-1,-1,-1,-1,-1},
-{350,351,-1,-1,-1,-1,-1,-1},
-{351,352,-1,-1,-1,-1,-1,-1},
-{352,353,-1,-1,-1,-1,-1,-1},
-{353,354,-1,-1,-1,-1,-1,-1},
-{354,355,-1,-1,-1,-1,-1,-1},
-{355,356,-1,-1,-1,-1,-1,-1},
-{356,357,-1,-1,-1,-1,-1,-1},
-{357,358,-1,-1,-1,-1,-1,-1},
-{358,359,-1,-1,-1,-1,-1,-1},
-{359,360,-1,-1,-1,-1,-1,-1},
-{360,361,-1,-1,-1,-1,-1,-1},
-{361,362,-1,-1,-1,-1,-1,-1},
-{362,363,-1,-1,-1,-1,-1,-1},
-{363,364,-1,-1,-1,-1,-1,-1},
-{364,365,-1,-1,-1,-1,-1,-1},
-{365,366,-1,-1,-1,-1,-1,-1},
-{366,367,-1,-1,-1,-1,-1,-1},
-{367,368,-1,-1,-1,-1,-1,-1},
-{368,369,-1,-1,-1,-1,-1,-1},
-{369,370,-1,-1,-1,-1,-1,-1},
-{370,371,-1,-1,-1,-1,-1,-1},
-{371,372,-1,-1,-1,-1,-1,-1},
-{372,373,-1,-1,-1,-1,-1,-1},
-{373,374,-1,-1,-1,-1,-1,-1},
-{374,375,-1,-1,-1,-1,-1,-1},
-{375,376,-1,-1,-1,-1,-1,-1},
-{376,377,-1,-1,-1,-1,-1,-1},
-{377,378,-1,-1,-1,-1,-1,-1},
-{378,379,-1,-1,-1,-1,-1,-1},
-{379,380,-1,-1,-1,-1,-1,-1},
-{380,381,-1,-1,-1,-1,-1,-1},
-{381,382,-1,-1,-1,-1,-1,-1},
-{382,383,-1,-1,-1,-1,-1,-1},
-{383,384,-1,-1,-1,-1,-1,-1},
-{384,385,-1,-1,-1,-1,-1,-1},
-{385,386,-1,-1,-1,-1,-1,-1},
-{386,387,-1,-1,-1,-1,-1,-1},
-{387,388,-1,-1,-1,-1,-1,-1},
-{388,389,-1,-1,-1,-1,-1,-1},
-{389,390,-1,-1,-1,-1,-1,-1},
-{390,391,-1,-1,-1,-1,-1,-1},
-{391,392,-1,-1,-1,-1,-1,-1},
-{392,393,-1,-1,-1,-1,-1,-1},
-{393,394,-1,-1,-1,-1,-1,-1},
-{394,395,-1,-1,-1,-1,-1,-1},
-{395,396,-1,-1,-1,-1,-1,-1},
-{396,397,-1,-1,-1,-1,-1,-1},
-{397,398,-1,-1,-1,-1,-1,-1},
-{398,399,-1,-1,-1,-1,-1,-1},
-{399,400,-1,-1,-1,-1,-1,-1},
-{400,401,-1,-1,-1,-1,-1,-1},
-{401,402,-1,-1,-1,-1,-1,-1},
-{402,403,-1,-1,-1,-1,-1,-1},
-{403,404,-1,-1,-1,-1,-1,-1},
-{404,405,-1,-1,-1,-1,-1,-1},
-{405,406,-1,-1,-1,-1,-1,-1},
-{406,407,-1,-1,-1,-1,-1,-1},
-{407,408,-1,-1,-1,-1,-1,-1},
-{408,409,-1,-1,-1,-1,-1,-1},
-{409,410,-1,-1,-1,-1,-1,-1},
-{410,411,-1,-1,-1,-1,-1,-1},
-{411,412,-1,-1,-1,-1,-1,-1},
-{412,413,-1,-1,-1,-1,-1,-1},
-{413,414,-1,-1,-1,-1,-1,-1},
-{414,415,-1,-1,-1,-1,-1,-1},
-{415,416,-1,-1,-1,-1,-1,-1},
-{416,417,-1,-1,-1,-1,-1,-1},
-{417,418,-1,-1,-1,-1,-1,-1},
-{418,419,-1,-1,-1,-1,-1,-1},
-{419,420,-1,-1,-1,-1,-1,-1},
-{420,421,-1,-1,-1,-1,-1,-1},
-{421,422,-1,-1,-1,-1,-1,-1},
-{422,423,-1,-1,-1,-1,-1,-1},
-{423,424,-1,-1,-1,-1,-1,-1},
-{424,425,-1,-1,-1,-1,-1,-1},
-{425,426,-1,-1,-1,-1,-1,-1},
-{426,427,-1,-1,-1,-1,-1,-1},
-{427,428,-1,-1,-1,-1,-1,-1},
-{428,429,-1,-1,-1,-1,-1,-1},
-{429,430,-1,-1,-1,-1,-1,-1},
-{430,431,-1,-1,-1,-1,-1,-1},
-{431,432,-1,-1,-1,-1,-1,-1},
-{432,433,-1,-1,-1,-1,-1,-1},
-{433,434,-1,-1,-1,-1,-1,-1},
-{434,435,-1,-1,-1,-1,-1,-1},
-{435,436,-1,-1,-1,-1,-1,-1},
-{436,437,-1,-1,-1,-1,-1,-1},
-{437,438,-1,-1,-1,-1,-1,-1},
-{438,439,-1,-1,-1,-1,-1,-1},
-{439,440,-1,-1,-1,-1,-1,-1},
-{440,441,-1,-1,-1,-1,-1,-1},
-{441,442,-1,-1,-1,-1,-1,-1},
-{442,443,-1,-1,-1,-1,-1,-1},
-{443,444,-1,-1,-1,-1,-1,-1},
-{444,445,-1,-1,-1,-1,-1,-1},
-{445,446,-1,-1,-1,-1,-1,-1},
-{446,447,-1,-1,-1,-1,-1,-1},
-{447,448,-1,-1,-1,-1,-1,-1},
-{448,449,-1,-1,-1,-1,-1,-1},
-{449,450,-1,-1,-1,-1,-1,-1},
-{450,451,-1,-1,-1,-1,-1,-1},
-{451,452,-1,-1,-1,-1,-1,-1},
-{452,453,-1,-1,-1,-1,-1,-1},
-{453,454,-1,-1,-1,-1,-1,-1},
-{454,455,-1,-1,-1,-1,-1,-1},
-{455,456,-1,-1,-1,-1,-1,-1},
-{456,457,-1,-1,-1,-1,-1,-1},
-{457,458,-1,-1,-1,-1,-1,-1},
-{458,459,-1,-1,-1,-1,-1,-1},
-{459,460,-1,-1,-1,-1,-1,-1},
-{460,461,-1,-1,-1,-1,-1,-1},
-{461,462,-1,-1,-1,-1,-1,-1},
-{462,463,-1,-1,-1,-1,-1,-1},
-{463,464,-1,-1,-1,-1,-1,-1},
-{464,465,-1,-1,-1,-1,-1,-1},
-{465,466,-1,-1,-1,-1,-1,-1},
-{466,467,-1,-1,-1,-1,-1,-1},
-{467,468,-1,-1,-1,-1,-1,-1},
-{468,469,-1,-1,-1,-1,-1,-1},
-{469,470,-1,-1,-1,-1,-1,-1},
-{470,471,-1,-1,-1,-1,-1,-1},
-{471,472,-1,-1,-1,-1,-1,-1},
-{472,473,-1,-1,-1,-1,-1,-1},
-{473,474,-1,-1,-1,-1,-1,-1},
-{474,475,-1,-1,-1,-1,-1,-1},
-{475,476,-1,-1,-1,-1,-1,-1},
-{476,477,-1,-1,-1,-1,-1,-1},
-{477,478,-1,-1,-1,-1,-1,-1},
-{478,479,-1,-1,-1,-1,-1,-1},
-{479,480,-1,-1,-1,-1,-1,-1},
-{480,481,-1,-1,-1,-1,-1,-1},
-{481,482,-1,-1,-1,-1,-1,-1},
-{482,483,-1,-1,-1,-1,-1,-1},
-{483,484,-1,-1,-1,-1,-1,-1},
-{484,485,-1,-1,-1,-1,-1,-1},
-{485,486,-1,-1,-1,-1,-1,-1},
-{486,487,-1,-1,-1,-1,-1,-1},
-{487,488,-1,-1,-1,-1,-1,-1},
-{488,489,-1,-1,-1,-1,-1,-1},
-{489,490,-1,-1,-1,-1,-1,-1},
-{490,491,-1,-1,-1,-1,-1,-1},
-{491,492,-1,-1,-1,-1,-1,-1},
-{492,493,-1,-1,-1,-1,-1,-1},
-{493,494,-1,-1,-1,-1,-1,-1},
-{494,495,-1,-1,-1,-1,-1,-1},
-{495,496,-1,-1,-1,-1,-1,-1},
-{496,497,-1,-1,-1,-1,-1,-1},
-{497,498,-1,-1,-1,-1,-1,-1},
-{498,499,-1,-1,-1,-1,-1,-1},
-{499,500,-1,-1,-1,-1,-1,-1},
-{500,501,-1,-1,-1,-1,-1,-1},
-{501,502,-1,-1,-1,-1,-1,-1},
-{502,503,-1,-1,-1,-1,-1,-1},
-{503,504,-1,-1,-1,-1,-1,-1},
-{504,505,-1,-1,-1,-1,-1,-1},
-{505,506,-1,-1,-1,-1,-1,-1},
-{506,507,-1,-1,-1,-1,-1,-1},
-{507,508,-1,-1,-1,-1,-1,-1},
-{508,509,-1,-1,-1,-1,-1,-1},
-{509,510,-1,-1,-1,-1,-1,-1},
-{510,511,-1,-1,-1,-1,-1,-1},
-{511,512,-1,-1,-1,-1,-1,-1},
-{512,513,-1,-1,-1,-1,-1,-1},
-{513,514,-1,-1,-1,-1,-1,-1},
-{514,515,-1,-1,-1,-1,-1,-1},
-{515,516,-1,-1,-1,-1,-1,-1},
-{516,517,-1,-1,-1,-1,-1,-1},
-{517,518,-1,-1,-1,-1,-1,-1},
-{518,519,-1,-1,-1,-1,-1,-1},
-{519,520,-1,-1,-1,-1,-1,-1},
-{520,521,-1,-1,-1,-1,-1,-1},
-{521,522,-1,-1,-1,-1,-1,-1},
-{522,523,-1,-1,-1,-1,-1,-1},
-{523,524,-1,-1,-1,-1,-1,-1},
-{524,525,-1,-1,-1,-1,-1,-1},
-{525,526,-1,-1,-1,-1,-1,-1},
-{526,527,-1,-1,-1,-1,-1,-1},
-{527,528,-1,-1,-1,-1,-1,-1},
-{528,529,-1,-1,-1,-1,-1,-1},
-{529,530,-1,-1,-1,-1,-1,-1},
-{530,531,-1,-1,-1,-1,-1,-1},
-{531,532,-1,-1,-1,-1,-1,-1},
-{532,533,-1,-1,-1,-1,-1,-1},
-{533,534,-1,-1,-1,-1,-1,-1},
-{534,535,-1,-1,-1,-1,-1,-1},
-{535,536,-1,-1,-1,-1,-1,-1},
-{536,537,-1,-1,-1,-1,-1,-1},
-{537,538,-1,-1,-1,-1,-1,-1},
-{538,539,-1,-1,-1,-1,-1,-1},
-{539,540,-1,-1,-1,-1,-1,-1},
-{540,541,-1,-1,-1,-1,-1,-1},
-{541,542,-1,-1,-1,-1,-1,-1},
-{542,543,-1,-1,-1,-1,-1,-1},
-{543,544,-1,-1,-1,-1,-1,-1},
-{544,545,-1,-1,-1,-1,-1,-1},
-{545,546,-1,-1,-1,-1,-1,-1},
-{546,547,-1,-1,-1,-1,-1,-1},
-{547,548,-1,-1,-1,-1,-1,-1},
-{548,549,-1,-1,-1,-1,-1,-1},
-{549,550,-1,-1,-1,-1,-1,-1},
-{550,551,-1,-1,-1,-1,-1,-1},
-{551,552,-1,-1,-1,-1,-1,-1},
-{552,553,-1,-1,-1,-1,-1,-1},
-{553,554,-1,-1,-1,-1,-1,-1},
-{554,555,-1,-1,-1,-1,-1,-1},
-{555,556,-1,-1,-1,-1,-1,-1},
-{556,557,-1,-1,-1,-1,-1,-1},
-{557,558,-1,-1,-1,-1,-1,-1},
-{558,559,-1,-1,-1,-1,-1,-1},
-{559,560,-1,-1,-1,-1,-1,-1},
-{560,561,-1,-1,-1,-1,-1,-1},
-{561,562,-1,-1,-1,-1,-1,-1},
-{562,563,-1,-1,-1,-1,-1,-1},
-{563,564,-1,-1,-1,-1,-1,-1},
-{564,565,-1,-1,-1,-1,-1,-1},
-{565,566,-1,-1,-1,-1,-1,-1},
-{566,567,-1,-1,-1,-1,-1,-1},
-{567,568,-1,-1,-1,-1,-1,-1},
-{568,569,-1,-1,-1,-1,-1,-1},
-{569,570,-1,-1,-1,-1,-1,-1},
-{570,571,-1,-1,-1,-1,-1,-1},
-{571,572,-1,-1,-1,-1,-1,-1},
-{572,573,-1,-1,-1,-1,-1,-1},
-{573,574,-1,-1,-1,-1,-1,-1},
-{574,575,-1,-1,-1,-1,-1,-1},
-{575,576,-1,-1,-1,-1,-1,-1},
-{576,577,-1,-1,-1,-1,-1,-1},
-{577,578,-1,-1,-1,-1,-1,-1},
-{578,579,-1,-1,-1,-1,-1,-1},
-{579,580,-1,-1,-1,-1,-1,-1},
-{580,581,-1,-1,-1,-1,-1,-1},
-{581,582,-1,-1,-1,-1,-1,-1},
-{582,583,-1,-1,-1,-1,-1,-1},
-{583,584,-1,-1,-1,-1,-1,-1},
-{584,585,-1,-1,-1,-1,-1,-1},
-{585,586,-1,-1,-1,-1,-1,-1},
-{586,587,-1,-1,-1,-1,-1,-1},
-{587,588,-1,-1,-1,-1,-1,-1},
-{588,589,-1,-1,-1,-1,-1,-1},
-{589,590,-1,-1,-1,-1,-1,-1},
-{590,591,-1,-1,-1,-1,-1,-1},
-{591,592,-1,-1,-1,-1,-1,-1},
-{592,593,-1,-1,-1,-1,-1,-1},
-{593,594,-1,-1,-1,-1,-1,-1},
-{594,595,-1,-1,-1,-1,-1,-1},
-{595,596,-1,-1,-1,-1,-1,-1},
-{596,597,-1,-1,-1,-1,-1,-1},
-{597,598,-1,-1,-1,-1,-1,-1},
-{598,599,-1,-1,-1,-1,-1,-1},
-{599,600,-1,-1,-1,-1,-1,-1},
-{600,601,-1,-1,-1,-1,-1,-1},
-{601,602,-1,-1,-1,-1,-1,-1},
-{602,603,-1,-1,-1,-1,-1,-1},
-{603,604,-1,-1,-1,-1,-1,-1},
-{604,605,-1,-1,-1,-1,-1,-1},
-{605,606,-1,-1,-1,-1,-1,-1},
-{606,607,-1,-1,-1,-1,-1,-1},
-{607,608,-1,-1,-1,-1,-1,-1},
-{608,609,-1,-1,-1,-1,-1,-1},
-{609,610,-1,-1,-1,-1,-1,-1},
-{610,611,-1,-1,-1,-1,-1,-1},
-{611,612,-1,-1,-1,-1,-1,-1},
-{612,613,-1,-1,-1,-1,-1,-1},
-{613,614,-1,-1,-1,-1,-1,-1},
-{614,615,-1,-1,-1,-1,-1,-1},
-{615,616,-1,-1,-1,-1,-1,-1},
-{616,617,-1,-1,-1,-1,-1,-1},
-{617,618,-1,-1,-1,-1,-1,-1},
-{618,619,-1,-1,-1,-1,-1,-1},
-{619,620,-1,-1,-1,-1,-1,-1},
-{620,621,-1,-1,-1,-1,-1,-1},
-{621,622,-1,-1,-1,-1,-1,-1},
-{622,623,-1,-1,-1,-1,-1,-1},
-{623,624,-1,-1,-1,-1,-1,-1},
-{624,625,-1,-1,-1,-1,-1,-1},
-{625,626,-1,-1,-1,-1,-1,-1},
-{626,627,-1,-1,-1,-1,-1,-1},
-{627,628,-1,-1,-1,-1,-1,-1},
-{628,629,-1,-1,-1,-1,-1,-1},
-{629,630,-1,-1,-1,-1,-1,-1},
-{630,631,-1,-1,-1,-1,-1,-1},
-{631,632,-1,-1,-1,-1,-1,-1},
-{632,633,-1,-1,-1,-1,-1,-1},
-{633,634,-1,-1,-1,-1,-1,-1},
-{634,635,-1,-1,-1,-1,-1,-1},
-{635,636,-1,-1,-1,-1,-1,-1},
-{636,637,-1,-1,-1,-1,-1,-1},
-{637,638,-1,-1,-1,-1,-1,-1},
-{638,639,-1,-1,-1,-1,-1,-1},
-{639,640,-1,-1,-1,-1,-1,-1},
-{640,641,-1,-1,-1,-1,-1,-1},
-{641,642,-1,-1,-1,-1,-1,-1},
-{642,643,-1,-1,-1,-1,-1,-1},
-{643,644,-1,-1,-1,-1,-1,-1},
-{644,645,-1,-1,-1,-1,-1,-1},
-{645,646,-1,-1,-1,-1,-1,-1},
-{646,647,-1,-1,-1,-1,-1,-1},
-{647,648,-1,-1,-1,-1,-1,-1},
-{648,649,-1,-1,-1,-1,-1,-1},
-{649,650,-1,-1,-1,-1,-1,-1},
-{650,651,-1,-1,-1,-1,-1,-1},
-{651,652,-1,-1,-1,-1,-1,-1},
-{652,653,-1,-1,-1,-1,-1,-1},
-{653,654,-1,-1,-1,-1,-1,-1},
-{654,655,-1,-1,-1,-1,-1,-1},
-{655,656,-1,-1,-1,-1,-1,-1},
-{656,657,-1,-1,-1,-1,-1,-1},
-{657,658,-1,-1,-1,-1,-1,-1},
-{658,659,-1,-1,-1,-1,-1,-1},
-{659,660,-1,-1,-1,-1,-1,-1},
-{660,661,-1,-1,-1,-1,-1,-1},
-{661,662,-1,-1,-1,-1,-1,-1},
-{662,663,-1,-1,-1,-1,-1,-1},
-{663,664,-1,-1,-1,-1,-1,-1},
-{664,665,-1,-1,-1,-1,-1,-1},
-{665,666,-1,-1,-1,-1,-1,-1},
-{666,667,-1,-1,-1,-1,-1,-1},
-{667,668,-1,-1,-1,-1,-1,-1},
-{668,669,-1,-1,-1,-1,-1,-1},
-{669,670,-1,-1,-1,-1,-1,-1},
-{670,671,-1,-1,-1,-1,-1,-1},
-{671,672,-1,-1,-1,-1,-1,-1},
-{672,673,-1,-1,-1,-1,-1,-1},
-{673,674,-1,-1,-1,-1,-1,-1},
-{674,675,-1,-1,-1,-1,-1,-1},
-{675,676,-1,-1,-1,-1,-1,-1},
-{676,677,-1,-1,-1,-1,-1,-1},
-{677,678,-1,-1,-1,-1,-1,-1},
-{678,679,-1,-1,-1,-1,-1,-1},
-{679,680,-1,-1,-1,-1,-1,-1},
-{680,681,-1,-1,-1,-1,-1,-1},
-{681,682,-1,-1,-1,-1,-1,-1},
-{682,683,-1,-1,-1,-1,-1,-1},
-{683,684,-1,-1,-1,-1,-1,-1},
-{684,685,-1,-1,-1,-1,-1,-1},
-{685,686,-1,-1,-1,-1,-1,-1},
-{686,687,-1,-1,-1,-1,-1,-1},
-{687,688,-1,-1,-1,-1,-1,-1},
-{688,689,-1,-1,-1,-1,-1,-1},
-{689,690,-1,-1,-1,-1,-1,-1},
-{690,691,-1,-1,-1,-1,-1,-1},
-{691,692,-1,-1,-1,-1,-1,-1},
-{692,693,-1,-1,-1,-1,-1,-1},
-{693,694,-1,-1,-1,-1,-1,-1},
-{694,695,-1,-1,-1,-1,-1,-1},
-{695,696,-1,-1,-1,-1,-1,-1},
-{696,697,-1,-1,-1,-1,-1,-1},
-{697,698,-1,-1,-1,-1,-1,-1},
-{698,699,-1,-1,-1,-1,-1,-1},
-{699,700,-1,-1,-1,-1,-1,-1},
-{700,701,-1,-1,-1,-1,-1,-1},
-{701,702,-1,-1,-1,-1,-1,-1},
-{702,703,-1,-1,-1,-1,-1,-1},
-{703,704,-1,-1,-1,-1,-1,-1},
-{704,705,-1,-1,-1,-1,-1,-1},
-{705,706,-1,-1,-1,-1,-1,-1},
-{706,707,-1,-1,-1,-1,-1,-1},
-{707,708,-1,-1,-1,-1,-1,-1},
-{708,709,-1,-1,-1,-1,-1,-1},
-{709,710,-1,-1,-1,-1,-1,-1},
-{710,711,-1,-1,-1,-1,-1,-1},
-{711,712,-1,-1,-1,-1,-1,-1},
-{712,713,-1,-1,-1,-1,-1,-1},
-{713,714,-1,-1,-1,-1,-1,-1},
-{714,715,-1,-1,-1,-1,-1,-1},
-{715,716,-1,-1,-1,-1,-1,-1},
-{716,717,-1,-1,-1,-1,-1,-1},
-{717,718,-1,-1,-1,-1,-1,-1},
-{718,719,-1,-1,-1,-1,-1,-1},
-{719,720,-1,-1,-1,-1,-1,-1},
-{720,721,-1,-1,-1,-1,-1,-1},
-{721,722,-1,-1,-1,-1,-1,-1},
-{722,723,-1,-1,-1,-1,-1,-1},
-{723,724,-1,-1,-1,-1,-1,-1},
-{724,725,-1,-1,-1,-1,-1,-1},
-{725,726,-1,-1,-1,-1,-1,-1},
-{726,727,-1,-1,-1,-1,-1,-1},
-{727,728,-1,-1,-1,-1,-1,-1},
-{728,729,-1,-1,-1,-1,-1,-1},
-{729,730,-1,-1,-1,-1,-1,-1},
-{730,731,-1,-1,-1,-1,-1,-1},
-{731,732,-1,-1,-1,-1,-1,-1},
-{732,733,-1,-1,-1,-1,-1,-1},
-{733,734,-1,-1,-1,-1,-1,-1},
-{734,735,-1,-1,-1,-1,-1,-1},
-{735,736,-1,-1,-1,-1,-1,-1},
-{736,737,-1,-1,-1,-1,-1,-1},
-{737,738,-1,-1,-1,-1,-1,-1},
-{738,739,-1,-1,-1,-1,-1,-1},
-{739,740,-1,-1,-1,-1,-1,-1},
-{740,741,-1,-1,-1,-1,-1,-1},
-{741,742,-1,-1,-1,-1,-1,-1},
-{742,743,-1,-1,-1,-1,-1,-1},
-{743,744,-1,-1,-1,-1,-1,-1},
-{744,745,-1,-1,-1,-1,-1,-1},
-{745,746,-1,-1,-1,-1,-1,-1},
-{746,747,-1,-1,-1,-1,-1,-1},
-{747,748,-1,-1,-1,-1,-1,-1},
-{748,749,-1,-1,-1,-1,-1,-1},
-{749,750,-1,-1,-1,-1,-1,-1},
-{750,751,-1,-1,-1,-1,-1,-1},
-{751,752,-1,-1,-1,-1,-1,-1},
-{752,753,-1,-1,-1,-1,-1,-1},
-{753,754,-1,-1,-1,-1,-1,-1},
-{754,755,-1,-1,-1,-1,-1,-1},
-{755,756,-1,-1,-1,-1,-1,-1},
-{756,757,-1,-1,-1,-1,-1,-1},
-{757,758,-1,-1,-1,-1,-1,-1},
-{758,759,-1,-1,-1,-1,-1,-1},
-{759,760,-1,-1,-1,-1,-1,-1},
-{760,761,-1,-1,-1,-1,-1,-1},
-{761,762,-1,-1,-1,-1,-1,-1},
-{762,763,-1,-1,-1,-1,-1,-1},
-{763,764,-1,-1,-1,-1,-1,-1},
-{764,765,-1,-1,-1,-1,-1,-1},
-{765,766,-1,-1,-1,-1,-1,-1},
-{766,767,-1,-1,-1,-1,-1,-1},
-{767,768,-1,-1,-1,-1,-1,-1},
-{768,769,-1,-1,-1,-1,-1,-1},
-{769,770,-1,-1,-1,-1,-1,-1},
-{770,771,-1,-1,-1,-1,-1,-1},
-{771,772,-1,-1,-1,-1,-1,-1},
-{772,773,-1,-1,-1,-1,-1,-1},
-{773,774,-1,-1,-1,-1,-1,-1},
-{774,775,-1,-1,-1,-1,-1,-1},
-{775,776,-1,-1,-1,-1,-1,-1},
-{776,777,-1,-1,-1,-1,-1,-1},
-{777,778,-1,-1,-1,-1,-1,-1},
-{778,779,-1,-1,-1,-1,-1,-1},
-{779,780,-1,-1,-1,-1,-1,-1},
-{780,781,-1,-1,-1,-1,-1,-1},
-{781,782,-1,-1,-1,-1,-1,-1},
-{782,783,-1,-1,-1,-1,-1,-1},
-{783,784,-1,-1,-1,-1,-1,-1},
-{784,785,-1,-1,-1,-1,-1,-1},
-{785,786,-1,-1,-1,-1,-1,-1},
-{786,787,-1,-1,-1,-1,-1,-1},
-{787,788,-1,-1,-1,-1,-1,-1},
-{788,789,-1,-1,-1,-1,-1,-1},
-{789,790,-1,-1,-1,-1,-1,-1},
-{790,791,-1,-1,-1,-1,-1,-1},
-{791,792,-1,-1,-1,-1,-1,-1},
-{792,793,-1,-1,-1,-1,-1,-1},
-{793,794,-1,-1,-1,-1,-1,-1},
-{794,795,-1,-1,-1,-1,-1,-1},
-{795,796,-1,-1,-1,-1,-1,-1},
-{796,797,-1,-1,-1,-1,-1,-1},
-{797,798,-1,-1,-1,-1,-1,-1},
-{798,799,-1,-1,-1,-1,-1,-1},
-{799,-1,-1,-1,-1,-1,-1,-1}};
+int mercury_normal_nGroups_8_16=18;
+int mercury_normal_QCbase_8_16[146]={
+50,6,3,41,504,696,
+50,6,7,64,305,350,403,422,689,709,
+50,6,6,23,142,387,394,614,665,
+50,6,5,2,36,383,143,663,
+50,6,4,395,594,687,743,
+50,6,4,21,395,437,321,
+50,6,7,139,262,670,155,213,142,216,
+50,6,7,213,572,618,195,685,157,323,
+50,6,7,174,188,205,308,372,487,607,
+50,6,5,143,177,323,428,461,
+50,6,7,10,176,240,253,474,515,549,
+50,6,6,15,316,236,450,609,614,
+50,6,5,186,243,367,470,712,
+50,6,3,175,441,515,
+50,6,5,145,295,212,313,322,
+50,6,8,140,171,369,426,553,784,669,442,
+799,1,2,0,1,
+1,0,1,799};
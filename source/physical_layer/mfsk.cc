@@ -169,7 +169,7 @@ void cl_mfsk::deinit()
 }
 
 // Generate MFSK preamble: known tones in all streams simultaneously
-void cl_mfsk::generate_preamble(std::complex<double>* preamble_out, int nSymb)
+void cl_mfsk::generate_preamble(sample_complex* preamble_out, int nSymb)
 {
 	if (M == 0 || Nc == 0 || nStreams == 0) return;
 
@@ -181,19 +181,19 @@ void cl_mfsk::generate_preamble(std::complex<double>* preamble_out, int nSymb)
 		// Zero all subcarriers
 		for (int k = 0; k < Nc; k++)
 		{
-			preamble_out[s * Nc + k] = std::complex<double>(0.0, 0.0);
+			preamble_out[s * Nc + k] = sample_complex(0.0, 0.0);
 		}
 		// Place known tone in each stream's band
 		int tone = preamble_tones[s % preamble_nSymb];
 		for (int st = 0; st < nStreams; st++)
 		{
-			preamble_out[s * Nc + stream_offsets[st] + tone] = std::complex<double>(amp, 0.0);
+			preamble_out[s * Nc + stream_offsets[st] + tone] = sample_complex(amp, 0.0);
 		}
 	}
 }
 
 // Generate ACK pattern: known tones with hopping, repeated ACK_PATTERN_REPS times
-void cl_mfsk::generate_ack_pattern(std::complex<double>* pattern_out)
+void cl_mfsk::generate_ack_pattern(sample_complex* pattern_out)
 {
 	if (M == 0 || Nc == 0 || nStreams == 0) return;
 
@@ -205,7 +205,7 @@ void cl_mfsk::generate_ack_pattern(std::complex<double>* pattern_out)
 		// Zero all subcarriers
 		for (int k = 0; k < Nc; k++)
 		{
-			pattern_out[s * Nc + k] = std::complex<double>(0.0, 0.0);
+			pattern_out[s * Nc + k] = sample_complex(0.0, 0.0);
 		}
 
 		// Which tone from the ack_tones sequence (wraps with ACK_PATTERN_LEN)
@@ -217,13 +217,13 @@ void cl_mfsk::generate_ack_pattern(std::complex<double>* pattern_out)
 		// Place in each stream's band (same tone in all streams, like preamble)
 		for (int st = 0; st < nStreams; st++)
 		{
-			pattern_out[s * Nc + stream_offsets[st] + actual_tone] = std::complex<double>(amp, 0.0);
+			pattern_out[s * Nc + stream_offsets[st] + actual_tone] = sample_complex(amp, 0.0);
 		}
 	}
 }
 
 // Generate BREAK pattern: identical structure to ACK but with break_tones
-void cl_mfsk::generate_break_pattern(std::complex<double>* pattern_out)
+void cl_mfsk::generate_break_pattern(sample_complex* pattern_out)
 {
 	if (M == 0 || Nc == 0 || nStreams == 0) return;
 
@@ -233,7 +233,7 @@ void cl_mfsk::generate_break_pattern(std::complex<double>* pattern_out)
 	{
 		for (int k = 0; k < Nc; k++)
 		{
-			pattern_out[s * Nc + k] = std::complex<double>(0.0, 0.0);
+			pattern_out[s * Nc + k] = sample_complex(0.0, 0.0);
 		}
 
 		int tone_base = break_tones[s % ACK_PATTERN_LEN];
@@ -241,7 +241,7 @@ void cl_mfsk::generate_break_pattern(std::complex<double>* pattern_out)
 
 		for (int st = 0; st < nStreams; st++)
 		{
-			pattern_out[s * Nc + stream_offsets[st] + actual_tone] = std::complex<double>(amp, 0.0);
+			pattern_out[s * Nc + stream_offsets[st] + actual_tone] = sample_complex(amp, 0.0);
 		}
 	}
 }
@@ -249,7 +249,7 @@ void cl_mfsk::generate_break_pattern(std::complex<double>* pattern_out)
 // TX: Map groups of bits to one-hot subcarrier vectors across all streams
 // Each symbol period consumes nStreams * nBits input bits
 void cl_mfsk::mod(const int* bits_in, int total_bits,
-                  std::complex<double>* symbols_out)
+                  sample_complex* symbols_out)
 {
 	if (M == 0 || nBits == 0 || Nc == 0 || nStreams == 0) return;
 
@@ -264,7 +264,7 @@ void cl_mfsk::mod(const int* bits_in, int total_bits,
 		// Zero all subcarriers for this symbol
 		for (int k = 0; k < Nc; k++)
 		{
-			symbols_out[s * Nc + k] = std::complex<double>(0.0, 0.0);
+			symbols_out[s * Nc + k] = sample_complex(0.0, 0.0);
 		}
 
 		// Process each stream
@@ -296,13 +296,13 @@ void cl_mfsk::mod(const int* bits_in, int total_bits,
 			int actual_tone = (tone_index + s * tone_hop_step) % M;
 
 			// Place in this stream's band
-			symbols_out[s * Nc + stream_offsets[st] + actual_tone] = std::complex<double>(amp, 0.0);
+			symbols_out[s * Nc + stream_offsets[st] + actual_tone] = sample_complex(amp, 0.0);
 		}
 	}
 }
 
 // RX: Non-coherent energy detection across all streams with soft LLR output
-void cl_mfsk::demod(const std::complex<double>* fft_in, int total_bits,
+void cl_mfsk::demod(const sample_complex* fft_in, int total_bits,
                     float* llr_out)
 {
 	if (M == 0 || nBits == 0 || Nc == 0 || nStreams == 0) return;
@@ -322,7 +322,7 @@ void cl_mfsk::demod(const std::complex<double>* fft_in, int total_bits,
 		{
 			if (k < band_start || k >= band_end)
 			{
-				std::complex<double> val = fft_in[s * Nc + k];
+				sample_complex val = fft_in[s * Nc + k];
 				double e = val.real() * val.real() + val.imag() * val.imag();
 				if (std::isfinite(e)) {
 					noise_sum += e;
@@ -342,7 +342,7 @@ void cl_mfsk::demod(const std::complex<double>* fft_in, int total_bits,
 			double E_raw[64]; // M <= 64
 			for (int m = 0; m < M; m++)
 			{
-				std::complex<double> val = fft_in[s * Nc + stream_offsets[st] + m];
+				sample_complex val = fft_in[s * Nc + stream_offsets[st] + m];
 				E_raw[m] = val.real() * val.real() + val.imag() * val.imag();
 				if (!std::isfinite(E_raw[m])) { E_raw[m] = 0.0; }
 			}
@@ -31,7 +31,7 @@ void shift_left(double* matrix, int size, int nShift)
 	}
 }
 
-double get_angle(std::complex <double> value)
+double get_angle(sample_complex value)
 {
 	double theta=0;
 
@@ -55,22 +55,22 @@ double get_angle(std::complex <double> value)
 	return theta;
 }
 
-double get_amplitude(std::complex <double> value)
+double get_amplitude(sample_complex value)
 {
 	double amplitude;
 	amplitude=sqrt(pow(value.real(),2)+pow(value.imag(),2));
 	return amplitude;
 }
 
-std::complex <double> set_complex(double amplitude, double theta)
+sample_complex set_complex(double amplitude, double theta)
 {
-	std::complex <double> value;
+	sample_complex value;
 	value.real(amplitude*cos(theta));
 	value.imag(amplitude*sin(theta));
 	return value;
 }
 
-void matrix_multiplication(std::complex <double>* a, int a_width, int a_hight, std::complex <double>* b, int b_width, int b_hight, std::complex <double>* c)
+void matrix_multiplication(sample_complex* a, int a_width, int a_hight, sample_complex* b, int b_width, int b_hight, sample_complex* c)
 {
 	if(a_width!=b_hight)
 	{
@@ -104,6 +104,66 @@ void byte_to_bit(int* data_byte, int* data_bit, int nBytes)
 	}
 }
 
+void byte_to_packed_bit(const int* data_byte, uint64_t* data_bit, int first_byte, int nBytes)
+{
+	for(int i=first_byte;i<first_byte+nBytes;i++)
+	{
+		data_bit[i>>3]&=~((uint64_t)0xff<<((i&7)*8));
+		data_bit[i>>3]|=(uint64_t)(data_byte[i-first_byte]&0xff)<<((i&7)*8);
+	}
+}
+
+void bit_to_packed_bit(const int* data_bit, uint64_t* data_packed, int nBits)
+{
+	for(int i=0;i<(nBits+63)/64;i++)
+	{
+		data_packed[i]=0;
+	}
+	for(int i=0;i<nBits;i++)
+	{
+		data_packed[i>>6]|=(uint64_t)(data_bit[i]&1)<<(i&63);
+	}
+}
+
+void packed_bit_to_bit(const uint64_t* data_packed, int* data_bit, int nBits)
+{
+	for(int i=0;i<nBits;i++)
+	{
+		data_bit[i]=get_packed_bit(data_packed,i);
+	}
+}
+
+// Copies in chunks of up to 64 bits in increasing bit order, so an overlapping copy to a
+// higher offset of the same array repeats the source like the equivalent per-bit loop.
+void packed_bit_copy(const uint64_t* in, int in_offset, uint64_t* out, int out_offset, int nBits)
+{
+	int chunk=64;
+	if(in==out && out_offset>in_offset && out_offset-in_offset<64)
+	{
+		chunk=out_offset-in_offset;
+	}
+	for(int done=0;done<nBits;done+=chunk)
+	{
+		int length=(nBits-done<chunk)?nBits-done:chunk;
+		int from=in_offset+done;
+		int to=out_offset+done;
+
+		uint64_t bits=in[from>>6]>>(from&63);
+		if((from&63)!=0 && (from&63)+length>64)
+		{
+			bits|=in[(from>>6)+1]<<(64-(from&63));
+		}
+		uint64_t mask=(length==64)?~(uint64_t)0:(((uint64_t)1<<length)-1);
+		bits&=mask;
+
+		out[to>>6]=(out[to>>6]&~(mask<<(to&63)))|(bits<<(to&63));
+		if((to&63)!=0 && (to&63)+length>64)
+		{
+			out[(to>>6)+1]=(out[(to>>6)+1]&~(mask>>(64-(to&63))))|(bits>>(64-(to&63)));
+		}
+	}
+}
+
 void bit_to_byte(int* data_bit, int* data_byte, int nBits)
 {
 	int mask;
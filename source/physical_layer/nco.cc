@@ -0,0 +1,135 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "physical_layer/nco.h"
+
+cl_nco::cl_nco()
+{
+	frequency=0;
+	sampling_frequency=0;
+	phase_increment=0;
+	lane_step_real=1;
+	lane_step_imag=0;
+	phase=0;
+}
+
+cl_nco::~cl_nco()
+{
+}
+
+void cl_nco::update_step()
+{
+	phase_increment=(sampling_frequency!=0)?frequency/sampling_frequency:0;
+	phase_increment-=floor(phase_increment);
+	lane_step_real=cos(2*M_PI*NCO_LANES*phase_increment);
+	lane_step_imag=sin(2*M_PI*NCO_LANES*phase_increment);
+}
+
+void cl_nco::set_frequency(double frequency, double sampling_frequency)
+{
+	if(frequency!=this->frequency || sampling_frequency!=this->sampling_frequency)
+	{
+		this->frequency=frequency;
+		this->sampling_frequency=sampling_frequency;
+		update_step();
+	}
+}
+
+void cl_nco::set_phase(double phase)
+{
+	this->phase=phase-floor(phase);
+}
+
+void cl_nco::reset()
+{
+	phase=0;
+}
+
+void cl_nco::mix_down(const double* in, sample_complex* out, int nItems, double amplitude)
+{
+	double z_real[NCO_LANES],z_imag[NCO_LANES];
+	for(int start=0;start<nItems;start+=NCO_BLOCK)
+	{
+		int block_size=(nItems-start<NCO_BLOCK)?nItems-start:NCO_BLOCK;
+		for(int k=0;k<NCO_LANES;k++)
+		{
+			double lane_phase=2*M_PI*(phase+k*phase_increment);
+			z_real[k]=amplitude*cos(lane_phase);
+			z_imag[k]=amplitude*sin(lane_phase);
+		}
+		int i=0;
+		for(;i+NCO_LANES<=block_size;i+=NCO_LANES)
+		{
+			const double* x=&in[start+i];
+			sample_complex* y=&out[start+i];
+			for(int k=0;k<NCO_LANES;k++)
+			{
+				y[k].real(x[k]*z_real[k]);
+				y[k].imag(x[k]*z_imag[k]);
+				double r=z_real[k]*lane_step_real-z_imag[k]*lane_step_imag;
+				z_imag[k]=z_real[k]*lane_step_imag+z_imag[k]*lane_step_real;
+				z_real[k]=r;
+			}
+		}
+		for(int k=0;i<block_size;i++,k++)
+		{
+			out[start+i].real(in[start+i]*z_real[k]);
+			out[start+i].imag(in[start+i]*z_imag[k]);
+		}
+		phase+=block_size*phase_increment;
+		phase-=floor(phase);
+	}
+}
+
+void cl_nco::mix_up(const sample_complex* in, double* out, int nItems, double amplitude)
+{
+	double z_real[NCO_LANES],z_imag[NCO_LANES];
+	for(int start=0;start<nItems;start+=NCO_BLOCK)
+	{
+		int block_size=(nItems-start<NCO_BLOCK)?nItems-start:NCO_BLOCK;
+		for(int k=0;k<NCO_LANES;k++)
+		{
+			double lane_phase=2*M_PI*(phase+k*phase_increment);
+			z_real[k]=amplitude*cos(lane_phase);
+			z_imag[k]=amplitude*sin(lane_phase);
+		}
+		int i=0;
+		for(;i+NCO_LANES<=block_size;i+=NCO_LANES)
+		{
+			const sample_complex* x=&in[start+i];
+			double* y=&out[start+i];
+			for(int k=0;k<NCO_LANES;k++)
+			{
+				y[k]=x[k].real()*z_real[k]+x[k].imag()*z_imag[k];
+				double r=z_real[k]*lane_step_real-z_imag[k]*lane_step_imag;
+				z_imag[k]=z_real[k]*lane_step_imag+z_imag[k]*lane_step_real;
+				z_real[k]=r;
+			}
+		}
+		for(int k=0;i<block_size;i++,k++)
+		{
+			out[start+i]=in[start+i].real()*z_real[k]+in[start+i].imag()*z_imag[k];
+		}
+		phase+=block_size*phase_increment;
+		phase-=floor(phase);
+	}
+}
@@ -22,7 +22,6 @@
 
 #include "common/os_interop.h"
 #include "physical_layer/ofdm.h"
-#include <algorithm>  // for std::swap in optimized FFT
 
 
 cl_ofdm::cl_ofdm()
@@ -40,34 +39,38 @@ cl_ofdm::cl_ofdm()
 	ffted_data=NULL;
 	estimated_channel=NULL;
 	estimated_channel_without_amplitude_restoration=NULL;
+	ls_numerator=NULL;
+	ls_row_numerator=NULL;
+	ls_denominator=NULL;
+	ls_row_denominator=NULL;
+	estimator_row=NULL;
+	MMSE_tap=NULL;
+	MMSE_weight=NULL;
+	MMSE_triple=NULL;
+	MMSE_nTriples=0;
+	MMSE_delay_spread=0;
+	MMSE_doppler=0.05;
+	MMSE_SNR=0;
 	time_sync_Nsymb=1;
 	freq_offset_ignore_limit=0.1;
 	start_shift=1;
-	passband_start_sample=0;
+	passband_nco.reset();
 	preamble_papr_cut=99;
 	data_papr_cut=99;
 	channel_estimator=ZERO_FORCE;
 	LS_window_width=0;
 	LS_window_hight=0;
 	channel_estimator_amplitude_restoration=NO;
-	// Optimized FFT tables
-	fft_twiddle=NULL;
-	fft_scratch=NULL;
-	fft_bit_rev=NULL;
-	fft_twiddle_size=0;
+	fft_plan=NULL;
+	ifft_plan=NULL;
 	// Pre-allocated passband_to_baseband buffers
 	p2b_l_data=NULL;
-	p2b_data_filtered=NULL;
 	p2b_buffer_size=0;
 	// Pre-allocated Nfft work buffers (Group A)
 	work_buf_a=NULL;
 	work_buf_b=NULL;
 	// Pre-allocated time_sync_preamble buffers (Group B)
-	tsync_corr_loc=NULL;
-	tsync_corr_vals=NULL;
-	tsync_corr_size=0;
-	tsync_data=NULL;
-	tsync_data_size=0;
+	init_time_sync_workspace(&tsync);
 	// Pre-allocated baseband_to_passband buffer (Group C)
 	b2p_data_interpolated=NULL;
 	b2p_buffer_size=0;
@@ -100,25 +103,35 @@ void cl_ofdm::init()
 	Ngi=Nfft*gi;
 
 	ofdm_frame = new struct st_carrier[this->Nsymb*this->Nc];
-	zero_padded_data=new std::complex <double>[Nfft];
-	iffted_data=new std::complex <double>[Nfft];
-	gi_removed_data=new std::complex <double>[Nfft];
-	ffted_data=new std::complex <double>[Nfft];
+	zero_padded_data=new sample_complex[Nfft];
+	iffted_data=new sample_complex[Nfft];
+	gi_removed_data=new sample_complex[Nfft];
+	ffted_data=new sample_complex[Nfft];
 	estimated_channel=new struct st_channel_complex[this->Nsymb*this->Nc];
 	estimated_channel_without_amplitude_restoration=new struct st_channel_complex[this->Nsymb*this->Nc];
 	ofdm_preamble = new struct st_carrier[this->preamble_configurator.Nsymb*this->Nc];
-	passband_start_sample=0;
+	passband_nco.reset();
 
 	preamble_configurator.init(this->Nfft, this->Nc,this->ofdm_preamble, this->start_shift);
 	pilot_configurator.init(this->Nfft, this->Nc,this->Nsymb,this->ofdm_frame, this->start_shift);
 
-	// Initialize optimized FFT tables
-	init_fft_tables(this->Nfft);
+	ls_numerator=new sample_complex[this->Nsymb*this->Nc];
+	ls_row_numerator=new sample_complex[this->Nsymb*this->Nc];
+	ls_denominator=new double[this->Nsymb*this->Nc];
+	ls_row_denominator=new double[this->Nsymb*this->Nc];
+	estimator_row=new sample_complex[this->Nc];
+	if(channel_estimator==CHANNEL_EST_MMSE)
+	{
+		build_MMSE_tables();
+	}
+
+	fft_plan=cl_fft_plan::get(this->Nfft,FFT_FORWARD);
+	ifft_plan=cl_fft_plan::get(this->Nfft,FFT_INVERSE);
 
 	// Pre-allocate shared Nfft work buffers (used by frequency_sync_coarse,
 	// time_sync_mfsk, detect_ack_pattern — never called concurrently)
-	work_buf_a = new std::complex<double>[Nfft];
-	work_buf_b = new std::complex<double>[Nfft];
+	work_buf_a = new sample_complex[Nfft];
+	work_buf_b = new sample_complex[Nfft];
 
 	for(int i=0;i<Nsymb;i++)
 	{
@@ -195,16 +208,26 @@ void cl_ofdm::deinit()
 		estimated_channel_without_amplitude_restoration=NULL;
 	}
 
+	if(ls_numerator!=NULL)
+	{
+		delete[] ls_numerator;
+		delete[] ls_row_numerator;
+		delete[] ls_denominator;
+		delete[] ls_row_denominator;
+		delete[] estimator_row;
+		ls_numerator=NULL;
+		ls_row_numerator=NULL;
+		ls_denominator=NULL;
+		ls_row_denominator=NULL;
+		estimator_row=NULL;
+	}
+	free_MMSE_tables();
+
 	if(p2b_l_data!=NULL)
 	{
 		delete[] p2b_l_data;
 		p2b_l_data=NULL;
 	}
-	if(p2b_data_filtered!=NULL)
-	{
-		delete[] p2b_data_filtered;
-		p2b_data_filtered=NULL;
-	}
 	p2b_buffer_size=0;
 
 	if(work_buf_a!=NULL)
@@ -217,23 +240,7 @@ void cl_ofdm::deinit()
 		delete[] work_buf_b;
 		work_buf_b=NULL;
 	}
-	if(tsync_corr_loc!=NULL)
-	{
-		delete[] tsync_corr_loc;
-		tsync_corr_loc=NULL;
-	}
-	if(tsync_corr_vals!=NULL)
-	{
-		delete[] tsync_corr_vals;
-		tsync_corr_vals=NULL;
-	}
-	tsync_corr_size=0;
-	if(tsync_data!=NULL)
-	{
-		delete[] tsync_data;
-		tsync_data=NULL;
-	}
-	tsync_data_size=0;
+	free_time_sync_workspace(&tsync);
 	if(b2p_data_interpolated!=NULL)
 	{
 		delete[] b2p_data_interpolated;
@@ -243,140 +250,11 @@ void cl_ofdm::deinit()
 
 	pilot_configurator.deinit();
 	preamble_configurator.deinit();
-	deinit_fft_tables();
-}
-
-// ============================================================================
-// Optimized FFT Implementation
-// - Precomputed twiddle factors (no sin/cos in hot path)
-// - Iterative algorithm (no recursion, no heap allocation)
-// - Bit-reversal permutation table
-// ============================================================================
-
-void cl_ofdm::init_fft_tables(int n)
-{
-	if (n <= 0 || (n & (n-1)) != 0) {
-		// n must be power of 2
-		fft_twiddle_size = 0;
-		return;
-	}
-
-	fft_twiddle_size = n;
-
-	// Allocate twiddle factors (only need n/2 for radix-2)
-	fft_twiddle = new std::complex<double>[n/2];
-	for (int k = 0; k < n/2; k++) {
-		double angle = -2.0 * M_PI * k / n;
-		fft_twiddle[k] = std::complex<double>(cos(angle), sin(angle));
-	}
-
-	// Allocate scratch buffer
-	fft_scratch = new std::complex<double>[n];
-
-	// Build bit-reversal permutation table
-	fft_bit_rev = new int[n];
-	int bits = 0;
-	for (int temp = n; temp > 1; temp >>= 1) bits++;
-
-	for (int i = 0; i < n; i++) {
-		int rev = 0;
-		for (int j = 0; j < bits; j++) {
-			if (i & (1 << j)) {
-				rev |= (1 << (bits - 1 - j));
-			}
-		}
-		fft_bit_rev[i] = rev;
-	}
-}
-
-void cl_ofdm::deinit_fft_tables()
-{
-	if (fft_twiddle != NULL) {
-		delete[] fft_twiddle;
-		fft_twiddle = NULL;
-	}
-	if (fft_scratch != NULL) {
-		delete[] fft_scratch;
-		fft_scratch = NULL;
-	}
-	if (fft_bit_rev != NULL) {
-		delete[] fft_bit_rev;
-		fft_bit_rev = NULL;
-	}
-	fft_twiddle_size = 0;
-}
-
-// Optimized iterative in-place FFT (Cooley-Tukey radix-2 DIT)
-void cl_ofdm::_fft_fast(std::complex<double>* v, int n)
-{
-	// Use precomputed tables if available and size matches
-	if (fft_twiddle_size != n || fft_twiddle == NULL) {
-		// Fall back to original implementation for non-standard sizes
-		_fft(v, n);
-		return;
-	}
-
-	// Bit-reversal permutation
-	for (int i = 0; i < n; i++) {
-		if (i < fft_bit_rev[i]) {
-			std::swap(v[i], v[fft_bit_rev[i]]);
-		}
-	}
-
-	// Iterative FFT butterfly operations
-	for (int size = 2; size <= n; size *= 2) {
-		int halfsize = size / 2;
-		int step = n / size;
-
-		for (int i = 0; i < n; i += size) {
-			for (int j = 0; j < halfsize; j++) {
-				std::complex<double> w = fft_twiddle[j * step];
-				std::complex<double> t = w * v[i + j + halfsize];
-				v[i + j + halfsize] = v[i + j] - t;
-				v[i + j] = v[i + j] + t;
-			}
-		}
-	}
-}
-
-// Optimized iterative in-place IFFT
-void cl_ofdm::_ifft_fast(std::complex<double>* v, int n)
-{
-	// Use precomputed tables if available and size matches
-	if (fft_twiddle_size != n || fft_twiddle == NULL) {
-		// Fall back to original implementation
-		_ifft(v, n);
-		return;
-	}
-
-	// Bit-reversal permutation
-	for (int i = 0; i < n; i++) {
-		if (i < fft_bit_rev[i]) {
-			std::swap(v[i], v[fft_bit_rev[i]]);
-		}
-	}
-
-	// Iterative IFFT butterfly operations (conjugate twiddle factors)
-	for (int size = 2; size <= n; size *= 2) {
-		int halfsize = size / 2;
-		int step = n / size;
-
-		for (int i = 0; i < n; i += size) {
-			for (int j = 0; j < halfsize; j++) {
-				// Conjugate twiddle factor for IFFT
-				std::complex<double> w = std::conj(fft_twiddle[j * step]);
-				std::complex<double> t = w * v[i + j + halfsize];
-				v[i + j + halfsize] = v[i + j] - t;
-				v[i + j] = v[i + j] + t;
-			}
-		}
-	}
-
-	// No 1/N scaling - Mercury uses unnormalized IFFT convention
-	// (FFT already normalizes by 1/N in fft())
+	fft_plan=NULL;
+	ifft_plan=NULL;
 }
 
-void cl_ofdm::zero_padder(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::zero_padder(sample_complex* in, sample_complex* out)
 {
 	for(int j=0;j<Nc/2;j++)
 	{
@@ -385,12 +263,12 @@ void cl_ofdm::zero_padder(std::complex <double>* in, std::complex <double>* out)
 
 	for(int j=0;j<start_shift;j++)
 	{
-		out[j]=std::complex <double>(0,0);
+		out[j]=sample_complex(0,0);
 	}
 
 	for(int j=Nc/2+start_shift;j<Nfft-Nc/2;j++)
 	{
-		out[j]=std::complex <double>(0,0);
+		out[j]=sample_complex(0,0);
 	}
 
 	for(int j=Nc/2;j<Nc;j++)
@@ -398,7 +276,7 @@ void cl_ofdm::zero_padder(std::complex <double>* in, std::complex <double>* out)
 		out[j-Nc/2+start_shift]=in[j];
 	}
 }
-void cl_ofdm::zero_depadder(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::zero_depadder(sample_complex* in, sample_complex* out)
 {
 	for(int j=0;j<Nc/2;j++)
 	{
@@ -409,7 +287,7 @@ void cl_ofdm::zero_depadder(std::complex <double>* in, std::complex <double>* ou
 		out[j]=in[j-Nc/2+start_shift];
 	}
 }
-void cl_ofdm::gi_adder(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::gi_adder(sample_complex* in, sample_complex* out)
 {
 	for(int j=0;j<Nfft;j++)
 	{
@@ -420,7 +298,7 @@ void cl_ofdm::gi_adder(std::complex <double>* in, std::complex <double>* out)
 		out[j]=in[j+Nfft-Ngi];
 	}
 }
-void cl_ofdm::gi_remover(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::gi_remover(sample_complex* in, sample_complex* out)
 {
 	for(int j=0;j<Nfft;j++)
 	{
@@ -428,122 +306,62 @@ void cl_ofdm::gi_remover(std::complex <double>* in, std::complex <double>* out)
 	}
 }
 
-void cl_ofdm::fft(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::fft(sample_complex* in, sample_complex* out)
 {
 	for(int i=0;i<Nfft;i++)
 	{
 		out[i]=in[i];
 	}
-	_fft_fast(out,Nfft);  // Use optimized FFT
+	fft_plan->execute(out);
 
 	for(int i=0;i<Nfft;i++)
 	{
-		out[i]=out[i]/(double)Nfft;
+		out[i]=out[i]/(sample_real)Nfft;
 	}
 
 }
-void cl_ofdm::fft(std::complex <double>* in, std::complex <double>* out, int _Nfft)
+void cl_ofdm::fft(sample_complex* in, sample_complex* out, int _Nfft)
 {
 	for(int i=0;i<_Nfft;i++)
 	{
 		out[i]=in[i];
 	}
-	_fft_fast(out,_Nfft);  // Use optimized FFT
+	((_Nfft==Nfft)?fft_plan:cl_fft_plan::get(_Nfft,FFT_FORWARD))->execute(out);
 
 	for(int i=0;i<_Nfft;i++)
 	{
-		out[i]=out[i]/(double)_Nfft;
+		out[i]=out[i]/(sample_real)_Nfft;
 	}
 
 }
 
-void cl_ofdm::_fft(std::complex <double> *v, int n)
-{
-	if(n>1) {
-		std::complex <double> *tmp=new std::complex <double>[n];
-		int k,m;    std::complex <double> z, w, *vo, *ve;
-		ve = tmp; vo = tmp+n/2;
-		for(k=0; k<n/2; k++) {
-			ve[k] = v[2*k];
-			vo[k] = v[2*k+1];
-		}
-		_fft( ve, n/2 );
-		_fft( vo, n/2 );
-		for(m=0; m<n/2; m++) {
-			w.real( cos(2*M_PI*m/(double)n));
-			w.imag( -sin(2*M_PI*m/(double)n));
-			z.real( w.real()*vo[m].real() - w.imag()*vo[m].imag());
-			z.imag( w.real()*vo[m].imag() + w.imag()*vo[m].real());
-			v[  m  ].real( ve[m].real() + z.real());
-			v[  m  ].imag( ve[m].imag() + z.imag());
-			v[m+n/2].real( ve[m].real() - z.real());
-			v[m+n/2].imag( ve[m].imag() - z.imag());
-		}
-		if(tmp!=NULL)
-		{
-			delete[] tmp;
-		}
-	}
-	//Ref:Wickerhauser, Mladen Victor,Mathematics for Multimedia, Birkhäuser Boston, January 2010, DOI: 10.1007/978-0-8176-4880-0, ISBNs 978-0-8176-4880-0, 978-0-8176-4879-4
-	//https://www.math.wustl.edu/~victor/mfmm/
-}
-
-void cl_ofdm::ifft(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::ifft(sample_complex* in, sample_complex* out)
 {
 	for(int i=0;i<Nfft;i++)
 	{
 		out[i]=in[i];
 	}
-	_ifft_fast(out,Nfft);  // Use optimized IFFT
+	// No 1/N scaling - Mercury uses unnormalized IFFT convention
+	// (FFT already normalizes by 1/N in fft())
+	ifft_plan->execute(out);
 }
 
-void cl_ofdm::ifft(std::complex <double>* in, std::complex <double>* out,int _Nfft)
+void cl_ofdm::ifft(sample_complex* in, sample_complex* out,int _Nfft)
 {
 	for(int i=0;i<_Nfft;i++)
 	{
 		out[i]=in[i];
 	}
-	_ifft_fast(out,_Nfft);  // Use optimized IFFT
-}
-
-void cl_ofdm::_ifft(std::complex <double>* v,int n)
-{
-	if(n>1) {
-		std::complex <double> *tmp=new std::complex <double>[n];
-		int k,m;    std::complex <double> z, w, *vo, *ve;
-		ve = tmp; vo = tmp+n/2;
-		for(k=0; k<n/2; k++) {
-			ve[k] = v[2*k];
-			vo[k] = v[2*k+1];
-		}
-		_ifft( ve, n/2);
-		_ifft( vo, n/2);
-		for(m=0; m<n/2; m++) {
-			w.real( cos(2*M_PI*m/(double)n));
-			w.imag( sin(2*M_PI*m/(double)n));
-			z.real( w.real()*vo[m].real() - w.imag()*vo[m].imag());
-			z.imag( w.real()*vo[m].imag() + w.imag()*vo[m].real());
-			v[  m  ].real( ve[m].real() + z.real());
-			v[  m  ].imag( ve[m].imag() + z.imag());
-			v[m+n/2].real( ve[m].real() - z.real());
-			v[m+n/2].imag( ve[m].imag() - z.imag());
-		}
-		if(tmp!=NULL)
-		{
-			delete[] tmp;
-		}
-	}
-	//Ref:Wickerhauser, Mladen Victor,Mathematics for Multimedia, Birkhäuser Boston, January 2010, DOI: 10.1007/978-0-8176-4880-0, ISBNs 978-0-8176-4880-0, 978-0-8176-4879-4
-	//https://www.math.wustl.edu/~victor/mfmm/
+	((_Nfft==Nfft)?ifft_plan:cl_fft_plan::get(_Nfft,FFT_INVERSE))->execute(out);
 }
 
-double cl_ofdm::carrier_sampling_frequency_sync(std::complex <double>*in, double carrier_freq_width, int preamble_nSymb, double sampling_frequency)
+double cl_ofdm::carrier_sampling_frequency_sync(sample_complex*in, double carrier_freq_width, int preamble_nSymb, double sampling_frequency)
 {
 	double frequency_offset_prec=0;
 
-	std::complex <double> p1,p2,mul;
-	std::complex <double> frame[Nfft];
-	std::complex <double> frame_fft[Nfft],frame_depadded1[Nfft],frame_depadded2[Nfft];
+	sample_complex p1,p2,mul;
+	sample_complex frame[Nfft];
+	sample_complex frame_fft[Nfft],frame_depadded1[Nfft],frame_depadded2[Nfft];
 
 	if(preamble_nSymb/2==0)
 	{
@@ -594,7 +412,7 @@ double cl_ofdm::carrier_sampling_frequency_sync(std::complex <double>*in, double
 	//Ref3: M. Speth, S. Fechtel, G. Fock and H. Meyr, "Optimum receiver design for OFDM-based broadband transmission .II. A case study," in IEEE Transactions on Communications, vol. 49, no. 4, pp. 571-578, April 2001, doi: 10.1109/26.917759.
 }
 
-double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrier_spacing, int search_range_subcarriers, int interpolation_rate)
+double cl_ofdm::frequency_sync_coarse(sample_complex* in, double subcarrier_spacing, int search_range_subcarriers, int interpolation_rate)
 {
 	/*
 	 * Full Schmidl-Cox frequency synchronization with integer CFO estimation.
@@ -622,7 +440,7 @@ double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrie
 
 	// Step 1: Fractional CFO estimation from time-domain correlation
 	// Correlate first half with second half of each preamble symbol
-	std::complex<double> P(0.0, 0.0);  // Complex correlation
+	sample_complex P(0.0, 0.0);  // Complex correlation
 	double R = 0.0;  // Normalization (energy of second half)
 
 	// Account for interpolation rate in sample indices
@@ -630,7 +448,7 @@ double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrie
 	int gi_samples = Ngi * interpolation_rate;
 
 	// Use first preamble symbol (after GI)
-	std::complex<double>* symbol_start = in + gi_samples;
+	sample_complex* symbol_start = in + gi_samples;
 
 	// Step 0: Energy gate - check signal level before CFO estimation
 	// This prevents noise from producing bogus CFO estimates
@@ -655,8 +473,8 @@ double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrie
 
 	for (int n = 0; n < half_symbol; n++)
 	{
-		std::complex<double> first_half = symbol_start[n];
-		std::complex<double> second_half = symbol_start[n + half_symbol];
+		sample_complex first_half = symbol_start[n];
+		sample_complex second_half = symbol_start[n + half_symbol];
 
 		// P = Σ r(n) × r*(n + Nfft/2)
 		P += first_half * std::conj(second_half);
@@ -692,8 +510,8 @@ double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrie
 	// Apply fractional correction and FFT the preamble symbol
 	// Note: Input is at interpolation_rate, so we downsample by taking every
 	// interpolation_rate-th sample to get back to baseband (Nfft samples)
-	std::complex<double>* corrected_symbol = work_buf_a;
-	std::complex<double>* fft_out = work_buf_b;
+	sample_complex* corrected_symbol = work_buf_a;
+	sample_complex* fft_out = work_buf_b;
 
 	// Apply fractional frequency correction and downsample to baseband rate
 	// Each output sample n corresponds to input sample n*interpolation_rate
@@ -702,7 +520,7 @@ double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrie
 	{
 		int src_idx = n * interpolation_rate;
 		double phase = phase_inc * n;
-		std::complex<double> correction(std::cos(phase), std::sin(phase));
+		sample_complex correction(std::cos(phase), std::sin(phase));
 		corrected_symbol[n] = symbol_start[src_idx] * correction;
 	}
 
@@ -811,7 +629,7 @@ double cl_ofdm::frequency_sync_coarse(std::complex<double>* in, double subcarrie
 	return total_cfo_hz;
 }
 
-void cl_ofdm::framer(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::framer(sample_complex* in, sample_complex* out)
 {
 	int data_index=0;
 	int pilot_index=0;
@@ -834,7 +652,7 @@ void cl_ofdm::framer(std::complex <double>* in, std::complex <double>* out)
 
 }
 
-void cl_ofdm::deframer(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::deframer(sample_complex* in, sample_complex* out)
 {
 	int data_index=0;
 
@@ -852,14 +670,14 @@ void cl_ofdm::deframer(std::complex <double>* in, std::complex <double>* out)
 }
 
 
-void cl_ofdm::symbol_mod(std::complex <double>*in, std::complex <double>*out)
+void cl_ofdm::symbol_mod(sample_complex*in, sample_complex*out)
 {
 	zero_padder(in,zero_padded_data);
 	ifft(zero_padded_data,iffted_data);
 	gi_adder(iffted_data, out);
 }
 
-void cl_ofdm::symbol_demod(std::complex <double>*in, std::complex <double>*out)
+void cl_ofdm::symbol_demod(sample_complex*in, sample_complex*out)
 {
 	gi_remover(in, gi_removed_data);
 	fft(gi_removed_data,ffted_data);
@@ -891,6 +709,9 @@ cl_pilot_configurator::cl_pilot_configurator()
 	seed=0;
 	print_on=NO;
 	pilot_density=HIGH_DENSITY;
+	pilot_cell=NULL;
+	time_weight=NULL;
+	frequency_weight=NULL;
 }
 
 cl_pilot_configurator::~cl_pilot_configurator()
@@ -899,6 +720,7 @@ cl_pilot_configurator::~cl_pilot_configurator()
 	{
 		delete[] virtual_carrier;
 	}
+	free_interpolation_tables();
 }
 
 void cl_pilot_configurator::init(int Nfft, int Nc, int Nsymb,struct st_carrier* _carrier, int start_shift)
@@ -930,7 +752,7 @@ void cl_pilot_configurator::init(int Nfft, int Nc, int Nsymb,struct st_carrier*
 
 	this->configure();
 
-	sequence = new std::complex <double>[nPilots];
+	sequence = new sample_complex[nPilots];
 
 	if(print_on==YES)
 	{
@@ -945,7 +767,7 @@ void cl_pilot_configurator::init(int Nfft, int Nc, int Nsymb,struct st_carrier*
 		for(int i=0;i<nPilots;i++)
 		{
 			pilot_value=__random()%2 ^ last_pilot;
-			sequence[i]=std::complex <double>(2*pilot_value-1,0)*boost;
+			sequence[i]=sample_complex(2*pilot_value-1,0)*(sample_real)boost;
 			last_pilot=pilot_value;
 		}
 	}
@@ -970,6 +792,7 @@ void cl_pilot_configurator::deinit()
 		delete[] sequence;
 		sequence=NULL;
 	}
+	free_interpolation_tables();
 
 }
 
@@ -1061,6 +884,106 @@ void cl_pilot_configurator::configure()
 			}
 		}
 	}
+
+	build_interpolation_tables();
+}
+
+void cl_pilot_configurator::build_interpolation_tables()
+{
+	free_interpolation_tables();
+
+	pilot_cell=new int[nPilots];
+	time_weight=new struct st_interpolation_weight[Nsymb*Nc];
+	frequency_weight=new struct st_interpolation_weight[Nc];
+
+	int pilot_index=0;
+	for(int j=0;j<Nsymb;j++)
+	{
+		for(int i=0;i<Nc;i++)
+		{
+			if((carrier+j*Nc+i)->type==PILOT)
+			{
+				pilot_cell[pilot_index++]=j*Nc+i;
+			}
+		}
+	}
+
+	int* pilot_rows=new int[Nsymb];
+	int last_anchor=-1;
+	for(int i=0;i<Nc;i++)
+	{
+		int nRows=0;
+		for(int j=0;j<Nsymb;j++)
+		{
+			time_weight[j*Nc+i].first=j*Nc+i;
+			time_weight[j*Nc+i].second=j*Nc+i;
+			time_weight[j*Nc+i].weight=0;
+			if((carrier+j*Nc+i)->type==PILOT)
+			{
+				pilot_rows[nRows++]=j;
+			}
+		}
+		frequency_weight[i].first=i;
+		frequency_weight[i].second=i;
+		frequency_weight[i].weight=0;
+		if((i%Dx!=0 && i!=Nc-1) || nRows==0)
+		{
+			continue;
+		}
+
+		// Rows before the first and after the last pilot are extrapolated from the two nearest pilots.
+		int k=0;
+		for(int j=0;j<Nsymb;j++)
+		{
+			while(k+2<nRows && pilot_rows[k+1]<=j)
+			{
+				k++;
+			}
+			time_weight[j*Nc+i].first=pilot_rows[k]*Nc+i;
+			if(nRows==1)
+			{
+				time_weight[j*Nc+i].second=pilot_rows[k]*Nc+i;
+			}
+			else
+			{
+				time_weight[j*Nc+i].second=pilot_rows[k+1]*Nc+i;
+				time_weight[j*Nc+i].weight=(double)(j-pilot_rows[k])/(double)(pilot_rows[k+1]-pilot_rows[k]);
+			}
+		}
+
+		for(int l=last_anchor+1;l<i;l++)
+		{
+			frequency_weight[l].first=(last_anchor==-1)?i:last_anchor;
+			frequency_weight[l].second=i;
+			frequency_weight[l].weight=(last_anchor==-1)?0:(double)(l-last_anchor)/(double)(i-last_anchor);
+		}
+		last_anchor=i;
+	}
+	for(int l=last_anchor+1;last_anchor!=-1 && l<Nc;l++)
+	{
+		frequency_weight[l].first=last_anchor;
+		frequency_weight[l].second=last_anchor;
+	}
+	delete[] pilot_rows;
+}
+
+void cl_pilot_configurator::free_interpolation_tables()
+{
+	if(pilot_cell!=NULL)
+	{
+		delete[] pilot_cell;
+		pilot_cell=NULL;
+	}
+	if(time_weight!=NULL)
+	{
+		delete[] time_weight;
+		time_weight=NULL;
+	}
+	if(frequency_weight!=NULL)
+	{
+		delete[] frequency_weight;
+		frequency_weight=NULL;
+	}
 }
 
 void cl_pilot_configurator::print()
@@ -1134,7 +1057,7 @@ void cl_preamble_configurator::init(int Nfft, int Nc, struct st_carrier* _carrie
 
 	this->configure();
 
-	sequence = new std::complex <double>[this->Nsymb*this->Nc];
+	sequence = new sample_complex[this->Nsymb*this->Nc];
 
 	if(print_on==YES)
 	{
@@ -1146,11 +1069,11 @@ void cl_preamble_configurator::init(int Nfft, int Nc, struct st_carrier* _carrie
 	{
 		if(modulation==MOD_BPSK)
 		{
-			sequence[i]=std::complex <double>(2*(__random()%2)-1,0);
+			sequence[i]=sample_complex(2*(__random()%2)-1,0);
 		}
 		else if(modulation==MOD_QPSK)
 		{
-			sequence[i]=std::complex <double>(2*(__random()%2)-1,2*(__random()%2)-1)/sqrt(2);
+			sequence[i]=sample_complex(2*(__random()%2)-1,2*(__random()%2)-1)/(sample_real)sqrt(2);
 		}
 	}
 
@@ -1263,190 +1186,368 @@ void cl_preamble_configurator::print()
 	}
 }
 
-void cl_ofdm::ZF_channel_estimator(std::complex <double>*in)
+// Pilot estimates of the anchor columns are interpolated in time into one row, then the row is
+// interpolated in frequency and written out; all weights come from the pilot configurator.
+void cl_ofdm::interpolate_channel(const sample_complex* pilot_estimate)
 {
-	int pilot_index=0;
+	const struct st_interpolation_weight* time_weight=pilot_configurator.time_weight;
+	const struct st_interpolation_weight* frequency_weight=pilot_configurator.frequency_weight;
+
 	for(int i=0;i<Nsymb;i++)
 	{
 		for(int j=0;j<Nc;j++)
 		{
-			if((ofdm_frame+i*Nc+j)->type==PILOT)
-			{
-				(estimated_channel+i*Nc+j)->status=MEASURED;
-				(estimated_channel+i*Nc+j)->value=*(in+i*Nc+j)/pilot_configurator.sequence[pilot_index];
-				pilot_index++;
-			}
-			else
+			if(frequency_weight[j].first==j)
 			{
-				(estimated_channel+i*Nc+j)->status=UNKNOWN;
-				(estimated_channel+i*Nc+j)->value=0;
+				const struct st_interpolation_weight* w=&time_weight[i*Nc+j];
+				estimator_row[j]=pilot_estimate[w->first]+(sample_real)w->weight*(pilot_estimate[w->second]-pilot_estimate[w->first]);
 			}
 		}
+		for(int j=0;j<Nc;j++)
+		{
+			const struct st_interpolation_weight* w=&frequency_weight[j];
+			(estimated_channel+i*Nc+j)->value=estimator_row[w->first]+(sample_real)w->weight*(estimator_row[w->second]-estimator_row[w->first]);
+			(estimated_channel+i*Nc+j)->status=(w->first==j && (ofdm_frame+i*Nc+j)->type==PILOT)?MEASURED:INTERPOLATED;
+		}
 	}
+}
 
-	for(int j=0;j<Nc;j++)
+void cl_ofdm::ZF_channel_estimator(sample_complex*in)
+{
+	if(pilot_configurator.nPilots==0)
 	{
-		if(j%this->pilot_configurator.Dx==0)
-		{
-			interpolate_linear_col(estimated_channel,Nc,Nsymb,j);
-		}
-		else if(j==Nc-1)
-		{
-			interpolate_linear_col(estimated_channel,Nc,Nsymb,j);
-		}
+		return;
 	}
+	for(int p=0;p<pilot_configurator.nPilots;p++)
+	{
+		int cell=pilot_configurator.pilot_cell[p];
+		ls_numerator[cell]=*(in+cell)/pilot_configurator.sequence[p];
+	}
+	interpolate_channel(ls_numerator);
+/*
+ * Ref: R. Lucky, “The adaptive equalizer,” IEEE Signal Processing Magazine, vol. 23, no. 3, pp. 104–107, 2006.
+ */
+}
 
-	for(int j=0;j<Nc;j+=this->pilot_configurator.Dx)
+// Sliding window sums of n cells spaced by stride, the window is clipped at both ends.
+static void window_sum(const sample_complex* in_numerator, const double* in_denominator, sample_complex* out_numerator, double* out_denominator, int n, int stride, int half_width)
+{
+	sample_complex numerator=0;
+	double denominator=0;
+	for(int k=0;k<=half_width && k<n;k++)
 	{
-		if(j+this->pilot_configurator.Dx<Nc)
+		numerator+=in_numerator[k*stride];
+		denominator+=in_denominator[k*stride];
+	}
+	for(int k=0;k<n;k++)
+	{
+		out_numerator[k*stride]=numerator;
+		out_denominator[k*stride]=denominator;
+		if(k+half_width+1<n)
 		{
-			interpolate_bilinear_matrix(estimated_channel,Nc,Nsymb,j,j+this->pilot_configurator.Dx,0,Nsymb-1);
+			numerator+=in_numerator[(k+half_width+1)*stride];
+			denominator+=in_denominator[(k+half_width+1)*stride];
 		}
-		else if(j!=Nc-1)
+		if(k-half_width>=0)
 		{
-			interpolate_bilinear_matrix(estimated_channel,Nc,Nsymb,j,Nc-1,0,Nsymb-1);
+			numerator-=in_numerator[(k-half_width)*stride];
+			denominator-=in_denominator[(k-half_width)*stride];
 		}
 	}
-/*
- * Ref: R. Lucky, “The adaptive equalizer,” IEEE Signal Processing Magazine, vol. 23, no. 3, pp. 104–107, 2006.
- */
 }
 
-void cl_ofdm::LS_channel_estimator(std::complex <double>*in)
+// LS fit of one channel value to all pilots of the LS_window_width x LS_window_hight window around
+// each pilot: sum(conj(x)*y)/sum(|x|^2), with both sums taken as separable running window sums.
+void cl_ofdm::LS_channel_estimator(sample_complex*in)
 {
-	std::complex <double> pilot_data[Nsymb*Nc]={std::complex <double> (0,0)};
+	if(pilot_configurator.nPilots==0)
+	{
+		return;
+	}
+	for(int i=0;i<Nsymb*Nc;i++)
+	{
+		ls_numerator[i]=0;
+		ls_denominator[i]=0;
+	}
+	for(int p=0;p<pilot_configurator.nPilots;p++)
+	{
+		int cell=pilot_configurator.pilot_cell[p];
+		ls_numerator[cell]=std::conj(pilot_configurator.sequence[p])*(*(in+cell));
+		ls_denominator[cell]=std::norm(pilot_configurator.sequence[p]);
+	}
 
-	int pilot_index=0;
 	for(int i=0;i<Nsymb;i++)
 	{
-		for(int j=0;j<Nc;j++)
-		{
-			if((ofdm_frame+i*Nc+j)->type==PILOT)
-			{
-				*(pilot_data+i*Nc+j)=pilot_configurator.sequence[pilot_index];
-				pilot_index++;
-			}
-			else
-			{
-				(estimated_channel+i*Nc+j)->status=UNKNOWN;
-				(estimated_channel+i*Nc+j)->value=0;
-			}
+		window_sum(&ls_numerator[i*Nc],&ls_denominator[i*Nc],&ls_row_numerator[i*Nc],&ls_row_denominator[i*Nc],Nc,1,LS_window_width/2);
+	}
+	for(int j=0;j<Nc;j++)
+	{
+		window_sum(&ls_row_numerator[j],&ls_row_denominator[j],&ls_numerator[j],&ls_denominator[j],Nsymb,Nc,LS_window_hight/2);
+	}
 
-		}
+	for(int p=0;p<pilot_configurator.nPilots;p++)
+	{
+		int cell=pilot_configurator.pilot_cell[p];
+		ls_numerator[cell]/=(sample_real)ls_denominator[cell];
 	}
+	interpolate_channel(ls_numerator);
+/*
+ * Ref J. . -J. van de Beek, O. Edfors, M. Sandell, S. K. Wilson and P. O. Borjesson, "On channel estimation in OFDM systems," 1995 IEEE 45th Vehicular Technology Conference. Countdown to the Wireless Twenty-First Century, Chicago, IL, USA, 1995, pp. 815-819 vol.2, doi: 10.1109/VETEC.1995.504981.
+ */
+}
 
-	// Debug: how many pilots found in ofdm_frame?
-	static int ls_debug_count = 0;
-	if(ls_debug_count < 5) {
-		printf("[LS-DEBUG] ofdm_frame=%p Nsymb=%d Nc=%d pilot_index=%d\n",
-			(void*)ofdm_frame, Nsymb, Nc, pilot_index);
-		fflush(stdout);
-		ls_debug_count++;
+static const double MMSE_bucket_SNR_dB[MMSE_SNR_BUCKETS]={0,6,12,18,24};
+
+static double sinc(double x)
+{
+	if(x==0)
+	{
+		return 1;
 	}
+	return sin(M_PI*x)/(M_PI*x);
+}
 
-	int nPilots=0;
-	std::complex <double> ch_tmp;
+// Uniform Doppler spectrum in time and uniform delay profile in frequency (robust Wiener design).
+static double channel_correlation(int symbol_distance, int carrier_distance, double doppler, double delay_spread)
+{
+	return sinc(2*doppler*symbol_distance)*sinc(delay_spread*carrier_distance);
+}
 
-	for(int j=0;j<Nc;j++)
+// Solves A*x=b in place for a symmetric positive definite A (Cholesky), b is replaced by x.
+static void solve_positive_definite(double* A, double* b, int n)
+{
+	for(int j=0;j<n;j++)
 	{
-		for(int i=0;i<Nsymb;i++)
+		double d=A[j*n+j];
+		for(int k=0;k<j;k++)
 		{
-			if((ofdm_frame+i*Nc+j)->type!=PILOT)
+			d-=A[j*n+k]*A[j*n+k];
+		}
+		d=sqrt(d);
+		A[j*n+j]=d;
+		for(int i=j+1;i<n;i++)
+		{
+			double s=A[i*n+j];
+			for(int k=0;k<j;k++)
 			{
-				continue;
+				s-=A[i*n+k]*A[j*n+k];
 			}
+			A[i*n+j]=s/d;
+		}
+	}
+	for(int i=0;i<n;i++)
+	{
+		for(int k=0;k<i;k++)
+		{
+			b[i]-=A[i*n+k]*b[k];
+		}
+		b[i]/=A[i*n+i];
+	}
+	for(int i=n-1;i>=0;i--)
+	{
+		for(int k=i+1;k<n;k++)
+		{
+			b[i]-=A[k*n+i]*b[k];
+		}
+		b[i]/=A[i*n+i];
+	}
+}
 
-			int window_vertical_start=i-LS_window_hight/2;
-			int window_vertical_end=i+LS_window_hight/2;
+// Switches the estimator of an initialized modem, the MMSE tables are built on first use.
+void cl_ofdm::set_channel_estimator(int estimator)
+{
+	channel_estimator=estimator;
+	if(channel_estimator==CHANNEL_EST_MMSE && MMSE_tap==NULL)
+	{
+		build_MMSE_tables();
+	}
+}
 
-			int window_horizontal_start=j-LS_window_width/2;
-			int window_horizontal_end=j+LS_window_width/2;
+// Every cell is estimated from the MMSE_TAPS pilots best correlated with it, taken from a box of
+// +-span cells around it. The weights r_hp*(R_pp+I/SNR)^-1 are solved once per SNR bucket.
+void cl_ofdm::build_MMSE_tables()
+{
+	free_MMSE_tables();
+	if(pilot_configurator.nPilots==0)
+	{
+		return;
+	}
+
+	int N=Nsymb*Nc;
+	double delay_spread=(MMSE_delay_spread>0)?MMSE_delay_spread:2*gi;
+	int span=2*pilot_configurator.Dy+pilot_configurator.Dx;
+	int nCandidates_max=(2*span+1)*(2*span+1);
+
+	MMSE_tap=new int[N*MMSE_TAPS];
+	MMSE_weight=new sample_real[MMSE_SNR_BUCKETS*N*MMSE_TAPS];
+	MMSE_triple=new int[3*pilot_configurator.nPilots];
+
+	int* candidate_cell=new int[nCandidates_max];
+	double* candidate_score=new double[nCandidates_max];
+	double A[MMSE_TAPS*MMSE_TAPS],b[MMSE_TAPS];
 
-			nPilots=0;
-			for(int k=window_vertical_start;k<=window_vertical_end;k++)
+	for(int i=0;i<Nsymb;i++)
+	{
+		for(int j=0;j<Nc;j++)
+		{
+			int nCandidates=0;
+			for(int k=std::max(i-span,0);k<=std::min(i+span,Nsymb-1);k++)
 			{
-				if(k<0 || k>=Nsymb)
+				for(int l=std::max(j-span,0);l<=std::min(j+span,Nc-1);l++)
 				{
-					continue;
-				}
-				for(int l=window_horizontal_start;l<=window_horizontal_end;l++)
-				{
-					if(l<0 || l>=Nc)
-					{
-						continue;
-					}
-
 					if((ofdm_frame+k*Nc+l)->type==PILOT)
 					{
-						nPilots++;
+						candidate_cell[nCandidates]=k*Nc+l;
+						// Nearer pilots win ties.
+						candidate_score[nCandidates]=fabs(channel_correlation(k-i,l-j,MMSE_doppler,delay_spread))-1e-6*((k-i)*(k-i)+(l-j)*(l-j));
+						nCandidates++;
 					}
 				}
 			}
 
-			std::complex <double> x[nPilots], y[nPilots];
-
-			int x_y_index=0;
-			for(int k=window_vertical_start;k<=window_vertical_end;k++)
+			int* tap=&MMSE_tap[(i*Nc+j)*MMSE_TAPS];
+			int nTaps=std::min(nCandidates,MMSE_TAPS);
+			for(int t=0;t<nTaps;t++)
 			{
-				if(k<0 || k>=Nsymb)
-				{
-					continue;
-				}
-				for(int l=window_horizontal_start;l<=window_horizontal_end;l++)
+				int best=t;
+				for(int c=t+1;c<nCandidates;c++)
 				{
-
-					if(l<0 || l>=Nc)
-					{
-						continue;
-					}
-					if((ofdm_frame+k*Nc+l)->type==PILOT)
+					if(candidate_score[c]>candidate_score[best])
 					{
-						x[x_y_index]=*(pilot_data+k*Nc+l);
-						y[x_y_index]=*(in+k*Nc+l);
-						x_y_index++;
+						best=c;
 					}
 				}
+				std::swap(candidate_cell[t],candidate_cell[best]);
+				std::swap(candidate_score[t],candidate_score[best]);
+				tap[t]=candidate_cell[t];
 			}
-			//ch_tmp=(x.transpose *x).inverse * x.transpose * y
-			matrix_multiplication(x,nPilots,1,x,1,nPilots,&ch_tmp);
-			ch_tmp=1.0/ch_tmp;
-			for(int m=0;m<nPilots;m++)
+			for(int t=nTaps;t<MMSE_TAPS;t++)
 			{
-				x[m]*=ch_tmp;
+				tap[t]=(nTaps>0)?tap[0]:i*Nc+j;
 			}
-			matrix_multiplication(x,nPilots,1,y,1,nPilots,&ch_tmp);
 
-			(estimated_channel+i*Nc+j)->status=MEASURED;
-			(estimated_channel+i*Nc+j)->value=ch_tmp;
+			for(int bucket=0;bucket<MMSE_SNR_BUCKETS;bucket++)
+			{
+				double noise=pow(10,-MMSE_bucket_SNR_dB[bucket]/10);
+				for(int t=0;t<nTaps;t++)
+				{
+					for(int u=0;u<nTaps;u++)
+					{
+						A[t*nTaps+u]=channel_correlation(tap[t]/Nc-tap[u]/Nc,tap[t]%Nc-tap[u]%Nc,MMSE_doppler,delay_spread)+((t==u)?noise:0);
+					}
+					b[t]=channel_correlation(tap[t]/Nc-i,tap[t]%Nc-j,MMSE_doppler,delay_spread);
+				}
+				solve_positive_definite(A,b,nTaps);
+				sample_real* weight=&MMSE_weight[(bucket*N+i*Nc+j)*MMSE_TAPS];
+				for(int t=0;t<MMSE_TAPS;t++)
+				{
+					weight[t]=(t<nTaps)?b[t]:0;
+				}
+			}
 		}
 	}
 
-
+	MMSE_nTriples=0;
 	for(int j=0;j<Nc;j++)
 	{
-		if(j%this->pilot_configurator.Dx==0)
-		{
-			interpolate_linear_col(estimated_channel,Nc,Nsymb,j);
-		}
-		else if(j==Nc-1)
+		int run[3]={0,0,0};
+		int nRun=0;
+		for(int i=0;i<Nsymb;i++)
 		{
-			interpolate_linear_col(estimated_channel,Nc,Nsymb,j);
+			if((ofdm_frame+i*Nc+j)->type!=PILOT)
+			{
+				continue;
+			}
+			run[0]=run[1];
+			run[1]=run[2];
+			run[2]=i*Nc+j;
+			if(++nRun>=3)
+			{
+				MMSE_triple[3*MMSE_nTriples]=run[0];
+				MMSE_triple[3*MMSE_nTriples+1]=run[1];
+				MMSE_triple[3*MMSE_nTriples+2]=run[2];
+				MMSE_nTriples++;
+			}
 		}
 	}
 
-	for(int j=0;j<Nc;j+=this->pilot_configurator.Dx)
+	delete[] candidate_cell;
+	delete[] candidate_score;
+}
+
+void cl_ofdm::free_MMSE_tables()
+{
+	if(MMSE_tap!=NULL)
+	{
+		delete[] MMSE_tap;
+		MMSE_tap=NULL;
+	}
+	if(MMSE_weight!=NULL)
+	{
+		delete[] MMSE_weight;
+		MMSE_weight=NULL;
+	}
+	if(MMSE_triple!=NULL)
+	{
+		delete[] MMSE_triple;
+		MMSE_triple=NULL;
+	}
+	MMSE_nTriples=0;
+}
+
+// 2D Wiener interpolation of the ZF pilot estimates. The noise of the pilot estimates is taken
+// from the second difference of runs of three pilots in a column, which cancels the channel slope.
+void cl_ofdm::MMSE_channel_estimator(sample_complex*in)
+{
+	if(pilot_configurator.nPilots==0)
+	{
+		return;
+	}
+	if(MMSE_tap==NULL)
+	{
+		build_MMSE_tables();
+	}
+
+	double power=0;
+	for(int p=0;p<pilot_configurator.nPilots;p++)
+	{
+		int cell=pilot_configurator.pilot_cell[p];
+		ls_numerator[cell]=*(in+cell)/pilot_configurator.sequence[p];
+		power+=std::norm(ls_numerator[cell]);
+	}
+	power/=pilot_configurator.nPilots;
+
+	double noise=0;
+	for(int t=0;t<MMSE_nTriples;t++)
 	{
-		if(j+this->pilot_configurator.Dx<Nc)
+		noise+=std::norm(ls_numerator[MMSE_triple[3*t]]-(sample_real)2*ls_numerator[MMSE_triple[3*t+1]]+ls_numerator[MMSE_triple[3*t+2]]);
+	}
+	int bucket=MMSE_SNR_BUCKETS-1;
+	if(MMSE_nTriples>0 && noise>0)
+	{
+		noise/=6.0*MMSE_nTriples;
+		MMSE_SNR=(power>noise)?10*log10((power-noise)/noise):-99.9;
+		while(bucket>0 && MMSE_bucket_SNR_dB[bucket]>MMSE_SNR+3)
 		{
-			interpolate_bilinear_matrix(estimated_channel,Nc,Nsymb,j,j+this->pilot_configurator.Dx,0,Nsymb-1);
+			bucket--;
 		}
-		else if(j!=Nc-1)
+	}
+
+	const sample_real* weight=&MMSE_weight[bucket*Nsymb*Nc*MMSE_TAPS];
+	for(int c=0;c<Nsymb*Nc;c++)
+	{
+		const int* tap=&MMSE_tap[c*MMSE_TAPS];
+		const sample_real* w=&weight[c*MMSE_TAPS];
+		sample_complex h=0;
+		for(int t=0;t<MMSE_TAPS;t++)
 		{
-			interpolate_bilinear_matrix(estimated_channel,Nc,Nsymb,j,Nc-1,0,Nsymb-1);
+			h+=w[t]*ls_numerator[tap[t]];
 		}
+		(estimated_channel+c)->value=h;
+		(estimated_channel+c)->status=((ofdm_frame+c)->type==PILOT)?MEASURED:INTERPOLATED;
 	}
 /*
- * Ref J. . -J. van de Beek, O. Edfors, M. Sandell, S. K. Wilson and P. O. Borjesson, "On channel estimation in OFDM systems," 1995 IEEE 45th Vehicular Technology Conference. Countdown to the Wireless Twenty-First Century, Chicago, IL, USA, 1995, pp. 815-819 vol.2, doi: 10.1109/VETEC.1995.504981.
+ * Ref: Y. Li, L. J. Cimini and N. R. Sollenberger, "Robust channel estimation for OFDM systems with rapid dispersive fading channels," IEEE Transactions on Communications, vol. 46, no. 7, pp. 902-915, July 1998.
  */
 }
 
@@ -1464,7 +1565,7 @@ void cl_ofdm::restore_channel_amplitude()
  * Ref: F. Jerji and C. Akamine, "Enhanced ZF and LS channel estimators for OFDM with MPSK modulation," 2024 IEEE International Symposium on Broadband Multimedia Systems and Broadcasting (BMSB).
  */
 }
-void cl_ofdm::automatic_gain_control(std::complex <double>*in)
+void cl_ofdm::automatic_gain_control(sample_complex*in)
 {
 	int pilot_index=0;
 	double pilot_amp=0;
@@ -1497,34 +1598,155 @@ void cl_ofdm::automatic_gain_control(std::complex <double>*in)
 	}
 }
 
-double cl_ofdm::measure_variance(std::complex <double>*in)
+double cl_ofdm::measure_variance(sample_complex*in, int first_symbol, int nSymbols)
 {
 	double variance=0;
 	int pilot_index=0;
-	std::complex <double> diff;
+	int nPilots_measured=0;
+	int last_symbol=(nSymbols<0)?Nsymb:first_symbol+nSymbols;
+	sample_complex diff;
 	for(int i=0;i<Nsymb;i++)
 	{
 		for(int j=0;j<Nc;j++)
 		{
 			if((ofdm_frame+i*Nc+j)->type==PILOT)
 			{
-				diff=*(in+i*Nc+j) -pilot_configurator.sequence[pilot_index];
+				if(i>=first_symbol && i<last_symbol)
+				{
+					diff=*(in+i*Nc+j) -pilot_configurator.sequence[pilot_index];
+					variance+=pow(diff.real(),2)+pow(diff.imag(),2);
+					nPilots_measured++;
+				}
 				pilot_index++;
-				variance+=pow(diff.real(),2)+pow(diff.imag(),2);
 			}
 		}
 
 	}
-	variance/=(double)pilot_index;
+	variance/=(double)nPilots_measured;
 
 	return variance;
 }
 
-double cl_ofdm::measure_signal_stregth(std::complex <double>*in, int nItems)
+void cl_ofdm::fill_missing_symbols(sample_complex*in, int first_symbol, int nSymbols)
+{
+	sample_complex H[Nc];
+	int nH[Nc];
+	int last_symbol=first_symbol+nSymbols;
+	int pilot_index=0;
+
+	for(int j=0;j<Nc;j++)
+	{
+		H[j]=0;
+		nH[j]=0;
+	}
+
+	for(int i=0;i<Nsymb;i++)
+	{
+		for(int j=0;j<Nc;j++)
+		{
+			if((ofdm_frame+i*Nc+j)->type==PILOT)
+			{
+				if(i>=first_symbol && i<last_symbol)
+				{
+					H[j]+=*(in+i*Nc+j)/pilot_configurator.sequence[pilot_index];
+					nH[j]++;
+				}
+				pilot_index++;
+			}
+		}
+	}
+
+	for(int j=0;j<Nc;j++)
+	{
+		if(nH[j]!=0)
+		{
+			H[j]/=(double)nH[j];
+		}
+	}
+
+	// Columns without a received pilot take the nearest column that has one.
+	for(int j=0;j<Nc;j++)
+	{
+		if(nH[j]!=0)
+		{
+			continue;
+		}
+		for(int k=1;k<Nc;k++)
+		{
+			if(j-k>=0 && nH[j-k]!=0)
+			{
+				H[j]=H[j-k];
+				break;
+			}
+			if(j+k<Nc && nH[j+k]!=0)
+			{
+				H[j]=H[j+k];
+				break;
+			}
+		}
+	}
+
+	pilot_index=0;
+	for(int i=0;i<Nsymb;i++)
+	{
+		for(int j=0;j<Nc;j++)
+		{
+			if(i>=first_symbol && i<last_symbol)
+			{
+				if((ofdm_frame+i*Nc+j)->type==PILOT)
+				{
+					pilot_index++;
+				}
+			}
+			else if((ofdm_frame+i*Nc+j)->type==PILOT)
+			{
+				*(in+i*Nc+j)=H[j]*pilot_configurator.sequence[pilot_index];
+				pilot_index++;
+			}
+			else
+			{
+				*(in+i*Nc+j)=0;
+			}
+		}
+	}
+}
+
+// How well the preamble carriers keep their phase from one preamble symbol to the next, 1 for a
+// clean preamble. It needs no channel estimate and drops on noise and false syncs.
+double cl_ofdm::preamble_coherence(sample_complex*in)
+{
+	sample_complex previous[Nc],current[Nc];
+	double turn_sum=0,power=0;
+
+	for(int i=0;i<preamble_configurator.Nsymb;i++)
+	{
+		symbol_demod(in+i*(Nfft+Ngi),current);
+		sample_complex turn=0;
+		for(int j=0;j<Nc;j++)
+		{
+			if((ofdm_preamble+i*Nc+j)->type!=PREAMBLE)
+			{
+				continue;
+			}
+			current[j]*=conj((ofdm_preamble+i*Nc+j)->value);
+			if(i>0)
+			{
+				turn+=current[j]*conj(previous[j]);
+				power+=std::abs(current[j])*std::abs(previous[j]);
+			}
+			previous[j]=current[j];
+		}
+		turn_sum+=std::abs(turn);
+	}
+
+	return (power>0)?turn_sum/power:0;
+}
+
+double cl_ofdm::measure_signal_stregth(sample_complex*in, int nItems)
 {
 	double signal_stregth=0;
 	double signal_stregth_dbm=0;
-	std::complex <double> value;
+	sample_complex value;
 
 	for(int i=0;i<nItems;i++)
 	{
@@ -1591,12 +1813,12 @@ void cl_ofdm::peak_clip(double *in, int nItems, double papr)
 
 }
 
-void cl_ofdm::peak_clip(std::complex <double> *in, int nItems, double papr)
+void cl_ofdm::peak_clip(sample_complex *in, int nItems, double papr)
 {
 	double power_measurment_avg=0;
 	double power_tmp=0;
 	double peak_allowed=0;
-	std::complex <double> value;
+	sample_complex value;
 	for(int i=0;i<nItems;i++)
 	{
 		value=*(in+i);
@@ -1619,11 +1841,11 @@ void cl_ofdm::peak_clip(std::complex <double> *in, int nItems, double papr)
 
 }
 
-double cl_ofdm::measure_SNR(std::complex <double>*in_s, std::complex <double>*in_n, int nItems)
+double cl_ofdm::measure_SNR(sample_complex*in_s, sample_complex*in_n, int nItems)
 {
 	double variance=0;
 	double SNR=0;
-	std::complex <double> diff;
+	sample_complex diff;
 	for(int i=0;i<nItems;i++)
 	{
 		diff=*(in_n+i)-*(in_s+i);
@@ -1634,7 +1856,7 @@ double cl_ofdm::measure_SNR(std::complex <double>*in_s, std::complex <double>*in
 	return SNR;
 }
 
-void cl_ofdm::channel_equalizer(std::complex <double>* in, std::complex <double>* out)
+void cl_ofdm::channel_equalizer(sample_complex* in, sample_complex* out)
 {
 	for(int i=0;i<Nsymb;i++)
 	{
@@ -1645,7 +1867,7 @@ void cl_ofdm::channel_equalizer(std::complex <double>* in, std::complex <double>
 		}
 	}
 }
-void cl_ofdm::channel_equalizer_without_amplitude_restoration(std::complex <double>* in,std::complex <double>* out)
+void cl_ofdm::channel_equalizer_without_amplitude_restoration(sample_complex* in,sample_complex* out)
 {
 	for(int i=0;i<Nsymb;i++)
 	{
@@ -1656,7 +1878,7 @@ void cl_ofdm::channel_equalizer_without_amplitude_restoration(std::complex <doub
 	}
 }
 
-int cl_ofdm::time_sync(std::complex <double>*in, int size, int interpolation_rate, int location_to_return)
+int cl_ofdm::time_sync(sample_complex*in, int size, int interpolation_rate, int location_to_return)
 {
 
 	double corss_corr=0;
@@ -1667,7 +1889,7 @@ int cl_ofdm::time_sync(std::complex <double>*in, int size, int interpolation_rat
 	double *corss_corr_vals=new double[size];
 	int return_val;
 
-	std::complex <double> *a_c, *b_c;
+	sample_complex *a_c, *b_c;
 
 	for(int i=0;i<size;i++)
 	{
@@ -1732,27 +1954,102 @@ int cl_ofdm::time_sync(std::complex <double>*in, int size, int interpolation_rat
 	return return_val;
 }
 
-int cl_ofdm::time_sync_preamble(std::complex <double>*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max)
+void init_time_sync_workspace(st_time_sync_workspace* workspace)
 {
-	double corss_corr=0;
-	double norm_a=0;
-	double norm_b=0;
+	workspace->corr_loc=NULL;
+	workspace->corr_vals=NULL;
+	workspace->corr_size=0;
+	workspace->prefix_energy=NULL;
+	workspace->prefix_gi=NULL;
+	workspace->prefix_half=NULL;
+	workspace->prefix_size=0;
+}
 
-	// Grow-as-needed correlation buffers (shared with time_sync_preamble_with_metric)
-	if(size > tsync_corr_size)
+void free_time_sync_workspace(st_time_sync_workspace* workspace)
+{
+	if(workspace->corr_loc!=NULL)
 	{
-		if(tsync_corr_loc!=NULL) delete[] tsync_corr_loc;
-		if(tsync_corr_vals!=NULL) delete[] tsync_corr_vals;
-		tsync_corr_loc = new int[size];
-		tsync_corr_vals = new double[size];
-		tsync_corr_size = size;
+		delete[] workspace->corr_loc;
+		workspace->corr_loc=NULL;
 	}
-	int *corss_corr_loc = tsync_corr_loc;
-	double *corss_corr_vals = tsync_corr_vals;
-	int return_val;
+	if(workspace->corr_vals!=NULL)
+	{
+		delete[] workspace->corr_vals;
+		workspace->corr_vals=NULL;
+	}
+	workspace->corr_size=0;
+	if(workspace->prefix_energy!=NULL)
+	{
+		delete[] workspace->prefix_energy;
+		delete[] workspace->prefix_gi;
+		delete[] workspace->prefix_half;
+		workspace->prefix_energy=NULL;
+		workspace->prefix_gi=NULL;
+		workspace->prefix_half=NULL;
+	}
+	workspace->prefix_size=0;
+}
 
+// Schmidl-Cox metric of the candidate at i from the prefix sums of time_sync_preamble_metric().
+static double preamble_metric_at(const double* energy, const double* gi_corr, const double* half_corr, int i, int nSymb, int symbol_len, int gi_len, int half_len, int fft_len)
+{
+	double corss_corr=0,norm_a=0,norm_b=0;
+	for(int l=0;l<nSymb;l++)
+	{
+		int gi_start=i+l*symbol_len;
+		int half_start=gi_start+gi_len;
 
-	std::complex <double> *a_c, *b_c;
+		corss_corr+=gi_corr[gi_start+gi_len]-gi_corr[gi_start];
+		corss_corr+=half_corr[half_start+half_len]-half_corr[half_start];
+		norm_a+=energy[half_start+half_len]-energy[gi_start];
+		norm_b+=energy[gi_start+fft_len+gi_len]-energy[gi_start+fft_len];
+		norm_b+=energy[half_start+2*half_len]-energy[half_start+half_len];
+	}
+
+	// Norm threshold: VB-Cable silence has amplitude ~1e-10 (nonzero).
+	// Norms accumulate to ~1e-18 and the ratio produces unstable metrics
+	// (up to 0.93) that can beat real preamble peaks. Use threshold
+	// instead of exact == 0.0 to suppress these degenerate cases.
+	if(norm_a < 0.001 || norm_b < 0.001)
+		return 0.0;
+	return corss_corr/sqrt(norm_a*norm_b);
+}
+
+// Fills corr_vals/corr_loc of the workspace with the Schmidl-Cox metric of every step-th candidate offset.
+// The GI and half-symbol correlations and both energies are differences of prefix sums, so each
+// candidate costs O(preamble symbols) instead of O(preamble length) and step=1 is affordable.
+void cl_ofdm::time_sync_preamble_metric(st_time_sync_workspace* workspace, sample_complex*in, int size, int interpolation_rate, int step)
+{
+	int gi_len=this->Ngi*interpolation_rate;
+	int half_len=(this->Nfft/2)*interpolation_rate;
+	int fft_len=this->Nfft*interpolation_rate;
+	int symbol_len=(this->Ngi+this->Nfft)*interpolation_rate;
+	int data_len=preamble_configurator.Nsymb*symbol_len;
+
+	// Grow-as-needed correlation and prefix sum buffers
+	if(size > workspace->corr_size)
+	{
+		if(workspace->corr_loc!=NULL) delete[] workspace->corr_loc;
+		if(workspace->corr_vals!=NULL) delete[] workspace->corr_vals;
+		workspace->corr_loc = new int[size];
+		workspace->corr_vals = new double[size];
+		workspace->corr_size = size;
+	}
+	if(size+1 > workspace->prefix_size)
+	{
+		if(workspace->prefix_energy!=NULL) delete[] workspace->prefix_energy;
+		if(workspace->prefix_gi!=NULL) delete[] workspace->prefix_gi;
+		if(workspace->prefix_half!=NULL) delete[] workspace->prefix_half;
+		workspace->prefix_energy = new double[size+1];
+		workspace->prefix_gi = new double[size+1];
+		workspace->prefix_half = new double[size+1];
+		workspace->prefix_size = size+1;
+	}
+	int *corss_corr_loc = workspace->corr_loc;
+	double *corss_corr_vals = workspace->corr_vals;
+	double *energy = workspace->prefix_energy;
+	double *gi_corr = workspace->prefix_gi;
+	double *half_corr = workspace->prefix_half;
 
 	for(int i=0;i<size;i++)
 	{
@@ -1760,190 +2057,104 @@ int cl_ofdm::time_sync_preamble(std::complex <double>*in, int size, int interpol
 		corss_corr_vals[i]=0;
 	}
 
-	int data_len = preamble_configurator.Nsymb*(this->Ngi+this->Nfft)*interpolation_rate;
-	if(data_len > tsync_data_size)
-	{
-		if(tsync_data!=NULL) delete[] tsync_data;
-		tsync_data = new std::complex<double>[data_len];
-		tsync_data_size = data_len;
-	}
-	std::complex <double> *data = tsync_data;
-
-	for(int i=0;i<size-preamble_configurator.Nsymb*(this->Ngi+this->Nfft)*interpolation_rate;i+=step)
+	// energy[n]=sum |in[k]|^2, gi_corr[n]=sum Re(in[k]*conj(in[k+Nfft])), half_corr[n]=sum Re(in[k]*conj(in[k+Nfft/2])), k<n
+	energy[0]=0;
+	gi_corr[0]=0;
+	half_corr[0]=0;
+	for(int k=0;k<size;k++)
 	{
-		for(int k=0;k<preamble_configurator.Nsymb*(this->Ngi+this->Nfft)*interpolation_rate;k++)
+		energy[k+1]=energy[k]+in[k].real()*in[k].real()+in[k].imag()*in[k].imag();
+		gi_corr[k+1]=gi_corr[k];
+		if(k+fft_len<size)
 		{
-			data[k]=*(in+i+k);
+			gi_corr[k+1]+=in[k].real()*in[k+fft_len].real()+in[k].imag()*in[k+fft_len].imag();
 		}
-
-		corss_corr=0;
-		norm_a=0;
-		norm_b=0;
-		for(int l=0;l<preamble_configurator.Nsymb;l++)
+		half_corr[k+1]=half_corr[k];
+		if(k+half_len<size)
 		{
-			a_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate;
-			b_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate+this->Nfft*interpolation_rate;
-
-			for(int m=0;m<this->Ngi*interpolation_rate;m++)
-			{
-				corss_corr+=a_c[m].real()*b_c[m].real();
-				norm_a+=a_c[m].real()*a_c[m].real();
-				norm_b+=b_c[m].real()*b_c[m].real();
-
-				corss_corr+=a_c[m].imag()*b_c[m].imag();
-				norm_a+=a_c[m].imag()*a_c[m].imag();
-				norm_b+=b_c[m].imag()*b_c[m].imag();
-			}
-
-			a_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate+this->Ngi*interpolation_rate;
-			b_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate+(this->Ngi+this->Nfft/2)*interpolation_rate;
-
-			for(int m=0;m<(this->Nfft/2)*interpolation_rate;m++)
-			{
-				corss_corr+=a_c[m].real()*b_c[m].real();
-				norm_a+=a_c[m].real()*a_c[m].real();
-				norm_b+=b_c[m].real()*b_c[m].real();
-
-				corss_corr+=a_c[m].imag()*b_c[m].imag();
-				norm_a+=a_c[m].imag()*a_c[m].imag();
-				norm_b+=b_c[m].imag()*b_c[m].imag();
-			}
+			half_corr[k+1]+=in[k].real()*in[k+half_len].real()+in[k].imag()*in[k+half_len].imag();
 		}
-
-		if(norm_a < 0.001 || norm_b < 0.001)
-			corss_corr = 0.0;
-		else
-			corss_corr=corss_corr/sqrt(norm_a*norm_b);
-		corss_corr_vals[i]=corss_corr;
-		corss_corr_loc[i]=i;
 	}
 
-	// Clamp location_to_return to valid range to prevent reading uninitialized sort entries
-	if(location_to_return >= nTrials_max)
-		location_to_return = nTrials_max - 1;
-
-	for(int j=0;j<nTrials_max;j++)
+	for(int i=0;i<size-data_len;i+=step)
 	{
-		corss_corr_loc[j]=j;
-		for(int i=j+1;i<size;i++)
-		{
-			if (corss_corr_vals[i]>corss_corr_vals[j])
-			{
-				corss_corr_vals[j]=corss_corr_vals[i];
-				corss_corr_loc[j]=i;
-			}
-		}
+		corss_corr_vals[i]=preamble_metric_at(energy,gi_corr,half_corr,i,preamble_configurator.Nsymb,symbol_len,gi_len,half_len,fft_len);
+		corss_corr_loc[i]=i;
 	}
-
-	return_val=corss_corr_loc[location_to_return];
-	return return_val;
 /*
  * 	Ref: T. M. Schmidl and D. C. Cox, "Robust frequency and timing synchronization for OFDM," in IEEE Transactions on Communications, vol. 45, no. 12, pp. 1613-1621, Dec. 1997, doi: 10.1109/26.650240.
  *
  */
 }
 
-TimeSyncResult cl_ofdm::time_sync_preamble_with_metric(std::complex <double>*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max)
+// metric[i-first] of the candidates first<=i<last of in[0..size-1], as time_sync_preamble_metric() with
+// step 1 finds them: candidates closer than a preamble to the end of in get 0. The metric of a
+// candidate only depends on the preamble length of in behind it, so the prefix sums only cover
+// in[first..last-1] and that preamble length.
+void cl_ofdm::time_sync_preamble_metric_range(st_time_sync_workspace* workspace, const sample_complex* in, int size, int interpolation_rate, int first, int last, double* metric)
 {
-	/*
-	 * Same as time_sync_preamble() but also returns the correlation metric.
-	 * This allows the caller to assess the quality of the time sync detection.
-	 * A high correlation (>0.7) indicates strong preamble detection.
-	 */
-	double corss_corr=0;
-	double norm_a=0;
-	double norm_b=0;
-	double max_correlation = 0.0;
+	int gi_len=this->Ngi*interpolation_rate;
+	int half_len=(this->Nfft/2)*interpolation_rate;
+	int fft_len=this->Nfft*interpolation_rate;
+	int symbol_len=(this->Ngi+this->Nfft)*interpolation_rate;
+	int data_len=preamble_configurator.Nsymb*symbol_len;
 
-	TimeSyncResult result;
-	result.delay = 0;
-	result.correlation = 0.0;
-
-	// Grow-as-needed correlation buffers
-	if(size > tsync_corr_size)
+	int nCandidates=((last<size-data_len)?last:size-data_len)-first;
+	for(int i=(nCandidates>0)?nCandidates:0;i<last-first;i++)
 	{
-		if(tsync_corr_loc!=NULL) delete[] tsync_corr_loc;
-		if(tsync_corr_vals!=NULL) delete[] tsync_corr_vals;
-		tsync_corr_loc = new int[size];
-		tsync_corr_vals = new double[size];
-		tsync_corr_size = size;
+		metric[i]=0;
 	}
-	int *corss_corr_loc = tsync_corr_loc;
-	double *corss_corr_vals = tsync_corr_vals;
-
-	std::complex <double> *a_c, *b_c;
-
-	for(int i=0;i<size;i++)
+	if(nCandidates<=0)
 	{
-		corss_corr_loc[i]=-1;
-		corss_corr_vals[i]=0;
+		return;
 	}
 
-	int data_len = preamble_configurator.Nsymb*(this->Ngi+this->Nfft)*interpolation_rate;
-	if(data_len > tsync_data_size)
+	int span=nCandidates+data_len;
+	if(span+1 > workspace->prefix_size)
 	{
-		if(tsync_data!=NULL) delete[] tsync_data;
-		tsync_data = new std::complex<double>[data_len];
-		tsync_data_size = data_len;
+		if(workspace->prefix_energy!=NULL) delete[] workspace->prefix_energy;
+		if(workspace->prefix_gi!=NULL) delete[] workspace->prefix_gi;
+		if(workspace->prefix_half!=NULL) delete[] workspace->prefix_half;
+		workspace->prefix_energy = new double[span+1];
+		workspace->prefix_gi = new double[span+1];
+		workspace->prefix_half = new double[span+1];
+		workspace->prefix_size = span+1;
 	}
-	std::complex <double> *data = tsync_data;
+	double *energy = workspace->prefix_energy;
+	double *gi_corr = workspace->prefix_gi;
+	double *half_corr = workspace->prefix_half;
 
-	for(int i=0;i<size-preamble_configurator.Nsymb*(this->Ngi+this->Nfft)*interpolation_rate;i+=step)
+	// The candidates only read the products of samples inside their own span.
+	const sample_complex* span_in=&in[first];
+	energy[0]=0;
+	gi_corr[0]=0;
+	half_corr[0]=0;
+	for(int k=0;k<span;k++)
 	{
-		for(int k=0;k<preamble_configurator.Nsymb*(this->Ngi+this->Nfft)*interpolation_rate;k++)
+		energy[k+1]=energy[k]+span_in[k].real()*span_in[k].real()+span_in[k].imag()*span_in[k].imag();
+		gi_corr[k+1]=gi_corr[k];
+		if(k+fft_len<span)
 		{
-			data[k]=*(in+i+k);
+			gi_corr[k+1]+=span_in[k].real()*span_in[k+fft_len].real()+span_in[k].imag()*span_in[k+fft_len].imag();
 		}
-
-		corss_corr=0;
-		norm_a=0;
-		norm_b=0;
-		for(int l=0;l<preamble_configurator.Nsymb;l++)
+		half_corr[k+1]=half_corr[k];
+		if(k+half_len<span)
 		{
-			a_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate;
-			b_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate+this->Nfft*interpolation_rate;
-
-			for(int m=0;m<this->Ngi*interpolation_rate;m++)
-			{
-				corss_corr+=a_c[m].real()*b_c[m].real();
-				norm_a+=a_c[m].real()*a_c[m].real();
-				norm_b+=b_c[m].real()*b_c[m].real();
-
-				corss_corr+=a_c[m].imag()*b_c[m].imag();
-				norm_a+=a_c[m].imag()*a_c[m].imag();
-				norm_b+=b_c[m].imag()*b_c[m].imag();
-			}
-
-			a_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate+this->Ngi*interpolation_rate;
-			b_c=data+l*(this->Ngi+this->Nfft)*interpolation_rate+(this->Ngi+this->Nfft/2)*interpolation_rate;
-
-			for(int m=0;m<(this->Nfft/2)*interpolation_rate;m++)
-			{
-				corss_corr+=a_c[m].real()*b_c[m].real();
-				norm_a+=a_c[m].real()*a_c[m].real();
-				norm_b+=b_c[m].real()*b_c[m].real();
-
-				corss_corr+=a_c[m].imag()*b_c[m].imag();
-				norm_a+=a_c[m].imag()*a_c[m].imag();
-				norm_b+=b_c[m].imag()*b_c[m].imag();
-			}
+			half_corr[k+1]+=span_in[k].real()*span_in[k+half_len].real()+span_in[k].imag()*span_in[k+half_len].imag();
 		}
+	}
 
-		// Norm threshold: VB-Cable silence has amplitude ~1e-10 (nonzero).
-		// Norms accumulate to ~1e-18 and the ratio produces unstable metrics
-		// (up to 0.93) that can beat real preamble peaks. Use threshold
-		// instead of exact == 0.0 to suppress these degenerate cases.
-		if(norm_a < 0.001 || norm_b < 0.001)
-			corss_corr = 0.0;
-		else
-			corss_corr=corss_corr/sqrt(norm_a*norm_b);
-		corss_corr_vals[i]=corss_corr;
-		corss_corr_loc[i]=i;
+	for(int i=0;i<nCandidates;i++)
+	{
+		metric[i]=preamble_metric_at(energy,gi_corr,half_corr,i,preamble_configurator.Nsymb,symbol_len,gi_len,half_len,fft_len);
 	}
+}
 
-	// Clamp location_to_return to valid range to prevent reading uninitialized sort entries
-	if(location_to_return >= nTrials_max)
-		location_to_return = nTrials_max - 1;
+// Moves the nTrials_max best candidates to the front of corr_vals/corr_loc of the workspace.
+void cl_ofdm::time_sync_preamble_rank(st_time_sync_workspace* workspace, int size, int nTrials_max)
+{
+	int *corss_corr_loc = workspace->corr_loc;
+	double *corss_corr_vals = workspace->corr_vals;
 
 	for(int j=0;j<nTrials_max;j++)
 	{
@@ -1957,16 +2168,52 @@ TimeSyncResult cl_ofdm::time_sync_preamble_with_metric(std::complex <double>*in,
 			}
 		}
 	}
+}
+
+int cl_ofdm::time_sync_preamble(sample_complex*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max)
+{
+	time_sync_preamble_metric(&tsync,in,size,interpolation_rate,step);
+
+	// Clamp location_to_return to valid range to prevent reading uninitialized sort entries
+	if(location_to_return >= nTrials_max)
+		location_to_return = nTrials_max - 1;
+
+	time_sync_preamble_rank(&tsync,size,nTrials_max);
+
+	return tsync.corr_loc[location_to_return];
+}
+
+TimeSyncResult cl_ofdm::time_sync_preamble_with_metric(sample_complex*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max)
+{
+	return time_sync_preamble_with_metric(&tsync,in,size,interpolation_rate,location_to_return,step,nTrials_max);
+}
+
+// Searches with the given scratch, so several searches can run at once.
+TimeSyncResult cl_ofdm::time_sync_preamble_with_metric(st_time_sync_workspace* workspace, sample_complex*in, int size, int interpolation_rate, int location_to_return, int step, int nTrials_max)
+{
+	/*
+	 * Same as time_sync_preamble() but also returns the correlation metric.
+	 * This allows the caller to assess the quality of the time sync detection.
+	 * A high correlation (>0.7) indicates strong preamble detection.
+	 */
+	TimeSyncResult result;
+
+	time_sync_preamble_metric(workspace,in,size,interpolation_rate,step);
+
+	// Clamp location_to_return to valid range to prevent reading uninitialized sort entries
+	if(location_to_return >= nTrials_max)
+		location_to_return = nTrials_max - 1;
+
+	time_sync_preamble_rank(workspace,size,nTrials_max);
 
-	result.delay = corss_corr_loc[location_to_return];
+	result.delay = workspace->corr_loc[location_to_return];
 	// Get the correlation value at the returned location
-	max_correlation = corss_corr_vals[location_to_return];
-	result.correlation = max_correlation;
+	result.correlation = workspace->corr_vals[location_to_return];
 
 	return result;
 }
 
-int cl_ofdm::time_sync_mfsk(std::complex<double>* baseband_interp, int buffer_size_interp,
+int cl_ofdm::time_sync_mfsk(sample_complex* baseband_interp, int buffer_size_interp,
                             int interpolation_rate, int preamble_nSymb,
                             const int* preamble_tones, int mfsk_M,
                             int nStreams, const int* stream_offsets,
@@ -1981,8 +2228,8 @@ int cl_ofdm::time_sync_mfsk(std::complex<double>* baseband_interp, int buffer_si
 	int sym_period_interp = Nofdm * interpolation_rate;
 	int buffer_nsymb = buffer_size_interp / sym_period_interp;
 
-	std::complex<double>* decimated_sym = work_buf_a;
-	std::complex<double>* fft_out = work_buf_b;
+	sample_complex* decimated_sym = work_buf_a;
+	sample_complex* fft_out = work_buf_b;
 
 	// Map preamble tone indices to FFT bin indices for each stream
 	int preamble_bins[8][4]; // [MAX_PREAMBLE_SYMB][MAX_STREAMS]
@@ -2064,7 +2311,7 @@ int cl_ofdm::time_sync_mfsk(std::complex<double>* baseband_interp, int buffer_si
 
 // ACK pattern detection: slide window across buffer, accumulate E_target/E_total
 // Returns best metric (0.0 = noise, up to ack_nsymb = perfect match)
-double cl_ofdm::detect_ack_pattern(std::complex<double>* baseband_interp, int buffer_size_interp,
+double cl_ofdm::detect_ack_pattern(sample_complex* baseband_interp, int buffer_size_interp,
                                    int interpolation_rate, int ack_nsymb,
                                    const int* ack_tones, int ack_pattern_len,
                                    int tone_hop_step, int mfsk_M,
@@ -2077,8 +2324,8 @@ double cl_ofdm::detect_ack_pattern(std::complex<double>* baseband_interp, int bu
 
 	if (buffer_nsymb < ack_nsymb) return 0.0;
 
-	std::complex<double>* decimated_sym = work_buf_a;
-	std::complex<double>* fft_out = work_buf_b;
+	sample_complex* decimated_sym = work_buf_a;
+	sample_complex* fft_out = work_buf_b;
 
 	int half = Nc / 2;
 	double best_metric = 0.0;
@@ -2185,7 +2432,7 @@ double cl_ofdm::detect_ack_pattern(std::complex<double>* baseband_interp, int bu
 	return best_metric;
 }
 
-int cl_ofdm::symbol_sync(std::complex <double>*in, int size, int interpolation_rate, int location_to_return)
+int cl_ofdm::symbol_sync(sample_complex*in, int size, int interpolation_rate, int location_to_return)
 {
 
 	double corss_corr=0;
@@ -2196,7 +2443,7 @@ int cl_ofdm::symbol_sync(std::complex <double>*in, int size, int interpolation_r
 	double *corss_corr_vals=new double[Nsymb];
 	int return_val;
 
-	std::complex <double> *a_c, *b_c, a, b;
+	sample_complex *a_c, *b_c, a, b;
 
 	for(int i=0;i<Nsymb;i++)
 	{
@@ -2264,7 +2511,7 @@ int cl_ofdm::symbol_sync(std::complex <double>*in, int size, int interpolation_r
 	return return_val;
 }
 
-void cl_ofdm::rational_resampler(std::complex <double>* in, int in_size, std::complex <double>* out, int rate, int interpolation_decimation)
+void cl_ofdm::rational_resampler(sample_complex* in, int in_size, sample_complex* out, int rate, int interpolation_decimation)
 {
 	if (interpolation_decimation==DECIMATION)
 	{
@@ -2291,49 +2538,72 @@ void cl_ofdm::rational_resampler(std::complex <double>* in, int in_size, std::co
 	}
 }
 
-void cl_ofdm::baseband_to_passband(std::complex <double>* in, int in_size, double* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude,int interpolation_rate)
+void cl_ofdm::baseband_to_passband(sample_complex* in, int in_size, double* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude,int interpolation_rate)
 {
-	double sampling_interval=1.0/sampling_frequency;
-
 	// Grow-as-needed interpolation buffer
 	int needed = in_size * interpolation_rate;
 	if(needed > b2p_buffer_size)
 	{
 		if(b2p_data_interpolated!=NULL) delete[] b2p_data_interpolated;
-		b2p_data_interpolated = new std::complex<double>[needed];
+		b2p_data_interpolated = new sample_complex[needed];
 		b2p_buffer_size = needed;
 	}
-	std::complex <double> *data_interpolated = b2p_data_interpolated;
+	sample_complex *data_interpolated = b2p_data_interpolated;
 
 	rational_resampler( in, in_size, data_interpolated, interpolation_rate, INTERPOLATION);
-	for(int i=0;i<in_size*interpolation_rate;i++)
+	passband_nco.set_frequency(carrier_frequency,sampling_frequency);
+	passband_nco.mix_up(data_interpolated,out,in_size*interpolation_rate,carrier_amplitude);
+}
+void cl_ofdm::passband_to_baseband(double* in, int in_size, sample_complex* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, int decimation_rate, cl_FIR* filter)
+{
+	// Reuse pre-allocated buffers (reallocate only if size changed)
+	if(p2b_buffer_size < in_size)
+	{
+		delete[] p2b_l_data;
+		p2b_l_data = new sample_complex[in_size];
+		p2b_buffer_size = in_size;
+	}
+
+	p2b_nco.set_frequency(carrier_frequency,sampling_frequency);
+	p2b_nco.reset();
+	p2b_nco.mix_down(in,p2b_l_data,in_size,carrier_amplitude);
+
+	if(decimation_rate==1)
 	{
-		out[i]=data_interpolated[i].real()*carrier_amplitude*cos(2*M_PI*carrier_frequency*(double)passband_start_sample * sampling_interval);
-		out[i]+=data_interpolated[i].imag()*carrier_amplitude*sin(2*M_PI*carrier_frequency*(double)passband_start_sample * sampling_interval);
-		passband_start_sample++;
+		filter->apply(p2b_l_data,out,in_size);
+	}
+	else
+	{
+		filter->apply_decimate(p2b_l_data,out,in_size,decimation_rate);
 	}
 }
-void cl_ofdm::passband_to_baseband(double* in, int in_size, std::complex <double>* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, int decimation_rate, cl_FIR* filter)
-{
-	double sampling_interval=1.0/sampling_frequency;
 
-	// Reuse pre-allocated buffers (reallocate only if size changed)
+// Computes only out[first..last-1] of passband_to_baseband() without decimation. Only the input
+// the filter reads for these outputs is mixed down, the NCO starts at the phase of in[0].
+void cl_ofdm::passband_to_baseband(double* in, int in_size, sample_complex* out, double sampling_frequency, double carrier_frequency, double carrier_amplitude, cl_FIR* filter, int first, int last)
+{
 	if(p2b_buffer_size < in_size)
 	{
 		delete[] p2b_l_data;
-		delete[] p2b_data_filtered;
-		p2b_l_data = new std::complex<double>[in_size];
-		p2b_data_filtered = new std::complex<double>[in_size];
+		p2b_l_data = new sample_complex[in_size];
 		p2b_buffer_size = in_size;
 	}
 
-	for(int i=0;i<in_size;i++)
+	int center=(filter->filter_nTaps-1)/2;
+	int mix_first=first-(filter->filter_nTaps-1-center);
+	int mix_last=last+center;
+	if(mix_first<0)
+	{
+		mix_first=0;
+	}
+	if(mix_last>in_size)
 	{
-		p2b_l_data[i].real(in[i]*carrier_amplitude*cos(2*M_PI*carrier_frequency*(double)i * sampling_interval));
-		p2b_l_data[i].imag(in[i]*carrier_amplitude*sin(2*M_PI*carrier_frequency*(double)i * sampling_interval));
+		mix_last=in_size;
 	}
 
-	filter->apply(p2b_l_data,p2b_data_filtered,in_size);
+	p2b_nco.set_frequency(carrier_frequency,sampling_frequency);
+	p2b_nco.set_phase(fmod((double)mix_first*carrier_frequency/sampling_frequency,1.0));
+	p2b_nco.mix_down(&in[mix_first],&p2b_l_data[mix_first],mix_last-mix_first,carrier_amplitude);
 
-	rational_resampler(p2b_data_filtered, in_size, out, decimation_rate, DECIMATION);
+	filter->apply(p2b_l_data,out,in_size,first,last);
 }
@@ -63,6 +63,8 @@ cl_configuration_telecom_system::cl_configuration_telecom_system()
 	ofdm_channel_estimator_amplitude_restoration=NO;
 	ofdm_LS_window_width=20;
 	ofdm_LS_window_hight=20;
+	ofdm_MMSE_delay_spread=0;
+	ofdm_MMSE_doppler=0.05;
 
 	bit_energy_dispersal_seed=0;
 
@@ -71,10 +73,15 @@ cl_configuration_telecom_system::cl_configuration_telecom_system()
 
 	ldpc_decoding_algorithm=SPA;
 	ldpc_GBF_eta=0.5;
+	ldpc_MS_alpha=0.9;
+	ldpc_MS_beta=0;
 	ldpc_nIteration_max=50;
+	ldpc_nThreads=0;
 	ldpc_print_nIteration=NO;
 
 	outer_code=CRC16_MODBUS_RTU;
+	harq_nBuffers=4;
+	ir_first_fraction=0;
 
 	frequency_interpolation_rate=4; // should we change to 8 when samplerate is 96 kHz?
 
@@ -22,13 +22,29 @@
 
 #include "physical_layer/psk.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PSK_X86
+#endif
+
+static int psk_select_demod_kernel()
+{
+#ifdef PSK_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2"))
+	{
+		return PSK_DEMOD_KERNEL_AVX2;
+	}
+#endif
+	return PSK_DEMOD_KERNEL_SCALAR;
+}
 
 
 cl_psk::cl_psk()
 {
 	constellation=NULL;
-	D_buf=NULL;
-	LLR_buf=NULL;
+	bit_metric=NULL;
+	demod_kernel=psk_select_demod_kernel();
 	nBits=0;
 	nSymbols=0;
 }
@@ -37,8 +53,7 @@ cl_psk::~cl_psk()
 {
 	deinit();
 	constellation=NULL;
-	D_buf=NULL;
-	LLR_buf=NULL;
+	bit_metric=NULL;
 	nBits=0;
 	nSymbols=0;
 }
@@ -50,194 +65,185 @@ void cl_psk::deinit()
 		delete[] constellation;
 		constellation=NULL;
 	}
-	if(D_buf!=NULL)
+	if(bit_metric!=NULL)
 	{
-		delete[] D_buf;
-		D_buf=NULL;
-	}
-	if(LLR_buf!=NULL)
-	{
-		delete[] LLR_buf;
-		LLR_buf=NULL;
+		delete[] bit_metric;
+		bit_metric=NULL;
 	}
 }
 
 void cl_psk::set_predefined_constellation(int M)
 {
-	std::complex <double>* _constellation =new std::complex <double>[M];
+	sample_complex* _constellation =new sample_complex[M];
 	if(M==MOD_BPSK)
 	{
-		_constellation[0]=std::complex <double> ( 1 , 0 );
-		_constellation[1]=std::complex <double> ( -1 , 0 );
+		_constellation[0]=sample_complex ( 1 , 0 );
+		_constellation[1]=sample_complex ( -1 , 0 );
 	}
 	else if(M==MOD_QPSK)
 	{
-		_constellation[0]=std::complex <double> ( -1,1);
-		_constellation[1]=std::complex <double> ( -1,-1);
-		_constellation[2]=std::complex <double> ( 1,1);
-		_constellation[3]=std::complex <double> ( 1,-1);
+		_constellation[0]=sample_complex ( -1,1);
+		_constellation[1]=sample_complex ( -1,-1);
+		_constellation[2]=sample_complex ( 1,1);
+		_constellation[3]=sample_complex ( 1,-1);
 
 	}
 	else if(M==MOD_8PSK)
 	{
-		_constellation[0]=std::complex <double> ( -1,-1) * sqrt(2.0)/2.0;
-		_constellation[1]=std::complex <double> ( -1,0);
-		_constellation[2]=std::complex <double> ( 0,1);
-		_constellation[3]=std::complex <double> ( -1,1) * sqrt(2.0)/2.0;
-		_constellation[4]=std::complex <double> ( 0,-1);
-		_constellation[5]=std::complex <double> ( 1,-1) * sqrt(2.0)/2.0;
-		_constellation[6]=std::complex <double> ( 1,1) * sqrt(2.0)/2.0;
-		_constellation[7]=std::complex <double> ( 1,0);
+		_constellation[0]=sample_complex ( -1,-1) * (sample_real)(sqrt(2.0)/2.0);
+		_constellation[1]=sample_complex ( -1,0);
+		_constellation[2]=sample_complex ( 0,1);
+		_constellation[3]=sample_complex ( -1,1) * (sample_real)(sqrt(2.0)/2.0);
+		_constellation[4]=sample_complex ( 0,-1);
+		_constellation[5]=sample_complex ( 1,-1) * (sample_real)(sqrt(2.0)/2.0);
+		_constellation[6]=sample_complex ( 1,1) * (sample_real)(sqrt(2.0)/2.0);
+		_constellation[7]=sample_complex ( 1,0);
 	}
 //	else if(M==MOD_8QAM)
 //	{
-//		_constellation[0]=std::complex <double> ( -3,1);
-//		_constellation[1]=std::complex <double> ( -3,-1);
-//		_constellation[2]=std::complex <double> ( -1,1);
-//		_constellation[3]=std::complex <double> ( -1,-1);
-//		_constellation[4]=std::complex <double> ( 3,1);
-//		_constellation[5]=std::complex <double> ( 3,-1);
-//		_constellation[6]=std::complex <double> ( 1,1);
-//		_constellation[7]=std::complex <double> ( 1,-1);
+//		_constellation[0]=sample_complex ( -3,1);
+//		_constellation[1]=sample_complex ( -3,-1);
+//		_constellation[2]=sample_complex ( -1,1);
+//		_constellation[3]=sample_complex ( -1,-1);
+//		_constellation[4]=sample_complex ( 3,1);
+//		_constellation[5]=sample_complex ( 3,-1);
+//		_constellation[6]=sample_complex ( 1,1);
+//		_constellation[7]=sample_complex ( 1,-1);
 //	}
 	else if(M==MOD_16QAM)
 	{
-		_constellation[0]=std::complex <double> ( -3,3);
-		_constellation[1]=std::complex <double> ( -3,1);
-		_constellation[2]=std::complex <double> ( -3,-3);
-		_constellation[3]=std::complex <double> ( -3,-1);
-		_constellation[4]=std::complex <double> ( -1,3);
-		_constellation[5]=std::complex <double> ( -1,1);
-		_constellation[6]=std::complex <double> ( -1,-3);
-		_constellation[7]=std::complex <double> ( -1,-1);
-		_constellation[8]=std::complex <double> ( 3,3);
-		_constellation[9]=std::complex <double> ( 3,1);
-		_constellation[10]=std::complex <double> ( 3,-3);
-		_constellation[11]=std::complex <double> ( 3,-1);
-		_constellation[12]=std::complex <double> ( 1,3);
-		_constellation[13]=std::complex <double> ( 1,1);
-		_constellation[14]=std::complex <double> ( 1,-3);
-		_constellation[15]=std::complex <double> ( 1,-1);
+		_constellation[0]=sample_complex ( -3,3);
+		_constellation[1]=sample_complex ( -3,1);
+		_constellation[2]=sample_complex ( -3,-3);
+		_constellation[3]=sample_complex ( -3,-1);
+		_constellation[4]=sample_complex ( -1,3);
+		_constellation[5]=sample_complex ( -1,1);
+		_constellation[6]=sample_complex ( -1,-3);
+		_constellation[7]=sample_complex ( -1,-1);
+		_constellation[8]=sample_complex ( 3,3);
+		_constellation[9]=sample_complex ( 3,1);
+		_constellation[10]=sample_complex ( 3,-3);
+		_constellation[11]=sample_complex ( 3,-1);
+		_constellation[12]=sample_complex ( 1,3);
+		_constellation[13]=sample_complex ( 1,1);
+		_constellation[14]=sample_complex ( 1,-3);
+		_constellation[15]=sample_complex ( 1,-1);
 	}
 	else if(M==MOD_32QAM)
 	{
-		_constellation[0]=std::complex <double> ( -3,5);
-		_constellation[1]=std::complex <double> ( -1,5);
-		_constellation[2]=std::complex <double> ( -3,-5);
-		_constellation[3]=std::complex <double> ( -1,-5);
-		_constellation[4]=std::complex <double> ( -5,3);
-		_constellation[5]=std::complex <double> ( -5,1);
-		_constellation[6]=std::complex <double> ( -5,-3);
-		_constellation[7]=std::complex <double> ( -5,-1);
-		_constellation[8]=std::complex <double> ( -1,3);
-		_constellation[9]=std::complex <double> ( -1,1);
-		_constellation[10]=std::complex <double> ( -1,-3);
-		_constellation[11]=std::complex <double> ( -1,-1);
-		_constellation[12]=std::complex <double> ( -3,3);
-		_constellation[13]=std::complex <double> ( -3,1);
-		_constellation[14]=std::complex <double> ( -3,-3);
-		_constellation[15]=std::complex <double> ( -3,-1);
-		_constellation[16]=std::complex <double> ( 3,5);
-		_constellation[17]=std::complex <double> ( 1,5);
-		_constellation[18]=std::complex <double> ( 3,-5);
-		_constellation[19]=std::complex <double> ( 1,-5);
-		_constellation[20]=std::complex <double> ( 5,3);
-		_constellation[21]=std::complex <double> ( 5,1);
-		_constellation[22]=std::complex <double> ( 5,-3);
-		_constellation[23]=std::complex <double> ( 5,-1);
-		_constellation[24]=std::complex <double> ( 1,3);
-		_constellation[25]=std::complex <double> ( 1,1);
-		_constellation[26]=std::complex <double> ( 1,-3);
-		_constellation[27]=std::complex <double> ( 1,-1);
-		_constellation[28]=std::complex <double> ( 3,3);
-		_constellation[29]=std::complex <double> ( 3,1);
-		_constellation[30]=std::complex <double> ( 3,-3);
-		_constellation[31]=std::complex <double> ( 3,-1);
+		_constellation[0]=sample_complex ( -3,5);
+		_constellation[1]=sample_complex ( -1,5);
+		_constellation[2]=sample_complex ( -3,-5);
+		_constellation[3]=sample_complex ( -1,-5);
+		_constellation[4]=sample_complex ( -5,3);
+		_constellation[5]=sample_complex ( -5,1);
+		_constellation[6]=sample_complex ( -5,-3);
+		_constellation[7]=sample_complex ( -5,-1);
+		_constellation[8]=sample_complex ( -1,3);
+		_constellation[9]=sample_complex ( -1,1);
+		_constellation[10]=sample_complex ( -1,-3);
+		_constellation[11]=sample_complex ( -1,-1);
+		_constellation[12]=sample_complex ( -3,3);
+		_constellation[13]=sample_complex ( -3,1);
+		_constellation[14]=sample_complex ( -3,-3);
+		_constellation[15]=sample_complex ( -3,-1);
+		_constellation[16]=sample_complex ( 3,5);
+		_constellation[17]=sample_complex ( 1,5);
+		_constellation[18]=sample_complex ( 3,-5);
+		_constellation[19]=sample_complex ( 1,-5);
+		_constellation[20]=sample_complex ( 5,3);
+		_constellation[21]=sample_complex ( 5,1);
+		_constellation[22]=sample_complex ( 5,-3);
+		_constellation[23]=sample_complex ( 5,-1);
+		_constellation[24]=sample_complex ( 1,3);
+		_constellation[25]=sample_complex ( 1,1);
+		_constellation[26]=sample_complex ( 1,-3);
+		_constellation[27]=sample_complex ( 1,-1);
+		_constellation[28]=sample_complex ( 3,3);
+		_constellation[29]=sample_complex ( 3,1);
+		_constellation[30]=sample_complex ( 3,-3);
+		_constellation[31]=sample_complex ( 3,-1);
 
 	}
 	else if(M==MOD_64QAM)
 	{
-		_constellation[0]=std::complex <double> ( -7,7);
-		_constellation[1]=std::complex <double> ( -7,5);
-		_constellation[2]=std::complex <double> ( -7,1);
-		_constellation[3]=std::complex <double> ( -7,3);
-		_constellation[4]=std::complex <double> ( -7,-7);
-		_constellation[5]=std::complex <double> ( -7,-5);
-		_constellation[6]=std::complex <double> ( -7,-1);
-		_constellation[7]=std::complex <double> ( -7,-3);
-		_constellation[8]=std::complex <double> ( -5,7);
-		_constellation[9]=std::complex <double> ( -5,5);
-		_constellation[10]=std::complex <double> ( -5,1);
-		_constellation[11]=std::complex <double> ( -5,3);
-		_constellation[12]=std::complex <double> ( -5,-7);
-		_constellation[13]=std::complex <double> ( -5,-5);
-		_constellation[14]=std::complex <double> ( -5,-1);
-		_constellation[15]=std::complex <double> ( -5,-3);
-		_constellation[16]=std::complex <double> ( -1,7);
-		_constellation[17]=std::complex <double> ( -1,5);
-		_constellation[18]=std::complex <double> ( -1,1);
-		_constellation[19]=std::complex <double> ( -1,3);
-		_constellation[20]=std::complex <double> ( -1,-7);
-		_constellation[21]=std::complex <double> ( -1,-5);
-		_constellation[22]=std::complex <double> ( -1,-1);
-		_constellation[23]=std::complex <double> ( -1,-3);
-		_constellation[24]=std::complex <double> ( -3,7);
-		_constellation[25]=std::complex <double> ( -3,5);
-		_constellation[26]=std::complex <double> ( -3,1);
-		_constellation[27]=std::complex <double> ( -3,3);
-		_constellation[28]=std::complex <double> ( -3,-7);
-		_constellation[29]=std::complex <double> ( -3,-5);
-		_constellation[30]=std::complex <double> ( -3,-1);
-		_constellation[31]=std::complex <double> ( -3,-3);
-		_constellation[32]=std::complex <double> ( 7,7);
-		_constellation[33]=std::complex <double> ( 7,5);
-		_constellation[34]=std::complex <double> ( 7,1);
-		_constellation[35]=std::complex <double> ( 7,3);
-		_constellation[36]=std::complex <double> ( 7,-7);
-		_constellation[37]=std::complex <double> ( 7,-5);
-		_constellation[38]=std::complex <double> ( 7,-1);
-		_constellation[39]=std::complex <double> ( 7,-3);
-		_constellation[40]=std::complex <double> ( 5,7);
-		_constellation[41]=std::complex <double> ( 5,5);
-		_constellation[42]=std::complex <double> ( 5,1);
-		_constellation[43]=std::complex <double> ( 5,3);
-		_constellation[44]=std::complex <double> ( 5,-7);
-		_constellation[45]=std::complex <double> ( 5,-5);
-		_constellation[46]=std::complex <double> ( 5,-1);
-		_constellation[47]=std::complex <double> ( 5,-3);
-		_constellation[48]=std::complex <double> ( 1,7);
-		_constellation[49]=std::complex <double> ( 1,5);
-		_constellation[50]=std::complex <double> ( 1,1);
-		_constellation[51]=std::complex <double> ( 1,3);
-		_constellation[52]=std::complex <double> ( 1,-7);
-		_constellation[53]=std::complex <double> ( 1,-5);
-		_constellation[54]=std::complex <double> ( 1,-1);
-		_constellation[55]=std::complex <double> ( 1,-3);
-		_constellation[56]=std::complex <double> ( 3,7);
-		_constellation[57]=std::complex <double> ( 3,5);
-		_constellation[58]=std::complex <double> ( 3,1);
-		_constellation[59]=std::complex <double> ( 3,3);
-		_constellation[60]=std::complex <double> ( 3,-7);
-		_constellation[61]=std::complex <double> ( 3,-5);
-		_constellation[62]=std::complex <double> ( 3,-1);
-		_constellation[63]=std::complex <double> ( 3,-3);
+		_constellation[0]=sample_complex ( -7,7);
+		_constellation[1]=sample_complex ( -7,5);
+		_constellation[2]=sample_complex ( -7,1);
+		_constellation[3]=sample_complex ( -7,3);
+		_constellation[4]=sample_complex ( -7,-7);
+		_constellation[5]=sample_complex ( -7,-5);
+		_constellation[6]=sample_complex ( -7,-1);
+		_constellation[7]=sample_complex ( -7,-3);
+		_constellation[8]=sample_complex ( -5,7);
+		_constellation[9]=sample_complex ( -5,5);
+		_constellation[10]=sample_complex ( -5,1);
+		_constellation[11]=sample_complex ( -5,3);
+		_constellation[12]=sample_complex ( -5,-7);
+		_constellation[13]=sample_complex ( -5,-5);
+		_constellation[14]=sample_complex ( -5,-1);
+		_constellation[15]=sample_complex ( -5,-3);
+		_constellation[16]=sample_complex ( -1,7);
+		_constellation[17]=sample_complex ( -1,5);
+		_constellation[18]=sample_complex ( -1,1);
+		_constellation[19]=sample_complex ( -1,3);
+		_constellation[20]=sample_complex ( -1,-7);
+		_constellation[21]=sample_complex ( -1,-5);
+		_constellation[22]=sample_complex ( -1,-1);
+		_constellation[23]=sample_complex ( -1,-3);
+		_constellation[24]=sample_complex ( -3,7);
+		_constellation[25]=sample_complex ( -3,5);
+		_constellation[26]=sample_complex ( -3,1);
+		_constellation[27]=sample_complex ( -3,3);
+		_constellation[28]=sample_complex ( -3,-7);
+		_constellation[29]=sample_complex ( -3,-5);
+		_constellation[30]=sample_complex ( -3,-1);
+		_constellation[31]=sample_complex ( -3,-3);
+		_constellation[32]=sample_complex ( 7,7);
+		_constellation[33]=sample_complex ( 7,5);
+		_constellation[34]=sample_complex ( 7,1);
+		_constellation[35]=sample_complex ( 7,3);
+		_constellation[36]=sample_complex ( 7,-7);
+		_constellation[37]=sample_complex ( 7,-5);
+		_constellation[38]=sample_complex ( 7,-1);
+		_constellation[39]=sample_complex ( 7,-3);
+		_constellation[40]=sample_complex ( 5,7);
+		_constellation[41]=sample_complex ( 5,5);
+		_constellation[42]=sample_complex ( 5,1);
+		_constellation[43]=sample_complex ( 5,3);
+		_constellation[44]=sample_complex ( 5,-7);
+		_constellation[45]=sample_complex ( 5,-5);
+		_constellation[46]=sample_complex ( 5,-1);
+		_constellation[47]=sample_complex ( 5,-3);
+		_constellation[48]=sample_complex ( 1,7);
+		_constellation[49]=sample_complex ( 1,5);
+		_constellation[50]=sample_complex ( 1,1);
+		_constellation[51]=sample_complex ( 1,3);
+		_constellation[52]=sample_complex ( 1,-7);
+		_constellation[53]=sample_complex ( 1,-5);
+		_constellation[54]=sample_complex ( 1,-1);
+		_constellation[55]=sample_complex ( 1,-3);
+		_constellation[56]=sample_complex ( 3,7);
+		_constellation[57]=sample_complex ( 3,5);
+		_constellation[58]=sample_complex ( 3,1);
+		_constellation[59]=sample_complex ( 3,3);
+		_constellation[60]=sample_complex ( 3,-7);
+		_constellation[61]=sample_complex ( 3,-5);
+		_constellation[62]=sample_complex ( 3,-1);
+		_constellation[63]=sample_complex ( 3,-3);
 	}
 	set_constellation(_constellation,M);
 	delete[] _constellation;
 }
 
-void cl_psk::set_constellation(std::complex <double> *_constellation, int size)
+void cl_psk::set_constellation(sample_complex *_constellation, int size)
 {
 	float power_normalization_value=0;
 
-	constellation=new std::complex <double>[size];
+	constellation=new sample_complex[size];
 	nSymbols=size;
 	nBits=(int)log2(nSymbols);
 
-	// Pre-allocate demod workspace buffers (eliminates per-frame heap churn)
-	D_buf=new float[nSymbols];
-	LLR_buf=new float[nBits];
-
 	for(int i=0;i<size;i++)
 	{
 		constellation[i]=*(_constellation+i);
@@ -253,10 +259,129 @@ void cl_psk::set_constellation(std::complex <double> *_constellation, int size)
 	{
 		constellation[i]*=power_normalization_value;
 	}
+
+	build_bit_metrics();
+}
+
+// Adds value v to the distinct values of list[0..n).
+static void psk_add_level(float* list, int* n, float v)
+{
+	for(int i=0;i<*n;i++)
+	{
+		if(list[i]==v)
+		{
+			return;
+		}
+	}
+	list[(*n)++]=v;
+}
+
+void cl_psk::build_bit_metrics()
+{
+	if(nSymbols/2>PSK_TERMS_MAX)
+	{
+		std::cout<<"Unsupported constellation size "<<nSymbols<<std::endl;
+		exit(2);
+	}
+	bit_metric=new st_psk_bit_metric[nBits];
+
+	for(int k=0;k<nBits;k++)
+	{
+		unsigned int mask=1<<k;
+		st_psk_bit_metric* metric=&bit_metric[k];
+		float level_i[2][PSK_TERMS_MAX],level_q[2][PSK_TERMS_MAX];
+		int nLevels_i[2]={0,0},nLevels_q[2]={0,0};
+
+		for(int j=0;j<nSymbols;j++)
+		{
+			int v=(j & mask)?1:0;
+			psk_add_level(level_i[v],&nLevels_i[v],constellation[j].real());
+			psk_add_level(level_q[v],&nLevels_q[v],constellation[j].imag());
+		}
+
+		// The points of each bit value form a grid (I levels x Q levels) when there are exactly
+		// nLevels_i*nLevels_q of them; if both grids also share the levels of one axis, that
+		// axis cancels out of the LLR.
+		int same_q=(nLevels_q[0]==nLevels_q[1]);
+		int same_i=(nLevels_i[0]==nLevels_i[1]);
+		for(int v=0;v<2;v++)
+		{
+			int grid=(nLevels_i[v]*nLevels_q[v]==nSymbols/2);
+			for(int l=0;l<nLevels_q[v] && same_q;l++)
+			{
+				int found=0;
+				for(int m=0;m<nLevels_q[1-v];m++)
+				{
+					found|=(level_q[1-v][m]==level_q[v][l]);
+				}
+				same_q=grid && found;
+			}
+			for(int l=0;l<nLevels_i[v] && same_i;l++)
+			{
+				int found=0;
+				for(int m=0;m<nLevels_i[1-v];m++)
+				{
+					found|=(level_i[1-v][m]==level_i[v][l]);
+				}
+				same_i=grid && found;
+			}
+		}
+
+		if(same_q)
+		{
+			metric->axis=PSK_AXIS_I;
+		}
+		else if(same_i)
+		{
+			metric->axis=PSK_AXIS_Q;
+		}
+		else
+		{
+			metric->axis=PSK_AXIS_IQ;
+		}
+
+		for(int v=0;v<2;v++)
+		{
+			metric->nTerms[v]=0;
+			if(metric->axis==PSK_AXIS_I)
+			{
+				for(int l=0;l<nLevels_i[v];l++)
+				{
+					metric->offset[v][l]=level_i[v][l]*level_i[v][l];
+					metric->slope_i[v][l]=-2*level_i[v][l];
+					metric->slope_q[v][l]=0;
+				}
+				metric->nTerms[v]=nLevels_i[v];
+			}
+			else if(metric->axis==PSK_AXIS_Q)
+			{
+				for(int l=0;l<nLevels_q[v];l++)
+				{
+					metric->offset[v][l]=level_q[v][l]*level_q[v][l];
+					metric->slope_i[v][l]=0;
+					metric->slope_q[v][l]=-2*level_q[v][l];
+				}
+				metric->nTerms[v]=nLevels_q[v];
+			}
+			else
+			{
+				for(int j=0;j<nSymbols;j++)
+				{
+					if(((j & mask)?1:0)==v)
+					{
+						int t=metric->nTerms[v]++;
+						metric->offset[v][t]=constellation[j].real()*constellation[j].real()+constellation[j].imag()*constellation[j].imag();
+						metric->slope_i[v][t]=-2*constellation[j].real();
+						metric->slope_q[v][t]=-2*constellation[j].imag();
+					}
+				}
+			}
+		}
+	}
 }
 
 
-void cl_psk::mod(const int *in,int nItems,std::complex <double> *out)
+void cl_psk::mod(const int *in,int nItems,sample_complex *out)
 {
 	for(int i=0;i<nItems;i+=nBits)
 	{
@@ -271,58 +396,184 @@ void cl_psk::mod(const int *in,int nItems,std::complex <double> *out)
 	}
 }
 
+void cl_psk::mod(const uint64_t *in,int nItems,sample_complex *out)
+{
+	// Same mapping as the int version: the first bit of each symbol is the MSB of its index.
+	for(int i=0;i<nItems;i+=nBits)
+	{
+		unsigned int const_loc=0;
+		for(int j=0;j<nBits;j++)
+		{
+			const_loc=(const_loc<<1)|(unsigned int)((in[(i+j)>>6]>>((i+j)&63))&1);
+		}
+		*(out+i/nBits)=constellation[const_loc];
+	}
+}
 
 
 
 
-void cl_psk::demod(const std::complex <double> *in,int nItems,float *out,float variance)
-{
-
-	float* D=D_buf;
-	float* LLR=LLR_buf;
-	float Dmin0,Dmin1;
-	unsigned int mask;
 
-	for(int i=0;i<nItems;i+=nBits)
+// Scalar max-log demapper for symbols [first,last).
+static void psk_demod_scalar(const st_psk_bit_metric* bit_metric, int nBits, const sample_complex *in, int first, int last, float *out, const int* out_index, float inv_variance)
+{
+	for(int s=first;s<last;s++)
 	{
-
-		for(int j=0;j<nSymbols;j++)
+		float yi=(float)in[s].real();
+		float yq=(float)in[s].imag();
+		for(int k=0;k<nBits;k++)
 		{
-			D[j]=pow((real(*(in+i/nBits))-real(constellation[j])),2)+pow((imag(*(in+i/nBits))-imag(constellation[j])),2);
+			const st_psk_bit_metric* metric=&bit_metric[k];
+			float m[2];
+			for(int v=0;v<2;v++)
+			{
+				const float* offset=metric->offset[v];
+				float best;
+				if(metric->axis==PSK_AXIS_I)
+				{
+					best=offset[0]+metric->slope_i[v][0]*yi;
+					for(int t=1;t<metric->nTerms[v];t++)
+					{
+						best=std::min(best,offset[t]+metric->slope_i[v][t]*yi);
+					}
+				}
+				else if(metric->axis==PSK_AXIS_Q)
+				{
+					best=offset[0]+metric->slope_q[v][0]*yq;
+					for(int t=1;t<metric->nTerms[v];t++)
+					{
+						best=std::min(best,offset[t]+metric->slope_q[v][t]*yq);
+					}
+				}
+				else
+				{
+					best=offset[0]+metric->slope_i[v][0]*yi+metric->slope_q[v][0]*yq;
+					for(int t=1;t<metric->nTerms[v];t++)
+					{
+						best=std::min(best,offset[t]+metric->slope_i[v][t]*yi+metric->slope_q[v][t]*yq);
+					}
+				}
+				m[v]=best;
+			}
+			int bit=s*nBits+nBits-k-1;
+			out[(out_index==NULL)?bit:out_index[bit]]=inv_variance*(m[1]-m[0]);
 		}
+	}
+}
+
+#ifdef PSK_X86
+
+// Eight symbols per step: the interleaved I/Q samples are split into an I and a Q vector, every
+// bit metric is evaluated on all eight lanes and the LLRs are scattered to their bit positions.
+__attribute__((target("avx2")))
+static int psk_demod_avx2(const st_psk_bit_metric* bit_metric, int nBits, const sample_complex *in, int nSymb, float *out, const int* out_index, float inv_variance)
+{
+	alignas(32) float llr[8];
+	const __m256 scale=_mm256_set1_ps(inv_variance);
+	int s=0;
+	for(;s+8<=nSymb;s+=8)
+	{
+		const sample_real* y=(const sample_real*)&in[s];
+#ifdef MERCURY_FLOAT_SAMPLES
+		__m256 a=_mm256_loadu_ps(y);
+		__m256 b=_mm256_loadu_ps(y+8);
+#else
+		__m256 a=_mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(y+4)),_mm256_cvtpd_ps(_mm256_loadu_pd(y)));
+		__m256 b=_mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(y+12)),_mm256_cvtpd_ps(_mm256_loadu_pd(y+8)));
+#endif
+		__m256 yi=_mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a,b,_MM_SHUFFLE(2,0,2,0))),_MM_SHUFFLE(3,1,2,0)));
+		__m256 yq=_mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a,b,_MM_SHUFFLE(3,1,3,1))),_MM_SHUFFLE(3,1,2,0)));
 
-		mask=1;
 		for(int k=0;k<nBits;k++)
 		{
-			Dmin0=D[0];
-			Dmin1=D[mask];
-
-			for(int j=0;j<nSymbols;j++)
+			const st_psk_bit_metric* metric=&bit_metric[k];
+			__m256 m[2];
+			for(int v=0;v<2;v++)
 			{
-				if((j & mask)==0)
+				const float* offset=metric->offset[v];
+				const float* slope_i=metric->slope_i[v];
+				const float* slope_q=metric->slope_q[v];
+				__m256 best;
+				if(metric->axis==PSK_AXIS_I)
+				{
+					best=_mm256_add_ps(_mm256_set1_ps(offset[0]),_mm256_mul_ps(_mm256_set1_ps(slope_i[0]),yi));
+					for(int t=1;t<metric->nTerms[v];t++)
+					{
+						best=_mm256_min_ps(best,_mm256_add_ps(_mm256_set1_ps(offset[t]),_mm256_mul_ps(_mm256_set1_ps(slope_i[t]),yi)));
+					}
+				}
+				else if(metric->axis==PSK_AXIS_Q)
 				{
-					if(D[j]<Dmin0)
+					best=_mm256_add_ps(_mm256_set1_ps(offset[0]),_mm256_mul_ps(_mm256_set1_ps(slope_q[0]),yq));
+					for(int t=1;t<metric->nTerms[v];t++)
 					{
-						Dmin0=D[j];
+						best=_mm256_min_ps(best,_mm256_add_ps(_mm256_set1_ps(offset[t]),_mm256_mul_ps(_mm256_set1_ps(slope_q[t]),yq)));
 					}
 				}
-				if((j & mask)==mask)
+				else
 				{
-					if(D[j]<Dmin1)
+					best=_mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(offset[0]),_mm256_mul_ps(_mm256_set1_ps(slope_i[0]),yi)),_mm256_mul_ps(_mm256_set1_ps(slope_q[0]),yq));
+					for(int t=1;t<metric->nTerms[v];t++)
 					{
-						Dmin1=D[j];
+						best=_mm256_min_ps(best,_mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(offset[t]),_mm256_mul_ps(_mm256_set1_ps(slope_i[t]),yi)),_mm256_mul_ps(_mm256_set1_ps(slope_q[t]),yq)));
 					}
 				}
+				m[v]=best;
+			}
+			_mm256_store_ps(llr,_mm256_mul_ps(scale,_mm256_sub_ps(m[1],m[0])));
+			int bit=s*nBits+nBits-k-1;
+			if(out_index==NULL)
+			{
+				for(int lane=0;lane<8;lane++)
+				{
+					out[bit+lane*nBits]=llr[lane];
+				}
+			}
+			else
+			{
+				for(int lane=0;lane<8;lane++)
+				{
+					out[out_index[bit+lane*nBits]]=llr[lane];
+				}
 			}
-			LLR[k]=((1/variance)*(Dmin1-Dmin0));
-			mask<<=1;
-		}
-		for(int j=0;j<nBits;j++)
-		{
-			*(out+i+j)=LLR[nBits-j-1];
 		}
 	}
+	return s;
+}
+
+#endif
+
+// Max-log LLRs, MSB of each symbol first: (1/variance)*(min distance to a point with the bit
+// set - min distance to a point with the bit cleared). nItems is the number of bits.
+void cl_psk::demod(const sample_complex *in,int nItems,float *out,float variance)
+{
+	demod(in,nItems,out,variance,NULL);
+}
+
+// As above, with the LLR of bit i written to out[out_index[i]], so a deinterleaver can be folded in.
+void cl_psk::demod(const sample_complex *in,int nItems,float *out,float variance,const int* out_index)
+{
+	int nSymb=(nItems+nBits-1)/nBits;
+	float inv_variance=1/variance;
+	int s=0;
+
+#ifdef PSK_X86
+	if(demod_kernel==PSK_DEMOD_KERNEL_AVX2)
+	{
+		s=psk_demod_avx2(bit_metric,nBits,in,nSymb,out,out_index,inv_variance);
+	}
+#endif
+	psk_demod_scalar(bit_metric,nBits,in,s,nSymb,out,out_index,inv_variance);
+}
 
+void cl_psk::set_demod_kernel(int kernel)
+{
+	demod_kernel=(kernel==PSK_DEMOD_KERNEL_SCALAR)?PSK_DEMOD_KERNEL_SCALAR:psk_select_demod_kernel();
+}
+
+int cl_psk::get_demod_kernel()
+{
+	return demod_kernel;
 }
 
 
@@ -23,6 +23,7 @@
 #include "physical_layer/telecom_system.h"
 #include "audioio/audioio.h"
 #include <chrono>
+#include <ctime>
 
 #ifdef MERCURY_GUI_ENABLED
 #include "gui/gui_state.h"
@@ -55,8 +56,11 @@ cl_telecom_system::cl_telecom_system()
 	time_sync_trials_max=20;
 	use_last_good_time_sync=NO;
 	use_last_good_freq_offset=NO;
+	// The speculative front end of the next trial only pays off with a core to spare for the decoder.
+	pipelined_receive=(std::thread::hardware_concurrency()>1)?YES:NO;
 	mfsk_fixed_delay=-1;
 	test_puncture_nBits=0;
+	test_estimator_benchmark=NO;
 	ctrl_nBits=0;
 	ctrl_nsymb=0;
 	mfsk_ctrl_mode=false;
@@ -85,132 +89,655 @@ cl_telecom_system::cl_telecom_system()
 	outer_code_reserved_bits=0;
 	bit_energy_dispersal_seed=0;
 	pre_equalization_channel=NULL;
+	receive_stats.harq_combined=NO;
+	harq_nBuffers=0;
+	harq_llr=NULL;
+	harq_llr_combined=NULL;
+	harq_age=NULL;
+	harq_key=NULL;
+	harq_nBuffers_allocated=0;
+	harq_N=0;
+	harq_Nsymb=0;
+	harq_M=0;
+	receive_stats.ir_part=IR_FULL;
+	receive_stats.frame_nsymb=0;
+	receive_stats.frame_key=HARQ_NO_KEY;
+	receive_stats.harq_stored=NO;
+	harq_rx_key=HARQ_NO_KEY;
+	ir_first_fraction=0;
+	ir_nsymb=0;
+	ir_part=IR_FULL;
+	rx_stream_baseband=NULL;
+	rx_stream_mixed=NULL;
+	rx_stream_filtered=NULL;
+	rx_stream_size=0;
+	rx_stream_head=0;
+	rx_stream_symbol_count=0;
+	rx_stream_carrier_frequency=0;
+	rx_stream_valid=NO;
+	rx_stream_metric=NULL;
+	rx_stream_symbol_peak=NULL;
+	rx_stream_symbol_peak_location=NULL;
+	rx_stream_symbol_energy=NULL;
+	rx_stream_symbol_size=0;
+	rx_stream_metric_valid=NO;
+	init_time_sync_workspace(&rx_stream_tsync);
+	for(int i=0;i<NUMBER_OF_PHY_CONTEXTS;i++)
+	{
+		phy_context[i].built=NO;
+		phy_context[i].modulation=0;
+		phy_context[i].carrier_frequency=0;
+		phy_context[i].pre_equalization_channel=NULL;
+		phy_context[i].rx_bit_dest=NULL;
+		phy_context[i].preamble_passband.samples=NULL;
+		phy_context[i].ack_pattern_passband.samples=NULL;
+		phy_context[i].break_pattern_passband.samples=NULL;
+	}
+	context=&phy_context[0];
+	data_container=&context->data_container;
+	ofdm=&context->ofdm;
+	psk=&context->psk;
+	mfsk=&context->mfsk;
+	ldpc=&context->ldpc;
+	capture_context.store(context);
+	for(int i=0;i<2;i++)
+	{
+		rx_trial[i].llr=NULL;
+		rx_trial[i].deframed_data=NULL;
+		rx_trial[i].deframed_data_without_amplitude_restoration=NULL;
+		rx_trial[i].result.hd_decoded_bit=NULL;
+		rx_trial[i].result.hd_decoded_byte=NULL;
+		rx_trial[i].ldpc_workspace=st_ldpc_workspace();
+	}
+	rx_trial_size=0;
+	rx_decoding=NULL;
+	rx_decoder_done=NO;
+	for(int i=0;i<COARSE_FREQ_HYPOTHESES;i++)
+	{
+		sync_worker[i].mixed=NULL;
+		sync_worker[i].baseband=NULL;
+		sync_worker[i].size=0;
+		init_time_sync_workspace(&sync_worker[i].tsync);
+	}
+	nSync_threads=std::thread::hardware_concurrency();
+	if(nSync_threads<=0)
+	{
+		nSync_threads=1;
+	}
 }
 
 
 cl_telecom_system::~cl_telecom_system()
 {
+	quiesce_rx_decoder();
+	harq_deinit();
+	if(rx_stream_baseband!=NULL)
+	{
+		delete[] rx_stream_baseband;
+		delete[] rx_stream_mixed;
+		delete[] rx_stream_filtered;
+		delete[] rx_stream_metric;
+		delete[] rx_stream_symbol_peak;
+		delete[] rx_stream_symbol_peak_location;
+		delete[] rx_stream_symbol_energy;
+	}
+	free_time_sync_workspace(&rx_stream_tsync);
+	free_phy_contexts();
+	for(int i=0;i<2;i++)
+	{
+		if(rx_trial[i].llr!=NULL)
+		{
+			delete[] rx_trial[i].llr;
+			delete[] rx_trial[i].deframed_data;
+			delete[] rx_trial[i].deframed_data_without_amplitude_restoration;
+			delete[] rx_trial[i].result.hd_decoded_bit;
+			delete[] rx_trial[i].result.hd_decoded_byte;
+		}
+		ldpc->deinit_workspace(&rx_trial[i].ldpc_workspace);
+	}
+	for(int i=0;i<COARSE_FREQ_HYPOTHESES;i++)
+	{
+		if(sync_worker[i].mixed!=NULL)
+		{
+			delete[] sync_worker[i].mixed;
+			delete[] sync_worker[i].baseband;
+		}
+		free_time_sync_workspace(&sync_worker[i].tsync);
+	}
+}
+
+// Copies the cached waveform to out and leaves the passband NCO where building it would have.
+// Returns NO when the waveform has to be built first.
+int cl_telecom_system::copy_cached_passband(st_passband_waveform* waveform, double carrier_frequency, double* out)
+{
+	if(waveform->samples==NULL || waveform->carrier_frequency!=carrier_frequency || waveform->output_power_Watt!=output_power_Watt)
+	{
+		return NO;
+	}
+	memcpy(out,waveform->samples,waveform->nSamples*sizeof(double));
+	ofdm->passband_nco.set_phase(waveform->end_phase);
+	return YES;
+}
+
+// The waveform must have been built with the passband NCO starting from phase 0.
+void cl_telecom_system::cache_passband(st_passband_waveform* waveform, double carrier_frequency, const double* in, int nSamples)
+{
+	if(waveform->samples!=NULL && waveform->nSamples!=nSamples)
+	{
+		delete[] waveform->samples;
+		waveform->samples=NULL;
+	}
+	if(waveform->samples==NULL)
+	{
+		waveform->samples=new double[nSamples];
+	}
+	memcpy(waveform->samples,in,nSamples*sizeof(double));
+	waveform->nSamples=nSamples;
+	waveform->carrier_frequency=carrier_frequency;
+	waveform->output_power_Watt=output_power_Watt;
+	waveform->end_phase=ofdm->passband_nco.phase;
+}
+
+void cl_telecom_system::free_phy_contexts()
+{
+	for(int i=0;i<NUMBER_OF_PHY_CONTEXTS;i++)
+	{
+		st_passband_waveform* waveforms[]={&phy_context[i].preamble_passband,&phy_context[i].ack_pattern_passband,&phy_context[i].break_pattern_passband};
+		for(int j=0;j<3;j++)
+		{
+			if(waveforms[j]->samples!=NULL)
+			{
+				delete[] waveforms[j]->samples;
+				waveforms[j]->samples=NULL;
+			}
+		}
+		if(phy_context[i].pre_equalization_channel!=NULL)
+		{
+			delete[] phy_context[i].pre_equalization_channel;
+			phy_context[i].pre_equalization_channel=NULL;
+		}
+		if(phy_context[i].rx_bit_dest!=NULL)
+		{
+			delete[] phy_context[i].rx_bit_dest;
+			phy_context[i].rx_bit_dest=NULL;
+		}
+	}
+	pre_equalization_channel=NULL;
+}
+
+// Completes the active context. The pre-equalization channel only depends on the modulation,
+// so it is measured once and copied to the other contexts of the same modulation.
+void cl_telecom_system::load_phy_context()
+{
+	context->modulation=M;
+
+	if(M!=MOD_MFSK && (context->pre_equalization_channel==NULL || context->carrier_frequency!=carrier_frequency))
+	{
+		if(context->pre_equalization_channel==NULL)
+		{
+			context->pre_equalization_channel=new struct st_channel_complex[data_container->Nc];
+		}
+		context->carrier_frequency=carrier_frequency;
+		pre_equalization_channel=context->pre_equalization_channel;
+
+		st_phy_context* measured=NULL;
+		for(int i=0;i<NUMBER_OF_PHY_CONTEXTS;i++)
+		{
+			if(&phy_context[i]!=context && phy_context[i].modulation==M && phy_context[i].pre_equalization_channel!=NULL
+					&& phy_context[i].carrier_frequency==carrier_frequency)
+			{
+				measured=&phy_context[i];
+				break;
+			}
+		}
+		if(measured!=NULL)
+		{
+			for(int i=0;i<data_container->Nc;i++)
+			{
+				pre_equalization_channel[i]=measured->pre_equalization_channel[i];
+			}
+		}
+		else
+		{
+			get_pre_equalization_channel();
+		}
+	}
+	pre_equalization_channel=context->pre_equalization_channel;
+
+	if(M!=MOD_MFSK && context->rx_bit_dest==NULL)
+	{
+		context->rx_bit_dest=new int[data_container->nBits];
+		build_rx_bit_dest(context->rx_bit_dest);
+	}
+}
+
+// The time/frequency and bit deinterleavers composed into one table, so the demapper writes the
+// LLRs of the deframed data straight to their place in the LDPC codeword.
+void cl_telecom_system::build_rx_bit_dest(int* dest)
+{
+	int bits_per_symbol=data_container->nBits/data_container->nData;
+	int* symbol_index=new int[data_container->nData];
+	int* symbol_src=new int[data_container->nData];
+	int* bit_src=new int[data_container->nBits];
+	int* codeword_src=new int[data_container->nBits];
+
+	for(int i=0;i<data_container->nData;i++)
+	{
+		symbol_index[i]=i;
+	}
+	deinterleaver(symbol_index,symbol_src,data_container->nData,time_freq_interleaver_block_size);
+	for(int i=0;i<data_container->nBits;i++)
+	{
+		bit_src[i]=symbol_src[i/bits_per_symbol]*bits_per_symbol+i%bits_per_symbol;
+	}
+	deinterleaver(bit_src,codeword_src,data_container->nBits,bit_interleaver_block_size);
+	for(int i=0;i<data_container->nBits;i++)
+	{
+		dest[codeword_src[i]]=i;
+	}
+
+	delete[] symbol_index;
+	delete[] symbol_src;
+	delete[] bit_src;
+	delete[] codeword_src;
+}
+
+// Returns the FIR_rx_time_sync baseband of data. For the capture window snapshot the mixer runs
+// on the absolute sample index, so the samples already processed for the previous snapshot stay
+// valid and only the appended symbols and the filter edges are recomputed. The constant phase
+// this adds to the window does not change the time sync metrics.
+sample_complex* cl_telecom_system::time_sync_baseband(double* data, double carrier_frequency)
+{
+	int size=data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate;
+	int symbol_size=data_container->Nofdm*frequency_interpolation_rate;
+	int nTaps=ofdm->FIR_rx_time_sync.filter_nTaps;
+	int center=(nTaps-1)/2;
+
+	if(data!=data_container->ready_to_process_passband_delayed_data || data_container->ready_to_process_symbol_count<0)
+	{
+		ofdm->passband_to_baseband(data,size,data_container->baseband_data_interpolated,sampling_frequency,carrier_frequency,carrier_amplitude,1,&ofdm->FIR_rx_time_sync);
+		return data_container->baseband_data_interpolated;
+	}
+
+	if(rx_stream_size!=size || rx_stream_symbol_size!=symbol_size)
+	{
+		if(rx_stream_baseband!=NULL)
+		{
+			delete[] rx_stream_baseband;
+			delete[] rx_stream_mixed;
+			delete[] rx_stream_filtered;
+			delete[] rx_stream_metric;
+			delete[] rx_stream_symbol_peak;
+			delete[] rx_stream_symbol_peak_location;
+			delete[] rx_stream_symbol_energy;
+		}
+		rx_stream_baseband=new sample_complex[2*size];
+		rx_stream_mixed=new sample_complex[size];
+		rx_stream_filtered=new sample_complex[size];
+		rx_stream_metric=new double[2*size];
+		rx_stream_symbol_peak=new double[size/symbol_size];
+		rx_stream_symbol_peak_location=new int[size/symbol_size];
+		rx_stream_symbol_energy=new double[size/symbol_size];
+		rx_stream_size=size;
+		rx_stream_symbol_size=symbol_size;
+		rx_stream_valid=NO;
+	}
+
+	long long symbol_count=data_container->ready_to_process_symbol_count;
+	long long shift=symbol_count-rx_stream_symbol_count;
+	long long first_sample=(symbol_count-data_container->buffer_Nsymb)*symbol_size;
+	double cycles_per_sample=carrier_frequency/sampling_frequency;
+	rx_stream_nco.set_frequency(carrier_frequency,sampling_frequency);
+
+	if(rx_stream_valid==YES && rx_stream_carrier_frequency==carrier_frequency && shift==0)
+	{
+		return &rx_stream_baseband[rx_stream_head];
+	}
+
+	if(rx_stream_valid==YES && rx_stream_carrier_frequency==carrier_frequency && shift>0 && shift*symbol_size+2*nTaps<size)
+	{
+		int nNew=(int)shift*symbol_size;
+		int ranges[2][2]={{0,nTaps-1},{size-nNew-nTaps+1,size}};
+		for(int r=0;r<2;r++)
+		{
+			rx_stream_nco.set_phase(fmod((double)(first_sample+ranges[r][0])*cycles_per_sample,1.0));
+			rx_stream_nco.mix_down(&data[ranges[r][0]],&rx_stream_mixed[ranges[r][0]],ranges[r][1]-ranges[r][0],carrier_amplitude);
+		}
+		ofdm->FIR_rx_time_sync.apply(rx_stream_mixed,rx_stream_filtered,size,0,nTaps-1-center);
+		ofdm->FIR_rx_time_sync.apply(rx_stream_mixed,rx_stream_filtered,size,size-nNew-center,size);
+
+		rx_stream_head=(rx_stream_head+nNew)%size;
+		int outputs[2][2]={{0,nTaps-1-center},{size-nNew-center,size}};
+		for(int r=0;r<2;r++)
+		{
+			for(int i=outputs[r][0];i<outputs[r][1];i++)
+			{
+				int p=(rx_stream_head+i)%size;
+				rx_stream_baseband[p]=rx_stream_filtered[i];
+				rx_stream_baseband[p+size]=rx_stream_filtered[i];
+			}
+		}
+		for(int r=0;r<2;r++)
+		{
+			update_rx_stream_symbols(outputs[r][0],outputs[r][1]);
+		}
+	}
+	else
+	{
+		rx_stream_nco.set_phase(fmod((double)first_sample*cycles_per_sample,1.0));
+		rx_stream_nco.mix_down(data,rx_stream_mixed,size,carrier_amplitude);
+		ofdm->FIR_rx_time_sync.apply(rx_stream_mixed,rx_stream_baseband,size);
+		memcpy(&rx_stream_baseband[size],rx_stream_baseband,size*sizeof(sample_complex));
+		rx_stream_head=0;
+		rx_stream_metric_valid=(M!=MOD_MFSK)?YES:NO;
+		update_rx_stream_symbols(0,size);
+	}
+	rx_stream_symbol_count=symbol_count;
+	rx_stream_carrier_frequency=carrier_frequency;
+	rx_stream_valid=YES;
+	return &rx_stream_baseband[rx_stream_head];
+}
+
+// Brings the energy of the symbols and, for OFDM, the metric of the candidates and the peak of
+// the symbols of the ring up to date after baseband[first..last-1] of the window changed.
+void cl_telecom_system::update_rx_stream_symbols(int first, int last)
+{
+	int size=rx_stream_size;
+	int symbol_size=rx_stream_symbol_size;
+	int nSymb=size/symbol_size;
+	int head_symbol=rx_stream_head/symbol_size;
+	sample_complex* baseband=&rx_stream_baseband[rx_stream_head];
+
+	for(int s=first/symbol_size;s*symbol_size<last;s++)
+	{
+		double energy=0;
+		for(int i=s*symbol_size;i<(s+1)*symbol_size;i++)
+		{
+			energy+=pow(baseband[i].real(),2)+pow(baseband[i].imag(),2);
+		}
+		rx_stream_symbol_energy[(head_symbol+s)%nSymb]=energy;
+	}
+
+	if(rx_stream_metric_valid==NO)
+	{
+		return;
+	}
+
+	// A candidate reads the preamble length of samples from its own position on.
+	int candidate_first=first-data_container->preamble_nSymb*symbol_size+1;
+	if(candidate_first<0)
+	{
+		candidate_first=0;
+	}
+	double* metric=&rx_stream_metric[rx_stream_head];
+	ofdm->time_sync_preamble_metric_range(&rx_stream_tsync,baseband,size,data_container->interpolation_rate,candidate_first,last,&metric[candidate_first]);
+	for(int i=candidate_first;i<last;i++)
+	{
+		int p=rx_stream_head+i;
+		rx_stream_metric[(p<size)?p+size:p-size]=rx_stream_metric[p];
+	}
+
+	for(int s=candidate_first/symbol_size;s*symbol_size<last;s++)
+	{
+		double peak=metric[s*symbol_size];
+		int location=0;
+		for(int i=1;i<symbol_size;i++)
+		{
+			if(metric[s*symbol_size+i]>peak)
+			{
+				peak=metric[s*symbol_size+i];
+				location=i;
+			}
+		}
+		rx_stream_symbol_peak[(head_symbol+s)%nSymb]=peak;
+		rx_stream_symbol_peak_location[(head_symbol+s)%nSymb]=location;
+	}
+}
+
+// Schmidl-Cox search of baseband[first..size-1], the delay found is from baseband[0]. On the time
+// sync ring, a search from a whole symbol compares the peaks of the symbols and gives the same
+// candidate as time_sync_preamble_with_metric(): the first one of the highest metric.
+TimeSyncResult cl_telecom_system::search_preamble(sample_complex* baseband, int first, int size, int step)
+{
+	TimeSyncResult result;
+	int symbol_size=rx_stream_symbol_size;
+	if(rx_stream_valid==YES && rx_stream_metric_valid==YES && baseband==&rx_stream_baseband[rx_stream_head]
+			&& size==rx_stream_size && step==1 && first%symbol_size==0)
+	{
+		int nSymb=size/symbol_size;
+		int head_symbol=rx_stream_head/symbol_size;
+		int best=(head_symbol+first/symbol_size)%nSymb;
+		result.delay=first+rx_stream_symbol_peak_location[best];
+		result.correlation=rx_stream_symbol_peak[best];
+		for(int s=first/symbol_size+1;s<nSymb;s++)
+		{
+			int p=(head_symbol+s)%nSymb;
+			if(rx_stream_symbol_peak[p]>result.correlation)
+			{
+				result.delay=s*symbol_size+rx_stream_symbol_peak_location[p];
+				result.correlation=rx_stream_symbol_peak[p];
+			}
+		}
+		return result;
+	}
+	result=ofdm->time_sync_preamble_with_metric(&baseband[first],size-first,data_container->interpolation_rate,0,step,1);
+	result.delay+=first;
+	return result;
+}
+
+// FIR_rx_data baseband of the frame at receive_stats.delay in baseband_data_interpolated. The rest
+// of the window is only filtered when the time sync baseband shares the buffer, the next trials
+// search it there.
+void cl_telecom_system::frame_baseband(double* data, double carrier_frequency, sample_complex* sync_baseband)
+{
+	int size=data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate;
+	if(sync_baseband==data_container->baseband_data_interpolated)
+	{
+		ofdm->passband_to_baseband(data,size,data_container->baseband_data_interpolated,sampling_frequency,carrier_frequency,carrier_amplitude,1,&ofdm->FIR_rx_data);
+		return;
+	}
+	int frame_end=receive_stats.delay+data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb)*frequency_interpolation_rate;
+	if(frame_end>size)
+	{
+		frame_end=size;
+	}
+	ofdm->passband_to_baseband(data,size,data_container->baseband_data_interpolated,sampling_frequency,carrier_frequency,carrier_amplitude,&ofdm->FIR_rx_data,receive_stats.delay,frame_end);
+}
+
+// ofdm->measure_signal_stregth() of baseband[0..nItems-1], summed from the energy of the symbols
+// on the time sync ring.
+double cl_telecom_system::measure_signal_stregth(sample_complex* baseband, int nItems)
+{
+	if(rx_stream_valid==NO || baseband!=&rx_stream_baseband[rx_stream_head] || nItems!=rx_stream_size)
+	{
+		return ofdm->measure_signal_stregth(baseband,nItems);
+	}
+	double signal_stregth=0;
+	for(int s=0;s<nItems/rx_stream_symbol_size;s++)
+	{
+		signal_stregth+=rx_stream_symbol_energy[s];
+	}
+	signal_stregth/=nItems;
+	return 10.0*log10((signal_stregth)/0.001);
+}
+
+// Schmidl-Cox search of the first frame span of data at carrier_frequency+frequency_offset[i]
+// for each hypothesis i, the results are left in sync_worker[i].result. Each hypothesis has its
+// own worker, the hypotheses are handed out to the threads of sync_pool one at a time.
+void cl_telecom_system::search_coarse_frequency(double* data, const double* frequency_offset, int step)
+{
+	int search_size=data_container->Nofdm*(2*data_container->preamble_nSymb+data_container->Nsymb)*frequency_interpolation_rate;
+	// Outputs past the searched span are never read, only the filter needs the samples behind it.
+	int nItems=search_size+ofdm->FIR_rx_time_sync.filter_nTaps;
+	if(nItems>data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate)
+	{
+		nItems=data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate;
+	}
+
+	sync_pool.run(COARSE_FREQ_HYPOTHESES,[this,data,nItems,search_size,frequency_offset,step](int i, int worker)
+	{
+		search_frequency_hypothesis(data,nItems,search_size,carrier_frequency+frequency_offset[i],step,&sync_worker[i]);
+	});
+}
 
+void cl_telecom_system::search_frequency_hypothesis(double* data, int nItems, int search_size, double frequency, int step, st_sync_worker* worker)
+{
+	if(worker->size<nItems)
+	{
+		if(worker->mixed!=NULL)
+		{
+			delete[] worker->mixed;
+			delete[] worker->baseband;
+		}
+		worker->mixed=new sample_complex[nItems];
+		worker->baseband=new sample_complex[nItems];
+		if(worker->mixed==NULL || worker->baseband==NULL)
+		{
+			std::cout<<"Memory allocation error"<<std::endl;
+			exit(2);
+		}
+		worker->size=nItems;
+	}
+	worker->nco.set_frequency(frequency,sampling_frequency);
+	worker->nco.reset();
+	worker->nco.mix_down(data,worker->mixed,nItems,carrier_amplitude);
+	worker->filter.apply(worker->mixed,worker->baseband,nItems);
+	worker->result=ofdm->time_sync_preamble_with_metric(&worker->tsync,worker->baseband,search_size,data_container->interpolation_rate,0,step,1);
 }
 
 cl_error_rate cl_telecom_system::baseband_test_EsN0(float EsN0,int max_frame_no)
 {
 	cl_error_rate lerror_rate;
-	float power_normalization=sqrt((double)ofdm.Nfft);
+	float power_normalization=sqrt((double)ofdm->Nfft);
 	float sigma=1.0/sqrt(pow(10,(EsN0/10)));
 	float variance=1.0/(pow(10,(EsN0/10)));
 	int nVirtual_data;
 	int nReal_data;
 	int delay=0;
-	nVirtual_data=ldpc.N-data_container.nBits;
-	nReal_data=data_container.nBits-ldpc.P;
+	nVirtual_data=ldpc->N-data_container->nBits;
+	nReal_data=data_container->nBits-ldpc->P;
 
 	int constellation_plot_counter=0;
 	int constellation_plot_nFrames=10;
-	float contellation[ofdm.pilot_configurator.nData*constellation_plot_nFrames][2]={0};
+	float contellation[ofdm->pilot_configurator.nData*constellation_plot_nFrames][2]={0};
 
-	while(lerror_rate.Frames_total<max_frame_no)
+	// The frames are decoded in batches, one per LDPC decoding thread.
+	int nBatch=ldpc->get_nThreads();
+	int nQueued=0;
+	float* batch_llr=new float[nBatch*ldpc->N];
+	int* batch_data=new int[nBatch*nReal_data];
+	int* batch_decoded=new int[nBatch*ldpc->K];
+	int* batch_iterations=new int[nBatch];
+	if(batch_llr==NULL || batch_data==NULL || batch_decoded==NULL || batch_iterations==NULL)
+	{
+		std::cout<<"Memory allocation error"<<std::endl;
+		exit(2);
+	}
+
+	while(lerror_rate.Frames_total+nQueued<max_frame_no)
 	{
 		for(int i=0;i<nReal_data;i++)
 		{
-			data_container.data_bit[i]=__random()%2;
+			data_container->data_bit[i]=__random()%2;
 		}
 		for(int i=0;i<nVirtual_data;i++)
 		{
-			data_container.data_bit[nReal_data+i]=data_container.data_bit[i];
+			data_container->data_bit[nReal_data+i]=data_container->data_bit[i];
 		}
 
-		ldpc.encode(data_container.data_bit,data_container.encoded_data);
+		ldpc->encode(data_container->data_bit,data_container->encoded_data);
 
-		for(int i=0;i<ldpc.P;i++)
+		for(int i=0;i<ldpc->P;i++)
 		{
-			data_container.encoded_data[nReal_data+i]=data_container.encoded_data[i+ldpc.K];
+			data_container->encoded_data[nReal_data+i]=data_container->encoded_data[i+ldpc->K];
 		}
 
-		interleaver(data_container.encoded_data,data_container.bit_interleaved_data,data_container.nBits,bit_interleaver_block_size);
+		interleaver(data_container->encoded_data,data_container->bit_interleaved_data,data_container->nBits,bit_interleaver_block_size);
 
-		psk.mod(data_container.bit_interleaved_data,data_container.nBits,data_container.modulated_data);
-		interleaver(data_container.modulated_data, data_container.ofdm_time_freq_interleaved_data, data_container.nData, time_freq_interleaver_block_size);
-		ofdm.framer(data_container.ofdm_time_freq_interleaved_data,data_container.ofdm_framed_data);
+		psk->mod(data_container->bit_interleaved_data,data_container->nBits,data_container->modulated_data);
+		interleaver(data_container->modulated_data, data_container->ofdm_time_freq_interleaved_data, data_container->nData, time_freq_interleaver_block_size);
+		ofdm->framer(data_container->ofdm_time_freq_interleaved_data,data_container->ofdm_framed_data);
 
-		for(int i=0;i<data_container.Nsymb;i++)
+		for(int i=0;i<data_container->Nsymb;i++)
 		{
-			ofdm.symbol_mod(&data_container.ofdm_framed_data[i*data_container.Nc],&data_container.ofdm_symbol_modulated_data[i*data_container.Nofdm]);
+			ofdm->symbol_mod(&data_container->ofdm_framed_data[i*data_container->Nc],&data_container->ofdm_symbol_modulated_data[i*data_container->Nofdm]);
 		}
 
-		for(int j=0;j<data_container.Nofdm*data_container.Nsymb;j++)
+		for(int j=0;j<data_container->Nofdm*data_container->Nsymb;j++)
 		{
-			data_container.ofdm_symbol_modulated_data[j]/=power_normalization;
+			data_container->ofdm_symbol_modulated_data[j]/=power_normalization;
 		}
 
 
-		awgn_channel.apply_with_delay(data_container.ofdm_symbol_modulated_data,data_container.baseband_data,sigma,data_container.Nofdm*data_container.Nsymb,0);
+		awgn_channel.apply_with_delay(data_container->ofdm_symbol_modulated_data,data_container->baseband_data,sigma,data_container->Nofdm*data_container->Nsymb,0);
 
 
-		for(int j=0;j<data_container.Nofdm*data_container.Nsymb;j++)
+		for(int j=0;j<data_container->Nofdm*data_container->Nsymb;j++)
 		{
-			data_container.baseband_data[j]*=power_normalization;
+			data_container->baseband_data[j]*=power_normalization;
 		}
 
-		for(int i=0;i<data_container.Nsymb;i++)
+		for(int i=0;i<data_container->Nsymb;i++)
 		{
-			ofdm.symbol_demod(&data_container.baseband_data[delay*0+i*data_container.Nofdm],&data_container.ofdm_symbol_demodulated_data[i*data_container.Nc]);
+			ofdm->symbol_demod(&data_container->baseband_data[delay*0+i*data_container->Nofdm],&data_container->ofdm_symbol_demodulated_data[i*data_container->Nc]);
 		}
 
-		if(ofdm.channel_estimator==ZERO_FORCE)
+		if(ofdm->channel_estimator==ZERO_FORCE)
 		{
-			ofdm.ZF_channel_estimator(data_container.ofdm_symbol_demodulated_data);
+			ofdm->ZF_channel_estimator(data_container->ofdm_symbol_demodulated_data);
 		}
-		else if (ofdm.channel_estimator==LEAST_SQUARE)
+		else if (ofdm->channel_estimator==LEAST_SQUARE)
 		{
-			ofdm.LS_channel_estimator(data_container.ofdm_symbol_demodulated_data);
+			ofdm->LS_channel_estimator(data_container->ofdm_symbol_demodulated_data);
 		}
-
-		if(ofdm.channel_estimator_amplitude_restoration==YES)
+		else if (ofdm->channel_estimator==CHANNEL_EST_MMSE)
 		{
-			ofdm.restore_channel_amplitude();
-			ofdm.channel_equalizer_without_amplitude_restoration(data_container.ofdm_symbol_demodulated_data,data_container.equalized_data_without_amplitude_restoration);
-			ofdm.deframer(data_container.equalized_data_without_amplitude_restoration,data_container.ofdm_deframed_data_without_amplitude_restoration);
+			ofdm->MMSE_channel_estimator(data_container->ofdm_symbol_demodulated_data);
 		}
 
-		ofdm.channel_equalizer(data_container.ofdm_symbol_demodulated_data,data_container.equalized_data);
+		if(ofdm->channel_estimator_amplitude_restoration==YES)
+		{
+			ofdm->restore_channel_amplitude();
+			ofdm->channel_equalizer_without_amplitude_restoration(data_container->ofdm_symbol_demodulated_data,data_container->equalized_data_without_amplitude_restoration);
+			ofdm->deframer(data_container->equalized_data_without_amplitude_restoration,data_container->ofdm_deframed_data_without_amplitude_restoration);
+		}
 
-		variance=ofdm.measure_variance(data_container.ofdm_symbol_demodulated_data);
+		ofdm->channel_equalizer(data_container->ofdm_symbol_demodulated_data,data_container->equalized_data);
 
-		ofdm.deframer(data_container.equalized_data,data_container.ofdm_deframed_data);
-		deinterleaver(data_container.ofdm_deframed_data, data_container.ofdm_time_freq_deinterleaved_data, data_container.nData, time_freq_interleaver_block_size);
-		psk.demod(data_container.ofdm_time_freq_deinterleaved_data,data_container.nBits,data_container.demodulated_data,variance);
+		variance=ofdm->measure_variance(data_container->ofdm_symbol_demodulated_data);
 
-		deinterleaver(data_container.demodulated_data,data_container.deinterleaved_data,data_container.nBits,bit_interleaver_block_size);
+		ofdm->deframer(data_container->equalized_data,data_container->ofdm_deframed_data);
+		psk->demod(data_container->ofdm_deframed_data,data_container->nBits,data_container->deinterleaved_data,variance,context->rx_bit_dest);
 
 
-		for(int i=ldpc.P-1;i>=0;i--)
+		for(int i=ldpc->P-1;i>=0;i--)
 		{
-			data_container.deinterleaved_data[i+nReal_data+nVirtual_data]=data_container.deinterleaved_data[i+nReal_data];
+			data_container->deinterleaved_data[i+nReal_data+nVirtual_data]=data_container->deinterleaved_data[i+nReal_data];
 		}
 
 		for(int i=0;i<nVirtual_data;i++)
 		{
-			data_container.deinterleaved_data[nReal_data+i]=data_container.deinterleaved_data[i];
+			data_container->deinterleaved_data[nReal_data+i]=data_container->deinterleaved_data[i];
 		}
 
+		memcpy(&batch_llr[nQueued*ldpc->N],data_container->deinterleaved_data,ldpc->N*sizeof(float));
+		memcpy(&batch_data[nQueued*nReal_data],data_container->data_bit,nReal_data*sizeof(int));
+		nQueued++;
 
-		ldpc.decode(data_container.deinterleaved_data,data_container.hd_decoded_data_bit);
-
-		if(ofdm.channel_estimator_amplitude_restoration==YES)
+		if(ofdm->channel_estimator_amplitude_restoration==YES)
 		{
-			for(int i=0;i<ofdm.pilot_configurator.nData;i++)
+			for(int i=0;i<ofdm->pilot_configurator.nData;i++)
 			{
-				contellation[constellation_plot_counter*ofdm.pilot_configurator.nData+i][0]=data_container.ofdm_deframed_data_without_amplitude_restoration[i].real();
-				contellation[constellation_plot_counter*ofdm.pilot_configurator.nData+i][1]=data_container.ofdm_deframed_data_without_amplitude_restoration[i].imag();
+				contellation[constellation_plot_counter*ofdm->pilot_configurator.nData+i][0]=data_container->ofdm_deframed_data_without_amplitude_restoration[i].real();
+				contellation[constellation_plot_counter*ofdm->pilot_configurator.nData+i][1]=data_container->ofdm_deframed_data_without_amplitude_restoration[i].imag();
 			}
 		}
 		else
 		{
-			for(int i=0;i<ofdm.pilot_configurator.nData;i++)
+			for(int i=0;i<ofdm->pilot_configurator.nData;i++)
 			{
-				contellation[constellation_plot_counter*ofdm.pilot_configurator.nData+i][0]=data_container.ofdm_deframed_data[i].real();
-				contellation[constellation_plot_counter*ofdm.pilot_configurator.nData+i][1]=data_container.ofdm_deframed_data[i].imag();
+				contellation[constellation_plot_counter*ofdm->pilot_configurator.nData+i][0]=data_container->ofdm_deframed_data[i].real();
+				contellation[constellation_plot_counter*ofdm->pilot_configurator.nData+i][1]=data_container->ofdm_deframed_data[i].imag();
 			}
 		}
 
@@ -219,12 +746,24 @@ cl_error_rate cl_telecom_system::baseband_test_EsN0(float EsN0,int max_frame_no)
 		if(constellation_plot_counter==constellation_plot_nFrames)
 		{
 			constellation_plot_counter=0;
-			constellation_plot.plot_constellation(&contellation[0][0],ofdm.pilot_configurator.nData*constellation_plot_nFrames);
+			constellation_plot.plot_constellation(&contellation[0][0],ofdm->pilot_configurator.nData*constellation_plot_nFrames);
 		}
 
-
-		lerror_rate.check(data_container.data_bit,data_container.hd_decoded_data_bit,nReal_data);
+		if(nQueued==nBatch || lerror_rate.Frames_total+nQueued==max_frame_no)
+		{
+			ldpc->decode_batch(batch_llr,batch_decoded,nQueued,batch_iterations);
+			for(int i=0;i<nQueued;i++)
+			{
+				lerror_rate.check(&batch_data[i*nReal_data],&batch_decoded[i*ldpc->K],nReal_data);
+			}
+			nQueued=0;
+		}
 	}
+
+	delete[] batch_llr;
+	delete[] batch_data;
+	delete[] batch_decoded;
+	delete[] batch_iterations;
 	return lerror_rate;
 }
 
@@ -241,10 +780,10 @@ cl_error_rate cl_telecom_system::passband_test_EsN0(float EsN0,int max_frame_no)
 	{
 		sigma = 1.0f / sqrt(pow(10.0f, (EsN0 / 10.0f)));
 	}
-	int nReal_data=data_container.nBits-ldpc.P;
+	int nReal_data=data_container->nBits-ldpc->P;
 	int delay=0;
 
-	if(data_container.Nfft==1024)
+	if(data_container->Nfft==1024)
 	{
 		delay=100;
 	}
@@ -256,17 +795,18 @@ cl_error_rate cl_telecom_system::passband_test_EsN0(float EsN0,int max_frame_no)
 	int constellation_plot_counter=0;
 	int constellation_plot_nFrames=10;
 	// For MFSK, nData can be very large (>15000) - skip constellation plot to avoid stack overflow
-	int nDataPlot = (M == MOD_MFSK) ? 0 : ofdm.pilot_configurator.nData;
+	int nDataPlot = (M == MOD_MFSK) ? 0 : ofdm->pilot_configurator.nData;
 	float contellation[nDataPlot*constellation_plot_nFrames+1][2]={};
 
 	while(lerror_rate.Frames_total<max_frame_no)
 	{
+		// Only whole bytes are sent, transmit_byte() pads the bits after the last one with zeros.
 		for(int i=0;i<nReal_data-outer_code_reserved_bits;i++)
 		{
-			data_container.data_bit[i]=__random()%2;
+			data_container->data_bit[i]=(i<(nReal_data-outer_code_reserved_bits)/8*8)?__random()%2:0;
 		}
-		bit_to_byte(data_container.data_bit,data_container.data_byte,nReal_data-outer_code_reserved_bits);
-		this->transmit_byte(data_container.data_byte,(nReal_data-outer_code_reserved_bits)/8,data_container.passband_data,SINGLE_MESSAGE);
+		bit_to_byte(data_container->data_bit,data_container->data_byte,nReal_data-outer_code_reserved_bits);
+		this->transmit_byte(data_container->data_byte,(nReal_data-outer_code_reserved_bits)/8,data_container->passband_data,SINGLE_MESSAGE);
 
 		// MFSK: calibrate sigma from measured signal power (first frame only)
 		// In-band channel SNR: SNR = P_sig / P_noise_inband
@@ -275,11 +815,11 @@ cl_error_rate cl_telecom_system::passband_test_EsN0(float EsN0,int max_frame_no)
 		// sigma = sqrt(2 * P_sig * f_nyquist / (SNR_linear * BW_signal))
 		if(!sigma_calibrated)
 		{
-			int nSamples = (data_container.Nofdm * (data_container.Nsymb + data_container.preamble_nSymb)) * frequency_interpolation_rate;
+			int nSamples = (data_container->Nofdm * (data_container->Nsymb + data_container->preamble_nSymb)) * frequency_interpolation_rate;
 			double P_sig = 0;
 			for(int i = 0; i < nSamples; i++)
 			{
-				P_sig += data_container.passband_data[i] * data_container.passband_data[i];
+				P_sig += data_container->passband_data[i] * data_container->passband_data[i];
 			}
 			P_sig /= nSamples;
 			double f_nyquist = sampling_frequency / 2.0;
@@ -287,31 +827,31 @@ cl_error_rate cl_telecom_system::passband_test_EsN0(float EsN0,int max_frame_no)
 			sigma_calibrated = true;
 		}
 
-		awgn_channel.apply_with_delay(data_container.passband_data,data_container.passband_delayed_data,sigma,(data_container.Nofdm*(data_container.Nsymb+data_container.preamble_nSymb))*this->frequency_interpolation_rate,((data_container.preamble_nSymb+2)*data_container.Nofdm+delay)*frequency_interpolation_rate);
+		awgn_channel.apply_with_delay(data_container->passband_data,data_container->passband_delayed_data,sigma,(data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb))*this->frequency_interpolation_rate,((data_container->preamble_nSymb+2)*data_container->Nofdm+delay)*frequency_interpolation_rate);
 		if(M == MOD_MFSK)
 		{
-			mfsk_fixed_delay = ((data_container.preamble_nSymb+2)*data_container.Nofdm+delay)*frequency_interpolation_rate;
+			mfsk_fixed_delay = ((data_container->preamble_nSymb+2)*data_container->Nofdm+delay)*frequency_interpolation_rate;
 		}
-		this->receive_byte(data_container.passband_delayed_data,data_container.hd_decoded_data_byte);
+		this->receive_byte(data_container->passband_delayed_data,data_container->hd_decoded_data_byte);
 		mfsk_fixed_delay = -1;
-		byte_to_bit(data_container.hd_decoded_data_byte,data_container.hd_decoded_data_bit,(nReal_data-outer_code_reserved_bits));
+		byte_to_bit(data_container->hd_decoded_data_byte,data_container->hd_decoded_data_bit,(nReal_data-outer_code_reserved_bits)/8);
 
 		if(nDataPlot > 0)
 		{
-			if(ofdm.channel_estimator_amplitude_restoration==YES)
+			if(ofdm->channel_estimator_amplitude_restoration==YES)
 			{
 				for(int i=0;i<nDataPlot;i++)
 				{
-					contellation[constellation_plot_counter*nDataPlot+i][0]=data_container.ofdm_deframed_data_without_amplitude_restoration[i].real();
-					contellation[constellation_plot_counter*nDataPlot+i][1]=data_container.ofdm_deframed_data_without_amplitude_restoration[i].imag();
+					contellation[constellation_plot_counter*nDataPlot+i][0]=data_container->ofdm_deframed_data_without_amplitude_restoration[i].real();
+					contellation[constellation_plot_counter*nDataPlot+i][1]=data_container->ofdm_deframed_data_without_amplitude_restoration[i].imag();
 				}
 			}
 			else
 			{
 				for(int i=0;i<nDataPlot;i++)
 				{
-					contellation[constellation_plot_counter*nDataPlot+i][0]=data_container.ofdm_deframed_data[i].real();
-					contellation[constellation_plot_counter*nDataPlot+i][1]=data_container.ofdm_deframed_data[i].imag();
+					contellation[constellation_plot_counter*nDataPlot+i][0]=data_container->ofdm_deframed_data[i].real();
+					contellation[constellation_plot_counter*nDataPlot+i][1]=data_container->ofdm_deframed_data[i].imag();
 				}
 			}
 
@@ -324,24 +864,24 @@ cl_error_rate cl_telecom_system::passband_test_EsN0(float EsN0,int max_frame_no)
 			}
 		}
 
-		lerror_rate.check(data_container.data_bit,data_container.hd_decoded_data_bit,nReal_data-outer_code_reserved_bits);
+		lerror_rate.check(data_container->data_bit,data_container->hd_decoded_data_bit,nReal_data-outer_code_reserved_bits);
 	}
 	return lerror_rate;
 }
 
 int cl_telecom_system::get_frame_size_bytes()
 {
-    return (data_container.nBits - ldpc.P - outer_code_reserved_bits) / 8;
+    return (data_container->nBits - ldpc->P - outer_code_reserved_bits) / 8;
 }
 
 int cl_telecom_system::get_frame_size_bits()
 {
-    return data_container.nBits - ldpc.P - outer_code_reserved_bits;
+    return data_container->nBits - ldpc->P - outer_code_reserved_bits;
 }
 
 void cl_telecom_system::transmit_byte(int *data, int nBytes, double* out, int message_location)
 {
-	int nReal_data = data_container.nBits - ldpc.P;
+	int nReal_data = data_container->nBits - ldpc->P;
 	int msB = 0, lsB = 0;
 	int frame_size = (nReal_data - outer_code_reserved_bits) / 8;
 
@@ -351,209 +891,212 @@ void cl_telecom_system::transmit_byte(int *data, int nBytes, double* out, int me
 		return;
 	}
 
-	byte_to_bit(data, data_container.data_bit, nBytes);
-
-	// Zero-pad data to full frame_size BEFORE CRC so that CRC covers a
-	// fixed-size block.  RX self-check: CRC16([frame_size bytes + CRC]) = 0.
-	for(int i = nBytes * 8; i < frame_size * 8; i++)
+	// The frame is built straight into packed words: data bytes, zero padding to the full
+	// frame_size (RX self-check: CRC16([frame_size bytes + CRC]) = 0), CRC, zero waste bits.
+	uint64_t* data_bit_packed=data_container->data_bit_packed;
+	for(int i=0;i<(nReal_data+63)/64;i++)
 	{
-		data_container.data_bit[i] = 0;
+		data_bit_packed[i]=0;
 	}
+	byte_to_packed_bit(data, data_bit_packed, 0, nBytes);
 
 	if(outer_code == CRC16_MODBUS_RTU)
 	{
-		// Pad byte array too (data may alias data_container.data_byte)
+		// Pad byte array too (data may alias data_container->data_byte)
 		for(int i = nBytes; i < frame_size; i++)
 			data[i] = 0;
 		uint16_t crc = CRC16_MODBUS_RTU_calc(data, frame_size);
 		msB = (crc & 0xff00) >> 8;
 		lsB = crc & 0x00ff;
-		byte_to_bit(&lsB, &data_container.data_bit[frame_size * 8], 1);
-		byte_to_bit(&msB, &data_container.data_bit[(frame_size + 1) * 8], 1);
-	}
-
-	// Zero any remaining non-byte-aligned waste bits after CRC
-	for(int i = frame_size * 8 + outer_code_reserved_bits; i < nReal_data; i++)
-	{
-		data_container.data_bit[i] = 0;
+		byte_to_packed_bit(&lsB, data_bit_packed, frame_size, 1);
+		byte_to_packed_bit(&msB, data_bit_packed, frame_size + 1, 1);
 	}
 
-	transmit_bit(data_container.data_bit, out, message_location);
+	transmit_packed(data_bit_packed, out, message_location);
 }
 
 void cl_telecom_system::transmit_bit(int* data, double* out, int message_location)
 {
-	int nVirtual_data=ldpc.N-data_container.nBits;
-	int nReal_data=data_container.nBits-ldpc.P;
-	float power_normalization=sqrt((double)(ofdm.Nfft*frequency_interpolation_rate));
+	int nReal_data=data_container->nBits-ldpc->P;
 
 	for(int i=0;i<nReal_data;i++)
 	{
-		data_container.data_bit[i]=data[i];
+		data_container->data_bit[i]=data[i];
 	}
+	bit_to_packed_bit(data_container->data_bit, data_container->data_bit_packed, nReal_data);
 
-	bit_energy_dispersal(data_container.data_bit, data_container.bit_energy_dispersal_sequence, data_container.data_bit_energy_dispersal, nReal_data);
+	transmit_packed(data_container->data_bit_packed, out, message_location);
+}
 
-	for(int i=0;i<nVirtual_data;i++)
-	{
-		data_container.data_bit_energy_dispersal[nReal_data+i]=data_container.data_bit_energy_dispersal[i];
-	}
+void cl_telecom_system::transmit_packed(const uint64_t* data, double* out, int message_location)
+{
+	int nVirtual_data=ldpc->N-data_container->nBits;
+	int nReal_data=data_container->nBits-ldpc->P;
+	float power_normalization=sqrt((double)(ofdm->Nfft*frequency_interpolation_rate));
 
-	ldpc.encode(data_container.data_bit_energy_dispersal,data_container.encoded_data);
+	// Bits stay packed 64 to a word from the frame up to the constellation mapper.
+	bit_energy_dispersal(data, data_container->bit_energy_dispersal_sequence_packed, data_container->data_bit_energy_dispersal_packed, nReal_data);
 
-	for(int i=0;i<ldpc.P;i++)
-	{
-		data_container.encoded_data[nReal_data+i]=data_container.encoded_data[i+ldpc.K];
-	}
+	packed_bit_copy(data_container->data_bit_energy_dispersal_packed, 0, data_container->data_bit_energy_dispersal_packed, nReal_data, nVirtual_data);
 
-	interleaver(data_container.encoded_data,data_container.bit_interleaved_data,data_container.nBits,bit_interleaver_block_size);
+	ldpc->encode(data_container->data_bit_energy_dispersal_packed,data_container->encoded_data_packed);
+
+	packed_bit_copy(data_container->encoded_data_packed, ldpc->K, data_container->encoded_data_packed, nReal_data, ldpc->P);
+
+	interleaver(data_container->encoded_data_packed,data_container->bit_interleaved_data_packed,data_container->nBits,bit_interleaver_block_size);
 
 	if(M == MOD_MFSK)
 	{
 		// MFSK: bits → one-hot subcarrier vectors, directly to framed data
 		// In ctrl mode, only modulate first ctrl_nBits interleaved bits (fewer symbols)
 		int active_nbits = get_active_nbits();
-		mfsk.mod(data_container.bit_interleaved_data, active_nbits, data_container.ofdm_framed_data);
+		packed_bit_to_bit(data_container->bit_interleaved_data_packed, data_container->bit_interleaved_data, active_nbits);
+		mfsk->mod(data_container->bit_interleaved_data, active_nbits, data_container->ofdm_framed_data);
 
 #ifdef MERCURY_GUI_ENABLED
 		// Accumulate tone energies across ALL symbols for full-packet view
 		{
-			int nSymbols = active_nbits / (mfsk.nBits * mfsk.nStreams);
+			int nSymbols = active_nbits / (mfsk->nBits * mfsk->nStreams);
 			double gui_E[2][64] = {};
 			int gui_peak[2] = {};
-			for (int st = 0; st < mfsk.nStreams && st < 2; st++)
+			for (int st = 0; st < mfsk->nStreams && st < 2; st++)
 			{
 				for (int s = 0; s < nSymbols; s++)
 				{
-					int hop = (s * mfsk.tone_hop_step) % mfsk.M;
-					for (int m = 0; m < mfsk.M && m < 64; m++)
+					int hop = (s * mfsk->tone_hop_step) % mfsk->M;
+					for (int m = 0; m < mfsk->M && m < 64; m++)
 					{
-						std::complex<double> val = data_container.ofdm_framed_data[
-							s * data_container.Nc + mfsk.stream_offsets[st] + ((m + hop) % mfsk.M)];
+						sample_complex val = data_container->ofdm_framed_data[
+							s * data_container->Nc + mfsk->stream_offsets[st] + ((m + hop) % mfsk->M)];
 						gui_E[st][m] += val.real() * val.real() + val.imag() * val.imag();
 					}
 				}
 				// Peak = last symbol's active tone (current tone indicator)
 				if (nSymbols > 0) {
 					int last_s = nSymbols - 1;
-					int hop = (last_s * mfsk.tone_hop_step) % mfsk.M;
+					int hop = (last_s * mfsk->tone_hop_step) % mfsk->M;
 					double max_e = -1.0;
-					for (int m = 0; m < mfsk.M && m < 64; m++)
+					for (int m = 0; m < mfsk->M && m < 64; m++)
 					{
-						std::complex<double> val = data_container.ofdm_framed_data[
-							last_s * data_container.Nc + mfsk.stream_offsets[st] + ((m + hop) % mfsk.M)];
+						sample_complex val = data_container->ofdm_framed_data[
+							last_s * data_container->Nc + mfsk->stream_offsets[st] + ((m + hop) % mfsk->M)];
 						double e = val.real() * val.real() + val.imag() * val.imag();
 						if (e > max_e) { max_e = e; gui_peak[st] = m; }
 					}
 				}
 			}
-			gui_push_mfsk_tones(gui_E, gui_peak, mfsk.M, mfsk.nStreams, true);
+			gui_push_mfsk_tones(gui_E, gui_peak, mfsk->M, mfsk->nStreams, true);
 		}
 #endif
 	}
 	else
 	{
-		psk.mod(data_container.bit_interleaved_data,data_container.nBits,data_container.modulated_data);
-		interleaver(data_container.modulated_data, data_container.ofdm_time_freq_interleaved_data, data_container.nData, time_freq_interleaver_block_size);
-		ofdm.framer(data_container.ofdm_time_freq_interleaved_data,data_container.ofdm_framed_data);
+		psk->mod(data_container->bit_interleaved_data_packed,data_container->nBits,data_container->modulated_data);
+		interleaver(data_container->modulated_data, data_container->ofdm_time_freq_interleaved_data, data_container->nData, time_freq_interleaver_block_size);
+		ofdm->framer(data_container->ofdm_time_freq_interleaved_data,data_container->ofdm_framed_data);
 	}
 
+	// Apply test TX carrier offset for frequency sync testing
+	double tx_carrier = carrier_frequency + test_tx_carrier_offset;
+	int preamble_nSamples = data_container->Nofdm*data_container->preamble_nSymb*frequency_interpolation_rate;
+
+	// MFSK amplitude boost: equalize drive level with OFDM
+	// power_normalization assumes Nc active subcarriers (OFDM), but MFSK has only nStreams.
+	// RMS scales as sqrt(nActive), so base boost = sqrt(Nc / nStreams).
+	// -2 dB trim: OFDM peak_clip removes ~2 dB of energy; MFSK isn't clipped (low PAPR).
+	double mfsk_boost = 1.0;
 	if(M == MOD_MFSK)
 	{
-		// MFSK preamble: known single-tone symbols (concentrated energy, detectable in weak signal)
-		mfsk.generate_preamble(data_container.preamble_data, data_container.preamble_nSymb);
+		mfsk_boost = sqrt((double)data_container->Nc / mfsk->nStreams) * pow(10.0, -2.0 / 20.0);
 	}
-	else
+
+	// The preamble only depends on the configuration: it is built once from carrier phase 0 and
+	// copied afterwards, the data symbols continue the carrier from its end.
+	if(copy_cached_passband(&context->preamble_passband, tx_carrier, data_container->passband_data_tx) == NO)
 	{
-		// OFDM preamble: broadband known symbols (all subcarriers)
-		for(int i=0;i<data_container.preamble_nSymb*ofdm.Nc;i++)
+		if(M == MOD_MFSK)
 		{
-			data_container.preamble_data[i]=ofdm.ofdm_preamble[i].value;
+			// MFSK preamble: known single-tone symbols (concentrated energy, detectable in weak signal)
+			mfsk->generate_preamble(data_container->preamble_data, data_container->preamble_nSymb);
 		}
-	}
-
-	if(M != MOD_MFSK)
-	{
-		// Pre-equalization (OFDM only, not used for MFSK)
-		for(int i=0;i<data_container.preamble_nSymb;i++)
+		else
 		{
-			for(int j=0;j<data_container.Nc;j++)
+			// OFDM preamble: broadband known symbols (all subcarriers), pre-equalized
+			for(int i=0;i<data_container->preamble_nSymb;i++)
 			{
-				data_container.preamble_data[i*data_container.Nc+j]*=pre_equalization_channel[j].value;
+				for(int j=0;j<data_container->Nc;j++)
+				{
+					data_container->preamble_data[i*data_container->Nc+j]=ofdm->ofdm_preamble[i*data_container->Nc+j].value*pre_equalization_channel[j].value;
+				}
 			}
 		}
 
-		for(int i=0;i<data_container.Nsymb;i++)
+		for(int i=0;i<data_container->preamble_nSymb;i++)
 		{
-			for(int j=0;j<data_container.Nc;j++)
-			{
-				data_container.ofdm_framed_data[i*data_container.Nc+j]*=pre_equalization_channel[j].value;
-			}
+			ofdm->symbol_mod(&data_container->preamble_data[i*data_container->Nc],&data_container->preamble_symbol_modulated_data[i*data_container->Nofdm]);
 		}
-	}
 
-	for(int i=0;i<data_container.preamble_nSymb;i++)
-	{
-		ofdm.symbol_mod(&data_container.preamble_data[i*data_container.Nc],&data_container.preamble_symbol_modulated_data[i*data_container.Nofdm]);
-	}
+		for(int j=0;j<data_container->Nofdm*data_container->preamble_nSymb;j++)
+		{
+			data_container->preamble_symbol_modulated_data[j]/=power_normalization;
+			data_container->preamble_symbol_modulated_data[j]*=sqrt(output_power_Watt)*ofdm->preamble_configurator.boost*mfsk_boost;
+		}
 
-	int active_nsymb = get_active_nsymb();
+		ofdm->passband_nco.reset();
+		ofdm->baseband_to_passband(data_container->preamble_symbol_modulated_data,data_container->Nofdm*data_container->preamble_nSymb,data_container->passband_data_tx,sampling_frequency,tx_carrier,carrier_amplitude,frequency_interpolation_rate);
+		ofdm->peak_clip(data_container->passband_data_tx, preamble_nSamples,ofdm->preamble_papr_cut);
 
-	for(int i=0;i<active_nsymb;i++)
-	{
-		ofdm.symbol_mod(&data_container.ofdm_framed_data[i*data_container.Nc],&data_container.ofdm_symbol_modulated_data[i*data_container.Nofdm]);
+		cache_passband(&context->preamble_passband, tx_carrier, data_container->passband_data_tx, preamble_nSamples);
 	}
 
-	// MFSK amplitude boost: equalize drive level with OFDM
-	// power_normalization assumes Nc active subcarriers (OFDM), but MFSK has only nStreams.
-	// RMS scales as sqrt(nActive), so base boost = sqrt(Nc / nStreams).
-	// -2 dB trim: OFDM peak_clip removes ~2 dB of energy; MFSK isn't clipped (low PAPR).
-	double mfsk_boost = 1.0;
-	if(M == MOD_MFSK)
+	if(M != MOD_MFSK)
 	{
-		mfsk_boost = sqrt((double)data_container.Nc / mfsk.nStreams) * pow(10.0, -2.0 / 20.0);
+		// Pre-equalization (OFDM only, not used for MFSK)
+		for(int i=0;i<data_container->Nsymb;i++)
+		{
+			for(int j=0;j<data_container->Nc;j++)
+			{
+				data_container->ofdm_framed_data[i*data_container->Nc+j]*=pre_equalization_channel[j].value;
+			}
+		}
 	}
 
-	for(int j=0;j<data_container.Nofdm*data_container.preamble_nSymb;j++)
+	int active_nsymb = get_active_nsymb();
+
+	for(int i=0;i<active_nsymb;i++)
 	{
-		data_container.preamble_symbol_modulated_data[j]/=power_normalization;
-		data_container.preamble_symbol_modulated_data[j]*=sqrt(output_power_Watt)*ofdm.preamble_configurator.boost*mfsk_boost;
+		ofdm->symbol_mod(&data_container->ofdm_framed_data[i*data_container->Nc],&data_container->ofdm_symbol_modulated_data[i*data_container->Nofdm]);
 	}
 
-	for(int j=0;j<data_container.Nofdm*active_nsymb;j++)
+	for(int j=0;j<data_container->Nofdm*active_nsymb;j++)
 	{
-		data_container.ofdm_symbol_modulated_data[j]/=power_normalization;
-		data_container.ofdm_symbol_modulated_data[j]*=sqrt(output_power_Watt)*mfsk_boost;
+		data_container->ofdm_symbol_modulated_data[j]/=power_normalization;
+		data_container->ofdm_symbol_modulated_data[j]*=sqrt(output_power_Watt)*mfsk_boost;
 	}
 
-	// Apply test TX carrier offset for frequency sync testing
-	double tx_carrier = carrier_frequency + test_tx_carrier_offset;
-	ofdm.baseband_to_passband(data_container.preamble_symbol_modulated_data,data_container.Nofdm*data_container.preamble_nSymb,data_container.passband_data_tx,sampling_frequency,tx_carrier,carrier_amplitude,frequency_interpolation_rate);
-	ofdm.baseband_to_passband(data_container.ofdm_symbol_modulated_data,data_container.Nofdm*active_nsymb,&data_container.passband_data_tx[data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate],sampling_frequency,tx_carrier,carrier_amplitude,frequency_interpolation_rate);
-
-	ofdm.peak_clip(data_container.passband_data_tx, data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate,ofdm.preamble_papr_cut);
-	ofdm.peak_clip(&data_container.passband_data_tx[data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate], data_container.Nofdm*active_nsymb*frequency_interpolation_rate,ofdm.data_papr_cut);
+	ofdm->baseband_to_passband(data_container->ofdm_symbol_modulated_data,data_container->Nofdm*active_nsymb,&data_container->passband_data_tx[preamble_nSamples],sampling_frequency,tx_carrier,carrier_amplitude,frequency_interpolation_rate);
+	ofdm->peak_clip(&data_container->passband_data_tx[preamble_nSamples], data_container->Nofdm*active_nsymb*frequency_interpolation_rate,ofdm->data_papr_cut);
 
 	if(message_location==NO_FILTER_MESSAGE)
 	{
-		for(int i=0;i<data_container.total_frame_size;i++)
+		for(int i=0;i<data_container->total_frame_size;i++)
 		{
-			*(out+i)=data_container.passband_data_tx[i];
+			*(out+i)=data_container->passband_data_tx[i];
 		}
 		return;
 	}
 
 	if(message_location==SINGLE_MESSAGE)
 	{
-		ofdm.FIR_tx1.apply(data_container.passband_data_tx,data_container.passband_data_tx_filtered_fir_1,data_container.total_frame_size);
-		ofdm.FIR_tx2.apply(data_container.passband_data_tx_filtered_fir_1,data_container.passband_data_tx_filtered_fir_2,data_container.total_frame_size);
+		ofdm->FIR_tx1.apply(data_container->passband_data_tx,data_container->passband_data_tx_filtered_fir_1,data_container->total_frame_size);
+		ofdm->FIR_tx2.apply(data_container->passband_data_tx_filtered_fir_1,data_container->passband_data_tx_filtered_fir_2,data_container->total_frame_size);
 
-		for(int i=0;i<data_container.total_frame_size;i++)
+		for(int i=0;i<data_container->total_frame_size;i++)
 		{
-			*(out+i)=data_container.passband_data_tx_filtered_fir_2[i];
+			*(out+i)=data_container->passband_data_tx_filtered_fir_2[i];
 		}
-		//		st_power_measurment power_measurment_preamble=ofdm.measure_signal_power_avg_papr(out, data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate);
-		//		st_power_measurment power_measurment_modulated_data=ofdm.measure_signal_power_avg_papr(&out[data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate], data_container.Nofdm*data_container.Nsymb*frequency_interpolation_rate);
+		//		st_power_measurment power_measurment_preamble=ofdm->measure_signal_power_avg_papr(out, data_container->Nofdm*data_container->preamble_nSymb*frequency_interpolation_rate);
+		//		st_power_measurment power_measurment_modulated_data=ofdm->measure_signal_power_avg_papr(&out[data_container->Nofdm*data_container->preamble_nSymb*frequency_interpolation_rate], data_container->Nofdm*data_container->Nsymb*frequency_interpolation_rate);
 		//
 		//		std::cout<<"preamble power: avg="<<power_measurment_preamble.avg;
 		//		std::cout<<" max="<<power_measurment_preamble.max;
@@ -567,30 +1110,30 @@ void cl_telecom_system::transmit_bit(int* data, double* out, int message_locatio
 
 	if(message_location==FIRST_MESSAGE)
 	{
-		for(int i=0;i<data_container.total_frame_size;i++)
+		for(int i=0;i<data_container->total_frame_size;i++)
 		{
-			data_container.passband_data_tx_buffer[data_container.total_frame_size + i]=data_container.passband_data_tx[i];//TODO increasing value
-			data_container.passband_data_tx_buffer[2 * data_container.total_frame_size + i]=data_container.passband_data_tx[i];
+			data_container->passband_data_tx_buffer[data_container->total_frame_size + i]=data_container->passband_data_tx[i];//TODO increasing value
+			data_container->passband_data_tx_buffer[2 * data_container->total_frame_size + i]=data_container->passband_data_tx[i];
 		}
 	}
 
 	if(message_location==MIDDLE_MESSAGE || message_location==FLUSH_MESSAGE)
 	{
-		for(int i=0;i<data_container.total_frame_size;i++)
+		for(int i=0;i<data_container->total_frame_size;i++)
 		{
-			data_container.passband_data_tx_buffer[2 * data_container.total_frame_size + i]=data_container.passband_data_tx[i];
+			data_container->passband_data_tx_buffer[2 * data_container->total_frame_size + i]=data_container->passband_data_tx[i];
 		}
 	}
 
 
-	ofdm.FIR_tx1.apply(&data_container.passband_data_tx_buffer[data_container.total_frame_size/2],data_container.passband_data_tx_filtered_fir_1,2*data_container.total_frame_size);
-	ofdm.FIR_tx2.apply(data_container.passband_data_tx_filtered_fir_1,data_container.passband_data_tx_filtered_fir_2,2*data_container.total_frame_size);
+	ofdm->FIR_tx1.apply(&data_container->passband_data_tx_buffer[data_container->total_frame_size/2],data_container->passband_data_tx_filtered_fir_1,2*data_container->total_frame_size);
+	ofdm->FIR_tx2.apply(data_container->passband_data_tx_filtered_fir_1,data_container->passband_data_tx_filtered_fir_2,2*data_container->total_frame_size);
 
-	for(int i=0;i<data_container.total_frame_size;i++)
+	for(int i=0;i<data_container->total_frame_size;i++)
 	{
-		*(out+i)=data_container.passband_data_tx_filtered_fir_2[data_container.total_frame_size/2+i];
+		*(out+i)=data_container->passband_data_tx_filtered_fir_2[data_container->total_frame_size/2+i];
 	}
-	shift_left(data_container.passband_data_tx_buffer, 3*data_container.total_frame_size, data_container.total_frame_size);
+	shift_left(data_container->passband_data_tx_buffer, 3*data_container->total_frame_size, data_container->total_frame_size);
 
 
 	int PAPR_Meas=NO;
@@ -599,8 +1142,8 @@ void cl_telecom_system::transmit_bit(int* data, double* out, int message_locatio
 
 	if(PAPR_Meas==YES)
 	{
-		st_power_measurment power_measurment_preamble=ofdm.measure_signal_power_avg_papr(out, data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate);
-		st_power_measurment power_measurment_modulated_data=ofdm.measure_signal_power_avg_papr(&out[data_container.Nofdm*data_container.preamble_nSymb*frequency_interpolation_rate], data_container.Nofdm*data_container.Nsymb*frequency_interpolation_rate);
+		st_power_measurment power_measurment_preamble=ofdm->measure_signal_power_avg_papr(out, data_container->Nofdm*data_container->preamble_nSymb*frequency_interpolation_rate);
+		st_power_measurment power_measurment_modulated_data=ofdm->measure_signal_power_avg_papr(&out[data_container->Nofdm*data_container->preamble_nSymb*frequency_interpolation_rate], data_container->Nofdm*data_container->Nsymb*frequency_interpolation_rate);
 		std::cout<<"preamble power: avg="<<power_measurment_preamble.avg;
 		std::cout<<" max="<<power_measurment_preamble.max;
 		std::cout<<" PAPR="<<power_measurment_preamble.papr_db<<" db";
@@ -611,23 +1154,23 @@ void cl_telecom_system::transmit_bit(int* data, double* out, int message_locatio
 
 	if(MER_Meas==YES)
 	{
-		ofdm.FIR_tx1.apply(data_container.passband_data_tx_buffer,&data_container.passband_data_tx_filtered_fir_1[data_container.total_frame_size/2],2.5*data_container.total_frame_size);
-		ofdm.FIR_tx2.apply(data_container.passband_data_tx_filtered_fir_1,data_container.passband_data_tx_filtered_fir_2,2.5*data_container.total_frame_size);
+		ofdm->FIR_tx1.apply(data_container->passband_data_tx_buffer,&data_container->passband_data_tx_filtered_fir_1[data_container->total_frame_size/2],2.5*data_container->total_frame_size);
+		ofdm->FIR_tx2.apply(data_container->passband_data_tx_filtered_fir_1,data_container->passband_data_tx_filtered_fir_2,2.5*data_container->total_frame_size);
 
-		ofdm.passband_to_baseband(&data_container.passband_data_tx_filtered_fir_2[data_container.total_frame_size+data_container.total_frame_size/2],data_container.total_frame_size,data_container.baseband_data_interpolated,sampling_frequency,carrier_frequency,carrier_amplitude,1,&ofdm.FIR_rx_data);
+		ofdm->passband_to_baseband(&data_container->passband_data_tx_filtered_fir_2[data_container->total_frame_size+data_container->total_frame_size/2],data_container->total_frame_size,data_container->baseband_data_interpolated,sampling_frequency,carrier_frequency,carrier_amplitude,1,&ofdm->FIR_rx_data);
 
-		ofdm.rational_resampler(data_container.baseband_data_interpolated, (data_container.Nofdm*(data_container.Nsymb+data_container.preamble_nSymb))*frequency_interpolation_rate, data_container.baseband_data, data_container.interpolation_rate, DECIMATION);
+		ofdm->rational_resampler(data_container->baseband_data_interpolated, (data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb))*frequency_interpolation_rate, data_container->baseband_data, data_container->interpolation_rate, DECIMATION);
 
-		for(int i=0;i<data_container.Nsymb;i++)
+		for(int i=0;i<data_container->Nsymb;i++)
 		{
-			ofdm.symbol_demod(&data_container.baseband_data[i*data_container.Nofdm+data_container.Nofdm*data_container.preamble_nSymb],&data_container.ofdm_symbol_demodulated_data[i*data_container.Nc]);
+			ofdm->symbol_demod(&data_container->baseband_data[i*data_container->Nofdm+data_container->Nofdm*data_container->preamble_nSymb],&data_container->ofdm_symbol_demodulated_data[i*data_container->Nc]);
 		}
-		ofdm.automatic_gain_control(data_container.ofdm_symbol_demodulated_data);
-		ofdm.ZF_channel_estimator(data_container.ofdm_symbol_demodulated_data);
-		ofdm.channel_equalizer(data_container.ofdm_symbol_demodulated_data,data_container.equalized_data);
-		ofdm.deframer(data_container.equalized_data,data_container.ofdm_deframed_data);
+		ofdm->automatic_gain_control(data_container->ofdm_symbol_demodulated_data);
+		ofdm->ZF_channel_estimator(data_container->ofdm_symbol_demodulated_data);
+		ofdm->channel_equalizer(data_container->ofdm_symbol_demodulated_data,data_container->equalized_data);
+		ofdm->deframer(data_container->equalized_data,data_container->ofdm_deframed_data);
 
-		float MER=ofdm.measure_SNR(data_container.ofdm_time_freq_interleaved_data,data_container.ofdm_deframed_data,data_container.nData);
+		float MER=ofdm->measure_SNR(data_container->ofdm_time_freq_interleaved_data,data_container->ofdm_deframed_data,data_container->nData);
 		std::cout<<"MER ="<<MER<<std::endl;
 	}
 
@@ -635,10 +1178,10 @@ void cl_telecom_system::transmit_bit(int* data, double* out, int message_locatio
 
 st_receive_stats cl_telecom_system::receive_bit(double *data, int* out)
 {
-	int nReal_data=data_container.nBits-ldpc.P;
+	int nReal_data=data_container->nBits-ldpc->P;
 
-	st_receive_stats tmp=receive_byte(data,data_container.hd_decoded_data_byte);
-	byte_to_bit(data_container.hd_decoded_data_byte, out, nReal_data/8);
+	st_receive_stats tmp=receive_byte(data,data_container->hd_decoded_data_byte);
+	byte_to_bit(data_container->hd_decoded_data_byte, out, nReal_data/8);
 
 	return tmp;
 }
@@ -647,15 +1190,22 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 {
 
 	float variance;
-	int nVirtual_data=ldpc.N-data_container.nBits;
-	int nReal_data=data_container.nBits-ldpc.P;
+	int nVirtual_data=ldpc->N-data_container->nBits;
+	int nReal_data=data_container->nBits-ldpc->P;
 	double freq_offset_measured=0;
 	receive_stats.message_decoded=NO;
 	receive_stats.frame_overflow_symbols=0;
 	receive_stats.sync_trials=0;
-
-	int step=100;
+	receive_stats.harq_combined=NO;
+	receive_stats.frame_key=harq_rx_key;
+	receive_stats.harq_stored=NO;
+	int harq_tried=NO;
+	alloc_rx_trials();
+
+	// Full resolution coarse search: the Schmidl-Cox metric costs O(1) per candidate.
+	int step=1;
 	int pream_symb_loc;
+	sample_complex* sync_baseband=data_container->baseband_data_interpolated;
 
 	// Coarse frequency offset - starts at 0, only searched on trial 1 if trial 0 fails
 	double coarse_freq_offset = 0.0;
@@ -667,32 +1217,32 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 		// Overflow recapture: delay pre-adjusted for buffer shift, use once.
 		receive_stats.delay = mfsk_fixed_delay;
 		mfsk_fixed_delay = -1;
-		pream_symb_loc = receive_stats.delay / (data_container.Nofdm * data_container.interpolation_rate);
+		pream_symb_loc = receive_stats.delay / (data_container->Nofdm * data_container->interpolation_rate);
 		if(pream_symb_loc < 1) { pream_symb_loc = 1; }
 		receive_stats.signal_stregth_dbm = 0;
 	}
 	else
 	{
-		ofdm.passband_to_baseband((double*)data,data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate,data_container.baseband_data_interpolated,sampling_frequency,carrier_frequency,carrier_amplitude,1,&ofdm.FIR_rx_time_sync);
+		sync_baseband=time_sync_baseband((double*)data,carrier_frequency);
 
-		receive_stats.signal_stregth_dbm=ofdm.measure_signal_stregth(data_container.baseband_data_interpolated, data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate);
+		receive_stats.signal_stregth_dbm=measure_signal_stregth(sync_baseband, data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate);
 
 		if(M == MOD_MFSK)
 		{
 			// MFSK: correlate against known preamble tone sequence
 			// Anti-re-decode: skip past where previous preamble sits in buffer
-			int search_start = receive_stats.mfsk_search_raw - data_container.nUnder_processing_events;
+			int search_start = receive_stats.mfsk_search_raw - data_container->nUnder_processing_events;
 			if(search_start < 0) search_start = 0;
-			receive_stats.delay=ofdm.time_sync_mfsk(data_container.baseband_data_interpolated,data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate,data_container.interpolation_rate,data_container.preamble_nSymb,mfsk.preamble_tones,mfsk.M,mfsk.nStreams,mfsk.stream_offsets,search_start);
+			receive_stats.delay=ofdm->time_sync_mfsk(sync_baseband,data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate,data_container->interpolation_rate,data_container->preamble_nSymb,mfsk->preamble_tones,mfsk->M,mfsk->nStreams,mfsk->stream_offsets,search_start);
 
 		}
 		else
 		{
-			TimeSyncResult coarse_result = ofdm.time_sync_preamble_with_metric(data_container.baseband_data_interpolated,data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate,data_container.interpolation_rate,0,step, 1);
+			TimeSyncResult coarse_result = search_preamble(sync_baseband,0,data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate,step);
 			receive_stats.delay = coarse_result.delay;
 			receive_stats.coarse_metric = coarse_result.correlation;
 		}
-		pream_symb_loc=receive_stats.delay/(data_container.Nofdm*data_container.interpolation_rate);
+		pream_symb_loc=receive_stats.delay/(data_container->Nofdm*data_container->interpolation_rate);
 		if(pream_symb_loc<1){pream_symb_loc=1;}
 	}
 
@@ -701,10 +1251,10 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 	// This replaces fixed turnaround guard margins with adaptive recapture.
 	if(M == MOD_MFSK && mfsk_fixed_delay < 0)
 	{
-		int sym_samples = data_container.Nofdm * frequency_interpolation_rate;
+		int sym_samples = data_container->Nofdm * frequency_interpolation_rate;
 		int active_nsymb = get_active_nsymb();
-		int frame_end_samples = receive_stats.delay + (data_container.preamble_nSymb + active_nsymb) * sym_samples;
-		int buffer_samples = data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate;
+		int frame_end_samples = receive_stats.delay + (data_container->preamble_nSymb + active_nsymb) * sym_samples;
+		int buffer_samples = data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate;
 		if(frame_end_samples > buffer_samples)
 		{
 			receive_stats.message_decoded = NO;
@@ -714,8 +1264,8 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 		}
 	}
 
-	int lower_bound = data_container.preamble_nSymb;
-	int upper_bound = data_container.buffer_Nsymb-(data_container.Nsymb+data_container.preamble_nSymb);
+	int lower_bound = data_container->preamble_nSymb;
+	int upper_bound = data_container->buffer_Nsymb-(data_container->Nsymb+data_container->preamble_nSymb);
 
 	if(M != MOD_MFSK)
 	{
@@ -733,8 +1283,8 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 	// buffer for signal energy and re-run Schmidl-Cox from the signal start.
 	if(M != MOD_MFSK && !(pream_symb_loc > lower_bound && pream_symb_loc < upper_bound))
 	{
-		int sym_samples = data_container.Nofdm * frequency_interpolation_rate;
-		int buf_samples = data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate;
+		int sym_samples = data_container->Nofdm * frequency_interpolation_rate;
+		int buf_samples = data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate;
 
 		if (g_verbose) printf("[OFDM-SYNC] bounds-failed: pream_symb=%d, scanning full buffer for signal\n", pream_symb_loc);
 		fflush(stdout);
@@ -747,8 +1297,8 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 			int cnt = 0;
 			for(int i = 0; i < sym_samples && (offset + i) < buf_samples; i++)
 			{
-				double re = data_container.baseband_data_interpolated[offset + i].real();
-				double im = data_container.baseband_data_interpolated[offset + i].imag();
+				double re = sync_baseband[offset + i].real();
+				double im = sync_baseband[offset + i].imag();
 				e += re*re + im*im;
 				cnt++;
 			}
@@ -765,12 +1315,9 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 			int search_start = signal_start_symb * sym_samples;
 			int available = buf_samples - search_start;
 
-			if(available > data_container.preamble_nSymb * sym_samples)
+			if(available > data_container->preamble_nSymb * sym_samples)
 			{
-				TimeSyncResult retry = ofdm.time_sync_preamble_with_metric(
-					&data_container.baseband_data_interpolated[search_start],
-					available, frequency_interpolation_rate, 0, step, 1);
-				retry.delay += search_start;
+				TimeSyncResult retry = search_preamble(sync_baseband, search_start, buf_samples, step);
 
 				int retry_symb = retry.delay / sym_samples;
 				if(retry_symb < 1) retry_symb = 1;
@@ -779,8 +1326,8 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 				int rcnt = 0;
 				for(int i = 0; i < sym_samples && (retry.delay + i) < buf_samples; i++)
 				{
-					double re = data_container.baseband_data_interpolated[retry.delay + i].real();
-					double im = data_container.baseband_data_interpolated[retry.delay + i].imag();
+					double re = sync_baseband[retry.delay + i].real();
+					double im = sync_baseband[retry.delay + i].imag();
 					retry_energy += re*re + im*im;
 					rcnt++;
 				}
@@ -811,14 +1358,14 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 		bool energy_ok = true;
 		if(M != MOD_MFSK)
 		{
-			int sym_samples = data_container.Nofdm * frequency_interpolation_rate;
-			int buf_samples = data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate;
+			int sym_samples = data_container->Nofdm * frequency_interpolation_rate;
+			int buf_samples = data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate;
 			double energy_sum = 0.0;
 			int count = 0;
 			for(int i = 0; i < sym_samples && (receive_stats.delay + i) < buf_samples; i++)
 			{
-				double re = data_container.baseband_data_interpolated[receive_stats.delay + i].real();
-				double im = data_container.baseband_data_interpolated[receive_stats.delay + i].imag();
+				double re = sync_baseband[receive_stats.delay + i].real();
+				double im = sync_baseband[receive_stats.delay + i].imag();
 				energy_sum += re*re + im*im;
 				count++;
 			}
@@ -865,8 +1412,8 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 					int cnt = 0;
 					for(int i = 0; i < sym_samples && (offset + i) < buf_samples; i++)
 					{
-						double re = data_container.baseband_data_interpolated[offset + i].real();
-						double im = data_container.baseband_data_interpolated[offset + i].imag();
+						double re = sync_baseband[offset + i].real();
+						double im = sync_baseband[offset + i].imag();
 						e += re*re + im*im;
 						cnt++;
 					}
@@ -883,12 +1430,9 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 					int search_start = signal_start_symb * sym_samples;
 					int available = buf_samples - search_start;
 
-					if(available > data_container.preamble_nSymb * sym_samples)
+					if(available > data_container->preamble_nSymb * sym_samples)
 					{
-						TimeSyncResult retry = ofdm.time_sync_preamble_with_metric(
-							&data_container.baseband_data_interpolated[search_start],
-							available, frequency_interpolation_rate, 0, step, 1);
-						retry.delay += search_start;
+						TimeSyncResult retry = search_preamble(sync_baseband, search_start, buf_samples, step);
 
 						int retry_symb = retry.delay / sym_samples;
 						if(retry_symb < 1) retry_symb = 1;
@@ -898,8 +1442,8 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 						int rcnt = 0;
 						for(int i = 0; i < sym_samples && (retry.delay + i) < buf_samples; i++)
 						{
-							double re = data_container.baseband_data_interpolated[retry.delay + i].real();
-							double im = data_container.baseband_data_interpolated[retry.delay + i].imag();
+							double re = sync_baseband[retry.delay + i].real();
+							double im = sync_baseband[retry.delay + i].imag();
 							retry_energy += re*re + im*im;
 							rcnt++;
 						}
@@ -930,6 +1474,13 @@ st_receive_stats cl_telecom_system::receive_byte(double *data, int* out)
 skip_h_retry_point:
 		while (receive_stats.sync_trials<=time_sync_trials_max)
 		{
+			// The front end below is speculative while the previous trial decodes, it is dropped
+			// as soon as that decode is known to have succeeded.
+			if(collect_rx_trial(out,nReal_data,&harq_tried,NO)==YES)
+			{
+				break;
+			}
+
 			if(mfsk_fixed_delay >= 0)
 			{
 				// Known delay - skip all time_sync refinement
@@ -946,31 +1497,27 @@ skip_h_retry_point:
 			{
 				receive_stats.delay=receive_stats.delay_of_last_decoded_message;
 			}
+#ifdef MERCURY_GUI_ENABLED
 			else if (receive_stats.sync_trials == 1 && g_gui_state.coarse_freq_sync_enabled.load())
 			{
 				// Trial 0 failed - try coarse frequency search before trial 1
 				// Search ±30 Hz; Moose handles ±22 Hz residual at each,
 				// giving ±52 Hz total coverage
-				const double freq_search[] = {-30.0, 0.0, 30.0};
-				const int n_search = 3;
+				const double freq_search[COARSE_FREQ_HYPOTHESES] = {-30.0, 0.0, 30.0};
 				double best_correlation = 0.0;
 				double best_offset = 0.0;
 				int best_delay = receive_stats.delay;
 				double zero_hz_correlation = 0.0;
 
-				for (int i = 0; i < n_search; i++)
+				if(collect_rx_trial(out,nReal_data,&harq_tried,NO)==YES)
+				{
+					goto rx_trial_decoded;
+				}
+				search_coarse_frequency((double*)data,freq_search,step);
+
+				for (int i = 0; i < COARSE_FREQ_HYPOTHESES; i++)
 				{
-					ofdm.passband_to_baseband((double*)data,
-						data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate,
-						data_container.baseband_data_interpolated,
-						sampling_frequency,
-						carrier_frequency + freq_search[i],
-						carrier_amplitude, 1, &ofdm.FIR_rx_time_sync);
-
-					TimeSyncResult ts_result = ofdm.time_sync_preamble_with_metric(
-						data_container.baseband_data_interpolated,
-						data_container.Nofdm * (2 * data_container.preamble_nSymb + data_container.Nsymb) * frequency_interpolation_rate,
-						data_container.interpolation_rate, 0, step, 1);
+					TimeSyncResult ts_result = sync_worker[i].result;
 
 					if (fabs(freq_search[i]) < 0.1)
 						zero_hz_correlation = ts_result.correlation;
@@ -989,40 +1536,36 @@ skip_h_retry_point:
 				{
 					coarse_freq_offset = best_offset;
 					receive_stats.delay = best_delay;
-					pream_symb_loc = receive_stats.delay / (data_container.Nofdm * data_container.interpolation_rate);
+					pream_symb_loc = receive_stats.delay / (data_container->Nofdm * data_container->interpolation_rate);
 					if (pream_symb_loc < 1) { pream_symb_loc = 1; }
 				}
 
 				// Restore baseband for time sync (at possibly corrected frequency)
-				ofdm.passband_to_baseband((double*)data,
-					data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate,
-					data_container.baseband_data_interpolated,
-					sampling_frequency,
-					carrier_frequency + coarse_freq_offset,
-					carrier_amplitude, 1, &ofdm.FIR_rx_time_sync);
+				sync_baseband=time_sync_baseband((double*)data,carrier_frequency + coarse_freq_offset);
 
 				// Fine time sync at the corrected frequency
 				// Window = preamble+4 symbols (±2 sym search range) to handle coarse
-				// Schmidl-Cox step=100 quantization + integer truncation of pream_symb_loc
-				TimeSyncResult ts_result = ofdm.time_sync_preamble_with_metric(
-					&data_container.baseband_data_interpolated[(pream_symb_loc-1)*data_container.Nofdm*frequency_interpolation_rate],
-					(ofdm.preamble_configurator.Nsymb+4)*data_container.Nofdm*data_container.interpolation_rate,
-					data_container.interpolation_rate,
+				// integer truncation of pream_symb_loc
+				TimeSyncResult ts_result = ofdm->time_sync_preamble_with_metric(
+					&sync_baseband[(pream_symb_loc-1)*data_container->Nofdm*frequency_interpolation_rate],
+					(ofdm->preamble_configurator.Nsymb+4)*data_container->Nofdm*data_container->interpolation_rate,
+					data_container->interpolation_rate,
 					receive_stats.sync_trials, 1, time_sync_trials_max);
-				receive_stats.delay = (pream_symb_loc-1)*data_container.Nofdm*frequency_interpolation_rate + ts_result.delay;
+				receive_stats.delay = (pream_symb_loc-1)*data_container->Nofdm*frequency_interpolation_rate + ts_result.delay;
 			}
+#endif
 			else
 			{
 				// Window = preamble+4 symbols (±2 sym search range) — see trial 1 comment
-			receive_stats.delay=(pream_symb_loc-1)*data_container.Nofdm*frequency_interpolation_rate+ofdm.time_sync_preamble(&data_container.baseband_data_interpolated[(pream_symb_loc-1)*data_container.Nofdm*frequency_interpolation_rate],(ofdm.preamble_configurator.Nsymb+4)*data_container.Nofdm*data_container.interpolation_rate,data_container.interpolation_rate,receive_stats.sync_trials,1,time_sync_trials_max);
+			receive_stats.delay=(pream_symb_loc-1)*data_container->Nofdm*frequency_interpolation_rate+ofdm->time_sync_preamble(&sync_baseband[(pream_symb_loc-1)*data_container->Nofdm*frequency_interpolation_rate],(ofdm->preamble_configurator.Nsymb+4)*data_container->Nofdm*data_container->interpolation_rate,data_container->interpolation_rate,receive_stats.sync_trials,1,time_sync_trials_max);
 			}
 
 			if(receive_stats.delay<0){receive_stats.delay=0;}
 
 			// Clamp delay to prevent buffer overflow in rational_resampler
 			{
-				int buf_size = data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate;
-				int frame_size = (data_container.Nofdm*(data_container.Nsymb+data_container.preamble_nSymb))*frequency_interpolation_rate;
+				int buf_size = data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate;
+				int frame_size = (data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb))*frequency_interpolation_rate;
 				int max_delay = buf_size - frame_size;
 				if(receive_stats.delay > max_delay)
 				{
@@ -1038,11 +1581,11 @@ skip_h_retry_point:
 			// to find signal onset while preserving sub-symbol alignment.
 			if(M != MOD_MFSK)
 			{
-				int sym_samples = data_container.Nofdm * frequency_interpolation_rate;
-				int buf_samples = data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate;
+				int sym_samples = data_container->Nofdm * frequency_interpolation_rate;
+				int buf_samples = data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate;
 				double fine_energy = 0.0;
 				for(int i = 0; i < sym_samples && (receive_stats.delay + i) < buf_samples; i++)
-					fine_energy += std::norm(data_container.baseband_data_interpolated[receive_stats.delay + i]);
+					fine_energy += std::norm(sync_baseband[receive_stats.delay + i]);
 				fine_energy /= sym_samples;
 				if(fine_energy < 0.001)
 				{
@@ -1053,7 +1596,7 @@ skip_h_retry_point:
 						if(candidate + sym_samples > buf_samples) break;
 						double e = 0.0;
 						for(int i = 0; i < sym_samples; i++)
-							e += std::norm(data_container.baseband_data_interpolated[candidate + i]);
+							e += std::norm(sync_baseband[candidate + i]);
 						e /= sym_samples;
 						if(e >= 0.001)
 						{
@@ -1072,13 +1615,17 @@ skip_h_retry_point:
 			double effective_carrier_freq = carrier_frequency + coarse_freq_offset;
 
 			// DIAGNOSTIC: Save baseband snapshot from FIR_rx_time_sync before overwrite
-			std::complex<double> ts_snap[4];
+			sample_complex ts_snap[4];
 			if(M != MOD_MFSK && receive_stats.sync_trials == 0) {
 				for(int k=0; k<4; k++)
-					ts_snap[k] = data_container.baseband_data_interpolated[receive_stats.delay + k];
+					ts_snap[k] = sync_baseband[receive_stats.delay + k];
 			}
 
-			ofdm.passband_to_baseband((double*)data,data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate,data_container.baseband_data_interpolated,sampling_frequency,effective_carrier_freq,carrier_amplitude,1,&ofdm.FIR_rx_data);
+			if(collect_rx_trial(out,nReal_data,&harq_tried,NO)==YES)
+			{
+				goto rx_trial_decoded;
+			}
+			frame_baseband((double*)data,effective_carrier_freq,sync_baseband);
 
 			// DIAGNOSTIC: Compare FIR_rx_time_sync vs FIR_rx_data at delay position
 			if(M != MOD_MFSK && receive_stats.sync_trials == 0) {
@@ -1087,22 +1634,22 @@ skip_h_retry_point:
 					printf("(%.6f,%.6f) ", ts_snap[k].real(), ts_snap[k].imag());
 				printf("data_fir: ");
 				for(int k=0; k<4; k++)
-					printf("(%.6f,%.6f) ", data_container.baseband_data_interpolated[receive_stats.delay + k].real(), data_container.baseband_data_interpolated[receive_stats.delay + k].imag());
+					printf("(%.6f,%.6f) ", data_container->baseband_data_interpolated[receive_stats.delay + k].real(), data_container->baseband_data_interpolated[receive_stats.delay + k].imag());
 				printf("\n"); fflush(stdout);
 
 				// Also check baseband energy around the extraction point
 				double energy_at_delay = 0.0, energy_mid_frame = 0.0;
-				int mid_offset = receive_stats.delay + (data_container.preamble_nSymb + data_container.Nsymb/2) * data_container.Nofdm * frequency_interpolation_rate;
+				int mid_offset = receive_stats.delay + (data_container->preamble_nSymb + data_container->Nsymb/2) * data_container->Nofdm * frequency_interpolation_rate;
 				for(int k=0; k<256; k++) {
-					energy_at_delay += std::norm(data_container.baseband_data_interpolated[receive_stats.delay + k]);
-					if(mid_offset + k < data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate)
-						energy_mid_frame += std::norm(data_container.baseband_data_interpolated[mid_offset + k]);
+					energy_at_delay += std::norm(data_container->baseband_data_interpolated[receive_stats.delay + k]);
+					if(mid_offset + k < data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate)
+						energy_mid_frame += std::norm(data_container->baseband_data_interpolated[mid_offset + k]);
 				}
 				printf("[BB-ENERGY] at_delay=%.6f mid_frame=%.6f\n", energy_at_delay / 256, energy_mid_frame / 256);
 				fflush(stdout);
 			}
 
-			ofdm.rational_resampler(&data_container.baseband_data_interpolated[receive_stats.delay], (data_container.Nofdm*(data_container.Nsymb+data_container.preamble_nSymb))*frequency_interpolation_rate, data_container.baseband_data, data_container.interpolation_rate, DECIMATION);
+			ofdm->rational_resampler(&data_container->baseband_data_interpolated[receive_stats.delay], (data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb))*frequency_interpolation_rate, data_container->baseband_data, data_container->interpolation_rate, DECIMATION);
 
 
 			if(receive_stats.sync_trials==time_sync_trials_max && use_last_good_freq_offset==YES && receive_stats.freq_offset_of_last_decoded_message!=0)
@@ -1116,68 +1663,78 @@ skip_h_retry_point:
 				// BUG FIX: baseband_data is at decimated (base) rate after rational_resampler,
 				// so guard interval skip is Ngi samples, NOT Ngi*interpolation_rate.
 				// The old code skipped Ngi*4=256=Nfft samples, reading across symbol boundaries.
-				freq_offset_measured=ofdm.carrier_sampling_frequency_sync(&data_container.baseband_data[data_container.Ngi],bandwidth/(double)data_container.Nc,data_container.preamble_nSymb, sampling_frequency);
+				freq_offset_measured=ofdm->carrier_sampling_frequency_sync(&data_container->baseband_data[data_container->Ngi],bandwidth/(double)data_container->Nc,data_container->preamble_nSymb, sampling_frequency);
 			}
 
 			if(M == MOD_MFSK)
 			{
 				// MFSK: skip fine frequency correction (no channel estimation to compensate)
 			}
-			else if(fabs(freq_offset_measured)>ofdm.freq_offset_ignore_limit)
+			else if(fabs(freq_offset_measured)>ofdm->freq_offset_ignore_limit)
 			{
 				// Apply fine correction on top of coarse correction
-				ofdm.passband_to_baseband((double*)data,(data_container.Nofdm*data_container.buffer_Nsymb)*frequency_interpolation_rate,data_container.baseband_data_interpolated,sampling_frequency,effective_carrier_freq+freq_offset_measured,carrier_amplitude,1,&ofdm.FIR_rx_data);
-				ofdm.rational_resampler(&data_container.baseband_data_interpolated[receive_stats.delay], (data_container.Nofdm*(data_container.Nsymb+data_container.preamble_nSymb))*frequency_interpolation_rate, data_container.baseband_data, data_container.interpolation_rate, DECIMATION);
+				frame_baseband((double*)data,effective_carrier_freq+freq_offset_measured,sync_baseband);
+				ofdm->rational_resampler(&data_container->baseband_data_interpolated[receive_stats.delay], (data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb))*frequency_interpolation_rate, data_container->baseband_data, data_container->interpolation_rate, DECIMATION);
 			}
 			{
 				// In ctrl mode, only demod ctrl_nsymb symbols; otherwise full Nsymb
 				int rx_nsymb = get_active_nsymb();
 				for(int i=0;i<rx_nsymb;i++)
 				{
-					ofdm.symbol_demod(&data_container.baseband_data[i*data_container.Nofdm+data_container.Nofdm*data_container.preamble_nSymb],&data_container.ofdm_symbol_demodulated_data[i*data_container.Nc]);
+					ofdm->symbol_demod(&data_container->baseband_data[i*data_container->Nofdm+data_container->Nofdm*data_container->preamble_nSymb],&data_container->ofdm_symbol_demodulated_data[i*data_container->Nc]);
 				}
 			}
 
 
+			// Only a frame received with a coherent preamble is worth keeping for chase combining.
+			double sync_coherence=0;
+			if(M != MOD_MFSK && harq_nBuffers>0 && receive_stats.frame_key!=HARQ_NO_KEY)
+			{
+				sync_coherence=ofdm->preamble_coherence(data_container->baseband_data);
+			}
+
+			int rx_ir_part=IR_FULL;
+			receive_stats.frame_nsymb=get_active_nsymb();
+
 			if(M == MOD_MFSK)
 			{
 				// MFSK: non-coherent energy detection on FFT output → soft LLRs
 				int rx_nbits = get_active_nbits();
-				mfsk.demod(data_container.ofdm_symbol_demodulated_data, rx_nbits, data_container.demodulated_data);
+				mfsk->demod(data_container->ofdm_symbol_demodulated_data, rx_nbits, data_container->demodulated_data);
 
 #ifdef MERCURY_GUI_ENABLED
 				// Accumulate tone energies across ALL symbols for full-packet view
 				{
-					int nSymbols = rx_nbits / (mfsk.nBits * mfsk.nStreams);
+					int nSymbols = rx_nbits / (mfsk->nBits * mfsk->nStreams);
 					double gui_E[2][64] = {};
 					int gui_peak[2] = {};
-					for (int st = 0; st < mfsk.nStreams && st < 2; st++)
+					for (int st = 0; st < mfsk->nStreams && st < 2; st++)
 					{
 						for (int s = 0; s < nSymbols; s++)
 						{
-							int hop = (s * mfsk.tone_hop_step) % mfsk.M;
-							for (int m = 0; m < mfsk.M && m < 64; m++)
+							int hop = (s * mfsk->tone_hop_step) % mfsk->M;
+							for (int m = 0; m < mfsk->M && m < 64; m++)
 							{
-								std::complex<double> val = data_container.ofdm_symbol_demodulated_data[
-									s * data_container.Nc + mfsk.stream_offsets[st] + ((m + hop) % mfsk.M)];
+								sample_complex val = data_container->ofdm_symbol_demodulated_data[
+									s * data_container->Nc + mfsk->stream_offsets[st] + ((m + hop) % mfsk->M)];
 								gui_E[st][m] += val.real() * val.real() + val.imag() * val.imag();
 							}
 						}
 						// Peak = last symbol's active tone
 						if (nSymbols > 0) {
 							int last_s = nSymbols - 1;
-							int hop = (last_s * mfsk.tone_hop_step) % mfsk.M;
+							int hop = (last_s * mfsk->tone_hop_step) % mfsk->M;
 							double max_e = -1.0;
-							for (int m = 0; m < mfsk.M && m < 64; m++)
+							for (int m = 0; m < mfsk->M && m < 64; m++)
 							{
-								std::complex<double> val = data_container.ofdm_symbol_demodulated_data[
-									last_s * data_container.Nc + mfsk.stream_offsets[st] + ((m + hop) % mfsk.M)];
+								sample_complex val = data_container->ofdm_symbol_demodulated_data[
+									last_s * data_container->Nc + mfsk->stream_offsets[st] + ((m + hop) % mfsk->M)];
 								double e = val.real() * val.real() + val.imag() * val.imag();
 								if (e > max_e) { max_e = e; gui_peak[st] = m; }
 							}
 						}
 					}
-					gui_push_mfsk_tones(gui_E, gui_peak, mfsk.M, mfsk.nStreams, false);
+					gui_push_mfsk_tones(gui_E, gui_peak, mfsk->M, mfsk->nStreams, false);
 				}
 #endif
 
@@ -1186,24 +1743,36 @@ skip_h_retry_point:
 				int puncture_from = rx_nbits;
 				if(test_puncture_nBits > 0 && test_puncture_nBits < puncture_from)
 					puncture_from = test_puncture_nBits;
-				for(int i = puncture_from; i < data_container.nBits; i++)
+				for(int i = puncture_from; i < data_container->nBits; i++)
 				{
-					data_container.demodulated_data[i] = 0.0f;
+					data_container->demodulated_data[i] = 0.0f;
 				}
 
+				deinterleaver(data_container->demodulated_data,data_container->deinterleaved_data,data_container->nBits,bit_interleaver_block_size);
+
 			}
 			else
 			{
-				ofdm.automatic_gain_control(data_container.ofdm_symbol_demodulated_data);
+				// A first part is a prefix of the full frame: the rows after it are rebuilt from its
+				// pilots and their LLRs erased. Once a part of the message is held, only full frames
+				// of it are resent.
+				if(ir_nsymb>0 && operation_mode==ARQ_MODE && harq_holds(receive_stats.frame_key)==NO)
+				{
+					rx_ir_part=IR_FIRST;
+					ofdm->fill_missing_symbols(data_container->ofdm_symbol_demodulated_data,0,ir_nsymb);
+					receive_stats.frame_nsymb=ir_nsymb;
+				}
+
+				ofdm->automatic_gain_control(data_container->ofdm_symbol_demodulated_data);
 
 				// DIAGNOSTIC: Print first few pilot subcarrier values after AGC
 				{
 					int diag_count = 0;
 					printf("[PILOT-DIAG] trial=%d first_pilots_after_AGC: ", receive_stats.sync_trials);
-					for(int si = 0; si < ofdm.Nsymb && diag_count < 5; si++) {
-						for(int sc = 0; sc < ofdm.Nc && diag_count < 5; sc++) {
-							if((ofdm.ofdm_frame + si*ofdm.Nc + sc)->type == PILOT) {
-								std::complex<double> v = data_container.ofdm_symbol_demodulated_data[si*data_container.Nc + sc];
+					for(int si = 0; si < ofdm->Nsymb && diag_count < 5; si++) {
+						for(int sc = 0; sc < ofdm->Nc && diag_count < 5; sc++) {
+							if((ofdm->ofdm_frame + si*ofdm->Nc + sc)->type == PILOT) {
+								sample_complex v = data_container->ofdm_symbol_demodulated_data[si*data_container->Nc + sc];
 								printf("[%d,%d]=(%.3f,%.3f)|%.3f ", si, sc, v.real(), v.imag(), std::abs(v));
 								diag_count++;
 							}
@@ -1212,31 +1781,35 @@ skip_h_retry_point:
 					printf("\n"); fflush(stdout);
 				}
 
-				if(ofdm.channel_estimator==ZERO_FORCE)
+				if(ofdm->channel_estimator==ZERO_FORCE)
 				{
-					ofdm.ZF_channel_estimator(data_container.ofdm_symbol_demodulated_data);
+					ofdm->ZF_channel_estimator(data_container->ofdm_symbol_demodulated_data);
 				}
-				else if (ofdm.channel_estimator==LEAST_SQUARE)
+				else if (ofdm->channel_estimator==LEAST_SQUARE)
 				{
-					ofdm.LS_channel_estimator(data_container.ofdm_symbol_demodulated_data);
+					ofdm->LS_channel_estimator(data_container->ofdm_symbol_demodulated_data);
 				}
-
+				else if (ofdm->channel_estimator==CHANNEL_EST_MMSE)
+				{
+					ofdm->MMSE_channel_estimator(data_container->ofdm_symbol_demodulated_data);
+				}
+
 				// Channel estimate diagnostic (BEFORE equalizer clears status)
 				double mean_H = -1.0;
 				{
 					double h_sum = 0, h_min = 1e9, h_max = 0;
 					int h_measured = 0, h_interpolated = 0;
-					for(int ci = 0; ci < ofdm.Nsymb * ofdm.Nc; ci++)
+					for(int ci = 0; ci < ofdm->Nsymb * ofdm->Nc; ci++)
 					{
-						if(ofdm.estimated_channel[ci].status == MEASURED)
+						if(ofdm->estimated_channel[ci].status == MEASURED)
 						{
-							double h_abs = std::abs(ofdm.estimated_channel[ci].value);
+							double h_abs = std::abs(ofdm->estimated_channel[ci].value);
 							h_sum += h_abs;
 							if(h_abs < h_min) h_min = h_abs;
 							if(h_abs > h_max) h_max = h_abs;
 							h_measured++;
 						}
-						else if(ofdm.estimated_channel[ci].status == INTERPOLATED)
+						else if(ofdm->estimated_channel[ci].status == INTERPOLATED)
 						{
 							h_interpolated++;
 						}
@@ -1251,13 +1824,13 @@ skip_h_retry_point:
 					if(receive_stats.sync_trials == 0) {
 						int hd = 0;
 						printf("[H-DIAG] first_H: ");
-						for(int ci = 0; ci < ofdm.Nsymb * ofdm.Nc && hd < 5; ci++) {
-							if(ofdm.estimated_channel[ci].status == MEASURED) {
+						for(int ci = 0; ci < ofdm->Nsymb * ofdm->Nc && hd < 5; ci++) {
+							if(ofdm->estimated_channel[ci].status == MEASURED) {
 								printf("[%d,%d]=(%.4f,%.4f)|%.4f ",
-									ci / ofdm.Nc, ci % ofdm.Nc,
-									ofdm.estimated_channel[ci].value.real(),
-									ofdm.estimated_channel[ci].value.imag(),
-									std::abs(ofdm.estimated_channel[ci].value));
+									ci / ofdm->Nc, ci % ofdm->Nc,
+									ofdm->estimated_channel[ci].value.real(),
+									ofdm->estimated_channel[ci].value.imag(),
+									std::abs(ofdm->estimated_channel[ci].value));
 								hd++;
 							}
 						}
@@ -1279,155 +1852,56 @@ skip_h_retry_point:
 					continue;
 				}
 
-				if(ofdm.channel_estimator_amplitude_restoration==YES)
+				if(ofdm->channel_estimator_amplitude_restoration==YES)
 				{
-					ofdm.restore_channel_amplitude();
-					ofdm.channel_equalizer_without_amplitude_restoration(data_container.ofdm_symbol_demodulated_data,data_container.equalized_data_without_amplitude_restoration);
-					ofdm.deframer(data_container.equalized_data_without_amplitude_restoration,data_container.ofdm_deframed_data_without_amplitude_restoration);
+					ofdm->restore_channel_amplitude();
+					ofdm->channel_equalizer_without_amplitude_restoration(data_container->ofdm_symbol_demodulated_data,data_container->equalized_data_without_amplitude_restoration);
+					ofdm->deframer(data_container->equalized_data_without_amplitude_restoration,data_container->ofdm_deframed_data_without_amplitude_restoration);
 				}
 
-				ofdm.channel_equalizer(data_container.ofdm_symbol_demodulated_data,data_container.equalized_data);
-
-				variance=ofdm.measure_variance(data_container.equalized_data);
-
-				ofdm.deframer(data_container.equalized_data,data_container.ofdm_deframed_data);
-				deinterleaver(data_container.ofdm_deframed_data, data_container.ofdm_time_freq_deinterleaved_data, data_container.nData, time_freq_interleaver_block_size);
-				psk.demod(data_container.ofdm_time_freq_deinterleaved_data,data_container.nBits,data_container.demodulated_data,variance);
-			}
-
-			deinterleaver(data_container.demodulated_data,data_container.deinterleaved_data,data_container.nBits,bit_interleaver_block_size);
-
-			for(int i=ldpc.P-1;i>=0;i--)
-			{
-				data_container.deinterleaved_data[i+nReal_data+nVirtual_data]=data_container.deinterleaved_data[i+nReal_data];
-			}
-
-			for(int i=0;i<nVirtual_data;i++)
-			{
-				data_container.deinterleaved_data[nReal_data+i]=data_container.deinterleaved_data[i];
-			}
-
-			receive_stats.iterations_done=ldpc.decode(data_container.deinterleaved_data,data_container.hd_decoded_data_bit);
-
-
-			bit_energy_dispersal(data_container.hd_decoded_data_bit, data_container.bit_energy_dispersal_sequence, data_container.hd_decoded_data_bit, nReal_data);
-
+				ofdm->channel_equalizer(data_container->ofdm_symbol_demodulated_data,data_container->equalized_data);
 
-			bit_to_byte(data_container.hd_decoded_data_bit, data_container.hd_decoded_data_byte, nReal_data);
+				// The rebuilt rows of an IR part are noise free, only the received ones count.
+				variance=ofdm->measure_variance(data_container->equalized_data,0,receive_stats.frame_nsymb);
 
+				ofdm->deframer(data_container->equalized_data,data_container->ofdm_deframed_data);
+				psk->demod(data_container->ofdm_deframed_data,data_container->nBits,data_container->deinterleaved_data,variance,context->rx_bit_dest);
 
-			receive_stats.all_zeros=YES;
-			for(int i=0;i<nReal_data/8;i++)
-			{
-				if(data_container.hd_decoded_data_byte[i]!=0)
+				if(rx_ir_part==IR_FIRST)
 				{
-					receive_stats.all_zeros=NO;
-					break;
+					ir_erase_missing_bits();
 				}
 			}
 
-			for(int i=0;i<(nReal_data-outer_code_reserved_bits)/8;i++)
+			for(int i=ldpc->P-1;i>=0;i--)
 			{
-				*(out+i)=data_container.hd_decoded_data_byte[i];
+				data_container->deinterleaved_data[i+nReal_data+nVirtual_data]=data_container->deinterleaved_data[i+nReal_data];
 			}
 
-			// CRC16 self-check: compute CRC over [data + CRC_LSB + CRC_MSB] = nReal_data/8 bytes.
-			// For correct data, CRC16_MODBUS_RTU of [message || appended_CRC] = 0.
-			// Check on ALL frames (not just LDPC failures) to catch wrong-codeword convergence.
-			receive_stats.crc=0;
-			if(outer_code == CRC16_MODBUS_RTU && receive_stats.all_zeros == NO)
+			for(int i=0;i<nVirtual_data;i++)
 			{
-				receive_stats.crc=CRC16_MODBUS_RTU_calc(data_container.hd_decoded_data_byte, nReal_data/8);
+				data_container->deinterleaved_data[nReal_data+i]=data_container->deinterleaved_data[i];
 			}
 
-			if(receive_stats.all_zeros==YES ||
-			   (outer_code == CRC16_MODBUS_RTU && receive_stats.crc != 0) ||
-			   (outer_code != CRC16_MODBUS_RTU && receive_stats.iterations_done > (ldpc.nIteration_max-1)))
+			// The trial is decoded while the front end goes on with the next one, which is only
+			// needed if this decode fails.
+			st_rx_trial* trial=(rx_decoding==&rx_trial[0])?&rx_trial[1]:&rx_trial[0];
+			capture_rx_trial(trial,rx_ir_part,variance,freq_offset_measured,sync_coherence);
+
+			if(collect_rx_trial(out,nReal_data,&harq_tried,YES)==YES)
 			{
-				receive_stats.SNR=-99.9;
-				receive_stats.message_decoded=NO;
-				if(M != MOD_MFSK)
-				{
-					if (g_verbose)
-						printf("[OFDM-SYNC] trial %d FAIL: delay=%d iter=%d all_zeros=%d freq_off=%.1f var=%.4f\n",
-							receive_stats.sync_trials, receive_stats.delay,
-							receive_stats.iterations_done, receive_stats.all_zeros,
-							freq_offset_measured, variance);
-					fflush(stdout);
-				}
-				receive_stats.sync_trials++;
+				break;
 			}
-			else
-			{
-				if(M == MOD_MFSK)
-				{
-					// MFSK: no channel estimation, skip variance-based SNR
-					// TODO: estimate SNR from peak tone energy vs noise energy
-					receive_stats.SNR = 0.0;
-				}
-				else if(ofdm.channel_estimator==LEAST_SQUARE)
-				{
-					if(ofdm.channel_estimator_amplitude_restoration==YES)
-					{
-						variance=ofdm.measure_variance(data_container.equalized_data_without_amplitude_restoration);
-					}
-					receive_stats.SNR=10.0*log10(1.0/variance);
-				}
-				else if(ofdm.channel_estimator==ZERO_FORCE)
-				{
-					bit_energy_dispersal(data_container.hd_decoded_data_bit, data_container.bit_energy_dispersal_sequence, data_container.hd_decoded_data_bit, nReal_data);
 
-					for(int i=0;i<nVirtual_data;i++)
-					{
-						data_container.hd_decoded_data_bit[nReal_data+i]=data_container.hd_decoded_data_bit[i];
-					}
-					ldpc.encode(data_container.hd_decoded_data_bit,data_container.encoded_data);
-					for(int i=0;i<ldpc.P;i++)
-					{
-						data_container.encoded_data[nReal_data+i]=data_container.encoded_data[i+ldpc.K];
-					}
-					interleaver(data_container.encoded_data,data_container.bit_interleaved_data,data_container.nBits,bit_interleaver_block_size);
-					psk.mod(data_container.bit_interleaved_data,data_container.nBits,data_container.modulated_data);
-					interleaver(data_container.modulated_data, data_container.ofdm_time_freq_interleaved_data, data_container.nData, time_freq_interleaver_block_size);
-					if(ofdm.channel_estimator_amplitude_restoration==YES)
-					{
-						receive_stats.SNR=ofdm.measure_SNR(data_container.ofdm_deframed_data_without_amplitude_restoration,data_container.ofdm_time_freq_interleaved_data,data_container.nData);
-					}
-					else
-					{
-						receive_stats.SNR=ofdm.measure_SNR(data_container.ofdm_deframed_data,data_container.ofdm_time_freq_interleaved_data,data_container.nData);
-					}
-
-				}
-
-				receive_stats.message_decoded=YES;
-
-#ifdef MERCURY_GUI_ENABLED
-				// Push constellation IQ data to GUI for scatter plot
-				if (M != MOD_MFSK) {
-					const std::complex<double>* iq_src =
-						(ofdm.channel_estimator_amplitude_restoration == YES)
-						? data_container.ofdm_deframed_data_without_amplitude_restoration
-						: data_container.ofdm_deframed_data;
-					gui_push_constellation(iq_src, data_container.nData, (int)M, false);
-				} else {
-					gui_push_constellation(nullptr, 0, (int)M, true);
-				}
-#endif
-
-				// Only store freq offset for OFDM modes — MFSK runs the Moose estimator
-				// on non-OFDM preamble data producing a garbage value (~45 Hz) that would
-				// corrupt OFDM decoding after gearshift (use_last_good_freq_offset fallback).
-				if(M != MOD_MFSK)
-				{
-					receive_stats.freq_offset_of_last_decoded_message=freq_offset_measured;
-					receive_stats.freq_offset=freq_offset_measured;
-				}
-
-				receive_stats.delay_of_last_decoded_message=receive_stats.delay;
+			start_rx_trial(trial,nReal_data);
+			if(rx_decoding==NULL && finish_rx_trial(trial,out,nReal_data,&harq_tried)==YES)
+			{
 				break;
 			}
+			receive_stats.sync_trials++;
 		}
+		collect_rx_trial(out,nReal_data,&harq_tried,YES);
+rx_trial_decoded:
 
 		// SKIP-H recovery: if all trials failed with low channel estimate,
 		// the detected preamble was likely a false peak (e.g. residual MFSK
@@ -1438,30 +1912,26 @@ skip_h_retry_point:
 			&& !skip_h_recovery_attempted)
 		{
 			skip_h_recovery_attempted = true;
-			int sym_samples = data_container.Nofdm * frequency_interpolation_rate;
-			int buf_samples = data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate;
+			int sym_samples = data_container->Nofdm * frequency_interpolation_rate;
+			int buf_samples = data_container->Nofdm * data_container->buffer_Nsymb * frequency_interpolation_rate;
 
 			// Start searching 2 symbols past the false preamble
 			int search_start_symb = pream_symb_loc + 2;
 			int search_start = search_start_symb * sym_samples;
-			int search_size = data_container.Nofdm *
-				(2 * data_container.preamble_nSymb + data_container.Nsymb) *
+			int search_size = data_container->Nofdm *
+				(2 * data_container->preamble_nSymb + data_container->Nsymb) *
 				frequency_interpolation_rate;
 			int available = buf_samples - search_start;
 			if(available > search_size) available = search_size;
 
 			if(search_start_symb < upper_bound
-				&& available > data_container.preamble_nSymb * sym_samples)
+				&& available > data_container->preamble_nSymb * sym_samples)
 			{
-				// Re-run passband_to_baseband with time_sync FIR for fresh search
-				ofdm.passband_to_baseband((double*)data,
-					data_container.Nofdm * data_container.buffer_Nsymb * frequency_interpolation_rate,
-					data_container.baseband_data_interpolated,
-					sampling_frequency, carrier_frequency, carrier_amplitude,
-					1, &ofdm.FIR_rx_time_sync);
-
-				TimeSyncResult retry = ofdm.time_sync_preamble_with_metric(
-					&data_container.baseband_data_interpolated[search_start],
+				// Re-run the time sync baseband for a fresh search
+				sync_baseband=time_sync_baseband((double*)data,carrier_frequency);
+
+				TimeSyncResult retry = ofdm->time_sync_preamble_with_metric(
+					&sync_baseband[search_start],
 					available, frequency_interpolation_rate, 0, step, 1);
 				retry.delay += search_start;
 
@@ -1473,8 +1943,8 @@ skip_h_retry_point:
 				int rcnt = 0;
 				for(int i = 0; i < sym_samples && (retry.delay + i) < buf_samples; i++)
 				{
-					double re = data_container.baseband_data_interpolated[retry.delay + i].real();
-					double im = data_container.baseband_data_interpolated[retry.delay + i].imag();
+					double re = sync_baseband[retry.delay + i].real();
+					double im = sync_baseband[retry.delay + i].imag();
 					retry_energy += re*re + im*im;
 					rcnt++;
 				}
@@ -1504,7 +1974,7 @@ skip_h_retry_point:
 		} // end if(energy_ok)
 	}
 
-	if(ldpc.print_nIteration==YES)
+	if(ldpc->print_nIteration==YES)
 	{
 		std::cout<<"decoded in "<< receive_stats.iterations_done<<" iterations."<<std::endl;
 	}
@@ -1517,19 +1987,512 @@ skip_h_retry_point:
 	return receive_stats;
 }
 
+void cl_telecom_system::alloc_rx_trials()
+{
+	if(rx_trial_size>=data_container->nData)
+	{
+		return;
+	}
+	for(int i=0;i<2;i++)
+	{
+		if(rx_trial[i].llr!=NULL)
+		{
+			delete[] rx_trial[i].llr;
+			delete[] rx_trial[i].deframed_data;
+			delete[] rx_trial[i].deframed_data_without_amplitude_restoration;
+			delete[] rx_trial[i].result.hd_decoded_bit;
+			delete[] rx_trial[i].result.hd_decoded_byte;
+		}
+		rx_trial[i].llr=new float[N_MAX];
+		rx_trial[i].deframed_data=new sample_complex[data_container->nData];
+		rx_trial[i].deframed_data_without_amplitude_restoration=new sample_complex[data_container->nData];
+		rx_trial[i].result.hd_decoded_bit=new int[N_MAX];
+		rx_trial[i].result.hd_decoded_byte=new int[N_MAX/8];
+		if(rx_trial[i].llr==NULL || rx_trial[i].deframed_data==NULL || rx_trial[i].deframed_data_without_amplitude_restoration==NULL
+				|| rx_trial[i].result.hd_decoded_bit==NULL || rx_trial[i].result.hd_decoded_byte==NULL)
+		{
+			std::cout<<"Memory allocation error"<<std::endl;
+			exit(2);
+		}
+	}
+	rx_trial_size=data_container->nData;
+}
+
+// The front end of the next trial overwrites the data container, so the trial keeps its own copy
+// of what decoding and reporting it needs.
+void cl_telecom_system::capture_rx_trial(st_rx_trial* trial, int rx_ir_part, float variance, double freq_offset_measured, double sync_coherence)
+{
+	memcpy(trial->llr,data_container->deinterleaved_data,ldpc->N*sizeof(float));
+	trial->sync_trial=receive_stats.sync_trials;
+	trial->delay=receive_stats.delay;
+	trial->freq_offset=freq_offset_measured;
+	trial->variance=variance;
+	trial->SNR_variance=variance;
+	trial->ir_part=rx_ir_part;
+	trial->frame_nsymb=receive_stats.frame_nsymb;
+	trial->frame_key=receive_stats.frame_key;
+	trial->sync_coherence=sync_coherence;
+	trial->decoded=NO;
+	trial->result.iterations_done=-1;
+	ldpc->init_workspace(&trial->ldpc_workspace);
+	if(M != MOD_MFSK)
+	{
+		memcpy(trial->deframed_data,data_container->ofdm_deframed_data,data_container->nData*sizeof(sample_complex));
+		if(ofdm->channel_estimator_amplitude_restoration==YES)
+		{
+			memcpy(trial->deframed_data_without_amplitude_restoration,data_container->ofdm_deframed_data_without_amplitude_restoration,data_container->nData*sizeof(sample_complex));
+			trial->SNR_variance=ofdm->measure_variance(data_container->equalized_data_without_amplitude_restoration,0,receive_stats.frame_nsymb);
+		}
+	}
+}
+
+// The decode only touches the trial, its result is published by finish_rx_trial().
+void cl_telecom_system::start_rx_trial(st_rx_trial* trial, int nReal_data)
+{
+	if(pipelined_receive==YES)
+	{
+		rx_decoding=trial;
+		rx_decoder_done=NO;
+		rx_decoder=std::thread([this,trial,nReal_data]()
+		{
+			trial->decoded=decode_frame(trial->llr,nReal_data,&trial->result,&trial->ldpc_workspace);
+			rx_decoder_done=YES;
+		});
+	}
+	else
+	{
+		trial->decoded=decode_frame(trial->llr,nReal_data,&trial->result,&trial->ldpc_workspace);
+	}
+}
+
+// Takes the trial off the decoder and reports it, returns YES when it decoded. Without wait
+// this is only done if the decoder is already done.
+int cl_telecom_system::collect_rx_trial(int* out, int nReal_data, int* harq_tried, int wait)
+{
+	if(rx_decoding==NULL || (wait==NO && rx_decoder_done==NO))
+	{
+		return NO;
+	}
+	rx_decoder.join();
+	st_rx_trial* trial=rx_decoding;
+	rx_decoding=NULL;
+	return finish_rx_trial(trial,out,nReal_data,harq_tried);
+}
+
+// A decode still running uses the LDPC code and workspaces of the configuration it was started in.
+void cl_telecom_system::quiesce_rx_decoder()
+{
+	if(rx_decoder.joinable())
+	{
+		rx_decoder.join();
+	}
+	rx_decoding=NULL;
+}
+
+// Reports a decoded trial, returns YES when its frame (or its chase combination) passed the checks.
+int cl_telecom_system::finish_rx_trial(st_rx_trial* trial, int* out, int nReal_data, int* harq_tried)
+{
+	receive_stats.ir_part=trial->ir_part;
+	int frame_decoded=trial->decoded;
+
+	// Chase combining, at most once per call: every sync trial of the same buffer sees the same frame.
+	// Only a keyed frame whose preamble was received coherently is combined and kept. The key is
+	// what the ARQ receiver expects, the buffers of a decoded message are released by the ARQ
+	// receiver from the id in its header.
+	receive_stats.harq_combined=NO;
+	if(frame_decoded==NO && M != MOD_MFSK && operation_mode==ARQ_MODE && *harq_tried==NO
+			&& trial->frame_key!=HARQ_NO_KEY && trial->sync_coherence>=HARQ_SYNC_COHERENCE)
+	{
+		*harq_tried=YES;
+		frame_decoded=harq_combine(trial,nReal_data);
+	}
+	if(trial->result.iterations_done>=0)
+	{
+		publish_decode_result(&trial->result,out,nReal_data);
+	}
+
+	if(frame_decoded==NO)
+	{
+		receive_stats.SNR=-99.9;
+		receive_stats.message_decoded=NO;
+		if(M != MOD_MFSK)
+		{
+			if (g_verbose)
+				printf("[OFDM-SYNC] trial %d FAIL: delay=%d iter=%d all_zeros=%d freq_off=%.1f var=%.4f\n",
+					trial->sync_trial, trial->delay,
+					receive_stats.iterations_done, receive_stats.all_zeros,
+					trial->freq_offset, trial->variance);
+			fflush(stdout);
+		}
+		return NO;
+	}
+
+	// Put the data container back to the decoded trial.
+	receive_stats.sync_trials=trial->sync_trial;
+	receive_stats.delay=trial->delay;
+	receive_stats.frame_nsymb=trial->frame_nsymb;
+	memcpy(data_container->deinterleaved_data,trial->llr,ldpc->N*sizeof(float));
+	if(M != MOD_MFSK)
+	{
+		memcpy(data_container->ofdm_deframed_data,trial->deframed_data,data_container->nData*sizeof(sample_complex));
+		if(ofdm->channel_estimator_amplitude_restoration==YES)
+		{
+			memcpy(data_container->ofdm_deframed_data_without_amplitude_restoration,trial->deframed_data_without_amplitude_restoration,data_container->nData*sizeof(sample_complex));
+		}
+	}
+
+	if(M == MOD_MFSK)
+	{
+		// MFSK: no channel estimation, skip variance-based SNR
+		// TODO: estimate SNR from peak tone energy vs noise energy
+		receive_stats.SNR = 0.0;
+	}
+	else if(ofdm->channel_estimator==LEAST_SQUARE || ofdm->channel_estimator==CHANNEL_EST_MMSE)
+	{
+		receive_stats.SNR=10.0*log10(1.0/trial->SNR_variance);
+	}
+	else if(ofdm->channel_estimator==ZERO_FORCE)
+	{
+		int nVirtual_data=ldpc->N-data_container->nBits;
+		bit_energy_dispersal(data_container->hd_decoded_data_bit, data_container->bit_energy_dispersal_sequence, data_container->hd_decoded_data_bit, nReal_data);
+
+		for(int i=0;i<nVirtual_data;i++)
+		{
+			data_container->hd_decoded_data_bit[nReal_data+i]=data_container->hd_decoded_data_bit[i];
+		}
+		ldpc->encode(data_container->hd_decoded_data_bit,data_container->encoded_data);
+		for(int i=0;i<ldpc->P;i++)
+		{
+			data_container->encoded_data[nReal_data+i]=data_container->encoded_data[i+ldpc->K];
+		}
+		interleaver(data_container->encoded_data,data_container->bit_interleaved_data,data_container->nBits,bit_interleaver_block_size);
+		psk->mod(data_container->bit_interleaved_data,data_container->nBits,data_container->modulated_data);
+		interleaver(data_container->modulated_data, data_container->ofdm_time_freq_interleaved_data, data_container->nData, time_freq_interleaver_block_size);
+		if(ofdm->channel_estimator_amplitude_restoration==YES)
+		{
+			receive_stats.SNR=ofdm->measure_SNR(data_container->ofdm_deframed_data_without_amplitude_restoration,data_container->ofdm_time_freq_interleaved_data,data_container->nData);
+		}
+		else
+		{
+			receive_stats.SNR=ofdm->measure_SNR(data_container->ofdm_deframed_data,data_container->ofdm_time_freq_interleaved_data,data_container->nData);
+		}
+
+	}
+
+	receive_stats.message_decoded=YES;
+
+#ifdef MERCURY_GUI_ENABLED
+	// Push constellation IQ data to GUI for scatter plot
+	if (M != MOD_MFSK) {
+		const sample_complex* iq_src =
+			(ofdm->channel_estimator_amplitude_restoration == YES)
+			? data_container->ofdm_deframed_data_without_amplitude_restoration
+			: data_container->ofdm_deframed_data;
+		gui_push_constellation(iq_src, data_container->nData, (int)M, false);
+	} else {
+		gui_push_constellation<sample_real>(nullptr, 0, (int)M, true);
+	}
+#endif
+
+	// Only store freq offset for OFDM modes — MFSK runs the Moose estimator
+	// on non-OFDM preamble data producing a garbage value (~45 Hz) that would
+	// corrupt OFDM decoding after gearshift (use_last_good_freq_offset fallback).
+	if(M != MOD_MFSK)
+	{
+		receive_stats.freq_offset_of_last_decoded_message=trial->freq_offset;
+		receive_stats.freq_offset=trial->freq_offset;
+	}
+
+	receive_stats.delay_of_last_decoded_message=receive_stats.delay;
+	return YES;
+}
+
+int cl_telecom_system::decode_frame(float* llr, int nReal_data, st_decode_result* result, st_ldpc_workspace* ldpc_workspace)
+{
+	result->iterations_done=ldpc->decode(llr,result->hd_decoded_bit,ldpc_workspace);
+
+
+	bit_energy_dispersal(result->hd_decoded_bit, data_container->bit_energy_dispersal_sequence, result->hd_decoded_bit, nReal_data);
+
+
+	bit_to_byte(result->hd_decoded_bit, result->hd_decoded_byte, nReal_data);
+
+
+	result->all_zeros=YES;
+	for(int i=0;i<nReal_data/8;i++)
+	{
+		if(result->hd_decoded_byte[i]!=0)
+		{
+			result->all_zeros=NO;
+			break;
+		}
+	}
+
+	// CRC16 self-check: compute CRC over [data + CRC_LSB + CRC_MSB] = nReal_data/8 bytes.
+	// For correct data, CRC16_MODBUS_RTU of [message || appended_CRC] = 0.
+	// Check on ALL frames (not just LDPC failures) to catch wrong-codeword convergence.
+	result->crc=0;
+	if(outer_code == CRC16_MODBUS_RTU && result->all_zeros == NO)
+	{
+		result->crc=CRC16_MODBUS_RTU_calc(result->hd_decoded_byte, nReal_data/8);
+	}
+
+	if(result->all_zeros==YES ||
+	   (outer_code == CRC16_MODBUS_RTU && result->crc != 0) ||
+	   (outer_code != CRC16_MODBUS_RTU && result->iterations_done > (ldpc->nIteration_max-1)))
+	{
+		return NO;
+	}
+	return YES;
+}
+
+// Main thread only: copies a decode into receive_stats, the data container and out. out may be
+// the data container's hd_decoded_data_byte.
+void cl_telecom_system::publish_decode_result(const st_decode_result* result, int* out, int nReal_data)
+{
+	receive_stats.iterations_done=result->iterations_done;
+	receive_stats.all_zeros=result->all_zeros;
+	receive_stats.crc=result->crc;
+	memcpy(data_container->hd_decoded_data_bit,result->hd_decoded_bit,nReal_data*sizeof(int));
+	memcpy(data_container->hd_decoded_data_byte,result->hd_decoded_byte,(nReal_data/8)*sizeof(int));
+	for(int i=0;i<(nReal_data-outer_code_reserved_bits)/8;i++)
+	{
+		out[i]=data_container->hd_decoded_data_byte[i];
+	}
+}
+
+// The frame key matches a failed frame with the stored receptions of the same ARQ message, all
+// of them are summed and decoded once. The CRC16 outer code confirms the
+// result; the buffers of the key are released since its message is now received.
+int cl_telecom_system::harq_combine(st_rx_trial* trial, int nReal_data)
+{
+	float* llr=trial->llr;
+	int key=trial->frame_key;
+	if(harq_nBuffers<=0 || harq_llr==NULL || outer_code!=CRC16_MODBUS_RTU || key==HARQ_NO_KEY)
+	{
+		return NO;
+	}
+
+	int free_buffer=-1;
+	int oldest_buffer=-1;
+	int duplicate_buffer=-1;
+	int nCombined=0;
+	memcpy(harq_llr_combined,llr,ldpc->N*sizeof(float));
+	for(int b=0;b<harq_nBuffers;b++)
+	{
+		if(harq_age[b]<0)
+		{
+			free_buffer=b;
+			continue;
+		}
+		if(oldest_buffer==-1 || harq_age[b]>harq_age[oldest_buffer])
+		{
+			oldest_buffer=b;
+		}
+		if(harq_key[b]!=key)
+		{
+			continue;
+		}
+		float* stored=&harq_llr[b*N_MAX];
+		double dot=0,energy_stored=0,energy_current=0;
+		for(int i=0;i<ldpc->N;i++)
+		{
+			if(stored[i]!=0 && llr[i]!=0)
+			{
+				dot+=stored[i]*llr[i];
+				energy_stored+=stored[i]*stored[i];
+				energy_current+=llr[i]*llr[i];
+			}
+		}
+		// Independent receptions of a frame only share the sign of the LLRs, a near copy is the
+		// same reception captured again and would be counted twice.
+		if(energy_stored>0 && energy_current>0 && dot/sqrt(energy_stored*energy_current)>HARQ_DUPLICATE_CORRELATION)
+		{
+			duplicate_buffer=b;
+			continue;
+		}
+		for(int i=0;i<ldpc->N;i++)
+		{
+			harq_llr_combined[i]+=stored[i];
+		}
+		nCombined++;
+	}
+
+	if(nCombined>0 && decode_frame(harq_llr_combined,nReal_data,&trial->result,&trial->ldpc_workspace)==YES)
+	{
+		harq_release(key);
+		receive_stats.harq_combined=YES;
+		if (g_verbose)
+			printf("[HARQ] frame key %d recovered by combining %d soft buffer(s)\n", key, nCombined);
+		return YES;
+	}
+
+	// A copy replaces the reception it repeats.
+	int buffer=duplicate_buffer;
+	if(buffer==-1)
+	{
+		buffer=(free_buffer!=-1)?free_buffer:oldest_buffer;
+	}
+	memcpy(&harq_llr[buffer*N_MAX],llr,ldpc->N*sizeof(float));
+	harq_age[buffer]=0;
+	harq_key[buffer]=key;
+	receive_stats.harq_stored=YES;
+	return NO;
+}
+
+void cl_telecom_system::harq_release(int key)
+{
+	if(harq_age==NULL || key==HARQ_NO_KEY)
+	{
+		return;
+	}
+	for(int b=0;b<harq_nBuffers;b++)
+	{
+		if(harq_key[b]==key)
+		{
+			harq_age[b]=-1;
+		}
+	}
+}
+
+int cl_telecom_system::harq_holds(int key)
+{
+	if(harq_age==NULL || key==HARQ_NO_KEY)
+	{
+		return NO;
+	}
+	for(int b=0;b<harq_nBuffers;b++)
+	{
+		if(harq_age[b]>=0 && harq_key[b]==key)
+		{
+			return YES;
+		}
+	}
+	return NO;
+}
+
+// Stored frames outlive a configuration switch unless the frame geometry changes with it.
+void cl_telecom_system::harq_init()
+{
+	if(harq_nBuffers==harq_nBuffers_allocated)
+	{
+		if(ldpc->N!=harq_N || data_container->Nsymb!=harq_Nsymb || M!=harq_M)
+		{
+			harq_flush();
+		}
+		harq_N=ldpc->N;
+		harq_Nsymb=data_container->Nsymb;
+		harq_M=M;
+		return;
+	}
+	harq_deinit();
+	harq_N=ldpc->N;
+	harq_Nsymb=data_container->Nsymb;
+	harq_M=M;
+	if(harq_nBuffers>0)
+	{
+		harq_llr=new float[harq_nBuffers*N_MAX];
+		harq_llr_combined=new float[N_MAX];
+		harq_age=new int[harq_nBuffers];
+		harq_key=new int[harq_nBuffers];
+		if(harq_llr==NULL || harq_llr_combined==NULL || harq_age==NULL || harq_key==NULL)
+		{
+			std::cout<<"Memory allocation error"<<std::endl;
+			exit(2);
+		}
+		harq_nBuffers_allocated=harq_nBuffers;
+	}
+	harq_flush();
+}
+
+void cl_telecom_system::harq_deinit()
+{
+	if(harq_llr!=NULL)
+	{
+		delete[] harq_llr;
+		harq_llr=NULL;
+	}
+	if(harq_llr_combined!=NULL)
+	{
+		delete[] harq_llr_combined;
+		harq_llr_combined=NULL;
+	}
+	if(harq_age!=NULL)
+	{
+		delete[] harq_age;
+		harq_age=NULL;
+	}
+	if(harq_key!=NULL)
+	{
+		delete[] harq_key;
+		harq_key=NULL;
+	}
+	harq_nBuffers_allocated=0;
+}
+
+void cl_telecom_system::harq_flush()
+{
+	if(harq_age==NULL)
+	{
+		return;
+	}
+	for(int b=0;b<harq_nBuffers;b++)
+	{
+		harq_age[b]=-1;
+		harq_key[b]=HARQ_NO_KEY;
+	}
+}
+
+void cl_telecom_system::harq_age_buffers(int max_age)
+{
+	if(harq_age==NULL)
+	{
+		return;
+	}
+	for(int b=0;b<harq_nBuffers;b++)
+	{
+		if(harq_age[b]>=0)
+		{
+			harq_age[b]++;
+			if(harq_age[b]>max_age)
+			{
+				harq_age[b]=-1;
+			}
+		}
+	}
+}
+
+// Zeroes the LLRs of the constellation symbols that sat in rows not sent with a first part.
+void cl_telecom_system::ir_erase_missing_bits()
+{
+	int bits_per_symbol=data_container->nBits/data_container->nData;
+	int data_index=0;
+	for(int i=0;i<data_container->Nsymb;i++)
+	{
+		for(int j=0;j<data_container->Nc;j++)
+		{
+			if((ofdm->ofdm_frame+i*data_container->Nc+j)->type==DATA)
+			{
+				if(i>=ir_nsymb)
+				{
+					for(int k=0;k<bits_per_symbol;k++)
+					{
+						data_container->deinterleaved_data[context->rx_bit_dest[data_index*bits_per_symbol+k]]=0;
+					}
+				}
+				data_index++;
+			}
+		}
+	}
+}
+
 double cl_telecom_system::measure_signal_only(double *data)
 {
 	// Lightweight signal measurement - only passband to baseband + measure strength
 	// No preamble detection or decoding
-	ofdm.passband_to_baseband((double*)data,
-		data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate,
-		data_container.baseband_data_interpolated,
-		sampling_frequency, carrier_frequency, carrier_amplitude,
-		1, &ofdm.FIR_rx_time_sync);
-
-	double signal_dbm = ofdm.measure_signal_stregth(
-		data_container.baseband_data_interpolated,
-		data_container.Nofdm*data_container.buffer_Nsymb*frequency_interpolation_rate);
+	double signal_dbm = measure_signal_stregth(
+		time_sync_baseband((double*)data,carrier_frequency),
+		data_container->Nofdm*data_container->buffer_Nsymb*frequency_interpolation_rate);
 
 	receive_stats.signal_stregth_dbm = signal_dbm;
 
@@ -1547,41 +2510,72 @@ void cl_telecom_system::calculate_parameters()
 
 	if(M == MOD_MFSK)
 	{
-		nData_eff = ofdm.Nsymb;
-		log2M_eff = mfsk.bits_per_symbol();
+		nData_eff = ofdm->Nsymb;
+		log2M_eff = mfsk->bits_per_symbol();
 	}
 	else
 	{
-		nData_eff = ofdm.pilot_configurator.nData;
+		nData_eff = ofdm->pilot_configurator.nData;
 		log2M_eff = log2(M);
 	}
 
-	LDPC_real_CR=(nData_eff*log2M_eff-(double)ldpc.P -(double)outer_code_reserved_bits)/(nData_eff*log2M_eff);
-	Tu= ofdm.Nc/bandwidth;
-	Ts= Tu*(1.0+ofdm.gi);
-	Tf= Ts*(ofdm.Nsymb+ofdm.preamble_configurator.Nsymb);
+	LDPC_real_CR=(nData_eff*log2M_eff-(double)ldpc->P -(double)outer_code_reserved_bits)/(nData_eff*log2M_eff);
+	Tu= ofdm->Nc/bandwidth;
+	Ts= Tu*(1.0+ofdm->gi);
+	Tf= Ts*(ofdm->Nsymb+ofdm->preamble_configurator.Nsymb);
 	rb= nData_eff * log2M_eff /Tf;
 	rbc= rb*LDPC_real_CR;
 	if(M == MOD_MFSK)
 		Shannon_limit= 0;
 	else
-		Shannon_limit= 10.0*log10((pow(2,(rb*ldpc.rate)/bandwidth)-1)*log2M_eff*bandwidth/rb);
-	sampling_frequency=frequency_interpolation_rate*(bandwidth/ofdm.Nc)*ofdm.Nfft;
+		Shannon_limit= 10.0*log10((pow(2,(rb*ldpc->rate)/bandwidth)-1)*log2M_eff*bandwidth/rb);
+	sampling_frequency=frequency_interpolation_rate*(bandwidth/ofdm->Nc)*ofdm->Nfft;
 }
 
 void cl_telecom_system::set_mfsk_ctrl_mode(bool enable)
 {
-	mfsk_ctrl_mode = enable && (M == MOD_MFSK) && (ctrl_nBits > 0) && (ctrl_nBits < data_container.nBits);
+	mfsk_ctrl_mode = enable && (M == MOD_MFSK) && (ctrl_nBits > 0) && (ctrl_nBits < data_container->nBits);
 }
 
 int cl_telecom_system::get_active_nsymb() const
 {
-	return (mfsk_ctrl_mode && ctrl_nsymb > 0) ? ctrl_nsymb : data_container.Nsymb;
+	if(mfsk_ctrl_mode && ctrl_nsymb > 0)
+	{
+		return ctrl_nsymb;
+	}
+	if(ir_part==IR_FIRST)
+	{
+		return ir_nsymb;
+	}
+	return data_container->Nsymb;
+}
+
+void cl_telecom_system::set_ir_part(int part)
+{
+	ir_part = (ir_nsymb > 0 && M != MOD_MFSK) ? part : IR_FULL;
+}
+
+// Incremental redundancy: low rate OFDM codes still decode with part of the codeword
+// missing, the full frame is only sent if the first part failed. It relies on the HARQ soft
+// buffers and the CRC16 to merge the receptions.
+void cl_telecom_system::update_ir_nsymb()
+{
+	ir_nsymb = 0;
+	ir_part = IR_FULL;
+	if(M != MOD_MFSK && ldpc->rate <= IR_RATE_MAX && harq_nBuffers > 0 && outer_code == CRC16_MODBUS_RTU
+			&& ir_first_fraction > 0 && ir_first_fraction < 1)
+	{
+		ir_nsymb = (int)ceil(ir_first_fraction * data_container->Nsymb);
+		if(ir_nsymb >= data_container->Nsymb)
+		{
+			ir_nsymb = 0;
+		}
+	}
 }
 
 int cl_telecom_system::get_active_nbits() const
 {
-	return (mfsk_ctrl_mode && ctrl_nBits > 0) ? ctrl_nBits : data_container.nBits;
+	return (mfsk_ctrl_mode && ctrl_nBits > 0) ? ctrl_nBits : data_container->nBits;
 }
 
 // TX: Generate ACK pattern as passband audio (no LDPC, no interleaver — pure known tones)
@@ -1591,38 +2585,46 @@ int cl_telecom_system::generate_ack_pattern_passband(double* out)
 
 	if(ack_pattern_passband_samples <= 0) return 0;
 
+	double tx_carrier = carrier_frequency;
+	if(copy_cached_passband(&context->ack_pattern_passband, tx_carrier, out) == YES)
+	{
+		return ack_pattern_passband_samples;
+	}
+
 	int nsymb = cl_mfsk::ACK_PATTERN_NSYMB;
-	float power_normalization = sqrt((double)(ofdm.Nfft * frequency_interpolation_rate));
+	float power_normalization = sqrt((double)(ofdm->Nfft * frequency_interpolation_rate));
 
 	// Generate subcarrier-domain ACK pattern (nsymb * Nc complex values)
 	// Reuse ofdm_framed_data buffer (allocated for Nsymb * Nc, nsymb=16 fits easily)
 	// Always use dedicated ack_mfsk (M=16, nStreams=1) — config-independent
-	ack_mfsk.generate_ack_pattern(data_container.ofdm_framed_data);
+	ack_mfsk.generate_ack_pattern(data_container->ofdm_framed_data);
 
 
 	// IFFT each symbol to time domain
 	for(int i = 0; i < nsymb; i++)
 	{
-		ofdm.symbol_mod(&data_container.ofdm_framed_data[i * data_container.Nc],
-			&data_container.ofdm_symbol_modulated_data[i * data_container.Nofdm]);
+		ofdm->symbol_mod(&data_container->ofdm_framed_data[i * data_container->Nc],
+			&data_container->ofdm_symbol_modulated_data[i * data_container->Nofdm]);
 	}
 
 	// Amplitude boost: equalize drive level with OFDM (sqrt(Nc/nStreams) - 2 dB trim)
-	double ack_boost = sqrt((double)data_container.Nc / ack_mfsk.nStreams) * pow(10.0, -2.0 / 20.0);
-	for(int j = 0; j < data_container.Nofdm * nsymb; j++)
+	double ack_boost = sqrt((double)data_container->Nc / ack_mfsk.nStreams) * pow(10.0, -2.0 / 20.0);
+	for(int j = 0; j < data_container->Nofdm * nsymb; j++)
 	{
-		data_container.ofdm_symbol_modulated_data[j] /= power_normalization;
-		data_container.ofdm_symbol_modulated_data[j] *= sqrt(output_power_Watt) * ack_boost;
+		data_container->ofdm_symbol_modulated_data[j] /= power_normalization;
+		data_container->ofdm_symbol_modulated_data[j] *= sqrt(output_power_Watt) * ack_boost;
 	}
 
 	// Baseband to passband
-	double tx_carrier = carrier_frequency;
-	ofdm.baseband_to_passband(data_container.ofdm_symbol_modulated_data,
-		data_container.Nofdm * nsymb, out,
+	ofdm->passband_nco.reset();
+	ofdm->baseband_to_passband(data_container->ofdm_symbol_modulated_data,
+		data_container->Nofdm * nsymb, out,
 		sampling_frequency, tx_carrier, carrier_amplitude, frequency_interpolation_rate);
 
 	// Peak clipping
-	ofdm.peak_clip(out, ack_pattern_passband_samples, ofdm.data_papr_cut);
+	ofdm->peak_clip(out, ack_pattern_passband_samples, ofdm->data_papr_cut);
+
+	cache_passband(&context->ack_pattern_passband, tx_carrier, out, ack_pattern_passband_samples);
 
 
 	return ack_pattern_passband_samples;
@@ -1635,15 +2637,15 @@ double cl_telecom_system::detect_ack_pattern_from_passband(double* data, int siz
 	if(ack_pattern_passband_samples <= 0) return 0.0;
 
 	// Passband to baseband (use FIR_rx_data for proper image rejection)
-	ofdm.passband_to_baseband(data, size,
-		data_container.baseband_data_interpolated,
+	ofdm->passband_to_baseband(data, size,
+		data_container->baseband_data_interpolated,
 		sampling_frequency, carrier_frequency, carrier_amplitude,
-		1, &ofdm.FIR_rx_data);
+		1, &ofdm->FIR_rx_data);
 
 	// Run matched-filter ACK detector — always use dedicated ack_mfsk (config-independent)
-	double metric = ofdm.detect_ack_pattern(
-		data_container.baseband_data_interpolated, size,
-		data_container.interpolation_rate,
+	double metric = ofdm->detect_ack_pattern(
+		data_container->baseband_data_interpolated, size,
+		data_container->interpolation_rate,
 		cl_mfsk::ACK_PATTERN_NSYMB,
 		ack_mfsk.ack_tones, cl_mfsk::ACK_PATTERN_LEN,
 		ack_mfsk.tone_hop_step, ack_mfsk.M,
@@ -1658,30 +2660,38 @@ int cl_telecom_system::generate_break_pattern_passband(double* out)
 {
 	if(ack_pattern_passband_samples <= 0) return 0;
 
+	double tx_carrier = carrier_frequency;
+	if(copy_cached_passband(&context->break_pattern_passband, tx_carrier, out) == YES)
+	{
+		return ack_pattern_passband_samples;
+	}
+
 	int nsymb = cl_mfsk::ACK_PATTERN_NSYMB;
-	float power_normalization = sqrt((double)(ofdm.Nfft * frequency_interpolation_rate));
+	float power_normalization = sqrt((double)(ofdm->Nfft * frequency_interpolation_rate));
 
-	ack_mfsk.generate_break_pattern(data_container.ofdm_framed_data);
+	ack_mfsk.generate_break_pattern(data_container->ofdm_framed_data);
 
 	for(int i = 0; i < nsymb; i++)
 	{
-		ofdm.symbol_mod(&data_container.ofdm_framed_data[i * data_container.Nc],
-			&data_container.ofdm_symbol_modulated_data[i * data_container.Nofdm]);
+		ofdm->symbol_mod(&data_container->ofdm_framed_data[i * data_container->Nc],
+			&data_container->ofdm_symbol_modulated_data[i * data_container->Nofdm]);
 	}
 
-	double ack_boost = sqrt((double)data_container.Nc / ack_mfsk.nStreams) * pow(10.0, -2.0 / 20.0);
-	for(int j = 0; j < data_container.Nofdm * nsymb; j++)
+	double ack_boost = sqrt((double)data_container->Nc / ack_mfsk.nStreams) * pow(10.0, -2.0 / 20.0);
+	for(int j = 0; j < data_container->Nofdm * nsymb; j++)
 	{
-		data_container.ofdm_symbol_modulated_data[j] /= power_normalization;
-		data_container.ofdm_symbol_modulated_data[j] *= sqrt(output_power_Watt) * ack_boost;
+		data_container->ofdm_symbol_modulated_data[j] /= power_normalization;
+		data_container->ofdm_symbol_modulated_data[j] *= sqrt(output_power_Watt) * ack_boost;
 	}
 
-	double tx_carrier = carrier_frequency;
-	ofdm.baseband_to_passband(data_container.ofdm_symbol_modulated_data,
-		data_container.Nofdm * nsymb, out,
+	ofdm->passband_nco.reset();
+	ofdm->baseband_to_passband(data_container->ofdm_symbol_modulated_data,
+		data_container->Nofdm * nsymb, out,
 		sampling_frequency, tx_carrier, carrier_amplitude, frequency_interpolation_rate);
 
-	ofdm.peak_clip(out, ack_pattern_passband_samples, ofdm.data_papr_cut);
+	ofdm->peak_clip(out, ack_pattern_passband_samples, ofdm->data_papr_cut);
+
+	cache_passband(&context->break_pattern_passband, tx_carrier, out, ack_pattern_passband_samples);
 
 	return ack_pattern_passband_samples;
 }
@@ -1691,14 +2701,14 @@ double cl_telecom_system::detect_break_pattern_from_passband(double* data, int s
 {
 	if(ack_pattern_passband_samples <= 0) return 0.0;
 
-	ofdm.passband_to_baseband(data, size,
-		data_container.baseband_data_interpolated,
+	ofdm->passband_to_baseband(data, size,
+		data_container->baseband_data_interpolated,
 		sampling_frequency, carrier_frequency, carrier_amplitude,
-		1, &ofdm.FIR_rx_data);
+		1, &ofdm->FIR_rx_data);
 
-	double metric = ofdm.detect_ack_pattern(
-		data_container.baseband_data_interpolated, size,
-		data_container.interpolation_rate,
+	double metric = ofdm->detect_ack_pattern(
+		data_container->baseband_data_interpolated, size,
+		data_container->interpolation_rate,
 		cl_mfsk::ACK_PATTERN_NSYMB,
 		ack_mfsk.break_tones, cl_mfsk::ACK_PATTERN_LEN,
 		ack_mfsk.tone_hop_step, ack_mfsk.M,
@@ -1719,7 +2729,7 @@ void cl_telecom_system::ack_pattern_detection_test()
 
 	int nsymb = cl_mfsk::ACK_PATTERN_NSYMB;
 	int passband_samples = ack_pattern_passband_samples;
-	int delay_samples = 2 * data_container.Nofdm * frequency_interpolation_rate;
+	int delay_samples = 2 * data_container->Nofdm * frequency_interpolation_rate;
 	int rx_buffer_size = passband_samples + 2 * delay_samples;
 
 	double* tx_passband = new double[passband_samples];
@@ -1801,69 +2811,164 @@ void cl_telecom_system::ack_pattern_detection_test()
 	delete[] rx_buffer;
 }
 
-void cl_telecom_system::init()
+// Builds the context the objects of the current configuration point into, once. M, the LDPC code
+// and the telecom parameters of the configuration are already set.
+void cl_telecom_system::build_phy_context(int configuration, int preamble_nSymb, int channel_estimator)
 {
-	if(ofdm.Nc==AUTO_SELLECT)
+	if(M==MOD_BPSK || M==MOD_QPSK || M==MOD_8PSK)
+	{
+		ofdm->channel_estimator_amplitude_restoration=YES;
+	}
+	else
+	{
+		ofdm->channel_estimator_amplitude_restoration=NO;
+	}
+	ofdm->preamble_configurator.Nsymb=preamble_nSymb;
+	ofdm->channel_estimator=channel_estimator;
+
+	ofdm->Nc=default_configurations_telecom_system.ofdm_Nc;
+	ofdm->Nfft=default_configurations_telecom_system.ofdm_Nfft;
+	ofdm->gi=default_configurations_telecom_system.ofdm_gi;
+	ofdm->Nsymb=default_configurations_telecom_system.ofdm_Nsymb;
+
+	ofdm->pilot_configurator.Dx=default_configurations_telecom_system.ofdm_pilot_configurator_Dx;
+	ofdm->pilot_configurator.Dy=default_configurations_telecom_system.ofdm_pilot_configurator_Dy;
+	ofdm->pilot_configurator.first_row=default_configurations_telecom_system.ofdm_pilot_configurator_first_row;
+	ofdm->pilot_configurator.last_row=default_configurations_telecom_system.ofdm_pilot_configurator_last_row;
+	ofdm->pilot_configurator.first_col=default_configurations_telecom_system.ofdm_pilot_configurator_first_col;
+	ofdm->pilot_configurator.second_col=default_configurations_telecom_system.ofdm_pilot_configurator_second_col;
+	ofdm->pilot_configurator.last_col=default_configurations_telecom_system.ofdm_pilot_configurator_last_col;
+	ofdm->pilot_configurator.boost=default_configurations_telecom_system.ofdm_pilot_configurator_pilot_boost;
+	ofdm->pilot_configurator.seed=default_configurations_telecom_system.ofdm_pilot_configurator_seed;
+	ofdm->pilot_configurator.pilot_density=default_configurations_telecom_system.ofdm_pilot_density;
+
+	ofdm->preamble_configurator.nIdentical_sections=default_configurations_telecom_system.ofdm_preamble_configurator_nIdentical_sections;
+	ofdm->preamble_configurator.modulation=default_configurations_telecom_system.ofdm_preamble_configurator_modulation;
+	ofdm->preamble_configurator.boost=default_configurations_telecom_system.ofdm_preamble_configurator_boost;
+	ofdm->preamble_configurator.seed=default_configurations_telecom_system.ofdm_preamble_configurator_seed;
+
+	ofdm->freq_offset_ignore_limit=default_configurations_telecom_system.ofdm_freq_offset_ignore_limit;
+	ofdm->start_shift=default_configurations_telecom_system.ofdm_start_shift;
+
+	ofdm->preamble_papr_cut=default_configurations_telecom_system.ofdm_preamble_papr_cut;
+	ofdm->data_papr_cut=default_configurations_telecom_system.ofdm_data_papr_cut;
+
+	ofdm->LS_window_width=default_configurations_telecom_system.ofdm_LS_window_width;
+	ofdm->LS_window_hight=default_configurations_telecom_system.ofdm_LS_window_hight;
+
+	if(ofdm->LS_window_width%2==0)
+	{
+		ofdm->LS_window_width++;
+	}
+	if(ofdm->LS_window_hight%2==0)
+	{
+		ofdm->LS_window_hight++;
+	}
+
+	ofdm->MMSE_delay_spread=default_configurations_telecom_system.ofdm_MMSE_delay_spread;
+	ofdm->MMSE_doppler=default_configurations_telecom_system.ofdm_MMSE_doppler;
+
+	ofdm->FIR_rx_data.filter_window=default_configurations_telecom_system.ofdm_FIR_rx_data_filter_window;
+	ofdm->FIR_rx_data.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_rx_data_filter_transition_bandwidth;
+	ofdm->FIR_rx_data.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_rx_data_lpf_filter_cut_frequency;
+	ofdm->FIR_rx_data.type=default_configurations_telecom_system.ofdm_FIR_rx_data_filter_type;
+
+	ofdm->FIR_rx_time_sync.filter_window=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_filter_window;
+	ofdm->FIR_rx_time_sync.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_filter_transition_bandwidth;
+	ofdm->FIR_rx_time_sync.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_lpf_filter_cut_frequency;
+	ofdm->FIR_rx_time_sync.type=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_filter_type;
+
+
+	ofdm->FIR_tx1.filter_window=default_configurations_telecom_system.ofdm_FIR_tx1_filter_window;
+	ofdm->FIR_tx1.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_tx1_filter_transition_bandwidth;
+	ofdm->FIR_tx1.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx1_lpf_filter_cut_frequency;
+	ofdm->FIR_tx1.hpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx1_hpf_filter_cut_frequency;
+	ofdm->FIR_tx1.type=default_configurations_telecom_system.ofdm_FIR_tx1_filter_type;
+
+	ofdm->FIR_tx2.filter_window=default_configurations_telecom_system.ofdm_FIR_tx2_filter_window;
+	ofdm->FIR_tx2.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_tx2_filter_transition_bandwidth;
+	ofdm->FIR_tx2.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx2_lpf_filter_cut_frequency;
+	ofdm->FIR_tx2.hpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx2_hpf_filter_cut_frequency;
+	ofdm->FIR_tx2.type=default_configurations_telecom_system.ofdm_FIR_tx2_filter_type;
+
+	if(operation_mode==ARQ_MODE)
+	{
+		ofdm->pilot_configurator.print_on=NO;
+		ofdm->preamble_configurator.print_on=NO;
+	}
+
+	if(ofdm->Nc==AUTO_SELLECT)
+	{
+		ofdm->Nc=50;
+	}
+	if(M==MOD_MFSK)
 	{
-		ofdm.Nc=50;
+		if(configuration==ROBUST_0)
+		{
+			mfsk->init(32,ofdm->Nc,1);
+		}
+		else
+		{
+			mfsk->init(16,ofdm->Nc,2);  // ROBUST_1, ROBUST_2: 2x parallel 16-MFSK
+		}
 	}
-	if(ofdm.Nsymb==AUTO_SELLECT)
+	if(ofdm->Nsymb==AUTO_SELLECT)
 	{
 		if(M==MOD_MFSK)
 		{
 			// MFSK: bits per symbol period = nBits * nStreams
 			// Nsymb = LDPC codeword length / bits per symbol period
-			ofdm.Nsymb = N_MAX / mfsk.bits_per_symbol();
+			ofdm->Nsymb = N_MAX / mfsk->bits_per_symbol();
 		}
-		else if(ofdm.pilot_configurator.pilot_density==HIGH_DENSITY)
+		else if(ofdm->pilot_configurator.pilot_density==HIGH_DENSITY)
 		{
-			if(M==MOD_BPSK){ofdm.Nsymb=48;} //48,1,3
-			if(M==MOD_QPSK){ofdm.Nsymb=24;} //24,1,3
-			if(M==MOD_8PSK){ofdm.Nsymb=16;} //16,1,3
-			if(M==MOD_16QAM){ofdm.Nsymb=12;} //12,1,3
-			if(M==MOD_32QAM){ofdm.Nsymb=9;}
-			if(M==MOD_64QAM){ofdm.Nsymb=8;}
+			if(M==MOD_BPSK){ofdm->Nsymb=48;} //48,1,3
+			if(M==MOD_QPSK){ofdm->Nsymb=24;} //24,1,3
+			if(M==MOD_8PSK){ofdm->Nsymb=16;} //16,1,3
+			if(M==MOD_16QAM){ofdm->Nsymb=12;} //12,1,3
+			if(M==MOD_32QAM){ofdm->Nsymb=9;}
+			if(M==MOD_64QAM){ofdm->Nsymb=8;}
 		}
-		else if(ofdm.pilot_configurator.pilot_density==LOW_DENSITY)
+		else if(ofdm->pilot_configurator.pilot_density==LOW_DENSITY)
 		{
-			if(M==MOD_BPSK){ofdm.Nsymb=40;} //40,1,5
-			if(M==MOD_QPSK){ofdm.Nsymb=20;} //20,1,5
-			if(M==MOD_8PSK){ofdm.Nsymb=16;} //13,1,5 (Nc=51)
-			if(M==MOD_16QAM){ofdm.Nsymb=10;} //10,1,5
-			if(M==MOD_32QAM){ofdm.Nsymb=9;} //Nc=53
-			if(M==MOD_64QAM){ofdm.Nsymb=8;}
+			if(M==MOD_BPSK){ofdm->Nsymb=40;} //40,1,5
+			if(M==MOD_QPSK){ofdm->Nsymb=20;} //20,1,5
+			if(M==MOD_8PSK){ofdm->Nsymb=16;} //13,1,5 (Nc=51)
+			if(M==MOD_16QAM){ofdm->Nsymb=10;} //10,1,5
+			if(M==MOD_32QAM){ofdm->Nsymb=9;} //Nc=53
+			if(M==MOD_64QAM){ofdm->Nsymb=8;}
 		}
 	}
 
-	if(M!=MOD_MFSK && ofdm.pilot_configurator.Dx==AUTO_SELLECT)
+	if(M!=MOD_MFSK && ofdm->pilot_configurator.Dx==AUTO_SELLECT)
 	{
-		if(M==MOD_BPSK){ofdm.pilot_configurator.Dx=1;}
-		if(M==MOD_QPSK){ofdm.pilot_configurator.Dx=1;}
-		if(M==MOD_8PSK){ofdm.pilot_configurator.Dx=1;}
-		if(M==MOD_16QAM){ofdm.pilot_configurator.Dx=1;}
-		if(M==MOD_32QAM){ofdm.pilot_configurator.Dx=1;}
-		if(M==MOD_64QAM){ofdm.pilot_configurator.Dx=1;}
+		if(M==MOD_BPSK){ofdm->pilot_configurator.Dx=1;}
+		if(M==MOD_QPSK){ofdm->pilot_configurator.Dx=1;}
+		if(M==MOD_8PSK){ofdm->pilot_configurator.Dx=1;}
+		if(M==MOD_16QAM){ofdm->pilot_configurator.Dx=1;}
+		if(M==MOD_32QAM){ofdm->pilot_configurator.Dx=1;}
+		if(M==MOD_64QAM){ofdm->pilot_configurator.Dx=1;}
 	}
 
-	if(M!=MOD_MFSK && ofdm.pilot_configurator.Dy==AUTO_SELLECT)
+	if(M!=MOD_MFSK && ofdm->pilot_configurator.Dy==AUTO_SELLECT)
 	{
-		if(ofdm.pilot_configurator.pilot_density==HIGH_DENSITY)
+		if(ofdm->pilot_configurator.pilot_density==HIGH_DENSITY)
 		{
-			if(M==MOD_BPSK){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_QPSK){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_8PSK){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_16QAM){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_32QAM){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_64QAM){ofdm.pilot_configurator.Dy=3;}
+			if(M==MOD_BPSK){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_QPSK){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_8PSK){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_16QAM){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_32QAM){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_64QAM){ofdm->pilot_configurator.Dy=3;}
 		}
-		else if(ofdm.pilot_configurator.pilot_density==LOW_DENSITY)
+		else if(ofdm->pilot_configurator.pilot_density==LOW_DENSITY)
 		{
-			if(M==MOD_BPSK){ofdm.pilot_configurator.Dy=5;}
-			if(M==MOD_QPSK){ofdm.pilot_configurator.Dy=5;}
-			if(M==MOD_8PSK){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_16QAM){ofdm.pilot_configurator.Dy=5;}
-			if(M==MOD_32QAM){ofdm.pilot_configurator.Dy=3;}
-			if(M==MOD_64QAM){ofdm.pilot_configurator.Dy=3;}
+			if(M==MOD_BPSK){ofdm->pilot_configurator.Dy=5;}
+			if(M==MOD_QPSK){ofdm->pilot_configurator.Dy=5;}
+			if(M==MOD_8PSK){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_16QAM){ofdm->pilot_configurator.Dy=5;}
+			if(M==MOD_32QAM){ofdm->pilot_configurator.Dy=3;}
+			if(M==MOD_64QAM){ofdm->pilot_configurator.Dy=3;}
 		}
 
 	}
@@ -1871,98 +2976,66 @@ void cl_telecom_system::init()
 	// MFSK doesn't use pilots, but pilot_configurator needs valid Dx/Dy
 	if(M == MOD_MFSK)
 	{
-		if(ofdm.pilot_configurator.Dx == AUTO_SELLECT) ofdm.pilot_configurator.Dx = 1;
-		if(ofdm.pilot_configurator.Dy == AUTO_SELLECT) ofdm.pilot_configurator.Dy = ofdm.Nsymb;
+		if(ofdm->pilot_configurator.Dx == AUTO_SELLECT) ofdm->pilot_configurator.Dx = 1;
+		if(ofdm->pilot_configurator.Dy == AUTO_SELLECT) ofdm->pilot_configurator.Dy = ofdm->Nsymb;
 	}
 
-	if(operation_mode==ARQ_MODE)
-	{
-		ofdm.pilot_configurator.print_on=NO;
-		ofdm.preamble_configurator.print_on=NO;
-	}
+	ofdm->init();
+	calculate_parameters();
 
-	if(reinit_subsystems.ofdm==YES)
+	cl_FIR* filters[]={&ofdm->FIR_rx_data,&ofdm->FIR_rx_time_sync,&ofdm->FIR_tx1,&ofdm->FIR_tx2};
+	for(int i=0;i<4;i++)
 	{
-		printf("[PHY-DEBUG] Before ofdm.init(): Nsymb=%d Nc=%d Dx=%d Dy=%d density=%d M=%d\n",
-			ofdm.Nsymb, ofdm.Nc, ofdm.pilot_configurator.Dx, ofdm.pilot_configurator.Dy,
-			ofdm.pilot_configurator.pilot_density, M);
-		fflush(stdout);
-		ofdm.init();
-		printf("[PHY-DEBUG] After ofdm.init(): nPilots=%d nData=%d ofdm_frame=%p\n",
-			ofdm.pilot_configurator.nPilots, ofdm.pilot_configurator.nData,
-			(void*)ofdm.ofdm_frame);
-		// Verify PILOT count directly in ofdm_frame
-		int verify_pilots = 0;
-		for(int i = 0; i < ofdm.Nsymb * ofdm.Nc; i++)
-			if(ofdm.ofdm_frame[i].type == PILOT) verify_pilots++;
-		printf("[PHY-DEBUG] Direct pilot count in ofdm_frame: %d\n", verify_pilots);
-		fflush(stdout);
-		reinit_subsystems.ofdm=NO;
+		filters[i]->sampling_frequency=this->sampling_frequency;
+		filters[i]->design();
 	}
 
-	if(reinit_subsystems.ldpc==YES)
+	if(M == MOD_MFSK)
 	{
-		ldpc.init();
-		reinit_subsystems.ldpc=NO;
+		// MFSK: nData = Nsymb (no pilots)
+		// Effective M = 2^(nBits*nStreams) so that nData*log2(M_eff) = N_MAX
+		int M_eff = 1 << mfsk->bits_per_symbol();
+		data_container->set_size(ofdm->Nsymb, ofdm->Nc, M_eff, ofdm->Nfft, ofdm->Nfft*(1+ofdm->gi), ofdm->Nsymb, ofdm->preamble_configurator.Nsymb, frequency_interpolation_rate);
 	}
-	calculate_parameters();
-
-	if(reinit_subsystems.ofdm_FIR_rx_data==YES)
+	else
 	{
-		ofdm.FIR_rx_data.sampling_frequency=this->sampling_frequency;
-		ofdm.FIR_rx_data.design();
-		reinit_subsystems.ofdm_FIR_rx_data=NO;
+		data_container->set_size(ofdm->pilot_configurator.nData, ofdm->Nc, M, ofdm->Nfft, ofdm->Nfft*(1+ofdm->gi), ofdm->Nsymb, ofdm->preamble_configurator.Nsymb, frequency_interpolation_rate);
+		psk->set_predefined_constellation(M);
 	}
 
-	if(reinit_subsystems.ofdm_FIR_rx_time_sync==YES)
+	__srandom (bit_energy_dispersal_seed);
+	for(int i=0;i<ldpc->N;i++)
 	{
-		ofdm.FIR_rx_time_sync.sampling_frequency=this->sampling_frequency;
-		ofdm.FIR_rx_time_sync.design();
-		reinit_subsystems.ofdm_FIR_rx_time_sync=NO;
+		data_container->bit_energy_dispersal_sequence[i]=__random()%2;
 	}
+	bit_to_packed_bit(data_container->bit_energy_dispersal_sequence, data_container->bit_energy_dispersal_sequence_packed, ldpc->N);
 
-	if(reinit_subsystems.ofdm_FIR_tx1==YES)
+	if(default_configurations_telecom_system.ofdm_time_sync_Nsymb==AUTO_SELLECT)
 	{
-		ofdm.FIR_tx1.sampling_frequency=this->sampling_frequency;
-		ofdm.FIR_tx1.design();
-		reinit_subsystems.ofdm_FIR_tx1=NO;
+		ofdm->time_sync_Nsymb=ofdm->Nsymb;
 	}
+	context->built=YES;
+}
 
-	if(reinit_subsystems.ofdm_FIR_tx2==YES)
-	{
-		ofdm.FIR_tx2.sampling_frequency=this->sampling_frequency;
-		ofdm.FIR_tx2.design();
-		reinit_subsystems.ofdm_FIR_tx2=NO;
-	}
+// Receiver state of a new configuration: nothing of the previous one carries over. The objects
+// of the configuration itself are in its context.
+void cl_telecom_system::reset_receiver()
+{
+	calculate_parameters();
 
-	if(reinit_subsystems.data_container==YES)
+	if(sync_worker[0].filter.sampling_frequency!=this->sampling_frequency)
 	{
-		if(M == MOD_MFSK)
+		for(int i=0;i<COARSE_FREQ_HYPOTHESES;i++)
 		{
-			// MFSK: nData = Nsymb (no pilots)
-			// Effective M = 2^(nBits*nStreams) so that nData*log2(M_eff) = N_MAX
-			int M_eff = 1 << mfsk.bits_per_symbol();
-			data_container.set_size(ofdm.Nsymb, ofdm.Nc, M_eff, ofdm.Nfft, ofdm.Nfft*(1+ofdm.gi), ofdm.Nsymb, ofdm.preamble_configurator.Nsymb, frequency_interpolation_rate);
+			sync_worker[i].filter.deinit();
+			sync_worker[i].filter.filter_window=ofdm->FIR_rx_time_sync.filter_window;
+			sync_worker[i].filter.filter_transition_bandwidth=ofdm->FIR_rx_time_sync.filter_transition_bandwidth;
+			sync_worker[i].filter.lpf_filter_cut_frequency=ofdm->FIR_rx_time_sync.lpf_filter_cut_frequency;
+			sync_worker[i].filter.hpf_filter_cut_frequency=ofdm->FIR_rx_time_sync.hpf_filter_cut_frequency;
+			sync_worker[i].filter.type=ofdm->FIR_rx_time_sync.type;
+			sync_worker[i].filter.sampling_frequency=this->sampling_frequency;
+			sync_worker[i].filter.design();
 		}
-		else
-		{
-			data_container.set_size(ofdm.pilot_configurator.nData, ofdm.Nc, M, ofdm.Nfft, ofdm.Nfft*(1+ofdm.gi), ofdm.Nsymb, ofdm.preamble_configurator.Nsymb, frequency_interpolation_rate);
-		}
-		reinit_subsystems.data_container=NO;
-	}
-
-	if(reinit_subsystems.pre_equalization_channel==YES && M != MOD_MFSK)
-	{
-		pre_equalization_channel=new struct st_channel_complex[data_container.Nc];
-		get_pre_equalization_channel();
-		reinit_subsystems.pre_equalization_channel=NO;
-	}
-
-	__srandom (bit_energy_dispersal_seed);
-	bit_energy_dispersal_seed = default_configurations_telecom_system.bit_energy_dispersal_seed;
-	for(int i=0;i<ldpc.N;i++)
-	{
-		data_container.bit_energy_dispersal_sequence[i]=__random()%2;
 	}
 
 	receive_stats.iterations_done=-1;
@@ -1978,92 +3051,80 @@ void cl_telecom_system::init()
 	receive_stats.message_decoded=NO;
 	receive_stats.SNR=-99.9;
 	receive_stats.signal_stregth_dbm=-999;
+	receive_stats.harq_combined=NO;
 
-}
+	harq_init();
 
-void cl_telecom_system::deinit()
-{
-	if(reinit_subsystems.data_container==YES)
-	{
-		data_container.deinit();
-	}
-	if(reinit_subsystems.ofdm_FIR_rx_data==YES)
-	{
-		ofdm.FIR_rx_data.deinit();
-	}
-	if(reinit_subsystems.ofdm_FIR_rx_time_sync==YES)
+	// Started once, a configuration switch keeps the threads.
+	int nSync_pool_threads=(nSync_threads<COARSE_FREQ_HYPOTHESES)?nSync_threads:COARSE_FREQ_HYPOTHESES;
+	if(sync_pool.nThreads!=nSync_pool_threads)
 	{
-		ofdm.FIR_rx_time_sync.deinit();
+		sync_pool.init(nSync_pool_threads);
 	}
-	if(reinit_subsystems.ofdm_FIR_tx1==YES)
-	{
-		ofdm.FIR_tx1.deinit();
-	}
-	if(reinit_subsystems.ofdm_FIR_tx2==YES)
-	{
-		ofdm.FIR_tx2.deinit();
-	}
-	if(reinit_subsystems.ldpc==YES)
-	{
-		ldpc.deinit();
-	}
-	if(reinit_subsystems.ofdm==YES)
+}
+
+// Makes the audio capture thread fill the data container of the current context. The newest
+// captured symbols are handed over under the capture mutex, so reception goes on across the switch.
+void cl_telecom_system::publish_phy_context()
+{
+	st_phy_context* previous=capture_context.load();
+	if(previous==context)
 	{
-		ofdm.deinit();
+		return;
 	}
-	if(reinit_subsystems.pre_equalization_channel==YES)
+	MUTEX_LOCK(&capture_prep_mutex);
+	if(previous->built==YES)
 	{
-		if(pre_equalization_channel!=NULL)
-		{
-			delete[] pre_equalization_channel;
-			pre_equalization_channel=NULL;
-		}
+		context->data_container.take_passband_window(&previous->data_container);
 	}
+	capture_context.store(context);
+	MUTEX_UNLOCK(&capture_prep_mutex);
+	rx_stream_valid=NO;
 }
 
 void cl_telecom_system::TX_RAND_process_main()
 {
 	static int is_first_message=YES;
-	for(int i=0;i<data_container.nBits-ldpc.P;i++)
+	for(int i=0;i<data_container->nBits-ldpc->P;i++)
 	{
-		data_container.data_bit[i]=rand()%2;
+		data_container->data_bit[i]=rand()%2;
 	}
 	if(is_first_message==YES)
 	{
-		transmit_bit(data_container.data_bit,data_container.passband_data,FIRST_MESSAGE);
+		transmit_bit(data_container->data_bit,data_container->passband_data,FIRST_MESSAGE);
 		is_first_message=NO;
 	}
 	else
 	{
-		transmit_bit(data_container.data_bit,data_container.passband_data,MIDDLE_MESSAGE);
+		transmit_bit(data_container->data_bit,data_container->passband_data,MIDDLE_MESSAGE);
 	}
-	tx_transfer(data_container.passband_data,data_container.Nofdm*data_container.interpolation_rate*(ofdm.Nsymb+ofdm.preamble_configurator.Nsymb));
+	tx_transfer(data_container->passband_data,data_container->Nofdm*data_container->interpolation_rate*(ofdm->Nsymb+ofdm->preamble_configurator.Nsymb));
 }
 
 void cl_telecom_system::TX_TEST_process_main()
 {
-    int nReal_data = data_container.nBits - ldpc.P;
+    int nReal_data = data_container->nBits - ldpc->P;
     int frame_size = (nReal_data - outer_code_reserved_bits) / 8;
 
     static int counter = 0;
 
     for (int i = 0; i < frame_size; i++)
     {
-        data_container.data_byte[i] = 0; // data_byte is an integer
+        data_container->data_byte[i] = 0; // data_byte is an integer
     }
-    data_container.data_byte[counter % frame_size] = 1;
+    data_container->data_byte[counter % frame_size] = 1;
     counter++;
 
-    transmit_byte(data_container.data_byte, (nReal_data - outer_code_reserved_bits) / 8, data_container.passband_data, SINGLE_MESSAGE);
+    transmit_byte(data_container->data_byte, (nReal_data - outer_code_reserved_bits) / 8, data_container->passband_data, SINGLE_MESSAGE);
 
-    tx_transfer(data_container.passband_data, data_container.Nofdm * data_container.interpolation_rate * (ofdm.Nsymb + ofdm.preamble_configurator.Nsymb));
+    tx_transfer(data_container->passband_data, data_container->Nofdm * data_container->interpolation_rate * (ofdm->Nsymb + ofdm->preamble_configurator.Nsymb));
 
 }
 
 void cl_telecom_system::TX_SHM_process_main(cbuf_handle_t buffer)
 {
     static uint32_t spinner_anim = 0; char spinner[] = ".oOo";
-    int nReal_data = data_container.nBits - ldpc.P;
+    int nReal_data = data_container->nBits - ldpc->P;
     // int frame_size_bits = nReal_data - outer_code_reserved_bits;
     int frame_size = (nReal_data - outer_code_reserved_bits) / 8;
     // int input_buffer_size = 0;
@@ -2080,7 +3141,7 @@ void cl_telecom_system::TX_SHM_process_main(cbuf_handle_t buffer)
 
         for (int i = 0; i < frame_size; i++)
         {
-            data_container.data_byte[i] = data[i];
+            data_container->data_byte[i] = data[i];
         }
     }
     // if there is no data in the buffer, just do nothing
@@ -2090,9 +3151,9 @@ void cl_telecom_system::TX_SHM_process_main(cbuf_handle_t buffer)
 		return;
     }
 
-    transmit_byte(data_container.data_byte, (nReal_data - outer_code_reserved_bits) / 8, data_container.passband_data, SINGLE_MESSAGE);
+    transmit_byte(data_container->data_byte, (nReal_data - outer_code_reserved_bits) / 8, data_container->passband_data, SINGLE_MESSAGE);
 
-    tx_transfer(data_container.passband_data, data_container.Nofdm * data_container.interpolation_rate * (ofdm.Nsymb + ofdm.preamble_configurator.Nsymb));
+    tx_transfer(data_container->passband_data, data_container->Nofdm * data_container->interpolation_rate * (ofdm->Nsymb + ofdm->preamble_configurator.Nsymb));
 
     printf("%c\033[1D", spinner[spinner_anim % 4]); spinner_anim++;
     fflush(stdout);
@@ -2101,30 +3162,30 @@ void cl_telecom_system::TX_SHM_process_main(cbuf_handle_t buffer)
 
 void cl_telecom_system::RX_RAND_process_main()
 {
-	std::complex <double> data_fft[ofdm.pilot_configurator.nData];
+	sample_complex data_fft[ofdm->pilot_configurator.nData];
 	int constellation_plot_counter=0;
 	int constellation_plot_nFrames=1;
-	float contellation[ofdm.pilot_configurator.nData*constellation_plot_nFrames][2]={0};
-    int nReal_data = data_container.nBits - ldpc.P;
+	float contellation[ofdm->pilot_configurator.nData*constellation_plot_nFrames][2]={0};
+    int nReal_data = data_container->nBits - ldpc->P;
     int frame_size = (nReal_data - outer_code_reserved_bits) / 8;
     int out_data[N_MAX];
 
-	int signal_period = data_container.Nofdm * data_container.buffer_Nsymb * data_container.interpolation_rate; // in samples
-	int symbol_period = data_container. Nofdm * data_container.interpolation_rate;
+	int signal_period = data_container->Nofdm * data_container->buffer_Nsymb * data_container->interpolation_rate; // in samples
+	int symbol_period = data_container->Nofdm * data_container->interpolation_rate;
 
-	if(data_container.data_ready == 0)
+	if(data_container->data_ready == 0)
 	{
 		msleep(1);
 		return;
 	}
 
 	MUTEX_LOCK(&capture_prep_mutex);
-	if (data_container.frames_to_read == 0)
+	if (data_container->frames_to_read == 0)
 	{
 
-		memcpy(data_container.ready_to_process_passband_delayed_data, data_container.passband_delayed_data, signal_period * sizeof(double));
+		data_container->snapshot_passband_window();
 
-		st_receive_stats received_message_stats = receive_byte(data_container.ready_to_process_passband_delayed_data, out_data);
+		st_receive_stats received_message_stats = receive_byte(data_container->ready_to_process_passband_delayed_data, out_data);
 
 		if(received_message_stats.message_decoded == YES)
 		{
@@ -2136,30 +3197,30 @@ void cl_telecom_system::RX_RAND_process_main()
 			std::cout << std::endl;
 			std::cout << std::dec;
 			std::cout << " sync_trial=" << receive_stats.sync_trials;
-			std::cout << " time_peak_subsymb_location=" << received_message_stats.delay % (data_container.Nofdm * data_container.interpolation_rate);
-			std::cout << " time_peak_symb_location=" << received_message_stats.delay / (data_container.Nofdm * data_container.interpolation_rate);
+			std::cout << " time_peak_subsymb_location=" << received_message_stats.delay % (data_container->Nofdm * data_container->interpolation_rate);
+			std::cout << " time_peak_symb_location=" << received_message_stats.delay / (data_container->Nofdm * data_container->interpolation_rate);
 			std::cout << " freq_offset=" << receive_stats.freq_offset;
 			std::cout << " SNR=" << receive_stats.SNR << " dB";
 			std::cout << " Signal Strength=" << receive_stats.signal_stregth_dbm << " dBm ";
 			std::cout << std::endl;
 
-			int end_of_current_message = received_message_stats.delay / symbol_period + data_container.Nsymb + data_container.preamble_nSymb;
-			int frames_left_in_buffer = data_container.buffer_Nsymb - end_of_current_message;
+			int end_of_current_message = received_message_stats.delay / symbol_period + data_container->Nsymb + data_container->preamble_nSymb;
+			int frames_left_in_buffer = data_container->buffer_Nsymb - end_of_current_message;
 			if(frames_left_in_buffer < 0)
 				frames_left_in_buffer = 0;
 
-			data_container.frames_to_read = data_container.Nsymb + data_container.preamble_nSymb - frames_left_in_buffer - data_container.nUnder_processing_events;
+			data_container->frames_to_read = data_container->Nsymb + data_container->preamble_nSymb - frames_left_in_buffer - data_container->nUnder_processing_events;
 
-			if(data_container.frames_to_read > (data_container.Nsymb + data_container.preamble_nSymb) || data_container.frames_to_read < 0)
-				data_container.frames_to_read = data_container.Nsymb + data_container.preamble_nSymb - frames_left_in_buffer;
+			if(data_container->frames_to_read > (data_container->Nsymb + data_container->preamble_nSymb) || data_container->frames_to_read < 0)
+				data_container->frames_to_read = data_container->Nsymb + data_container->preamble_nSymb - frames_left_in_buffer;
 
-			receive_stats.delay_of_last_decoded_message += (data_container.Nsymb + data_container.preamble_nSymb - data_container.frames_to_read) * symbol_period;
+			receive_stats.delay_of_last_decoded_message += (data_container->Nsymb + data_container->preamble_nSymb - data_container->frames_to_read) * symbol_period;
 
-			data_container.nUnder_processing_events = 0;
+			data_container->nUnder_processing_events = 0;
 		}
 		else
 		{
-			if(data_container.frames_to_read == 0 && receive_stats.delay_of_last_decoded_message != -1)
+			if(data_container->frames_to_read == 0 && receive_stats.delay_of_last_decoded_message != -1)
 			{
 				receive_stats.delay_of_last_decoded_message -= symbol_period;
 				if(receive_stats.delay_of_last_decoded_message < 0)
@@ -2170,10 +3231,10 @@ void cl_telecom_system::RX_RAND_process_main()
 			//				std::cout<<" Signal Strength="<<receive_stats.signal_stregth_dbm<<" dBm ";
 			//				std::cout<<std::endl;
 		}
-		for(int i=0;i<ofdm.pilot_configurator.nData;i++)
+		for(int i=0;i<ofdm->pilot_configurator.nData;i++)
 		{
-			contellation[constellation_plot_counter*ofdm.pilot_configurator.nData+i][0]=data_fft[i].real();
-			contellation[constellation_plot_counter*ofdm.pilot_configurator.nData+i][1]=data_fft[i].imag();
+			contellation[constellation_plot_counter*ofdm->pilot_configurator.nData+i][0]=data_fft[i].real();
+			contellation[constellation_plot_counter*ofdm->pilot_configurator.nData+i][1]=data_fft[i].imag();
 		}
 
 		constellation_plot_counter++;
@@ -2181,36 +3242,36 @@ void cl_telecom_system::RX_RAND_process_main()
 		if(constellation_plot_counter==constellation_plot_nFrames)
 		{
 			constellation_plot_counter=0;
-			constellation_plot.plot_constellation(&contellation[0][0],ofdm.pilot_configurator.nData*constellation_plot_nFrames);
+			constellation_plot.plot_constellation(&contellation[0][0],ofdm->pilot_configurator.nData*constellation_plot_nFrames);
 		}
 	}
-	data_container.data_ready = 0;
+	data_container->data_ready = 0;
 	MUTEX_UNLOCK(&capture_prep_mutex);
 }
 
 void cl_telecom_system::RX_TEST_process_main()
 {
     int out_data[N_MAX];
-    int nReal_data = data_container.nBits - ldpc.P;
+    int nReal_data = data_container->nBits - ldpc->P;
     int frame_size = (nReal_data - outer_code_reserved_bits) / 8;
-	// int buff_size = data_container.Nofdm * data_container.buffer_Nsymb * data_container.interpolation_rate * 2;
+	// int buff_size = data_container->Nofdm * data_container->buffer_Nsymb * data_container->interpolation_rate * 2;
 
-	int signal_period = data_container.Nofdm * data_container.buffer_Nsymb * data_container.interpolation_rate; // in samples
-	int symbol_period = data_container. Nofdm * data_container.interpolation_rate;
+	int signal_period = data_container->Nofdm * data_container->buffer_Nsymb * data_container->interpolation_rate; // in samples
+	int symbol_period = data_container->Nofdm * data_container->interpolation_rate;
 
-	if(data_container.data_ready == 0)
+	if(data_container->data_ready == 0)
 	{
 		msleep(1);
 		return;
 	}
 
 	MUTEX_LOCK(&capture_prep_mutex);
-	if (data_container.frames_to_read == 0)
+	if (data_container->frames_to_read == 0)
 	{
 
-		memcpy(data_container.ready_to_process_passband_delayed_data, data_container.passband_delayed_data, signal_period * sizeof(double));
+		data_container->snapshot_passband_window();
 
-		st_receive_stats received_message_stats = receive_byte(data_container.ready_to_process_passband_delayed_data, out_data);
+		st_receive_stats received_message_stats = receive_byte(data_container->ready_to_process_passband_delayed_data, out_data);
 
 		if(received_message_stats.message_decoded == YES)
 		{
@@ -2222,30 +3283,30 @@ void cl_telecom_system::RX_TEST_process_main()
 			std::cout << std::endl;
 			std::cout << std::dec;
 			std::cout << " sync_trial=" << receive_stats.sync_trials;
-			std::cout << " time_peak_subsymb_location=" << received_message_stats.delay % (data_container.Nofdm * data_container.interpolation_rate);
-			std::cout << " time_peak_symb_location=" << received_message_stats.delay / (data_container.Nofdm * data_container.interpolation_rate);
+			std::cout << " time_peak_subsymb_location=" << received_message_stats.delay % (data_container->Nofdm * data_container->interpolation_rate);
+			std::cout << " time_peak_symb_location=" << received_message_stats.delay / (data_container->Nofdm * data_container->interpolation_rate);
 			std::cout << " freq_offset=" << receive_stats.freq_offset;
 			std::cout << " SNR=" << receive_stats.SNR << " dB";
 			std::cout << " Signal Strength=" << receive_stats.signal_stregth_dbm << " dBm ";
 			std::cout << std::endl;
 
-			int end_of_current_message = received_message_stats.delay / symbol_period + data_container.Nsymb + data_container.preamble_nSymb;
-			int frames_left_in_buffer = data_container.buffer_Nsymb - end_of_current_message;
+			int end_of_current_message = received_message_stats.delay / symbol_period + data_container->Nsymb + data_container->preamble_nSymb;
+			int frames_left_in_buffer = data_container->buffer_Nsymb - end_of_current_message;
 			if(frames_left_in_buffer < 0)
 				frames_left_in_buffer = 0;
 
-			data_container.frames_to_read = data_container.Nsymb + data_container.preamble_nSymb - frames_left_in_buffer - data_container.nUnder_processing_events;
+			data_container->frames_to_read = data_container->Nsymb + data_container->preamble_nSymb - frames_left_in_buffer - data_container->nUnder_processing_events;
 
-			if(data_container.frames_to_read > (data_container.Nsymb + data_container.preamble_nSymb) || data_container.frames_to_read < 0)
-				data_container.frames_to_read = data_container.Nsymb + data_container.preamble_nSymb - frames_left_in_buffer;
+			if(data_container->frames_to_read > (data_container->Nsymb + data_container->preamble_nSymb) || data_container->frames_to_read < 0)
+				data_container->frames_to_read = data_container->Nsymb + data_container->preamble_nSymb - frames_left_in_buffer;
 
-			receive_stats.delay_of_last_decoded_message += (data_container.Nsymb + data_container.preamble_nSymb - data_container.frames_to_read) * symbol_period;
+			receive_stats.delay_of_last_decoded_message += (data_container->Nsymb + data_container->preamble_nSymb - data_container->frames_to_read) * symbol_period;
 
-			data_container.nUnder_processing_events = 0;
+			data_container->nUnder_processing_events = 0;
 		}
 		else
 		{
-			if(data_container.frames_to_read == 0 && receive_stats.delay_of_last_decoded_message != -1)
+			if(data_container->frames_to_read == 0 && receive_stats.delay_of_last_decoded_message != -1)
 			{
 				receive_stats.delay_of_last_decoded_message -= symbol_period;
 				if(receive_stats.delay_of_last_decoded_message < 0)
@@ -2258,7 +3319,7 @@ void cl_telecom_system::RX_TEST_process_main()
 		}
 
 	}
-	data_container.data_ready = 0;
+	data_container->data_ready = 0;
 	MUTEX_UNLOCK(&capture_prep_mutex);
 }
 
@@ -2267,49 +3328,48 @@ void cl_telecom_system::RX_SHM_process_main(cbuf_handle_t buffer)
 {
     static uint32_t spinner_anim = 0; char spinner[] = ".oOo";
 	int out_data[N_MAX];
-    int nReal_data = data_container.nBits - ldpc.P;
+    int nReal_data = data_container->nBits - ldpc->P;
     int frame_size = (nReal_data - outer_code_reserved_bits) / 8;
 
-	int signal_period = data_container.Nofdm * data_container.buffer_Nsymb * data_container.interpolation_rate; // in samples
-	int symbol_period = data_container.Nofdm * data_container.interpolation_rate;
+	int signal_period = data_container->Nofdm * data_container->buffer_Nsymb * data_container->interpolation_rate; // in samples
+	int symbol_period = data_container->Nofdm * data_container->interpolation_rate;
 
 	// lock
-	if(data_container.data_ready == 0)
+	if(data_container->data_ready == 0)
 	{
 		msleep(1);
 		return;
 	}
 
 	MUTEX_LOCK(&capture_prep_mutex);
-	// Guard: deinit path zeros Nofdm/buffer_Nsymb under this mutex before freeing
-	// buffers. If we see zero, buffers are being freed — skip processing.
-	if(data_container.Nofdm == 0 || data_container.buffer_Nsymb == 0)
+	// Guard: the container has no size before its configuration is first loaded.
+	if(data_container->Nofdm == 0 || data_container->buffer_Nsymb == 0)
 	{
-		data_container.data_ready = 0;
+		data_container->data_ready = 0;
 		MUTEX_UNLOCK(&capture_prep_mutex);
 		return;
 	}
 	// Recompute under mutex for consistency with guard check
-	signal_period = data_container.Nofdm * data_container.buffer_Nsymb * data_container.interpolation_rate;
-	symbol_period = data_container.Nofdm * data_container.interpolation_rate;
-	if (data_container.frames_to_read == 0)
+	signal_period = data_container->Nofdm * data_container->buffer_Nsymb * data_container->interpolation_rate;
+	symbol_period = data_container->Nofdm * data_container->interpolation_rate;
+	if (data_container->frames_to_read == 0)
 	{
 #ifdef MERCURY_GUI_ENABLED
 		// Apply live LDPC iteration limit from GUI
 		int gui_ldpc_max = g_gui_state.ldpc_iterations_max.load();
 		if (gui_ldpc_max >= 5 && gui_ldpc_max <= 50)
-			ldpc.nIteration_max = gui_ldpc_max;
+			ldpc->nIteration_max = gui_ldpc_max;
 #endif
 
-		memcpy(data_container.ready_to_process_passband_delayed_data, data_container.passband_delayed_data, signal_period * sizeof(double));
+		data_container->snapshot_passband_window();
 
 		auto proc_start = std::chrono::steady_clock::now();
-		st_receive_stats received_message_stats = receive_byte(data_container.ready_to_process_passband_delayed_data, out_data);
+		st_receive_stats received_message_stats = receive_byte(data_container->ready_to_process_passband_delayed_data, out_data);
 		auto proc_end = std::chrono::steady_clock::now();
 		double proc_ms = std::chrono::duration<double, std::milli>(proc_end - proc_start).count();
 
 		// Frame period = (preamble + data symbols) in wall clock time
-		double frame_samples = (double)(data_container.Nofdm * (data_container.Nsymb + data_container.preamble_nSymb) * data_container.interpolation_rate);
+		double frame_samples = (double)(data_container->Nofdm * (data_container->Nsymb + data_container->preamble_nSymb) * data_container->interpolation_rate);
 		double frame_ms = (frame_samples / 48000.0) * 1000.0;
 		float load = (frame_ms > 0) ? (float)(proc_ms / frame_ms) : 0.0f;
 
@@ -2349,23 +3409,23 @@ void cl_telecom_system::RX_SHM_process_main(cbuf_handle_t buffer)
 			spinner_anim++;
 			fflush(stdout);
 
-			int end_of_current_message = received_message_stats.delay / symbol_period + data_container.Nsymb + data_container.preamble_nSymb;
-			int frames_left_in_buffer = data_container.buffer_Nsymb - end_of_current_message;
+			int end_of_current_message = received_message_stats.delay / symbol_period + data_container->Nsymb + data_container->preamble_nSymb;
+			int frames_left_in_buffer = data_container->buffer_Nsymb - end_of_current_message;
 			if(frames_left_in_buffer < 0)
 				frames_left_in_buffer = 0;
 
-			data_container.frames_to_read = data_container.Nsymb + data_container.preamble_nSymb - frames_left_in_buffer - data_container.nUnder_processing_events;
+			data_container->frames_to_read = data_container->Nsymb + data_container->preamble_nSymb - frames_left_in_buffer - data_container->nUnder_processing_events;
 
-			if(data_container.frames_to_read > (data_container.Nsymb + data_container.preamble_nSymb) || data_container.frames_to_read < 0)
-				data_container.frames_to_read = data_container.Nsymb + data_container.preamble_nSymb - frames_left_in_buffer;
+			if(data_container->frames_to_read > (data_container->Nsymb + data_container->preamble_nSymb) || data_container->frames_to_read < 0)
+				data_container->frames_to_read = data_container->Nsymb + data_container->preamble_nSymb - frames_left_in_buffer;
 
-			receive_stats.delay_of_last_decoded_message += (data_container.Nsymb + data_container.preamble_nSymb - data_container.frames_to_read) * symbol_period;
+			receive_stats.delay_of_last_decoded_message += (data_container->Nsymb + data_container->preamble_nSymb - data_container->frames_to_read) * symbol_period;
 
-			data_container.nUnder_processing_events = 0;
+			data_container->nUnder_processing_events = 0;
 		}
 		else
 		{
-			if(data_container.frames_to_read == 0 && receive_stats.delay_of_last_decoded_message != -1)
+			if(data_container->frames_to_read == 0 && receive_stats.delay_of_last_decoded_message != -1)
 			{
 				receive_stats.delay_of_last_decoded_message -= symbol_period;
 				if(receive_stats.delay_of_last_decoded_message < 0)
@@ -2385,7 +3445,7 @@ void cl_telecom_system::RX_SHM_process_main(cbuf_handle_t buffer)
 		}
 
 	}
-	data_container.data_ready = 0;
+	data_container->data_ready = 0;
 	MUTEX_UNLOCK(&capture_prep_mutex);
 }
 
@@ -2431,6 +3491,11 @@ void cl_telecom_system::BER_PLOT_baseband_process_main()
 }
 void cl_telecom_system::BER_PLOT_passband_process_main()
 {
+	if(test_estimator_benchmark==YES)
+	{
+		channel_estimator_benchmark();
+		return;
+	}
 	BER_plot.open("BER");
 	BER_plot.reset("BER");
 	// MFSK: sweep channel SNR from -25 to +5 dB in 1 dB steps (VARA claims ~-10 dB for SL1)
@@ -2479,6 +3544,203 @@ void cl_telecom_system::BER_PLOT_passband_process_main()
 	}
 }
 
+// Runs a PLOT_PASSBAND sweep once with each estimator. Both passes start from the same seeds,
+// so they see the same data and noise. The frame time covers the whole TX/channel/RX chain; the
+// estimator time is the estimator alone, run again on the last demodulated frame of the point.
+void cl_telecom_system::channel_estimator_benchmark()
+{
+	if(M == MOD_MFSK)
+	{
+		std::cout<<"Channel estimator benchmark not supported for MFSK configs."<<std::endl;
+		return;
+	}
+	BER_plot.open("BER");
+	BER_plot.reset("BER");
+	// 1 dB steps up to where the high rate configurations decode.
+	int nPoints=25;
+	int nFrames_per_point=100;
+	int nEstimator_runs=100;
+	int estimator[2]={LEAST_SQUARE,CHANNEL_EST_MMSE};
+	float data_plot[2][nPoints][2];
+	double estimator_us[2]={0,0};
+	int initial_estimator=ofdm->channel_estimator;
+	output_power_Watt=1;
+	float start_location=-10.0f;
+
+	std::cout<<"EsN0;BER_LS;BER_MMSE;FER_LS;FER_MMSE;ms_per_frame_LS;ms_per_frame_MMSE;us_estimator_LS;us_estimator_MMSE"<<std::endl;
+	for(int ind=0;ind<nPoints;ind++)
+	{
+		float EsN0=(float)(ind+start_location);
+		cl_error_rate error_rate[2];
+		double frame_ms[2];
+		double point_estimator_us[2];
+		for(int e=0;e<2;e++)
+		{
+			ofdm->set_channel_estimator(estimator[e]);
+			__srandom(ind+1);
+			awgn_channel.set_seed(ind+1);
+			std::clock_t cpu_start=std::clock();
+			error_rate[e]=passband_test_EsN0(EsN0,nFrames_per_point);
+			frame_ms[e]=1000.0*(std::clock()-cpu_start)/CLOCKS_PER_SEC/nFrames_per_point;
+
+			cpu_start=std::clock();
+			for(int i=0;i<nEstimator_runs;i++)
+			{
+				if(estimator[e]==CHANNEL_EST_MMSE)
+				{
+					ofdm->MMSE_channel_estimator(data_container->ofdm_symbol_demodulated_data);
+				}
+				else
+				{
+					ofdm->LS_channel_estimator(data_container->ofdm_symbol_demodulated_data);
+				}
+			}
+			point_estimator_us[e]=1e6*(std::clock()-cpu_start)/CLOCKS_PER_SEC/nEstimator_runs;
+			estimator_us[e]+=point_estimator_us[e];
+			data_plot[e][ind][0]=EsN0;
+			data_plot[e][ind][1]=error_rate[e].BER;
+		}
+		std::cout<<EsN0<<";"<<error_rate[0].BER<<";"<<error_rate[1].BER<<";"<<error_rate[0].FER<<";"<<error_rate[1].FER
+				<<";"<<frame_ms[0]<<";"<<frame_ms[1]<<";"<<point_estimator_us[0]<<";"<<point_estimator_us[1]<<std::endl;
+	}
+	std::cout<<"Estimator CPU time per frame: LS "<<estimator_us[0]/nPoints<<" us, MMSE "<<estimator_us[1]/nPoints<<" us"<<std::endl;
+
+	ofdm->set_channel_estimator(initial_estimator);
+	BER_plot.plot("BER LS",&data_plot[0][0][0],nPoints,"BER MMSE",&data_plot[1][0][0],nPoints);
+	BER_plot.close();
+}
+
+// Chase combining against the receiver without it. Every keyed frame is sent twice over passband
+// AWGN, once with no soft buffers and once with the configured ones, from the same seeds. A frame
+// decoded without HARQ has to be decoded with it, to the same bytes, any other decode has to be a
+// HARQ recovery, and no decoded frame may differ from the data sent. Returns YES when it holds.
+int cl_telecom_system::harq_check()
+{
+	if(M == MOD_MFSK || outer_code!=CRC16_MODBUS_RTU)
+	{
+		std::cout<<"HARQ check needs an OFDM config with the CRC16 outer code."<<std::endl;
+		return NO;
+	}
+	// 1 dB steps over the sync and decoding thresholds of all the OFDM configurations.
+	int nPoints=26;
+	int nFrames_per_point=20;
+	int nTransmissions=2;
+	float start_location=-5.0f;
+	float step_size=1.0f;
+	int initial_operation_mode=operation_mode;
+	int initial_harq_nBuffers=harq_nBuffers;
+	int nReal_data=data_container->nBits-ldpc->P;
+	int nBytes=(nReal_data-outer_code_reserved_bits)/8;
+	int delay=(data_container->Nfft==1024)?100:50;
+	int nItems=(data_container->Nofdm*(data_container->Nsymb+data_container->preamble_nSymb))*frequency_interpolation_rate;
+	int nDelay=((data_container->preamble_nSymb+2)*data_container->Nofdm+delay)*frequency_interpolation_rate;
+	float sigma;
+
+	int* direct_decoded=new int[nFrames_per_point*nTransmissions];
+	int* direct_bytes=new int[nFrames_per_point*nTransmissions*nBytes];
+	if(direct_decoded==NULL || direct_bytes==NULL)
+	{
+		std::cout<<"Memory allocation error"<<std::endl;
+		exit(2);
+	}
+
+	operation_mode=ARQ_MODE;
+	int nMismatches_total=0;
+	int nFalse_accepts_total=0;
+	std::cout<<"EsN0;frames;decoded_without_HARQ;decoded_with_HARQ;HARQ_recovered;mismatches;false_accepts"<<std::endl;
+	for(int ind=0;ind<nPoints;ind++)
+	{
+		float EsN0=(float)(ind*step_size+start_location);
+		sigma=1.0f/sqrt(pow(10.0f,(EsN0/10.0f)));
+		int nDecoded[2]={0,0};
+		int nRecovered=0;
+		int nMismatches=0;
+		int nFalse_accepts=0;
+		for(int pass=0;pass<2;pass++)
+		{
+			harq_nBuffers=(pass==0)?0:initial_harq_nBuffers;
+			harq_init();
+			__srandom(ind+1);
+			awgn_channel.set_seed(ind+1);
+			for(int f=0;f<nFrames_per_point;f++)
+			{
+				for(int i=0;i<nBytes;i++)
+				{
+					data_container->data_byte[i]=__random()%256;
+				}
+				for(int t=0;t<nTransmissions;t++)
+				{
+					int r=f*nTransmissions+t;
+					// Keyed as the ARQ receiver would: by the message it waits for.
+					harq_rx_key=f;
+					this->transmit_byte(data_container->data_byte,nBytes,data_container->passband_data,SINGLE_MESSAGE);
+					awgn_channel.apply_with_delay(data_container->passband_data,data_container->passband_delayed_data,sigma,nItems,nDelay);
+					// The sync fallback to the last decoded frame would let a HARQ recovery change the
+					// receptions after it, every reception starts from the same state in both passes.
+					receive_stats.delay_of_last_decoded_message=-1;
+					receive_stats.freq_offset_of_last_decoded_message=0;
+					st_receive_stats stats=this->receive_byte(data_container->passband_delayed_data,data_container->hd_decoded_data_byte);
+
+					int decoded=(stats.message_decoded==YES);
+					int* out=data_container->hd_decoded_data_byte;
+					for(int i=0;decoded && i<nBytes;i++)
+					{
+						if(out[i]!=data_container->data_byte[i])
+						{
+							nFalse_accepts++;
+							decoded=NO;
+						}
+					}
+					nDecoded[pass]+=decoded;
+					if(decoded==YES)
+					{
+						harq_release(f);
+					}
+					if(pass==0)
+					{
+						direct_decoded[r]=decoded;
+						memcpy(&direct_bytes[r*nBytes],out,nBytes*sizeof(int));
+					}
+					else if(direct_decoded[r]==YES)
+					{
+						if(decoded==NO || stats.harq_combined==YES || memcmp(&direct_bytes[r*nBytes],out,nBytes*sizeof(int))!=0)
+						{
+							nMismatches++;
+						}
+					}
+					else if(decoded==YES)
+					{
+						if(stats.harq_combined==YES)
+						{
+							nRecovered++;
+						}
+						else
+						{
+							nMismatches++;
+						}
+					}
+				}
+			}
+		}
+		nMismatches_total+=nMismatches;
+		nFalse_accepts_total+=nFalse_accepts;
+		std::cout<<EsN0<<";"<<nFrames_per_point*nTransmissions<<";"<<nDecoded[0]<<";"<<nDecoded[1]<<";"<<nRecovered
+				<<";"<<nMismatches<<";"<<nFalse_accepts<<std::endl;
+	}
+
+	operation_mode=initial_operation_mode;
+	harq_nBuffers=initial_harq_nBuffers;
+	harq_rx_key=HARQ_NO_KEY;
+	harq_init();
+	harq_flush();
+	delete[] direct_decoded;
+	delete[] direct_bytes;
+
+	int passed=(nMismatches_total==0 && nFalse_accepts_total==0)?YES:NO;
+	std::cout<<"HARQ check: "<<(passed==YES?"OK":"FAILED")<<" ("<<nMismatches_total<<" mismatches, "<<nFalse_accepts_total<<" false accepts)"<<std::endl;
+	return passed;
+}
+
 void cl_telecom_system::load_configuration()
 {
 	this->load_configuration(default_configurations_telecom_system.init_configuration);
@@ -2644,31 +3906,6 @@ void cl_telecom_system::load_configuration(int configuration)
 		ofdm_channel_estimator=LEAST_SQUARE;
 	}
 
-	if(_modulation==MOD_BPSK || _modulation==MOD_QPSK || _modulation==MOD_8PSK)
-	{
-		ofdm.channel_estimator_amplitude_restoration=YES;
-	}
-	else
-	{
-		ofdm.channel_estimator_amplitude_restoration=NO;
-	}
-
-	if(current_configuration!=CONFIG_NONE)
-	{
-		reinit_subsystems.microphone=NO;
-		reinit_subsystems.speaker=NO;
-		reinit_subsystems.telecom_system=NO;
-		reinit_subsystems.data_container=NO;
-		reinit_subsystems.ofdm_FIR_rx_data=NO;
-		reinit_subsystems.ofdm_FIR_rx_time_sync=NO;
-		reinit_subsystems.ofdm_FIR_tx1=NO;
-		reinit_subsystems.ofdm_FIR_tx2=NO;
-		reinit_subsystems.ofdm=NO;
-		reinit_subsystems.ldpc=NO;
-		reinit_subsystems.psk=NO;
-		reinit_subsystems.pre_equalization_channel=NO;
-	}
-
 	if(current_configuration==CONFIG_NONE)
 	{
 		last_configuration=configuration;
@@ -2680,145 +3917,16 @@ void cl_telecom_system::load_configuration(int configuration)
 		current_configuration=configuration;
 	}
 
-	if(_modulation!=M || ofdm_preamble_configurator_Nsymb!=ofdm.preamble_configurator.Nsymb)
-	{
-		reinit_subsystems.microphone=YES;
-		reinit_subsystems.speaker=YES;
-		reinit_subsystems.telecom_system=YES;
-		reinit_subsystems.data_container=YES;
-		reinit_subsystems.ofdm=YES;
-		reinit_subsystems.psk=YES;
-		reinit_subsystems.pre_equalization_channel=YES;
-	}
-
-	// MFSK: different ROBUST configs may change M or nStreams, need full reinit
-	if(_modulation==MOD_MFSK && M==MOD_MFSK)
-	{
-		int new_mfsk_M, new_nStreams;
-		if(configuration == ROBUST_0) { new_mfsk_M = 32; new_nStreams = 1; }
-		else { new_mfsk_M = 16; new_nStreams = 2; } // ROBUST_1, ROBUST_2
-		if(new_mfsk_M != mfsk.M || new_nStreams != mfsk.nStreams)
-		{
-			reinit_subsystems.telecom_system=YES;
-			reinit_subsystems.data_container=YES;
-			reinit_subsystems.ofdm=YES;
-			reinit_subsystems.psk=YES;
-		}
-	}
-
-	if(_ldpc_rate!=ldpc.rate)
-	{
-		reinit_subsystems.telecom_system=YES;
-		reinit_subsystems.ldpc=YES;
-	}
-
-	if(reinit_subsystems.microphone==YES)
-	{
-        // why do we need this?
-		// microphone.deinit();
-	}
-	if(reinit_subsystems.speaker==YES)
-	{
-        // why do we need this?
-		// speaker.deinit();
-	}
-
-	if(reinit_subsystems.psk==YES)
-	{
-		psk.deinit();
-	}
-	if(reinit_subsystems.telecom_system==YES)
-	{
-		printf("[PHY-REINIT] About to deinit telecom_system (config %d -> %d)\n", last_configuration, configuration);
-		fflush(stdout);
-
-		// Zero audio-facing buffer parameters under the mutex BEFORE deinit
-		// frees passband_delayed_data.  The audio capture_prep thread re-reads
-		// these inside the same mutex, so it will see the zeroed values and
-		// skip the buffer access, preventing use-after-free.
-		// Only zero when data_container will actually be deinitialized and
-		// re-allocated by set_size(). Otherwise (e.g., LDPC-only reinit where
-		// buffers stay intact), Nofdm must stay valid for passband calculations.
-		if(reinit_subsystems.data_container==YES)
-		{
-			MUTEX_LOCK(&capture_prep_mutex);
-			data_container.Nofdm = 0;
-			data_container.buffer_Nsymb = 0;
-			data_container.data_ready = 0;
-			MUTEX_UNLOCK(&capture_prep_mutex);
-		}
-
-		printf("[PHY-REINIT] Mutex zeroed, calling deinit...\n");
-		fflush(stdout);
-		this->deinit();
-		printf("[PHY-REINIT] deinit complete (tid=%lu)\n", (unsigned long)pthread_self());
-		fflush(stdout);
-	}
-
-	printf("[PHY-REINIT] post-deinit A (tid=%lu)\n", (unsigned long)pthread_self());
-	fflush(stdout);
-	printf("[PHY-M] _modulation=%d M_before=%.0f MOD_BPSK=%d MOD_MFSK=%d\n",
-		_modulation, M, MOD_BPSK, MOD_MFSK);
-	fflush(stdout);
 	M=_modulation;
-	printf("[PHY-M] M_after=%.0f\n", M);
-	fflush(stdout);
-	ldpc.rate=_ldpc_rate;
-	ofdm.preamble_configurator.Nsymb=ofdm_preamble_configurator_Nsymb;
-	ofdm.channel_estimator=ofdm_channel_estimator;
 
 	awgn_channel.set_seed(rand());
 
-	ofdm.Nc=default_configurations_telecom_system.ofdm_Nc;
-	ofdm.Nfft=default_configurations_telecom_system.ofdm_Nfft;
-	ofdm.gi=default_configurations_telecom_system.ofdm_gi;
-	ofdm.Nsymb=default_configurations_telecom_system.ofdm_Nsymb;
-
-	ofdm.pilot_configurator.Dx=default_configurations_telecom_system.ofdm_pilot_configurator_Dx;
-	ofdm.pilot_configurator.Dy=default_configurations_telecom_system.ofdm_pilot_configurator_Dy;
-	ofdm.pilot_configurator.first_row=default_configurations_telecom_system.ofdm_pilot_configurator_first_row;
-	ofdm.pilot_configurator.last_row=default_configurations_telecom_system.ofdm_pilot_configurator_last_row;
-	ofdm.pilot_configurator.first_col=default_configurations_telecom_system.ofdm_pilot_configurator_first_col;
-	ofdm.pilot_configurator.second_col=default_configurations_telecom_system.ofdm_pilot_configurator_second_col;
-	ofdm.pilot_configurator.last_col=default_configurations_telecom_system.ofdm_pilot_configurator_last_col;
-	ofdm.pilot_configurator.boost=default_configurations_telecom_system.ofdm_pilot_configurator_pilot_boost;
-	ofdm.pilot_configurator.seed=default_configurations_telecom_system.ofdm_pilot_configurator_seed;
-	ofdm.pilot_configurator.pilot_density=default_configurations_telecom_system.ofdm_pilot_density;
-
-	ofdm.preamble_configurator.nIdentical_sections=default_configurations_telecom_system.ofdm_preamble_configurator_nIdentical_sections;
-	ofdm.preamble_configurator.modulation=default_configurations_telecom_system.ofdm_preamble_configurator_modulation;
-	ofdm.preamble_configurator.boost=default_configurations_telecom_system.ofdm_preamble_configurator_boost;
-	ofdm.preamble_configurator.seed=default_configurations_telecom_system.ofdm_preamble_configurator_seed;
-
-	ofdm.freq_offset_ignore_limit=default_configurations_telecom_system.ofdm_freq_offset_ignore_limit;
-	ofdm.start_shift=default_configurations_telecom_system.ofdm_start_shift;
-
-	ofdm.preamble_papr_cut=default_configurations_telecom_system.ofdm_preamble_papr_cut;
-	ofdm.data_papr_cut=default_configurations_telecom_system.ofdm_data_papr_cut;
-
-	ofdm.LS_window_width=default_configurations_telecom_system.ofdm_LS_window_width;
-	ofdm.LS_window_hight=default_configurations_telecom_system.ofdm_LS_window_hight;
-
-	if(ofdm.LS_window_width%2==0)
-	{
-		ofdm.LS_window_width++;
-	}
-	if(ofdm.LS_window_hight%2==0)
-	{
-		ofdm.LS_window_hight++;
-	}
-
-	bit_energy_dispersal_seed=default_configurations_telecom_system.bit_energy_dispersal_seed;
-
-	ldpc.standard=default_configurations_telecom_system.ldpc_standard;
-	ldpc.framesize=default_configurations_telecom_system.ldpc_framesize;
-
-	ldpc.decoding_algorithm=default_configurations_telecom_system.ldpc_decoding_algorithm;
-	ldpc.GBF_eta=default_configurations_telecom_system.ldpc_GBF_eta;
-	ldpc.nIteration_max=default_configurations_telecom_system.ldpc_nIteration_max;
-	ldpc.print_nIteration=default_configurations_telecom_system.ldpc_print_nIteration;
+	// The decoder thread of the last trial still uses the objects of the old context.
+	quiesce_rx_decoder();
 
 	outer_code=default_configurations_telecom_system.outer_code;
+	harq_nBuffers=default_configurations_telecom_system.harq_nBuffers;
+	ir_first_fraction=default_configurations_telecom_system.ir_first_fraction;
 
 	if(outer_code==CRC16_MODBUS_RTU)
 	{
@@ -2842,112 +3950,44 @@ void cl_telecom_system::load_configuration(int configuration)
 	carrier_frequency=default_configurations_telecom_system.carrier_frequency;
 	output_power_Watt=default_configurations_telecom_system.output_power_Watt;
 
-	ofdm.FIR_rx_data.filter_window=default_configurations_telecom_system.ofdm_FIR_rx_data_filter_window;
-	ofdm.FIR_rx_data.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_rx_data_filter_transition_bandwidth;
-	ofdm.FIR_rx_data.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_rx_data_lpf_filter_cut_frequency;
-	ofdm.FIR_rx_data.type=default_configurations_telecom_system.ofdm_FIR_rx_data_filter_type;
-
-	ofdm.FIR_rx_time_sync.filter_window=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_filter_window;
-	ofdm.FIR_rx_time_sync.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_filter_transition_bandwidth;
-	ofdm.FIR_rx_time_sync.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_lpf_filter_cut_frequency;
-	ofdm.FIR_rx_time_sync.type=default_configurations_telecom_system.ofdm_FIR_rx_time_sync_filter_type;
-
-
-	ofdm.FIR_tx1.filter_window=default_configurations_telecom_system.ofdm_FIR_tx1_filter_window;
-	ofdm.FIR_tx1.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_tx1_filter_transition_bandwidth;
-	ofdm.FIR_tx1.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx1_lpf_filter_cut_frequency;
-	ofdm.FIR_tx1.hpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx1_hpf_filter_cut_frequency;
-	ofdm.FIR_tx1.type=default_configurations_telecom_system.ofdm_FIR_tx1_filter_type;
-
-	ofdm.FIR_tx2.filter_window=default_configurations_telecom_system.ofdm_FIR_tx2_filter_window;
-	ofdm.FIR_tx2.filter_transition_bandwidth=default_configurations_telecom_system.ofdm_FIR_tx2_filter_transition_bandwidth;
-	ofdm.FIR_tx2.lpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx2_lpf_filter_cut_frequency;
-	ofdm.FIR_tx2.hpf_filter_cut_frequency=default_configurations_telecom_system.ofdm_FIR_tx2_hpf_filter_cut_frequency;
-	ofdm.FIR_tx2.type=default_configurations_telecom_system.ofdm_FIR_tx2_filter_type;
-
-
 	constellation_plot.folder=default_configurations_telecom_system.plot_folder;
 	BER_plot.folder=default_configurations_telecom_system.plot_folder;
 	constellation_plot.plot_active=default_configurations_telecom_system.plot_plot_active;
 	BER_plot.plot_active=default_configurations_telecom_system.plot_plot_active;
 
-
-	if(reinit_subsystems.psk==YES)
-	{
-		if(M == MOD_MFSK)
-		{
-			int mfsk_M, mfsk_nStreams;
-			if(current_configuration == ROBUST_0) { mfsk_M = 32; mfsk_nStreams = 1; }
-			else { mfsk_M = 16; mfsk_nStreams = 2; } // ROBUST_1, ROBUST_2: 2x parallel 16-MFSK
-			mfsk.init(mfsk_M, ofdm.Nc, mfsk_nStreams);
-		}
-		else
-		{
-			psk.set_predefined_constellation(M);
-		}
-		reinit_subsystems.psk=NO;
-	}
-	if(reinit_subsystems.telecom_system==YES)
+	// A configuration loaded before only swaps the pointers, its objects are kept as built.
+	context=&phy_context[is_robust_config(configuration)?NUMBER_OF_CONFIGS+configuration-ROBUST_0:configuration];
+	data_container=&context->data_container;
+	ofdm=&context->ofdm;
+	psk=&context->psk;
+	mfsk=&context->mfsk;
+	ldpc=&context->ldpc;
+	if(context->built==NO)
 	{
-		printf("[PHY-REINIT] Calling init...\n");
-		fflush(stdout);
-		this->init();
-		printf("[PHY-REINIT] init complete\n");
-		fflush(stdout);
-		reinit_subsystems.telecom_system=NO;
-	}
+		bit_energy_dispersal_seed=default_configurations_telecom_system.bit_energy_dispersal_seed;
 
-	// Re-init MFSK now that ofdm.Nc is finalized (was AUTO_SELLECT during mfsk.init above)
-	// This recalculates stream_offsets with the correct Nc value
-	if(M == MOD_MFSK)
-	{
-		int mfsk_M, mfsk_nStreams;
-		if(current_configuration == ROBUST_0) { mfsk_M = 32; mfsk_nStreams = 1; }
-		else { mfsk_M = 16; mfsk_nStreams = 2; } // ROBUST_1, ROBUST_2
-		mfsk.init(mfsk_M, ofdm.Nc, mfsk_nStreams);
-	}
+		ldpc->standard=default_configurations_telecom_system.ldpc_standard;
+		ldpc->framesize=default_configurations_telecom_system.ldpc_framesize;
+		ldpc->rate=_ldpc_rate;
 
-	bit_interleaver_block_size=data_container.nBits/10;
-	time_freq_interleaver_block_size=data_container.nData/10;
+		ldpc->decoding_algorithm=default_configurations_telecom_system.ldpc_decoding_algorithm;
+		ldpc->GBF_eta=default_configurations_telecom_system.ldpc_GBF_eta;
+		ldpc->MS_alpha=default_configurations_telecom_system.ldpc_MS_alpha;
+		ldpc->MS_beta=default_configurations_telecom_system.ldpc_MS_beta;
+		ldpc->nIteration_max=default_configurations_telecom_system.ldpc_nIteration_max;
+		ldpc->nThreads=default_configurations_telecom_system.ldpc_nThreads;
+		ldpc->print_nIteration=default_configurations_telecom_system.ldpc_print_nIteration;
+		ldpc->init();
 
-	if(default_configurations_telecom_system.ofdm_time_sync_Nsymb==AUTO_SELLECT)
-	{
-		ofdm.time_sync_Nsymb=ofdm.Nsymb;
+		build_phy_context(configuration, ofdm_preamble_configurator_Nsymb, ofdm_channel_estimator);
 	}
 
-	if(reinit_subsystems.microphone==YES)
-	{
-        // TODO: Do we need this?
-#if 0
-		microphone.baudrate = sampling_frequency;
-		microphone.nbuffer_Samples = 2 * ofdm.Nfft*(1+ofdm.gi)*frequency_interpolation_rate*(ofdm.Nsymb+ofdm.preamble_configurator.Nsymb);
-		microphone.frames_per_period = ofdm.Nfft*(1+ofdm.gi)*frequency_interpolation_rate;
-		if(operation_mode != BER_PLOT_baseband &&
-           operation_mode != BER_PLOT_passband &&
-           operation_mode != TX_TEST)
-		{
-			microphone.init();
-		}
-		reinit_subsystems.microphone=NO;
-#endif
-	}
+	bit_interleaver_block_size=data_container->nBits/10;
+	time_freq_interleaver_block_size=data_container->nData/10;
 
-	if(reinit_subsystems.speaker==YES)
-	{
-        // TODO: Do we need this?
-#if 0
-		speaker.baudrate = sampling_frequency;
-		speaker.nbuffer_Samples = 2 * ofdm.Nfft*(1+ofdm.gi)*frequency_interpolation_rate*(ofdm.Nsymb+ofdm.preamble_configurator.Nsymb);
-		speaker.frames_per_period = ofdm.Nfft*(1+ofdm.gi)*frequency_interpolation_rate;
-		if(operation_mode != BER_PLOT_baseband &&
-           operation_mode != BER_PLOT_passband &&
-           operation_mode != RX_TEST)
-		{
-			speaker.init();
-		}
-		reinit_subsystems.speaker=NO;
-#endif
-	}
+	reset_receiver();
+	load_phy_context();
+	publish_phy_context();
 
 	// Invalidate cached sync state from previous config - frame timing differs
 	// between configs (preamble_nSymb varies 1-4), so old values would be wrong
@@ -2956,21 +3996,21 @@ void cl_telecom_system::load_configuration(int configuration)
 	receive_stats.mfsk_search_raw = 0;
 
 	printf("[PHY] Config %d active: M=%.0f LDPC_rate=%.3f BW=%.0fHz Nc=%d Nsymb=%d nBits=%d\n",
-		current_configuration, M, ldpc.rate, bandwidth,
-		data_container.Nc, data_container.Nsymb, data_container.nBits);
+		current_configuration, M, ldpc->rate, bandwidth,
+		data_container->Nc, data_container->Nsymb, data_container->nBits);
 	if(M == MOD_MFSK)
 	{
-		double _mfsk_boost = sqrt((double)data_container.Nc / mfsk.nStreams) * pow(10.0, -2.0 / 20.0);
-		printf("[PHY] MFSK: M=%d nStreams=%d bps=%d offsets=[", mfsk.M, mfsk.nStreams, mfsk.bits_per_symbol());
-		for(int i = 0; i < mfsk.nStreams; i++) printf("%s%d", i?",":"", mfsk.stream_offsets[i]);
-		printf("] Nc=%d boost=%.1fdB\n", mfsk.Nc, 20.0*log10(_mfsk_boost));
+		double _mfsk_boost = sqrt((double)data_container->Nc / mfsk->nStreams) * pow(10.0, -2.0 / 20.0);
+		printf("[PHY] MFSK: M=%d nStreams=%d bps=%d offsets=[", mfsk->M, mfsk->nStreams, mfsk->bits_per_symbol());
+		for(int i = 0; i < mfsk->nStreams; i++) printf("%s%d", i?",":"", mfsk->stream_offsets[i]);
+		printf("] Nc=%d boost=%.1fdB\n", mfsk->Nc, 20.0*log10(_mfsk_boost));
 
 		// Set up short control frame parameters for MFSK modes.
 		// BER testing determined safe ctrl_nBits values (same waterfall as full frame):
 		//   ROBUST_0 (rate 1/16, 32-MFSK×1): 1200 bits, waterfall -13 dB
 		//   ROBUST_1 (rate 1/16, 16-MFSK×2): 1400 bits, waterfall -11 dB
 		//   ROBUST_2 (rate 1/4): no puncturing (rate 1/4 can't tolerate it)
-		int bps = mfsk.bits_per_symbol();
+		int bps = mfsk->bits_per_symbol();
 		if(current_configuration == ROBUST_0)
 		{
 			ctrl_nBits = 1200;
@@ -2990,7 +4030,7 @@ void cl_telecom_system::load_configuration(int configuration)
 
 		if(ctrl_nBits > 0)
 			printf("[PHY] Ctrl frame: nBits=%d nsymb=%d (%.0f%% of data)\n",
-				ctrl_nBits, ctrl_nsymb, 100.0 * ctrl_nsymb / data_container.Nsymb);
+				ctrl_nBits, ctrl_nsymb, 100.0 * ctrl_nsymb / data_container->Nsymb);
 
 	}
 	else
@@ -3000,12 +4040,16 @@ void cl_telecom_system::load_configuration(int configuration)
 		mfsk_ctrl_mode = false;
 	}
 
+	update_ir_nsymb();
+	if(ir_nsymb > 0)
+		printf("[PHY] IR: first part %d of %d symbols\n", ir_nsymb, data_container->Nsymb);
+
 	// Universal ACK pattern: dedicated ack_mfsk with fixed M=16, nStreams=1 for ALL modes.
 	// Config-independent: both sides always agree on ACK tone parameters,
 	// so no config switching needed for ACK pattern TX/RX.
-	ack_mfsk.init(16, data_container.Nc, 1);  // M=16, Nc=50, 1 stream centered in band
+	ack_mfsk.init(16, data_container->Nc, 1);  // M=16, Nc=50, 1 stream centered in band
 
-	ack_pattern_passband_samples = cl_mfsk::ACK_PATTERN_NSYMB * data_container.Nofdm * frequency_interpolation_rate;
+	ack_pattern_passband_samples = cl_mfsk::ACK_PATTERN_NSYMB * data_container->Nofdm * frequency_interpolation_rate;
 
 	// Per-mode detection threshold (all using ack_mfsk: M=16, nStreams=1):
 	// ROBUST_0 (-13 dB): low SNR, need conservative threshold
@@ -3108,36 +4152,36 @@ char cl_telecom_system::get_configuration(double SNR)
 void cl_telecom_system::get_pre_equalization_channel()
 {
 	int nTries=1000;
-	for(int i=0;i<data_container.Nc;i++)
+	for(int i=0;i<data_container->Nc;i++)
 	{
 		pre_equalization_channel[i].value=0;
 	}
 
 	for(int j=0;j<nTries;j++)
 	{
-		for(int i=0;i<data_container.Nc*log2(data_container.M);i++)
+		for(int i=0;i<data_container->Nc*log2(data_container->M);i++)
 		{
-			data_container.bit_interleaved_data[i]=__random()%2;
+			data_container->bit_interleaved_data[i]=__random()%2;
 		}
-		psk.mod(data_container.bit_interleaved_data,data_container.Nc*log2(data_container.M),data_container.modulated_data);
+		psk->mod(data_container->bit_interleaved_data,data_container->Nc*log2(data_container->M),data_container->modulated_data);
 
-		ofdm.symbol_mod(data_container.modulated_data,data_container.preamble_symbol_modulated_data);
-		ofdm.passband_start_sample=0;
-		ofdm.baseband_to_passband(data_container.preamble_symbol_modulated_data,data_container.Nofdm,data_container.passband_data_tx,sampling_frequency,carrier_frequency,carrier_amplitude,frequency_interpolation_rate);
+		ofdm->symbol_mod(data_container->modulated_data,data_container->preamble_symbol_modulated_data);
+		ofdm->passband_nco.reset();
+		ofdm->baseband_to_passband(data_container->preamble_symbol_modulated_data,data_container->Nofdm,data_container->passband_data_tx,sampling_frequency,carrier_frequency,carrier_amplitude,frequency_interpolation_rate);
 
-		ofdm.FIR_tx1.apply(data_container.passband_data_tx,data_container.passband_data_tx_filtered_fir_1,data_container.Nofdm*frequency_interpolation_rate);
-		ofdm.FIR_tx2.apply(data_container.passband_data_tx_filtered_fir_1,data_container.passband_data_tx_filtered_fir_2,data_container.Nofdm*frequency_interpolation_rate);
+		ofdm->FIR_tx1.apply(data_container->passband_data_tx,data_container->passband_data_tx_filtered_fir_1,data_container->Nofdm*frequency_interpolation_rate);
+		ofdm->FIR_tx2.apply(data_container->passband_data_tx_filtered_fir_1,data_container->passband_data_tx_filtered_fir_2,data_container->Nofdm*frequency_interpolation_rate);
 
-		ofdm.passband_to_baseband(data_container.passband_data_tx_filtered_fir_2,data_container.Nofdm*frequency_interpolation_rate,data_container.baseband_data,sampling_frequency,carrier_frequency,carrier_amplitude,data_container.interpolation_rate,&ofdm.FIR_rx_data);
-		ofdm.symbol_demod(data_container.baseband_data,data_container.ofdm_symbol_demodulated_data);
+		ofdm->passband_to_baseband(data_container->passband_data_tx_filtered_fir_2,data_container->Nofdm*frequency_interpolation_rate,data_container->baseband_data,sampling_frequency,carrier_frequency,carrier_amplitude,data_container->interpolation_rate,&ofdm->FIR_rx_data);
+		ofdm->symbol_demod(data_container->baseband_data,data_container->ofdm_symbol_demodulated_data);
 
-		for(int i=0;i<data_container.Nc;i++)
+		for(int i=0;i<data_container->Nc;i++)
 		{
-			pre_equalization_channel[i].value+=data_container.modulated_data[i]/data_container.ofdm_symbol_demodulated_data[i];
+			pre_equalization_channel[i].value+=data_container->modulated_data[i]/data_container->ofdm_symbol_demodulated_data[i];
 		}
 	}
 
-	for(int i=0;i<data_container.Nc;i++)
+	for(int i=0;i<data_container->Nc;i++)
 	{
 		pre_equalization_channel[i].value/=nTries;
 	}
@@ -0,0 +1,137 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "physical_layer/worker_pool.h"
+#include <cassert>
+
+cl_worker_pool::cl_worker_pool()
+{
+	job=NULL;
+	nTasks=0;
+	next_task=0;
+	nBusy=0;
+	generation=0;
+	quit=0;
+	running=0;
+	nThreads=1;
+}
+
+cl_worker_pool::~cl_worker_pool()
+{
+	deinit();
+}
+
+void cl_worker_pool::init(int nThreads)
+{
+	deinit();
+	if(nThreads<1)
+	{
+		nThreads=1;
+	}
+	this->nThreads=nThreads;
+	quit=0;
+	for(int i=1;i<nThreads;i++)
+	{
+		threads.push_back(std::thread(&cl_worker_pool::work,this,i));
+	}
+}
+
+void cl_worker_pool::deinit()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit=1;
+	}
+	job_ready.notify_all();
+	for(unsigned int i=0;i<threads.size();i++)
+	{
+		threads[i].join();
+	}
+	threads.clear();
+	nThreads=1;
+}
+
+void cl_worker_pool::work_tasks(int worker)
+{
+	int i;
+	while((i=next_task++)<nTasks)
+	{
+		(*job)(i,worker);
+	}
+}
+
+void cl_worker_pool::work(int worker)
+{
+	long long done_generation=0;
+	while(1)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			job_ready.wait(lock,[this,done_generation](){return quit || generation!=done_generation;});
+			if(quit)
+			{
+				return;
+			}
+			done_generation=generation;
+		}
+		work_tasks(worker);
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			nBusy--;
+		}
+		job_done.notify_one();
+	}
+}
+
+void cl_worker_pool::run(int nTasks, const std::function<void(int,int)>& task)
+{
+	// One job at a time: a second caller would hand the running job's workers a new one.
+	int was_running=running.exchange(1);
+	assert(was_running==0);
+	(void)was_running;
+
+	if(threads.empty() || nTasks<=1)
+	{
+		for(int i=0;i<nTasks;i++)
+		{
+			task(i,0);
+		}
+		running=0;
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job=&task;
+		this->nTasks=nTasks;
+		next_task=0;
+		nBusy=(int)threads.size();
+		generation++;
+	}
+	job_ready.notify_all();
+	work_tasks(0);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	job_done.wait(lock,[this](){return nBusy==0;});
+	job=NULL;
+	running=0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Standalone LDPC decoder benchmark (make bench-ldpc).
+// For every Mercury rate and decoding algorithm, random codewords are BPSK modulated over AWGN at
+// a fixed Eb/N0 and seed, then decoded one at a time, or -b at a time through decode_batch(). The
+// data bits and the noise both come from the seed. Results are printed as CSV on stdout; in batch
+// mode the latency is the one of a decode_batch() call.
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include "physical_layer/ldpc.h"
+#include "physical_layer/awgn.h"
+#include "common/os_interop.h"
+
+static const int rates[]={1,2,3,4,5,6,8,14};
+static const char* algorithm_names[]={"GBF","SPA","MS","LAYERED_MS","SIMD_MS"};
+
+static void usage(const char* name)
+{
+	printf("Usage: %s [-e EbN0_dB] [-n frames] [-s seed] [-r rate_x16] [-a algorithm] [-b batch] [-t threads]\n", name);
+	printf("  -e  Eb/N0 in dB (default 3.0)\n");
+	printf("  -n  frames per rate and algorithm (default 200)\n");
+	printf("  -s  random seed (default 1)\n");
+	printf("  -r  only the rate r/16 (default all)\n");
+	printf("  -a  only the algorithm GBF=%d SPA=%d MS=%d LAYERED_MS=%d SIMD_MS=%d (default all)\n", GBF, SPA, LDPC_MS, LAYERED_MS, SIMD_MS);
+	printf("  -b  codewords per decode_batch() call, 0 decodes one at a time with decode() (default 0)\n");
+	printf("  -t  decode_batch() threads, 0 for one per hardware thread (default 0)\n");
+}
+
+int main(int argc, char *argv[])
+{
+	double EbN0=3.0;
+	int nFrames=200;
+	long seed=1;
+	int only_rate=-1;
+	int only_algorithm=-1;
+	int batch=0;
+	int nThreads=0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "he:n:s:r:a:b:t:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'e':
+			EbN0=atof(optarg);
+			break;
+		case 'n':
+			nFrames=atoi(optarg);
+			break;
+		case 's':
+			seed=atol(optarg);
+			break;
+		case 'r':
+			only_rate=atoi(optarg);
+			break;
+		case 'a':
+			only_algorithm=atoi(optarg);
+			break;
+		case 'b':
+			batch=atoi(optarg);
+			break;
+		case 't':
+			nThreads=atoi(optarg);
+			break;
+		default:
+			usage(argv[0]);
+			return (opt=='h')?0:1;
+		}
+	}
+	if(nFrames<=0 || seed<=0 || batch<0 || nThreads<0)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	printf("algorithm,rate,EbN0_dB,frames,batch,threads,frames_per_s,mean_latency_us,p99_latency_us,avg_iterations,FER\n");
+
+	for(int algorithm=GBF;algorithm<=SIMD_MS;algorithm++)
+	{
+		if(only_algorithm!=-1 && algorithm!=only_algorithm)
+		{
+			continue;
+		}
+		for(unsigned int r=0;r<sizeof(rates)/sizeof(rates[0]);r++)
+		{
+			if(only_rate!=-1 && rates[r]!=only_rate)
+			{
+				continue;
+			}
+
+			// Same decoder settings as the modem defaults in physical_config.cc.
+			cl_ldpc ldpc;
+			ldpc.standard=MERCURY;
+			ldpc.framesize=MERCURY_NORMAL;
+			ldpc.rate=(float)rates[r]/16.0;
+			ldpc.decoding_algorithm=algorithm;
+			ldpc.GBF_eta=0.5;
+			ldpc.MS_alpha=0.9;
+			ldpc.MS_beta=0;
+			ldpc.nIteration_max=50;
+			ldpc.nThreads=(batch>0)?nThreads:1;
+			ldpc.print_nIteration=NO;
+			ldpc.init();
+
+			// Every rate and algorithm sees the same data and noise.
+			__srandom(seed);
+			cl_awgn awgn;
+			awgn.set_seed(seed);
+
+			double sigma=sqrt(1.0/(2.0*ldpc.rate*pow(10.0,EbN0/10.0)));
+			int nBatch=(batch>0)?batch:1;
+			std::vector<int> data(nBatch*ldpc.K),encoded_data(ldpc.N),decoded_data(nBatch*ldpc.K+ldpc.N),iterations_done(nBatch);
+			std::vector<float> llr(nBatch*ldpc.N);
+			std::vector<double> latency;
+			st_ldpc_workspace workspace=st_ldpc_workspace();
+			ldpc.init_workspace(&workspace);
+			long iterations=0;
+			int frame_errors=0;
+
+			for(int f=0;f<nFrames;f+=nBatch)
+			{
+				int nCodewords=std::min(nBatch,nFrames-f);
+				for(int c=0;c<nCodewords;c++)
+				{
+					for(int i=0;i<ldpc.K;i++)
+					{
+						data[c*ldpc.K+i]=__random()%2;
+					}
+					ldpc.encode(&data[c*ldpc.K],encoded_data.data());
+					for(int i=0;i<ldpc.N;i++)
+					{
+						double y=(encoded_data[i]?-1.0:1.0)+sigma*awgn.awgn_value_generator();
+						llr[c*ldpc.N+i]=(float)(2.0*y/(sigma*sigma));
+					}
+				}
+
+				std::chrono::steady_clock::time_point start=std::chrono::steady_clock::now();
+				if(batch>0)
+				{
+					ldpc.decode_batch(llr.data(),decoded_data.data(),nCodewords,iterations_done.data());
+				}
+				else
+				{
+					iterations_done[0]=ldpc.decode(llr.data(),decoded_data.data(),&workspace);
+				}
+				latency.push_back(std::chrono::duration<double,std::micro>(std::chrono::steady_clock::now()-start).count());
+
+				for(int c=0;c<nCodewords;c++)
+				{
+					iterations+=iterations_done[c];
+					for(int i=0;i<ldpc.K;i++)
+					{
+						if(decoded_data[c*ldpc.K+i]!=data[c*ldpc.K+i])
+						{
+							frame_errors++;
+							break;
+						}
+					}
+				}
+			}
+
+			double total=0;
+			for(unsigned int l=0;l<latency.size();l++)
+			{
+				total+=latency[l];
+			}
+			std::sort(latency.begin(),latency.end());
+			int p99_index=(int)ceil(0.99*latency.size())-1;
+
+			printf("%s,%d/16,%.2f,%d,%d,%d,%.1f,%.1f,%.1f,%.2f,%.4f\n",algorithm_names[algorithm],rates[r],EbN0,nFrames,batch,
+					(batch>0)?ldpc.get_nThreads():1,(total>0)?nFrames/(total*1e-6):0.0,total/latency.size(),latency[p99_index],
+					(double)iterations/nFrames,(double)frame_errors/nFrames);
+			fflush(stdout);
+			ldpc.deinit_workspace(&workspace);
+			ldpc.deinit();
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,711 @@
+/*
+ * Mercury: A configurable open-source software-defined modem.
+ * Copyright (C) 2022-2024 Fadi Jerji
+ * Author: Fadi Jerji
+ * Email: fadi.jerji@  <gmail.com, caisresearch.com, ieee.org>
+ * ORCID: 0000-0002-2076-5831
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, version 3 of the
+ * License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Equivalence checks of the optimized PHY kernels (make check-equivalence).
+// Every kernel runs next to the scalar path it replaced, or a direct evaluation of what it
+// computes, on the same seeded input. One CSV line per check on stdout: bit exact checks count
+// mismatching cases, the others also give the largest error against their tolerance. The exit
+// status is 1 when a check fails.
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <unistd.h>
+#include "physical_layer/ldpc.h"
+#include "physical_layer/awgn.h"
+#include "physical_layer/misc.h"
+#include "physical_layer/interleaver.h"
+#include "physical_layer/psk.h"
+#include "physical_layer/fir_filter.h"
+#include "physical_layer/nco.h"
+#include "physical_layer/fft.h"
+#include "common/os_interop.h"
+
+static const int rates[]={1,2,3,4,5,6,8,14};
+static const int modulations[]={MOD_BPSK,MOD_QPSK,MOD_8PSK,MOD_16QAM,MOD_32QAM,MOD_64QAM};
+static int nFailed=0;
+
+static void usage(const char* name)
+{
+	printf("Usage: %s [-n cases] [-s seed]\n", name);
+	printf("  -n  random cases per check (default 50)\n");
+	printf("  -s  random seed (default 1)\n");
+}
+
+static uint64_t random_word()
+{
+	uint64_t word=0;
+	for(int i=0;i<4;i++)
+	{
+		word=(word<<16)|(uint64_t)(__random()&0xffff);
+	}
+	return word;
+}
+
+static int same_words(const uint64_t* a, const uint64_t* b, int nWords)
+{
+	for(int i=0;i<nWords;i++)
+	{
+		if(a[i]!=b[i])
+		{
+			return NO;
+		}
+	}
+	return YES;
+}
+
+static double random_sample()
+{
+	return 2.0*__random()/2147483647.0-1.0;
+}
+
+static void report(const char* check, int nCases, int nMismatches, double max_error, double tolerance)
+{
+	int passed=(nMismatches==0 && max_error<=tolerance);
+	if(!passed)
+	{
+		nFailed++;
+	}
+	printf("%s,%d,%d,%.3g,%.3g,%s\n",check,nCases,nMismatches,max_error,tolerance,passed?"OK":"FAIL");
+	fflush(stdout);
+}
+
+// Same decoder settings as the modem defaults in physical_config.cc.
+static void init_ldpc(cl_ldpc* ldpc, int rate, int algorithm)
+{
+	ldpc->standard=MERCURY;
+	ldpc->framesize=MERCURY_NORMAL;
+	ldpc->rate=(float)rate/16.0;
+	ldpc->decoding_algorithm=algorithm;
+	ldpc->GBF_eta=0.5;
+	ldpc->MS_alpha=0.9;
+	ldpc->MS_beta=0;
+	ldpc->nIteration_max=50;
+	ldpc->nThreads=1;
+	ldpc->print_nIteration=NO;
+	ldpc->init();
+}
+
+// SIMD_MS: the vector kernel picked for the CPU against the scalar kernel on the same row groups.
+// Eb/N0 sweeps 0 to 4 dB over the cases, so converged and failed codewords are both seen. Decoded
+// bits and iteration counts must be identical.
+static void check_SIMD_MS(int nCases, long seed)
+{
+	for(unsigned int r=0;r<sizeof(rates)/sizeof(rates[0]);r++)
+	{
+		cl_ldpc ldpc;
+		init_ldpc(&ldpc,rates[r],SIMD_MS);
+		int cpu_kernel=ldpc.get_SIMD_MS_kernel();
+		if(cpu_kernel==SIMD_MS_KERNEL_SCALAR)
+		{
+			printf("SIMD_MS %d/16,0,0,0,0,SKIP (no vector kernel on this CPU)\n",rates[r]);
+			continue;
+		}
+
+		__srandom(seed);
+		cl_awgn awgn;
+		awgn.set_seed(seed);
+		std::vector<int> data(ldpc.K),encoded_data(ldpc.N),decoded_vector(ldpc.N),decoded_scalar(ldpc.N);
+		std::vector<float> llr(ldpc.N);
+		st_ldpc_workspace workspace=st_ldpc_workspace();
+		ldpc.init_workspace(&workspace);
+		int nMismatches=0;
+
+		for(int c=0;c<nCases;c++)
+		{
+			for(int i=0;i<ldpc.K;i++)
+			{
+				data[i]=__random()%2;
+			}
+			ldpc.encode(data.data(),encoded_data.data());
+			double EbN0=4.0*c/nCases;
+			double sigma=sqrt(1.0/(2.0*ldpc.rate*pow(10.0,EbN0/10.0)));
+			for(int i=0;i<ldpc.N;i++)
+			{
+				double y=(encoded_data[i]?-1.0:1.0)+sigma*awgn.awgn_value_generator();
+				llr[i]=(float)(2.0*y/(sigma*sigma));
+			}
+
+			ldpc.set_SIMD_MS_kernel(cpu_kernel);
+			int iterations_vector=ldpc.decode(llr.data(),decoded_vector.data(),&workspace);
+			ldpc.set_SIMD_MS_kernel(SIMD_MS_KERNEL_SCALAR);
+			int iterations_scalar=ldpc.decode(llr.data(),decoded_scalar.data(),&workspace);
+
+			int same=(iterations_vector==iterations_scalar);
+			for(int i=0;same && i<ldpc.K;i++)
+			{
+				same=(decoded_vector[i]==decoded_scalar[i]);
+			}
+			nMismatches+=!same;
+		}
+
+		char name[64];
+		snprintf(name,sizeof(name),"SIMD_MS %d/16",rates[r]);
+		report(name,nCases,nMismatches,0,0);
+		ldpc.deinit_workspace(&workspace);
+		ldpc.deinit();
+	}
+}
+
+// Packed TX path: every packed kernel against its int version, or a bit by bit loop, on random
+// lengths and offsets. Words past the range written are filled with random bits first and have
+// to come out unchanged. All checks are bit exact.
+static void check_packed(int nCases, long seed)
+{
+	const int nWords=N_MAX_WORDS+2;
+	std::vector<uint64_t> in(nWords),out(nWords),expected(nWords),sequence(nWords);
+	std::vector<int> bits(N_MAX),bits_out(N_MAX),bits_sequence(N_MAX),bits_expected(N_MAX);
+	int nMismatches;
+	char name[64];
+	__srandom(seed);
+
+	for(unsigned int r=0;r<sizeof(rates)/sizeof(rates[0]);r++)
+	{
+		cl_ldpc ldpc;
+		init_ldpc(&ldpc,rates[r],SIMD_MS);
+		std::vector<int> data(ldpc.K),encoded_data(ldpc.N);
+		nMismatches=0;
+		for(int c=0;c<nCases;c++)
+		{
+			for(int i=0;i<ldpc.K;i++)
+			{
+				data[i]=__random()%2;
+			}
+			ldpc.encode(data.data(),encoded_data.data());
+			bit_to_packed_bit(data.data(),in.data(),ldpc.K);
+			ldpc.encode(in.data(),out.data());
+			packed_bit_to_bit(out.data(),bits_out.data(),ldpc.N);
+			int same=YES;
+			for(int i=0;same && i<ldpc.N;i++)
+			{
+				same=(bits_out[i]==encoded_data[i]);
+			}
+			nMismatches+=!same;
+		}
+		snprintf(name,sizeof(name),"packed encode %d/16",rates[r]);
+		report(name,nCases,nMismatches,0,0);
+		ldpc.deinit();
+	}
+
+	nMismatches=0;
+	for(int c=0;c<nCases;c++)
+	{
+		int nBits=1+__random()%N_MAX;
+		for(int i=0;i<nBits;i++)
+		{
+			bits[i]=__random()%2;
+		}
+		for(int i=0;i<nWords;i++)
+		{
+			out[i]=random_word();
+		}
+		bit_to_packed_bit(bits.data(),out.data(),nBits);
+		packed_bit_to_bit(out.data(),bits_out.data(),nBits);
+		int same=YES;
+		for(int i=0;same && i<nBits;i++)
+		{
+			same=(get_packed_bit(out.data(),i)==bits[i] && bits_out[i]==bits[i]);
+		}
+		// The last word is cleared past nBits.
+		for(int i=nBits;same && i<(nBits+63)/64*64;i++)
+		{
+			same=(get_packed_bit(out.data(),i)==0);
+		}
+		nMismatches+=!same;
+	}
+	report("bit_to_packed_bit/packed_bit_to_bit",nCases,nMismatches,0,0);
+
+	nMismatches=0;
+	for(int c=0;c<nCases;c++)
+	{
+		// Every other case copies inside one array, overlapping when the offsets are close.
+		int in_place=c%2;
+		int nBits=__random()%(N_MAX/2+1);
+		int in_offset=__random()%(N_MAX/2);
+		int out_offset=in_place?in_offset+__random()%130:__random()%(N_MAX/2);
+		for(int i=0;i<nWords;i++)
+		{
+			in[i]=random_word();
+			out[i]=in_place?in[i]:random_word();
+		}
+		expected=out;
+		const uint64_t* source=in_place?expected.data():in.data();
+		for(int i=0;i<nBits;i++)
+		{
+			set_packed_bit(expected.data(),out_offset+i,get_packed_bit(source,in_offset+i));
+		}
+		packed_bit_copy(in_place?out.data():in.data(),in_offset,out.data(),out_offset,nBits);
+		nMismatches+=!same_words(out.data(),expected.data(),nWords);
+	}
+	report("packed_bit_copy",nCases,nMismatches,0,0);
+
+	nMismatches=0;
+	for(int c=0;c<nCases;c++)
+	{
+		int nItems=1+__random()%N_MAX;
+		int block_size=1+__random()%nItems;
+		for(int i=0;i<nItems;i++)
+		{
+			bits[i]=__random()%2;
+		}
+		interleaver(bits.data(),bits_expected.data(),nItems,block_size);
+		bit_to_packed_bit(bits.data(),in.data(),nItems);
+		interleaver(in.data(),out.data(),nItems,block_size);
+		packed_bit_to_bit(out.data(),bits_out.data(),nItems);
+		int same=YES;
+		for(int i=0;same && i<nItems;i++)
+		{
+			same=(bits_out[i]==bits_expected[i]);
+		}
+		nMismatches+=!same;
+	}
+	report("packed interleaver",nCases,nMismatches,0,0);
+
+	nMismatches=0;
+	for(int c=0;c<nCases;c++)
+	{
+		int nItems=1+__random()%N_MAX;
+		for(int i=0;i<nItems;i++)
+		{
+			bits[i]=__random()%2;
+			bits_sequence[i]=__random()%2;
+		}
+		bit_energy_dispersal(bits.data(),bits_sequence.data(),bits_expected.data(),nItems);
+		bit_to_packed_bit(bits.data(),in.data(),nItems);
+		bit_to_packed_bit(bits_sequence.data(),sequence.data(),nItems);
+		for(int i=0;i<nWords;i++)
+		{
+			out[i]=random_word();
+		}
+		expected=out;
+		for(int i=0;i<nItems;i++)
+		{
+			set_packed_bit(expected.data(),i,bits_expected[i]);
+		}
+		bit_energy_dispersal(in.data(),sequence.data(),out.data(),nItems);
+		nMismatches+=!same_words(out.data(),expected.data(),nWords);
+	}
+	report("packed bit_energy_dispersal",nCases,nMismatches,0,0);
+
+	for(unsigned int m=0;m<sizeof(modulations)/sizeof(modulations[0]);m++)
+	{
+		cl_psk psk;
+		psk.set_predefined_constellation(modulations[m]);
+		int nBits=(int)log2(modulations[m]);
+		int nSymbols=N_MAX/nBits;
+		std::vector<sample_complex> symbols(nSymbols),symbols_packed(nSymbols);
+		nMismatches=0;
+		for(int c=0;c<nCases;c++)
+		{
+			for(int i=0;i<nSymbols*nBits;i++)
+			{
+				bits[i]=__random()%2;
+			}
+			psk.mod(bits.data(),nSymbols*nBits,symbols.data());
+			bit_to_packed_bit(bits.data(),in.data(),nSymbols*nBits);
+			psk.mod(in.data(),nSymbols*nBits,symbols_packed.data());
+			int same=YES;
+			for(int i=0;same && i<nSymbols;i++)
+			{
+				same=(symbols[i]==symbols_packed[i]);
+			}
+			nMismatches+=!same;
+		}
+		snprintf(name,sizeof(name),"packed psk mod M=%d",modulations[m]);
+		report(name,nCases,nMismatches,0,0);
+		psk.deinit();
+	}
+}
+
+// FIR: block, decimating and stream filtering against the direct time domain sum of
+// apply(in,out,nItems,first,last), with taps below and above FIR_FFT_MIN_TAPS so that both the
+// direct and the overlap-save paths run. Inputs are within [-1,1], the error is absolute.
+static void check_FIR(int nCases, long seed)
+{
+	const double transition_bandwidth[]={4000,1000,200};
+	const double tolerance=100*std::numeric_limits<sample_real>::epsilon();
+	char name[64];
+	__srandom(seed);
+
+	for(unsigned int t=0;t<sizeof(transition_bandwidth)/sizeof(transition_bandwidth[0]);t++)
+	{
+		cl_FIR fir;
+		fir.filter_window=HAMMING;
+		fir.filter_transition_bandwidth=transition_bandwidth[t];
+		fir.lpf_filter_cut_frequency=3000;
+		fir.hpf_filter_cut_frequency=300;
+		fir.sampling_frequency=48000;
+		fir.type=(t%2==0)?LPF:HPF;
+		fir.design();
+		int center=(fir.filter_nTaps-1)/2;
+
+		const int nItems_max=16384;
+		std::vector<sample_complex> in(nItems_max),out(nItems_max),reference(nItems_max);
+		std::vector<double> in_real(nItems_max),out_real(nItems_max);
+		double max_error[4]={0,0,0,0};
+
+		for(int c=0;c<nCases;c++)
+		{
+			int nItems=1+__random()%nItems_max;
+			for(int i=0;i<nItems;i++)
+			{
+				in[i]=sample_complex(random_sample(),random_sample());
+			}
+			fir.apply(in.data(),reference.data(),nItems,0,nItems);
+
+			fir.apply(in.data(),out.data(),nItems);
+			for(int i=0;i<nItems;i++)
+			{
+				max_error[0]=std::max(max_error[0],(double)std::abs(out[i]-reference[i]));
+			}
+
+			int decimation_rate=1+__random()%8;
+			fir.apply_decimate(in.data(),out.data(),nItems,decimation_rate);
+			for(int m=0;m*decimation_rate<nItems;m++)
+			{
+				max_error[1]=std::max(max_error[1],(double)std::abs(out[m]-reference[m*decimation_rate]));
+			}
+
+			// Real input: the imaginary part of the reference is left out.
+			for(int i=0;i<nItems;i++)
+			{
+				in_real[i]=in[i].real();
+				in[i]=sample_complex(in[i].real(),0);
+			}
+			fir.apply(in.data(),reference.data(),nItems,0,nItems);
+			fir.apply(in_real.data(),out_real.data(),nItems);
+			for(int i=0;i<nItems;i++)
+			{
+				max_error[2]=std::max(max_error[2],fabs(out_real[i]-reference[i].real()));
+			}
+
+			// The stream in chunks of random length lags the block output by (nTaps-1)/2.
+			fir.reset_stream();
+			for(int done=0;done<nItems;)
+			{
+				int chunk=1+__random()%(nItems-done);
+				fir.apply_stream(&in_real[done],&out_real[done],chunk);
+				done+=chunk;
+			}
+			for(int i=center;i<nItems;i++)
+			{
+				max_error[3]=std::max(max_error[3],fabs(out_real[i]-reference[i-center].real()));
+			}
+		}
+
+		const char* variant[4]={"apply complex","apply_decimate","apply real","apply_stream"};
+		for(int v=0;v<4;v++)
+		{
+			snprintf(name,sizeof(name),"FIR %d taps %s",fir.filter_nTaps,variant[v]);
+			report(name,nCases,0,max_error[v],tolerance);
+		}
+		fir.deinit();
+	}
+}
+
+// NCO: mix_down and mix_up against one cos()/sin() per sample, on a stream split into calls of
+// random length. The reference phase is initial_phase+i*increment in long double, with the
+// increment the NCO holds: its rounding to double is the NCO resolution, not a kernel error.
+// The phase left in the NCO is checked too, as a distance in cycles.
+static void check_NCO(int nCases, long seed)
+{
+	const double sampling_frequency=48000;
+	// The phase accumulator is double in both builds and takes a rounding per call and per block.
+	const double tolerance=1e5*std::numeric_limits<double>::epsilon()+100*std::numeric_limits<sample_real>::epsilon();
+	const int nItems=20000;
+	std::vector<double> in_real(nItems),out_real(nItems);
+	std::vector<sample_complex> in(nItems),out(nItems);
+	double max_error[3]={0,0,0};
+	__srandom(seed);
+
+	for(int c=0;c<nCases;c++)
+	{
+		double frequency=sampling_frequency*random_sample()/2.0;
+		double amplitude=1.0+random_sample()/2.0;
+		double initial_phase=(random_sample()+1.0)/2.0;
+		for(int i=0;i<nItems;i++)
+		{
+			in_real[i]=random_sample();
+			in[i]=sample_complex(random_sample(),random_sample());
+		}
+
+		for(int direction=0;direction<2;direction++)
+		{
+			cl_nco nco;
+			nco.set_frequency(frequency,sampling_frequency);
+			nco.set_phase(initial_phase);
+			for(int done=0;done<nItems;)
+			{
+				int chunk=1+__random()%(nItems-done<1000?nItems-done:1000);
+				if(direction==0)
+				{
+					nco.mix_down(&in_real[done],&out[done],chunk,amplitude);
+				}
+				else
+				{
+					nco.mix_up(&in[done],&out_real[done],chunk,amplitude);
+				}
+				done+=chunk;
+			}
+
+			double phase_increment=frequency/sampling_frequency;
+			phase_increment-=floor(phase_increment);
+			long double phase=0;
+			for(int i=0;i<=nItems;i++)
+			{
+				phase=initial_phase+(long double)i*phase_increment;
+				if(i==nItems)
+				{
+					break;
+				}
+				long double angle=2.0L*M_PI*(phase-floorl(phase));
+				double carrier_real=amplitude*(double)cosl(angle);
+				double carrier_imag=amplitude*(double)sinl(angle);
+				double error;
+				if(direction==0)
+				{
+					error=std::abs(out[i]-sample_complex(in_real[i]*carrier_real,in_real[i]*carrier_imag));
+				}
+				else
+				{
+					error=fabs(out_real[i]-(in[i].real()*carrier_real+in[i].imag()*carrier_imag));
+				}
+				max_error[direction]=std::max(max_error[direction],error);
+			}
+			double phase_error=fabs((double)(phase-floorl(phase))-nco.phase);
+			max_error[2]=std::max(max_error[2],std::min(phase_error,1.0-phase_error));
+		}
+	}
+	report("NCO mix_down",nCases,0,max_error[0],tolerance);
+	report("NCO mix_up",nCases,0,max_error[1],tolerance);
+	report("NCO phase",nCases,0,max_error[2],tolerance);
+}
+
+// FFT: the shared complex plans in both directions and the real input plan against a direct DFT
+// in long double, unscaled like the plans. The case number picks the size, 2 to 4096 points (4 for
+// the real plan). Inputs are within [-1,1], the error is divided by sqrt(n).
+static void check_FFT(int nCases, long seed)
+{
+	const int log2_n_max=12;
+	const double tolerance=100*std::numeric_limits<sample_real>::epsilon();
+	const int n_max=1<<log2_n_max;
+	std::vector<sample_complex> v(n_max),out(n_max/2+1);
+	std::vector<sample_real> in_real(n_max);
+	std::vector<long double> in_r(n_max),in_i(n_max),twiddle_real(n_max),twiddle_imag(n_max);
+	double max_error[3]={0,0,0};
+	__srandom(seed);
+
+	for(int c=0;c<nCases;c++)
+	{
+		int n=1<<(1+c%log2_n_max);
+		for(int k=0;k<n;k++)
+		{
+			twiddle_real[k]=cosl(2.0L*M_PI*k/n);
+			twiddle_imag[k]=sinl(2.0L*M_PI*k/n);
+		}
+		for(int kind=0;kind<3;kind++)
+		{
+			int direction=(kind==1)?FFT_INVERSE:FFT_FORWARD;
+			if(kind==2 && n<4)
+			{
+				continue;
+			}
+			for(int i=0;i<n;i++)
+			{
+				v[i]=sample_complex(random_sample(),(kind==2)?0:random_sample());
+				in_real[i]=v[i].real();
+				in_r[i]=v[i].real();
+				in_i[i]=v[i].imag();
+			}
+			int nBins=n;
+			if(kind==2)
+			{
+				cl_fft_plan::get_real(n)->execute(in_real.data(),out.data());
+				nBins=n/2+1;
+			}
+			else
+			{
+				cl_fft_plan::get(n,direction)->execute(v.data());
+			}
+
+			for(int k=0;k<nBins;k++)
+			{
+				long double acc_r=0,acc_i=0;
+				for(int i=0;i<n;i++)
+				{
+					long double w_r=twiddle_real[((long)i*k)%n];
+					long double w_i=(direction==FFT_INVERSE)?twiddle_imag[((long)i*k)%n]:-twiddle_imag[((long)i*k)%n];
+					acc_r+=in_r[i]*w_r-in_i[i]*w_i;
+					acc_i+=in_r[i]*w_i+in_i[i]*w_r;
+				}
+				sample_complex result=(kind==2)?out[k]:v[k];
+				double error=hypot((double)(result.real()-acc_r),(double)(result.imag()-acc_i))/sqrt((double)n);
+				max_error[kind]=std::max(max_error[kind],error);
+			}
+		}
+	}
+	report("FFT complex forward",nCases,0,max_error[0],tolerance);
+	report("FFT complex inverse",nCases,0,max_error[1],tolerance);
+	report("FFT real",nCases,0,max_error[2],tolerance);
+}
+
+// PSK demapper: the kernel picked for the CPU and the scalar kernel against a brute force max-log
+// demapper in double over all the constellation points, BPSK to 64QAM, half of the cases through a
+// random out_index. The points come from mod() of each index, MSB first. The error is scaled by
+// variance/(1+|y|^2), the size of the terms the float kernels cancel. The two kernels evaluate
+// the same metrics in the same order, a case where their LLRs differ at all counts as a mismatch.
+static void check_PSK_demod(int nCases, long seed)
+{
+	const double tolerance=1e-5;
+	char name[64];
+	__srandom(seed);
+
+	for(unsigned int m=0;m<sizeof(modulations)/sizeof(modulations[0]);m++)
+	{
+		int M=modulations[m];
+		int nBits=(int)log2(M);
+		int nSymbols=N_MAX/nBits;
+		int nItems=nSymbols*nBits;
+		cl_psk psk;
+		psk.set_predefined_constellation(M);
+		int cpu_kernel=psk.get_demod_kernel();
+
+		std::vector<sample_complex> points(M),symbols(nSymbols);
+		std::vector<int> index_bits(nBits),out_index(nItems);
+		std::vector<float> llr_cpu(nItems),llr_scalar(nItems);
+		for(int j=0;j<M;j++)
+		{
+			for(int k=0;k<nBits;k++)
+			{
+				index_bits[k]=(j>>(nBits-1-k))&1;
+			}
+			psk.mod(index_bits.data(),nBits,&points[j]);
+		}
+
+		double max_error[2]={0,0};
+		int nMismatches=0;
+		for(int c=0;c<nCases;c++)
+		{
+			float variance=(float)pow(10.0,-2.0*(random_sample()+1.0)/2.0-0.5);
+			double sigma=sqrt(variance/2.0);
+			for(int s=0;s<nSymbols;s++)
+			{
+				symbols[s]=points[__random()%M]+sample_complex(sigma*random_sample()*2.0,sigma*random_sample()*2.0);
+			}
+			for(int i=0;i<nItems;i++)
+			{
+				out_index[i]=i;
+			}
+			if(c%2==1)
+			{
+				for(int i=nItems-1;i>0;i--)
+				{
+					std::swap(out_index[i],out_index[__random()%(i+1)]);
+				}
+			}
+			const int* index=(c%2==1)?out_index.data():NULL;
+
+			psk.set_demod_kernel(cpu_kernel);
+			psk.demod(symbols.data(),nItems,llr_cpu.data(),variance,index);
+			psk.set_demod_kernel(PSK_DEMOD_KERNEL_SCALAR);
+			psk.demod(symbols.data(),nItems,llr_scalar.data(),variance,index);
+			int same=YES;
+			for(int i=0;same && i<nItems;i++)
+			{
+				same=(llr_cpu[i]==llr_scalar[i]);
+			}
+			nMismatches+=!same;
+
+			for(int s=0;s<nSymbols;s++)
+			{
+				double y_r=symbols[s].real(),y_i=symbols[s].imag();
+				double scale=variance/(1.0+y_r*y_r+y_i*y_i);
+				for(int k=0;k<nBits;k++)
+				{
+					double distance_min[2]={INFINITY,INFINITY};
+					for(int j=0;j<M;j++)
+					{
+						double d_r=y_r-points[j].real(),d_i=y_i-points[j].imag();
+						int bit=(j>>k)&1;
+						distance_min[bit]=std::min(distance_min[bit],d_r*d_r+d_i*d_i);
+					}
+					double reference=(distance_min[1]-distance_min[0])/variance;
+					int i=out_index[s*nBits+nBits-1-k];
+					max_error[0]=std::max(max_error[0],fabs(llr_cpu[i]-reference)*scale);
+					max_error[1]=std::max(max_error[1],fabs(llr_scalar[i]-reference)*scale);
+				}
+			}
+		}
+
+		snprintf(name,sizeof(name),"PSK demod M=%d %s",M,(cpu_kernel==PSK_DEMOD_KERNEL_AVX2)?"AVX2":"scalar");
+		report(name,nCases,nMismatches,max_error[0],tolerance);
+		snprintf(name,sizeof(name),"PSK demod M=%d scalar",M);
+		report(name,nCases,0,max_error[1],tolerance);
+		psk.deinit();
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	int nCases=50;
+	long seed=1;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "hn:s:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n':
+			nCases=atoi(optarg);
+			break;
+		case 's':
+			seed=atol(optarg);
+			break;
+		default:
+			usage(argv[0]);
+			return (opt=='h')?0:1;
+		}
+	}
+	if(nCases<=0 || seed<=0)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	printf("check,cases,mismatches,max_error,tolerance,result\n");
+	check_SIMD_MS(nCases,seed);
+	check_packed(nCases,seed);
+	check_FIR(nCases,seed);
+	check_NCO(nCases,seed);
+	check_FFT(nCases,seed);
+	check_PSK_demod(nCases,seed);
+
+	if(nFailed>0)
+	{
+		printf("%d check(s) failed\n",nFailed);
+		return 1;
+	}
+	return 0;
+}
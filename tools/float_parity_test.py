@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""
+Float/double BER parity check for the PHY data path (make float-parity).
+Builds Mercury twice, with FLOAT_SAMPLES=0 and FLOAT_SAMPLES=1, runs
+-m PLOT_BASEBAND on each config with both builds and compares the BER curves.
+The BER test seeds its data and noise the same way in both builds, so the
+curves are expected to match up to rounding.
+
+Usage: python3 tools/float_parity_test.py [configs] [tolerance]
+  configs: comma-separated, e.g. "0,8,12" (default)
+  tolerance: largest allowed BER difference per point (default 0.001)
+
+Near the waterfall a frame may decode in one build and not in the other, the
+default tolerance allows for that.
+
+Run from the repository root. Each build is made with GUI_ENABLED=0 in its own
+copy of the sources under _float_parity/, the working tree and its objects are
+left alone. The binaries are kept as _float_parity/mercury_double and
+_float_parity/mercury_float.
+Exits with 1 when a curve differs by more than the tolerance.
+"""
+import subprocess, sys, re, shutil, os
+
+configs = [int(x) for x in sys.argv[1].split(",")] if len(sys.argv) > 1 else [0, 8, 12]
+tolerance = float(sys.argv[2]) if len(sys.argv) > 2 else 0.001
+
+build_root = "_float_parity"
+builds = {"double": "0", "float": "1"}
+
+
+def build(name, float_samples):
+    print(f"--- Building {name} (FLOAT_SAMPLES={float_samples}) ---")
+    build_dir = os.path.join(build_root, name)
+    for tree in ["include", "source"]:
+        shutil.copytree(tree, os.path.join(build_dir, tree), dirs_exist_ok=True,
+                        ignore=shutil.ignore_patterns("*.o", "*.a"))
+    shutil.copy("Makefile", build_dir)
+    subprocess.run(["make", "-j4", "GUI_ENABLED=0", f"FLOAT_SAMPLES={float_samples}", "mercury"],
+                   cwd=build_dir, check=True)
+    shutil.copy(os.path.join(build_dir, "mercury"), os.path.join(build_root, f"mercury_{name}"))
+
+
+def ber_curve(binary, config):
+    proc = subprocess.run([os.path.join(build_root, binary), "-m", "PLOT_BASEBAND", "-s", str(config)],
+                          capture_output=True, text=True, timeout=1800)
+    curve = []
+    for line in (proc.stdout + proc.stderr).split("\n"):
+        m = re.match(r'^(-?\d+(?:\.\d+)?);(\d+(?:\.\d+)?(?:e[+-]?\d+)?)$', line.strip())
+        if m:
+            curve.append((float(m.group(1)), float(m.group(2))))
+    return curve
+
+
+for name, float_samples in builds.items():
+    build(name, float_samples)
+
+failed = False
+print(f"\n{'config':>6} {'points':>6} {'max |dBER|':>10} {'result':>7}")
+for config in configs:
+    curves = {name: ber_curve(f"mercury_{name}", config) for name in builds}
+    double_curve, float_curve = curves["double"], curves["float"]
+    if not double_curve or len(double_curve) != len(float_curve):
+        print(f"{config:>6} {'-':>6} {'-':>10} {'NO DATA':>7}")
+        failed = True
+        continue
+    max_diff = max(abs(d[1] - f[1]) for d, f in zip(double_curve, float_curve))
+    ok = max_diff <= tolerance
+    failed = failed or not ok
+    print(f"{config:>6} {len(double_curve):>6} {max_diff:>10.6f} {'OK' if ok else 'DIFFER':>7}")
+    if not ok:
+        for d, f in zip(double_curve, float_curve):
+            if abs(d[1] - f[1]) > tolerance:
+                print(f"    EsN0 {d[0]:>5}: double {d[1]:.6f}  float {f[1]:.6f}")
+
+sys.exit(1 if failed else 0)